@@ -287,6 +287,60 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+// mgp_csr
+
+inline mgp_csr *graph_project_csr(mgp_graph *graph, const char *label, const char *edge_type,
+                                  const char *weight_property, double default_weight, mgp_memory *memory) {
+  return MgInvoke<mgp_csr *>(mgp_graph_project_csr, graph, label, edge_type, weight_property, default_weight, memory);
+}
+
+inline void csr_destroy(mgp_csr *csr) { mgp_csr_destroy(csr); }
+
+inline size_t csr_vertices_count(mgp_csr *csr) { return MgInvoke<size_t>(mgp_csr_vertices_count, csr); }
+
+inline size_t csr_edges_count(mgp_csr *csr) { return MgInvoke<size_t>(mgp_csr_edges_count, csr); }
+
+inline const uint64_t *csr_offsets(mgp_csr *csr) { return MgInvoke<const uint64_t *>(mgp_csr_offsets, csr); }
+
+inline const uint64_t *csr_neighbours(mgp_csr *csr) { return MgInvoke<const uint64_t *>(mgp_csr_neighbours, csr); }
+
+inline const double *csr_weights(mgp_csr *csr) { return MgInvoke<const double *>(mgp_csr_weights, csr); }
+
+inline mgp_vertex_id csr_vertex_id(mgp_csr *csr, size_t index) {
+  return MgInvoke<mgp_vertex_id>(mgp_csr_vertex_id, csr, index);
+}
+
+// mgp_property_column
+
+inline mgp_property_column *graph_property_column(mgp_graph *graph, const char *label, const char *property,
+                                                  double default_value, mgp_memory *memory) {
+  return MgInvoke<mgp_property_column *>(mgp_graph_property_column, graph, label, property, default_value, memory);
+}
+
+inline void property_column_destroy(mgp_property_column *column) { mgp_property_column_destroy(column); }
+
+inline size_t property_column_size(mgp_property_column *column) {
+  return MgInvoke<size_t>(mgp_property_column_size, column);
+}
+
+inline const double *property_column_values(mgp_property_column *column) {
+  return MgInvoke<const double *>(mgp_property_column_values, column);
+}
+
+inline const int64_t *property_column_vertex_ids(mgp_property_column *column) {
+  return MgInvoke<const int64_t *>(mgp_property_column_vertex_ids, column);
+}
+
+// Parallel execution
+
+inline size_t graph_parallel_workers(mgp_graph *graph) {
+  return MgInvoke<size_t>(mgp_graph_parallel_workers, graph);
+}
+
+inline void graph_parallel_for_vertices(mgp_graph *graph, mgp_vertices_partition_cb cb, void *payload) {
+  MgInvokeVoid(mgp_graph_parallel_for_vertices, graph, cb, payload);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
@@ -760,12 +814,73 @@ inline void result_record_insert(mgp_result_record *record, const char *field_na
   MgInvokeVoid(mgp_result_record_insert, record, field_name, val);
 }
 
+// Commit hooks
+
+inline void module_add_commit_hook(mgp_module *module, const char *name, mgp_commit_hook_cb cb) {
+  MgInvokeVoid(mgp_module_add_commit_hook, module, name, cb);
+}
+
+inline uint64_t commit_changes_timestamp(mgp_commit_changes *changes) {
+  return MgInvoke<uint64_t>(mgp_commit_changes_timestamp, changes);
+}
+
+inline size_t commit_changes_size(mgp_commit_changes *changes) {
+  return MgInvoke<size_t>(mgp_commit_changes_size, changes);
+}
+
+inline mgp_commit_change commit_changes_at(mgp_commit_changes *changes, size_t index) {
+  return MgInvoke<mgp_commit_change>(mgp_commit_changes_at, changes, index);
+}
+
+// Transformations
+
+inline void module_add_transformation(mgp_module *module, const char *name, mgp_trans_cb cb) {
+  MgInvokeVoid(mgp_module_add_transformation, module, name, cb);
+}
+
+inline size_t messages_size(mgp_messages *messages) { return MgInvoke<size_t>(mgp_messages_size, messages); }
+
+inline mgp_message *messages_at(mgp_messages *messages, size_t index) {
+  return MgInvoke<mgp_message *>(mgp_messages_at, messages, index);
+}
+
+inline mgp_source_type message_source_type(mgp_message *message) {
+  return MgInvoke<mgp_source_type>(mgp_message_source_type, message);
+}
+
+inline const char *message_payload(mgp_message *message) {
+  return MgInvoke<const char *>(mgp_message_payload, message);
+}
+
+inline size_t message_payload_size(mgp_message *message) {
+  return MgInvoke<size_t>(mgp_message_payload_size, message);
+}
+
+inline const char *message_topic_name(mgp_message *message) {
+  return MgInvoke<const char *>(mgp_message_topic_name, message);
+}
+
+inline const char *message_key(mgp_message *message) { return MgInvoke<const char *>(mgp_message_key, message); }
+
+inline size_t message_key_size(mgp_message *message) { return MgInvoke<size_t>(mgp_message_key_size, message); }
+
+inline int64_t message_timestamp(mgp_message *message) {
+  return MgInvoke<int64_t>(mgp_message_timestamp, message);
+}
+
+inline int64_t message_offset(mgp_message *message) { return MgInvoke<int64_t>(mgp_message_offset, message); }
+
 // Function
 
 inline mgp_func *module_add_function(mgp_module *module, const char *name, mgp_func_cb cb) {
   return MgInvoke<mgp_func *>(mgp_module_add_function, module, name, cb);
 }
 
+inline mgp_func *module_add_scalar_function(mgp_module *module, const char *name, mgp_scalar_func_cb cb,
+                                            mgp_scalar_type result_type) {
+  return MgInvoke<mgp_func *>(mgp_module_add_scalar_function, module, name, cb, result_type);
+}
+
 inline void func_add_arg(mgp_func *func, const char *name, mgp_type *type) {
   MgInvokeVoid(mgp_func_add_arg, func, name, type);
 }
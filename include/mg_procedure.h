@@ -1237,6 +1237,136 @@ enum mgp_error mgp_duration_sub(struct mgp_duration *first, struct mgp_duration
 enum mgp_error mgp_vertices_iterator_next(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
 ///@}
 
+/// @name Graph Projections
+///
+/// A graph projection is a read-only copy of the vertices and the outgoing
+/// edges of a graph in the compressed sparse row (CSR) format, for algorithms
+/// which read the whole graph, often many times. The projected vertices are
+/// numbered from 0 to the number of vertices - 1. The outgoing edges of the
+/// vertex `i` are the entries `offsets[i]` to `offsets[i + 1] - 1` of the
+/// neighbours and the weights, where each neighbour is the number of the
+/// vertex the edge leads to. The projection doesn't change with the graph.
+///@{
+
+/// Read-only CSR projection of a graph.
+struct mgp_csr;
+
+/// Free the memory used by a mgp_csr.
+void mgp_csr_destroy(struct mgp_csr *csr);
+
+/// Project the graph into a mgp_csr.
+/// Only the vertices with the label named `label` and the edges of the type named `edge_type` between them are
+/// projected, or all of them if the name is NULL. The weight of an edge is the numeric value of its property named
+/// `weight_property`, or `default_weight` if the edge has no numeric value of the property. The edges have no weights
+/// if `weight_property` is NULL.
+/// The vertices are projected on multiple threads when the query is executed in parallel.
+/// Resulting mgp_csr must be freed with mgp_csr_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_csr.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `graph` is a subgraph.
+enum mgp_error mgp_graph_project_csr(struct mgp_graph *graph, const char *label, const char *edge_type,
+                                     const char *weight_property, double default_weight, struct mgp_memory *memory,
+                                     struct mgp_csr **result);
+
+/// Get the number of projected vertices.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_vertices_count(struct mgp_csr *csr, size_t *result);
+
+/// Get the number of projected edges.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_edges_count(struct mgp_csr *csr, size_t *result);
+
+/// Get the array of the offsets of the edges of each vertex, which has the number of vertices + 1 elements.
+/// The array is valid as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_offsets(struct mgp_csr *csr, const uint64_t **result);
+
+/// Get the array of the neighbours of the edges, which has the number of edges elements.
+/// The array is valid as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_neighbours(struct mgp_csr *csr, const uint64_t **result);
+
+/// Get the array of the weights of the edges, which has the number of edges elements.
+/// Result is NULL if the edges were projected without weights.
+/// The array is valid as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_weights(struct mgp_csr *csr, const double **result);
+
+/// Get the ID of the projected vertex numbered `index`.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `index` isn't less than the number of vertices.
+enum mgp_error mgp_csr_vertex_id(struct mgp_csr *csr, size_t index, struct mgp_vertex_id *result);
+///@}
+
+/// @name Property Columns
+///
+/// A property column is a read-only copy of the numeric values of a property
+/// of the vertices in a contiguous array, for modules which hand the values
+/// over in bulk, e.g. as the features of a machine learning model. The column
+/// doesn't change with the graph.
+///@{
+
+/// Read-only column of the values of a vertex property.
+struct mgp_property_column;
+
+/// Free the memory used by a mgp_property_column.
+void mgp_property_column_destroy(struct mgp_property_column *column);
+
+/// Copy the values of the property named `property` of the vertices into a mgp_property_column.
+/// Only the vertices with the label named `label` are copied, or all of them if `label` is NULL. Integer values are
+/// converted to doubles, and the vertices which have no numeric value of the property get `default_value`.
+/// The vertices are copied on multiple threads when the query is executed in parallel.
+/// Resulting mgp_property_column must be freed with mgp_property_column_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_property_column.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `graph` is a subgraph.
+enum mgp_error mgp_graph_property_column(struct mgp_graph *graph, const char *label, const char *property,
+                                         double default_value, struct mgp_memory *memory,
+                                         struct mgp_property_column **result);
+
+/// Get the number of vertices in the column.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_property_column_size(struct mgp_property_column *column, size_t *result);
+
+/// Get the array of the values, which has the size of the column elements.
+/// The array is valid as long as the mgp_property_column.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_property_column_values(struct mgp_property_column *column, const double **result);
+
+/// Get the array of the IDs of the vertices, in the order of the values.
+/// The array is valid as long as the mgp_property_column.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_property_column_vertex_ids(struct mgp_property_column *column, const int64_t **result);
+///@}
+
+/// @name Parallel Execution
+///
+/// A procedure can read the graph on the threads which execute read-only
+/// queries in parallel. The vertices are split into partitions, and each
+/// partition is passed to a callback on one of the workers. The workers see
+/// the graph as the procedure does, but they can't modify it.
+///@{
+
+/// Callback reading a partition of the vertices.
+/// The callback owns `vertices`, which must be freed with mgp_vertices_iterator_destroy. The vertices belong to a
+/// read-only graph which is valid while the callback runs, and mgp_must_abort can be called with it.
+/// `worker` is the number of the worker calling the callback, from 0 to the number returned by
+/// mgp_graph_parallel_workers - 1. A worker calls the callback for one partition at a time.
+/// `memory` is used for the allocations of the worker, and is valid while the callback runs. Its allocations count
+/// towards the memory limit of the server, and its objects are freed once the callback returns.
+typedef void (*mgp_vertices_partition_cb)(struct mgp_vertices_iterator *vertices, size_t worker,
+                                          struct mgp_memory *memory, void *payload);
+
+/// Get the maximum number of workers which call the callbacks of mgp_graph_parallel_for_vertices.
+/// Result is 1 if the query isn't executed in parallel.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_graph_parallel_workers(struct mgp_graph *graph, size_t *result);
+
+/// Split the vertices of the graph into partitions and call `cb` for each of them with the `payload`.
+/// The partitions are read on the parallel execution threads and the calling thread, which waits until all of them
+/// are read. The vertices are read as a single partition on the calling thread if the query isn't executed in
+/// parallel or the graph can't be split.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the partitions.
+enum mgp_error mgp_graph_parallel_for_vertices(struct mgp_graph *graph, mgp_vertices_partition_cb cb, void *payload);
+///@}
+
 /// @name Type System
 ///
 /// The following structures and functions are used to build a type
@@ -1489,6 +1619,15 @@ enum mgp_error mgp_proc_add_result(struct mgp_proc *proc, const char *name, stru
 /// RETURN mgp_error::MGP_ERROR_LOGIC_ERROR if a result field with the same name was already added.
 enum mgp_error mgp_proc_add_deprecated_result(struct mgp_proc *proc, const char *name, struct mgp_type *type);
 
+/// Mark a read procedure as deterministic, so its records can be cached.
+///
+/// A deterministic procedure yields the same records whenever it's called with the same arguments on the same
+/// committed state of the database. Its records are then reused by the calls which see the same state, instead of
+/// running the procedure again, unless the calling transaction changed the database.
+///
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `proc` is a write or a batched procedure.
+enum mgp_error mgp_proc_set_deterministic(struct mgp_proc *proc);
+
 /// Log a message on a certain level.
 enum mgp_error mgp_log(enum mgp_log_level log_level, const char *output);
 ///@}
@@ -1612,6 +1751,91 @@ typedef void (*mgp_trans_cb)(struct mgp_messages *, struct mgp_graph *, struct m
 enum mgp_error mgp_module_add_transformation(struct mgp_module *module, const char *name, mgp_trans_cb cb);
 /// @}
 
+/// @name Commit Hooks API
+/// API for following the changes of the committed transactions, e.g. to
+/// update the state of an incremental algorithm instead of recomputing it.
+///
+/// The commit hooks are called after each transaction which changed the graph
+/// commits in the IN_MEMORY_TRANSACTIONAL storage mode, by the thread which
+/// committed it. Transactions commit concurrently, so the order of the changes
+/// is given by their commit timestamps and not by the order of the calls. The
+/// changes a replica receives from the main instance aren't passed to the
+/// hooks of the replica.
+///@{
+
+/// Net changes of a committed transaction.
+struct mgp_commit_changes;
+
+/// Type of a single change in mgp_commit_changes.
+enum mgp_commit_change_type {
+  MGP_COMMIT_CHANGE_CREATED_VERTEX,
+  MGP_COMMIT_CHANGE_CREATED_EDGE,
+  MGP_COMMIT_CHANGE_SET_VERTEX_LABEL,
+  MGP_COMMIT_CHANGE_REMOVED_VERTEX_LABEL,
+  MGP_COMMIT_CHANGE_SET_VERTEX_PROPERTY,
+  MGP_COMMIT_CHANGE_SET_EDGE_PROPERTY,
+  MGP_COMMIT_CHANGE_DELETED_EDGE,
+  MGP_COMMIT_CHANGE_DELETED_VERTEX,
+};
+
+/// A single change. Only the fields used by its type are set.
+struct mgp_commit_change {
+  enum mgp_commit_change_type type;
+  /// Changed vertex, or the start vertex of a created or deleted edge.
+  struct mgp_vertex_id vertex_id;
+  /// End vertex of a created or deleted edge.
+  struct mgp_vertex_id to_vertex_id;
+  /// Created, deleted or changed edge.
+  struct mgp_edge_id edge_id;
+  /// Type of a created or deleted edge.
+  struct mgp_edge_type edge_type;
+  /// Set or removed label.
+  struct mgp_label label;
+  /// Name of the set property.
+  const char *property_name;
+  /// Values of the property before and after the transaction. A property which
+  /// wasn't set or was removed has a null value.
+  struct mgp_value *old_value;
+  struct mgp_value *new_value;
+};
+
+/// Get the commit timestamp of the transaction.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_commit_changes_timestamp(struct mgp_commit_changes *changes, uint64_t *result);
+
+/// Get the number of changes.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_commit_changes_size(struct mgp_commit_changes *changes, size_t *result);
+
+/// Get the change at the given index.
+/// The changes are ordered by their type, as listed in mgp_commit_change_type,
+/// so the vertices are created before their edges and the edges are deleted
+/// before their vertices. An object created and deleted by the transaction
+/// isn't included, and neither are the labels and properties of the deleted
+/// objects. The strings and values of the change are owned by `changes`.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if the index is out of range.
+enum mgp_error mgp_commit_changes_at(struct mgp_commit_changes *changes, size_t index,
+                                     struct mgp_commit_change *result);
+
+/// Entry-point for a commit hook, invoked after a transaction commits.
+///
+/// Passed in arguments will not live longer than the callback's execution.
+/// Therefore, you must not store them globally or use the passed in mgp_memory
+/// to allocate global resources. The transaction is already committed, so the
+/// hook can't abort it.
+typedef void (*mgp_commit_hook_cb)(struct mgp_commit_changes *, struct mgp_memory *);
+
+/// Register a commit hook with a module.
+///
+/// The `name` must be a valid identifier, following the same rules as the
+/// procedure `name` in mgp_module_add_read_procedure.
+///
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for the hook.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid hook name.
+/// RETURN mgp_error::MGP_ERROR_LOGIC_ERROR if a commit hook with the same name was already registered.
+enum mgp_error mgp_module_add_commit_hook(struct mgp_module *module, const char *name, mgp_commit_hook_cb cb);
+///@}
+
 /// @name Memgraph Magic Functions API
 ///
 /// API for creating the Memgraph magic functions. It is used to create external-source stateless methods which can
@@ -1635,7 +1859,8 @@ struct mgp_func_context;
 /// Passed in `type` describes what kind of values can be used as the argument.
 ///
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for an argument.
-/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid argument name.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid argument name, or if `type` isn't a
+/// scalar type and the function is a scalar function.
 /// Return mgp_error::MGP_ERROR_LOGIC_ERROR if the function already has any optional argument.
 enum mgp_error mgp_func_add_arg(struct mgp_func *func, const char *name, struct mgp_type *type);
 
@@ -1657,7 +1882,8 @@ enum mgp_error mgp_func_add_arg(struct mgp_func *func, const char *name, struct
 /// `type`.
 ///
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for an argument.
-/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid argument name.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid argument name, or if `type` isn't a
+/// scalar type and the function is a scalar function.
 /// Return mgp_error::MGP_ERROR_VALUE_CONVERSION if `default_value` is a graph element (vertex, edge or path).
 /// Return mgp_error::MGP_ERROR_LOGIC_ERROR if `default_value` does not satisfy `type`.
 enum mgp_error mgp_func_add_opt_arg(struct mgp_func *func, const char *name, struct mgp_type *type,
@@ -1693,6 +1919,64 @@ enum mgp_error mgp_func_result_set_error_msg(struct mgp_func_result *result, con
 /// mgp_func_result.
 enum mgp_error mgp_func_result_set_value(struct mgp_func_result *result, struct mgp_value *value,
                                          struct mgp_memory *memory);
+
+/// Type of an argument or the result of a scalar function.
+enum mgp_scalar_type {
+  MGP_SCALAR_TYPE_BOOL,
+  MGP_SCALAR_TYPE_INT,
+  MGP_SCALAR_TYPE_DOUBLE,
+  MGP_SCALAR_TYPE_STRING,
+};
+
+/// String which isn't null-terminated.
+struct mgp_string_view {
+  const char *data;
+  size_t size;
+};
+
+/// Argument or the result of a scalar function, set in the member of `value`
+/// which matches its `type`.
+struct mgp_scalar {
+  enum mgp_scalar_type type;
+  union {
+    int bool_value;
+    int64_t int_value;
+    double double_value;
+    struct mgp_string_view string_value;
+  } value;
+};
+
+/// Entry-point for a scalar Memgraph magic function.
+///
+/// `args` holds `args_size` arguments of the types the function was
+/// registered with, including the default values of the optional arguments
+/// which weren't passed in. The callback sets the value of `result`, whose
+/// `type` is already set to the result type of the function, or sets an error
+/// message with mgp_func_result_set_error_msg on `error`.
+///
+/// Passed in arguments, including the data of the strings, will not live
+/// longer than the callback's execution. The data of a string result must be
+/// allocated with `memory` or be static, as it's copied after the callback
+/// returns.
+typedef void (*mgp_scalar_func_cb)(const struct mgp_scalar *args, size_t args_size, struct mgp_scalar *result,
+                                   struct mgp_func_result *error, struct mgp_memory *memory);
+
+/// Register a Memgraph magic function which takes and returns scalar values.
+///
+/// Scalar functions are called without converting their arguments and the
+/// result to mgp_value, which makes them much cheaper to call than the
+/// functions registered with mgp_module_add_function. Their arguments are
+/// added with mgp_func_add_arg and mgp_func_add_opt_arg, and must be of the
+/// types returned by mgp_type_bool, mgp_type_int, mgp_type_float or
+/// mgp_type_string. Null arguments are rejected before the function is called.
+///
+/// The `name` follows the same rules as the `name` in mgp_module_add_function.
+///
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate memory for mgp_func.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `name` is not a valid function name.
+/// RETURN mgp_error::MGP_ERROR_LOGIC_ERROR if a function with the same name was already registered.
+enum mgp_error mgp_module_add_scalar_function(struct mgp_module *module, const char *name, mgp_scalar_func_cb cb,
+                                              enum mgp_scalar_type result_type, struct mgp_func **result);
 /// @}
 
 #ifdef __cplusplus
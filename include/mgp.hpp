@@ -13,11 +13,13 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <map>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -220,6 +222,7 @@ class Graph {
  private:
   friend class Node;
   friend class Relationship;
+  friend class GraphProjection;
 
  public:
   explicit Graph(mgp_graph *graph);
@@ -234,6 +237,13 @@ class Graph {
   /// @brief Returns an iterable structure of the graph’s relationships.
   GraphRelationships Relationships() const;
 
+  /// @brief Returns the maximum number of workers calling the function passed to ParallelForNodes.
+  size_t ParallelWorkers() const;
+  /// @brief Splits the graph’s nodes into partitions and calls `func(nodes, worker)` for each of them on the parallel
+  /// execution threads, where `worker` is less than ParallelWorkers(). The nodes and their graph are read-only. The
+  /// first exception thrown by `func` is rethrown once all partitions are read.
+  void ParallelForNodes(const std::function<void(GraphNodes nodes, size_t worker)> &func) const;
+
   /// @brief Returns the graph node with the given ID.
   Node GetNodeById(const Id node_id) const;
 
@@ -276,6 +286,42 @@ class Graph {
   mgp_graph *graph_;
 };
 
+/// @brief Read-only projection of the graph’s nodes and their outgoing relationships in the compressed sparse row
+/// (CSR) format; wrapper class for @ref mgp_csr.
+/// The nodes are numbered from 0 to NodesCount() - 1. The relationships of the node `i` lead to the nodes
+/// Neighbours()[Offsets()[i]] to Neighbours()[Offsets()[i + 1] - 1].
+class GraphProjection {
+ public:
+  /// @brief Projects the nodes with the `label` and the relationships of the `type` between them. An empty label or
+  /// type projects all of them. The relationships are weighted by their numeric `weight_property` values, or
+  /// `default_weight` if they don’t have one, unless the property is empty.
+  explicit GraphProjection(const Graph &graph, std::string_view label = "", std::string_view type = "",
+                           std::string_view weight_property = "", double default_weight = 1.0);
+
+  GraphProjection(const GraphProjection &) = delete;
+  GraphProjection &operator=(const GraphProjection &) = delete;
+  GraphProjection(GraphProjection &&other) noexcept;
+  GraphProjection &operator=(GraphProjection &&other) noexcept;
+
+  ~GraphProjection();
+
+  size_t NodesCount() const;
+  size_t RelationshipsCount() const;
+
+  /// @brief Returns the offsets of the relationships of each node, and the number of relationships at the end.
+  std::span<const uint64_t> Offsets() const;
+  /// @brief Returns the numbers of the nodes the relationships lead to.
+  std::span<const uint64_t> Neighbours() const;
+  /// @brief Returns the weights of the relationships, which are empty if they were projected without weights.
+  std::span<const double> Weights() const;
+
+  /// @brief Returns the ID of the node with the given number.
+  Id NodeId(size_t index) const;
+
+ private:
+  mgp_csr *csr_;
+};
+
 /// @brief View of graph nodes; wrapper class for @ref mgp_vertices_iterator.
 class Nodes {
  public:
@@ -1470,6 +1516,91 @@ class Result {
 
 /* #endregion */
 
+/* #region Stream messages (Message, Messages) */
+
+enum class SourceType : uint8_t {
+  Kafka,
+  Pulsar,
+};
+
+/// @brief Wrapper class for @ref mgp_message, a message consumed by a stream. The payload and key are views of the
+/// consumed message, they aren't copied and aren't null-terminated.
+class Message {
+ public:
+  explicit Message(mgp_message *message);
+
+  /// @brief Returns the type of the stream that consumed the message.
+  SourceType Source() const;
+  /// @brief Returns the payload, which is a byte array and not necessarily a string.
+  std::string_view Payload() const;
+  /// @brief Returns the name of the topic.
+  std::string_view TopicName() const;
+  /// @brief Returns the key. Only Kafka messages have keys.
+  std::string_view Key() const;
+  /// @brief Returns the timestamp in milliseconds since the epoch. Only Kafka messages have timestamps.
+  int64_t Timestamp() const;
+  /// @brief Returns the offset of the message in its partition. Only Kafka messages have offsets.
+  int64_t Offset() const;
+
+ private:
+  mgp_message *message_;
+};
+
+/// @brief Wrapper class for @ref mgp_messages, the batch of messages passed to a transformation.
+class Messages {
+ public:
+  explicit Messages(mgp_messages *messages);
+
+  /// @brief Returns the number of messages.
+  size_t Size() const;
+
+  /// @brief Returns the message at the given `index`.
+  Message operator[](size_t index) const;
+
+  class Iterator {
+   private:
+    friend class Messages;
+
+   public:
+    using value_type = Message;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Message *;
+    using reference = const Message &;
+    using iterator_category = std::forward_iterator_tag;
+
+    bool operator==(const Iterator &other) const;
+
+    bool operator!=(const Iterator &other) const;
+
+    Iterator &operator++();
+
+    Message operator*() const;
+
+   private:
+    Iterator(const Messages *iterable, size_t index);
+
+    const Messages *iterable_;
+    size_t index_;
+  };
+
+  Iterator begin() const;
+  Iterator end() const;
+
+ private:
+  mgp_messages *messages_;
+};
+
+/// @brief Adds a query and its parameters to the result of a transformation.
+///
+/// Binding the data of a whole batch of messages to a single query, e.g. `UNWIND $messages AS message CREATE ...`,
+/// executes the query once per batch instead of once per message.
+/// @param result - the result of the transformation
+/// @param query - the query to execute
+/// @param parameters - the parameters of the query
+inline void AddTransformationQuery(mgp_result *result, std::string_view query, const Map &parameters);
+
+/* #endregion */
+
 /* #region Module */
 
 /// @brief Represents a procedure’s parameter. Parameters are defined by their name, type, and (if optional) default
@@ -1568,6 +1699,23 @@ inline void AddBatchProcedure(mgp_proc_cb callback, mgp_proc_initializer initial
 inline void AddFunction(mgp_func_cb callback, std::string_view name, std::vector<Parameter> parameters,
                         mgp_module *module, mgp_memory *memory);
 
+/// @brief Adds a scalar function to the query module, which is called with raw values instead of mgp::Value.
+/// @param callback - function callback
+/// @param name - function name
+/// @param parameters - function parameters, which must be of the Bool, Int, Double or String type
+/// @param result_type - type of the function result, which is Bool, Int, Double or String
+/// @param module - the query module that the function is added to
+/// @param memory - access to memory
+inline void AddScalarFunction(mgp_scalar_func_cb callback, std::string_view name, std::vector<Parameter> parameters,
+                              Type result_type, mgp_module *module, mgp_memory *memory);
+
+/// @brief Adds a transformation to the query module. The results of a transformation are added with
+/// @ref AddTransformationQuery.
+/// @param callback - transformation callback, whose messages can be accessed through @ref Messages
+/// @param name - transformation name
+/// @param module - the query module that the transformation is added to
+inline void AddTransformation(mgp_trans_cb callback, std::string_view name, mgp_module *module);
+
 /* #endregion */
 
 namespace util {
@@ -1921,6 +2069,62 @@ inline void Graph::CheckMustAbort() const {
   }
 }
 
+// GraphProjection:
+
+inline GraphProjection::GraphProjection(const Graph &graph, std::string_view label, std::string_view type,
+                                        std::string_view weight_property, double default_weight) {
+  const std::string label_name(label);
+  const std::string type_name(type);
+  const std::string weight_property_name(weight_property);
+  csr_ = mgp::MemHandlerCallback(graph_project_csr, graph.graph_, label.empty() ? nullptr : label_name.c_str(),
+                                 type.empty() ? nullptr : type_name.c_str(),
+                                 weight_property.empty() ? nullptr : weight_property_name.c_str(), default_weight);
+  if (csr_ == nullptr) {
+    throw mg_exception::NotEnoughMemoryException();
+  }
+}
+
+inline GraphProjection::GraphProjection(GraphProjection &&other) noexcept : csr_(other.csr_) { other.csr_ = nullptr; }
+
+inline GraphProjection &GraphProjection::operator=(GraphProjection &&other) noexcept {
+  if (this != &other) {
+    if (csr_ != nullptr) {
+      mgp::csr_destroy(csr_);
+    }
+    csr_ = other.csr_;
+    other.csr_ = nullptr;
+  }
+  return *this;
+}
+
+inline GraphProjection::~GraphProjection() {
+  if (csr_ != nullptr) {
+    mgp::csr_destroy(csr_);
+  }
+}
+
+inline size_t GraphProjection::NodesCount() const { return mgp::csr_vertices_count(csr_); }
+
+inline size_t GraphProjection::RelationshipsCount() const { return mgp::csr_edges_count(csr_); }
+
+inline std::span<const uint64_t> GraphProjection::Offsets() const {
+  return {mgp::csr_offsets(csr_), NodesCount() + 1};
+}
+
+inline std::span<const uint64_t> GraphProjection::Neighbours() const {
+  return {mgp::csr_neighbours(csr_), RelationshipsCount()};
+}
+
+inline std::span<const double> GraphProjection::Weights() const {
+  const auto *weights = mgp::csr_weights(csr_);
+  if (weights == nullptr) {
+    return {};
+  }
+  return {weights, RelationshipsCount()};
+}
+
+inline Id GraphProjection::NodeId(size_t index) const { return Id::FromInt(mgp::csr_vertex_id(csr_, index).as_int); }
+
 inline int64_t Graph::Order() const {
   int64_t i = 0;
   for (const auto _ : Nodes()) {
@@ -1947,6 +2151,30 @@ inline GraphNodes Graph::Nodes() const {
 
 inline GraphRelationships Graph::Relationships() const { return GraphRelationships(graph_); }
 
+inline size_t Graph::ParallelWorkers() const { return mgp::graph_parallel_workers(graph_); }
+
+inline void Graph::ParallelForNodes(const std::function<void(GraphNodes nodes, size_t worker)> &func) const {
+  struct Payload {
+    const std::function<void(GraphNodes nodes, size_t worker)> *func;
+    std::mutex lock;
+    std::exception_ptr error;
+  } payload{&func};
+  mgp::graph_parallel_for_vertices(
+      graph_,
+      [](mgp_vertices_iterator *vertices, size_t worker, mgp_memory *memory, void *raw_payload) {
+        auto *payload = static_cast<Payload *>(raw_payload);
+        const MemoryDispatcherGuard guard(memory);
+        try {
+          (*payload->func)(GraphNodes(vertices), worker);
+        } catch (...) {
+          const std::lock_guard lock(payload->lock);
+          if (!payload->error) payload->error = std::current_exception();
+        }
+      },
+      &payload);
+  if (payload.error) std::rethrow_exception(payload.error);
+}
+
 inline Node Graph::GetNodeById(const Id node_id) const {
   auto mgp_node = mgp::MemHandlerCallback(graph_get_vertex_by_id, graph_, mgp_vertex_id{.as_int = node_id.AsInt()});
   if (mgp_node == nullptr) {
@@ -4184,6 +4412,66 @@ inline void Result::SetErrorMessage(const char *error_msg) const {
 
 /* #endregion */
 
+/* #region Stream messages (Message, Messages) */
+
+inline Message::Message(mgp_message *message) : message_(message) {}
+
+inline SourceType Message::Source() const {
+  switch (mgp::message_source_type(message_)) {
+    case KAFKA:
+      return SourceType::Kafka;
+    case PULSAR:
+      return SourceType::Pulsar;
+  }
+  throw ValueException("Unknown stream source type.");
+}
+
+inline std::string_view Message::Payload() const {
+  return {mgp::message_payload(message_), mgp::message_payload_size(message_)};
+}
+
+inline std::string_view Message::TopicName() const { return mgp::message_topic_name(message_); }
+
+inline std::string_view Message::Key() const { return {mgp::message_key(message_), mgp::message_key_size(message_)}; }
+
+inline int64_t Message::Timestamp() const { return mgp::message_timestamp(message_); }
+
+inline int64_t Message::Offset() const { return mgp::message_offset(message_); }
+
+inline Messages::Messages(mgp_messages *messages) : messages_(messages) {}
+
+inline size_t Messages::Size() const { return mgp::messages_size(messages_); }
+
+inline Message Messages::operator[](size_t index) const { return Message(mgp::messages_at(messages_, index)); }
+
+inline Messages::Iterator::Iterator(const Messages *iterable, size_t index) : iterable_(iterable), index_(index) {}
+
+inline bool Messages::Iterator::operator==(const Iterator &other) const {
+  return iterable_ == other.iterable_ && index_ == other.index_;
+}
+
+inline bool Messages::Iterator::operator!=(const Iterator &other) const { return !(*this == other); }
+
+inline Messages::Iterator &Messages::Iterator::operator++() {
+  index_++;
+  return *this;
+}
+
+inline Message Messages::Iterator::operator*() const { return (*iterable_)[index_]; }
+
+inline Messages::Iterator Messages::begin() const { return Iterator(this, 0); }
+
+inline Messages::Iterator Messages::end() const { return Iterator(this, Size()); }
+
+inline void AddTransformationQuery(mgp_result *result, std::string_view query, const Map &parameters) {
+  auto record = RecordFactory(result).NewRecord();
+  // The query view isn't necessarily null-terminated.
+  record.Insert("query", std::string(query));
+  record.Insert("parameters", parameters);
+}
+
+/* #endregion */
+
 /* #region Module */
 
 // Parameter:
@@ -4259,6 +4547,18 @@ inline void AddParamsReturnsToProc(mgp_proc *proc, std::vector<Parameter> &param
     mgp::proc_add_result(proc, return_name, return_.GetMGPType());
   }
 }
+
+inline void AddParamsToFunc(mgp_func *func, const std::vector<Parameter> &parameters) {
+  for (const auto &parameter : parameters) {
+    const auto *parameter_name = parameter.name.data();
+
+    if (!parameter.optional) {
+      mgp::func_add_arg(func, parameter_name, parameter.GetMGPType());
+    } else {
+      mgp::func_add_opt_arg(func, parameter_name, parameter.GetMGPType(), parameter.default_value.ptr());
+    }
+  }
+}
 }  // namespace detail
 
 void AddProcedure(mgp_proc_cb callback, std::string_view name, ProcedureType proc_type,
@@ -4281,16 +4581,34 @@ void AddBatchProcedure(mgp_proc_cb callback, mgp_proc_initializer initializer, m
 void AddFunction(mgp_func_cb callback, std::string_view name, std::vector<Parameter> parameters, mgp_module *module,
                  mgp_memory *memory) {
   auto *func = mgp::module_add_function(module, name.data(), callback);
+  detail::AddParamsToFunc(func, parameters);
+}
 
-  for (const auto &parameter : parameters) {
-    const auto *parameter_name = parameter.name.data();
-
-    if (!parameter.optional) {
-      mgp::func_add_arg(func, parameter_name, parameter.GetMGPType());
-    } else {
-      mgp::func_add_opt_arg(func, parameter_name, parameter.GetMGPType(), parameter.default_value.ptr());
-    }
+void AddScalarFunction(mgp_scalar_func_cb callback, std::string_view name, std::vector<Parameter> parameters,
+                       Type result_type, mgp_module *module, mgp_memory *memory) {
+  mgp_scalar_type scalar_result_type;
+  switch (result_type) {
+    case Type::Bool:
+      scalar_result_type = MGP_SCALAR_TYPE_BOOL;
+      break;
+    case Type::Int:
+      scalar_result_type = MGP_SCALAR_TYPE_INT;
+      break;
+    case Type::Double:
+      scalar_result_type = MGP_SCALAR_TYPE_DOUBLE;
+      break;
+    case Type::String:
+      scalar_result_type = MGP_SCALAR_TYPE_STRING;
+      break;
+    default:
+      throw ValueException("Scalar functions return a Bool, an Int, a Double or a String.");
   }
+  auto *func = mgp::module_add_scalar_function(module, name.data(), callback, scalar_result_type);
+  detail::AddParamsToFunc(func, parameters);
+}
+
+void AddTransformation(mgp_trans_cb callback, std::string_view name, mgp_module *module) {
+  mgp::module_add_transformation(module, name.data(), callback);
 }
 
 /* #endregion */
@@ -1219,6 +1219,43 @@ class Graph:
             raise InvalidContextError()
         return Vertices(self._graph)
 
+    def property_column(
+        self, property_name: str, label: typing.Optional[str] = None, default: float = float("nan")
+    ) -> typing.Tuple[memoryview, memoryview]:
+        """
+        Copy the numeric values of a vertex property into a contiguous array.
+
+        The values are read without creating a Python object for each vertex,
+        and the returned arrays can be wrapped by NumPy (`numpy.asarray`) or
+        Arrow (`pyarrow.py_buffer`) without copying them. The arrays don't
+        reference the graph, so they may be kept after the procedure returns.
+
+        Args:
+            property_name: String naming the property.
+            label: String naming the label of the vertices, or `None` for all
+              vertices.
+            default: Value of the vertices which have no numeric value of the
+              property.
+
+        Returns:
+            A tuple of the vertex IDs (`int64`) and their property values
+            (`float64`), as read-only `memoryview` objects of equal length.
+
+        Raises:
+            InvalidContextError: If context is invalid.
+
+        Examples:
+            ```
+            ids, values = graph.property_column("rank", "Page")
+            features = numpy.asarray(values)
+            ```
+
+        """
+        if not self.is_valid():
+            raise InvalidContextError()
+        values = self._graph.property_column(property_name, label, default)
+        return memoryview(values.vertex_ids()), memoryview(values)
+
     def is_mutable(self) -> bool:
         """
         Check if the graph is mutable. Thus it can be used to modify vertices and edges.
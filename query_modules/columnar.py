@@ -0,0 +1,205 @@
+import datetime
+import decimal
+import sys
+
+import mgp
+
+try:
+    import pyarrow as pa
+    import pyarrow.dataset as ds
+    import pyarrow.parquet as pq
+except ImportError as import_error:
+    sys.stderr.write(
+        '\n'
+        'NOTE: Please install pyarrow to be able to use columnar module.\n'
+        'Using Python:\n'
+        + sys.version +
+        '\n')
+    raise import_error
+
+# Files with these extensions are read as Arrow IPC files, everything else,
+# including directories, as Parquet.
+ARROW_EXTENSIONS = ('.arrow', '.feather', '.ipc')
+
+DEFAULT_BATCH_SIZE = 64 * 1024
+
+
+def _batches(path, columns, batch_size):
+    '''
+    Reads the file or the directory of files at `path` in batches of at most
+    `batch_size` rows. Only the given columns are read, all of them if
+    `columns` is None.
+    '''
+    file_format = 'arrow' if path.endswith(ARROW_EXTENSIONS) else 'parquet'
+    dataset = ds.dataset(path, format=file_format)
+    if columns is not None:
+        missing = [c for c in columns if c not in dataset.schema.names]
+        if missing:
+            raise KeyError(f'Columns {missing} are not in {path}')
+    return dataset.to_batches(columns=columns, batch_size=batch_size)
+
+
+def _to_property_value(value):
+    '''
+    Converts a value read from an Arrow column into a value which can be
+    stored as a property.
+    '''
+    if isinstance(value, decimal.Decimal):
+        return float(value)
+    if isinstance(value, datetime.datetime) and value.tzinfo is not None:
+        # Local date times are stored, so zoned timestamps are stored in UTC.
+        return value.astimezone(datetime.timezone.utc).replace(tzinfo=None)
+    if isinstance(value, list):
+        return [_to_property_value(v) for v in value]
+    if isinstance(value, dict):
+        return {k: _to_property_value(v) for k, v in value.items()}
+    if isinstance(value, bytes):
+        raise TypeError('Binary columns can\'t be stored as properties')
+    return value
+
+
+def _columns_to_rows(batch, columns):
+    '''
+    Converts the typed columns of the batch into Python values column by
+    column and returns them as rows of the given columns.
+    '''
+    values = [batch.column(c).to_pylist() for c in columns]
+    return zip(*values)
+
+
+@mgp.write_proc
+def load_nodes(context: mgp.ProcCtx,
+               path: str,
+               labels: mgp.List[str] = [],
+               columns: mgp.Nullable[mgp.List[str]] = None,
+               batch_size: int = DEFAULT_BATCH_SIZE
+               ) -> mgp.Record(nodes_created=int):
+    '''
+    Creates a node for each row of a Parquet or Arrow file, or of a directory
+    of such files, with the given labels. Each non-null value of the row is
+    stored as a property named after its column, with the type of the column:
+    integers, floats, booleans, strings, dates, times, timestamps, durations,
+    lists and structs (as maps) are kept as they are, and decimals are stored
+    as floats. Only the given columns are read, all of them by default.
+
+    The values aren't parsed from text like with LOAD CSV, the file is read
+    in batches of `batch_size` rows which are converted column by column.
+
+    Example:
+      CALL columnar.load_nodes("/data/people.parquet", ["Person"])
+      YIELD nodes_created;
+    '''
+    nodes_created = 0
+    for batch in _batches(path, columns, batch_size):
+        names = batch.schema.names
+        for row in _columns_to_rows(batch, names):
+            vertex = context.graph.create_vertex()
+            for label in labels:
+                vertex.add_label(label)
+            vertex.properties.set_properties(
+                {name: _to_property_value(value) for name, value in zip(names, row) if value is not None})
+            nodes_created += 1
+    return mgp.Record(nodes_created=nodes_created)
+
+
+@mgp.write_proc
+def load_relationships(context: mgp.ProcCtx,
+                       path: str,
+                       relationship_type: str,
+                       start_column: str,
+                       end_column: str,
+                       id_property: str = 'id',
+                       columns: mgp.Nullable[mgp.List[str]] = None,
+                       batch_size: int = DEFAULT_BATCH_SIZE
+                       ) -> mgp.Record(relationships_created=int):
+    '''
+    Creates a relationship of the given type for each row of a Parquet or
+    Arrow file, or of a directory of such files. The start and end nodes are
+    the nodes whose `id_property` equals the value in `start_column` and
+    `end_column`. The other non-null values of the row are stored as
+    properties, converted like in `load_nodes`. Only the given columns are
+    stored as properties, all of them by default.
+
+    The nodes are looked up by a map of `id_property` built once at the start,
+    so the procedure fails if a row refers to a node which doesn't exist.
+
+    Example:
+      CALL columnar.load_relationships("/data/knows.parquet", "KNOWS",
+                                       "from", "to")
+      YIELD relationships_created;
+    '''
+    nodes = {}
+    for vertex in context.graph.vertices:
+        node_id = vertex.properties.get(id_property)
+        if node_id is not None:
+            nodes[node_id] = vertex
+    edge_type = mgp.EdgeType(relationship_type)
+
+    read_columns = None
+    if columns is not None:
+        read_columns = list(dict.fromkeys([start_column, end_column, *columns]))
+    relationships_created = 0
+    for batch in _batches(path, read_columns, batch_size):
+        names = [n for n in batch.schema.names if n not in (start_column, end_column)]
+        starts = batch.column(start_column).to_pylist()
+        ends = batch.column(end_column).to_pylist()
+        for start, end, row in zip(starts, ends, _columns_to_rows(batch, names)):
+            if start not in nodes:
+                raise KeyError(f'Node with {id_property} {start!r} doesn\'t exist')
+            if end not in nodes:
+                raise KeyError(f'Node with {id_property} {end!r} doesn\'t exist')
+            edge = context.graph.create_edge(nodes[start], nodes[end], edge_type)
+            edge.properties.set_properties(
+                {name: _to_property_value(value) for name, value in zip(names, row) if value is not None})
+            relationships_created += 1
+    return mgp.Record(relationships_created=relationships_created)
+
+
+def _to_arrow_value(value):
+    '''
+    Converts a value of a query result into a value which can be written to
+    an Arrow column. Nodes and relationships are written as their properties.
+    '''
+    if isinstance(value, (mgp.Vertex, mgp.Edge)):
+        return {k: _to_arrow_value(v) for k, v in value.properties.items()}
+    if isinstance(value, (list, tuple)):
+        return [_to_arrow_value(v) for v in value]
+    if isinstance(value, dict):
+        return {k: _to_arrow_value(v) for k, v in value.items()}
+    if isinstance(value, mgp.Path):
+        raise TypeError('Paths can\'t be exported')
+    return value
+
+
+@mgp.read_proc
+def export(context: mgp.ProcCtx,
+           path: str,
+           rows: mgp.List[mgp.Map]
+           ) -> mgp.Record(rows_written=int):
+    '''
+    Writes the rows, e.g. collected results of a query, to a Parquet file, or
+    to an Arrow IPC file if `path` ends with one of the Arrow extensions. Each
+    key of the rows is a column, and its type is inferred from the values.
+
+    Example:
+      MATCH (p:Person)
+      WITH collect({name: p.name, born: p.born}) AS rows
+      CALL columnar.export("/data/people.parquet", rows) YIELD rows_written
+      RETURN rows_written;
+    '''
+    columns = {}
+    for i, row in enumerate(rows):
+        row = _to_arrow_value(row)
+        for key in row:
+            # Rows without a key have nulls in its column.
+            columns.setdefault(key, [None] * i)
+        for key, values in columns.items():
+            values.append(row.get(key))
+    table = pa.table(columns)
+    if path.endswith(ARROW_EXTENSIONS):
+        with pa.OSFile(path, 'wb') as sink:
+            with pa.ipc.new_file(sink, table.schema) as writer:
+                writer.write_table(table)
+    else:
+        pq.write_table(table, path)
+    return mgp.Record(rows_written=table.num_rows)
@@ -0,0 +1,207 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <mgp.hpp>
+
+#include "graph_algorithms.hpp"
+
+namespace {
+
+constexpr const char *kArgumentStartNode = "start_node";
+constexpr const char *kArgumentLabel = "label";
+constexpr const char *kArgumentRelationshipType = "relationship_type";
+constexpr const char *kArgumentWeightProperty = "weight_property";
+constexpr const char *kArgumentDampingFactor = "damping_factor";
+constexpr const char *kArgumentMaxIterations = "max_iterations";
+constexpr const char *kArgumentTolerance = "tolerance";
+constexpr const char *kArgumentDirected = "directed";
+constexpr const char *kArgumentNormalized = "normalized";
+constexpr const char *kArgumentResolution = "resolution";
+
+constexpr const char *kFieldNode = "node";
+constexpr const char *kFieldDistance = "distance";
+constexpr const char *kFieldComponentId = "component_id";
+constexpr const char *kFieldRank = "rank";
+constexpr const char *kFieldBetweennessCentrality = "betweenness_centrality";
+constexpr const char *kFieldTriangles = "triangles";
+constexpr const char *kFieldCommunityId = "community_id";
+
+// Limits of the passes of the Louvain method over the vertices of each level.
+constexpr size_t kLouvainMaxPasses = 32;
+constexpr double kLouvainMinModularityGain = 1e-4;
+
+graph_algorithms::Csr View(const mgp::GraphProjection &projection) {
+  return {projection.Offsets(), projection.Neighbours(), projection.Weights()};
+}
+
+// Calls `func(list, graph, result)` with the memory guard set, and reports its
+// exceptions as the error of the procedure.
+template <typename TFunc>
+void Run(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory, const TFunc &func) {
+  try {
+    mgp::MemoryDispatcherGuard guard(memory);
+    func(mgp::List(args), mgp::Graph(memgraph_graph), result);
+  } catch (const std::exception &e) {
+    mgp::result_set_error_msg(result, e.what());
+    return;
+  }
+}
+
+// Inserts a record with the node of each vertex and its value.
+template <typename TValue, typename TConvert>
+void InsertRecords(const mgp::Graph &graph, const mgp::GraphProjection &projection, const std::vector<TValue> &values,
+                   mgp_result *result, const char *field, const TConvert &convert) {
+  auto record_factory = mgp::RecordFactory(result);
+  for (size_t vertex = 0; vertex < values.size(); ++vertex) {
+    auto record = record_factory.NewRecord();
+    record.Insert(kFieldNode, graph.GetNodeById(projection.NodeId(vertex)));
+    record.Insert(field, convert(values[vertex]));
+  }
+}
+
+template <typename TValue>
+void InsertRecords(const mgp::Graph &graph, const mgp::GraphProjection &projection, const std::vector<TValue> &values,
+                   mgp_result *result, const char *field) {
+  InsertRecords(graph, projection, values, result, field, [](const TValue &value) { return value; });
+}
+
+// Inserts the components of the vertices identified by the IDs of their nodes.
+void InsertComponents(const mgp::Graph &graph, const mgp::GraphProjection &projection,
+                      const std::vector<uint64_t> &components, mgp_result *result) {
+  InsertRecords(graph, projection, components, result, kFieldComponentId,
+                [&projection](uint64_t component) { return projection.NodeId(component).AsInt(); });
+}
+
+void BreadthFirstSearch(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const auto start_node = arguments[0].ValueNode();
+    const mgp::GraphProjection projection(graph, arguments[1].ValueString(), arguments[2].ValueString());
+    std::optional<uint64_t> start;
+    for (size_t vertex = 0; vertex < projection.NodesCount(); ++vertex) {
+      if (projection.NodeId(vertex) == start_node.Id()) {
+        start = vertex;
+        break;
+      }
+    }
+    if (!start) throw mgp::ValueException("The start node isn't in the projected graph.");
+
+    const auto distances = graph_algorithms::BreadthFirstSearch(View(projection), *start);
+    auto record_factory = mgp::RecordFactory(result);
+    for (size_t vertex = 0; vertex < distances.size(); ++vertex) {
+      if (distances[vertex] < 0) continue;
+      auto record = record_factory.NewRecord();
+      record.Insert(kFieldNode, graph.GetNodeById(projection.NodeId(vertex)));
+      record.Insert(kFieldDistance, distances[vertex]);
+    }
+  });
+}
+
+void WeaklyConnectedComponents(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString());
+    InsertComponents(graph, projection, graph_algorithms::WeaklyConnectedComponents(View(projection)), result);
+  });
+}
+
+void StronglyConnectedComponents(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString());
+    InsertComponents(graph, projection, graph_algorithms::StronglyConnectedComponents(View(projection)), result);
+  });
+}
+
+void PageRank(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const auto damping_factor = arguments[2].ValueDouble();
+    const auto max_iterations = arguments[3].ValueInt();
+    const auto tolerance = arguments[4].ValueDouble();
+    if (damping_factor < 0.0 || damping_factor > 1.0) {
+      throw mgp::ValueException("The damping factor must be between 0 and 1.");
+    }
+    if (max_iterations < 0) throw mgp::ValueException("The maximum number of iterations can't be negative.");
+
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString());
+    const auto ranks = graph_algorithms::PageRank(View(projection), damping_factor,
+                                                  static_cast<size_t>(max_iterations), tolerance);
+    InsertRecords(graph, projection, ranks, result, kFieldRank);
+  });
+}
+
+void BetweennessCentrality(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString());
+    const auto centrality = graph_algorithms::BetweennessCentrality(View(projection), arguments[2].ValueBool(),
+                                                                    arguments[3].ValueBool());
+    InsertRecords(graph, projection, centrality, result, kFieldBetweennessCentrality);
+  });
+}
+
+void TriangleCount(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString());
+    InsertRecords(graph, projection, graph_algorithms::TriangleCounts(View(projection)), result, kFieldTriangles,
+                  [](uint64_t triangles) { return static_cast<int64_t>(triangles); });
+  });
+}
+
+void Louvain(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  Run(args, memgraph_graph, result, memory, [](const mgp::List &arguments, const mgp::Graph &graph, auto *result) {
+    const auto resolution = arguments[3].ValueDouble();
+    if (resolution <= 0.0) throw mgp::ValueException("The resolution must be positive.");
+    const mgp::GraphProjection projection(graph, arguments[0].ValueString(), arguments[1].ValueString(),
+                                          arguments[2].ValueString());
+    const auto communities =
+        graph_algorithms::Louvain(View(projection), resolution, kLouvainMaxPasses, kLouvainMinModularityGain);
+    InsertRecords(graph, projection, communities, result, kFieldCommunityId,
+                  [](uint64_t community) { return static_cast<int64_t>(community); });
+  });
+}
+
+}  // namespace
+
+extern "C" int mgp_init_module(struct mgp_module *module, struct mgp_memory *memory) {
+  try {
+    mgp::MemoryDispatcherGuard guard(memory);
+    const auto label = mgp::Parameter(kArgumentLabel, mgp::Type::String, "");
+    const auto relationship_type = mgp::Parameter(kArgumentRelationshipType, mgp::Type::String, "");
+    const auto node = mgp::Return(kFieldNode, mgp::Type::Node);
+
+    mgp::AddProcedure(BreadthFirstSearch, "bfs", mgp::ProcedureType::Read,
+                      {mgp::Parameter(kArgumentStartNode, mgp::Type::Node), label, relationship_type},
+                      {node, mgp::Return(kFieldDistance, mgp::Type::Int)}, module, memory);
+    mgp::AddProcedure(WeaklyConnectedComponents, "weakly_connected_components", mgp::ProcedureType::Read,
+                      {label, relationship_type}, {node, mgp::Return(kFieldComponentId, mgp::Type::Int)}, module,
+                      memory);
+    mgp::AddProcedure(StronglyConnectedComponents, "strongly_connected_components", mgp::ProcedureType::Read,
+                      {label, relationship_type}, {node, mgp::Return(kFieldComponentId, mgp::Type::Int)}, module,
+                      memory);
+    mgp::AddProcedure(PageRank, "pagerank", mgp::ProcedureType::Read,
+                      {label, relationship_type, mgp::Parameter(kArgumentDampingFactor, mgp::Type::Double, 0.85),
+                       mgp::Parameter(kArgumentMaxIterations, mgp::Type::Int, int64_t{100}),
+                       mgp::Parameter(kArgumentTolerance, mgp::Type::Double, 1e-5)},
+                      {node, mgp::Return(kFieldRank, mgp::Type::Double)}, module, memory);
+    mgp::AddProcedure(BetweennessCentrality, "betweenness_centrality", mgp::ProcedureType::Read,
+                      {label, relationship_type, mgp::Parameter(kArgumentDirected, mgp::Type::Bool, true),
+                       mgp::Parameter(kArgumentNormalized, mgp::Type::Bool, true)},
+                      {node, mgp::Return(kFieldBetweennessCentrality, mgp::Type::Double)}, module, memory);
+    mgp::AddProcedure(TriangleCount, "triangle_count", mgp::ProcedureType::Read, {label, relationship_type},
+                      {node, mgp::Return(kFieldTriangles, mgp::Type::Int)}, module, memory);
+    mgp::AddProcedure(Louvain, "louvain", mgp::ProcedureType::Read,
+                      {label, relationship_type, mgp::Parameter(kArgumentWeightProperty, mgp::Type::String, ""),
+                       mgp::Parameter(kArgumentResolution, mgp::Type::Double, 1.0)},
+                      {node, mgp::Return(kFieldCommunityId, mgp::Type::Int)}, module, memory);
+  } catch (const std::exception &e) {
+    return 1;
+  }
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() { return 0; }
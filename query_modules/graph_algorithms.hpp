@@ -0,0 +1,645 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Graph algorithms over graphs in the compressed sparse row (CSR) format, as
+// projected by mgp::GraphProjection. They don't depend on the query module
+// API, so they can be benchmarked on their own.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace graph_algorithms {
+
+/// Graph whose vertex `i` has the edges `offsets[i]` to `offsets[i + 1] - 1`,
+/// leading to `neighbours` with `weights`, which are empty for an unweighted
+/// graph.
+struct Csr {
+  std::span<const uint64_t> offsets;
+  std::span<const uint64_t> neighbours;
+  std::span<const double> weights;
+
+  size_t VerticesCount() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+  std::span<const uint64_t> Neighbours(uint64_t vertex) const {
+    return neighbours.subspan(offsets[vertex], offsets[vertex + 1] - offsets[vertex]);
+  }
+
+  double Weight(uint64_t edge) const { return weights.empty() ? 1.0 : weights[edge]; }
+};
+
+/// Csr which owns its arrays.
+struct OwnedCsr {
+  std::vector<uint64_t> offsets;
+  std::vector<uint64_t> neighbours;
+  std::vector<double> weights;
+
+  Csr View() const { return {offsets, neighbours, weights}; }
+};
+
+inline size_t ThreadsCount() { return std::max<size_t>(1, std::thread::hardware_concurrency()); }
+
+/// Calls `func(begin, end, worker)` for the chunks of the range [0, `size`) on
+/// up to ThreadsCount() threads, where `worker` is the index of the thread.
+/// The threads take the chunks as they go, because the work of a vertex
+/// depends on its degree. Ranges shorter than `min_parallel_size` are
+/// processed by the calling thread alone.
+template <typename TFunc>
+void ParallelFor(size_t size, size_t min_parallel_size, const TFunc &func) {
+  static constexpr size_t kChunksPerThread = 16;
+  const auto threads = ThreadsCount();
+  if (threads == 1 || size < std::max<size_t>(min_parallel_size, 2)) {
+    if (size != 0) func(0, size, 0);
+    return;
+  }
+  const auto chunk = std::max<size_t>(1, size / (threads * kChunksPerThread));
+  std::atomic<size_t> next{0};
+  const auto work = [&](size_t worker) {
+    for (auto begin = next.fetch_add(chunk, std::memory_order_relaxed); begin < size;
+         begin = next.fetch_add(chunk, std::memory_order_relaxed)) {
+      func(begin, std::min(size, begin + chunk), worker);
+    }
+  };
+  std::vector<std::jthread> workers;
+  workers.reserve(threads - 1);
+  for (size_t worker = 1; worker < threads; ++worker) {
+    workers.emplace_back(work, worker);
+  }
+  work(0);
+}
+
+// Vertex loops with less work than this run on a single thread.
+constexpr size_t kMinParallelVertices = 4096;
+
+/// Accumulator of a single thread, padded so the threads don't share cache
+/// lines.
+template <typename T>
+struct alignas(64) PerThread {
+  T value{};
+};
+
+/// Returns the graph with the edges reversed.
+inline OwnedCsr Transpose(const Csr &graph) {
+  const auto vertices = graph.VerticesCount();
+  OwnedCsr transposed;
+  transposed.offsets.assign(vertices + 1, 0);
+  for (const auto neighbour : graph.neighbours) {
+    ++transposed.offsets[neighbour + 1];
+  }
+  std::partial_sum(transposed.offsets.begin(), transposed.offsets.end(), transposed.offsets.begin());
+  transposed.neighbours.resize(graph.neighbours.size());
+  if (!graph.weights.empty()) transposed.weights.resize(graph.weights.size());
+  std::vector<uint64_t> positions(transposed.offsets.begin(), transposed.offsets.end() - 1);
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    for (auto edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; ++edge) {
+      const auto position = positions[graph.neighbours[edge]]++;
+      transposed.neighbours[position] = vertex;
+      if (!graph.weights.empty()) transposed.weights[position] = graph.weights[edge];
+    }
+  }
+  return transposed;
+}
+
+/// Returns the graph with an edge in both directions for each edge. The
+/// neighbours of each vertex are sorted, and parallel edges are merged into a
+/// single one whose weight is the sum of theirs. A self-loop is kept with
+/// twice its weight, as it adds to the degree of its vertex twice, unless
+/// `self_loops` is false. The result is weighted if `weighted` is true.
+inline OwnedCsr Undirected(const Csr &graph, bool weighted, bool self_loops) {
+  const auto vertices = graph.VerticesCount();
+  std::vector<uint64_t> offsets(vertices + 1, 0);
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    for (const auto neighbour : graph.Neighbours(vertex)) {
+      if (neighbour == vertex && !self_loops) continue;
+      ++offsets[vertex + 1];
+      ++offsets[neighbour + 1];
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<std::pair<uint64_t, double>> edges(offsets.back());
+  std::vector<uint64_t> positions(offsets.begin(), offsets.end() - 1);
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    for (auto edge = graph.offsets[vertex]; edge < graph.offsets[vertex + 1]; ++edge) {
+      const auto neighbour = graph.neighbours[edge];
+      if (neighbour == vertex && !self_loops) continue;
+      edges[positions[vertex]++] = {neighbour, graph.Weight(edge)};
+      edges[positions[neighbour]++] = {vertex, graph.Weight(edge)};
+    }
+  }
+
+  // Sort the neighbours of each vertex and merge the parallel edges in place,
+  // keeping the new number of neighbours in `positions`.
+  ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t /*worker*/) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      auto first = edges.begin() + static_cast<std::ptrdiff_t>(offsets[vertex]);
+      auto last = edges.begin() + static_cast<std::ptrdiff_t>(offsets[vertex + 1]);
+      std::sort(first, last);
+      auto out = first;
+      for (auto it = first; it != last; ++it) {
+        if (out != first && std::prev(out)->first == it->first) {
+          std::prev(out)->second += it->second;
+        } else {
+          *out++ = *it;
+        }
+      }
+      positions[vertex] = static_cast<uint64_t>(out - first);
+    }
+  });
+
+  OwnedCsr undirected;
+  undirected.offsets.resize(vertices + 1);
+  undirected.offsets[0] = 0;
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    undirected.offsets[vertex + 1] = undirected.offsets[vertex] + positions[vertex];
+  }
+  undirected.neighbours.resize(undirected.offsets.back());
+  if (weighted) undirected.weights.resize(undirected.offsets.back());
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    for (uint64_t i = 0; i < positions[vertex]; ++i) {
+      const auto &[neighbour, weight] = edges[offsets[vertex] + i];
+      undirected.neighbours[undirected.offsets[vertex] + i] = neighbour;
+      if (weighted) undirected.weights[undirected.offsets[vertex] + i] = weight;
+    }
+  }
+  return undirected;
+}
+
+/// Returns the number of edges on the shortest path from `start` to each
+/// vertex, or -1 for the vertices which can't be reached. The levels are
+/// expanded in parallel.
+inline std::vector<int64_t> BreadthFirstSearch(const Csr &graph, uint64_t start) {
+  std::vector<int64_t> distances(graph.VerticesCount(), -1);
+  distances[start] = 0;
+  std::vector<uint64_t> frontier{start};
+  std::vector<PerThread<std::vector<uint64_t>>> next_frontiers(ThreadsCount());
+  for (int64_t distance = 1; !frontier.empty(); ++distance) {
+    ParallelFor(frontier.size(), kMinParallelVertices / 4, [&](size_t begin, size_t end, size_t worker) {
+      auto &next_frontier = next_frontiers[worker].value;
+      for (auto i = begin; i < end; ++i) {
+        for (const auto neighbour : graph.Neighbours(frontier[i])) {
+          std::atomic_ref<int64_t> neighbour_distance(distances[neighbour]);
+          int64_t unvisited = -1;
+          if (neighbour_distance.load(std::memory_order_relaxed) == -1 &&
+              neighbour_distance.compare_exchange_strong(unvisited, distance, std::memory_order_relaxed)) {
+            next_frontier.push_back(neighbour);
+          }
+        }
+      }
+    });
+    frontier.clear();
+    for (auto &next_frontier : next_frontiers) {
+      frontier.insert(frontier.end(), next_frontier.value.begin(), next_frontier.value.end());
+      next_frontier.value.clear();
+    }
+  }
+  return distances;
+}
+
+/// Returns the weakly connected component of each vertex, identified by its
+/// smallest vertex. The edges are merged by a lock-free union-find in
+/// parallel.
+inline std::vector<uint64_t> WeaklyConnectedComponents(const Csr &graph) {
+  const auto vertices = graph.VerticesCount();
+  std::vector<uint64_t> parents(vertices);
+  std::iota(parents.begin(), parents.end(), 0);
+
+  // The parent of a vertex is never greater than the vertex, so the roots only
+  // ever get smaller and the loops end.
+  const auto find = [&parents](uint64_t vertex) {
+    while (true) {
+      std::atomic_ref<uint64_t> parent_ref(parents[vertex]);
+      auto parent = parent_ref.load(std::memory_order_relaxed);
+      if (parent == vertex) return vertex;
+      const auto grandparent = std::atomic_ref<uint64_t>(parents[parent]).load(std::memory_order_relaxed);
+      // Path halving; losing the race only leaves the path longer.
+      if (grandparent != parent) parent_ref.compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+      vertex = grandparent;
+    }
+  };
+  const auto unite = [&](uint64_t first, uint64_t second) {
+    while (true) {
+      first = find(first);
+      second = find(second);
+      if (first == second) return;
+      if (first < second) std::swap(first, second);
+      auto root = first;
+      if (std::atomic_ref<uint64_t>(parents[first]).compare_exchange_strong(root, second, std::memory_order_relaxed)) {
+        return;
+      }
+    }
+  };
+
+  ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t /*worker*/) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      for (const auto neighbour : graph.Neighbours(vertex)) {
+        unite(vertex, neighbour);
+      }
+    }
+  });
+  std::vector<uint64_t> components(vertices);
+  ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t /*worker*/) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      components[vertex] = find(vertex);
+    }
+  });
+  return components;
+}
+
+/// Returns the strongly connected component of each vertex, identified by one
+/// of its vertices. Tarjan's algorithm runs on a single thread.
+inline std::vector<uint64_t> StronglyConnectedComponents(const Csr &graph) {
+  static constexpr auto kUnvisited = std::numeric_limits<uint64_t>::max();
+  const auto vertices = graph.VerticesCount();
+  std::vector<uint64_t> indices(vertices, kUnvisited);
+  std::vector<uint64_t> low_links(vertices);
+  std::vector<uint64_t> components(vertices, kUnvisited);
+  std::vector<uint64_t> stack;
+  // Vertices being visited and their next edge, instead of recursion.
+  std::vector<std::pair<uint64_t, uint64_t>> calls;
+  uint64_t next_index = 0;
+
+  const auto visit = [&](uint64_t vertex) {
+    indices[vertex] = low_links[vertex] = next_index++;
+    stack.push_back(vertex);
+    calls.emplace_back(vertex, graph.offsets[vertex]);
+  };
+
+  for (uint64_t root = 0; root < vertices; ++root) {
+    if (indices[root] != kUnvisited) continue;
+    visit(root);
+    while (!calls.empty()) {
+      auto &[vertex, edge] = calls.back();
+      if (edge < graph.offsets[vertex + 1]) {
+        const auto current = vertex;
+        const auto neighbour = graph.neighbours[edge++];
+        if (indices[neighbour] == kUnvisited) {
+          visit(neighbour);
+        } else if (components[neighbour] == kUnvisited) {
+          // The neighbour is still on the stack.
+          low_links[current] = std::min(low_links[current], indices[neighbour]);
+        }
+        continue;
+      }
+      const auto finished = vertex;
+      calls.pop_back();
+      if (low_links[finished] == indices[finished]) {
+        uint64_t member = kUnvisited;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          components[member] = finished;
+        } while (member != finished);
+      }
+      if (!calls.empty()) {
+        auto &caller_low_link = low_links[calls.back().first];
+        caller_low_link = std::min(caller_low_link, low_links[finished]);
+      }
+    }
+  }
+  return components;
+}
+
+/// Returns the PageRank of each vertex. The ranks of dangling vertices are
+/// spread over all vertices. Each iteration pulls the ranks over the reversed
+/// edges in parallel, so no two threads write the same rank. Stops once the
+/// ranks change by less than `tolerance` in total.
+inline std::vector<double> PageRank(const Csr &graph, double damping_factor, size_t max_iterations,
+                                    double tolerance) {
+  const auto vertices = graph.VerticesCount();
+  if (vertices == 0) return {};
+  const auto reversed = Transpose(graph);
+  const auto reversed_view = reversed.View();
+  std::vector<double> ranks(vertices, 1.0 / static_cast<double>(vertices));
+  std::vector<double> next_ranks(vertices);
+  std::vector<double> contributions(vertices);
+  std::vector<PerThread<double>> partial_sums(ThreadsCount());
+
+  const auto sum_partial = [&partial_sums] {
+    double sum = 0.0;
+    for (auto &partial : partial_sums) {
+      sum += std::exchange(partial.value, 0.0);
+    }
+    return sum;
+  };
+
+  for (size_t iteration = 0; iteration < max_iterations; ++iteration) {
+    ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t worker) {
+      double dangling = 0.0;
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        const auto degree = graph.offsets[vertex + 1] - graph.offsets[vertex];
+        if (degree == 0) {
+          dangling += ranks[vertex];
+          contributions[vertex] = 0.0;
+        } else {
+          contributions[vertex] = ranks[vertex] / static_cast<double>(degree);
+        }
+      }
+      partial_sums[worker].value += dangling;
+    });
+    const auto base = (1.0 - damping_factor + damping_factor * sum_partial()) / static_cast<double>(vertices);
+
+    ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t worker) {
+      double change = 0.0;
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        double sum = 0.0;
+        for (const auto source : reversed_view.Neighbours(vertex)) {
+          sum += contributions[source];
+        }
+        next_ranks[vertex] = base + damping_factor * sum;
+        change += std::abs(next_ranks[vertex] - ranks[vertex]);
+      }
+      partial_sums[worker].value += change;
+    });
+    ranks.swap(next_ranks);
+    if (sum_partial() < tolerance) break;
+  }
+  return ranks;
+}
+
+/// Returns the betweenness centrality of each vertex, ignoring the weights.
+/// The shortest paths from each source are counted by Brandes' algorithm, and
+/// the sources are split between the threads. An undirected graph counts its
+/// paths once and not once in each direction.
+inline std::vector<double> BetweennessCentrality(const Csr &graph, bool directed, bool normalized) {
+  const auto vertices = graph.VerticesCount();
+  std::optional<OwnedCsr> undirected;
+  if (!directed) undirected.emplace(Undirected(graph, false, false));
+  const auto paths_graph = directed ? graph : undirected->View();
+
+  struct State {
+    explicit State(size_t vertices)
+        : distances(vertices, -1), paths(vertices, 0.0), dependencies(vertices, 0.0), centrality(vertices, 0.0) {
+      order.reserve(vertices);
+    }
+
+    std::vector<int64_t> distances;
+    std::vector<double> paths;
+    std::vector<double> dependencies;
+    std::vector<double> centrality;
+    // Vertices in the order in which they were reached.
+    std::vector<uint64_t> order;
+  };
+  std::vector<std::optional<State>> states(ThreadsCount());
+
+  // Betweenness of small graphs is still worth computing in parallel, as each
+  // source traverses the whole graph.
+  ParallelFor(vertices, 2, [&](size_t begin, size_t end, size_t worker) {
+    auto &state = states[worker];
+    if (!state) state.emplace(vertices);
+    for (auto source = begin; source < end; ++source) {
+      state->order.push_back(source);
+      state->distances[source] = 0;
+      state->paths[source] = 1.0;
+      for (size_t head = 0; head < state->order.size(); ++head) {
+        const auto vertex = state->order[head];
+        for (const auto neighbour : paths_graph.Neighbours(vertex)) {
+          if (state->distances[neighbour] < 0) {
+            state->distances[neighbour] = state->distances[vertex] + 1;
+            state->order.push_back(neighbour);
+          }
+          if (state->distances[neighbour] == state->distances[vertex] + 1) {
+            state->paths[neighbour] += state->paths[vertex];
+          }
+        }
+      }
+      // The farther vertices get their dependencies first.
+      for (auto it = state->order.rbegin(); it != state->order.rend(); ++it) {
+        const auto vertex = *it;
+        double dependency = 0.0;
+        for (const auto neighbour : paths_graph.Neighbours(vertex)) {
+          if (state->distances[neighbour] == state->distances[vertex] + 1) {
+            dependency += state->paths[vertex] / state->paths[neighbour] * (1.0 + state->dependencies[neighbour]);
+          }
+        }
+        state->dependencies[vertex] = dependency;
+        if (vertex != source) state->centrality[vertex] += dependency;
+      }
+      for (const auto vertex : state->order) {
+        state->distances[vertex] = -1;
+        state->paths[vertex] = 0.0;
+        state->dependencies[vertex] = 0.0;
+      }
+      state->order.clear();
+    }
+  });
+
+  double scale = directed ? 1.0 : 0.5;
+  if (normalized && vertices > 2) {
+    scale = 1.0 / (static_cast<double>(vertices - 1) * static_cast<double>(vertices - 2));
+  }
+  std::vector<double> centrality(vertices, 0.0);
+  for (const auto &state : states) {
+    if (!state) continue;
+    for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+      centrality[vertex] += state->centrality[vertex];
+    }
+  }
+  for (auto &value : centrality) {
+    value *= scale;
+  }
+  return centrality;
+}
+
+/// Returns the number of triangles each vertex is in, ignoring the directions
+/// of the edges, parallel edges and self-loops. Each edge is oriented towards
+/// the vertex with the higher degree, so each triangle is found once by
+/// intersecting short sorted lists, and the vertices are split between the
+/// threads.
+inline std::vector<uint64_t> TriangleCounts(const Csr &graph) {
+  const auto vertices = graph.VerticesCount();
+  const auto undirected = Undirected(graph, false, false);
+  const auto undirected_view = undirected.View();
+  const auto precedes = [&undirected_view](uint64_t first, uint64_t second) {
+    const auto first_degree = undirected_view.Neighbours(first).size();
+    const auto second_degree = undirected_view.Neighbours(second).size();
+    return first_degree < second_degree || (first_degree == second_degree && first < second);
+  };
+
+  OwnedCsr oriented;
+  oriented.offsets.assign(vertices + 1, 0);
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    const auto neighbours = undirected_view.Neighbours(vertex);
+    oriented.offsets[vertex + 1] =
+        oriented.offsets[vertex] + static_cast<uint64_t>(std::count_if(
+                                       neighbours.begin(), neighbours.end(),
+                                       [&](uint64_t neighbour) { return precedes(vertex, neighbour); }));
+  }
+  oriented.neighbours.reserve(oriented.offsets.back());
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    // The neighbours stay sorted by their numbers.
+    for (const auto neighbour : undirected_view.Neighbours(vertex)) {
+      if (precedes(vertex, neighbour)) oriented.neighbours.push_back(neighbour);
+    }
+  }
+  const auto oriented_view = oriented.View();
+
+  std::vector<uint64_t> triangles(vertices, 0);
+  const auto add_triangle = [&triangles](uint64_t vertex) {
+    std::atomic_ref<uint64_t>(triangles[vertex]).fetch_add(1, std::memory_order_relaxed);
+  };
+  ParallelFor(vertices, kMinParallelVertices, [&](size_t begin, size_t end, size_t /*worker*/) {
+    for (auto vertex = begin; vertex < end; ++vertex) {
+      const auto neighbours = oriented_view.Neighbours(vertex);
+      for (const auto neighbour : neighbours) {
+        const auto second_neighbours = oriented_view.Neighbours(neighbour);
+        auto first_it = neighbours.begin();
+        auto second_it = second_neighbours.begin();
+        while (first_it != neighbours.end() && second_it != second_neighbours.end()) {
+          if (*first_it < *second_it) {
+            ++first_it;
+          } else if (*second_it < *first_it) {
+            ++second_it;
+          } else {
+            add_triangle(vertex);
+            add_triangle(neighbour);
+            add_triangle(*first_it);
+            ++first_it;
+            ++second_it;
+          }
+        }
+      }
+    }
+  });
+  return triangles;
+}
+
+/// Returns the community of each vertex, numbered from 0, found by the Louvain
+/// method on the graph with undirected edges. The vertices are moved between
+/// the communities on a single thread, as long as a pass over them increases
+/// the modularity by at least `min_modularity_gain`, and the communities then
+/// become the vertices of the next level.
+inline std::vector<uint64_t> Louvain(const Csr &graph, double resolution, size_t max_passes,
+                                     double min_modularity_gain) {
+  static constexpr double kMinGain = 1e-12;
+  const auto vertices = graph.VerticesCount();
+  std::vector<uint64_t> communities(vertices);
+  std::iota(communities.begin(), communities.end(), 0);
+  auto level = Undirected(graph, true, true);
+
+  while (true) {
+    const auto level_view = level.View();
+    const auto level_vertices = level_view.VerticesCount();
+    std::vector<uint64_t> level_communities(level_vertices);
+    std::iota(level_communities.begin(), level_communities.end(), 0);
+    std::vector<double> degrees(level_vertices, 0.0);
+    for (uint64_t vertex = 0; vertex < level_vertices; ++vertex) {
+      for (auto edge = level_view.offsets[vertex]; edge < level_view.offsets[vertex + 1]; ++edge) {
+        degrees[vertex] += level_view.Weight(edge);
+      }
+    }
+    const auto total_weight = std::accumulate(degrees.begin(), degrees.end(), 0.0);
+    if (total_weight <= 0.0) break;
+    auto totals = degrees;
+
+    // Weights of the edges from the moved vertex to each community.
+    std::vector<double> community_weights(level_vertices, 0.0);
+    std::vector<bool> is_neighbour_community(level_vertices, false);
+    std::vector<uint64_t> neighbour_communities;
+    bool moved_any = false;
+    for (size_t pass = 0; pass < max_passes; ++pass) {
+      bool moved = false;
+      double pass_gain = 0.0;
+      for (uint64_t vertex = 0; vertex < level_vertices; ++vertex) {
+        const auto current = level_communities[vertex];
+        totals[current] -= degrees[vertex];
+        neighbour_communities.push_back(current);
+        is_neighbour_community[current] = true;
+        for (auto edge = level_view.offsets[vertex]; edge < level_view.offsets[vertex + 1]; ++edge) {
+          const auto neighbour = level_view.neighbours[edge];
+          if (neighbour == vertex) continue;
+          const auto community = level_communities[neighbour];
+          if (!is_neighbour_community[community]) {
+            is_neighbour_community[community] = true;
+            neighbour_communities.push_back(community);
+          }
+          community_weights[community] += level_view.Weight(edge);
+        }
+        const auto gain = [&](uint64_t community) {
+          return community_weights[community] - resolution * totals[community] * degrees[vertex] / total_weight;
+        };
+        auto best = current;
+        const auto current_gain = gain(current);
+        auto best_gain = current_gain;
+        for (const auto community : neighbour_communities) {
+          const auto community_gain = gain(community);
+          if (community_gain > best_gain + kMinGain) {
+            best = community;
+            best_gain = community_gain;
+          }
+        }
+        for (const auto community : neighbour_communities) {
+          community_weights[community] = 0.0;
+          is_neighbour_community[community] = false;
+        }
+        neighbour_communities.clear();
+        totals[best] += degrees[vertex];
+        level_communities[vertex] = best;
+        moved = moved || best != current;
+        pass_gain += best_gain - current_gain;
+      }
+      moved_any = moved_any || moved;
+      // The gains are in the units of the edge weights.
+      if (!moved || 2.0 * pass_gain / total_weight < min_modularity_gain) break;
+    }
+    if (!moved_any) break;
+
+    // Number the communities from 0 and make them the vertices of the next
+    // level.
+    static constexpr auto kUnnumbered = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> numbers(level_vertices, kUnnumbered);
+    uint64_t next_number = 0;
+    for (auto &community : level_communities) {
+      if (numbers[community] == kUnnumbered) numbers[community] = next_number++;
+      community = numbers[community];
+    }
+    for (auto &community : communities) {
+      community = level_communities[community];
+    }
+    if (next_number == level_vertices) break;
+
+    std::vector<std::vector<std::pair<uint64_t, double>>> community_edges(next_number);
+    for (uint64_t vertex = 0; vertex < level_vertices; ++vertex) {
+      auto &edges = community_edges[level_communities[vertex]];
+      for (auto edge = level_view.offsets[vertex]; edge < level_view.offsets[vertex + 1]; ++edge) {
+        edges.emplace_back(level_communities[level_view.neighbours[edge]], level_view.Weight(edge));
+      }
+    }
+    OwnedCsr next_level;
+    next_level.offsets.push_back(0);
+    for (auto &edges : community_edges) {
+      std::sort(edges.begin(), edges.end());
+      for (const auto &[neighbour, weight] : edges) {
+        if (next_level.neighbours.size() > next_level.offsets.back() && next_level.neighbours.back() == neighbour) {
+          next_level.weights.back() += weight;
+        } else {
+          next_level.neighbours.push_back(neighbour);
+          next_level.weights.push_back(weight);
+        }
+      }
+      next_level.offsets.push_back(next_level.neighbours.size());
+    }
+    level = std::move(next_level);
+  }
+  return communities;
+}
+
+}  // namespace graph_algorithms
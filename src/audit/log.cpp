@@ -83,14 +83,22 @@ inline nlohmann::json PropertyValueToJson(const storage::PropertyValue &pv) {
       ret = to_string(temporal_data);
       break;
     }
+    case storage::PropertyValue::Type::Point: {
+      std::stringstream ss;
+      ss << pv.ValuePoint();
+      ret = ss.str();
+      break;
+    }
   }
   return ret;
 }
 
-Log::Log(const std::filesystem::path &storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis)
+Log::Log(const std::filesystem::path &storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis,
+         bool drop_when_full)
     : storage_directory_(storage_directory),
       buffer_size_(buffer_size),
       buffer_flush_interval_millis_(buffer_flush_interval_millis),
+      drop_when_full_(drop_when_full),
       started_(false) {}
 
 void Log::Start() {
@@ -121,7 +129,12 @@ void Log::Record(const std::string &address, const std::string &username, const
   auto timestamp =
       std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
           .count();
-  buffer_->emplace(Item{timestamp, address, username, query, params, db});
+  Item item{timestamp, address, username, query, params, db};
+  if (!drop_when_full_) {
+    buffer_->emplace(std::move(item));
+  } else if (!buffer_->try_emplace(std::move(item))) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
 }
 
 void Log::ReopenLog() {
@@ -133,6 +146,9 @@ void Log::ReopenLog() {
 
 void Log::Flush() {
   std::lock_guard<std::mutex> guard(lock_);
+  if (const auto dropped = dropped_.exchange(0, std::memory_order_relaxed); dropped > 0) {
+    spdlog::warn("The audit log buffer was full, {} entries were dropped.", dropped);
+  }
   for (uint64_t i = 0; i < buffer_size_; ++i) {
     auto item = buffer_->pop();
     if (!item) break;
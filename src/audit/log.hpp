@@ -36,7 +36,12 @@ class Log {
   };
 
  public:
-  Log(const std::filesystem::path &storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis);
+  /// When `drop_when_full` is set, entries recorded while the buffer is full
+  /// are dropped (and the number of dropped entries is logged on the next
+  /// flush) instead of blocking the recording thread until the buffer is
+  /// flushed.
+  Log(const std::filesystem::path &storage_directory, int32_t buffer_size, int32_t buffer_flush_interval_millis,
+      bool drop_when_full = false);
 
   ~Log();
 
@@ -50,7 +55,8 @@ class Log {
   /// they won't do anything. Isn't thread-safe.
   void Start();
 
-  /// Adds an entry to the audit log. Thread-safe.
+  /// Adds an entry to the audit log. Thread-safe and lock-free unless the
+  /// buffer is full and entries aren't dropped.
   void Record(const std::string &address, const std::string &username, const std::string &query,
               const storage::PropertyValue &params, const std::string &db);
 
@@ -63,7 +69,9 @@ class Log {
   std::filesystem::path storage_directory_;
   int32_t buffer_size_;
   int32_t buffer_flush_interval_millis_;
+  bool drop_when_full_;
   std::atomic<bool> started_;
+  std::atomic<uint64_t> dropped_{0};
 
   std::optional<RingBuffer<Item>> buffer_;
   utils::Scheduler scheduler_;
@@ -11,10 +11,12 @@
 #include <cstring>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <utility>
 
 #include <fmt/format.h>
 
+#include "auth/crypto.hpp"
 #include "auth/exceptions.hpp"
 #include "license/license.hpp"
 #include "utils/flag_validation.hpp"
@@ -41,6 +43,10 @@ DEFINE_VALIDATED_int32(auth_module_timeout_ms, 10000,
                        "Timeout (in milliseconds) used when waiting for a "
                        "response from the auth module.",
                        FLAG_IN_RANGE(100, 1800000));
+DEFINE_VALIDATED_uint64(auth_password_cache_ttl_sec, 60,
+                        "Time (in seconds) for which a verified password is recognized by its keyed digest instead of "
+                        "being hashed again on login. Set to 0 to verify the password on every login.",
+                        FLAG_IN_RANGE(0, 86400));
 
 namespace memgraph::auth {
 const std::string kUserPrefix = "user:";
@@ -64,6 +70,30 @@ const std::string kLinkPrefix = "link:";
  * key="link:<username>", value="<rolename>"
  */
 
+namespace {
+
+User ParseUser(const std::string &serialized) {
+  nlohmann::json data;
+  try {
+    data = nlohmann::json::parse(serialized);
+  } catch (const nlohmann::json::parse_error &e) {
+    throw AuthException("Couldn't load user data!");
+  }
+  return User::Deserialize(data);
+}
+
+Role ParseRole(const std::string &serialized) {
+  nlohmann::json data;
+  try {
+    data = nlohmann::json::parse(serialized);
+  } catch (const nlohmann::json::parse_error &e) {
+    throw AuthException("Couldn't load role data!");
+  }
+  return Role::Deserialize(data);
+}
+
+}  // namespace
+
 Auth::Auth(const std::string &storage_directory) : storage_(storage_directory), module_(FLAGS_auth_module_executable) {}
 
 std::optional<User> Auth::Authenticate(const std::string &username, const std::string &password) {
@@ -143,13 +173,21 @@ std::optional<User> Auth::Authenticate(const std::string &username, const std::s
     }
     SaveUser(*user);
     return user;
-  } else {
-    auto user = GetUser(username);
-    if (!user) {
-      spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the user doesn't exist.", username,
-                                          "https://memgr.ph/auth"));
-      return std::nullopt;
-    }
+  }
+  return AuthenticateWithStoredPassword(username, password);
+}
+
+std::optional<User> Auth::AuthenticateWithStoredPassword(const std::string &username,
+                                                         const std::string &password) const {
+  auto user = GetUser(username);
+  if (!user) {
+    spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the user doesn't exist.", username,
+                                        "https://memgr.ph/auth"));
+    return std::nullopt;
+  }
+
+  const std::chrono::seconds ttl(FLAGS_auth_password_cache_ttl_sec);
+  if (ttl.count() == 0) {
     if (!user->CheckPassword(password)) {
       spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the password is not correct.",
                                           username, "https://memgr.ph/auth"));
@@ -157,21 +195,46 @@ std::optional<User> Auth::Authenticate(const std::string &username, const std::s
     }
     return user;
   }
+
+  const auto digest = PasswordDigest(password);
+  const auto now = std::chrono::steady_clock::now();
+  const auto is_verified = verified_passwords_.WithLock([&](const auto &verified_passwords) {
+    const auto it = verified_passwords.find(user->username());
+    return it != verified_passwords.end() && it->second.digest == digest && it->second.expires_at > now;
+  });
+  if (is_verified) return user;
+
+  if (!user->CheckPassword(password)) {
+    spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the password is not correct.",
+                                        username, "https://memgr.ph/auth"));
+    return std::nullopt;
+  }
+  verified_passwords_.WithLock([&](auto &verified_passwords) {
+    verified_passwords.insert_or_assign(user->username(), VerifiedPassword{digest, now + ttl});
+  });
+  return user;
+}
+
+bool Auth::UsesAuthModule() const { return module_.IsUsed(); }
+
+void Auth::ClearCaches() {
+  users_cache_->clear();
+  verified_passwords_->clear();
 }
 
 std::optional<User> Auth::GetUser(const std::string &username_orig) const {
   auto username = utils::ToLowerCase(username_orig);
+  if (auto cached_user = users_cache_.WithLock([&](const auto &users) -> std::optional<User> {
+        const auto it = users.find(username);
+        if (it == users.end()) return std::nullopt;
+        return it->second;
+      })) {
+    return cached_user;
+  }
   auto existing_user = storage_.Get(kUserPrefix + username);
   if (!existing_user) return std::nullopt;
 
-  nlohmann::json data;
-  try {
-    data = nlohmann::json::parse(*existing_user);
-  } catch (const nlohmann::json::parse_error &e) {
-    throw AuthException("Couldn't load user data!");
-  }
-
-  auto user = User::Deserialize(data);
+  auto user = ParseUser(*existing_user);
   auto link = storage_.Get(kLinkPrefix + username);
 
   if (link) {
@@ -180,10 +243,12 @@ std::optional<User> Auth::GetUser(const std::string &username_orig) const {
       user.SetRole(*role);
     }
   }
+  users_cache_->insert_or_assign(username, user);
   return user;
 }
 
 void Auth::SaveUser(const User &user) {
+  ClearCaches();
   bool success = false;
   if (const auto *role = user.role(); role != nullptr) {
     success = storage_.PutMultiple(
@@ -211,6 +276,7 @@ std::optional<User> Auth::AddUser(const std::string &username, const std::option
 bool Auth::RemoveUser(const std::string &username_orig) {
   auto username = utils::ToLowerCase(username_orig);
   if (!storage_.Get(kUserPrefix + username)) return false;
+  ClearCaches();
   std::vector<std::string> keys({kLinkPrefix + username, kUserPrefix + username});
   if (!storage_.DeleteMultiple(keys)) {
     throw AuthException("Couldn't remove user '{}'!", username);
@@ -218,17 +284,57 @@ bool Auth::RemoveUser(const std::string &username_orig) {
   return true;
 }
 
+std::vector<User> Auth::LoadUsers(const std::vector<std::pair<std::string, std::string>> &user_data) const {
+  std::vector<std::string> link_keys;
+  link_keys.reserve(user_data.size());
+  for (const auto &[username, _] : user_data) {
+    link_keys.push_back(kLinkPrefix + username);
+  }
+  auto links = storage_.GetMultiple(link_keys);
+
+  // Roles are usually shared by many users, each of them is read only once.
+  std::map<std::string, std::optional<Role>> roles;
+  for (auto &link : links) {
+    if (!link) continue;
+    *link = utils::ToLowerCase(*link);
+    roles.emplace(*link, std::nullopt);
+  }
+  std::vector<std::string> role_keys;
+  role_keys.reserve(roles.size());
+  for (const auto &[rolename, _] : roles) {
+    role_keys.push_back(kRolePrefix + rolename);
+  }
+  const auto role_data = storage_.GetMultiple(role_keys);
+  auto role_data_it = role_data.begin();
+  for (auto &[_, role] : roles) {
+    if (*role_data_it) {
+      role = ParseRole(**role_data_it);
+    }
+    ++role_data_it;
+  }
+
+  std::vector<User> users;
+  users.reserve(user_data.size());
+  for (size_t i = 0; i < user_data.size(); ++i) {
+    auto user = ParseUser(user_data[i].second);
+    if (links[i]) {
+      if (const auto &role = roles[*links[i]]; role) {
+        user.SetRole(*role);
+      }
+    }
+    users.push_back(std::move(user));
+  }
+  return users;
+}
+
 std::vector<auth::User> Auth::AllUsers() const {
-  std::vector<auth::User> ret;
+  std::vector<std::pair<std::string, std::string>> user_data;
   for (auto it = storage_.begin(kUserPrefix); it != storage_.end(kUserPrefix); ++it) {
     auto username = it->first.substr(kUserPrefix.size());
     if (username != utils::ToLowerCase(username)) continue;
-    auto user = GetUser(username);
-    if (user) {
-      ret.push_back(std::move(*user));
-    }
+    user_data.emplace_back(std::move(username), it->second);
   }
-  return ret;
+  return LoadUsers(user_data);
 }
 
 bool Auth::HasUsers() const { return storage_.begin(kUserPrefix) != storage_.end(kUserPrefix); }
@@ -238,17 +344,11 @@ std::optional<Role> Auth::GetRole(const std::string &rolename_orig) const {
   auto existing_role = storage_.Get(kRolePrefix + rolename);
   if (!existing_role) return std::nullopt;
 
-  nlohmann::json data;
-  try {
-    data = nlohmann::json::parse(*existing_role);
-  } catch (const nlohmann::json::parse_error &e) {
-    throw AuthException("Couldn't load role data!");
-  }
-
-  return Role::Deserialize(data);
+  return ParseRole(*existing_role);
 }
 
 void Auth::SaveRole(const Role &role) {
+  ClearCaches();
   if (!storage_.Put(kRolePrefix + role.rolename(), role.Serialize().dump())) {
     throw AuthException("Couldn't save role '{}'!", role.rolename());
   }
@@ -267,6 +367,7 @@ std::optional<Role> Auth::AddRole(const std::string &rolename) {
 bool Auth::RemoveRole(const std::string &rolename_orig) {
   auto rolename = utils::ToLowerCase(rolename_orig);
   if (!storage_.Get(kRolePrefix + rolename)) return false;
+  ClearCaches();
   std::vector<std::string> keys;
   for (auto it = storage_.begin(kLinkPrefix); it != storage_.end(kLinkPrefix); ++it) {
     if (utils::ToLowerCase(it->second) == rolename) {
@@ -285,31 +386,39 @@ std::vector<auth::Role> Auth::AllRoles() const {
   for (auto it = storage_.begin(kRolePrefix); it != storage_.end(kRolePrefix); ++it) {
     auto rolename = it->first.substr(kRolePrefix.size());
     if (rolename != utils::ToLowerCase(rolename)) continue;
-    auto role = GetRole(rolename);
-    if (role) {
-      ret.push_back(*role);
-    } else {
-      throw AuthException("Couldn't load role '{}'!", rolename);
-    }
+    ret.push_back(ParseRole(it->second));
   }
   return ret;
 }
 
 std::vector<auth::User> Auth::AllUsersForRole(const std::string &rolename_orig) const {
   auto rolename = utils::ToLowerCase(rolename_orig);
-  std::vector<auth::User> ret;
+  std::vector<std::string> usernames;
+  std::vector<std::string> user_keys;
   for (auto it = storage_.begin(kLinkPrefix); it != storage_.end(kLinkPrefix); ++it) {
     auto username = it->first.substr(kLinkPrefix.size());
     if (username != utils::ToLowerCase(username)) continue;
     if (it->second != utils::ToLowerCase(it->second)) continue;
     if (it->second == rolename) {
-      auto user = GetUser(username);
-      if (user) {
-        ret.push_back(std::move(*user));
-      } else {
-        throw AuthException("Couldn't load user '{}'!", username);
-      }
+      user_keys.push_back(kUserPrefix + username);
+      usernames.push_back(std::move(username));
+    }
+  }
+  if (usernames.empty()) return {};
+
+  const auto role = GetRole(rolename);
+  const auto user_data = storage_.GetMultiple(user_keys);
+  std::vector<auth::User> ret;
+  ret.reserve(usernames.size());
+  for (size_t i = 0; i < usernames.size(); ++i) {
+    if (!user_data[i]) {
+      throw AuthException("Couldn't load user '{}'!", usernames[i]);
+    }
+    auto user = ParseUser(*user_data[i]);
+    if (role) {
+      user.SetRole(*role);
     }
+    ret.push_back(std::move(user));
   }
   return ret;
 }
@@ -344,13 +453,15 @@ bool Auth::RevokeDatabaseFromUser(const std::string &db, const std::string &name
 }
 
 void Auth::DeleteDatabase(const std::string &db) {
-  for (auto it = storage_.begin(kUserPrefix); it != storage_.end(kUserPrefix); ++it) {
-    auto username = it->first.substr(kUserPrefix.size());
-    auto user = GetUser(username);
-    if (user) {
-      user->db_access().Delete(db);
-      SaveUser(*user);
-    }
+  ClearCaches();
+  std::map<std::string, std::string> items;
+  for (auto &user : AllUsers()) {
+    user.db_access().Delete(db);
+    // The links to the roles are unchanged, only the users are written.
+    items.emplace(kUserPrefix + user.username(), user.Serialize().dump());
+  }
+  if (!storage_.PutMultiple(items)) {
+    throw AuthException("Couldn't remove database '{}' from the users!", db);
   }
 }
 
@@ -367,4 +478,13 @@ bool Auth::SetMainDatabase(const std::string &db, const std::string &name) {
 }
 #endif
 
+std::optional<User> Authenticate(utils::Synchronized<Auth, utils::WritePrioritizedRWLock> *auth,
+                                 const std::string &username, const std::string &password) {
+  {
+    auto locked_auth = auth->ReadLock();
+    if (!locked_auth->UsesAuthModule()) return locked_auth->AuthenticateWithStoredPassword(username, password);
+  }
+  return auth->Lock()->Authenticate(username, password);
+}
+
 }  // namespace memgraph::auth
@@ -9,14 +9,19 @@
 #pragma once
 
 #include <mutex>
+#include <chrono>
 #include <optional>
+#include <unordered_map>
 #include <vector>
 
 #include "auth/exceptions.hpp"
 #include "auth/models.hpp"
 #include "auth/module.hpp"
 #include "kvstore/kvstore.hpp"
+#include "utils/rw_lock.hpp"
 #include "utils/settings.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::auth {
 
@@ -44,6 +49,28 @@ class Auth final {
    */
   std::optional<User> Authenticate(const std::string &username, const std::string &password);
 
+  /**
+   * Authenticates a user using the password stored for the user, without
+   * consulting the auth module. Unlike `Authenticate` it doesn't modify the
+   * storage, so it can be called concurrently under a read lock.
+   *
+   * A password that was verified less than `--auth-password-cache-ttl-sec`
+   * seconds ago is recognized by its keyed digest instead of being hashed
+   * again.
+   *
+   * @param username
+   * @param password
+   *
+   * @return a user when the username and password match, nullopt otherwise
+   * @throw AuthException if unable to authenticate for whatever reason.
+   */
+  std::optional<User> AuthenticateWithStoredPassword(const std::string &username, const std::string &password) const;
+
+  /**
+   * Returns whether the users are authenticated by the auth module.
+   */
+  bool UsesAuthModule() const;
+
   /**
    * Gets a user from the storage.
    *
@@ -199,10 +226,41 @@ class Auth final {
 #endif
 
  private:
+  /// Deserializes the users from their (username, serialized user) pairs and
+  /// loads their links and roles with one batched lookup each.
+  std::vector<User> LoadUsers(const std::vector<std::pair<std::string, std::string>> &user_data) const;
+
+  /// Drops the cached users and verified passwords, called on every change of
+  /// the storage.
+  void ClearCaches();
+
+  struct VerifiedPassword {
+    std::string digest;
+    std::chrono::steady_clock::time_point expires_at;
+  };
+
   // Even though the `kvstore::KVStore` class is guaranteed to be thread-safe,
   // Auth is not thread-safe because modifying users and roles might require
   // more than one operation on the storage.
   kvstore::KVStore storage_;
   auth::Module module_;
+  // Users (with their roles) as deserialized from the storage, and the digests
+  // of their recently verified passwords, both keyed by the username. The const
+  // functions are called concurrently under a read lock, so they're
+  // synchronized on their own.
+  mutable utils::Synchronized<std::unordered_map<std::string, User>, utils::SpinLock> users_cache_;
+  mutable utils::Synchronized<std::unordered_map<std::string, VerifiedPassword>, utils::SpinLock> verified_passwords_;
 };
+
+/**
+ * Authenticates a user, verifying the stored password under the read lock of
+ * `auth` so that concurrent logins don't serialize on password hashing. The
+ * write lock is taken only when the auth module is used, because it creates
+ * and updates the users.
+ *
+ * @return a user when the username and password match, nullopt otherwise
+ * @throw AuthException if unable to authenticate for whatever reason.
+ */
+std::optional<User> Authenticate(utils::Synchronized<Auth, utils::WritePrioritizedRWLock> *auth,
+                                 const std::string &username, const std::string &password);
 }  // namespace memgraph::auth
@@ -7,13 +7,16 @@
 //
 #include "auth/crypto.hpp"
 
+#include <array>
 #include <iomanip>
 #include <sstream>
 
 #include <gflags/gflags.h>
 #include <libbcrypt/bcrypt.h>
 #include <openssl/evp.h>
+#include <openssl/hmac.h>
 #include <openssl/opensslv.h>
+#include <openssl/rand.h>
 #include <openssl/sha.h>
 
 #include "auth/exceptions.hpp"
@@ -181,4 +184,23 @@ std::string EncryptPassword(const std::string &password) {
   }
 }
 
+std::string PasswordDigest(const std::string &password) {
+  static const auto key = [] {
+    std::array<unsigned char, SHA256_DIGEST_LENGTH> key{};
+    if (RAND_bytes(key.data(), static_cast<int>(key.size())) != 1) {
+      throw AuthException("Couldn't generate the password digest key!");
+    }
+    return key;
+  }();
+
+  std::array<unsigned char, SHA256_DIGEST_LENGTH> digest{};
+  unsigned int digest_size = 0;
+  if (HMAC(EVP_sha256(), key.data(), static_cast<int>(key.size()),
+           reinterpret_cast<const unsigned char *>(password.data()), password.size(), digest.data(),
+           &digest_size) == nullptr) {
+    throw AuthException("Couldn't compute the password digest!");
+  }
+  return {reinterpret_cast<const char *>(digest.data()), digest_size};
+}
+
 }  // namespace memgraph::auth
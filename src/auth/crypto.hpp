@@ -18,4 +18,10 @@ std::string EncryptPassword(const std::string &password);
 
 /// @throw AuthException if unable to verify the password.
 bool VerifyPassword(const std::string &password, const std::string &hash);
+
+/// Returns a keyed SHA-256 digest of the password, which is much cheaper than
+/// `VerifyPassword`. The key is generated randomly once per process, so the
+/// digest only identifies a password that was already verified by this process.
+/// @throw AuthException if unable to compute the digest.
+std::string PasswordDigest(const std::string &password);
 }  // namespace memgraph::auth
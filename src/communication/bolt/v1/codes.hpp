@@ -49,6 +49,10 @@ enum class Signature : uint8_t {
   Duration = 0x45,
   LocalDateTime = 0x64,
   LocalTime = 0x74,
+
+  /// Spatial data types
+  Point2d = 0x58,
+  Point3d = 0x59,
 };
 
 enum class Marker : uint8_t {
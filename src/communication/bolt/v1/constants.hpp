@@ -31,5 +31,11 @@ inline constexpr size_t kHandshakeSize = 20;
 inline constexpr uint16_t kSupportedVersions[] = {0x0100, 0x0400, 0x0401, 0x0403, 0x0502};
 
 inline constexpr int kPullAll = -1;
+
+/**
+ * Seconds for which the clients may use the routing table sent for ROUTE.
+ */
+inline constexpr int64_t kRoutingTableTtlSec = 300;
+
 inline constexpr int kPullLast = -1;
 }  // namespace memgraph::communication::bolt
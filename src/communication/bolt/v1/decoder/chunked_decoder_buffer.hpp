@@ -47,11 +47,16 @@ enum class ChunkState : uint8_t {
  * the data can then be read. While getting a chunk the buffer checks the
  * chunk for validity and then copies only data from the chunk. The headers
  * aren't copied so that the decoder can read only the raw encoded data.
+ *
+ * The data of a chunk is copied as it arrives, so the underlying buffer
+ * doesn't have to fit a whole chunk. The internal buffer grows to the size
+ * of the largest message, and is freed after the message if it grew larger
+ * than a chunk.
  */
 template <typename TBuffer>
 class ChunkedDecoderBuffer {
  public:
-  ChunkedDecoderBuffer(TBuffer &buffer) : buffer_(buffer) { data_.reserve(kChunkMaxDataSize); }
+  ChunkedDecoderBuffer(TBuffer &buffer) : buffer_(buffer) {}
 
   /**
    * Reads data from the internal buffer.
@@ -67,7 +72,11 @@ class ChunkedDecoderBuffer {
     pos_ += len;
     if (Size() == 0) {
       pos_ = 0;
-      data_.clear();
+      if (data_.capacity() > kChunkMaxDataSize) {
+        data_ = {};
+      } else {
+        data_.clear();
+      }
     }
     return true;
   }
@@ -97,31 +106,31 @@ class ChunkedDecoderBuffer {
    *                           message is whole)
    */
   ChunkState GetChunk() {
-    uint8_t *data = buffer_.data();
-    size_t size = buffer_.size();
-
-    if (size < 2) {
-      return ChunkState::Partial;
-    }
-
-    size_t chunk_size = data[0];
-    chunk_size <<= 8;
-    chunk_size += data[1];
-
-    if (chunk_size == 0) {
-      // The message is done.
+    if (chunk_remaining_ == 0) {
+      uint8_t *data = buffer_.data();
+      if (buffer_.size() < 2) {
+        return ChunkState::Partial;
+      }
+
+      size_t chunk_size = data[0];
+      chunk_size <<= 8;
+      chunk_size += data[1];
       buffer_.Shift(2);
-      return ChunkState::Done;
-    }
 
-    if (size < chunk_size + 2) {
-      return ChunkState::Partial;
+      if (chunk_size == 0) {
+        // The message is done.
+        return ChunkState::Done;
+      }
+      chunk_remaining_ = chunk_size;
     }
 
-    std::copy(data + 2, data + chunk_size + 2, std::back_inserter(data_));
-    buffer_.Shift(chunk_size + 2);
+    const size_t size = std::min(buffer_.size(), chunk_remaining_);
+    uint8_t *data = buffer_.data();
+    data_.insert(data_.end(), data, data + size);
+    buffer_.Shift(size);
+    chunk_remaining_ -= size;
 
-    return ChunkState::Whole;
+    return chunk_remaining_ == 0 ? ChunkState::Whole : ChunkState::Partial;
   }
 
   /**
@@ -135,5 +144,7 @@ class ChunkedDecoderBuffer {
   TBuffer &buffer_;
   std::vector<uint8_t> data_;
   size_t pos_{0};
+  // Data of the current chunk which wasn't copied yet.
+  size_t chunk_remaining_{0};
 };
 }  // namespace memgraph::communication::bolt
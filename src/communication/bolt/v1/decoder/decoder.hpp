@@ -131,6 +131,8 @@ class Decoder {
             return ReadUnboundedEdge(data);
           case Signature::Path:
             return ReadPath(data);
+          case Signature::Point2d:
+            return ReadPoint(data, false);
           default:
             return false;
         }
@@ -143,6 +145,8 @@ class Decoder {
         switch (static_cast<Signature>(signature)) {
           case Signature::Duration:
             return ReadDuration(data);
+          case Signature::Point3d:
+            return ReadPoint(data, true);
           default:
             return false;
         }
@@ -630,5 +634,25 @@ class Decoder {
     *data = Value(utils::Duration(micros.count()));
     return true;
   }
+
+  bool ReadPoint(Value *data, bool is_3d) {
+    Value dv;
+    if (!ReadValue(&dv, Value::Type::Int)) {
+      return false;
+    }
+    const auto crs = storage::SridToCrs(dv.ValueInt());
+    if (!crs || storage::Is3d(*crs) != is_3d) {
+      return false;
+    }
+    std::array<double, 3> coordinates{0.0};
+    for (auto i = 0; i < (is_3d ? 3 : 2); ++i) {
+      if (!ReadValue(&dv, Value::Type::Double)) {
+        return false;
+      }
+      coordinates[i] = dv.ValueDouble();
+    }
+    *data = Value(storage::Point(*crs, coordinates[0], coordinates[1], coordinates[2]));
+    return true;
+  }
 };
 }  // namespace memgraph::communication::bolt
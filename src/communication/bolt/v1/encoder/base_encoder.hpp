@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <array>
+#include <charconv>
 #include <type_traits>
 
 #include "communication/bolt/v1/codes.hpp"
@@ -27,7 +29,7 @@ namespace memgraph::communication::bolt {
 /**
  * Bolt BaseEncoder. Has public interfaces for writing Bolt encoded data.
  * Supported types are: Null, Bool, Int, Double, String, List, Map, Vertex,
- * Edge, Date, LocalDate, LocalDateTime, Duration.
+ * Edge, Date, LocalDate, LocalDateTime, Duration, Point.
  *
  * The purpose of this class is to stream bolt data into the given Buffer.
  *
@@ -109,6 +111,20 @@ class BaseEncoder {
     WriteRAW(value.c_str(), value.size());
   }
 
+  // Writes the element ID introduced in Bolt v5, which is the decimal ID if
+  // it isn't set.
+  void WriteElementId(const std::string &element_id, Id id) {
+    if (!element_id.empty()) {
+      WriteString(element_id);
+      return;
+    }
+    std::array<char, 20> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), id.AsInt());
+    const auto size = static_cast<size_t>(result.ptr - digits.data());
+    WriteTypeSize(size, MarkerString);
+    WriteRAW(digits.data(), size);
+  }
+
   void WriteList(const std::vector<Value> &value) {
     WriteTypeSize(value.size(), MarkerList);
     for (auto &x : value) WriteValue(x);
@@ -143,7 +159,7 @@ class BaseEncoder {
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(vertex.element_id);
+      WriteElementId(vertex.element_id, vertex.id);
     }
   }
 
@@ -169,12 +185,12 @@ class BaseEncoder {
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(edge.element_id);
+      WriteElementId(edge.element_id, edge.id);
       if (!unbound) {
         // from_element_id introduced in v5.0
-        WriteString(edge.from_element_id);
+        WriteElementId(edge.from_element_id, edge.from);
         // to_element_id introduced in v5.0
-        WriteString(edge.to_element_id);
+        WriteElementId(edge.to_element_id, edge.to);
       }
     }
   }
@@ -197,7 +213,7 @@ class BaseEncoder {
 
     if (major_v_ > 4) {
       // element_id introduced in v5.0
-      WriteString(edge.element_id);
+      WriteElementId(edge.element_id, edge.id);
     }
   }
 
@@ -243,6 +259,16 @@ class BaseEncoder {
     WriteInt(duration.SubSecondsAsNanoseconds());
   }
 
+  void WritePoint(const storage::Point &point) {
+    const auto is_3d = storage::Is3d(point.crs);
+    WriteRAW(utils::UnderlyingCast(is_3d ? Marker::TinyStruct4 : Marker::TinyStruct3));
+    WriteRAW(utils::UnderlyingCast(is_3d ? Signature::Point3d : Signature::Point2d));
+    WriteInt(static_cast<int64_t>(point.crs));
+    WriteDouble(point.x);
+    WriteDouble(point.y);
+    if (is_3d) WriteDouble(point.z);
+  }
+
   void WriteValue(const Value &value) {
     switch (value.type()) {
       case Value::Type::Null:
@@ -290,6 +316,9 @@ class BaseEncoder {
       case Value::Type::Duration:
         WriteDuration(value.ValueDuration());
         break;
+      case Value::Type::Point:
+        WritePoint(value.ValuePoint());
+        break;
     }
   }
 
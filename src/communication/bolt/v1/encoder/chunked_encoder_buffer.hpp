@@ -12,8 +12,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "communication/bolt/v1/constants.hpp"
@@ -41,7 +43,10 @@ namespace memgraph::communication::bolt {
  * unnecessarily buffered in memory.
  *
  * The current implementation stores only a single chunk into memory and sends
- * it immediately to the output stream when new data arrives.
+ * it immediately to the output stream when new data arrives. If the output
+ * stream can write a sequence of buffers at once, data spanning whole chunks
+ * is sent directly from the caller's memory together with the chunk headers,
+ * instead of being copied into the chunk first.
  *
  * @tparam TOutputStream the output stream that should be used
  */
@@ -58,6 +63,17 @@ class ChunkedEncoderBuffer {
    * @param n is the number of bytes
    */
   void Write(const uint8_t *values, size_t n) {
+    if constexpr (requires(std::span<const std::span<const uint8_t>> buffers) {
+                    output_stream_.WriteGathered(buffers, true);
+                  }) {
+      if (n >= kChunkMaxDataSize && output_stream_.CanWriteGathered()) {
+        const auto whole_chunks_size = n - n % kChunkMaxDataSize;
+        WriteWholeChunks(values, whole_chunks_size);
+        values += whole_chunks_size;
+        n -= whole_chunks_size;
+      }
+    }
+
     size_t written = 0;
 
     while (n > 0) {
@@ -114,6 +130,28 @@ class ChunkedEncoderBuffer {
   bool HasData() { return have_ > 0; }
 
  private:
+  // Sends the buffered data as a chunk, followed by the chunks of `values`
+  // whose `n` is a multiple of the maximum chunk data size, with a single
+  // gathered write. The write is synchronous, so `values` don't have to
+  // outlive the call.
+  void WriteWholeChunks(const uint8_t *values, size_t n) {
+    static constexpr std::array<uint8_t, kChunkHeaderSize> kWholeChunkHeader{kChunkMaxDataSize >> 8,
+                                                                            kChunkMaxDataSize & 0xFF};
+    std::vector<std::span<const uint8_t>> buffers;
+    buffers.reserve(2 * (n / kChunkMaxDataSize) + 1);
+    if (have_ > 0) {
+      chunk_[0] = have_ >> 8;
+      chunk_[1] = have_ & 0xFF;
+      buffers.emplace_back(chunk_.data(), kChunkHeaderSize + have_);
+    }
+    for (size_t offset = 0; offset < n; offset += kChunkMaxDataSize) {
+      buffers.emplace_back(kWholeChunkHeader);
+      buffers.emplace_back(values + offset, kChunkMaxDataSize);
+    }
+    output_stream_.WriteGathered(buffers, true);
+    Clear();
+  }
+
   // The output stream used.
   TOutputStream &output_stream_;
 
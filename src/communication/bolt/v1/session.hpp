@@ -13,7 +13,10 @@
 
 #include <concepts>
 #include <cstddef>
+#include <functional>
+#include <map>
 #include <optional>
+#include <string>
 #include <thread>
 
 #include "communication/bolt/v1/constants.hpp"
@@ -31,6 +34,7 @@
 #include "dbms/global.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/uuid.hpp"
 
 namespace memgraph::communication::bolt {
@@ -81,7 +85,7 @@ class Session : public dbms::SessionInterface {
    * if an explicit transaction was started.
    */
   virtual std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params,
+      const std::string &query, std::map<std::string, Value> params,
       const std::map<std::string, memgraph::communication::bolt::Value> &extra) = 0;
 
   virtual void Configure(const std::map<std::string, memgraph::communication::bolt::Value> &run_time_info) = 0;
@@ -106,8 +110,16 @@ class Session : public dbms::SessionInterface {
    */
   virtual std::map<std::string, Value> Discard(std::optional<int> n, std::optional<int> qid) = 0;
 
+  /**
+   * Compute results of the last query ahead of the next PULL, until
+   * `should_stop` returns true. Errors are reported by the next PULL.
+   */
+  virtual void Prefetch(const std::function<bool()> & /*should_stop*/) {}
+
   virtual void BeginTransaction(const std::map<std::string, memgraph::communication::bolt::Value> &params) = 0;
-  virtual void CommitTransaction() = 0;
+  /** Returns the metadata of the SUCCESS message, i.e. the bookmark of the
+   * committed transaction. */
+  virtual std::map<std::string, Value> CommitTransaction() = 0;
   virtual void RollbackTransaction() = 0;
 
   /** Aborts currently running query. */
@@ -125,10 +137,6 @@ class Session : public dbms::SessionInterface {
    */
   void Execute() {
     if (UNLIKELY(!handshake_done_)) {
-      // Resize the input buffer to ensure that a whole chunk can fit into it.
-      // This can be done only once because the buffer holds its size.
-      input_stream_.Resize(kChunkWholeSize);
-
       // Receive the handshake.
       if (input_stream_.size() < kHandshakeSize) {
         spdlog::trace("Received partial handshake of size {}", input_stream_.size());
@@ -160,7 +168,7 @@ class Session : public dbms::SessionInterface {
         case State::Idle:
         case State::Result:
           at_least_one_run_ = true;
-          state_ = StateExecutingRun(*this, state_);
+          state_ = busy_ ? StateBusyRun(*this, state_) : StateExecutingRun(*this, state_);
           break;
         case State::Error:
           state_ = StateErrorRun(*this, state_);
@@ -181,6 +189,27 @@ class Session : public dbms::SessionInterface {
     }
   }
 
+  /**
+   * Executes the session like `Execute`, but fails the queries instead of
+   * executing them, because the server has too much work queued for the
+   * client.
+   */
+  void ExecuteBusy() {
+    busy_ = true;
+    const utils::OnScopeExit reset_busy{[this] { busy_ = false; }};
+    Execute();
+  }
+
+  /**
+   * Computes results ahead of the next PULL if the last PULL left results
+   * which weren't sent, while the sent ones are received by the client.
+   */
+  void PrefetchResults(const std::function<bool()> &should_stop) {
+    if (state_ == State::Result) {
+      Prefetch(should_stop);
+    }
+  }
+
   void HandleError() {
     if (!at_least_one_run_) {
       spdlog::info("Sudden connection loss. Make sure the client supports Memgraph.");
@@ -200,6 +229,16 @@ class Session : public dbms::SessionInterface {
   bool handshake_done_{false};
   State state_{State::Handshake};
   bool at_least_one_run_{false};
+  bool busy_{false};
+
+  // The response to the last ROUTE message, which is sent again as long as
+  // the clients connect to the same address and database.
+  struct RoutingTable {
+    std::string address;
+    std::string db;
+    std::map<std::string, Value> response;
+  };
+  std::optional<RoutingTable> routing_table_;
 
   struct Version {
     uint8_t major;
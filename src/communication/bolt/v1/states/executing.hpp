@@ -115,28 +115,15 @@ State RunHandlerV5(Signature signature, TSession &session, State state, Marker m
     case Signature::Route:
       return HandleRoute<TSession>(session, marker);
     case Signature::LogOff:
-      return HandleLogOff<TSession>();
+      return HandleLogOff<TSession>(session, marker);
     default:
       spdlog::trace("Unrecognized signature received (0x{:02X})!", utils::UnderlyingCast(signature));
       return State::Close;
   }
 }
 
-/**
- * Executor state run function
- * This function executes an initialized Bolt session.
- * It executes: RUN, PULL_ALL, DISCARD_ALL & RESET.
- * @param session the session that should be used for the run
- */
 template <typename TSession>
-State StateExecutingRun(TSession &session, State state) {
-  Marker marker;
-  Signature signature;
-  if (!session.decoder_.ReadMessageHeader(&signature, &marker)) {
-    spdlog::trace("Missing header data!");
-    return State::Close;
-  }
-
+State RunHandler(Signature signature, TSession &session, State state, Marker marker) {
   switch (session.version_.major) {
     case 1:
       memgraph::metrics::IncrementCounter(memgraph::metrics::BoltMessages);
@@ -159,4 +146,65 @@ State StateExecutingRun(TSession &session, State state) {
       return State::Close;
   }
 }
+
+/**
+ * Executor state run function
+ * This function executes an initialized Bolt session.
+ * It executes: RUN, PULL_ALL, DISCARD_ALL & RESET.
+ * @param session the session that should be used for the run
+ */
+template <typename TSession>
+State StateExecutingRun(TSession &session, State state) {
+  Marker marker;
+  Signature signature;
+  if (!session.decoder_.ReadMessageHeader(&signature, &marker)) {
+    spdlog::trace("Missing header data!");
+    return State::Close;
+  }
+  return RunHandler(signature, session, state, marker);
+}
+
+/**
+ * Busy state run function
+ * This function fails the messages of an initialized Bolt session without
+ * executing them, because the server has too much work queued for the
+ * client. RESET, GOODBYE and NOOP are still handled, so the client can retry.
+ * @param session the session that should be used for the run
+ */
+template <typename TSession>
+State StateBusyRun(TSession &session, State state) {
+  Marker marker;
+  Signature signature;
+  if (!session.decoder_.ReadMessageHeader(&signature, &marker)) {
+    spdlog::trace("Missing header data!");
+    return State::Close;
+  }
+  if (signature == Signature::Reset || signature == Signature::Goodbye || signature == Signature::Noop) {
+    return RunHandler(signature, session, state, marker);
+  }
+
+  uint8_t value = utils::UnderlyingCast(marker);
+  if ((value & 0xF0U) != utils::UnderlyingCast(Marker::TinyStruct)) {
+    spdlog::trace("Expected TinyStruct marker, but received 0x{:02X}!", value);
+    return State::Close;
+  }
+  value &= 0x0FU;
+  Value dv;
+  for (int i = 0; i < value; ++i) {
+    if (!session.decoder_.ReadValue(&dv)) {
+      spdlog::trace("Couldn't clean up parameter {} / {}!", i, value);
+      return State::Close;
+    }
+  }
+
+  memgraph::metrics::IncrementCounter(memgraph::metrics::BoltMessages);
+  session.encoder_buffer_.Clear();
+  if (!session.encoder_.MessageFailure({{"code", "Memgraph.TransientError.General.ServerBusy"},
+                                        {"message", "The server is busy with other queries of the client. Retry the "
+                                                    "query after its previous queries finish."}})) {
+    spdlog::trace("Couldn't send failure message!");
+    return State::Close;
+  }
+  return State::Error;
+}
 }  // namespace memgraph::communication::bolt
@@ -212,7 +212,7 @@ State HandleRunV1(TSession &session, const State state, const Marker marker) {
 
   try {
     // Interpret can throw.
-    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(), {});
+    const auto [header, qid] = session.Interpret(query.ValueString(), std::move(params.ValueMap()), {});
     // Convert std::string to Value
     std::vector<Value> vec;
     std::map<std::string, Value> data;
@@ -276,7 +276,7 @@ State HandleRunV4(TSession &session, const State state, const Marker marker) {
 
   try {
     // Interpret can throw.
-    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(), extra.ValueMap());
+    const auto [header, qid] = session.Interpret(query.ValueString(), std::move(params.ValueMap()), extra.ValueMap());
     // Convert std::string to Value
     std::vector<Value> vec;
     std::map<std::string, Value> data;
@@ -412,11 +412,11 @@ State HandleCommit(TSession &session, const State state, const Marker marker) {
   DMG_ASSERT(!session.encoder_buffer_.HasData(), "There should be no data to write in this state");
 
   try {
-    if (!session.encoder_.MessageSuccess({})) {
+    // The transaction is committed first so its bookmark can be sent.
+    if (!session.encoder_.MessageSuccess(session.CommitTransaction())) {
       spdlog::trace("Couldn't send success message!");
       return State::Close;
     }
-    session.CommitTransaction();
     return State::Idle;
   } catch (const std::exception &e) {
     return HandleFailure(session, e);
@@ -462,9 +462,10 @@ State HandleGoodbye() {
 
 template <typename TSession>
 State HandleRoute(TSession &session, const Marker marker) {
-  // Route message is not implemented since it is Neo4j specific, therefore we will receive it and inform user that
-  // there is no implementation. Before that, we have to read out the fields from the buffer to leave it in a clean
-  // state.
+  // Memgraph is a single instance, so the routing table sends the clients
+  // back to the address they connected to for reading, writing and routing.
+  // Clusters of Neo4j aren't supported, so the clients which don't send the
+  // address are informed that routing isn't supported.
   if (marker != Marker::TinyStruct3) {
     spdlog::trace("Expected TinyStruct3 marker, but received 0x{:02x}!", utils::UnderlyingCast(marker));
     return State::Close;
@@ -485,6 +486,42 @@ State HandleRoute(TSession &session, const Marker marker) {
     spdlog::trace("Couldn't read db field!");
     return State::Close;
   }
+
+  const auto &routing_context = routing.ValueMap();
+  const auto address = routing_context.find("address");
+  if (address != routing_context.end() && address->second.type() == Value::Type::String) {
+    // The database is sent as a string before Bolt v4.4 and in a map since.
+    std::string db_name = session.GetDatabaseName();
+    if (db.type() == Value::Type::String) {
+      db_name = db.ValueString();
+    } else if (db.type() == Value::Type::Map) {
+      const auto &extra = db.ValueMap();
+      if (auto it = extra.find("db"); it != extra.end() && it->second.type() == Value::Type::String) {
+        db_name = it->second.ValueString();
+      }
+    }
+
+    auto &cached = session.routing_table_;
+    if (!cached || cached->address != address->second.ValueString() || cached->db != db_name) {
+      const auto server = [&](const char *role) {
+        return Value(std::map<std::string, Value>{{"addresses", Value(std::vector<Value>{address->second})},
+                                                  {"role", Value(role)}});
+      };
+      cached.emplace(address->second.ValueString(), db_name,
+                     std::map<std::string, Value>{
+                         {"rt", Value(std::map<std::string, Value>{
+                                    {"ttl", Value(kRoutingTableTtlSec)},
+                                    {"db", Value(db_name)},
+                                    {"servers", Value(std::vector<Value>{server("WRITE"), server("READ"),
+                                                                         server("ROUTE")})}})}});
+    }
+    if (!session.encoder_.MessageSuccess(cached->response)) {
+      spdlog::trace("Couldn't send routing table!");
+      return State::Close;
+    }
+    return State::Idle;
+  }
+
   session.encoder_buffer_.Clear();
   bool fail_sent =
       session.encoder_.MessageFailure({{"code", "66"}, {"message", "Route message is not supported in Memgraph!"}});
@@ -496,8 +533,22 @@ State HandleRoute(TSession &session, const Marker marker) {
 }
 
 template <typename TSession>
-State HandleLogOff() {
-  // No arguments sent, the user just needs to reauthenticate
+State HandleLogOff(TSession &session, const Marker marker) {
+  if (marker != Marker::TinyStruct) {
+    spdlog::trace("Expected TinyStruct marker, but received 0x{:02X}!", utils::UnderlyingCast(marker));
+    return State::Close;
+  }
+  // The connection and the session are kept, only the user has to
+  // authenticate again with LOGON. Anything the user left running is aborted.
+  try {
+    session.Abort();
+  } catch (const std::exception &e) {
+    return HandleFailure(session, e);
+  }
+  if (!session.encoder_.MessageSuccess({})) {
+    spdlog::trace("Couldn't send success message!");
+    return State::Close;
+  }
   return State::Init;
 }
 }  // namespace memgraph::communication::bolt
@@ -54,6 +54,7 @@ DEF_GETTER_BY_REF(Date, utils::Date, date_v)
 DEF_GETTER_BY_REF(LocalTime, utils::LocalTime, local_time_v)
 DEF_GETTER_BY_REF(LocalDateTime, utils::LocalDateTime, local_date_time_v)
 DEF_GETTER_BY_REF(Duration, utils::Duration, duration_v)
+DEF_GETTER_BY_REF(Point, storage::Point, point_v)
 
 #undef DEF_GETTER_BY_REF
 
@@ -103,6 +104,9 @@ Value::Value(const Value &other) : type_(other.type_) {
     case Type::Duration:
       new (&duration_v) utils::Duration(other.duration_v);
       return;
+    case Type::Point:
+      new (&point_v) storage::Point(other.point_v);
+      return;
   }
 }
 
@@ -157,6 +161,9 @@ Value &Value::operator=(const Value &other) {
       case Type::Duration:
         new (&duration_v) utils::Duration(other.duration_v);
         return *this;
+      case Type::Point:
+        new (&point_v) storage::Point(other.point_v);
+        return *this;
     }
   }
   return *this;
@@ -208,6 +215,9 @@ Value::Value(Value &&other) noexcept : type_(other.type_) {
     case Type::Duration:
       new (&duration_v) utils::Duration(other.duration_v);
       break;
+    case Type::Point:
+      new (&point_v) storage::Point(other.point_v);
+      break;
   }
 
   // reset the type of other
@@ -266,6 +276,9 @@ Value &Value::operator=(Value &&other) noexcept {
       case Type::Duration:
         new (&duration_v) utils::Duration(other.duration_v);
         break;
+      case Type::Point:
+        new (&point_v) storage::Point(other.point_v);
+        break;
     }
 
     // reset the type of other
@@ -324,6 +337,8 @@ Value::~Value() {
     case Type::Duration:
       duration_v.~Duration();
       return;
+    case Type::Point:
+      return;
   }
 }
 
@@ -427,6 +442,8 @@ std::ostream &operator<<(std::ostream &os, const Value &value) {
       return os << value.ValueLocalDateTime();
     case Value::Type::Duration:
       return os << value.ValueDuration();
+    case Value::Type::Point:
+      return os << value.ValuePoint();
   }
 }
 
@@ -462,6 +479,8 @@ std::ostream &operator<<(std::ostream &os, const Value::Type type) {
       return os << "local_date_time";
     case Value::Type::Duration:
       return os << "duration";
+    case Value::Type::Point:
+      return os << "point";
   }
 }
 }  // namespace memgraph::communication::bolt
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "storage/v2/point.hpp"
 #include "utils/cast.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/temporal.hpp"
@@ -52,6 +53,9 @@ inline bool operator!=(const Id &id1, const Id &id2) { return !(id1 == id2); }
 /**
  * Structure used when reading a Vertex with the decoder.
  * The decoder writes data into this structure.
+ *
+ * An empty element ID is encoded as the decimal ID, which avoids building a
+ * string for each encoded vertex and edge.
  */
 struct Vertex {
   Id id;
@@ -152,7 +156,8 @@ class Value {
     Date,
     LocalTime,
     LocalDateTime,
-    Duration
+    Duration,
+    Point
   };
 
   // constructors for primitive types
@@ -178,6 +183,7 @@ class Value {
     new (&local_date_time_v) utils::LocalDateTime(date_time);
   }
   Value(const utils::Duration &dur) : type_(Type::Duration) { new (&duration_v) utils::Duration(dur); }
+  Value(const storage::Point &point) : type_(Type::Point) { new (&point_v) storage::Point(point); }
   // move constructors for non-primitive values
   Value(std::string &&value) noexcept : type_(Type::String) { new (&string_v) std::string(std::move(value)); }
   Value(std::vector<Value> &&value) noexcept : type_(Type::List) { new (&list_v) std::vector<Value>(std::move(value)); }
@@ -225,6 +231,7 @@ class Value {
   DECL_GETTER_BY_REFERENCE(LocalTime, utils::LocalTime)
   DECL_GETTER_BY_REFERENCE(LocalDateTime, utils::LocalDateTime)
   DECL_GETTER_BY_REFERENCE(Duration, utils::Duration)
+  DECL_GETTER_BY_REFERENCE(Point, storage::Point)
 #undef DECL_GETTER_BY_REFERNCE
 
 #define TYPE_CHECKER(type) \
@@ -244,6 +251,7 @@ class Value {
   TYPE_CHECKER(LocalTime)
   TYPE_CHECKER(LocalDateTime)
   TYPE_CHECKER(Duration)
+  TYPE_CHECKER(Point)
 #undef TYPE_CHECKER
 
   friend std::ostream &operator<<(std::ostream &os, const Value &value);
@@ -267,6 +275,7 @@ class Value {
     utils::LocalTime local_time_v;
     utils::LocalDateTime local_date_time_v;
     utils::Duration duration_v;
+    storage::Point point_v;
   };
 };
 /**
@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,11 +11,68 @@
 
 #include "communication/buffer.hpp"
 
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
 #include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
 
 namespace memgraph::communication {
 
-Buffer::Buffer() : data_(kBufferInitialSize, 0), read_end_(this), write_end_(this) {}
+namespace {
+
+// Number of size classes of the storage kept in the pool. Larger storage is
+// freed when it is released.
+constexpr size_t kPooledSizeClasses = 8;
+// Storage kept in the pool in total, the storage released above it is freed.
+constexpr size_t kMaxPooledBytes = 64UL * 1024 * 1024;
+
+class StoragePool final {
+ public:
+  // The pool is never destroyed, so buffers can be destroyed at any time.
+  static StoragePool &Instance() {
+    static auto *pool = new StoragePool();
+    return *pool;
+  }
+
+  std::unique_ptr<uint8_t[]> Acquire(size_t size_class, size_t size) {
+    if (size_class < kPooledSizeClasses) {
+      std::lock_guard guard(lock_);
+      auto &free = free_[size_class];
+      if (!free.empty()) {
+        auto storage = std::move(free.back());
+        free.pop_back();
+        pooled_bytes_ -= size;
+        return storage;
+      }
+    }
+    return std::make_unique_for_overwrite<uint8_t[]>(size);
+  }
+
+  void Release(std::unique_ptr<uint8_t[]> storage, size_t size_class, size_t size) {
+    if (size_class >= kPooledSizeClasses) return;
+    std::lock_guard guard(lock_);
+    if (pooled_bytes_ + size > kMaxPooledBytes) return;
+    free_[size_class].push_back(std::move(storage));
+    pooled_bytes_ += size;
+  }
+
+ private:
+  utils::SpinLock lock_;
+  std::array<std::vector<std::unique_ptr<uint8_t[]>>, kPooledSizeClasses> free_;
+  size_t pooled_bytes_{0};
+};
+
+}  // namespace
+
+Buffer::Buffer() : read_end_(this), write_end_(this) {}
+
+Buffer::~Buffer() {
+  have_ = 0;
+  Release();
+}
 
 Buffer::ReadEnd::ReadEnd(Buffer *buffer) : buffer_(buffer) {}
 
@@ -43,7 +100,7 @@ Buffer::ReadEnd *Buffer::read_end() { return &read_end_; }
 
 Buffer::WriteEnd *Buffer::write_end() { return &write_end_; }
 
-uint8_t *Buffer::data() { return data_.data(); }
+uint8_t *Buffer::data() { return data_.get(); }
 
 size_t Buffer::size() const { return have_; }
 
@@ -52,29 +109,45 @@ void Buffer::Shift(size_t len) {
   if (len == have_) {
     have_ = 0;
   } else {
-    memmove(data_.data(), data_.data() + len, have_ - len);
+    memmove(data_.get(), data_.get() + len, have_ - len);
     have_ -= len;
   }
 }
 
 io::network::StreamBuffer Buffer::Allocate() {
-  DMG_ASSERT(data_.size() > have_,
+  Resize(kBufferInitialSize);
+  DMG_ASSERT(capacity_ > have_,
              "The buffer thinks that there is more data "
              "in the buffer than there is underlying "
              "storage space!");
-  return {data_.data() + have_, data_.size() - have_};
+  return {data_.get() + have_, capacity_ - have_};
 }
 
 void Buffer::Written(size_t len) {
   have_ += len;
-  DMG_ASSERT(have_ <= data_.size(), "Written more than storage has space!");
+  DMG_ASSERT(have_ <= capacity_, "Written more than storage has space!");
 }
 
 void Buffer::Resize(size_t len) {
-  if (len <= data_.size()) return;
-  data_.resize(len, 0);
+  if (len <= capacity_) return;
+  size_t size_class = 0;
+  while ((kBufferInitialSize << size_class) < len) ++size_class;
+  const size_t capacity = kBufferInitialSize << size_class;
+  auto data = StoragePool::Instance().Acquire(size_class, capacity);
+  if (have_ > 0) memcpy(data.get(), data_.get(), have_);
+  if (data_) StoragePool::Instance().Release(std::move(data_), size_class_, capacity_);
+  data_ = std::move(data);
+  size_class_ = size_class;
+  capacity_ = capacity;
 }
 
 void Buffer::Clear() { have_ = 0; }
 
+void Buffer::Release() {
+  if (have_ != 0 || !data_) return;
+  StoragePool::Instance().Release(std::move(data_), size_class_, capacity_);
+  data_ = nullptr;
+  capacity_ = 0;
+}
+
 }  // namespace memgraph::communication
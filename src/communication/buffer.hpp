@@ -11,7 +11,9 @@
 
 #pragma once
 
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 #include "io/network/stream_buffer.hpp"
 
@@ -24,8 +26,10 @@ namespace memgraph::communication {
  *
  * Allocating, writing and written stores data in the buffer. The stored
  * data can then be read using the pointer returned with the data function.
- * This implementation stores data in a variable sized array (a vector).
- * The internal array can only grow in size.
+ * This implementation stores data in an array taken from a pool shared by all
+ * buffers. The arrays come in size classes which double from the initial
+ * size, and the array is taken when data is first written, so a buffer which
+ * was released while it was empty doesn't hold any memory.
  *
  * This buffer is NOT thread safe. It is intended to be used in the network
  * stack where all execution when it is being done is being done on a single
@@ -34,7 +38,7 @@ namespace memgraph::communication {
 class Buffer final {
  private:
   // Initial capacity of the internal buffer.
-  const size_t kBufferInitialSize = 65536;
+  static constexpr size_t kBufferInitialSize = 65536;
 
  public:
   Buffer();
@@ -43,7 +47,7 @@ class Buffer final {
   Buffer(Buffer &&) = delete;
   Buffer &operator=(const Buffer &) = delete;
   Buffer &operator=(Buffer &&) = delete;
-  ~Buffer() = default;
+  ~Buffer();
 
   /**
    * This class provides all functions from the buffer that are needed to allow
@@ -111,6 +115,13 @@ class Buffer final {
    */
   WriteEnd *write_end();
 
+  /**
+   * Returns the internal storage to the shared pool if the buffer holds no
+   * data, e.g. while the connection is idle. The storage is taken again when
+   * data is written.
+   */
+  void Release();
+
  private:
   /**
    * This function returns a pointer to the internal buffer. It is used for
@@ -169,7 +180,9 @@ class Buffer final {
    */
   void Clear();
 
-  std::vector<uint8_t> data_;
+  std::unique_ptr<uint8_t[]> data_;
+  size_t size_class_{0};
+  size_t capacity_{0};
   size_t have_{0};
   ReadEnd read_end_;
   WriteEnd write_end_;
@@ -11,6 +11,10 @@
 
 #include "communication/client.hpp"
 
+#include <unistd.h>
+
+#include <array>
+
 #include "communication/helpers.hpp"
 #include "utils/logging.hpp"
 
@@ -21,6 +25,9 @@ Client::Client(ClientContext *context) : context_(context) {}
 Client::~Client() {
   Close();
   ReleaseSslObjects();
+  if (ssl_session_) {
+    SSL_SESSION_free(ssl_session_);
+  }
 }
 
 bool Client::Connect(const io::network::Endpoint &endpoint) {
@@ -64,6 +71,12 @@ bool Client::Connect(const io::network::Endpoint &endpoint) {
     // the read and write end. This function cannot fail.
     SSL_set_bio(ssl_, bio_, bio_);
 
+    // Resume the session of the previous connection. The server performs a
+    // full handshake if it doesn't accept it.
+    if (ssl_session_) {
+      SSL_set_session(ssl_, ssl_session_);
+    }
+
     // Clear all leftover errors.
     ERR_clear_error();
 
@@ -209,6 +222,50 @@ bool Client::Write(const std::string &str, bool have_more) {
   return Write(reinterpret_cast<const uint8_t *>(str.data()), str.size(), have_more);
 }
 
+bool Client::Write(std::span<const iovec> parts, bool have_more) {
+  if (ssl_) {
+    // OpenSSL has no gathered write, the parts are encrypted one by one.
+    for (const auto &part : parts) {
+      if (!Write(static_cast<const uint8_t *>(part.iov_base), part.iov_len, have_more)) return false;
+    }
+    return true;
+  }
+  return socket_.Write(parts, have_more);
+}
+
+bool Client::SendFile(int fd, uint64_t offset, size_t size, bool have_more) {
+  if (!ssl_) return socket_.SendFile(fd, offset, size);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (BIO_get_ktls_send(SSL_get_wbio(ssl_))) {
+    while (size > 0) {
+      ERR_clear_error();
+      auto written = SSL_sendfile(ssl_, fd, static_cast<off_t>(offset), size, 0);
+      if (written <= 0) {
+        if (SSL_get_error(ssl_, static_cast<int>(written)) != SSL_ERROR_WANT_WRITE) return false;
+        socket_.WaitForReadyWrite();
+      } else {
+        offset += written;
+        size -= written;
+      }
+    }
+    return true;
+  }
+#endif
+
+  // The data has to be encrypted in user space.
+  std::array<uint8_t, 65536> buffer;
+  while (size > 0) {
+    auto read = pread(fd, buffer.data(), std::min(size, buffer.size()), static_cast<off_t>(offset));
+    if (read == -1 && errno == EINTR) continue;
+    if (read <= 0) return false;
+    if (!Write(buffer.data(), read, have_more || static_cast<size_t>(read) < size)) return false;
+    offset += read;
+    size -= read;
+  }
+  return true;
+}
+
 const io::network::Endpoint &Client::endpoint() { return socket_.endpoint(); }
 
 void Client::ReleaseSslObjects() {
@@ -216,6 +273,21 @@ void Client::ReleaseSslObjects() {
   // free the SSL object because the `SSL_free` function also automatically
   // frees the BIO object.
   if (ssl_) {
+    // With TLS 1.3 the session tickets arrive after the handshake, so the
+    // session is kept once the connection is no longer used.
+    if (auto *session = SSL_get1_session(ssl_)) {
+#if OPENSSL_VERSION_NUMBER >= 0x10101000L
+      const bool resumable = SSL_SESSION_is_resumable(session) == 1;
+#else
+      const bool resumable = true;
+#endif
+      if (resumable) {
+        if (ssl_session_) SSL_SESSION_free(ssl_session_);
+        ssl_session_ = session;
+      } else {
+        SSL_SESSION_free(session);
+      }
+    }
     SSL_free(ssl_);
     ssl_ = nullptr;
     bio_ = nullptr;
@@ -114,6 +114,19 @@ class Client final {
    */
   bool Write(const std::string &str, bool have_more = false);
 
+  /**
+   * This function writes the parts to the socket in order without copying
+   * them into a single buffer.
+   */
+  bool Write(std::span<const iovec> parts, bool have_more = false);
+
+  /**
+   * This function writes `size` bytes of the file `fd` starting at `offset`
+   * to the socket. Without SSL, or with kernel TLS, the data is sent by the
+   * kernel without passing through user space.
+   */
+  bool SendFile(int fd, uint64_t offset, size_t size, bool have_more = false);
+
   const io::network::Endpoint &endpoint();
 
  private:
@@ -125,6 +138,9 @@ class Client final {
   ClientContext *context_;
   SSL *ssl_{nullptr};
   BIO *bio_{nullptr};
+  // The session of the last SSL connection, resumed by the next one to skip
+  // the full handshake.
+  SSL_SESSION *ssl_session_{nullptr};
 };
 
 /**
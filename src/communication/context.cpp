@@ -18,6 +18,18 @@
 
 namespace memgraph::communication {
 
+namespace {
+
+// Identifies the sessions of the server in its cache. The sessions can't be
+// resumed without it when the client certificates are verified.
+constexpr unsigned char kSessionIdContext[] = "memgraph";
+
+// Seconds for which the clients may resume a session with its ID or ticket
+// instead of performing a full handshake.
+constexpr long kSessionTimeoutSec = 3600;
+
+}  // namespace
+
 ClientContext::ClientContext(bool use_ssl) : use_ssl_(use_ssl), ctx_(nullptr) {
   if (use_ssl_) {
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -30,6 +42,12 @@ ClientContext::ClientContext(bool use_ssl) : use_ssl_(use_ssl), ctx_(nullptr) {
     // Disable legacy SSL support. Other options can be seen here:
     // https://www.openssl.org/docs/man1.0.2/ssl/SSL_CTX_set_options.html
     SSL_CTX_set_options(ctx_, SSL_OP_NO_SSLv3);
+#ifdef SSL_OP_ENABLE_KTLS
+    // Kernel TLS lets files be sent with `sendfile` over encrypted
+    // connections. OpenSSL falls back to user space encryption if the kernel
+    // doesn't support it.
+    SSL_CTX_set_options(ctx_, SSL_OP_ENABLE_KTLS);
+#endif
   }
 }
 
@@ -108,6 +126,22 @@ ServerContext::ServerContext(const std::string &key_file, const std::string &cer
       MG_ASSERT(!ec, "Setting SSL verification mode failed!");
     }
   }
+
+  // The clients which reconnect resume their sessions, either from the cache
+  // of the server or from the session tickets, which are encrypted with keys
+  // generated for this context.
+  auto *native = ctx_->native_handle();
+  SSL_CTX_set_session_cache_mode(native, SSL_SESS_CACHE_SERVER);
+  MG_ASSERT(SSL_CTX_set_session_id_context(native, kSessionIdContext, sizeof(kSessionIdContext) - 1) == 1,
+            "Setting SSL session ID context failed!");
+  SSL_CTX_set_timeout(native, kSessionTimeoutSec);
+  SSL_CTX_clear_options(native, SSL_OP_NO_TICKET);
+#ifdef SSL_OP_ENABLE_KTLS
+  // The sessions which use the socket directly, like the replication ones,
+  // encrypt in the kernel after the handshake if it supports it. The Bolt
+  // sessions encrypt through memory buffers, so they aren't affected.
+  SSL_CTX_set_options(native, SSL_OP_ENABLE_KTLS);
+#endif
 }
 
 ServerContext::ServerContext(ServerContext &&other) noexcept { std::swap(ctx_, other.ctx_); }
@@ -0,0 +1,227 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "memory/memory_control.hpp"
+#include "utils/logging.hpp"
+#include "utils/thread.hpp"
+
+namespace memgraph::communication::v2 {
+
+/**
+ * Threads which execute the work of the sessions, so the threads of the
+ * io_context only read from and accept the connections.
+ *
+ * The work is queued as short or long. Short work is taken first, and long
+ * work runs on all threads except one, which is left for the short work, so
+ * short queries don't wait for long running reports to finish.
+ *
+ * The work is submitted for a client, e.g. a user, and the clients with
+ * queued work take turns, so a client flooding the server with work delays
+ * its own work instead of everyone's. The work running and queued for a
+ * single client can be limited.
+ *
+ * With `numa_aware`, the threads are spread across the NUMA nodes, pinned to
+ * the processing units of their node and allocate from its memory arena, so
+ * the objects created by the work stay local to the threads of the node.
+ */
+class ExecutionPool final {
+ public:
+  enum class Priority : uint8_t { SHORT, LONG };
+
+  struct Limits {
+    // Work of a client running at once, 0 for no limit.
+    size_t max_running_per_client{0};
+    // Work of a client waiting to run, above which the work is rejected, 0
+    // for no limit.
+    size_t max_queued_per_client{0};
+  };
+
+  explicit ExecutionPool(size_t pool_size) : ExecutionPool(pool_size, Limits{}) {}
+
+  ExecutionPool(size_t pool_size, Limits limits, bool numa_aware = false)
+      : pool_size_{pool_size}, limits_{limits}, numa_aware_{numa_aware} {
+    MG_ASSERT(pool_size != 0, "Pool size must be greater then 0!");
+  }
+
+  ExecutionPool(const ExecutionPool &) = delete;
+  ExecutionPool &operator=(const ExecutionPool &) = delete;
+  ExecutionPool(ExecutionPool &&) = delete;
+  ExecutionPool &operator=(ExecutionPool &&) = delete;
+  ~ExecutionPool() = default;
+
+  void Run() {
+    threads_.reserve(pool_size_);
+    const size_t numa_nodes = numa_aware_ ? utils::NumaNodesCount() : 1;
+    for (size_t i = 0; i < pool_size_; ++i) {
+      threads_.emplace_back([this, node = i % numa_nodes]() {
+        if (numa_aware_ && utils::ThreadPinToNumaNode(node)) memory::UseNumaNodeArena(node);
+        ThreadLoop();
+      });
+    }
+  }
+
+  /// Stops the threads after the work they are executing. The queued work is
+  /// dropped.
+  void Shutdown() {
+    {
+      std::lock_guard guard(lock_);
+      stopped_ = true;
+      short_work_.clear();
+      long_work_.clear();
+      clients_.clear();
+    }
+    cv_.notify_all();
+  }
+
+  void AwaitShutdown() { threads_.clear(); }
+
+  void Submit(Priority priority, std::function<void()> work) { Submit(priority, {}, std::move(work)); }
+
+  /// Queues the work of the `client`.
+  /// @return false if the work was rejected because the client has too much
+  /// queued work.
+  bool Submit(Priority priority, const std::string &client, std::function<void()> work) {
+    {
+      std::lock_guard guard(lock_);
+      if (stopped_) return true;
+      auto &state = clients_[client];
+      if (limits_.max_queued_per_client != 0 && state.queued >= limits_.max_queued_per_client) return false;
+      ++state.queued;
+      (priority == Priority::SHORT ? short_work_ : long_work_).Push(client, std::move(work));
+    }
+    cv_.notify_one();
+    return true;
+  }
+
+ private:
+  // Work queued by clients which take turns. The clients are kept in the
+  // order in which they are served.
+  class FairQueue {
+   public:
+    void Push(const std::string &client, std::function<void()> work) {
+      auto &queue = work_[client];
+      if (queue.empty()) clients_.push_back(client);
+      queue.push_back(std::move(work));
+    }
+
+    /// Returns the client whose work should run next, skipping the clients
+    /// for which `can_run` returns false.
+    template <typename TFunc>
+    std::optional<std::string> Next(const TFunc &can_run) const {
+      for (const auto &client : clients_) {
+        if (can_run(client)) return client;
+      }
+      return std::nullopt;
+    }
+
+    std::function<void()> Pop(const std::string &client) {
+      auto it = work_.find(client);
+      auto work = std::move(it->second.front());
+      it->second.pop_front();
+      std::erase(clients_, client);
+      // The client waits for its next turn behind the other clients.
+      if (it->second.empty()) {
+        work_.erase(it);
+      } else {
+        clients_.push_back(client);
+      }
+      return work;
+    }
+
+    bool empty() const { return clients_.empty(); }
+
+    void clear() {
+      work_.clear();
+      clients_.clear();
+    }
+
+   private:
+    std::unordered_map<std::string, std::deque<std::function<void()>>> work_;
+    std::deque<std::string> clients_;
+  };
+
+  struct ClientState {
+    size_t running{0};
+    size_t queued{0};
+  };
+
+  size_t MaxLongWork() const { return pool_size_ > 1 ? pool_size_ - 1 : 1; }
+
+  bool CanRun(const std::string &client) const {
+    return limits_.max_running_per_client == 0 || clients_.at(client).running < limits_.max_running_per_client;
+  }
+
+  // Returns the queue and the client of the work which should run next.
+  std::optional<std::pair<FairQueue *, std::string>> NextWork() {
+    const auto can_run = [this](const auto &client) { return CanRun(client); };
+    if (auto client = short_work_.Next(can_run)) return std::make_pair(&short_work_, std::move(*client));
+    if (running_long_work_ >= MaxLongWork()) return std::nullopt;
+    if (auto client = long_work_.Next(can_run)) return std::make_pair(&long_work_, std::move(*client));
+    return std::nullopt;
+  }
+
+  void ThreadLoop() {
+    std::unique_lock guard(lock_);
+    while (true) {
+      std::optional<std::pair<FairQueue *, std::string>> next;
+      cv_.wait(guard, [&] { return stopped_ || (next = NextWork()); });
+      if (stopped_) return;
+      auto &[queue, client] = *next;
+      const bool is_long = queue == &long_work_;
+      auto work = queue->Pop(client);
+      auto &state = clients_[client];
+      --state.queued;
+      ++state.running;
+      if (is_long) ++running_long_work_;
+
+      guard.unlock();
+      work();
+      // The work may hold the last reference to its session.
+      work = nullptr;
+      guard.lock();
+
+      if (is_long) --running_long_work_;
+      // The work which waited for the finished one is taken by this thread.
+      if (auto it = clients_.find(client); it != clients_.end()) {
+        if (--it->second.running == 0 && it->second.queued == 0) clients_.erase(it);
+      }
+    }
+  }
+
+  size_t pool_size_;
+  Limits limits_;
+  bool numa_aware_;
+  std::mutex lock_;
+  std::condition_variable cv_;
+  FairQueue short_work_;
+  FairQueue long_work_;
+  std::unordered_map<std::string, ClientState> clients_;
+  size_t running_long_work_{0};
+  bool stopped_{false};
+  std::vector<std::jthread> threads_;
+};
+
+}  // namespace memgraph::communication::v2
@@ -28,6 +28,7 @@
 #include <boost/system/detail/error_code.hpp>
 
 #include "communication/context.hpp"
+#include "communication/v2/execution_pool.hpp"
 #include "communication/v2/pool.hpp"
 #include "communication/v2/session.hpp"
 #include "utils/message.hpp"
@@ -54,67 +55,94 @@ class Listener final : public std::enable_shared_from_this<Listener<TSession, TS
     return std::shared_ptr<Listener>{new Listener(std::forward<Args>(args)...)};
   }
 
-  void Start() { DoAccept(); }
+  void Start() {
+    for (auto &acceptor : acceptors_) {
+      DoAccept(acceptor);
+    }
+  }
 
   bool IsRunning() const noexcept { return alive_.load(std::memory_order_relaxed); }
 
  private:
-  Listener(boost::asio::io_context &io_context, TSessionContext *session_context, ServerContext *server_context,
-           tcp::endpoint &endpoint, const std::string_view service_name, const uint64_t inactivity_timeout_sec)
-      : io_context_(io_context),
-        session_context_(session_context),
+  /// With multiple io_contexts, each has its own acceptor bound to the
+  /// endpoint with SO_REUSEPORT, and the kernel distributes the connections
+  /// among them. A connection stays on the io_context which accepted it.
+  Listener(const std::vector<boost::asio::io_context *> &io_contexts, TSessionContext *session_context,
+           ServerContext *server_context, tcp::endpoint &endpoint, const std::string_view service_name,
+           const uint64_t inactivity_timeout_sec, ExecutionPool *execution_pool,
+           const std::chrono::milliseconds long_execution)
+      : session_context_(session_context),
         server_context_(server_context),
-        acceptor_(io_context_),
         endpoint_{endpoint},
         service_name_{service_name},
-        inactivity_timeout_{inactivity_timeout_sec} {
+        inactivity_timeout_{inactivity_timeout_sec},
+        execution_pool_{execution_pool},
+        long_execution_{long_execution} {
+    MG_ASSERT(!io_contexts.empty(), "The listener needs an io_context!");
+    acceptors_.reserve(io_contexts.size());
+    for (auto *io_context : io_contexts) {
+      acceptors_.emplace_back(*io_context);
+      if (!OpenAcceptor(acceptors_.back(), endpoint, io_contexts.size() > 1)) return;
+    }
+  }
+
+  bool OpenAcceptor(tcp::acceptor &acceptor, const tcp::endpoint &endpoint, bool reuse_port) {
     boost::system::error_code ec;
     // Open the acceptor
-    acceptor_.open(endpoint.protocol(), ec);
+    acceptor.open(endpoint.protocol(), ec);
     if (ec) {
       OnError(ec, "open");
-      return;
+      return false;
     }
 
     // Allow address reuse
-    acceptor_.set_option(boost::asio::socket_base::reuse_address(true), ec);
+    acceptor.set_option(boost::asio::socket_base::reuse_address(true), ec);
     if (ec) {
       OnError(ec, "set_option");
-      return;
+      return false;
+    }
+
+    if (reuse_port) {
+      acceptor.set_option(boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true), ec);
+      if (ec) {
+        OnError(ec, "set_option");
+        return false;
+      }
     }
 
     // Bind to the server address
-    acceptor_.bind(endpoint, ec);
+    acceptor.bind(endpoint, ec);
     if (ec) {
       spdlog::error(
           utils::MessageWithLink("Cannot bind to socket on endpoint {}.", endpoint, "https://memgr.ph/socket"));
       OnError(ec, "bind");
-      return;
+      return false;
     }
 
-    acceptor_.listen(boost::asio::socket_base::max_listen_connections, ec);
+    acceptor.listen(boost::asio::socket_base::max_listen_connections, ec);
     if (ec) {
       OnError(ec, "listen");
-      return;
+      return false;
     }
+    return true;
   }
 
-  void DoAccept() {
-    acceptor_.async_accept(io_context_,
-                           [shared_this = shared_from_this()](auto ec, boost::asio::ip::tcp::socket &&socket) {
-                             shared_this->OnAccept(ec, std::move(socket));
-                           });
+  void DoAccept(tcp::acceptor &acceptor) {
+    acceptor.async_accept(
+        [shared_this = shared_from_this(), &acceptor](auto ec, boost::asio::ip::tcp::socket &&socket) {
+          shared_this->OnAccept(acceptor, ec, std::move(socket));
+        });
   }
 
-  void OnAccept(boost::system::error_code ec, tcp::socket socket) {
+  void OnAccept(tcp::acceptor &acceptor, boost::system::error_code ec, tcp::socket socket) {
     if (ec) {
       return OnError(ec, "accept");
     }
 
     auto session = SessionHandler::Create(std::move(socket), session_context_, *server_context_, endpoint_,
-                                          inactivity_timeout_, service_name_);
+                                          inactivity_timeout_, service_name_, execution_pool_, long_execution_);
     session->Start();
-    DoAccept();
+    DoAccept(acceptor);
   }
 
   void OnError(const boost::system::error_code &ec, const std::string_view what) {
@@ -122,14 +150,15 @@ class Listener final : public std::enable_shared_from_this<Listener<TSession, TS
     alive_.store(false, std::memory_order_relaxed);
   }
 
-  boost::asio::io_context &io_context_;
   TSessionContext *session_context_;
   ServerContext *server_context_;
-  tcp::acceptor acceptor_;
+  std::vector<tcp::acceptor> acceptors_;
 
   tcp::endpoint endpoint_;
   std::string_view service_name_;
   std::chrono::seconds inactivity_timeout_;
+  ExecutionPool *execution_pool_;
+  std::chrono::milliseconds long_execution_;
 
   std::atomic<bool> alive_;
 };
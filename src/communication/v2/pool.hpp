@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -19,17 +21,34 @@
 #include <boost/asio/io_context.hpp>
 
 #include "utils/logging.hpp"
+#include "utils/thread.hpp"
 
 namespace memgraph::communication::v2 {
 
+/**
+ * Threads which run the io_context of the server. By default, all threads run
+ * a single shared io_context. With `io_context_per_thread`, each thread runs
+ * its own io_context and is pinned to a processing unit, so the handlers of a
+ * connection always run on the same core and the threads don't contend for
+ * the scheduler of a shared io_context.
+ */
 class IOContextThreadPool final {
  private:
   using IOContext = boost::asio::io_context;
   using IOContextGuard = boost::asio::executor_work_guard<boost::asio::io_context::executor_type>;
 
  public:
-  explicit IOContextThreadPool(size_t pool_size) : guard_{io_context_.get_executor()}, pool_size_{pool_size} {
+  explicit IOContextThreadPool(size_t pool_size, bool io_context_per_thread = false) : pool_size_{pool_size} {
     MG_ASSERT(pool_size != 0, "Pool size must be greater then 0!");
+    const size_t io_contexts_count = io_context_per_thread ? pool_size : 1;
+    io_contexts_.reserve(io_contexts_count);
+    guards_.reserve(io_contexts_count);
+    for (size_t i = 0; i < io_contexts_count; ++i) {
+      // A single thread runs the io_context, so it doesn't need locking.
+      io_contexts_.push_back(
+          std::make_unique<IOContext>(io_context_per_thread ? 1 : BOOST_ASIO_CONCURRENCY_HINT_DEFAULT));
+      guards_.emplace_back(io_contexts_.back()->get_executor());
+    }
   }
 
   IOContextThreadPool(const IOContextThreadPool &) = delete;
@@ -40,14 +59,22 @@ class IOContextThreadPool final {
 
   void Run() {
     background_threads_.reserve(pool_size_);
+    const bool pin_threads = io_contexts_.size() > 1;
+    const size_t cores = std::max(std::thread::hardware_concurrency(), 1U);
     for (size_t i = 0; i < pool_size_; ++i) {
-      background_threads_.emplace_back([this]() { io_context_.run(); });
+      auto &io_context = *io_contexts_[i % io_contexts_.size()];
+      background_threads_.emplace_back([&io_context, pin_threads, core = i % cores]() {
+        if (pin_threads) utils::ThreadPinToCore(core);
+        io_context.run();
+      });
     }
     running_ = true;
   }
 
   void Shutdown() {
-    io_context_.stop();
+    for (auto &io_context : io_contexts_) {
+      io_context->stop();
+    }
     running_ = false;
   }
 
@@ -55,12 +82,19 @@ class IOContextThreadPool final {
 
   bool IsRunning() const noexcept { return running_; }
 
-  IOContext &GetIOContext() noexcept { return io_context_; }
+  /// Returns the io_contexts, a single one unless each thread runs its own.
+  std::vector<IOContext *> GetIOContexts() const {
+    std::vector<IOContext *> io_contexts;
+    io_contexts.reserve(io_contexts_.size());
+    for (const auto &io_context : io_contexts_) {
+      io_contexts.push_back(io_context.get());
+    }
+    return io_contexts;
+  }
 
  private:
-  /// The pool of io_context.
-  IOContext io_context_;
-  IOContextGuard guard_;
+  std::vector<std::unique_ptr<IOContext>> io_contexts_;
+  std::vector<IOContextGuard> guards_;
   size_t pool_size_;
   std::vector<std::jthread> background_threads_;
   bool running_{false};
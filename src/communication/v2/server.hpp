@@ -12,6 +12,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -27,6 +28,7 @@
 
 #include "communication/context.hpp"
 #include "communication/init.hpp"
+#include "communication/v2/execution_pool.hpp"
 #include "communication/v2/listener.hpp"
 #include "communication/v2/pool.hpp"
 #include "utils/logging.hpp"
@@ -42,16 +44,14 @@ using ServerEndpoint = boost::asio::ip::tcp::endpoint;
  *
  * Listens for incoming connections on the server port and assigns them to the
  * connection listener. The listener and session are implemented using asio
- * async model. Currently the implemented model is thread per core model
- * opposed to io_context per core. The reasoning for opting for the former model
- * is the robustness to the multiple resource demanding queries that can be split
- * across multiple threads, and then a single thread would not block io_context,
- * unlike in the latter model where it is possible that thread that accepts
- * request is being blocked by demanding query.
- * All logic is contained within handlers that are being dispatched
- * on a single strand per session. The only exception is write which is
- * synchronous since the nature of the clients conenction is synchronous as
- * well.
+ * async model. A small pool of threads runs the io_context, which accepts the
+ * connections and reads from them, while the received messages are executed
+ * by a separate execution pool. Demanding queries therefore never block the
+ * threads which accept the connections and read from them.
+ * The I/O handlers are dispatched on a single strand per session, and a
+ * session doesn't read while its messages are executed. The only exception is
+ * write which is synchronous, since the nature of the clients connection is
+ * synchronous as well, and which is done by the execution pool.
  *
  * Current Server architecture:
  * incoming connection -> server -> listener -> session
@@ -70,11 +70,19 @@ class Server final {
  public:
   /**
    * Constructs and binds server to endpoint, operates on session data and
-   * invokes workers_count workers
+   * invokes workers_count workers which execute the sessions' messages and
+   * io_workers_count workers which handle the connections. Sessions whose
+   * previous execution took longer than long_execution are executed with a
+   * lower priority. With io_context_per_worker, each I/O worker runs its own
+   * io_context with its own acceptor, pinned to a processing unit. The limits
+   * apply to the work of each client of the sessions. With numa_aware_workers,
+   * the workers are spread across the NUMA nodes.
    */
   Server(ServerEndpoint &endpoint, TSessionContext *session_context, ServerContext *server_context,
          int inactivity_timeout_sec, std::string_view service_name,
-         size_t workers_count = std::thread::hardware_concurrency());
+         size_t workers_count = std::thread::hardware_concurrency(), size_t io_workers_count = 1,
+         std::chrono::milliseconds long_execution = std::chrono::seconds(1), bool io_context_per_worker = false,
+         ExecutionPool::Limits limits = {}, bool numa_aware_workers = false);
 
   ~Server();
 
@@ -89,10 +97,14 @@ class Server final {
 
   void Shutdown() {
     context_thread_pool_.Shutdown();
+    execution_pool_.Shutdown();
     spdlog::info("{} shutting down...", service_name_);
   }
 
-  void AwaitShutdown() { context_thread_pool_.AwaitShutdown(); }
+  void AwaitShutdown() {
+    context_thread_pool_.AwaitShutdown();
+    execution_pool_.AwaitShutdown();
+  }
 
   bool IsRunning() const noexcept;
 
@@ -101,6 +113,7 @@ class Server final {
   std::string service_name_;
 
   IOContextThreadPool context_thread_pool_;
+  ExecutionPool execution_pool_;
   std::shared_ptr<Listener<TSession, TSessionContext>> listener_;
 };
 
@@ -112,13 +125,18 @@ Server<TSession, TSessionContext>::~Server() {
 template <typename TSession, typename TSessionContext>
 Server<TSession, TSessionContext>::Server(ServerEndpoint &endpoint, TSessionContext *session_context,
                                           ServerContext *server_context, const int inactivity_timeout_sec,
-                                          const std::string_view service_name, size_t workers_count)
+                                          const std::string_view service_name, size_t workers_count,
+                                          size_t io_workers_count, std::chrono::milliseconds long_execution,
+                                          bool io_context_per_worker, ExecutionPool::Limits limits,
+                                          bool numa_aware_workers)
     : endpoint_{endpoint},
       service_name_{service_name},
-      context_thread_pool_{workers_count},
-      listener_{Listener<TSession, TSessionContext>::Create(context_thread_pool_.GetIOContext(), session_context,
+      context_thread_pool_{io_workers_count, io_context_per_worker},
+      execution_pool_{workers_count, limits, numa_aware_workers},
+      listener_{Listener<TSession, TSessionContext>::Create(context_thread_pool_.GetIOContexts(), session_context,
                                                             server_context, endpoint_, service_name_,
-                                                            inactivity_timeout_sec)} {}
+                                                            inactivity_timeout_sec, &execution_pool_,
+                                                            long_execution)} {}
 
 template <typename TSession, typename TSessionContext>
 bool Server<TSession, TSessionContext>::Start() {
@@ -130,6 +148,7 @@ bool Server<TSession, TSessionContext>::Start() {
 
   spdlog::info("{} server is fully armed and operational", service_name_);
   spdlog::info("{} listening on {}", service_name_, endpoint_.address());
+  execution_pool_.Run();
   context_thread_pool_.Run();
 
   return true;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -19,6 +20,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -47,6 +49,7 @@
 #include "communication/buffer.hpp"
 #include "communication/context.hpp"
 #include "communication/exceptions.hpp"
+#include "communication/v2/execution_pool.hpp"
 #include "dbms/global.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
@@ -75,8 +78,11 @@ using tcp = boost::asio::ip::tcp;
  */
 class OutputStream final {
  public:
-  explicit OutputStream(std::function<bool(const uint8_t *, size_t, bool)> write_function)
-      : write_function_(write_function) {}
+  using GatheredWriteFunction = std::function<bool(std::span<const std::span<const uint8_t>>, bool)>;
+
+  explicit OutputStream(std::function<bool(const uint8_t *, size_t, bool)> write_function,
+                        GatheredWriteFunction gathered_write_function = {})
+      : write_function_(std::move(write_function)), gathered_write_function_(std::move(gathered_write_function)) {}
 
   OutputStream(const OutputStream &) = delete;
   OutputStream(OutputStream &&) = delete;
@@ -90,8 +96,17 @@ class OutputStream final {
     return Write(reinterpret_cast<const uint8_t *>(str.data()), str.size(), have_more);
   }
 
+  bool CanWriteGathered() const { return static_cast<bool>(gathered_write_function_); }
+
+  /// Writes the buffers in order with as few system calls as possible. May
+  /// only be used if `CanWriteGathered` returns true.
+  bool WriteGathered(std::span<const std::span<const uint8_t>> buffers, bool have_more = false) {
+    return gathered_write_function_(buffers, have_more);
+  }
+
  private:
   std::function<bool(const uint8_t *, size_t, bool)> write_function_;
+  GatheredWriteFunction gathered_write_function_;
 };
 
 /**
@@ -273,6 +288,10 @@ class WebsocketSession : public std::enable_shared_from_this<WebsocketSession<TS
  * This class is used internally in the communication stack to handle all user
  * Sessions. It handles socket ownership, inactivity timeout and protocol
  * wrapping.
+ *
+ * The received messages are executed by the execution pool, and the session
+ * reads again once they are executed. The work of a session is queued as
+ * long if its previous execution took longer than `long_execution`.
  */
 template <typename TSession, typename TSessionContext>
 class Session final : public std::enable_shared_from_this<Session<TSession, TSessionContext>> {
@@ -354,6 +373,39 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
         socket_);
   }
 
+  bool WriteGathered(std::span<const std::span<const uint8_t>> buffers, bool have_more = false) {
+    if (!IsConnected()) {
+      return false;
+    }
+    std::vector<boost::asio::const_buffer> remaining;
+    remaining.reserve(buffers.size());
+    for (const auto &buffer : buffers) {
+      remaining.emplace_back(buffer.data(), buffer.size());
+    }
+    boost::system::error_code ec;
+    ExecuteForSocket(utils::Overloaded{
+        [&](TCPSocket &socket) {
+          // A send may write only a part of the buffers, and the rest are sent
+          // by the next one.
+          auto first = remaining.begin();
+          while (first != remaining.end()) {
+            auto sent = socket.send(std::span(first, remaining.end()), MSG_NOSIGNAL | (have_more ? MSG_MORE : 0), ec);
+            if (ec) return;
+            while (first != remaining.end() && sent >= first->size()) {
+              sent -= first->size();
+              ++first;
+            }
+            if (first != remaining.end()) *first += sent;
+          }
+        },
+        [&](SSLSocket &socket) { boost::asio::write(socket, remaining, ec); }});
+    if (ec) {
+      OnError(ec);
+      return false;
+    }
+    return true;
+  }
+
   bool IsConnected() const {
     return std::visit([this](const auto &socket) { return execution_active_ && socket.lowest_layer().is_open(); },
                       socket_);
@@ -362,17 +414,23 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
  private:
   explicit Session(tcp::socket &&socket, TSessionContext *session_context, ServerContext &server_context,
                    tcp::endpoint endpoint, const std::chrono::seconds inactivity_timeout_sec,
-                   std::string_view service_name)
+                   std::string_view service_name, ExecutionPool *execution_pool,
+                   std::chrono::milliseconds long_execution)
       : socket_(CreateSocket(std::move(socket), server_context)),
         strand_{boost::asio::make_strand(GetExecutor())},
-        output_stream_([this](const uint8_t *data, size_t len, bool have_more) { return Write(data, len, have_more); }),
+        output_stream_([this](const uint8_t *data, size_t len, bool have_more) { return Write(data, len, have_more); },
+                       [this](std::span<const std::span<const uint8_t>> buffers, bool have_more) {
+                         return WriteGathered(buffers, have_more);
+                       }),
         session_{*session_context, endpoint, input_buffer_.read_end(), &output_stream_},
         session_context_{session_context},
         endpoint_{endpoint},
         remote_endpoint_{GetRemoteEndpoint()},
         service_name_{service_name},
         timeout_seconds_(inactivity_timeout_sec),
-        timeout_timer_(GetExecutor()) {
+        timeout_timer_(GetExecutor()),
+        execution_pool_(execution_pool),
+        long_execution_(long_execution) {
 #ifdef MG_ENTERPRISE
     // TODO Try to remove Register (see comment at SessionInterface declaration)
     session_context_->Register(session_);
@@ -392,6 +450,16 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
       return;
     }
     timeout_timer_.expires_after(timeout_seconds_);
+    if (input_buffer_.read_end()->size() == 0 && std::holds_alternative<TCPSocket>(socket_)) {
+      // The session doesn't hold the input buffer while it waits for the
+      // client, so idle connections don't hold any. The encrypted sessions
+      // can't wait without reading because the stream may hold decrypted data.
+      input_buffer_.Release();
+      std::get<TCPSocket>(socket_).async_wait(
+          tcp::socket::wait_read,
+          boost::asio::bind_executor(strand_, std::bind_front(&Session::OnReadable, shared_from_this())));
+      return;
+    }
     ExecuteForSocket([this](auto &&socket) {
       auto buffer = input_buffer_.write_end()->Allocate();
       socket.async_read_some(
@@ -411,6 +479,19 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
     return boost::beast::websocket::is_upgrade(parser.get());
   }
 
+  void OnReadable(const boost::system::error_code &ec) {
+    if (ec) {
+      session_.HandleError();
+      return OnError(ec);
+    }
+    // The data is available, so the read doesn't block.
+    boost::system::error_code read_ec;
+    auto buffer = input_buffer_.write_end()->Allocate();
+    const auto bytes_transferred =
+        std::get<TCPSocket>(socket_).read_some(boost::asio::buffer(buffer.data, buffer.len), read_ec);
+    OnRead(read_ec, bytes_transferred);
+  }
+
   void OnRead(const boost::system::error_code &ec, const size_t bytes_transferred) {
     if (ec) {
       // TODO Check if client disconnected
@@ -440,21 +521,68 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
       }
     }
 
+    // Executing the messages doesn't count as inactivity.
+    timeout_timer_.expires_at(boost::asio::steady_timer::time_point::max());
+    std::string client;
+    if constexpr (requires { session_.FairShareKey(); }) {
+      client = session_.FairShareKey();
+    }
+    if (!execution_pool_->Submit(priority_, client,
+                                 [shared_this = shared_from_this()] { shared_this->DoExecute(); })) {
+      // The client has too much queued work, so its messages are failed right
+      // away instead of waiting behind it.
+      DoExecute(true);
+    }
+  }
+
+  // Runs on a thread of the execution pool, while the session doesn't read.
+  // A busy session fails its queries and runs on the strand instead.
+  void DoExecute(bool busy = false) {
+    const auto start = std::chrono::steady_clock::now();
+    bool closed = false;
     try {
-      session_.Execute();
-      DoRead();
+      if constexpr (requires { session_.ExecuteBusy(); }) {
+        if (busy) {
+          session_.ExecuteBusy();
+        } else {
+          session_.Execute();
+        }
+      } else {
+        session_.Execute();
+      }
     } catch (const SessionClosedException &e) {
       spdlog::info("{} client {}:{} closed the connection.", service_name_, remote_endpoint_.address(),
                    remote_endpoint_.port());
-      DoShutdown();
+      closed = true;
     } catch (const std::exception &e) {
       spdlog::error(
           "Exception was thrown while processing event in {} session "
           "associated with {}:{}",
           service_name_, remote_endpoint_.address(), remote_endpoint_.port());
       spdlog::debug("Exception message: {}", e.what());
-      DoShutdown();
+      closed = true;
+    }
+    if (!busy) {
+      priority_ = std::chrono::steady_clock::now() - start > long_execution_ ? ExecutionPool::Priority::LONG
+                                                                             : ExecutionPool::Priority::SHORT;
     }
+    if constexpr (requires { session_.PrefetchResults(std::function<bool()>{}); }) {
+      // The sent results are received by the client while the next ones are
+      // computed, until the client's next message arrives.
+      if (!closed && !busy) {
+        session_.PrefetchResults([this] {
+          boost::system::error_code ec;
+          return ExecuteForSocket([&](auto &socket) { return socket.lowest_layer().available(ec) > 0 || ec; });
+        });
+      }
+    }
+    boost::asio::dispatch(strand_, [shared_this = shared_from_this(), closed] {
+      if (closed) {
+        shared_this->DoShutdown();
+      } else {
+        shared_this->DoRead();
+      }
+    });
   }
 
   void OnError(const boost::system::error_code &ec) {
@@ -575,7 +703,11 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
   std::string_view service_name_;
   std::chrono::seconds timeout_seconds_;
   boost::asio::steady_timer timeout_timer_;
-  bool execution_active_{false};
+  ExecutionPool *execution_pool_;
+  std::chrono::milliseconds long_execution_;
+  ExecutionPool::Priority priority_{ExecutionPool::Priority::SHORT};
+  // Written by the execution pool when a write fails.
+  std::atomic<bool> execution_active_{false};
   bool has_received_msg_{false};
 };
 }  // namespace memgraph::communication::v2
@@ -16,7 +16,7 @@
 namespace memgraph::communication::websocket {
 
 bool SafeAuth::Authenticate(const std::string &username, const std::string &password) const {
-  return auth_->Lock()->Authenticate(username, password).has_value();
+  return auth::Authenticate(auth_, username, password).has_value();
 }
 
 bool SafeAuth::HasUserPermission(const std::string &username, const auth::Permission permission) const {
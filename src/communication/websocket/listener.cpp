@@ -11,6 +11,16 @@
 
 #include "communication/websocket/listener.hpp"
 
+#include <vector>
+
+#include <boost/asio/post.hpp>
+
+#include "utils/event_counter.hpp"
+
+namespace memgraph::metrics {
+extern const Event WebSocketMessagesDropped;
+}  // namespace memgraph::metrics
+
 namespace memgraph::communication::websocket {
 namespace {
 void LogError(boost::beast::error_code ec, const std::string_view what) {
@@ -21,9 +31,39 @@ void LogError(boost::beast::error_code ec, const std::string_view what) {
 void Listener::Run() { DoAccept(); }
 
 void Listener::WriteToAll(std::shared_ptr<std::string> message) {
+  if (!pending_.try_emplace(std::move(message))) {
+    metrics::IncrementCounter(metrics::WebSocketMessagesDropped);
+    return;
+  }
+  const auto pending = pending_count_.fetch_add(1, std::memory_order_acq_rel) + 1;
+  if (!flush_scheduled_.exchange(true, std::memory_order_acq_rel)) {
+    boost::asio::post(ioc_, [shared_this = shared_from_this()] { shared_this->ScheduleFlush(); });
+  } else if (pending == kMaxBatchSize) {
+    // The batch is full, so it's sent without waiting for the rest of the
+    // interval.
+    boost::asio::post(ioc_, [shared_this = shared_from_this()] { shared_this->flush_timer_.cancel(); });
+  }
+}
+
+void Listener::ScheduleFlush() {
+  flush_timer_.expires_after(kBatchInterval);
+  flush_timer_.async_wait(
+      [shared_this = shared_from_this()](boost::beast::error_code /*ec*/) { shared_this->Flush(); });
+}
+
+void Listener::Flush() {
+  // The messages written from now on schedule the next batch.
+  flush_scheduled_.store(false, std::memory_order_release);
+  auto batch = std::make_shared<std::vector<std::shared_ptr<std::string>>>();
+  while (auto message = pending_.pop()) {
+    batch->push_back(std::move(*message));
+  }
+  pending_count_.fetch_sub(batch->size(), std::memory_order_acq_rel);
+  if (batch->empty()) return;
+
   auto sessions_ptr = sessions_.Lock();
   for (auto &session : *sessions_ptr) {
-    session->Write(message);
+    session->Write(batch);
   }
 }
 
@@ -31,7 +71,7 @@ boost::asio::ip::tcp::endpoint Listener::GetEndpoint() const { return acceptor_.
 
 Listener::Listener(boost::asio::io_context &ioc, ServerContext *context, tcp::endpoint endpoint,
                    AuthenticationInterface &auth)
-    : ioc_(ioc), context_(context), acceptor_(ioc), auth_(auth) {
+    : ioc_(ioc), context_(context), acceptor_(ioc), auth_(auth), flush_timer_(ioc) {
   boost::beast::error_code ec;
 
   // Open the acceptor
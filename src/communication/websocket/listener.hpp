@@ -11,17 +11,23 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <list>
 #include <memory>
+#include <string>
 
 #include <spdlog/spdlog.h>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core.hpp>
 
 #include "communication/context.hpp"
 #include "communication/websocket/session.hpp"
+#include "data_structures/ring_buffer.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
@@ -37,19 +43,36 @@ class Listener : public std::enable_shared_from_this<Listener> {
 
   // Start accepting incoming connections
   void Run();
+
+  // Queues the message for all sessions. It can be called from any thread,
+  // and never blocks: the messages are sent in batches from the thread of
+  // the listener, and dropped if too many of them wait for a batch.
   void WriteToAll(std::shared_ptr<std::string> message);
   tcp::endpoint GetEndpoint() const;
 
  private:
+  // Messages waiting for a batch, above which the messages are dropped.
+  static constexpr size_t kMaxPendingMessages = 4096;
+  // The batch is sent after this time, or once it has this many messages.
+  static constexpr std::chrono::milliseconds kBatchInterval{50};
+  static constexpr size_t kMaxBatchSize = 256;
+
   Listener(boost::asio::io_context &ioc, ServerContext *context, tcp::endpoint endpoint, AuthenticationInterface &auth);
 
   void DoAccept();
   void OnAccept(boost::beast::error_code ec, tcp::socket socket);
 
+  void ScheduleFlush();
+  void Flush();
+
   boost::asio::io_context &ioc_;
   ServerContext *context_;
   tcp::acceptor acceptor_;
   utils::Synchronized<std::list<std::shared_ptr<Session>>, utils::SpinLock> sessions_;
   AuthenticationInterface &auth_;
+  RingBuffer<std::shared_ptr<std::string>> pending_{kMaxPendingMessages};
+  std::atomic<size_t> pending_count_{0};
+  std::atomic<bool> flush_scheduled_{false};
+  boost::asio::steady_timer flush_timer_;
 };
 }  // namespace memgraph::communication::websocket
@@ -24,8 +24,13 @@
 
 #include "communication/context.hpp"
 #include "communication/websocket/auth.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 
+namespace memgraph::metrics {
+extern const Event WebSocketMessagesDropped;
+}  // namespace memgraph::metrics
+
 namespace memgraph::communication::websocket {
 namespace {
 void LogError(const boost::beast::error_code ec, const std::string_view what) {
@@ -88,16 +93,23 @@ bool Session::Run() {
   return true;
 }
 
-void Session::Write(std::shared_ptr<std::string> message) {
-  boost::asio::dispatch(strand_, [message = std::move(message), shared_this = shared_from_this()]() mutable {
+void Session::Write(std::shared_ptr<const std::vector<std::shared_ptr<std::string>>> messages) {
+  boost::asio::dispatch(strand_, [messages = std::move(messages), shared_this = shared_from_this()]() mutable {
     if (!shared_this->connected_.load(std::memory_order_relaxed)) {
       return;
     }
     if (!shared_this->IsAuthenticated()) {
       return;
     }
-    shared_this->messages_.push_back(std::move(message));
-    if (shared_this->messages_.size() > 1) {
+    const bool writing = !shared_this->messages_.empty();
+    for (const auto &message : *messages) {
+      if (shared_this->messages_.size() >= kMaxQueuedMessages) {
+        metrics::IncrementCounter(metrics::WebSocketMessagesDropped);
+        continue;
+      }
+      shared_this->messages_.push_back(message);
+    }
+    if (writing || shared_this->messages_.empty()) {
       return;
     }
     shared_this->DoWrite();
@@ -14,7 +14,9 @@
 #include <deque>
 #include <memory>
 #include <optional>
+#include <string>
 #include <variant>
+#include <vector>
 
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -41,10 +43,14 @@ class Session : public std::enable_shared_from_this<Session> {
   }
 
   bool Run();
-  void Write(std::shared_ptr<std::string> message);
+  // Queues the messages for the client. The messages which don't fit into the
+  // queue of a slow client are dropped.
+  void Write(std::shared_ptr<const std::vector<std::shared_ptr<std::string>>> messages);
   bool IsConnected() const;
 
  private:
+  static constexpr size_t kMaxQueuedMessages = 4096;
+
   using PlainWebSocket = boost::beast::websocket::stream<boost::beast::tcp_stream>;
   using SSLWebSocket = boost::beast::websocket::stream<boost::beast::ssl_stream<boost::beast::tcp_stream>>;
 
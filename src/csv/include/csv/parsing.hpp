@@ -89,6 +89,9 @@ class Reader {
     bool ignore_bad{false};
     std::optional<utils::pmr::string> delimiter{};
     std::optional<utils::pmr::string> quote{};
+    // Number of rows parsed at once by a background thread while the previous
+    // rows are read. The rows are parsed when they are read if it's 0.
+    size_t prefetch_batch_size{0};
   };
 
   using Row = utils::pmr::vector<utils::pmr::string>;
@@ -116,6 +119,8 @@ class Reader {
 
   bool HasHeader() const;
   auto GetHeader() const -> Header const &;
+  /// Returns the next row, allocated with `mem` unless the rows are
+  /// prefetched, in which case they are allocated by `NewDeleteResource`.
   auto GetNextRow(utils::MemoryResource *mem) -> std::optional<Row>;
 
  private:
@@ -11,7 +11,12 @@
 
 #include "csv/parsing.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <string_view>
+#include <thread>
 
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
@@ -22,6 +27,7 @@
 #include "utils/file.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/string.hpp"
+#include "utils/thread.hpp"
 
 using PlainStream = boost::iostreams::filtering_istream;
 
@@ -29,9 +35,20 @@ namespace memgraph::csv {
 
 using ParseError = Reader::ParseError;
 
+namespace {
+// Number of prefetched batches of rows which may wait to be read.
+constexpr size_t kMaxPrefetchedBatches = 4;
+}  // namespace
+
 struct Reader::impl {
   impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *mem);
 
+  impl(const impl &) = delete;
+  impl &operator=(const impl &) = delete;
+  impl(impl &&) = delete;
+  impl &operator=(impl &&) = delete;
+  ~impl();
+
   [[nodiscard]] bool HasHeader() const { return read_config_.with_header; }
   [[nodiscard]] auto Header() const -> Header const & { return header_; }
 
@@ -48,6 +65,19 @@ struct Reader::impl {
 
   ParsingResult ParseRow(utils::MemoryResource *mem);
 
+  auto ReadNextRow(utils::MemoryResource *mem) -> std::optional<Reader::Row>;
+
+  // Parses the batches of rows on the prefetch thread.
+  void Prefetch();
+
+  // Rows parsed by the prefetch thread. The batch which ends the file is the
+  // last one, and it holds the exception thrown by the parser, if any.
+  struct Batch {
+    std::vector<Reader::Row> rows;
+    bool end{false};
+    std::exception_ptr error;
+  };
+
   utils::MemoryResource *memory_;
   std::filesystem::path path_;
   CsvSource source_;
@@ -56,6 +86,16 @@ struct Reader::impl {
   uint64_t line_count_{1};
   uint16_t number_of_columns_{0};
   Reader::Header header_{memory_};
+
+  // The prefetch thread is started on the first read, once the header is read.
+  std::thread prefetch_thread_;
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_cv_;
+  std::deque<Batch> prefetched_batches_;
+  bool stop_prefetch_{false};
+  // The batch from which the rows are read.
+  Batch batch_;
+  size_t batch_row_{0};
 };
 
 Reader::impl::impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *mem)
@@ -64,10 +104,21 @@ Reader::impl::impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *
   read_config_.ignore_bad = cfg.ignore_bad;
   read_config_.delimiter = cfg.delimiter ? std::move(*cfg.delimiter) : utils::pmr::string{",", memory_};
   read_config_.quote = cfg.quote ? std::move(*cfg.quote) : utils::pmr::string{"\"", memory_};
+  read_config_.prefetch_batch_size = cfg.prefetch_batch_size;
   InitializeStream();
   TryInitializeHeader();
 }
 
+Reader::impl::~impl() {
+  if (!prefetch_thread_.joinable()) return;
+  {
+    auto guard = std::lock_guard{prefetch_mutex_};
+    stop_prefetch_ = true;
+  }
+  prefetch_cv_.notify_all();
+  prefetch_thread_.join();
+}
+
 enum class CompressionMethod : uint8_t {
   NONE,
   GZip,
@@ -316,7 +367,7 @@ Reader::ParsingResult Reader::impl::ParseRow(utils::MemoryResource *mem) {
   return std::move(row);
 }
 
-std::optional<Reader::Row> Reader::impl::GetNextRow(utils::MemoryResource *mem) {
+std::optional<Reader::Row> Reader::impl::ReadNextRow(utils::MemoryResource *mem) {
   auto row = ParseRow(mem);
 
   if (row.HasError()) {
@@ -340,6 +391,65 @@ std::optional<Reader::Row> Reader::impl::GetNextRow(utils::MemoryResource *mem)
   return std::move(*row);
 }
 
+void Reader::impl::Prefetch() {
+  utils::ThreadSetName("csv prefetch");
+  bool end = false;
+  while (!end) {
+    Batch batch;
+    batch.rows.reserve(read_config_.prefetch_batch_size);
+    try {
+      while (batch.rows.size() < read_config_.prefetch_batch_size) {
+        auto row = ReadNextRow(utils::NewDeleteResource());
+        if (!row) {
+          batch.end = true;
+          break;
+        }
+        batch.rows.push_back(std::move(*row));
+      }
+    } catch (...) {
+      batch.error = std::current_exception();
+      batch.end = true;
+    }
+    end = batch.end;
+
+    {
+      auto guard = std::unique_lock{prefetch_mutex_};
+      prefetch_cv_.wait(guard,
+                        [this] { return stop_prefetch_ || prefetched_batches_.size() < kMaxPrefetchedBatches; });
+      if (stop_prefetch_) return;
+      prefetched_batches_.push_back(std::move(batch));
+    }
+    prefetch_cv_.notify_all();
+  }
+}
+
+std::optional<Reader::Row> Reader::impl::GetNextRow(utils::MemoryResource *mem) {
+  if (read_config_.prefetch_batch_size == 0) {
+    return ReadNextRow(mem);
+  }
+
+  if (!prefetch_thread_.joinable()) {
+    prefetch_thread_ = std::thread([this] { Prefetch(); });
+  }
+  while (batch_row_ == batch_.rows.size()) {
+    if (batch_.end) {
+      // The rows before the error are returned first, same as without
+      // prefetching.
+      if (batch_.error) std::rethrow_exception(std::exchange(batch_.error, nullptr));
+      return std::nullopt;
+    }
+    {
+      auto guard = std::unique_lock{prefetch_mutex_};
+      prefetch_cv_.wait(guard, [this] { return !prefetched_batches_.empty(); });
+      batch_ = std::move(prefetched_batches_.front());
+      prefetched_batches_.pop_front();
+    }
+    prefetch_cv_.notify_all();
+    batch_row_ = 0;
+  }
+  return std::move(batch_.rows[batch_row_++]);
+}
+
 // Returns Reader::Row if the read row if valid;
 // Returns std::nullopt if end of file is reached or an error occurred
 // making it unreadable;
@@ -13,25 +13,34 @@
 
 #include <atomic>
 #include <chrono>
-#include <mutex>
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <thread>
 #include <utility>
 
 #include "utils/logging.hpp"
-#include "utils/spin_lock.hpp"
 
 /**
  * A thread-safe ring buffer. Multi-producer, multi-consumer. Producers get
- * blocked if the buffer is full. Consumers get returnd a nullopt. First in
- * first out.
+ * blocked if the buffer is full, unless they use `try_emplace`. Consumers get
+ * returnd a nullopt. First in first out.
+ *
+ * The buffer is lock-free: each slot carries a sequence number which tells
+ * whether the slot is ready to be written or read at the current position, so
+ * producers and consumers only contend on an atomic increment of their
+ * position (the bounded MPMC queue of Dmitry Vyukov).
  *
  * @tparam TElement - type of element the buffer tracks.
  */
 template <typename TElement>
 class RingBuffer {
  public:
-  explicit RingBuffer(int capacity) : capacity_(capacity), buffer_{std::make_unique<TElement[]>(capacity_)} {}
+  explicit RingBuffer(int capacity) : capacity_(capacity), buffer_{std::make_unique<Slot[]>(capacity_)} {
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      buffer_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
 
   RingBuffer(const RingBuffer &) = delete;
   RingBuffer(RingBuffer &&) = delete;
@@ -48,15 +57,7 @@ class RingBuffer {
   template <typename... TArgs>
   void emplace(TArgs &&...args) {
     while (true) {
-      {
-        std::lock_guard<memgraph::utils::SpinLock> guard(lock_);
-        if (size_ < capacity_) {
-          buffer_[write_pos_++] = TElement(std::forward<TArgs>(args)...);
-          write_pos_ %= capacity_;
-          size_++;
-          return;
-        }
-      }
+      if (try_emplace(std::forward<TArgs>(args)...)) return;
 
       SPDLOG_WARN("RingBuffer full: worker waiting");
 
@@ -65,32 +66,72 @@ class RingBuffer {
     }
   }
 
+  /**
+   * Emplaces a new element into the buffer if space in the buffer is
+   * available. The arguments are left intact otherwise.
+   *
+   * @return false if the buffer is full.
+   */
+  template <typename... TArgs>
+  bool try_emplace(TArgs &&...args) {
+    auto pos = write_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &slot = buffer_[pos % capacity_];
+      const auto sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == pos) {
+        if (write_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          slot.element = TElement(std::forward<TArgs>(args)...);
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (sequence < pos) {
+        // The slot still holds the element written a lap ago.
+        return false;
+      } else {
+        pos = write_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
   /**
    * Removes and returns the oldest element from the buffer. If the buffer is
    * empty, nullopt is returned.
    */
   std::optional<TElement> pop() {
-    std::lock_guard<memgraph::utils::SpinLock> guard(lock_);
-    if (size_ == 0) return std::nullopt;
-    size_--;
-    std::optional<TElement> result(std::move(buffer_[read_pos_++]));
-    read_pos_ %= capacity_;
-    return result;
+    auto pos = read_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      auto &slot = buffer_[pos % capacity_];
+      const auto sequence = slot.sequence.load(std::memory_order_acquire);
+      if (sequence == pos + 1) {
+        if (read_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          std::optional<TElement> result(std::move(slot.element));
+          slot.sequence.store(pos + capacity_, std::memory_order_release);
+          return result;
+        }
+      } else if (sequence < pos + 1) {
+        // The slot wasn't written yet.
+        return std::nullopt;
+      } else {
+        pos = read_pos_.load(std::memory_order_relaxed);
+      }
+    }
   }
 
   /** Removes all elements from the buffer. */
   void clear() {
-    std::lock_guard<memgraph::utils::SpinLock> guard(lock_);
-    read_pos_ = 0;
-    write_pos_ = 0;
-    size_ = 0;
+    while (pop()) {
+    }
   }
 
  private:
-  int capacity_;
-  std::unique_ptr<TElement[]> buffer_;
-  memgraph::utils::SpinLock lock_;
-  int read_pos_{0};
-  int write_pos_{0};
-  int size_{0};
+  struct Slot {
+    std::atomic<uint64_t> sequence;
+    TElement element;
+  };
+
+  uint64_t capacity_;
+  std::unique_ptr<Slot[]> buffer_;
+  // The positions only grow, the slot of a position is `position % capacity_`.
+  alignas(64) std::atomic<uint64_t> write_pos_{0};
+  alignas(64) std::atomic<uint64_t> read_pos_{0};
 };
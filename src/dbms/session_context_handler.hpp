@@ -12,6 +12,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <concepts>
 #include <cstdint>
 #include <filesystem>
@@ -19,6 +20,7 @@
 #include <mutex>
 #include <optional>
 #include <ostream>
+#include <set>
 #include <stdexcept>
 #include <system_error>
 #include <unordered_map>
@@ -33,11 +35,13 @@
 #include "spdlog/spdlog.h"
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/paths.hpp"
+#include "storage/v2/inmemory/storage.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/file.hpp"
 #include "utils/logging.hpp"
 #include "utils/result.hpp"
 #include "utils/rw_lock.hpp"
+#include "utils/scheduler.hpp"
 #include "utils/synchronized.hpp"
 #include "utils/uuid.hpp"
 
@@ -79,13 +83,18 @@ class SessionContextHandler {
    * @param audit_log pointer to the audit logger (ENTERPRISE only)
    * @param configs storage and interpreter configurations
    * @param recovery_on_startup restore databases (and its content) and authentication data
+   * @param delete_on_drop delete the storage directory of dropped databases
+   * @param lazy_loading recover the databases other than the default one when they are first used
+   * @param unload_idle_after unload databases unused for this long (0 to keep them loaded)
    */
-  SessionContextHandler(memgraph::audit::Log &audit_log, Config configs, bool recovery_on_startup, bool delete_on_drop)
+  SessionContextHandler(memgraph::audit::Log &audit_log, Config configs, bool recovery_on_startup, bool delete_on_drop,
+                        bool lazy_loading = false, std::chrono::seconds unload_idle_after = {})
       : lock_{utils::RWLock::Priority::READ},
         default_configs_(configs),
         run_id_{utils::GenerateUUID()},
         audit_log_(&audit_log),
-        delete_on_drop_(delete_on_drop) {
+        delete_on_drop_(delete_on_drop),
+        unload_idle_after_(unload_idle_after) {
     const auto &root = configs.storage_config.durability.storage_directory;
     utils::EnsureDirOrDie(root);
     // Verify that the user that started the process is the same user that is
@@ -152,6 +161,10 @@ class SessionContextHandler {
     if (recovery_on_startup) {
       for (const auto &[name, _] : *durability_) {
         if (name == kDefaultDB) continue;  // Already set
+        if (lazy_loading) {
+          unloaded_dbs_.emplace(name);
+          continue;
+        }
         spdlog::info("Restoring database {}.", name);
         MG_ASSERT(!New_(name).HasError(), "Failed while creating database {}.", name);
         spdlog::info("Database {} restored.", name);
@@ -164,9 +177,21 @@ class SessionContextHandler {
         durability_->Delete(name);
       }
     }
+
+    // Unloaded databases are recovered from their snapshots, so they must be written
+    if (unload_idle_after_ > std::chrono::seconds::zero()) {
+      if (default_configs_->storage_config.durability.snapshot_wal_mode ==
+          storage::Config::Durability::SnapshotWalMode::DISABLED) {
+        spdlog::warn("Idle databases won't be unloaded because the durability is disabled.");
+      } else {
+        unload_scheduler_.Run("Unload idle DBs", std::min(unload_idle_after_, std::chrono::seconds(60)),
+                              [this] { UnloadIdle_(); });
+      }
+    }
   }
 
   void Shutdown() {
+    unload_scheduler_.Stop();
     for (auto &ic : interp_handler_) memgraph::query::Shutdown(ic.second.get().get());
   }
 
@@ -178,6 +203,7 @@ class SessionContextHandler {
    */
   NewResultT New(const std::string &name) {
     std::lock_guard<LockT> wr(lock_);
+    if (unloaded_dbs_.contains(name)) return NewError::EXISTS;
     return New_(name, name);
   }
 
@@ -189,6 +215,7 @@ class SessionContextHandler {
    * @throw UnknownDatabaseException if getting unknown database
    */
   SessionContext Get(const std::string &name) {
+    EnsureLoaded_(name);
     std::shared_lock<LockT> rd(lock_);
     return Get_(name);
   }
@@ -202,6 +229,7 @@ class SessionContextHandler {
    * @throws UnknownDatabaseException, UnknownSessionException or anything OnChange throws
    */
   SetForResult SetFor(const std::string &uuid, const std::string &db_name) {
+    EnsureLoaded_(db_name);
     std::shared_lock<LockT> rd(lock_);
     (void)Get_(
         db_name);  // throws if db doesn't exist (TODO: Better to pass it via OnChange - but injecting dependency)
@@ -223,6 +251,7 @@ class SessionContextHandler {
   template <typename THandler>
   requires std::invocable<THandler, SessionContext> SetForResult SetInPlace(const std::string &db_name,
                                                                             THandler handler) {
+    EnsureLoaded_(db_name);
     std::shared_lock<LockT> rd(lock_);
     return handler(Get_(db_name));
   }
@@ -268,6 +297,8 @@ class SessionContextHandler {
    * @return DeleteResult error on failure
    */
   DeleteResult Delete(const std::string &db_name) {
+    // Recovered so that the database is dropped the same way as the loaded ones
+    EnsureLoaded_(db_name);
     std::lock_guard<LockT> wr(lock_);
     if (db_name == kDefaultDB) {
       // MSG cannot delete the default db
@@ -320,6 +351,7 @@ class SessionContextHandler {
 
     // Delete from defunct_dbs_ (in case a second delete call was successful)
     defunct_dbs_.erase(db_name);
+    last_used_.erase(db_name);
 
     return {};  // Success
   }
@@ -345,17 +377,19 @@ class SessionContextHandler {
   }
 
   /**
-   * @brief Return all active databases.
+   * @brief Return all databases, including the ones which aren't loaded.
    *
    * @return std::vector<std::string>
    */
   std::vector<std::string> All() const {
     std::shared_lock<LockT> rd(lock_);
-    return interp_handler_.All();
+    auto all = interp_handler_.All();
+    all.insert(all.end(), unloaded_dbs_.begin(), unloaded_dbs_.end());
+    return all;
   }
 
   /**
-   * @brief Return the number of vertex across all databases.
+   * @brief Return the number of vertex across all loaded databases.
    *
    * @return uint64_t
    */
@@ -364,7 +398,7 @@ class SessionContextHandler {
     uint64_t nv = 0;
     uint64_t ne = 0;
     std::shared_lock<LockT> rd(lock_);
-    const uint64_t ndb = std::distance(interp_handler_.cbegin(), interp_handler_.cend());
+    const uint64_t ndb = std::distance(interp_handler_.cbegin(), interp_handler_.cend()) + unloaded_dbs_.size();
     for (const auto &ic : interp_handler_) {
       const auto &info = ic.second.get()->db->GetInfo();
       nv += info.vertex_count;
@@ -391,13 +425,7 @@ class SessionContextHandler {
    */
   void RestoreTriggers() {
     std::lock_guard<LockT> wr(lock_);
-    for (auto &ic_itr : interp_handler_) {
-      auto ic = ic_itr.second.get();
-      spdlog::debug("Restoring trigger for database \"{}\"", ic->db->id());
-      auto storage_accessor = ic->db->Access();
-      auto dba = memgraph::query::DbAccessor{storage_accessor.get()};
-      ic->trigger_store.RestoreTriggers(&ic->ast_cache, &dba, ic->config.query, ic->auth_checker);
-    }
+    for (auto &ic_itr : interp_handler_) RestoreTriggers_(ic_itr.second.get().get());
   }
 
   /**
@@ -406,14 +434,84 @@ class SessionContextHandler {
    */
   void RestoreStreams() {
     std::lock_guard<LockT> wr(lock_);
-    for (auto &ic_itr : interp_handler_) {
-      auto ic = ic_itr.second.get();
-      spdlog::debug("Restoring streams for database \"{}\"", ic->db->id());
-      ic->streams.RestoreStreams();
-    }
+    for (auto &ic_itr : interp_handler_) RestoreStreams_(ic_itr.second.get().get());
   }
 
  private:
+  static void RestoreTriggers_(query::InterpreterContext *ic) {
+    spdlog::debug("Restoring trigger for database \"{}\"", ic->db->id());
+    auto storage_accessor = ic->db->Access();
+    auto dba = memgraph::query::DbAccessor{storage_accessor.get()};
+    ic->trigger_store.RestoreTriggers(&ic->ast_cache, &dba, ic->config.query, ic->auth_checker);
+  }
+
+  static void RestoreStreams_(query::InterpreterContext *ic) {
+    spdlog::debug("Restoring streams for database \"{}\"", ic->db->id());
+    ic->streams.RestoreStreams();
+  }
+
+  /**
+   * @brief Recover the "name" database if it's durable but not loaded yet.
+   *
+   * @param name name of the database
+   */
+  void EnsureLoaded_(const std::string &name) {
+    {
+      std::shared_lock<LockT> rd(lock_);
+      if (!unloaded_dbs_.contains(name)) return;
+    }
+    std::lock_guard<LockT> wr(lock_);
+    if (!unloaded_dbs_.contains(name)) return;  // Loaded in the meantime
+    spdlog::info("Restoring database {}.", name);
+    auto storage = default_configs_->storage_config;
+    storage::UpdatePaths(storage, storage.durability.storage_directory / name);
+    // The data of unloaded databases is only on disk
+    storage.durability.recover_on_startup = true;
+    auto res = New_(name, storage, default_configs_->interp_config);
+    MG_ASSERT(!res.HasError(), "Failed while creating database {}.", name);
+    unloaded_dbs_.erase(name);
+    last_used_[name] = std::chrono::steady_clock::now();
+    RestoreTriggers_(res.GetValue().interpreter_context.get());
+    RestoreStreams_(res.GetValue().interpreter_context.get());
+    spdlog::info("Database {} restored.", name);
+  }
+
+  /**
+   * @brief Unload databases which had no sessions nor streams for unload_idle_after_.
+   */
+  void UnloadIdle_() {
+    std::lock_guard<LockT> wr(lock_);
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::string> idle;
+    for (auto &[name, item] : interp_handler_) {
+      if (name == kDefaultDB) continue;
+      auto [last_used, _] = last_used_.try_emplace(name, now);
+      auto ic = item.get();
+      if (!ic->interpreters->empty() || !ic->streams.GetStreamInfo().empty()) {
+        last_used->second = now;
+      } else if (now - last_used->second >= unload_idle_after_) {
+        idle.push_back(name);
+      }
+    }
+    for (const auto &name : idle) {
+      auto ic = *interp_handler_.Get(name);
+      if (auto *mem_storage = dynamic_cast<storage::InMemoryStorage *>(ic->db.get())) {
+        if (mem_storage->CreateSnapshot({false}).HasError()) {
+          spdlog::warn("Failed to create a snapshot of the idle database {}, it stays loaded.", name);
+          continue;
+        }
+      }
+      ic.reset();
+      if (!interp_handler_.Delete(name)) {
+        spdlog::warn("Failed to unload the idle database {}.", name);
+        continue;
+      }
+      last_used_.erase(name);
+      unloaded_dbs_.emplace(name);
+      spdlog::info("Database {} unloaded after being idle.", name);
+    }
+  }
+
   std::optional<std::filesystem::path> StorageDir_(const std::string &name) const {
     const auto conf = interp_handler_.GetConfig(name);
     if (conf) {
@@ -571,6 +669,10 @@ class SessionContextHandler {
 
   std::set<std::string> defunct_dbs_;  //!< Databases that are in an unknown state due to various failures
   bool delete_on_drop_;                //!< Flag defining if dropping storage also deletes its directory
+  std::set<std::string> unloaded_dbs_;  //!< Durable databases which are loaded on first use
+  std::chrono::seconds unload_idle_after_;  //!< Idle time after which databases are unloaded (0 to disable)
+  std::unordered_map<std::string, std::chrono::steady_clock::time_point> last_used_;  //!< Last time a DB was in use
+  utils::Scheduler unload_scheduler_;  //!< Periodically unloads idle databases (destroyed first)
  public:
   static SessionContextHandler &ExtractSCH(query::InterpreterContext *interpreter_context) {
     return static_cast<typename decltype(interp_handler_)::InterpContextT *>(interpreter_context)->sc_handler_;
@@ -25,4 +25,8 @@ DEFINE_VALIDATED_int32(audit_buffer_size, memgraph::audit::kBufferSizeDefault,
 DEFINE_VALIDATED_int32(audit_buffer_flush_interval_ms, memgraph::audit::kBufferFlushIntervalMillisDefault,
                        "Interval (in milliseconds) used for flushing the audit log buffer.",
                        FLAG_IN_RANGE(10, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(audit_buffer_drop_when_full, false,
+            "Set to true to drop the audit log entries recorded while the audit log buffer is full instead of "
+            "blocking the queries until the buffer is flushed.");
 #endif
@@ -20,4 +20,6 @@ DECLARE_bool(audit_enabled);
 DECLARE_int32(audit_buffer_size);
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(audit_buffer_flush_interval_ms);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(audit_buffer_drop_when_full);
 #endif
@@ -27,6 +27,44 @@ DEFINE_VALIDATED_int32(bolt_num_workers, std::max(std::thread::hardware_concurre
                        "number of processing units available on the machine.",
                        FLAG_IN_RANGE(1, INT32_MAX));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_num_io_workers, 1,
+                       "Number of workers which accept the Bolt connections and read from them. The queries are "
+                       "executed by the workers set by bolt_num_workers.",
+                       FLAG_IN_RANGE(1, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_io_context_per_worker, false,
+            "Each Bolt I/O worker runs its own event loop pinned to a processing unit, and accepts connections "
+            "with its own socket bound using SO_REUSEPORT. A connection is handled by the same worker for its "
+            "lifetime.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_numa_aware_workers, false,
+            "Spread the Bolt workers across the NUMA nodes, pinning each to the processing units of its node and "
+            "giving each node its own memory arena, so the data created by the queries is placed on the node of "
+            "the worker which creates it.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_long_execution_ms, 1000,
+                       "Bolt sessions whose previous execution took longer than this number of milliseconds are "
+                       "executed with a lower priority, and can't occupy all of the Bolt workers.",
+                       FLAG_IN_RANGE(0, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_max_executing_per_client, 0,
+                       "Maximum number of queries of a single user executed by the Bolt workers at once. The other "
+                       "queries of the user wait while the queries of other users are executed. 0 for no limit.",
+                       FLAG_IN_RANGE(0, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_max_queued_per_client, 0,
+                       "Maximum number of queries of a single user waiting for the Bolt workers. Further queries of "
+                       "the user fail immediately with a transient error. 0 for no limit.",
+                       FLAG_IN_RANGE(0, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_fair_share_by_role, false,
+            "The Bolt workers are shared fairly between the roles instead of the users, and the limits on the "
+            "queries of a user apply to their role.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(bolt_fair_share_by_database, false,
+            "The Bolt workers are shared fairly between the databases instead of the users, and the limits on the "
+            "queries of a user apply to the database of the session.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(bolt_session_inactivity_timeout, 1800,
                        "Time in seconds after which inactive Bolt sessions will be "
                        "closed.",
@@ -0,0 +1,57 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+#include "flags/disk_workload_profile.hpp"
+
+#include "utils/enum.hpp"
+#include "utils/flag_validation.hpp"
+
+#include "gflags/gflags.h"
+
+#include <array>
+#include <string_view>
+
+using WorkloadProfile = memgraph::storage::Config::DiskConfig::WorkloadProfile;
+
+inline constexpr std::array disk_workload_profile_mappings{
+    std::pair{std::string_view{"DEFAULT"}, WorkloadProfile::DEFAULT},
+    std::pair{std::string_view{"POINT_LOOKUPS"}, WorkloadProfile::POINT_LOOKUPS},
+    std::pair{std::string_view{"SCANS"}, WorkloadProfile::SCANS}};
+
+const std::string disk_workload_profile_help_string = fmt::format(
+    "RocksDB options of the on-disk storage, tuned for the expected workload. Allowed values: {}",
+    memgraph::utils::GetAllowedEnumValuesString(disk_workload_profile_mappings));
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_string(storage_disk_workload_profile, "DEFAULT", disk_workload_profile_help_string.c_str(), {
+  if (const auto result = memgraph::utils::IsValidEnumValueString(value, disk_workload_profile_mappings);
+      result.HasError()) {
+    switch (result.GetError()) {
+      case memgraph::utils::ValidationError::EmptyValue: {
+        std::cout << "Disk workload profile cannot be empty." << std::endl;
+        break;
+      }
+      case memgraph::utils::ValidationError::InvalidValue: {
+        std::cout << "Invalid value for disk workload profile. Allowed values: "
+                  << memgraph::utils::GetAllowedEnumValuesString(disk_workload_profile_mappings) << std::endl;
+        break;
+      }
+    }
+    return false;
+  }
+  return true;
+});
+
+WorkloadProfile memgraph::flags::ParseDiskWorkloadProfile() {
+  const auto profile =
+      memgraph::utils::StringToEnum<WorkloadProfile>(FLAGS_storage_disk_workload_profile, disk_workload_profile_mappings);
+  MG_ASSERT(profile, "Invalid disk workload profile");
+  return *profile;
+}
@@ -37,6 +37,10 @@ DEFINE_VALIDATED_int32(monitoring_port, 7444,
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(metrics_port, 9091, "Port on which the Memgraph server for exposing metrics should listen.",
                        FLAG_IN_RANGE(0, std::numeric_limits<uint16_t>::max()));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(metrics_query_fingerprints, 100,
+              "Number of the most frequently executed query fingerprints whose latency histograms and counters are "
+              "exposed as metrics. Value of 0 disables the fingerprint metrics.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(init_file, "",
@@ -66,10 +70,38 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24 * 3600));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_gc_thread_count, memgraph::storage::Config::Gc().thread_count,
+                        "The number of threads used by the storage garbage collector.", FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_time_slice_ms, memgraph::storage::Config::Gc().time_slice.count(),
+              "Maximum time (in milliseconds) a storage garbage collector cycle unlinks deltas before it releases the "
+              "storage lock and continues in a new slice. Set to 0 to disable slicing.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_gc_compact_delta_chains, memgraph::storage::Config::Gc().compact_delta_chains,
+            "Controls whether the storage garbage collector removes property versions which no active transaction "
+            "can see from delta chains that are kept alive by long-running transactions.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(storage_dictionary_encoded_properties, "",
+              "Comma-separated list of properties whose string values are stored only once, in a dictionary shared by "
+              "all vertices and edges. Use it for properties with a limited number of distinct values. Ignored by "
+              "the on-disk storage.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_packed_index_merge_threshold, memgraph::storage::Config().packed_index_merge_threshold,
+              "Keep label+property indices in packed, sorted arrays and merge recent writes into them during garbage "
+              "collection once at least this many of them accumulate. Use it for labels which are mostly read. Set to "
+              "0 to disable. Ignored by the on-disk storage.");
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
 // `mg_import_csv`. If you change it, make sure to change it there as well.
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_properties_on_edges, false, "Controls whether edges have properties.");
+// NOTE: The `storage_properties_on_edge_types` flag must be the same here and
+// in `mg_import_csv`. If you change it, make sure to change it there as well.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(storage_properties_on_edge_types, "",
+              "Comma-separated list of edge types whose edges have properties when --storage-properties-on-edges is "
+              "off. The edges of the other types are stored only as references in their vertices. The list must stay "
+              "the same between restarts. Ignored by the on-disk storage.");
 
 // storage_recover_on_startup deprecated; use data_recovery_on_startup instead
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -88,6 +120,13 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_max_increments,
+                        memgraph::storage::Config::Durability().snapshot_max_increments,
+                        "The number of incremental snapshots, which store only the vertices and edges changed since "
+                        "the previous snapshot, created after each full snapshot. Set to 0 to create only full "
+                        "snapshots.",
+                        FLAG_IN_RANGE(0, 1000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -98,15 +137,75 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, memgraph::storage::Config::Durability().wal_group_commit,
+            "Make every commit durable before it returns, syncing the WAL of concurrent commits with a single "
+            "'fsync' call on a dedicated thread. Overrides --storage-wal-file-flush-every-n-tx.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_wal_preallocated_files, memgraph::storage::Config::Durability().wal_preallocated_files,
+              "Number of empty files with the space of a WAL file preallocated which are kept ready for new WAL "
+              "files. Set to 0 to disable preallocation.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_direct_io, memgraph::storage::Config::Durability().wal_direct_io,
+            "Write WAL files with direct I/O (O_DIRECT), bypassing the page cache.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_durability_compression, memgraph::storage::Config::Durability().compression,
+            "Compress the objects written to snapshots and the transactions written to WAL files with zlib.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
               "The number of edges and vertices stored in a batch in a snapshot file.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_thread_count, memgraph::storage::Config::Durability().snapshot_thread_count,
+                        "The number of threads used to create snapshots. Each thread encodes batches of "
+                        "--storage-items-per-batch vertices or edges.",
+                        FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_snapshot_write_mib_per_sec,
+              memgraph::storage::Config::Durability().snapshot_write_mebibytes_per_sec,
+              "Limit the rate at which snapshots are written to this many MiB per second, so that they don't delay "
+              "the WAL syncs of commits. While limited, snapshot writes also wait for the WAL syncs in progress. Set "
+              "to 0 to write snapshots as fast as possible.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_parallel_index_recovery, false,
-            "Controls whether the index creation can be done in a multithreaded fashion.");
+            "Controls whether the index creation, both on recovery and on CREATE INDEX, can be done in a "
+            "multithreaded fashion.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_recover_to_timestamp, 0,
+              "Recover only the transactions committed at or before this commit timestamp. The snapshots and WAL "
+              "files with later transactions are moved to the .backup directory. Set to 0 to recover everything.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_background_index_recovery, memgraph::storage::Config::Durability().background_index_recovery,
+            "Create the recovered label and label+property indices in the background, so queries can be served as "
+            "soon as the data is recovered. Queries don't use an index until it's created.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_vertex_cache_mib, memgraph::storage::Config::DiskConfig().vertex_cache_mib,
+              "Memory in MiB for the vertices read from the on-disk storage which are cached across transactions. "
+              "Set to 0 to disable the cache.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_disk_block_cache_percent, 10,
+                        "Percentage of the memory limit used for the RocksDB block cache of the on-disk storage "
+                        "when a non-default workload profile is set.",
+                        FLAG_IN_RANGE(1, 100));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_sst_ingestion_min_objects,
+              memgraph::storage::Config::DiskConfig().sst_ingestion_min_objects,
+              "Commits to the on-disk storage which only create at least this many vertices and edges, such as "
+              "imports, are sorted into SST files which are ingested into RocksDB. Set to 0 to disable it.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_disk_reference_indices, memgraph::storage::Config::DiskConfig().reference_indices,
+            "Controls whether the label and label+property indices of the on-disk storage store only references to "
+            "the vertices, which are read from the main storage, instead of copies of their labels and properties.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_write_stall_timeout_ms,
+              memgraph::storage::Config::DiskConfig().write_stall_timeout.count(),
+              "Time in milliseconds a commit to the on-disk storage waits while RocksDB stalls writes until its "
+              "compactions catch up, after which it fails with a retryable error. Set to 0 to wait indefinitely.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_recovery_thread_count,
@@ -118,6 +217,14 @@ DEFINE_uint64(storage_recovery_thread_count,
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_delete_on_drop, true,
             "If set to true the query 'DROP DATABASE x' will delete the underlying storage as well.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_lazy_database_loading, false,
+            "If set to true the databases other than the default one are recovered when they are first used instead "
+            "of on startup.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_unload_idle_databases_sec, 0,
+              "Databases other than the default one without sessions and streams for this many seconds are "
+              "snapshotted and unloaded, and recovered again when they are used. Set to 0 to disable it.");
 #endif
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -137,12 +244,31 @@ DEFINE_uint32(
     stream_transaction_retry_interval, 500,
     "Retry interval in milliseconds when a stream transformation fails to commit because of conflicting transactions");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint32(kafka_stream_max_in_flight_batches, 1,
+                        "Maximum number of batches a Kafka stream polls before the previous ones are processed. With "
+                        "more than 1, the next batches are polled while the current one is transformed and committed.",
+                        FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(kafka_bootstrap_servers, "",
               "List of default Kafka brokers as a comma separated list of broker host or host:port.");
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(pulsar_service_url, "", "Default URL used while connecting to Pulsar brokers.");
 
+// Trigger flags.
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(after_commit_trigger_threads, 1, "Number of threads running the after commit triggers.",
+                        FLAG_IN_RANGE(1, 1024));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(after_commit_trigger_batch_size, 1,
+                        "Maximum number of committed transactions whose changes are merged into a single run of the "
+                        "after commit triggers.",
+                        FLAG_IN_RANGE(1, 1000000));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(after_commit_trigger_queue_size, 0,
+              "Maximum number of committed transactions waiting for their after commit triggers. Committing "
+              "transactions wait while the queue is full. With 0, the queue isn't limited.");
+
 // Query flags.
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -150,12 +276,79 @@ DEFINE_double(query_execution_timeout_sec, -1,
               "Maximum allowed query execution time. Queries exceeding this "
               "limit will be aborted. Value of 0 means no limit.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_parallel_execution_threads, 0,
+              "Number of threads helping to execute parts of read-only queries, such as scans followed by an "
+              "aggregation, in parallel. Value of 0 executes each query on a single thread.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_pull_batch_size, 256,
+              "Number of rows pulled at once by the query operators of read-only queries. Value of 0 pulls the rows "
+              "one at a time.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_prefetch_rows, 1000,
+              "Maximum number of results of a read-only query computed ahead of the client's next PULL while the "
+              "previous results are sent. Value of 0 computes the results only when they are pulled.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_spill_threshold_mb, 0,
+              "Maximum memory in megabytes which the aggregations, orderings and DISTINCT clauses of a query keep "
+              "before spilling their rows to temporary files under the data directory. Value of 0 keeps all rows in "
+              "memory.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_memory_limit_per_database_mb, 0,
+              "Maximum memory in megabytes which the executing queries of a single database allocate at once, so "
+              "that the queries of one database can't take the memory of the others. Value of 0 limits the queries "
+              "only by the total memory limit.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_memory_limit_per_user_mb, 0,
+              "Maximum memory in megabytes which the transactions of a single user allocate at once in a database. "
+              "Value of 0 limits the transactions only by the memory limit of the database.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_slow_log_threshold_ms, 1000,
+              "Queries taking at least this many milliseconds are recorded by the slow query log, which keeps the "
+              "recent ones for SHOW SLOW QUERIES and writes them to files under the data directory.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_double(query_slow_log_sample_rate, 1.0,
+                        "Fraction of the queries taking at least --query-slow-log-threshold-ms which are recorded by "
+                        "the slow query log. Value of 0 disables the log.",
+                        FLAG_IN_RANGE(0.0, 1.0));
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_slow_log_size, 1000,
+              "Number of the most recent slow queries of each database kept in memory for SHOW SLOW QUERIES. Value "
+              "of 0 disables the slow query log.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_procedure_cache_mb, 64,
+              "Maximum memory in megabytes taken by the cached records of the procedures which their modules declare "
+              "deterministic. Value of 0 disables the cache.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_result_cache_mb, 0,
+              "Maximum memory in megabytes taken by the cached results of read-only queries, which are reused by the "
+              "same queries with the same parameters while the database doesn't change. Value of 0 disables the "
+              "cache.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: "
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, false, "Restore replication state on startup, e.g. recover replica");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_sync_quorum, 0,
+              "The number of SYNC replicas which must apply a transaction before its commit succeeds. The responses "
+              "of the replicas are awaited concurrently. 0 waits for all SYNC replicas.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_bookmark_wait_timeout_ms, 5000,
+              "The time a transaction started with bookmarks waits for the instance (usually a REPLICA) to catch up "
+              "with them before it fails.");
 
 DEFINE_VALIDATED_string(query_modules_directory, "",
                         "Directory where modules with custom query procedures are stored. "
@@ -173,6 +366,11 @@ DEFINE_VALIDATED_string(query_modules_directory, "",
                           return true;
                         });
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_modules_lazy_loading, false,
+            "Load each query module when it's first used instead of loading all of them on startup and on "
+            "mg.load_all(). The commit hooks of a module only run once it's loaded.");
+
 auto memgraph::flags::ParseQueryModulesDirectory() -> std::vector<std::filesystem::path> {
   const auto directories = memgraph::utils::Split(FLAGS_query_modules_directory, ",");
   std::vector<std::filesystem::path> query_modules_directories;
@@ -189,6 +387,12 @@ DEFINE_string(query_callable_mappings_path, "",
               "pairs in a json file. With this option query module procedures that do not exist in memgraph can be "
               "mapped to ones that exist.");
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(query_cost_model_path, "",
+              "The path to a json file with the costs of processing a row by each query operator, which the query "
+              "planner uses instead of the default ones. The file can be made on the host by the cost_calibration "
+              "benchmark.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_HIDDEN_string(license_key, "", "License key for Memgraph Enterprise.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
@@ -13,6 +13,7 @@
 #include <optional>
 
 #include "audit/log.hpp"
+#include "flags/bolt.hpp"
 #include "flags/run_time_configurable.hpp"
 #include "glue/auth_checker.hpp"
 #include "glue/communication.hpp"
@@ -42,7 +43,25 @@ auto ToQueryExtras(const memgraph::communication::bolt::Value &extra) -> memgrap
     tx_timeout = it->second.ValueInt();
   }
 
-  return memgraph::query::QueryExtras{std::move(metadata_pv), tx_timeout};
+  auto bookmarks = std::vector<std::string>{};
+  if (auto const it = as_map.find("bookmarks"); it != as_map.cend() && it->second.IsList()) {
+    for (const auto &bookmark : it->second.ValueList()) {
+      if (bookmark.IsString()) bookmarks.push_back(bookmark.ValueString());
+    }
+  }
+
+  auto prepared_statement = std::optional<std::string>{};
+  if (auto const it = as_map.find("prepared_statement"); it != as_map.cend() && it->second.IsString()) {
+    prepared_statement = it->second.ValueString();
+  }
+
+  auto result_cache_max_staleness_ms = std::optional<int64_t>{};
+  if (auto const it = as_map.find("result_cache_max_staleness_ms"); it != as_map.cend() && it->second.IsInt()) {
+    result_cache_max_staleness_ms = it->second.ValueInt();
+  }
+
+  return memgraph::query::QueryExtras{std::move(metadata_pv), tx_timeout, std::move(bookmarks),
+                                      std::move(prepared_statement), result_cache_max_staleness_ms};
 }
 
 class TypedValueResultStreamBase {
@@ -153,12 +172,18 @@ std::optional<std::string> SessionHL::GetServerNameForInit() {
   return locked_name->empty() ? std::nullopt : std::make_optional(*locked_name);
 }
 
+std::string SessionHL::FairShareKey() const {
+  if (FLAGS_bolt_fair_share_by_database) return "db:" + interpreter_context_->db->id();
+  if (!user_) return "session:" + UUID();
+  if (FLAGS_bolt_fair_share_by_role && user_->role()) return "role:" + user_->role()->rolename();
+  return "user:" + user_->username();
+}
+
 bool SessionHL::Authenticate(const std::string &username, const std::string &password) {
-  auto locked_auth = auth_->Lock();
-  if (!locked_auth->HasUsers()) {
+  if (!auth_->ReadLock()->HasUsers()) {
     return true;
   }
-  user_ = locked_auth->Authenticate(username, password);
+  user_ = memgraph::auth::Authenticate(auth_, username, password);
 #ifdef MG_ENTERPRISE
   if (user_.has_value()) {
     const auto &db = user_->db_access().GetDefault();
@@ -196,12 +221,16 @@ std::map<std::string, memgraph::communication::bolt::Value> SessionHL::Pull(Sess
     throw memgraph::communication::bolt::ClientError(e.what());
   }
 }
+void SessionHL::Prefetch(const std::function<bool()> &should_stop) { interpreter_->Prefetch(should_stop); }
 std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(
-    const std::string &query, const std::map<std::string, memgraph::communication::bolt::Value> &params,
+    const std::string &query, std::map<std::string, memgraph::communication::bolt::Value> params,
     const std::map<std::string, memgraph::communication::bolt::Value> &extra) {
+  // The parameters are moved instead of copied, so large parameters aren't
+  // held twice.
   std::map<std::string, memgraph::storage::PropertyValue> params_pv;
-  for (const auto &[key, bolt_param] : params) {
-    params_pv.emplace(key, ToPropertyValue(bolt_param));
+  while (!params.empty()) {
+    auto param = params.extract(params.begin());
+    params_pv.emplace(std::move(param.key()), ToPropertyValue(std::move(param.mapped())));
   }
   const std::string *username{nullptr};
   if (user_) {
@@ -215,7 +244,7 @@ std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(
   }
 #endif
   try {
-    auto result = interpreter_->Prepare(query, params_pv, username, ToQueryExtras(extra), UUID());
+    auto result = interpreter_->Prepare(query, std::move(params_pv), username, ToQueryExtras(extra), UUID());
     const std::string db_name = result.db ? *result.db : "";
     if (user_ && !AuthChecker::IsUserAuthorized(*user_, result.privileges, db_name)) {
       interpreter_->Abort();
@@ -239,7 +268,13 @@ std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(
   }
 }
 void SessionHL::RollbackTransaction() { interpreter_->RollbackTransaction(); }
-void SessionHL::CommitTransaction() { interpreter_->CommitTransaction(); }
+std::map<std::string, memgraph::communication::bolt::Value> SessionHL::CommitTransaction() {
+  interpreter_->CommitTransaction();
+  if (const auto &bookmark = interpreter_->GetBookmark()) {
+    return {{"bookmark", *bookmark}};
+  }
+  return {};
+}
 void SessionHL::BeginTransaction(const std::map<std::string, memgraph::communication::bolt::Value> &extra) {
   interpreter_->BeginTransaction(ToQueryExtras(extra));
 }
@@ -75,12 +75,12 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
 
   void BeginTransaction(const std::map<std::string, memgraph::communication::bolt::Value> &extra) override;
 
-  void CommitTransaction() override;
+  std::map<std::string, memgraph::communication::bolt::Value> CommitTransaction() override;
 
   void RollbackTransaction() override;
 
   std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, memgraph::communication::bolt::Value> &params,
+      const std::string &query, std::map<std::string, memgraph::communication::bolt::Value> params,
       const std::map<std::string, memgraph::communication::bolt::Value> &extra) override;
 
   std::map<std::string, memgraph::communication::bolt::Value> Pull(TEncoder *encoder, std::optional<int> n,
@@ -89,6 +89,8 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
   std::map<std::string, memgraph::communication::bolt::Value> Discard(std::optional<int> n,
                                                                       std::optional<int> qid) override;
 
+  void Prefetch(const std::function<bool()> &should_stop) override;
+
   void Abort() override;
 
   // Called during Init
@@ -104,6 +106,11 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
 
   std::string GetDatabaseName() const override;
 
+  /// Returns the client whose queries share the Bolt workers fairly with the
+  /// other clients: the user or their role, or the session before the user
+  /// is authenticated.
+  std::string FairShareKey() const;
+
  private:
   std::map<std::string, memgraph::communication::bolt::Value> DecodeSummary(
       const std::map<std::string, memgraph::query::TypedValue> &summary);
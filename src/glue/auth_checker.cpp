@@ -21,46 +21,30 @@
 
 #ifdef MG_ENTERPRISE
 namespace {
-bool IsUserAuthorizedLabels(const memgraph::auth::User &user, const memgraph::query::DbAccessor *dba,
-                            const std::vector<memgraph::storage::LabelId> &labels,
-                            const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
+bool IsUserAuthorizedGlobally(const memgraph::auth::FineGrainedAccessPermissions &permissions,
+                              const memgraph::auth::FineGrainedPermission fine_grained_permission) {
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return std::all_of(labels.begin(), labels.end(), [dba, &user, fine_grained_privilege](const auto &label) {
-    return user.GetFineGrainedAccessLabelPermissions().Has(
-               dba->LabelToName(label), memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(
-                                            fine_grained_privilege)) == memgraph::auth::PermissionLevel::GRANT;
-  });
-}
-
-bool IsUserAuthorizedGloballyLabels(const memgraph::auth::User &user,
-                                    const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return user.GetFineGrainedAccessLabelPermissions().Has(memgraph::query::kAsterisk, fine_grained_permission) ==
-         memgraph::auth::PermissionLevel::GRANT;
+  return permissions.Has(memgraph::query::kAsterisk, fine_grained_permission) == memgraph::auth::PermissionLevel::GRANT;
 }
 
-bool IsUserAuthorizedGloballyEdges(const memgraph::auth::User &user,
-                                   const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
+// Returns the bits of the fine-grained permissions granted for the label or edge type with the given name.
+uint8_t CompileGrants(const memgraph::auth::FineGrainedAccessPermissions &permissions, const std::string &name) {
+  uint8_t grants{0};
+  for (const auto permission :
+       {memgraph::auth::FineGrainedPermission::READ, memgraph::auth::FineGrainedPermission::UPDATE,
+        memgraph::auth::FineGrainedPermission::CREATE_DELETE}) {
+    if (permissions.Has(name, permission) == memgraph::auth::PermissionLevel::GRANT) {
+      grants |= static_cast<uint8_t>(permission);
+    }
   }
-  return user.GetFineGrainedAccessEdgeTypePermissions().Has(memgraph::query::kAsterisk, fine_grained_permission) ==
-         memgraph::auth::PermissionLevel::GRANT;
+  return grants;
 }
 
-bool IsUserAuthorizedEdgeType(const memgraph::auth::User &user, const memgraph::query::DbAccessor *dba,
-                              const memgraph::storage::EdgeTypeId &edgeType,
-                              const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return user.GetFineGrainedAccessEdgeTypePermissions().Has(
-             dba->EdgeTypeToName(edgeType), memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(
-                                                fine_grained_privilege)) == memgraph::auth::PermissionLevel::GRANT;
+bool IsGranted(const uint8_t grants, const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
+  return (grants & static_cast<uint8_t>(
+                       memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege))) != 0;
 }
 }  // namespace
 #endif
@@ -131,7 +115,26 @@ bool AuthChecker::IsUserAuthorized(const memgraph::auth::User &user,
 
 #ifdef MG_ENTERPRISE
 FineGrainedAuthChecker::FineGrainedAuthChecker(auth::User user, const memgraph::query::DbAccessor *dba)
-    : user_{std::move(user)}, dba_(dba){};
+    : user_{std::move(user)},
+      dba_(dba),
+      label_permissions_{user_.GetFineGrainedAccessLabelPermissions()},
+      edge_type_permissions_{user_.GetFineGrainedAccessEdgeTypePermissions()} {}
+
+uint8_t FineGrainedAuthChecker::LabelGrants(const memgraph::storage::LabelId label) const {
+  const auto id = label.AsUint();
+  if (id >= label_grants_.size()) label_grants_.resize(id + 1, kUnresolvedGrants);
+  auto &grants = label_grants_[id];
+  if (grants == kUnresolvedGrants) grants = CompileGrants(label_permissions_, dba_->LabelToName(label));
+  return grants;
+}
+
+uint8_t FineGrainedAuthChecker::EdgeTypeGrants(const memgraph::storage::EdgeTypeId edge_type) const {
+  const auto id = edge_type.AsUint();
+  if (id >= edge_type_grants_.size()) edge_type_grants_.resize(id + 1, kUnresolvedGrants);
+  auto &grants = edge_type_grants_[id];
+  if (grants == kUnresolvedGrants) grants = CompileGrants(edge_type_permissions_, dba_->EdgeTypeToName(edge_type));
+  return grants;
+}
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex, const memgraph::storage::View view,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
@@ -149,22 +152,30 @@ bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex,
     }
   }
 
-  return IsUserAuthorizedLabels(user_, dba_, *maybe_labels, fine_grained_privilege);
+  return Has(*maybe_labels, fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::EdgeAccessor &edge,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsUserAuthorizedEdgeType(user_, dba_, edge.EdgeType(), fine_grained_privilege);
+  return Has(edge.EdgeType(), fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const std::vector<memgraph::storage::LabelId> &labels,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsUserAuthorizedLabels(user_, dba_, labels, fine_grained_privilege);
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  return std::all_of(labels.begin(), labels.end(), [this, fine_grained_privilege](const auto label) {
+    return IsGranted(LabelGrants(label), fine_grained_privilege);
+  });
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::storage::EdgeTypeId &edge_type,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsUserAuthorizedEdgeType(user_, dba_, edge_type, fine_grained_privilege);
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  return IsGranted(EdgeTypeGrants(edge_type), fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
@@ -172,7 +183,8 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsUserAuthorizedGloballyLabels(user_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return IsUserAuthorizedGlobally(label_permissions_,
+                                  FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
@@ -180,7 +192,8 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsUserAuthorizedGloballyEdges(user_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return IsUserAuthorizedGlobally(edge_type_permissions_,
+                                  FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 };
 #endif
 }  // namespace memgraph::glue
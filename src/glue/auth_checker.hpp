@@ -45,6 +45,12 @@ class AuthChecker : public query::AuthChecker {
   mutable memgraph::utils::Synchronized<auth::User, memgraph::utils::SpinLock> user_;  // cached user
 };
 #ifdef MG_ENTERPRISE
+/// Checks the fine-grained permissions of a user during a single query execution.
+///
+/// The permissions of the user and its role are merged once on construction, and the permissions granted for each
+/// label and edge type are compiled into a bit mask the first time the label or edge type is checked, so checking an
+/// object takes a lookup by its ID. The checker is created anew for each query, so a GRANT or REVOKE is visible to
+/// the next query. It's not thread-safe, the operators don't run in parallel when fine-grained access is checked.
 class FineGrainedAuthChecker : public query::FineGrainedAuthChecker {
  public:
   explicit FineGrainedAuthChecker(auth::User user, const memgraph::query::DbAccessor *dba);
@@ -68,8 +74,18 @@ class FineGrainedAuthChecker : public query::FineGrainedAuthChecker {
       memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const override;
 
  private:
+  static constexpr uint8_t kUnresolvedGrants = 0x80;
+
+  uint8_t LabelGrants(memgraph::storage::LabelId label) const;
+  uint8_t EdgeTypeGrants(memgraph::storage::EdgeTypeId edge_type) const;
+
   auth::User user_;
   const memgraph::query::DbAccessor *dba_;
+  auth::FineGrainedAccessPermissions label_permissions_;
+  auth::FineGrainedAccessPermissions edge_type_permissions_;
+  // Granted permission bits indexed by the ID of the label or edge type, `kUnresolvedGrants` until first checked.
+  mutable std::vector<uint8_t> label_grants_;
+  mutable std::vector<uint8_t> edge_type_grants_;
 };
 #endif
 }  // namespace memgraph::glue
@@ -13,6 +13,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "storage/v2/edge_accessor.hpp"
@@ -60,6 +61,8 @@ query::TypedValue ToTypedValue(const Value &value) {
       return query::TypedValue(value.ValueLocalDateTime());
     case Value::Type::Duration:
       return query::TypedValue(value.ValueDuration());
+    case Value::Type::Point:
+      return query::TypedValue(value.ValuePoint());
   }
 }
 
@@ -127,6 +130,8 @@ storage::Result<Value> ToBoltValue(const query::TypedValue &value, const storage
       return Value(value.ValueLocalDateTime());
     case query::TypedValue::Type::Duration:
       return Value(value.ValueDuration());
+    case query::TypedValue::Type::Point:
+      return Value(value.ValuePoint());
     case query::TypedValue::Type::Graph:
       auto maybe_graph = ToBoltGraph(value.ValueGraph(), db, view);
       if (maybe_graph.HasError()) return maybe_graph.GetError();
@@ -147,12 +152,14 @@ storage::Result<communication::bolt::Vertex> ToBoltVertex(const storage::VertexA
   auto maybe_properties = vertex.Properties(view);
   if (maybe_properties.HasError()) return maybe_properties.GetError();
   std::map<std::string, Value> properties;
-  for (const auto &prop : *maybe_properties) {
-    properties[db.PropertyToName(prop.first)] = ToBoltValue(prop.second);
+  // The decoded values aren't needed afterwards, so their strings, lists and
+  // maps are moved instead of copied.
+  for (auto &[property, value] : *maybe_properties) {
+    properties.emplace(db.PropertyToName(property), ToBoltValue(std::move(value)));
   }
-  // Introduced in Bolt v5 (for now just send the ID)
-  auto element_id = std::to_string(id.AsInt());
-  return communication::bolt::Vertex{id, std::move(labels), std::move(properties), std::move(element_id)};
+  // The element ID introduced in Bolt v5 is left empty, so the encoder sends
+  // the ID.
+  return communication::bolt::Vertex{id, std::move(labels), std::move(properties)};
 }
 
 storage::Result<communication::bolt::Edge> ToBoltEdge(const storage::EdgeAccessor &edge, const storage::Storage &db,
@@ -164,15 +171,14 @@ storage::Result<communication::bolt::Edge> ToBoltEdge(const storage::EdgeAccesso
   auto maybe_properties = edge.Properties(view);
   if (maybe_properties.HasError()) return maybe_properties.GetError();
   std::map<std::string, Value> properties;
-  for (const auto &prop : *maybe_properties) {
-    properties[db.PropertyToName(prop.first)] = ToBoltValue(prop.second);
+  // The decoded values aren't needed afterwards, so their strings, lists and
+  // maps are moved instead of copied.
+  for (auto &[property, value] : *maybe_properties) {
+    properties.emplace(db.PropertyToName(property), ToBoltValue(std::move(value)));
   }
-  // Introduced in Bolt v5 (for now just send the ID)
-  const auto element_id = std::to_string(id.AsInt());
-  const auto from_element_id = std::to_string(from.AsInt());
-  const auto to_element_id = std::to_string(to.AsInt());
-  return communication::bolt::Edge{
-      id, from, to, std::move(type), std::move(properties), element_id, from_element_id, to_element_id};
+  // The element IDs introduced in Bolt v5 are left empty, so the encoder
+  // sends the IDs.
+  return communication::bolt::Edge{id, from, to, std::move(type), std::move(properties)};
 }
 
 storage::Result<communication::bolt::Path> ToBoltPath(const query::Path &path, const storage::Storage &db,
@@ -258,6 +264,35 @@ storage::PropertyValue ToPropertyValue(const Value &value) {
     case Value::Type::Duration:
       return storage::PropertyValue(
           storage::TemporalData(storage::TemporalType::Duration, value.ValueDuration().microseconds));
+    case Value::Type::Point:
+      return storage::PropertyValue(value.ValuePoint());
+  }
+}
+
+storage::PropertyValue ToPropertyValue(Value &&value) {
+  switch (value.type()) {
+    case Value::Type::String:
+      return storage::PropertyValue(std::move(value.ValueString()));
+    case Value::Type::List: {
+      auto &values = value.ValueList();
+      std::vector<storage::PropertyValue> vec;
+      vec.reserve(values.size());
+      for (auto &v : values) {
+        vec.emplace_back(ToPropertyValue(std::move(v)));
+      }
+      return storage::PropertyValue(std::move(vec));
+    }
+    case Value::Type::Map: {
+      auto &values = value.ValueMap();
+      std::map<std::string, storage::PropertyValue> map;
+      while (!values.empty()) {
+        auto entry = values.extract(values.begin());
+        map.emplace(std::move(entry.key()), ToPropertyValue(std::move(entry.mapped())));
+      }
+      return storage::PropertyValue(std::move(map));
+    }
+    default:
+      return ToPropertyValue(std::as_const(value));
   }
 }
 
@@ -291,7 +326,7 @@ Value ToBoltValue(const storage::PropertyValue &value) {
       }
       return Value(std::move(dv_map));
     }
-    case storage::PropertyValue::Type::TemporalData:
+    case storage::PropertyValue::Type::TemporalData: {
       const auto &type = value.ValueTemporalData();
       switch (type.type) {
         case storage::TemporalType::Date:
@@ -303,6 +338,34 @@ Value ToBoltValue(const storage::PropertyValue &value) {
         case storage::TemporalType::Duration:
           return Value(utils::Duration(type.microseconds));
       }
+    }
+    case storage::PropertyValue::Type::Point:
+      return Value(value.ValuePoint());
+  }
+}
+
+Value ToBoltValue(storage::PropertyValue &&value) {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::String:
+      return Value(std::move(value.ValueString()));
+    case storage::PropertyValue::Type::List: {
+      auto &values = value.ValueList();
+      std::vector<Value> vec;
+      vec.reserve(values.size());
+      for (auto &v : values) {
+        vec.push_back(ToBoltValue(std::move(v)));
+      }
+      return Value(std::move(vec));
+    }
+    case storage::PropertyValue::Type::Map: {
+      std::map<std::string, Value> dv_map;
+      for (auto &[key, v] : value.ValueMap()) {
+        dv_map.emplace(key, ToBoltValue(std::move(v)));
+      }
+      return Value(std::move(dv_map));
+    }
+    default:
+      return ToBoltValue(std::as_const(value));
   }
 }
 
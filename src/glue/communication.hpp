@@ -72,6 +72,14 @@ query::TypedValue ToTypedValue(const communication::bolt::Value &value);
 
 communication::bolt::Value ToBoltValue(const storage::PropertyValue &value);
 
+/// Like the overload above, but moves the strings, lists and maps out of the
+/// value instead of copying them.
+communication::bolt::Value ToBoltValue(storage::PropertyValue &&value);
+
 storage::PropertyValue ToPropertyValue(const communication::bolt::Value &value);
 
+/// Like the overload above, but moves the strings, lists and maps out of the
+/// value instead of copying them.
+storage::PropertyValue ToPropertyValue(communication::bolt::Value &&value);
+
 }  // namespace memgraph::glue
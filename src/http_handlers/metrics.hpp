@@ -25,6 +25,8 @@
 #include "storage/v2/storage.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/lock_contention.hpp"
+#include "utils/query_fingerprint_metrics.hpp"
 
 namespace memgraph::http {
 
@@ -34,6 +36,11 @@ struct MetricsResponse {
   double average_degree;
   uint64_t memory_usage;
   uint64_t disk_usage;
+  uint64_t uncollected_transactions;
+  uint64_t oldest_active_transaction_age_ms;
+
+  // Entries of each index, including the obsolete ones
+  std::vector<std::pair<std::string, uint64_t>> index_entries{};
 
   // Storage of all the counter values throughout the system
   // e.g. number of active transactions
@@ -45,6 +52,16 @@ struct MetricsResponse {
   // Storage of all the percentile values across the histograms in the system
   // e.g. query latency percentiles, snapshot recovery duration percentiles, etc.
   std::vector<std::tuple<std::string, std::string, uint64_t>> event_histograms{};
+
+  // Replication metrics of each replica registered on MAIN
+  std::vector<storage::ReplicaMetrics> replicas{};
+
+  // Latency percentiles and counters of the most frequently executed query
+  // fingerprints
+  std::vector<std::shared_ptr<const metrics::QueryFingerprintMetrics>> query_fingerprints{};
+
+  // Vertices whose locks were waited for the longest
+  std::vector<utils::LockContentionTable::Entry> hot_vertex_locks{};
 };
 
 template <typename TSessionContext>
@@ -58,7 +75,7 @@ class MetricsService {
   }
 
  private:
-  const storage::Storage *db_;
+  storage::Storage *db_;
 
   MetricsResponse GetMetrics() {
     auto info = db_->GetInfo();
@@ -68,9 +85,15 @@ class MetricsService {
                            .average_degree = info.average_degree,
                            .memory_usage = info.memory_usage,
                            .disk_usage = info.disk_usage,
+                           .uncollected_transactions = info.uncollected_transactions,
+                           .oldest_active_transaction_age_ms = info.oldest_active_transaction_age_ms,
+                           .index_entries = std::move(info.index_entries),
                            .event_counters = GetEventCounters(),
                            .event_gauges = GetEventGauges(),
-                           .event_histograms = GetEventHistograms()};
+                           .event_histograms = GetEventHistograms(),
+                           .replicas = db_->ReplicasMetrics(),
+                           .query_fingerprints = metrics::global_query_fingerprints.Tracked(),
+                           .hot_vertex_locks = storage::vertex_lock_contention.Entries()};
   }
 
   nlohmann::json AsJson(MetricsResponse response) {
@@ -82,6 +105,13 @@ class MetricsService {
     metrics_response[general_type]["average_degree"] = response.average_degree;
     metrics_response[general_type]["memory_usage"] = response.memory_usage;
     metrics_response[general_type]["disk_usage"] = response.disk_usage;
+    metrics_response[general_type]["uncollected_transactions"] = response.uncollected_transactions;
+    metrics_response[general_type]["oldest_active_transaction_age_ms"] = response.oldest_active_transaction_age_ms;
+
+    const auto *index_entries_type = "IndexEntries";
+    for (const auto &[index, entries] : response.index_entries) {
+      metrics_response[index_entries_type][index] = entries;
+    }
 
     for (const auto &[name, type, value] : response.event_counters) {
       metrics_response[type][name] = value;
@@ -95,6 +125,41 @@ class MetricsService {
       metrics_response[type][name] = value;
     }
 
+    const auto *replication_type = "Replication";
+    for (const auto &replica : response.replicas) {
+      auto &replica_response = metrics_response[replication_type][replica.name];
+      replica_response["commit_timestamp_lag"] = replica.commit_timestamp_lag;
+      replica_response["sent_bytes"] = replica.sent_bytes;
+      replica_response["sent_bytes_per_second"] = replica.sent_bytes_per_second;
+      replica_response["in_flight_transactions"] = replica.in_flight_transactions;
+      for (const auto &[percentile, value] : replica.append_latency_percentiles) {
+        replica_response["append_latency_us_" + std::to_string(percentile) + "p"] = value;
+      }
+      replica_response["recovery_steps_done"] = replica.recovery_steps_done;
+      replica_response["recovery_steps_total"] = replica.recovery_steps_total;
+    }
+
+    const auto *query_fingerprint_type = "QueryFingerprint";
+    for (const auto &fingerprint : response.query_fingerprints) {
+      auto &fingerprint_response = metrics_response[query_fingerprint_type][std::to_string(fingerprint->hash)];
+      fingerprint_response["executions"] = fingerprint->executions.load(std::memory_order_acquire);
+      fingerprint_response["rows"] = fingerprint->rows.load(std::memory_order_acquire);
+      fingerprint_response["plan_cache_hits"] = fingerprint->plan_cache_hits.load(std::memory_order_acquire);
+      fingerprint_response["plan_cache_misses"] = fingerprint->plan_cache_misses.load(std::memory_order_acquire);
+      fingerprint_response["serialization_conflicts"] =
+          fingerprint->serialization_conflicts.load(std::memory_order_acquire);
+      for (const auto &[percentile, value] : fingerprint->latency_us.YieldPercentiles()) {
+        fingerprint_response["latency_us_" + std::to_string(percentile) + "p"] = value;
+      }
+    }
+
+    const auto *hot_vertex_locks_type = "HotVertexLocks";
+    for (const auto &[gid, waits, wait_ns] : response.hot_vertex_locks) {
+      auto &lock_response = metrics_response[hot_vertex_locks_type][std::to_string(gid)];
+      lock_response["waits"] = waits;
+      lock_response["wait_ns"] = wait_ns;
+    }
+
     return metrics_response;
   }
 
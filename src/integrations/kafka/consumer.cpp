@@ -13,8 +13,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 #include <librdkafka/rdkafkacpp.h>
@@ -104,6 +108,43 @@ void TryToConsumeBatch(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &inf
     throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
   }
 }
+// Commits the offsets following the messages of the batch, unlike TryToConsumeBatch, which commits the position of the
+// consumer, because the consumer might have already polled the next batches.
+void CommitBatchOffsets(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info, const std::vector<Message> &batch) {
+  std::map<std::pair<std::string_view, int32_t>, int64_t> offsets;
+  for (const auto &message : batch) {
+    auto &offset = offsets[{message.TopicName(), message.Partition()}];
+    offset = std::max(offset, message.Offset() + 1);
+  }
+  std::vector<RdKafka::TopicPartition *> partitions;
+  utils::OnScopeExit clear_partitions([&]() { RdKafka::TopicPartition::destroy(partitions); });
+  partitions.reserve(offsets.size());
+  for (const auto &[topic_partition, offset] : offsets) {
+    partitions.push_back(
+        RdKafka::TopicPartition::create(std::string{topic_partition.first}, topic_partition.second, offset));
+  }
+  if (const auto err = consumer.commitSync(partitions); err != RdKafka::ERR_NO_ERROR) {
+    throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
+  }
+}
+
+// Makes the consumer continue from the committed offsets, so the polled batches which weren't processed are polled
+// again.
+void RewindToCommittedOffsets(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info) {
+  std::vector<RdKafka::TopicPartition *> partitions;
+  utils::OnScopeExit clear_partitions([&]() { RdKafka::TopicPartition::destroy(partitions); });
+  if (const auto err = consumer.assignment(partitions); err != RdKafka::ERR_NO_ERROR) {
+    spdlog::warn("Couldn't get the assignment of consumer {}: {}", info.consumer_name, RdKafka::err2str(err));
+    return;
+  }
+  for (auto *partition : partitions) {
+    partition->set_offset(RdKafka::Topic::OFFSET_INVALID);
+  }
+  if (const auto err = consumer.assign(partitions); err != RdKafka::ERR_NO_ERROR) {
+    spdlog::warn("Couldn't rewind consumer {} to the committed offsets: {}", info.consumer_name,
+                 RdKafka::err2str(err));
+  }
+}
 }  // namespace
 
 Message::Message(std::unique_ptr<RdKafka::Message> &&message) : message_{std::move(message)} {
@@ -138,6 +179,8 @@ int64_t Message::Offset() const {
   return c_message->offset;
 }
 
+int32_t Message::Partition() const { return message_->partition(); }
+
 Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
     : info_{std::move(info)}, consumer_function_(std::move(consumer_function)), cb_(info_.consumer_name) {
   MG_ASSERT(consumer_function_, "Empty consumer function for Kafka consumer");
@@ -148,6 +191,9 @@ Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
   if (info_.batch_size < kMinimumSize) {
     throw ConsumerFailedToInitializeException(info_.consumer_name, "Batch size has to be positive!");
   }
+  if (info_.max_in_flight_batches < 1) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name, "Number of in-flight batches has to be positive!");
+  }
 
   std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
   if (conf == nullptr) {
@@ -393,6 +439,12 @@ void Consumer::StartConsuming() {
 
     utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
 
+    if (info_.max_in_flight_batches > 1) {
+      ConsumePipelined();
+      is_running_.store(false);
+      return;
+    }
+
     while (is_running_) {
       auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
       if (maybe_batch.HasError()) {
@@ -418,6 +470,92 @@ void Consumer::StartConsuming() {
   });
 }
 
+void Consumer::ConsumePipelined() {
+  std::mutex mutex;
+  std::condition_variable cv;
+  // The batches which are polled, but not processed yet, including the one being processed.
+  std::deque<std::vector<Message>> batches;
+  bool polling_done{false};
+  bool failed{false};
+
+  // Processes the batches in the order they were polled, so the offsets are committed in order too.
+  std::thread processor([&] {
+    static constexpr auto kMaxThreadNameSize = utils::GetMaxThreadNameSize();
+    const auto full_thread_name = "Proc#" + info_.consumer_name;
+    utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
+
+    while (true) {
+      const std::vector<Message> *batch{nullptr};
+      {
+        std::unique_lock lock(mutex);
+        cv.wait(lock, [&] { return !batches.empty() || polling_done; });
+        if (batches.empty()) return;
+        batch = &batches.front();
+      }
+
+      spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
+      try {
+        consumer_function_(*batch);
+        CommitBatchOffsets(*consumer_, info_, *batch);
+      } catch (const std::exception &e) {
+        spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
+        {
+          std::lock_guard lock(mutex);
+          failed = true;
+          batches.clear();
+        }
+        is_running_.store(false);
+        cv.notify_all();
+        return;
+      }
+      spdlog::info("Kafka consumer {} finished processing", info_.consumer_name);
+
+      {
+        std::lock_guard lock(mutex);
+        batches.pop_front();
+      }
+      cv.notify_all();
+    }
+  });
+
+  while (is_running_) {
+    {
+      std::unique_lock lock(mutex);
+      cv.wait(lock, [&] { return static_cast<int64_t>(batches.size()) < info_.max_in_flight_batches || failed; });
+      if (failed) break;
+    }
+
+    auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
+    if (maybe_batch.HasError()) {
+      spdlog::warn("Consumer {} couldn't read messages: {}", info_.consumer_name, maybe_batch.GetError());
+      break;
+    }
+    if (maybe_batch.GetValue().empty()) {
+      continue;
+    }
+
+    {
+      std::lock_guard lock(mutex);
+      if (failed) break;
+      batches.push_back(std::move(maybe_batch.GetValue()));
+    }
+    cv.notify_all();
+  }
+
+  // The already polled batches are processed before stopping, otherwise they would be skipped when the consumer is
+  // started again.
+  {
+    std::lock_guard lock(mutex);
+    polling_done = true;
+  }
+  cv.notify_all();
+  processor.join();
+
+  if (failed) {
+    RewindToCommittedOffsets(*consumer_, info_);
+  }
+}
+
 void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const {
   MG_ASSERT(!is_running_, "Cannot start already running consumer!");
 
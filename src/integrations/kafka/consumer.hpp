@@ -72,6 +72,9 @@ class Message final {
   /// Returns the offset of the message
   int64_t Offset() const;
 
+  /// Returns the partition of the topic the message belongs to.
+  int32_t Partition() const;
+
  private:
   std::unique_ptr<RdKafka::Message> message_;
 };
@@ -88,6 +91,10 @@ struct ConsumerInfo {
   int64_t batch_size;
   std::unordered_map<std::string, std::string> public_configs{};
   std::unordered_map<std::string, std::string> private_configs{};
+  // With more than one in-flight batch the next batches are polled while the
+  // current one is processed, and the offsets of the batches are committed in
+  // order after they are processed.
+  int64_t max_in_flight_batches{1};
 };
 
 /// Memgraphs Kafka consumer wrapper.
@@ -165,6 +172,7 @@ class Consumer final : public RdKafka::EventCb {
   void event_cb(RdKafka::Event &event) override;
 
   void StartConsuming();
+  void ConsumePipelined();
   void StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const;
 
   void StopConsuming();
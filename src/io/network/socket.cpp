@@ -13,6 +13,11 @@
 #include <fcntl.h>
 #include <netinet/tcp.h>
 #include <poll.h>
+#include <sys/sendfile.h>
+
+#include <algorithm>
+#include <climits>
+#include <vector>
 
 #include "io/network/addrinfo.hpp"
 #include "io/network/socket.hpp"
@@ -220,6 +225,60 @@ bool Socket::Write(const std::string &s, bool have_more) {
   return Write(reinterpret_cast<const uint8_t *>(s.data()), s.size(), have_more);
 }
 
+bool Socket::Write(std::span<const iovec> parts, bool have_more) {
+  constexpr unsigned msg_nosignal = MSG_NOSIGNAL;
+  constexpr unsigned msg_more = MSG_MORE;
+  const unsigned flags = msg_nosignal | (have_more ? msg_more : 0);
+  // The parts are advanced past the written data after partial writes.
+  std::vector<iovec> remaining(parts.begin(), parts.end());
+  auto *current = remaining.data();
+  auto *end = remaining.data() + remaining.size();
+  while (true) {
+    while (current != end && current->iov_len == 0) ++current;
+    if (current == end) return true;
+    msghdr message{};
+    message.msg_iov = current;
+    message.msg_iovlen = std::min<size_t>(end - current, IOV_MAX);
+    auto written = sendmsg(socket_, &message, static_cast<int>(flags));
+    if (written == -1) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        return false;
+      }
+      if (!WaitForReadyWrite()) return false;
+    } else if (written == 0) {
+      return false;
+    } else {
+      auto left = static_cast<size_t>(written);
+      while (left >= current->iov_len) {
+        left -= current->iov_len;
+        ++current;
+        if (current == end) return true;
+      }
+      current->iov_base = static_cast<uint8_t *>(current->iov_base) + left;
+      current->iov_len -= left;
+    }
+  }
+}
+
+bool Socket::SendFile(int fd, uint64_t offset, size_t size) {
+  auto file_offset = static_cast<off_t>(offset);
+  while (size > 0) {
+    auto written = sendfile(socket_, fd, &file_offset, size);
+    if (written == -1) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        return false;
+      }
+      if (!WaitForReadyWrite()) return false;
+    } else if (written == 0) {
+      // The file is shorter than expected.
+      return false;
+    } else {
+      size -= written;
+    }
+  }
+  return true;
+}
+
 ssize_t Socket::Read(void *buffer, size_t len, bool nonblock) {
   return recv(socket_, buffer, len, nonblock ? MSG_DONTWAIT : 0);
 }
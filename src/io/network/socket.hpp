@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include <functional>
 #include <iostream>
 #include <optional>
+#include <span>
 
 #include "io/network/endpoint.hpp"
 
@@ -151,6 +154,20 @@ class Socket {
   bool Write(const uint8_t *data, size_t len, bool have_more = false);
   bool Write(const std::string &s, bool have_more = false);
 
+  /**
+   * Write the parts to the socket in order with as few system calls as
+   * possible, the data isn't copied into an intermediate buffer. This
+   * function guarantees that all data will be written.
+   */
+  bool Write(std::span<const iovec> parts, bool have_more = false);
+
+  /**
+   * Write `size` bytes of the file `fd` starting at `offset` to the socket
+   * with `sendfile`, so the data doesn't pass through user space. This
+   * function guarantees that all data will be written.
+   */
+  bool SendFile(int fd, uint64_t offset, size_t size);
+
   /**
    * Read data from the socket.
    * This function is a direct wrapper for the read function.
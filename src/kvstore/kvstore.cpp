@@ -17,6 +17,21 @@
 
 namespace memgraph::kvstore {
 
+namespace {
+
+// Returns the smallest key greater than all keys with the given prefix, or
+// std::nullopt if there is no such key.
+std::optional<std::string> PrefixUpperBound(std::string prefix) {
+  while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == 0xff) {
+    prefix.pop_back();
+  }
+  if (prefix.empty()) return std::nullopt;
+  prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+  return prefix;
+}
+
+}  // namespace
+
 struct KVStore::impl {
   std::filesystem::path storage;
   std::unique_ptr<rocksdb::DB> db;
@@ -72,6 +87,22 @@ std::optional<std::string> KVStore::Get(const std::string &key) const noexcept {
   return value;
 }
 
+std::vector<std::optional<std::string>> KVStore::GetMultiple(const std::vector<std::string> &keys) const {
+  std::vector<rocksdb::Slice> key_slices(keys.begin(), keys.end());
+  std::vector<std::string> values;
+  const auto statuses = pimpl_->db->MultiGet(rocksdb::ReadOptions(), key_slices, &values);
+  std::vector<std::optional<std::string>> result;
+  result.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (statuses[i].ok()) {
+      result.emplace_back(std::move(values[i]));
+    } else {
+      result.emplace_back(std::nullopt);
+    }
+  }
+  return result;
+}
+
 bool KVStore::Delete(std::string_view key) {
   auto s = pimpl_->db->Delete(rocksdb::WriteOptions(), key);
   return s.ok();
@@ -87,12 +118,12 @@ bool KVStore::DeleteMultiple(const std::vector<std::string> &keys) {
 }
 
 bool KVStore::DeletePrefix(const std::string &prefix) {
-  std::unique_ptr<rocksdb::Iterator> iter =
-      std::unique_ptr<rocksdb::Iterator>(pimpl_->db->NewIterator(rocksdb::ReadOptions()));
-  for (iter->Seek(prefix); iter->Valid() && iter->key().starts_with(prefix); iter->Next()) {
-    if (!pimpl_->db->Delete(rocksdb::WriteOptions(), iter->key()).ok()) return false;
+  rocksdb::WriteBatch batch;
+  for (auto it = begin(prefix); it != end(prefix); ++it) {
+    batch.Delete(it->first);
   }
-  return true;
+  auto s = pimpl_->db->Write(rocksdb::WriteOptions(), &batch);
+  return s.ok();
 }
 
 bool KVStore::PutAndDeleteMultiple(const std::map<std::string, std::string> &items,
@@ -113,6 +144,9 @@ bool KVStore::PutAndDeleteMultiple(const std::map<std::string, std::string> &ite
 struct KVStore::iterator::impl {
   const KVStore *kvstore;
   std::string prefix;
+  // Referenced by the read options of `it`.
+  std::optional<std::string> upper_bound;
+  std::optional<rocksdb::Slice> upper_bound_slice;
   std::unique_ptr<rocksdb::Iterator> it;
   std::pair<std::string, std::string> disk_prop;
 };
@@ -121,9 +155,18 @@ KVStore::iterator::iterator(const KVStore *kvstore, const std::string &prefix, b
     : pimpl_(std::make_unique<impl>()) {
   pimpl_->kvstore = kvstore;
   pimpl_->prefix = prefix;
-  pimpl_->it = std::unique_ptr<rocksdb::Iterator>(pimpl_->kvstore->pimpl_->db->NewIterator(rocksdb::ReadOptions()));
+  if (at_end) return;
+  rocksdb::ReadOptions options;
+  // The keys past the prefix, and the tombstones between them, are skipped
+  // without being read.
+  pimpl_->upper_bound = PrefixUpperBound(prefix);
+  if (pimpl_->upper_bound) {
+    pimpl_->upper_bound_slice.emplace(*pimpl_->upper_bound);
+    options.iterate_upper_bound = &*pimpl_->upper_bound_slice;
+  }
+  pimpl_->it = std::unique_ptr<rocksdb::Iterator>(pimpl_->kvstore->pimpl_->db->NewIterator(options));
   pimpl_->it->Seek(pimpl_->prefix);
-  if (!pimpl_->it->Valid() || !pimpl_->it->key().starts_with(pimpl_->prefix) || at_end) pimpl_->it = nullptr;
+  if (!pimpl_->it->Valid() || !pimpl_->it->key().starts_with(pimpl_->prefix)) pimpl_->it = nullptr;
 }
 
 KVStore::iterator::iterator(KVStore::iterator &&other) { pimpl_ = std::move(other.pimpl_); }
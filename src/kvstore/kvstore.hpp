@@ -82,6 +82,16 @@ class KVStore final {
    */
   std::optional<std::string> Get(const std::string &key) const noexcept;
 
+  /**
+   * Retrieve values for the given keys with a single lookup.
+   *
+   * @param keys
+   *
+   * @return Values for the given keys, in the same order. std::nullopt for
+   *         the keys which don't exist or couldn't be read.
+   */
+  std::vector<std::optional<std::string>> GetMultiple(const std::vector<std::string> &keys) const;
+
   /**
    * Deletes the key and corresponding value from storage.
    *
@@ -105,7 +115,8 @@ class KVStore final {
   bool DeleteMultiple(const std::vector<std::string> &keys);
 
   /**
-   * Delete all (key, value) pairs where key begins with a given prefix.
+   * Atomically delete all (key, value) pairs where key begins with a given
+   * prefix.
    *
    * @param prefix - prefix of the keys in (key, value) pairs to be deleted.
    *                 This parameter is optional and is empty by default.
@@ -157,7 +168,9 @@ class KVStore final {
    *
    * It filters all (key, value) pairs where the key has a certain prefix
    * and behaves as if all of those pairs are stored in a single iterable
-   * collection of std::pair<std::string, std::string>.
+   * collection of std::pair<std::string, std::string>. The pairs are read
+   * from a consistent snapshot taken when the iterator is created, and the
+   * underlying iterator is bounded to the prefix.
    */
   class iterator final : public std::iterator<std::input_iterator_tag,                      // iterator_category
                                               std::pair<std::string, std::string>,          // value_type
@@ -25,12 +25,17 @@
 #include "helpers.hpp"
 #include "license/license_sender.hpp"
 #include "query/discard_value_stream.hpp"
+#include "query/plan/cost_params.hpp"
 #include "query/procedure/callable_alias_mapper.hpp"
 #include "query/procedure/module.hpp"
 #include "query/procedure/py_module.hpp"
+#include "query/procedure/result_cache.hpp"
+#include "query/query_result_cache.hpp"
 #include "requests/requests.hpp"
 #include "telemetry/telemetry.hpp"
+#include "utils/query_fingerprint_metrics.hpp"
 #include "utils/signals.hpp"
+#include "utils/string.hpp"
 #include "utils/sysinfo/memory.hpp"
 #include "utils/system_info.hpp"
 #include "utils/terminate_handler.hpp"
@@ -233,7 +238,7 @@ int main(int argc, char **argv) {
 #ifdef MG_ENTERPRISE
   // Audit log
   memgraph::audit::Log audit_log{data_directory / "audit", FLAGS_audit_buffer_size,
-                                 FLAGS_audit_buffer_flush_interval_ms};
+                                 FLAGS_audit_buffer_flush_interval_ms, FLAGS_audit_buffer_drop_when_full};
   // Start the log if enabled.
   if (FLAGS_audit_enabled) {
     audit_log.Start();
@@ -250,18 +255,33 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .thread_count = FLAGS_storage_gc_thread_count,
+             .time_slice = std::chrono::milliseconds(FLAGS_storage_gc_time_slice_ms),
+             .compact_delta_chains = FLAGS_storage_gc_compact_delta_chains},
       .items = {.properties_on_edges = FLAGS_storage_properties_on_edges},
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_storage_recover_on_startup || FLAGS_data_recovery_on_startup,
+                     .recover_to_timestamp = FLAGS_storage_recover_to_timestamp != 0
+                                                 ? std::make_optional(FLAGS_storage_recover_to_timestamp)
+                                                 : std::nullopt,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_max_increments = FLAGS_storage_snapshot_max_increments,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
+                     .wal_preallocated_files = FLAGS_storage_wal_preallocated_files,
+                     .wal_direct_io = FLAGS_storage_wal_direct_io,
+                     .compression = FLAGS_storage_durability_compression,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
+                     .replication_sync_quorum = FLAGS_replication_sync_quorum,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
-                     .allow_parallel_index_creation = FLAGS_storage_parallel_index_recovery},
+                     .snapshot_thread_count = FLAGS_storage_snapshot_thread_count,
+                     .snapshot_write_mebibytes_per_sec = FLAGS_storage_snapshot_write_mib_per_sec,
+                     .allow_parallel_index_creation = FLAGS_storage_parallel_index_recovery,
+                     .background_index_recovery = FLAGS_storage_background_index_recovery},
       .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel()},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
                .label_index_directory = FLAGS_data_directory + "/rocksdb_label_index",
@@ -270,7 +290,22 @@ int main(int argc, char **argv) {
                .name_id_mapper_directory = FLAGS_data_directory + "/rocksdb_name_id_mapper",
                .id_name_mapper_directory = FLAGS_data_directory + "/rocksdb_id_name_mapper",
                .durability_directory = FLAGS_data_directory + "/rocksdb_durability",
-               .wal_directory = FLAGS_data_directory + "/rocksdb_wal"}};
+               .wal_directory = FLAGS_data_directory + "/rocksdb_wal",
+               .vertex_cache_mib = FLAGS_storage_disk_vertex_cache_mib,
+               .workload_profile = memgraph::flags::ParseDiskWorkloadProfile(),
+               .block_cache_bytes = memory_limit / 100 * FLAGS_storage_disk_block_cache_percent,
+               .sst_ingestion_min_objects = FLAGS_storage_disk_sst_ingestion_min_objects,
+               .reference_indices = FLAGS_storage_disk_reference_indices,
+               .write_stall_timeout = std::chrono::milliseconds(FLAGS_storage_disk_write_stall_timeout_ms)}};
+  for (const auto &property : memgraph::utils::Split(FLAGS_storage_dictionary_encoded_properties, ",")) {
+    const auto trimmed = memgraph::utils::Trim(property);
+    if (!trimmed.empty()) db_config.dictionary_encoded_properties.emplace_back(trimmed);
+  }
+  for (const auto &edge_type : memgraph::utils::Split(FLAGS_storage_properties_on_edge_types, ",")) {
+    const auto trimmed = memgraph::utils::Trim(edge_type);
+    if (!trimmed.empty()) db_config.properties_on_edge_types.emplace_back(trimmed);
+  }
+  db_config.packed_index_merge_threshold = FLAGS_storage_packed_index_merge_threshold;
   if (FLAGS_storage_snapshot_interval_sec == 0) {
     if (FLAGS_storage_wal_enabled) {
       LOG_FATAL(
@@ -292,12 +327,26 @@ int main(int argc, char **argv) {
 
   // Default interpreter configuration
   memgraph::query::InterpreterConfig interp_config{
-      .query = {.allow_load_csv = FLAGS_allow_load_csv},
+      .query = {.allow_load_csv = FLAGS_allow_load_csv,
+                .pull_batch_size = FLAGS_query_pull_batch_size,
+                .prefetch_rows = FLAGS_query_prefetch_rows,
+                .parallel_execution_threads = FLAGS_query_parallel_execution_threads,
+                .spill_threshold_bytes = FLAGS_query_spill_threshold_mb * 1024 * 1024,
+                .memory_limit_per_database_bytes = FLAGS_query_memory_limit_per_database_mb * 1024 * 1024,
+                .memory_limit_per_user_bytes = FLAGS_query_memory_limit_per_user_mb * 1024 * 1024,
+                .slow_query_threshold_ms = FLAGS_query_slow_log_threshold_ms,
+                .slow_query_sample_rate = FLAGS_query_slow_log_sample_rate,
+                .slow_query_log_size = FLAGS_query_slow_log_size},
       .replication_replica_check_frequency = std::chrono::seconds(FLAGS_replication_replica_check_frequency_sec),
+      .bookmark_wait_timeout = std::chrono::milliseconds(FLAGS_replication_bookmark_wait_timeout_ms),
       .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
       .default_pulsar_service_url = FLAGS_pulsar_service_url,
       .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)};
+      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+      .kafka_stream_max_in_flight_batches = FLAGS_kafka_stream_max_in_flight_batches,
+      .after_commit_trigger_threads = FLAGS_after_commit_trigger_threads,
+      .after_commit_trigger_batch_size = FLAGS_after_commit_trigger_batch_size,
+      .after_commit_trigger_queue_size = FLAGS_after_commit_trigger_queue_size};
 
   auto auth_glue =
       [flag = FLAGS_auth_user_or_role_name_regex](
@@ -324,7 +373,8 @@ int main(int argc, char **argv) {
   // SessionContext handler (multi-tenancy)
   memgraph::dbms::SessionContextHandler sc_handler(audit_log, {db_config, interp_config, auth_glue},
                                                    FLAGS_storage_recover_on_startup || FLAGS_data_recovery_on_startup,
-                                                   FLAGS_storage_delete_on_drop);
+                                                   FLAGS_storage_delete_on_drop, FLAGS_storage_lazy_database_loading,
+                                                   std::chrono::seconds(FLAGS_storage_unload_idle_databases_sec));
   // Just for current support... TODO remove
   auto session_context = sc_handler.Get(memgraph::dbms::kDefaultDB);
 #else
@@ -343,8 +393,12 @@ int main(int argc, char **argv) {
 
   memgraph::query::procedure::gModuleRegistry.SetModulesDirectory(memgraph::flags::ParseQueryModulesDirectory(),
                                                                   FLAGS_data_directory);
+  memgraph::query::procedure::gModuleRegistry.SetLazyLoading(FLAGS_query_modules_lazy_loading);
   memgraph::query::procedure::gModuleRegistry.UnloadAndLoadModulesFromDirectories();
   memgraph::query::procedure::gCallableAliasMapper.LoadMapping(FLAGS_query_callable_mappings_path);
+  memgraph::query::procedure::gResultCache.SetCapacity(FLAGS_query_procedure_cache_mb * 1024 * 1024);
+  memgraph::query::gQueryResultCache.SetCapacity(FLAGS_query_result_cache_mb * 1024 * 1024);
+  memgraph::query::plan::LoadCostParams(FLAGS_query_cost_model_path);
 
   if (!FLAGS_init_file.empty()) {
     spdlog::info("Running init file...");
@@ -388,12 +442,19 @@ int main(int argc, char **argv) {
   }
   auto server_endpoint = memgraph::communication::v2::ServerEndpoint{
       boost::asio::ip::address::from_string(FLAGS_bolt_address), static_cast<uint16_t>(FLAGS_bolt_port)};
+  const memgraph::communication::v2::ExecutionPool::Limits bolt_limits{
+      .max_running_per_client = static_cast<size_t>(FLAGS_bolt_max_executing_per_client),
+      .max_queued_per_client = static_cast<size_t>(FLAGS_bolt_max_queued_per_client)};
 #ifdef MG_ENTERPRISE
   memgraph::glue::ServerT server(server_endpoint, &sc_handler, &context, FLAGS_bolt_session_inactivity_timeout,
-                                 service_name, FLAGS_bolt_num_workers);
+                                 service_name, FLAGS_bolt_num_workers, FLAGS_bolt_num_io_workers,
+                                 std::chrono::milliseconds(FLAGS_bolt_long_execution_ms),
+                                 FLAGS_bolt_io_context_per_worker, bolt_limits, FLAGS_bolt_numa_aware_workers);
 #else
   memgraph::glue::ServerT server(server_endpoint, &session_context, &context, FLAGS_bolt_session_inactivity_timeout,
-                                 service_name, FLAGS_bolt_num_workers);
+                                 service_name, FLAGS_bolt_num_workers, FLAGS_bolt_num_io_workers,
+                                 std::chrono::milliseconds(FLAGS_bolt_long_execution_ms),
+                                 FLAGS_bolt_io_context_per_worker, bolt_limits, FLAGS_bolt_numa_aware_workers);
 #endif
 
   const auto machine_id = memgraph::utils::GetMachineId();
@@ -435,6 +496,7 @@ int main(int argc, char **argv) {
       {FLAGS_monitoring_address, static_cast<uint16_t>(FLAGS_monitoring_port)}, &context, websocket_auth};
   memgraph::flags::AddLoggerSink(websocket_server.GetLoggingSink());
 
+  memgraph::metrics::global_query_fingerprints.SetCapacity(FLAGS_metrics_query_fingerprints);
   memgraph::glue::MonitoringServerT metrics_server{
       {FLAGS_metrics_address, static_cast<uint16_t>(FLAGS_metrics_port)}, &session_context, &context};
 
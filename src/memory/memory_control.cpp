@@ -11,10 +11,15 @@
 
 #include "memory_control.hpp"
 
+#include <mutex>
+#include <vector>
+
 #if USE_JEMALLOC
 #include <jemalloc/jemalloc.h>
 #endif
 
+#include "utils/logging.hpp"
+
 namespace memgraph::memory {
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -28,6 +33,30 @@ void PurgeUnusedMemory() {
 #endif
 }
 
+void UseNumaNodeArena([[maybe_unused]] size_t node) {
+#if USE_JEMALLOC
+  static std::mutex mutex;
+  static std::vector<unsigned> arenas;
+  unsigned arena = 0;
+  {
+    std::lock_guard guard(mutex);
+    while (arenas.size() <= node) {
+      unsigned new_arena = 0;
+      size_t size = sizeof(new_arena);
+      if (mallctl("arenas.create", &new_arena, &size, nullptr, 0) != 0) {
+        spdlog::warn("Couldn't create the memory arena of the NUMA node {}!", node);
+        return;
+      }
+      arenas.push_back(new_arena);
+    }
+    arena = arenas[node];
+  }
+  if (mallctl("thread.arena", nullptr, nullptr, &arena, sizeof(arena)) != 0) {
+    spdlog::warn("Couldn't use the memory arena of the NUMA node {}!", node);
+  }
+#endif
+}
+
 #undef STRINGIFY
 #undef STRINGIFY_HELPER
 }  // namespace memgraph::memory
@@ -11,6 +11,14 @@
 
 #pragma once
 
+#include <cstddef>
+
 namespace memgraph::memory {
 void PurgeUnusedMemory();
+
+/// Makes the calling thread allocate from the jemalloc arena of the given NUMA
+/// node. Pages are placed on the node of the thread which first touches them,
+/// so the threads pinned to a node keep allocating local memory instead of
+/// reusing the pages freed by the threads of other nodes.
+void UseNumaNodeArena(size_t node);
 }  // namespace memgraph::memory
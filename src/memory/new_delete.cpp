@@ -86,13 +86,29 @@ void deleteSized(void *ptr, const std::size_t /*unused*/) noexcept { free(ptr);
 void deleteSized(void *ptr, const std::size_t /*unused*/, const std::align_val_t /*unused*/) noexcept { free(ptr); }
 #endif
 
+// Charges the allocation to the global tracker and to the tracker of the thread.
+void TrackAmount(const int64_t size) {
+  memgraph::utils::TrackTotalAlloc(size);
+  try {
+    memgraph::utils::MemoryTracker::ThreadAlloc(size);
+  } catch (...) {
+    memgraph::utils::TrackTotalFree(size);
+    throw;
+  }
+}
+
+void UntrackAmount(const int64_t size) {
+  memgraph::utils::TrackTotalFree(size);
+  memgraph::utils::MemoryTracker::ThreadFree(size);
+}
+
 void TrackMemory(std::size_t size) {
 #if USE_JEMALLOC
   if (size != 0) [[likely]] {
     size = nallocx(size, 0);
   }
 #endif
-  memgraph::utils::total_memory_tracker.Alloc(static_cast<int64_t>(size));
+  TrackAmount(static_cast<int64_t>(size));
 }
 
 void TrackMemory(std::size_t size, const std::align_val_t align) {
@@ -101,7 +117,7 @@ void TrackMemory(std::size_t size, const std::align_val_t align) {
     size = nallocx(size, MALLOCX_ALIGN(align));  // NOLINT(hicpp-signed-bitwise)
   }
 #endif
-  memgraph::utils::total_memory_tracker.Alloc(static_cast<int64_t>(size));
+  TrackAmount(static_cast<int64_t>(size));
 }
 
 bool TrackMemoryNoExcept(const std::size_t size) {
@@ -128,14 +144,14 @@ void UntrackMemory([[maybe_unused]] void *ptr, [[maybe_unused]] std::size_t size
   try {
 #if USE_JEMALLOC
     if (ptr != nullptr) [[likely]] {
-      memgraph::utils::total_memory_tracker.Free(sallocx(ptr, 0));
+      UntrackAmount(static_cast<int64_t>(sallocx(ptr, 0)));
     }
 #else
     if (size) {
-      memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(size));
+      UntrackAmount(static_cast<int64_t>(size));
     } else {
       // Innaccurate because malloc_usable_size() result is greater or equal to allocated size.
-      memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(malloc_usable_size(ptr)));
+      UntrackAmount(static_cast<int64_t>(malloc_usable_size(ptr)));
     }
 #endif
   } catch (...) {
@@ -146,14 +162,14 @@ void UntrackMemory(void *ptr, const std::align_val_t align, [[maybe_unused]] std
   try {
 #if USE_JEMALLOC
     if (ptr != nullptr) [[likely]] {
-      memgraph::utils::total_memory_tracker.Free(sallocx(ptr, MALLOCX_ALIGN(align)));  // NOLINT(hicpp-signed-bitwise)
+      UntrackAmount(static_cast<int64_t>(sallocx(ptr, MALLOCX_ALIGN(align))));  // NOLINT(hicpp-signed-bitwise)
     }
 #else
     if (size) {
-      memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(size));
+      UntrackAmount(static_cast<int64_t>(size));
     } else {
       // Innaccurate because malloc_usable_size() result is greater or equal to allocated size.
-      memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(malloc_usable_size(ptr)));
+      UntrackAmount(static_cast<int64_t>(malloc_usable_size(ptr)));
     }
 #endif
   } catch (...) {
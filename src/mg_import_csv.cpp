@@ -12,12 +12,20 @@
 #include <gflags/gflags.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <streambuf>
+#include <string_view>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "helpers.hpp"
 #include "storage/v2/config.hpp"
@@ -58,6 +66,9 @@ bool ValidateIdTypeOptions(const char *flagname, const std::string &value) {
 // CSV file on a correctly set-up Memgraph installation.
 DEFINE_string(data_directory, "mg_data", "Path to directory in which to save all permanent data.");
 DEFINE_bool(storage_properties_on_edges, false, "Controls whether relationships have properties.");
+DEFINE_string(storage_properties_on_edge_types, "",
+              "Comma-separated list of relationship types which have properties when "
+              "--storage-properties-on-edges is off.");
 
 // CSV import flags.
 DEFINE_string(array_delimiter, ";", "Delimiter between elements of array values.");
@@ -95,6 +106,12 @@ DEFINE_string(relationships, "",
               "specified for the relationship files. The flag can be specified multiple "
               "times (useful for differently formatted relationship files). The format "
               "of this argument is: [<type>=]<file>[,<file>][,<file>]...");
+DEFINE_uint64(threads, std::max(std::thread::hardware_concurrency(), 1U),
+              "Number of threads parsing the CSV files, creating the nodes and relationships and writing the "
+              "snapshot.");
+DEFINE_uint64(chunk_size, 4UL * 1024UL * 1024UL,
+              "Approximate number of bytes of a CSV file parsed by a thread at once. Each thread keeps about this "
+              "much of the file in memory, together with the parsed rows.");
 
 std::vector<std::string> ParseRepeatedFlag(const std::string &flagname, int argc, char *argv[]) {
   std::vector<std::string> values;
@@ -158,6 +175,44 @@ struct hash<NodeId> {
 
 }  // namespace std
 
+// Maps the node IDs to the gids of their nodes. It's sharded by the hash of
+// the ID, so that the threads importing the nodes and relationships rarely
+// wait for each other.
+class NodeIdMap {
+ public:
+  NodeIdMap() : shards_(std::make_unique<Shard[]>(kShards)) {}
+
+  // Maps the ID to the gid unless it's mapped to a smaller gid, so that the
+  // node which comes first in the CSV files keeps the ID no matter which
+  // thread inserts it first.
+  void InsertFirst(const NodeId &node_id, memgraph::storage::Gid gid) {
+    auto &shard = GetShard(node_id);
+    std::lock_guard guard(shard.lock);
+    auto [it, inserted] = shard.map.emplace(node_id, gid);
+    if (!inserted && gid < it->second) it->second = gid;
+  }
+
+  std::optional<memgraph::storage::Gid> Find(const NodeId &node_id) const {
+    const auto &shard = GetShard(node_id);
+    std::lock_guard guard(shard.lock);
+    auto it = shard.map.find(node_id);
+    if (it == shard.map.end()) return std::nullopt;
+    return it->second;
+  }
+
+ private:
+  static constexpr size_t kShards = 1024;
+
+  struct alignas(64) Shard {
+    mutable std::mutex lock;
+    std::unordered_map<NodeId, memgraph::storage::Gid> map;
+  };
+
+  Shard &GetShard(const NodeId &node_id) const { return shards_[std::hash<NodeId>{}(node_id) % kShards]; }
+
+  std::unique_ptr<Shard[]> shards_;
+};
+
 // Exception used to indicate that something went wrong during data loading.
 class LoadException : public memgraph::utils::BasicException {
  public:
@@ -352,6 +407,160 @@ std::pair<std::vector<Field>, uint64_t> ReadHeader(std::istream &stream) {
   return {std::move(fields), lines_count};
 }
 
+// Part of a CSV file made of whole rows.
+struct Chunk {
+  std::string_view data;
+  // Line of the file at which the chunk starts.
+  uint64_t first_line;
+  // Number of rows in the chunk, as `ReadRow` reads them.
+  uint64_t rows;
+};
+
+// Splits the data into chunks of whole rows, each at least `chunk_size` bytes
+// long except the last one. A row ends with a line feed which isn't in a
+// quoted field, the quoting rules are the same as in `ReadRow`. If `at_end`
+// is false, the data after the last complete row is left out of the chunks.
+// Returns the chunks and the number of bytes they cover.
+std::pair<std::vector<Chunk>, size_t> SplitIntoChunks(std::string_view data, uint64_t first_line, bool at_end,
+                                                      size_t chunk_size) {
+  std::vector<Chunk> chunks;
+  size_t chunk_start = 0;
+  uint64_t chunk_lines = 0;
+  uint64_t chunk_rows = 0;
+  size_t row_end = 0;
+  auto close_chunk = [&](size_t end) {
+    chunks.push_back({data.substr(chunk_start, end - chunk_start), first_line, chunk_rows});
+    first_line += chunk_lines;
+    chunk_start = end;
+    chunk_lines = 0;
+    chunk_rows = 0;
+  };
+
+  bool quoting = false;
+  bool field_start = true;
+  for (size_t i = 0; i < data.size(); ++i) {
+    const auto c = data[i];
+    if (c == '\n') {
+      ++chunk_lines;
+      if (quoting) continue;
+      ++chunk_rows;
+      row_end = i + 1;
+      field_start = true;
+      if (row_end - chunk_start >= chunk_size) close_chunk(row_end);
+      continue;
+    }
+    // Carriage returns are ignored in CSVs.
+    if (c == '\r') continue;
+    if (quoting) {
+      if (SubstringStartsWith(data, i, FLAGS_quote)) {
+        if (SubstringStartsWith(data, i + FLAGS_quote.size(), FLAGS_quote)) {
+          // This is an escaped quote character.
+          i += FLAGS_quote.size() * 2 - 1;
+        } else {
+          quoting = false;
+          i += FLAGS_quote.size() - 1;
+        }
+      }
+    } else if (field_start && SubstringStartsWith(data, i, FLAGS_quote)) {
+      quoting = true;
+      field_start = false;
+      i += FLAGS_quote.size() - 1;
+    } else if (SubstringStartsWith(data, i, FLAGS_delimiter)) {
+      field_start = true;
+      i += FLAGS_delimiter.size() - 1;
+    } else {
+      field_start = false;
+    }
+  }
+
+  if (at_end && row_end < data.size()) {
+    // The last row isn't followed by a line feed.
+    ++chunk_rows;
+    ++chunk_lines;
+    row_end = data.size();
+  }
+  if (row_end > chunk_start) close_chunk(row_end);
+  return {std::move(chunks), row_end};
+}
+
+// Reads the data of the CSV file from the current position of the stream in
+// blocks of a chunk for each thread, and calls `process` with the chunks of
+// each block.
+void ForEachBlock(std::istream &stream, uint64_t first_line,
+                  const std::function<void(const std::vector<Chunk> &)> &process) {
+  const size_t block_size = FLAGS_threads * FLAGS_chunk_size;
+  std::string buffer;
+  bool at_end = false;
+  while (!at_end) {
+    const auto previous_size = buffer.size();
+    buffer.resize(previous_size + block_size);
+    stream.read(buffer.data() + previous_size, static_cast<std::streamsize>(block_size));
+    buffer.resize(previous_size + stream.gcount());
+    at_end = !stream;
+
+    auto [chunks, size] = SplitIntoChunks(buffer, first_line, at_end, FLAGS_chunk_size);
+    if (chunks.empty()) continue;
+    process(chunks);
+    first_line = chunks.back().first_line + std::count(chunks.back().data.begin(), chunks.back().data.end(), '\n');
+    buffer.erase(0, size);
+  }
+}
+
+// Calls `function` with the indices from 0 to `count` - 1 on up to
+// `FLAGS_threads` threads.
+void ParallelFor(size_t count, const std::function<void(size_t)> &function) {
+  std::atomic<size_t> next{0};
+  std::vector<std::jthread> threads;
+  const auto thread_count = std::min<size_t>(FLAGS_threads, count);
+  threads.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    threads.emplace_back([&] {
+      for (auto index = next++; index < count; index = next++) function(index);
+    });
+  }
+}
+
+// Makes the data of a chunk readable as a stream without copying it.
+class ChunkStreamBuffer : public std::streambuf {
+ public:
+  explicit ChunkStreamBuffer(std::string_view data) {
+    // The buffer is only read.
+    auto *begin = const_cast<char *>(data.data());
+    setg(begin, begin, begin + data.size());
+  }
+};
+
+// The first error which happened while processing the chunks of a file, in
+// the order of the rows.
+class ChunkErrors {
+ public:
+  void Add(uint64_t row_number, const std::string &message) {
+    std::lock_guard guard(lock_);
+    if (!first_ || row_number < first_->first) first_.emplace(row_number, message);
+  }
+
+  void FatalIfAny(const std::string &path) const {
+    if (first_) LOG_FATAL("Couldn't process row {} of '{}' because of: {}", first_->first, path, first_->second);
+  }
+
+ private:
+  std::mutex lock_;
+  std::optional<std::pair<uint64_t, std::string>> first_;
+};
+
+/// @throw LoadException
+void CheckRowSize(std::vector<std::string> *row, const std::vector<Field> &header) {
+  if ((!FLAGS_ignore_extra_columns && row->size() != header.size()) ||
+      (FLAGS_ignore_extra_columns && row->size() < header.size()))
+    throw LoadException(
+        "Expected as many values as there are header fields (found {}, "
+        "expected {})",
+        row->size(), header.size());
+  if (row->size() > header.size()) {
+    row->resize(header.size());
+  }
+}
+
 /// @throw LoadException
 int64_t StringToInt(const std::string &value) {
   try {
@@ -406,7 +615,7 @@ memgraph::storage::PropertyValue StringToValue(const std::string &str, const std
 std::string GetIdSpace(const std::string &type) {
   // The format of this field is as follows:
   // [START_|END_]ID[(<id_space>)]
-  std::regex format(R"(^(START_|END_)?ID(\(([^\(\)]+)\))?$)", std::regex::extended);
+  static const std::regex format(R"(^(START_|END_)?ID(\(([^\(\)]+)\))?$)", std::regex::extended);
   std::smatch res;
   if (!std::regex_match(type, res, format))
     throw LoadException(
@@ -417,46 +626,58 @@ std::string GetIdSpace(const std::string &type) {
   return res[3];
 }
 
+// A node row parsed from a CSV file.
+struct NodeRow {
+  std::vector<std::string> values;
+  uint64_t row_number;
+  std::optional<NodeId> id;
+};
+
 /// @throw LoadException
-void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::string> &row,
-                    const std::vector<Field> &fields, const std::vector<std::string> &additional_labels,
-                    std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map) {
+std::optional<NodeId> GetNodeId(const std::vector<std::string> &row, const std::vector<Field> &fields) {
   std::optional<NodeId> id;
-  auto acc = store->Access();
-  auto node = acc->CreateVertex();
   for (size_t i = 0; i < row.size(); ++i) {
     const auto &field = fields[i];
-    const auto &value = row[i];
+    if (!memgraph::utils::StartsWith(field.type, "ID")) continue;
+    if (id) throw LoadException("Only one node ID must be specified");
+    if (FLAGS_id_type == "INTEGER") {
+      // Call `StringToInt` to verify that the ID is a valid integer.
+      StringToInt(row[i]);
+    }
+    id.emplace(NodeId{row[i], GetIdSpace(field.type)});
+  }
+  return id;
+}
+
+/// @throw LoadException
+void ProcessNodeRow(memgraph::storage::InMemoryStorage::ReplicationAccessor *acc, const NodeRow &row,
+                    memgraph::storage::Gid gid, const std::vector<Field> &fields,
+                    const std::vector<std::string> &additional_labels, const NodeIdMap &node_id_map) {
+  if (row.id && node_id_map.Find(*row.id) != gid) {
+    if (FLAGS_skip_duplicate_nodes) {
+      spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", *row.id,
+                                                    "https://memgr.ph/csv-import-tool"));
+      return;
+    } else {
+      throw LoadException("Node with ID '{}' already exists", *row.id);
+    }
+  }
+  auto node = acc->CreateVertexEx(gid);
+  for (size_t i = 0; i < row.values.size(); ++i) {
+    const auto &field = fields[i];
+    const auto &value = row.values[i];
     if (memgraph::utils::StartsWith(field.type, "ID")) {
-      if (id) throw LoadException("Only one node ID must be specified");
-      if (FLAGS_id_type == "INTEGER") {
-        // Call `StringToInt` to verify that the ID is a valid integer.
-        StringToInt(value);
-      }
-      NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map->find(node_id);
-      if (it != node_id_map->end()) {
-        if (FLAGS_skip_duplicate_nodes) {
-          spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", node_id,
-                                                        "https://memgr.ph/csv-import-tool"));
-          return;
-        } else {
-          throw LoadException("Node with ID '{}' already exists", node_id);
-        }
-      }
-      node_id_map->emplace(node_id, node.Gid());
       if (!field.name.empty()) {
         memgraph::storage::PropertyValue pv_id;
         if (FLAGS_id_type == "INTEGER") {
-          pv_id = memgraph::storage::PropertyValue(StringToInt(node_id.id));
+          pv_id = memgraph::storage::PropertyValue(StringToInt(value));
         } else {
-          pv_id = memgraph::storage::PropertyValue(node_id.id);
+          pv_id = memgraph::storage::PropertyValue(value);
         }
         auto old_node_property = node.SetProperty(acc->NameToProperty(field.name), pv_id);
         if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
         if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
       }
-      id = node_id;
     } else if (field.type == "LABEL") {
       for (const auto &label : memgraph::utils::Split(value, FLAGS_array_delimiter)) {
         auto node_label = node.AddLabel(acc->NameToLabel(label));
@@ -474,46 +695,85 @@ void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::st
     if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
     if (!*node_label) throw LoadException("The label '{}' already exists", label);
   }
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the node");
 }
 
-void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_path,
-                  std::optional<std::vector<Field>> *header,
-                  std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map,
-                  const std::vector<std::string> &additional_labels) {
+// Each node gets the gid which is its position among all node rows, so the
+// gids don't depend on the order in which the threads create the nodes. The
+// rows of each block are parsed and their IDs mapped first, so a duplicate ID
+// is always kept by its first node.
+void ProcessNodes(memgraph::storage::InMemoryStorage *store, const std::string &nodes_path,
+                  std::optional<std::vector<Field>> *header, NodeIdMap *node_id_map,
+                  const std::vector<std::string> &additional_labels, uint64_t *next_gid) {
   std::ifstream nodes_file(nodes_path);
   MG_ASSERT(nodes_file, "Unable to open '{}'", nodes_path);
   uint64_t row_number = 1;
-  try {
-    if (!*header) {
+  if (!*header) {
+    try {
       auto [fields, header_lines] = ReadHeader(nodes_file);
       row_number += header_lines;
       header->emplace(std::move(fields));
+    } catch (const LoadException &e) {
+      LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, nodes_path, e.what());
     }
-    while (true) {
-      auto [row, lines_count] = ReadRow(nodes_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessNodeRow(store, row, **header, additional_labels, node_id_map);
-      row_number += lines_count;
-    }
-  } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, nodes_path, e.what());
   }
+  const auto &fields = **header;
+  ChunkErrors errors;
+  ForEachBlock(nodes_file, row_number, [&](const std::vector<Chunk> &chunks) {
+    std::vector<uint64_t> first_gids(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      first_gids[i] = *next_gid;
+      *next_gid += chunks[i].rows;
+    }
+
+    std::vector<std::vector<NodeRow>> rows(chunks.size());
+    ParallelFor(chunks.size(), [&](size_t i) {
+      ChunkStreamBuffer buffer(chunks[i].data);
+      std::istream stream(&buffer);
+      auto row_number = chunks[i].first_line;
+      try {
+        auto gid = first_gids[i];
+        while (true) {
+          auto [values, lines_count] = ReadRow(stream);
+          if (lines_count == 0) break;
+          CheckRowSize(&values, fields);
+          auto id = GetNodeId(values, fields);
+          if (id) node_id_map->InsertFirst(*id, memgraph::storage::Gid::FromUint(gid));
+          rows[i].push_back({std::move(values), row_number, std::move(id)});
+          row_number += lines_count;
+          ++gid;
+        }
+      } catch (const LoadException &e) {
+        errors.Add(row_number, e.what());
+      }
+    });
+    errors.FatalIfAny(nodes_path);
+
+    ParallelFor(chunks.size(), [&](size_t i) {
+      // The accessor is needed for creating the nodes with the given gids.
+      auto acc = store->Access(std::nullopt);
+      memgraph::storage::InMemoryStorage::ReplicationAccessor replication_acc(
+          std::move(*static_cast<memgraph::storage::InMemoryStorage::InMemoryAccessor *>(acc.get())));
+      uint64_t row_number = chunks[i].first_line;
+      try {
+        for (size_t j = 0; j < rows[i].size(); ++j) {
+          const auto &row = rows[i][j];
+          row_number = row.row_number;
+          ProcessNodeRow(&replication_acc, row, memgraph::storage::Gid::FromUint(first_gids[i] + j), fields,
+                         additional_labels, *node_id_map);
+        }
+        if (replication_acc.Commit().HasError()) throw LoadException("Couldn't store the nodes");
+      } catch (const LoadException &e) {
+        errors.Add(row_number, e.what());
+      }
+    });
+    errors.FatalIfAny(nodes_path);
+  });
 }
 
 /// @throw LoadException
-void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vector<Field> &fields,
+void ProcessRelationshipsRow(memgraph::storage::Storage::Accessor *acc, const std::vector<Field> &fields,
                              const std::vector<std::string> &row, std::optional<std::string> relationship_type,
-                             const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
+                             const NodeIdMap &node_id_map) {
   std::optional<memgraph::storage::Gid> start_id;
   std::optional<memgraph::storage::Gid> end_id;
   std::map<std::string, memgraph::storage::PropertyValue> properties;
@@ -527,8 +787,8 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
         StringToInt(value);
       }
       NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map.find(node_id);
-      if (it == node_id_map.end()) {
+      start_id = node_id_map.Find(node_id);
+      if (!start_id) {
         if (FLAGS_skip_bad_relationships) {
           spdlog::warn(memgraph::utils::MessageWithLink("Skipping bad relationship with START_ID '{}'.", node_id,
                                                         "https://memgr.ph/csv-import-tool"));
@@ -537,7 +797,6 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
           throw LoadException("Node with ID '{}' does not exist", node_id);
         }
       }
-      start_id = it->second;
     } else if (memgraph::utils::StartsWith(field.type, "END_ID")) {
       if (end_id) throw LoadException("Only one node ID must be specified");
       if (FLAGS_id_type == "INTEGER") {
@@ -545,8 +804,8 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
         StringToInt(value);
       }
       NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map.find(node_id);
-      if (it == node_id_map.end()) {
+      end_id = node_id_map.Find(node_id);
+      if (!end_id) {
         if (FLAGS_skip_bad_relationships) {
           spdlog::warn(memgraph::utils::MessageWithLink("Skipping bad relationship with END_ID '{}'.", node_id,
                                                         "https://memgr.ph/csv-import-tool"));
@@ -555,7 +814,6 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
           throw LoadException("Node with ID '{}' does not exist", node_id);
         }
       }
-      end_id = it->second;
     } else if (field.type == "TYPE") {
       if (relationship_type) throw LoadException("Only one relationship TYPE must be specified");
       relationship_type = value;
@@ -568,7 +826,6 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
   if (!end_id) throw LoadException("END_ID must be set");
   if (!relationship_type) throw LoadException("Relationship TYPE must be set");
 
-  auto acc = store->Access();
   auto from_node = acc->FindVertex(*start_id, memgraph::storage::View::NEW);
   if (!from_node) throw LoadException("From node must be in the storage");
   auto to_node = acc->FindVertex(*end_id, memgraph::storage::View::NEW);
@@ -590,41 +847,46 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
       }
     }
   }
-
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the relationship");
 }
 
 void ProcessRelationships(memgraph::storage::Storage *store, const std::string &relationships_path,
                           const std::optional<std::string> &relationship_type,
-                          std::optional<std::vector<Field>> *header,
-                          const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
+                          std::optional<std::vector<Field>> *header, const NodeIdMap &node_id_map) {
   std::ifstream relationships_file(relationships_path);
   MG_ASSERT(relationships_file, "Unable to open '{}'", relationships_path);
   uint64_t row_number = 1;
-  try {
-    if (!*header) {
+  if (!*header) {
+    try {
       auto [fields, header_lines] = ReadHeader(relationships_file);
       row_number += header_lines;
       header->emplace(std::move(fields));
+    } catch (const LoadException &e) {
+      LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, relationships_path, e.what());
     }
-    while (true) {
-      auto [row, lines_count] = ReadRow(relationships_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessRelationshipsRow(store, **header, row, relationship_type, node_id_map);
-      row_number += lines_count;
-    }
-  } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, relationships_path, e.what());
   }
+  const auto &fields = **header;
+  ChunkErrors errors;
+  ForEachBlock(relationships_file, row_number, [&](const std::vector<Chunk> &chunks) {
+    ParallelFor(chunks.size(), [&](size_t i) {
+      ChunkStreamBuffer buffer(chunks[i].data);
+      std::istream stream(&buffer);
+      auto row_number = chunks[i].first_line;
+      try {
+        auto acc = store->Access();
+        while (true) {
+          auto [row, lines_count] = ReadRow(stream);
+          if (lines_count == 0) break;
+          CheckRowSize(&row, fields);
+          ProcessRelationshipsRow(acc.get(), fields, row, relationship_type, node_id_map);
+          row_number += lines_count;
+        }
+        if (acc->Commit().HasError()) throw LoadException("Couldn't store the relationships");
+      } catch (const LoadException &e) {
+        errors.Add(row_number, e.what());
+      }
+    });
+    errors.FatalIfAny(relationships_path);
+  });
 }
 
 struct NodesArgument {
@@ -700,29 +962,43 @@ int main(int argc, char *argv[]) {
     FLAGS_id_type = upper;
   }
 
-  std::unordered_map<NodeId, memgraph::storage::Gid> node_id_map;
-  auto store = std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+  MG_ASSERT(FLAGS_threads > 0, "The --threads flag must be positive!");
+  MG_ASSERT(FLAGS_chunk_size > 0, "The --chunk-size flag must be positive!");
 
+  NodeIdMap node_id_map;
+  memgraph::storage::Config config{
       .items = {.properties_on_edges = FLAGS_storage_properties_on_edges},
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = false,
                      .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::DISABLED,
-                     .snapshot_on_exit = true},
-  });
+                     .snapshot_on_exit = true,
+                     .snapshot_thread_count = FLAGS_threads},
+  };
+  for (const auto &edge_type : memgraph::utils::Split(FLAGS_storage_properties_on_edge_types, ",")) {
+    const auto trimmed = memgraph::utils::Trim(edge_type);
+    if (!trimmed.empty()) config.properties_on_edge_types.emplace_back(trimmed);
+  }
+  auto store = std::make_unique<memgraph::storage::InMemoryStorage>(config);
+  // The nodes and relationships are created by several threads at once, which
+  // doesn't need isolation, and the relationships are linked to their nodes in
+  // bulk once they are all created.
+  store->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
 
   memgraph::utils::Timer load_timer;
 
   // Process all nodes files.
+  uint64_t next_gid = 0;
   for (const auto &value : nodes) {
     auto [files, additional_labels] = ParseNodesArgument(value);
     std::optional<std::vector<Field>> header;
     for (const auto &nodes_file : files) {
       spdlog::info("Loading {}", nodes_file);
-      ProcessNodes(store.get(), nodes_file, &header, &node_id_map, additional_labels);
+      ProcessNodes(store.get(), nodes_file, &header, &node_id_map, additional_labels, &next_gid);
     }
   }
 
   // Process all relationships files.
+  store->SetEdgeImportMode(memgraph::storage::EdgeImportMode::ACTIVE);
   for (const auto &value : relationships) {
     auto [files, type] = ParseRelationshipsArgument(value);
     std::optional<std::vector<Field>> header;
@@ -731,11 +1007,13 @@ int main(int argc, char *argv[]) {
       ProcessRelationships(store.get(), relationships_file, type, &header, node_id_map);
     }
   }
+  store->SetEdgeImportMode(memgraph::storage::EdgeImportMode::INACTIVE);
 
   double load_sec = load_timer.Elapsed().count();
   spdlog::info("Loaded all data in {:.3f}s", load_sec);
 
-  // The snapshot will be created in the storage destructor.
+  // The snapshot will be created in the storage destructor, by
+  // `FLAGS_threads` threads.
 
   return 0;
 }
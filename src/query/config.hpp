@@ -11,20 +11,57 @@
 
 #pragma once
 #include <chrono>
+#include <cstdint>
 #include <string>
 
 namespace memgraph::query {
 struct InterpreterConfig {
   struct Query {
     bool allow_load_csv{true};
+    // Number of rows pulled at once by the operators of read-only queries, 0
+    // to pull the rows one at a time.
+    uint64_t pull_batch_size{256};
+    // Number of results of read-only queries pulled ahead of the next PULL
+    // while the previous results are sent, 0 to pull them only when requested.
+    uint64_t prefetch_rows{1000};
+    // Number of threads helping to execute parts of read-only queries in
+    // parallel, 0 to execute the queries on a single thread.
+    uint64_t parallel_execution_threads{0};
+    // Memory kept by the aggregations, orderings and DISTINCT clauses of a
+    // query before they spill their rows to the disk, 0 to never spill.
+    uint64_t spill_threshold_bytes{0};
+    // Memory which the queries of a single database may allocate for their
+    // execution at once, 0 for no limit other than the global one.
+    uint64_t memory_limit_per_database_bytes{0};
+    // Memory which the transactions of a single user may allocate in a
+    // database at once, 0 for no limit other than the one of the database.
+    uint64_t memory_limit_per_user_bytes{0};
+    // Queries taking at least this long are recorded by the slow query log,
+    // `slow_query_sample_rate` of them if it's below 1. The log keeps the
+    // `slow_query_log_size` most recent ones in memory, nothing is recorded
+    // if the sample rate or the size is 0.
+    uint64_t slow_query_threshold_ms{1000};
+    double slow_query_sample_rate{1.0};
+    uint64_t slow_query_log_size{1000};
   } query;
 
   // The same as \ref memgraph::storage::replication::ReplicationClientConfig
   std::chrono::seconds replication_replica_check_frequency{1};
+  // How long a transaction waits for the instance to catch up with its bookmarks.
+  std::chrono::milliseconds bookmark_wait_timeout{5000};
 
   std::string default_kafka_bootstrap_servers;
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+  int64_t kafka_stream_max_in_flight_batches{1};
+
+  // Threads running the after commit triggers. Each run covers the changes of
+  // up to `after_commit_trigger_batch_size` committed transactions, and with a
+  // non-zero `after_commit_trigger_queue_size` the committing transactions
+  // wait while that many transactions are waiting for their triggers.
+  size_t after_commit_trigger_threads{1};
+  size_t after_commit_trigger_batch_size{1};
+  size_t after_commit_trigger_queue_size{0};
 };
 }  // namespace memgraph::query
@@ -11,8 +11,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <filesystem>
 #include <memory>
+#include <regex>
 #include <type_traits>
+#include <vector>
 
 #include "query/common.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
@@ -21,11 +25,16 @@
 #include "query/plan/profile.hpp"
 #include "query/trigger.hpp"
 #include "utils/async_timer.hpp"
+#include "utils/thread_pool.hpp"
 
 #include "query/frame_change.hpp"
 
 namespace memgraph::query {
 
+namespace plan {
+class LogicalOperator;
+}  // namespace plan
+
 enum class TransactionStatus {
   IDLE,
   ACTIVE,
@@ -53,6 +62,12 @@ struct EvaluationContext {
   mutable std::unordered_map<std::string, int64_t> counters{};
   /// Property lookup cache ({symbol: {property_id: property_value, ...}, ...})
   mutable std::unordered_map<int32_t, std::map<storage::PropertyId, storage::PropertyValue>> property_lookups_cache{};
+  /// Values of the expressions marked as constant, which are evaluated once
+  /// per execution ({expression: value, ...})
+  mutable std::unordered_map<const Expression *, TypedValue> constant_values{};
+  /// Regular expressions compiled by the matches, which are compiled again
+  /// only when the pattern changes ({match: (pattern, regex), ...})
+  mutable std::unordered_map<const RegexMatch *, std::pair<std::string, std::regex>> regexes{};
 };
 
 inline std::vector<storage::PropertyId> NamesToProperties(const std::vector<std::string> &property_names,
@@ -74,6 +89,31 @@ inline std::vector<storage::LabelId> NamesToLabels(const std::vector<std::string
   return labels;
 }
 
+/// Chunks of the vertices of a scan which are taken by the workers executing
+/// a part of a query in parallel, one chunk at a time.
+class VertexChunks {
+ public:
+  VertexChunks(const plan::LogicalOperator *scan, std::vector<VerticesIterable> chunks)
+      : scan_(scan), chunks_(std::move(chunks)) {}
+
+  /// The scan whose vertices are split into the chunks.
+  const plan::LogicalOperator *Scan() const { return scan_; }
+
+  size_t Size() const { return chunks_.size(); }
+
+  /// Returns the next chunk which isn't taken yet, or `nullptr` once all of
+  /// them are taken.
+  VerticesIterable *Next() {
+    const auto chunk = next_.fetch_add(1, std::memory_order_relaxed);
+    return chunk < chunks_.size() ? &chunks_[chunk] : nullptr;
+  }
+
+ private:
+  const plan::LogicalOperator *scan_;
+  std::vector<VerticesIterable> chunks_;
+  std::atomic<size_t> next_{0};
+};
+
 struct ExecutionContext {
   DbAccessor *db_accessor{nullptr};
   SymbolTable symbol_table;
@@ -84,9 +124,33 @@ struct ExecutionContext {
   std::chrono::duration<double> profile_execution_time;
   plan::ProfilingStats stats;
   plan::ProfilingStats *stats_root{nullptr};
+  /// Bytes allocated from the query memory resource while profiling, `nullptr`
+  /// if the query isn't profiled.
+  uint64_t *profile_allocated_bytes{nullptr};
   ExecutionStats execution_stats;
   TriggerContextCollector *trigger_context_collector{nullptr};
   FrameChangeCollector *frame_change_collector{nullptr};
+  /// Number of rows pulled at once by `plan::Cursor::PullBatch`, 0 if the rows
+  /// are pulled one at a time.
+  size_t pull_batch_size{0};
+  /// Threads which execute parts of read-only queries in parallel, `nullptr`
+  /// if the query is executed on a single thread.
+  utils::ThreadPool *parallel_execution_pool{nullptr};
+  /// Number of workers executing a part of the query in parallel, including
+  /// the thread executing the query.
+  size_t parallel_workers{0};
+  /// Set for the workers executing a part of the query in parallel.
+  VertexChunks *vertex_chunks{nullptr};
+  /// Memory which `Aggregate`, `OrderBy` and `Distinct` keep before spilling
+  /// their rows to files in the `spill_directory`, 0 if they never spill.
+  uint64_t spill_threshold_bytes{0};
+  std::filesystem::path spill_directory;
+  /// Rows counted by `Accumulate`, `Aggregate`, `OrderBy` and the left branch
+  /// of `Cartesian`, `nullptr` if they aren't counted.
+  plan::ObservedCardinalities *observed_cardinalities{nullptr};
+  /// Rows counted by the filters which are in the map, e.g. those an index
+  /// could replace, `nullptr` if they aren't counted.
+  plan::ObservedFilters *observed_filters{nullptr};
   std::shared_ptr<utils::AsyncTimer> timer;
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
@@ -11,39 +11,237 @@
 
 #include "query/cypher_query_interpreter.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <tuple>
+
+#include "query/frontend/semantic/constant_expressions.hpp"
+#include "query/plan/pretty_print.hpp"
+#include "utils/bound.hpp"
+#include "utils/fnv.hpp"
+
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-DEFINE_VALIDATED_int32(query_plan_cache_ttl, 60, "Time to live for cached query plans, in seconds.",
+DEFINE_VALIDATED_int32(query_plan_cache_ttl, 0,
+                       "Time to live for cached query plans, in seconds. With 0, the plans are kept until the counts "
+                       "their costs were estimated with drift, or the indices or their statistics change.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_double(query_plan_cache_max_drift, 2.0,
+                        "Cached query plans are made again when a vertex or edge count their costs were estimated "
+                        "with changes by more than this ratio.",
+                        FLAG_IN_RANGE(1.0, std::numeric_limits<double>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_double(query_plan_cache_max_underestimation, 100.0,
+                        "Cached query plans are made again when an operator which collects all of its input, like "
+                        "an aggregation or ordering, receives more rows than estimated by more than this ratio.",
+                        FLAG_IN_RANGE(1.0, std::numeric_limits<double>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_max_estimated_memory_mib, 0,
+              "Queries whose plans are estimated to keep more memory than this number of MiB in operators which "
+              "collect their input, like aggregations and orderings, are rejected. With 0, no query is rejected.");
 
 namespace memgraph::query {
+
+namespace {
+
+// Larger blocks are rarely allocated more than a few times in a pull, so
+// pooling them would keep more memory than it saves allocations.
+constexpr size_t kMaxPullPoolBlockSize = 64UL * 1024UL;
+// The number of allocations of a size an execution has to forward upstream
+// for the pull pools to be tuned to serve it.
+constexpr uint64_t kMinPoolableAllocations = 8;
+// The size to which the chunks of the largest blocks of the tuned pull pools
+// are limited.
+constexpr size_t kPullPoolChunkBytes = 1024UL * 1024UL;
+constexpr size_t kMinPullPoolBlocksPerChunk = 16;
+
+// Collects the lookups of label and property indices with the values given by
+// parameters, for which the index statistics include a histogram.
+class ParameterIndexLookupCollector final : public plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  explicit ParameterIndexLookupCollector(DbAccessor *db_accessor) : db_accessor_(db_accessor) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool PreVisit(plan::ScanAllByLabelPropertyValue &op) override {
+    auto *parameter = utils::Downcast<ParameterLookup>(op.expression_);
+    if (!parameter) return true;
+    auto stats = db_accessor_->GetIndexStats(op.label_, op.property_);
+    if (stats && !stats->histogram.Empty()) {
+      lookups_.emplace_back(op.label_, op.property_, parameter->token_position_);
+    }
+    return true;
+  }
+
+  bool Visit(plan::Once &) override { return true; }
+
+  std::vector<std::tuple<storage::LabelId, storage::PropertyId, int32_t>> lookups_;
+
+ private:
+  DbAccessor *db_accessor_;
+};
+
+int64_t SelectivityBucket(double count) { return count < 1.0 ? 0 : 1 + static_cast<int64_t>(std::log10(count)); }
+
+// Chooses among the plans like the default post processor, with the costs of
+// the plans misestimated during their previous executions corrected.
+class CostFeedbackPostProcessor final {
+ public:
+  using ProcessedPlan = plan::PostProcessor::ProcessedPlan;
+
+  CostFeedbackPostProcessor(const Parameters &parameters, const std::vector<PlanCostFeedback> &cost_feedback,
+                            const DbAccessor &db_accessor)
+      : post_processor_(parameters), cost_feedback_(cost_feedback), db_accessor_(db_accessor) {}
+
+  template <class TPlanningContext>
+  ProcessedPlan Rewrite(ProcessedPlan plan, TPlanningContext *context) {
+    return post_processor_.Rewrite(std::move(plan), context);
+  }
+
+  template <class TVertexCounts>
+  double EstimatePlanCost(const ProcessedPlan &plan, TVertexCounts *vertex_counts, const SymbolTable &table) {
+    auto cost = post_processor_.EstimatePlanCost(plan, vertex_counts, table);
+    if (cost_feedback_.empty()) return cost;
+    const auto fingerprint = PlanFingerprint(db_accessor_, *plan);
+    for (const auto &feedback : cost_feedback_) {
+      if (feedback.plan_fingerprint == fingerprint) cost *= feedback.cost_factor;
+    }
+    return cost;
+  }
+
+ private:
+  plan::PostProcessor post_processor_;
+  const std::vector<PlanCostFeedback> &cost_feedback_;
+  const DbAccessor &db_accessor_;
+};
+
+uint64_t PlanVariantHash(uint64_t hash, const std::vector<int64_t> &selectivity_buckets) {
+  for (const auto bucket : selectivity_buckets) {
+    hash = utils::HashCombine<uint64_t, int64_t>{}(hash, bucket);
+  }
+  return hash;
+}
+
+}  // namespace
+
 CachedPlan::CachedPlan(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
 
-ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
-                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config) {
-  // Strip the query for caching purposes. The process of stripping a query
-  // "normalizes" it by replacing any literals with new parameters. This
-  // results in just the *structure* of the query being taken into account for
-  // caching.
-  frontend::StrippedQuery stripped_query{query_string};
+CachedPlan::CachedPlan(std::unique_ptr<LogicalPlan> plan, const Parameters &parameters, DbAccessor *db_accessor,
+                       std::vector<PlanCostFeedback> cost_feedback)
+    : plan_(std::move(plan)), cost_feedback_(std::move(cost_feedback)) {
+  auto &root = const_cast<plan::LogicalOperator &>(plan_->GetRoot());
+  ParameterIndexLookupCollector collector(db_accessor);
+  root.Accept(collector);
+  for (const auto &[label, property, token_position] : collector.lookups_) {
+    parameter_lookups_.push_back({label, property, token_position});
+  }
+  selectivity_buckets_ = SelectivityBuckets(parameters, db_accessor);
+  index_candidates_ = FindIndexCandidates(root, plan_->GetSymbolTable(), plan_->GetAstStorage(), db_accessor);
 
-  // Copy over the parameters that were introduced during stripping.
-  Parameters parameters{stripped_query.literals()};
+  auto vertex_counts = plan::MakeVertexCountCache(db_accessor);
+  plan::CostEstimator<decltype(vertex_counts)> estimator(&vertex_counts, plan_->GetSymbolTable(), parameters);
+  root.Accept(estimator);
+  breaker_cardinalities_ = estimator.breaker_cardinalities();
+  estimated_rows_ = estimator.cardinality();
+  // Each row kept by a pipeline breaker holds at most the values of a frame.
+  const auto row_bytes = static_cast<double>(plan_->GetSymbolTable().max_position()) * sizeof(TypedValue);
+  for (const auto &[op, rows] : breaker_cardinalities_) {
+    estimated_memory_ += rows * row_bytes;
+  }
+}
 
-  // Check that all user-specified parameters are provided.
-  for (const auto &param_pair : stripped_query.parameters()) {
-    auto it = params.find(param_pair.second);
+bool CachedPlan::IsExpired(DbAccessor *db_accessor) const {
+  if (FLAGS_query_plan_cache_ttl > 0 && cache_timer_.Elapsed() > std::chrono::seconds(FLAGS_query_plan_cache_ttl)) {
+    return true;
+  }
+  if (misestimated_.load(std::memory_order_acquire)) return true;
+  return plan_->GetCardinalities().HasDrifted(db_accessor, FLAGS_query_plan_cache_max_drift);
+}
 
-    if (it == params.end()) {
-      throw query::UnprovidedParameterError("Parameter ${} not provided.", param_pair.second);
+void CachedPlan::ReportObservedCardinalities(const plan::ObservedCardinalities &observed,
+                                             const DbAccessor &db_accessor) {
+  if (misestimated_.load(std::memory_order_acquire)) return;
+  // Only the underestimated rows are corrected. Fewer rows than estimated are
+  // also observed when the execution stops early, for example with LIMIT.
+  double max_ratio = 1.0;
+  for (const auto &[op, rows] : observed) {
+    auto it = breaker_cardinalities_.find(op);
+    if (it == breaker_cardinalities_.end()) continue;
+    max_ratio = std::max(max_ratio, (static_cast<double>(rows) + 1.0) / (it->second + 1.0));
+  }
+  if (max_ratio <= FLAGS_query_plan_cache_max_underestimation) return;
+
+  const auto fingerprint = PlanFingerprint(db_accessor, plan_->GetRoot());
+  auto cost_feedback = cost_feedback_.Lock();
+  // The plan was already chosen with its cost corrected, so planning the query
+  // again wouldn't change it.
+  if (std::any_of(cost_feedback->begin(), cost_feedback->end(),
+                  [&](const auto &feedback) { return feedback.plan_fingerprint == fingerprint; })) {
+    return;
+  }
+  cost_feedback->push_back({fingerprint, max_ratio});
+  misestimated_.store(true, std::memory_order_release);
+}
+
+CachedPlan::PoolParameters CachedPlan::PullPoolParameters(size_t default_max_block_size,
+                                                          size_t default_max_blocks_per_chunk) const {
+  const auto max_block_size = pull_pool_max_block_size_.load(std::memory_order_relaxed);
+  if (max_block_size <= default_max_block_size) return {default_max_block_size, default_max_blocks_per_chunk};
+  return {max_block_size,
+          std::clamp(kPullPoolChunkBytes / max_block_size, kMinPullPoolBlocksPerChunk, default_max_blocks_per_chunk)};
+}
+
+void CachedPlan::ReportPullPoolStats(const utils::PoolResource::Stats &stats) {
+  if (stats.unpooled == 0) return;
+  // The largest size which was forwarded upstream often enough, unless it's
+  // too large to be worth pooling.
+  size_t max_block_size = 0;
+  for (size_t size_class = utils::PoolResource::Stats::kSizeClasses; size_class-- > 0;) {
+    const auto size = size_t{1} << size_class;
+    if (size <= kMaxPullPoolBlockSize && stats.unpooled_by_size_class[size_class] >= kMinPoolableAllocations) {
+      max_block_size = size;
+      break;
     }
+  }
+  auto current = pull_pool_max_block_size_.load(std::memory_order_relaxed);
+  while (current < max_block_size &&
+         !pull_pool_max_block_size_.compare_exchange_weak(current, max_block_size, std::memory_order_relaxed)) {
+  }
+}
 
-    parameters.Add(param_pair.first, it->second);
+std::vector<int64_t> CachedPlan::SelectivityBuckets(const Parameters &parameters, DbAccessor *db_accessor) const {
+  std::vector<int64_t> buckets;
+  buckets.reserve(parameter_lookups_.size());
+  for (const auto &lookup : parameter_lookups_) {
+    auto stats = db_accessor->GetIndexStats(lookup.label, lookup.property);
+    if (!stats || stats->histogram.Empty()) {
+      buckets.push_back(-1);
+      continue;
+    }
+    const auto &value = parameters.AtTokenPosition(lookup.token_position);
+    buckets.push_back(SelectivityBucket(
+        stats->histogram.EstimateRangeCount(utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value))));
   }
+  return buckets;
+}
+
+ParsedQuery ParseQuery(const std::string &query_string, std::map<std::string, storage::PropertyValue> params,
+                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config) {
+  // Strip the query for caching purposes. The process of stripping a query
+  // "normalizes" it by replacing any literals with new parameters. This
+  // results in just the *structure* of the query being taken into account for
+  // caching.
+  auto stripped_query = std::make_shared<const frontend::StrippedQuery>(query_string);
+
+  auto parameters = BindParameters(*stripped_query, params);
 
   // Cache the query's AST if it isn't already.
-  auto hash = stripped_query.hash();
+  auto hash = stripped_query->hash();
   auto accessor = cache->access();
   auto it = accessor.find(hash);
   std::unique_ptr<frontend::opencypher::Parser> parser;
@@ -53,17 +251,13 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
   bool is_cacheable = true;
 
   auto get_information_from_cache = [&](const auto &cached_query) {
-    result.ast_storage.properties_ = cached_query.ast_storage.properties_;
-    result.ast_storage.labels_ = cached_query.ast_storage.labels_;
-    result.ast_storage.edge_types_ = cached_query.ast_storage.edge_types_;
-
-    result.query = cached_query.query->Clone(&result.ast_storage);
+    result.query = CloneQuery(cached_query.ast_storage, cached_query.query, &result.ast_storage);
     result.required_privileges = cached_query.required_privileges;
   };
 
   if (it == accessor.end()) {
     try {
-      parser = std::make_unique<frontend::opencypher::Parser>(stripped_query.query());
+      parser = std::make_unique<frontend::opencypher::Parser>(stripped_query->query());
     } catch (const SyntaxException &e) {
       // There is a syntax exception in the stripped query. Re-run the parser
       // on the original query to get an appropriate error messsage.
@@ -91,11 +285,7 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
 
       get_information_from_cache(it->second);
     } else {
-      result.ast_storage.properties_ = ast_storage.properties_;
-      result.ast_storage.labels_ = ast_storage.labels_;
-      result.ast_storage.edge_types_ = ast_storage.edge_types_;
-
-      result.query = visitor.query()->Clone(&result.ast_storage);
+      result.query = CloneQuery(ast_storage, visitor.query(), &result.ast_storage);
       result.required_privileges = query::GetRequiredPrivileges(visitor.query());
 
       is_cacheable = false;
@@ -105,7 +295,7 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
   }
 
   return ParsedQuery{query_string,
-                     params,
+                     std::move(params),
                      std::move(parameters),
                      std::move(stripped_query),
                      std::move(result.ast_storage),
@@ -114,39 +304,143 @@ ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::stri
                      is_cacheable};
 }
 
+Parameters BindParameters(const frontend::StrippedQuery &stripped_query,
+                          const std::map<std::string, storage::PropertyValue> &params) {
+  // Copy over the parameters that were introduced during stripping.
+  Parameters parameters{stripped_query.literals()};
+
+  // Check that all user-specified parameters are provided.
+  for (const auto &param_pair : stripped_query.parameters()) {
+    auto it = params.find(param_pair.second);
+
+    if (it == params.end()) {
+      throw query::UnprovidedParameterError("Parameter ${} not provided.", param_pair.second);
+    }
+
+    parameters.Add(param_pair.first, it->second);
+  }
+  return parameters;
+}
+
+Query *CloneQuery(const AstStorage &from, Query *query, AstStorage *ast_storage) {
+  ast_storage->properties_ = from.properties_;
+  ast_storage->labels_ = from.labels_;
+  ast_storage->edge_types_ = from.edge_types_;
+  return query->Clone(ast_storage);
+}
+
+uint64_t PlanFingerprint(const DbAccessor &db_accessor, const plan::LogicalOperator &root) {
+  return std::hash<std::string>{}(plan::PlanToJson(db_accessor, &root).dump());
+}
+
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
-                                             const std::vector<Identifier *> &predefined_identifiers) {
+                                             const std::vector<Identifier *> &predefined_identifiers,
+                                             const std::vector<PlanCostFeedback> &cost_feedback) {
   auto vertex_counts = plan::MakeVertexCountCache(db_accessor);
   auto symbol_table = MakeSymbolTable(query, predefined_identifiers);
+  MarkConstantExpressions(query);
   auto planning_context = plan::MakePlanningContext(&ast_storage, &symbol_table, query, &vertex_counts);
-  auto [root, cost] = plan::MakeLogicalPlan(&planning_context, parameters, FLAGS_query_cost_planner);
+  CostFeedbackPostProcessor post_processor(parameters, cost_feedback, *db_accessor);
+  auto [root, cost] = plan::MakeLogicalPlan(&planning_context, &post_processor, FLAGS_query_cost_planner);
   return std::make_unique<SingleNodeLogicalPlan>(std::move(root), cost, std::move(ast_storage),
-                                                 std::move(symbol_table));
+                                                 std::move(symbol_table), vertex_counts.Cardinalities());
 }
 
-std::shared_ptr<CachedPlan> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                              const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
-                                              DbAccessor *db_accessor,
-                                              const std::vector<Identifier *> &predefined_identifiers) {
+std::shared_ptr<CachedPlan> LocalPlanCache::Find(uint64_t key) {
+  const auto generation = Generation();
+  if (generation != entries_generation_) {
+    entries_.clear();
+    entries_generation_ = generation;
+    return nullptr;
+  }
+  auto it = std::find_if(entries_.begin(), entries_.end(), [key](const auto &entry) { return entry.first == key; });
+  if (it == entries_.end()) return nullptr;
+  std::rotate(it, it + 1, entries_.end());
+  return entries_.back().second;
+}
+
+void LocalPlanCache::Insert(uint64_t key, std::shared_ptr<CachedPlan> plan, uint64_t generation) {
+  // The shared cache was cleared after the plan was found, so it may be stale.
+  if (generation != Generation()) return;
+  if (generation != entries_generation_) {
+    entries_.clear();
+    entries_generation_ = generation;
+  }
+  std::erase_if(entries_, [key](const auto &entry) { return entry.first == key; });
+  if (entries_.size() == kMaxPlans) entries_.erase(entries_.begin());
+  entries_.emplace_back(key, std::move(plan));
+}
+
+namespace {
+
+std::shared_ptr<CachedPlan> FindOrMakePlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
+                                           const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
+                                           DbAccessor *db_accessor,
+                                           const std::vector<Identifier *> &predefined_identifiers) {
   std::optional<utils::SkipList<PlanCacheEntry>::Accessor> plan_cache_access;
+  auto cache_key = hash;
+  std::vector<PlanCostFeedback> cost_feedback;
   if (plan_cache) {
     plan_cache_access.emplace(plan_cache->access());
-    auto it = plan_cache_access->find(hash);
-    if (it != plan_cache_access->end()) {
-      if (it->second->IsExpired()) {
-        plan_cache_access->remove(hash);
-      } else {
-        return it->second;
+    auto find_plan = [&](uint64_t key) -> std::shared_ptr<CachedPlan> {
+      auto it = plan_cache_access->find(key);
+      if (it == plan_cache_access->end()) return nullptr;
+      if (it->second->IsExpired(db_accessor)) {
+        cost_feedback = it->second->CostFeedback();
+        plan_cache_access->remove(key);
+        return nullptr;
+      }
+      return it->second;
+    };
+    if (auto cached_plan = find_plan(hash)) {
+      auto selectivity_buckets = cached_plan->SelectivityBuckets(parameters, db_accessor);
+      if (selectivity_buckets == cached_plan->selectivity_buckets()) {
+        return cached_plan;
+      }
+      // The variants are cached under the hash combined with the buckets, so
+      // there is at most one for each combination of orders of magnitude.
+      cache_key = PlanVariantHash(hash, selectivity_buckets);
+      if (auto variant = find_plan(cache_key)) {
+        return variant;
       }
     }
   }
 
   auto plan = std::make_shared<CachedPlan>(
-      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
+      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers, cost_feedback),
+      parameters, db_accessor, std::move(cost_feedback));
   if (plan_cache_access) {
-    plan_cache_access->insert({hash, plan});
+    plan_cache_access->insert({cache_key, plan});
+  }
+  return plan;
+}
+
+}  // namespace
+
+std::shared_ptr<CachedPlan> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
+                                              const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
+                                              DbAccessor *db_accessor,
+                                              const std::vector<Identifier *> &predefined_identifiers,
+                                              LocalPlanCache *local_plan_cache) {
+  if (!plan_cache || !local_plan_cache) {
+    return FindOrMakePlan(hash, std::move(ast_storage), query, parameters, plan_cache, db_accessor,
+                          predefined_identifiers);
+  }
+  if (auto plan = local_plan_cache->Find(hash)) {
+    // The checks are the same as those of the shared cache, which removes the
+    // plan if it expired.
+    if (!plan->IsExpired(db_accessor) &&
+        plan->SelectivityBuckets(parameters, db_accessor) == plan->selectivity_buckets()) {
+      return plan;
+    }
   }
+  // The generation is read before the lookup, so a plan found while the
+  // shared cache is cleared isn't kept.
+  const auto generation = local_plan_cache->Generation();
+  auto plan =
+      FindOrMakePlan(hash, std::move(ast_storage), query, parameters, plan_cache, db_accessor, predefined_identifiers);
+  local_plan_cache->Insert(hash, plan, generation);
   return plan;
 }
 }  // namespace memgraph::query
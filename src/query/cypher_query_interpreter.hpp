@@ -11,20 +11,33 @@
 
 #pragma once
 
+#include <atomic>
+#include <unordered_map>
+
 #include "query/config.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
 #include "query/frontend/opencypher/parser.hpp"
 #include "query/frontend/semantic/required_privileges.hpp"
 #include "query/frontend/semantic/symbol_generator.hpp"
 #include "query/frontend/stripped.hpp"
+#include "query/index_advisor.hpp"
 #include "query/plan/planner.hpp"
+#include "query/plan/profile.hpp"
 #include "utils/flag_validation.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/timer.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_ttl);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_double(query_plan_cache_max_drift);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_double(query_plan_cache_max_underestimation);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(query_max_estimated_memory_mib);
 
 namespace memgraph::query {
 
@@ -45,25 +58,131 @@ class LogicalPlan {
   virtual double GetCost() const = 0;
   virtual const SymbolTable &GetSymbolTable() const = 0;
   virtual const AstStorage &GetAstStorage() const = 0;
+  virtual const plan::PlanCardinalities &GetCardinalities() const = 0;
+};
+
+/// Correction of the estimated cost of a plan, observed while executing it.
+struct PlanCostFeedback {
+  /// Identifies the plan among those considered when the query is planned.
+  uint64_t plan_fingerprint;
+  /// Ratio between the observed and the estimated rows of the plan.
+  double cost_factor;
 };
 
 class CachedPlan {
  public:
   explicit CachedPlan(std::unique_ptr<LogicalPlan> plan);
 
+  /// Also keeps the index lookups of the plan whose numbers of vertices depend
+  /// on the parameters, together with the selectivity buckets of `parameters`,
+  /// and the estimated input rows of its pipeline breakers. The
+  /// `cost_feedback` observed with the previous plans of the query is kept
+  /// for planning it again.
+  CachedPlan(std::unique_ptr<LogicalPlan> plan, const Parameters &parameters, DbAccessor *db_accessor,
+             std::vector<PlanCostFeedback> cost_feedback = {});
+
   const auto &plan() const { return plan_->GetRoot(); }
   double cost() const { return plan_->GetCost(); }
+  /// Estimated number of rows produced by the plan.
+  double estimated_rows() const { return estimated_rows_; }
+  /// Estimated bytes of the rows kept by the pipeline breakers of the plan.
+  double estimated_memory() const { return estimated_memory_; }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
 
-  bool IsExpired() const {
-    // NOLINTNEXTLINE (modernize-use-nullptr)
-    return cache_timer_.Elapsed() > std::chrono::seconds(FLAGS_query_plan_cache_ttl);
+  /// Returns true if the plan has to be made again, because the counts its
+  /// costs were estimated with drifted, it was misestimated during an
+  /// execution or its time to live passed.
+  bool IsExpired(DbAccessor *db_accessor) const;
+
+  /// Compares the rows which the pipeline breakers received during an
+  /// execution with the estimated ones. If some received more rows than
+  /// estimated by more than `query_plan_cache_max_underestimation`, the plan
+  /// expires and the ratio is kept as the feedback for planning the query
+  /// again.
+  void ReportObservedCardinalities(const plan::ObservedCardinalities &observed, const DbAccessor &db_accessor);
+
+  bool HasBreakerCardinalities() const { return !breaker_cardinalities_.empty(); }
+
+  /// Filters of the plan which an index could replace, whose rows are
+  /// reported to the `IndexAdvisor` of the database.
+  const std::vector<IndexCandidate> &index_candidates() const { return index_candidates_; }
+
+  std::vector<PlanCostFeedback> CostFeedback() const { return *cost_feedback_.ReadLock(); }
+
+  struct PoolParameters {
+    size_t max_block_size;
+    size_t max_blocks_per_chunk;
   };
 
+  /// Returns the parameters of the pool serving the allocations of a pull of
+  /// the plan. They are the defaults until the allocations of an execution
+  /// are reported with `ReportPullPoolStats`.
+  PoolParameters PullPoolParameters(size_t default_max_block_size, size_t default_max_blocks_per_chunk) const;
+
+  /// Raises the maximum block size of the pull pools if the pools of an
+  /// execution often forwarded allocations of a similar size upstream, so
+  /// that the following executions pool them. Fewer blocks are then put in a
+  /// chunk, so that the chunks of the larger blocks stay small.
+  void ReportPullPoolStats(const utils::PoolResource::Stats &stats);
+
+  /// Returns the orders of magnitude of the numbers of vertices which the
+  /// parameter dependent index lookups of the plan match with `parameters`,
+  /// as estimated by the histograms of the indices.
+  std::vector<int64_t> SelectivityBuckets(const Parameters &parameters, DbAccessor *db_accessor) const;
+
+  const auto &selectivity_buckets() const { return selectivity_buckets_; }
+
+  /// Returns true if the plan was used by a query before, so using it again
+  /// is a hit of the plan cache.
+  bool MarkUsed() { return used_.exchange(true, std::memory_order_relaxed); }
+
  private:
+  struct ParameterIndexLookup {
+    storage::LabelId label;
+    storage::PropertyId property;
+    int32_t token_position;
+  };
+
   std::unique_ptr<LogicalPlan> plan_;
+  std::vector<ParameterIndexLookup> parameter_lookups_;
+  std::vector<int64_t> selectivity_buckets_;
+  std::unordered_map<const plan::LogicalOperator *, double> breaker_cardinalities_;
+  std::vector<IndexCandidate> index_candidates_;
+  double estimated_rows_{0};
+  double estimated_memory_{0};
+  utils::Synchronized<std::vector<PlanCostFeedback>, utils::RWSpinLock> cost_feedback_;
+  std::atomic<bool> misestimated_{false};
   utils::Timer cache_timer_;
+  // Zero until the pull pools are tuned.
+  std::atomic<size_t> pull_pool_max_block_size_{0};
+  std::atomic<bool> used_{false};
+};
+
+/// The plans recently used by a session, which are looked up before the plan
+/// cache shared by all sessions, so hits don't access the shared skip list.
+/// The plans are dropped when the shared cache is cleared, which is noticed by
+/// the change of its generation. This class isn't thread-safe.
+class LocalPlanCache {
+ public:
+  explicit LocalPlanCache(const std::atomic<uint64_t> *generation) : generation_(generation) {}
+
+  /// Returns the plan cached under the key, or nullptr.
+  std::shared_ptr<CachedPlan> Find(uint64_t key);
+
+  /// Caches the plan, which was found in or added to the shared cache while
+  /// it had the `generation`.
+  void Insert(uint64_t key, std::shared_ptr<CachedPlan> plan, uint64_t generation);
+
+  uint64_t Generation() const { return generation_->load(std::memory_order_acquire); }
+
+ private:
+  static constexpr size_t kMaxPlans = 16;
+
+  const std::atomic<uint64_t> *generation_;
+  uint64_t entries_generation_{0};
+  // The most recently used plans are at the back.
+  std::vector<std::pair<uint64_t, std::shared_ptr<CachedPlan>>> entries_;
 };
 
 struct CachedQuery {
@@ -103,49 +222,78 @@ struct ParsedQuery {
   std::string query_string;
   std::map<std::string, storage::PropertyValue> user_parameters;
   Parameters parameters;
-  frontend::StrippedQuery stripped_query;
+  // Shared with the prepared statements made from the query.
+  std::shared_ptr<const frontend::StrippedQuery> stripped_query;
   AstStorage ast_storage;
   Query *query;
   std::vector<AuthQuery::Privilege> required_privileges;
   bool is_cacheable{true};
 };
 
-ParsedQuery ParseQuery(const std::string &query_string, const std::map<std::string, storage::PropertyValue> &params,
+ParsedQuery ParseQuery(const std::string &query_string, std::map<std::string, storage::PropertyValue> params,
                        utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config);
 
+/// Returns the literals of the stripped query together with the values of the
+/// user-specified parameters it uses.
+/// @throw UnprovidedParameterError if a parameter isn't in `params`.
+Parameters BindParameters(const frontend::StrippedQuery &stripped_query,
+                          const std::map<std::string, storage::PropertyValue> &params);
+
+/// Copies the `query` and its names into `ast_storage`, and returns the copy.
+Query *CloneQuery(const AstStorage &from, Query *query, AstStorage *ast_storage);
+
 class SingleNodeLogicalPlan final : public LogicalPlan {
  public:
   SingleNodeLogicalPlan(std::unique_ptr<plan::LogicalOperator> root, double cost, AstStorage storage,
-                        const SymbolTable &symbol_table)
-      : root_(std::move(root)), cost_(cost), storage_(std::move(storage)), symbol_table_(symbol_table) {}
+                        const SymbolTable &symbol_table, plan::PlanCardinalities cardinalities = {})
+      : root_(std::move(root)),
+        cost_(cost),
+        storage_(std::move(storage)),
+        symbol_table_(symbol_table),
+        cardinalities_(std::move(cardinalities)) {}
 
   const plan::LogicalOperator &GetRoot() const override { return *root_; }
   double GetCost() const override { return cost_; }
   const SymbolTable &GetSymbolTable() const override { return symbol_table_; }
   const AstStorage &GetAstStorage() const override { return storage_; }
+  const plan::PlanCardinalities &GetCardinalities() const override { return cardinalities_; }
 
  private:
   std::unique_ptr<plan::LogicalOperator> root_;
   double cost_;
   AstStorage storage_;
   SymbolTable symbol_table_;
+  plan::PlanCardinalities cardinalities_;
 };
 
+/// Returns an identifier of the plan, which is the same for the plans made
+/// for the same query with the same structure.
+uint64_t PlanFingerprint(const DbAccessor &db_accessor, const plan::LogicalOperator &root);
+
+/// The estimated costs of the plans in `cost_feedback` are multiplied by
+/// their cost factors when choosing among the plans of the query.
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
-                                             const std::vector<Identifier *> &predefined_identifiers);
+                                             const std::vector<Identifier *> &predefined_identifiers,
+                                             const std::vector<PlanCostFeedback> &cost_feedback = {});
 
 /**
  * Return the parsed *Cypher* query's AST cached logical plan, or create and
  * cache a fresh one if it doesn't yet exist.
+ * If the parameters select a number of vertices of a different order of
+ * magnitude than those the cached plan was made for, a variant of the plan
+ * is made and cached for them.
  * @param predefined_identifiers optional identifiers you want to inject into a query.
  * If an identifier is not defined in a scope, we check the predefined identifiers.
  * If an identifier is contained there, we inject it at that place and remove it,
  * because a predefined identifier can be used only in one scope.
+ * @param local_plan_cache optional cache of the session, which is looked up
+ * before `plan_cache`.
  */
 std::shared_ptr<CachedPlan> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
                                               const Parameters &parameters, utils::SkipList<PlanCacheEntry> *plan_cache,
                                               DbAccessor *db_accessor,
-                                              const std::vector<Identifier *> &predefined_identifiers = {});
+                                              const std::vector<Identifier *> &predefined_identifiers = {},
+                                              LocalPlanCache *local_plan_cache = nullptr);
 
 }  // namespace memgraph::query
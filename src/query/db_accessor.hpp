@@ -52,6 +52,11 @@ class EdgeAccessor final {
     return impl_.GetProperty(key, view);
   }
 
+  storage::Result<bool> IsPropertyEqual(storage::View view, storage::PropertyId key,
+                                        const storage::PropertyValue &value) const {
+    return impl_.IsPropertyEqual(key, value, view);
+  }
+
   storage::Result<storage::PropertyValue> SetProperty(storage::PropertyId key, const storage::PropertyValue &value) {
     return impl_.SetProperty(key, value);
   }
@@ -128,6 +133,11 @@ class VertexAccessor final {
     return impl_.GetProperty(key, view);
   }
 
+  storage::Result<bool> IsPropertyEqual(storage::View view, storage::PropertyId key,
+                                        const storage::PropertyValue &value) const {
+    return impl_.IsPropertyEqual(key, value, view);
+  }
+
   storage::Result<storage::PropertyValue> SetProperty(storage::PropertyId key, const storage::PropertyValue &value) {
     return impl_.SetProperty(key, value);
   }
@@ -207,6 +217,14 @@ class VertexAccessor final {
     return EdgeVertexAccessorResult{.edges = edges, .expanded_count = (*maybe_result).expanded_count};
   }
 
+  storage::Result<bool> HasInEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types) const {
+    return impl_.HasInEdges(view, edge_types);
+  }
+
+  storage::Result<bool> HasOutEdges(storage::View view, const std::vector<storage::EdgeTypeId> &edge_types) const {
+    return impl_.HasOutEdges(view, edge_types);
+  }
+
   storage::Result<size_t> InDegree(storage::View view) const { return impl_.InDegree(view); }
 
   storage::Result<size_t> OutDegree(storage::View view) const { return impl_.OutDegree(view); }
@@ -328,6 +346,13 @@ class VerticesIterable final {
       return *this;
     }
 
+    /// @return the value of the indexed property of the current vertex read
+    /// from the index entry, or nullptr if the iterator doesn't read it.
+    const storage::PropertyValue *IndexedValue() const {
+      const auto *it = std::get_if<storage::VerticesIterable::Iterator>(&it_);
+      return it ? it->IndexedValue() : nullptr;
+    }
+
     bool operator==(const Iterator &other) const { return it_ == other.it_; }
 
     bool operator!=(const Iterator &other) const { return !(other == *this); }
@@ -338,6 +363,12 @@ class VerticesIterable final {
                                                utils::Allocator<VertexAccessor>> *vertices)
       : iterable_(vertices) {}
 
+  /// @return true if the storage iterable applies the filter.
+  bool SetFilter(const storage::VertexFilter *filter) {
+    auto *iterable = std::get_if<storage::VerticesIterable>(&iterable_);
+    return iterable && iterable->SetFilter(filter);
+  }
+
   Iterator begin() {
     return std::visit(memgraph::utils::Overloaded{
                           [](storage::VerticesIterable &iterable_) { return Iterator(iterable_.begin()); },
@@ -358,9 +389,52 @@ class VerticesIterable final {
   }
 };
 
+class EdgesIterable final {
+  storage::EdgesIterable iterable_;
+
+ public:
+  class Iterator final {
+    storage::EdgesIterable::Iterator it_;
+
+   public:
+    explicit Iterator(storage::EdgesIterable::Iterator it) : it_(std::move(it)) {}
+
+    EdgeAccessor operator*() const { return EdgeAccessor(*it_); }
+
+    Iterator &operator++() {
+      ++it_;
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const { return it_ == other.it_; }
+
+    bool operator!=(const Iterator &other) const { return !(other == *this); }
+  };
+
+  explicit EdgesIterable(storage::EdgesIterable iterable) : iterable_(std::move(iterable)) {}
+
+  Iterator begin() { return Iterator(iterable_.begin()); }
+
+  Iterator end() { return Iterator(iterable_.end()); }
+};
+
 class DbAccessor final {
   storage::Storage::Accessor *accessor_;
 
+  static std::vector<storage::VertexAccessor> ToStorageVertices(const std::vector<VertexAccessor> &vertices) {
+    std::vector<storage::VertexAccessor> storage_vertices;
+    storage_vertices.reserve(vertices.size());
+    for (const auto &vertex : vertices) storage_vertices.push_back(vertex.impl_);
+    return storage_vertices;
+  }
+
+  static std::vector<VerticesIterable> ToVerticesIterables(std::vector<storage::VerticesIterable> storage_iterables) {
+    std::vector<VerticesIterable> iterables;
+    iterables.reserve(storage_iterables.size());
+    for (auto &iterable : storage_iterables) iterables.emplace_back(std::move(iterable));
+    return iterables;
+  }
+
  public:
   explicit DbAccessor(storage::Storage::Accessor *accessor) : accessor_(accessor) {}
 
@@ -370,6 +444,19 @@ class DbAccessor final {
     return std::nullopt;
   }
 
+  bool CanFindVertexByUniqueKey(storage::LabelId label, const std::set<storage::PropertyId> &properties) const {
+    return accessor_->CanFindVertexByUniqueKey(label, properties);
+  }
+
+  storage::Result<std::optional<VertexAccessor>> FindVertexByUniqueKey(
+      storage::LabelId label, const std::set<storage::PropertyId> &properties,
+      const std::vector<storage::PropertyValue> &values) {
+    auto maybe_vertex = accessor_->FindVertexByUniqueKey(label, properties, values);
+    if (maybe_vertex.HasError()) return maybe_vertex.GetError();
+    if (*maybe_vertex) return std::make_optional<VertexAccessor>(**maybe_vertex);
+    return std::optional<VertexAccessor>{};
+  }
+
   void FinalizeTransaction() { accessor_->FinalizeTransaction(); }
 
   VerticesIterable Vertices(storage::View view) { return VerticesIterable(accessor_->Vertices(view)); }
@@ -382,6 +469,19 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, view));
   }
 
+  /// Splits the vertices into chunks which may be iterated by different
+  /// threads while the transaction caches are frozen. Returns no chunks if
+  /// the storage can't split the vertices.
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, uint64_t num_chunks) {
+    return ToVerticesIterables(accessor_->ChunkedVertices(view, num_chunks));
+  }
+
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, storage::LabelId label, uint64_t num_chunks) {
+    return ToVerticesIterables(accessor_->ChunkedVertices(label, view, num_chunks));
+  }
+
+  void FreezeTransactionCaches(bool frozen) { accessor_->FreezeTransactionCaches(frozen); }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property,
                             const storage::PropertyValue &value) {
     return VerticesIterable(accessor_->Vertices(label, property, value, view));
@@ -393,12 +493,94 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  VerticesIterable Vertices(storage::View view, storage::LabelId label,
+                            const std::vector<storage::PropertyId> &properties,
+                            const std::vector<storage::PropertyValue> &prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, prefix, lower, upper, view));
+  }
+
+  VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property,
+                            storage::TextMatch match, const std::string &pattern) {
+    return VerticesIterable(accessor_->Vertices(label, property, match, pattern, view));
+  }
+
+  VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property,
+                            const storage::PointRegion &region) {
+    return VerticesIterable(accessor_->Vertices(label, property, region, view));
+  }
+
+  std::vector<std::pair<VertexAccessor, double>> TextSearch(storage::View view, storage::LabelId label,
+                                                            storage::PropertyId property, std::string_view query,
+                                                            uint64_t limit) {
+    auto found = accessor_->TextSearch(label, property, query, limit, view);
+    std::vector<std::pair<VertexAccessor, double>> result;
+    result.reserve(found.size());
+    for (auto &[vertex, score] : found) {
+      result.emplace_back(VertexAccessor(vertex), score);
+    }
+    return result;
+  }
+
+  std::vector<std::pair<VertexAccessor, double>> VectorSearch(storage::View view, storage::LabelId label,
+                                                              storage::PropertyId property,
+                                                              const std::vector<float> &query, uint64_t limit,
+                                                              storage::VectorMetric metric) {
+    auto found = accessor_->VectorSearch(label, property, query, limit, metric, view);
+    std::vector<std::pair<VertexAccessor, double>> result;
+    result.reserve(found.size());
+    for (auto &[vertex, distance] : found) {
+      result.emplace_back(VertexAccessor(vertex), distance);
+    }
+    return result;
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
+    return EdgesIterable(accessor_->Edges(edge_type, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const storage::PropertyValue &value) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, value, view));
+  }
+
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                      const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return EdgesIterable(accessor_->Edges(edge_type, property, lower, upper, view));
+  }
+
   VertexAccessor InsertVertex() { return VertexAccessor(accessor_->CreateVertex()); }
 
+  std::vector<VertexAccessor> InsertVertices(uint64_t count, const std::vector<storage::LabelId> &labels) {
+    auto created = accessor_->CreateVertices(count, labels);
+    std::vector<VertexAccessor> vertices;
+    vertices.reserve(created.size());
+    for (auto &vertex : created) {
+      vertices.emplace_back(vertex);
+    }
+    return vertices;
+  }
+
   void PrefetchOutEdges(const VertexAccessor &vertex) const { accessor_->PrefetchOutEdges(vertex.impl_); }
 
   void PrefetchInEdges(const VertexAccessor &vertex) const { accessor_->PrefetchInEdges(vertex.impl_); }
 
+  void PrefetchOutEdges(const std::vector<VertexAccessor> &vertices,
+                        const std::vector<storage::EdgeTypeId> &edge_types = {}) const {
+    accessor_->PrefetchOutEdges(ToStorageVertices(vertices), edge_types);
+  }
+
+  void PrefetchInEdges(const std::vector<VertexAccessor> &vertices,
+                       const std::vector<storage::EdgeTypeId> &edge_types = {}) const {
+    accessor_->PrefetchInEdges(ToStorageVertices(vertices), edge_types);
+  }
+
   storage::Result<EdgeAccessor> InsertEdge(VertexAccessor *from, VertexAccessor *to,
                                            const storage::EdgeTypeId &edge_type) {
     auto maybe_edge = accessor_->CreateEdge(&from->impl_, &to->impl_, edge_type);
@@ -533,18 +715,49 @@ class DbAccessor final {
 
   void AdvanceCommand() { accessor_->AdvanceCommand(); }
 
+  void ReadStateBeforeTransaction(bool enabled) { accessor_->ReadStateBeforeTransaction(enabled); }
+
   utils::BasicResult<storage::StorageDataManipulationError, void> Commit() { return accessor_->Commit(); }
 
   void Abort() { accessor_->Abort(); }
 
   storage::StorageMode GetStorageMode() const { return accessor_->GetCreationStorageMode(); }
 
+  std::optional<storage::SnapshotId> GetSnapshotId() const { return accessor_->GetSnapshotId(); }
+
   bool LabelIndexExists(storage::LabelId label) const { return accessor_->LabelIndexExists(label); }
 
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId prop) const {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label,
+                                         const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->LabelPropertyCompositeIndexExists(label, properties);
+  }
+
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    return accessor_->LabelPropertyCompositeIndices(label);
+  }
+
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
+  bool TextIndexExists(storage::LabelId label, storage::PropertyId property) const {
+    return accessor_->TextIndexExists(label, property);
+  }
+
+  bool PointIndexExists(storage::LabelId label, storage::PropertyId property) const {
+    return accessor_->PointIndexExists(label, property);
+  }
+
+  bool VectorIndexExists(storage::LabelId label, storage::PropertyId property) const {
+    return accessor_->VectorIndexExists(label, property);
+  }
+
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const {
     return accessor_->GetIndexStats(label);
   }
@@ -554,10 +767,19 @@ class DbAccessor final {
     return accessor_->GetIndexStats(label, property);
   }
 
+  std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+      const storage::LabelId &label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->GetIndexStats(label, properties);
+  }
+
   std::vector<std::pair<storage::LabelId, storage::PropertyId>> ClearLabelPropertyIndexStats() {
     return accessor_->ClearLabelPropertyIndexStats();
   }
 
+  std::vector<std::pair<storage::LabelId, std::vector<storage::PropertyId>>> ClearLabelPropertyCompositeIndexStats() {
+    return accessor_->ClearLabelPropertyCompositeIndexStats();
+  }
+
   std::vector<storage::LabelId> ClearLabelIndexStats() { return accessor_->ClearLabelIndexStats(); }
 
   std::vector<std::pair<storage::LabelId, storage::PropertyId>> DeleteLabelPropertyIndexStats(
@@ -565,6 +787,11 @@ class DbAccessor final {
     return accessor_->DeleteLabelPropertyIndexStats(labels);
   }
 
+  std::vector<std::pair<storage::LabelId, std::vector<storage::PropertyId>>> DeleteLabelPropertyCompositeIndexStats(
+      const std::span<std::string> labels) {
+    return accessor_->DeleteLabelPropertyCompositeIndexStats(labels);
+  }
+
   std::vector<storage::LabelId> DeleteLabelIndexStats(const std::span<std::string> labels) {
     return accessor_->DeleteLabelIndexStats(labels);
   }
@@ -578,6 +805,11 @@ class DbAccessor final {
     accessor_->SetIndexStats(label, property, stats);
   }
 
+  void SetIndexStats(const storage::LabelId &label, const std::vector<storage::PropertyId> &properties,
+                     const storage::LabelPropertyIndexStats &stats) {
+    accessor_->SetIndexStats(label, properties, stats);
+  }
+
   int64_t VerticesCount() const { return accessor_->ApproximateVertexCount(); }
 
   int64_t VerticesCount(storage::LabelId label) const { return accessor_->ApproximateVertexCount(label); }
@@ -597,6 +829,56 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->ApproximateVertexCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &upper) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix, lower, upper);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, storage::PropertyId property, storage::TextMatch match,
+                        std::string_view pattern) const {
+    return accessor_->ApproximateVertexCount(label, property, match, pattern);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, storage::PropertyId property,
+                        const storage::PointRegion &region) const {
+    return accessor_->ApproximateVertexCount(label, property, region);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) const { return accessor_->ApproximateEdgeCount(edge_type); }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const storage::PropertyValue &value) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property, value);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &upper) const {
+    return accessor_->ApproximateEdgeCount(edge_type, property, lower, upper);
+  }
+
+  /// Exact counts, empty unless the storage keeps them for the transaction.
+  std::optional<uint64_t> ExactVerticesCount(storage::LabelId label) const { return accessor_->VertexCount(label); }
+
+  std::optional<uint64_t> ExactEdgesCount(storage::EdgeTypeId edge_type) const {
+    return accessor_->EdgeCount(edge_type);
+  }
+
   storage::IndicesInfo ListAllIndices() const { return accessor_->ListAllIndices(); }
 
   storage::ConstraintsInfo ListAllConstraints() const { return accessor_->ListAllConstraints(); }
@@ -110,6 +110,18 @@ void DumpTemporalData(std::ostream &os, const storage::TemporalData &value) {
     }
   }
 }
+
+void DumpPoint(std::ostream *os, const storage::Point &point) {
+  *os << "point({x: ";
+  DumpPreciseDouble(os, point.x);
+  *os << ", y: ";
+  DumpPreciseDouble(os, point.y);
+  if (storage::Is3d(point.crs)) {
+    *os << ", z: ";
+    DumpPreciseDouble(os, point.z);
+  }
+  *os << ", srid: " << static_cast<uint16_t>(point.crs) << "})";
+}
 }  // namespace
 
 void DumpPropertyValue(std::ostream *os, const storage::PropertyValue &value) {
@@ -150,6 +162,10 @@ void DumpPropertyValue(std::ostream *os, const storage::PropertyValue &value) {
       DumpTemporalData(*os, value.ValueTemporalData());
       return;
     }
+    case storage::PropertyValue::Type::Point: {
+      DumpPoint(os, value.ValuePoint());
+      return;
+    }
   }
 }
 
@@ -245,6 +261,40 @@ void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::L
       << ");";
 }
 
+void DumpLabelPropertyCompositeIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                     const std::vector<storage::PropertyId> &properties) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, properties, ", ", [&dba](auto &stream, const auto &property) {
+    stream << EscapeName(dba->PropertyToName(property));
+  });
+  *os << ");";
+}
+
+void DumpEdgeTypeIndex(std::ostream *os, query::DbAccessor *dba, const storage::EdgeTypeId edge_type) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << ";";
+}
+
+void DumpEdgeTypePropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::EdgeTypeId edge_type,
+                               storage::PropertyId property) {
+  *os << "CREATE EDGE INDEX ON :" << EscapeName(dba->EdgeTypeToName(edge_type)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
+void DumpTextIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label, storage::PropertyId property) {
+  *os << "CREATE TEXT INDEX ON :" << EscapeName(dba->LabelToName(label)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
+void DumpPointIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label, storage::PropertyId property) {
+  *os << "CREATE POINT INDEX ON :" << EscapeName(dba->LabelToName(label)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
+void DumpVectorIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label, storage::PropertyId property) {
+  *os << "CREATE VECTOR INDEX ON :" << EscapeName(dba->LabelToName(label)) << "("
+      << EscapeName(dba->PropertyToName(property)) << ");";
+}
+
 void DumpExistenceConstraint(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
                              storage::PropertyId property) {
   *os << "CREATE CONSTRAINT ON (u:" << EscapeName(dba->LabelToName(label)) << ") ASSERT EXISTS (u."
@@ -269,6 +319,18 @@ PullPlanDump::PullPlanDump(DbAccessor *dba)
                    CreateLabelIndicesPullChunk(),
                    // Dump all label property indices
                    CreateLabelPropertyIndicesPullChunk(),
+                   // Dump all composite label property indices
+                   CreateLabelPropertyCompositeIndicesPullChunk(),
+                   // Dump all edge type indices
+                   CreateEdgeTypeIndicesPullChunk(),
+                   // Dump all edge type property indices
+                   CreateEdgeTypePropertyIndicesPullChunk(),
+                   // Dump all text indices
+                   CreateTextIndicesPullChunk(),
+                   // Dump all point indices
+                   CreatePointIndicesPullChunk(),
+                   // Dump all vector indices
+                   CreateVectorIndicesPullChunk(),
                    // Dump all existence constraints
                    CreateExistenceConstraintsPullChunk(),
                    // Dump all unique constraints
@@ -364,6 +426,168 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
   };
 }
 
+PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyCompositeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &label_property_composite = indices_info_->label_property_composite;
+
+    size_t local_counter = 0;
+    while (global_index < label_property_composite.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &label_property_composite_index = label_property_composite[global_index];
+      DumpLabelPropertyCompositeIndex(&os, dba_, label_property_composite_index.first,
+                                      label_property_composite_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == label_property_composite.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateEdgeTypeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &edge_type = indices_info_->edge_type;
+
+    size_t local_counter = 0;
+    while (global_index < edge_type.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      DumpEdgeTypeIndex(&os, dba_, edge_type[global_index]);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == edge_type.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateEdgeTypePropertyIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &edge_type_property = indices_info_->edge_type_property;
+
+    size_t local_counter = 0;
+    while (global_index < edge_type_property.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &edge_type_property_index = edge_type_property[global_index];
+      DumpEdgeTypePropertyIndex(&os, dba_, edge_type_property_index.first, edge_type_property_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == edge_type_property.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateTextIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &text = indices_info_->text;
+
+    size_t local_counter = 0;
+    while (global_index < text.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &text_index = text[global_index];
+      DumpTextIndex(&os, dba_, text_index.first, text_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == text.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreatePointIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &point = indices_info_->point;
+
+    size_t local_counter = 0;
+    while (global_index < point.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &point_index = point[global_index];
+      DumpPointIndex(&os, dba_, point_index.first, point_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == point.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
+PullPlanDump::PullChunk PullPlanDump::CreateVectorIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &vector = indices_info_->vector;
+
+    size_t local_counter = 0;
+    while (global_index < vector.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &vector_index = vector[global_index];
+      DumpVectorIndex(&os, dba_, vector_index.first, vector_index.second);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == vector.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
 PullPlanDump::PullChunk PullPlanDump::CreateExistenceConstraintsPullChunk() {
   return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
     // Delay the construction of constraint vectors
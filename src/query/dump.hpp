@@ -55,6 +55,12 @@ struct PullPlanDump {
 
   PullChunk CreateLabelIndicesPullChunk();
   PullChunk CreateLabelPropertyIndicesPullChunk();
+  PullChunk CreateLabelPropertyCompositeIndicesPullChunk();
+  PullChunk CreateEdgeTypeIndicesPullChunk();
+  PullChunk CreateEdgeTypePropertyIndicesPullChunk();
+  PullChunk CreateTextIndicesPullChunk();
+  PullChunk CreatePointIndicesPullChunk();
+  PullChunk CreateVectorIndicesPullChunk();
   PullChunk CreateExistenceConstraintsPullChunk();
   PullChunk CreateUniqueConstraintsPullChunk();
   PullChunk CreateInternalIndexPullChunk();
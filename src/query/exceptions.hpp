@@ -247,6 +247,12 @@ class TriggerModificationInMulticommandTxException : public QueryException {
       : QueryException("Trigger queries not allowed in multicommand transactions.") {}
 };
 
+class MaterializedViewInMulticommandTxException : public QueryException {
+ public:
+  MaterializedViewInMulticommandTxException()
+      : QueryException("Materialized view queries not allowed in multicommand transactions.") {}
+};
+
 class StreamQueryInMulticommandTxException : public QueryException {
  public:
   StreamQueryInMulticommandTxException()
@@ -291,10 +297,22 @@ class CreateSnapshotDisabledOnDiskStorage final : public QueryException {
   CreateSnapshotDisabledOnDiskStorage() : QueryException("In the on-disk storage mode data is already persistent.") {}
 };
 
+class DumpToDirectoryInMulticommandTxException final : public QueryException {
+ public:
+  DumpToDirectoryInMulticommandTxException()
+      : QueryException("Database cannot be dumped to a directory in multicommand transactions.") {}
+};
+
+class DumpToDirectoryDisabledOnDiskStorage final : public QueryException {
+ public:
+  DumpToDirectoryDisabledOnDiskStorage()
+      : QueryException("Database can be dumped to a directory only in the in-memory storage modes.") {}
+};
+
 class EdgeImportModeQueryDisabledOnDiskStorage final : public QueryException {
  public:
   EdgeImportModeQueryDisabledOnDiskStorage()
-      : QueryException("Edge import mode is only allowed for on-disk storage mode.") {}
+      : QueryException("Edge import mode is only allowed for on-disk and in-memory analytical storage modes.") {}
 };
 
 class SettingConfigInMulticommandTxException final : public QueryException {
@@ -323,6 +341,16 @@ class ReplicationException : public utils::BasicException {
                               message) {}
 };
 
+// Inherited from BasicException so the client retries the transaction, which
+// succeeds once RocksDB's compactions catch up.
+class WriteStallException : public utils::BasicException {
+ public:
+  WriteStallException()
+      : utils::BasicException(
+            "Unable to commit because the on-disk storage is stalling writes until its compactions catch up. Retry "
+            "the transaction.") {}
+};
+
 class TransactionQueueInMulticommandTxException : public QueryException {
  public:
   TransactionQueueInMulticommandTxException()
@@ -345,4 +373,13 @@ class MultiDatabaseQueryInMulticommandTxException : public QueryException {
       : QueryException("Multi-database queries are not allowed in multicommand transactions.") {}
 };
 
+class MemoryEstimateExceededException : public QueryException {
+ public:
+  MemoryEstimateExceededException(uint64_t estimated_mib, uint64_t limit_mib)
+      : QueryException(
+            "The query is estimated to use {} MiB of memory, which is more than the limit of {} MiB. The limit is "
+            "set by the query_max_estimated_memory_mib flag.",
+            estimated_mib, limit_mib) {}
+};
+
 }  // namespace memgraph::query
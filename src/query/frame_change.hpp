@@ -8,26 +8,48 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+
 #include "query/typed_value.hpp"
 #include "utils/memory.hpp"
 #include "utils/pmr/unordered_map.hpp"
+#include "utils/pmr/unordered_set.hpp"
 #include "utils/pmr/vector.hpp"
 namespace memgraph::query {
 
 // Key is hash output, value is vector of unique elements
 using CachedType = utils::pmr::unordered_map<size_t, std::vector<TypedValue>>;
 
+// Hashes strings regardless of their allocators.
+struct StringViewHash {
+  size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+};
+
 struct CachedValue {
   // Cached value, this can be probably templateized
   CachedType cache_;
 
-  explicit CachedValue(utils::MemoryResource *mem) : cache_(mem) {}
+  // Integers and strings, which are the usual elements of the lists, are kept
+  // in sets of their own so they are probed without comparing TypedValues.
+  // Only the integers which can be exactly compared with doubles are kept in
+  // `ints_`, the other values are in `cache_`.
+  utils::pmr::unordered_set<int64_t> ints_;
+  utils::pmr::unordered_set<TypedValue::TString, StringViewHash> strings_;
 
-  CachedValue(CachedType &&cache, memgraph::utils::MemoryResource *memory) : cache_(std::move(cache), memory) {}
+  explicit CachedValue(utils::MemoryResource *mem) : cache_(mem), ints_(mem), strings_(mem) {}
 
-  CachedValue(const CachedValue &other, memgraph::utils::MemoryResource *memory) : cache_(other.cache_, memory) {}
+  CachedValue(CachedType &&cache, memgraph::utils::MemoryResource *memory)
+      : cache_(std::move(cache), memory), ints_(memory), strings_(memory) {}
 
-  CachedValue(CachedValue &&other, memgraph::utils::MemoryResource *memory) : cache_(std::move(other.cache_), memory) {}
+  CachedValue(const CachedValue &other, memgraph::utils::MemoryResource *memory)
+      : cache_(other.cache_, memory), ints_(other.ints_, memory), strings_(other.strings_, memory) {}
+
+  CachedValue(CachedValue &&other, memgraph::utils::MemoryResource *memory)
+      : cache_(std::move(other.cache_), memory),
+        ints_(std::move(other.ints_), memory),
+        strings_(std::move(other.strings_), memory) {}
 
   CachedValue(CachedValue &&other) noexcept = delete;
 
@@ -51,6 +73,14 @@ struct CachedValue {
     const auto &list = value.ValueList();
     TypedValue::Hash hash{};
     for (const TypedValue &element : list) {
+      if (element.IsInt() && IsExactDouble(element.ValueInt())) {
+        ints_.insert(element.ValueInt());
+        continue;
+      }
+      if (element.IsString()) {
+        strings_.insert(element.ValueString());
+        continue;
+      }
       const auto key = hash(element);
       auto &vector_values = cache_[key];
       if (!IsValueInVec(vector_values, element)) {
@@ -61,6 +91,17 @@ struct CachedValue {
   }
   // Func to cache_value inside cache_
   bool ContainsValue(const TypedValue &value) const {
+    if (value.IsString()) return strings_.contains(value.ValueString());
+    if (value.IsInt() && ints_.contains(value.ValueInt())) return true;
+    if (value.IsDouble()) {
+      // Integers are equal to the doubles with the same value.
+      const auto double_value = value.ValueDouble();
+      if (double_value == std::trunc(double_value) && std::abs(double_value) <= kMaxExactDouble &&
+          ints_.contains(static_cast<int64_t>(double_value))) {
+        return true;
+      }
+    }
+    if (cache_.empty()) return false;
     TypedValue::Hash hash{};
     const auto key = hash(value);
     if (cache_.contains(key)) {
@@ -69,7 +110,14 @@ struct CachedValue {
     return false;
   }
 
+  bool Empty() const { return cache_.empty() && ints_.empty() && strings_.empty(); }
+
  private:
+  // Integers up to 2^53 are converted to doubles without losing precision.
+  static constexpr int64_t kMaxExactDouble = int64_t{1} << 53;
+
+  static bool IsExactDouble(int64_t value) { return value >= -kMaxExactDouble && value <= kMaxExactDouble; }
+
   bool IsValueInVec(const std::vector<TypedValue> &vec_values, const TypedValue &value) const {
     return std::any_of(vec_values.begin(), vec_values.end(), [&value](auto &vec_value) {
       const auto is_value_equal = vec_value == value;
@@ -96,7 +144,7 @@ class FrameChangeCollector {
 
   // Is value for given key cached
   bool IsKeyValueCached(const std::string &key) const {
-    return tracked_values_.contains(key) && !tracked_values_.at(key).cache_.empty();
+    return tracked_values_.contains(key) && !tracked_values_.at(key).Empty();
   }
 
   // Reset value for tracking key
@@ -289,4 +289,7 @@ constexpr utils::TypeInfo query::ShowDatabasesQuery::kType{utils::TypeId::AST_SH
 constexpr utils::TypeInfo query::EdgeImportModeQuery::kType{utils::TypeId::AST_EDGE_IMPORT_MODE_QUERY,
                                                             "EdgeImportModeQuery", &query::Query::kType};
 
+constexpr utils::TypeInfo query::MaterializedViewQuery::kType{utils::TypeId::AST_MATERIALIZED_VIEW_QUERY,
+                                                              "MaterializedViewQuery", &query::Query::kType};
+
 }  // namespace memgraph
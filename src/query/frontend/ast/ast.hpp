@@ -1034,6 +1034,9 @@ class ListLiteral : public memgraph::query::BaseLiteral {
   }
 
   std::vector<memgraph::query::Expression *> elements_;
+  /// Set if the value only depends on literals and parameters, so it is
+  /// evaluated once per query execution.
+  bool is_constant_{false};
 
   ListLiteral *Clone(AstStorage *storage) const override {
     ListLiteral *object = storage->Create<ListLiteral>();
@@ -1041,6 +1044,7 @@ class ListLiteral : public memgraph::query::BaseLiteral {
     for (auto i0 = 0; i0 < elements_.size(); ++i0) {
       object->elements_[i0] = elements_[i0] ? elements_[i0]->Clone(storage) : nullptr;
     }
+    object->is_constant_ = is_constant_;
     return object;
   }
 
@@ -1071,6 +1075,9 @@ class MapLiteral : public memgraph::query::BaseLiteral {
   }
 
   std::unordered_map<memgraph::query::PropertyIx, memgraph::query::Expression *> elements_;
+  /// Set if the value only depends on literals and parameters, so it is
+  /// evaluated once per query execution.
+  bool is_constant_{false};
 
   MapLiteral *Clone(AstStorage *storage) const override {
     MapLiteral *object = storage->Create<MapLiteral>();
@@ -1078,6 +1085,7 @@ class MapLiteral : public memgraph::query::BaseLiteral {
       PropertyIx key = storage->GetPropertyIx(entry.first.name);
       object->elements_[key] = entry.second->Clone(storage);
     }
+    object->is_constant_ = is_constant_;
     return object;
   }
 
@@ -1310,6 +1318,9 @@ class Function : public memgraph::query::Expression {
   std::vector<memgraph::query::Expression *> arguments_;
   std::string function_name_;
   std::function<TypedValue(const TypedValue *, int64_t, const FunctionContext &)> function_;
+  /// Set if the value only depends on literals and parameters, so it is
+  /// evaluated once per query execution.
+  bool is_constant_{false};
 
   Function *Clone(AstStorage *storage) const override {
     Function *object = storage->Create<Function>();
@@ -1319,6 +1330,7 @@ class Function : public memgraph::query::Expression {
     }
     object->function_name_ = function_name_;
     object->function_ = function_;
+    object->is_constant_ = is_constant_;
     return object;
   }
 
@@ -2163,18 +2175,33 @@ class IndexQuery : public memgraph::query::Query {
 
   enum class Action { CREATE, DROP };
 
+  /// Whether the index is on vertices with `label_` or on edges with
+  /// `edge_type_`. `TEXT` indices are on vertices with `label_`, indexing the
+  /// terms of the single property in `properties_`. `POINT` indices are on
+  /// vertices with `label_`, indexing the point values of the single property
+  /// in `properties_`. `VECTOR` indices are on vertices with `label_`,
+  /// indexing the lists of numbers of the single property in `properties_`.
+  enum class Type { LABEL, EDGE_TYPE, TEXT, POINT, VECTOR };
+
   IndexQuery() = default;
 
   DEFVISITABLE(QueryVisitor<void>);
 
   memgraph::query::IndexQuery::Action action_;
+  memgraph::query::IndexQuery::Type type_{Type::LABEL};
   memgraph::query::LabelIx label_;
+  memgraph::query::EdgeTypeIx edge_type_;
   std::vector<memgraph::query::PropertyIx> properties_;
 
   IndexQuery *Clone(AstStorage *storage) const override {
     IndexQuery *object = storage->Create<IndexQuery>();
     object->action_ = action_;
-    object->label_ = storage->GetLabelIx(label_.name);
+    object->type_ = type_;
+    if (type_ != Type::EDGE_TYPE) {
+      object->label_ = storage->GetLabelIx(label_.name);
+    } else {
+      object->edge_type_ = storage->GetEdgeTypeIx(edge_type_.name);
+    }
     object->properties_.resize(properties_.size());
     for (auto i = 0; i < object->properties_.size(); ++i) {
       object->properties_[i] = storage->GetPropertyIx(properties_[i].name);
@@ -2902,7 +2929,7 @@ class InfoQuery : public memgraph::query::Query {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class InfoType { STORAGE, INDEX, CONSTRAINT, BUILD };
+  enum class InfoType { STORAGE, INDEX, CONSTRAINT, BUILD, SLOW_QUERIES, INDEX_RECOMMENDATIONS };
 
   DEFVISITABLE(QueryVisitor<void>);
 
@@ -2964,8 +2991,13 @@ class DumpQuery : public memgraph::query::Query {
 
   DEFVISITABLE(QueryVisitor<void>);
 
+  /// Directory to which the database is written in the snapshot format
+  /// instead of being returned as Cypher queries.
+  memgraph::query::Expression *directory_{nullptr};
+
   DumpQuery *Clone(AstStorage *storage) const override {
     DumpQuery *object = storage->Create<DumpQuery>();
+    object->directory_ = directory_ ? directory_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -3163,6 +3195,33 @@ class TriggerQuery : public memgraph::query::Query {
   friend class AstStorage;
 };
 
+class MaterializedViewQuery : public memgraph::query::Query {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  enum class Action { CREATE_VIEW, DROP_VIEW, SHOW_VIEWS, SHOW_VIEW };
+
+  MaterializedViewQuery() = default;
+
+  DEFVISITABLE(QueryVisitor<void>);
+
+  memgraph::query::MaterializedViewQuery::Action action_;
+  std::string view_name_;
+  std::string statement_;
+
+  MaterializedViewQuery *Clone(AstStorage *storage) const override {
+    auto *object = storage->Create<MaterializedViewQuery>();
+    object->action_ = action_;
+    object->view_name_ = view_name_;
+    object->statement_ = statement_;
+    return object;
+  }
+
+ private:
+  friend class AstStorage;
+};
+
 class IsolationLevelQuery : public memgraph::query::Query {
  public:
   static const utils::TypeInfo kType;
@@ -3262,6 +3321,7 @@ class StreamQuery : public memgraph::query::Query {
   memgraph::query::Expression *service_url_{nullptr};
   std::unordered_map<memgraph::query::Expression *, memgraph::query::Expression *> configs_;
   std::unordered_map<memgraph::query::Expression *, memgraph::query::Expression *> credentials_;
+  memgraph::query::Expression *workers_{nullptr};
 
   StreamQuery *Clone(AstStorage *storage) const override {
     StreamQuery *object = storage->Create<StreamQuery>();
@@ -3291,6 +3351,7 @@ class StreamQuery : public memgraph::query::Query {
     for (const auto &[key, value] : credentials_) {
       object->credentials_[key->Clone(storage)] = value->Clone(storage);
     }
+    object->workers_ = workers_ ? workers_->Clone(storage) : nullptr;
     return object;
   }
 
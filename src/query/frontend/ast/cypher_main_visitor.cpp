@@ -128,6 +128,12 @@ antlrcpp::Any CypherMainVisitor::visitInfoQuery(MemgraphCypher::InfoQueryContext
   } else if (ctx->buildInfo()) {
     info_query->info_type_ = InfoQuery::InfoType::BUILD;
     return info_query;
+  } else if (ctx->slowQueriesInfo()) {
+    info_query->info_type_ = InfoQuery::InfoType::SLOW_QUERIES;
+    return info_query;
+  } else if (ctx->indexRecommendationsInfo()) {
+    info_query->info_type_ = InfoQuery::InfoType::INDEX_RECOMMENDATIONS;
+    return info_query;
   } else {
     throw utils::NotYetImplemented("Info query: '{}'", ctx->getText());
   }
@@ -214,9 +220,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::CREATE;
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
-  if (ctx->propertyKeyName()) {
-    auto name_key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {name_key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
   }
   return index_query;
 }
@@ -224,11 +229,114 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
 antlrcpp::Any CypherMainVisitor::visitDropIndex(MemgraphCypher::DropIndexContext *ctx) {
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::DROP;
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
+  }
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "EdgeIndexQuery should have exactly one child!");
+  auto *index_query = std::any_cast<IndexQuery *>(ctx->children[0]->accept(this));
+  query_ = index_query;
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::CREATE;
+  index_query->type_ = IndexQuery::Type::EDGE_TYPE;
+  index_query->edge_type_ = AddEdgeType(std::any_cast<std::string>(ctx->relTypeName()->accept(this)));
   if (ctx->propertyKeyName()) {
-    auto key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {key};
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
   }
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::DROP;
+  index_query->type_ = IndexQuery::Type::EDGE_TYPE;
+  index_query->edge_type_ = AddEdgeType(std::any_cast<std::string>(ctx->relTypeName()->accept(this)));
+  if (ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  }
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitTextIndexQuery(MemgraphCypher::TextIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "TextIndexQuery should have exactly one child!");
+  auto *index_query = std::any_cast<IndexQuery *>(ctx->children[0]->accept(this));
+  query_ = index_query;
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateTextIndex(MemgraphCypher::CreateTextIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::CREATE;
+  index_query->type_ = IndexQuery::Type::TEXT;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropTextIndex(MemgraphCypher::DropTextIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::DROP;
+  index_query->type_ = IndexQuery::Type::TEXT;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitPointIndexQuery(MemgraphCypher::PointIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "PointIndexQuery should have exactly one child!");
+  auto *index_query = std::any_cast<IndexQuery *>(ctx->children[0]->accept(this));
+  query_ = index_query;
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreatePointIndex(MemgraphCypher::CreatePointIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::CREATE;
+  index_query->type_ = IndexQuery::Type::POINT;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropPointIndex(MemgraphCypher::DropPointIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::DROP;
+  index_query->type_ = IndexQuery::Type::POINT;
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitVectorIndexQuery(MemgraphCypher::VectorIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "VectorIndexQuery should have exactly one child!");
+  auto *index_query = std::any_cast<IndexQuery *>(ctx->children[0]->accept(this));
+  query_ = index_query;
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateVectorIndex(MemgraphCypher::CreateVectorIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::CREATE;
+  index_query->type_ = IndexQuery::Type::VECTOR;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropVectorIndex(MemgraphCypher::DropVectorIndexContext *ctx) {
+  auto *index_query = storage_->Create<IndexQuery>();
+  index_query->action_ = IndexQuery::Action::DROP;
+  index_query->type_ = IndexQuery::Type::VECTOR;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->properties_.push_back(std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this)));
   return index_query;
 }
 
@@ -241,6 +349,12 @@ antlrcpp::Any CypherMainVisitor::visitAuthQuery(MemgraphCypher::AuthQueryContext
 
 antlrcpp::Any CypherMainVisitor::visitDumpQuery(MemgraphCypher::DumpQueryContext *ctx) {
   auto *dump_query = storage_->Create<DumpQuery>();
+  if (ctx->directory) {
+    if (!ctx->directory->StringLiteral()) {
+      throw SyntaxException("Dump directory should be a string literal.");
+    }
+    dump_query->directory_ = std::any_cast<Expression *>(ctx->directory->accept(this));
+  }
   query_ = dump_query;
   return dump_query;
 }
@@ -482,6 +596,44 @@ antlrcpp::Any CypherMainVisitor::visitShowTriggers(MemgraphCypher::ShowTriggersC
   return trigger_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitMaterializedViewQuery(MemgraphCypher::MaterializedViewQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "MaterializedViewQuery should have exactly one child!");
+  auto *materialized_view_query = std::any_cast<MaterializedViewQuery *>(ctx->children[0]->accept(this));
+  query_ = materialized_view_query;
+  return materialized_view_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitCreateMaterializedView(MemgraphCypher::CreateMaterializedViewContext *ctx) {
+  auto *materialized_view_query = storage_->Create<MaterializedViewQuery>();
+  materialized_view_query->action_ = MaterializedViewQuery::Action::CREATE_VIEW;
+  materialized_view_query->view_name_ = std::any_cast<std::string>(ctx->viewName()->symbolicName()->accept(this));
+
+  auto *statement = ctx->viewStatement();
+  antlr4::misc::Interval interval{statement->start->getStartIndex(), statement->stop->getStopIndex()};
+  materialized_view_query->statement_ = ctx->start->getInputStream()->getText(interval);
+  return materialized_view_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropMaterializedView(MemgraphCypher::DropMaterializedViewContext *ctx) {
+  auto *materialized_view_query = storage_->Create<MaterializedViewQuery>();
+  materialized_view_query->action_ = MaterializedViewQuery::Action::DROP_VIEW;
+  materialized_view_query->view_name_ = std::any_cast<std::string>(ctx->viewName()->symbolicName()->accept(this));
+  return materialized_view_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitShowMaterializedViews(MemgraphCypher::ShowMaterializedViewsContext * /*ctx*/) {
+  auto *materialized_view_query = storage_->Create<MaterializedViewQuery>();
+  materialized_view_query->action_ = MaterializedViewQuery::Action::SHOW_VIEWS;
+  return materialized_view_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitShowMaterializedView(MemgraphCypher::ShowMaterializedViewContext *ctx) {
+  auto *materialized_view_query = storage_->Create<MaterializedViewQuery>();
+  materialized_view_query->action_ = MaterializedViewQuery::Action::SHOW_VIEW;
+  materialized_view_query->view_name_ = std::any_cast<std::string>(ctx->viewName()->symbolicName()->accept(this));
+  return materialized_view_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitIsolationLevelQuery(MemgraphCypher::IsolationLevelQueryContext *ctx) {
   auto *isolation_level_query = storage_->Create<IsolationLevelQuery>();
 
@@ -606,7 +758,7 @@ std::string_view ToString(const CommonStreamConfigKey key) {
     __VA_ARGS__                                                      \
   };
 
-GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS);
+GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS, WORKERS);
 
 std::string_view ToString(const KafkaConfigKey key) {
   switch (key) {
@@ -620,6 +772,8 @@ std::string_view ToString(const KafkaConfigKey key) {
       return "CONFIGS";
     case KafkaConfigKey::CREDENTIALS:
       return "CREDENTIALS";
+    case KafkaConfigKey::WORKERS:
+      return "WORKERS";
   }
 }
 
@@ -663,6 +817,7 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStream(MemgraphCypher::KafkaCre
                                                                    stream_query->configs_);
   MapConfig<false, std::unordered_map<Expression *, Expression *>>(memory_, KafkaConfigKey::CREDENTIALS,
                                                                    stream_query->credentials_);
+  MapConfig<false, Expression *>(memory_, KafkaConfigKey::WORKERS, stream_query->workers_);
 
   MapCommonStreamConfigs(memory_, *stream_query);
 
@@ -727,6 +882,16 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStreamConfig(MemgraphCypher::Ka
     return {};
   }
 
+  if (ctx->WORKERS()) {
+    ThrowIfExists(memory_, KafkaConfigKey::WORKERS);
+    if (!ctx->workers->numberLiteral() || !ctx->workers->numberLiteral()->integerLiteral()) {
+      throw SemanticException("Workers must be an integer literal!");
+    }
+    static constexpr auto workers_key = static_cast<uint8_t>(KafkaConfigKey::WORKERS);
+    memory_[workers_key] = std::any_cast<Expression *>(ctx->workers->accept(this));
+    return {};
+  }
+
   MG_ASSERT(ctx->BOOTSTRAP_SERVERS());
   ThrowIfExists(memory_, KafkaConfigKey::BOOTSTRAP_SERVERS);
   if (!ctx->bootstrapServers->StringLiteral()) {
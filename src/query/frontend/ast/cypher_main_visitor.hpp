@@ -261,6 +261,31 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitShowTriggers(MemgraphCypher::ShowTriggersContext *ctx) override;
 
+  /**
+   * @return MaterializedViewQuery*
+   */
+  antlrcpp::Any visitMaterializedViewQuery(MemgraphCypher::MaterializedViewQueryContext *ctx) override;
+
+  /**
+   * @return MaterializedViewQuery*
+   */
+  antlrcpp::Any visitCreateMaterializedView(MemgraphCypher::CreateMaterializedViewContext *ctx) override;
+
+  /**
+   * @return MaterializedViewQuery*
+   */
+  antlrcpp::Any visitDropMaterializedView(MemgraphCypher::DropMaterializedViewContext *ctx) override;
+
+  /**
+   * @return MaterializedViewQuery*
+   */
+  antlrcpp::Any visitShowMaterializedViews(MemgraphCypher::ShowMaterializedViewsContext *ctx) override;
+
+  /**
+   * @return MaterializedViewQuery*
+   */
+  antlrcpp::Any visitShowMaterializedView(MemgraphCypher::ShowMaterializedViewContext *ctx) override;
+
   /**
    * @return IsolationLevelQuery*
    */
@@ -461,6 +486,66 @@ class CypherMainVisitor : public antlropencypher::MemgraphCypherBaseVisitor {
    */
   antlrcpp::Any visitDropIndex(MemgraphCypher::DropIndexContext *ctx) override;
 
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitEdgeIndexQuery(MemgraphCypher::EdgeIndexQueryContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitCreateEdgeIndex(MemgraphCypher::CreateEdgeIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitDropEdgeIndex(MemgraphCypher::DropEdgeIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitTextIndexQuery(MemgraphCypher::TextIndexQueryContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitCreateTextIndex(MemgraphCypher::CreateTextIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitDropTextIndex(MemgraphCypher::DropTextIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitPointIndexQuery(MemgraphCypher::PointIndexQueryContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitCreatePointIndex(MemgraphCypher::CreatePointIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitDropPointIndex(MemgraphCypher::DropPointIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitVectorIndexQuery(MemgraphCypher::VectorIndexQueryContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitCreateVectorIndex(MemgraphCypher::CreateVectorIndexContext *ctx) override;
+
+  /**
+   * @return IndexQuery*
+   */
+  antlrcpp::Any visitDropVectorIndex(MemgraphCypher::DropVectorIndexContext *ctx) override;
+
   /**
    * @return AuthQuery*
    */
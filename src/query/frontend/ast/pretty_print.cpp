@@ -169,6 +169,9 @@ void PrintObject(std::ostream *out, const storage::PropertyValue &value) {
     case storage::PropertyValue::Type::TemporalData:
       PrintObject(out, value.ValueTemporalData());
       break;
+    case storage::PropertyValue::Type::Point:
+      PrintObject(out, value.ValuePoint());
+      break;
   }
 }
 
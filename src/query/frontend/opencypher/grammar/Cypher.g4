@@ -48,7 +48,11 @@ constraintInfo : CONSTRAINT INFO ;
 
 buildInfo : BUILD INFO ;
 
-infoQuery : SHOW ( storageInfo | indexInfo | constraintInfo | buildInfo) ;
+slowQueriesInfo : SLOW QUERIES ;
+
+indexRecommendationsInfo : INDEX RECOMMENDATIONS ;
+
+infoQuery : SHOW ( storageInfo | indexInfo | constraintInfo | buildInfo | slowQueriesInfo | indexRecommendationsInfo ) ;
 
 explainQuery : EXPLAIN cypherQuery ;
 
@@ -328,9 +332,9 @@ integerLiteral : DecimalLiteral
                | HexadecimalLiteral
                ;
 
-createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+createIndex : CREATE INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? ;
 
-dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ')' )? ;
+dropIndex : DROP INDEX ON ':' labelName ( '(' propertyKeyName ( ',' propertyKeyName )* ')' )? ;
 
 doubleLiteral : FloatingLiteral ;
 
@@ -73,15 +73,18 @@ memgraphCypherKeyword : cypherKeyword
                       | LOAD
                       | LOCK
                       | MAIN
+                      | MATERIALIZED
                       | MODE
                       | NEXT
                       | NO
                       | NOTHING
                       | PASSWORD
+                      | POINT
                       | PULSAR
                       | PORT
                       | PRIVILEGES
                       | READ
+                      | RECOMMENDATIONS
                       | REGISTER
                       | REPLICA
                       | REPLICAS
@@ -89,10 +92,12 @@ memgraphCypherKeyword : cypherKeyword
                       | REVOKE
                       | ROLE
                       | ROLES
+                      | QUERIES
                       | QUOTE
                       | SESSION
                       | SETTING
                       | SETTINGS
+                      | SLOW
                       | SNAPSHOT
                       | START
                       | STATS
@@ -101,6 +106,7 @@ memgraphCypherKeyword : cypherKeyword
                       | STREAM
                       | STREAMS
                       | SYNC
+                      | TEXT
                       | TIMEOUT
                       | TO
                       | TOPICS
@@ -114,9 +120,13 @@ memgraphCypherKeyword : cypherKeyword
                       | USE
                       | USER
                       | USERS
+                      | VECTOR
                       | VERSION
+                      | VIEW
+                      | VIEWS
                       | TERMINATE
                       | TRANSACTIONS
+                      | WORKERS
                       ;
 
 symbolicName : UnescapedSymbolicName
@@ -126,6 +136,10 @@ symbolicName : UnescapedSymbolicName
 
 query : cypherQuery
       | indexQuery
+      | edgeIndexQuery
+      | textIndexQuery
+      | pointIndexQuery
+      | vectorIndexQuery
       | explainQuery
       | profileQuery
       | infoQuery
@@ -148,6 +162,7 @@ query : cypherQuery
       | multiDatabaseQuery
       | showDatabases
       | edgeImportModeQuery
+      | materializedViewQuery
       ;
 
 authQuery : createRole
@@ -183,6 +198,12 @@ triggerQuery : createTrigger
              | showTriggers
              ;
 
+materializedViewQuery : createMaterializedView
+                      | dropMaterializedView
+                      | showMaterializedViews
+                      | showMaterializedView
+                      ;
+
 clause : cypherMatch
        | unwind
        | merge
@@ -346,7 +367,7 @@ showRoleForUser : SHOW ROLE FOR user=userOrRoleName ;
 
 showUsersForRole : SHOW USERS FOR role=userOrRoleName ;
 
-dumpQuery: DUMP DATABASE ;
+dumpQuery: DUMP DATABASE ( TO directory=literal ) ? ;
 
 analyzeGraphQuery: ANALYZE GRAPH ( ON LABELS ( listOfColonSymbolicNames | ASTERISK ) ) ? ( DELETE STATISTICS ) ? ;
 
@@ -385,6 +406,18 @@ dropTrigger : DROP TRIGGER triggerName ;
 
 showTriggers : SHOW TRIGGERS ;
 
+viewName : symbolicName ;
+
+viewStatement : .*? ;
+
+createMaterializedView : CREATE MATERIALIZED VIEW viewName AS viewStatement ;
+
+dropMaterializedView : DROP MATERIALIZED VIEW viewName ;
+
+showMaterializedViews : SHOW MATERIALIZED VIEWS ;
+
+showMaterializedView : SHOW MATERIALIZED VIEW viewName ;
+
 isolationLevel : SNAPSHOT ISOLATION | READ COMMITTED | READ UNCOMMITTED ;
 
 isolationLevelScope : GLOBAL | SESSION | NEXT ;
@@ -423,6 +456,7 @@ kafkaCreateStreamConfig : TOPICS topicNames
                         | BOOTSTRAP_SERVERS bootstrapServers=literal
                         | CONFIGS configsMap=configMap
                         | CREDENTIALS credentialsMap=configMap
+                        | WORKERS workers=literal
                         | commonCreateStreamConfig
                         ;
 
@@ -482,3 +516,27 @@ dropDatabase : DROP DATABASE databaseName ;
 showDatabases: SHOW DATABASES ;
 
 edgeImportModeQuery : EDGE IMPORT MODE ( ACTIVE | INACTIVE ) ;
+
+edgeIndexQuery : createEdgeIndex | dropEdgeIndex ;
+
+createEdgeIndex : CREATE EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
+dropEdgeIndex : DROP EDGE INDEX ON ':' relTypeName ( '(' propertyKeyName ')' )? ;
+
+textIndexQuery : createTextIndex | dropTextIndex ;
+
+createTextIndex : CREATE TEXT INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+dropTextIndex : DROP TEXT INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+pointIndexQuery : createPointIndex | dropPointIndex ;
+
+createPointIndex : CREATE POINT INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+dropPointIndex : DROP POINT INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+vectorIndexQuery : createVectorIndex | dropVectorIndex ;
+
+createVectorIndex : CREATE VECTOR INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+dropVectorIndex : DROP VECTOR INDEX ON ':' labelName '(' propertyKeyName ')' ;
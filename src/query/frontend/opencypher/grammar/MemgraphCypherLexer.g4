@@ -82,6 +82,7 @@ LEVEL                   : L E V E L ;
 LOAD                    : L O A D ;
 LOCK                    : L O C K ;
 MAIN                    : M A I N ;
+MATERIALIZED            : M A T E R I A L I Z E D ;
 MODE                    : M O D E ;
 MODULE_READ             : M O D U L E UNDERSCORE R E A D ;
 MODULE_WRITE            : M O D U L E UNDERSCORE W R I T E ;
@@ -93,11 +94,13 @@ NOTHING                 : N O T H I N G ;
 ON_DISK_TRANSACTIONAL   : O N UNDERSCORE D I S K UNDERSCORE T R A N S A C T I O N A L ;
 NULLIF                  : N U L L I F ;
 PASSWORD                : P A S S W O R D ;
+POINT                   : P O I N T ;
 PORT                    : P O R T ;
 PRIVILEGES              : P R I V I L E G E S ;
 PULSAR                  : P U L S A R ;
 READ                    : R E A D ;
 READ_FILE               : R E A D UNDERSCORE F I L E ;
+RECOMMENDATIONS         : R E C O M M E N D A T I O N S ;
 REGISTER                : R E G I S T E R ;
 REPLICA                 : R E P L I C A ;
 REPLICAS                : R E P L I C A S ;
@@ -105,11 +108,13 @@ REPLICATION             : R E P L I C A T I O N ;
 REVOKE                  : R E V O K E ;
 ROLE                    : R O L E ;
 ROLES                   : R O L E S ;
+QUERIES                 : Q U E R I E S ;
 QUOTE                   : Q U O T E ;
 SERVICE_URL             : S E R V I C E UNDERSCORE U R L ;
 SESSION                 : S E S S I O N ;
 SETTING                 : S E T T I N G ;
 SETTINGS                : S E T T I N G S ;
+SLOW                    : S L O W ;
 SNAPSHOT                : S N A P S H O T ;
 START                   : S T A R T ;
 STATISTICS              : S T A T I S T I C S ;
@@ -122,6 +127,7 @@ STREAM                  : S T R E A M ;
 STREAMS                 : S T R E A M S ;
 SYNC                    : S Y N C ;
 TERMINATE               : T E R M I N A T E ;
+TEXT                    : T E X T ;
 TIMEOUT                 : T I M E O U T ;
 TO                      : T O ;
 TOPICS                  : T O P I C S;
@@ -137,5 +143,9 @@ UPDATE                  : U P D A T E ;
 USE                     : U S E ;
 USER                    : U S E R ;
 USERS                   : U S E R S ;
+VECTOR                  : V E C T O R ;
 VERSION                 : V E R S I O N ;
+VIEW                    : V I E W ;
+VIEWS                   : V I E W S ;
 WEBSOCKET               : W E B S O C K E T ;
+WORKERS                 : W O R K E R S ;
@@ -0,0 +1,79 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/frontend/semantic/constant_expressions.hpp"
+
+#include "query/frontend/ast/ast_visitor.hpp"
+#include "query/interpret/awesome_memgraph_functions.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+class ConstantExpressionChecker : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  // Any variable, including the ones bound inside of the expression by list
+  // comprehensions and reduce, makes the expression depend on the row.
+  bool Visit(Identifier &) override { return is_constant_ = false; }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+
+  bool PreVisit(Function &function) override {
+    if (!IsDeterministicFunction(function.function_name_)) is_constant_ = false;
+    return is_constant_;
+  }
+  bool PreVisit(Aggregation &) override { return is_constant_ = false; }
+  bool PreVisit(Exists &) override { return is_constant_ = false; }
+
+  bool is_constant_{true};
+};
+
+class ConstantExpressionMarker : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool Visit(Identifier &) override { return true; }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+
+  // The outermost constant expression is cached, so there is no need to mark
+  // the ones inside of it.
+  bool PreVisit(Function &function) override { return !Mark(function, &function.is_constant_); }
+  bool PreVisit(ListLiteral &literal) override { return !Mark(literal, &literal.is_constant_); }
+  bool PreVisit(MapLiteral &literal) override { return !Mark(literal, &literal.is_constant_); }
+
+ private:
+  static bool Mark(Expression &expression, bool *is_constant) {
+    *is_constant = IsConstantExpression(expression);
+    return *is_constant;
+  }
+};
+
+}  // namespace
+
+bool IsConstantExpression(Expression &expression) {
+  ConstantExpressionChecker checker;
+  expression.Accept(checker);
+  return checker.is_constant_;
+}
+
+void MarkConstantExpressions(CypherQuery *query) {
+  ConstantExpressionMarker marker;
+  query->Accept(marker);
+}
+
+}  // namespace memgraph::query
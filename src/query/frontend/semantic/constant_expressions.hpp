@@ -0,0 +1,28 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include "query/frontend/ast/ast.hpp"
+
+namespace memgraph::query {
+
+/// Returns true if the value of the expression only depends on literals,
+/// parameters and deterministic functions of them.
+bool IsConstantExpression(Expression &expression);
+
+/// Marks the function calls, list literals and map literals whose values are
+/// the same for every row of a query execution, so the evaluator computes
+/// them only once per execution. Literals are stripped into parameters before
+/// the query is planned, so the values can't be computed during planning.
+void MarkConstantExpressions(CypherQuery *query);
+
+}  // namespace memgraph::query
@@ -38,12 +38,14 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
   void Visit(InfoQuery &info_query) override {
     switch (info_query.info_type_) {
       case InfoQuery::InfoType::INDEX:
+      case InfoQuery::InfoType::INDEX_RECOMMENDATIONS:
         // TODO: This should be INDEX | STATS, but we don't have support for
         // *or* with privileges.
         AddPrivilege(AuthQuery::Privilege::INDEX);
         break;
       case InfoQuery::InfoType::STORAGE:
       case InfoQuery::InfoType::BUILD:
+      case InfoQuery::InfoType::SLOW_QUERIES:
         AddPrivilege(AuthQuery::Privilege::STATS);
         break;
       case InfoQuery::InfoType::CONSTRAINT:
@@ -89,6 +91,19 @@ class PrivilegeExtractor : public QueryVisitor<void>, public HierarchicalTreeVis
 
   void Visit(EdgeImportModeQuery & /*edge_import_mode_query*/) override {}
 
+  void Visit(MaterializedViewQuery &materialized_view_query) override {
+    switch (materialized_view_query.action_) {
+      case MaterializedViewQuery::Action::CREATE_VIEW:
+      case MaterializedViewQuery::Action::DROP_VIEW:
+        AddPrivilege(AuthQuery::Privilege::INDEX);
+        break;
+      case MaterializedViewQuery::Action::SHOW_VIEWS:
+      case MaterializedViewQuery::Action::SHOW_VIEW:
+        AddPrivilege(AuthQuery::Privilege::MATCH);
+        break;
+    }
+  }
+
   void Visit(VersionQuery & /*version_query*/) override { AddPrivilege(AuthQuery::Privilege::STATS); }
 
   void Visit(MultiDatabaseQuery &query) override {
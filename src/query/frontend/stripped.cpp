@@ -16,6 +16,7 @@
 #include <iostream>
 #include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "query/exceptions.hpp"
@@ -46,9 +47,19 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
     SPACE
   };
 
-  std::vector<std::pair<Token, std::string>> tokens;
-  std::string unstripped_chunk;
+  // Tokens and the strings joined into the stripped query are views of the
+  // original query or of the stripped token constants, so they don't allocate.
+  const std::string_view original(original_);
+  std::vector<std::pair<Token, std::string_view>> tokens;
+  std::string_view unstripped_chunk;
   for (int i = 0; i < static_cast<int>(original_.size());) {
+    // Whitespace can't be a part of any other token.
+    if (original_[i] == ' ' || original_[i] == '\t' || original_[i] == '\n' || original_[i] == '\r') {
+      const auto len = MatchWhitespaceAndComments(i);
+      tokens.emplace_back(Token::SPACE, original.substr(i, len));
+      i += len;
+      continue;
+    }
     Token token = Token::UNMATCHED;
     int len = 0;
     auto update = [&](int new_len, Token new_token) {
@@ -69,7 +80,7 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
     update(MatchUnescapedName(i), Token::UNESCAPED_NAME);
     update(MatchWhitespaceAndComments(i), Token::SPACE);
     if (token == Token::UNMATCHED) throw LexingException("Invalid query.");
-    tokens.emplace_back(token, original_.substr(i, len));
+    tokens.emplace_back(token, original.substr(i, len));
     i += len;
 
     // If we notice execute, we possibly create a trigger which has defined statements.
@@ -88,24 +99,22 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
       // trigger-name (5th element) can also be "execute" so we verify that the size is larger than 5
       if (token_span.size() > 5 && utils::IEquals(token_span[0].second, "create") &&
           utils::IEquals(token_span[2].second, "trigger")) {
-        unstripped_chunk = original_.substr(i);
+        unstripped_chunk = original.substr(i);
         break;
       }
     }
   }
 
-  std::vector<std::string> token_strings;
+  std::vector<std::string_view> token_strings;
+  token_strings.reserve(tokens.size() + 1);
   // A helper function that stores literal and its token position in a
   // literals_. In stripped query text literal is replaced with a new_value.
   // new_value can be any value that is lexed as a literal.
   auto replace_stripped = [this, &token_strings](int position, const auto &value, const std::string &new_value) {
     literals_.Add(position, storage::PropertyValue(value));
-    token_strings.push_back(new_value);
+    token_strings.emplace_back(new_value);
   };
 
-  // Copy original tokens because we need to use original case in named
-  // expressions and keywords in tokens will be lowercased in the next loop.
-  auto original_tokens = tokens;
   // For every token in original query remember token index in stripped query.
   std::vector<int> position_mapping(tokens.size(), -1);
 
@@ -134,13 +143,13 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
       case Token::SPACE:
         break;
       case Token::STRING:
-        replace_stripped(token_index, ParseStringLiteral(token.second), kStrippedStringToken);
+        replace_stripped(token_index, ParseStringLiteral(std::string(token.second)), kStrippedStringToken);
         break;
       case Token::INT:
-        replace_stripped(token_index, ParseIntegerLiteral(token.second), kStrippedIntToken);
+        replace_stripped(token_index, ParseIntegerLiteral(std::string(token.second)), kStrippedIntToken);
         break;
       case Token::REAL:
-        replace_stripped(token_index, ParseDoubleLiteral(token.second), kStrippedDoubleToken);
+        replace_stripped(token_index, ParseDoubleLiteral(std::string(token.second)), kStrippedDoubleToken);
         break;
       case Token::SPECIAL:
       case Token::ESCAPED_NAME:
@@ -148,7 +157,7 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
         token_strings.push_back(token.second);
         break;
       case Token::PARAMETER:
-        parameters_[token_index] = ParseParameter(token.second);
+        parameters_[token_index] = ParseParameter(std::string(token.second));
         token_strings.push_back(token.second);
         break;
     }
@@ -159,17 +168,17 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
   }
 
   if (!unstripped_chunk.empty()) {
-    token_strings.push_back(std::move(unstripped_chunk));
+    token_strings.push_back(unstripped_chunk);
   }
 
-  query_ = utils::Join(token_strings, " ");
+  utils::Join(&query_, token_strings, " ");
   hash_ = utils::Fnv(query_);
 
   auto it = tokens.begin();
   while (it != tokens.end()) {
     // Store nonaliased named expressions in returns in named_exprs_.
     it = std::find_if(it, tokens.end(),
-                      [](const std::pair<Token, std::string> &a) { return utils::IEquals(a.second, "return"); });
+                      [](const std::pair<Token, std::string_view> &a) { return utils::IEquals(a.second, "return"); });
     // There is no RETURN so there is nothing to do here.
     if (it == tokens.end()) return;
     // Skip RETURN;
@@ -233,9 +242,7 @@ StrippedQuery::StrippedQuery(const std::string &query) : original_(query) {
         // Named expression is not aliased. Save string disregarding leading and
         // trailing whitespaces.
         std::string s;
-        auto begin_token = it - tokens.begin() + original_tokens.begin();
-        auto end_token = last_non_space - tokens.begin() + original_tokens.begin() + 1;
-        for (auto kt = begin_token; kt != end_token; ++kt) {
+        for (auto kt = it; kt != last_non_space + 1; ++kt) {
           s += kt->second;
         }
         named_exprs_[position_mapping[it - tokens.begin()]] = s;
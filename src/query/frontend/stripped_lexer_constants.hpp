@@ -219,7 +219,14 @@ const trie::Trie kKeywords = {"union",
                               "directory",
                               "lock",
                               "unlock",
-                              "build"};
+                              "build",
+                              "workers",
+                              "slow",
+                              "queries",
+                              "materialized",
+                              "view",
+                              "views",
+                              "recommendations"};
 
 // Unicode codepoints that are allowed at the start of the unescaped name.
 const std::bitset<kBitsetSize> kUnescapedNameAllowedStarts(
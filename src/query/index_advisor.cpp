@@ -0,0 +1,164 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/index_advisor.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "query/plan/cost_params.hpp"
+#include "query/plan/preprocess.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+// Finds the filters whose input is a scan of the vertices by their label, and
+// the properties of the scanned vertices they compare with values which
+// don't depend on the vertices.
+class IndexCandidateFinder final : public plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  IndexCandidateFinder(const SymbolTable &symbol_table, const AstStorage &ast_storage, DbAccessor *db_accessor)
+      : symbol_table_(symbol_table), ast_storage_(ast_storage), db_accessor_(db_accessor) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool PreVisit(plan::Filter &op) override {
+    if (!op.input_ || op.input_->GetTypeInfo() != plan::ScanAllByLabel::kType) return true;
+    const auto &scan = static_cast<const plan::ScanAllByLabel &>(*op.input_);
+    std::vector<storage::PropertyId> equalities;
+    std::vector<storage::PropertyId> ranges;
+    AddConjuncts(op.expression_, scan.output_symbol_, &equalities, &ranges);
+    auto unique = [](std::vector<storage::PropertyId> *properties) {
+      std::sort(properties->begin(), properties->end());
+      properties->erase(std::unique(properties->begin(), properties->end()), properties->end());
+    };
+    if (!equalities.empty()) {
+      unique(&equalities);
+      candidates_.push_back({&op, scan.label_, std::move(equalities), true});
+    } else if (!ranges.empty()) {
+      candidates_.push_back({&op, scan.label_, {ranges.front()}, false});
+    }
+    return true;
+  }
+
+  bool Visit(plan::Once &) override { return true; }
+
+  std::vector<IndexCandidate> candidates_;
+
+ private:
+  void AddConjuncts(Expression *expression, const Symbol &symbol, std::vector<storage::PropertyId> *equalities,
+                    std::vector<storage::PropertyId> *ranges) {
+    if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+      AddConjuncts(and_op->expression1_, symbol, equalities, ranges);
+      AddConjuncts(and_op->expression2_, symbol, equalities, ranges);
+      return;
+    }
+    auto *binary = utils::Downcast<BinaryOperator>(expression);
+    if (!binary) return;
+    const bool is_equality = utils::Downcast<EqualOperator>(binary) != nullptr;
+    const bool is_in_list = utils::Downcast<InListOperator>(binary) != nullptr;
+    const bool is_range = utils::Downcast<LessOperator>(binary) || utils::Downcast<LessEqualOperator>(binary) ||
+                          utils::Downcast<GreaterOperator>(binary) || utils::Downcast<GreaterEqualOperator>(binary);
+    if (!is_equality && !is_in_list && !is_range) return;
+    for (auto [lhs, rhs] : {std::pair{binary->expression1_, binary->expression2_},
+                            std::pair{binary->expression2_, binary->expression1_}}) {
+      auto property = ScannedProperty(lhs, symbol);
+      if (property && !UsesSymbol(rhs, symbol)) {
+        (is_range ? ranges : equalities)->push_back(*property);
+        return;
+      }
+      // The property is only the element of the list.
+      if (is_in_list) return;
+    }
+  }
+
+  std::optional<storage::PropertyId> ScannedProperty(Expression *expression, const Symbol &symbol) const {
+    auto *lookup = utils::Downcast<PropertyLookup>(expression);
+    if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return std::nullopt;
+    auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+    if (!identifier || symbol_table_.at(*identifier) != symbol) return std::nullopt;
+    return db_accessor_->NameToProperty(ast_storage_.properties_[lookup->property_.ix]);
+  }
+
+  bool UsesSymbol(Expression *expression, const Symbol &symbol) const {
+    plan::UsedSymbolsCollector collector(symbol_table_);
+    expression->Accept(collector);
+    return collector.symbols_.contains(symbol);
+  }
+
+  const SymbolTable &symbol_table_;
+  const AstStorage &ast_storage_;
+  DbAccessor *db_accessor_;
+};
+
+// Cost of the scan of the rows found by the index which would replace the
+// filter.
+double IndexScanCost(const IndexCandidate &candidate) {
+  if (candidate.properties.size() > 1) return plan::CostParam::MakeScanAllByLabelProperties;
+  if (candidate.equality) return plan::CostParam::MakeScanAllByLabelPropertyValue;
+  return plan::CostParam::MakeScanAllByLabelPropertyRange;
+}
+
+}  // namespace
+
+std::vector<IndexCandidate> FindIndexCandidates(plan::LogicalOperator &root, const SymbolTable &symbol_table,
+                                                const AstStorage &ast_storage, DbAccessor *db_accessor) {
+  IndexCandidateFinder finder(symbol_table, ast_storage, db_accessor);
+  root.Accept(finder);
+  return std::move(finder.candidates_);
+}
+
+void IndexAdvisor::Record(const std::vector<IndexCandidate> &candidates, const plan::ObservedFilters &observed) {
+  auto locked_recommendations = recommendations_.Lock();
+  for (const auto &candidate : candidates) {
+    auto it = observed.find(candidate.filter);
+    if (it == observed.end() || it->second.input == 0) continue;
+    const auto &rows = it->second;
+    auto [entry, inserted] =
+        locked_recommendations->try_emplace(Key{candidate.label, candidate.properties, candidate.equality});
+    auto &recommendation = entry->second;
+    if (inserted) {
+      recommendation.label = candidate.label;
+      recommendation.properties = candidate.properties;
+      recommendation.equality = candidate.equality;
+    }
+    ++recommendation.executions;
+    recommendation.scanned_rows += rows.input;
+    recommendation.discarded_rows += rows.input - rows.passed;
+    // The filter is still evaluated on the rows found by the index, as it may
+    // have other conjuncts.
+    const auto scan_cost =
+        static_cast<double>(rows.input) * (plan::CostParam::kScanAllByLabel + plan::CostParam::kFilter);
+    const auto index_cost = static_cast<double>(rows.passed) * (IndexScanCost(candidate) + plan::CostParam::kFilter);
+    recommendation.saved_cost += scan_cost - index_cost;
+  }
+}
+
+std::vector<IndexAdvisor::Recommendation> IndexAdvisor::Recommendations() const {
+  std::vector<Recommendation> recommendations;
+  {
+    auto locked_recommendations = recommendations_.Lock();
+    for (const auto &[key, recommendation] : *locked_recommendations) {
+      if (recommendation.saved_cost > 0) recommendations.push_back(recommendation);
+    }
+  }
+  std::sort(recommendations.begin(), recommendations.end(),
+            [](const auto &first, const auto &second) { return first.saved_cost > second.saved_cost; });
+  return recommendations;
+}
+
+void IndexAdvisor::Clear() { recommendations_->clear(); }
+
+}  // namespace memgraph::query
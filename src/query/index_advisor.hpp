@@ -0,0 +1,86 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "query/db_accessor.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+#include "query/plan/profile.hpp"
+#include "storage/v2/id_types.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query {
+
+/// A filter of the vertices scanned by their label which compares their
+/// properties with values known before the scan, so that an index of the
+/// label and the properties could find the vertices instead.
+struct IndexCandidate {
+  const plan::LogicalOperator *filter;
+  storage::LabelId label;
+  /// Properties compared for equality, ordered by their ids, or the single
+  /// property compared with a range.
+  std::vector<storage::PropertyId> properties;
+  bool equality;
+};
+
+/// Returns the filters of the plan which an index could replace.
+std::vector<IndexCandidate> FindIndexCandidates(plan::LogicalOperator &root, const SymbolTable &symbol_table,
+                                                const AstStorage &ast_storage, DbAccessor *db_accessor);
+
+/**
+ * Indices which would have saved the most work to the executed queries of a
+ * database, found from the rows which the filters of the vertices scanned
+ * by their label received and discarded.
+ *
+ * The work an index would have saved is estimated with the costs of the
+ * operators used by the planner: the scan by label and the filter of the
+ * scanned rows are replaced by an index scan and the filter of the rows the
+ * filter passed, as the rows found by the index aren't known.
+ *
+ * This class is thread-safe.
+ */
+class IndexAdvisor final {
+ public:
+  struct Recommendation {
+    storage::LabelId label;
+    std::vector<storage::PropertyId> properties;
+    bool equality;
+    /// Executions of the queries with the filter.
+    uint64_t executions{0};
+    uint64_t scanned_rows{0};
+    uint64_t discarded_rows{0};
+    double saved_cost{0};
+  };
+
+  /// Adds the rows which the filters of the `candidates` received and passed
+  /// during an execution.
+  void Record(const std::vector<IndexCandidate> &candidates, const plan::ObservedFilters &observed);
+
+  /// Returns the indices which would have saved any work, the most first.
+  std::vector<Recommendation> Recommendations() const;
+
+  void Clear();
+
+ private:
+  using Key = std::tuple<storage::LabelId, std::vector<storage::PropertyId>, bool>;
+
+  mutable utils::Synchronized<std::map<Key, Recommendation>, utils::SpinLock> recommendations_;
+};
+
+}  // namespace memgraph::query
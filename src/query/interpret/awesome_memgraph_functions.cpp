@@ -12,13 +12,16 @@
 #include "query/interpret/awesome_memgraph_functions.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <cmath>
 #include <cstdlib>
 #include <functional>
 #include <random>
+#include <span>
 #include <string_view>
 #include <type_traits>
+#include <unordered_set>
 
 #include "query/db_accessor.hpp"
 #include "query/exceptions.hpp"
@@ -26,6 +29,8 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/point.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
 #include "utils/uuid.hpp"
@@ -104,6 +109,7 @@ struct Date {};
 struct LocalTime {};
 struct LocalDateTime {};
 struct Duration {};
+struct Point {};
 
 template <class ArgType>
 bool ArgIsType(const TypedValue &arg) {
@@ -143,6 +149,8 @@ bool ArgIsType(const TypedValue &arg) {
     return arg.IsLocalDateTime();
   } else if constexpr (std::is_same_v<ArgType, Duration>) {
     return arg.IsDuration();
+  } else if constexpr (std::is_same_v<ArgType, Point>) {
+    return arg.IsPoint();
   } else if constexpr (std::is_same_v<ArgType, void>) {
     return true;
   } else {
@@ -193,6 +201,8 @@ constexpr const char *ArgTypeName() {
     return "LocalDateTime";
   } else if constexpr (std::is_same_v<ArgType, Duration>) {
     return "Duration";
+  } else if constexpr (std::is_same_v<ArgType, Point>) {
+    return "Point";
   } else {
     static_assert(std::is_same_v<ArgType, Null>, "Unknown ArgType");
   }
@@ -596,6 +606,8 @@ TypedValue ValueType(const TypedValue *args, int64_t nargs, const FunctionContex
       return TypedValue("LOCAL_DATE_TIME", ctx.memory);
     case TypedValue::Type::Duration:
       return TypedValue("DURATION", ctx.memory);
+    case TypedValue::Type::Point:
+      return TypedValue("POINT", ctx.memory);
     case TypedValue::Type::Graph:
       throw QueryRuntimeException("Cannot fetch graph as it is not standardized openCypher type name");
   }
@@ -1204,6 +1216,142 @@ TypedValue Duration(const TypedValue *args, int64_t nargs, const FunctionContext
   return TypedValue(utils::Duration(duration_parameters), ctx.memory);
 }
 
+// Defined before `Point` because the function would hide the argument type.
+// The same holds for `WithinBBox`.
+TypedValue Distance(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
+  FType<Or<Null, Point>, Or<Null, Point>>("distance", args, nargs);
+  if (args[0].IsNull() || args[1].IsNull()) return TypedValue(ctx.memory);
+  const auto distance = storage::Distance(args[0].ValuePoint(), args[1].ValuePoint());
+  if (!distance) return TypedValue(ctx.memory);
+  return TypedValue(*distance, ctx.memory);
+}
+
+TypedValue WithinBBox(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
+  FType<Or<Null, Point>, Or<Null, Point>, Or<Null, Point>>("withinbbox", args, nargs);
+  if (args[0].IsNull() || args[1].IsNull() || args[2].IsNull()) return TypedValue(ctx.memory);
+  const auto &point = args[0].ValuePoint();
+  const auto &lower = args[1].ValuePoint();
+  const auto &upper = args[2].ValuePoint();
+  if (point.crs != lower.crs || point.crs != upper.crs) return TypedValue(ctx.memory);
+  return TypedValue(storage::PointRegion::WithinBox(lower, upper).Contains(point), ctx.memory);
+}
+
+TypedValue Point(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
+  FType<Or<Null, Map>>("point", args, nargs);
+  if (args[0].IsNull()) return TypedValue(ctx.memory);
+
+  using namespace std::literals;
+  // Cartesian and geographic names of the same coordinate.
+  std::array<std::optional<double>, 3> coordinates;
+  std::array<std::pair<std::string_view, std::string_view>, 3> coordinate_names{
+      std::pair{"x"sv, "longitude"sv}, std::pair{"y"sv, "latitude"sv}, std::pair{"z"sv, "height"sv}};
+  bool has_geographic_names = false;
+  std::optional<storage::CoordinateReferenceSystem> crs;
+  for (const auto &[key, value] : args[0].ValueMap()) {
+    if (value.IsNull()) return TypedValue(ctx.memory);
+    if (key == "srid" || key == "crs") {
+      if (crs) throw QueryRuntimeException("Only one of 'srid' and 'crs' can be given to point.");
+      if (key == "srid") {
+        if (!value.IsInt()) throw QueryRuntimeException("Invalid value for key 'srid'. Expected an integer.");
+        crs = storage::SridToCrs(value.ValueInt());
+      } else {
+        if (!value.IsString()) throw QueryRuntimeException("Invalid value for key 'crs'. Expected a string.");
+        crs = storage::StringToCrs(value.ValueString());
+      }
+      if (!crs) throw QueryRuntimeException("Unsupported coordinate reference system given to point.");
+      continue;
+    }
+    auto it = std::find_if(coordinate_names.begin(), coordinate_names.end(),
+                           [&key](const auto &names) { return key == names.first || key == names.second; });
+    if (it == coordinate_names.end()) throw QueryRuntimeException("Unknown key '{}'.", key);
+    if (!value.IsNumeric()) throw QueryRuntimeException("Invalid value for key '{}'. Expected a numeric value.", key);
+    auto &coordinate = coordinates[std::distance(coordinate_names.begin(), it)];
+    if (coordinate) throw QueryRuntimeException("Point coordinate '{}' is given more than once.", key);
+    coordinate = value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+    has_geographic_names |= key == it->second;
+  }
+
+  if (!coordinates[0] || !coordinates[1]) {
+    throw QueryRuntimeException("Point requires both x and y, or longitude and latitude.");
+  }
+  const auto has_z = coordinates[2].has_value();
+  if (!crs) {
+    if (has_geographic_names) {
+      crs = has_z ? storage::CoordinateReferenceSystem::Wgs84_3d : storage::CoordinateReferenceSystem::Wgs84_2d;
+    } else {
+      crs = has_z ? storage::CoordinateReferenceSystem::Cartesian3d : storage::CoordinateReferenceSystem::Cartesian2d;
+    }
+  }
+  if (has_geographic_names && !storage::IsGeographic(*crs)) {
+    throw QueryRuntimeException("Longitude, latitude and height can only be used with geographic points.");
+  }
+  if (has_z != storage::Is3d(*crs)) {
+    throw QueryRuntimeException("Point in {} coordinate reference system requires {} coordinates.",
+                                storage::CrsToString(*crs), storage::Is3d(*crs) ? 3 : 2);
+  }
+  if (storage::IsGeographic(*crs) && (*coordinates[1] < -90.0 || *coordinates[1] > 90.0)) {
+    throw QueryRuntimeException("Latitude of a point must be in the range [-90, 90].");
+  }
+  return TypedValue(storage::Point(*crs, *coordinates[0], *coordinates[1], coordinates[2].value_or(0.0)),
+                    ctx.memory);
+}
+
+// Calls the scalar function `func` with the values of `args` as they are,
+// instead of converting them to mgp_value.
+TypedValue CallScalarFunction(const mgp_func &func, const std::string &fully_qualified_name,
+                              std::span<const TypedValue> args, const FunctionContext &ctx) {
+  procedure::ValidateArguments(args, func, fully_qualified_name);
+  const auto to_scalar = [&ctx](mgp_scalar_type type, const TypedValue &value) {
+    mgp_scalar scalar{.type = type};
+    switch (type) {
+      case MGP_SCALAR_TYPE_BOOL:
+        scalar.value.bool_value = value.ValueBool() ? 1 : 0;
+        break;
+      case MGP_SCALAR_TYPE_INT:
+        scalar.value.int_value = value.ValueInt();
+        break;
+      case MGP_SCALAR_TYPE_DOUBLE:
+        scalar.value.double_value = value.ValueDouble();
+        break;
+      case MGP_SCALAR_TYPE_STRING: {
+        const auto &string = value.ValueString();
+        scalar.value.string_value = {.data = string.data(), .size = string.size()};
+        break;
+      }
+    }
+    return scalar;
+  };
+
+  utils::pmr::vector<mgp_scalar> scalar_args(ctx.memory);
+  scalar_args.reserve(func.scalar_arg_types.size());
+  for (size_t i = 0; i < args.size(); ++i) {
+    scalar_args.push_back(to_scalar(func.scalar_arg_types[i], args[i]));
+  }
+  for (auto i = args.size() - func.args.size(); i < func.opt_args.size(); ++i) {
+    scalar_args.push_back(to_scalar(func.scalar_arg_types[func.args.size() + i], std::get<2>(func.opt_args[i])));
+  }
+
+  mgp_memory memory{ctx.memory};
+  mgp_scalar result{.type = func.scalar_result_type};
+  mgp_func_result error;
+  func.scalar_cb(scalar_args.data(), scalar_args.size(), &result, &error, &memory);
+  if (error.error_msg) {
+    throw QueryRuntimeException(*error.error_msg);
+  }
+  switch (func.scalar_result_type) {
+    case MGP_SCALAR_TYPE_BOOL:
+      return TypedValue(result.value.bool_value != 0, ctx.memory);
+    case MGP_SCALAR_TYPE_INT:
+      return TypedValue(result.value.int_value, ctx.memory);
+    case MGP_SCALAR_TYPE_DOUBLE:
+      return TypedValue(result.value.double_value, ctx.memory);
+    case MGP_SCALAR_TYPE_STRING:
+      return TypedValue(std::string_view(result.value.string_value.data, result.value.string_value.size),
+                        ctx.memory);
+  }
+  throw QueryRuntimeException("Function '{}' has an unknown result type.", fully_qualified_name);
+}
+
 std::function<TypedValue(const TypedValue *, const int64_t, const FunctionContext &)> UserFunction(
     const mgp_func &func, const std::string &fully_qualified_name) {
   return [func, fully_qualified_name](const TypedValue *args, int64_t nargs, const FunctionContext &ctx) -> TypedValue {
@@ -1219,17 +1367,16 @@ std::function<TypedValue(const TypedValue *, const int64_t, const FunctionContex
     // NOLINTNEXTLINE(clang-diagnostic-unused-variable)
     const auto &module_ptr = (*maybe_found).first;
 
+    const std::span<const TypedValue> args_list(args, static_cast<size_t>(nargs));
+    if (func.scalar_cb) {
+      return CallScalarFunction(func, fully_qualified_name, args_list, ctx);
+    }
+
     const auto &func_cb = func.cb;
     mgp_memory memory{ctx.memory};
     mgp_func_context functx{ctx.db_accessor, ctx.view};
     auto graph = mgp_graph::NonWritableGraph(*ctx.db_accessor, ctx.view);
 
-    std::vector<TypedValue> args_list;
-    args_list.reserve(nargs);
-    for (std::size_t i = 0; i < nargs; ++i) {
-      args_list.emplace_back(args[i]);
-    }
-
     auto function_argument_list = mgp_list(ctx.memory);
     procedure::ConstructArguments(args_list, func, fully_qualified_name, function_argument_list, graph);
 
@@ -1336,6 +1483,11 @@ std::function<TypedValue(const TypedValue *, int64_t, const FunctionContext &ctx
   if (function_name == "LOCALDATETIME") return LocalDateTime;
   if (function_name == "DURATION") return Duration;
 
+  // Functions for spatial types
+  if (function_name == kPoint) return Point;
+  if (function_name == kDistance) return Distance;
+  if (function_name == kWithinBBox) return WithinBBox;
+
   const auto &maybe_found =
       procedure::FindFunction(procedure::gModuleRegistry, function_name, utils::NewDeleteResource());
 
@@ -1347,4 +1499,21 @@ std::function<TypedValue(const TypedValue *, int64_t, const FunctionContext &ctx
   return nullptr;
 }
 
+bool IsDeterministicFunction(const std::string &function_name) {
+  // Temporal functions called without arguments return the time at which the
+  // query execution started.
+  static const std::unordered_set<std::string> kDeterministicFunctions{
+      // Scalar and list functions
+      "HEAD", "LAST", "PROPERTIES", "SIZE", "TOBOOLEAN", "TOFLOAT", "TOINTEGER", "VALUETYPE", "KEYS", "RANGE", "TAIL",
+      // Math functions
+      "ABS", "CEIL", "FLOOR", "ROUND", "SIGN", "E", "EXP", "LOG", "LOG10", "SQRT", "ACOS", "ASIN", "ATAN", "ATAN2",
+      "COS", "PI", "SIN", "TAN",
+      // String functions
+      kContains, kEndsWith, "LEFT", "LTRIM", "REPLACE", "REVERSE", "RIGHT", "RTRIM", "SPLIT", kStartsWith,
+      "SUBSTRING", "TOLOWER", "TOSTRING", "TOUPPER", "TRIM", "TOBYTESTRING", "FROMBYTESTRING",
+      // Temporal and spatial functions
+      "DATE", "LOCALTIME", "LOCALDATETIME", "DURATION", kPoint, kDistance, kWithinBBox};
+  return kDeterministicFunctions.contains(function_name);
+}
+
 }  // namespace memgraph::query
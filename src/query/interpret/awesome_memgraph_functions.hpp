@@ -28,6 +28,9 @@ const char kStartsWith[] = "STARTSWITH";
 const char kEndsWith[] = "ENDSWITH";
 const char kContains[] = "CONTAINS";
 const char kId[] = "ID";
+const char kPoint[] = "POINT";
+const char kDistance[] = "DISTANCE";
+const char kWithinBBox[] = "WITHINBBOX";
 }  // namespace
 
 struct FunctionContext {
@@ -47,4 +50,10 @@ struct FunctionContext {
 std::function<TypedValue(const TypedValue *arguments, int64_t num_arguments, const FunctionContext &context)>
 NameToFunction(const std::string &function_name);
 
+/// Return true if the built-in function with the given name returns the same
+/// value whenever it's called with the same arguments during a query
+/// execution. Functions which are random, count calls, read the graph or are
+/// defined by query modules aren't deterministic.
+bool IsDeterministicFunction(const std::string &function_name);
+
 }  // namespace memgraph::query
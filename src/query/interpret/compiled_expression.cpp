@@ -0,0 +1,280 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <optional>
+
+#include "query/exceptions.hpp"
+#include "utils/logging.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+CompiledExpression::CompiledExpression(Expression *expression) { result_ = Compile(expression); }
+
+CompiledExpression::Operand CompiledExpression::Emit(Op op, Operand lhs, Operand rhs, uint32_t index) {
+  const auto result = static_cast<uint32_t>(registers_.size());
+  registers_.emplace_back();
+  instructions_.push_back({op, result, lhs, rhs, index});
+  return {Operand::Kind::REGISTER, result};
+}
+
+CompiledExpression::Operand CompiledExpression::Fallback(Expression *expression) {
+  expressions_.push_back(expression);
+  return Emit(Op::EVALUATE, {}, {}, static_cast<uint32_t>(expressions_.size() - 1));
+}
+
+CompiledExpression::Operand CompiledExpression::Compile(Expression *expression) {
+  if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) {
+    constants_.emplace_back(literal->value_);
+    return {Operand::Kind::CONSTANT, static_cast<uint32_t>(constants_.size() - 1)};
+  }
+  if (auto *parameter = utils::Downcast<ParameterLookup>(expression)) {
+    return Emit(Op::PARAMETER, {}, {}, static_cast<uint32_t>(parameter->token_position_));
+  }
+  if (auto *identifier = utils::Downcast<Identifier>(expression)) {
+    return {Operand::Kind::SYMBOL, static_cast<uint32_t>(identifier->symbol_pos_)};
+  }
+  if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) {
+    // Lookups of all properties share a cache, so they are left to the
+    // evaluator together with the lookups of other expressions.
+    if (lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY ||
+        !utils::Downcast<Identifier>(lookup->expression_)) {
+      return Fallback(expression);
+    }
+    auto object = Compile(lookup->expression_);
+    expressions_.push_back(lookup);
+    return Emit(Op::PROPERTY, object, {}, static_cast<uint32_t>(expressions_.size() - 1));
+  }
+  if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+    // Like the evaluator, the second operand isn't evaluated if the first one
+    // is false. The jump and the AND write their result into the same register.
+    auto lhs = Compile(and_op->expression1_);
+    const auto jump = instructions_.size();
+    auto result = Emit(Op::JUMP_IF_FALSE, lhs);
+    auto rhs = Compile(and_op->expression2_);
+    instructions_.push_back({Op::AND, result.index, lhs, rhs, 0});
+    instructions_[jump].index = static_cast<uint32_t>(instructions_.size());
+    return result;
+  }
+  auto binary = [this](Op op, BinaryOperator *binary_op) {
+    auto lhs = Compile(binary_op->expression1_);
+    auto rhs = Compile(binary_op->expression2_);
+    return Emit(op, lhs, rhs);
+  };
+  if (auto *op = utils::Downcast<OrOperator>(expression)) return binary(Op::OR, op);
+  if (auto *op = utils::Downcast<XorOperator>(expression)) return binary(Op::XOR, op);
+  if (auto *op = utils::Downcast<AdditionOperator>(expression)) return binary(Op::ADD, op);
+  if (auto *op = utils::Downcast<SubtractionOperator>(expression)) return binary(Op::SUBTRACT, op);
+  if (auto *op = utils::Downcast<MultiplicationOperator>(expression)) return binary(Op::MULTIPLY, op);
+  if (auto *op = utils::Downcast<DivisionOperator>(expression)) return binary(Op::DIVIDE, op);
+  if (auto *op = utils::Downcast<ModOperator>(expression)) return binary(Op::MOD, op);
+  if (auto *op = utils::Downcast<EqualOperator>(expression)) return binary(Op::EQUAL, op);
+  if (auto *op = utils::Downcast<NotEqualOperator>(expression)) return binary(Op::NOT_EQUAL, op);
+  if (auto *op = utils::Downcast<LessOperator>(expression)) return binary(Op::LESS, op);
+  if (auto *op = utils::Downcast<GreaterOperator>(expression)) return binary(Op::GREATER, op);
+  if (auto *op = utils::Downcast<LessEqualOperator>(expression)) return binary(Op::LESS_EQUAL, op);
+  if (auto *op = utils::Downcast<GreaterEqualOperator>(expression)) return binary(Op::GREATER_EQUAL, op);
+  auto unary = [this](Op op, UnaryOperator *unary_op) { return Emit(op, Compile(unary_op->expression_)); };
+  if (auto *op = utils::Downcast<NotOperator>(expression)) return unary(Op::NOT, op);
+  if (auto *op = utils::Downcast<UnaryPlusOperator>(expression)) return unary(Op::UNARY_PLUS, op);
+  if (auto *op = utils::Downcast<UnaryMinusOperator>(expression)) return unary(Op::UNARY_MINUS, op);
+  if (auto *op = utils::Downcast<IsNullOperator>(expression)) return unary(Op::IS_NULL, op);
+  return Fallback(expression);
+}
+
+const TypedValue &CompiledExpression::Load(const Operand &operand, Frame &frame) const {
+  switch (operand.kind) {
+    case Operand::Kind::REGISTER:
+      return registers_[operand.index];
+    case Operand::Kind::CONSTANT:
+      return constants_[operand.index];
+    case Operand::Kind::SYMBOL:
+      return frame.elems()[operand.index];
+  }
+}
+
+const char *CompiledExpression::OperatorName(Op op) {
+  switch (op) {
+    case Op::OR:
+      return "OR";
+    case Op::XOR:
+      return "XOR";
+    case Op::ADD:
+    case Op::UNARY_PLUS:
+      return "+";
+    case Op::SUBTRACT:
+    case Op::UNARY_MINUS:
+      return "-";
+    case Op::MULTIPLY:
+      return "*";
+    case Op::DIVIDE:
+      return "/";
+    case Op::MOD:
+      return "%";
+    case Op::EQUAL:
+      return "=";
+    case Op::NOT_EQUAL:
+      return "<>";
+    case Op::LESS:
+      return "<";
+    case Op::GREATER:
+      return ">";
+    case Op::LESS_EQUAL:
+      return "<=";
+    case Op::GREATER_EQUAL:
+      return ">=";
+    case Op::NOT:
+      return "NOT";
+    default:
+      return "";
+  }
+}
+
+TypedValue CompiledExpression::Evaluate(ExpressionEvaluator &evaluator) {
+  auto &frame = *evaluator.frame_;
+  for (size_t pc = 0; pc < instructions_.size(); ++pc) {
+    const auto &instruction = instructions_[pc];
+    auto &result = registers_[instruction.result];
+    switch (instruction.op) {
+      case Op::PARAMETER:
+        result = TypedValue(evaluator.ctx_->parameters.AtTokenPosition(static_cast<int>(instruction.index)));
+        continue;
+      case Op::PROPERTY: {
+        const auto &object = Load(instruction.lhs, frame);
+        auto *lookup = static_cast<PropertyLookup *>(expressions_[instruction.index]);
+        if (object.IsVertex()) {
+          result = TypedValue(evaluator.GetProperty(object.ValueVertex(), lookup->property_));
+        } else if (object.IsEdge()) {
+          result = TypedValue(evaluator.GetProperty(object.ValueEdge(), lookup->property_));
+        } else {
+          result = lookup->Accept(evaluator);
+        }
+        continue;
+      }
+      case Op::EVALUATE:
+        result = expressions_[instruction.index]->Accept(evaluator);
+        continue;
+      case Op::JUMP_IF_FALSE: {
+        const auto &value = Load(instruction.lhs, frame);
+        if (value.IsBool() && !value.ValueBool()) {
+          result = TypedValue(false);
+          pc = instruction.index - 1;
+        }
+        continue;
+      }
+      case Op::NOT:
+      case Op::UNARY_PLUS:
+      case Op::UNARY_MINUS:
+      case Op::IS_NULL: {
+        const auto &value = Load(instruction.lhs, frame);
+        if (instruction.op == Op::IS_NULL) {
+          result = TypedValue(value.IsNull());
+          continue;
+        }
+        try {
+          if (instruction.op == Op::NOT) {
+            result = !value;
+          } else if (instruction.op == Op::UNARY_PLUS) {
+            result = +value;
+          } else {
+            result = -value;
+          }
+        } catch (const TypedValueException &) {
+          throw QueryRuntimeException("Invalid type {} for '{}'.", value.type(), OperatorName(instruction.op));
+        }
+        continue;
+      }
+      default:
+        break;
+    }
+    const auto &lhs = Load(instruction.lhs, frame);
+    const auto &rhs = Load(instruction.rhs, frame);
+    switch (instruction.op) {
+      case Op::EQUAL:
+      case Op::NOT_EQUAL:
+      case Op::LESS:
+      case Op::GREATER:
+      case Op::LESS_EQUAL:
+      case Op::GREATER_EQUAL: {
+        if (lhs.IsInt() && rhs.IsInt()) {
+          result = TypedValue(Compare(instruction.op, lhs.ValueInt(), rhs.ValueInt()));
+          continue;
+        }
+        if (lhs.IsDouble() && rhs.IsDouble()) {
+          result = TypedValue(Compare(instruction.op, lhs.ValueDouble(), rhs.ValueDouble()));
+          continue;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    try {
+      switch (instruction.op) {
+        case Op::AND:
+          result = lhs && rhs;
+          break;
+        case Op::OR:
+          result = lhs || rhs;
+          break;
+        case Op::XOR:
+          result = lhs ^ rhs;
+          break;
+        case Op::ADD:
+          result = lhs + rhs;
+          break;
+        case Op::SUBTRACT:
+          result = lhs - rhs;
+          break;
+        case Op::MULTIPLY:
+          result = lhs * rhs;
+          break;
+        case Op::DIVIDE:
+          result = lhs / rhs;
+          break;
+        case Op::MOD:
+          result = lhs % rhs;
+          break;
+        case Op::EQUAL:
+          result = lhs == rhs;
+          break;
+        case Op::NOT_EQUAL:
+          result = lhs != rhs;
+          break;
+        case Op::LESS:
+          result = lhs < rhs;
+          break;
+        case Op::GREATER:
+          result = lhs > rhs;
+          break;
+        case Op::LESS_EQUAL:
+          result = lhs <= rhs;
+          break;
+        case Op::GREATER_EQUAL:
+          result = lhs >= rhs;
+          break;
+        default:
+          LOG_FATAL("Unexpected instruction of a compiled expression");
+      }
+    } catch (const TypedValueException &) {
+      if (instruction.op == Op::AND) {
+        throw QueryRuntimeException("Invalid types: {} and {} for AND.", lhs.type(), rhs.type());
+      }
+      throw QueryRuntimeException("Invalid types: {} and {} for '{}'.", lhs.type(), rhs.type(),
+                                  OperatorName(instruction.op));
+    }
+  }
+  return TypedValue(Load(result_, frame), evaluator.ctx_->memory);
+}
+
+}  // namespace memgraph::query
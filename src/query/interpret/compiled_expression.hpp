@@ -0,0 +1,133 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/typed_value.hpp"
+
+namespace memgraph::query {
+
+/**
+ * An expression compiled into a sequence of instructions on registers, which
+ * evaluates to the same value as the expression visited by the
+ * `ExpressionEvaluator`.
+ *
+ * Literals, parameters, identifiers, property lookups of identifiers and the
+ * arithmetic, comparison and logical operators are compiled. The operands
+ * which are literals or identifiers are read in place instead of being copied,
+ * the properties are read directly from the vertices and edges on the frame
+ * and the comparisons of numbers of the same type don't go through the generic
+ * `TypedValue` operators. Other subexpressions are evaluated by the evaluator.
+ *
+ * The registers are kept between the evaluations, so an object may only be
+ * evaluated by one thread at a time.
+ */
+class CompiledExpression final {
+ public:
+  explicit CompiledExpression(Expression *expression);
+
+  /// Evaluates the expression on the frame of the `evaluator`, which also
+  /// evaluates the subexpressions which aren't compiled. The value is
+  /// allocated with the memory of the evaluator.
+  TypedValue Evaluate(ExpressionEvaluator &evaluator);
+
+  /// Number of instructions, which are all evaluated by the evaluator if the
+  /// expression couldn't be compiled.
+  size_t Size() const { return instructions_.size(); }
+
+ private:
+  enum class Op : uint8_t {
+    // Loads the parameter at the token position `index`.
+    PARAMETER,
+    // Reads the property of the lookup `expressions_[index]` from `lhs`.
+    PROPERTY,
+    // Evaluates `expressions_[index]` with the evaluator.
+    EVALUATE,
+    // Jumps to the instruction `index` with the false result if `lhs` is false.
+    JUMP_IF_FALSE,
+    AND,
+    OR,
+    XOR,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    MOD,
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    GREATER,
+    LESS_EQUAL,
+    GREATER_EQUAL,
+    NOT,
+    UNARY_PLUS,
+    UNARY_MINUS,
+    IS_NULL,
+  };
+
+  struct Operand {
+    enum class Kind : uint8_t { REGISTER, CONSTANT, SYMBOL };
+    Kind kind{Kind::REGISTER};
+    // Index of the register, of the constant or the position of the symbol.
+    uint32_t index{0};
+  };
+
+  struct Instruction {
+    Op op;
+    // Register into which the result is written.
+    uint32_t result;
+    Operand lhs;
+    Operand rhs;
+    uint32_t index;
+  };
+
+  // Compares the numbers like the `TypedValue` operators, which derive the
+  // other comparisons from `<` and `==`.
+  template <class T>
+  static bool Compare(Op op, T lhs, T rhs) {
+    switch (op) {
+      case Op::EQUAL:
+        return lhs == rhs;
+      case Op::NOT_EQUAL:
+        return !(lhs == rhs);
+      case Op::LESS:
+        return lhs < rhs;
+      case Op::GREATER:
+        return !(lhs < rhs || lhs == rhs);
+      case Op::LESS_EQUAL:
+        return lhs < rhs || lhs == rhs;
+      default:
+        return !(lhs < rhs);
+    }
+  }
+
+  // Name of the operator in the errors, which are the same as the evaluator's.
+  static const char *OperatorName(Op op);
+
+  Operand Compile(Expression *expression);
+  Operand Emit(Op op, Operand lhs = {}, Operand rhs = {}, uint32_t index = 0);
+  Operand Fallback(Expression *expression);
+
+  const TypedValue &Load(const Operand &operand, Frame &frame) const;
+
+  std::vector<Instruction> instructions_;
+  std::vector<TypedValue> constants_;
+  std::vector<Expression *> expressions_;
+  std::vector<TypedValue> registers_;
+  Operand result_;
+};
+
+}  // namespace memgraph::query
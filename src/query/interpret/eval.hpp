@@ -172,6 +172,9 @@ class PrimitiveLiteralExpressionEvaluator : public ExpressionVisitor<TypedValue>
  private:
   EvaluationContext const *ctx_;
 };
+
+class CompiledExpression;
+
 class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
  public:
   ExpressionEvaluator(Frame *frame, const SymbolTable &symbol_table, const EvaluationContext &ctx, DbAccessor *dba,
@@ -542,6 +545,35 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
       }
       return std::nullopt;
     };
+    auto maybe_point = [this](const storage::Point &point, const auto &prop_name) -> std::optional<TypedValue> {
+      if (prop_name == "x") {
+        return TypedValue(point.x, ctx_->memory);
+      }
+      if (prop_name == "y") {
+        return TypedValue(point.y, ctx_->memory);
+      }
+      if (prop_name == "z" && storage::Is3d(point.crs)) {
+        return TypedValue(point.z, ctx_->memory);
+      }
+      if (storage::IsGeographic(point.crs)) {
+        if (prop_name == "longitude") {
+          return TypedValue(point.x, ctx_->memory);
+        }
+        if (prop_name == "latitude") {
+          return TypedValue(point.y, ctx_->memory);
+        }
+        if (prop_name == "height" && storage::Is3d(point.crs)) {
+          return TypedValue(point.z, ctx_->memory);
+        }
+      }
+      if (prop_name == "srid") {
+        return TypedValue(static_cast<int64_t>(point.crs), ctx_->memory);
+      }
+      if (prop_name == "crs") {
+        return TypedValue(storage::CrsToString(point.crs), ctx_->memory);
+      }
+      return std::nullopt;
+    };
     switch (expression_result_ptr->type()) {
       case TypedValue::Type::Null:
         return TypedValue(ctx_->memory);
@@ -616,6 +648,13 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
         }
         throw QueryRuntimeException("Invalid property name {} for LocalDateTime", prop_name);
       }
+      case TypedValue::Type::Point: {
+        const auto &prop_name = property_lookup.property_.name;
+        if (auto point_field = maybe_point(expression_result_ptr->ValuePoint(), prop_name); point_field) {
+          return std::move(*point_field);
+        }
+        throw QueryRuntimeException("Invalid property name {} for Point", prop_name);
+      }
       case TypedValue::Type::Graph: {
         const auto &prop_name = property_lookup.property_.name;
         const auto &graph = expression_result_ptr->ValueGraph();
@@ -626,7 +665,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
       }
       default:
         throw QueryRuntimeException(
-            "Only nodes, edges, maps, temporal types and graphs have properties to be looked up.");
+            "Only nodes, edges, maps, temporal types, points and graphs have properties to be looked up.");
     }
   }
 
@@ -772,23 +811,13 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
   }
 
   TypedValue Visit(ListLiteral &literal) override {
-    TypedValue::TVector result(ctx_->memory);
-    result.reserve(literal.elements_.size());
-    for (const auto &expression : literal.elements_) result.emplace_back(expression->Accept(*this));
-    return TypedValue(result, ctx_->memory);
+    if (literal.is_constant_) return EvaluateConstant(literal, [&] { return EvaluateList(literal); });
+    return EvaluateList(literal);
   }
 
   TypedValue Visit(MapLiteral &literal) override {
-    TypedValue::TMap result(ctx_->memory);
-    for (const auto &pair : literal.elements_) {
-      result.emplace(pair.first.name, pair.second->Accept(*this));
-    }
-
-    ctx_->property_lookups_cache.clear();
-    // TODO Don’t clear the cache if there are remaining MapLiterals with PropertyLookups that read the same properties
-    // from the same variable (symbol & value)
-
-    return TypedValue(result, ctx_->memory);
+    if (literal.is_constant_) return EvaluateConstant(literal, [&] { return EvaluateMap(literal); });
+    return EvaluateMap(literal);
   }
 
   TypedValue Visit(MapProjectionLiteral &literal) override {
@@ -844,28 +873,8 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
   }
 
   TypedValue Visit(Function &function) override {
-    FunctionContext function_ctx{dba_, ctx_->memory, ctx_->timestamp, &ctx_->counters, view_};
-    // Stack allocate evaluated arguments when there's a small number of them.
-    if (function.arguments_.size() <= 8) {
-      TypedValue arguments[8] = {TypedValue(ctx_->memory), TypedValue(ctx_->memory), TypedValue(ctx_->memory),
-                                 TypedValue(ctx_->memory), TypedValue(ctx_->memory), TypedValue(ctx_->memory),
-                                 TypedValue(ctx_->memory), TypedValue(ctx_->memory)};
-      for (size_t i = 0; i < function.arguments_.size(); ++i) {
-        arguments[i] = function.arguments_[i]->Accept(*this);
-      }
-      auto res = function.function_(arguments, function.arguments_.size(), function_ctx);
-      MG_ASSERT(res.GetMemoryResource() == ctx_->memory);
-      return res;
-    } else {
-      TypedValue::TVector arguments(ctx_->memory);
-      arguments.reserve(function.arguments_.size());
-      for (const auto &argument : function.arguments_) {
-        arguments.emplace_back(argument->Accept(*this));
-      }
-      auto res = function.function_(arguments.data(), arguments.size(), function_ctx);
-      MG_ASSERT(res.GetMemoryResource() == ctx_->memory);
-      return res;
-    }
+    if (function.is_constant_) return EvaluateConstant(function, [&] { return CallFunction(function); });
+    return CallFunction(function);
   }
 
   TypedValue Visit(Reduce &reduce) override {
@@ -880,6 +889,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
     const auto &element_symbol = symbol_table_->at(*reduce.identifier_);
     const auto &accumulator_symbol = symbol_table_->at(*reduce.accumulator_);
     auto accumulator = reduce.initializer_->Accept(*this);
+    if (auto result = ReduceNumbers(reduce, list, accumulator)) return std::move(*result);
     for (const auto &element : list) {
       frame_->at(accumulator_symbol) = accumulator;
       frame_->at(element_symbol) = element;
@@ -1073,14 +1083,141 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
     }
     const auto &target_string = target_string_value.ValueString();
     try {
-      std::regex regex(regex_value.ValueString());
-      return TypedValue(std::regex_match(target_string, regex), ctx_->memory);
+      return TypedValue(std::regex_match(target_string, CompiledRegex(regex_match, regex_value.ValueString())),
+                        ctx_->memory);
     } catch (const std::regex_error &e) {
       throw QueryRuntimeException("Regex error in '{}': {}", regex_value.ValueString(), e.what());
     }
   }
 
  private:
+  // Compiled expressions read the frame and the properties like the evaluator.
+  friend class CompiledExpression;
+
+  // Returns the value of an expression marked as constant, which is evaluated
+  // the first time it's needed during the execution.
+  template <class TEvaluate>
+  TypedValue EvaluateConstant(const Expression &expression, TEvaluate evaluate) {
+    auto found = ctx_->constant_values.find(&expression);
+    if (found == ctx_->constant_values.end()) {
+      found = ctx_->constant_values.emplace(&expression, TypedValue(evaluate(), utils::NewDeleteResource())).first;
+    }
+    return TypedValue(found->second, ctx_->memory);
+  }
+
+  // Returns the regular expression of the match, which is compiled again only
+  // when the pattern differs from the one used in the previous evaluation.
+  const std::regex &CompiledRegex(const RegexMatch &regex_match, const TypedValue::TString &pattern) {
+    auto found = ctx_->regexes.find(&regex_match);
+    if (found == ctx_->regexes.end() || std::string_view(found->second.first) != pattern) {
+      std::regex regex(pattern.begin(), pattern.end());
+      found =
+          ctx_->regexes.insert_or_assign(&regex_match, std::make_pair(std::string(pattern), std::move(regex))).first;
+    }
+    return found->second.second;
+  }
+
+  // Sums or multiplies a list of numbers when the reduce expression is
+  // `accumulator + element` or `accumulator * element`, without evaluating the
+  // expression for every element. Returns nullopt for other expressions and
+  // for lists with values which aren't numbers.
+  std::optional<TypedValue> ReduceNumbers(Reduce &reduce, const TypedValue::TVector &list,
+                                          const TypedValue &initial) {
+    Expression *expression1 = nullptr;
+    Expression *expression2 = nullptr;
+    bool is_addition = false;
+    if (auto *addition = utils::Downcast<AdditionOperator>(reduce.expression_)) {
+      expression1 = addition->expression1_;
+      expression2 = addition->expression2_;
+      is_addition = true;
+    } else if (auto *multiplication = utils::Downcast<MultiplicationOperator>(reduce.expression_)) {
+      expression1 = multiplication->expression1_;
+      expression2 = multiplication->expression2_;
+    } else {
+      return std::nullopt;
+    }
+    auto *identifier1 = utils::Downcast<Identifier>(expression1);
+    auto *identifier2 = utils::Downcast<Identifier>(expression2);
+    if (!identifier1 || !identifier2) return std::nullopt;
+    const auto &accumulator_symbol = symbol_table_->at(*reduce.accumulator_);
+    const auto &element_symbol = symbol_table_->at(*reduce.identifier_);
+    const auto &symbol1 = symbol_table_->at(*identifier1);
+    const auto &symbol2 = symbol_table_->at(*identifier2);
+    // Both operations are commutative, so the order of the operands doesn't
+    // matter.
+    if (!((symbol1 == accumulator_symbol && symbol2 == element_symbol) ||
+          (symbol1 == element_symbol && symbol2 == accumulator_symbol))) {
+      return std::nullopt;
+    }
+    auto is_number = [](const TypedValue &value) { return value.IsInt() || value.IsDouble(); };
+    if (!is_number(initial) || !std::all_of(list.begin(), list.end(), is_number)) return std::nullopt;
+
+    // The accumulator stays an integer until it's combined with the first
+    // double, like when the expression is evaluated for every element.
+    bool is_double = initial.IsDouble();
+    int64_t int_result = is_double ? 0 : initial.ValueInt();
+    double double_result = is_double ? initial.ValueDouble() : 0.0;
+    for (const auto &element : list) {
+      if (!is_double && element.IsInt()) {
+        int_result = is_addition ? int_result + element.ValueInt() : int_result * element.ValueInt();
+        continue;
+      }
+      if (!is_double) {
+        double_result = static_cast<double>(int_result);
+        is_double = true;
+      }
+      const auto value = element.IsInt() ? static_cast<double>(element.ValueInt()) : element.ValueDouble();
+      double_result = is_addition ? double_result + value : double_result * value;
+    }
+    if (is_double) return TypedValue(double_result, ctx_->memory);
+    return TypedValue(int_result, ctx_->memory);
+  }
+
+  TypedValue EvaluateList(ListLiteral &literal) {
+    TypedValue::TVector result(ctx_->memory);
+    result.reserve(literal.elements_.size());
+    for (const auto &expression : literal.elements_) result.emplace_back(expression->Accept(*this));
+    return TypedValue(result, ctx_->memory);
+  }
+
+  TypedValue EvaluateMap(MapLiteral &literal) {
+    TypedValue::TMap result(ctx_->memory);
+    for (const auto &pair : literal.elements_) {
+      result.emplace(pair.first.name, pair.second->Accept(*this));
+    }
+
+    ctx_->property_lookups_cache.clear();
+    // TODO Don’t clear the cache if there are remaining MapLiterals with PropertyLookups that read the same properties
+    // from the same variable (symbol & value)
+
+    return TypedValue(result, ctx_->memory);
+  }
+
+  TypedValue CallFunction(Function &function) {
+    FunctionContext function_ctx{dba_, ctx_->memory, ctx_->timestamp, &ctx_->counters, view_};
+    // Stack allocate evaluated arguments when there's a small number of them.
+    if (function.arguments_.size() <= 8) {
+      TypedValue arguments[8] = {TypedValue(ctx_->memory), TypedValue(ctx_->memory), TypedValue(ctx_->memory),
+                                 TypedValue(ctx_->memory), TypedValue(ctx_->memory), TypedValue(ctx_->memory),
+                                 TypedValue(ctx_->memory), TypedValue(ctx_->memory)};
+      for (size_t i = 0; i < function.arguments_.size(); ++i) {
+        arguments[i] = function.arguments_[i]->Accept(*this);
+      }
+      auto res = function.function_(arguments, function.arguments_.size(), function_ctx);
+      MG_ASSERT(res.GetMemoryResource() == ctx_->memory);
+      return res;
+    } else {
+      TypedValue::TVector arguments(ctx_->memory);
+      arguments.reserve(function.arguments_.size());
+      for (const auto &argument : function.arguments_) {
+        arguments.emplace_back(argument->Accept(*this));
+      }
+      auto res = function.function_(arguments.data(), arguments.size(), function_ctx);
+      MG_ASSERT(res.GetMemoryResource() == ctx_->memory);
+      return res;
+    }
+  }
+
   template <class TRecordAccessor>
   std::map<storage::PropertyId, storage::PropertyValue> GetAllProperties(const TRecordAccessor &record_accessor) {
     auto maybe_props = record_accessor.Properties(view_);
@@ -15,10 +15,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <charconv>
 #include <chrono>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <limits>
@@ -58,6 +62,7 @@
 #include "query/plan/profile.hpp"
 #include "query/plan/vertex_count_cache.hpp"
 #include "query/procedure/module.hpp"
+#include "query/query_result_cache.hpp"
 #include "query/stream.hpp"
 #include "query/stream/common.hpp"
 #include "query/trigger.hpp"
@@ -657,9 +662,11 @@ Callback HandleReplicationQuery(ReplicationQuery *repl_query, const Parameters &
         notifications->emplace_back(SeverityLevel::WARNING, NotificationCode::REPLICA_PORT_WARNING,
                                     "Be careful the replication port must be different from the memgraph port!");
       }
-      callback.fn = [handler = ReplQueryHandler{interpreter_context->db.get()}, role = repl_query->role_,
-                     maybe_port]() mutable {
+      callback.fn = [handler = ReplQueryHandler{interpreter_context->db.get()}, role = repl_query->role_, maybe_port,
+                     interpreter_context]() mutable {
         handler.SetReplicationRole(role, maybe_port);
+        // Materialized views are maintained only on the main instance.
+        interpreter_context->materialized_views.MarkStale(std::nullopt);
         return std::vector<std::vector<TypedValue>>();
       };
       notifications->emplace_back(
@@ -798,6 +805,8 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
     throw SemanticException("Bootstrap servers must not be an empty string!");
   }
   auto common_stream_info = GetCommonStreamInfo(stream_query, evaluator);
+  const auto workers =
+      GetOptionalValue<int64_t>(stream_query->workers_, evaluator).value_or(query::stream::kDefaultKafkaWorkers);
 
   const auto get_config_map = [&evaluator](std::unordered_map<Expression *, Expression *> map,
                                            std::string_view map_name) -> std::unordered_map<std::string, std::string> {
@@ -818,7 +827,7 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
   return [interpreter_context, stream_name = stream_query->stream_name_,
           topic_names = EvaluateTopicNames(evaluator, stream_query->topic_names_),
           consumer_group = std::move(consumer_group), common_stream_info = std::move(common_stream_info),
-          bootstrap_servers = std::move(bootstrap), owner = StringPointerToOptional(username),
+          bootstrap_servers = std::move(bootstrap), workers, owner = StringPointerToOptional(username),
           configs = get_config_map(stream_query->configs_, "Configs"),
           credentials = get_config_map(stream_query->credentials_, "Credentials")]() mutable {
     std::string bootstrap = bootstrap_servers
@@ -830,7 +839,8 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
                                                                      .consumer_group = std::move(consumer_group),
                                                                      .bootstrap_servers = std::move(bootstrap),
                                                                      .configs = std::move(configs),
-                                                                     .credentials = std::move(credentials)},
+                                                                     .credentials = std::move(credentials),
+                                                                     .workers = workers},
                                                                     std::move(owner));
 
     return std::vector<std::vector<TypedValue>>{};
@@ -1149,13 +1159,29 @@ struct PullPlan {
                     std::shared_ptr<utils::AsyncTimer> tx_timer,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, bool use_monotonic_memory = true,
-                    FrameChangeCollector *frame_change_collector_ = nullptr);
+                    FrameChangeCollector *frame_change_collector_ = nullptr, size_t pull_batch_size = 0,
+                    bool parallel_execution = false);
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
                                                         std::map<std::string, TypedValue> *summary);
 
+  /// Pulls up to `max_rows` results ahead of the next `Pull`, stopping earlier
+  /// once `should_stop` returns true. An error is rethrown by the next `Pull`.
+  void Prefetch(size_t max_rows, const std::function<bool()> &should_stop, const std::vector<Symbol> &output_symbols);
+
  private:
+  // Sets up the memory for pulling the results and calls `func`.
+  template <typename TFunc>
+  void WithPullMemory(const TFunc &func);
+
+  // Returns true if a result was pulled into the frame.
+  bool PullResult();
+
+  // Pulls the next result into `pulled_results_`, returns false if there are
+  // no more results.
+  bool PullIntoQueue(const std::vector<Symbol> &output_symbols);
+
   std::shared_ptr<CachedPlan> plan_ = nullptr;
   plan::UniqueCursorPtr cursor_ = nullptr;
   Frame frame_;
@@ -1167,13 +1193,40 @@ struct PullPlan {
   // those pulls by accumulating the execution time.
   std::chrono::duration<double> execution_time_{0};
 
-  // To pull the results from a query we call the `Pull` method on
-  // the cursor which saves the results in a Frame.
-  // Becuase we can't find out if there are some saved results in a frame,
-  // and the cursor cannot deduce if the next pull will have a result,
-  // we have to keep track of any unsent results from previous `PullPlan::Pull`
-  // manually by using this flag.
-  bool has_unsent_results_ = false;
+  // The cursor cannot deduce if the next pull will have a result, so after
+  // streaming the requested results one more is pulled to find out if there
+  // are more. It is kept here until the next `PullPlan::Pull`, together with
+  // the results pulled by `PullPlan::Prefetch`. The values keep the execution
+  // memory of the frame.
+  std::deque<std::vector<TypedValue>> pulled_results_;
+  bool cursor_exhausted_{false};
+  std::exception_ptr prefetch_error_;
+
+  // Rows received by the pipeline breakers, which are compared with the
+  // estimated ones once all results are pulled.
+  plan::ObservedCardinalities observed_cardinalities_;
+
+  // Rows received and passed by the filters which an index could replace,
+  // reported to the index advisor once all results are pulled.
+  plan::ObservedFilters observed_filters_;
+  IndexAdvisor *index_advisor_{nullptr};
+
+  // When the rows are pulled in batches, the results are pulled into this
+  // block and placed on the frame one at a time.
+  std::optional<plan::FrameBlock> result_block_;
+  size_t result_block_row_{0};
+
+  // The row passed to the stream, reused so that its vector is allocated
+  // once per query instead of once per row.
+  std::vector<TypedValue> stream_row_;
+
+  // Allocations served by the pools of all of the pulls, reported to the plan
+  // once all results are pulled, and the parameters of the last pool.
+  utils::PoolResource::Stats pull_pool_stats_;
+  CachedPlan::PoolParameters pull_pool_parameters_{0, 0};
+
+  // Bytes allocated from the pull memory of a profiled query.
+  uint64_t profile_allocated_bytes_{0};
 
   // In the case of LOAD CSV, we want to use only PoolResource without MonotonicMemoryResource
   // to reuse allocated memory. As LOAD CSV is processing row by row
@@ -1188,7 +1241,7 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
                    std::optional<std::string> username, std::atomic<TransactionStatus> *transaction_status,
                    std::shared_ptr<utils::AsyncTimer> tx_timer, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, bool use_monotonic_memory,
-                   FrameChangeCollector *frame_change_collector)
+                   FrameChangeCollector *frame_change_collector, size_t pull_batch_size, bool parallel_execution)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
@@ -1218,13 +1271,28 @@ PullPlan::PullPlan(const std::shared_ptr<CachedPlan> plan, const Parameters &par
   ctx_.is_shutting_down = &interpreter_context->is_shutting_down;
   ctx_.transaction_status = transaction_status;
   ctx_.is_profile_query = is_profile_query;
+  if (is_profile_query) ctx_.profile_allocated_bytes = &profile_allocated_bytes_;
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
+  // Profiling counts the pulls of every operator, so the rows are pulled one
+  // at a time.
+  ctx_.pull_batch_size = is_profile_query ? 0 : pull_batch_size;
+  if (parallel_execution && !is_profile_query && interpreter_context->parallel_execution_pool) {
+    ctx_.parallel_execution_pool = interpreter_context->parallel_execution_pool.get();
+    ctx_.parallel_workers = interpreter_context->config.query.parallel_execution_threads + 1;
+  }
+  ctx_.spill_threshold_bytes = interpreter_context->config.query.spill_threshold_bytes;
+  ctx_.spill_directory = interpreter_context->spill_directory;
+  if (dba && plan->HasBreakerCardinalities()) ctx_.observed_cardinalities = &observed_cardinalities_;
+  if (dba && !plan->index_candidates().empty()) {
+    for (const auto &candidate : plan->index_candidates()) observed_filters_.try_emplace(candidate.filter);
+    ctx_.observed_filters = &observed_filters_;
+    index_advisor_ = &interpreter_context->index_advisor;
+  }
 }
 
-std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
-                                                                const std::vector<Symbol> &output_symbols,
-                                                                std::map<std::string, TypedValue> *summary) {
+template <typename TFunc>
+void PullPlan::WithPullMemory(const TFunc &func) {
   // Set up temporary memory for a single Pull. Initial memory comes from the
   // stack. 256 KiB should fit on the stack and should be more than enough for a
   // single `Pull`.
@@ -1235,17 +1303,19 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   utils::MonotonicBufferResource monotonic_memory{&stack_data[0], stack_size, &resource_with_exception};
   std::optional<utils::PoolResource> pool_memory;
   static constexpr auto kMaxBlockPerChunks = 128;
+  // The pool is tuned by the allocations of the previous executions of the
+  // plan, see `CachedPlan::ReportPullPoolStats`.
+  const auto [max_block_size, max_blocks_per_chunk] =
+      plan_->PullPoolParameters(kExecutionPoolMaxBlockSize, kMaxBlockPerChunks);
 
   if (!use_monotonic_memory_) {
-    pool_memory.emplace(kMaxBlockPerChunks, kExecutionPoolMaxBlockSize, &resource_with_exception,
-                        &resource_with_exception);
+    pool_memory.emplace(max_blocks_per_chunk, max_block_size, &resource_with_exception, &resource_with_exception);
   } else {
     // We can throw on every query because a simple queries for deleting will use only
     // the stack allocated buffer.
     // Also, we want to throw only when the query engine requests more memory and not the storage
     // so we add the exception to the allocator.
-    // TODO (mferencevic): Tune the parameters accordingly.
-    pool_memory.emplace(kMaxBlockPerChunks, 1024, &monotonic_memory, &resource_with_exception);
+    pool_memory.emplace(max_blocks_per_chunk, max_block_size, &monotonic_memory, &resource_with_exception);
   }
 
   std::optional<utils::LimitedMemoryResource> maybe_limited_resource;
@@ -1255,51 +1325,125 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
   } else {
     ctx_.evaluation_context.memory = &*pool_memory;
   }
+  std::optional<utils::CountingMemoryResource> counting_memory;
+  if (ctx_.profile_allocated_bytes) {
+    counting_memory.emplace(ctx_.profile_allocated_bytes, ctx_.evaluation_context.memory);
+    ctx_.evaluation_context.memory = &*counting_memory;
+  }
 
-  // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  func();
+  pull_pool_stats_ += pool_memory->GetStats();
+  pull_pool_parameters_ = {pool_memory->GetMaxBlockSize(), pool_memory->GetMaxBlocksPerChunk()};
+}
 
-  const auto stream_values = [&]() {
-    // TODO: The streamed values should also probably use the above memory.
-    std::vector<TypedValue> values;
-    values.reserve(output_symbols.size());
+bool PullPlan::PullResult() {
+  if (cursor_exhausted_) return false;
+  if (!result_block_) {
+    cursor_exhausted_ = !cursor_->Pull(frame_, ctx_);
+    return !cursor_exhausted_;
+  }
+  if (result_block_row_ == result_block_->Size()) {
+    result_block_->Clear();
+    result_block_row_ = 0;
+    if (!cursor_->PullBatch(frame_, *result_block_, ctx_)) {
+      cursor_exhausted_ = true;
+      return false;
+    }
+  }
+  result_block_->RestoreRow(result_block_row_++, frame_, ctx_.frame_change_collector);
+  return true;
+}
+
+bool PullPlan::PullIntoQueue(const std::vector<Symbol> &output_symbols) {
+  if (!PullResult()) return false;
+  auto &row = pulled_results_.emplace_back();
+  row.reserve(output_symbols.size());
+  for (const auto &symbol : output_symbols) {
+    row.emplace_back(std::move(frame_[symbol]));
+  }
+  return true;
+}
+
+void PullPlan::Prefetch(size_t max_rows, const std::function<bool()> &should_stop,
+                        const std::vector<Symbol> &output_symbols) {
+  // Checking whether to stop may be a system call, so it isn't done per row.
+  static constexpr size_t kRowsBetweenStopChecks = 64;
+  if (prefetch_error_ || cursor_exhausted_ || output_symbols.empty()) return;
+  if (ctx_.pull_batch_size > 0 && !result_block_) {
+    result_block_.emplace(output_symbols, ctx_.pull_batch_size, frame_.GetMemoryResource());
+  }
+
+  WithPullMemory([&] {
+    utils::Timer timer;
+    try {
+      for (size_t i = 0; pulled_results_.size() < max_rows; ++i) {
+        if (i % kRowsBetweenStopChecks == 0 && should_stop()) break;
+        if (!PullIntoQueue(output_symbols)) break;
+      }
+    } catch (...) {
+      prefetch_error_ = std::current_exception();
+    }
+    execution_time_ += timer.Elapsed();
+  });
+}
+
+std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
+                                                                const std::vector<Symbol> &output_symbols,
+                                                                std::map<std::string, TypedValue> *summary) {
+  if (prefetch_error_) {
+    std::rethrow_exception(std::exchange(prefetch_error_, nullptr));
+  }
+  if (ctx_.pull_batch_size > 0 && !result_block_) {
+    result_block_.emplace(output_symbols, ctx_.pull_batch_size, frame_.GetMemoryResource());
+  }
 
+  const auto stream_values = [&]() {
+    // Each pulled row is streamed once and the cursors write the output
+    // symbols again on the next pull, so the values are moved out of the
+    // frame instead of copied. They keep the execution memory of the frame,
+    // which outlives the call to the stream.
+    stream_row_.reserve(output_symbols.size());
     for (const auto &symbol : output_symbols) {
-      values.emplace_back(frame_[symbol]);
+      stream_row_.emplace_back(std::move(frame_[symbol]));
     }
 
-    stream->Result(values);
+    stream->Result(stream_row_);
+    stream_row_.clear();
   };
 
-  // Get the execution time of all possible result pulls and streams.
-  utils::Timer timer;
+  bool has_more = false;
+  WithPullMemory([&] {
+    // Get the execution time of all possible result pulls and streams.
+    utils::Timer timer;
+
+    int i = 0;
+    for (; !n || i < n; ++i) {
+      if (!pulled_results_.empty()) {
+        // stream the results pulled ahead by the previous pulls
+        if (!output_symbols.empty()) {
+          stream->Result(pulled_results_.front());
+        }
+        pulled_results_.pop_front();
+        continue;
+      }
 
-  int i = 0;
-  if (has_unsent_results_ && !output_symbols.empty()) {
-    // stream unsent results from previous pull
-    stream_values();
-    ++i;
-  }
+      if (!PullResult()) {
+        break;
+      }
 
-  for (; !n || i < n; ++i) {
-    if (!pull_result()) {
-      break;
+      if (!output_symbols.empty()) {
+        stream_values();
+      }
     }
 
-    if (!output_symbols.empty()) {
-      stream_values();
-    }
-  }
+    // If we finished because we streamed the requested n results,
+    // we try to pull the next result to see if there is more.
+    has_more = i == n && (!pulled_results_.empty() || PullIntoQueue(output_symbols));
 
-  // If we finished because we streamed the requested n results,
-  // we try to pull the next result to see if there is more.
-  // If there is additional result, we leave the pulled result in the frame
-  // and set the flag to true.
-  has_unsent_results_ = i == n && pull_result();
-
-  execution_time_ += timer.Elapsed();
+    execution_time_ += timer.Elapsed();
+  });
 
-  if (has_unsent_results_) {
+  if (has_more) {
     return std::nullopt;
   }
 
@@ -1319,7 +1463,18 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
     }
     summary->insert_or_assign("stats", std::move(stats));
   }
+  if (ctx_.is_profile_query) {
+    std::map<std::string, TypedValue> pool;
+    pool.emplace("max_block_size", static_cast<int64_t>(pull_pool_parameters_.max_block_size));
+    pool.emplace("max_blocks_per_chunk", static_cast<int64_t>(pull_pool_parameters_.max_blocks_per_chunk));
+    pool.emplace("pooled_allocations", static_cast<int64_t>(pull_pool_stats_.pooled));
+    pool.emplace("unpooled_allocations", static_cast<int64_t>(pull_pool_stats_.unpooled));
+    summary->insert_or_assign("pull_memory_pool", std::move(pool));
+  }
   cursor_->Shutdown();
+  if (ctx_.observed_cardinalities) plan_->ReportObservedCardinalities(observed_cardinalities_, *ctx_.db_accessor);
+  if (index_advisor_) index_advisor_->Record(plan_->index_candidates(), observed_filters_);
+  plan_->ReportPullPoolStats(pull_pool_stats_);
   ctx_.profile_execution_time = execution_time_;
   return GetStatsWithTotalTime(ctx_);
 }
@@ -1344,6 +1499,29 @@ storage::replication::ReplicationRole GetReplicaRole(storage::Storage *storage)
   return storage::replication::ReplicationRole::MAIN;
 }
 
+void RunAfterCommitTriggers(InterpreterContext *interpreter_context, TriggerContext trigger_context);
+
+AfterCommitTriggerExecutor MakeAfterCommitTriggerExecutor(InterpreterContext *interpreter_context) {
+  const auto &config = interpreter_context->config;
+  return {config.after_commit_trigger_threads, config.after_commit_trigger_batch_size,
+          config.after_commit_trigger_queue_size, [interpreter_context](TriggerContext trigger_context) {
+            RunAfterCommitTriggers(interpreter_context, std::move(trigger_context));
+          }};
+}
+
+std::unique_ptr<utils::ThreadPool> MakeParallelExecutionPool(const InterpreterConfig &config) {
+  if (config.query.parallel_execution_threads == 0) return nullptr;
+  return std::make_unique<utils::ThreadPool>(config.query.parallel_execution_threads);
+}
+
+// The files spilled by the queries are removed once the queries finish, so the
+// files left in the directory were spilled before a crash.
+std::filesystem::path MakeSpillDirectory(const InterpreterConfig &config, const std::filesystem::path &data_directory) {
+  auto directory = data_directory / "spill";
+  if (config.query.spill_threshold_bytes > 0) utils::DeleteDir(directory);
+  return directory;
+}
+
 }  // namespace
 
 InterpreterContext::InterpreterContext(const storage::Config storage_config, const InterpreterConfig interpreter_config,
@@ -1352,13 +1530,24 @@ InterpreterContext::InterpreterContext(const storage::Config storage_config, con
     : auth(ah),
       auth_checker(ac),
       trigger_store(data_directory / "triggers"),
+      materialized_views(data_directory / "materialized_views"),
       config(interpreter_config),
+      after_commit_triggers(MakeAfterCommitTriggerExecutor(this)),
+      parallel_execution_pool(MakeParallelExecutionPool(interpreter_config)),
+      spill_directory(MakeSpillDirectory(interpreter_config, data_directory)),
+      slow_query_log(data_directory / "slow_queries",
+                     std::chrono::milliseconds(interpreter_config.query.slow_query_threshold_ms),
+                     interpreter_config.query.slow_query_sample_rate, interpreter_config.query.slow_query_log_size),
       streams{this, data_directory / "streams"} {
+  if (config.query.memory_limit_per_database_bytes > 0) {
+    query_memory_tracker.SetHardLimit(static_cast<int64_t>(config.query.memory_limit_per_database_bytes));
+  }
   if (utils::DirExists(storage_config.disk.main_storage_directory)) {
     db = std::make_unique<storage::DiskStorage>(storage_config);
   } else {
     db = std::make_unique<storage::InMemoryStorage>(storage_config);
   }
+  materialized_views.RestoreViews(&ast_cache, config.query);
 }
 
 InterpreterContext::InterpreterContext(std::unique_ptr<storage::Storage> &&db, InterpreterConfig interpreter_config,
@@ -1368,11 +1557,61 @@ InterpreterContext::InterpreterContext(std::unique_ptr<storage::Storage> &&db, I
       auth(ah),
       auth_checker(ac),
       trigger_store(data_directory / "triggers"),
+      materialized_views(data_directory / "materialized_views"),
       config(interpreter_config),
-      streams{this, data_directory / "streams"} {}
+      after_commit_triggers(MakeAfterCommitTriggerExecutor(this)),
+      parallel_execution_pool(MakeParallelExecutionPool(interpreter_config)),
+      spill_directory(MakeSpillDirectory(interpreter_config, data_directory)),
+      slow_query_log(data_directory / "slow_queries",
+                     std::chrono::milliseconds(interpreter_config.query.slow_query_threshold_ms),
+                     interpreter_config.query.slow_query_sample_rate, interpreter_config.query.slow_query_log_size),
+      streams{this, data_directory / "streams"} {
+  if (config.query.memory_limit_per_database_bytes > 0) {
+    query_memory_tracker.SetHardLimit(static_cast<int64_t>(config.query.memory_limit_per_database_bytes));
+  }
+  materialized_views.RestoreViews(&ast_cache, config.query);
+}
+
+utils::MemoryTracker *InterpreterContext::UserMemoryTracker(const std::string &username) {
+  return user_memory_trackers.WithLock([&](auto &trackers) {
+    auto [it, inserted] = trackers.try_emplace(username, &query_memory_tracker);
+    if (inserted && config.query.memory_limit_per_user_bytes > 0) {
+      it->second.SetHardLimit(static_cast<int64_t>(config.query.memory_limit_per_user_bytes));
+    }
+    return &it->second;
+  });
+}
 
 Interpreter::Interpreter(InterpreterContext *interpreter_context) : interpreter_context_(interpreter_context) {
   MG_ASSERT(interpreter_context_, "Interpreter context must not be NULL");
+  local_plan_cache_.emplace(&interpreter_context_->plan_cache_generation);
+}
+
+void Interpreter::Prefetch(const std::function<bool()> &should_stop) {
+  const auto max_rows = interpreter_context_->config.query.prefetch_rows;
+  if (max_rows == 0 || query_executions_.empty()) return;
+  auto &query_execution = query_executions_.back();
+  if (!query_execution || !query_execution->prepared_query || !query_execution->prepared_query->prefetch_handler) {
+    return;
+  }
+  utils::MemoryTracker::ThreadTrackerScope memory_scope(
+      transaction_memory_tracker_ ? &*transaction_memory_tracker_ : nullptr);
+  query_execution->prepared_query->prefetch_handler(max_rows, should_stop);
+}
+
+void Interpreter::SetupTransactionMemoryTracker() {
+  auto *parent = username_ ? interpreter_context_->UserMemoryTracker(*username_)
+                           : &interpreter_context_->query_memory_tracker;
+  transaction_memory_tracker_.emplace(parent);
+}
+
+void Interpreter::SetupTriggerContextCollector() {
+  const auto &trigger_store = interpreter_context_->trigger_store;
+  collect_view_changes_ = interpreter_context_->materialized_views.HasViews();
+  if (!trigger_store.HasTriggers() && !collect_view_changes_) return;
+  auto event_types = trigger_store.GetEventTypes();
+  if (collect_view_changes_) event_types.insert(TriggerEventType::ANY);
+  trigger_context_collector_.emplace(event_types);
 }
 
 auto DetermineTxTimeout(std::optional<int64_t> tx_timeout_ms, InterpreterConfig const &config) -> TxTimeout {
@@ -1405,6 +1644,8 @@ PreparedQuery Interpreter::PrepareTransactionQuery(std::string_view query_upper,
 
       memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveTransactions);
 
+      WaitForBookmarks(extras.bookmarks);
+
       in_explicit_transaction_ = true;
       expect_rollback_ = false;
       metadata_ = GenOptional(extras.metadata_pv);
@@ -1415,11 +1656,10 @@ PreparedQuery Interpreter::PrepareTransactionQuery(std::string_view query_upper,
 
       db_accessor_ = interpreter_context_->db->Access(GetIsolationLevelOverride());
       execution_db_accessor_.emplace(db_accessor_.get());
+      SetupTransactionMemoryTracker();
       transaction_status_.store(TransactionStatus::ACTIVE, std::memory_order_release);
 
-      if (interpreter_context_->trigger_store.HasTriggers()) {
-        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
-      }
+      SetupTriggerContextCollector();
     };
   } else if (query_upper == "COMMIT") {
     handler = [this] {
@@ -1511,13 +1751,47 @@ bool IsCallBatchedProcedureQuery(const std::vector<memgraph::query::Clause *> &c
   return false;
 }
 
+PreparedStatement MakePreparedStatement(const ParsedQuery &parsed_query) {
+  if (!utils::Downcast<CypherQuery>(parsed_query.query) || !parsed_query.is_cacheable) {
+    throw QueryException("Only Cypher queries whose plans can be cached can be prepared.");
+  }
+  PreparedStatement statement{.query_string = parsed_query.query_string,
+                              .stripped_query = parsed_query.stripped_query,
+                              .required_privileges = parsed_query.required_privileges};
+  statement.query = CloneQuery(parsed_query.ast_storage, parsed_query.query, &statement.ast_storage);
+  return statement;
+}
+
+ParsedQuery ParsePreparedStatement(PreparedStatement *statement, std::map<std::string, storage::PropertyValue> params,
+                                   InterpreterContext *interpreter_context) {
+  if (statement->interpreter_context != interpreter_context ||
+      statement->plan_cache_generation != interpreter_context->plan_cache_generation.load(std::memory_order_acquire)) {
+    statement->plan = nullptr;
+  }
+  auto parameters = BindParameters(*statement->stripped_query, params);
+  ParsedQuery parsed_query{.query_string = statement->query_string,
+                           .user_parameters = std::move(params),
+                           .parameters = std::move(parameters),
+                           .stripped_query = statement->stripped_query,
+                           .query = statement->query,
+                           .required_privileges = statement->required_privileges};
+  // The query of a pinned plan is only inspected, the query being planned
+  // again is consumed by the planner.
+  if (!statement->plan) {
+    parsed_query.query = CloneQuery(statement->ast_storage, statement->query, &parsed_query.ast_storage);
+  }
+  return parsed_query;
+}
+
 PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
                                  InterpreterContext *interpreter_context, DbAccessor *dba,
                                  utils::MemoryResource *execution_memory, std::vector<Notification> *notifications,
                                  const std::string *username, std::atomic<TransactionStatus> *transaction_status,
                                  std::shared_ptr<utils::AsyncTimer> tx_timer,
                                  TriggerContextCollector *trigger_context_collector = nullptr,
-                                 FrameChangeCollector *frame_change_collector = nullptr) {
+                                 FrameChangeCollector *frame_change_collector = nullptr,
+                                 PreparedStatement *statement = nullptr,
+                                 LocalPlanCache *local_plan_cache = nullptr) {
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
 
   EvaluationContext evaluation_context;
@@ -1547,48 +1821,139 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   spdlog::trace("PrepareCypher has {} encountered all shortest paths and will {} use of monotonic memory",
                 IsAllShortestPathsQuery(clauses) ? "" : "not", use_monotonic_memory ? "" : "not");
 
-  auto plan = CypherQueryToPlan(parsed_query.stripped_query.hash(), std::move(parsed_query.ast_storage), cypher_query,
-                                parsed_query.parameters,
-                                parsed_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba);
+  std::shared_ptr<CachedPlan> plan;
+  if (statement && statement->plan) {
+    plan = statement->plan;
+  } else {
+    // The generation is read before planning, so a plan made while an index
+    // is changed isn't pinned.
+    const auto plan_cache_generation = interpreter_context->plan_cache_generation.load(std::memory_order_acquire);
+    plan = CypherQueryToPlan(parsed_query.stripped_query->hash(), std::move(parsed_query.ast_storage), cypher_query,
+                             parsed_query.parameters,
+                             parsed_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba, {},
+                             local_plan_cache);
+    if (statement) {
+      statement->plan = plan;
+      statement->interpreter_context = interpreter_context;
+      statement->plan_cache_generation = plan_cache_generation;
+    }
+  }
 
   TryCaching(plan->ast_storage(), frame_change_collector);
   summary->insert_or_assign("cost_estimate", plan->cost());
+  summary->insert_or_assign("rows_estimate", plan->estimated_rows());
+  summary->insert_or_assign("memory_estimate", plan->estimated_memory());
+  if (FLAGS_query_max_estimated_memory_mib > 0) {
+    const auto estimated_mib = static_cast<uint64_t>(plan->estimated_memory() / 1024 / 1024);
+    if (estimated_mib > FLAGS_query_max_estimated_memory_mib) {
+      throw MemoryEstimateExceededException(estimated_mib, FLAGS_query_max_estimated_memory_mib);
+    }
+  }
   auto rw_type_checker = plan::ReadWriteTypeChecker();
   rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(plan->plan()));
 
   auto output_symbols = plan->plan().OutputSymbols(plan->symbol_table());
 
   std::vector<std::string> header;
-  header.reserve(output_symbols.size());
-
-  for (const auto &symbol : output_symbols) {
-    // When the symbol is aliased or expanded from '*' (inside RETURN or
-    // WITH), then there is no token position, so use symbol name.
-    // Otherwise, find the name from stripped query.
-    header.push_back(
-        utils::FindOr(parsed_query.stripped_query.named_expressions(), symbol.token_position(), symbol.name()).first);
+  if (statement && !statement->header.empty()) {
+    header = statement->header;
+  } else {
+    header.reserve(output_symbols.size());
+    for (const auto &symbol : output_symbols) {
+      // When the symbol is aliased or expanded from '*' (inside RETURN or
+      // WITH), then there is no token position, so use symbol name.
+      // Otherwise, find the name from stripped query.
+      header.push_back(
+          utils::FindOr(parsed_query.stripped_query->named_expressions(), symbol.token_position(), symbol.name())
+              .first);
+    }
+    if (statement) statement->header = header;
   }
+  // Rows of read-only queries can be pulled ahead of the ones being streamed,
+  // and parts of them executed in parallel. Queries which reuse the memory of
+  // a single row are left out.
+  const bool is_read_only = rw_type_checker.type == RWType::R || rw_type_checker.type == RWType::NONE;
+  const size_t pull_batch_size =
+      is_read_only && use_monotonic_memory ? interpreter_context->config.query.pull_batch_size : 0;
   auto pull_plan =
       std::make_shared<PullPlan>(plan, parsed_query.parameters, false, dba, interpreter_context, execution_memory,
                                  StringPointerToOptional(username), transaction_status, std::move(tx_timer),
                                  trigger_context_collector, memory_limit, use_monotonic_memory,
-                                 frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr);
-  return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
-                       [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
-                           AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
-                         if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+                                 frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr,
+                                 pull_batch_size, is_read_only && use_monotonic_memory);
+  PreparedQuery prepared_query{std::move(header), std::move(parsed_query.required_privileges),
+                               [pull_plan, output_symbols, summary](
+                                   AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
+                                 if (pull_plan->Pull(stream, n, output_symbols, summary)) {
+                                   return QueryHandlerResult::COMMIT;
+                                 }
+                                 return std::nullopt;
+                               },
+                               rw_type_checker.type};
+  prepared_query.plan = plan;
+  prepared_query.plan_cache_hit = plan->MarkUsed();
+  // Results of queries which write could be computed ahead only to be rolled
+  // back, so only the results of read-only queries are prefetched.
+  if (is_read_only && use_monotonic_memory) {
+    prepared_query.prefetch_handler = [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols)](
+                                          size_t max_rows, const std::function<bool()> &should_stop) {
+      pull_plan->Prefetch(max_rows, should_stop, output_symbols);
+    };
+  }
+  return prepared_query;
+}
+
+PreparedQuery PrepareCachedResultQuery(std::shared_ptr<const QueryResultCache::Result> result,
+                                       std::vector<AuthQuery::Privilege> privileges) {
+  auto header = result->header;
+  return PreparedQuery{std::move(header), std::move(privileges),
+                       [result = std::move(result), streamed = size_t{0}](
+                           AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+                         for (int local_counter = 0; streamed < result->rows.size() && (!n || local_counter < *n);
+                              ++streamed, ++local_counter) {
+                           stream->Result(result->rows[streamed]);
+                         }
+                         if (streamed == result->rows.size()) {
                            return QueryHandlerResult::COMMIT;
                          }
                          return std::nullopt;
                        },
-                       rw_type_checker.type};
+                       RWType::R};
+}
+
+// Passes the results of a query both to the client's stream and to the
+// recorder of the result cache.
+struct RecordingStream {
+  void Result(const std::vector<TypedValue> &values) {
+    recorder->Result(values);
+    stream->Result(values);
+  }
+
+  AnyStream *stream;
+  QueryResultCache::Recorder *recorder;
+};
+
+void RecordQueryResult(PreparedQuery *prepared_query, QueryResultCache::Key key,
+                       std::optional<storage::SnapshotId> snapshot) {
+  auto recorder = std::make_shared<QueryResultCache::Recorder>(&gQueryResultCache, std::move(key),
+                                                               prepared_query->header, snapshot);
+  prepared_query->query_handler = [handler = std::move(prepared_query->query_handler), recorder = std::move(recorder)](
+                                      AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
+    RecordingStream recording_stream{stream, recorder.get()};
+    AnyStream recording_any_stream{&recording_stream, utils::NewDeleteResource()};
+    auto result = handler(&recording_any_stream, n);
+    if (result == QueryHandlerResult::COMMIT) {
+      recorder->Finish();
+    }
+    return result;
+  };
 }
 
 PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
                                   InterpreterContext *interpreter_context, DbAccessor *dba,
                                   utils::MemoryResource *execution_memory) {
   const std::string kExplainQueryStart = "explain ";
-  MG_ASSERT(utils::StartsWith(utils::ToLowerCase(parsed_query.stripped_query.query()), kExplainQueryStart),
+  MG_ASSERT(utils::StartsWith(utils::ToLowerCase(parsed_query.stripped_query->query()), kExplainQueryStart),
             "Expected stripped query to start with '{}'", kExplainQueryStart);
 
   // Parse and cache the inner query separately (as if it was a standalone
@@ -1605,7 +1970,7 @@ PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string
   MG_ASSERT(cypher_query, "Cypher grammar should not allow other queries in EXPLAIN");
 
   auto cypher_query_plan = CypherQueryToPlan(
-      parsed_inner_query.stripped_query.hash(), std::move(parsed_inner_query.ast_storage), cypher_query,
+      parsed_inner_query.stripped_query->hash(), std::move(parsed_inner_query.ast_storage), cypher_query,
       parsed_inner_query.parameters, parsed_inner_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba);
 
   std::stringstream printed_plan;
@@ -1617,6 +1982,9 @@ PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string
   }
 
   summary->insert_or_assign("explain", plan::PlanToJson(*dba, &cypher_query_plan->plan()).dump());
+  summary->insert_or_assign("cost_estimate", cypher_query_plan->cost());
+  summary->insert_or_assign("rows_estimate", cypher_query_plan->estimated_rows());
+  summary->insert_or_assign("memory_estimate", cypher_query_plan->estimated_memory());
 
   return PreparedQuery{{"QUERY PLAN"},
                        std::move(parsed_query.required_privileges),
@@ -1638,7 +2006,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
                                   FrameChangeCollector *frame_change_collector) {
   const std::string kProfileQueryStart = "profile ";
 
-  MG_ASSERT(utils::StartsWith(utils::ToLowerCase(parsed_query.stripped_query.query()), kProfileQueryStart),
+  MG_ASSERT(utils::StartsWith(utils::ToLowerCase(parsed_query.stripped_query->query()), kProfileQueryStart),
             "Expected stripped query to start with '{}'", kProfileQueryStart);
 
   // PROFILE isn't allowed inside multi-command (explicit) transactions. This is
@@ -1693,7 +2061,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   const auto memory_limit = EvaluateMemoryLimit(evaluator, cypher_query->memory_limit_, cypher_query->memory_scale_);
 
   auto cypher_query_plan = CypherQueryToPlan(
-      parsed_inner_query.stripped_query.hash(), std::move(parsed_inner_query.ast_storage), cypher_query,
+      parsed_inner_query.stripped_query->hash(), std::move(parsed_inner_query.ast_storage), cypher_query,
       parsed_inner_query.parameters, parsed_inner_query.is_cacheable ? &interpreter_context->plan_cache : nullptr, dba);
   TryCaching(cypher_query_plan->ast_storage(), frame_change_collector);
   auto rw_type_checker = plan::ReadWriteTypeChecker();
@@ -1748,9 +2116,90 @@ PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, std::map<std::string, T
                        RWType::R};
 }
 
+PreparedQuery PrepareDumpToDirectoryQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                          InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw DumpToDirectoryInMulticommandTxException();
+  }
+
+  if (interpreter_context->db->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    throw DumpToDirectoryDisabledOnDiskStorage();
+  }
+
+  auto *dump_query = utils::Downcast<DumpQuery>(parsed_query.query);
+  EvaluationContext evaluation_context;
+  evaluation_context.timestamp = QueryTimestamp();
+  evaluation_context.parameters = parsed_query.parameters;
+  auto evaluator = PrimitiveLiteralExpressionEvaluator{evaluation_context};
+  auto directory = std::string(dump_query->directory_->Accept(evaluator).ValueString());
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [interpreter_context, directory = std::move(directory)](
+          AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
+        auto *mem_storage = static_cast<storage::InMemoryStorage *>(interpreter_context->db.get());
+        if (mem_storage->DumpSnapshot(directory).HasError()) {
+          throw utils::BasicException("Failed to dump the database to {}. Reached max number of tries.", directory);
+        }
+        return QueryHandlerResult::COMMIT;
+      },
+      RWType::NONE};
+}
+
+namespace {
+
+// Computes the statistics of a label-property index from the number of
+// vertices per distinct value and the sum of degrees of all of the vertices.
+// `values_map` must not be empty.
+template <typename TValuesMap>
+storage::LabelPropertyIndexStats ComputeLabelPropertyIndexStats(const TValuesMap &values_map, uint64_t total_degree) {
+  uint64_t count_property_value = std::accumulate(
+      values_map.begin(), values_map.end(), 0,
+      [](uint64_t prev_value, const auto &prop_value_count) { return prev_value + prop_value_count.second; });
+  // num_distinc_values will never be 0
+  double avg_group_size = static_cast<double>(count_property_value) / static_cast<double>(values_map.size());
+  double chi_squared_stat = std::accumulate(
+      values_map.begin(), values_map.end(), 0.0, [avg_group_size](double prev_result, const auto &value_entry) {
+        return prev_result + utils::ChiSquaredValue(value_entry.second, avg_group_size);
+      });
+
+  double average_degree =
+      count_property_value > 0 ? static_cast<double>(total_degree) / static_cast<double>(count_property_value) : 0;
+
+  return storage::LabelPropertyIndexStats{.count = count_property_value,
+                                          .distinct_values_count = static_cast<uint64_t>(values_map.size()),
+                                          .statistic = chi_squared_stat,
+                                          .avg_group_size = avg_group_size,
+                                          .avg_degree = average_degree};
+}
+
+// Clears the plan cache, together with the plans pinned by prepared
+// statements.
+void InvalidatePlanCache(InterpreterContext *interpreter_context) {
+  auto access = interpreter_context->plan_cache.access();
+  for (auto &kv : access) {
+    access.remove(kv.first);
+  }
+  interpreter_context->plan_cache_generation.fetch_add(1, std::memory_order_acq_rel);
+}
+
+template <typename TDbAccessor>
+std::string PropertiesToString(const TDbAccessor &db, const std::vector<storage::PropertyId> &properties) {
+  std::vector<std::string> names;
+  names.reserve(properties.size());
+  for (const auto &property : properties) {
+    names.push_back(db.PropertyToName(property));
+  }
+  return utils::Join(names, ", ");
+}
+
+}  // namespace
+
 std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreateStatistics(
     const std::span<std::string> labels, DbAccessor *execution_db_accessor) {
   using LPIndex = std::pair<storage::LabelId, storage::PropertyId>;
+  using LPCompositeIndex = std::pair<storage::LabelId, std::vector<storage::PropertyId>>;
   auto view = storage::View::OLD;
 
   auto erase_not_specified_label_indices = [&labels, execution_db_accessor](auto &index_info) {
@@ -1822,39 +2271,48 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
 
     std::vector<std::pair<LPIndex, storage::LabelPropertyIndexStats>> label_property_stats;
     label_property_stats.reserve(label_property_counter.size());
-    std::for_each(
-        label_property_counter.begin(), label_property_counter.end(),
-        [execution_db_accessor, &vertex_degree_counter, &label_property_stats](const auto &counter_entry) {
-          const auto &[label_property, values_map] = counter_entry;
-          // Extract info
-          uint64_t count_property_value = std::accumulate(
-              values_map.begin(), values_map.end(), 0,
-              [](uint64_t prev_value, const auto &prop_value_count) { return prev_value + prop_value_count.second; });
-          // num_distinc_values will never be 0
-          double avg_group_size = static_cast<double>(count_property_value) / static_cast<double>(values_map.size());
-          double chi_squared_stat = std::accumulate(
-              values_map.begin(), values_map.end(), 0.0, [avg_group_size](double prev_result, const auto &value_entry) {
-                return prev_result + utils::ChiSquaredValue(value_entry.second, avg_group_size);
-              });
-
-          double average_degree = count_property_value > 0
-                                      ? static_cast<double>(vertex_degree_counter[label_property]) /
-                                            static_cast<double>(count_property_value)
-                                      : 0;
-
-          auto index_stats =
-              storage::LabelPropertyIndexStats{.count = count_property_value,
-                                               .distinct_values_count = static_cast<uint64_t>(values_map.size()),
-                                               .statistic = chi_squared_stat,
-                                               .avg_group_size = avg_group_size,
-                                               .avg_degree = average_degree};
-          execution_db_accessor->SetIndexStats(label_property.first, label_property.second, index_stats);
-          label_property_stats.push_back(std::make_pair(label_property, index_stats));
-        });
+    std::for_each(label_property_counter.begin(), label_property_counter.end(),
+                  [execution_db_accessor, &vertex_degree_counter, &label_property_stats](const auto &counter_entry) {
+                    const auto &[label_property, values_map] = counter_entry;
+                    auto index_stats =
+                        ComputeLabelPropertyIndexStats(values_map, vertex_degree_counter[label_property]);
+                    index_stats.histogram = storage::PropertyValueHistogram::Build(values_map);
+                    execution_db_accessor->SetIndexStats(label_property.first, label_property.second, index_stats);
+                    label_property_stats.push_back(std::make_pair(label_property, index_stats));
+                  });
 
     return label_property_stats;
   };
 
+  // The statistics of a composite index are computed over the distinct tuples
+  // of the indexed properties.
+  auto populate_label_property_composite_stats = [execution_db_accessor, view](auto &index_info) {
+    std::vector<std::pair<LPCompositeIndex, storage::LabelPropertyIndexStats>> label_property_composite_stats;
+    label_property_composite_stats.reserve(index_info.size());
+    for (const auto &index : index_info) {
+      const auto &[label, properties] = index;
+      std::map<std::vector<storage::PropertyValue>, int64_t> values_counter;
+      uint64_t vertex_degree_counter{0};
+      auto vertices = execution_db_accessor->Vertices(view, label, properties, {}, std::nullopt, std::nullopt);
+      for (const auto &vertex : vertices) {
+        std::vector<storage::PropertyValue> values;
+        values.reserve(properties.size());
+        for (const auto &property : properties) {
+          values.push_back(*vertex.GetProperty(view, property));
+        }
+        values_counter[std::move(values)]++;
+        vertex_degree_counter += *vertex.OutDegree(view) + *vertex.InDegree(view);
+      }
+      if (values_counter.empty()) continue;
+
+      auto index_stats = ComputeLabelPropertyIndexStats(values_counter, vertex_degree_counter);
+      execution_db_accessor->SetIndexStats(label, properties, index_stats);
+      label_property_composite_stats.emplace_back(index, index_stats);
+    }
+
+    return label_property_composite_stats;
+  };
+
   auto index_info = execution_db_accessor->ListAllIndices();
 
   std::vector<storage::LabelId> label_indices_info = index_info.label;
@@ -1865,8 +2323,12 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
   erase_not_specified_label_property_indices(label_property_indices_info);
   auto label_property_stats = populate_label_property_stats(label_property_indices_info);
 
+  std::vector<LPCompositeIndex> label_property_composite_indices_info = index_info.label_property_composite;
+  erase_not_specified_label_property_indices(label_property_composite_indices_info);
+  auto label_property_composite_stats = populate_label_property_composite_stats(label_property_composite_indices_info);
+
   std::vector<std::vector<TypedValue>> results;
-  results.reserve(label_stats.size() + label_property_stats.size());
+  results.reserve(label_stats.size() + label_property_stats.size() + label_property_composite_stats.size());
 
   std::for_each(label_stats.begin(), label_stats.end(), [execution_db_accessor, &results](const auto &stat_entry) {
     std::vector<TypedValue> result;
@@ -1897,23 +2359,41 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
                   results.push_back(std::move(result));
                 });
 
+  std::for_each(label_property_composite_stats.begin(), label_property_composite_stats.end(),
+                [execution_db_accessor, &results](const auto &stat_entry) {
+                  std::vector<TypedValue> result;
+                  result.reserve(kComputeStatisticsNumResults);
+
+                  result.emplace_back(execution_db_accessor->LabelToName(stat_entry.first.first));
+                  result.emplace_back(PropertiesToString(*execution_db_accessor, stat_entry.first.second));
+                  result.emplace_back(static_cast<int64_t>(stat_entry.second.count));
+                  result.emplace_back(static_cast<int64_t>(stat_entry.second.distinct_values_count));
+                  result.emplace_back(stat_entry.second.avg_group_size);
+                  result.emplace_back(stat_entry.second.statistic);
+                  result.emplace_back(stat_entry.second.avg_degree);
+                  results.push_back(std::move(result));
+                });
+
   return results;
 }
 
 std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphDeleteStatistics(
     const std::span<std::string> labels, DbAccessor *execution_db_accessor) {
   std::vector<std::pair<storage::LabelId, storage::PropertyId>> label_prop_results;
+  std::vector<std::pair<storage::LabelId, std::vector<storage::PropertyId>>> label_prop_composite_results;
   std::vector<storage::LabelId> label_results;
   if (labels[0] == kAsterisk) {
     label_prop_results = execution_db_accessor->ClearLabelPropertyIndexStats();
+    label_prop_composite_results = execution_db_accessor->ClearLabelPropertyCompositeIndexStats();
     label_results = execution_db_accessor->ClearLabelIndexStats();
   } else {
     label_prop_results = execution_db_accessor->DeleteLabelPropertyIndexStats(labels);
+    label_prop_composite_results = execution_db_accessor->DeleteLabelPropertyCompositeIndexStats(labels);
     label_results = execution_db_accessor->DeleteLabelIndexStats(labels);
   }
 
   std::vector<std::vector<TypedValue>> results;
-  results.reserve(label_prop_results.size() + label_results.size());
+  results.reserve(label_prop_results.size() + label_prop_composite_results.size() + label_results.size());
   std::transform(label_prop_results.begin(), label_prop_results.end(), std::back_inserter(results),
                  [execution_db_accessor](const auto &label_property_index) {
                    return std::vector<TypedValue>{
@@ -1921,6 +2401,13 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphDelet
                        TypedValue(execution_db_accessor->PropertyToName(label_property_index.second))};
                  });
 
+  std::transform(label_prop_composite_results.begin(), label_prop_composite_results.end(),
+                 std::back_inserter(results), [execution_db_accessor](const auto &label_property_composite_index) {
+                   return std::vector<TypedValue>{
+                       TypedValue(execution_db_accessor->LabelToName(label_property_composite_index.first)),
+                       TypedValue(PropertiesToString(*execution_db_accessor, label_property_composite_index.second))};
+                 });
+
   std::transform(
       label_results.begin(), label_results.end(), std::back_inserter(results),
       [execution_db_accessor](const auto &label_index) {
@@ -1962,12 +2449,7 @@ PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explici
   }
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] {
-    auto access = plan_cache->access();
-    for (auto &kv : access) {
-      access.remove(kv.first);
-    }
-  };
+  auto invalidate_plan_cache = [interpreter_context] { InvalidatePlanCache(interpreter_context); };
   utils::OnScopeExit cache_invalidator(invalidate_plan_cache);
 
   auto *analyze_graph_query = utils::Downcast<AnalyzeGraphQuery>(parsed_query.query);
@@ -1989,6 +2471,169 @@ PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explici
                        RWType::NONE};
 }
 
+PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, std::vector<Notification> *notifications,
+                                    InterpreterContext *interpreter_context) {
+  auto *index_query = utils::Downcast<IndexQuery>(parsed_query.query);
+  MG_ASSERT(index_query->type_ == IndexQuery::Type::EDGE_TYPE, "Expected an edge index query!");
+  if (interpreter_context->db->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    throw utils::NotYetImplemented("edge indices in the on-disk storage");
+  }
+  auto edge_type = interpreter_context->db->NameToEdgeType(index_query->edge_type_.name);
+  if (!index_query->properties_.empty() && !interpreter_context->db->config_.items.PropertiesOnEdges(edge_type)) {
+    throw SemanticException("Edge type+property indices require properties on the edges of their type to be enabled!");
+  }
+  std::optional<storage::PropertyId> property;
+  std::string index_description = fmt::format("edge type {}", index_query->edge_type_.name);
+  if (!index_query->properties_.empty()) {
+    property = interpreter_context->db->NameToProperty(index_query->properties_[0].name);
+    index_description += fmt::format(" on property {}", index_query->properties_[0].name);
+  }
+
+  Notification index_notification(SeverityLevel::INFO);
+  const bool create = index_query->action_ == IndexQuery::Action::CREATE;
+  index_notification.code = create ? NotificationCode::CREATE_INDEX : NotificationCode::DROP_INDEX;
+  index_notification.title = fmt::format("{} index on {}.", create ? "Created" : "Dropped", index_description);
+
+  auto handler = [interpreter_context, edge_type, property, create,
+                  index_description = std::move(index_description)](Notification &index_notification) {
+    auto maybe_index_error = [&] {
+      if (create) {
+        return property ? interpreter_context->db->CreateIndex(edge_type, *property)
+                        : interpreter_context->db->CreateIndex(edge_type);
+      }
+      return property ? interpreter_context->db->DropIndex(edge_type, *property)
+                      : interpreter_context->db->DropIndex(edge_type);
+    }();
+    // Creating an index influences computed plan costs.
+    utils::OnScopeExit invalidator([interpreter_context] { InvalidatePlanCache(interpreter_context); });
+
+    if (maybe_index_error.HasError()) {
+      const auto &error = maybe_index_error.GetError();
+      std::visit(
+          [&index_notification, &index_description, create]<typename T>(T &&) {
+            using ErrorType = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<ErrorType, storage::ReplicationError>) {
+              throw ReplicationException(
+                  fmt::format("At least one SYNC replica has not confirmed the {} of the index on {}.",
+                              create ? "creation" : "dropping", index_description));
+            } else if constexpr (std::is_same_v<ErrorType, storage::IndexDefinitionError>) {
+              index_notification.code = create ? NotificationCode::EXISTENT_INDEX : NotificationCode::NONEXISTENT_INDEX;
+              index_notification.title =
+                  fmt::format("Index on {} {}.", index_description, create ? "already exists" : "doesn't exist");
+            } else if constexpr (std::is_same_v<ErrorType, storage::IndexPersistenceError>) {
+              throw IndexPersistenceException();
+            } else {
+              static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
+            }
+          },
+          error);
+    }
+  };
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [handler = std::move(handler), notifications, index_notification = std::move(index_notification)](
+          AnyStream * /*stream*/, std::optional<int> /*unused*/) mutable {
+        handler(index_notification);
+        notifications->push_back(index_notification);
+        return QueryHandlerResult::NOTHING;
+      },
+      RWType::W};
+}
+
+/// Prepares the queries of the text, point and vector indices, which are all
+/// on one property of the vertices with a label.
+PreparedQuery PrepareSinglePropertyIndexQuery(ParsedQuery parsed_query, std::vector<Notification> *notifications,
+                                              InterpreterContext *interpreter_context) {
+  auto *index_query = utils::Downcast<IndexQuery>(parsed_query.query);
+  MG_ASSERT(index_query->properties_.size() == 1, "Text, point and vector indices are on exactly one property!");
+  const auto type = index_query->type_;
+  const std::string_view index_kind = std::invoke([type]() -> std::string_view {
+    switch (type) {
+      case IndexQuery::Type::TEXT:
+        return "text";
+      case IndexQuery::Type::POINT:
+        return "point";
+      case IndexQuery::Type::VECTOR:
+        return "vector";
+      case IndexQuery::Type::LABEL:
+      case IndexQuery::Type::EDGE_TYPE:
+        break;
+    }
+    LOG_FATAL("Expected a text, point or vector index query!");
+  });
+  if (interpreter_context->db->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    throw utils::NotYetImplemented(fmt::format("{} indices in the on-disk storage", index_kind));
+  }
+
+  auto label = interpreter_context->db->NameToLabel(index_query->label_.name);
+  auto property = interpreter_context->db->NameToProperty(index_query->properties_[0].name);
+  std::string index_description =
+      fmt::format("label {} on property {}", index_query->label_.name, index_query->properties_[0].name);
+
+  Notification index_notification(SeverityLevel::INFO);
+  const bool create = index_query->action_ == IndexQuery::Action::CREATE;
+  index_notification.code = create ? NotificationCode::CREATE_INDEX : NotificationCode::DROP_INDEX;
+  index_notification.title =
+      fmt::format("{} {} index on {}.", create ? "Created" : "Dropped", index_kind, index_description);
+
+  auto handler = [interpreter_context, label, property, create, type, index_kind,
+                  index_description = std::move(index_description)](Notification &index_notification) {
+    auto *db = interpreter_context->db.get();
+    auto maybe_index_error = std::invoke([db, label, property, create, type] {
+      switch (type) {
+        case IndexQuery::Type::TEXT:
+          return create ? db->CreateTextIndex(label, property) : db->DropTextIndex(label, property);
+        case IndexQuery::Type::POINT:
+          return create ? db->CreatePointIndex(label, property) : db->DropPointIndex(label, property);
+        case IndexQuery::Type::VECTOR:
+          return create ? db->CreateVectorIndex(label, property) : db->DropVectorIndex(label, property);
+        case IndexQuery::Type::LABEL:
+        case IndexQuery::Type::EDGE_TYPE:
+          break;
+      }
+      LOG_FATAL("Expected a text, point or vector index query!");
+    });
+    // Creating an index influences computed plan costs.
+    utils::OnScopeExit invalidator([interpreter_context] { InvalidatePlanCache(interpreter_context); });
+
+    if (maybe_index_error.HasError()) {
+      const auto &error = maybe_index_error.GetError();
+      std::visit(
+          [&index_notification, &index_description, create, index_kind]<typename T>(T &&) {
+            using ErrorType = std::remove_cvref_t<T>;
+            if constexpr (std::is_same_v<ErrorType, storage::ReplicationError>) {
+              throw ReplicationException(
+                  fmt::format("At least one SYNC replica has not confirmed the {} of the {} index on {}.",
+                              create ? "creation" : "dropping", index_kind, index_description));
+            } else if constexpr (std::is_same_v<ErrorType, storage::IndexDefinitionError>) {
+              index_notification.code = create ? NotificationCode::EXISTENT_INDEX : NotificationCode::NONEXISTENT_INDEX;
+              index_notification.title =
+                  fmt::format("{}{} index on {} {}.", static_cast<char>(std::toupper(index_kind.front())),
+                              index_kind.substr(1), index_description, create ? "already exists" : "doesn't exist");
+            } else if constexpr (std::is_same_v<ErrorType, storage::IndexPersistenceError>) {
+              throw IndexPersistenceException();
+            } else {
+              static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
+            }
+          },
+          error);
+    }
+  };
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [handler = std::move(handler), notifications, index_notification = std::move(index_notification)](
+          AnyStream * /*stream*/, std::optional<int> /*unused*/) mutable {
+        handler(index_notification);
+        notifications->push_back(index_notification);
+        return QueryHandlerResult::NOTHING;
+      },
+      RWType::W};
+}
+
 PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
                                 std::vector<Notification> *notifications, InterpreterContext *interpreter_context) {
   if (in_explicit_transaction) {
@@ -1996,15 +2641,17 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   }
 
   auto *index_query = utils::Downcast<IndexQuery>(parsed_query.query);
+  if (index_query->type_ == IndexQuery::Type::EDGE_TYPE) {
+    return PrepareEdgeIndexQuery(std::move(parsed_query), notifications, interpreter_context);
+  }
+  if (index_query->type_ == IndexQuery::Type::TEXT || index_query->type_ == IndexQuery::Type::POINT ||
+      index_query->type_ == IndexQuery::Type::VECTOR) {
+    return PrepareSinglePropertyIndexQuery(std::move(parsed_query), notifications, interpreter_context);
+  }
   std::function<void(Notification &)> handler;
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = &interpreter_context->plan_cache] {
-    auto access = plan_cache->access();
-    for (auto &kv : access) {
-      access.remove(kv.first);
-    }
-  };
+  auto invalidate_plan_cache = [interpreter_context] { InvalidatePlanCache(interpreter_context); };
 
   auto label = interpreter_context->db->NameToLabel(index_query->label_.name);
 
@@ -2019,7 +2666,12 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   auto properties_stringified = utils::Join(properties_string, ", ");
 
   if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
+    if (interpreter_context->db->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+      throw utils::NotYetImplemented("index on multiple properties in the on-disk storage");
+    }
+    if (std::set<storage::PropertyId>(properties.begin(), properties.end()).size() != properties.size()) {
+      throw SemanticException("The same property can't be used more than once in an index!");
+    }
   }
 
   Notification index_notification(SeverityLevel::INFO);
@@ -2032,9 +2684,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [interpreter_context, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? interpreter_context->db->CreateIndex(label)
-                                                    : interpreter_context->db->CreateIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return interpreter_context->db->CreateIndex(label);
+          if (properties.size() == 1) return interpreter_context->db->CreateIndex(label, properties[0]);
+          return interpreter_context->db->CreateIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2069,9 +2723,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [interpreter_context, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? interpreter_context->db->DropIndex(label)
-                                                    : interpreter_context->db->DropIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return interpreter_context->db->DropIndex(label);
+          if (properties.size() == 1) return interpreter_context->db->DropIndex(label, properties[0]);
+          return interpreter_context->db->DropIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2135,6 +2791,8 @@ PreparedQuery PrepareAuthQuery(ParsedQuery parsed_query, bool in_explicit_transa
           // Invalidate auth cache after every type of AuthQuery
           interpreter_context->auth_checker->ClearCache();
 #endif
+          // Cached results may not be visible to the users anymore.
+          gQueryResultCache.Clear();
         }
 
         if (pull_plan->Pull(stream, n)) {
@@ -2363,14 +3021,14 @@ Callback ShowTriggers(InterpreterContext *interpreter_context) {
 
 PreparedQuery PrepareTriggerQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
                                   std::vector<Notification> *notifications, InterpreterContext *interpreter_context,
-                                  DbAccessor *dba, const std::map<std::string, storage::PropertyValue> &user_parameters,
-                                  const std::string *username) {
+                                  DbAccessor *dba, const std::string *username) {
   if (in_explicit_transaction) {
     throw TriggerModificationInMulticommandTxException();
   }
 
   auto *trigger_query = utils::Downcast<TriggerQuery>(parsed_query.query);
   MG_ASSERT(trigger_query);
+  const auto &user_parameters = parsed_query.user_parameters;
 
   std::optional<Notification> trigger_notification;
   auto callback = std::invoke([trigger_query, interpreter_context, dba, &user_parameters,
@@ -2410,6 +3068,77 @@ PreparedQuery PrepareTriggerQuery(ParsedQuery parsed_query, bool in_explicit_tra
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
+Callback HandleMaterializedViewQuery(MaterializedViewQuery *view_query, InterpreterContext *interpreter_context) {
+  auto *views = &interpreter_context->materialized_views;
+  switch (view_query->action_) {
+    case MaterializedViewQuery::Action::CREATE_VIEW:
+      return {{},
+              [views, view_name = std::move(view_query->view_name_),
+               view_statement = std::move(view_query->statement_),
+               interpreter_context]() mutable -> std::vector<std::vector<TypedValue>> {
+                views->AddView(std::move(view_name), view_statement, interpreter_context->db.get(),
+                               &interpreter_context->ast_cache, interpreter_context->config.query);
+                return {};
+              }};
+    case MaterializedViewQuery::Action::DROP_VIEW:
+      return {{},
+              [views, view_name = std::move(view_query->view_name_)]() -> std::vector<std::vector<TypedValue>> {
+                views->DropView(view_name);
+                return {};
+              }};
+    case MaterializedViewQuery::Action::SHOW_VIEWS:
+      return {{"view name", "statement"}, [views] {
+                std::vector<std::vector<TypedValue>> results;
+                auto view_infos = views->GetViewInfo();
+                results.reserve(view_infos.size());
+                for (auto &view_info : view_infos) {
+                  std::vector<TypedValue> typed_view_info;
+                  typed_view_info.reserve(2);
+                  typed_view_info.emplace_back(std::move(view_info.name));
+                  typed_view_info.emplace_back(std::move(view_info.statement));
+                  results.push_back(std::move(typed_view_info));
+                }
+                return results;
+              }};
+    case MaterializedViewQuery::Action::SHOW_VIEW: {
+      auto view = views->Find(view_query->view_name_);
+      if (!view) {
+        throw QueryException("Materialized view with name '{}' doesn't exist.", view_query->view_name_);
+      }
+      auto header = view->Header();
+      return {std::move(header),
+              [view = std::move(view), interpreter_context] { return view->Rows(interpreter_context->db.get()); }};
+    }
+  }
+}
+
+PreparedQuery PrepareMaterializedViewQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                           InterpreterContext *interpreter_context) {
+  if (in_explicit_transaction) {
+    throw MaterializedViewInMulticommandTxException();
+  }
+
+  auto *view_query = utils::Downcast<MaterializedViewQuery>(parsed_query.query);
+  MG_ASSERT(view_query);
+  auto callback = HandleMaterializedViewQuery(view_query, interpreter_context);
+
+  return PreparedQuery{std::move(callback.header), std::move(parsed_query.required_privileges),
+                       [callback_fn = std::move(callback.fn), pull_plan = std::shared_ptr<PullPlanVector>{nullptr}](
+                           AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+                         if (UNLIKELY(!pull_plan)) {
+                           pull_plan = std::make_shared<PullPlanVector>(callback_fn());
+                         }
+
+                         if (pull_plan->Pull(stream, n)) {
+                           return QueryHandlerResult::COMMIT;
+                         }
+                         return std::nullopt;
+                       },
+                       RWType::NONE};
+  // False positive report for the std::make_shared above
+  // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
+}
+
 PreparedQuery PrepareStreamQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
                                  std::vector<Notification> *notifications, InterpreterContext *interpreter_context,
                                  const std::string *username) {
@@ -2597,7 +3326,10 @@ PreparedQuery PrepareStorageModeQuery(ParsedQuery parsed_query, const bool in_ex
     }
 
     callback = [requested_mode, interpreter_context]() -> std::function<void()> {
-      return [interpreter_context, requested_mode] { interpreter_context->db->SetStorageMode(requested_mode); };
+      return [interpreter_context, requested_mode] {
+        interpreter_context->db->SetStorageMode(requested_mode);
+        interpreter_context->materialized_views.MarkStale(std::nullopt);
+      };
     }();
   }
 
@@ -2617,7 +3349,9 @@ PreparedQuery PrepareEdgeImportModeQuery(ParsedQuery parsed_query, const bool in
     throw EdgeImportModeModificationInMulticommandTxException();
   }
 
-  if (interpreter_context->db->GetStorageMode() != storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+  const auto storage_mode = interpreter_context->db->GetStorageMode();
+  if (storage_mode != storage::StorageMode::ON_DISK_TRANSACTIONAL &&
+      storage_mode != storage::StorageMode::IN_MEMORY_ANALYTICAL) {
     throw EdgeImportModeQueryDisabledOnDiskStorage();
   }
 
@@ -2625,10 +3359,15 @@ PreparedQuery PrepareEdgeImportModeQuery(ParsedQuery parsed_query, const bool in
   MG_ASSERT(edge_import_mode_query);
   const auto requested_status = ToEdgeImportMode(edge_import_mode_query->status_);
 
-  auto callback = [requested_status, interpreter_context]() -> std::function<void()> {
-    return [interpreter_context, requested_status] {
-      auto *disk_storage = static_cast<storage::DiskStorage *>(interpreter_context->db.get());
-      disk_storage->SetEdgeImportMode(requested_status);
+  auto callback = [requested_status, storage_mode, interpreter_context]() -> std::function<void()> {
+    return [interpreter_context, requested_status, storage_mode] {
+      if (storage_mode == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+        auto *disk_storage = static_cast<storage::DiskStorage *>(interpreter_context->db.get());
+        disk_storage->SetEdgeImportMode(requested_status);
+      } else {
+        auto *mem_storage = static_cast<storage::InMemoryStorage *>(interpreter_context->db.get());
+        mem_storage->SetEdgeImportMode(requested_status);
+      }
     };
   }();
 
@@ -2730,6 +3469,8 @@ std::vector<std::vector<TypedValue>> TransactionQueueQueryHandler::ShowTransacti
         }
       }
       results.back().push_back(TypedValue(metadata_tv));
+      const auto peak_memory = interpreter->GetTransactionPeakMemory();
+      results.back().push_back(peak_memory ? TypedValue(*peak_memory) : TypedValue());
     }
   }
   return results;
@@ -2797,7 +3538,7 @@ Callback HandleTransactionQueueQuery(TransactionQueueQuery *transaction_query,
   Callback callback;
   switch (transaction_query->action_) {
     case TransactionQueueQuery::Action::SHOW_TRANSACTIONS: {
-      callback.header = {"username", "transaction_id", "query", "metadata"};
+      callback.header = {"username", "transaction_id", "query", "metadata", "peak_memory_allocated"};
       callback.fn = [handler = TransactionQueueQueryHandler(), interpreter_context, username,
                      hasTransactionManagementPrivilege]() mutable {
         std::vector<std::vector<TypedValue>> results;
@@ -2891,7 +3632,7 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
     case InfoQuery::InfoType::STORAGE:
       header = {"storage info", "value"};
 
-      handler = [db, interpreter_isolation_level, next_transaction_isolation_level] {
+      handler = [db, interpreter_context, interpreter_isolation_level, next_transaction_isolation_level] {
         auto info = db->GetInfo();
         std::vector<std::vector<TypedValue>> results{
             {TypedValue("name"), TypedValue(db->id())},
@@ -2902,6 +3643,10 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
             {TypedValue("disk_usage"), TypedValue(static_cast<int64_t>(info.disk_usage))},
             {TypedValue("memory_allocated"), TypedValue(static_cast<int64_t>(utils::total_memory_tracker.Amount()))},
             {TypedValue("allocation_limit"), TypedValue(static_cast<int64_t>(utils::total_memory_tracker.HardLimit()))},
+            {TypedValue("query_memory_allocated"),
+             TypedValue(static_cast<int64_t>(interpreter_context->query_memory_tracker.Amount()))},
+            {TypedValue("query_memory_limit"),
+             TypedValue(static_cast<int64_t>(interpreter_context->query_memory_tracker.HardLimit()))},
             {TypedValue("global_isolation_level"), TypedValue(IsolationLevelToString(db->GetIsolationLevel()))},
             {TypedValue("session_isolation_level"), TypedValue(IsolationLevelToString(interpreter_isolation_level))},
             {TypedValue("next_session_isolation_level"),
@@ -2915,10 +3660,18 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
       handler = [interpreter_context] {
         const std::string_view label_index_mark{"label"};
         const std::string_view label_property_index_mark{"label+property"};
+        const std::string_view label_property_composite_index_mark{"label+properties"};
+        const std::string_view edge_type_index_mark{"edge-type"};
+        const std::string_view edge_type_property_index_mark{"edge-type+property"};
+        const std::string_view text_index_mark{"text"};
+        const std::string_view point_index_mark{"point"};
+        const std::string_view vector_index_mark{"vector"};
         auto *db = interpreter_context->db.get();
         auto info = db->ListAllIndices();
         std::vector<std::vector<TypedValue>> results;
-        results.reserve(info.label.size() + info.label_property.size());
+        results.reserve(info.label.size() + info.label_property.size() + info.label_property_composite.size() +
+                        info.edge_type.size() + info.edge_type_property.size() + info.text.size() +
+                        info.point.size() + info.vector.size());
         for (const auto &item : info.label) {
           results.push_back({TypedValue(label_index_mark), TypedValue(db->LabelToName(item)), TypedValue()});
         }
@@ -2926,8 +3679,32 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
           results.push_back({TypedValue(label_property_index_mark), TypedValue(db->LabelToName(item.first)),
                              TypedValue(db->PropertyToName(item.second))});
         }
+        for (const auto &item : info.label_property_composite) {
+          results.push_back({TypedValue(label_property_composite_index_mark), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(PropertiesToString(*db, item.second))});
+        }
+        for (const auto &item : info.edge_type) {
+          results.push_back({TypedValue(edge_type_index_mark), TypedValue(db->EdgeTypeToName(item)), TypedValue()});
+        }
+        for (const auto &item : info.edge_type_property) {
+          results.push_back({TypedValue(edge_type_property_index_mark), TypedValue(db->EdgeTypeToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
+        for (const auto &item : info.text) {
+          results.push_back({TypedValue(text_index_mark), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
+        for (const auto &item : info.point) {
+          results.push_back({TypedValue(point_index_mark), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
+        for (const auto &item : info.vector) {
+          results.push_back({TypedValue(vector_index_mark), TypedValue(db->LabelToName(item.first)),
+                             TypedValue(db->PropertyToName(item.second))});
+        }
 
-        std::sort(results.begin(), results.end(), [&label_index_mark](const auto &record_1, const auto &record_2) {
+        std::sort(results.begin(), results.end(), [&label_index_mark, &edge_type_index_mark](const auto &record_1,
+                                                                                             const auto &record_2) {
           const auto type_1 = record_1[0].ValueString();
           const auto type_2 = record_2[0].ValueString();
 
@@ -2937,7 +3714,7 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
 
           const auto label_1 = record_1[1].ValueString();
           const auto label_2 = record_2[1].ValueString();
-          if (type_1 == label_index_mark || label_1 != label_2) {
+          if (type_1 == label_index_mark || type_1 == edge_type_index_mark || label_1 != label_2) {
             return label_1 < label_2;
           }
 
@@ -2979,6 +3756,58 @@ PreparedQuery PrepareInfoQuery(ParsedQuery parsed_query, bool in_explicit_transa
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
       break;
+    case InfoQuery::InfoType::SLOW_QUERIES:
+      header = {"timestamp", "username", "query_hash", "query", "parameters", "plan", "parsing_time", "planning_time",
+                "execution_time", "streaming_time", "commit_time", "total_time"};
+      handler = [interpreter_context] {
+        const auto slow_queries = interpreter_context->slow_query_log.Recent();
+        std::vector<std::vector<TypedValue>> results;
+        results.reserve(slow_queries.size());
+        // The latest queries first.
+        for (auto it = slow_queries.rbegin(); it != slow_queries.rend(); ++it) {
+          results.push_back({TypedValue(it->timestamp), TypedValue(it->username),
+                             TypedValue(static_cast<int64_t>(it->query_hash)), TypedValue(it->query),
+                             TypedValue(it->parameters), TypedValue(it->plan), TypedValue(it->parsing_time),
+                             TypedValue(it->planning_time), TypedValue(it->execution_time),
+                             TypedValue(it->streaming_time), TypedValue(it->commit_time),
+                             TypedValue(it->TotalTime())});
+        }
+        return std::pair{results, QueryHandlerResult::NOTHING};
+      };
+      break;
+    case InfoQuery::InfoType::INDEX_RECOMMENDATIONS:
+      header = {"index type", "label", "properties", "comparison", "executions", "scanned_rows", "discarded_rows",
+                "estimated_saved_cost"};
+      handler = [interpreter_context] {
+        auto *db = interpreter_context->db.get();
+        const auto info = db->ListAllIndices();
+        // Queries planned before an index was made keep scanning by label
+        // until their plans expire.
+        auto exists = [&info](const IndexAdvisor::Recommendation &recommendation) {
+          if (recommendation.properties.size() == 1) {
+            return std::find(info.label_property.begin(), info.label_property.end(),
+                             std::pair{recommendation.label, recommendation.properties[0]}) !=
+                   info.label_property.end();
+          }
+          return std::find(info.label_property_composite.begin(), info.label_property_composite.end(),
+                           std::pair{recommendation.label, recommendation.properties}) !=
+                 info.label_property_composite.end();
+        };
+        std::vector<std::vector<TypedValue>> results;
+        for (const auto &recommendation : interpreter_context->index_advisor.Recommendations()) {
+          if (exists(recommendation)) continue;
+          results.push_back(
+              {TypedValue(recommendation.properties.size() == 1 ? "label+property" : "label+properties"),
+               TypedValue(db->LabelToName(recommendation.label)),
+               TypedValue(PropertiesToString(*db, recommendation.properties)),
+               TypedValue(recommendation.equality ? "equality" : "range"),
+               TypedValue(static_cast<int64_t>(recommendation.executions)),
+               TypedValue(static_cast<int64_t>(recommendation.scanned_rows)),
+               TypedValue(static_cast<int64_t>(recommendation.discarded_rows)), TypedValue(recommendation.saved_cost)});
+        }
+        return std::pair{results, QueryHandlerResult::NOTHING};
+      };
+      break;
   }
 
   return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
@@ -3499,6 +4328,11 @@ std::optional<uint64_t> Interpreter::GetTransactionId() const {
   return {};
 }
 
+std::optional<int64_t> Interpreter::GetTransactionPeakMemory() const {
+  if (transaction_memory_tracker_) return transaction_memory_tracker_->Peak();
+  return {};
+}
+
 void Interpreter::BeginTransaction(QueryExtras const &extras) {
   const auto prepared_query = PrepareTransactionQuery("BEGIN", extras);
   prepared_query.query_handler(nullptr, {});
@@ -3519,13 +4353,14 @@ void Interpreter::RollbackTransaction() {
 }
 
 Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
-                                                const std::map<std::string, storage::PropertyValue> &params,
+                                                std::map<std::string, storage::PropertyValue> params,
                                                 const std::string *username, QueryExtras const &extras,
                                                 const std::string &session_uuid) {
   std::shared_ptr<utils::AsyncTimer> current_timer;
   if (!in_explicit_transaction_) {
     query_executions_.clear();
     transaction_queries_->clear();
+    WaitForBookmarks(extras.bookmarks);
     // Handle user-defined metadata in auto-transactions
     metadata_ = GenOptional(extras.metadata_pv);
     auto const timeout = DetermineTxTimeout(extras.tx_timeout, interpreter_context_->config);
@@ -3555,8 +4390,18 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     return {query_execution->prepared_query->header, query_execution->prepared_query->privileges, qid, {}};
   }
 
+  // A prepared statement is executed by its name without the query.
+  PreparedStatement *statement = nullptr;
+  if (extras.prepared_statement && query_string.empty()) {
+    auto it = prepared_statements_.find(*extras.prepared_statement);
+    if (it == prepared_statements_.end()) {
+      throw QueryException("Prepared statement {} doesn't exist.", *extras.prepared_statement);
+    }
+    statement = &it->second;
+  }
+
   // Don't save BEGIN, COMMIT or ROLLBACK
-  transaction_queries_->push_back(query_string);
+  transaction_queries_->push_back(statement ? statement->query_string : query_string);
 
   // All queries other than transaction control queries advance the command in
   // an explicit transaction block.
@@ -3576,8 +4421,12 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         std::make_unique<QueryExecution>(utils::MonotonicBufferResource(kExecutionMemoryBlockSize)));
     query_execution_ptr = &query_executions_.back();
     utils::Timer parsing_timer;
-    ParsedQuery parsed_query =
-        ParseQuery(query_string, params, &interpreter_context_->ast_cache, interpreter_context_->config.query);
+    ParsedQuery parsed_query = statement ? ParsePreparedStatement(statement, std::move(params), interpreter_context_)
+                                         : ParseQuery(query_string, std::move(params), &interpreter_context_->ast_cache,
+                                                      interpreter_context_->config.query);
+    if (extras.prepared_statement && !statement) {
+      statement = &(prepared_statements_[*extras.prepared_statement] = MakePreparedStatement(parsed_query));
+    }
     TypedValue parsing_time{parsing_timer.Elapsed().count()};
 
     if ((utils::Downcast<CypherQuery>(parsed_query.query) || utils::Downcast<ProfileQuery>(parsed_query.query))) {
@@ -3608,25 +4457,31 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
         in_explicit_transaction_ ? static_cast<int>(query_executions_.size() - 1) : std::optional<int>{};
 
     query_execution->summary["parsing_time"] = std::move(parsing_time);
+    query_execution->stripped_query = parsed_query.stripped_query;
+    query_execution->fingerprint = metrics::global_query_fingerprints.Execute(parsed_query.stripped_query->hash());
+    if (interpreter_context_->slow_query_log.IsEnabled()) {
+      query_execution->parameters = ParametersShape(parsed_query.user_parameters);
+    }
 
     // Set a default cost estimate of 0. Individual queries can overwrite this
     // field with an improved estimate.
     query_execution->summary["cost_estimate"] = 0.0;
 
-    // Some queries require an active transaction in order to be prepared.
+    // Some queries require an active transaction in order to be prepared. A
+    // dump to a directory makes its own snapshot transaction.
+    auto *dump_query = utils::Downcast<DumpQuery>(parsed_query.query);
     if (!in_explicit_transaction_ &&
         (utils::Downcast<CypherQuery>(parsed_query.query) || utils::Downcast<ExplainQuery>(parsed_query.query) ||
-         utils::Downcast<ProfileQuery>(parsed_query.query) || utils::Downcast<DumpQuery>(parsed_query.query) ||
+         utils::Downcast<ProfileQuery>(parsed_query.query) || (dump_query && !dump_query->directory_) ||
          utils::Downcast<TriggerQuery>(parsed_query.query) || utils::Downcast<AnalyzeGraphQuery>(parsed_query.query) ||
          utils::Downcast<TransactionQueueQuery>(parsed_query.query))) {
       memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveTransactions);
       db_accessor_ = interpreter_context_->db->Access(GetIsolationLevelOverride());
       execution_db_accessor_.emplace(db_accessor_.get());
+      SetupTransactionMemoryTracker();
       transaction_status_.store(TransactionStatus::ACTIVE, std::memory_order_release);
 
-      if (utils::Downcast<CypherQuery>(parsed_query.query) && interpreter_context_->trigger_store.HasTriggers()) {
-        trigger_context_collector_.emplace(interpreter_context_->trigger_store.GetEventTypes());
-      }
+      if (utils::Downcast<CypherQuery>(parsed_query.query)) SetupTriggerContextCollector();
     }
 
     utils::Timer planning_timer;
@@ -3637,10 +4492,34 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     frame_change_collector_.reset();
     frame_change_collector_.emplace(memory_resource);
     if (utils::Downcast<CypherQuery>(parsed_query.query)) {
-      prepared_query = PrepareCypherQuery(
-          std::move(parsed_query), &query_execution->summary, interpreter_context_, &*execution_db_accessor_,
-          memory_resource, &query_execution->notifications, username, &transaction_status_, std::move(current_timer),
-          trigger_context_collector_ ? &*trigger_context_collector_ : nullptr, &*frame_change_collector_);
+      // Results of read-only queries in auto-commit transactions are reused
+      // while the database doesn't change, or for as long as the client allows.
+      std::optional<QueryResultCache::Key> result_cache_key;
+      std::optional<storage::SnapshotId> snapshot;
+      std::optional<std::chrono::milliseconds> max_staleness;
+      if (gQueryResultCache.Enabled() && !in_explicit_transaction_) {
+        snapshot = db_accessor_->GetSnapshotId();
+        if (extras.result_cache_max_staleness_ms.value_or(0) > 0) {
+          max_staleness = std::chrono::milliseconds(*extras.result_cache_max_staleness_ms);
+        }
+        if (snapshot || max_staleness) {
+          result_cache_key = QueryResultCache::MakeKey(interpreter_context_->db->id(), username_, parsed_query);
+        }
+      }
+      if (auto cached_result =
+              result_cache_key ? gQueryResultCache.Find(*result_cache_key, snapshot, max_staleness) : nullptr) {
+        prepared_query =
+            PrepareCachedResultQuery(std::move(cached_result), std::move(parsed_query.required_privileges));
+      } else {
+        prepared_query = PrepareCypherQuery(
+            std::move(parsed_query), &query_execution->summary, interpreter_context_, &*execution_db_accessor_,
+            memory_resource, &query_execution->notifications, username, &transaction_status_,
+            std::move(current_timer), trigger_context_collector_ ? &*trigger_context_collector_ : nullptr,
+            &*frame_change_collector_, statement, &*local_plan_cache_);
+        if (result_cache_key && prepared_query.rw_type == RWType::R) {
+          RecordQueryResult(&prepared_query, std::move(*result_cache_key), snapshot);
+        }
+      }
     } else if (utils::Downcast<ExplainQuery>(parsed_query.query)) {
       prepared_query = PrepareExplainQuery(std::move(parsed_query), &query_execution->summary, interpreter_context_,
                                            &*execution_db_accessor_, &query_execution->execution_memory_with_exception);
@@ -3649,7 +4528,10 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
                                            interpreter_context_, &*execution_db_accessor_,
                                            &query_execution->execution_memory_with_exception, username,
                                            &transaction_status_, std::move(current_timer), &*frame_change_collector_);
-    } else if (utils::Downcast<DumpQuery>(parsed_query.query)) {
+    } else if (dump_query && dump_query->directory_) {
+      prepared_query =
+          PrepareDumpToDirectoryQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
+    } else if (dump_query) {
       prepared_query = PrepareDumpQuery(std::move(parsed_query), &query_execution->summary, &*execution_db_accessor_,
                                         memory_resource);
     } else if (utils::Downcast<IndexQuery>(parsed_query.query)) {
@@ -3680,7 +4562,7 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<TriggerQuery>(parsed_query.query)) {
       prepared_query =
           PrepareTriggerQuery(std::move(parsed_query), in_explicit_transaction_, &query_execution->notifications,
-                              interpreter_context_, &*execution_db_accessor_, params, username);
+                              interpreter_context_, &*execution_db_accessor_, username);
     } else if (utils::Downcast<StreamQuery>(parsed_query.query)) {
       prepared_query = PrepareStreamQuery(std::move(parsed_query), in_explicit_transaction_,
                                           &query_execution->notifications, interpreter_context_, username);
@@ -3708,6 +4590,9 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<EdgeImportModeQuery>(parsed_query.query)) {
       prepared_query =
           PrepareEdgeImportModeQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
+    } else if (utils::Downcast<MaterializedViewQuery>(parsed_query.query)) {
+      prepared_query =
+          PrepareMaterializedViewQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_);
     } else {
       LOG_FATAL("Should not get here -- unknown query type!");
     }
@@ -3740,6 +4625,61 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
   }
 }
 
+void Interpreter::RecordFinishedQuery(const QueryExecution &query_execution, const CachedPlan *plan,
+                                      bool plan_cache_hit, const std::map<std::string, TypedValue> &summary,
+                                      std::chrono::duration<double> commit_time) {
+  auto &slow_query_log = interpreter_context_->slow_query_log;
+  // Transaction control queries aren't parsed.
+  if ((!slow_query_log.IsEnabled() && !query_execution.fingerprint) || !query_execution.stripped_query) return;
+
+  const auto seconds = [&summary](const std::string &key) {
+    auto it = summary.find(key);
+    return it != summary.end() && it->second.IsDouble() ? it->second.ValueDouble() : 0.0;
+  };
+  SlowQuery slow_query{.parsing_time = seconds("parsing_time"), .planning_time = seconds("planning_time")};
+  // The results of read-only queries may be pulled ahead of the client's
+  // pulls, so their execution can take longer than the pulls.
+  const auto pull_time = query_execution.pull_time.count();
+  const auto execution_time = summary.contains("plan_execution_time") ? seconds("plan_execution_time") : pull_time;
+  slow_query.execution_time = execution_time;
+  slow_query.streaming_time = std::max(pull_time - execution_time, 0.0);
+  slow_query.commit_time = commit_time.count();
+
+  if (auto &fingerprint = query_execution.fingerprint) {
+    fingerprint->latency_us.Measure(static_cast<uint64_t>(slow_query.TotalTime() * 1'000'000));
+    fingerprint->rows.fetch_add(query_execution.rows, std::memory_order_relaxed);
+    if (plan) {
+      (plan_cache_hit ? fingerprint->plan_cache_hits : fingerprint->plan_cache_misses)
+          .fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  if (!slow_query_log.ShouldRecord(std::chrono::duration<double>(slow_query.TotalTime()))) return;
+
+  slow_query.timestamp =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
+          .count();
+  slow_query.db = interpreter_context_->db->id();
+  slow_query.username = username_.value_or("");
+  slow_query.query_hash = query_execution.stripped_query->hash();
+  slow_query.query = query_execution.stripped_query->query();
+  slow_query.parameters = query_execution.parameters;
+  if (plan) {
+    // The names in the plan are looked up through the transaction of the
+    // query if it's still open.
+    std::unique_ptr<storage::Storage::Accessor> storage_accessor;
+    std::optional<DbAccessor> dba;
+    if (!execution_db_accessor_) {
+      storage_accessor = interpreter_context_->db->Access();
+      dba.emplace(storage_accessor.get());
+    }
+    std::stringstream plan_text;
+    plan::PrettyPrint(execution_db_accessor_ ? *execution_db_accessor_ : *dba, &plan->plan(), &plan_text);
+    slow_query.plan = plan_text.str();
+  }
+  slow_query_log.Record(std::move(slow_query));
+}
+
 std::vector<TypedValue> Interpreter::GetQueries() {
   auto typed_queries = std::vector<TypedValue>();
   transaction_queries_.WithLock([&typed_queries](const auto &transaction_queries) {
@@ -3770,7 +4710,10 @@ void Interpreter::Abort() {
 
   memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveTransactions);
 
-  if (!db_accessor_) return;
+  if (!db_accessor_) {
+    transaction_memory_tracker_.reset();
+    return;
+  }
 
   db_accessor_->Abort();
   for (auto &qe : query_executions_) {
@@ -3780,6 +4723,7 @@ void Interpreter::Abort() {
   db_accessor_.reset();
   trigger_context_collector_.reset();
   frame_change_collector_.reset();
+  transaction_memory_tracker_.reset();
 }
 
 namespace {
@@ -3808,6 +4752,13 @@ void RunTriggersIndividually(const utils::SkipList<Trigger> &triggers, Interpret
       continue;
     }
 
+    // The changes of the triggers aren't collected, so the views are computed
+    // again once they're read.
+    utils::OnScopeExit mark_views_stale([&interpreter_context, &storage_acc] {
+      if (const auto commit_timestamp = storage_acc->GetCommitTimestamp()) {
+        interpreter_context->materialized_views.MarkStale(*commit_timestamp);
+      }
+    });
     auto maybe_commit_error = db_accessor.Commit();
     if (maybe_commit_error.HasError()) {
       const auto &error = maybe_commit_error.GetError();
@@ -3840,6 +4791,8 @@ void RunTriggersIndividually(const utils::SkipList<Trigger> &triggers, Interpret
               }
             } else if constexpr (std::is_same_v<ErrorType, storage::SerializationError>) {
               throw QueryException("Unable to commit due to serialization error.");
+            } else if constexpr (std::is_same_v<ErrorType, storage::WriteStallError>) {
+              throw WriteStallException();
             } else {
               static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
             }
@@ -3848,6 +4801,15 @@ void RunTriggersIndividually(const utils::SkipList<Trigger> &triggers, Interpret
     }
   }
 }
+
+void RunAfterCommitTriggers(InterpreterContext *interpreter_context, TriggerContext trigger_context) {
+  // A batch can merge the changes of transactions from many interpreters, so
+  // it has its own status instead of the status of one of them.
+  std::atomic<TransactionStatus> transaction_status{TransactionStatus::ACTIVE};
+  RunTriggersIndividually(interpreter_context->trigger_store.AfterCommitTriggers(), interpreter_context,
+                          std::move(trigger_context), &transaction_status);
+  SPDLOG_DEBUG("Finished executing after commit triggers");
+}
 }  // namespace
 
 void Interpreter::Commit() {
@@ -3856,6 +4818,7 @@ void Interpreter::Commit() {
   // For now, we will not check if there are some unfinished queries.
   // We should document clearly that all results should be pulled to complete
   // a query.
+  bookmark_.reset();
   if (!db_accessor_) return;
 
   /*
@@ -3890,6 +4853,16 @@ void Interpreter::Commit() {
     memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveTransactions);
   });
 
+  // The changes made by before commit triggers aren't collected, so the views
+  // are computed again after such transactions instead.
+  auto &materialized_views = interpreter_context_->materialized_views;
+  std::optional<MaterializedViewStore::Changes> view_changes;
+  if (trigger_context_collector_ && collect_view_changes_ &&
+      interpreter_context_->trigger_store.BeforeCommitTriggers().size() == 0 &&
+      current_storage_mode == storage::StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    view_changes.emplace(materialized_views.CollectChanges(&*execution_db_accessor_, *trigger_context_collector_));
+  }
+
   std::optional<TriggerContext> trigger_context = std::nullopt;
   if (trigger_context_collector_) {
     trigger_context.emplace(std::move(*trigger_context_collector_).TransformToTriggerContext());
@@ -3924,11 +4897,16 @@ void Interpreter::Commit() {
     execution_db_accessor_.reset();
     db_accessor_.reset();
     trigger_context_collector_.reset();
+    transaction_memory_tracker_.reset();
   };
   utils::OnScopeExit members_reseter(reset_necessary_members);
 
   auto commit_confirmed_by_all_sync_repplicas = true;
 
+  if (procedure::gModuleRegistry.HasCommitHooks()) {
+    db_accessor_->CollectCommitChanges();
+  }
+
   auto maybe_commit_error = db_accessor_->Commit();
   if (maybe_commit_error.HasError()) {
     const auto &error = maybe_commit_error.GetError();
@@ -3960,7 +4938,9 @@ void Interpreter::Commit() {
               }
             }
           } else if constexpr (std::is_same_v<ErrorType, storage::SerializationError>) {
-            throw QueryException("Unable to commit due to serialization error.");
+            throw TransactionSerializationException("Unable to commit due to serialization error.");
+          } else if constexpr (std::is_same_v<ErrorType, storage::WriteStallError>) {
+            throw WriteStallException();
           } else {
             static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
           }
@@ -3968,19 +4948,34 @@ void Interpreter::Commit() {
         error);
   }
 
+  // The hooks are called once the changes are visible to other transactions.
+  if (auto changes = db_accessor_->TakeCommitChanges(); changes && !changes->Empty()) {
+    procedure::gModuleRegistry.RunCommitHooks(*changes, *execution_db_accessor_);
+  }
+
+  if (const auto commit_timestamp = db_accessor_->GetCommitTimestamp();
+      commit_timestamp && materialized_views.HasViews()) {
+    if (view_changes) {
+      materialized_views.Apply(*view_changes, *commit_timestamp);
+    } else {
+      materialized_views.MarkStale(*commit_timestamp);
+    }
+  }
+
+  // Any transaction committed later has a greater timestamp, so waiting for
+  // this one is enough to see the changes of this transaction.
+  bookmark_ = fmt::format("{}:{}", interpreter_context_->db->id(), interpreter_context_->db->LastCommitTimestamp());
+
   // The ordered execution of after commit triggers is heavily depending on the exclusiveness of
   // db_accessor_->Commit(): only one of the transactions can be commiting at the same time, so when the commit is
   // finished, that transaction probably will schedule its after commit triggers, because the other transactions that
   // want to commit are still waiting for commiting or one of them just started commiting its changes. This means the
   // ordered execution of after commit triggers are not guaranteed.
+  // The user transaction is finalized once the triggers ran, as the trigger context refers to its objects.
   if (trigger_context && interpreter_context_->trigger_store.AfterCommitTriggers().size() > 0) {
-    interpreter_context_->after_commit_trigger_pool.AddTask(
-        [this, trigger_context = std::move(*trigger_context),
-         user_transaction = std::shared_ptr(std::move(db_accessor_))]() mutable {
-          RunTriggersIndividually(this->interpreter_context_->trigger_store.AfterCommitTriggers(),
-                                  this->interpreter_context_, std::move(trigger_context), &this->transaction_status_);
+    interpreter_context_->after_commit_triggers.Add(
+        std::move(*trigger_context), [user_transaction = std::shared_ptr(std::move(db_accessor_))]() {
           user_transaction->FinalizeTransaction();
-          SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
         });
   }
 
@@ -3990,6 +4985,31 @@ void Interpreter::Commit() {
   }
 }
 
+void Interpreter::WaitForBookmarks(const std::vector<std::string> &bookmarks) {
+  std::optional<uint64_t> wait_for_timestamp;
+  for (const auto &bookmark : bookmarks) {
+    const auto separator = bookmark.rfind(':');
+    uint64_t timestamp = 0;
+    if (separator == std::string::npos) throw QueryException("Invalid bookmark '{}'.", bookmark);
+    const auto *timestamp_end = bookmark.data() + bookmark.size();
+    const auto [end, error] = std::from_chars(bookmark.data() + separator + 1, timestamp_end, timestamp);
+    if (error != std::errc{} || end != timestamp_end) throw QueryException("Invalid bookmark '{}'.", bookmark);
+    // Bookmarks of other databases don't affect this one.
+    if (std::string_view{bookmark}.substr(0, separator) != interpreter_context_->db->id()) continue;
+    wait_for_timestamp = std::max(wait_for_timestamp.value_or(0), timestamp);
+  }
+  if (!wait_for_timestamp) return;
+
+  const auto deadline = std::chrono::steady_clock::now() + interpreter_context_->config.bookmark_wait_timeout;
+  while (interpreter_context_->db->LastCommitTimestamp() < *wait_for_timestamp) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      throw QueryException(
+          "Timed out while waiting for the transactions of the bookmarks to be replicated to this instance.");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
 void Interpreter::AdvanceCommand() {
   if (!db_accessor_) return;
   db_accessor_->AdvanceCommand();
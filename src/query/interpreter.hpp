@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <map>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <gflags/gflags.h>
@@ -24,10 +26,13 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
 #include "query/frontend/stripped.hpp"
+#include "query/index_advisor.hpp"
 #include "query/interpret/frame.hpp"
+#include "query/materialized_view.hpp"
 #include "query/metadata.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/read_write_type_checker.hpp"
+#include "query/slow_query_log.hpp"
 #include "query/stream.hpp"
 #include "query/stream/streams.hpp"
 #include "query/trigger.hpp"
@@ -39,6 +44,7 @@
 #include "utils/event_counter.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
+#include "utils/query_fingerprint_metrics.hpp"
 #include "utils/settings.hpp"
 #include "utils/skip_list.hpp"
 #include "utils/spin_lock.hpp"
@@ -221,6 +227,14 @@ struct PreparedQuery {
   std::function<std::optional<QueryHandlerResult>(AnyStream *stream, std::optional<int> n)> query_handler;
   plan::ReadWriteTypeChecker::RWType rw_type;
   std::optional<std::string> db{};
+  // Pulls up to `max_rows` results ahead of the next call to `query_handler`,
+  // stopping earlier once `should_stop` returns true. Not set if the results
+  // can't be pulled ahead.
+  std::function<void(size_t max_rows, const std::function<bool()> &should_stop)> prefetch_handler{};
+  // The plan of a Cypher query, printed by the slow query log.
+  std::shared_ptr<const CachedPlan> plan{};
+  // Whether the plan was found in the plan cache rather than made.
+  bool plan_cache_hit{false};
 };
 
 /**
@@ -230,6 +244,15 @@ struct PreparedQuery {
 struct QueryExtras {
   std::map<std::string, memgraph::storage::PropertyValue> metadata_pv;
   std::optional<int64_t> tx_timeout;
+  // Bookmarks of transactions the client has seen, the transaction waits
+  // until they are committed on this instance.
+  std::vector<std::string> bookmarks;
+  // Name of the prepared statement the query defines, or which is executed
+  // when the query is empty.
+  std::optional<std::string> prepared_statement;
+  // How old, in milliseconds, a cached result of the query may be to be
+  // returned instead of executing the query.
+  std::optional<int64_t> result_cache_max_staleness_ms;
 };
 
 class Interpreter;
@@ -266,16 +289,65 @@ struct InterpreterContext {
 
   utils::SkipList<QueryCacheEntry> ast_cache;
   utils::SkipList<PlanCacheEntry> plan_cache;
+  // Incremented whenever the plan cache is cleared, which makes the plans
+  // pinned by prepared statements be made again too.
+  std::atomic<uint64_t> plan_cache_generation{0};
 
   TriggerStore trigger_store;
-  utils::ThreadPool after_commit_trigger_pool{1};
+
+  MaterializedViewStore materialized_views;
 
   const InterpreterConfig config;
 
+  AfterCommitTriggerExecutor after_commit_triggers;
+
+  // Threads helping to execute parts of read-only queries in parallel,
+  // `nullptr` if the queries are executed on a single thread.
+  std::unique_ptr<utils::ThreadPool> parallel_execution_pool;
+
+  // Directory of the temporary files into which queries spill their rows.
+  const std::filesystem::path spill_directory;
+
+  // Queries of this database which took long, see `config.query.slow_query_threshold_ms`.
+  SlowQueryLog slow_query_log;
+
+  // Indices which would have saved the most work to the queries of this
+  // database, see `SHOW INDEX RECOMMENDATIONS`.
+  IndexAdvisor index_advisor;
+
+  // Memory allocated by the transactions of this database, limited by
+  // `config.query.memory_limit_per_database_bytes`.
+  utils::MemoryTracker query_memory_tracker;
+
+  // Memory allocated by the transactions of each user of this database,
+  // limited by `config.query.memory_limit_per_user_bytes`. The trackers are
+  // children of `query_memory_tracker` and live as long as the database.
+  utils::Synchronized<std::map<std::string, utils::MemoryTracker, std::less<>>, utils::SpinLock> user_memory_trackers;
+
+  /// Returns the tracker of the transactions of the user, creating it on the
+  /// first call.
+  utils::MemoryTracker *UserMemoryTracker(const std::string &username);
+
   query::stream::Streams streams;
   utils::Synchronized<std::unordered_set<Interpreter *>, utils::SpinLock> interpreters;
 };
 
+/// A Cypher query prepared once by a session and then executed by its name,
+/// which skips stripping, parsing and looking up the caches. The plan made on
+/// the first execution is pinned until an index change clears the plan cache.
+struct PreparedStatement {
+  std::string query_string;
+  std::shared_ptr<const frontend::StrippedQuery> stripped_query;
+  AstStorage ast_storage;
+  Query *query{nullptr};
+  std::vector<AuthQuery::Privilege> required_privileges;
+
+  std::shared_ptr<CachedPlan> plan;
+  std::vector<std::string> header;
+  const InterpreterContext *interpreter_context{nullptr};
+  uint64_t plan_cache_generation{0};
+};
+
 /// Function that is used to tell all active interpreters that they should stop
 /// their ongoing execution.
 inline void Shutdown(InterpreterContext *context) { context->is_shutting_down.store(true, std::memory_order_release); }
@@ -307,11 +379,12 @@ class Interpreter final {
    * Prepare a query for execution.
    *
    * Preparing a query means to preprocess the query and save it for
-   * future calls of `Pull`.
+   * future calls of `Pull`. The parameters are kept with the query, so
+   * moving them in avoids copying large parameters.
    *
    * @throw query::QueryException
    */
-  PrepareResult Prepare(const std::string &query, const std::map<std::string, storage::PropertyValue> &params,
+  PrepareResult Prepare(const std::string &query, std::map<std::string, storage::PropertyValue> params,
                         const std::string *username, QueryExtras const &extras = {},
                         const std::string &session_uuid = {});
 
@@ -357,12 +430,30 @@ class Interpreter final {
   std::map<std::string, TypedValue> Pull(TStream *result_stream, std::optional<int> n = {},
                                          std::optional<int> qid = {});
 
+  /**
+   * Pull results of the last query ahead of its next `Pull`, while the
+   * previous ones are sent to the client. At most
+   * `InterpreterConfig::Query::prefetch_rows` results are kept, and pulling
+   * stops earlier once `should_stop` returns true.
+   *
+   * An error raised while pulling is thrown by the next `Pull`.
+   */
+  void Prefetch(const std::function<bool()> &should_stop);
+
   void BeginTransaction(QueryExtras const &extras = {});
 
   std::optional<uint64_t> GetTransactionId() const;
 
+  /// Peak memory allocated by the pulls of the current transaction so far.
+  std::optional<int64_t> GetTransactionPeakMemory() const;
+
   void CommitTransaction();
 
+  /// Returns the bookmark of the last transaction committed by this
+  /// interpreter, which identifies the transaction's commit timestamp on the
+  /// database ("<database>:<commit timestamp>").
+  const std::optional<std::string> &GetBookmark() const { return bookmark_; }
+
   void RollbackTransaction();
 
   void SetNextTransactionIsolationLevel(storage::IsolationLevel isolation_level);
@@ -386,6 +477,18 @@ class Interpreter final {
     std::map<std::string, TypedValue> summary;
     std::vector<Notification> notifications;
 
+    // Kept for the slow query log, the parameters are described only if the
+    // log is enabled.
+    std::shared_ptr<const frontend::StrippedQuery> stripped_query;
+    std::string parameters;
+    // Time spent in the query handler by the pulls of the query.
+    std::chrono::duration<double> pull_time{0};
+    // Metrics of the fingerprint of the query, null if the fingerprint isn't
+    // tracked.
+    std::shared_ptr<metrics::QueryFingerprintMetrics> fingerprint;
+    // Results streamed by the pulls of the query.
+    uint64_t rows{0};
+
     explicit QueryExecution(utils::MonotonicBufferResource monotonic_memory)
         : execution_memory(std::move(monotonic_memory)) {
       std::visit(
@@ -446,18 +549,45 @@ class Interpreter final {
   // move this unique_ptr into a shrared_ptr.
   std::unique_ptr<storage::Storage::Accessor> db_accessor_;
   std::optional<DbAccessor> execution_db_accessor_;
+  // Memory allocated by the pulls of the current transaction, a child of the
+  // tracker of the user or of the database. Set before the transaction
+  // becomes ACTIVE and reset after it stops being so, which lets
+  // SHOW TRANSACTIONS read it while it holds the transaction VERIFYING.
+  std::optional<utils::MemoryTracker> transaction_memory_tracker_;
   std::optional<TriggerContextCollector> trigger_context_collector_;
+  // Whether the collector collects all changes, which the materialized views
+  // are updated with when the transaction commits.
+  bool collect_view_changes_{false};
   std::optional<FrameChangeCollector> frame_change_collector_;
 
   std::optional<storage::IsolationLevel> interpreter_isolation_level;
   std::optional<storage::IsolationLevel> next_transaction_isolation_level;
 
+  std::optional<std::string> bookmark_;
+
+  std::unordered_map<std::string, PreparedStatement> prepared_statements_;
+
+  std::optional<LocalPlanCache> local_plan_cache_;
+
+  /// Waits until the transactions of the bookmarks which belong to this
+  /// database are committed on this instance. Replicas can lag behind MAIN,
+  /// so reads on them wait for the writes the client has seen.
+  /// @throw QueryException if the bookmarks are invalid or the wait times out
+  void WaitForBookmarks(const std::vector<std::string> &bookmarks);
+
   PreparedQuery PrepareTransactionQuery(std::string_view query_upper, QueryExtras const &extras = {});
   void Commit();
+  void SetupTransactionMemoryTracker();
+  void SetupTriggerContextCollector();
   void AdvanceCommand();
   void AbortCommand(std::unique_ptr<QueryExecution> *query_execution);
   std::optional<storage::IsolationLevel> GetIsolationLevelOverride();
 
+  /// Records the finished query in the metrics of its fingerprint, and in the
+  /// slow query log if it took long enough.
+  void RecordFinishedQuery(const QueryExecution &query_execution, const CachedPlan *plan, bool plan_cache_hit,
+                           const std::map<std::string, TypedValue> &summary, std::chrono::duration<double> commit_time);
+
   size_t ActiveQueryExecutions() {
     return std::count_if(query_executions_.begin(), query_executions_.end(),
                          [](const auto &execution) { return execution && execution->prepared_query; });
@@ -512,7 +642,15 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     AnyStream stream{result_stream,
                      std::visit([](auto &execution_memory) -> utils::MemoryResource * { return &execution_memory; },
                                 query_execution->execution_memory)};
-    const auto maybe_res = query_execution->prepared_query->query_handler(&stream, n);
+    std::optional<QueryHandlerResult> maybe_res;
+    {
+      utils::MemoryTracker::ThreadTrackerScope memory_scope(
+          transaction_memory_tracker_ ? &*transaction_memory_tracker_ : nullptr);
+      utils::Timer pull_timer;
+      maybe_res = query_execution->prepared_query->query_handler(&stream, n);
+      query_execution->pull_time += pull_timer.Elapsed();
+    }
+    query_execution->rows += stream.Rows();
     // Stream is using execution memory of the query_execution which
     // can be deleted after its execution so the stream should be cleared
     // first.
@@ -523,6 +661,9 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
     if (maybe_res) {
       // Save its summary
       maybe_summary.emplace(std::move(query_execution->summary));
+      if (transaction_memory_tracker_) {
+        maybe_summary->insert_or_assign("peak_memory_allocated", TypedValue(transaction_memory_tracker_->Peak()));
+      }
       if (!query_execution->notifications.empty()) {
         std::vector<TypedValue> notifications;
         notifications.reserve(query_execution->notifications.size());
@@ -531,11 +672,21 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
         }
         maybe_summary->insert_or_assign("notifications", std::move(notifications));
       }
+      // The commit releases the prepared query.
+      auto plan = query_execution->prepared_query->plan;
+      const auto plan_cache_hit = query_execution->prepared_query->plan_cache_hit;
       if (!in_explicit_transaction_) {
+        std::chrono::duration<double> commit_time{0};
         switch (*maybe_res) {
-          case QueryHandlerResult::COMMIT:
+          case QueryHandlerResult::COMMIT: {
+            utils::Timer commit_timer;
             Commit();
+            commit_time = commit_timer.Elapsed();
+            if (bookmark_) {
+              maybe_summary->insert_or_assign("bookmark", TypedValue(*bookmark_));
+            }
             break;
+          }
           case QueryHandlerResult::ABORT:
             Abort();
             break;
@@ -546,6 +697,7 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
             MG_ASSERT(in_explicit_transaction_ || !db_accessor_);
             break;
         }
+        RecordFinishedQuery(*query_execution, plan.get(), plan_cache_hit, *maybe_summary, commit_time);
         // As the transaction is done we can clear all the executions
         // NOTE: we cannot clear query_execution inside the Abort and Commit
         // methods as we will delete summary contained in them which we need
@@ -553,6 +705,8 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
         query_executions_.clear();
         transaction_queries_->clear();
       } else {
+        RecordFinishedQuery(*query_execution, plan.get(), plan_cache_hit, *maybe_summary,
+                            std::chrono::duration<double>{0});
         // We can only clear this execution as some of the queries
         // in the transaction can be in unfinished state
         query_execution.reset(nullptr);
@@ -561,6 +715,13 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
   } catch (const ExplicitTransactionUsageException &) {
     query_execution.reset(nullptr);
     throw;
+  } catch (const TransactionSerializationException &) {
+    if (query_execution && query_execution->fingerprint) {
+      query_execution->fingerprint->serialization_conflicts.fetch_add(1, std::memory_order_relaxed);
+    }
+    memgraph::metrics::IncrementCounter(memgraph::metrics::FailedQuery);
+    AbortCommand(&query_execution);
+    throw;
   } catch (const utils::BasicException &) {
     memgraph::metrics::IncrementCounter(memgraph::metrics::FailedQuery);
     AbortCommand(&query_execution);
@@ -0,0 +1,577 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/materialized_view.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+
+#include <json/json.hpp>
+
+#include "query/context.hpp"
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/ast/ast_visitor.hpp"
+#include "query/frontend/semantic/symbol_generator.hpp"
+#include "query/interpret/eval.hpp"
+#include "query/interpret/frame.hpp"
+#include "query/query_result_cache.hpp"
+#include "utils/fnv.hpp"
+#include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+// When the format of the persisted view is changed, update the kVersion.
+inline constexpr uint64_t kVersion{1};
+
+constexpr std::string_view kUnsupportedQueryMessage =
+    "Materialized views support only queries of the form MATCH (n:Label) WHERE ... RETURN ... or "
+    "MATCH (a)-[r:TYPE]->(b) WHERE ... RETURN ..., which return grouping keys and count, sum and avg aggregations.";
+
+// Finds the uses of the matched objects through which the row of an object
+// could depend on other objects, or on the changes of its end nodes.
+class UnsupportedUseFinder : public HierarchicalTreeVisitor {
+ public:
+  UnsupportedUseFinder(std::unordered_set<std::string> element_names, std::unordered_set<std::string> end_names)
+      : element_names_(std::move(element_names)), end_names_(std::move(end_names)) {}
+
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool Visit(Identifier &identifier) override {
+    if (element_names_.contains(identifier.name_) || end_names_.contains(identifier.name_)) found_ = true;
+    return true;
+  }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+
+  bool PreVisit(PropertyLookup &lookup) override { return !IsElement(lookup.expression_); }
+  bool PreVisit(LabelsTest &labels_test) override { return !IsElement(labels_test.expression_); }
+  bool PreVisit(Function &function) override {
+    static const std::unordered_set<std::string> kElementFunctions{"ID", "LABELS", "TYPE", "PROPERTIES", "KEYS"};
+    if (function.arguments_.size() != 1) return true;
+    if (kElementFunctions.contains(function.function_name_) && IsElement(function.arguments_[0])) return false;
+    // Only the ids of the end nodes don't change without the relationship.
+    return !(function.function_name_ == "ID" && IsEnd(function.arguments_[0]));
+  }
+  // Aggregations may only be returned, and not be used in other expressions.
+  bool PreVisit(Aggregation &) override { return !(found_ = true); }
+  bool PreVisit(Exists &) override { return !(found_ = true); }
+
+  bool found_{false};
+
+ private:
+  bool IsElement(Expression *expression) const {
+    auto *identifier = utils::Downcast<Identifier>(expression);
+    return identifier && element_names_.contains(identifier->name_);
+  }
+
+  bool IsEnd(Expression *expression) const {
+    auto *identifier = utils::Downcast<Identifier>(expression);
+    return identifier && end_names_.contains(identifier->name_);
+  }
+
+  std::unordered_set<std::string> element_names_;
+  std::unordered_set<std::string> end_names_;
+};
+
+bool HasEmptyProperties(const NodeAtom &node) {
+  const auto *properties = std::get_if<std::unordered_map<PropertyIx, Expression *>>(&node.properties_);
+  return properties && properties->empty();
+}
+
+TypedValue SumValue(const MaterializedView::Aggregate &aggregate) {
+  if (aggregate.double_count == 0) return TypedValue(aggregate.int_sum);
+  return TypedValue(static_cast<double>(aggregate.int_sum) + aggregate.double_sum);
+}
+
+void MergeGroups(const MaterializedView::Groups &changes, MaterializedView::Groups *groups) {
+  for (const auto &[keys, change] : changes) {
+    auto it = groups->try_emplace(keys).first;
+    auto &group = it->second;
+    group.rows += change.rows;
+    group.aggregates.resize(change.aggregates.size());
+    for (size_t i = 0; i < change.aggregates.size(); ++i) {
+      group.aggregates[i].count += change.aggregates[i].count;
+      group.aggregates[i].int_sum += change.aggregates[i].int_sum;
+      group.aggregates[i].double_sum += change.aggregates[i].double_sum;
+      group.aggregates[i].double_count += change.aggregates[i].double_count;
+    }
+    if (group.rows == 0) groups->erase(it);
+  }
+}
+
+}  // namespace
+
+size_t MaterializedView::KeysHash::operator()(const std::vector<TypedValue> &keys) const {
+  return utils::FnvCollection<std::vector<TypedValue>, TypedValue, TypedValue::Hash>{}(keys);
+}
+
+bool MaterializedView::KeysEqual::operator()(const std::vector<TypedValue> &first,
+                                              const std::vector<TypedValue> &second) const {
+  return std::equal(first.begin(), first.end(), second.begin(), second.end(), TypedValue::BoolEqual{});
+}
+
+class MaterializedView::Evaluation final {
+ public:
+  Evaluation(const MaterializedView *view, DbAccessor *dba, storage::View storage_view)
+      : view_(view),
+        storage_view_(storage_view),
+        frame_(view->symbol_table_.max_position()),
+        evaluator_(&frame_, view->symbol_table_, context_, dba, storage_view) {
+    const auto &ast_storage = view->parsed_statement_.ast_storage;
+    context_.parameters = view->parsed_statement_.parameters;
+    context_.properties = NamesToProperties(ast_storage.properties_, dba);
+    context_.labels = NamesToLabels(ast_storage.labels_, dba);
+    if (view->node_) {
+      for (const auto &label : view->node_->labels_) labels_.push_back(dba->NameToLabel(label.name));
+    } else {
+      for (const auto &edge_type : view->edge_->edge_types_) edge_types_.push_back(dba->NameToEdgeType(edge_type.name));
+    }
+  }
+
+  void AddVertex(const VertexAccessor &vertex, int64_t sign, Groups *groups) {
+    if (!vertex.IsVisible(storage_view_)) return;
+    for (const auto label : labels_) {
+      auto has_label = vertex.HasLabel(storage_view_, label);
+      if (has_label.HasError() || !*has_label) return;
+    }
+    frame_[view_->symbol_table_.at(*view_->node_->identifier_)] = TypedValue(vertex);
+    AddRow(sign, groups);
+  }
+
+  void AddEdge(const EdgeAccessor &edge, int64_t sign, Groups *groups) {
+    if (!edge.IsVisible(storage_view_)) return;
+    if (!edge_types_.empty() && std::ranges::find(edge_types_, edge.EdgeType()) == edge_types_.end()) return;
+    frame_[view_->symbol_table_.at(*view_->edge_->identifier_)] = TypedValue(edge);
+    frame_[view_->symbol_table_.at(*view_->from_node_->identifier_)] = TypedValue(edge.From());
+    frame_[view_->symbol_table_.at(*view_->to_node_->identifier_)] = TypedValue(edge.To());
+    AddRow(sign, groups);
+  }
+
+ private:
+  void AddRow(int64_t sign, Groups *groups) {
+    if (view_->where_) {
+      auto condition = view_->where_->Accept(evaluator_);
+      if (condition.IsNull()) return;
+      if (condition.type() != TypedValue::Type::Bool) {
+        throw QueryRuntimeException("Filter expression must evaluate to bool or null, got {}.", condition.type());
+      }
+      if (!condition.ValueBool()) return;
+    }
+
+    std::vector<TypedValue> keys;
+    keys.reserve(view_->key_count_);
+    for (size_t i = 0; i < view_->columns_.size(); ++i) {
+      if (view_->columns_[i] != Column::KEY) continue;
+      keys.emplace_back(view_->expressions_[i]->Accept(evaluator_), utils::NewDeleteResource());
+    }
+    auto &group = (*groups)[std::move(keys)];
+    group.rows += sign;
+    group.aggregates.resize(view_->columns_.size() - view_->key_count_);
+
+    auto aggregate_it = group.aggregates.begin();
+    for (size_t i = 0; i < view_->columns_.size(); ++i) {
+      if (view_->columns_[i] == Column::KEY) continue;
+      auto &aggregate = *aggregate_it++;
+      if (!view_->expressions_[i]) {
+        aggregate.count += sign;
+        continue;
+      }
+      auto value = view_->expressions_[i]->Accept(evaluator_);
+      if (value.IsNull()) continue;
+      if (view_->columns_[i] == Column::COUNT) {
+        aggregate.count += sign;
+      } else if (value.IsInt()) {
+        aggregate.count += sign;
+        aggregate.int_sum += sign * value.ValueInt();
+      } else if (value.IsDouble()) {
+        aggregate.count += sign;
+        aggregate.double_count += sign;
+        aggregate.double_sum += static_cast<double>(sign) * value.ValueDouble();
+      } else {
+        throw QueryRuntimeException("Only numeric values allowed in SUM and AVG aggregations.");
+      }
+    }
+  }
+
+  const MaterializedView *view_;
+  storage::View storage_view_;
+  EvaluationContext context_;
+  Frame frame_;
+  ExpressionEvaluator evaluator_;
+  std::vector<storage::LabelId> labels_;
+  std::vector<storage::EdgeTypeId> edge_types_;
+};
+
+MaterializedView::MaterializedView(std::string name, const std::string &statement,
+                                   utils::SkipList<QueryCacheEntry> *query_cache,
+                                   const InterpreterConfig::Query &query_config)
+    : name_(std::move(name)), parsed_statement_(ParseQuery(statement, {}, query_cache, query_config)) {
+  auto *cypher_query = utils::Downcast<CypherQuery>(parsed_statement_.query);
+  if (!cypher_query || !cypher_query->cypher_unions_.empty() || cypher_query->memory_limit_) {
+    throw QueryException(kUnsupportedQueryMessage);
+  }
+  if (!parsed_statement_.is_cacheable || HasChangingResults(cypher_query)) {
+    throw QueryException(
+        "The query of a materialized view can't call procedures, user-defined functions or functions whose results "
+        "change between executions.");
+  }
+
+  const auto &clauses = cypher_query->single_query_->clauses_;
+  auto *match = clauses.size() == 2 ? utils::Downcast<Match>(clauses[0]) : nullptr;
+  auto *return_clause = clauses.size() == 2 ? utils::Downcast<Return>(clauses[1]) : nullptr;
+  if (!match || !return_clause || match->optional_ || match->patterns_.size() != 1 ||
+      match->patterns_[0]->identifier_->user_declared_) {
+    throw QueryException(kUnsupportedQueryMessage);
+  }
+
+  const auto &atoms = match->patterns_[0]->atoms_;
+  std::unordered_set<std::string> element_names;
+  std::unordered_set<std::string> end_names;
+  if (atoms.size() == 1) {
+    node_ = utils::Downcast<NodeAtom>(atoms[0]);
+    if (!node_ || !HasEmptyProperties(*node_)) throw QueryException(kUnsupportedQueryMessage);
+    element_names.insert(node_->identifier_->name_);
+  } else if (atoms.size() == 3) {
+    edge_ = utils::Downcast<EdgeAtom>(atoms[1]);
+    auto *left_node = utils::Downcast<NodeAtom>(atoms[0]);
+    auto *right_node = utils::Downcast<NodeAtom>(atoms[2]);
+    if (!edge_ || edge_->type_ != EdgeAtom::Type::SINGLE || edge_->direction_ == EdgeAtom::Direction::BOTH ||
+        !std::get<std::unordered_map<PropertyIx, Expression *>>(edge_->properties_).empty() || !left_node ||
+        !right_node || !left_node->labels_.empty() || !right_node->labels_.empty() ||
+        !HasEmptyProperties(*left_node) || !HasEmptyProperties(*right_node) ||
+        left_node->identifier_->name_ == right_node->identifier_->name_) {
+      throw QueryException(kUnsupportedQueryMessage);
+    }
+    from_node_ = edge_->direction_ == EdgeAtom::Direction::OUT ? left_node : right_node;
+    to_node_ = edge_->direction_ == EdgeAtom::Direction::OUT ? right_node : left_node;
+    element_names.insert(edge_->identifier_->name_);
+    end_names.insert(from_node_->identifier_->name_);
+    end_names.insert(to_node_->identifier_->name_);
+  } else {
+    throw QueryException(kUnsupportedQueryMessage);
+  }
+
+  const auto &body = return_clause->body_;
+  if (body.distinct || body.all_identifiers || !body.order_by.empty() || body.skip || body.limit) {
+    throw QueryException(kUnsupportedQueryMessage);
+  }
+  const auto check_expression = [&](Expression *expression) {
+    if (!expression) return;
+    UnsupportedUseFinder finder(element_names, end_names);
+    expression->Accept(finder);
+    if (finder.found_) throw QueryException(kUnsupportedQueryMessage);
+  };
+  if (match->where_) {
+    where_ = match->where_->expression_;
+    check_expression(where_);
+  }
+  for (auto *named_expression : body.named_expressions) {
+    header_.push_back(named_expression->name_);
+    auto *aggregation = utils::Downcast<Aggregation>(named_expression->expression_);
+    if (!aggregation) {
+      check_expression(named_expression->expression_);
+      columns_.push_back(Column::KEY);
+      expressions_.push_back(named_expression->expression_);
+      ++key_count_;
+      continue;
+    }
+    if (aggregation->distinct_) throw QueryException(kUnsupportedQueryMessage);
+    switch (aggregation->op_) {
+      case Aggregation::Op::COUNT:
+        columns_.push_back(Column::COUNT);
+        break;
+      case Aggregation::Op::SUM:
+        columns_.push_back(Column::SUM);
+        break;
+      case Aggregation::Op::AVG:
+        columns_.push_back(Column::AVG);
+        break;
+      default:
+        throw QueryException(kUnsupportedQueryMessage);
+    }
+    check_expression(aggregation->expression1_);
+    expressions_.push_back(aggregation->expression1_);
+  }
+
+  symbol_table_ = MakeSymbolTable(cypher_query);
+}
+
+void MaterializedView::AddChanges(DbAccessor *dba, storage::View view, const std::vector<VertexAccessor> &vertices,
+                                  const std::vector<EdgeAccessor> &edges, int64_t sign, Groups *changes) const {
+  Evaluation evaluation(this, dba, view);
+  if (node_) {
+    for (const auto &vertex : vertices) evaluation.AddVertex(vertex, sign, changes);
+  } else {
+    for (const auto &edge : edges) evaluation.AddEdge(edge, sign, changes);
+  }
+}
+
+void MaterializedView::Apply(const Groups &changes, uint64_t commit_timestamp) {
+  std::lock_guard guard(lock_);
+  if (building_) {
+    pending_changes_.emplace_back(changes, commit_timestamp);
+    return;
+  }
+  if (stale_ || commit_timestamp < as_of_) return;
+  MergeGroups(changes, &groups_);
+}
+
+void MaterializedView::MarkStale(std::optional<uint64_t> commit_timestamp) {
+  const auto timestamp = commit_timestamp.value_or(std::numeric_limits<uint64_t>::max());
+  std::lock_guard guard(lock_);
+  if (building_) {
+    pending_stale_timestamp_ = std::max(pending_stale_timestamp_.value_or(0), timestamp);
+    return;
+  }
+  if (timestamp > as_of_) stale_ = true;
+}
+
+std::vector<std::vector<TypedValue>> MaterializedView::Rows(storage::Storage *storage) {
+  {
+    std::lock_guard guard(lock_);
+    if (!stale_) return MakeRows(groups_);
+  }
+  return Compute(storage);
+}
+
+std::vector<std::vector<TypedValue>> MaterializedView::Compute(storage::Storage *storage) {
+  std::lock_guard build_guard(build_lock_);
+  {
+    std::lock_guard guard(lock_);
+    // Another read could have computed the view meanwhile.
+    if (!stale_) return MakeRows(groups_);
+    building_ = true;
+  }
+
+  Groups groups;
+  std::unique_ptr<storage::Storage::Accessor> storage_accessor;
+  try {
+    storage_accessor = storage->Access(storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    DbAccessor dba(storage_accessor.get());
+    Evaluation evaluation(this, &dba, storage::View::OLD);
+    for (auto vertex : dba.Vertices(storage::View::OLD)) {
+      if (node_) {
+        evaluation.AddVertex(vertex, 1, &groups);
+        continue;
+      }
+      auto out_edges = vertex.OutEdges(storage::View::OLD);
+      if (out_edges.HasError()) continue;
+      for (const auto &edge : out_edges->edges) evaluation.AddEdge(edge, 1, &groups);
+    }
+  } catch (...) {
+    std::lock_guard guard(lock_);
+    building_ = false;
+    pending_changes_.clear();
+    pending_stale_timestamp_.reset();
+    throw;
+  }
+
+  // Only the changes of in-memory transactions on the main instance are
+  // known, otherwise the view is computed again on each read.
+  const bool is_maintained = storage->GetStorageMode() == storage::StorageMode::IN_MEMORY_TRANSACTIONAL &&
+                             storage->GetReplicationRole() != storage::replication::ReplicationRole::REPLICA;
+  std::lock_guard guard(lock_);
+  as_of_ = storage_accessor->GetStartTimestamp();
+  for (const auto &[changes, commit_timestamp] : pending_changes_) {
+    if (commit_timestamp > as_of_) MergeGroups(changes, &groups);
+  }
+  stale_ = !is_maintained || pending_stale_timestamp_.value_or(0) > as_of_;
+  building_ = false;
+  pending_changes_.clear();
+  pending_stale_timestamp_.reset();
+  groups_ = std::move(groups);
+  return MakeRows(groups_);
+}
+
+std::vector<std::vector<TypedValue>> MaterializedView::MakeRows(const Groups &groups) const {
+  std::vector<std::vector<TypedValue>> rows;
+  rows.reserve(std::max<size_t>(groups.size(), 1));
+  const auto add_row = [&](const std::vector<TypedValue> &keys, const Group &group) {
+    auto &row = rows.emplace_back();
+    row.reserve(columns_.size());
+    auto key_it = keys.begin();
+    auto aggregate_it = group.aggregates.begin();
+    for (const auto column : columns_) {
+      if (column == Column::KEY) {
+        row.push_back(*key_it++);
+        continue;
+      }
+      const auto aggregate = aggregate_it != group.aggregates.end() ? *aggregate_it++ : Aggregate{};
+      switch (column) {
+        case Column::COUNT:
+          row.emplace_back(aggregate.count);
+          break;
+        case Column::SUM:
+          row.push_back(SumValue(aggregate));
+          break;
+        case Column::AVG:
+          if (aggregate.count == 0) {
+            row.emplace_back();
+            break;
+          }
+          row.emplace_back((static_cast<double>(aggregate.int_sum) + aggregate.double_sum) /
+                           static_cast<double>(aggregate.count));
+          break;
+        case Column::KEY:
+          break;
+      }
+    }
+  };
+  for (const auto &[keys, group] : groups) add_row(keys, group);
+  // Aggregations without grouping keys return a row even if nothing matches.
+  if (key_count_ == 0 && groups.empty()) add_row({}, Group{});
+  return rows;
+}
+
+MaterializedViewStore::MaterializedViewStore(std::filesystem::path directory) : storage_{std::move(directory)} {}
+
+void MaterializedViewStore::RestoreViews(utils::SkipList<QueryCacheEntry> *query_cache,
+                                         const InterpreterConfig::Query &query_config) {
+  spdlog::info("Loading materialized views...");
+  for (const auto &[view_name, view_data] : storage_) {
+    std::shared_ptr<MaterializedView> view;
+    try {
+      const auto json_view_data = nlohmann::json::parse(view_data);
+      if (json_view_data["version"] != kVersion || !json_view_data["statement"].is_string()) {
+        spdlog::warn("Failed to load materialized view '{}'. Invalid state of the view data.", view_name);
+        continue;
+      }
+      view = std::make_shared<MaterializedView>(view_name, json_view_data["statement"].get<std::string>(),
+                                                query_cache, query_config);
+    } catch (const nlohmann::json::exception &e) {
+      spdlog::warn("Failed to load materialized view '{}'. Invalid state of the view data.", view_name);
+      continue;
+    } catch (const utils::BasicException &e) {
+      spdlog::warn("Failed to load materialized view '{}' because: {}", view_name, e.what());
+      continue;
+    }
+    views_.WithLock([&](auto &views) { views.emplace(view_name, std::move(view)); });
+    view_count_.fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void MaterializedViewStore::AddView(std::string name, const std::string &statement, storage::Storage *storage,
+                                    utils::SkipList<QueryCacheEntry> *query_cache,
+                                    const InterpreterConfig::Query &query_config) {
+  if (storage->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    throw QueryException("Materialized views are not supported in the on-disk storage mode.");
+  }
+  std::lock_guard store_guard(store_lock_);
+  if (storage_.Get(name)) {
+    throw QueryException("Materialized view with the same name already exists.");
+  }
+  auto view = std::make_shared<MaterializedView>(name, statement, query_cache, query_config);
+
+  // The view is registered before it's computed, so that the transactions
+  // which commit meanwhile know about it.
+  views_.WithLock([&](auto &views) { views.emplace(name, view); });
+  view_count_.fetch_add(1, std::memory_order_acq_rel);
+  try {
+    view->Rows(storage);
+  } catch (...) {
+    views_.WithLock([&](auto &views) { views.erase(name); });
+    view_count_.fetch_sub(1, std::memory_order_acq_rel);
+    throw;
+  }
+
+  nlohmann::json data = nlohmann::json::object();
+  data["statement"] = statement;
+  data["version"] = kVersion;
+  storage_.Put(name, data.dump());
+}
+
+void MaterializedViewStore::DropView(const std::string &name) {
+  std::lock_guard store_guard(store_lock_);
+  if (!storage_.Get(name)) {
+    throw QueryException("Materialized view with name '{}' doesn't exist.", name);
+  }
+  if (views_.WithLock([&](auto &views) { return views.erase(name); }) > 0) {
+    view_count_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  storage_.Delete(name);
+}
+
+std::shared_ptr<MaterializedView> MaterializedViewStore::Find(const std::string &name) const {
+  return views_.WithLock([&](const auto &views) -> std::shared_ptr<MaterializedView> {
+    auto it = views.find(name);
+    return it != views.end() ? it->second : nullptr;
+  });
+}
+
+std::vector<MaterializedViewStore::ViewInfo> MaterializedViewStore::GetViewInfo() const {
+  return views_.WithLock([](const auto &views) {
+    std::vector<ViewInfo> info;
+    info.reserve(views.size());
+    for (const auto &[name, view] : views) info.push_back({name, view->Statement()});
+    return info;
+  });
+}
+
+MaterializedViewStore::Changes MaterializedViewStore::CollectChanges(DbAccessor *dba,
+                                                                     const TriggerContextCollector &collector) const {
+  Changes changes;
+  views_.WithLock([&](const auto &views) {
+    changes.reserve(views.size());
+    for (const auto &[name, view] : views) changes.emplace_back(view, MaterializedView::Groups{});
+  });
+  const auto vertices = collector.ChangedObjects<VertexAccessor>();
+  const auto edges = collector.ChangedObjects<EdgeAccessor>();
+
+  // The rows of the objects as they are now are added before the rows of the
+  // objects as they were before the transaction are subtracted, because
+  // reading the latter invalidates the reads of the current state meanwhile.
+  const auto add_changes = [&](storage::View view, int64_t sign) {
+    std::erase_if(changes, [&](auto &view_changes) {
+      try {
+        view_changes.first->AddChanges(dba, view, vertices, edges, sign, &view_changes.second);
+        return false;
+      } catch (const utils::BasicException &e) {
+        // The view is computed again on the next read, which fails the same
+        // way if the changed object is still there.
+        spdlog::debug("Failed to update materialized view '{}': {}", view_changes.first->Name(), e.what());
+        return true;
+      }
+    });
+  };
+  add_changes(storage::View::NEW, 1);
+  dba->ReadStateBeforeTransaction(true);
+  utils::OnScopeExit read_current_state([dba] { dba->ReadStateBeforeTransaction(false); });
+  add_changes(storage::View::OLD, -1);
+  return changes;
+}
+
+void MaterializedViewStore::Apply(const Changes &changes, uint64_t commit_timestamp) {
+  std::unordered_set<const MaterializedView *> changed_views;
+  for (const auto &[view, view_changes] : changes) {
+    view->Apply(view_changes, commit_timestamp);
+    changed_views.insert(view.get());
+  }
+  views_.WithLock([&](const auto &views) {
+    for (const auto &[name, view] : views) {
+      if (!changed_views.contains(view.get())) view->MarkStale(commit_timestamp);
+    }
+  });
+}
+
+void MaterializedViewStore::MarkStale(std::optional<uint64_t> commit_timestamp) {
+  views_.WithLock([&](const auto &views) {
+    for (const auto &[name, view] : views) view->MarkStale(commit_timestamp);
+  });
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,217 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "kvstore/kvstore.hpp"
+#include "query/config.hpp"
+#include "query/cypher_query_interpreter.hpp"
+#include "query/db_accessor.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/trigger_context.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query {
+
+/**
+ * Result of an aggregation over a simple pattern, kept in memory and updated
+ * with the changes of each committed transaction rather than computed again
+ * when read.
+ *
+ * The query of a view is a single MATCH of either one node, e.g.
+ * `MATCH (n:Label) WHERE n.x > 0`, or one directed relationship, e.g.
+ * `MATCH (a)-[r:TYPE]->(b)`, followed by a RETURN of grouping keys and of
+ * `count`, `sum` and `avg` aggregations. The node and the relationship may be
+ * used in the expressions through their properties, labels and types, and
+ * the end nodes of the relationship only through `id`, so that each matched
+ * object adds to the aggregates independently of the others.
+ *
+ * A transaction adds the rows of the objects it created or changed, as they
+ * are when it commits, and subtracts the rows of the objects it deleted or
+ * changed, as they were before it. When the changes of a transaction aren't
+ * known, e.g. on a replica, the view is computed again on the next read.
+ *
+ * This class is thread-safe.
+ */
+class MaterializedView final {
+ public:
+  struct Aggregate {
+    // Values the aggregation counted, or summed for `sum` and `avg`.
+    int64_t count{0};
+    int64_t int_sum{0};
+    // Doubles are summed apart from the integers, so that the sum of only
+    // integers stays an integer.
+    double double_sum{0};
+    int64_t double_count{0};
+  };
+
+  struct Group {
+    // Matched rows in the group, the group is removed once there are none.
+    int64_t rows{0};
+    std::vector<Aggregate> aggregates;
+  };
+
+  struct KeysHash {
+    size_t operator()(const std::vector<TypedValue> &keys) const;
+  };
+
+  struct KeysEqual {
+    bool operator()(const std::vector<TypedValue> &first, const std::vector<TypedValue> &second) const;
+  };
+
+  /// Groups of the view by the values of the grouping keys, or the changes
+  /// of the groups made by a transaction.
+  using Groups = std::unordered_map<std::vector<TypedValue>, Group, KeysHash, KeysEqual>;
+
+  /// @throw QueryException if the statement isn't a supported query.
+  MaterializedView(std::string name, const std::string &statement, utils::SkipList<QueryCacheEntry> *query_cache,
+                   const InterpreterConfig::Query &query_config);
+
+  MaterializedView(const MaterializedView &) = delete;
+  MaterializedView &operator=(const MaterializedView &) = delete;
+  MaterializedView(MaterializedView &&) = delete;
+  MaterializedView &operator=(MaterializedView &&) = delete;
+  ~MaterializedView() = default;
+
+  const std::string &Name() const { return name_; }
+  const std::string &Statement() const { return parsed_statement_.query_string; }
+  const std::vector<std::string> &Header() const { return header_; }
+
+  /// Adds the rows of the changed `vertices` and `edges`, as the transaction
+  /// of `dba` sees them in the `view`, multiplied by `sign` to `changes`.
+  /// @throw QueryRuntimeException if the expressions can't be evaluated.
+  void AddChanges(DbAccessor *dba, storage::View view, const std::vector<VertexAccessor> &vertices,
+                  const std::vector<EdgeAccessor> &edges, int64_t sign, Groups *changes) const;
+
+  /// Applies the changes of the transaction committed at `commit_timestamp`.
+  void Apply(const Groups &changes, uint64_t commit_timestamp);
+
+  /// Makes the view be computed again on the next read, because the changes
+  /// of the transaction committed at `commit_timestamp` aren't known, or
+  /// because of some other change of the database if it isn't set.
+  void MarkStale(std::optional<uint64_t> commit_timestamp);
+
+  /// Returns the rows of the view, computing them first if they're stale.
+  /// @throw QueryRuntimeException if the expressions can't be evaluated.
+  std::vector<std::vector<TypedValue>> Rows(storage::Storage *storage);
+
+ private:
+  enum class Column : uint8_t { KEY, COUNT, SUM, AVG };
+
+  // Evaluates the rows of the matched objects in a transaction.
+  class Evaluation;
+
+  std::vector<std::vector<TypedValue>> Compute(storage::Storage *storage);
+
+  std::vector<std::vector<TypedValue>> MakeRows(const Groups &groups) const;
+
+  std::string name_;
+  ParsedQuery parsed_statement_;
+  SymbolTable symbol_table_;
+  std::vector<std::string> header_;
+  std::vector<Column> columns_;
+  // Grouping key of each KEY column and the argument of each aggregation,
+  // nullptr for `count(*)`.
+  std::vector<Expression *> expressions_;
+  size_t key_count_{0};
+  // The matched node, or the relationship and its end nodes.
+  NodeAtom *node_{nullptr};
+  EdgeAtom *edge_{nullptr};
+  NodeAtom *from_node_{nullptr};
+  NodeAtom *to_node_{nullptr};
+  Expression *where_{nullptr};
+
+  // Taken while the view is computed, so that it's computed once at a time.
+  std::mutex build_lock_;
+  mutable utils::SpinLock lock_;
+  Groups groups_;
+  bool stale_{true};
+  // Start timestamp of the transaction in which the view was computed, the
+  // changes of the transactions committed before it are already included.
+  uint64_t as_of_{0};
+  // While the view is computed, the changes committed meanwhile are kept to
+  // be applied once it is, unless they're already included.
+  bool building_{false};
+  std::vector<std::pair<Groups, uint64_t>> pending_changes_;
+  std::optional<uint64_t> pending_stale_timestamp_;
+};
+
+/**
+ * Materialized views of a database, persisted in a key-value store. Only
+ * the statements of the views are persisted, the rows are computed on the
+ * first read after a restart.
+ */
+class MaterializedViewStore final {
+ public:
+  /// Changes of each view made by a transaction.
+  using Changes = std::vector<std::pair<std::shared_ptr<MaterializedView>, MaterializedView::Groups>>;
+
+  struct ViewInfo {
+    std::string name;
+    std::string statement;
+  };
+
+  explicit MaterializedViewStore(std::filesystem::path directory);
+
+  void RestoreViews(utils::SkipList<QueryCacheEntry> *query_cache, const InterpreterConfig::Query &query_config);
+
+  /// Creates the view and computes its rows.
+  /// @throw QueryException if the view can't be created.
+  void AddView(std::string name, const std::string &statement, storage::Storage *storage,
+               utils::SkipList<QueryCacheEntry> *query_cache, const InterpreterConfig::Query &query_config);
+
+  /// @throw QueryException if the view doesn't exist.
+  void DropView(const std::string &name);
+
+  std::shared_ptr<MaterializedView> Find(const std::string &name) const;
+
+  std::vector<ViewInfo> GetViewInfo() const;
+
+  bool HasViews() const { return view_count_.load(std::memory_order_acquire) > 0; }
+
+  /// Computes how the objects changed by the transaction of `dba`, collected
+  /// by the `collector`, change the views. Called right before the
+  /// transaction commits. The views whose changes can't be computed are left
+  /// out of the result.
+  Changes CollectChanges(DbAccessor *dba, const TriggerContextCollector &collector) const;
+
+  /// Applies the changes of the transaction committed at `commit_timestamp`.
+  /// The views without changes among them are marked as stale.
+  void Apply(const Changes &changes, uint64_t commit_timestamp);
+
+  /// Marks all views as stale, see `MaterializedView::MarkStale`.
+  void MarkStale(std::optional<uint64_t> commit_timestamp);
+
+ private:
+  mutable utils::Synchronized<std::map<std::string, std::shared_ptr<MaterializedView>, std::less<>>, utils::SpinLock>
+      views_;
+  std::atomic<size_t> view_count_{0};
+  std::mutex store_lock_;
+  kvstore::KVStore storage_;
+};
+
+}  // namespace memgraph::query
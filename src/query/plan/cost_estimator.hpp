@@ -13,6 +13,7 @@
 
 #include "query/frontend/ast/ast.hpp"
 #include "query/parameters.hpp"
+#include "query/plan/cost_params.hpp"
 #include "query/plan/operator.hpp"
 #include "query/typed_value.hpp"
 #include "utils/algorithm.hpp"
@@ -70,21 +71,7 @@ struct Scope {
 template <class TDbAccessor>
 class CostEstimator : public HierarchicalLogicalOperatorVisitor {
  public:
-  struct CostParam {
-    static constexpr double kScanAll{1.0};
-    static constexpr double kScanAllByLabel{1.1};
-    static constexpr double MakeScanAllByLabelPropertyValue{1.1};
-    static constexpr double MakeScanAllByLabelPropertyRange{1.1};
-    static constexpr double MakeScanAllByLabelProperty{1.1};
-    static constexpr double kExpand{2.0};
-    static constexpr double kExpandVariable{3.0};
-    static constexpr double kFilter{1.5};
-    static constexpr double kEdgeUniquenessFilter{1.5};
-    static constexpr double kUnwind{1.3};
-    static constexpr double kForeach{1.0};
-    static constexpr double kUnion{1.0};
-    static constexpr double kSubquery{1.0};
-  };
+  using CostParam = memgraph::query::plan::CostParam;
 
   struct CardParam {
     static constexpr double kExpand{3.0};
@@ -163,7 +150,10 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     auto upper = BoundToPropertyValue(logical_op.upper_bound_);
 
     int64_t factor = 1;
-    if (upper || lower)
+    if ((upper || lower) && index_stats && !index_stats->histogram.Empty())
+      // the histogram gathered by `ANALYZE GRAPH` also accounts for skewed values
+      factor = std::llround(index_stats->histogram.EstimateRangeCount(lower, upper));
+    else if (upper || lower)
       // if we have either Bound<PropertyValue>, use the value index
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, lower, upper);
     else
@@ -193,8 +183,116 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ScanAllByLabelProperties &logical_op) override {
+    auto index_stats = db_accessor_->GetIndexStats(logical_op.label_, logical_op.properties_);
+    if (index_stats.has_value()) {
+      SaveStatsFor(logical_op.output_symbol_, index_stats.value());
+    }
+
+    // Same as for the single property lookups, the cardinality can be
+    // evaluated properly only if all of the values and bounds are literals.
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(logical_op.prefix_.size());
+    for (auto *expression : logical_op.prefix_) {
+      auto property_value = ConstPropertyValue(expression);
+      if (!property_value) break;
+      prefix.push_back(std::move(*property_value));
+    }
+    auto lower = BoundToPropertyValue(logical_op.lower_bound_);
+    auto upper = BoundToPropertyValue(logical_op.upper_bound_);
+
+    double factor = 1.0;
+    if (prefix.size() == logical_op.prefix_.size() && (!logical_op.lower_bound_ || lower) &&
+        (!logical_op.upper_bound_ || upper))
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_, prefix, lower, upper);
+    else
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.properties_) * CardParam::kFilter;
+
+    cardinality_ *= factor;
+
+    // ScanAll performs some work for every element that is produced
+    IncrementCost(CostParam::MakeScanAllByLabelProperties);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByText &logical_op) override {
+    // The index is estimated by the rarest term of the pattern, so a literal
+    // pattern gives a close estimate. Otherwise the whole index is scanned.
+    auto pattern = ConstPropertyValue(logical_op.expression_);
+    double factor = 1.0;
+    if (pattern && pattern->IsString())
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, logical_op.match_,
+                                           pattern->ValueString());
+    else
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, logical_op.match_, "") *
+               CardParam::kFilter;
+
+    cardinality_ *= factor;
+
+    // ScanAll performs some work for every element that is produced
+    IncrementCost(CostParam::kScanAllByText);
+    return true;
+  }
+
+  bool PostVisit(ScanAllByPoint &logical_op) override {
+    // Constant regions are estimated by the number of indexed points in their
+    // bounding box. Otherwise the labeled vertices are filtered.
+    auto first = ConstPropertyValue(logical_op.lower_or_center_);
+    auto second = ConstPropertyValue(logical_op.upper_or_radius_);
+    std::optional<storage::PointRegion> region;
+    if (first && first->IsPoint() && second) {
+      if (logical_op.region_type_ == storage::PointRegion::Type::WITHIN_DISTANCE) {
+        if (second->IsInt() || second->IsDouble()) {
+          const double radius = second->IsInt() ? static_cast<double>(second->ValueInt()) : second->ValueDouble();
+          region = storage::PointRegion::WithinDistance(first->ValuePoint(), radius, logical_op.inclusive_);
+        }
+      } else if (second->IsPoint()) {
+        region = storage::PointRegion::WithinBox(first->ValuePoint(), second->ValuePoint());
+      }
+    }
+    double factor = 1.0;
+    if (region)
+      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, *region);
+    else
+      factor = db_accessor_->VerticesCount(logical_op.label_) * CardParam::kFilter;
+
+    cardinality_ *= factor;
+
+    // ScanAll performs some work for every element that is produced
+    IncrementCost(CostParam::kScanAllByPoint);
+    return true;
+  }
+
   // TODO: Cost estimate ScanAllById?
 
+  bool PostVisit(ScanAllByEdgeType &logical_op) override {
+    const auto edge_type = logical_op.common_.edge_types.front();
+    double factor = 1.0;
+    if (!logical_op.property_) {
+      factor = db_accessor_->EdgesCount(edge_type);
+    } else if (logical_op.expression_) {
+      auto property_value = ConstPropertyValue(logical_op.expression_);
+      if (property_value)
+        factor = db_accessor_->EdgesCount(edge_type, *logical_op.property_, property_value.value());
+      else
+        factor = db_accessor_->EdgesCount(edge_type, *logical_op.property_) * CardParam::kFilter;
+    } else {
+      auto lower = BoundToPropertyValue(logical_op.lower_bound_);
+      auto upper = BoundToPropertyValue(logical_op.upper_bound_);
+      if (upper || lower)
+        factor = db_accessor_->EdgesCount(edge_type, *logical_op.property_, lower, upper);
+      else
+        factor = db_accessor_->EdgesCount(edge_type, *logical_op.property_);
+      if ((logical_op.upper_bound_ && !upper) || (logical_op.lower_bound_ && !lower)) factor *= CardParam::kFilter;
+    }
+
+    cardinality_ *= factor;
+
+    // Like ScanAll, the edge scan does some work for every edge it produces.
+    IncrementCost(CostParam::kScanAllByEdgeType);
+    return true;
+  }
+
   bool PostVisit(Expand &expand) override {
     auto card_param = CardParam::kExpand;
     auto stats = GetStatsFor(expand.input_symbol_);
@@ -312,6 +410,57 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return false;
   }
 
+  bool PreVisit(HashJoin &op) override {
+    // The left branch is pulled only once to build the hash table, after
+    // which each row of the right branch is joined like by a Filter.
+    double left_cost = EstimateCostOnBranch(&op.left_op_);
+    op.right_op_->Accept(*this);
+    cost_ += left_cost;
+
+    IncrementCost(CostParam::kFilter);
+    // An optional join yields at least every right row.
+    if (!op.optional_) cardinality_ *= CardParam::kFilter;
+
+    return false;
+  }
+
+  bool PreVisit(IndexedJoin &op) override {
+    // The sub branch is pulled for each row of the main branch, so its cost
+    // and cardinality multiply those of the main branch.
+    op.main_branch_->Accept(*this);
+    CostEstimator<TDbAccessor> sub_branch_estimator(db_accessor_, table_, parameters, scopes_.back());
+    op.sub_branch_->Accept(sub_branch_estimator);
+    cost_ += cardinality_ * sub_branch_estimator.cost();
+    cardinality_ *= sub_branch_estimator.cardinality();
+
+    return false;
+  }
+
+  // The pipeline breakers receive all the rows of their inputs before they
+  // output any, so their estimated input rows can be checked during execution.
+  bool PostVisit(Accumulate &op) override {
+    breaker_cardinalities_[&op] = cardinality_;
+    return true;
+  }
+
+  bool PostVisit(Aggregate &op) override {
+    breaker_cardinalities_[&op] = cardinality_;
+    return true;
+  }
+
+  bool PostVisit(OrderBy &op) override {
+    breaker_cardinalities_[&op] = cardinality_;
+    return true;
+  }
+
+  bool PreVisit(Cartesian &op) override {
+    // Only the rows of the left branch are kept in memory.
+    op.left_op_->Accept(*this);
+    breaker_cardinalities_[&op] = cardinality_;
+    op.right_op_->Accept(*this);
+    return false;
+  }
+
   bool PostVisit(EmptyResult & /*op*/) override {
     scopes_.emplace_back();
     return true;
@@ -322,6 +471,10 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   auto cost() const { return cost_; }
   auto cardinality() const { return cardinality_; }
 
+  /// Estimated numbers of rows which the pipeline breakers outside of the
+  /// branches estimated separately receive from their inputs.
+  const auto &breaker_cardinalities() const { return breaker_cardinalities_; }
+
  private:
   // cost estimation that gets accumulated as the visitor
   // tours the logical plan
@@ -331,6 +484,8 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   // cardinality is a double to make it easier to work with
   double cardinality_{1};
 
+  std::unordered_map<const LogicalOperator *, double> breaker_cardinalities_;
+
   // accessor used for cardinality estimates in ScanAll and ScanAllByLabel
   TDbAccessor *db_accessor_;
   const SymbolTable &table_;
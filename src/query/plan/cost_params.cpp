@@ -0,0 +1,84 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/cost_params.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <string_view>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+#include <json/json.hpp>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+// The names of the costs in the json file, which are the names of the
+// operators.
+constexpr std::pair<std::string_view, double *> kCostParams[] = {
+    {"ScanAll", &CostParam::kScanAll},
+    {"ScanAllByLabel", &CostParam::kScanAllByLabel},
+    {"ScanAllByLabelPropertyValue", &CostParam::MakeScanAllByLabelPropertyValue},
+    {"ScanAllByLabelPropertyRange", &CostParam::MakeScanAllByLabelPropertyRange},
+    {"ScanAllByLabelProperty", &CostParam::MakeScanAllByLabelProperty},
+    {"ScanAllByLabelProperties", &CostParam::MakeScanAllByLabelProperties},
+    {"ScanAllByEdgeType", &CostParam::kScanAllByEdgeType},
+    {"ScanAllByText", &CostParam::kScanAllByText},
+    {"ScanAllByPoint", &CostParam::kScanAllByPoint},
+    {"Expand", &CostParam::kExpand},
+    {"ExpandVariable", &CostParam::kExpandVariable},
+    {"Filter", &CostParam::kFilter},
+    {"EdgeUniquenessFilter", &CostParam::kEdgeUniquenessFilter},
+    {"Unwind", &CostParam::kUnwind},
+    {"Foreach", &CostParam::kForeach},
+    {"Union", &CostParam::kUnion},
+    {"Subquery", &CostParam::kSubquery},
+};
+
+}  // namespace
+
+void LoadCostParams(const std::filesystem::path &path) {
+  using json = nlohmann::json;
+  if (path.empty()) {
+    spdlog::info("Path to the query cost model was not set, using the default operator costs.");
+    return;
+  }
+  MG_ASSERT(std::filesystem::is_regular_file(path), "Path to the query cost model {} is not a regular file.",
+            path.string());
+  json costs;
+  try {
+    std::ifstream file(path);
+    costs = json::parse(file);
+  } catch (const json::exception &e) {
+    LOG_FATAL("Parsing the query cost model {} was unsuccessful: {}", path.string(), e.what());
+  }
+  MG_ASSERT(costs.is_object(), "The query cost model {} has to map the operators to their costs.", path.string());
+  for (auto it = costs.begin(); it != costs.end(); ++it) {
+    const auto &name = it.key();
+    const auto &cost = it.value();
+    const auto *param = std::find_if(std::begin(kCostParams), std::end(kCostParams),
+                                     [&](const auto &param) { return param.first == name; });
+    if (param == std::end(kCostParams)) {
+      spdlog::warn("The query cost model has the cost of an unknown operator {}.", name);
+      continue;
+    }
+    MG_ASSERT(cost.is_number() && cost.get<double>() > 0.0, "The cost of the operator {} has to be a positive number.",
+              name);
+    *param->second = cost.get<double>();
+  }
+  spdlog::info("Loaded the query cost model from {}.", path.string());
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,47 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <filesystem>
+
+namespace memgraph::query::plan {
+
+/// Costs of processing a row by each operator, relative to each other, which
+/// the `CostEstimator` uses to compare the plans. The defaults may be replaced
+/// with the costs measured on the host, see `LoadCostParams`.
+struct CostParam {
+  static inline double kScanAll{1.0};
+  static inline double kScanAllByLabel{1.1};
+  static inline double MakeScanAllByLabelPropertyValue{1.1};
+  static inline double MakeScanAllByLabelPropertyRange{1.1};
+  static inline double MakeScanAllByLabelProperty{1.1};
+  static inline double MakeScanAllByLabelProperties{1.1};
+  static inline double kScanAllByEdgeType{1.1};
+  static inline double kScanAllByText{1.1};
+  static inline double kScanAllByPoint{1.1};
+  static inline double kExpand{2.0};
+  static inline double kExpandVariable{3.0};
+  static inline double kFilter{1.5};
+  static inline double kEdgeUniquenessFilter{1.5};
+  static inline double kUnwind{1.3};
+  static inline double kForeach{1.0};
+  static inline double kUnion{1.0};
+  static inline double kSubquery{1.0};
+};
+
+/// Replaces the `CostParam` costs with those in the json file at `path`, which
+/// maps the names of the operators to their costs, like the file written by
+/// the `cost_calibration` benchmark. The costs of operators missing from the
+/// file are kept. Has to be called before any query is planned.
+void LoadCostParams(const std::filesystem::path &path);
+
+}  // namespace memgraph::query::plan
@@ -12,9 +12,13 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstdint>
+#include <exception>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <queue>
 #include <random>
@@ -30,6 +34,7 @@
 #include "query/common.hpp"
 #include "spdlog/spdlog.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "csv/parsing.hpp"
 #include "license/license.hpp"
 #include "query/auth_checker.hpp"
@@ -39,14 +44,19 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
+#include "query/plan/preprocess.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
+#include "query/procedure/result_cache.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/vertex_filter.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/event_counter.hpp"
@@ -57,6 +67,7 @@
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/pmr/deque.hpp"
 #include "utils/pmr/list.hpp"
 #include "utils/pmr/unordered_map.hpp"
@@ -100,8 +111,12 @@ extern const Event ScanAllOperator;
 extern const Event ScanAllByLabelOperator;
 extern const Event ScanAllByLabelPropertyRangeOperator;
 extern const Event ScanAllByLabelPropertyValueOperator;
+extern const Event ScanAllByLabelPropertiesOperator;
 extern const Event ScanAllByLabelPropertyOperator;
 extern const Event ScanAllByIdOperator;
+extern const Event ScanAllByEdgeTypeOperator;
+extern const Event ScanAllByTextOperator;
+extern const Event ScanAllByPointOperator;
 extern const Event ExpandOperator;
 extern const Event ExpandVariableOperator;
 extern const Event ConstructNamedPathOperator;
@@ -125,6 +140,8 @@ extern const Event UnwindOperator;
 extern const Event DistinctOperator;
 extern const Event UnionOperator;
 extern const Event CartesianOperator;
+extern const Event HashJoinOperator;
+extern const Event IndexedJoinOperator;
 extern const Event CallProcedureOperator;
 extern const Event ForeachOperator;
 extern const Event EmptyResultOperator;
@@ -136,6 +153,10 @@ namespace memgraph::query::plan {
 
 namespace {
 
+// Number of input rows of which Expand prefetches the edges at once in the
+// on-disk storage.
+constexpr size_t kExpandInputBatchSize = 256;
+
 // Custom equality function for a vector of typed values.
 // Used in unordered_maps in Aggregate and Distinct operators.
 struct TypedValueVectorEqual {
@@ -149,10 +170,9 @@ struct TypedValueVectorEqual {
   }
 };
 
-// Returns boolean result of evaluating filter expression. Null is treated as
-// false. Other non boolean values raise a QueryRuntimeException.
-bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
-  TypedValue result = filter->Accept(evaluator);
+// Returns boolean result of a filter expression. Null is treated as false.
+// Other non boolean values raise a QueryRuntimeException.
+bool FilterResult(const TypedValue &result) {
   // Null is treated like false.
   if (result.IsNull()) return false;
   if (result.type() != TypedValue::Type::Bool)
@@ -160,6 +180,14 @@ bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
   return result.ValueBool();
 }
 
+bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
+  return FilterResult(filter->Accept(evaluator));
+}
+
+bool EvaluateFilter(ExpressionEvaluator &evaluator, CompiledExpression &filter) {
+  return FilterResult(filter.Evaluate(evaluator));
+}
+
 template <typename T>
 uint64_t ComputeProfilingKey(const T *obj) {
   static_assert(sizeof(T *) == sizeof(uint64_t));
@@ -170,8 +198,99 @@ inline void AbortCheck(ExecutionContext const &context) {
   if (auto const reason = MustAbort(context); reason != AbortReason::NO_ABORT) throw HintedAbortError(reason);
 }
 
+// Returns the free symbols of the expressions together with `symbols`.
+std::vector<Symbol> UsedSymbols(const SymbolTable &symbol_table, const std::vector<Expression *> &expressions,
+                                const std::vector<Symbol> &symbols) {
+  UsedSymbolsCollector collector(symbol_table);
+  for (auto *expression : expressions) {
+    if (expression) expression->Accept(collector);
+  }
+  collector.symbols_.insert(symbols.begin(), symbols.end());
+  return {collector.symbols_.begin(), collector.symbols_.end()};
+}
+
+// Pulls all rows of the cursor and calls `process` for each of them. When
+// batches are enabled, the rows are pulled in batches keeping the values of
+// the symbols returned by `get_symbols`, and restored into the frame one by
+// one. Returns the number of pulled rows.
+template <class TGetSymbols, class TProcess>
+uint64_t PullAllRows(Cursor &cursor, Frame &frame, ExecutionContext &context, TGetSymbols get_symbols,
+                     TProcess process) {
+  uint64_t rows = 0;
+  if (context.pull_batch_size == 0) {
+    for (; cursor.Pull(frame, context); ++rows) process();
+    return rows;
+  }
+  FrameBlock block(get_symbols(), context.pull_batch_size, frame.GetMemoryResource());
+  for (; cursor.PullBatch(frame, block, context); block.Clear()) {
+    for (size_t row = 0; row < block.Size(); ++row) {
+      block.RestoreRow(row, frame, context.frame_change_collector);
+      process();
+    }
+    rows += block.Size();
+  }
+  return rows;
+}
+
+// Counts the rows which a pipeline breaker received from its input, so that
+// they can be compared with those estimated by the planner.
+void ObserveCardinality(ExecutionContext &context, const LogicalOperator &op, uint64_t rows) {
+  if (context.observed_cardinalities) (*context.observed_cardinalities)[&op] += rows;
+}
+
 }  // namespace
 
+FrameBlock::FrameBlock(std::vector<Symbol> symbols, size_t capacity, utils::MemoryResource *memory)
+    : symbols_(std::move(symbols)), capacity_(capacity), columns_(memory) {
+  MG_ASSERT(capacity_ > 0, "FrameBlock must have a positive capacity");
+  columns_.reserve(symbols_.size());
+  for (size_t i = 0; i < symbols_.size(); ++i) {
+    utils::pmr::vector<TypedValue> column(memory);
+    column.reserve(capacity_);
+    columns_.emplace_back(std::move(column));
+  }
+}
+
+void FrameBlock::AppendRow(const Frame &frame) {
+  DMG_ASSERT(!Full(), "FrameBlock is full");
+  for (size_t i = 0; i < symbols_.size(); ++i) {
+    columns_[i].emplace_back(frame[symbols_[i]]);
+  }
+  ++size_;
+}
+
+void FrameBlock::MoveRow(Frame &frame) {
+  DMG_ASSERT(!Full(), "FrameBlock is full");
+  for (size_t i = 0; i < symbols_.size(); ++i) {
+    columns_[i].emplace_back(std::move(frame[symbols_[i]]));
+  }
+  ++size_;
+}
+
+void FrameBlock::RestoreRow(size_t row, Frame &frame, FrameChangeCollector *frame_change_collector) {
+  DMG_ASSERT(row < size_, "FrameBlock row out of range");
+  for (size_t i = 0; i < symbols_.size(); ++i) {
+    if (frame_change_collector && frame_change_collector->IsKeyTracked(symbols_[i].name())) {
+      frame_change_collector->ResetTrackingValue(symbols_[i].name());
+    }
+    frame[symbols_[i]] = std::move(columns_[i][row]);
+  }
+}
+
+void FrameBlock::Clear() {
+  for (auto &column : columns_) {
+    column.clear();
+  }
+  size_ = 0;
+}
+
+bool Cursor::PullBatch(Frame &frame, FrameBlock &block, ExecutionContext &context) {
+  while (!block.Full() && Pull(frame, context)) {
+    block.AppendRow(frame);
+  }
+  return !block.Empty();
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define SCOPED_PROFILE_OP(name) ScopedProfile profile{ComputeProfilingKey(this), name, &context};
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -202,28 +321,13 @@ void Once::OnceCursor::Reset() { did_pull_ = false; }
 CreateNode::CreateNode(const std::shared_ptr<LogicalOperator> &input, const NodeCreationInfo &node_info)
     : input_(input ? input : std::make_shared<Once>()), node_info_(node_info) {}
 
-// Creates a vertex on this GraphDb. Returns a reference to vertex placed on the
-// frame.
-VertexAccessor &CreateLocalVertex(const NodeCreationInfo &node_info, Frame *frame, ExecutionContext &context) {
+namespace {
+
+// Sets the properties of a created vertex and places it on the frame. Returns
+// a reference to the vertex placed on the frame.
+VertexAccessor &InitLocalVertex(VertexAccessor new_node, const NodeCreationInfo &node_info, Frame *frame,
+                                ExecutionContext &context) {
   auto &dba = *context.db_accessor;
-  auto new_node = dba.InsertVertex();
-  context.execution_stats[ExecutionStats::Key::CREATED_NODES] += 1;
-  for (auto label : node_info.labels) {
-    auto maybe_error = new_node.AddLabel(label);
-    if (maybe_error.HasError()) {
-      switch (maybe_error.GetError()) {
-        case storage::Error::SERIALIZATION_ERROR:
-          throw TransactionSerializationException();
-        case storage::Error::DELETED_OBJECT:
-          throw QueryRuntimeException("Trying to set a label on a deleted node.");
-        case storage::Error::VERTEX_HAS_EDGES:
-        case storage::Error::PROPERTIES_DISABLED:
-        case storage::Error::NONEXISTENT_OBJECT:
-          throw QueryRuntimeException("Unexpected error when setting a label.");
-      }
-    }
-    context.execution_stats[ExecutionStats::Key::CREATED_LABELS] += 1;
-  }
   // Evaluator should use the latest accessors, as modified in this query, when
   // setting properties on new nodes.
   ExpressionEvaluator evaluator(frame, context.symbol_table, context.evaluation_context, context.db_accessor,
@@ -247,6 +351,36 @@ VertexAccessor &CreateLocalVertex(const NodeCreationInfo &node_info, Frame *fram
   return (*frame)[node_info.symbol].ValueVertex();
 }
 
+// Number of rows whose vertices are created at once.
+constexpr size_t kCreateNodeBatchSize = 1024;
+
+}  // namespace
+
+// Creates a vertex on this GraphDb. Returns a reference to vertex placed on the
+// frame.
+VertexAccessor &CreateLocalVertex(const NodeCreationInfo &node_info, Frame *frame, ExecutionContext &context) {
+  auto &dba = *context.db_accessor;
+  auto new_node = dba.InsertVertex();
+  context.execution_stats[ExecutionStats::Key::CREATED_NODES] += 1;
+  for (auto label : node_info.labels) {
+    auto maybe_error = new_node.AddLabel(label);
+    if (maybe_error.HasError()) {
+      switch (maybe_error.GetError()) {
+        case storage::Error::SERIALIZATION_ERROR:
+          throw TransactionSerializationException();
+        case storage::Error::DELETED_OBJECT:
+          throw QueryRuntimeException("Trying to set a label on a deleted node.");
+        case storage::Error::VERTEX_HAS_EDGES:
+        case storage::Error::PROPERTIES_DISABLED:
+        case storage::Error::NONEXISTENT_OBJECT:
+          throw QueryRuntimeException("Unexpected error when setting a label.");
+      }
+    }
+    context.execution_stats[ExecutionStats::Key::CREATED_LABELS] += 1;
+  }
+  return InitLocalVertex(new_node, node_info, frame, context);
+}
+
 ACCEPT_WITH_INPUT(CreateNode)
 
 UniqueCursorPtr CreateNode::MakeCursor(utils::MemoryResource *mem) const {
@@ -262,7 +396,14 @@ std::vector<Symbol> CreateNode::ModifiedSymbols(const SymbolTable &table) const
 }
 
 CreateNode::CreateNodeCursor::CreateNodeCursor(const CreateNode &self, utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+    : self_(self), input_cursor_(self.input_->MakeCursor(mem)), batch_input_(nullptr) {
+  // The unwound rows don't depend on the created vertices, so all vertices of
+  // a batch of rows can be created before the rows are returned.
+  if (self_.input_->GetTypeInfo() == Unwind::kType) {
+    const auto *unwind = static_cast<const Unwind *>(self_.input_.get());
+    if (unwind->input_->GetTypeInfo() == Once::kType) batch_input_ = unwind;
+  }
+}
 
 bool CreateNode::CreateNodeCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("CreateNode");
@@ -274,6 +415,16 @@ bool CreateNode::CreateNodeCursor::Pull(Frame &frame, ExecutionContext &context)
   }
 #endif
 
+  if (batch_input_ && !context.is_profile_query) {
+    if (batch_row_ == batch_vertices_.size() && !PullCreatedBatch(frame, context)) return false;
+    batch_rows_->RestoreRow(batch_row_, frame, context.frame_change_collector);
+    auto created_vertex = InitLocalVertex(batch_vertices_[batch_row_++], self_.node_info_, &frame, context);
+    if (context.trigger_context_collector) {
+      context.trigger_context_collector->RegisterCreatedObject(created_vertex);
+    }
+    return true;
+  }
+
   if (input_cursor_->Pull(frame, context)) {
     auto created_vertex = CreateLocalVertex(self_.node_info_, &frame, context);
     if (context.trigger_context_collector) {
@@ -285,9 +436,37 @@ bool CreateNode::CreateNodeCursor::Pull(Frame &frame, ExecutionContext &context)
   return false;
 }
 
+// Pulls the next batch of unwound rows and creates their vertices with the
+// labels through a single storage call. Returns false if the input is
+// exhausted.
+bool CreateNode::CreateNodeCursor::PullCreatedBatch(Frame &frame, ExecutionContext &context) {
+  if (!batch_rows_) {
+    batch_rows_.emplace(std::vector<Symbol>{batch_input_->output_symbol_}, kCreateNodeBatchSize,
+                        frame.GetMemoryResource());
+  }
+  batch_rows_->Clear();
+  batch_vertices_.clear();
+  batch_row_ = 0;
+  while (!batch_rows_->Full() && input_cursor_->Pull(frame, context)) {
+    batch_rows_->AppendRow(frame);
+  }
+  if (batch_rows_->Empty()) return false;
+
+  batch_vertices_ = context.db_accessor->InsertVertices(batch_rows_->Size(), self_.node_info_.labels);
+  context.execution_stats[ExecutionStats::Key::CREATED_NODES] += static_cast<int64_t>(batch_rows_->Size());
+  context.execution_stats[ExecutionStats::Key::CREATED_LABELS] +=
+      static_cast<int64_t>(batch_rows_->Size() * self_.node_info_.labels.size());
+  return true;
+}
+
 void CreateNode::CreateNodeCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void CreateNode::CreateNodeCursor::Reset() { input_cursor_->Reset(); }
+void CreateNode::CreateNodeCursor::Reset() {
+  input_cursor_->Reset();
+  if (batch_rows_) batch_rows_->Clear();
+  batch_vertices_.clear();
+  batch_row_ = 0;
+}
 
 CreateExpand::CreateExpand(const NodeCreationInfo &node_info, const EdgeCreationInfo &edge_info,
                            const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, bool existing_node)
@@ -431,17 +610,98 @@ VertexAccessor &CreateExpand::CreateExpandCursor::OtherVertex(Frame &frame, Exec
   }
 }
 
+namespace {
+
+// Returns the property lookup of an identifier if the expression is one.
+PropertyLookup *FindIdentifierPropertyLookup(Expression *expression) {
+  auto *lookup = utils::Downcast<PropertyLookup>(expression);
+  if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return nullptr;
+  if (!utils::Downcast<Identifier>(lookup->expression_)) return nullptr;
+  return lookup;
+}
+
+bool IsConstant(Expression *expression) {
+  return utils::Downcast<PrimitiveLiteral>(expression) || utils::Downcast<ParameterLookup>(expression);
+}
+
+storage::PropertyValue EvaluateConstant(Expression *expression, const EvaluationContext &context) {
+  if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) return literal->value_;
+  return context.parameters.AtTokenPosition(static_cast<ParameterLookup *>(expression)->token_position_);
+}
+
+// Adds the conjunct of a filter to the storage filter of the vertices of the
+// `symbol` if it's a label test or a comparison of a property with a constant.
+void AddVertexFilterConjunct(Expression *expression, const Symbol &symbol, const SymbolTable &symbol_table,
+                             const EvaluationContext &context, storage::VertexFilter *filter) {
+  using Comparison = storage::VertexFilter::Comparison;
+  if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+    AddVertexFilterConjunct(and_op->expression1_, symbol, symbol_table, context, filter);
+    AddVertexFilterConjunct(and_op->expression2_, symbol, symbol_table, context, filter);
+    return;
+  }
+  auto is_symbol = [&](Expression *expression) {
+    auto *identifier = utils::Downcast<Identifier>(expression);
+    return identifier && symbol_table.at(*identifier) == symbol;
+  };
+  if (auto *labels_test = utils::Downcast<LabelsTest>(expression)) {
+    if (!is_symbol(labels_test->expression_)) return;
+    for (const auto &label : labels_test->labels_) filter->AddLabel(context.labels[label.ix]);
+    return;
+  }
+  if (auto *not_op = utils::Downcast<NotOperator>(expression)) {
+    auto *is_null = utils::Downcast<IsNullOperator>(not_op->expression_);
+    auto *lookup = is_null ? FindIdentifierPropertyLookup(is_null->expression_) : nullptr;
+    if (!lookup || !is_symbol(lookup->expression_)) return;
+    filter->AddProperty(context.properties[lookup->property_.ix], Comparison::IS_NOT_NULL, storage::PropertyValue());
+    return;
+  }
+  // The comparison of the constant with the property, and the flipped one of
+  // the property with the constant.
+  auto comparison = [&]() -> std::optional<std::pair<Comparison, Comparison>> {
+    if (utils::Downcast<EqualOperator>(expression)) return std::pair{Comparison::EQUAL, Comparison::EQUAL};
+    if (utils::Downcast<LessOperator>(expression)) return std::pair{Comparison::LESS, Comparison::GREATER};
+    if (utils::Downcast<LessEqualOperator>(expression)) {
+      return std::pair{Comparison::LESS_EQUAL, Comparison::GREATER_EQUAL};
+    }
+    if (utils::Downcast<GreaterOperator>(expression)) return std::pair{Comparison::GREATER, Comparison::LESS};
+    if (utils::Downcast<GreaterEqualOperator>(expression)) {
+      return std::pair{Comparison::GREATER_EQUAL, Comparison::LESS_EQUAL};
+    }
+    return std::nullopt;
+  }();
+  if (!comparison) return;
+  auto *binary_op = static_cast<BinaryOperator *>(expression);
+  for (auto [lhs, rhs, op] : {std::tuple{binary_op->expression1_, binary_op->expression2_, comparison->first},
+                              std::tuple{binary_op->expression2_, binary_op->expression1_, comparison->second}}) {
+    auto *lookup = FindIdentifierPropertyLookup(lhs);
+    if (!lookup || !is_symbol(lookup->expression_) || !IsConstant(rhs)) continue;
+    auto value = EvaluateConstant(rhs, context);
+    // Other values are left to the expression evaluator, which also reports
+    // the invalid comparisons.
+    if (!value.IsInt() && !value.IsDouble() && !value.IsString() && !(value.IsBool() && op == Comparison::EQUAL)) {
+      return;
+    }
+    filter->AddProperty(context.properties[lookup->property_.ix], op, std::move(value));
+    return;
+  }
+}
+
+}  // namespace
+
 template <class TVerticesFun>
 class ScanAllCursor : public Cursor {
  public:
   explicit ScanAllCursor(const ScanAll &self, Symbol output_symbol, UniqueCursorPtr input_cursor, storage::View view,
-                         TVerticesFun get_vertices, const char *op_name)
+                         TVerticesFun get_vertices, const char *op_name, Expression *filter = nullptr,
+                         std::optional<storage::PropertyId> indexed_property = std::nullopt)
       : self_(self),
         output_symbol_(output_symbol),
         input_cursor_(std::move(input_cursor)),
         view_(view),
         get_vertices_(std::move(get_vertices)),
-        op_name_(op_name) {}
+        op_name_(op_name),
+        filter_(filter),
+        indexed_property_(indexed_property) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP_BY_REF(self_);
@@ -449,6 +709,10 @@ class ScanAllCursor : public Cursor {
     AbortCheck(context);
 
     while (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+      if (IsChunked(context)) {
+        if (!TakeChunk(context)) return false;
+        continue;
+      }
       if (!input_cursor_->Pull(frame, context)) return false;
       // We need a getter function, because in case of exhausting a lazy
       // iterable, we cannot simply reset it by calling begin().
@@ -458,6 +722,7 @@ class ScanAllCursor : public Cursor {
       // the roundabout assignment + emplace, instead of simple:
       // vertices _ = get_vertices_(frame, context);
       vertices_.emplace(std::move(next_vertices.value()));
+      SetVertexFilter(context);
       vertices_it_.emplace(vertices_.value().begin());
       vertices_end_it_.emplace(vertices_.value().end());
     }
@@ -468,10 +733,46 @@ class ScanAllCursor : public Cursor {
 #endif
 
     frame[output_symbol_] = *vertices_it_.value();
+    SetIndexedValue(frame, context);
     ++vertices_it_.value();
     return true;
   }
 
+  bool PullBatch(Frame &frame, FrameBlock &block, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    AbortCheck(context);
+
+    while (!block.Full()) {
+      if (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+        if (IsChunked(context)) {
+          if (!TakeChunk(context)) break;
+          continue;
+        }
+        if (!input_cursor_->Pull(frame, context)) break;
+        auto next_vertices = get_vertices_(frame, context);
+        if (!next_vertices) continue;
+        vertices_.emplace(std::move(next_vertices.value()));
+        SetVertexFilter(context);
+        vertices_it_.emplace(vertices_.value().begin());
+        vertices_end_it_.emplace(vertices_.value().end());
+        continue;
+      }
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker && !FindNextVertex(context)) {
+        continue;
+      }
+#endif
+
+      frame[output_symbol_] = *vertices_it_.value();
+      SetIndexedValue(frame, context);
+      ++vertices_it_.value();
+      // The input symbols stay on the frame for the other vertices.
+      block.AppendRow(frame);
+    }
+    return !block.Empty();
+  }
+
 #ifdef MG_ENTERPRISE
   bool FindNextVertex(const ExecutionContext &context) {
     while (vertices_it_.value() != vertices_end_it_.value()) {
@@ -495,15 +796,73 @@ class ScanAllCursor : public Cursor {
   }
 
  private:
+  using TVertices = typename std::result_of<TVerticesFun(Frame &, ExecutionContext &)>::type::value_type;
+
+  // The workers of a parallel query take the chunks of the vertices of the
+  // scan one at a time instead of pulling the input, which is `Once`.
+  bool IsChunked(const ExecutionContext &context) const {
+    return context.vertex_chunks && context.vertex_chunks->Scan() == &self_;
+  }
+
+  bool TakeChunk(ExecutionContext &context) {
+    if constexpr (std::is_same_v<TVertices, VerticesIterable>) {
+      auto *chunk = context.vertex_chunks->Next();
+      if (!chunk) return false;
+      vertices_.emplace(std::move(*chunk));
+      SetVertexFilter(context);
+      vertices_it_.emplace(vertices_.value().begin());
+      vertices_end_it_.emplace(vertices_.value().end());
+      return true;
+    } else {
+      LOG_FATAL("{} can't scan chunks of the vertices", op_name_);
+    }
+  }
+
+  // Lets the storage skip the vertices for which the simple conjuncts of the
+  // filter are false, while it reads them anyway. The filter expects the old
+  // state of the vertices.
+  void SetVertexFilter(const ExecutionContext &context) {
+    if constexpr (std::is_same_v<TVertices, VerticesIterable>) {
+      if (!filter_ || view_ != storage::View::OLD) return;
+      if (!vertex_filter_) {
+        vertex_filter_.emplace();
+        AddVertexFilterConjunct(filter_, output_symbol_, context.symbol_table, context.evaluation_context,
+                                &*vertex_filter_);
+      }
+      if (!vertex_filter_->Empty()) vertices_->SetFilter(&*vertex_filter_);
+    }
+  }
+
+  // Writes the value of the indexed property of the current vertex. It's read
+  // from the vertex only if the iterator doesn't read it from the index.
+  void SetIndexedValue(Frame &frame, const ExecutionContext &context) {
+    if (!self_.indexed_value_symbol_) return;
+    auto *memory = context.evaluation_context.memory;
+    if constexpr (std::is_same_v<TVertices, VerticesIterable>) {
+      if (const auto *value = vertices_it_->IndexedValue()) {
+        frame[*self_.indexed_value_symbol_] = TypedValue(*value, memory);
+        return;
+      }
+    }
+    auto maybe_value = frame[output_symbol_].ValueVertex().GetProperty(view_, *indexed_property_);
+    if (maybe_value.HasError()) {
+      throw QueryRuntimeException("Unexpected error when getting a property.");
+    }
+    frame[*self_.indexed_value_symbol_] = TypedValue(*maybe_value, memory);
+  }
+
   const ScanAll &self_;
   const Symbol output_symbol_;
   const UniqueCursorPtr input_cursor_;
   storage::View view_;
   TVerticesFun get_vertices_;
-  std::optional<typename std::result_of<TVerticesFun(Frame &, ExecutionContext &)>::type::value_type> vertices_;
+  std::optional<TVertices> vertices_;
   std::optional<decltype(vertices_.value().begin())> vertices_it_;
   std::optional<decltype(vertices_.value().end())> vertices_end_it_;
   const char *op_name_;
+  Expression *filter_;
+  std::optional<storage::VertexFilter> vertex_filter_;
+  std::optional<storage::PropertyId> indexed_property_;
 };
 
 ScanAll::ScanAll(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, storage::View view)
@@ -511,7 +870,9 @@ ScanAll::ScanAll(const std::shared_ptr<LogicalOperator> &input, Symbol output_sy
 
 ACCEPT_WITH_INPUT(ScanAll)
 
-UniqueCursorPtr ScanAll::MakeCursor(utils::MemoryResource *mem) const {
+UniqueCursorPtr ScanAll::MakeCursor(utils::MemoryResource *mem) const { return MakeFilteredCursor(mem, nullptr); }
+
+UniqueCursorPtr ScanAll::MakeFilteredCursor(utils::MemoryResource *mem, Expression *filter) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllOperator);
 
   auto vertices = [this](Frame &, ExecutionContext &context) {
@@ -519,12 +880,13 @@ UniqueCursorPtr ScanAll::MakeCursor(utils::MemoryResource *mem) const {
     return std::make_optional(db->Vertices(view_));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, *this, output_symbol_, input_->MakeCursor(mem),
-                                                                view_, std::move(vertices), "ScanAll");
+                                                                view_, std::move(vertices), "ScanAll", filter);
 }
 
 std::vector<Symbol> ScanAll::ModifiedSymbols(const SymbolTable &table) const {
   auto symbols = input_->ModifiedSymbols(table);
   symbols.emplace_back(output_symbol_);
+  if (indexed_value_symbol_) symbols.emplace_back(*indexed_value_symbol_);
   return symbols;
 }
 
@@ -548,6 +910,39 @@ UniqueCursorPtr ScanAllByLabel::MakeCursor(utils::MemoryResource *mem) const {
 // TODO(buda): Implement ScanAllByLabelProperty operator to iterate over
 // vertices that have the label and some value for the given property.
 
+namespace {
+
+std::optional<utils::Bound<storage::PropertyValue>> EvaluateRangeBound(
+    ExpressionEvaluator &evaluator, const std::optional<utils::Bound<Expression *>> &bound) {
+  if (!bound) return std::nullopt;
+  const auto &value = bound->value()->Accept(evaluator);
+  try {
+    const auto &property_value = storage::PropertyValue(value);
+    switch (property_value.type()) {
+      case storage::PropertyValue::Type::Bool:
+      case storage::PropertyValue::Type::List:
+      case storage::PropertyValue::Type::Map:
+      case storage::PropertyValue::Type::Point:
+        // Prevent indexed lookup with something that would fail if we did
+        // the original filter with `operator<`. Note, for some reason,
+        // Cypher does not support comparing boolean values.
+        throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
+      case storage::PropertyValue::Type::Null:
+      case storage::PropertyValue::Type::Int:
+      case storage::PropertyValue::Type::Double:
+      case storage::PropertyValue::Type::String:
+      case storage::PropertyValue::Type::TemporalData:
+        // These are all fine, there's also the Time data type which was
+        // added to Cypher, but we don't have support for it yet.
+        return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
+    }
+  } catch (const TypedValueException &) {
+    throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+  }
+}
+
+}  // namespace
+
 ScanAllByLabelPropertyRange::ScanAllByLabelPropertyRange(const std::shared_ptr<LogicalOperator> &input,
                                                          Symbol output_symbol, storage::LabelId label,
                                                          storage::PropertyId property, const std::string &property_name,
@@ -565,41 +960,18 @@ ScanAllByLabelPropertyRange::ScanAllByLabelPropertyRange(const std::shared_ptr<L
 ACCEPT_WITH_INPUT(ScanAllByLabelPropertyRange)
 
 UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *mem) const {
+  return MakeFilteredCursor(mem, nullptr);
+}
+
+UniqueCursorPtr ScanAllByLabelPropertyRange::MakeFilteredCursor(utils::MemoryResource *mem, Expression *filter) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByLabelPropertyRangeOperator);
 
   auto vertices = [this](Frame &frame, ExecutionContext &context)
       -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, property_, std::nullopt, std::nullopt))> {
     auto *db = context.db_accessor;
     ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
-    auto convert = [&evaluator](const auto &bound) -> std::optional<utils::Bound<storage::PropertyValue>> {
-      if (!bound) return std::nullopt;
-      const auto &value = bound->value()->Accept(evaluator);
-      try {
-        const auto &property_value = storage::PropertyValue(value);
-        switch (property_value.type()) {
-          case storage::PropertyValue::Type::Bool:
-          case storage::PropertyValue::Type::List:
-          case storage::PropertyValue::Type::Map:
-            // Prevent indexed lookup with something that would fail if we did
-            // the original filter with `operator<`. Note, for some reason,
-            // Cypher does not support comparing boolean values.
-            throw QueryRuntimeException("Invalid type {} for '<'.", value.type());
-          case storage::PropertyValue::Type::Null:
-          case storage::PropertyValue::Type::Int:
-          case storage::PropertyValue::Type::Double:
-          case storage::PropertyValue::Type::String:
-          case storage::PropertyValue::Type::TemporalData:
-            // These are all fine, there's also Point, Date and Time data types
-            // which were added to Cypher, but we don't have support for those
-            // yet.
-            return std::make_optional(utils::Bound<storage::PropertyValue>(property_value, bound->type()));
-        }
-      } catch (const TypedValueException &) {
-        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
-      }
-    };
-    auto maybe_lower = convert(lower_bound_);
-    auto maybe_upper = convert(upper_bound_);
+    auto maybe_lower = EvaluateRangeBound(evaluator, lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(evaluator, upper_bound_);
     // If any bound is null, then the comparison would result in nulls. This
     // is treated as not satisfying the filter, so return no vertices.
     if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
@@ -607,7 +979,8 @@ UniqueCursorPtr ScanAllByLabelPropertyRange::MakeCursor(utils::MemoryResource *m
     return std::make_optional(db->Vertices(view_, label_, property_, maybe_lower, maybe_upper));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
-      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyRange");
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyRange",
+      filter, property_);
 }
 
 ScanAllByLabelPropertyValue::ScanAllByLabelPropertyValue(const std::shared_ptr<LogicalOperator> &input,
@@ -625,6 +998,10 @@ ScanAllByLabelPropertyValue::ScanAllByLabelPropertyValue(const std::shared_ptr<L
 ACCEPT_WITH_INPUT(ScanAllByLabelPropertyValue)
 
 UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *mem) const {
+  return MakeFilteredCursor(mem, nullptr);
+}
+
+UniqueCursorPtr ScanAllByLabelPropertyValue::MakeFilteredCursor(utils::MemoryResource *mem, Expression *filter) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByLabelPropertyValueOperator);
 
   auto vertices = [this](Frame &frame, ExecutionContext &context)
@@ -639,7 +1016,57 @@ UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *m
     return std::make_optional(db->Vertices(view_, label_, property_, storage::PropertyValue(value)));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
-      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyValue");
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyValue",
+      filter, property_);
+}
+
+ScanAllByLabelProperties::ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input,
+                                                   Symbol output_symbol, storage::LabelId label,
+                                                   std::vector<storage::PropertyId> properties,
+                                                   std::vector<std::string> property_names,
+                                                   std::vector<Expression *> prefix, std::optional<Bound> lower_bound,
+                                                   std::optional<Bound> upper_bound, storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      properties_(std::move(properties)),
+      property_names_(std::move(property_names)),
+      prefix_(std::move(prefix)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(!prefix_.empty(), "Composite index lookup needs at least one property value.");
+  MG_ASSERT(prefix_.size() + (lower_bound_ || upper_bound_ ? 1 : 0) <= properties_.size(),
+            "Composite index lookup uses more properties than the index has.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByLabelProperties)
+
+UniqueCursorPtr ScanAllByLabelProperties::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByLabelPropertiesOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, properties_, {}, std::nullopt,
+                                                              std::nullopt))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(prefix_.size());
+    for (auto *expression : prefix_) {
+      auto value = expression->Accept(evaluator);
+      // Null never equals anything, so no vertex can satisfy the filter.
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      prefix.emplace_back(value);
+    }
+    auto maybe_lower = EvaluateRangeBound(evaluator, lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(evaluator, upper_bound_);
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return std::make_optional(db->Vertices(view_, label_, properties_, prefix, maybe_lower, maybe_upper));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelProperties");
 }
 
 ScanAllByLabelProperty::ScanAllByLabelProperty(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
@@ -657,7 +1084,91 @@ UniqueCursorPtr ScanAllByLabelProperty::MakeCursor(utils::MemoryResource *mem) c
     return std::make_optional(db->Vertices(view_, label_, property_));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, *this, output_symbol_, input_->MakeCursor(mem),
-                                                                view_, std::move(vertices), "ScanAllByLabelProperty");
+                                                                view_, std::move(vertices), "ScanAllByLabelProperty",
+                                                                nullptr, property_);
+}
+
+ScanAllByText::ScanAllByText(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                             storage::LabelId label, storage::PropertyId property, std::string property_name,
+                             storage::TextMatch match, Expression *expression, storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      property_(property),
+      property_name_(std::move(property_name)),
+      match_(match),
+      expression_(expression) {
+  DMG_ASSERT(expression, "Expression is not optional.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByText)
+
+UniqueCursorPtr ScanAllByText::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByTextOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context)
+      -> std::optional<decltype(context.db_accessor->Vertices(view_, label_, property_, match_, std::string()))> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto value = expression_->Accept(evaluator);
+    // Like for the string operators, a null pattern matches no vertex.
+    if (value.IsNull()) return std::nullopt;
+    if (!value.IsString()) {
+      throw QueryRuntimeException("'{}' cannot be used as a string pattern.", value.type());
+    }
+    return std::make_optional(db->Vertices(view_, label_, property_, match_, std::string(value.ValueString())));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, *this, output_symbol_, input_->MakeCursor(mem),
+                                                                view_, std::move(vertices), "ScanAllByText");
+}
+
+ScanAllByPoint::ScanAllByPoint(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                               storage::LabelId label, storage::PropertyId property, std::string property_name,
+                               storage::PointRegion::Type region_type, Expression *lower_or_center,
+                               Expression *upper_or_radius, bool inclusive, storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      property_(property),
+      property_name_(std::move(property_name)),
+      region_type_(region_type),
+      lower_or_center_(lower_or_center),
+      upper_or_radius_(upper_or_radius),
+      inclusive_(inclusive) {
+  DMG_ASSERT(lower_or_center && upper_or_radius, "Expressions are not optional.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByPoint)
+
+UniqueCursorPtr ScanAllByPoint::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByPointOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context) -> std::optional<VerticesIterable> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    auto first = lower_or_center_->Accept(evaluator);
+    auto second = upper_or_radius_->Accept(evaluator);
+    // Like for the distance and withinbbox functions, a null argument matches
+    // no vertex.
+    if (first.IsNull() || second.IsNull()) return std::nullopt;
+    if (!first.IsPoint()) {
+      throw QueryRuntimeException("'{}' cannot be used as a point.", first.type());
+    }
+    if (region_type_ == storage::PointRegion::Type::WITHIN_DISTANCE) {
+      if (!second.IsNumeric()) {
+        throw QueryRuntimeException("'{}' cannot be used as a distance.", second.type());
+      }
+      const double radius = second.IsInt() ? static_cast<double>(second.ValueInt()) : second.ValueDouble();
+      return std::make_optional(db->Vertices(
+          view_, label_, property_, storage::PointRegion::WithinDistance(first.ValuePoint(), radius, inclusive_)));
+    }
+    if (!second.IsPoint()) {
+      throw QueryRuntimeException("'{}' cannot be used as a point.", second.type());
+    }
+    if (first.ValuePoint().crs != second.ValuePoint().crs) return std::nullopt;
+    return std::make_optional(db->Vertices(view_, label_, property_,
+                                           storage::PointRegion::WithinBox(first.ValuePoint(), second.ValuePoint())));
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, *this, output_symbol_, input_->MakeCursor(mem),
+                                                                view_, std::move(vertices), "ScanAllByPoint");
 }
 
 ScanAllById::ScanAllById(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, Expression *expression,
@@ -686,6 +1197,127 @@ UniqueCursorPtr ScanAllById::MakeCursor(utils::MemoryResource *mem) const {
                                                                 view_, std::move(vertices), "ScanAllById");
 }
 
+ScanAllByEdgeType::ScanAllByEdgeType(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol,
+                                     ExpandCommon common, std::optional<storage::PropertyId> property,
+                                     std::string property_name, Expression *expression,
+                                     std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+                                     storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      input_symbol_(std::move(input_symbol)),
+      common_(std::move(common)),
+      property_(property),
+      property_name_(std::move(property_name)),
+      expression_(expression),
+      lower_bound_(std::move(lower_bound)),
+      upper_bound_(std::move(upper_bound)),
+      view_(view) {
+  MG_ASSERT(common_.edge_types.size() == 1, "ScanAllByEdgeType needs exactly one edge type.");
+  MG_ASSERT(common_.direction != EdgeAtom::Direction::BOTH, "ScanAllByEdgeType needs an exact direction.");
+  MG_ASSERT(!common_.existing_node, "ScanAllByEdgeType can't expand to an existing node.");
+  MG_ASSERT(property_ || (!expression_ && !lower_bound_ && !upper_bound_),
+            "Property value lookup needs the property of the index.");
+}
+
+ACCEPT_WITH_INPUT(ScanAllByEdgeType)
+
+class ScanAllByEdgeTypeCursor : public Cursor {
+ public:
+  ScanAllByEdgeTypeCursor(const ScanAllByEdgeType &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    while (true) {
+      AbortCheck(context);
+
+      while (!edges_ || edges_it_.value() == edges_end_it_.value()) {
+        if (!input_cursor_->Pull(frame, context)) return false;
+        auto next_edges = GetEdges(frame, context);
+        if (!next_edges) continue;
+        edges_.emplace(std::move(next_edges.value()));
+        edges_it_.emplace(edges_.value().begin());
+        edges_end_it_.emplace(edges_.value().end());
+      }
+
+      auto edge = *edges_it_.value();
+      ++edges_it_.value();
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge.From(), self_.view_,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge.To(), self_.view_,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        continue;
+      }
+#endif
+      frame[self_.common_.edge_symbol] = edge;
+      if (self_.common_.direction == EdgeAtom::Direction::OUT) {
+        frame[self_.input_symbol_] = edge.From();
+        frame[self_.common_.node_symbol] = edge.To();
+      } else {
+        frame[self_.input_symbol_] = edge.To();
+        frame[self_.common_.node_symbol] = edge.From();
+      }
+      return true;
+    }
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    edges_ = std::nullopt;
+    edges_it_ = std::nullopt;
+    edges_end_it_ = std::nullopt;
+  }
+
+ private:
+  std::optional<EdgesIterable> GetEdges(Frame &frame, ExecutionContext &context) {
+    auto *db = context.db_accessor;
+    const auto edge_type = self_.common_.edge_types.front();
+    if (!self_.property_) return db->Edges(self_.view_, edge_type);
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  self_.view_);
+    if (self_.expression_) {
+      auto value = self_.expression_->Accept(evaluator);
+      if (value.IsNull()) return std::nullopt;
+      if (!value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
+      }
+      return db->Edges(self_.view_, edge_type, *self_.property_, storage::PropertyValue(value));
+    }
+    if (!self_.lower_bound_ && !self_.upper_bound_) return db->Edges(self_.view_, edge_type, *self_.property_);
+    auto maybe_lower = EvaluateRangeBound(evaluator, self_.lower_bound_);
+    auto maybe_upper = EvaluateRangeBound(evaluator, self_.upper_bound_);
+    // Same as for the vertex range scans, a null bound satisfies no edge.
+    if (maybe_lower && maybe_lower->value().IsNull()) return std::nullopt;
+    if (maybe_upper && maybe_upper->value().IsNull()) return std::nullopt;
+    return db->Edges(self_.view_, edge_type, *self_.property_, maybe_lower, maybe_upper);
+  }
+
+  const ScanAllByEdgeType &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::optional<EdgesIterable> edges_;
+  std::optional<EdgesIterable::Iterator> edges_it_;
+  std::optional<EdgesIterable::Iterator> edges_end_it_;
+};
+
+UniqueCursorPtr ScanAllByEdgeType::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByEdgeTypeOperator);
+
+  return MakeUniqueCursorPtr<ScanAllByEdgeTypeCursor>(mem, *this, mem);
+}
+
+std::vector<Symbol> ScanAllByEdgeType::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(input_symbol_);
+  symbols.emplace_back(common_.edge_symbol);
+  symbols.emplace_back(common_.node_symbol);
+  return symbols;
+}
+
 namespace {
 bool CheckExistingNode(const VertexAccessor &new_node, const Symbol &existing_node_sym, Frame &frame) {
   const TypedValue &existing_node = frame[existing_node_sym];
@@ -737,18 +1369,32 @@ std::vector<Symbol> Expand::ModifiedSymbols(const SymbolTable &table) const {
 }
 
 Expand::ExpandCursor::ExpandCursor(const Expand &self, utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+    : self_(self), input_cursor_(self.input_->MakeCursor(mem)), input_batch_(mem) {}
 
 Expand::ExpandCursor::ExpandCursor(const Expand &self, int64_t input_degree, int64_t existing_node_degree,
                                    utils::MemoryResource *mem)
     : self_(self),
       input_cursor_(self.input_->MakeCursor(mem)),
       prev_input_degree_(input_degree),
-      prev_existing_degree_(existing_node_degree) {}
+      prev_existing_degree_(existing_node_degree),
+      input_batch_(mem) {}
 
 bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP_BY_REF(self_);
 
+  return PullRow(frame, context);
+}
+
+bool Expand::ExpandCursor::PullBatch(Frame &frame, FrameBlock &block, ExecutionContext &context) {
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  while (!block.Full() && PullRow(frame, context)) {
+    block.AppendRow(frame);
+  }
+  return !block.Empty();
+}
+
+bool Expand::ExpandCursor::PullRow(Frame &frame, ExecutionContext &context) {
   // A helper function for expanding a node from an edge.
   auto pull_node = [this, &frame](const EdgeAccessor &new_edge, EdgeAtom::Direction direction) {
     if (self_.common_.existing_node) return;
@@ -815,6 +1461,7 @@ void Expand::ExpandCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Expand::ExpandCursor::Reset() {
   input_cursor_->Reset();
+  input_batch_.clear();
   in_edges_ = std::nullopt;
   in_edges_it_ = std::nullopt;
   out_edges_ = std::nullopt;
@@ -871,11 +1518,56 @@ ExpansionInfo Expand::ExpandCursor::GetExpansionInfo(Frame &frame) {
       .input_node = existing_vertex, .direction = new_direction, .existing_node = vertex, .reversed = true};
 }
 
+bool Expand::ExpandCursor::PullInput(Frame &frame, ExecutionContext &context) {
+  if (context.db_accessor->GetStorageMode() != storage::StorageMode::ON_DISK_TRANSACTIONAL) {
+    return input_cursor_->Pull(frame, context);
+  }
+
+  if (input_batch_.empty()) {
+    if (!input_symbols_) input_symbols_ = self_.input_->ModifiedSymbols(context.symbol_table);
+    // The existing node may be expanded from instead of the input node, in
+    // the opposite direction.
+    std::vector<VertexAccessor> in_vertices;
+    std::vector<VertexAccessor> out_vertices;
+    const auto direction = self_.common_.direction;
+    auto add_vertex = [&](const TypedValue &value, bool reversed) {
+      if (!value.IsVertex()) return;
+      if (direction == EdgeAtom::Direction::BOTH || (direction == EdgeAtom::Direction::IN) != reversed) {
+        in_vertices.push_back(value.ValueVertex());
+      }
+      if (direction == EdgeAtom::Direction::BOTH || (direction == EdgeAtom::Direction::OUT) != reversed) {
+        out_vertices.push_back(value.ValueVertex());
+      }
+    };
+    while (input_batch_.size() < kExpandInputBatchSize && input_cursor_->Pull(frame, context)) {
+      utils::pmr::vector<TypedValue> row(input_batch_.get_allocator().GetMemoryResource());
+      row.reserve(input_symbols_->size());
+      for (const Symbol &symbol : *input_symbols_) row.emplace_back(frame[symbol]);
+      input_batch_.emplace_back(std::move(row));
+      add_vertex(frame[self_.input_symbol_], false);
+      if (self_.common_.existing_node) add_vertex(frame[self_.common_.node_symbol], true);
+    }
+    if (input_batch_.empty()) return false;
+    if (!in_vertices.empty()) context.db_accessor->PrefetchInEdges(in_vertices, self_.common_.edge_types);
+    if (!out_vertices.empty()) context.db_accessor->PrefetchOutEdges(out_vertices, self_.common_.edge_types);
+  }
+
+  auto row_it = input_batch_.front().begin();
+  for (const Symbol &symbol : *input_symbols_) {
+    if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+      context.frame_change_collector->ResetTrackingValue(symbol.name());
+    }
+    frame[symbol] = std::move(*row_it++);
+  }
+  input_batch_.pop_front();
+  return true;
+}
+
 bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   // Input Vertex could be null if it is created by a failed optional match. In
   // those cases we skip that input pull and continue with the next.
   while (true) {
-    if (!input_cursor_->Pull(frame, context)) return false;
+    if (!PullInput(frame, context)) return false;
 
     expansion_info_ = GetExpansionInfo(frame);
 
@@ -891,15 +1583,11 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       if (self_.common_.existing_node) {
         if (expansion_info_.existing_node) {
           auto existing_node = *expansion_info_.existing_node;
-          context.db_accessor->PrefetchInEdges(vertex);
-
           auto edges_result = UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node));
           in_edges_.emplace(edges_result.edges);
           num_expanded_first = edges_result.expanded_count;
         }
       } else {
-        context.db_accessor->PrefetchInEdges(vertex);
-
         auto edges_result = UnwrapEdgesResult(vertex.InEdges(self_.view_, self_.common_.edge_types));
         in_edges_.emplace(edges_result.edges);
         num_expanded_first = edges_result.expanded_count;
@@ -914,15 +1602,11 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       if (self_.common_.existing_node) {
         if (expansion_info_.existing_node) {
           auto existing_node = *expansion_info_.existing_node;
-          context.db_accessor->PrefetchOutEdges(vertex);
-
           auto edges_result = UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node));
           out_edges_.emplace(edges_result.edges);
           num_expanded_second = edges_result.expanded_count;
         }
       } else {
-        context.db_accessor->PrefetchOutEdges(vertex);
-
         auto edges_result = UnwrapEdgesResult(vertex.OutEdges(self_.view_, self_.common_.edge_types));
         out_edges_.emplace(edges_result.edges);
         num_expanded_second = edges_result.expanded_count;
@@ -1505,6 +2189,27 @@ class STShortestPathCursor : public query::plan::Cursor {
   }
 };
 
+namespace {
+
+// Number of chunks of the scanned vertices per parallel worker. Smaller chunks
+// balance the work of the workers better.
+constexpr size_t kChunksPerParallelWorker = 4;
+
+constexpr size_t kParallelWorkerMemoryBlockSize = 64UL * 1024UL;
+
+// A BFS level holding at least 1/kBfsBottomUpLevelRatio of all vertices is
+// expanded bottom-up, by looking for a parent in the level among the edges of
+// the unvisited vertices, which touches fewer edges than expanding the level.
+constexpr int64_t kBfsBottomUpLevelRatio = 14;
+
+// Smaller BFS levels aren't worth splitting between parallel workers.
+constexpr size_t kParallelBfsMinLevelSize = 1024;
+
+// Number of level vertices a parallel worker expands at a time.
+constexpr size_t kParallelBfsSliceSize = 256;
+
+}  // namespace
+
 class SingleSourceShortestPathCursor : public query::plan::Cursor {
  public:
   SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1531,29 +2236,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     auto expand_pair = [this, &evaluator, &frame, &context](EdgeAccessor edge, VertexAccessor vertex) {
       // if we already processed the given vertex it doesn't get expanded
       if (processed_.find(vertex) != processed_.end()) return;
-#ifdef MG_ENTERPRISE
-      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
-          !(context.auth_checker->Has(vertex, storage::View::OLD,
-                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
-            context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
-        return;
-      }
-#endif
-      frame[self_.filter_lambda_.inner_edge_symbol] = edge;
-      frame[self_.filter_lambda_.inner_node_symbol] = vertex;
-
-      if (self_.filter_lambda_.expression) {
-        TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
-        switch (result.type()) {
-          case TypedValue::Type::Null:
-            return;
-          case TypedValue::Type::Bool:
-            if (!result.ValueBool()) return;
-            break;
-          default:
-            throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
-        }
-      }
+      if (!CanExpand(edge, vertex, frame, evaluator, context)) return;
       to_visit_next_.emplace_back(edge, vertex);
       processed_.emplace(vertex, edge);
     };
@@ -1578,7 +2261,13 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     while (true) {
       AbortCheck(context);
       // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
+      if (to_visit_current_.empty()) {
+        to_visit_current_.swap(to_visit_next_);
+        if (!to_visit_current_.empty()) {
+          ++current_depth_;
+          level_expanded_ = current_depth_ < upper_bound_ && ExpandLevel(frame, context);
+        }
+      }
 
       // if current is still empty, it means both are empty, so pull from
       // input
@@ -1588,6 +2277,8 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         to_visit_current_.clear();
         to_visit_next_.clear();
         processed_.clear();
+        current_depth_ = 0;
+        level_expanded_ = false;
 
         const auto &vertex_value = frame[self_.input_symbol_];
         // it is possible that the vertex is Null due to optional matching
@@ -1629,8 +2320,11 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         edge_list.emplace_back(previous_edge.value());
       }
 
-      // expand only if what we've just expanded is less then max depth
-      if (static_cast<int64_t>(edge_list.size()) < upper_bound_) expand_from_vertex(expansion.second);
+      // expand only if what we've just expanded is less then max depth and
+      // the whole level wasn't expanded already
+      if (!level_expanded_ && static_cast<int64_t>(edge_list.size()) < upper_bound_) {
+        expand_from_vertex(expansion.second);
+      }
 
       if (static_cast<int64_t>(edge_list.size()) < lower_bound_) continue;
 
@@ -1651,6 +2345,8 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    current_depth_ = 0;
+    level_expanded_ = false;
   }
 
  private:
@@ -1662,6 +2358,11 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   int64_t lower_bound_{-1};
   int64_t upper_bound_{-1};
 
+  // Depth of the expansions in to_visit_current_.
+  int64_t current_depth_{0};
+  // True if to_visit_next_ already holds all expansions from the current depth.
+  bool level_expanded_{false};
+
   // maps vertices to the edge they got expanded from. it is an optional
   // edge because the root does not get expanded from anything.
   // contains visited vertices as well as those scheduled to be visited.
@@ -1669,6 +2370,169 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
   // edge/vertex pairs we have yet to visit, for current and next depth
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_current_;
   utils::pmr::vector<std::pair<EdgeAccessor, VertexAccessor>> to_visit_next_;
+
+  // Checks if the given (edge, vertex) pair satisfies the "where" condition.
+  bool CanExpand(const EdgeAccessor &edge, const VertexAccessor &vertex, Frame &frame, ExpressionEvaluator &evaluator,
+                 const ExecutionContext &context) const {
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+        !(context.auth_checker->Has(vertex, storage::View::OLD,
+                                    memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+          context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+      return false;
+    }
+#endif
+    frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+    frame[self_.filter_lambda_.inner_node_symbol] = vertex;
+
+    if (self_.filter_lambda_.expression) {
+      TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
+      switch (result.type()) {
+        case TypedValue::Type::Null:
+          return false;
+        case TypedValue::Type::Bool:
+          return result.ValueBool();
+        default:
+          throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Expands all expansions in to_visit_current_ at once into to_visit_next_.
+   * A level holding a large part of the graph is expanded bottom-up, by
+   * checking the edges of the unvisited vertices for a parent in the level.
+   * Large levels are split between the parallel execution threads, whose
+   * expansions are merged into processed_ in the order of the workers.
+   *
+   * @return false if the level should be expanded one vertex at a time.
+   */
+  bool ExpandLevel(Frame &frame, ExecutionContext &context) {
+    auto *dba = context.db_accessor;
+    if (dba->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) return false;
+    bool parallel = context.parallel_execution_pool && context.parallel_workers > 1 && !context.is_profile_query &&
+                    !context.vertex_chunks;
+#ifdef MG_ENTERPRISE
+    if (context.auth_checker) parallel = false;
+#endif
+    const auto level_size = to_visit_current_.size();
+    const bool bottom_up = static_cast<int64_t>(level_size) * kBfsBottomUpLevelRatio >= dba->VerticesCount();
+    if (!bottom_up && (!parallel || level_size < kParallelBfsMinLevelSize)) return false;
+
+    auto *mem = processed_.get_allocator().GetMemoryResource();
+    utils::pmr::unordered_set<VertexAccessor> level(mem);
+    std::vector<VerticesIterable> chunks;
+    size_t num_items = (level_size + kParallelBfsSliceSize - 1) / kParallelBfsSliceSize;
+    if (bottom_up) {
+      for (const auto &expansion : to_visit_current_) level.insert(expansion.second);
+      if (parallel) {
+        chunks = dba->ChunkedVertices(storage::View::OLD, context.parallel_workers * kChunksPerParallelWorker);
+      }
+      if (chunks.empty()) chunks.emplace_back(dba->Vertices(storage::View::OLD));
+      num_items = chunks.size();
+    }
+
+    struct Worker {
+      Worker(const ExecutionContext &parent, Frame &parent_frame)
+          : memory(kParallelWorkerMemoryBlockSize), frame(parent.symbol_table.max_position(), &memory) {
+        frame.elems().assign(parent_frame.elems().begin(), parent_frame.elems().end());
+        evaluation_context.memory = &memory;
+        evaluation_context.timestamp = parent.evaluation_context.timestamp;
+        evaluation_context.parameters = parent.evaluation_context.parameters;
+        evaluation_context.properties = parent.evaluation_context.properties;
+        evaluation_context.labels = parent.evaluation_context.labels;
+      }
+
+      utils::MonotonicBufferResource memory;
+      Frame frame;
+      EvaluationContext evaluation_context;
+      std::vector<std::pair<EdgeAccessor, VertexAccessor>> expansions;
+      std::exception_ptr error;
+    };
+    const auto num_workers = parallel ? std::min(context.parallel_workers, num_items) : 1;
+    std::vector<std::unique_ptr<Worker>> workers;
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers.push_back(std::make_unique<Worker>(context, frame));
+    }
+
+    const auto direction = self_.common_.direction;
+    const auto &edge_types = self_.common_.edge_types;
+    std::atomic<size_t> next_item{0};
+    // The workers only read processed_, which is merged into after all of
+    // them are done.
+    auto work = [&](size_t i) {
+      auto &worker = *workers[i];
+      try {
+        ExpressionEvaluator evaluator(&worker.frame, context.symbol_table, worker.evaluation_context, dba,
+                                      storage::View::OLD);
+        auto try_expand = [&](const EdgeAccessor &edge, const VertexAccessor &vertex) {
+          if (!CanExpand(edge, vertex, worker.frame, evaluator, context)) return false;
+          worker.expansions.emplace_back(edge, vertex);
+          return true;
+        };
+        for (auto item = next_item++; item < num_items; item = next_item++) {
+          AbortCheck(context);
+          if (bottom_up) {
+            for (const auto &vertex : chunks[item]) {
+              if (processed_.contains(vertex)) continue;
+              bool found = false;
+              if (direction != EdgeAtom::Direction::IN) {
+                for (const auto &edge : UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, edge_types)).edges) {
+                  if (level.contains(edge.From()) && try_expand(edge, vertex)) {
+                    found = true;
+                    break;
+                  }
+                }
+              }
+              if (!found && direction != EdgeAtom::Direction::OUT) {
+                for (const auto &edge : UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, edge_types)).edges) {
+                  if (level.contains(edge.To()) && try_expand(edge, vertex)) break;
+                }
+              }
+            }
+            continue;
+          }
+          const auto end = std::min(level_size, (item + 1) * kParallelBfsSliceSize);
+          for (auto pos = item * kParallelBfsSliceSize; pos < end; ++pos) {
+            const auto &vertex = to_visit_current_[pos].second;
+            if (direction != EdgeAtom::Direction::IN) {
+              for (const auto &edge : UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, edge_types)).edges) {
+                if (!processed_.contains(edge.To())) try_expand(edge, edge.To());
+              }
+            }
+            if (direction != EdgeAtom::Direction::OUT) {
+              for (const auto &edge : UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, edge_types)).edges) {
+                if (!processed_.contains(edge.From())) try_expand(edge, edge.From());
+              }
+            }
+          }
+        }
+      } catch (...) {
+        worker.error = std::current_exception();
+      }
+    };
+    if (parallel) {
+      // The workers only read the transaction, so its caches mustn't change.
+      dba->FreezeTransactionCaches(true);
+      utils::OnScopeExit unfreeze{[dba] { dba->FreezeTransactionCaches(false); }};
+      utils::RunParallelWorkers(*context.parallel_execution_pool, num_workers, work);
+    } else {
+      work(0);
+    }
+    for (const auto &worker : workers) {
+      if (worker->error) std::rethrow_exception(worker->error);
+    }
+
+    // A vertex reached from several level vertices is expanded only once.
+    for (const auto &worker : workers) {
+      for (const auto &[edge, vertex] : worker->expansions) {
+        if (processed_.emplace(vertex, edge).second) to_visit_next_.emplace_back(edge, vertex);
+      }
+    }
+    return true;
+  }
 };
 
 namespace {
@@ -1701,7 +2565,8 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         total_cost_(mem),
         previous_(mem),
         yielded_vertices_(mem),
-        pq_(mem) {}
+        pq_(mem),
+        weight_property_(FindWeightProperty(*self_.weight_lambda_)) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("ExpandWeightedShortestPath");
@@ -1734,10 +2599,18 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
         if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
       }
 
-      frame[self_.weight_lambda_->inner_edge_symbol] = edge;
-      frame[self_.weight_lambda_->inner_node_symbol] = vertex;
-
-      TypedValue current_weight = self_.weight_lambda_->expression->Accept(evaluator);
+      TypedValue current_weight = std::invoke([&] {
+        if (weight_property_) {
+          auto property = context.evaluation_context.properties[weight_property_->property.ix];
+          auto maybe_weight = weight_property_->of_edge ? edge.GetProperty(storage::View::OLD, property)
+                                                        : vertex.GetProperty(storage::View::OLD, property);
+          // Errors are reported by the evaluator.
+          if (maybe_weight.HasValue()) return TypedValue(*maybe_weight, memory);
+        }
+        frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+        frame[self_.weight_lambda_->inner_node_symbol] = vertex;
+        return self_.weight_lambda_->expression->Accept(evaluator);
+      });
 
       CheckWeightType(current_weight, memory);
 
@@ -1946,6 +2819,28 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
                       PriorityQueueComparator>
       pq_;
 
+  // A property of the expanded edge or vertex which is the whole weight
+  // lambda, so the weight is read without going through the evaluator.
+  struct WeightProperty {
+    PropertyIx property;
+    bool of_edge;
+  };
+  std::optional<WeightProperty> weight_property_;
+
+  static std::optional<WeightProperty> FindWeightProperty(const ExpansionLambda &weight_lambda) {
+    auto *lookup = utils::Downcast<PropertyLookup>(weight_lambda.expression);
+    if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return std::nullopt;
+    auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+    if (!identifier) return std::nullopt;
+    if (identifier->symbol_pos_ == weight_lambda.inner_edge_symbol.position()) {
+      return WeightProperty{lookup->property_, true};
+    }
+    if (identifier->symbol_pos_ == weight_lambda.inner_node_symbol.position()) {
+      return WeightProperty{lookup->property_, false};
+    }
+    return std::nullopt;
+  }
+
   void ClearQueue() {
     while (!pq_.empty()) pq_.pop();
   }
@@ -2444,14 +3339,143 @@ static std::vector<UniqueCursorPtr> MakeCursorVector(const std::vector<std::shar
   return cursors;
 }
 
+namespace {
+
+// Splits the filter expression into its conjuncts. Those comparing a property
+// of a symbol with a constant go into `property_equalities`.
+void SplitFilterConjuncts(Expression *expression, std::vector<Filter::PropertyEquality> *property_equalities,
+                          std::vector<Expression *> *conjuncts) {
+  if (auto *and_op = utils::Downcast<AndOperator>(expression)) {
+    SplitFilterConjuncts(and_op->expression1_, property_equalities, conjuncts);
+    SplitFilterConjuncts(and_op->expression2_, property_equalities, conjuncts);
+    return;
+  }
+  if (auto *equal = utils::Downcast<EqualOperator>(expression)) {
+    for (auto [lhs, rhs] : {std::pair{equal->expression1_, equal->expression2_},
+                            std::pair{equal->expression2_, equal->expression1_}}) {
+      auto *lookup = FindIdentifierPropertyLookup(lhs);
+      if (!lookup || !IsConstant(rhs)) continue;
+      property_equalities->push_back({equal, static_cast<Identifier *>(lookup->expression_), lookup->property_, rhs});
+      return;
+    }
+  }
+  conjuncts->push_back(expression);
+}
+
+// Returns the value compared by the property equality, or std::nullopt if the
+// equality has to be evaluated with the expression evaluator.
+std::optional<storage::PropertyValue> EvaluateEqualityValue(const Filter::PropertyEquality &equality,
+                                                            const EvaluationContext &context) {
+  auto value = [&] {
+    if (auto *literal = utils::Downcast<PrimitiveLiteral>(equality.value)) return literal->value_;
+    return context.parameters.AtTokenPosition(static_cast<ParameterLookup *>(equality.value)->token_position_);
+  }();
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Null:
+    case storage::PropertyValue::Type::Bool:
+    case storage::PropertyValue::Type::Int:
+    case storage::PropertyValue::Type::Double:
+    case storage::PropertyValue::Type::String:
+      return value;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Compares the property of the vertex or edge without converting it to a
+// `TypedValue`. Returns std::nullopt for other values and on errors, which
+// the expression evaluator reports.
+std::optional<bool> IsPropertyEqual(const TypedValue &object, storage::PropertyId property,
+                                    const storage::PropertyValue &value) {
+  auto to_optional = [](const storage::Result<bool> &result) -> std::optional<bool> {
+    if (result.HasError()) return std::nullopt;
+    return *result;
+  };
+  switch (object.type()) {
+    case TypedValue::Type::Null:
+      return false;
+    case TypedValue::Type::Vertex:
+      if (value.IsNull()) return false;
+      return to_optional(object.ValueVertex().IsPropertyEqual(storage::View::OLD, property, value));
+    case TypedValue::Type::Edge:
+      if (value.IsNull()) return false;
+      return to_optional(object.ValueEdge().IsPropertyEqual(storage::View::OLD, property, value));
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace
+
+namespace {
+
+// Makes the cursor of the input of the filter. Scans of the vertices which
+// the storage can filter get the filter expression.
+UniqueCursorPtr MakeFilterInputCursor(const Filter &filter, utils::MemoryResource *mem) {
+  const auto &input = *filter.input_;
+  if (input.GetTypeInfo() == ScanAll::kType) {
+    return static_cast<const ScanAll &>(input).MakeFilteredCursor(mem, filter.expression_);
+  }
+  if (input.GetTypeInfo() == ScanAllByLabelPropertyRange::kType) {
+    return static_cast<const ScanAllByLabelPropertyRange &>(input).MakeFilteredCursor(mem, filter.expression_);
+  }
+  if (input.GetTypeInfo() == ScanAllByLabelPropertyValue::kType) {
+    return static_cast<const ScanAllByLabelPropertyValue &>(input).MakeFilteredCursor(mem, filter.expression_);
+  }
+  return input.MakeCursor(mem);
+}
+
+}  // namespace
+
 Filter::FilterCursor::FilterCursor(const Filter &self, utils::MemoryResource *mem)
     : self_(self),
-      input_cursor_(self_.input_->MakeCursor(mem)),
-      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)) {}
+      input_cursor_(MakeFilterInputCursor(self_, mem)),
+      pattern_filter_cursors_(MakeCursorVector(self_.pattern_filters_, mem)) {
+  std::vector<Expression *> conjuncts;
+  SplitFilterConjuncts(self_.expression_, &property_equalities_, &conjuncts);
+  conjuncts_.reserve(conjuncts.size());
+  for (auto *conjunct : conjuncts) conjuncts_.emplace_back(conjunct);
+}
+
+Filter::FilterCursor::~FilterCursor() = default;
+
+bool Filter::FilterCursor::EvaluateConjuncts(Frame &frame, ExecutionContext &context,
+                                             ExpressionEvaluator &evaluator) {
+  if (!equality_values_) {
+    equality_values_.emplace();
+    equality_values_->reserve(property_equalities_.size());
+    for (const auto &equality : property_equalities_) {
+      equality_values_->push_back(EvaluateEqualityValue(equality, context.evaluation_context));
+    }
+  }
+  // The property equalities are checked first, directly against the property
+  // stores of the vertices and edges, e.g. those just expanded by the input.
+  for (size_t i = 0; i < property_equalities_.size(); ++i) {
+    const auto &equality = property_equalities_[i];
+    std::optional<bool> equal;
+    if (const auto &value = (*equality_values_)[i]) {
+      equal = IsPropertyEqual(frame[context.symbol_table.at(*equality.identifier)],
+                              context.evaluation_context.properties[equality.property.ix], *value);
+    }
+    if (!equal) equal = EvaluateFilter(evaluator, equality.expression);
+    if (!*equal) return false;
+  }
+  return std::all_of(conjuncts_.begin(), conjuncts_.end(),
+                     [&](CompiledExpression &conjunct) { return EvaluateFilter(evaluator, conjunct); });
+}
+
+void Filter::FilterCursor::LookUpObservedRows(ExecutionContext &context) {
+  if (observed_rows_looked_up_) return;
+  observed_rows_looked_up_ = true;
+  if (!context.observed_filters) return;
+  auto it = context.observed_filters->find(&self_);
+  if (it != context.observed_filters->end()) observed_rows_ = &it->second;
+}
 
 bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Filter");
 
+  LookUpObservedRows(context);
   // Like all filters, newly set values should not affect filtering of old
   // nodes and edges.
   ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
@@ -2460,14 +3484,48 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (observed_rows_) ++observed_rows_->input;
+    if (EvaluateConjuncts(frame, context, evaluator)) {
+      if (observed_rows_) ++observed_rows_->passed;
+      return true;
+    }
   }
   return false;
 }
 
+bool Filter::FilterCursor::PullBatch(Frame &frame, FrameBlock &block, ExecutionContext &context) {
+  // Pattern filters read the frame beyond the symbols of the expression.
+  if (!pattern_filter_cursors_.empty()) return Cursor::PullBatch(frame, block, context);
+
+  SCOPED_PROFILE_OP("Filter");
+
+  LookUpObservedRows(context);
+  if (!input_block_) {
+    input_block_.emplace(UsedSymbols(context.symbol_table, {self_.expression_}, block.Symbols()), block.Capacity(),
+                         frame.GetMemoryResource());
+  }
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD, context.frame_change_collector);
+  // The input block has the same capacity, so it always fits into one block.
+  while (block.Empty()) {
+    input_block_->Clear();
+    if (!input_cursor_->PullBatch(frame, *input_block_, context)) return false;
+    for (size_t row = 0; row < input_block_->Size(); ++row) {
+      input_block_->RestoreRow(row, frame, context.frame_change_collector);
+      if (EvaluateConjuncts(frame, context, evaluator)) block.MoveRow(frame);
+    }
+    if (observed_rows_) observed_rows_->input += input_block_->Size();
+  }
+  if (observed_rows_) observed_rows_->passed += block.Size();
+  return true;
+}
+
 void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
+void Filter::FilterCursor::Reset() {
+  input_cursor_->Reset();
+  if (input_block_) input_block_->Clear();
+}
 
 EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
     : input_(input), output_symbol_(output_symbol) {}
@@ -2480,9 +3538,129 @@ UniqueCursorPtr EvaluatePatternFilter::MakeCursor(utils::MemoryResource *mem) co
   return MakeUniqueCursorPtr<EvaluatePatternFilterCursor>(mem, *this, mem);
 }
 
+namespace {
+
+// Returns the input of a pattern filter input which is a Limit of at least one
+// row. Returns nullptr for other inputs.
+const LogicalOperator *FindLimitedInput(const LogicalOperator &input) {
+  if (input.GetTypeInfo() != Limit::kType) return nullptr;
+  const auto &limit = static_cast<const Limit &>(input);
+  const auto *count = utils::Downcast<PrimitiveLiteral>(limit.expression_);
+  if (!count || !count->value_.IsInt() || count->value_.ValueInt() < 1) return nullptr;
+  return limit.input_.get();
+}
+
+// Returns the Expand of a pattern filter input which only checks if the input
+// node of the Expand has edges, i.e. the input is a Limit of an Expand to a new
+// node from Once. Returns nullptr for other inputs.
+const Expand *FindEdgesCheck(const LogicalOperator &input) {
+  const auto *limited = FindLimitedInput(input);
+  if (!limited || limited->GetTypeInfo() != Expand::kType) return nullptr;
+  const auto &expand = static_cast<const Expand &>(*limited);
+  if (expand.common_.existing_node || !expand.input_ || expand.input_->GetTypeInfo() != Once::kType) return nullptr;
+  return &expand;
+}
+
+// Checks if the `expand` would expand any edge of its input node, without
+// creating accessors for the edges.
+bool HasEdgesToExpand(const Expand &expand, const Frame &frame, ExecutionContext &context) {
+  const auto &input = frame[expand.input_symbol_];
+  if (input.IsNull()) return false;
+  ExpectType(expand.input_symbol_, input, TypedValue::Type::Vertex);
+  const auto &vertex = input.ValueVertex();
+  const auto direction = expand.common_.direction;
+  if (direction != EdgeAtom::Direction::OUT) {
+    context.db_accessor->PrefetchInEdges(vertex);
+    if (UnwrapEdgesResult(vertex.HasInEdges(expand.view_, expand.common_.edge_types))) return true;
+  }
+  if (direction != EdgeAtom::Direction::IN) {
+    context.db_accessor->PrefetchOutEdges(vertex);
+    if (UnwrapEdgesResult(vertex.HasOutEdges(expand.view_, expand.common_.edge_types))) return true;
+  }
+  return false;
+}
+
+// Returns the ExpandVariable of a pattern filter input which only checks if a
+// node is reachable over a variable length path, i.e. the input is a Limit of a
+// depth-first ExpandVariable from Once. Returns nullptr for other inputs.
+const ExpandVariable *FindReachabilityCheck(const LogicalOperator &input) {
+  const auto *limited = FindLimitedInput(input);
+  if (!limited || limited->GetTypeInfo() != ExpandVariable::kType) return nullptr;
+  const auto &expand = static_cast<const ExpandVariable &>(*limited);
+  if (expand.type_ != EdgeAtom::Type::DEPTH_FIRST || !expand.input_ || expand.input_->GetTypeInfo() != Once::kType) {
+    return nullptr;
+  }
+  return &expand;
+}
+
+// Checks if the depth-first `expand` would yield any path, by searching from
+// its input node breadth-first and expanding each reached vertex only once.
+// The shortest path to a vertex never repeats an edge, so the edge uniqueness
+// of the expansion holds for it. That doesn't hold for paths with a minimum
+// length above one or for cycles back to the input node, for which nullopt is
+// returned and the paths have to be enumerated.
+std::optional<bool> IsReachable(const ExpandVariable &expand, Frame &frame, ExecutionContext &context) {
+  const auto &input = frame[expand.input_symbol_];
+  if (input.IsNull()) return false;
+  ExpectType(expand.input_symbol_, input, TypedValue::Type::Vertex);
+  const auto source = input.ValueVertex();
+
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD);
+  auto calc_bound = [&evaluator](auto &bound) {
+    auto value = EvaluateInt(&evaluator, bound, "Variable expansion bound");
+    if (value < 0) throw QueryRuntimeException("Variable expansion bound must be a non-negative integer.");
+    return value;
+  };
+  const auto lower_bound = expand.lower_bound_ ? calc_bound(expand.lower_bound_) : 1;
+  const auto upper_bound =
+      expand.upper_bound_ ? calc_bound(expand.upper_bound_) : std::numeric_limits<int64_t>::max();
+  if (lower_bound != 1) return std::nullopt;
+
+  std::optional<VertexAccessor> target;
+  if (expand.common_.existing_node) {
+    const auto &existing_node = frame[expand.common_.node_symbol];
+    if (existing_node.IsNull()) return std::nullopt;
+    ExpectType(expand.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
+    target = existing_node.ValueVertex();
+    if (*target == source) return std::nullopt;
+  }
+
+  auto *memory = context.evaluation_context.memory;
+  utils::pmr::unordered_set<VertexAccessor> visited(memory);
+  utils::pmr::vector<VertexAccessor> frontier(memory);
+  utils::pmr::vector<VertexAccessor> next_frontier(memory);
+  visited.insert(source);
+  frontier.push_back(source);
+  for (int64_t depth = 0; depth < upper_bound && !frontier.empty(); ++depth) {
+    for (const auto &vertex : frontier) {
+      AbortCheck(context);
+      for (const auto &[edge, direction] : ExpandFromVertex(vertex, expand.common_.direction,
+                                                            expand.common_.edge_types, memory, context.db_accessor)) {
+        auto other = direction == EdgeAtom::Direction::IN ? edge.From() : edge.To();
+        if (expand.filter_lambda_.expression) {
+          frame[expand.filter_lambda_.inner_edge_symbol] = edge;
+          frame[expand.filter_lambda_.inner_node_symbol] = other;
+          if (!EvaluateFilter(evaluator, expand.filter_lambda_.expression)) continue;
+        }
+        if (!target || other == *target) return true;
+        if (visited.insert(other).second) next_frontier.push_back(other);
+      }
+    }
+    frontier.swap(next_frontier);
+    next_frontier.clear();
+  }
+  return false;
+}
+
+}  // namespace
+
 EvaluatePatternFilter::EvaluatePatternFilterCursor::EvaluatePatternFilterCursor(const EvaluatePatternFilter &self,
                                                                                 utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self_.input_->MakeCursor(mem)) {}
+    : self_(self),
+      input_cursor_(self_.input_->MakeCursor(mem)),
+      edges_check_(FindEdgesCheck(*self_.input_)),
+      reachability_check_(FindReachabilityCheck(*self_.input_)) {}
 
 std::vector<Symbol> EvaluatePatternFilter::ModifiedSymbols(const SymbolTable &table) const {
   return input_->ModifiedSymbols(table);
@@ -2491,6 +3669,24 @@ std::vector<Symbol> EvaluatePatternFilter::ModifiedSymbols(const SymbolTable &ta
 bool EvaluatePatternFilter::EvaluatePatternFilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("EvaluatePatternFilter");
 
+  // Profiling reports the operators of the input, and the fine grained
+  // privileges are checked on each expanded edge.
+  bool check_directly = !context.is_profile_query;
+#ifdef MG_ENTERPRISE
+  if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) check_directly = false;
+#endif
+  if (check_directly && edges_check_) {
+    frame[self_.output_symbol_] =
+        TypedValue(HasEdgesToExpand(*edges_check_, frame, context), context.evaluation_context.memory);
+    return true;
+  }
+  if (check_directly && reachability_check_) {
+    if (auto reachable = IsReachable(*reachability_check_, frame, context)) {
+      frame[self_.output_symbol_] = TypedValue(*reachable, context.evaluation_context.memory);
+      return true;
+    }
+  }
+
   input_cursor_->Reset();
 
   frame[self_.output_symbol_] = TypedValue(input_cursor_->Pull(frame, context), context.evaluation_context.memory);
@@ -2544,9 +3740,44 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(Frame &frame, FrameBlock &block, ExecutionContext &context) {
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  if (!input_block_) {
+    std::vector<Expression *> expressions;
+    expressions.reserve(self_.named_expressions_.size());
+    for (auto *named_expr : self_.named_expressions_) {
+      expressions.push_back(named_expr->expression_);
+    }
+    // The caller may also need the symbols from before the projection, e.g.
+    // for ORDER BY on a value which isn't returned.
+    input_block_.emplace(UsedSymbols(context.symbol_table, expressions, block.Symbols()), block.Capacity(),
+                         frame.GetMemoryResource());
+  }
+  input_block_->Clear();
+  if (!input_cursor_->PullBatch(frame, *input_block_, context)) return false;
+
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::NEW, context.frame_change_collector);
+  for (size_t row = 0; row < input_block_->Size(); ++row) {
+    input_block_->RestoreRow(row, frame, context.frame_change_collector);
+    for (auto *named_expr : self_.named_expressions_) {
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+      }
+      named_expr->Accept(evaluator);
+    }
+    block.MoveRow(frame);
+  }
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
-void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
+void Produce::ProduceCursor::Reset() {
+  input_cursor_->Reset();
+  if (input_block_) input_block_->Clear();
+}
 
 Delete::Delete(const std::shared_ptr<LogicalOperator> &input_, const std::vector<Expression *> &expressions,
                bool detach_)
@@ -2716,7 +3947,9 @@ bool SetProperty::SetPropertyCursor::Pull(Frame &frame, ExecutionContext &contex
 #endif
       auto old_value = PropsSetChecked(&lhs.ValueVertex(), self_.property_, rhs);
       context.execution_stats[ExecutionStats::Key::UPDATED_PROPERTIES] += 1;
-      if (context.trigger_context_collector) {
+      // The values are copied only if a trigger is interested in the change.
+      if (context.trigger_context_collector &&
+          context.trigger_context_collector->ShouldRegisterObjectPropertyChange<VertexAccessor>()) {
         // rhs cannot be moved because it was created with the allocator that is only valid during current pull
         context.trigger_context_collector->RegisterSetObjectProperty(lhs.ValueVertex(), self_.property_,
                                                                      TypedValue{std::move(old_value)}, TypedValue{rhs});
@@ -2732,7 +3965,8 @@ bool SetProperty::SetPropertyCursor::Pull(Frame &frame, ExecutionContext &contex
 #endif
       auto old_value = PropsSetChecked(&lhs.ValueEdge(), self_.property_, rhs);
       context.execution_stats[ExecutionStats::Key::UPDATED_PROPERTIES] += 1;
-      if (context.trigger_context_collector) {
+      if (context.trigger_context_collector &&
+          context.trigger_context_collector->ShouldRegisterObjectPropertyChange<EdgeAccessor>()) {
         // rhs cannot be moved because it was created with the allocator that is only valid
         // during current pull
         context.trigger_context_collector->RegisterSetObjectProperty(lhs.ValueEdge(), self_.property_,
@@ -3073,7 +4307,9 @@ bool RemoveProperty::RemovePropertyCursor::Pull(Frame &frame, ExecutionContext &
       }
     }
 
-    if (context.trigger_context_collector) {
+    using TRecordAccessor = std::remove_pointer_t<decltype(record)>;
+    if (context.trigger_context_collector &&
+        context.trigger_context_collector->ShouldRegisterObjectPropertyChange<TRecordAccessor>()) {
       context.trigger_context_collector->RegisterRemovedObjectProperty(*record, property,
                                                                        TypedValue(std::move(*maybe_old_value)));
     }
@@ -3323,6 +4559,7 @@ class AccumulateCursor : public Cursor {
         cache_.emplace_back(std::move(row));
       }
       pulled_all_input_ = true;
+      ObserveCardinality(context, self_, cache_.size());
       cache_it_ = cache_.begin();
 
       if (self_.advance_command_) dba.AdvanceCommand();
@@ -3400,20 +4637,124 @@ TypedValue DefaultAggregationOpValue(const Aggregate::Element &element, utils::M
       return TypedValue(query::Graph(memory));
   }
 }
+
+// Returns the scan whose vertices may be split into chunks which are processed
+// by the input of an aggregation in parallel, or `nullptr` if the input can't
+// be executed in parallel. The input may only filter and expand the vertices
+// of a scan of all vertices or of the vertices with a label.
+const ScanAll *FindParallelScan(const LogicalOperator &input) {
+  const auto *op = &input;
+  while (op->GetTypeInfo() == Filter::kType || op->GetTypeInfo() == Expand::kType) {
+    if (op->GetTypeInfo() == Filter::kType && !static_cast<const Filter *>(op)->pattern_filters_.empty()) {
+      return nullptr;
+    }
+    op = op->input().get();
+  }
+  if (op->GetTypeInfo() != ScanAll::kType && op->GetTypeInfo() != ScanAllByLabel::kType) return nullptr;
+  const auto *scan = static_cast<const ScanAll *>(op);
+  if (scan->input()->GetTypeInfo() != Once::kType) return nullptr;
+  return scan;
+}
+
+// Aggregations whose partial results of the parallel workers can be merged.
+bool IsMergeableAggregation(const Aggregate::Element &element) {
+  if (element.distinct) return false;
+  switch (element.op) {
+    case Aggregation::Op::COUNT:
+    case Aggregation::Op::SUM:
+    case Aggregation::Op::AVG:
+    case Aggregation::Op::MIN:
+    case Aggregation::Op::MAX:
+      return true;
+    case Aggregation::Op::COLLECT_LIST:
+    case Aggregation::Op::COLLECT_MAP:
+    case Aggregation::Op::PROJECT:
+      return false;
+  }
+}
+
+// A count of the vertices with a label or of the edges of a type, which the
+// storage may keep.
+struct StorageCount {
+  std::optional<storage::LabelId> label;
+  std::optional<storage::EdgeTypeId> edge_type;
+};
+
+// Returns the count kept by the storage which an aggregation would compute,
+// if it only counts the rows of a scan of the vertices with a label or of an
+// expansion of the edges of a single type from all vertices.
+std::optional<StorageCount> FindStorageCount(const Aggregate &aggregate) {
+  if (!aggregate.group_by_.empty() || !aggregate.remember_.empty()) return std::nullopt;
+  const auto &input = *aggregate.input_;
+  StorageCount count;
+  // the symbols which are set by each row of the input
+  std::vector<Symbol> symbols;
+  if (input.GetTypeInfo() == ScanAllByLabel::kType) {
+    const auto &scan = static_cast<const ScanAllByLabel &>(input);
+    if (scan.input_->GetTypeInfo() != Once::kType) return std::nullopt;
+    count.label = scan.label_;
+    symbols = {scan.output_symbol_};
+  } else if (input.GetTypeInfo() == Expand::kType) {
+    const auto &expand = static_cast<const Expand &>(input);
+    if (expand.common_.existing_node || expand.common_.direction == EdgeAtom::Direction::BOTH ||
+        expand.common_.edge_types.size() != 1 || expand.input_->GetTypeInfo() != ScanAll::kType) {
+      return std::nullopt;
+    }
+    const auto &scan = static_cast<const ScanAll &>(*expand.input_);
+    if (scan.input_->GetTypeInfo() != Once::kType || scan.output_symbol_ != expand.input_symbol_) return std::nullopt;
+    count.edge_type = expand.common_.edge_types[0];
+    symbols = {scan.output_symbol_, expand.common_.node_symbol, expand.common_.edge_symbol};
+  } else if (input.GetTypeInfo() == ScanAllByEdgeType::kType) {
+    const auto &scan = static_cast<const ScanAllByEdgeType &>(input);
+    if (scan.property_ || scan.common_.edge_types.size() != 1 || scan.input_->GetTypeInfo() != Once::kType) {
+      return std::nullopt;
+    }
+    count.edge_type = scan.common_.edge_types[0];
+    symbols = {scan.input_symbol_, scan.common_.node_symbol, scan.common_.edge_symbol};
+  } else {
+    return std::nullopt;
+  }
+  for (const auto &element : aggregate.aggregations_) {
+    if (element.op != Aggregation::Op::COUNT || element.distinct) return std::nullopt;
+    // count(*) has no value, and the scanned symbols are never null
+    if (!element.value) continue;
+    const auto *identifier = utils::Downcast<Identifier>(element.value);
+    if (!identifier || std::none_of(symbols.begin(), symbols.end(), [identifier](const Symbol &symbol) {
+          return symbol.position() == identifier->symbol_pos_;
+        })) {
+      return std::nullopt;
+    }
+  }
+  return count;
+}
 }  // namespace
 
 class AggregateCursor : public Cursor {
  public:
   AggregateCursor(const Aggregate &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), aggregation_(mem) {}
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        aggregation_(mem),
+        int_groups_(mem),
+        string_groups_(mem),
+        vertex_groups_(mem),
+        partition_aggregation_(utils::NewDeleteResource()),
+        storage_count_(FindStorageCount(self_)) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP_BY_REF(self_);
 
+    if (!pulled_all_input_ && storage_count_ && PullStorageCount(frame, context)) {
+      pulled_all_input_ = true;
+      return true;
+    }
+
     if (!pulled_all_input_) {
       ProcessAll(&frame, &context);
       pulled_all_input_ = true;
-      aggregation_it_ = aggregation_.begin();
+      // the spilled partitions are output first
+      output_ = partitions_.empty() ? &aggregation_ : &partition_aggregation_;
+      aggregation_it_ = output_->begin();
 
       if (aggregation_.empty()) {
         auto *pull_memory = context.evaluation_context.memory;
@@ -3436,7 +4777,9 @@ class AggregateCursor : public Cursor {
       }
     }
 
-    if (aggregation_it_ == aggregation_.end()) return false;
+    while (aggregation_it_ == output_->end()) {
+      if (!AggregateNextPartition(frame, context)) return false;
+    }
 
     // place aggregation values on the frame
     auto aggregation_values_it = aggregation_it_->second.values_.begin();
@@ -3456,6 +4799,14 @@ class AggregateCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     aggregation_.clear();
+    int_groups_.clear();
+    string_groups_.clear();
+    vertex_groups_.clear();
+    partition_aggregation_.clear();
+    partitions_.clear();
+    groups_bytes_ = 0;
+    next_partition_ = 0;
+    output_ = &aggregation_;
     aggregation_it_ = aggregation_.begin();
     pulled_all_input_ = false;
   }
@@ -3498,11 +4849,62 @@ class AggregateCursor : public Cursor {
                             // custom equality
                             TypedValueVectorEqual>
       aggregation_;
+  // The groups of the aggregations grouped by a single value, indexed by the
+  // raw value so that the rows of the common groups are aggregated without
+  // building and hashing a group-by vector.
+  template <class TKey>
+  using GroupIndex = absl::flat_hash_map<TKey, AggregationValue *, absl::Hash<TKey>, std::equal_to<TKey>,
+                                         utils::Allocator<std::pair<const TKey, AggregationValue *>>>;
+  GroupIndex<int64_t> int_groups_;
+  // the strings are the group-by values in the aggregation_
+  GroupIndex<std::string_view> string_groups_;
+  GroupIndex<uint64_t> vertex_groups_;
+  // When the input rows may be spilled, the groups stop being added to the
+  // aggregation_ once their approximate memory crosses the threshold. The rows
+  // of the other groups are spilled into the partitions_ by the hashes of
+  // their groups, and each partition is aggregated in the
+  // partition_aggregation_ after the input is exhausted.
+  decltype(aggregation_) partition_aggregation_;
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+  // the symbols whose values are spilled for each input row
+  std::vector<Symbol> spill_symbols_;
+  uint64_t groups_bytes_{0};
+  size_t next_partition_{0};
+  // the aggregations being output, which are either aggregation_ or
+  // partition_aggregation_
+  decltype(aggregation_) *output_{&aggregation_};
   // iterator over the accumulated cache
   decltype(aggregation_.begin()) aggregation_it_ = aggregation_.begin();
   // this LogicalOp pulls all from the input on it's first pull
   // this switch tracks if this has been performed
   bool pulled_all_input_{false};
+  // set if the aggregations only count the rows of the input, which the
+  // storage may know without pulling them
+  const std::optional<StorageCount> storage_count_;
+
+  /**
+   * Places the counts kept by the storage on the frame, instead of counting
+   * the rows of the input. Returns false if the storage doesn't keep them for
+   * the transaction.
+   */
+  bool PullStorageCount(Frame &frame, ExecutionContext &context) {
+    // Profiling reports the operators of the input, and the fine grained
+    // privileges are checked on each scanned vertex and edge.
+    if (context.is_profile_query) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    const auto count = storage_count_->label ? context.db_accessor->ExactVerticesCount(*storage_count_->label)
+                                             : context.db_accessor->ExactEdgesCount(*storage_count_->edge_type);
+    if (!count) return false;
+    for (const auto &elem : self_.aggregations_) {
+      frame[elem.output_sym] = TypedValue(static_cast<int64_t>(*count), context.evaluation_context.memory);
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(elem.output_sym.name())) {
+        context.frame_change_collector->ResetTrackingValue(elem.output_sym.name());
+      }
+    }
+    return true;
+  }
 
   /**
    * Pulls from the input operator until exhausted and aggregates the
@@ -3514,39 +4916,344 @@ class AggregateCursor : public Cursor {
    * aggregation results, and not on the number of inputs.
    */
   void ProcessAll(Frame *frame, ExecutionContext *context) {
+    if (!ProcessAllInParallel(*context)) {
+      AggregateInput(frame, context);
+    }
+
+    // The spilled rows may update the aggregations in memory, so those are
+    // output after all partitions.
+    if (partitions_.empty()) CalculateAverages(&aggregation_, *context);
+  }
+
+  // Calculates the AVG aggregations, which have only been summed so far.
+  void CalculateAverages(decltype(aggregation_) *aggregation, const ExecutionContext &context) const {
+    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+      if (self_.aggregations_[pos].op != Aggregation::Op::AVG) continue;
+      for (auto &kv : *aggregation) {
+        AggregationValue &agg_value = kv.second;
+        auto count = agg_value.counts_[pos];
+        auto *pull_memory = context.evaluation_context.memory;
+        if (count > 0) {
+          agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
+        }
+      }
+    }
+  }
+
+  /**
+   * Aggregates the rows of the next spilled partition and starts outputting
+   * them. Once all partitions are output, starts outputting the aggregations
+   * which were kept in memory.
+   *
+   * @return false if everything was output.
+   */
+  bool AggregateNextPartition(Frame &frame, ExecutionContext &context) {
+    if (output_ == &aggregation_) return false;
+    partition_aggregation_.clear();
+    if (next_partition_ == partitions_.size()) {
+      partitions_.clear();
+      CalculateAverages(&aggregation_, context);
+      output_ = &aggregation_;
+      aggregation_it_ = aggregation_.begin();
+      return true;
+    }
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::NEW);
+    auto &partition = partitions_[next_partition_++];
+    partition->Rewind();
+    utils::pmr::vector<TypedValue> row(utils::NewDeleteResource());
+    while (partition->Read(&row)) {
+      AbortCheck(context);
+      for (size_t i = 0; i < spill_symbols_.size(); ++i) frame[spill_symbols_[i]] = row[i];
+      auto group_by = EvaluateGroupBy(&evaluator, utils::NewDeleteResource());
+      auto it = aggregation_.find(group_by);
+      if (it == aggregation_.end()) {
+        it = partition_aggregation_.try_emplace(std::move(group_by), utils::NewDeleteResource()).first;
+        EnsureInitialized(frame, &it->second);
+      }
+      Update(&evaluator, &it->second);
+    }
+    partition.reset();
+    CalculateAverages(&partition_aggregation_, context);
+    output_ = &partition_aggregation_;
+    aggregation_it_ = partition_aggregation_.begin();
+    return true;
+  }
+
+  /**
+   * Pulls from the input operator until exhausted and aggregates the
+   * results, without calculating the AVG aggregations.
+   */
+  void AggregateInput(Frame *frame, ExecutionContext *context) {
     ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
                                   storage::View::NEW);
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
+    auto get_symbols = [&] {
+      std::vector<Expression *> expressions(self_.group_by_.begin(), self_.group_by_.end());
+      for (const auto &aggregation : self_.aggregations_) {
+        expressions.push_back(aggregation.value);
+        expressions.push_back(aggregation.key);
+      }
+      return UsedSymbols(context->symbol_table, expressions, self_.remember_);
+    };
+    if (context->spill_threshold_bytes > 0) {
+      spill_symbols_ = get_symbols();
+      const auto rows = PullAllRows(*input_cursor_, *frame, *context, get_symbols,
+                                    [&] { ProcessOneOrSpill(*frame, &evaluator, *context); });
+      ObserveCardinality(*context, self_, rows);
+      return;
+    }
+    const auto rows =
+        PullAllRows(*input_cursor_, *frame, *context, get_symbols, [&] { ProcessOne(*frame, &evaluator); });
+    ObserveCardinality(*context, self_, rows);
+  }
+
+  /**
+   * Splits the vertices scanned by the input into chunks and aggregates them
+   * on the parallel execution threads. Each worker aggregates the chunks it
+   * takes with its own cursor, and the partial aggregations of the workers
+   * are merged at the end.
+   *
+   * @return false if the input can't be aggregated in parallel.
+   */
+  bool ProcessAllInParallel(ExecutionContext &context) {
+    if (!context.parallel_execution_pool || context.parallel_workers < 2 || context.is_profile_query ||
+        context.vertex_chunks) {
+      return false;
+    }
+#ifdef MG_ENTERPRISE
+    if (context.auth_checker) return false;
+#endif
+    if (!std::all_of(self_.aggregations_.begin(), self_.aggregations_.end(), IsMergeableAggregation)) return false;
+    const auto *scan = FindParallelScan(*self_.input_);
+    if (!scan) return false;
+
+    auto *dba = context.db_accessor;
+    const auto num_chunks = context.parallel_workers * kChunksPerParallelWorker;
+    auto chunks = scan->GetTypeInfo() == ScanAllByLabel::kType
+                      ? dba->ChunkedVertices(scan->view_, static_cast<const ScanAllByLabel *>(scan)->label_, num_chunks)
+                      : dba->ChunkedVertices(scan->view_, num_chunks);
+    if (chunks.size() < 2) return false;
+    VertexChunks vertex_chunks(scan, std::move(chunks));
+
+    struct Worker {
+      Worker(const Aggregate &self, const ExecutionContext &parent, VertexChunks *vertex_chunks)
+          : memory(kParallelWorkerMemoryBlockSize),
+            frame(parent.symbol_table.max_position(), &memory),
+            cursor(self, &memory) {
+        context.db_accessor = parent.db_accessor;
+        context.symbol_table = parent.symbol_table;
+        context.evaluation_context.memory = &memory;
+        context.evaluation_context.timestamp = parent.evaluation_context.timestamp;
+        context.evaluation_context.parameters = parent.evaluation_context.parameters;
+        context.evaluation_context.properties = parent.evaluation_context.properties;
+        context.evaluation_context.labels = parent.evaluation_context.labels;
+        context.is_shutting_down = parent.is_shutting_down;
+        context.transaction_status = parent.transaction_status;
+        context.pull_batch_size = parent.pull_batch_size;
+        context.vertex_chunks = vertex_chunks;
+        context.timer = parent.timer;
+      }
+
+      utils::MonotonicBufferResource memory;
+      Frame frame;
+      ExecutionContext context;
+      AggregateCursor cursor;
+      std::exception_ptr error;
+    };
+    const auto num_workers = std::min(context.parallel_workers, vertex_chunks.Size());
+    std::vector<std::unique_ptr<Worker>> workers;
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers.push_back(std::make_unique<Worker>(self_, context, &vertex_chunks));
+    }
+
+    // The workers only read the transaction, so its caches mustn't change.
+    dba->FreezeTransactionCaches(true);
+    utils::OnScopeExit unfreeze{[dba] { dba->FreezeTransactionCaches(false); }};
+    utils::RunParallelWorkers(*context.parallel_execution_pool, num_workers, [&workers](size_t i) {
+      auto &worker = *workers[i];
+      try {
+        worker.cursor.AggregateInput(&worker.frame, &worker.context);
+      } catch (...) {
+        worker.error = std::current_exception();
+      }
+    });
+    for (const auto &worker : workers) {
+      if (worker->error) std::rethrow_exception(worker->error);
+    }
+
+    for (const auto &worker : workers) {
+      Merge(worker->cursor);
+    }
+    return true;
+  }
+
+  /**
+   * Merges the aggregations of the `other` cursor, which aggregated a
+   * different part of the same input, into the aggregations of this cursor.
+   * The AVG aggregations of both cursors must only be summed so far.
+   */
+  void Merge(const AggregateCursor &other) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (const auto &[other_group_by, other_value] : other.aggregation_) {
+      auto &agg_value = aggregation_.try_emplace(utils::pmr::vector<TypedValue>(other_group_by, mem), mem).first->second;
+      if (agg_value.values_.empty()) {
+        agg_value.counts_.assign(other_value.counts_.begin(), other_value.counts_.end());
+        agg_value.values_.assign(other_value.values_.begin(), other_value.values_.end());
+        agg_value.remember_.assign(other_value.remember_.begin(), other_value.remember_.end());
+        for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+          agg_value.unique_values_.emplace_back(AggregationValue::TSet(mem));
+        }
+        continue;
+      }
+
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        const auto other_count = other_value.counts_[pos];
+        if (other_count == 0) continue;
+        auto &count = agg_value.counts_[pos];
+        auto &value = agg_value.values_[pos];
+        const auto &other_agg = other_value.values_[pos];
+        if (count == 0) {
+          count = other_count;
+          value = other_agg;
+          continue;
+        }
+        count += other_count;
+        switch (self_.aggregations_[pos].op) {
+          case Aggregation::Op::COUNT:
+            value = count;
+            break;
+          case Aggregation::Op::MIN:
+            try {
+              if ((other_agg < value).ValueBool()) value = other_agg;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MIN of '{}' and '{}'.", other_agg.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::MAX:
+            try {
+              if ((other_agg > value).ValueBool()) value = other_agg;
+            } catch (const TypedValueException &) {
+              throw QueryRuntimeException("Unable to get MAX of '{}' and '{}'.", other_agg.type(), value.type());
+            }
+            break;
+          case Aggregation::Op::AVG:
+          case Aggregation::Op::SUM:
+            value = value + other_agg;
+            break;
+          case Aggregation::Op::COLLECT_LIST:
+          case Aggregation::Op::COLLECT_MAP:
+          case Aggregation::Op::PROJECT:
+            LOG_FATAL("Aggregation {} can't be merged", static_cast<int>(self_.aggregations_[pos].op));
+        }
+      }
+    }
+  }
+
+  /**
+   * Performs a single accumulation.
+   */
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+    if (self_.group_by_.size() == 1) {
+      ProcessOneGroupedByValue(frame, evaluator);
+      return;
+    }
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    auto &agg_value = aggregation_.try_emplace(EvaluateGroupBy(evaluator, mem), mem).first->second;
+    EnsureInitialized(frame, &agg_value);
+    Update(evaluator, &agg_value);
+  }
+
+  /**
+   * Performs a single accumulation grouped by a single value. Int, string and
+   * vertex values are looked up in the group indices first, and the other
+   * values, as well as the values of new groups, in the aggregation_.
+   */
+  void ProcessOneGroupedByValue(const Frame &frame, ExpressionEvaluator *evaluator) {
+    auto key = self_.group_by_[0]->Accept(*evaluator);
+    AggregationValue *agg_value = nullptr;
+    switch (key.type()) {
+      case TypedValue::Type::Int:
+        if (auto it = int_groups_.find(key.ValueInt()); it != int_groups_.end()) agg_value = it->second;
+        break;
+      case TypedValue::Type::String:
+        if (auto it = string_groups_.find(key.ValueString()); it != string_groups_.end()) agg_value = it->second;
+        break;
+      case TypedValue::Type::Vertex:
+        if (auto it = vertex_groups_.find(key.ValueVertex().Gid().AsUint()); it != vertex_groups_.end()) {
+          agg_value = it->second;
+        }
+        break;
+      default:
+        break;
     }
 
-    // calculate AVG aggregations (so far they have only been summed)
-    for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
-      if (self_.aggregations_[pos].op != Aggregation::Op::AVG) continue;
-      for (auto &kv : aggregation_) {
-        AggregationValue &agg_value = kv.second;
-        auto count = agg_value.counts_[pos];
-        auto *pull_memory = context->evaluation_context.memory;
-        if (count > 0) {
-          agg_value.values_[pos] = agg_value.values_[pos] / TypedValue(static_cast<double>(count), pull_memory);
-        }
+    if (!agg_value) {
+      auto *mem = aggregation_.get_allocator().GetMemoryResource();
+      utils::pmr::vector<TypedValue> group_by(mem);
+      group_by.emplace_back(key);
+      auto &[group_key, value] = *aggregation_.try_emplace(std::move(group_by), mem).first;
+      agg_value = &value;
+      // an equal int may already have a double group-by value
+      switch (key.type()) {
+        case TypedValue::Type::Int:
+          int_groups_.emplace(key.ValueInt(), agg_value);
+          break;
+        case TypedValue::Type::String:
+          string_groups_.emplace(group_key[0].ValueString(), agg_value);
+          break;
+        case TypedValue::Type::Vertex:
+          vertex_groups_.emplace(key.ValueVertex().Gid().AsUint(), agg_value);
+          break;
+        default:
+          break;
       }
     }
+    EnsureInitialized(frame, agg_value);
+    Update(evaluator, agg_value);
   }
 
   /**
-   * Performs a single accumulation.
+   * Performs a single accumulation, unless the row belongs to a group which
+   * isn't in memory after the groups crossed the spill threshold. Such rows
+   * are spilled into the partition of their group if they can be.
    */
-  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+  void ProcessOneOrSpill(const Frame &frame, ExpressionEvaluator *evaluator, const ExecutionContext &context) {
     auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    auto group_by = EvaluateGroupBy(evaluator, mem);
+    auto it = aggregation_.find(group_by);
+    if (it == aggregation_.end()) {
+      if (!partitions_.empty()) {
+        utils::pmr::vector<TypedValue> row(utils::NewDeleteResource());
+        row.reserve(spill_symbols_.size());
+        for (const auto &symbol : spill_symbols_) row.emplace_back(frame[symbol]);
+        if (IsSpillable(row)) {
+          partitions_[aggregation_.hash_function()(group_by) % kSpillPartitions]->Write(row);
+          return;
+        }
+      }
+      groups_bytes_ += ApproximateSize(group_by);
+      it = aggregation_.try_emplace(std::move(group_by), mem).first;
+      EnsureInitialized(frame, &it->second);
+      groups_bytes_ += ApproximateSize(it->second.remember_) + ApproximateSize(it->second.values_);
+      if (partitions_.empty() && groups_bytes_ >= context.spill_threshold_bytes) {
+        partitions_.reserve(kSpillPartitions);
+        for (size_t i = 0; i < kSpillPartitions; ++i) {
+          partitions_.push_back(std::make_unique<SpillFile>(context.spill_directory));
+        }
+      }
+    }
+    Update(evaluator, &it->second);
+  }
+
+  utils::pmr::vector<TypedValue> EvaluateGroupBy(ExpressionEvaluator *evaluator, utils::MemoryResource *mem) const {
     utils::pmr::vector<TypedValue> group_by(mem);
     group_by.reserve(self_.group_by_.size());
     for (Expression *expression : self_.group_by_) {
       group_by.emplace_back(expression->Accept(*evaluator));
     }
-    auto &agg_value = aggregation_.try_emplace(std::move(group_by), mem).first->second;
-    EnsureInitialized(frame, &agg_value);
-    Update(evaluator, &agg_value);
+    return group_by;
   }
 
   /** Ensures the new AggregationValue has been initialized. This means
@@ -3586,7 +5293,7 @@ class AggregateCursor : public Cursor {
       auto input_expr_ptr = agg_elem_it->value;
       if (!input_expr_ptr) {
         *count_it += 1;
-        *value_it = *count_it;
+        value_it->ValueInt() = *count_it;
         continue;
       }
 
@@ -3638,7 +5345,7 @@ class AggregateCursor : public Cursor {
       // aggregation of existing values
       switch (agg_op) {
         case Aggregation::Op::COUNT:
-          *value_it = *count_it;
+          value_it->ValueInt() = *count_it;
           break;
         case Aggregation::Op::MIN: {
           EnsureOkForMinMax(input_value);
@@ -3669,7 +5376,15 @@ class AggregateCursor : public Cursor {
         // the input has been processed
         case Aggregation::Op::SUM:
           EnsureOkForAvgSum(input_value);
-          *value_it = *value_it + input_value;
+          // sum the common numbers in place
+          if (value_it->IsInt() && input_value.IsInt()) {
+            value_it->ValueInt() += input_value.ValueInt();
+          } else if (value_it->IsDouble()) {
+            value_it->ValueDouble() +=
+                input_value.IsInt() ? static_cast<double>(input_value.ValueInt()) : input_value.ValueDouble();
+          } else {
+            *value_it = *value_it + input_value;
+          }
           break;
         case Aggregation::Op::COLLECT_LIST:
           value_it->ValueList().push_back(input_value);
@@ -3844,8 +5559,8 @@ void Limit::LimitCursor::Reset() {
 }
 
 OrderBy::OrderBy(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
-                 const std::vector<Symbol> &output_symbols)
-    : input_(input), output_symbols_(output_symbols) {
+                 const std::vector<Symbol> &output_symbols, Expression *skip, Expression *limit)
+    : input_(input), output_symbols_(output_symbols), skip_(skip), limit_(limit) {
   // split the order_by vector into two vectors of orderings and expressions
   std::vector<Ordering> ordering;
   ordering.reserve(order_by.size());
@@ -3869,7 +5584,10 @@ std::vector<Symbol> OrderBy::ModifiedSymbols(const SymbolTable &table) const { r
 class OrderByCursor : public Cursor {
  public:
   OrderByCursor(const OrderBy &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        cache_(mem),
+        spill_cache_(utils::NewDeleteResource()) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP_BY_REF(self_);
@@ -3877,47 +5595,89 @@ class OrderByCursor : public Cursor {
     if (!did_pull_all_) {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
-      auto *mem = cache_.get_allocator().GetMemoryResource();
-      while (input_cursor_->Pull(frame, context)) {
+      auto less = [this](const auto &pair1, const auto &pair2) { return Less(pair1, pair2); };
+      // With a top K, the cache is a max-heap of the K smallest rows so far.
+      const auto top_k = TopK(evaluator);
+      // The query memory is released only once the query finishes, so the
+      // rows which may be spilled are kept in memory which is freed.
+      spill_ = !top_k && context.spill_threshold_bytes > 0;
+      rows_ = spill_ ? &spill_cache_ : &cache_;
+      auto &cache = *rows_;
+      auto *mem = cache.get_allocator().GetMemoryResource();
+      auto get_symbols = [&] { return UsedSymbols(context.symbol_table, self_.order_by_, self_.output_symbols_); };
+      const auto rows = PullAllRows(*input_cursor_, frame, context, get_symbols, [&] {
         // collect the order_by elements
         utils::pmr::vector<TypedValue> order_by(mem);
         order_by.reserve(self_.order_by_.size());
         for (auto expression_ptr : self_.order_by_) {
           order_by.emplace_back(expression_ptr->Accept(evaluator));
         }
+        const bool full = top_k && cache.size() == *top_k;
+        if (full && (cache.empty() || !self_.compare_(order_by, cache.front().order_by))) return;
 
         // collect the output elements
         utils::pmr::vector<TypedValue> output(mem);
         output.reserve(self_.output_symbols_.size());
         for (const Symbol &output_sym : self_.output_symbols_) output.emplace_back(frame[output_sym]);
 
-        cache_.push_back(Element{std::move(order_by), std::move(output)});
-      }
-
-      std::sort(cache_.begin(), cache_.end(), [this](const auto &pair1, const auto &pair2) {
-        return self_.compare_(pair1.order_by, pair2.order_by);
+        if (full) {
+          // replace the largest row
+          std::pop_heap(cache.begin(), cache.end(), less);
+          cache.back() = Element{std::move(order_by), std::move(output)};
+        } else {
+          cache.push_back(Element{std::move(order_by), std::move(output)});
+        }
+        if (top_k) std::push_heap(cache.begin(), cache.end(), less);
+        if (spill_) {
+          cache_bytes_ += ApproximateSize(cache.back().order_by) + ApproximateSize(cache.back().remember);
+          if (cache_bytes_ >= context.spill_threshold_bytes) SpillRun(context);
+        }
       });
+      ObserveCardinality(context, self_, rows);
+
+      if (top_k) {
+        std::sort_heap(cache.begin(), cache.end(), less);
+      } else {
+        std::sort(cache.begin(), cache.end(), less);
+      }
 
       did_pull_all_ = true;
-      cache_it_ = cache_.begin();
+      cache_it_ = cache.begin();
+      for (auto &run : runs_) {
+        run.file->Rewind();
+        ReadHead(&run);
+      }
     }
 
-    if (cache_it_ == cache_.end()) return false;
+    // the smallest of the rows in memory and the next rows of the spilled runs
+    const Element *next = cache_it_ != rows_->end() ? &*cache_it_ : nullptr;
+    SpilledRun *next_run = nullptr;
+    for (auto &run : runs_) {
+      if (run.head && (!next || Less(*run.head, *next))) {
+        next = &*run.head;
+        next_run = &run;
+      }
+    }
+    if (!next) return false;
 
     AbortCheck(context);
 
     // place the output values on the frame
-    DMG_ASSERT(self_.output_symbols_.size() == cache_it_->remember.size(),
+    DMG_ASSERT(self_.output_symbols_.size() == next->remember.size(),
                "Number of values does not match the number of output symbols "
                "in OrderBy");
     auto output_sym_it = self_.output_symbols_.begin();
-    for (const TypedValue &output : cache_it_->remember) {
+    for (const TypedValue &output : next->remember) {
       if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(output_sym_it->name())) {
         context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
       }
       frame[*output_sym_it++] = output;
     }
-    cache_it_++;
+    if (next_run) {
+      ReadHead(next_run);
+    } else {
+      cache_it_++;
+    }
     return true;
   }
   void Shutdown() override { input_cursor_->Shutdown(); }
@@ -3926,6 +5686,11 @@ class OrderByCursor : public Cursor {
     input_cursor_->Reset();
     did_pull_all_ = false;
     cache_.clear();
+    spill_cache_.clear();
+    runs_.clear();
+    cache_bytes_ = 0;
+    spill_ = false;
+    rows_ = &cache_;
     cache_it_ = cache_.begin();
   }
 
@@ -3935,13 +5700,74 @@ class OrderByCursor : public Cursor {
     utils::pmr::vector<TypedValue> remember;
   };
 
+  // A sorted run of rows spilled to the disk.
+  struct SpilledRun {
+    std::unique_ptr<SpillFile> file;
+    // the smallest row of the run which wasn't output yet
+    std::optional<Element> head;
+  };
+
+  bool Less(const Element &lhs, const Element &rhs) const { return self_.compare_(lhs.order_by, rhs.order_by); }
+
+  // Sorts the rows in memory and writes them into a new spilled run. If some of
+  // the rows can't be spilled, they and all further rows are kept in memory.
+  void SpillRun(const ExecutionContext &context) {
+    if (!std::all_of(spill_cache_.begin(), spill_cache_.end(),
+                     [](const Element &row) { return IsSpillable(row.order_by) && IsSpillable(row.remember); })) {
+      spill_ = false;
+      return;
+    }
+    std::sort(spill_cache_.begin(), spill_cache_.end(),
+              [this](const Element &lhs, const Element &rhs) { return Less(lhs, rhs); });
+    auto &run = runs_.emplace_back(SpilledRun{std::make_unique<SpillFile>(context.spill_directory), std::nullopt});
+    for (const auto &row : spill_cache_) {
+      run.file->Write(row.order_by);
+      run.file->Write(row.remember);
+    }
+    spill_cache_.clear();
+    cache_bytes_ = 0;
+  }
+
+  static void ReadHead(SpilledRun *run) {
+    Element row{utils::pmr::vector<TypedValue>(utils::NewDeleteResource()),
+                utils::pmr::vector<TypedValue>(utils::NewDeleteResource())};
+    if (run->file->Read(&row.order_by) && run->file->Read(&row.remember)) {
+      run->head = std::move(row);
+    } else {
+      run->head.reset();
+    }
+  }
+
+  // Returns the number of rows which pass the Skip and Limit after this
+  // operator, or nullopt if they aren't known or can't be evaluated to valid
+  // counts. Invalid counts are reported by the Skip and Limit themselves.
+  std::optional<size_t> TopK(ExpressionEvaluator &evaluator) const {
+    if (!self_.limit_) return std::nullopt;
+    size_t top_k = 0;
+    for (auto *expression : {self_.skip_, self_.limit_}) {
+      if (!expression) continue;
+      auto count = expression->Accept(evaluator);
+      if (count.type() != TypedValue::Type::Int || count.ValueInt() < 0) return std::nullopt;
+      top_k += count.ValueInt();
+    }
+    return top_k;
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
   bool did_pull_all_{false};
   // a cache of elements pulled from the input
   // the cache is filled and sorted (only on first elem) on first Pull
   utils::pmr::vector<Element> cache_;
-  // iterator over the cache_, maintains state between Pulls
+  // the rows which weren't spilled yet, used instead of the cache_ when the
+  // rows may be spilled
+  utils::pmr::vector<Element> spill_cache_;
+  utils::pmr::vector<Element> *rows_{&cache_};
+  // approximate memory used by the rows in the spill_cache_
+  uint64_t cache_bytes_{0};
+  bool spill_{false};
+  std::vector<SpilledRun> runs_;
+  // iterator over the *rows_, maintains state between Pulls
   decltype(cache_.begin()) cache_it_ = cache_.begin();
 };
 
@@ -3977,10 +5803,37 @@ std::vector<Symbol> Merge::ModifiedSymbols(const SymbolTable &table) const {
   return symbols;
 }
 
+namespace {
+
+bool IsSetOrRemove(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == SetProperty::kType || type == SetProperties::kType || type == SetLabels::kType ||
+         type == RemoveProperty::kType || type == RemoveLabels::kType;
+}
+
+// Returns the node created by the MERGE if its pattern is a single node with
+// labels and properties, and it doesn't change the matched node.
+const NodeCreationInfo *FindMergedNode(const Merge &merge) {
+  for (const auto *op = merge.merge_match_.get(); op->GetTypeInfo() != Once::kType; op = op->input().get()) {
+    if (!op->HasSingleInput() || IsSetOrRemove(*op)) return nullptr;
+  }
+  const auto *op = merge.merge_create_.get();
+  while (IsSetOrRemove(*op)) op = op->input().get();
+  if (op->GetTypeInfo() != CreateNode::kType) return nullptr;
+  const auto &create = static_cast<const CreateNode &>(*op);
+  if (create.input_->GetTypeInfo() != Once::kType || create.node_info_.labels.empty()) return nullptr;
+  const auto *properties = std::get_if<PropertiesMapList>(&create.node_info_.properties);
+  if (!properties || properties->empty()) return nullptr;
+  return &create.node_info_;
+}
+
+}  // namespace
+
 Merge::MergeCursor::MergeCursor(const Merge &self, utils::MemoryResource *mem)
     : input_cursor_(self.input_->MakeCursor(mem)),
       merge_match_cursor_(self.merge_match_->MakeCursor(mem)),
-      merge_create_cursor_(self.merge_create_->MakeCursor(mem)) {}
+      merge_create_cursor_(self.merge_create_->MakeCursor(mem)),
+      unique_node_(FindMergedNode(self)) {}
 
 bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("Merge");
@@ -3993,6 +5846,7 @@ bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
         // and merge_create (could have a Once at the beginning)
         merge_match_cursor_->Reset();
         merge_create_cursor_->Reset();
+        if (auto pulled = PullUniqueKey(frame, context)) return *pulled;
       } else
         // input is exhausted, we're done
         return false;
@@ -4018,6 +5872,73 @@ bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
   }
 }
 
+std::optional<bool> Merge::MergeCursor::PullUniqueKey(Frame &frame, ExecutionContext &context) {
+  if (!unique_node_ || context.is_profile_query) return std::nullopt;
+#ifdef MG_ENTERPRISE
+  // The fine grained privileges are checked on each scanned vertex.
+  if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return std::nullopt;
+#endif
+  auto &dba = *context.db_accessor;
+  const auto &properties = std::get<PropertiesMapList>(unique_node_->properties);
+  if (!unique_key_chosen_) {
+    unique_key_chosen_ = true;
+    auto constraints = dba.ListAllConstraints();
+    for (auto &[label, constraint_properties] : constraints.unique) {
+      if (!utils::Contains(unique_node_->labels, label)) continue;
+      const bool merged_properties =
+          std::all_of(constraint_properties.begin(), constraint_properties.end(), [&](auto property) {
+            return std::any_of(properties.begin(), properties.end(),
+                               [&](const auto &key_value) { return key_value.first == property; });
+          });
+      if (merged_properties && dba.CanFindVertexByUniqueKey(label, constraint_properties)) {
+        unique_key_.emplace(label, std::move(constraint_properties));
+        break;
+      }
+    }
+  }
+  if (!unique_key_) return std::nullopt;
+
+  // Only the values which compare the same when stored and when filtered by
+  // the match branch are looked up.
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::NEW);
+  std::map<storage::PropertyId, storage::PropertyValue> values;
+  for (const auto &[key, value_expression] : properties) {
+    auto value = value_expression->Accept(evaluator);
+    if (!value.IsBool() && !value.IsInt() && !value.IsDouble() && !value.IsString()) return std::nullopt;
+    values.insert_or_assign(key, storage::PropertyValue(value));
+  }
+  std::vector<storage::PropertyValue> key_values;
+  key_values.reserve(unique_key_->second.size());
+  for (const auto property : unique_key_->second) {
+    key_values.push_back(values.at(property));
+  }
+
+  auto maybe_vertex = dba.FindVertexByUniqueKey(unique_key_->first, unique_key_->second, key_values);
+  if (maybe_vertex.HasError()) {
+    // Another transaction made the node, so creating it would fail on commit.
+    throw TransactionSerializationException();
+  }
+  if (!*maybe_vertex) return merge_create_cursor_->Pull(frame, context);
+
+  // The node has to have the rest of the pattern as well, otherwise it's left
+  // to the regular branches.
+  auto &vertex = **maybe_vertex;
+  for (const auto label : unique_node_->labels) {
+    auto has_label = vertex.HasLabel(storage::View::NEW, label);
+    if (!has_label.HasValue() || !*has_label) return std::nullopt;
+  }
+  for (const auto &[key, value] : values) {
+    auto stored = vertex.GetProperty(storage::View::NEW, key);
+    if (!stored.HasValue() || !(*stored == value)) return std::nullopt;
+  }
+  if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(unique_node_->symbol.name())) {
+    context.frame_change_collector->ResetTrackingValue(unique_node_->symbol.name());
+  }
+  frame[unique_node_->symbol] = vertex;
+  return true;
+}
+
 void Merge::MergeCursor::Shutdown() {
   input_cursor_->Shutdown();
   merge_match_cursor_->Shutdown();
@@ -4129,30 +6050,46 @@ class UnwindCursor : public Cursor {
     SCOPED_PROFILE_OP("Unwind");
     while (true) {
       AbortCheck(context);
-      // if we reached the end of our list of values
-      // pull from the input
-      if (input_value_it_ == input_value_.end()) {
-        if (!input_cursor_->Pull(frame, context)) return false;
-
-        // successful pull from input, initialize value and iterator
-        ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
-                                      storage::View::OLD);
-        TypedValue input_value = self_.input_expression_->Accept(evaluator);
-        if (input_value.type() != TypedValue::Type::List)
-          throw QueryRuntimeException("Argument of UNWIND must be a list, but '{}' was provided.", input_value.type());
-        // Copy the evaluted input_value_list to our vector.
-        input_value_ = input_value.ValueList();
-        input_value_it_ = input_value_.begin();
+      if (parameter_list_ && parameter_list_pos_ < parameter_list_->size()) {
+        auto &output = frame[self_.output_symbol_];
+        output = TypedValue((*parameter_list_)[parameter_list_pos_++], output.GetMemoryResource());
+        ResetTrackingValue(context);
+        return true;
+      }
+      if (!parameter_list_ && input_value_it_ != input_value_.end()) {
+        frame[self_.output_symbol_] = *input_value_it_++;
+        ResetTrackingValue(context);
+        return true;
       }
 
-      // if we reached the end of our list of values goto back to top
-      if (input_value_it_ == input_value_.end()) continue;
-
-      frame[self_.output_symbol_] = *input_value_it_++;
-      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(self_.output_symbol_.name_)) {
-        context.frame_change_collector->ResetTrackingValue(self_.output_symbol_.name_);
+      // we reached the end of our list of values, pull from the input
+      if (!input_cursor_->Pull(frame, context)) return false;
+      parameter_list_ = nullptr;
+      input_value_.clear();
+      input_value_it_ = input_value_.end();
+
+      // A list passed as a parameter is unwound without being copied, its
+      // elements are converted one at a time.
+      if (const auto *lookup = utils::Downcast<ParameterLookup>(self_.input_expression_)) {
+        const auto &parameter = context.evaluation_context.parameters.AtTokenPosition(lookup->token_position_);
+        if (parameter.type() != storage::PropertyValue::Type::List) {
+          throw QueryRuntimeException("Argument of UNWIND must be a list, but '{}' was provided.",
+                                      TypedValue(parameter).type());
+        }
+        parameter_list_ = &parameter.ValueList();
+        parameter_list_pos_ = 0;
+        continue;
       }
-      return true;
+
+      // successful pull from input, initialize value and iterator
+      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD);
+      TypedValue input_value = self_.input_expression_->Accept(evaluator);
+      if (input_value.type() != TypedValue::Type::List)
+        throw QueryRuntimeException("Argument of UNWIND must be a list, but '{}' was provided.", input_value.type());
+      // The evaluated list is moved to our vector if it uses the same memory.
+      input_value_ = std::move(input_value.ValueList());
+      input_value_it_ = input_value_.begin();
     }
   }
 
@@ -4160,6 +6097,7 @@ class UnwindCursor : public Cursor {
 
   void Reset() override {
     input_cursor_->Reset();
+    parameter_list_ = nullptr;
     input_value_.clear();
     input_value_it_ = input_value_.end();
   }
@@ -4171,6 +6109,15 @@ class UnwindCursor : public Cursor {
   utils::pmr::vector<TypedValue> input_value_;
   // current position in input_value_
   decltype(input_value_)::iterator input_value_it_ = input_value_.end();
+  // list parameter we are unwinding instead of input_value_
+  const std::vector<storage::PropertyValue> *parameter_list_{nullptr};
+  size_t parameter_list_pos_{0};
+
+  void ResetTrackingValue(ExecutionContext &context) const {
+    if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(self_.output_symbol_.name_)) {
+      context.frame_change_collector->ResetTrackingValue(self_.output_symbol_.name_);
+    }
+  }
 };
 
 UniqueCursorPtr Unwind::MakeCursor(utils::MemoryResource *mem) const {
@@ -4182,22 +6129,44 @@ UniqueCursorPtr Unwind::MakeCursor(utils::MemoryResource *mem) const {
 class DistinctCursor : public Cursor {
  public:
   DistinctCursor(const Distinct &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), seen_rows_(mem) {}
+      : self_(self),
+        input_cursor_(self.input_->MakeCursor(mem)),
+        seen_rows_(mem),
+        spill_seen_rows_(utils::NewDeleteResource()) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("Distinct");
 
+    // The query memory is released only once the query finishes, so the rows
+    // which may be spilled are kept in memory which is freed.
+    auto &seen_rows = context.spill_threshold_bytes > 0 ? spill_seen_rows_ : seen_rows_;
     while (true) {
-      if (!input_cursor_->Pull(frame, context)) return false;
+      if (input_done_) return PullSpilled(frame, context);
+      if (!input_cursor_->Pull(frame, context)) {
+        if (partitions_.empty()) return false;
+        input_done_ = true;
+        continue;
+      }
 
-      utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().GetMemoryResource());
+      utils::pmr::vector<TypedValue> row(seen_rows.get_allocator().GetMemoryResource());
       row.reserve(self_.value_symbols_.size());
 
       for (const auto &symbol : self_.value_symbols_) {
         row.emplace_back(frame.at(symbol));
       }
 
-      if (seen_rows_.insert(std::move(row)).second) {
+      // After the seen rows are spilled, the new rows are compared with them
+      // once the input is exhausted.
+      if (!partitions_.empty() && IsSpillable(row)) {
+        partitions_[PartitionOf(row)].pending->Write(row);
+        continue;
+      }
+
+      const bool track_size = context.spill_threshold_bytes > 0 && partitions_.empty() && !keep_in_memory_;
+      const auto size = track_size ? ApproximateSize(row) : 0;
+      if (seen_rows.insert(std::move(row)).second) {
+        seen_bytes_ += size;
+        if (track_size && seen_bytes_ >= context.spill_threshold_bytes) SpillSeenRows(context);
         return true;
       }
     }
@@ -4208,9 +6177,79 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    spill_seen_rows_.clear();
+    seen_bytes_ = 0;
+    keep_in_memory_ = false;
+    partitions_.clear();
+    input_done_ = false;
+    current_partition_ = 0;
+    partition_loaded_ = false;
   }
 
  private:
+  // The spilled rows whose hashes fall into the same partition.
+  struct SpilledPartition {
+    // the rows which were output before they were spilled
+    std::unique_ptr<SpillFile> seen;
+    // the rows pulled after the seen rows were spilled, possibly duplicates
+    std::unique_ptr<SpillFile> pending;
+  };
+
+  size_t PartitionOf(const utils::pmr::vector<TypedValue> &row) const {
+    return spill_seen_rows_.hash_function()(row) % kSpillPartitions;
+  }
+
+  // Writes the seen rows into the partitions, unless some of them can't be
+  // spilled, in which case all rows are kept in memory.
+  void SpillSeenRows(const ExecutionContext &context) {
+    if (!std::all_of(spill_seen_rows_.begin(), spill_seen_rows_.end(),
+                     [](const auto &row) { return IsSpillable(row); })) {
+      keep_in_memory_ = true;
+      return;
+    }
+    partitions_.reserve(kSpillPartitions);
+    for (size_t i = 0; i < kSpillPartitions; ++i) {
+      partitions_.push_back(SpilledPartition{std::make_unique<SpillFile>(context.spill_directory),
+                                             std::make_unique<SpillFile>(context.spill_directory)});
+    }
+    for (const auto &row : spill_seen_rows_) partitions_[PartitionOf(row)].seen->Write(row);
+    // From now on the set holds only the rows which can't be spilled.
+    spill_seen_rows_.clear();
+  }
+
+  // Outputs the pending rows which weren't seen, one partition at a time.
+  bool PullSpilled(Frame &frame, ExecutionContext &context) {
+    utils::pmr::vector<TypedValue> row(spill_seen_rows_.get_allocator().GetMemoryResource());
+    while (current_partition_ < partitions_.size()) {
+      auto &partition = partitions_[current_partition_];
+      if (!partition_loaded_) {
+        spill_seen_rows_.clear();
+        partition.seen->Rewind();
+        while (partition.seen->Read(&row)) spill_seen_rows_.insert(std::move(row));
+        partition.pending->Rewind();
+        partition_loaded_ = true;
+      }
+      while (partition.pending->Read(&row)) {
+        auto [it, inserted] = spill_seen_rows_.insert(std::move(row));
+        if (!inserted) continue;
+        for (size_t i = 0; i < self_.value_symbols_.size(); ++i) {
+          const auto &symbol = self_.value_symbols_[i];
+          if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+            context.frame_change_collector->ResetTrackingValue(symbol.name());
+          }
+          frame[symbol] = (*it)[i];
+        }
+        return true;
+      }
+      partition.seen.reset();
+      partition.pending.reset();
+      partition_loaded_ = false;
+      ++current_partition_;
+    }
+    spill_seen_rows_.clear();
+    return false;
+  }
+
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
   // a set of already seen rows
@@ -4220,6 +6259,16 @@ class DistinctCursor : public Cursor {
                             utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
                             TypedValueVectorEqual>
       seen_rows_;
+  // the seen rows which aren't spilled yet, used instead of the seen_rows_
+  // when the rows may be spilled
+  decltype(seen_rows_) spill_seen_rows_;
+  // approximate memory used by the rows in the spill_seen_rows_
+  uint64_t seen_bytes_{0};
+  bool keep_in_memory_{false};
+  std::vector<SpilledPartition> partitions_;
+  bool input_done_{false};
+  size_t current_partition_{0};
+  bool partition_loaded_{false};
 };
 
 Distinct::Distinct(const std::shared_ptr<LogicalOperator> &input, const std::vector<Symbol> &value_symbols)
@@ -4355,6 +6404,7 @@ class CartesianCursor : public Cursor {
       while (left_op_cursor_->Pull(frame, context)) {
         left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
       }
+      ObserveCardinality(context, self_, left_op_frames_.size());
 
       // We're setting the iterator to 'end' here so it pulls the right
       // cursor.
@@ -4426,6 +6476,202 @@ UniqueCursorPtr Cartesian::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<CartesianCursor>(mem, *this, mem);
 }
 
+std::vector<Symbol> HashJoin::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = left_op_->ModifiedSymbols(table);
+  auto right = right_op_->ModifiedSymbols(table);
+  symbols.insert(symbols.end(), right.begin(), right.end());
+  return symbols;
+}
+
+bool HashJoin::Accept(HierarchicalLogicalOperatorVisitor &visitor) {
+  if (visitor.PreVisit(*this)) {
+    left_op_->Accept(visitor) && right_op_->Accept(visitor);
+  }
+  return visitor.PostVisit(*this);
+}
+
+WITHOUT_SINGLE_INPUT(HashJoin);
+
+namespace {
+
+class HashJoinCursor : public Cursor {
+ public:
+  HashJoinCursor(const HashJoin &self, utils::MemoryResource *mem)
+      : self_(self),
+        hash_table_(mem),
+        right_op_frame_(mem),
+        left_op_cursor_(self.left_op_->MakeCursor(mem)),
+        right_op_cursor_(self_.right_op_->MakeCursor(mem)) {
+    MG_ASSERT(left_op_cursor_ != nullptr, "HashJoinCursor: Missing left operator cursor.");
+    MG_ASSERT(right_op_cursor_ != nullptr, "HashJoinCursor: Missing right operator cursor.");
+  }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD, context.frame_change_collector);
+
+    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
+      for (const auto &symbol : symbols) {
+        frame[symbol] = restore_from[symbol.position()];
+        if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+          context.frame_change_collector->ResetTrackingValue(symbol.name());
+        }
+      }
+    };
+
+    if (matched_frames_ && matched_frames_it_ != matched_frames_->end()) {
+      // Make sure right_op_cursor last pulled results are on frame.
+      restore_frame(self_.right_symbols_, right_op_frame_);
+    } else {
+      // Advance right_op_cursor_ until its row joins with some left row.
+      matched_frames_ = nullptr;
+      while (!matched_frames_) {
+        if (!right_op_cursor_->Pull(frame, context)) return false;
+
+        right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
+        if (!hash_table_initialized_) {
+          // The left side is built lazily, so it isn't pulled at all if the
+          // right side yields nothing.
+          BuildHashTable(frame, context, evaluator);
+          restore_frame(self_.right_symbols_, right_op_frame_);
+        }
+        // The table is built only from the left rows, so an empty table can't
+        // join with any right row.
+        if (hash_table_.empty() && !self_.optional_) return false;
+
+        auto key = self_.hash_join_condition_->expression2_->Accept(evaluator);
+        if (!key.IsNull()) {
+          if (auto found = hash_table_.find(key); found != hash_table_.end()) {
+            matched_frames_ = &found->second;
+            matched_frames_it_ = matched_frames_->begin();
+          }
+        }
+        if (!matched_frames_ && self_.optional_) {
+          // The right row is yielded once without any left row.
+          for (const auto &symbol : self_.left_symbols_) {
+            frame[symbol] = TypedValue(context.evaluation_context.memory);
+            if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+              context.frame_change_collector->ResetTrackingValue(symbol.name());
+            }
+          }
+          AbortCheck(context);
+          return true;
+        }
+      }
+    }
+
+    AbortCheck(context);
+
+    restore_frame(self_.left_symbols_, *matched_frames_it_);
+    matched_frames_it_++;
+    return true;
+  }
+
+  void Shutdown() override {
+    left_op_cursor_->Shutdown();
+    right_op_cursor_->Shutdown();
+  }
+
+  void Reset() override {
+    left_op_cursor_->Reset();
+    right_op_cursor_->Reset();
+    right_op_frame_.clear();
+    hash_table_.clear();
+    matched_frames_ = nullptr;
+    hash_table_initialized_ = false;
+  }
+
+ private:
+  using TFrames = utils::pmr::vector<utils::pmr::vector<TypedValue>>;
+
+  void BuildHashTable(Frame &frame, ExecutionContext &context, ExpressionEvaluator &evaluator) {
+    while (left_op_cursor_->Pull(frame, context)) {
+      auto key = self_.hash_join_condition_->expression1_->Accept(evaluator);
+      // Null doesn't equal anything, so such rows never join.
+      if (key.IsNull()) continue;
+      auto &frames = hash_table_.try_emplace(std::move(key)).first->second;
+      frames.emplace_back(frame.elems().begin(), frame.elems().end());
+    }
+    hash_table_initialized_ = true;
+  }
+
+  const HashJoin &self_;
+  utils::pmr::unordered_map<TypedValue, TFrames, TypedValue::Hash, TypedValue::BoolEqual> hash_table_;
+  utils::pmr::vector<TypedValue> right_op_frame_;
+  const UniqueCursorPtr left_op_cursor_;
+  const UniqueCursorPtr right_op_cursor_;
+  // Left rows which join with the last pulled right row.
+  TFrames *matched_frames_{nullptr};
+  TFrames::iterator matched_frames_it_;
+  bool hash_table_initialized_{false};
+};
+
+}  // namespace
+
+UniqueCursorPtr HashJoin::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::HashJoinOperator);
+
+  return MakeUniqueCursorPtr<HashJoinCursor>(mem, *this, mem);
+}
+
+IndexedJoin::IndexedJoin(std::shared_ptr<LogicalOperator> main_branch, std::shared_ptr<LogicalOperator> sub_branch)
+    : main_branch_(std::move(main_branch)), sub_branch_(std::move(sub_branch)) {}
+
+bool IndexedJoin::Accept(HierarchicalLogicalOperatorVisitor &visitor) {
+  if (visitor.PreVisit(*this)) {
+    main_branch_->Accept(visitor) && sub_branch_->Accept(visitor);
+  }
+  return visitor.PostVisit(*this);
+}
+
+UniqueCursorPtr IndexedJoin::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::IndexedJoinOperator);
+
+  return MakeUniqueCursorPtr<IndexedJoinCursor>(mem, *this, mem);
+}
+
+std::vector<Symbol> IndexedJoin::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = main_branch_->ModifiedSymbols(table);
+  auto sub_branch_symbols = sub_branch_->ModifiedSymbols(table);
+  symbols.insert(symbols.end(), sub_branch_symbols.begin(), sub_branch_symbols.end());
+  return symbols;
+}
+
+IndexedJoin::IndexedJoinCursor::IndexedJoinCursor(const IndexedJoin &self, utils::MemoryResource *mem)
+    : self_(self), main_branch_(self.main_branch_->MakeCursor(mem)), sub_branch_(self.sub_branch_->MakeCursor(mem)) {}
+
+bool IndexedJoin::IndexedJoinCursor::Pull(Frame &frame, ExecutionContext &context) {
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  while (true) {
+    if (pull_input_ && !main_branch_->Pull(frame, context)) {
+      return false;
+    }
+
+    if (sub_branch_->Pull(frame, context)) {
+      pull_input_ = false;
+      return true;
+    }
+    // The sub branch is exhausted for this main row, look up the next one.
+    pull_input_ = true;
+    sub_branch_->Reset();
+    AbortCheck(context);
+  }
+}
+
+void IndexedJoin::IndexedJoinCursor::Shutdown() {
+  main_branch_->Shutdown();
+  sub_branch_->Shutdown();
+}
+
+void IndexedJoin::IndexedJoinCursor::Reset() {
+  main_branch_->Reset();
+  sub_branch_->Reset();
+  pull_input_ = true;
+}
+
 OutputTable::OutputTable(std::vector<Symbol> output_symbols, std::vector<std::vector<TypedValue>> rows)
     : output_symbols_(std::move(output_symbols)), callback_([rows](Frame *, ExecutionContext *) { return rows; }) {}
 
@@ -4559,19 +6805,13 @@ std::unordered_map<std::string, int64_t> CallProcedure::GetAndResetCounters() {
 namespace {
 
 void CallCustomProcedure(const std::string_view fully_qualified_procedure_name, const mgp_proc &proc,
-                         const std::vector<Expression *> &args, mgp_graph &graph, ExpressionEvaluator *evaluator,
-                         utils::MemoryResource *memory, std::optional<size_t> memory_limit, mgp_result *result,
-                         const bool call_initializer = false) {
+                         std::vector<TypedValue> args_list, mgp_graph &graph, utils::MemoryResource *memory,
+                         std::optional<size_t> memory_limit, mgp_result *result, const bool call_initializer = false) {
   static_assert(std::uses_allocator_v<mgp_value, utils::Allocator<mgp_value>>,
                 "Expected mgp_value to use custom allocator and makes STL "
                 "containers aware of that");
   // Build and type check procedure arguments.
   mgp_list proc_args(memory);
-  std::vector<TypedValue> args_list;
-  args_list.reserve(args.size());
-  for (auto *expression : args) {
-    args_list.emplace_back(expression->Accept(*evaluator));
-  }
   std::optional<query::Graph> subgraph;
   std::optional<query::SubgraphDbAccessor> db_acc;
 
@@ -4612,11 +6852,18 @@ void CallCustomProcedure(const std::string_view fully_qualified_procedure_name,
   }
 }
 
+// Initial size of the memory of the rows yielded by a single procedure call.
+constexpr size_t kProcedureRowsInitialMemory = 64UL * 1024UL;
+
 }  // namespace
 
 class CallProcedureCursor : public Cursor {
   const CallProcedure *self_;
   UniqueCursorPtr input_cursor_;
+  // The rows are kept apart from the memory of the procedure, which is freed
+  // once the procedure returns, so only the rows stay in memory while they
+  // are pulled.
+  utils::MonotonicBufferResource rows_memory_{kProcedureRowsInitialMemory};
   mgp_result *result_;
   decltype(result_->rows.end()) result_row_it_{result_->rows.end()};
   size_t result_signature_size_{0};
@@ -4630,9 +6877,8 @@ class CallProcedureCursor : public Cursor {
         input_cursor_(self_->input_->MakeCursor(mem)),
         // result_ needs to live throughout multiple Pull evaluations, until all
         // rows are produced. We don't use the memory dedicated for QueryExecution (and Frame),
-        // but memory dedicated for procedure to wipe result_ and everything allocated in procedure all at once.
-        result_(utils::Allocator<mgp_result>(self_->memory_resource)
-                    .new_object<mgp_result>(nullptr, self_->memory_resource)) {
+        // but memory dedicated for the rows to wipe result_ all at once.
+        result_(utils::Allocator<mgp_result>(&rows_memory_).new_object<mgp_result>(nullptr, &rows_memory_)) {
     MG_ASSERT(self_->result_fields_.size() == self_->result_symbols_.size(), "Incorrectly constructed CallProcedure");
   }
 
@@ -4649,11 +6895,10 @@ class CallProcedureCursor : public Cursor {
     while (result_row_it_ == result_->rows.end()) {
       // It might be a good idea to resolve the procedure name once, at the
       // start. Unfortunately, this could deadlock if we tried to invoke a
-      // procedure from a module (read lock) and reload a module (write lock)
-      // inside the same execution thread. Also, our RWLock is setup so that
-      // it's not possible for a single thread to request multiple read locks.
+      // procedure from a module and reload that module inside the same
+      // execution thread, as reloading waits until the module isn't used.
       // Builtin module registration in query/procedure/module.cpp depends on
-      // this locking scheme.
+      // the module being found only for the duration of the call.
       const auto &maybe_found = procedure::FindProcedure(procedure::gModuleRegistry, self_->procedure_name_,
                                                          context.evaluation_context.memory);
       if (!maybe_found) {
@@ -4690,8 +6935,8 @@ class CallProcedureCursor : public Cursor {
       // Unpluging memory without calling destruct on each object since everything was allocated with this memory
       // resource
       self_->monotonic_memory.Release();
-      result_ =
-          utils::Allocator<mgp_result>(self_->memory_resource).new_object<mgp_result>(nullptr, self_->memory_resource);
+      rows_memory_.Release();
+      result_ = utils::Allocator<mgp_result>(&rows_memory_).new_object<mgp_result>(nullptr, &rows_memory_);
 
       const auto graph_view = proc->info.is_write ? storage::View::NEW : storage::View::OLD;
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
@@ -4705,8 +6950,20 @@ class CallProcedureCursor : public Cursor {
       auto *memory = self_->memory_resource;
       auto memory_limit = EvaluateMemoryLimit(evaluator, self_->memory_limit_, self_->memory_scale_);
       auto graph = mgp_graph::WritableGraph(*context.db_accessor, graph_view, context);
-      CallCustomProcedure(self_->procedure_name_, *proc, self_->arguments_, graph, &evaluator, memory, memory_limit,
-                          result_, call_initializer);
+      std::vector<TypedValue> args_list;
+      args_list.reserve(self_->arguments_.size());
+      for (auto *expression : self_->arguments_) {
+        args_list.emplace_back(expression->Accept(evaluator));
+      }
+      auto cache_key = ResultCacheKey(*proc, args_list, context);
+      if (!cache_key || !procedure::gResultCache.Find(*cache_key, context.db_accessor, graph_view, result_)) {
+        CallCustomProcedure(self_->procedure_name_, *proc, std::move(args_list), graph, memory, memory_limit, result_,
+                            call_initializer);
+        if (cache_key && !result_->error_msg) procedure::gResultCache.Insert(std::move(*cache_key), *result_);
+      }
+      // The values of the rows are copied into the rows' memory, so whatever
+      // the procedure allocated isn't needed while the rows are pulled.
+      self_->monotonic_memory.Release();
 
       if (call_initializer) call_initializer = false;
 
@@ -4752,10 +7009,25 @@ class CallProcedureCursor : public Cursor {
     return true;
   }
 
+  // Returns the key of the records of the call in the result cache, if they
+  // may be cached.
+  std::optional<procedure::ResultCache::Key> ResultCacheKey(const mgp_proc &proc,
+                                                            const std::vector<TypedValue> &args_list,
+                                                            const ExecutionContext &context) const {
+    if (!proc.info.is_deterministic || !procedure::gResultCache.Enabled()) return std::nullopt;
+#ifdef MG_ENTERPRISE
+    // The user may not see all vertices which the cached records contain.
+    if (context.auth_checker) return std::nullopt;
+#endif
+    auto snapshot = context.db_accessor->GetSnapshotId();
+    if (!snapshot) return std::nullopt;
+    return procedure::ResultCache::MakeKey(context.db_accessor->id(), self_->procedure_name_, *snapshot, args_list);
+  }
+
   void Reset() override {
     self_->monotonic_memory.Release();
-    result_ =
-        utils::Allocator<mgp_result>(self_->memory_resource).new_object<mgp_result>(nullptr, self_->memory_resource);
+    rows_memory_.Release();
+    result_ = utils::Allocator<mgp_result>(&rows_memory_).new_object<mgp_result>(nullptr, &rows_memory_);
     if (cleanup_) {
       cleanup_.value()();
     }
@@ -4763,6 +7035,7 @@ class CallProcedureCursor : public Cursor {
 
   void Shutdown() override {
     self_->monotonic_memory.Release();
+    rows_memory_.Release();
     if (cleanup_) {
       cleanup_.value()();
     }
@@ -4873,8 +7146,11 @@ auto ToOptionalString(ExpressionEvaluator *evaluator, Expression *expression) ->
   return std::nullopt;
 };
 
-TypedValue CsvRowToTypedList(csv::Reader::Row &row, std::optional<utils::pmr::string> &nullif) {
-  auto *mem = row.get_allocator().GetMemoryResource();
+// Number of rows which the CSV reader parses ahead on its own thread at once.
+constexpr size_t kLoadCsvPrefetchBatchSize = 1024;
+
+TypedValue CsvRowToTypedList(csv::Reader::Row &row, std::optional<utils::pmr::string> &nullif,
+                             utils::MemoryResource *mem) {
   auto typed_columns = utils::pmr::vector<TypedValue>(mem);
   typed_columns.reserve(row.size());
   for (auto &column : row) {
@@ -4887,16 +7163,15 @@ TypedValue CsvRowToTypedList(csv::Reader::Row &row, std::optional<utils::pmr::st
   return {std::move(typed_columns), mem};
 }
 
-TypedValue CsvRowToTypedMap(csv::Reader::Row &row, csv::Reader::Header header,
-                            std::optional<utils::pmr::string> &nullif) {
+TypedValue CsvRowToTypedMap(csv::Reader::Row &row, const csv::Reader::Header &header,
+                            std::optional<utils::pmr::string> &nullif, utils::MemoryResource *mem) {
   // a valid row has the same number of elements as the header
-  auto *mem = row.get_allocator().GetMemoryResource();
   utils::pmr::map<utils::pmr::string, TypedValue> m(mem);
   for (auto i = 0; i < row.size(); ++i) {
     if (!nullif.has_value() || row[i] != nullif.value()) {
-      m.emplace(std::move(header[i]), std::move(row[i]));
+      m.emplace(header[i], std::move(row[i]));
     } else {
-      m.emplace(std::piecewise_construct, std::forward_as_tuple(std::move(header[i])), std::forward_as_tuple());
+      m.emplace(std::piecewise_construct, std::forward_as_tuple(header[i]), std::forward_as_tuple());
     }
   }
   return {std::move(m), mem};
@@ -4945,10 +7220,9 @@ class LoadCsvCursor : public Cursor {
       return false;
     }
     if (!reader_->HasHeader()) {
-      frame[self_->row_var_] = CsvRowToTypedList(*row, nullif_);
+      frame[self_->row_var_] = CsvRowToTypedList(*row, nullif_, context.evaluation_context.memory);
     } else {
-      frame[self_->row_var_] =
-          CsvRowToTypedMap(*row, csv::Reader::Header(reader_->GetHeader(), context.evaluation_context.memory), nullif_);
+      frame[self_->row_var_] = CsvRowToTypedMap(*row, reader_->GetHeader(), nullif_, context.evaluation_context.memory);
     }
     if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(self_->row_var_.name())) {
       context.frame_change_collector->ResetTrackingValue(self_->row_var_.name());
@@ -4975,10 +7249,11 @@ class LoadCsvCursor : public Cursor {
     // Note that the reader has to be given its own memory resource, as it
     // persists between pulls, so it can't use the evalutation context memory
     // resource.
-    return csv::Reader(
-        csv::CsvSource::Create(*maybe_file),
-        csv::Reader::Config(self_->with_header_, self_->ignore_bad_, std::move(maybe_delim), std::move(maybe_quote)),
-        utils::NewDeleteResource());
+    auto config =
+        csv::Reader::Config(self_->with_header_, self_->ignore_bad_, std::move(maybe_delim), std::move(maybe_quote));
+    // The rows are parsed while the previous ones are processed by the query.
+    config.prefetch_batch_size = kLoadCsvPrefetchBatchSize;
+    return csv::Reader(csv::CsvSource::Create(*maybe_file), std::move(config), utils::NewDeleteResource());
   }
 
   std::optional<utils::pmr::string> ParseNullif(EvaluationContext *eval_context) {
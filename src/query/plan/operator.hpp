@@ -22,12 +22,16 @@
 #include "query/common.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol.hpp"
+#include "query/plan/profile.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/indices/text_index.hpp"
 #include "utils/bound.hpp"
 #include "utils/fnv.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
+#include "utils/string.hpp"
 #include "utils/synchronized.hpp"
 #include "utils/visitor.hpp"
 
@@ -35,13 +39,47 @@ namespace memgraph {
 
 namespace query {
 
+class CompiledExpression;
 struct ExecutionContext;
 class ExpressionEvaluator;
 class Frame;
+class FrameChangeCollector;
 class SymbolTable;
 
 namespace plan {
 
+/// A block of rows pulled at once by @c Cursor::PullBatch. The rows hold the
+/// values of a fixed list of symbols and are stored by column, one column for
+/// each symbol.
+class FrameBlock {
+ public:
+  FrameBlock(std::vector<Symbol> symbols, size_t capacity, utils::MemoryResource *memory);
+
+  const std::vector<Symbol> &Symbols() const { return symbols_; }
+  size_t Size() const { return size_; }
+  size_t Capacity() const { return capacity_; }
+  bool Empty() const { return size_ == 0; }
+  bool Full() const { return size_ == capacity_; }
+
+  /// Appends a row with the copies of the symbols' values in the frame.
+  void AppendRow(const Frame &frame);
+
+  /// Appends a row with the symbols' values moved out of the frame. Only used
+  /// when all of the symbols are set again before the next row.
+  void MoveRow(Frame &frame);
+
+  /// Moves the values of the row into the frame.
+  void RestoreRow(size_t row, Frame &frame, FrameChangeCollector *frame_change_collector);
+
+  void Clear();
+
+ private:
+  std::vector<Symbol> symbols_;
+  size_t capacity_;
+  size_t size_{0};
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> columns_;
+};
+
 /// Base class for iteration cursors of @c LogicalOperator classes.
 ///
 /// Each @c LogicalOperator must produce a concrete @c Cursor, which provides
@@ -61,6 +99,20 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Run iterations of a @c LogicalOperator until the empty @c FrameBlock is
+  /// full or there are no more results.
+  ///
+  /// The block holds the values of the symbols needed by the caller. The
+  /// frame is used while pulling the rows and its values are unspecified
+  /// afterwards. Batches are only pulled when
+  /// @c ExecutionContext::pull_batch_size is set, that is for read-only
+  /// queries, so pulling a row never changes the rows pulled before it.
+  ///
+  /// The default implementation calls @c Pull for every row.
+  ///
+  /// @return false if no rows were pulled.
+  virtual bool PullBatch(Frame &, FrameBlock &, ExecutionContext &);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -99,7 +151,11 @@ class ScanAllByLabel;
 class ScanAllByLabelPropertyRange;
 class ScanAllByLabelPropertyValue;
 class ScanAllByLabelProperty;
+class ScanAllByLabelProperties;
 class ScanAllById;
+class ScanAllByEdgeType;
+class ScanAllByText;
+class ScanAllByPoint;
 class Expand;
 class ExpandVariable;
 class ConstructNamedPath;
@@ -123,6 +179,8 @@ class Unwind;
 class Distinct;
 class Union;
 class Cartesian;
+class HashJoin;
+class IndexedJoin;
 class CallProcedure;
 class LoadCsv;
 class Foreach;
@@ -132,11 +190,12 @@ class Apply;
 
 using LogicalOperatorCompositeVisitor =
     utils::CompositeVisitor<Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelPropertyRange,
-                            ScanAllByLabelPropertyValue, ScanAllByLabelProperty, ScanAllById, Expand, ExpandVariable,
+                            ScanAllByLabelPropertyValue, ScanAllByLabelProperty, ScanAllByLabelProperties, ScanAllById,
+                            ScanAllByEdgeType, ScanAllByText, ScanAllByPoint, Expand, ExpandVariable,
                             ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels,
                             RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit,
-                            OrderBy, Merge, Optional, Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv,
-                            Foreach, EmptyResult, EvaluatePatternFilter, Apply>;
+                            OrderBy, Merge, Optional, Unwind, Distinct, Union, Cartesian, HashJoin, IndexedJoin,
+                            CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -374,8 +433,15 @@ class CreateNode : public memgraph::query::plan::LogicalOperator {
     void Reset() override;
 
    private:
+    bool PullCreatedBatch(Frame &, ExecutionContext &);
+
     const CreateNode &self_;
     const UniqueCursorPtr input_cursor_;
+    // Set if the input only unwinds a list, whose rows are created in batches.
+    const Unwind *batch_input_;
+    std::optional<FrameBlock> batch_rows_;
+    std::vector<VertexAccessor> batch_vertices_;
+    size_t batch_row_{0};
   };
 };
 
@@ -530,6 +596,10 @@ class ScanAll : public memgraph::query::plan::LogicalOperator {
   ScanAll(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, storage::View view = storage::View::OLD);
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  /// Makes the cursor which lets the storage skip the vertices for which the
+  /// simple conjuncts of the `filter` expression are false. The vertices
+  /// still have to be filtered by the expression.
+  UniqueCursorPtr MakeFilteredCursor(utils::MemoryResource *, Expression *filter) const;
   std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
 
   bool HasSingleInput() const override { return true; }
@@ -545,6 +615,12 @@ class ScanAll : public memgraph::query::plan::LogicalOperator {
   /// command. With @c storage::View::NEW, all vertices will be produced the current
   /// transaction sees along with their modifications.
   storage::View view_;
+  /// Symbol into which the scans by a label and a property write the value of
+  /// the property of each produced vertex. The in-memory index iterators read
+  /// it from the index entries, so the lookups of the property which the
+  /// planner replaces with the symbol don't read the vertex. Other scans
+  /// leave it unset.
+  std::optional<Symbol> indexed_value_symbol_;
 
   std::string ToString() const override { return fmt::format("ScanAll ({})", output_symbol_.name()); }
 
@@ -625,6 +701,8 @@ class ScanAllByLabelPropertyRange : public memgraph::query::plan::ScanAll {
 
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  /// @sa ScanAll::MakeFilteredCursor
+  UniqueCursorPtr MakeFilteredCursor(utils::MemoryResource *, Expression *filter) const;
 
   storage::LabelId label_;
   storage::PropertyId property_;
@@ -642,6 +720,7 @@ class ScanAllByLabelPropertyRange : public memgraph::query::plan::ScanAll {
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
     object->view_ = view_;
+    object->indexed_value_symbol_ = indexed_value_symbol_;
     object->label_ = label_;
     object->property_ = property_;
     object->property_name_ = property_name_;
@@ -689,6 +768,8 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
 
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  /// @sa ScanAll::MakeFilteredCursor
+  UniqueCursorPtr MakeFilteredCursor(utils::MemoryResource *, Expression *filter) const;
 
   storage::LabelId label_;
   storage::PropertyId property_;
@@ -705,6 +786,7 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
     object->view_ = view_;
+    object->indexed_value_symbol_ = indexed_value_symbol_;
     object->label_ = label_;
     object->property_ = property_;
     object->property_name_ = property_name_;
@@ -746,6 +828,7 @@ class ScanAllByLabelProperty : public memgraph::query::plan::ScanAll {
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
     object->view_ = view_;
+    object->indexed_value_symbol_ = indexed_value_symbol_;
     object->label_ = label_;
     object->property_ = property_;
     object->property_name_ = property_name_;
@@ -754,6 +837,199 @@ class ScanAllByLabelProperty : public memgraph::query::plan::ScanAll {
   }
 };
 
+/// Behaves like @c ScanAll, but produces only vertices with given label whose
+/// leading properties of a composite index are equal to the given values. The
+/// next property can additionally be restricted by a range.
+///
+/// @sa ScanAll
+/// @sa ScanAllByLabelPropertyRange
+/// @sa ScanAllByLabelPropertyValue
+class ScanAllByLabelProperties : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /** Bound with expression which when evaluated produces the bound value. */
+  using Bound = utils::Bound<Expression *>;
+  ScanAllByLabelProperties() {}
+  /**
+   * Constructs the operator for given label and composite index properties.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the vertices will be stored.
+   * @param label Label which the vertex must have.
+   * @param properties Properties of the composite index, in the index order.
+   * @param prefix Expressions producing the values of the leading properties.
+   * @param lower_bound Optional lower @c Bound of the property following the prefix.
+   * @param upper_bound Optional upper @c Bound of the property following the prefix.
+   * @param view storage::View used when obtaining vertices.
+   */
+  ScanAllByLabelProperties(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                           storage::LabelId label, std::vector<storage::PropertyId> properties,
+                           std::vector<std::string> property_names, std::vector<Expression *> prefix,
+                           std::optional<Bound> lower_bound, std::optional<Bound> upper_bound,
+                           storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::LabelId label_;
+  std::vector<storage::PropertyId> properties_;
+  std::vector<std::string> property_names_;
+  std::vector<Expression *> prefix_;
+  std::optional<Bound> lower_bound_;
+  std::optional<Bound> upper_bound_;
+
+  std::string ToString() const override {
+    return fmt::format("ScanAllByLabelProperties ({0} :{1} {{{2}}})", output_symbol_.name(),
+                       dba_->LabelToName(label_), utils::Join(property_names_, ", "));
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByLabelProperties>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->label_ = label_;
+    object->properties_ = properties_;
+    object->property_names_ = property_names_;
+    object->prefix_.reserve(prefix_.size());
+    for (auto *expression : prefix_) {
+      object->prefix_.push_back(expression ? expression->Clone(storage) : nullptr);
+    }
+    if (lower_bound_) {
+      object->lower_bound_.emplace(
+          utils::Bound<Expression *>(lower_bound_->value()->Clone(storage), lower_bound_->type()));
+    } else {
+      object->lower_bound_ = std::nullopt;
+    }
+    if (upper_bound_) {
+      object->upper_bound_.emplace(
+          utils::Bound<Expression *>(upper_bound_->value()->Clone(storage), upper_bound_->type()));
+    } else {
+      object->upper_bound_ = std::nullopt;
+    }
+    return object;
+  }
+};
+
+/// Behaves like @c ScanAll, but produces only the vertices with the given
+/// label whose string value of the property matches the pattern. The
+/// vertices are looked up in the text index on the label and the property.
+class ScanAllByText : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ScanAllByText() {}
+  /**
+   * Constructs the operator for the given label, property and pattern.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the vertices will be stored.
+   * @param label Label which the vertex must have.
+   * @param property Property whose value is matched.
+   * @param property_name Name of the property, used for printing.
+   * @param match How the value is matched against the pattern.
+   * @param expression Expression producing the pattern.
+   * @param view storage::View used when obtaining vertices.
+   */
+  ScanAllByText(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, storage::LabelId label,
+                storage::PropertyId property, std::string property_name, storage::TextMatch match,
+                Expression *expression, storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::LabelId label_;
+  storage::PropertyId property_;
+  std::string property_name_;
+  storage::TextMatch match_;
+  Expression *expression_;
+
+  std::string ToString() const override {
+    static constexpr std::string_view kMatchNames[] = {"STARTS WITH", "ENDS WITH", "CONTAINS"};
+    return fmt::format("ScanAllByText ({0} :{1} {{{2}}} {3})", output_symbol_.name(), dba_->LabelToName(label_),
+                       property_name_, kMatchNames[static_cast<uint8_t>(match_)]);
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByText>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->label_ = label_;
+    object->property_ = property_;
+    object->property_name_ = property_name_;
+    object->match_ = match_;
+    object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
+    return object;
+  }
+};
+
+/// Behaves like @c ScanAll, but produces only the vertices with the given
+/// label whose point value of the property is in a region. The vertices are
+/// looked up in the point index on the label and the property.
+class ScanAllByPoint : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ScanAllByPoint() {}
+  /**
+   * Constructs the operator for the given label, property and region.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param output_symbol Symbol where the vertices will be stored.
+   * @param label Label which the vertex must have.
+   * @param property Property whose point value must be in the region.
+   * @param property_name Name of the property, used for printing.
+   * @param region_type Whether the region is a circle or a box.
+   * @param lower_or_center Expression producing the center of a circle or
+   *     the lower corner of a box.
+   * @param upper_or_radius Expression producing the radius of a circle or
+   *     the upper corner of a box.
+   * @param inclusive Whether the points at the radius are in the circle.
+   * @param view storage::View used when obtaining vertices.
+   */
+  ScanAllByPoint(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, storage::LabelId label,
+                 storage::PropertyId property, std::string property_name, storage::PointRegion::Type region_type,
+                 Expression *lower_or_center, Expression *upper_or_radius, bool inclusive,
+                 storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::LabelId label_;
+  storage::PropertyId property_;
+  std::string property_name_;
+  storage::PointRegion::Type region_type_;
+  Expression *lower_or_center_;
+  Expression *upper_or_radius_;
+  bool inclusive_;
+
+  std::string ToString() const override {
+    return fmt::format("ScanAllByPoint ({0} :{1} {{{2}}} {3})", output_symbol_.name(), dba_->LabelToName(label_),
+                       property_name_,
+                       region_type_ == storage::PointRegion::Type::WITHIN_DISTANCE ? "WITHIN DISTANCE" : "WITHIN BOX");
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByPoint>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->label_ = label_;
+    object->property_ = property_;
+    object->property_name_ = property_name_;
+    object->region_type_ = region_type_;
+    object->lower_or_center_ = lower_or_center_ ? lower_or_center_->Clone(storage) : nullptr;
+    object->upper_or_radius_ = upper_or_radius_ ? upper_or_radius_->Clone(storage) : nullptr;
+    object->inclusive_ = inclusive_;
+    return object;
+  }
+};
+
 /// ScanAll producing a single node with ID equal to evaluated expression
 class ScanAllById : public memgraph::query::plan::ScanAll {
  public:
@@ -803,6 +1079,89 @@ struct ExpandCommon {
   bool existing_node;
 };
 
+/// Scans the edges of a single type by the edge type index, or by the edge
+/// type+property index when a property is given. Both endpoints of each edge
+/// are placed on the frame, so the operator does the work of a `ScanAll` of
+/// the start node followed by an `Expand` over that edge type.
+class ScanAllByEdgeType : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /** Bound with expression which when evaluated produces the bound value. */
+  using Bound = utils::Bound<Expression *>;
+  ScanAllByEdgeType() {}
+  /**
+   * Constructs the operator for the given edge type and an optional property.
+   *
+   * @param input Preceding operator which will serve as the input.
+   * @param input_symbol Symbol where the start node of the pattern will be stored.
+   * @param common Symbols of the edge and of its other end, the direction
+   *    relative to the start node and the single edge type being scanned. The
+   *    direction can't be BOTH and the other end can't be an existing node.
+   * @param property Optional property of the edge type+property index.
+   * @param property_name Name of the property, used for printing.
+   * @param expression Optional expression producing the property value.
+   * @param lower_bound Optional lower @c Bound of the property value.
+   * @param upper_bound Optional upper @c Bound of the property value.
+   * @param view storage::View used when obtaining edges.
+   */
+  ScanAllByEdgeType(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, ExpandCommon common,
+                    std::optional<storage::PropertyId> property = std::nullopt, std::string property_name = "",
+                    Expression *expression = nullptr, std::optional<Bound> lower_bound = std::nullopt,
+                    std::optional<Bound> upper_bound = std::nullopt, storage::View view = storage::View::OLD);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol input_symbol_;
+  memgraph::query::plan::ExpandCommon common_;
+  std::optional<storage::PropertyId> property_;
+  std::string property_name_;
+  Expression *expression_{nullptr};
+  std::optional<Bound> lower_bound_;
+  std::optional<Bound> upper_bound_;
+  storage::View view_;
+
+  std::string ToString() const override {
+    return fmt::format("ScanAllByEdgeType ({}){}[{}:{}{}]{}({})", input_symbol_.name(),
+                       common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", common_.edge_symbol.name(),
+                       dba_->EdgeTypeToName(common_.edge_types.front()),
+                       property_ ? fmt::format(" {{{}}}", property_name_) : "",
+                       common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name());
+  }
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByEdgeType>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->input_symbol_ = input_symbol_;
+    object->common_ = common_;
+    object->property_ = property_;
+    object->property_name_ = property_name_;
+    object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
+    if (lower_bound_) {
+      object->lower_bound_.emplace(
+          utils::Bound<Expression *>(lower_bound_->value()->Clone(storage), lower_bound_->type()));
+    } else {
+      object->lower_bound_ = std::nullopt;
+    }
+    if (upper_bound_) {
+      object->upper_bound_.emplace(
+          utils::Bound<Expression *>(upper_bound_->value()->Clone(storage), upper_bound_->type()));
+    } else {
+      object->upper_bound_ = std::nullopt;
+    }
+    object->view_ = view_;
+    return object;
+  }
+};
+
 struct ExpansionInfo {
   std::optional<VertexAccessor> input_node;
   EdgeAtom::Direction direction;
@@ -854,6 +1213,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpandCursor(const Expand &, utils::MemoryResource *);
     ExpandCursor(const Expand &, int64_t input_degree, int64_t existing_node_degree, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBlock &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
     ExpansionInfo GetExpansionInfo(Frame &);
@@ -877,8 +1237,14 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     ExpansionInfo expansion_info_;
     int64_t prev_input_degree_{-1};
     int64_t prev_existing_degree_{-1};
+    // In the on-disk storage the input is pulled in batches, so the edges of
+    // the vertices of a whole batch are read from the disk together.
+    std::optional<std::vector<Symbol>> input_symbols_;
+    utils::pmr::deque<utils::pmr::vector<TypedValue>> input_batch_;
 
+    bool PullRow(Frame &, ExecutionContext &);
     bool InitEdges(Frame &, ExecutionContext &);
+    bool PullInput(Frame &, ExecutionContext &);
   };
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
@@ -1121,6 +1487,16 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   std::vector<std::shared_ptr<memgraph::query::plan::LogicalOperator>> pattern_filters_;
   Expression *expression_;
 
+  /// A conjunct of the expression comparing a property of a symbol with a
+  /// literal or a parameter. The cursor checks it against the property store
+  /// of the vertex or edge without evaluating the property lookup.
+  struct PropertyEquality {
+    EqualOperator *expression;
+    Identifier *identifier;
+    PropertyIx property;
+    Expression *value;
+  };
+
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
     auto object = std::make_unique<Filter>();
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
@@ -1136,7 +1512,9 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   class FilterCursor : public Cursor {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
+    ~FilterCursor() override;
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBlock &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1144,6 +1522,22 @@ class Filter : public memgraph::query::plan::LogicalOperator {
     const Filter &self_;
     const UniqueCursorPtr input_cursor_;
     const std::vector<UniqueCursorPtr> pattern_filter_cursors_;
+    std::optional<FrameBlock> input_block_;
+    std::vector<PropertyEquality> property_equalities_;
+    // Conjuncts of the expression which aren't property equalities, compiled
+    // when the cursor is made.
+    std::vector<CompiledExpression> conjuncts_;
+    // Values of the property equalities, evaluated on the first pull.
+    // std::nullopt for those the expression evaluator has to check.
+    std::optional<std::vector<std::optional<storage::PropertyValue>>> equality_values_;
+    // Rows of the filter counted in the execution context, looked up on the
+    // first pull. `nullptr` if they aren't counted.
+    FilterRows *observed_rows_{nullptr};
+    bool observed_rows_looked_up_{false};
+
+    void LookUpObservedRows(ExecutionContext &);
+
+    bool EvaluateConjuncts(Frame &, ExecutionContext &, ExpressionEvaluator &);
   };
 };
 
@@ -1196,12 +1590,14 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBlock &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
     const Produce &self_;
     const UniqueCursorPtr input_cursor_;
+    std::optional<FrameBlock> input_block_;
   };
 };
 
@@ -1829,6 +2225,12 @@ class EvaluatePatternFilter : public memgraph::query::plan::LogicalOperator {
    private:
     const EvaluatePatternFilter &self_;
     UniqueCursorPtr input_cursor_;
+    // The Expand of the input if the input only checks if a node has edges,
+    // which is then checked without pulling the input.
+    const Expand *edges_check_;
+    // The ExpandVariable of the input if the input only checks if a node is
+    // reachable, which is then checked with a breadth-first search.
+    const ExpandVariable *reachability_check_;
   };
 };
 
@@ -1909,7 +2311,7 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   OrderBy() {}
 
   OrderBy(const std::shared_ptr<LogicalOperator> &input, const std::vector<SortItem> &order_by,
-          const std::vector<Symbol> &output_symbols);
+          const std::vector<Symbol> &output_symbols, Expression *skip = nullptr, Expression *limit = nullptr);
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
   std::vector<Symbol> OutputSymbols(const SymbolTable &) const override;
@@ -1923,6 +2325,11 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   TypedValueVectorCompare compare_;
   std::vector<Expression *> order_by_;
   std::vector<Symbol> output_symbols_;
+  /// Skip and limit of the Skip and Limit which directly follow this
+  /// operator. If the limit is set, only the first skip + limit rows are
+  /// kept while sorting.
+  Expression *skip_{nullptr};
+  Expression *limit_{nullptr};
 
   std::string ToString() const override {
     return fmt::format("OrderBy {{{}}}",
@@ -1938,6 +2345,8 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
       object->order_by_[i6] = order_by_[i6] ? order_by_[i6]->Clone(storage) : nullptr;
     }
     object->output_symbols_ = output_symbols_;
+    object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
+    object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -2004,6 +2413,19 @@ class Merge : public memgraph::query::plan::LogicalOperator {
     //  - first Pulling from this cursor
     //  - previous Pull from this cursor exhausted the merge_match_cursor
     bool pull_input_{true};
+
+    // The node of the pattern, if it's a single node which can be found by the
+    // values of a unique constraint instead of by `merge_match_cursor_`.
+    const NodeCreationInfo *const unique_node_;
+    // The unique constraint on the node, chosen on the first Pull.
+    std::optional<std::pair<storage::LabelId, std::set<storage::PropertyId>>> unique_key_;
+    bool unique_key_chosen_{false};
+
+    /**
+     * Finds the node by the unique constraint on it, or creates it. Returns
+     * nothing if the regular branches have to be pulled for the row.
+     */
+    std::optional<bool> PullUniqueKey(Frame &, ExecutionContext &);
   };
 };
 
@@ -2225,6 +2647,111 @@ class Cartesian : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Joins the rows of two independent input branches on an equality, like
+/// @c Cartesian followed by a @c Filter with the join condition does.
+///
+/// All rows of the left branch are pulled once and stored in a hash table by
+/// the value of the condition's first expression, which may use only the left
+/// symbols. Each row of the right branch is then joined with the stored rows
+/// whose value equals the value of the condition's second expression, which
+/// may use only the right symbols. Null values never join with anything.
+///
+/// An optional join yields the right rows which join with no left row too,
+/// with the left symbols set to Null, like @c Optional with the left branch as
+/// its optional branch does.
+class HashJoin : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  HashJoin() {}
+  /** Construct the operator with left input branch, right input branch and the join condition. */
+  HashJoin(const std::shared_ptr<LogicalOperator> &left_op, const std::vector<Symbol> &left_symbols,
+           const std::shared_ptr<LogicalOperator> &right_op, const std::vector<Symbol> &right_symbols,
+           EqualOperator *hash_join_condition, bool optional = false)
+      : left_op_(left_op),
+        left_symbols_(left_symbols),
+        right_op_(right_op),
+        right_symbols_(right_symbols),
+        hash_join_condition_(hash_join_condition),
+        optional_(optional) {}
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override;
+  std::shared_ptr<LogicalOperator> input() const override;
+  void set_input(std::shared_ptr<LogicalOperator>) override;
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> left_op_;
+  std::vector<Symbol> left_symbols_;
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> right_op_;
+  std::vector<Symbol> right_symbols_;
+  EqualOperator *hash_join_condition_;
+  bool optional_{false};
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<HashJoin>();
+    object->left_op_ = left_op_ ? left_op_->Clone(storage) : nullptr;
+    object->left_symbols_ = left_symbols_;
+    object->right_op_ = right_op_ ? right_op_->Clone(storage) : nullptr;
+    object->right_symbols_ = right_symbols_;
+    object->hash_join_condition_ = hash_join_condition_ ? hash_join_condition_->Clone(storage) : nullptr;
+    object->optional_ = optional_;
+    return object;
+  }
+};
+
+/// Joins each row of the main branch with the rows of the sub branch, which
+/// is pulled anew for every main row.
+///
+/// The sub branch starts with the symbols bound by the main branch and looks
+/// up only the joining rows by an index, instead of scanning everything and
+/// filtering by the join condition like @c Cartesian or building a hash table
+/// of the whole branch like @c HashJoin.
+class IndexedJoin : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  IndexedJoin() {}
+  IndexedJoin(std::shared_ptr<LogicalOperator> main_branch, std::shared_ptr<LogicalOperator> sub_branch);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return main_branch_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { main_branch_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> main_branch_;
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> sub_branch_;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<IndexedJoin>();
+    object->main_branch_ = main_branch_ ? main_branch_->Clone(storage) : nullptr;
+    object->sub_branch_ = sub_branch_ ? sub_branch_->Clone(storage) : nullptr;
+    return object;
+  }
+
+ private:
+  class IndexedJoinCursor : public Cursor {
+   public:
+    IndexedJoinCursor(const IndexedJoin &, utils::MemoryResource *);
+    bool Pull(Frame &, ExecutionContext &) override;
+    void Shutdown() override;
+    void Reset() override;
+
+   private:
+    const IndexedJoin &self_;
+    UniqueCursorPtr main_branch_;
+    UniqueCursorPtr sub_branch_;
+    bool pull_input_{true};
+  };
+};
+
 /// An operator that outputs a table, producing a single row on each pull
 class OutputTable : public memgraph::query::plan::LogicalOperator {
  public:
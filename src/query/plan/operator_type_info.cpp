@@ -47,9 +47,21 @@ constexpr utils::TypeInfo query::plan::ScanAllByLabelPropertyValue::kType{
 constexpr utils::TypeInfo query::plan::ScanAllByLabelProperty::kType{
     utils::TypeId::SCAN_ALL_BY_LABEL_PROPERTY, "ScanAllByLabelProperty", &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByLabelProperties::kType{
+    utils::TypeId::SCAN_ALL_BY_LABEL_PROPERTIES, "ScanAllByLabelProperties", &query::plan::ScanAll::kType};
+
 constexpr utils::TypeInfo query::plan::ScanAllById::kType{utils::TypeId::SCAN_ALL_BY_ID, "ScanAllById",
                                                           &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByEdgeType::kType{
+    utils::TypeId::SCAN_ALL_BY_EDGE_TYPE, "ScanAllByEdgeType", &query::plan::LogicalOperator::kType};
+
+constexpr utils::TypeInfo query::plan::ScanAllByText::kType{utils::TypeId::SCAN_ALL_BY_TEXT, "ScanAllByText",
+                                                            &query::plan::ScanAll::kType};
+
+constexpr utils::TypeInfo query::plan::ScanAllByPoint::kType{utils::TypeId::SCAN_ALL_BY_POINT, "ScanAllByPoint",
+                                                             &query::plan::ScanAll::kType};
+
 constexpr utils::TypeInfo query::plan::ExpandCommon::kType{utils::TypeId::EXPAND_COMMON, "ExpandCommon", nullptr};
 
 constexpr utils::TypeInfo query::plan::Expand::kType{utils::TypeId::EXPAND, "Expand",
@@ -131,6 +143,12 @@ constexpr utils::TypeInfo query::plan::Union::kType{utils::TypeId::UNION, "Union
 constexpr utils::TypeInfo query::plan::Cartesian::kType{utils::TypeId::CARTESIAN, "Cartesian",
                                                         &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::HashJoin::kType{utils::TypeId::HASH_JOIN, "HashJoin",
+                                                       &query::plan::LogicalOperator::kType};
+
+constexpr utils::TypeInfo query::plan::IndexedJoin::kType{utils::TypeId::INDEXED_JOIN, "IndexedJoin",
+                                                          &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::OutputTable::kType{utils::TypeId::OUTPUT_TABLE, "OutputTable",
                                                           &query::plan::LogicalOperator::kType};
 
@@ -0,0 +1,39 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/planner.hpp"
+
+#include <cstdint>
+#include <limits>
+
+#include "utils/flag_validation.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_planning_threads, 0U,
+                        "Number of threads estimating the costs of the alternative plans of a query. With 0, the "
+                        "costs are estimated by the thread planning the query.",
+                        FLAG_IN_RANGE(0, 64));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_double(query_plan_cost_bound, 0.0,
+                        "The cost planner stops considering the alternative plans of a query once it finds a plan "
+                        "whose estimated cost is at most this bound. With 0, all of the plans are considered.",
+                        FLAG_IN_RANGE(0.0, std::numeric_limits<double>::max()));
+
+namespace memgraph::query::plan {
+
+utils::ThreadPool *PlanningThreadPool() {
+  if (FLAGS_query_planning_threads == 0) return nullptr;
+  // The flag is read only once, the pool lives until the process exits.
+  static utils::ThreadPool pool(FLAGS_query_planning_threads);
+  return &pool;
+}
+
+}  // namespace memgraph::query::plan
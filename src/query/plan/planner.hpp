@@ -17,6 +17,15 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
 #include "query/plan/cost_estimator.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/preprocess.hpp"
@@ -25,6 +34,10 @@
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/variable_start_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
+#include "utils/thread_pool.hpp"
+
+DECLARE_uint64(query_planning_threads);
+DECLARE_double(query_plan_cost_bound);
 
 namespace memgraph::query {
 
@@ -71,6 +84,91 @@ auto MakeLogicalPlanForSingleQuery(QueryParts query_parts, PlanningContext<TDbAc
   return TPlanner<PlanningContext<TDbAccessor>>(context).Plan(query_parts);
 }
 
+/// Returns the pool of the threads estimating the costs of the alternative
+/// plans, or nullptr if the planning thread estimates them.
+utils::ThreadPool *PlanningThreadPool();
+
+namespace impl {
+
+/// Estimates the costs of the `plans`, which are rewritten first, on the
+/// planning thread pool, and returns the one with the least cost together with
+/// its cost. Of the plans with the same cost the first one is chosen, like
+/// when the costs are estimated one by one. Every estimation uses its own copy
+/// of the `vertex_counts`, whose lookups are merged back into them by the
+/// planning thread.
+template <class TPlans, class TPlanningContext, class TPlanPostProcess, class TVertexCounts>
+auto ChooseLeastCostPlanConcurrently(TPlans plans, TPlanningContext *context, TPlanPostProcess *post_process,
+                                     TVertexCounts *vertex_counts, utils::ThreadPool *pool) {
+  using ProcessedPlan = typename TPlanPostProcess::ProcessedPlan;
+  struct State {
+    std::mutex lock;
+    std::condition_variable cv;
+    size_t pending{0};
+    std::optional<ProcessedPlan> best_plan;
+    double best_cost{std::numeric_limits<double>::max()};
+    size_t best_index{0};
+    std::vector<std::shared_ptr<TVertexCounts>> estimated_counts;
+    std::exception_ptr error;
+  } state;
+  auto merge_estimated_counts = [&] {
+    std::vector<std::shared_ptr<TVertexCounts>> estimated_counts;
+    {
+      std::lock_guard guard(state.lock);
+      estimated_counts.swap(state.estimated_counts);
+    }
+    for (const auto &counts : estimated_counts) vertex_counts->Merge(*counts);
+  };
+  // Rewritten plans waiting for their costs are kept in memory, so only a few
+  // of them are generated ahead of the estimations.
+  const size_t max_pending = 2 * FLAGS_query_planning_threads;
+
+  size_t index = 0;
+  for (auto plan : plans) {
+    {
+      std::unique_lock guard(state.lock);
+      state.cv.wait(guard, [&] { return state.pending < max_pending; });
+      if (state.error) break;
+      if (state.best_plan && state.best_cost <= FLAGS_query_plan_cost_bound) break;
+      ++state.pending;
+    }
+    merge_estimated_counts();
+    // Rewriting adds expressions to the AST storage, so it isn't concurrent.
+    auto rewritten_plan = std::make_shared<ProcessedPlan>(post_process->Rewrite(std::move(plan), context));
+    auto counts = std::make_shared<TVertexCounts>(*vertex_counts);
+    pool->AddTask([&state, &table = *context->symbol_table, post_process, rewritten_plan, counts, index] {
+      std::optional<double> cost;
+      std::exception_ptr error;
+      try {
+        cost = post_process->EstimatePlanCost(*rewritten_plan, counts.get(), table);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      std::lock_guard guard(state.lock);
+      if (error && !state.error) state.error = error;
+      const bool is_better = cost && (!state.best_plan || *cost < state.best_cost ||
+                                      (*cost == state.best_cost && index < state.best_index));
+      if (is_better) {
+        state.best_plan.emplace(std::move(*rewritten_plan));
+        state.best_cost = *cost;
+        state.best_index = index;
+      }
+      state.estimated_counts.push_back(counts);
+      --state.pending;
+      state.cv.notify_all();
+    });
+    ++index;
+  }
+  {
+    std::unique_lock guard(state.lock);
+    state.cv.wait(guard, [&] { return state.pending == 0; });
+  }
+  merge_estimated_counts();
+  if (state.error) std::rethrow_exception(state.error);
+  return std::make_pair(std::move(state.best_plan), state.best_cost);
+}
+
+}  // namespace impl
+
 /// Generates the LogicalOperator tree and returns the resulting plan.
 ///
 /// @tparam TPlanningContext Type of the context used.
@@ -94,14 +192,28 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
   std::optional<ProcessedPlan> curr_plan;
   if (use_variable_planner) {
     auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(query_parts, context);
-    for (auto plan : plans) {
-      // Plans are generated lazily and the current plan will disappear, so
-      // it's ok to move it.
-      auto rewritten_plan = post_process->Rewrite(std::move(plan), context);
-      double cost = post_process->EstimatePlanCost(rewritten_plan, &vertex_counts, *context->symbol_table);
-      if (!curr_plan || cost < total_cost) {
-        curr_plan.emplace(std::move(rewritten_plan));
-        total_cost = cost;
+    using TVertexCounts = std::remove_reference_t<decltype(vertex_counts)>;
+    constexpr bool kConcurrentCosts =
+        std::is_copy_constructible_v<TVertexCounts> &&
+        requires(TVertexCounts & counts, const TVertexCounts &other) { counts.Merge(other); };
+    auto *pool = PlanningThreadPool();
+    if constexpr (kConcurrentCosts) {
+      if (pool) {
+        std::tie(curr_plan, total_cost) =
+            impl::ChooseLeastCostPlanConcurrently(std::move(plans), context, post_process, &vertex_counts, pool);
+      }
+    }
+    if (!kConcurrentCosts || !pool) {
+      for (auto plan : plans) {
+        // Plans are generated lazily and the current plan will disappear, so
+        // it's ok to move it.
+        auto rewritten_plan = post_process->Rewrite(std::move(plan), context);
+        double cost = post_process->EstimatePlanCost(rewritten_plan, &vertex_counts, *context->symbol_table);
+        if (!curr_plan || cost < total_cost) {
+          curr_plan.emplace(std::move(rewritten_plan));
+          total_cost = cost;
+        }
+        if (total_cost <= FLAGS_query_plan_cost_bound) break;
       }
     }
   } else {
@@ -128,6 +128,29 @@ PropertyFilter::PropertyFilter(const SymbolTable &symbol_table, const Symbol &sy
   is_symbol_in_value_ = utils::Contains(collector.symbols_, symbol);
 }
 
+PropertyFilter::PropertyFilter(const SymbolTable &symbol_table, const Symbol &symbol, PropertyIx property, Type type,
+                               Expression *value, const std::optional<PropertyFilter::Bound> &lower_bound,
+                               const std::optional<PropertyFilter::Bound> &upper_bound)
+    : symbol_(symbol),
+      property_(property),
+      type_(type),
+      value_(value),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {
+  MG_ASSERT(type == Type::POINT_DISTANCE || type == Type::POINT_BBOX);
+  UsedSymbolsCollector collector(symbol_table);
+  if (value) {
+    value->Accept(collector);
+  }
+  if (lower_bound) {
+    lower_bound->value()->Accept(collector);
+  }
+  if (upper_bound) {
+    upper_bound->value()->Accept(collector);
+  }
+  is_symbol_in_value_ = utils::Contains(collector.symbols_, symbol);
+}
+
 PropertyFilter::PropertyFilter(const Symbol &symbol, PropertyIx property, Type type)
     : symbol_(symbol), property_(property), type_(type) {
   // As this constructor is used for property filters where
@@ -319,6 +342,67 @@ void Filters::AnalyzeAndStoreFilter(Expression *expr, const SymbolTable &symbol_
     }
     return false;
   };
+  // Like add_prop_equal, but for the STARTS WITH, ENDS WITH and CONTAINS
+  // operators, which are parsed as function calls. The property lookup has to
+  // be the first argument, since the operators aren't symmetric.
+  auto add_prop_string_match = [&](auto *maybe_string_match) -> bool {
+    auto *function = utils::Downcast<Function>(maybe_string_match);
+    if (!function || function->arguments_.size() != 2U) return false;
+    PropertyFilter::Type type;
+    if (function->function_name_ == kStartsWith) {
+      type = PropertyFilter::Type::STARTS_WITH;
+    } else if (function->function_name_ == kEndsWith) {
+      type = PropertyFilter::Type::ENDS_WITH;
+    } else if (function->function_name_ == kContains) {
+      type = PropertyFilter::Type::CONTAINS;
+    } else {
+      return false;
+    }
+    PropertyLookup *prop_lookup = nullptr;
+    Identifier *ident = nullptr;
+    if (!get_property_lookup(function->arguments_[0], prop_lookup, ident)) return false;
+    auto filter = make_filter(FilterInfo::Type::Property);
+    filter.property_filter = PropertyFilter(symbol_table, symbol_table.at(*ident), prop_lookup->property_,
+                                            function->arguments_[1], type);
+    all_filters_.emplace_back(filter);
+    return true;
+  };
+  // Checks if maybe_distance is the distance between a property lookup and
+  // another expression, which is less than `radius`. Both arguments are tried
+  // as the property lookup, like in add_prop_greater.
+  auto add_prop_point_distance = [&](auto *maybe_distance, auto *radius, auto bound_type) -> bool {
+    auto *function = utils::Downcast<Function>(maybe_distance);
+    if (!function || function->function_name_ != kDistance || function->arguments_.size() != 2U) return false;
+    bool is_prop_filter = false;
+    for (auto i = 0U; i < 2U; ++i) {
+      PropertyLookup *prop_lookup = nullptr;
+      Identifier *ident = nullptr;
+      if (!get_property_lookup(function->arguments_[i], prop_lookup, ident)) continue;
+      auto filter = make_filter(FilterInfo::Type::Property);
+      filter.property_filter =
+          PropertyFilter(symbol_table, symbol_table.at(*ident), prop_lookup->property_,
+                         PropertyFilter::Type::POINT_DISTANCE, function->arguments_[1U - i], std::nullopt,
+                         Bound(radius, bound_type));
+      all_filters_.emplace_back(filter);
+      is_prop_filter = true;
+    }
+    return is_prop_filter;
+  };
+  // Checks if maybe_within_bbox is `withinbbox(n.prop, lower, upper)`.
+  auto add_prop_point_bbox = [&](auto *maybe_within_bbox) -> bool {
+    auto *function = utils::Downcast<Function>(maybe_within_bbox);
+    if (!function || function->function_name_ != kWithinBBox || function->arguments_.size() != 3U) return false;
+    PropertyLookup *prop_lookup = nullptr;
+    Identifier *ident = nullptr;
+    if (!get_property_lookup(function->arguments_[0], prop_lookup, ident)) return false;
+    auto filter = make_filter(FilterInfo::Type::Property);
+    filter.property_filter = PropertyFilter(symbol_table, symbol_table.at(*ident), prop_lookup->property_,
+                                            PropertyFilter::Type::POINT_BBOX, nullptr,
+                                            Bound(function->arguments_[1], Bound::Type::INCLUSIVE),
+                                            Bound(function->arguments_[2], Bound::Type::INCLUSIVE));
+    all_filters_.emplace_back(filter);
+    return true;
+  };
   // Checks if either the expr1 and expr2 are property lookups, adds them as
   // PropertyFilter and returns true. Otherwise, returns false.
   auto add_prop_greater = [&](auto *expr1, auto *expr2, auto bound_type) -> bool {
@@ -440,21 +524,30 @@ void Filters::AnalyzeAndStoreFilter(Expression *expr, const SymbolTable &symbol_
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *gt = utils::Downcast<GreaterOperator>(expr)) {
-    if (!add_prop_greater(gt->expression1_, gt->expression2_, Bound::Type::EXCLUSIVE)) {
+    bool is_prop_filter = add_prop_greater(gt->expression1_, gt->expression2_, Bound::Type::EXCLUSIVE);
+    // `radius > distance(n.prop, value)`
+    is_prop_filter |= add_prop_point_distance(gt->expression2_, gt->expression1_, Bound::Type::EXCLUSIVE);
+    if (!is_prop_filter) {
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *ge = utils::Downcast<GreaterEqualOperator>(expr)) {
-    if (!add_prop_greater(ge->expression1_, ge->expression2_, Bound::Type::INCLUSIVE)) {
+    bool is_prop_filter = add_prop_greater(ge->expression1_, ge->expression2_, Bound::Type::INCLUSIVE);
+    is_prop_filter |= add_prop_point_distance(ge->expression2_, ge->expression1_, Bound::Type::INCLUSIVE);
+    if (!is_prop_filter) {
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *lt = utils::Downcast<LessOperator>(expr)) {
     // Like greater, but in reverse.
-    if (!add_prop_greater(lt->expression2_, lt->expression1_, Bound::Type::EXCLUSIVE)) {
+    bool is_prop_filter = add_prop_greater(lt->expression2_, lt->expression1_, Bound::Type::EXCLUSIVE);
+    is_prop_filter |= add_prop_point_distance(lt->expression1_, lt->expression2_, Bound::Type::EXCLUSIVE);
+    if (!is_prop_filter) {
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *le = utils::Downcast<LessEqualOperator>(expr)) {
     // Like greater equal, but in reverse.
-    if (!add_prop_greater(le->expression2_, le->expression1_, Bound::Type::INCLUSIVE)) {
+    bool is_prop_filter = add_prop_greater(le->expression2_, le->expression1_, Bound::Type::INCLUSIVE);
+    is_prop_filter |= add_prop_point_distance(le->expression1_, le->expression2_, Bound::Type::INCLUSIVE);
+    if (!is_prop_filter) {
       all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
     }
   } else if (auto *in = utils::Downcast<InListOperator>(expr)) {
@@ -471,6 +564,10 @@ void Filters::AnalyzeAndStoreFilter(Expression *expr, const SymbolTable &symbol_
     }
   } else if (auto *exists = utils::Downcast<Exists>(expr)) {
     all_filters_.emplace_back(make_filter(FilterInfo::Type::Pattern));
+  } else if (utils::Downcast<Function>(expr)) {
+    if (!add_prop_string_match(expr) && !add_prop_point_bbox(expr)) {
+      all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
+    }
   } else {
     all_filters_.emplace_back(make_filter(FilterInfo::Type::Generic));
   }
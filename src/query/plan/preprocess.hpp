@@ -217,13 +217,33 @@ class PropertyFilter {
 
   /// Depending on type, this PropertyFilter may be a value equality, regex
   /// matched value or a range with lower and (or) upper bounds, IN list filter.
-  enum class Type { EQUAL, REGEX_MATCH, RANGE, IN, IS_NOT_NULL };
+  /// The STARTS_WITH, ENDS_WITH and CONTAINS filters match the value against
+  /// a string pattern. The POINT_DISTANCE and POINT_BBOX filters check that
+  /// the value is a point in a region.
+  enum class Type {
+    EQUAL,
+    REGEX_MATCH,
+    RANGE,
+    IN,
+    IS_NOT_NULL,
+    STARTS_WITH,
+    ENDS_WITH,
+    CONTAINS,
+    POINT_DISTANCE,
+    POINT_BBOX
+  };
 
-  /// Construct with Expression being the equality or regex match check.
+  /// Construct with Expression being the equality, regex or string pattern
+  /// match check.
   PropertyFilter(const SymbolTable &, const Symbol &, PropertyIx, Expression *, Type);
   /// Construct the range based filter.
   PropertyFilter(const SymbolTable &, const Symbol &, PropertyIx, const std::optional<Bound> &,
                  const std::optional<Bound> &);
+  /// Construct a point filter. POINT_DISTANCE filters have the center in the
+  /// value and the radius in the upper bound. POINT_BBOX filters have the
+  /// corners of the box in the lower and the upper bound.
+  PropertyFilter(const SymbolTable &, const Symbol &, PropertyIx, Type, Expression *, const std::optional<Bound> &,
+                 const std::optional<Bound> &);
   /// Construct a filter without an expression that produces a value.
   /// Used for the "PROP IS NOT NULL" filter, and can be used for any
   /// property filter that doesn't need to use an expression to produce
@@ -237,7 +257,8 @@ class PropertyFilter {
   /// True if the same symbol is used in expressions for value or bounds.
   bool is_symbol_in_value_ = false;
   /// Expression which when evaluated produces the value a property must
-  /// equal or regex match depending on type_.
+  /// equal, regex match or string match depending on type_, or the center of
+  /// a POINT_DISTANCE filter.
   Expression *value_ = nullptr;
   /// Expressions which produce lower and upper bounds for a property.
   std::optional<Bound> lower_bound_{};
@@ -71,11 +71,39 @@ bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperty &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllByLabelProperties &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
 bool PlanPrinter::PreVisit(ScanAllById &op) {
   WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllByEdgeType &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::ScanAllByText &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::ScanAllByPoint &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Expand &op) {
   op.dba_ = dba_;
   WithPrintLn([&](auto &out) { out << "* " << op.ToString(); });
@@ -172,6 +200,26 @@ bool PlanPrinter::PreVisit(query::plan::Cartesian &op) {
   return false;
 }
 
+bool PlanPrinter::PreVisit(query::plan::HashJoin &op) {
+  WithPrintLn([&op](auto &out) {
+    out << (op.optional_ ? "* OptionalHashJoin {" : "* HashJoin {");
+    utils::PrintIterable(out, op.left_symbols_, ", ", [](auto &out, const auto &sym) { out << sym.name(); });
+    out << " : ";
+    utils::PrintIterable(out, op.right_symbols_, ", ", [](auto &out, const auto &sym) { out << sym.name(); });
+    out << "}";
+  });
+  Branch(*op.right_op_);
+  op.left_op_->Accept(*this);
+  return false;
+}
+
+bool PlanPrinter::PreVisit(query::plan::IndexedJoin &op) {
+  WithPrintLn([](auto &out) { out << "* IndexedJoin"; });
+  Branch(*op.sub_branch_);
+  op.main_branch_->Accept(*this);
+  return false;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Foreach &op) {
   WithPrintLn([](auto &out) { out << "* Foreach"; });
   Branch(*op.update_clauses_);
@@ -429,6 +477,23 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperty &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByLabelProperties &op) {
+  json self;
+  self["name"] = "ScanAllByLabelProperties";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["properties"] = ToJson(op.properties_, *dba_);
+  self["prefix"] = ToJson(op.prefix_);
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   json self;
   self["name"] = "ScanAllById";
@@ -439,6 +504,79 @@ bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByEdgeType &op) {
+  json self;
+  self["name"] = "ScanAllByEdgeType";
+  self["input_symbol"] = ToJson(op.input_symbol_);
+  self["node_symbol"] = ToJson(op.common_.node_symbol);
+  self["edge_symbol"] = ToJson(op.common_.edge_symbol);
+  self["edge_types"] = ToJson(op.common_.edge_types, *dba_);
+  self["direction"] = ToString(op.common_.direction);
+  self["property"] = op.property_ ? ToJson(*op.property_, *dba_) : json();
+  self["expression"] = op.expression_ ? ToJson(op.expression_) : json();
+  self["lower_bound"] = op.lower_bound_ ? ToJson(*op.lower_bound_) : json();
+  self["upper_bound"] = op.upper_bound_ ? ToJson(*op.upper_bound_) : json();
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ScanAllByText &op) {
+  json self;
+  self["name"] = "ScanAllByText";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["property"] = ToJson(op.property_, *dba_);
+  switch (op.match_) {
+    case storage::TextMatch::STARTS_WITH:
+      self["match"] = "STARTS WITH";
+      break;
+    case storage::TextMatch::ENDS_WITH:
+      self["match"] = "ENDS WITH";
+      break;
+    case storage::TextMatch::CONTAINS:
+      self["match"] = "CONTAINS";
+      break;
+  }
+  self["expression"] = ToJson(op.expression_);
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ScanAllByPoint &op) {
+  json self;
+  self["name"] = "ScanAllByPoint";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["property"] = ToJson(op.property_, *dba_);
+  switch (op.region_type_) {
+    case storage::PointRegion::Type::WITHIN_DISTANCE:
+      self["region"] = "WITHIN DISTANCE";
+      self["center"] = ToJson(op.lower_or_center_);
+      self["radius"] = ToJson(op.upper_or_radius_);
+      self["inclusive"] = op.inclusive_;
+      break;
+    case storage::PointRegion::Type::WITHIN_BOX:
+      self["region"] = "WITHIN BOX";
+      self["lower"] = ToJson(op.lower_or_center_);
+      self["upper"] = ToJson(op.upper_or_radius_);
+      break;
+  }
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(CreateNode &op) {
   json self;
   self["name"] = "CreateNode";
@@ -729,6 +867,10 @@ bool PlanToJsonVisitor::PreVisit(OrderBy &op) {
     self["order_by"].push_back(json);
   }
   self["output_symbols"] = ToJson(op.output_symbols_);
+  if (op.limit_) {
+    self["skip"] = op.skip_ ? ToJson(op.skip_) : json();
+    self["limit"] = ToJson(op.limit_);
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -879,6 +1021,38 @@ bool PlanToJsonVisitor::PreVisit(Cartesian &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(HashJoin &op) {
+  json self;
+  self["name"] = "HashJoin";
+  self["left_symbols"] = ToJson(op.left_symbols_);
+  self["right_symbols"] = ToJson(op.right_symbols_);
+  self["hash_join_condition"] = ToJson(op.hash_join_condition_);
+  self["optional"] = op.optional_;
+
+  op.left_op_->Accept(*this);
+  self["left_op"] = PopOutput();
+
+  op.right_op_->Accept(*this);
+  self["right_op"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(IndexedJoin &op) {
+  json self;
+  self["name"] = "IndexedJoin";
+
+  op.main_branch_->Accept(*this);
+  self["main_branch"] = PopOutput();
+
+  op.sub_branch_->Accept(*this);
+  self["sub_branch"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(Foreach &op) {
   json self;
   self["name"] = "Foreach";
@@ -30,6 +30,12 @@ unsigned long long IndividualCycles(const ProfilingStats &cumulative_stats) {
                                                        [](auto acc, auto &stats) { return acc + stats.num_cycles; });
 }
 
+ProfilingCounters IndividualCounters(const ProfilingStats &cumulative_stats) {
+  auto children = ProfilingCounters{};
+  for (const auto &child : cumulative_stats.children) children += child.counters;
+  return cumulative_stats.counters - children;
+}
+
 double RelativeTime(unsigned long long num_cycles, unsigned long long total_cycles) {
   return static_cast<double>(num_cycles) / total_cycles;
 }
@@ -141,6 +147,16 @@ class ProfilingStatsToJsonHelper {
     obj->emplace("actual_hits", cumulative_stats.actual_hits);
     obj->emplace("relative_time", RelativeTime(cycles, total_cycles_));
     obj->emplace("absolute_time", AbsoluteTime(cycles, total_cycles_, total_time_));
+    const auto counters = IndividualCounters(cumulative_stats);
+    obj->emplace("cpu_time_ns", counters.cpu_time_ns);
+    obj->emplace("allocated_bytes", counters.allocated_bytes);
+    obj->emplace("lock_wait_ns", counters.lock_wait_ns);
+    obj->emplace("lock_contentions", counters.lock_contentions);
+    obj->emplace("lock_spins", counters.lock_spins);
+    obj->emplace("vertices_touched", counters.storage.vertices_touched);
+    obj->emplace("edges_touched", counters.storage.edges_touched);
+    obj->emplace("delta_steps", counters.storage.delta_steps);
+    obj->emplace("index_seeks", counters.storage.index_seeks);
     obj->emplace("children", json::array());
 
     for (size_t i = 0; i < cumulative_stats.children.size(); ++i) {
@@ -12,16 +12,67 @@
 #pragma once
 
 #include <cstdint>
+#include <unordered_map>
 #include <vector>
 
 #include <json/json.hpp>
 
 #include "query/typed_value.hpp"
+#include "storage/v2/access_counters.hpp"
 
 namespace memgraph::query {
 
 namespace plan {
 
+class LogicalOperator;
+
+/// Numbers of rows which the pipeline breakers of a plan received from their
+/// inputs during an execution.
+using ObservedCardinalities = std::unordered_map<const LogicalOperator *, uint64_t>;
+
+/// Numbers of rows which a filter received from its input and passed on
+/// during an execution.
+struct FilterRows {
+  uint64_t input{0};
+  uint64_t passed{0};
+};
+
+using ObservedFilters = std::unordered_map<const LogicalOperator *, FilterRows>;
+
+/// Resources used by the pulls of a logical operator, including the ones used
+/// by the operators it pulled from.
+struct ProfilingCounters {
+  /// CPU time of the executing thread.
+  uint64_t cpu_time_ns{0};
+  /// Bytes allocated from the query memory resource.
+  uint64_t allocated_bytes{0};
+  /// Time spent waiting for storage locks held by other threads, the number of
+  /// such waits and the iterations spent spinning in them.
+  uint64_t lock_wait_ns{0};
+  uint64_t lock_contentions{0};
+  uint64_t lock_spins{0};
+  storage::AccessCounters storage;
+
+  ProfilingCounters &operator+=(const ProfilingCounters &other) {
+    cpu_time_ns += other.cpu_time_ns;
+    allocated_bytes += other.allocated_bytes;
+    lock_wait_ns += other.lock_wait_ns;
+    lock_contentions += other.lock_contentions;
+    lock_spins += other.lock_spins;
+    storage += other.storage;
+    return *this;
+  }
+
+  ProfilingCounters operator-(const ProfilingCounters &other) const {
+    return {cpu_time_ns - other.cpu_time_ns,
+            allocated_bytes - other.allocated_bytes,
+            lock_wait_ns - other.lock_wait_ns,
+            lock_contentions - other.lock_contentions,
+            lock_spins - other.lock_spins,
+            storage - other.storage};
+  }
+};
+
 /**
  * Stores profiling statistics for a single logical operator.
  */
@@ -32,6 +83,7 @@ struct ProfilingStats {
   std::string name;
   // TODO: This should use the allocator for query execution
   std::vector<ProfilingStats> children;
+  ProfilingCounters counters{};
 };
 
 struct ProfilingStatsWithTotalTime {
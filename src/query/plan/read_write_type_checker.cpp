@@ -36,7 +36,11 @@ PRE_VISIT(ScanAllByLabel, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyRange, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyValue, RWType::R, true)
 PRE_VISIT(ScanAllByLabelProperty, RWType::R, true)
+PRE_VISIT(ScanAllByLabelProperties, RWType::R, true)
 PRE_VISIT(ScanAllById, RWType::R, true)
+PRE_VISIT(ScanAllByEdgeType, RWType::R, true)
+PRE_VISIT(ScanAllByText, RWType::R, true)
+PRE_VISIT(ScanAllByPoint, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
 PRE_VISIT(ExpandVariable, RWType::R, true)
@@ -55,6 +59,18 @@ bool ReadWriteTypeChecker::PreVisit(Cartesian &op) {
   return false;
 }
 
+bool ReadWriteTypeChecker::PreVisit(HashJoin &op) {
+  op.left_op_->Accept(*this);
+  op.right_op_->Accept(*this);
+  return false;
+}
+
+bool ReadWriteTypeChecker::PreVisit(IndexedJoin &op) {
+  op.main_branch_->Accept(*this);
+  op.sub_branch_->Accept(*this);
+  return false;
+}
+
 PRE_VISIT(EmptyResult, RWType::NONE, true)
 PRE_VISIT(Produce, RWType::NONE, true)
 PRE_VISIT(Accumulate, RWType::NONE, true)
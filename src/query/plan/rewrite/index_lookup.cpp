@@ -11,6 +11,7 @@
 
 #include "query/plan/rewrite/index_lookup.hpp"
 
+#include "query/plan/read_write_type_checker.hpp"
 #include "utils/flag_validation.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
@@ -48,4 +49,103 @@ Expression *RemoveAndExpressions(Expression *expr, const std::unordered_set<Expr
   return and_op;
 }
 
+namespace {
+
+// Returns the name of the property whose values the scan reads from the index,
+// or nullptr if it doesn't read any.
+const std::string *IndexedPropertyName(const LogicalOperator &op) {
+  if (const auto *scan = utils::Downcast<const ScanAllByLabelPropertyValue>(&op)) return &scan->property_name_;
+  if (const auto *scan = utils::Downcast<const ScanAllByLabelPropertyRange>(&op)) return &scan->property_name_;
+  if (const auto *scan = utils::Downcast<const ScanAllByLabelProperty>(&op)) return &scan->property_name_;
+  return nullptr;
+}
+
+// The operators which pass the frames of their input on without keeping them,
+// so the values written by a scan below them are still on the frame.
+bool PassesInputFrames(const LogicalOperator &op) {
+  return utils::IsSubtype(op, ScanAll::kType) || utils::IsSubtype(op, Filter::kType) ||
+         utils::IsSubtype(op, Produce::kType) || utils::IsSubtype(op, Expand::kType) ||
+         utils::IsSubtype(op, ExpandVariable::kType) || utils::IsSubtype(op, EdgeUniquenessFilter::kType) ||
+         utils::IsSubtype(op, ConstructNamedPath::kType) || utils::IsSubtype(op, Optional::kType) ||
+         utils::IsSubtype(op, Unwind::kType) || utils::IsSubtype(op, Skip::kType) ||
+         utils::IsSubtype(op, Limit::kType);
+}
+
+class IndexedValueRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  IndexedValueRewriter(SymbolTable *symbol_table, AstStorage *ast_storage)
+      : symbol_table_(symbol_table), ast_storage_(ast_storage) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once &) override { return true; }
+
+  bool PreVisit(Produce &op) override {
+    auto scans = CollectIndexedScans(op.input());
+    if (scans.empty()) return true;
+    for (auto &named_expression : op.named_expressions_) {
+      auto *expression = ReplaceLookup(named_expression->expression_, scans);
+      if (expression == named_expression->expression_) continue;
+      // The named expressions are shared by the alternative plans, so the
+      // replaced one is a new expression.
+      auto *replaced =
+          ast_storage_->Create<NamedExpression>(named_expression->name_, expression, named_expression->token_position_);
+      replaced->symbol_pos_ = named_expression->symbol_pos_;
+      replaced->is_aliased_ = named_expression->is_aliased_;
+      named_expression = replaced;
+    }
+    return true;
+  }
+
+  bool PreVisit(Aggregate &op) override {
+    auto scans = CollectIndexedScans(op.input());
+    if (scans.empty()) return true;
+    for (auto &key : op.group_by_) key = ReplaceLookup(key, scans);
+    for (auto &aggregation : op.aggregations_) aggregation.value = ReplaceLookup(aggregation.value, scans);
+    return true;
+  }
+
+ private:
+  // Collects the scans reading indexed values whose frames reach the consumer
+  // of the `input`.
+  static std::vector<ScanAll *> CollectIndexedScans(std::shared_ptr<LogicalOperator> input) {
+    std::vector<ScanAll *> scans;
+    for (auto op = std::move(input); op && PassesInputFrames(*op); op = op->input()) {
+      if (IndexedPropertyName(*op)) scans.push_back(static_cast<ScanAll *>(op.get()));
+      if (!op->HasSingleInput()) break;
+    }
+    return scans;
+  }
+
+  Expression *ReplaceLookup(Expression *expression, const std::vector<ScanAll *> &scans) {
+    auto *lookup = utils::Downcast<PropertyLookup>(expression);
+    if (!lookup || lookup->evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return expression;
+    auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+    if (!identifier) return expression;
+    const auto &symbol = symbol_table_->at(*identifier);
+    for (auto *scan : scans) {
+      if (scan->output_symbol_ != symbol || *IndexedPropertyName(*scan) != lookup->property_.name) continue;
+      if (!scan->indexed_value_symbol_) scan->indexed_value_symbol_ = symbol_table_->CreateAnonymousSymbol();
+      const auto &value_symbol = *scan->indexed_value_symbol_;
+      return ast_storage_->Create<Identifier>(value_symbol.name(), false)->MapTo(value_symbol);
+    }
+    return expression;
+  }
+
+  SymbolTable *symbol_table_;
+  AstStorage *ast_storage_;
+};
+
+}  // namespace
+
+void ReadIndexedValues(LogicalOperator *root, SymbolTable *symbol_table, AstStorage *ast_storage) {
+  ReadWriteTypeChecker read_write_type_checker;
+  read_write_type_checker.InferRWType(*root);
+  if (read_write_type_checker.type != ReadWriteTypeChecker::RWType::R) return;
+  IndexedValueRewriter rewriter(symbol_table, ast_storage);
+  root->Accept(rewriter);
+}
+
 }  // namespace memgraph::query::plan::impl
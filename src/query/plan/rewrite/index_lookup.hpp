@@ -38,6 +38,13 @@ namespace impl {
 // given expression tree.
 Expression *RemoveAndExpressions(Expression *expr, const std::unordered_set<Expression *> &exprs_to_remove);
 
+// Replace the lookups of the indexed property of the vertices produced by the
+// scans by a label and a property with the values which the scans read from
+// the index entries. Only the lookups which are whole projected, grouped or
+// aggregated expressions are replaced, and only in read-only plans, in which
+// the property can't change after the scan.
+void ReadIndexedValues(LogicalOperator *root, SymbolTable *symbol_table, AstStorage *ast_storage);
+
 template <class TDbAccessor>
 class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
  public:
@@ -90,8 +97,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
-  bool PostVisit(Expand & /*expand*/) override {
+  // Replace `ScanAll` of the start node followed by `Expand` over a single
+  // edge type with a `ScanAllByEdgeType`, which reads only the edges of that
+  // type from the edge index.
+  bool PostVisit(Expand &expand) override {
     prev_ops_.pop_back();
+    auto indexed_scan = GenScanByEdgeIndex(expand);
+    if (indexed_scan) {
+      SetOnParent(std::move(indexed_scan));
+    }
     return true;
   }
 
@@ -192,6 +206,44 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  // Rewriting HashJoin assumes the same as for Cartesian. The left branch is
+  // rewritten only in PostVisit, because replacing the HashJoin with an
+  // IndexedJoin needs the filters of the left branch untouched.
+  bool PreVisit(HashJoin &op) override {
+    prev_ops_.push_back(&op);
+    RewriteBranch(&op.right_op_);
+    return false;
+  }
+
+  // Replace HashJoin with IndexedJoin in PostVisit, because the replacement
+  // may remove the last reference to HashJoin and thus free the memory. An
+  // optional HashJoin is replaced with Optional, which also looks up the
+  // joining rows for each right row, but yields the rows without any.
+  bool PostVisit(HashJoin &op) override {
+    prev_ops_.pop_back();
+    auto sub_branch = GenIndexedJoinBranch(op);
+    if (sub_branch && op.optional_) {
+      SetOnParent(std::make_shared<Optional>(op.right_op_, std::move(sub_branch), op.left_symbols_));
+    } else if (sub_branch) {
+      SetOnParent(std::make_shared<IndexedJoin>(op.right_op_, std::move(sub_branch)));
+    } else {
+      RewriteBranch(&op.left_op_);
+    }
+    return true;
+  }
+
+  bool PreVisit(IndexedJoin &op) override {
+    prev_ops_.push_back(&op);
+    RewriteBranch(&op.main_branch_);
+    RewriteBranch(&op.sub_branch_);
+    return false;
+  }
+
+  bool PostVisit(IndexedJoin &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(Union &op) override {
     prev_ops_.push_back(&op);
     RewriteBranch(&op.left_op_);
@@ -260,6 +312,15 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByLabelProperties &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByLabelProperties &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ScanAllById &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -269,6 +330,33 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PreVisit(ScanAllByEdgeType &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByEdgeType &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllByText &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByText &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
+  bool PreVisit(ScanAllByPoint &op) override {
+    prev_ops_.push_back(&op);
+    return true;
+  }
+  bool PostVisit(ScanAllByPoint &) override {
+    prev_ops_.pop_back();
+    return true;
+  }
+
   bool PreVisit(ConstructNamedPath &op) override {
     prev_ops_.push_back(&op);
     return true;
@@ -496,6 +584,35 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     std::optional<storage::LabelPropertyIndexStats> index_stats;
   };
 
+  struct LabelPropertyCompositeIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // FilterInfos with PropertyFilter of Type::EQUAL, one per leading property.
+    std::vector<FilterInfo> prefix_filters;
+    // FilterInfo with PropertyFilter of Type::RANGE on the property following
+    // the prefix.
+    std::optional<FilterInfo> range_filter;
+    int64_t vertex_count;
+
+    size_t UsedPropertiesCount() const { return prefix_filters.size() + (range_filter ? 1 : 0); }
+  };
+
+  struct TextIndex {
+    LabelIx label;
+    // FilterInfo with PropertyFilter of Type::STARTS_WITH, ENDS_WITH or
+    // CONTAINS.
+    FilterInfo filter;
+    storage::TextMatch match;
+    int64_t vertex_count;
+  };
+
+  struct PointIndex {
+    LabelIx label;
+    // FilterInfo with PropertyFilter of Type::POINT_DISTANCE or POINT_BBOX.
+    FilterInfo filter;
+    int64_t vertex_count;
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -516,6 +633,27 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     }
   }
 
+  // Returns the left branch of `join` starting from the symbols bound by the
+  // right branch, with the join condition used by an indexed scan, or
+  // `nullptr` if no index can be used for the join condition.
+  std::shared_ptr<LogicalOperator> GenIndexedJoinBranch(const HashJoin &join) {
+    std::shared_ptr<LogicalOperator> branch = join.left_op_->Clone(ast_storage_);
+    auto *last_op = branch.get();
+    while (last_op->HasSingleInput() && last_op->input()->GetTypeInfo() != Once::kType) {
+      last_op = last_op->input().get();
+    }
+    if (!last_op->HasSingleInput()) return nullptr;
+    last_op->set_input(std::make_shared<Once>(join.right_symbols_));
+
+    auto filter = std::make_shared<Filter>(std::move(branch), std::vector<std::shared_ptr<LogicalOperator>>{},
+                                           join.hash_join_condition_);
+    IndexLookupRewriter<TDbAccessor> rewriter(symbol_table_, ast_storage_, db_);
+    filter->Accept(rewriter);
+    // The join condition is used by an indexed scan only if its Filter was
+    // removed.
+    return rewriter.new_root_;
+  }
+
   storage::LabelId GetLabel(LabelIx label) { return db_->NameToLabel(label.name); }
 
   storage::PropertyId GetProperty(PropertyIx prop) { return db_->NameToProperty(prop.name); }
@@ -584,6 +722,11 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
           // cannot scan `n` by property index.
           continue;
         }
+        if (IsTextFilter(filter.property_filter->type_) || IsPointFilter(filter.property_filter->type_)) {
+          // String pattern and point filters can only be served by a text or
+          // a point index.
+          continue;
+        }
         const auto &property = filter.property_filter->property_;
         if (!db_->LabelPropertyIndexExists(GetLabel(label), GetProperty(property))) {
           continue;
@@ -622,6 +765,142 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     }
     return found;
   }
+  // Finds the composite index which can serve the most of the property filters
+  // on `symbol`. Its leading properties need to be filtered by equality and the
+  // property after them can be filtered by a range. Indices serving less than
+  // two filters are never returned, since a single property index is as good
+  // for them. Among the indices serving the same number of filters, the one
+  // with the least vertices wins.
+  std::optional<LabelPropertyCompositeIndex> FindBestLabelPropertyCompositeIndex(
+      const Symbol &symbol, const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    auto find_filter = [this, &symbol, &are_bound](storage::PropertyId property,
+                                                   PropertyFilter::Type type) -> std::optional<FilterInfo> {
+      for (const auto &filter : filters_.PropertyFilters(symbol)) {
+        if (filter.property_filter->is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+        if (filter.property_filter->type_ != type || GetProperty(filter.property_filter->property_) != property) {
+          continue;
+        }
+        return filter;
+      }
+      return std::nullopt;
+    };
+
+    std::optional<LabelPropertyCompositeIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (auto &properties : db_->LabelPropertyCompositeIndices(GetLabel(label))) {
+        LabelPropertyCompositeIndex candidate{label, std::move(properties), {}, std::nullopt, 0};
+        for (const auto &property : candidate.properties) {
+          auto filter = find_filter(property, PropertyFilter::Type::EQUAL);
+          if (!filter) {
+            candidate.range_filter = find_filter(property, PropertyFilter::Type::RANGE);
+            break;
+          }
+          candidate.prefix_filters.push_back(std::move(*filter));
+        }
+        if (candidate.prefix_filters.empty() || candidate.UsedPropertiesCount() < 2) continue;
+
+        candidate.vertex_count = db_->VerticesCount(GetLabel(label), candidate.properties);
+        if (!found || candidate.UsedPropertiesCount() > found->UsedPropertiesCount() ||
+            (candidate.UsedPropertiesCount() == found->UsedPropertiesCount() &&
+             candidate.vertex_count < found->vertex_count)) {
+          found = std::move(candidate);
+        }
+      }
+    }
+    return found;
+  }
+
+  static bool IsTextFilter(PropertyFilter::Type type) {
+    return type == PropertyFilter::Type::STARTS_WITH || type == PropertyFilter::Type::ENDS_WITH ||
+           type == PropertyFilter::Type::CONTAINS;
+  }
+
+  static storage::TextMatch ToTextMatch(PropertyFilter::Type type) {
+    switch (type) {
+      case PropertyFilter::Type::STARTS_WITH:
+        return storage::TextMatch::STARTS_WITH;
+      case PropertyFilter::Type::ENDS_WITH:
+        return storage::TextMatch::ENDS_WITH;
+      case PropertyFilter::Type::CONTAINS:
+        return storage::TextMatch::CONTAINS;
+      default:
+        LOG_FATAL("Property filter isn't a string pattern filter.");
+    }
+  }
+
+  // Finds the text index which needs to check the least candidates for one of
+  // the string pattern filters on `symbol`. The candidates can be estimated
+  // only for literal patterns, for other patterns the whole index is counted.
+  std::optional<TextIndex> FindBestTextIndex(const Symbol &symbol, const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    std::optional<TextIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (const auto &filter : filters_.PropertyFilters(symbol)) {
+        if (!IsTextFilter(filter.property_filter->type_)) continue;
+        if (filter.property_filter->is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+        const auto property = GetProperty(filter.property_filter->property_);
+        if (!db_->TextIndexExists(GetLabel(label), property)) continue;
+        const auto match = ToTextMatch(filter.property_filter->type_);
+        std::string_view pattern;
+        if (auto *literal = utils::Downcast<PrimitiveLiteral>(filter.property_filter->value_);
+            literal && literal->value_.IsString()) {
+          pattern = literal->value_.ValueString();
+        }
+        const int64_t vertex_count = db_->VerticesCount(GetLabel(label), property, match, pattern);
+        if (!found || vertex_count < found->vertex_count) {
+          found = TextIndex{label, filter, match, vertex_count};
+        }
+      }
+    }
+    return found;
+  }
+
+  static bool IsPointFilter(PropertyFilter::Type type) {
+    return type == PropertyFilter::Type::POINT_DISTANCE || type == PropertyFilter::Type::POINT_BBOX;
+  }
+
+  // Finds the point index with the least labeled vertices for one of the point
+  // filters on `symbol`. The regions are rarely constant at planning time, so
+  // the labeled vertices are the estimate of the candidates.
+  std::optional<PointIndex> FindBestPointIndex(const Symbol &symbol, const std::unordered_set<Symbol> &bound_symbols) {
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    std::optional<PointIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (const auto &filter : filters_.PropertyFilters(symbol)) {
+        if (!IsPointFilter(filter.property_filter->type_)) continue;
+        if (filter.property_filter->is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+        if (!db_->PointIndexExists(GetLabel(label), GetProperty(filter.property_filter->property_))) continue;
+        const int64_t vertex_count = db_->VerticesCount(GetLabel(label));
+        if (!found || vertex_count < found->vertex_count) {
+          found = PointIndex{label, filter, vertex_count};
+        }
+      }
+    }
+    return found;
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. If the node
   // does not have at least a label, no indexed lookup can be created and
   // `nullptr` is returned. The operator is chained after `input`. Optional
@@ -660,6 +939,37 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       // Without labels, we cannot generate any indexed ScanAll.
       return nullptr;
     }
+    // Composite indices are tried first, since they are only chosen when they
+    // can serve more than one of the property filters.
+    auto found_composite_index = FindBestLabelPropertyCompositeIndex(node_symbol, bound_symbols);
+    if (found_composite_index && (!max_vertex_count || *max_vertex_count >= found_composite_index->vertex_count)) {
+      std::vector<Expression *> prefix;
+      prefix.reserve(found_composite_index->prefix_filters.size());
+      for (const auto &filter : found_composite_index->prefix_filters) {
+        prefix.push_back(filter.property_filter->value_);
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::optional<ScanAllByLabelProperties::Bound> lower_bound;
+      std::optional<ScanAllByLabelProperties::Bound> upper_bound;
+      if (const auto &range_filter = found_composite_index->range_filter) {
+        lower_bound = range_filter->property_filter->lower_bound_;
+        upper_bound = range_filter->property_filter->upper_bound_;
+        filter_exprs_for_removal_.insert(range_filter->expression);
+        filters_.EraseFilter(*range_filter);
+      }
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_composite_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      std::vector<std::string> property_names;
+      property_names.reserve(found_composite_index->properties.size());
+      for (const auto &property : found_composite_index->properties) {
+        property_names.push_back(db_->PropertyToName(property));
+      }
+      return std::make_unique<ScanAllByLabelProperties>(
+          input, node_symbol, GetLabel(found_composite_index->label), std::move(found_composite_index->properties),
+          std::move(property_names), std::move(prefix), std::move(lower_bound), std::move(upper_bound), view);
+    }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
@@ -708,6 +1018,42 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
                                                              prop_filter.property_.name, prop_filter.value_, view);
       }
     }
+    // A text index is preferred to the label index, since it yields only the
+    // vertices matching the pattern.
+    auto found_text_index = FindBestTextIndex(node_symbol, bound_symbols);
+    if (found_text_index && (!max_vertex_count || *max_vertex_count >= found_text_index->vertex_count)) {
+      const auto prop_filter = *found_text_index->filter.property_filter;
+      // The index checks the actual values, so the filter isn't needed anymore.
+      filter_exprs_for_removal_.insert(found_text_index->filter.expression);
+      filters_.EraseFilter(found_text_index->filter);
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_text_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      return std::make_unique<ScanAllByText>(input, node_symbol, GetLabel(found_text_index->label),
+                                             GetProperty(prop_filter.property_), prop_filter.property_.name,
+                                             found_text_index->match, prop_filter.value_, view);
+    }
+    // Like a text index, a point index yields only the vertices in the region.
+    auto found_point_index = FindBestPointIndex(node_symbol, bound_symbols);
+    if (found_point_index && (!max_vertex_count || *max_vertex_count >= found_point_index->vertex_count)) {
+      const auto prop_filter = *found_point_index->filter.property_filter;
+      // The index checks the actual values, so the filter isn't needed anymore.
+      filter_exprs_for_removal_.insert(found_point_index->filter.expression);
+      filters_.EraseFilter(found_point_index->filter);
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_point_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      if (prop_filter.type_ == PropertyFilter::Type::POINT_DISTANCE) {
+        return std::make_unique<ScanAllByPoint>(
+            input, node_symbol, GetLabel(found_point_index->label), GetProperty(prop_filter.property_),
+            prop_filter.property_.name, storage::PointRegion::Type::WITHIN_DISTANCE, prop_filter.value_,
+            prop_filter.upper_bound_->value(), prop_filter.upper_bound_->IsInclusive(), view);
+      }
+      return std::make_unique<ScanAllByPoint>(input, node_symbol, GetLabel(found_point_index->label),
+                                              GetProperty(prop_filter.property_), prop_filter.property_.name,
+                                              storage::PointRegion::Type::WITHIN_BOX, prop_filter.lower_bound_->value(),
+                                              prop_filter.upper_bound_->value(), true, view);
+    }
     auto maybe_label = FindBestLabelIndex(labels);
     if (!maybe_label) return nullptr;
     const auto &label = *maybe_label;
@@ -721,6 +1067,53 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
     return std::make_unique<ScanAllByLabel>(input, node_symbol, GetLabel(label), view);
   }
+
+  // Creates a ScanAllByEdgeType replacing the `expand` together with its input,
+  // if the input is a plain `ScanAll` of the start node and the single edge
+  // type of the expansion is indexed. The start node must not be filtered,
+  // otherwise a vertex index or the filter would have stayed in between. An
+  // equality or range filter on an edge property is consumed when the edge
+  // type+property index exists, else `nullptr` is returned if there is no
+  // edge type index either.
+  std::unique_ptr<ScanAllByEdgeType> GenScanByEdgeIndex(const Expand &expand) {
+    const auto &common = expand.common_;
+    if (common.existing_node || common.edge_types.size() != 1 || common.direction == EdgeAtom::Direction::BOTH) {
+      return nullptr;
+    }
+    const auto &input = expand.input();
+    if (input->GetTypeInfo() != ScanAll::kType) return nullptr;
+    const auto &scan = static_cast<const ScanAll &>(*input);
+    if (scan.output_symbol_ != expand.input_symbol_) return nullptr;
+
+    const auto edge_type = common.edge_types.front();
+    const auto &modified_symbols = expand.ModifiedSymbols(*symbol_table_);
+    std::unordered_set<Symbol> bound_symbols(modified_symbols.begin(), modified_symbols.end());
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+    for (const auto &filter : filters_.PropertyFilters(common.edge_symbol)) {
+      const auto &prop_filter = *filter.property_filter;
+      if (prop_filter.is_symbol_in_value_ || !are_bound(filter.used_symbols)) continue;
+      if (prop_filter.type_ != PropertyFilter::Type::EQUAL && prop_filter.type_ != PropertyFilter::Type::RANGE) {
+        continue;
+      }
+      const auto property = GetProperty(prop_filter.property_);
+      if (!db_->EdgeTypePropertyIndexExists(edge_type, property)) continue;
+      filter_exprs_for_removal_.insert(filter.expression);
+      filters_.EraseFilter(filter);
+      return std::make_unique<ScanAllByEdgeType>(scan.input(), expand.input_symbol_, common, property,
+                                                 prop_filter.property_.name, prop_filter.value_,
+                                                 prop_filter.lower_bound_, prop_filter.upper_bound_, expand.view_);
+    }
+    if (!db_->EdgeTypeIndexExists(edge_type)) return nullptr;
+    return std::make_unique<ScanAllByEdgeType>(scan.input(), expand.input_symbol_, common, std::nullopt, "", nullptr,
+                                               std::nullopt, std::nullopt, expand.view_);
+  }
 };
 
 }  // namespace impl
@@ -738,6 +1131,7 @@ std::unique_ptr<LogicalOperator> RewriteWithIndexLookup(std::unique_ptr<LogicalO
     // crashing the application.
     throw utils::NotYetImplemented("optimizing index lookup");
   }
+  impl::ReadIndexedValues(root_op.get(), symbol_table, ast_storage);
   return root_op;
 }
 
@@ -462,6 +462,12 @@ class ReturnBodyContext : public HierarchicalTreeVisitor {
   std::vector<NamedExpression *> named_expressions_;
 };
 
+// Skip and limit counts are known before any row is pulled if they are
+// literals or parameters.
+bool IsConstantCount(Expression *count) {
+  return !count || utils::Downcast<PrimitiveLiteral>(count) || utils::Downcast<ParameterLookup>(count);
+}
+
 std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator> input_op, bool advance_command,
                                                const ReturnBodyContext &body, bool accumulate = false) {
   std::vector<Symbol> used_symbols(body.used_symbols().begin(), body.used_symbols().end());
@@ -485,7 +491,11 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   // Like Where, OrderBy can read from symbols established by named expressions
   // in Produce, so it must come after it.
   if (!body.order_by().empty()) {
-    last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    // With a known limit OrderBy keeps only the rows which pass the Skip and
+    // Limit, instead of sorting all of them.
+    const bool top_k = body.limit() && IsConstantCount(body.skip()) && IsConstantCount(body.limit());
+    last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols(),
+                                        top_k ? body.skip() : nullptr, top_k ? body.limit() : nullptr);
   }
   // Finally, Skip and Limit must come after OrderBy.
   if (body.skip()) {
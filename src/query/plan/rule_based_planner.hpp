@@ -279,6 +279,8 @@ class RuleBasedPlanner {
     for (const auto &matching : single_query_part.optional_matching) {
       MatchContext opt_ctx{matching, symbol_table, bound_symbols};
 
+      if (GenOptionalHashJoin(last_op, matching, symbol_table, bound_symbols)) continue;
+
       std::vector<Symbol> bound_symbols(context_->bound_symbols.begin(), context_->bound_symbols.end());
       auto once_with_symbols = std::make_unique<Once>(bound_symbols);
 
@@ -481,8 +483,19 @@ class RuleBasedPlanner {
                                                    std::vector<Symbol> &new_symbols,
                                                    std::unordered_map<Symbol, std::vector<Symbol>> &named_paths,
                                                    Filters &filters, storage::View view) {
-    for (const auto &expansion : matching.expansions) {
+    for (size_t i = 0; i < matching.expansions.size(); ++i) {
+      const auto &expansion = matching.expansions[i];
       const auto &node1_symbol = symbol_table.at(*expansion.node1->identifier_);
+      if (!utils::Contains(bound_symbols, node1_symbol) && view == storage::View::OLD) {
+        // A part of the pattern disconnected from everything bound so far
+        // starts here, join it by a hash table instead of scanning it for
+        // each row if possible.
+        if (auto part_end = GenHashJoin(last_op, matching, i, symbol_table, storage, bound_symbols, new_symbols,
+                                        named_paths, filters)) {
+          i = *part_end - 1;
+          continue;
+        }
+      }
       if (bound_symbols.insert(node1_symbol).second) {
         // We have just bound this symbol, so generate ScanAll which fills it.
         last_op = std::make_unique<ScanAll>(std::move(last_op), node1_symbol, view);
@@ -502,6 +515,170 @@ class RuleBasedPlanner {
     return last_op;
   }
 
+  // Plans the expansions of `matching` starting at `begin` which form a part
+  // of the pattern disconnected from `bound_symbols` as a separate branch of a
+  // HashJoin with `last_op`. The join condition is taken from an equality
+  // filter between the part and the bound symbols. Returns the index of the
+  // first expansion after the part, or nullopt (leaving everything untouched)
+  // if there is no such filter. The HashJoin is rewritten into an IndexedJoin
+  // later if the part can be looked up by an index on the join condition.
+  std::optional<size_t> GenHashJoin(std::unique_ptr<LogicalOperator> &last_op, const Matching &matching,
+                                    size_t begin, const SymbolTable &symbol_table, AstStorage &storage,
+                                    std::unordered_set<Symbol> &bound_symbols, std::vector<Symbol> &new_symbols,
+                                    std::unordered_map<Symbol, std::vector<Symbol>> &named_paths, Filters &filters) {
+    // Rows from outside of this matching only, e.g. in OPTIONAL MATCH, are
+    // better joined by filtering.
+    if (bound_symbols.empty() || last_op->GetTypeInfo() == Once::kType) return std::nullopt;
+
+    std::unordered_set<Symbol> part_symbols{symbol_table.at(*matching.expansions[begin].node1->identifier_)};
+    auto part_end = begin;
+    for (; part_end < matching.expansions.size(); ++part_end) {
+      const auto &expansion = matching.expansions[part_end];
+      const auto &node1_symbol = symbol_table.at(*expansion.node1->identifier_);
+      if (!utils::Contains(part_symbols, node1_symbol)) break;
+      if (!expansion.edge) continue;
+      // Variable expansions may use the bound symbols in their lambdas and
+      // bounds, so they are left for after the join.
+      if (expansion.edge->IsVariable()) break;
+      const auto &node2_symbol = symbol_table.at(*expansion.node2->identifier_);
+      if (utils::Contains(bound_symbols, node2_symbol)) break;
+      part_symbols.insert(symbol_table.at(*expansion.edge->identifier_));
+      part_symbols.insert(node2_symbol);
+    }
+
+    auto uses_only = [&symbol_table](Expression *expression, const std::unordered_set<Symbol> &symbols) {
+      return UsesOnly(expression, symbols, symbol_table);
+    };
+    EqualOperator *join_filter = nullptr;
+    Expression *part_expression = nullptr;
+    Expression *bound_expression = nullptr;
+    for (const auto &filter : filters) {
+      auto *equal = utils::Downcast<EqualOperator>(filter.expression);
+      if (!equal || !filter.matchings.empty()) continue;
+      if (uses_only(equal->expression1_, part_symbols) && uses_only(equal->expression2_, bound_symbols)) {
+        std::tie(part_expression, bound_expression) = std::make_pair(equal->expression1_, equal->expression2_);
+      } else if (uses_only(equal->expression2_, part_symbols) && uses_only(equal->expression1_, bound_symbols)) {
+        std::tie(part_expression, bound_expression) = std::make_pair(equal->expression2_, equal->expression1_);
+      } else {
+        continue;
+      }
+      join_filter = equal;
+      break;
+    }
+    if (!join_filter) return std::nullopt;
+
+    // Erasing the filter erases all of the filter infos made from it.
+    filters.EraseFilter(FilterInfo{FilterInfo::Type::Generic, join_filter});
+
+    std::unique_ptr<LogicalOperator> part_op = std::make_unique<Once>();
+    std::unordered_set<Symbol> part_bound_symbols;
+    std::vector<Symbol> part_new_symbols;
+    Matching part_matching;
+    part_matching.expansions.assign(matching.expansions.begin() + begin, matching.expansions.begin() + part_end);
+    part_matching.edge_symbols = matching.edge_symbols;
+    part_op = HandleExpansion(std::move(part_op), part_matching, symbol_table, storage, part_bound_symbols,
+                              part_new_symbols, named_paths, filters, storage::View::OLD);
+
+    auto part_op_symbols = part_op->ModifiedSymbols(symbol_table);
+    auto last_op_symbols = last_op->ModifiedSymbols(symbol_table);
+    last_op = std::make_unique<HashJoin>(std::move(part_op), std::move(part_op_symbols), std::move(last_op),
+                                         std::move(last_op_symbols),
+                                         storage.Create<EqualOperator>(part_expression, bound_expression));
+
+    // Ensure Cyphermorphism between the edges of the part and the edges
+    // bound before.
+    for (const auto &edge_symbols : matching.edge_symbols) {
+      for (const auto &edge_symbol : edge_symbols) {
+        if (!utils::Contains(part_symbols, edge_symbol)) continue;
+        std::vector<Symbol> other_symbols;
+        for (const auto &symbol : edge_symbols) {
+          if (utils::Contains(bound_symbols, symbol)) other_symbols.push_back(symbol);
+        }
+        if (!other_symbols.empty()) {
+          last_op = std::make_unique<EdgeUniquenessFilter>(std::move(last_op), edge_symbol, other_symbols);
+        }
+      }
+    }
+
+    bound_symbols.insert(part_bound_symbols.begin(), part_bound_symbols.end());
+    new_symbols.insert(new_symbols.end(), part_new_symbols.begin(), part_new_symbols.end());
+    last_op = GenFilters(std::move(last_op), bound_symbols, filters, storage, symbol_table);
+    last_op = impl::GenNamedPaths(std::move(last_op), bound_symbols, named_paths);
+    last_op = GenFilters(std::move(last_op), bound_symbols, filters, storage, symbol_table);
+    return part_end;
+  }
+
+  // Returns true if the expression uses some symbols, all of which are in
+  // `symbols`.
+  static bool UsesOnly(Expression *expression, const std::unordered_set<Symbol> &symbols,
+                       const SymbolTable &symbol_table) {
+    UsedSymbolsCollector collector(symbol_table);
+    expression->Accept(collector);
+    return !collector.symbols_.empty() &&
+           std::all_of(collector.symbols_.begin(), collector.symbols_.end(),
+                       [&symbols](const auto &symbol) { return utils::Contains(symbols, symbol); });
+  }
+
+  // Plans an OPTIONAL MATCH which doesn't start from the bound symbols, and
+  // whose only filter using them is an equality, as an optional HashJoin with
+  // `last_op`. The optional pattern is then matched once for all of the rows
+  // instead of once for every row. Returns false, leaving everything
+  // untouched, if the matching isn't correlated so.
+  bool GenOptionalHashJoin(std::unique_ptr<LogicalOperator> &last_op, const Matching &matching,
+                           const SymbolTable &symbol_table, std::unordered_set<Symbol> &bound_symbols) {
+    if (bound_symbols.empty() || matching.expansions.empty()) return false;
+    for (const auto &expansion : matching.expansions) {
+      if (utils::Contains(bound_symbols, symbol_table.at(*expansion.node1->identifier_))) return false;
+      if (!expansion.edge) continue;
+      // Variable expansions may use the bound symbols in their lambdas and
+      // bounds.
+      if (expansion.edge->IsVariable()) return false;
+      if (utils::Contains(bound_symbols, symbol_table.at(*expansion.node2->identifier_))) return false;
+    }
+
+    EqualOperator *join_filter = nullptr;
+    Expression *part_expression = nullptr;
+    Expression *bound_expression = nullptr;
+    for (const auto &filter : matching.filters) {
+      const bool uses_bound_symbols =
+          std::any_of(filter.used_symbols.begin(), filter.used_symbols.end(),
+                      [&bound_symbols](const auto &symbol) { return utils::Contains(bound_symbols, symbol); });
+      if (!uses_bound_symbols) continue;
+      // An equality may be split into several filter infos.
+      if (join_filter && filter.expression == join_filter) continue;
+      auto *equal = utils::Downcast<EqualOperator>(filter.expression);
+      if (join_filter || !equal || !filter.matchings.empty()) return false;
+      if (UsesOnly(equal->expression1_, matching.expansion_symbols, symbol_table) &&
+          UsesOnly(equal->expression2_, bound_symbols, symbol_table)) {
+        std::tie(part_expression, bound_expression) = std::make_pair(equal->expression1_, equal->expression2_);
+      } else if (UsesOnly(equal->expression2_, matching.expansion_symbols, symbol_table) &&
+                 UsesOnly(equal->expression1_, bound_symbols, symbol_table)) {
+        std::tie(part_expression, bound_expression) = std::make_pair(equal->expression2_, equal->expression1_);
+      } else {
+        return false;
+      }
+      join_filter = equal;
+    }
+    if (!join_filter) return false;
+
+    Matching part_matching = matching;
+    // Erasing the filter erases all of the filter infos made from it.
+    part_matching.filters.EraseFilter(FilterInfo{FilterInfo::Type::Generic, join_filter});
+    std::unordered_set<Symbol> part_bound_symbols;
+    MatchContext part_ctx{part_matching, symbol_table, part_bound_symbols};
+    auto part_op = PlanMatching(part_ctx, std::make_unique<Once>());
+    if (!part_op) return false;
+
+    AstStorage &storage = *context_->ast_storage;
+    auto part_op_symbols = part_op->ModifiedSymbols(symbol_table);
+    auto last_op_symbols = last_op->ModifiedSymbols(symbol_table);
+    last_op = std::make_unique<HashJoin>(std::move(part_op), std::move(part_op_symbols), std::move(last_op),
+                                         std::move(last_op_symbols),
+                                         storage.Create<EqualOperator>(part_expression, bound_expression), true);
+    bound_symbols.insert(part_bound_symbols.begin(), part_bound_symbols.end());
+    return true;
+  }
+
   std::unique_ptr<LogicalOperator> GenExpand(std::unique_ptr<LogicalOperator> last_op, const Expansion &expansion,
                                              const SymbolTable &symbol_table, std::unordered_set<Symbol> &bound_symbols,
                                              const Matching &matching, AstStorage &storage, Filters &filters,
@@ -11,11 +11,13 @@
 
 #pragma once
 
+#include <time.h>
 #include <cstdint>
 
 #include "query/context.hpp"
 #include "query/plan/profile.hpp"
 #include "utils/likely.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/tsc.hpp"
 
 namespace memgraph::query::plan {
@@ -61,6 +63,7 @@ class ScopedProfile {
 
       context_->stats_root = stats_;
       stats_->actual_hits++;
+      start_counters_ = ReadCounters();
       start_time_ = utils::ReadTSC();
     }
   }
@@ -93,6 +96,7 @@ class ScopedProfile {
 
       context_->stats_root = stats_;
       stats_->actual_hits++;
+      start_counters_ = ReadCounters();
       start_time_ = utils::ReadTSC();
     }
   }
@@ -100,6 +104,7 @@ class ScopedProfile {
   ~ScopedProfile() noexcept {
     if (UNLIKELY(context_->is_profile_query)) {
       stats_->num_cycles += utils::ReadTSC() - start_time_;
+      stats_->counters += ReadCounters() - start_counters_;
 
       // Restore the old root ("pop")
       context_->stats_root = root_;
@@ -107,10 +112,22 @@ class ScopedProfile {
   }
 
  private:
+  ProfilingCounters ReadCounters() const noexcept {
+    timespec cpu_time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_time);
+    return {static_cast<uint64_t>(cpu_time.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(cpu_time.tv_nsec),
+            context_->profile_allocated_bytes ? *context_->profile_allocated_bytes : 0,
+            utils::lock_wait_counters.wait_ns,
+            utils::lock_wait_counters.contentions,
+            utils::lock_wait_counters.spins,
+            storage::access_counters};
+  }
+
   query::ExecutionContext *context_;
   ProfilingStats *root_{nullptr};
   ProfilingStats *stats_{nullptr};
   unsigned long long start_time_{0};
+  ProfilingCounters start_counters_;
 };
 
 }  // namespace memgraph::query::plan
@@ -0,0 +1,276 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/spill.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <string>
+#include <type_traits>
+
+#include "query/exceptions.hpp"
+#include "utils/file.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+// Approximate memory used by a map entry apart from its key and value.
+constexpr size_t kMapEntryOverheadBytes = 32;
+
+template <class T>
+void WriteRaw(std::ostream &out, const T &value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  const auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+  out.write(bytes.data(), bytes.size());
+}
+
+template <class T>
+T ReadRaw(std::istream &in) {
+  std::array<char, sizeof(T)> bytes{};
+  in.read(bytes.data(), bytes.size());
+  return std::bit_cast<T>(bytes);
+}
+
+void WriteString(std::ostream &out, std::string_view str) {
+  WriteRaw<uint64_t>(out, str.size());
+  out.write(str.data(), static_cast<std::streamsize>(str.size()));
+}
+
+TypedValue::TString ReadString(std::istream &in, utils::MemoryResource *memory) {
+  TypedValue::TString str(ReadRaw<uint64_t>(in), '\0', memory);
+  in.read(str.data(), static_cast<std::streamsize>(str.size()));
+  return str;
+}
+
+void WriteValue(std::ostream &out, const TypedValue &value) {
+  WriteRaw(out, static_cast<uint8_t>(value.type()));
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      return;
+    case TypedValue::Type::Bool:
+      WriteRaw(out, value.ValueBool());
+      return;
+    case TypedValue::Type::Int:
+      WriteRaw(out, value.ValueInt());
+      return;
+    case TypedValue::Type::Double:
+      WriteRaw(out, value.ValueDouble());
+      return;
+    case TypedValue::Type::String:
+      WriteString(out, value.ValueString());
+      return;
+    case TypedValue::Type::List:
+      WriteRaw<uint64_t>(out, value.ValueList().size());
+      for (const auto &element : value.ValueList()) WriteValue(out, element);
+      return;
+    case TypedValue::Type::Map:
+      WriteRaw<uint64_t>(out, value.ValueMap().size());
+      for (const auto &[key, element] : value.ValueMap()) {
+        WriteString(out, key);
+        WriteValue(out, element);
+      }
+      return;
+    case TypedValue::Type::Vertex:
+      WriteRaw(out, value.ValueVertex());
+      return;
+    case TypedValue::Type::Edge:
+      WriteRaw(out, value.ValueEdge());
+      return;
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      WriteRaw<uint64_t>(out, path.edges().size());
+      WriteRaw(out, path.vertices()[0]);
+      for (size_t i = 0; i < path.edges().size(); ++i) {
+        WriteRaw(out, path.edges()[i]);
+        WriteRaw(out, path.vertices()[i + 1]);
+      }
+      return;
+    }
+    case TypedValue::Type::Date:
+      WriteRaw(out, value.ValueDate().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalTime:
+      WriteRaw(out, value.ValueLocalTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::LocalDateTime:
+      WriteRaw(out, value.ValueLocalDateTime().MicrosecondsSinceEpoch());
+      return;
+    case TypedValue::Type::Duration:
+      WriteRaw(out, value.ValueDuration().microseconds);
+      return;
+    case TypedValue::Type::Point:
+      WriteRaw(out, value.ValuePoint());
+      return;
+    case TypedValue::Type::Graph:
+      LOG_FATAL("Graph values can't be spilled");
+  }
+}
+
+TypedValue ReadValue(std::istream &in, utils::MemoryResource *memory) {
+  switch (static_cast<TypedValue::Type>(ReadRaw<uint8_t>(in))) {
+    case TypedValue::Type::Null:
+      return TypedValue(memory);
+    case TypedValue::Type::Bool:
+      return TypedValue(ReadRaw<bool>(in), memory);
+    case TypedValue::Type::Int:
+      return TypedValue(ReadRaw<int64_t>(in), memory);
+    case TypedValue::Type::Double:
+      return TypedValue(ReadRaw<double>(in), memory);
+    case TypedValue::Type::String:
+      return TypedValue(ReadString(in, memory), memory);
+    case TypedValue::Type::List: {
+      TypedValue::TVector list(memory);
+      const auto size = ReadRaw<uint64_t>(in);
+      list.reserve(size);
+      for (uint64_t i = 0; i < size; ++i) list.emplace_back(ReadValue(in, memory));
+      return TypedValue(std::move(list), memory);
+    }
+    case TypedValue::Type::Map: {
+      TypedValue::TMap map(memory);
+      const auto size = ReadRaw<uint64_t>(in);
+      for (uint64_t i = 0; i < size; ++i) {
+        auto key = ReadString(in, memory);
+        map.emplace(std::move(key), ReadValue(in, memory));
+      }
+      return TypedValue(std::move(map), memory);
+    }
+    case TypedValue::Type::Vertex:
+      return TypedValue(ReadRaw<VertexAccessor>(in), memory);
+    case TypedValue::Type::Edge:
+      return TypedValue(ReadRaw<EdgeAccessor>(in), memory);
+    case TypedValue::Type::Path: {
+      const auto edges = ReadRaw<uint64_t>(in);
+      Path path(ReadRaw<VertexAccessor>(in), memory);
+      for (uint64_t i = 0; i < edges; ++i) {
+        path.Expand(ReadRaw<EdgeAccessor>(in));
+        path.Expand(ReadRaw<VertexAccessor>(in));
+      }
+      return TypedValue(std::move(path), memory);
+    }
+    case TypedValue::Type::Date:
+      return TypedValue(utils::Date(ReadRaw<int64_t>(in)), memory);
+    case TypedValue::Type::LocalTime:
+      return TypedValue(utils::LocalTime(ReadRaw<int64_t>(in)), memory);
+    case TypedValue::Type::LocalDateTime:
+      return TypedValue(utils::LocalDateTime(ReadRaw<int64_t>(in)), memory);
+    case TypedValue::Type::Duration:
+      return TypedValue(utils::Duration(ReadRaw<int64_t>(in)), memory);
+    case TypedValue::Type::Point:
+      return TypedValue(ReadRaw<storage::Point>(in), memory);
+    case TypedValue::Type::Graph:
+      break;
+  }
+  throw QueryRuntimeException("Couldn't read a value spilled to the disk.");
+}
+
+bool IsSpillable(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::List:
+      return std::all_of(value.ValueList().begin(), value.ValueList().end(),
+                         [](const auto &element) { return IsSpillable(element); });
+    case TypedValue::Type::Map:
+      return std::all_of(value.ValueMap().begin(), value.ValueMap().end(),
+                         [](const auto &entry) { return IsSpillable(entry.second); });
+    case TypedValue::Type::Graph:
+      return false;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+size_t ApproximateSize(const TypedValue &value) {
+  size_t size = sizeof(TypedValue);
+  switch (value.type()) {
+    case TypedValue::Type::String:
+      size += value.ValueString().size();
+      break;
+    case TypedValue::Type::List:
+      for (const auto &element : value.ValueList()) size += ApproximateSize(element);
+      break;
+    case TypedValue::Type::Map:
+      for (const auto &[key, element] : value.ValueMap()) {
+        size += kMapEntryOverheadBytes + key.size() + ApproximateSize(element);
+      }
+      break;
+    case TypedValue::Type::Path:
+      size += value.ValuePath().vertices().size() * sizeof(VertexAccessor) +
+              value.ValuePath().edges().size() * sizeof(EdgeAccessor);
+      break;
+    case TypedValue::Type::Graph:
+      size += value.ValueGraph().vertices().size() * sizeof(VertexAccessor) +
+              value.ValueGraph().edges().size() * sizeof(EdgeAccessor);
+      break;
+    default:
+      break;
+  }
+  return size;
+}
+
+size_t ApproximateSize(const utils::pmr::vector<TypedValue> &values) {
+  size_t size = 0;
+  for (const auto &value : values) size += ApproximateSize(value);
+  return size;
+}
+
+bool IsSpillable(const utils::pmr::vector<TypedValue> &values) {
+  return std::all_of(values.begin(), values.end(), [](const auto &value) { return IsSpillable(value); });
+}
+
+SpillFile::SpillFile(const std::filesystem::path &directory) {
+  static std::atomic<uint64_t> next_file{0};
+  if (!utils::EnsureDir(directory)) {
+    throw QueryRuntimeException("Couldn't create the directory {} for spilling query results.", directory.string());
+  }
+  path_ = directory / std::to_string(next_file.fetch_add(1, std::memory_order_relaxed));
+  file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file_) {
+    throw QueryRuntimeException("Couldn't create the file {} for spilling query results.", path_.string());
+  }
+}
+
+SpillFile::~SpillFile() {
+  file_.close();
+  std::error_code error;
+  std::filesystem::remove(path_, error);
+}
+
+void SpillFile::Write(const utils::pmr::vector<TypedValue> &row) {
+  WriteRaw<uint64_t>(file_, row.size());
+  for (const auto &value : row) WriteValue(file_, value);
+  if (!file_) throw QueryRuntimeException("Couldn't write query results spilled to the disk.");
+  ++rows_;
+}
+
+void SpillFile::Rewind() {
+  file_.flush();
+  file_.seekg(0);
+  read_rows_ = 0;
+}
+
+bool SpillFile::Read(utils::pmr::vector<TypedValue> *row) {
+  if (read_rows_ == rows_) return false;
+  auto *memory = row->get_allocator().GetMemoryResource();
+  row->clear();
+  const auto size = ReadRaw<uint64_t>(file_);
+  row->reserve(size);
+  for (uint64_t i = 0; i < size; ++i) row->emplace_back(ReadValue(file_, memory));
+  if (!file_) throw QueryRuntimeException("Couldn't read query results spilled to the disk.");
+  ++read_rows_;
+  return true;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,77 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "query/typed_value.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query::plan {
+
+/// Number of files into which the operators keeping their rows in a hash table
+/// partition the rows they spill.
+constexpr size_t kSpillPartitions = 16;
+
+/// Returns the approximate memory used by the value.
+size_t ApproximateSize(const TypedValue &value);
+
+/// Returns the approximate memory used by the values.
+size_t ApproximateSize(const utils::pmr::vector<TypedValue> &values);
+
+/// Returns true if the values can be written to a `SpillFile`. Graph values
+/// can't be.
+bool IsSpillable(const utils::pmr::vector<TypedValue> &values);
+
+/**
+ * A temporary file into which an operator spills the rows it can't keep in
+ * memory. Each row is a vector of values, and the rows are read back in the
+ * order in which they were written.
+ *
+ * Vertices, edges and paths are written as their accessors, so the rows may
+ * only be read in the transaction which wrote them. The file is removed when
+ * the object is destroyed.
+ */
+class SpillFile {
+ public:
+  /// Creates an empty file in the `directory`, which is created if needed.
+  /// @throw QueryRuntimeException if the file can't be created.
+  explicit SpillFile(const std::filesystem::path &directory);
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+  ~SpillFile();
+
+  /// Appends the row, whose values must be spillable.
+  void Write(const utils::pmr::vector<TypedValue> &row);
+
+  /// Starts reading the rows from the first one.
+  void Rewind();
+
+  /// Reads the next row into `row`, allocating the values with its memory.
+  /// @return false if all rows were read.
+  bool Read(utils::pmr::vector<TypedValue> *row);
+
+  uint64_t Rows() const { return rows_; }
+
+ private:
+  std::filesystem::path path_;
+  std::fstream file_;
+  uint64_t rows_{0};
+  uint64_t read_rows_{0};
+};
+
+}  // namespace memgraph::query::plan
@@ -11,9 +11,12 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <queue>
 
+#include "utils/algorithm.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/logging.hpp"
 
@@ -25,6 +28,29 @@ namespace memgraph::query::plan::impl {
 
 namespace {
 
+// Matchings with at most this many expansions chained from the starting node
+// have their order searched exhaustively, longer ones are ordered greedily.
+constexpr size_t kMaxExhaustiveExpansions = 12;
+// Assumed average degree of vertices without statistics.
+constexpr double kDefaultDegree = 3.0;
+// Assumed selectivity of a property filter on a single node.
+constexpr double kPropertyFilterSelectivity = 0.25;
+// Assumed growth of the results of a variable length expansion compared to a
+// single expansion.
+constexpr double kVariableExpansionFactor = 3.0;
+
+// Flips the expansion to expand from its second node. Breadth-first expansions
+// are not flipped, because that changes their results.
+void FlipExpansion(Expansion &expansion) {
+  if (expansion.edge->type_ == EdgeAtom::Type::BREADTH_FIRST) return;
+  std::swap(expansion.node1, expansion.node2);
+  expansion.is_flipped = true;
+  if (expansion.direction != EdgeAtom::Direction::BOTH) {
+    expansion.direction =
+        expansion.direction == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
+  }
+}
+
 // Add applicable expansions for `node_symbol` to `next_expansions`. These
 // expansions are removed from `node_symbol_to_expansions`, while
 // `seen_expansions` and `expanded_symbols` are populated with new data.
@@ -71,15 +97,7 @@ void AddNextExpansions(const Symbol &node_symbol, const Matching &matching, cons
       // We are not expanding from node1, so flip the expansion.
       DMG_ASSERT(expansion.node2 && symbol_table.at(*expansion.node2->identifier_) == node_symbol,
                  "Expected node_symbol to be bound in node2");
-      if (expansion.edge->type_ != EdgeAtom::Type::BREADTH_FIRST) {
-        // BFS must *not* be flipped. Doing that changes the BFS results.
-        std::swap(expansion.node1, expansion.node2);
-        expansion.is_flipped = true;
-        if (expansion.direction != EdgeAtom::Direction::BOTH) {
-          expansion.direction =
-              expansion.direction == EdgeAtom::Direction::IN ? EdgeAtom::Direction::OUT : EdgeAtom::Direction::IN;
-        }
-      }
+      FlipExpansion(expansion);
     }
     seen_expansions.insert(expansion_id);
     expanded_symbols.insert(symbol_table.at(*expansion.node1->identifier_));
@@ -95,12 +113,195 @@ void AddNextExpansions(const Symbol &node_symbol, const Matching &matching, cons
   }
 }
 
+// Estimates the number of rows matched by the parts of a pattern, assuming
+// that the labels, the properties and the edges are independent.
+class PatternSizeEstimator {
+ public:
+  PatternSizeEstimator(const Matching &matching, const PatternEstimates &estimates)
+      : matching_(matching), estimates_(estimates) {}
+
+  // Estimated number of vertices matched by the node.
+  double NodeCount(const Symbol &symbol) const {
+    double count = estimates_.vertex_count;
+    for (const auto &label : matching_.filters.FilteredLabels(symbol)) {
+      if (auto label_count = estimates_.label_vertex_count(label)) count = std::min(count, *label_count);
+    }
+    for (const auto &filter : matching_.filters) {
+      if (filter.used_symbols.size() != 1U || !utils::Contains(filter.used_symbols, symbol)) continue;
+      if (filter.type == FilterInfo::Type::Property) count *= kPropertyFilterSelectivity;
+      if (filter.type == FilterInfo::Type::Id) count = std::min(count, 1.0);
+    }
+    return std::max(count, 1.0);
+  }
+
+  // Estimated fraction of the pairs of vertices which the expansion connects.
+  double EdgeSelectivity(const Expansion &expansion, const SymbolTable &symbol_table) const {
+    if (!expansion.edge) return 1.0;
+    std::optional<double> edge_count;
+    if (!expansion.edge->edge_types_.empty()) {
+      edge_count = 0.0;
+      for (const auto &edge_type : expansion.edge->edge_types_) {
+        auto type_count = estimates_.edge_type_count(edge_type);
+        if (!type_count) {
+          edge_count = std::nullopt;
+          break;
+        }
+        *edge_count += *type_count;
+      }
+    }
+    if (!edge_count) {
+      // The average degree of a labeled endpoint bounds the number of edges
+      // which can be matched from it.
+      for (const auto *node : {expansion.node1, expansion.node2}) {
+        for (const auto &label : matching_.filters.FilteredLabels(symbol_table.at(*node->identifier_))) {
+          auto label_count = estimates_.label_vertex_count(label);
+          auto avg_degree = estimates_.label_avg_degree(label);
+          if (!label_count || !avg_degree) continue;
+          edge_count = std::min(edge_count.value_or(std::numeric_limits<double>::max()), *label_count * *avg_degree);
+        }
+      }
+    }
+    double selectivity = edge_count.value_or(estimates_.vertex_count * kDefaultDegree) /
+                         (estimates_.vertex_count * estimates_.vertex_count);
+    if (expansion.direction == EdgeAtom::Direction::BOTH) selectivity *= 2.0;
+    if (expansion.edge->IsVariable()) selectivity *= kVariableExpansionFactor;
+    return selectivity;
+  }
+
+ private:
+  const Matching &matching_;
+  const PatternEstimates &estimates_;
+};
+
+// Orders the `chained` expansions of the matching, which can all be reached
+// from the start node, so that the estimated sum of the rows produced after
+// each expansion is the least. The size of a partial match doesn't depend on
+// the order of its expansions, so the best order of each set of expansions is
+// found by dynamic programming over the sets, which are extended one
+// expansion at a time as the plans are left deep. Long matchings take the
+// expansion producing the fewest rows at each step instead. Returns the
+// indices of the expansions in the matching, or nullopt if they couldn't be
+// ordered.
+std::optional<std::vector<size_t>> OrderExpansions(const NodeAtom *start_node, const std::vector<size_t> &chained,
+                                                   const Matching &matching, const SymbolTable &symbol_table,
+                                                   const PatternEstimates &estimates) {
+  // Symbols bound by the expansions are tracked as bits.
+  std::unordered_map<Symbol, size_t> symbol_bits;
+  bool too_many_symbols = false;
+  auto bit_of = [&](const Symbol &symbol) -> uint64_t {
+    auto [it, inserted] = symbol_bits.emplace(symbol, symbol_bits.size());
+    if (it->second >= 64U) {
+      too_many_symbols = true;
+      return 0;
+    }
+    return uint64_t{1} << it->second;
+  };
+
+  PatternSizeEstimator estimator(matching, estimates);
+  const auto start_bit = bit_of(symbol_table.at(*start_node->identifier_));
+  uint64_t node_bits = start_bit;
+  std::unordered_map<uint64_t, double> node_counts{
+      {start_bit, estimator.NodeCount(symbol_table.at(*start_node->identifier_))}};
+  std::vector<uint64_t> endpoints(chained.size(), 0);
+  std::vector<uint64_t> binds(chained.size(), 0);
+  std::vector<uint64_t> required(chained.size(), 0);
+  std::vector<double> selectivities(chained.size(), 1.0);
+  for (size_t i = 0; i < chained.size(); ++i) {
+    const auto &expansion = matching.expansions[chained[i]];
+    for (const auto *node : {expansion.node1, expansion.node2}) {
+      if (!node) continue;
+      const auto &symbol = symbol_table.at(*node->identifier_);
+      const auto bit = bit_of(symbol);
+      endpoints[i] |= bit;
+      if (!(node_bits & bit)) node_counts.emplace(bit, estimator.NodeCount(symbol));
+      node_bits |= bit;
+    }
+    binds[i] = endpoints[i];
+    if (expansion.edge) binds[i] |= bit_of(symbol_table.at(*expansion.edge->identifier_));
+    selectivities[i] = estimator.EdgeSelectivity(expansion, symbol_table);
+  }
+  for (size_t i = 0; i < chained.size(); ++i) {
+    for (const auto &range_symbol : matching.expansions[chained[i]].symbols_in_range) {
+      if (!utils::Contains(matching.expansion_symbols, range_symbol)) continue;
+      if (!utils::Contains(symbol_bits, range_symbol)) return std::nullopt;
+      required[i] |= bit_of(range_symbol);
+    }
+  }
+  if (too_many_symbols) return std::nullopt;
+
+  auto can_expand = [&](size_t i, uint64_t bound) { return (endpoints[i] & bound) && !(required[i] & ~bound); };
+  // Rows after extending the match of the `bound` symbols with the expansion.
+  auto extended_size = [&](double size, uint64_t bound, size_t i) {
+    size *= selectivities[i];
+    for (auto new_nodes = binds[i] & node_bits & ~bound; new_nodes; new_nodes &= new_nodes - 1) {
+      size *= node_counts.at(new_nodes & (~new_nodes + 1));
+    }
+    return size;
+  };
+
+  const auto start_size = node_counts.at(start_bit);
+  std::vector<size_t> order;
+  order.reserve(chained.size());
+  if (chained.size() > kMaxExhaustiveExpansions) {
+    uint64_t bound = start_bit;
+    double size = start_size;
+    std::vector<bool> used(chained.size(), false);
+    while (order.size() < chained.size()) {
+      std::optional<size_t> best;
+      double best_size = 0.0;
+      for (size_t i = 0; i < chained.size(); ++i) {
+        if (used[i] || !can_expand(i, bound)) continue;
+        const auto next_size = extended_size(size, bound, i);
+        if (!best || next_size < best_size) {
+          best = i;
+          best_size = next_size;
+        }
+      }
+      if (!best) return std::nullopt;
+      used[*best] = true;
+      bound |= binds[*best];
+      size = best_size;
+      order.push_back(chained[*best]);
+    }
+    return order;
+  }
+
+  const size_t sets = size_t{1} << chained.size();
+  std::vector<uint64_t> bound(sets, start_bit);
+  std::vector<double> size(sets, start_size);
+  std::vector<double> cost(sets, std::numeric_limits<double>::infinity());
+  std::vector<size_t> last(sets, 0);
+  cost[0] = 0.0;
+  for (size_t set = 0; set < sets; ++set) {
+    if (cost[set] == std::numeric_limits<double>::infinity()) continue;
+    for (size_t i = 0; i < chained.size(); ++i) {
+      const auto next = set | (size_t{1} << i);
+      if (next == set || !can_expand(i, bound[set])) continue;
+      // Every order reaching the same set binds the same symbols and produces
+      // the same number of rows.
+      bound[next] = bound[set] | binds[i];
+      size[next] = extended_size(size[set], bound[set], i);
+      if (cost[set] + size[next] < cost[next]) {
+        cost[next] = cost[set] + size[next];
+        last[next] = i;
+      }
+    }
+  }
+  if (cost[sets - 1] == std::numeric_limits<double>::infinity()) return std::nullopt;
+  for (auto set = sets - 1; set; set &= ~(size_t{1} << last[set])) {
+    order.push_back(chained[last[set]]);
+  }
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
 // Generates expansions emanating from the start_node by forming a chain. When
 // the chain can no longer be continued, a different starting node is picked
 // among remaining expansions and the process continues. This is done until all
-// matching.expansions are used.
+// matching.expansions are used. With estimates, the chained expansions are
+// reordered by OrderExpansions.
 std::vector<Expansion> ExpansionsFrom(const NodeAtom *start_node, const Matching &matching,
-                                      const SymbolTable &symbol_table) {
+                                      const SymbolTable &symbol_table, const PatternEstimates *estimates) {
   // Make a copy of node_symbol_to_expansions, because we will modify it as
   // expansions are chained.
   auto node_symbol_to_expansions = matching.node_symbol_to_expansions;
@@ -125,6 +326,24 @@ std::vector<Expansion> ExpansionsFrom(const NodeAtom *start_node, const Matching
       add_next_expansions(expansion.node2);
     }
   }
+  if (estimates && expansions.size() > 1) {
+    std::vector<size_t> chained(seen_expansions.begin(), seen_expansions.end());
+    std::sort(chained.begin(), chained.end());
+    if (auto order = OrderExpansions(start_node, chained, matching, symbol_table, *estimates)) {
+      std::unordered_set<Symbol> bound_symbols({symbol_table.at(*start_node->identifier_)});
+      expansions.clear();
+      for (const auto i : *order) {
+        auto &expansion = expansions.emplace_back(matching.expansions[i]);
+        if (!utils::Contains(bound_symbols, symbol_table.at(*expansion.node1->identifier_))) {
+          FlipExpansion(expansion);
+        }
+        bound_symbols.insert(symbol_table.at(*expansion.node1->identifier_));
+        if (expansion.node2) {
+          bound_symbols.insert(symbol_table.at(*expansion.node2->identifier_));
+        }
+      }
+    }
+  }
   if (!node_symbol_to_expansions.empty()) {
     // We could pick a new starting expansion, but to avoid runtime
     // complexity, simply append the remaining expansions. They should have the
@@ -169,8 +388,12 @@ FilterMatching ToFilterMatching(Matching &matching) {
 
 }  // namespace
 
-VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table)
-    : matching_(matching), symbol_table_(symbol_table), nodes_(ExpansionNodes(matching.expansions, symbol_table)) {}
+VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table,
+                                     std::shared_ptr<const PatternEstimates> estimates)
+    : matching_(matching),
+      symbol_table_(symbol_table),
+      nodes_(ExpansionNodes(matching.expansions, symbol_table)),
+      estimates_(std::move(estimates)) {}
 
 VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     : self_(self),
@@ -183,7 +406,8 @@ VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     // Overwrite the original matching expansions with the new ones by
     // generating it from the first start node.
     start_nodes_it_ = self_->nodes_.begin();
-    current_matching_.expansions = ExpansionsFrom(**start_nodes_it_, self_->matching_, self_->symbol_table_);
+    current_matching_.expansions =
+        ExpansionsFrom(**start_nodes_it_, self_->matching_, self_->symbol_table_, self_->estimates_.get());
   }
   DMG_ASSERT(start_nodes_it_ || self_->nodes_.empty(),
              "start_nodes_it_ should only be nullopt when self_->nodes_ is empty");
@@ -207,22 +431,25 @@ VaryMatchingStart::iterator &VaryMatchingStart::iterator::operator++() {
     return *this;
   }
   const auto &start_node = **start_nodes_it_;
-  current_matching_.expansions = ExpansionsFrom(start_node, self_->matching_, self_->symbol_table_);
+  current_matching_.expansions =
+      ExpansionsFrom(start_node, self_->matching_, self_->symbol_table_, self_->estimates_.get());
   return *this;
 }
 
 CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &matchings,
-                                                            const SymbolTable &symbol_table) {
+                                                            const SymbolTable &symbol_table,
+                                                            const std::shared_ptr<const PatternEstimates> &estimates) {
   std::vector<VaryMatchingStart> variants;
   variants.reserve(matchings.size());
   for (const auto &matching : matchings) {
-    variants.emplace_back(VaryMatchingStart(matching, symbol_table));
+    variants.emplace_back(VaryMatchingStart(matching, symbol_table, estimates));
   }
   return MakeCartesianProduct(std::move(variants));
 }
 
 CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching,
-                                                             const SymbolTable &symbol_table) {
+                                                             const SymbolTable &symbol_table,
+                                                             const std::shared_ptr<const PatternEstimates> &estimates) {
   auto filter_matchings_cnt = 0;
   for (const auto &filter : matching.filters) {
     filter_matchings_cnt += static_cast<int>(filter.matchings.size());
@@ -233,19 +460,20 @@ CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &mat
 
   for (const auto &filter : matching.filters) {
     for (const auto &filter_matching : filter.matchings) {
-      variants.emplace_back(filter_matching, symbol_table);
+      variants.emplace_back(filter_matching, symbol_table, estimates);
     }
   }
 
   return MakeCartesianProduct(std::move(variants));
 }
 
-VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table)
+VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table,
+                                             std::shared_ptr<const PatternEstimates> estimates)
     : query_part_(std::move(query_part)),
-      matchings_(VaryMatchingStart(query_part_.matching, symbol_table)),
-      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table)),
-      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table)),
-      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table)) {}
+      matchings_(VaryMatchingStart(query_part_.matching, symbol_table, estimates)),
+      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table, estimates)),
+      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table, estimates)),
+      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table, estimates)) {}
 
 VaryQueryPartMatching::iterator::iterator(const SingleQueryPart &query_part,
                                           VaryMatchingStart::iterator matchings_begin,
@@ -12,6 +12,11 @@
 /// @file
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+
 #include "cppitertools/imap.hpp"
 #include "cppitertools/slice.hpp"
 #include "gflags/gflags.h"
@@ -178,11 +183,23 @@ class NodeSymbolEqual {
   const SymbolTable &symbol_table_;
 };
 
+/// Estimated sizes of the graph, used for ordering the expansions of a
+/// matching. The functions return nullopt when there is no estimate.
+struct PatternEstimates {
+  double vertex_count{1.0};
+  std::function<std::optional<double>(const LabelIx &)> label_vertex_count;
+  std::function<std::optional<double>(const LabelIx &)> label_avg_degree;
+  std::function<std::optional<double>(const EdgeTypeIx &)> edge_type_count;
+};
+
 // Generates n matchings, where n is the number of nodes to match. Each Matching
-// will have a different node as a starting node for expansion.
+// will have a different node as a starting node for expansion. With estimates,
+// the expansions from each starting node are ordered so that the estimated
+// intermediate results are the smallest, otherwise they are chained
+// breadth-first.
 class VaryMatchingStart {
  public:
-  VaryMatchingStart(Matching, const SymbolTable &);
+  VaryMatchingStart(Matching, const SymbolTable &, std::shared_ptr<const PatternEstimates> estimates = nullptr);
 
   class iterator {
    public:
@@ -223,20 +240,24 @@ class VaryMatchingStart {
   Matching matching_;
   const SymbolTable &symbol_table_;
   std::unordered_set<NodeAtom *, NodeSymbolHash, NodeSymbolEqual> nodes_;
+  std::shared_ptr<const PatternEstimates> estimates_;
 };
 
 // Similar to VaryMatchingStart, but varies the starting nodes for all given
 // matchings. After all matchings produce multiple alternative starts, the
 // Cartesian product of all of them is returned.
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &);
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &,
+                                                            const std::shared_ptr<const PatternEstimates> &);
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table);
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table,
+                                                             const std::shared_ptr<const PatternEstimates> &estimates);
 
 // Produces alternative query parts out of a single part by varying how each
 // graph matching is done.
 class VaryQueryPartMatching {
  public:
-  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &);
+  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &,
+                        std::shared_ptr<const PatternEstimates> estimates = nullptr);
 
   class iterator {
    public:
@@ -318,13 +339,38 @@ class VariableStartPlanner {
 
     auto single_query_parts = ExtractSingleQueryParts(std::make_unique<QueryParts>(query_parts));
 
+    auto estimates = MakePatternEstimates();
     for (const auto &single_query_part : single_query_parts) {
-      varying_query_matchings.emplace_back(single_query_part, symbol_table);
+      varying_query_matchings.emplace_back(single_query_part, symbol_table, estimates);
     }
 
     return iter::slice(MakeCartesianProduct(std::move(varying_query_matchings)), 0UL, FLAGS_query_max_plans);
   }
 
+  // Estimates the pattern sizes from the counts and the statistics of the
+  // indices. Labels and edge types without an index have no estimate.
+  std::shared_ptr<const impl::PatternEstimates> MakePatternEstimates() {
+    auto *db = context_->db;
+    auto estimates = std::make_shared<impl::PatternEstimates>();
+    estimates->vertex_count = std::max(1.0, static_cast<double>(db->VerticesCount()));
+    estimates->label_vertex_count = [db](const LabelIx &label_ix) -> std::optional<double> {
+      auto label = db->NameToLabel(label_ix.name);
+      if (!db->LabelIndexExists(label)) return std::nullopt;
+      return static_cast<double>(db->VerticesCount(label));
+    };
+    estimates->label_avg_degree = [db](const LabelIx &label_ix) -> std::optional<double> {
+      auto stats = db->GetIndexStats(db->NameToLabel(label_ix.name));
+      if (!stats) return std::nullopt;
+      return stats->avg_degree;
+    };
+    estimates->edge_type_count = [db](const EdgeTypeIx &edge_type_ix) -> std::optional<double> {
+      auto edge_type = db->NameToEdgeType(edge_type_ix.name);
+      if (!db->EdgeTypeIndexExists(edge_type)) return std::nullopt;
+      return static_cast<double>(db->EdgesCount(edge_type));
+    };
+    return estimates;
+  }
+
   std::vector<SingleQueryPart> ExtractSingleQueryParts(const std::shared_ptr<QueryParts> query_parts) {
     std::vector<SingleQueryPart> results;
 
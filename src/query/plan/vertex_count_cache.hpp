@@ -12,16 +12,57 @@
 /// @file
 #pragma once
 
+#include <algorithm>
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "query/typed_value.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/indices/text_index.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/bound.hpp"
 #include "utils/fnv.hpp"
 
 namespace memgraph::query::plan {
 
+/// Counts which the cost estimates of a plan relied on. Counts of specific
+/// property values are left out, because cached plans are shared between the
+/// values of a query's parameters.
+struct PlanCardinalities {
+  std::optional<int64_t> vertices_count;
+  std::vector<std::pair<storage::LabelId, int64_t>> label_vertex_counts;
+  std::vector<std::pair<std::pair<storage::LabelId, storage::PropertyId>, int64_t>> label_property_vertex_counts;
+  std::vector<std::pair<storage::EdgeTypeId, int64_t>> edge_type_edge_counts;
+
+  /// Returns true if any current count differs from the recorded one by more
+  /// than `max_ratio` times, or if an index the count was read from is gone.
+  template <class TDbAccessor>
+  bool HasDrifted(TDbAccessor *db, double max_ratio) const {
+    auto drifted = [max_ratio](int64_t recorded, int64_t current) {
+      const auto lower = static_cast<double>(std::min(recorded, current)) + 1.0;
+      const auto higher = static_cast<double>(std::max(recorded, current)) + 1.0;
+      return higher / lower > max_ratio;
+    };
+    if (vertices_count && drifted(*vertices_count, db->VerticesCount())) return true;
+    for (const auto &[label, count] : label_vertex_counts) {
+      if (!db->LabelIndexExists(label) || drifted(count, db->VerticesCount(label))) return true;
+    }
+    for (const auto &[key, count] : label_property_vertex_counts) {
+      const auto &[label, property] = key;
+      if (!db->LabelPropertyIndexExists(label, property) || drifted(count, db->VerticesCount(label, property))) {
+        return true;
+      }
+    }
+    for (const auto &[edge_type, count] : edge_type_edge_counts) {
+      if (!db->EdgeTypeIndexExists(edge_type) || drifted(count, db->EdgesCount(edge_type))) return true;
+    }
+    return false;
+  }
+};
+
 /// A stand in class for `TDbAccessor` which provides memoized calls to
 /// `VerticesCount`.
 template <class TDbAccessor>
@@ -31,6 +72,7 @@ class VertexCountCache {
 
   auto NameToLabel(const std::string &name) { return db_->NameToLabel(name); }
   auto NameToProperty(const std::string &name) { return db_->NameToProperty(name); }
+  auto PropertyToName(storage::PropertyId property) const { return db_->PropertyToName(property); }
   auto NameToEdgeType(const std::string &name) { return db_->NameToEdgeType(name); }
 
   int64_t VerticesCount() {
@@ -72,12 +114,103 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    auto key = std::make_pair(label, properties);
+    if (label_properties_vertex_count_.find(key) == label_properties_vertex_count_.end())
+      label_properties_vertex_count_[key] = db_->VerticesCount(label, properties);
+    return label_properties_vertex_count_.at(key);
+  }
+
+  // Lookups by a prefix are not memoized, each candidate composite index is
+  // estimated only once per planned scan.
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return db_->VerticesCount(label, properties, prefix, lower, upper);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, storage::PropertyId property, storage::TextMatch match,
+                        std::string_view pattern) {
+    return db_->VerticesCount(label, property, match, pattern);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, storage::PropertyId property, const storage::PointRegion &region) {
+    return db_->VerticesCount(label, property, region);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type) {
+    if (edge_type_edge_count_.find(edge_type) == edge_type_edge_count_.end())
+      edge_type_edge_count_[edge_type] = db_->EdgesCount(edge_type);
+    return edge_type_edge_count_.at(edge_type);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgesCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property, const storage::PropertyValue &value) {
+    return db_->EdgesCount(edge_type, property, value);
+  }
+
+  int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                     const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return db_->EdgesCount(edge_type, property, lower, upper);
+  }
+
+  /// Returns the counts looked up so far.
+  PlanCardinalities Cardinalities() const {
+    PlanCardinalities cardinalities{.vertices_count = vertices_count_};
+    cardinalities.label_vertex_counts.assign(label_vertex_count_.begin(), label_vertex_count_.end());
+    cardinalities.label_property_vertex_counts.assign(label_property_vertex_count_.begin(),
+                                                      label_property_vertex_count_.end());
+    cardinalities.edge_type_edge_counts.assign(edge_type_edge_count_.begin(), edge_type_edge_count_.end());
+    return cardinalities;
+  }
+
+  /// Adds the counts looked up by the `other` cache, which was copied from
+  /// this one, and which this one didn't look up.
+  void Merge(const VertexCountCache &other) {
+    if (!vertices_count_) vertices_count_ = other.vertices_count_;
+    label_vertex_count_.insert(other.label_vertex_count_.begin(), other.label_vertex_count_.end());
+    label_property_vertex_count_.insert(other.label_property_vertex_count_.begin(),
+                                        other.label_property_vertex_count_.end());
+    label_properties_vertex_count_.insert(other.label_properties_vertex_count_.begin(),
+                                          other.label_properties_vertex_count_.end());
+    for (const auto &[key, counts] : other.property_value_vertex_count_) {
+      property_value_vertex_count_[key].insert(counts.begin(), counts.end());
+    }
+    for (const auto &[key, counts] : other.property_bounds_vertex_count_) {
+      property_bounds_vertex_count_[key].insert(counts.begin(), counts.end());
+    }
+    edge_type_edge_count_.insert(other.edge_type_edge_count_.begin(), other.edge_type_edge_count_.end());
+  }
+
   bool LabelIndexExists(storage::LabelId label) { return db_->LabelIndexExists(label); }
 
+  bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
+
+  bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
+    return db_->EdgeTypePropertyIndexExists(edge_type, property);
+  }
+
   bool LabelPropertyIndexExists(storage::LabelId label, storage::PropertyId property) {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  bool TextIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->TextIndexExists(label, property);
+  }
+
+  bool PointIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->PointIndexExists(label, property);
+  }
+
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) {
+    return db_->LabelPropertyCompositeIndices(label);
+  }
+
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const {
     return db_->GetIndexStats(label);
   }
@@ -87,6 +220,11 @@ class VertexCountCache {
     return db_->GetIndexStats(label, property);
   }
 
+  std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+      const storage::LabelId &label, const std::vector<storage::PropertyId> &properties) const {
+    return db_->GetIndexStats(label, properties);
+  }
+
  private:
   typedef std::pair<storage::LabelId, storage::PropertyId> LabelPropertyKey;
 
@@ -131,6 +269,7 @@ class VertexCountCache {
   std::optional<int64_t> vertices_count_;
   std::unordered_map<storage::LabelId, int64_t> label_vertex_count_;
   std::unordered_map<LabelPropertyKey, int64_t, LabelPropertyHash> label_property_vertex_count_;
+  std::map<std::pair<storage::LabelId, std::vector<storage::PropertyId>>, int64_t> label_properties_vertex_count_;
   std::unordered_map<
       LabelPropertyKey,
       std::unordered_map<query::TypedValue, int64_t, query::TypedValue::Hash, query::TypedValue::BoolEqual>,
@@ -139,6 +278,7 @@ class VertexCountCache {
   std::unordered_map<LabelPropertyKey, std::unordered_map<BoundsKey, int64_t, BoundsHash, BoundsEqual>,
                      LabelPropertyHash>
       property_bounds_vertex_count_;
+  std::unordered_map<storage::EdgeTypeId, int64_t> edge_type_edge_count_;
 };
 
 template <class TDbAccessor>
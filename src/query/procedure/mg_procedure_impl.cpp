@@ -12,16 +12,19 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <exception>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <regex>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "license/license.hpp"
 #include "mg_procedure.h"
@@ -38,8 +41,10 @@
 #include "utils/logging.hpp"
 #include "utils/math.hpp"
 #include "utils/memory.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/variant_helpers.hpp"
 
 #include <cppitertools/filter.hpp>
@@ -203,7 +208,7 @@ template <typename TFunc, typename... Args>
 
 // Graph mutations
 bool MgpGraphIsMutable(const mgp_graph &graph) noexcept {
-  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr;
+  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr && !graph.read_only;
 }
 
 bool MgpVertexIsMutable(const mgp_vertex &vertex) { return MgpGraphIsMutable(*vertex.graph); }
@@ -304,6 +309,8 @@ mgp_value_type FromTypedValueType(memgraph::query::TypedValue::Type type) {
       return MGP_VALUE_TYPE_LOCAL_DATE_TIME;
     case memgraph::query::TypedValue::Type::Duration:
       return MGP_VALUE_TYPE_DURATION;
+    case memgraph::query::TypedValue::Type::Point:
+      throw std::logic_error{"mgp_value for TypedValue::Type::Point doesn't exist."};
     case memgraph::query::TypedValue::Type::Graph:
       throw std::logic_error{"mgp_value for TypedValue::Type::Graph doesn't exist."};
   }
@@ -629,7 +636,10 @@ mgp_value::mgp_value(const memgraph::storage::PropertyValue &pv, memgraph::utils
           break;
         }
       }
+      break;
     }
+    case memgraph::storage::PropertyValue::Type::Point:
+      throw std::logic_error{"mgp_value for PropertyValue::Type::Point doesn't exist."};
   }
 }
 
@@ -2868,10 +2878,12 @@ void NextPermitted(mgp_vertices_iterator &it) {
 
 /// @throw anything VerticesIterable may throw
 mgp_vertices_iterator::mgp_vertices_iterator(mgp_graph *graph, memgraph::utils::MemoryResource *memory)
-    : memory(memory),
-      graph(graph),
-      vertices(std::visit([graph](auto *impl) { return impl->Vertices(graph->view); }, graph->impl)),
-      current_it(vertices.begin()) {
+    : mgp_vertices_iterator(graph, std::visit([graph](auto *impl) { return impl->Vertices(graph->view); }, graph->impl),
+                            memory) {}
+
+mgp_vertices_iterator::mgp_vertices_iterator(mgp_graph *graph, memgraph::query::VerticesIterable vertices,
+                                             memgraph::utils::MemoryResource *memory)
+    : memory(memory), graph(graph), vertices(std::move(vertices)), current_it(this->vertices.begin()) {
 #ifdef MG_ENTERPRISE
   if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     NextPermitted(*this);
@@ -2949,6 +2961,418 @@ mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **res
       result);
 }
 
+namespace {
+
+// Number of chunks of the projected vertices per parallel worker.
+constexpr size_t kProjectionChunksPerWorker = 4;
+
+// Vertices of a graph, split into chunks which are projected on the parallel
+// execution threads when the query runs with them.
+struct VertexChunks {
+  std::vector<memgraph::query::VerticesIterable> iterables;
+  bool parallel{false};
+  // The vertices have to be checked for the label when they aren't read from
+  // the label index.
+  bool check_label{false};
+};
+
+VertexChunks SplitVertices(const mgp_graph &graph, memgraph::query::DbAccessor *dba,
+                           std::optional<memgraph::storage::LabelId> label_id) {
+  const auto view = graph.view;
+  const bool use_label_index = label_id && dba->LabelIndexExists(*label_id);
+  VertexChunks chunks{.check_label = label_id && !use_label_index};
+  const auto *ctx = graph.ctx;
+  if (ctx && ctx->parallel_execution_pool && ctx->parallel_workers > 1) {
+    const auto num_chunks = ctx->parallel_workers * kProjectionChunksPerWorker;
+    chunks.iterables = use_label_index ? dba->ChunkedVertices(view, *label_id, num_chunks)
+                                       : dba->ChunkedVertices(view, num_chunks);
+  }
+  // The chunks are projected on the calling thread when the storage can't
+  // split the vertices.
+  chunks.parallel = !chunks.iterables.empty();
+  if (!chunks.parallel) {
+    chunks.iterables.push_back(use_label_index ? dba->Vertices(view, *label_id) : dba->Vertices(view));
+  }
+  return chunks;
+}
+
+// Calls `project` with the index of each chunk, on the parallel execution
+// threads if the chunks are parallel.
+template <typename TFunc>
+void ForEachChunk(const mgp_graph &graph, const VertexChunks &chunks, const TFunc &project) {
+  const auto num_chunks = chunks.iterables.size();
+  if (!chunks.parallel) {
+    for (size_t i = 0; i < num_chunks; ++i) project(i);
+    return;
+  }
+  auto *ctx = graph.ctx;
+  std::atomic<size_t> next_chunk{0};
+  std::vector<std::exception_ptr> errors(ctx->parallel_workers);
+  memgraph::utils::RunParallelWorkers(*ctx->parallel_execution_pool, ctx->parallel_workers, [&](size_t worker) {
+    try {
+      for (auto i = next_chunk.fetch_add(1); i < num_chunks; i = next_chunk.fetch_add(1)) project(i);
+    } catch (...) {
+      errors[worker] = std::current_exception();
+    }
+  });
+  for (const auto &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+memgraph::query::DbAccessor *ProjectedDbAccessor(mgp_graph *graph) {
+  auto *const *maybe_dba = std::get_if<memgraph::query::DbAccessor *>(&graph->impl);
+  if (!maybe_dba) {
+    throw std::logic_error{"Subgraphs can't be projected."};
+  }
+  return *maybe_dba;
+}
+
+// Vertices projected from a single chunk, together with their edges.
+struct CsrChunk {
+  std::vector<int64_t> vertex_ids;
+  // Number of the edges of each vertex.
+  std::vector<uint64_t> degrees;
+  // IDs of the vertices which the edges lead to, replaced by the numbers of
+  // the vertices once all vertices are numbered.
+  std::vector<int64_t> neighbours;
+  std::vector<double> weights;
+  // Numbers of the first vertex and the first edge of the chunk.
+  uint64_t first_vertex{0};
+  uint64_t first_edge{0};
+};
+
+double CsrEdgeWeight(const memgraph::query::EdgeAccessor &edge, memgraph::storage::View view,
+                     memgraph::storage::PropertyId property, double default_weight) {
+  auto maybe_value = edge.GetProperty(view, property);
+  if (maybe_value.HasError()) return default_weight;
+  if (maybe_value->IsInt()) return static_cast<double>(maybe_value->ValueInt());
+  if (maybe_value->IsDouble()) return maybe_value->ValueDouble();
+  return default_weight;
+}
+
+void ProjectCsr(mgp_graph *graph, const char *label, const char *edge_type, const char *weight_property,
+                double default_weight, mgp_csr *csr) {
+  auto *dba = ProjectedDbAccessor(graph);
+  const auto view = graph->view;
+  std::optional<memgraph::storage::LabelId> label_id;
+  if (label) label_id = dba->NameToLabel(label);
+  std::vector<memgraph::storage::EdgeTypeId> edge_types;
+  if (edge_type) edge_types.push_back(dba->NameToEdgeType(edge_type));
+  std::optional<memgraph::storage::PropertyId> weight_id;
+  if (weight_property) weight_id = dba->NameToProperty(weight_property);
+
+  auto vertex_chunks = SplitVertices(*graph, dba, label_id);
+  const bool parallel = vertex_chunks.parallel;
+  auto &iterables = vertex_chunks.iterables;
+  std::vector<CsrChunk> chunks(iterables.size());
+  const auto for_each_chunk = [&](const auto &project) { ForEachChunk(*graph, vertex_chunks, project); };
+
+  {
+    // The workers only read the transaction, so its caches mustn't change.
+    if (parallel) dba->FreezeTransactionCaches(true);
+    memgraph::utils::OnScopeExit unfreeze{[dba, parallel] {
+      if (parallel) dba->FreezeTransactionCaches(false);
+    }};
+    for_each_chunk([&](size_t i) {
+      auto &chunk = chunks[i];
+      for (auto vertex : iterables[i]) {
+        if (vertex_chunks.check_label) {
+          auto has_label = vertex.HasLabel(view, *label_id);
+          if (has_label.HasError() || !*has_label) continue;
+        }
+        if (!parallel) dba->PrefetchOutEdges(vertex);
+        auto maybe_edges = vertex.OutEdges(view, edge_types);
+        if (maybe_edges.HasError()) continue;
+        chunk.vertex_ids.push_back(vertex.Gid().AsInt());
+        chunk.degrees.push_back(maybe_edges->edges.size());
+        for (const auto &edge : maybe_edges->edges) {
+          chunk.neighbours.push_back(edge.To().Gid().AsInt());
+          if (weight_id) chunk.weights.push_back(CsrEdgeWeight(edge, view, *weight_id, default_weight));
+        }
+      }
+    });
+  }
+
+  auto &vertex_ids = csr->vertex_ids;
+  for (auto &chunk : chunks) {
+    chunk.first_vertex = vertex_ids.size();
+    vertex_ids.insert(vertex_ids.end(), chunk.vertex_ids.begin(), chunk.vertex_ids.end());
+  }
+  // The vertices are in the order of their IDs unless they come from the label
+  // index, in which case their numbers are sorted by their IDs for the lookup.
+  std::vector<uint64_t> numbers_by_id;
+  if (!std::is_sorted(vertex_ids.begin(), vertex_ids.end())) {
+    numbers_by_id.resize(vertex_ids.size());
+    std::iota(numbers_by_id.begin(), numbers_by_id.end(), 0);
+    std::sort(numbers_by_id.begin(), numbers_by_id.end(),
+              [&vertex_ids](uint64_t first, uint64_t second) { return vertex_ids[first] < vertex_ids[second]; });
+  }
+  const auto find_number = [&](int64_t id) -> std::optional<uint64_t> {
+    if (numbers_by_id.empty()) {
+      auto it = std::lower_bound(vertex_ids.begin(), vertex_ids.end(), id);
+      if (it == vertex_ids.end() || *it != id) return std::nullopt;
+      return it - vertex_ids.begin();
+    }
+    auto it = std::lower_bound(numbers_by_id.begin(), numbers_by_id.end(), id,
+                               [&vertex_ids](uint64_t number, int64_t id) { return vertex_ids[number] < id; });
+    if (it == numbers_by_id.end() || vertex_ids[*it] != id) return std::nullopt;
+    return *it;
+  };
+
+  // The edges leading to the vertices which aren't projected are dropped.
+  for_each_chunk([&](size_t i) {
+    auto &chunk = chunks[i];
+    size_t read = 0;
+    size_t written = 0;
+    for (auto &degree : chunk.degrees) {
+      const auto end = read + degree;
+      for (; read < end; ++read) {
+        const auto number = find_number(chunk.neighbours[read]);
+        if (!number) {
+          --degree;
+          continue;
+        }
+        chunk.neighbours[written] = static_cast<int64_t>(*number);
+        if (weight_id) chunk.weights[written] = chunk.weights[read];
+        ++written;
+      }
+    }
+    chunk.neighbours.resize(written);
+    if (weight_id) chunk.weights.resize(written);
+  });
+
+  uint64_t num_edges = 0;
+  for (auto &chunk : chunks) {
+    chunk.first_edge = num_edges;
+    num_edges += chunk.neighbours.size();
+  }
+  csr->offsets.resize(vertex_ids.size() + 1);
+  csr->neighbours.resize(num_edges);
+  csr->weighted = weight_id.has_value();
+  if (csr->weighted) csr->weights.resize(num_edges);
+  csr->offsets.back() = num_edges;
+  for_each_chunk([&](size_t i) {
+    const auto &chunk = chunks[i];
+    auto offset = chunk.first_edge;
+    for (size_t j = 0; j < chunk.degrees.size(); ++j) {
+      csr->offsets[chunk.first_vertex + j] = offset;
+      offset += chunk.degrees[j];
+    }
+    std::copy(chunk.neighbours.begin(), chunk.neighbours.end(), csr->neighbours.begin() + chunk.first_edge);
+    if (csr->weighted) std::copy(chunk.weights.begin(), chunk.weights.end(), csr->weights.begin() + chunk.first_edge);
+  });
+}
+
+}  // namespace
+
+void mgp_csr_destroy(mgp_csr *csr) { DeleteRawMgpObject(csr); }
+
+mgp_error mgp_graph_project_csr(mgp_graph *graph, const char *label, const char *edge_type, const char *weight_property,
+                                double default_weight, mgp_memory *memory, mgp_csr **result) {
+  return WrapExceptions(
+      [=] {
+        auto csr = NewMgpObject<mgp_csr>(memory);
+        ProjectCsr(graph, label, edge_type, weight_property, default_weight, csr.get());
+        return csr.release();
+      },
+      result);
+}
+
+mgp_error mgp_csr_vertices_count(mgp_csr *csr, size_t *result) {
+  *result = csr->vertex_ids.size();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_csr_edges_count(mgp_csr *csr, size_t *result) {
+  *result = csr->neighbours.size();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_csr_offsets(mgp_csr *csr, const uint64_t **result) {
+  *result = csr->offsets.data();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_csr_neighbours(mgp_csr *csr, const uint64_t **result) {
+  *result = csr->neighbours.data();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_csr_weights(mgp_csr *csr, const double **result) {
+  *result = csr->weighted ? csr->weights.data() : nullptr;
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_csr_vertex_id(mgp_csr *csr, size_t index, mgp_vertex_id *result) {
+  return WrapExceptions([csr, index] { return mgp_vertex_id{.as_int = csr->vertex_ids.at(index)}; }, result);
+}
+
+namespace {
+
+// Vertices and values copied from a single chunk.
+struct PropertyColumnChunk {
+  std::vector<int64_t> vertex_ids;
+  std::vector<double> values;
+};
+
+void ProjectPropertyColumn(mgp_graph *graph, const char *label, const char *property, double default_value,
+                           mgp_property_column *column) {
+  auto *dba = ProjectedDbAccessor(graph);
+  const auto view = graph->view;
+  std::optional<memgraph::storage::LabelId> label_id;
+  if (label) label_id = dba->NameToLabel(label);
+  const auto property_id = dba->NameToProperty(property);
+
+  auto vertex_chunks = SplitVertices(*graph, dba, label_id);
+  std::vector<PropertyColumnChunk> chunks(vertex_chunks.iterables.size());
+  {
+    // The workers only read the transaction, so its caches mustn't change.
+    if (vertex_chunks.parallel) dba->FreezeTransactionCaches(true);
+    memgraph::utils::OnScopeExit unfreeze{[dba, parallel = vertex_chunks.parallel] {
+      if (parallel) dba->FreezeTransactionCaches(false);
+    }};
+    ForEachChunk(*graph, vertex_chunks, [&](size_t i) {
+      auto &chunk = chunks[i];
+      for (auto vertex : vertex_chunks.iterables[i]) {
+        if (vertex_chunks.check_label) {
+          auto has_label = vertex.HasLabel(view, *label_id);
+          if (has_label.HasError() || !*has_label) continue;
+        }
+        auto maybe_value = vertex.GetProperty(view, property_id);
+        auto value = default_value;
+        if (!maybe_value.HasError()) {
+          if (maybe_value->IsInt()) value = static_cast<double>(maybe_value->ValueInt());
+          if (maybe_value->IsDouble()) value = maybe_value->ValueDouble();
+        }
+        chunk.vertex_ids.push_back(vertex.Gid().AsInt());
+        chunk.values.push_back(value);
+      }
+    });
+  }
+
+  size_t size = 0;
+  for (const auto &chunk : chunks) size += chunk.values.size();
+  column->vertex_ids.reserve(size);
+  column->values.reserve(size);
+  for (const auto &chunk : chunks) {
+    column->vertex_ids.insert(column->vertex_ids.end(), chunk.vertex_ids.begin(), chunk.vertex_ids.end());
+    column->values.insert(column->values.end(), chunk.values.begin(), chunk.values.end());
+  }
+}
+
+}  // namespace
+
+void mgp_property_column_destroy(mgp_property_column *column) { DeleteRawMgpObject(column); }
+
+mgp_error mgp_graph_property_column(mgp_graph *graph, const char *label, const char *property, double default_value,
+                                    mgp_memory *memory, mgp_property_column **result) {
+  return WrapExceptions(
+      [=] {
+        auto column = NewMgpObject<mgp_property_column>(memory);
+        ProjectPropertyColumn(graph, label, property, default_value, column.get());
+        return column.release();
+      },
+      result);
+}
+
+mgp_error mgp_property_column_size(mgp_property_column *column, size_t *result) {
+  *result = column->values.size();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_property_column_values(mgp_property_column *column, const double **result) {
+  *result = column->values.data();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_property_column_vertex_ids(mgp_property_column *column, const int64_t **result) {
+  *result = column->vertex_ids.data();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+namespace {
+
+// Number of vertex partitions per worker of a parallel procedure. Smaller
+// partitions balance the work of the workers better.
+constexpr size_t kPartitionsPerWorker = 4;
+
+constexpr size_t kWorkerPoolMaxBlockSize = 1024;
+
+// Returns the workers which may read the graph in parallel, 1 if the graph is
+// read on the calling thread.
+size_t ParallelWorkers(const mgp_graph &graph) {
+  const auto *ctx = graph.ctx;
+  if (!ctx || !ctx->parallel_execution_pool || ctx->parallel_workers < 2 || ctx->is_profile_query) return 1;
+  if (!std::holds_alternative<memgraph::query::DbAccessor *>(graph.impl)) return 1;
+#ifdef MG_ENTERPRISE
+  if (ctx->auth_checker) return 1;
+#endif
+  return ctx->parallel_workers;
+}
+
+void ParallelForVertices(mgp_graph *graph, mgp_vertices_partition_cb cb, void *payload) {
+  // The workers share the context of the procedure, so they can check whether
+  // the query must abort.
+  mgp_graph worker_graph{graph->impl, graph->view, graph->ctx, true};
+  std::vector<memgraph::query::VerticesIterable> partitions;
+  const auto num_workers = ParallelWorkers(*graph);
+  memgraph::query::DbAccessor *dba = nullptr;
+  if (num_workers > 1) {
+    dba = std::get<memgraph::query::DbAccessor *>(graph->impl);
+    partitions = dba->ChunkedVertices(graph->view, num_workers * kPartitionsPerWorker);
+  }
+  if (partitions.size() < 2) {
+    // The worker's memory is released when it's done, like in parallel.
+    memgraph::utils::ResourceWithOutOfMemoryException upstream;
+    memgraph::utils::PoolResource worker_memory(128, kWorkerPoolMaxBlockSize, &upstream, &upstream);
+    mgp_memory memory{&worker_memory};
+    auto *vertices = NewRawMgpObject<mgp_vertices_iterator>(&memory, &worker_graph);
+    cb(vertices, 0, &memory, payload);
+    return;
+  }
+
+  std::atomic<size_t> next_partition{0};
+  std::vector<std::exception_ptr> errors(num_workers);
+  const auto work = [&](size_t worker) {
+    try {
+      // Allocations past the memory limit fail in the workers as they do in
+      // the query.
+      memgraph::utils::ResourceWithOutOfMemoryException upstream;
+      for (auto i = next_partition.fetch_add(1); i < partitions.size(); i = next_partition.fetch_add(1)) {
+        // The partitions left once the query is aborted aren't read.
+        if (memgraph::query::MustAbort(*graph->ctx) != memgraph::query::AbortReason::NO_ABORT) return;
+        memgraph::utils::PoolResource worker_memory(128, kWorkerPoolMaxBlockSize, &upstream, &upstream);
+        mgp_memory memory{&worker_memory};
+        auto *vertices = NewRawMgpObject<mgp_vertices_iterator>(&memory, &worker_graph, std::move(partitions[i]));
+        cb(vertices, worker, &memory, payload);
+      }
+    } catch (...) {
+      errors[worker] = std::current_exception();
+    }
+  };
+  {
+    // The workers only read the transaction, so its caches mustn't change.
+    dba->FreezeTransactionCaches(true);
+    memgraph::utils::OnScopeExit unfreeze{[dba] { dba->FreezeTransactionCaches(false); }};
+    memgraph::utils::RunParallelWorkers(*graph->ctx->parallel_execution_pool, num_workers, work);
+  }
+  for (const auto &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+}
+
+}  // namespace
+
+mgp_error mgp_graph_parallel_workers(mgp_graph *graph, size_t *result) {
+  *result = ParallelWorkers(*graph);
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_graph_parallel_for_vertices(mgp_graph *graph, mgp_vertices_partition_cb cb, void *payload) {
+  return WrapExceptions([=] { ParallelForVertices(graph, cb, payload); });
+}
+
 /// Type System
 ///
 /// All types are allocated globally, so that we simplify the API and minimize
@@ -3167,12 +3591,45 @@ mgp_error mgp_proc_add_opt_arg(mgp_proc *proc, const char *name, mgp_type *type,
   return MgpAddOptArg(*proc, std::string(name), *type, *default_value);
 }
 
+namespace {
+
+std::optional<mgp_scalar_type> ScalarTypeOf(const CypherType &type) {
+  if (dynamic_cast<const BoolType *>(&type)) return MGP_SCALAR_TYPE_BOOL;
+  if (dynamic_cast<const IntType *>(&type)) return MGP_SCALAR_TYPE_INT;
+  if (dynamic_cast<const FloatType *>(&type)) return MGP_SCALAR_TYPE_DOUBLE;
+  if (dynamic_cast<const StringType *>(&type)) return MGP_SCALAR_TYPE_STRING;
+  return std::nullopt;
+}
+
+// Adds the argument with `add_arg` and records its scalar type if `func` is a
+// scalar function.
+template <typename TAddArg>
+mgp_error AddFuncArg(mgp_func &func, const char *name, const mgp_type &type, const TAddArg &add_arg) {
+  if (!func.scalar_cb) return add_arg();
+  const auto scalar_type = ScalarTypeOf(*type.impl);
+  if (const auto err = WrapExceptions([&] {
+        if (!scalar_type) {
+          throw std::invalid_argument{fmt::format(
+              "Argument '{}' of scalar function '{}' must be a boolean, an integer, a float or a string", name,
+              func.name)};
+        }
+      });
+      err != mgp_error::MGP_ERROR_NO_ERROR) {
+    return err;
+  }
+  if (const auto err = add_arg(); err != mgp_error::MGP_ERROR_NO_ERROR) return err;
+  return WrapExceptions([&] { func.scalar_arg_types.push_back(*scalar_type); });
+}
+
+}  // namespace
+
 mgp_error mgp_func_add_arg(mgp_func *func, const char *name, mgp_type *type) {
-  return MgpAddArg(*func, std::string(name), *type);
+  return AddFuncArg(*func, name, *type, [&] { return MgpAddArg(*func, std::string(name), *type); });
 }
 
 mgp_error mgp_func_add_opt_arg(mgp_func *func, const char *name, mgp_type *type, mgp_value *default_value) {
-  return MgpAddOptArg(*func, std::string(name), *type, *default_value);
+  return AddFuncArg(*func, name, *type,
+                    [&] { return MgpAddOptArg(*func, std::string(name), *type, *default_value); });
 }
 
 namespace {
@@ -3213,6 +3670,15 @@ mgp_error mgp_proc_add_deprecated_result(mgp_proc *proc, const char *name, mgp_t
   return AddResultToProp(proc, name, type, true);
 }
 
+mgp_error mgp_proc_set_deterministic(mgp_proc *proc) {
+  return WrapExceptions([proc] {
+    if (proc->info.is_write || proc->info.is_batched) {
+      throw std::logic_error{fmt::format("Procedure '{}' can't be deterministic.", proc->name)};
+    }
+    proc->info.is_deterministic = true;
+  });
+}
+
 int mgp_must_abort(mgp_graph *graph) {
   MG_ASSERT(graph->ctx);
   static_assert(noexcept(memgraph::query::MustAbort(*graph->ctx)));
@@ -3271,6 +3737,8 @@ std::ostream &PrintValue(const TypedValue &value, std::ostream *stream) {
       return (*stream) << value.ValueLocalDateTime();
     case TypedValue::Type::Duration:
       return (*stream) << value.ValueDuration();
+    case TypedValue::Type::Point:
+      return (*stream) << value.ValuePoint();
     case TypedValue::Type::Vertex:
     case TypedValue::Type::Edge:
     case TypedValue::Type::Path:
@@ -3488,6 +3956,108 @@ mgp_error mgp_module_add_transformation(mgp_module *module, const char *name, mg
   });
 }
 
+mgp_commit_changes::mgp_commit_changes(const memgraph::storage::CommitChanges &changes,
+                                       const memgraph::query::DbAccessor &dba, memgraph::utils::MemoryResource *memory)
+    : commit_timestamp(changes.commit_timestamp), changes(memory), values(memory) {
+  const auto vertex_change = [](mgp_commit_change_type type, memgraph::storage::Gid gid) {
+    mgp_commit_change change{};
+    change.type = type;
+    change.vertex_id.as_int = gid.AsInt();
+    return change;
+  };
+  const auto edge_change = [&dba](mgp_commit_change_type type, const memgraph::storage::CommitChanges::Edge &edge) {
+    mgp_commit_change change{};
+    change.type = type;
+    change.vertex_id.as_int = edge.from_vertex.AsInt();
+    change.to_vertex_id.as_int = edge.to_vertex.AsInt();
+    change.edge_id.as_int = edge.gid.AsInt();
+    change.edge_type.name = dba.EdgeTypeToName(edge.edge_type).c_str();
+    return change;
+  };
+  const auto label_change = [&dba](mgp_commit_change_type type, const memgraph::storage::CommitChanges::Label &label) {
+    mgp_commit_change change{};
+    change.type = type;
+    change.vertex_id.as_int = label.vertex.AsInt();
+    change.label.name = dba.LabelToName(label.label).c_str();
+    return change;
+  };
+  const auto property_change = [this, &dba](mgp_commit_change_type type,
+                                            const memgraph::storage::CommitChanges::Property &property) {
+    mgp_commit_change change{};
+    change.type = type;
+    (type == MGP_COMMIT_CHANGE_SET_VERTEX_PROPERTY ? change.vertex_id.as_int : change.edge_id.as_int) =
+        property.object.AsInt();
+    change.property_name = dba.PropertyToName(property.property).c_str();
+    change.old_value = &values.emplace_back(property.old_value);
+    change.new_value = &values.emplace_back(property.new_value);
+    return change;
+  };
+
+  this->changes.reserve(changes.created_vertices.size() + changes.created_edges.size() + changes.set_labels.size() +
+                        changes.removed_labels.size() + changes.vertex_properties.size() +
+                        changes.edge_properties.size() + changes.deleted_edges.size() +
+                        changes.deleted_vertices.size());
+  for (const auto gid : changes.created_vertices) {
+    this->changes.push_back(vertex_change(MGP_COMMIT_CHANGE_CREATED_VERTEX, gid));
+  }
+  for (const auto &edge : changes.created_edges) {
+    this->changes.push_back(edge_change(MGP_COMMIT_CHANGE_CREATED_EDGE, edge));
+  }
+  for (const auto &label : changes.set_labels) {
+    this->changes.push_back(label_change(MGP_COMMIT_CHANGE_SET_VERTEX_LABEL, label));
+  }
+  for (const auto &label : changes.removed_labels) {
+    this->changes.push_back(label_change(MGP_COMMIT_CHANGE_REMOVED_VERTEX_LABEL, label));
+  }
+  for (const auto &property : changes.vertex_properties) {
+    this->changes.push_back(property_change(MGP_COMMIT_CHANGE_SET_VERTEX_PROPERTY, property));
+  }
+  for (const auto &property : changes.edge_properties) {
+    this->changes.push_back(property_change(MGP_COMMIT_CHANGE_SET_EDGE_PROPERTY, property));
+  }
+  for (const auto &edge : changes.deleted_edges) {
+    this->changes.push_back(edge_change(MGP_COMMIT_CHANGE_DELETED_EDGE, edge));
+  }
+  for (const auto gid : changes.deleted_vertices) {
+    this->changes.push_back(vertex_change(MGP_COMMIT_CHANGE_DELETED_VERTEX, gid));
+  }
+}
+
+mgp_error mgp_commit_changes_timestamp(mgp_commit_changes *changes, uint64_t *result) {
+  *result = changes->commit_timestamp;
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_commit_changes_size(mgp_commit_changes *changes, size_t *result) {
+  static_assert(noexcept(changes->changes.size()));
+  *result = changes->changes.size();
+  return mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_error mgp_commit_changes_at(mgp_commit_changes *changes, size_t index, mgp_commit_change *result) {
+  return WrapExceptions(
+      [changes, index] {
+        if (index >= Call<size_t>(mgp_commit_changes_size, changes)) {
+          throw std::out_of_range("Change cannot be retrieved, because index exceeds changes' size!");
+        }
+        return changes->changes[index];
+      },
+      result);
+}
+
+mgp_error mgp_module_add_commit_hook(mgp_module *module, const char *name, mgp_commit_hook_cb cb) {
+  return WrapExceptions([=] {
+    if (!IsValidIdentifierName(name)) {
+      throw std::invalid_argument{fmt::format("Invalid commit hook name: {}", name)};
+    }
+    if (module->commit_hooks.find(name) != module->commit_hooks.end()) {
+      throw std::logic_error{fmt::format("Commit hook already exists with name '{}'", name)};
+    };
+    auto *memory = module->commit_hooks.get_allocator().GetMemoryResource();
+    module->commit_hooks.emplace(name, mgp_commit_hook(name, cb, memory));
+  });
+}
+
 mgp_error mgp_module_add_function(mgp_module *module, const char *name, mgp_func_cb cb, mgp_func **result) {
   return WrapExceptions(
       [=] {
@@ -3504,6 +4074,23 @@ mgp_error mgp_module_add_function(mgp_module *module, const char *name, mgp_func
       result);
 }
 
+mgp_error mgp_module_add_scalar_function(mgp_module *module, const char *name, mgp_scalar_func_cb cb,
+                                         mgp_scalar_type result_type, mgp_func **result) {
+  return WrapExceptions(
+      [=] {
+        if (!IsValidIdentifierName(name)) {
+          throw std::invalid_argument{fmt::format("Invalid function name: {}", name)};
+        }
+        if (module->functions.find(name) != module->functions.end()) {
+          throw std::logic_error{fmt::format("Function with similar name already exists '{}'", name)};
+        };
+        auto *memory = module->functions.get_allocator().GetMemoryResource();
+
+        return &module->functions.emplace(name, mgp_func(name, cb, result_type, memory)).first->second;
+      },
+      result);
+}
+
 mgp_error mgp_log(const mgp_log_level log_level, const char *output) {
   return WrapExceptions([=] {
     switch (log_level) {
@@ -26,8 +26,10 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/procedure/cypher_type_ptr.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/commit_changes.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/memory.hpp"
+#include "utils/pmr/deque.hpp"
 #include "utils/pmr/map.hpp"
 #include "utils/pmr/string.hpp"
 #include "utils/pmr/vector.hpp"
@@ -560,6 +562,9 @@ struct mgp_graph {
   // TODO: Merge `mgp_graph` and `mgp_memory` into a single `mgp_context`. The
   // `ctx` field is out of place here.
   memgraph::query::ExecutionContext *ctx;
+  // Set for the graphs read by the workers of a parallel procedure, which
+  // share the context but mustn't modify the graph.
+  bool read_only{false};
 
   static mgp_graph WritableGraph(memgraph::query::DbAccessor &acc, memgraph::storage::View view,
                                  memgraph::query::ExecutionContext &ctx) {
@@ -706,6 +711,10 @@ struct mgp_vertices_iterator {
   /// @throw anything VerticesIterable may throw
   mgp_vertices_iterator(mgp_graph *graph, memgraph::utils::MemoryResource *memory);
 
+  /// Iterates a part of the vertices of the graph.
+  mgp_vertices_iterator(mgp_graph *graph, memgraph::query::VerticesIterable vertices,
+                        memgraph::utils::MemoryResource *memory);
+
   memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
 
   memgraph::utils::MemoryResource *memory;
@@ -715,6 +724,38 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_csr {
+  using allocator_type = memgraph::utils::Allocator<mgp_csr>;
+
+  explicit mgp_csr(memgraph::utils::MemoryResource *memory)
+      : memory(memory), vertex_ids(memory), offsets(memory), neighbours(memory), weights(memory) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  /// IDs of the vertices, indexed by their numbers.
+  memgraph::utils::pmr::vector<int64_t> vertex_ids;
+  memgraph::utils::pmr::vector<uint64_t> offsets;
+  memgraph::utils::pmr::vector<uint64_t> neighbours;
+  /// Weights of the edges, empty if the edges have no weights.
+  memgraph::utils::pmr::vector<double> weights;
+  bool weighted{false};
+};
+
+struct mgp_property_column {
+  using allocator_type = memgraph::utils::Allocator<mgp_property_column>;
+
+  explicit mgp_property_column(memgraph::utils::MemoryResource *memory)
+      : memory(memory), vertex_ids(memory), values(memory) {}
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  memgraph::utils::pmr::vector<int64_t> vertex_ids;
+  /// Values of the vertices, in the order of `vertex_ids`.
+  memgraph::utils::pmr::vector<double> values;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
@@ -722,6 +763,8 @@ struct mgp_type {
 struct ProcedureInfo {
   bool is_write{false};
   bool is_batched{false};
+  // The records of a deterministic procedure may be cached.
+  bool is_deterministic{false};
   std::optional<memgraph::query::AuthQuery::Privilege> required_privilege = std::nullopt;
 };
 struct mgp_proc {
@@ -878,18 +921,38 @@ struct mgp_func {
   /// @throw std::length_error
   mgp_func(const char *name, std::function<void(mgp_list *, mgp_func_context *, mgp_func_result *, mgp_memory *)> cb,
            memgraph::utils::MemoryResource *memory)
-      : name(name, memory), cb(cb), args(memory), opt_args(memory) {}
+      : name(name, memory), cb(cb), args(memory), opt_args(memory), scalar_arg_types(memory) {}
+
+  /// @throw std::bad_alloc
+  /// @throw std::length_error
+  mgp_func(const char *name, mgp_scalar_func_cb scalar_cb, mgp_scalar_type scalar_result_type,
+           memgraph::utils::MemoryResource *memory)
+      : name(name, memory),
+        args(memory),
+        opt_args(memory),
+        scalar_cb(scalar_cb),
+        scalar_result_type(scalar_result_type),
+        scalar_arg_types(memory) {}
 
   /// @throw std::bad_alloc
   /// @throw std::length_error
   mgp_func(const mgp_func &other, memgraph::utils::MemoryResource *memory)
-      : name(other.name, memory), cb(other.cb), args(other.args, memory), opt_args(other.opt_args, memory) {}
+      : name(other.name, memory),
+        cb(other.cb),
+        args(other.args, memory),
+        opt_args(other.opt_args, memory),
+        scalar_cb(other.scalar_cb),
+        scalar_result_type(other.scalar_result_type),
+        scalar_arg_types(other.scalar_arg_types, memory) {}
 
   mgp_func(mgp_func &&other, memgraph::utils::MemoryResource *memory)
       : name(std::move(other.name), memory),
         cb(std::move(other.cb)),
         args(std::move(other.args), memory),
-        opt_args(std::move(other.opt_args), memory) {}
+        opt_args(std::move(other.opt_args), memory),
+        scalar_cb(other.scalar_cb),
+        scalar_result_type(other.scalar_result_type),
+        scalar_arg_types(std::move(other.scalar_arg_types), memory) {}
 
   mgp_func(const mgp_func &other) = default;
   mgp_func(mgp_func &&other) = default;
@@ -910,6 +973,63 @@ struct mgp_func {
   memgraph::utils::pmr::vector<std::tuple<memgraph::utils::pmr::string, const memgraph::query::procedure::CypherType *,
                                           memgraph::query::TypedValue>>
       opt_args;
+  /// Entry-point of a scalar function, which is called instead of `cb` if set.
+  mgp_scalar_func_cb scalar_cb{nullptr};
+  mgp_scalar_type scalar_result_type{MGP_SCALAR_TYPE_BOOL};
+  /// Types of the required and then the optional arguments of a scalar function.
+  memgraph::utils::pmr::vector<mgp_scalar_type> scalar_arg_types;
+};
+
+struct mgp_commit_hook {
+  using allocator_type = memgraph::utils::Allocator<mgp_commit_hook>;
+
+  /// @throw std::bad_alloc
+  /// @throw std::length_error
+  mgp_commit_hook(const char *name, mgp_commit_hook_cb cb, memgraph::utils::MemoryResource *memory)
+      : name(name, memory), cb(cb) {}
+
+  /// @throw std::bad_alloc
+  /// @throw std::length_error
+  mgp_commit_hook(const mgp_commit_hook &other, memgraph::utils::MemoryResource *memory)
+      : name(other.name, memory), cb(other.cb) {}
+
+  mgp_commit_hook(mgp_commit_hook &&other, memgraph::utils::MemoryResource *memory)
+      : name(std::move(other.name), memory), cb(std::move(other.cb)) {}
+
+  mgp_commit_hook(const mgp_commit_hook &other) = default;
+  mgp_commit_hook(mgp_commit_hook &&other) = default;
+
+  mgp_commit_hook &operator=(const mgp_commit_hook &) = delete;
+  mgp_commit_hook &operator=(mgp_commit_hook &&) = delete;
+
+  ~mgp_commit_hook() = default;
+
+  /// Name of the commit hook.
+  memgraph::utils::pmr::string name;
+  /// Entry-point for the commit hook.
+  std::function<void(mgp_commit_changes *, mgp_memory *)> cb;
+};
+
+struct mgp_commit_changes {
+  using allocator_type = memgraph::utils::Allocator<mgp_commit_changes>;
+
+  /// Converts the changes, taking the names of their labels, edge types and
+  /// properties from `dba`.
+  /// @throw std::bad_alloc
+  mgp_commit_changes(const memgraph::storage::CommitChanges &changes, const memgraph::query::DbAccessor &dba,
+                     memgraph::utils::MemoryResource *memory);
+
+  mgp_commit_changes(const mgp_commit_changes &) = delete;
+  mgp_commit_changes(mgp_commit_changes &&) = delete;
+  mgp_commit_changes &operator=(const mgp_commit_changes &) = delete;
+  mgp_commit_changes &operator=(mgp_commit_changes &&) = delete;
+  ~mgp_commit_changes() = default;
+
+  uint64_t commit_timestamp;
+  memgraph::utils::pmr::vector<mgp_commit_change> changes;
+  /// Property values the changes point to. The deque doesn't move them when it
+  /// grows.
+  memgraph::utils::pmr::deque<mgp_value> values;
 };
 
 mgp_error MgpTransAddFixedResult(mgp_trans *trans) noexcept;
@@ -918,17 +1038,19 @@ struct mgp_module {
   using allocator_type = memgraph::utils::Allocator<mgp_module>;
 
   explicit mgp_module(memgraph::utils::MemoryResource *memory)
-      : procedures(memory), transformations(memory), functions(memory) {}
+      : procedures(memory), transformations(memory), functions(memory), commit_hooks(memory) {}
 
   mgp_module(const mgp_module &other, memgraph::utils::MemoryResource *memory)
       : procedures(other.procedures, memory),
         transformations(other.transformations, memory),
-        functions(other.functions, memory) {}
+        functions(other.functions, memory),
+        commit_hooks(other.commit_hooks, memory) {}
 
   mgp_module(mgp_module &&other, memgraph::utils::MemoryResource *memory)
       : procedures(std::move(other.procedures), memory),
         transformations(std::move(other.transformations), memory),
-        functions(std::move(other.functions), memory) {}
+        functions(std::move(other.functions), memory),
+        commit_hooks(std::move(other.commit_hooks), memory) {}
 
   mgp_module(const mgp_module &) = default;
   mgp_module(mgp_module &&) = default;
@@ -941,6 +1063,7 @@ struct mgp_module {
   memgraph::utils::pmr::map<memgraph::utils::pmr::string, mgp_proc> procedures;
   memgraph::utils::pmr::map<memgraph::utils::pmr::string, mgp_trans> transformations;
   memgraph::utils::pmr::map<memgraph::utils::pmr::string, mgp_func> functions;
+  memgraph::utils::pmr::map<memgraph::utils::pmr::string, mgp_commit_hook> commit_hooks;
 };
 
 namespace memgraph::query::procedure {
@@ -11,8 +11,11 @@
 
 #include "query/procedure/module.hpp"
 
+#include <algorithm>
 #include <filesystem>
+#include <chrono>
 #include <optional>
+#include <thread>
 
 extern "C" {
 #include <dlfcn.h>
@@ -77,6 +80,8 @@ class BuiltinModule final : public Module {
 
   const std::map<std::string, mgp_func, std::less<>> *Functions() const override;
 
+  const std::map<std::string, mgp_commit_hook, std::less<>> *CommitHooks() const override;
+
   void AddProcedure(std::string_view name, mgp_proc proc);
 
   void AddTransformation(std::string_view name, mgp_trans trans);
@@ -88,6 +93,7 @@ class BuiltinModule final : public Module {
   std::map<std::string, mgp_proc, std::less<>> procedures_;
   std::map<std::string, mgp_trans, std::less<>> transformations_;
   std::map<std::string, mgp_func, std::less<>> functions_;
+  std::map<std::string, mgp_commit_hook, std::less<>> commit_hooks_;
 };
 
 BuiltinModule::BuiltinModule() {}
@@ -102,6 +108,9 @@ const std::map<std::string, mgp_trans, std::less<>> *BuiltinModule::Transformati
   return &transformations_;
 }
 const std::map<std::string, mgp_func, std::less<>> *BuiltinModule::Functions() const { return &functions_; }
+const std::map<std::string, mgp_commit_hook, std::less<>> *BuiltinModule::CommitHooks() const {
+  return &commit_hooks_;
+}
 
 void BuiltinModule::AddProcedure(std::string_view name, mgp_proc proc) { procedures_.emplace(name, std::move(proc)); }
 
@@ -111,45 +120,27 @@ void BuiltinModule::AddTransformation(std::string_view name, mgp_trans trans) {
 
 namespace {
 
-auto WithUpgradedLock(auto *lock, const auto &function) {
-  lock->unlock_shared();
-  utils::OnScopeExit shared_lock{[&] { lock->lock_shared(); }};
-  function();
-};
-
-void RegisterMgLoad(ModuleRegistry *module_registry, utils::RWLock *lock, BuiltinModule *module) {
-  // Loading relies on the fact that regular procedure invocation through
-  // CallProcedureCursor::Pull takes ModuleRegistry::lock_ with READ access. To
-  // load modules we have to upgrade our READ access to WRITE access,
-  // therefore we release the READ lock and invoke the load function which
-  // takes the WRITE lock. Obviously, some other thread may take a READ or WRITE
-  // lock during our transition when we hold no such lock. In this case it is
-  // fine, because our builtin module cannot be unloaded and we are ok with
-  // using the new state of module_registry when we manage to acquire the lock
-  // we desire. Note, deadlock between threads should not be possible, because a
-  // single thread may only take either a READ or a WRITE lock, it's not
-  // possible for a thread to hold both. If a thread tries to do that, it will
-  // deadlock immediately (no other thread needs to do anything).
-  auto load_all_cb = [module_registry, lock](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result * /*result*/,
-                                             mgp_memory * /*memory*/) {
-    WithUpgradedLock(lock, [&]() { module_registry->UnloadAndLoadModulesFromDirectories(); });
+void RegisterMgLoad(ModuleRegistry *module_registry, BuiltinModule *module) {
+  // Reloading waits until the reloaded modules aren't used anymore. The
+  // procedure invocation through CallProcedureCursor::Pull only uses the
+  // builtin module, which is never reloaded, so the calls below can't wait on
+  // themselves.
+  auto load_all_cb = [module_registry](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result * /*result*/,
+                                       mgp_memory * /*memory*/) {
+    module_registry->UnloadAndLoadModulesFromDirectories();
   };
   mgp_proc load_all("load_all", load_all_cb, utils::NewDeleteResource());
   module->AddProcedure("load_all", std::move(load_all));
-  auto load_cb = [module_registry, lock](mgp_list *args, mgp_graph * /*graph*/, mgp_result *result,
-                                         mgp_memory * /*memory*/) {
+  auto load_cb = [module_registry](mgp_list *args, mgp_graph * /*graph*/, mgp_result *result,
+                                   mgp_memory * /*memory*/) {
     MG_ASSERT(Call<size_t>(mgp_list_size, args) == 1U, "Should have been type checked already");
     auto *arg = Call<mgp_value *>(mgp_list_at, args, 0);
     MG_ASSERT(CallBool(mgp_value_is_string, arg), "Should have been type checked already");
     bool succ = false;
-    WithUpgradedLock(lock, [&]() {
-      const char *arg_as_string{nullptr};
-      if (const auto err = mgp_value_get_string(arg, &arg_as_string); err != mgp_error::MGP_ERROR_NO_ERROR) {
-        succ = false;
-      } else {
-        succ = module_registry->LoadOrReloadModuleFromName(arg_as_string);
-      }
-    });
+    const char *arg_as_string{nullptr};
+    if (const auto err = mgp_value_get_string(arg, &arg_as_string); err == mgp_error::MGP_ERROR_NO_ERROR) {
+      succ = module_registry->LoadOrReloadModuleFromName(arg_as_string);
+    }
     if (!succ) {
       MG_ASSERT(mgp_result_set_error_msg(result, "Failed to (re)load the module.") == mgp_error::MGP_ERROR_NO_ERROR);
     }
@@ -173,15 +164,13 @@ std::string GetPathString(const std::optional<std::filesystem::path> &path) {
 }
 }  // namespace
 
-void RegisterMgProcedures(
-    // We expect modules to be sorted by name.
-    const std::map<std::string, std::unique_ptr<Module>, std::less<>> *all_modules, BuiltinModule *module) {
-  auto procedures_cb = [all_modules](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result *result,
-                                     mgp_memory *memory) {
-    // Iterating over all_modules assumes that the standard mechanism of custom
-    // procedure invocations takes the ModuleRegistry::lock_ with READ access.
-    // For details on how the invocation is done, take a look at the
-    // CallProcedureCursor::Pull implementation.
+void RegisterMgProcedures(const ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto procedures_cb = [module_registry](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result *result,
+                                         mgp_memory *memory) {
+    // The modules which are loaded on first use are listed as well. We expect
+    // modules to be sorted by name.
+    module_registry->LoadPendingModules();
+    const auto all_modules = module_registry->Modules();
     for (const auto &[module_name, module] : *all_modules) {
       // Return the results in sorted order by module and by procedure.
       static_assert(
@@ -271,10 +260,11 @@ void RegisterMgProcedures(
   module->AddProcedure("procedures", std::move(procedures));
 }
 
-void RegisterMgTransformations(const std::map<std::string, std::unique_ptr<Module>, std::less<>> *all_modules,
-                               BuiltinModule *module) {
-  auto transformations_cb = [all_modules](mgp_list * /*unused*/, mgp_graph * /*unused*/, mgp_result *result,
-                                          mgp_memory *memory) {
+void RegisterMgTransformations(const ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto transformations_cb = [module_registry](mgp_list * /*unused*/, mgp_graph * /*unused*/, mgp_result *result,
+                                              mgp_memory *memory) {
+    module_registry->LoadPendingModules();
+    const auto all_modules = module_registry->Modules();
     for (const auto &[module_name, module] : *all_modules) {
       // Return the results in sorted order by module and by transformation.
       static_assert(
@@ -335,13 +325,13 @@ void RegisterMgTransformations(const std::map<std::string, std::unique_ptr<Modul
   module->AddProcedure("transformations", std::move(procedures));
 }
 
-void RegisterMgFunctions(
-    // We expect modules to be sorted by name.
-    const std::map<std::string, std::unique_ptr<Module>, std::less<>> *all_modules, BuiltinModule *module) {
-  auto functions_cb = [all_modules](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result *result,
-                                    mgp_memory *memory) {
-    // Iterating over all_modules assumes that the standard mechanism of magic
-    // functions invocations takes the ModuleRegistry::lock_ with READ access.
+void RegisterMgFunctions(const ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto functions_cb = [module_registry](mgp_list * /*args*/, mgp_graph * /*graph*/, mgp_result *result,
+                                        mgp_memory *memory) {
+    // The modules which are loaded on first use are listed as well. We expect
+    // modules to be sorted by name.
+    module_registry->LoadPendingModules();
+    const auto all_modules = module_registry->Modules();
     for (const auto &[module_name, module] : *all_modules) {
       // Return the results in sorted order by module and by function_name.
       static_assert(std::is_same_v<decltype(module->Functions()), const std::map<std::string, mgp_func, std::less<>> *>,
@@ -585,9 +575,9 @@ utils::BasicResult<std::string> WriteToFile(const std::filesystem::path &file, c
 }
 }  // namespace
 
-void RegisterMgCreateModuleFile(ModuleRegistry *module_registry, utils::RWLock *lock, BuiltinModule *module) {
-  auto create_module_file_cb = [module_registry, lock](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
-                                                       mgp_memory *memory) {
+void RegisterMgCreateModuleFile(ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto create_module_file_cb = [module_registry](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
+                                                 mgp_memory *memory) {
     MG_ASSERT(Call<size_t>(mgp_list_size, args) == 2U, "Should have been type checked already");
     auto *filename_arg = Call<mgp_value *>(mgp_list_at, args, 0);
     MG_ASSERT(CallBool(mgp_value_is_string, filename_arg), "Should have been type checked already");
@@ -643,7 +633,7 @@ void RegisterMgCreateModuleFile(ModuleRegistry *module_registry, utils::RWLock *
       return;
     }
 
-    WithUpgradedLock(lock, [&]() { module_registry->UnloadAndLoadModulesFromDirectories(); });
+    module_registry->UnloadAndLoadModulesFromDirectories();
   };
   mgp_proc create_module_file("create_module_file", std::move(create_module_file_cb), utils::NewDeleteResource(),
                               {.required_privilege = AuthQuery::Privilege::MODULE_WRITE});
@@ -656,9 +646,9 @@ void RegisterMgCreateModuleFile(ModuleRegistry *module_registry, utils::RWLock *
   module->AddProcedure("create_module_file", std::move(create_module_file));
 }
 
-void RegisterMgUpdateModuleFile(ModuleRegistry *module_registry, utils::RWLock *lock, BuiltinModule *module) {
-  auto update_module_file_cb = [module_registry, lock](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
-                                                       mgp_memory * /*memory*/) {
+void RegisterMgUpdateModuleFile(ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto update_module_file_cb = [module_registry](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
+                                                 mgp_memory * /*memory*/) {
     MG_ASSERT(Call<size_t>(mgp_list_size, args) == 2U, "Should have been type checked already");
     auto *path_arg = Call<mgp_value *>(mgp_list_at, args, 0);
     MG_ASSERT(CallBool(mgp_value_is_string, path_arg), "Should have been type checked already");
@@ -701,7 +691,7 @@ void RegisterMgUpdateModuleFile(ModuleRegistry *module_registry, utils::RWLock *
       return;
     }
 
-    WithUpgradedLock(lock, [&]() { module_registry->UnloadAndLoadModulesFromDirectories(); });
+    module_registry->UnloadAndLoadModulesFromDirectories();
   };
   mgp_proc update_module_file("update_module_file", std::move(update_module_file_cb), utils::NewDeleteResource(),
                               {.required_privilege = AuthQuery::Privilege::MODULE_WRITE});
@@ -712,9 +702,9 @@ void RegisterMgUpdateModuleFile(ModuleRegistry *module_registry, utils::RWLock *
   module->AddProcedure("update_module_file", std::move(update_module_file));
 }
 
-void RegisterMgDeleteModuleFile(ModuleRegistry *module_registry, utils::RWLock *lock, BuiltinModule *module) {
-  auto delete_module_file_cb = [module_registry, lock](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
-                                                       mgp_memory * /*memory*/) {
+void RegisterMgDeleteModuleFile(ModuleRegistry *module_registry, BuiltinModule *module) {
+  auto delete_module_file_cb = [module_registry](mgp_list *args, mgp_graph * /*unused*/, mgp_result *result,
+                                                 mgp_memory * /*memory*/) {
     MG_ASSERT(Call<size_t>(mgp_list_size, args) == 1U, "Should have been type checked already");
     auto *path_arg = Call<mgp_value *>(mgp_list_at, args, 0);
     MG_ASSERT(CallBool(mgp_value_is_string, path_arg), "Should have been type checked already");
@@ -760,7 +750,7 @@ void RegisterMgDeleteModuleFile(ModuleRegistry *module_registry, utils::RWLock *
       parent_path = parent_path.parent_path();
     }
 
-    WithUpgradedLock(lock, [&]() { module_registry->UnloadAndLoadModulesFromDirectories(); });
+    module_registry->UnloadAndLoadModulesFromDirectories();
   };
   mgp_proc delete_module_file("delete_module_file", std::move(delete_module_file_cb), utils::NewDeleteResource(),
                               {.required_privilege = AuthQuery::Privilege::MODULE_WRITE});
@@ -769,13 +759,208 @@ void RegisterMgDeleteModuleFile(ModuleRegistry *module_registry, utils::RWLock *
   module->AddProcedure("delete_module_file", std::move(delete_module_file));
 }
 
+void RegisterMgTextSearch(BuiltinModule *module) {
+  auto text_search_cb = [](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+    MG_ASSERT(Call<size_t>(mgp_list_size, args) == 4U, "Should have been type checked already");
+    const char *label_name{nullptr};
+    const char *property_name{nullptr};
+    const char *query{nullptr};
+    int64_t limit{0};
+    if (!TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 0), &label_name); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 1), &property_name); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 2), &query); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_int(Call<mgp_value *>(mgp_list_at, args, 3), &limit); }, result)) {
+      return;
+    }
+
+    if (limit < 0) {
+      static_cast<void>(mgp_result_set_error_msg(result, "The limit can't be negative."));
+      return;
+    }
+
+    auto *const *db_accessor = std::get_if<DbAccessor *>(&graph->impl);
+    if (!db_accessor) {
+      static_cast<void>(mgp_result_set_error_msg(result, "Text search isn't supported on subgraphs."));
+      return;
+    }
+    auto *dba = *db_accessor;
+    const auto label = dba->NameToLabel(label_name);
+    const auto property = dba->NameToProperty(property_name);
+    if (!dba->TextIndexExists(label, property)) {
+      const auto message = fmt::format("There is no text index on :{}({}).", label_name, property_name);
+      static_cast<void>(mgp_result_set_error_msg(result, message.c_str()));
+      return;
+    }
+
+    const auto matches = dba->TextSearch(graph->view, label, property, query, static_cast<uint64_t>(limit));
+    for (const auto &[vertex, score] : matches) {
+      mgp_result_record *record{nullptr};
+      if (!TryOrSetError([&] { return mgp_result_new_record(result, &record); }, result)) {
+        return;
+      }
+
+      MgpUniquePtr<mgp_vertex> node{nullptr, mgp_vertex_destroy};
+      if (!TryOrSetError(
+              [&] {
+                return CreateMgpObject(node, mgp_graph_get_vertex_by_id, graph, mgp_vertex_id{vertex.Gid().AsInt()},
+                                       memory);
+              },
+              result)) {
+        return;
+      }
+      MgpUniquePtr<mgp_value> node_value{nullptr, mgp_value_destroy};
+      if (!TryOrSetError([&] { return CreateMgpObject(node_value, mgp_value_make_vertex, node.get()); }, result)) {
+        return;
+      }
+      // The value took ownership of the vertex.
+      static_cast<void>(node.release());
+      MgpUniquePtr<mgp_value> score_value{nullptr, mgp_value_destroy};
+      if (!TryOrSetError([&] { return CreateMgpObject(score_value, mgp_value_make_double, score, memory); }, result)) {
+        return;
+      }
+
+      if (!InsertResultOrSetError(result, record, "node", node_value.get()) ||
+          !InsertResultOrSetError(result, record, "score", score_value.get())) {
+        return;
+      }
+    }
+  };
+  mgp_proc text_search("text_search", std::move(text_search_cb), utils::NewDeleteResource());
+  MG_ASSERT(mgp_proc_add_arg(&text_search, "label", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&text_search, "property", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&text_search, "query", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&text_search, "limit", Call<mgp_type *>(mgp_type_int)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(&text_search, "node", Call<mgp_type *>(mgp_type_node)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(&text_search, "score", Call<mgp_type *>(mgp_type_float)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  module->AddProcedure("text_search", std::move(text_search));
+}
+
+void RegisterMgVectorSearch(BuiltinModule *module) {
+  auto vector_search_cb = [](mgp_list *args, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+    MG_ASSERT(Call<size_t>(mgp_list_size, args) == 5U, "Should have been type checked already");
+    const char *label_name{nullptr};
+    const char *property_name{nullptr};
+    mgp_list *query_list{nullptr};
+    int64_t limit{0};
+    const char *metric_name{nullptr};
+    if (!TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 0), &label_name); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 1), &property_name); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_list(Call<mgp_value *>(mgp_list_at, args, 2), &query_list); },
+                       result) ||
+        !TryOrSetError([&] { return mgp_value_get_int(Call<mgp_value *>(mgp_list_at, args, 3), &limit); }, result) ||
+        !TryOrSetError([&] { return mgp_value_get_string(Call<mgp_value *>(mgp_list_at, args, 4), &metric_name); },
+                       result)) {
+      return;
+    }
+
+    if (limit < 0) {
+      static_cast<void>(mgp_result_set_error_msg(result, "The limit can't be negative."));
+      return;
+    }
+    const auto metric = storage::StringToVectorMetric(metric_name);
+    if (!metric) {
+      const auto message = fmt::format("Unknown metric '{}', expected 'l2' or 'cos'.", metric_name);
+      static_cast<void>(mgp_result_set_error_msg(result, message.c_str()));
+      return;
+    }
+
+    auto *const *db_accessor = std::get_if<DbAccessor *>(&graph->impl);
+    if (!db_accessor) {
+      static_cast<void>(mgp_result_set_error_msg(result, "Vector search isn't supported on subgraphs."));
+      return;
+    }
+    auto *dba = *db_accessor;
+    const auto label = dba->NameToLabel(label_name);
+    const auto property = dba->NameToProperty(property_name);
+    if (!dba->VectorIndexExists(label, property)) {
+      const auto message = fmt::format("There is no vector index on :{}({}).", label_name, property_name);
+      static_cast<void>(mgp_result_set_error_msg(result, message.c_str()));
+      return;
+    }
+
+    // The type of the argument is checked, so all items are numbers.
+    std::vector<float> query(Call<size_t>(mgp_list_size, query_list));
+    for (size_t i = 0; i < query.size(); ++i) {
+      auto *item = Call<mgp_value *>(mgp_list_at, query_list, i);
+      query[i] = Call<int>(mgp_value_is_int, item) ? static_cast<float>(Call<int64_t>(mgp_value_get_int, item))
+                                                    : static_cast<float>(Call<double>(mgp_value_get_double, item));
+    }
+
+    const auto neighbours =
+        dba->VectorSearch(graph->view, label, property, query, static_cast<uint64_t>(limit), *metric);
+    for (const auto &[vertex, distance] : neighbours) {
+      mgp_result_record *record{nullptr};
+      if (!TryOrSetError([&] { return mgp_result_new_record(result, &record); }, result)) {
+        return;
+      }
+
+      MgpUniquePtr<mgp_vertex> node{nullptr, mgp_vertex_destroy};
+      if (!TryOrSetError(
+              [&] {
+                return CreateMgpObject(node, mgp_graph_get_vertex_by_id, graph, mgp_vertex_id{vertex.Gid().AsInt()},
+                                       memory);
+              },
+              result)) {
+        return;
+      }
+      MgpUniquePtr<mgp_value> node_value{nullptr, mgp_value_destroy};
+      if (!TryOrSetError([&] { return CreateMgpObject(node_value, mgp_value_make_vertex, node.get()); }, result)) {
+        return;
+      }
+      // The value took ownership of the vertex.
+      static_cast<void>(node.release());
+      MgpUniquePtr<mgp_value> distance_value{nullptr, mgp_value_destroy};
+      if (!TryOrSetError([&] { return CreateMgpObject(distance_value, mgp_value_make_double, distance, memory); },
+                         result)) {
+        return;
+      }
+
+      if (!InsertResultOrSetError(result, record, "node", node_value.get()) ||
+          !InsertResultOrSetError(result, record, "distance", distance_value.get())) {
+        return;
+      }
+    }
+  };
+  mgp_proc vector_search("vector_search", std::move(vector_search_cb), utils::NewDeleteResource());
+  MG_ASSERT(mgp_proc_add_arg(&vector_search, "label", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&vector_search, "property", Call<mgp_type *>(mgp_type_string)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&vector_search, "query",
+                             Call<mgp_type *>(mgp_type_list, Call<mgp_type *>(mgp_type_number))) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_arg(&vector_search, "limit", Call<mgp_type *>(mgp_type_int)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  mgp_value default_metric("l2", utils::NewDeleteResource());
+  MG_ASSERT(mgp_proc_add_opt_arg(&vector_search, "metric", Call<mgp_type *>(mgp_type_string), &default_metric) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(&vector_search, "node", Call<mgp_type *>(mgp_type_node)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  MG_ASSERT(mgp_proc_add_result(&vector_search, "distance", Call<mgp_type *>(mgp_type_float)) ==
+            mgp_error::MGP_ERROR_NO_ERROR);
+  module->AddProcedure("vector_search", std::move(vector_search));
+}
+
 // Run `fun` with `mgp_module *` and `mgp_memory *` arguments. If `fun` returned
-// a `true` value, store the `mgp_module::procedures` and
-// `mgp_module::transformations into `proc_map`. The return value of WithModuleRegistration
+// a `true` value, store the `mgp_module::procedures`,
+// `mgp_module::transformations`, `mgp_module::functions` and
+// `mgp_module::commit_hooks` into the maps. The return value of WithModuleRegistration
 // is the same as that of `fun`. Note, the return value need only be convertible to `bool`,
 // it does not have to be `bool` itself.
-template <class TProcMap, class TTransMap, class TFuncMap, class TFun>
-auto WithModuleRegistration(TProcMap *proc_map, TTransMap *trans_map, TFuncMap *func_map, const TFun &fun) {
+template <class TProcMap, class TTransMap, class TFuncMap, class THookMap, class TFun>
+auto WithModuleRegistration(TProcMap *proc_map, TTransMap *trans_map, TFuncMap *func_map, THookMap *hook_map,
+                            const TFun &fun) {
   // We probably don't need more than 256KB for module initialization.
   static constexpr size_t stack_bytes = 256UL * 1024UL;
   unsigned char stack_memory[stack_bytes];
@@ -790,6 +975,8 @@ auto WithModuleRegistration(TProcMap *proc_map, TTransMap *trans_map, TFuncMap *
     for (const auto &trans : module_def.transformations) trans_map->emplace(trans);
     // Copy functions into resulting func_map.
     for (const auto &func : module_def.functions) func_map->emplace(func);
+    // Copy commit hooks into resulting hook_map.
+    for (const auto &hook : module_def.commit_hooks) hook_map->emplace(hook);
   }
   return res;
 }
@@ -815,6 +1002,8 @@ class SharedLibraryModule final : public Module {
 
   const std::map<std::string, mgp_func, std::less<>> *Functions() const override;
 
+  const std::map<std::string, mgp_commit_hook, std::less<>> *CommitHooks() const override;
+
   std::optional<std::filesystem::path> Path() const override { return file_path_; }
 
  private:
@@ -832,6 +1021,8 @@ class SharedLibraryModule final : public Module {
   std::map<std::string, mgp_trans, std::less<>> transformations_;
   /// Registered functions
   std::map<std::string, mgp_func, std::less<>> functions_;
+  /// Registered commit hooks
+  std::map<std::string, mgp_commit_hook, std::less<>> commit_hooks_;
 };
 
 SharedLibraryModule::SharedLibraryModule() : handle_(nullptr) {}
@@ -886,7 +1077,7 @@ bool SharedLibraryModule::Load(const std::filesystem::path &file_path) {
     }
     return true;
   };
-  if (!WithModuleRegistration(&procedures_, &transformations_, &functions_, module_cb)) {
+  if (!WithModuleRegistration(&procedures_, &transformations_, &functions_, &commit_hooks_, module_cb)) {
     return false;
   }
   // Get optional mgp_shutdown_module
@@ -915,6 +1106,8 @@ bool SharedLibraryModule::Close() {
   spdlog::info("Closed module {}", file_path_);
   handle_ = nullptr;
   procedures_.clear();
+  // The hooks call into the closed library.
+  commit_hooks_.clear();
   return true;
 }
 
@@ -939,6 +1132,13 @@ const std::map<std::string, mgp_func, std::less<>> *SharedLibraryModule::Functio
   return &functions_;
 }
 
+const std::map<std::string, mgp_commit_hook, std::less<>> *SharedLibraryModule::CommitHooks() const {
+  MG_ASSERT(handle_,
+            "Attempting to access commit hooks of a module that has not "
+            "been loaded...");
+  return &commit_hooks_;
+}
+
 class PythonModule final : public Module {
  public:
   PythonModule();
@@ -955,6 +1155,7 @@ class PythonModule final : public Module {
   const std::map<std::string, mgp_proc, std::less<>> *Procedures() const override;
   const std::map<std::string, mgp_trans, std::less<>> *Transformations() const override;
   const std::map<std::string, mgp_func, std::less<>> *Functions() const override;
+  const std::map<std::string, mgp_commit_hook, std::less<>> *CommitHooks() const override;
   std::optional<std::filesystem::path> Path() const override { return file_path_; }
 
  private:
@@ -963,6 +1164,7 @@ class PythonModule final : public Module {
   std::map<std::string, mgp_proc, std::less<>> procedures_;
   std::map<std::string, mgp_trans, std::less<>> transformations_;
   std::map<std::string, mgp_func, std::less<>> functions_;
+  std::map<std::string, mgp_commit_hook, std::less<>> commit_hooks_;
 };
 
 PythonModule::PythonModule() {}
@@ -993,7 +1195,7 @@ bool PythonModule::Load(const std::filesystem::path &file_path) {
     };
     return result;
   };
-  py_module_ = WithModuleRegistration(&procedures_, &transformations_, &functions_, module_cb);
+  py_module_ = WithModuleRegistration(&procedures_, &transformations_, &functions_, &commit_hooks_, module_cb);
   if (py_module_) {
     spdlog::info("Loaded module {}", file_path);
 
@@ -1018,6 +1220,7 @@ bool PythonModule::Close() {
   procedures_.clear();
   transformations_.clear();
   functions_.clear();
+  commit_hooks_.clear();
 
   // Get the reference to sys.modules dictionary
   py::Object sys(PyImport_ImportModule("sys"));
@@ -1133,6 +1336,13 @@ const std::map<std::string, mgp_func, std::less<>> *PythonModule::Functions() co
             "not been loaded...");
   return &functions_;
 }
+
+const std::map<std::string, mgp_commit_hook, std::less<>> *PythonModule::CommitHooks() const {
+  MG_ASSERT(py_module_,
+            "Attempting to access commit hooks of a module that has "
+            "not been loaded...");
+  return &commit_hooks_;
+}
 namespace {
 
 std::unique_ptr<Module> LoadModuleFromFile(const std::filesystem::path &path) {
@@ -1159,36 +1369,81 @@ std::unique_ptr<Module> LoadModuleFromFile(const std::filesystem::path &path) {
 bool ModuleRegistry::RegisterModule(const std::string_view name, std::unique_ptr<Module> module) {
   MG_ASSERT(!name.empty(), "Module name cannot be empty");
   MG_ASSERT(module, "Tried to register an invalid module");
-  if (modules_.find(name) != modules_.end()) {
+  std::lock_guard guard(write_mutex_);
+  return DoRegisterModule(name, std::move(module));
+}
+
+bool ModuleRegistry::DoRegisterModule(const std::string_view name, std::shared_ptr<Module> module) const {
+  const auto modules = Modules();
+  if (modules->find(name) != modules->end()) {
     spdlog::error(
         utils::MessageWithLink("Unable to overwrite an already loaded module {}.", name, "https://memgr.ph/modules"));
     return false;
   }
-  modules_.emplace(name, std::move(module));
+  auto new_modules = std::make_shared<ModuleMap>(*modules);
+  new_modules->emplace(name, std::move(module));
+  PublishModules(std::move(new_modules));
   return true;
 }
 
-void ModuleRegistry::DoUnloadAllModules() {
-  MG_ASSERT(modules_.find("mg") != modules_.end(), "Expected the builtin \"mg\" module to be present.");
-  // This is correct because the destructor will close each module. However,
-  // we don't want to unload the builtin "mg" module.
-  auto module = std::move(modules_["mg"]);
-  modules_.clear();
-  modules_.emplace("mg", std::move(module));
+void ModuleRegistry::PublishModules(std::shared_ptr<const ModuleMap> modules) const {
+  has_commit_hooks_.store(std::any_of(modules->begin(), modules->end(),
+                                      [](const auto &module) { return !module.second->CommitHooks()->empty(); }),
+                          std::memory_order_release);
+  modules_.store(std::move(modules), std::memory_order_release);
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<Module>>> ModuleRegistry::TakeModules(const bool reload) {
+  const auto modules = Modules();
+  MG_ASSERT(modules->find("mg") != modules->end(), "Expected the builtin \"mg\" module to be present.");
+  // We don't want to unload the builtin "mg" module.
+  auto new_modules = std::make_shared<ModuleMap>();
+  std::vector<std::pair<std::string, std::shared_ptr<Module>>> taken;
+  for (const auto &[name, module] : *modules) {
+    if (name == "mg") {
+      new_modules->emplace(name, module);
+      continue;
+    }
+    if (reload) reloading_modules_.insert(name);
+    taken.emplace_back(name, module);
+  }
+  PublishModules(std::move(new_modules));
+  return taken;
+}
+
+void ModuleRegistry::CloseWhenUnused(std::vector<std::pair<std::string, std::shared_ptr<Module>>> modules) {
+  static constexpr auto kUnusedCheckInterval = std::chrono::milliseconds(1);
+  for (auto &[name, module] : modules) {
+    // The module can't be found anymore, but the callers which found it before
+    // and the older snapshots of the modules may still use it. It has to be
+    // closed before it's loaded again, as a Python module is shared through
+    // sys.modules.
+    while (module.use_count() > 1) {
+      std::this_thread::sleep_for(kUnusedCheckInterval);
+    }
+    if (!module->Close()) {
+      spdlog::warn("Failed to close module {}", name);
+    }
+    module.reset();
+  }
 }
 
 ModuleRegistry::ModuleRegistry() {
-  auto module = std::make_unique<BuiltinModule>();
-  RegisterMgProcedures(&modules_, module.get());
-  RegisterMgTransformations(&modules_, module.get());
-  RegisterMgFunctions(&modules_, module.get());
-  RegisterMgLoad(this, &lock_, module.get());
+  auto module = std::make_shared<BuiltinModule>();
+  RegisterMgProcedures(this, module.get());
+  RegisterMgTransformations(this, module.get());
+  RegisterMgFunctions(this, module.get());
+  RegisterMgLoad(this, module.get());
   RegisterMgGetModuleFiles(this, module.get());
   RegisterMgGetModuleFile(this, module.get());
-  RegisterMgCreateModuleFile(this, &lock_, module.get());
-  RegisterMgUpdateModuleFile(this, &lock_, module.get());
-  RegisterMgDeleteModuleFile(this, &lock_, module.get());
-  modules_.emplace("mg", std::move(module));
+  RegisterMgCreateModuleFile(this, module.get());
+  RegisterMgUpdateModuleFile(this, module.get());
+  RegisterMgDeleteModuleFile(this, module.get());
+  RegisterMgTextSearch(module.get());
+  RegisterMgVectorSearch(module.get());
+  auto modules = std::make_shared<ModuleMap>();
+  modules->emplace("mg", std::move(module));
+  modules_.store(std::move(modules));
 }
 
 void ModuleRegistry::SetModulesDirectory(std::vector<std::filesystem::path> modules_dirs,
@@ -1210,9 +1465,9 @@ bool ModuleRegistry::LoadModuleIfFound(const std::filesystem::path &modules_dir,
   for (const auto &entry : std::filesystem::directory_iterator(modules_dir)) {
     const auto &path = entry.path();
     if (entry.is_regular_file() && path.stem() == name) {
-      auto module = LoadModuleFromFile(path);
+      std::shared_ptr<Module> module = LoadModuleFromFile(path);
       if (!module) return false;
-      return RegisterModule(name, std::move(module));
+      return DoRegisterModule(name, std::move(module));
     }
   }
   return false;
@@ -1221,24 +1476,38 @@ bool ModuleRegistry::LoadModuleIfFound(const std::filesystem::path &modules_dir,
 bool ModuleRegistry::LoadOrReloadModuleFromName(const std::string_view name) {
   if (modules_dirs_.empty()) return false;
   if (name.empty()) return false;
-  std::unique_lock<utils::RWLock> guard(lock_);
-  auto found_it = modules_.find(name);
-  if (found_it != modules_.end()) {
-    if (!found_it->second->Close()) {
-      spdlog::warn("Failed to close module {}", found_it->first);
+  std::vector<std::pair<std::string, std::shared_ptr<Module>>> unloaded;
+  {
+    std::unique_lock guard(write_mutex_);
+    reloaded_.wait(guard, [&] { return !reloading_modules_.contains(name); });
+    reloading_modules_.emplace(name);
+    pending_modules_.erase(std::string(name));
+    const auto modules = Modules();
+    if (auto found_it = modules->find(name); found_it != modules->end()) {
+      unloaded.emplace_back(found_it->first, found_it->second);
+      auto new_modules = std::make_shared<ModuleMap>(*modules);
+      new_modules->erase(found_it->first);
+      PublishModules(std::move(new_modules));
     }
-    modules_.erase(found_it);
   }
-
-  for (const auto &module_dir : modules_dirs_) {
-    if (LoadModuleIfFound(module_dir, name)) {
-      return true;
+  CloseWhenUnused(std::move(unloaded));
+
+  bool loaded = false;
+  {
+    std::lock_guard guard(write_mutex_);
+    for (const auto &module_dir : modules_dirs_) {
+      if (LoadModuleIfFound(module_dir, name)) {
+        loaded = true;
+        break;
+      }
     }
+    reloading_modules_.erase(std::string(name));
   }
-  return false;
+  reloaded_.notify_all();
+  return loaded;
 }
 
-void ModuleRegistry::LoadModulesFromDirectory(const std::filesystem::path &modules_dir) {
+void ModuleRegistry::FindModulesInDirectory(const std::filesystem::path &modules_dir) {
   if (modules_dir.empty()) return;
   if (!utils::DirExists(modules_dir)) {
     spdlog::error(
@@ -1250,43 +1519,136 @@ void ModuleRegistry::LoadModulesFromDirectory(const std::filesystem::path &modul
     if (entry.is_regular_file()) {
       std::string name = path.stem();
       if (name.empty()) continue;
-      auto module = LoadModuleFromFile(path);
-      if (!module) continue;
-      RegisterModule(name, std::move(module));
+      pending_modules_[std::move(name)].push_back(path);
     }
   }
 }
 
+ModulePtr ModuleRegistry::LoadPendingModule(const std::string_view name) const {
+  std::vector<std::filesystem::path> paths;
+  if (auto pending_it = pending_modules_.find(name); pending_it != pending_modules_.end()) {
+    paths = std::move(pending_it->second);
+    pending_modules_.erase(pending_it);
+  }
+  const auto modules = Modules();
+  if (auto found_it = modules->find(name); found_it != modules->end()) {
+    if (!paths.empty()) {
+      spdlog::error(utils::MessageWithLink("Unable to overwrite an already loaded module {}.", name,
+                                           "https://memgr.ph/modules"));
+    }
+    return ModulePtr(found_it->second);
+  }
+  // Same as when loading all of the modules, the first file which loads
+  // successfully provides the module.
+  for (const auto &path : paths) {
+    std::shared_ptr<Module> module = LoadModuleFromFile(path);
+    if (!module) continue;
+    DoRegisterModule(name, module);
+    return ModulePtr(std::move(module));
+  }
+  return ModulePtr{nullptr};
+}
+
+void ModuleRegistry::LoadPendingModules() const {
+  // Each module is loaded under its own lock, so the lookups of the modules
+  // which are already loaded don't wait for all of them.
+  while (true) {
+    std::lock_guard guard(write_mutex_);
+    auto pending_it = std::find_if(pending_modules_.begin(), pending_modules_.end(),
+                                   [this](const auto &pending) { return !reloading_modules_.contains(pending.first); });
+    if (pending_it == pending_modules_.end()) return;
+    const auto name = pending_it->first;
+    LoadPendingModule(name);
+  }
+}
+
 void ModuleRegistry::UnloadAndLoadModulesFromDirectories() {
-  std::unique_lock<utils::RWLock> guard(lock_);
-  DoUnloadAllModules();
-  for (const auto &module_dir : modules_dirs_) {
-    LoadModulesFromDirectory(module_dir);
+  std::vector<std::pair<std::string, std::shared_ptr<Module>>> unloaded;
+  {
+    std::lock_guard guard(write_mutex_);
+    unloaded = TakeModules(/*reload=*/true);
+    pending_modules_.clear();
+  }
+  std::vector<std::string> names;
+  names.reserve(unloaded.size());
+  for (const auto &[name, module] : unloaded) {
+    names.push_back(name);
   }
+  CloseWhenUnused(std::move(unloaded));
+
+  {
+    std::lock_guard guard(write_mutex_);
+    for (const auto &module_dir : modules_dirs_) {
+      FindModulesInDirectory(module_dir);
+    }
+    for (const auto &name : names) {
+      reloading_modules_.erase(name);
+    }
+  }
+  reloaded_.notify_all();
+  if (!lazy_loading_) LoadPendingModules();
 }
 
 ModulePtr ModuleRegistry::GetModuleNamed(const std::string_view name) const {
-  std::shared_lock<utils::RWLock> guard(lock_);
-  auto found_it = modules_.find(name);
-  if (found_it == modules_.end()) return ModulePtr{nullptr};
-  return ModulePtr(found_it->second.get(), std::move(guard));
+  {
+    const auto modules = Modules();
+    if (auto found_it = modules->find(name); found_it != modules->end()) return ModulePtr(found_it->second);
+  }
+  std::unique_lock guard(write_mutex_);
+  reloaded_.wait(guard, [&] { return !reloading_modules_.contains(name); });
+  return LoadPendingModule(name);
 }
 
 void ModuleRegistry::UnloadAllModules() {
-  std::unique_lock<utils::RWLock> guard(lock_);
-  DoUnloadAllModules();
+  std::vector<std::pair<std::string, std::shared_ptr<Module>>> unloaded;
+  {
+    std::lock_guard guard(write_mutex_);
+    unloaded = TakeModules(/*reload=*/false);
+    pending_modules_.clear();
+  }
+  CloseWhenUnused(std::move(unloaded));
 }
 
 utils::MemoryResource &ModuleRegistry::GetSharedMemoryResource() noexcept { return *shared_; }
 
 bool ModuleRegistry::RegisterMgProcedure(const std::string_view name, mgp_proc proc) {
-  std::unique_lock<utils::RWLock> guard(lock_);
-  if (auto module = modules_.find("mg"); module != modules_.end()) {
-    auto *builtin_module = dynamic_cast<BuiltinModule *>(module->second.get());
-    builtin_module->AddProcedure(name, std::move(proc));
-    return true;
+  std::lock_guard guard(write_mutex_);
+  const auto modules = Modules();
+  auto found_it = modules->find("mg");
+  if (found_it == modules->end()) return false;
+  // The published module may be in use, so it's replaced by a copy with the
+  // procedure added.
+  const auto &builtin_module = dynamic_cast<const BuiltinModule &>(*found_it->second);
+  auto new_builtin_module = std::make_shared<BuiltinModule>();
+  for (const auto &[proc_name, builtin_proc] : *builtin_module.Procedures()) {
+    new_builtin_module->AddProcedure(proc_name, builtin_proc);
+  }
+  for (const auto &[trans_name, builtin_trans] : *builtin_module.Transformations()) {
+    new_builtin_module->AddTransformation(trans_name, builtin_trans);
+  }
+  new_builtin_module->AddProcedure(name, std::move(proc));
+  auto new_modules = std::make_shared<ModuleMap>(*modules);
+  new_modules->insert_or_assign("mg", std::move(new_builtin_module));
+  PublishModules(std::move(new_modules));
+  return true;
+}
+
+void ModuleRegistry::RunCommitHooks(const storage::CommitChanges &changes, const DbAccessor &dba) const {
+  static constexpr size_t kMemoryBlockSize = 8UL * 1024UL;
+  const auto modules = Modules();
+  utils::MonotonicBufferResource memory{kMemoryBlockSize};
+  mgp_commit_changes mgp_changes(changes, dba, &memory);
+  for (const auto &[module_name, module] : *modules) {
+    for (const auto &[hook_name, hook] : *module->CommitHooks()) {
+      utils::MonotonicBufferResource hook_memory{kMemoryBlockSize};
+      mgp_memory memory_wrapper{&hook_memory};
+      try {
+        hook.cb(&mgp_changes, &memory_wrapper);
+      } catch (const std::exception &e) {
+        spdlog::warn("Commit hook {}.{} failed: {}", module_name, hook_name, e.what());
+      }
+    }
   }
-  return false;
 }
 
 const std::filesystem::path &ModuleRegistry::InternalModuleDir() const noexcept { return internal_module_dir_; }
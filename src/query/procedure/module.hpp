@@ -14,10 +14,17 @@
 #pragma once
 
 #include <dlfcn.h>
+#include <atomic>
+#include <condition_variable>
 #include <filesystem>
 #include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <set>
 #include <shared_mutex>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -49,43 +56,86 @@ class Module {
   virtual const std::map<std::string, mgp_trans, std::less<>> *Transformations() const = 0;
   // /// Returns registered functions of this module
   virtual const std::map<std::string, mgp_func, std::less<>> *Functions() const = 0;
+  /// Returns registered commit hooks of this module
+  virtual const std::map<std::string, mgp_commit_hook, std::less<>> *CommitHooks() const = 0;
 
   virtual std::optional<std::filesystem::path> Path() const = 0;
 };
 
 /// Proxy for a registered Module, acquires a read lock from ModuleRegistry.
+/// Module which isn't closed while it's pointed to.
 class ModulePtr final {
-  const Module *module_{nullptr};
-  std::shared_lock<utils::RWLock> lock_;
+  std::shared_ptr<const Module> module_;
 
  public:
   ModulePtr() = default;
   explicit ModulePtr(std::nullptr_t) {}
-  ModulePtr(const Module *module, std::shared_lock<utils::RWLock> lock) : module_(module), lock_(std::move(lock)) {}
+  explicit ModulePtr(std::shared_ptr<const Module> module) : module_(std::move(module)) {}
 
   explicit operator bool() const { return static_cast<bool>(module_); }
 
   const Module &operator*() const { return *module_; }
-  const Module *operator->() const { return module_; }
+  const Module *operator->() const { return module_.get(); }
 };
 
-/// Thread-safe registration of modules from libraries, uses utils::RWLock.
+/// Thread-safe registration of modules from libraries. The loaded modules are
+/// kept in an immutable map which is copied and replaced on each change, so
+/// finding a module never waits for other modules to be (re)loaded. A module
+/// is closed only once it isn't used anymore.
 class ModuleRegistry final {
   friend CypherMainVisitorTest;
 
-  std::map<std::string, std::unique_ptr<Module>, std::less<>> modules_;
-  mutable utils::RWLock lock_{utils::RWLock::Priority::WRITE};
+ public:
+  using ModuleMap = std::map<std::string, std::shared_ptr<Module>, std::less<>>;
+
+ private:
+  // Mutable, as the lookups load the modules which are loaded on first use.
+  mutable std::atomic<std::shared_ptr<const ModuleMap>> modules_;
+  // Files of the modules which are loaded when they are first used, in the
+  // order of the modules directories.
+  mutable std::map<std::string, std::vector<std::filesystem::path>, std::less<>> pending_modules_;
+  // Modules which are being unloaded to be loaded again. Finding them waits
+  // until they are loaded.
+  mutable std::set<std::string, std::less<>> reloading_modules_;
+  // Serializes the changes of the modules and protects the pending and
+  // reloading ones.
+  mutable std::mutex write_mutex_;
+  mutable std::condition_variable reloaded_;
+  bool lazy_loading_{false};
   std::unique_ptr<utils::MemoryResource> shared_{std::make_unique<utils::ResourceWithOutOfMemoryException>()};
+  // Set if any of the modules_ registered a commit hook, so the commits don't
+  // collect their changes for nothing.
+  mutable std::atomic<bool> has_commit_hooks_{false};
 
   bool RegisterModule(std::string_view name, std::unique_ptr<Module> module);
 
-  void DoUnloadAllModules();
+  /// Must be called while holding write_mutex_.
+  bool DoRegisterModule(std::string_view name, std::shared_ptr<Module> module) const;
+
+  /// Replaces the modules with `modules`. Must be called while holding
+  /// write_mutex_.
+  void PublishModules(std::shared_ptr<const ModuleMap> modules) const;
+
+  /// Removes all modules except the builtin "mg" module and returns them.
+  /// Finding them waits until they are loaded again if `reload` is true. Must
+  /// be called while holding write_mutex_.
+  std::vector<std::pair<std::string, std::shared_ptr<Module>>> TakeModules(bool reload);
 
-  /// Loads the module if it's in the modules_dir directory
+  /// Closes the taken `modules` once nothing else uses them.
+  static void CloseWhenUnused(std::vector<std::pair<std::string, std::shared_ptr<Module>>> modules);
+
+  /// Loads the pending module with the given name, if there is one. Must be
+  /// called while holding write_mutex_.
+  ModulePtr LoadPendingModule(std::string_view name) const;
+
+  /// Loads the module if it's in the modules_dir directory. Must be called
+  /// while holding write_mutex_.
   /// @return Whether the module was loaded
   bool LoadModuleIfFound(const std::filesystem::path &modules_dir, std::string_view name);
 
-  void LoadModulesFromDirectory(const std::filesystem::path &modules_dir);
+  /// Adds the modules in the modules_dir directory to the pending ones. Must be
+  /// called while holding write_mutex_.
+  void FindModulesInDirectory(const std::filesystem::path &modules_dir);
 
  public:
   ModuleRegistry();
@@ -94,10 +144,21 @@ class ModuleRegistry final {
   void SetModulesDirectory(std::vector<std::filesystem::path> modules_dir, const std::filesystem::path &data_directory);
   const std::vector<std::filesystem::path> &GetModulesDirectory() const;
 
+  /// Set whether the modules from the directories are loaded when they are
+  /// first used, instead of when the directories are (re)loaded.
+  void SetLazyLoading(bool lazy_loading) { lazy_loading_ = lazy_loading; }
+
+  /// Returns the loaded modules, sorted by name.
+  std::shared_ptr<const ModuleMap> Modules() const { return modules_.load(std::memory_order_acquire); }
+
+  /// Loads the modules which would be loaded when they are first used.
+  void LoadPendingModules() const;
+
   /// Atomically load or reload a module with a particular name from the given
   /// directory.
   ///
-  /// Takes a write lock. If the module exists it is reloaded. Otherwise, the
+  /// If the module exists it is reloaded once it's no longer used, and finding
+  /// it waits until then. Otherwise, the
   /// module is loaded from the file whose filename, without the extension,
   /// matches the module's name. If multiple such files exist, only one is
   /// chosen, in an unspecified manner. If loading of the chosen file fails, no
@@ -108,17 +169,17 @@ class ModuleRegistry final {
   bool LoadOrReloadModuleFromName(std::string_view name);
 
   /// Atomically unload all modules and then load all possible modules from the
-  /// set directories.
+  /// set directories, or only find them if the modules are loaded lazily.
   ///
-  /// Takes a write lock.
+  /// Finding the modules waits until they are loaded again, while their
+  /// unloading waits until they are no longer used.
   void UnloadAndLoadModulesFromDirectories();
 
-  /// Find a module with given name or return nullptr.
-  /// Takes a read lock.
+  /// Find a module with given name, loading it if it's pending, or return
+  /// nullptr.
   ModulePtr GetModuleNamed(std::string_view name) const;
 
-  /// Remove all loaded (non-builtin) modules.
-  /// Takes a write lock.
+  /// Remove all loaded (non-builtin) modules once they are no longer used.
   void UnloadAllModules();
 
   /// Returns the shared memory allocator used by modules
@@ -126,6 +187,13 @@ class ModuleRegistry final {
 
   bool RegisterMgProcedure(std::string_view name, mgp_proc proc);
 
+  bool HasCommitHooks() const { return has_commit_hooks_.load(std::memory_order_acquire); }
+
+  /// Calls the commit hooks of all modules with the changes of a committed
+  /// transaction. The names in the changes are taken from `dba`. Errors of the
+  /// hooks are logged, as the transaction can't be aborted anymore.
+  void RunCommitHooks(const storage::CommitChanges &changes, const DbAccessor &dba) const;
+
   const std::filesystem::path &InternalModuleDir() const noexcept;
 
  private:
@@ -206,9 +274,11 @@ std::optional<std::pair<procedure::ModulePtr, const mgp_func *>> FindFunction(
 template <typename T>
 concept IsCallable = utils::SameAsAnyOf<T, mgp_proc, mgp_func>;
 
+/// Throws QueryRuntimeException if the number or the types of `args` don't
+/// match the arguments of `callable`.
 template <IsCallable TCall>
-void ConstructArguments(const std::vector<TypedValue> &args, const TCall &callable,
-                        const std::string_view fully_qualified_name, mgp_list &args_list, mgp_graph &graph) {
+void ValidateArguments(std::span<const TypedValue> args, const TCall &callable,
+                       const std::string_view fully_qualified_name) {
   const auto n_args = args.size();
   const auto c_args_sz = callable.args.size();
   const auto c_opt_args_sz = callable.opt_args.size();
@@ -226,11 +296,9 @@ void ConstructArguments(const std::vector<TypedValue> &args, const TCall &callab
     throw QueryRuntimeException("'{}' requires between {} and {} arguments.", fully_qualified_name, c_args_sz,
                                 c_args_sz + c_opt_args_sz);
   }
-  args_list.elems.reserve(n_args);
-
   auto is_not_optional_arg = [c_args_sz](int i) { return c_args_sz > i; };
   for (size_t i = 0; i < n_args; ++i) {
-    auto arg = args[i];
+    const auto &arg = args[i];
     std::string_view name;
     const query::procedure::CypherType *type = nullptr;
     if (is_not_optional_arg(i)) {
@@ -244,10 +312,20 @@ void ConstructArguments(const std::vector<TypedValue> &args, const TCall &callab
       throw QueryRuntimeException("'{}' argument named '{}' at position {} must be of type {}.", fully_qualified_name,
                                   name, i, type->GetPresentableName());
     }
-    args_list.elems.emplace_back(std::move(arg), &graph);
+  }
+}
+
+template <IsCallable TCall>
+void ConstructArguments(std::span<const TypedValue> args, const TCall &callable,
+                        const std::string_view fully_qualified_name, mgp_list &args_list, mgp_graph &graph) {
+  ValidateArguments(args, callable, fully_qualified_name);
+  const auto c_opt_args_sz = callable.opt_args.size();
+  args_list.elems.reserve(callable.args.size() + c_opt_args_sz);
+  for (const auto &arg : args) {
+    args_list.elems.emplace_back(arg, &graph);
   }
   // Fill missing optional arguments with their default values.
-  const size_t passed_in_opt_args = n_args - c_args_sz;
+  const size_t passed_in_opt_args = args.size() - callable.args.size();
   for (size_t i = passed_in_opt_args; i < c_opt_args_sz; ++i) {
     args_list.elems.emplace_back(std::get<2>(callable.opt_args[i]), &graph);
   }
@@ -384,6 +384,125 @@ PyObject *PyGraphIterVertices(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   return reinterpret_cast<PyObject *>(py_vertices_it);
 }
 
+// Vertex property column exported through the buffer protocol, so modules
+// read the values without creating a Python object for each of them.
+//
+// The column is allocated outside of the query memory and doesn't reference
+// the graph, so it stays valid after the procedure returns.
+//
+// clang-format off
+struct PyPropertyColumn {
+  PyObject_HEAD
+  mgp_property_column *column;
+  // Column object which owns `column`, or nullptr if this object owns it.
+  PyObject *owner;
+  // Whether the buffer holds the IDs of the vertices instead of the values.
+  bool vertex_ids;
+  Py_ssize_t size;
+};
+// clang-format on
+
+void PyPropertyColumnDealloc(PyPropertyColumn *self) {
+  MG_ASSERT(self->column);
+  if (self->owner) {
+    Py_DECREF(self->owner);
+  } else {
+    mgp_property_column_destroy(self->column);
+  }
+  Py_TYPE(self)->tp_free(self);
+}
+
+int PyPropertyColumnGetBuffer(PyPropertyColumn *self, Py_buffer *view, int flags) {
+  if (flags & PyBUF_WRITABLE) {
+    PyErr_SetString(PyExc_BufferError, "_mgp.PropertyColumn is read-only.");
+    view->obj = nullptr;
+    return -1;
+  }
+  const void *data{nullptr};
+  if (self->vertex_ids) {
+    static_assert(sizeof(long long) == sizeof(int64_t));
+    data = Call<const int64_t *>(mgp_property_column_vertex_ids, self->column);
+  } else {
+    data = Call<const double *>(mgp_property_column_values, self->column);
+  }
+  Py_INCREF(self);
+  view->obj = reinterpret_cast<PyObject *>(self);
+  view->buf = const_cast<void *>(data);
+  view->itemsize = self->vertex_ids ? sizeof(int64_t) : sizeof(double);
+  view->len = self->size * view->itemsize;
+  view->readonly = 1;
+  view->format = (flags & PyBUF_FORMAT) ? const_cast<char *>(self->vertex_ids ? "q" : "d") : nullptr;
+  view->ndim = 1;
+  view->shape = (flags & PyBUF_ND) ? &self->size : nullptr;
+  view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &view->itemsize : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+PyObject *MakePyPropertyColumn(mgp_property_column *column, PyObject *owner, bool vertex_ids);
+
+PyObject *PyPropertyColumnVertexIds(PyPropertyColumn *self, PyObject *Py_UNUSED(ignored)) {
+  return MakePyPropertyColumn(self->column, reinterpret_cast<PyObject *>(self), true);
+}
+
+static PyMethodDef PyPropertyColumnMethods[] = {
+    {"__reduce__", reinterpret_cast<PyCFunction>(DisallowPickleAndCopy), METH_NOARGS, "__reduce__ is not supported"},
+    {"vertex_ids", reinterpret_cast<PyCFunction>(PyPropertyColumnVertexIds), METH_NOARGS,
+     "Return _mgp.PropertyColumn holding the IDs of the vertices in the order of the values."},
+    {nullptr, {}, {}, {}},
+};
+
+static PyBufferProcs PyPropertyColumnBufferProcs = {
+    .bf_getbuffer = reinterpret_cast<getbufferproc>(PyPropertyColumnGetBuffer),
+    .bf_releasebuffer = nullptr,
+};
+
+// clang-format off
+static PyTypeObject PyPropertyColumnType = {
+    PyVarObject_HEAD_INIT(nullptr, 0)
+    .tp_name = "_mgp.PropertyColumn",
+    .tp_basicsize = sizeof(PyPropertyColumn),
+    .tp_dealloc = reinterpret_cast<destructor>(PyPropertyColumnDealloc),
+    .tp_as_buffer = &PyPropertyColumnBufferProcs,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Wraps struct mgp_property_column.",
+    .tp_methods = PyPropertyColumnMethods,
+};
+// clang-format on
+
+PyObject *MakePyPropertyColumn(mgp_property_column *column, PyObject *owner, bool vertex_ids) {
+  auto *py_column = PyObject_New(PyPropertyColumn, &PyPropertyColumnType);
+  if (!py_column) return nullptr;
+  py_column->column = column;
+  Py_XINCREF(owner);
+  py_column->owner = owner;
+  py_column->vertex_ids = vertex_ids;
+  py_column->size = static_cast<Py_ssize_t>(Call<size_t>(mgp_property_column_size, column));
+  return reinterpret_cast<PyObject *>(py_column);
+}
+
+PyObject *PyGraphPropertyColumn(PyGraph *self, PyObject *args) {
+  MG_ASSERT(PyGraphIsValidImpl(*self));
+  const char *property_name{nullptr};
+  const char *label_name{nullptr};
+  double default_value{0.0};
+  if (!PyArg_ParseTuple(args, "szd", &property_name, &label_name, &default_value)) return nullptr;
+  // The column outlives the query memory, which is freed once the procedure
+  // returns.
+  mgp_memory memory{memgraph::utils::NewDeleteResource()};
+  mgp_property_column *column{nullptr};
+  mgp_error error{mgp_error::MGP_ERROR_NO_ERROR};
+  // Other Python procedures may run while the vertices are copied.
+  Py_BEGIN_ALLOW_THREADS;
+  error = mgp_graph_property_column(self->graph, label_name, property_name, default_value, &memory, &column);
+  Py_END_ALLOW_THREADS;
+  if (RaiseExceptionFromErrorCode(error)) return nullptr;
+  auto *py_column = MakePyPropertyColumn(column, nullptr, false);
+  if (!py_column) mgp_property_column_destroy(column);
+  return py_column;
+}
+
 PyObject *PyGraphMustAbort(PyGraph *self, PyObject *Py_UNUSED(ignored)) {
   MG_ASSERT(PyGraphIsValidImpl(*self));
   return PyBool_FromLong(mgp_must_abort(self->graph));
@@ -406,6 +525,8 @@ static PyMethodDef PyGraphMethods[] = {
      "Delete a vertex and all of its edges."},
     {"delete_edge", reinterpret_cast<PyCFunction>(PyGraphDeleteEdge), METH_VARARGS, "Delete an edge."},
     {"iter_vertices", reinterpret_cast<PyCFunction>(PyGraphIterVertices), METH_NOARGS, "Return _mgp.VerticesIterator."},
+    {"property_column", reinterpret_cast<PyCFunction>(PyGraphPropertyColumn), METH_VARARGS,
+     "Return _mgp.PropertyColumn with the values of a vertex property."},
     {"must_abort", reinterpret_cast<PyCFunction>(PyGraphMustAbort), METH_NOARGS,
      "Check whether the running procedure should abort"},
     {nullptr, {}, {}, {}},
@@ -967,8 +1088,15 @@ std::optional<py::ExceptionInfo> AddMultipleBatchRecordsFromPython(mgp_result *r
 }
 
 std::function<void()> PyObjectCleanup(py::Object &py_object, bool start_gc) {
-  return [py_object, start_gc]() {
-    if (start_gc) {
+  // The object is captured by reference, so the caller holds its only
+  // reference unless some `_mgp` instance is still alive.
+  return [&py_object, start_gc]() {
+    // Every `_mgp` instance references the graph (or the messages) it was
+    // created from. If the procedure released all of them, there is nothing
+    // for the full collection to free, and it is skipped since it runs over
+    // all objects of the interpreter while holding the GIL, blocking the
+    // Python procedures of the other queries.
+    if (start_gc && Py_REFCNT(py_object.Ptr()) > 1) {
       // Run `gc.collect` (reference cycle-detection) explicitly, so that we are
       // sure the procedure cleaned up everything it held references to. If the
       // user stored a reference to one of our `_mgp` instances then the
@@ -2432,6 +2560,7 @@ PyObject *PyInitMgpModule() {
   if (!register_type(&PyVerticesIteratorType, "VerticesIterator")) return nullptr;
   if (!register_type(&PyEdgesIteratorType, "EdgesIterator")) return nullptr;
   if (!register_type(&PyGraphType, "Graph")) return nullptr;
+  if (!register_type(&PyPropertyColumnType, "PropertyColumn")) return nullptr;
   if (!register_type(&PyEdgeType, "Edge")) return nullptr;
   if (!register_type(&PyQueryProcType, "Proc")) return nullptr;
   if (!register_type(&PyMagicFuncType, "Func")) return nullptr;
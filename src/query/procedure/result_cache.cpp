@@ -0,0 +1,269 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/procedure/result_cache.hpp"
+
+#include <algorithm>
+
+#include "query/procedure/mg_procedure_impl.hpp"
+
+namespace memgraph::query::procedure {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+ResultCache gResultCache;
+
+namespace {
+
+// Approximate memory used by each cached value and record apart from their
+// contents.
+constexpr size_t kValueOverheadBytes = 32;
+
+bool HasGraphElements(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Vertex:
+    case TypedValue::Type::Edge:
+    case TypedValue::Type::Path:
+    case TypedValue::Type::Graph:
+      return true;
+    case TypedValue::Type::List:
+      return std::any_of(value.ValueList().begin(), value.ValueList().end(),
+                         [](const auto &element) { return HasGraphElements(element); });
+    case TypedValue::Type::Map:
+      return std::any_of(value.ValueMap().begin(), value.ValueMap().end(),
+                         [](const auto &entry) { return HasGraphElements(entry.second); });
+    default:
+      return false;
+  }
+}
+
+size_t ApproximateValueSize(const TypedValue &value) {
+  size_t size = kValueOverheadBytes;
+  switch (value.type()) {
+    case TypedValue::Type::String:
+      size += value.ValueString().size();
+      break;
+    case TypedValue::Type::List:
+      for (const auto &element : value.ValueList()) size += ApproximateValueSize(element);
+      break;
+    case TypedValue::Type::Map:
+      for (const auto &[key, element] : value.ValueMap()) size += key.size() + ApproximateValueSize(element);
+      break;
+    default:
+      break;
+  }
+  return size;
+}
+
+}  // namespace
+
+bool ResultCache::Key::operator==(const Key &other) const {
+  if (database != other.database || procedure != other.procedure || snapshot != other.snapshot ||
+      arguments.size() != other.arguments.size()) {
+    return false;
+  }
+  // Integers and doubles are equal in Cypher, but the procedure may yield
+  // different records for them.
+  return std::equal(arguments.begin(), arguments.end(), other.arguments.begin(),
+                    [](const TypedValue &first, const TypedValue &second) {
+                      return first.type() == second.type() && TypedValue::BoolEqual{}(first, second);
+                    });
+}
+
+size_t ResultCache::KeyHash::operator()(const Key &key) const {
+  static constexpr size_t kPrime = 1099511628211UL;
+  size_t hash = std::hash<std::string>{}(key.database);
+  hash = hash * kPrime ^ std::hash<std::string>{}(key.procedure);
+  hash = hash * kPrime ^ std::hash<uint64_t>{}(key.snapshot.last_commit_timestamp);
+  hash = hash * kPrime ^ std::hash<uint64_t>{}(key.snapshot.storage_mode_changes);
+  for (const auto &argument : key.arguments) {
+    hash = hash * kPrime ^ TypedValue::Hash{}(argument);
+  }
+  return hash;
+}
+
+std::optional<ResultCache::Key> ResultCache::MakeKey(std::string_view database, std::string_view procedure,
+                                                     const storage::SnapshotId &snapshot,
+                                                     const std::vector<TypedValue> &arguments) {
+  Key key{.database = std::string(database), .procedure = std::string(procedure), .snapshot = snapshot};
+  key.arguments.reserve(arguments.size());
+  for (const auto &argument : arguments) {
+    if (HasGraphElements(argument)) return std::nullopt;
+    key.arguments.emplace_back(argument, utils::NewDeleteResource());
+  }
+  return key;
+}
+
+void ResultCache::SetCapacity(size_t capacity_bytes) {
+  std::lock_guard guard(lock_);
+  capacity_.store(capacity_bytes, std::memory_order_relaxed);
+  EvictOverCapacity();
+}
+
+std::optional<ResultCache::CachedValue> ResultCache::ToCachedValue(const TypedValue &value) {
+  if (!HasGraphElements(value)) return CachedValue{TypedValue(value, utils::NewDeleteResource())};
+  switch (value.type()) {
+    case TypedValue::Type::Vertex:
+      return CachedValue{value.ValueVertex().Gid()};
+    case TypedValue::Type::List: {
+      CachedValue::List list;
+      list.reserve(value.ValueList().size());
+      for (const auto &element : value.ValueList()) {
+        auto cached = ToCachedValue(element);
+        if (!cached) return std::nullopt;
+        list.push_back(std::move(*cached));
+      }
+      return CachedValue{std::move(list)};
+    }
+    case TypedValue::Type::Map: {
+      CachedValue::Map map;
+      map.reserve(value.ValueMap().size());
+      for (const auto &[key, element] : value.ValueMap()) {
+        auto cached = ToCachedValue(element);
+        if (!cached) return std::nullopt;
+        map.emplace_back(std::string(key), std::move(*cached));
+      }
+      return CachedValue{std::move(map)};
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+std::optional<TypedValue> ResultCache::ToTypedValue(const CachedValue &value, DbAccessor *dba, storage::View view,
+                                                    utils::MemoryResource *memory) {
+  if (const auto *typed_value = std::get_if<TypedValue>(&value.value)) return TypedValue(*typed_value, memory);
+  if (const auto *gid = std::get_if<storage::Gid>(&value.value)) {
+    auto vertex = dba->FindVertex(*gid, view);
+    if (!vertex) return std::nullopt;
+    return TypedValue(*vertex, memory);
+  }
+  if (const auto *list = std::get_if<CachedValue::List>(&value.value)) {
+    TypedValue::TVector elements(memory);
+    elements.reserve(list->size());
+    for (const auto &element : *list) {
+      auto typed_element = ToTypedValue(element, dba, view, memory);
+      if (!typed_element) return std::nullopt;
+      elements.push_back(std::move(*typed_element));
+    }
+    return TypedValue(std::move(elements), memory);
+  }
+  TypedValue::TMap entries(memory);
+  for (const auto &[key, element] : std::get<CachedValue::Map>(value.value)) {
+    auto typed_element = ToTypedValue(element, dba, view, memory);
+    if (!typed_element) return std::nullopt;
+    entries.emplace(TypedValue::TString(key, memory), std::move(*typed_element));
+  }
+  return TypedValue(std::move(entries), memory);
+}
+
+size_t ResultCache::ApproximateSize(const CachedValue &value) {
+  if (const auto *typed_value = std::get_if<TypedValue>(&value.value)) return ApproximateValueSize(*typed_value);
+  size_t size = kValueOverheadBytes;
+  if (const auto *list = std::get_if<CachedValue::List>(&value.value)) {
+    for (const auto &element : *list) size += ApproximateSize(element);
+  } else if (const auto *map = std::get_if<CachedValue::Map>(&value.value)) {
+    for (const auto &[key, element] : *map) size += key.size() + ApproximateSize(element);
+  }
+  return size;
+}
+
+bool ResultCache::Find(const Key &key, DbAccessor *dba, storage::View view, mgp_result *result) {
+  std::shared_ptr<const std::vector<Record>> records;
+  {
+    std::lock_guard guard(lock_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return false;
+    order_.splice(order_.begin(), order_, it->second.position);
+    records = it->second.records;
+  }
+
+  auto *memory = result->rows.get_allocator().GetMemoryResource();
+  const auto rows_before = result->rows.size();
+  for (const auto &record : *records) {
+    auto &row = result->rows.emplace_back(mgp_result_record{
+        result->signature, utils::pmr::map<utils::pmr::string, TypedValue>(memory)});
+    for (const auto &[field, value] : record) {
+      auto typed_value = ToTypedValue(value, dba, view, memory);
+      // The vertices exist in the state of the database the records were
+      // cached for, so this only happens if the key doesn't identify it.
+      if (!typed_value) {
+        result->rows.erase(result->rows.begin() + static_cast<std::ptrdiff_t>(rows_before), result->rows.end());
+        return false;
+      }
+      row.values.emplace(field, std::move(*typed_value));
+    }
+  }
+  return true;
+}
+
+void ResultCache::Insert(Key key, const mgp_result &result) {
+  const auto capacity = capacity_.load(std::memory_order_relaxed);
+  if (capacity == 0) return;
+  auto records = std::make_shared<std::vector<Record>>();
+  records->reserve(result.rows.size());
+  size_t size = kValueOverheadBytes;
+  for (const auto &row : result.rows) {
+    auto &record = records->emplace_back();
+    record.reserve(row.values.size());
+    size += kValueOverheadBytes;
+    for (const auto &[field, value] : row.values) {
+      auto cached = ToCachedValue(value);
+      if (!cached) return;
+      size += field.size() + ApproximateSize(*cached);
+      record.emplace_back(std::string(field), std::move(*cached));
+    }
+    if (size > capacity) return;
+  }
+
+  std::lock_guard guard(lock_);
+  // The transactions which start from now on can't see the older states of
+  // the database, so their records are dropped.
+  std::erase_if(entries_, [&](const auto &entry) {
+    const auto &[other, other_entry] = entry;
+    const bool older = other.database == key.database &&
+                       std::pair(other.snapshot.storage_mode_changes, other.snapshot.last_commit_timestamp) <
+                           std::pair(key.snapshot.storage_mode_changes, key.snapshot.last_commit_timestamp);
+    if (!older) return false;
+    size_ -= other_entry.size;
+    order_.erase(other_entry.position);
+    return true;
+  });
+  auto [it, inserted] = entries_.try_emplace(std::move(key));
+  if (inserted) {
+    order_.push_front(&it->first);
+    it->second.position = order_.begin();
+  } else {
+    order_.splice(order_.begin(), order_, it->second.position);
+    size_ -= it->second.size;
+  }
+  it->second.records = std::move(records);
+  it->second.size = size;
+  size_ += size;
+  EvictOverCapacity();
+}
+
+void ResultCache::Clear() {
+  std::lock_guard guard(lock_);
+  entries_.clear();
+  order_.clear();
+  size_ = 0;
+}
+
+void ResultCache::EvictOverCapacity() {
+  while (size_ > capacity_.load(std::memory_order_relaxed) && !order_.empty()) {
+    auto it = entries_.find(*order_.back());
+    size_ -= it->second.size;
+    order_.pop_back();
+    entries_.erase(it);
+  }
+}
+
+}  // namespace memgraph::query::procedure
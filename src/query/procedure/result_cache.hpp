@@ -0,0 +1,125 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "query/db_accessor.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/view.hpp"
+
+struct mgp_result;
+
+namespace memgraph::query::procedure {
+
+/**
+ * Records yielded by the deterministic procedures, reused by the calls with the
+ * same arguments which see the same committed state of the database.
+ *
+ * The least recently used records are evicted once all cached records take
+ * more memory than the capacity. Records with edges, paths or graphs aren't
+ * cached. Vertices are cached as their IDs and found again by the calls which
+ * reuse them.
+ *
+ * This class is thread-safe.
+ */
+class ResultCache final {
+ public:
+  struct Key {
+    std::string database;
+    std::string procedure;
+    storage::SnapshotId snapshot;
+    std::vector<TypedValue> arguments;
+
+    bool operator==(const Key &other) const;
+  };
+
+  ResultCache() = default;
+  ResultCache(const ResultCache &) = delete;
+  ResultCache &operator=(const ResultCache &) = delete;
+  ResultCache(ResultCache &&) = delete;
+  ResultCache &operator=(ResultCache &&) = delete;
+  ~ResultCache() = default;
+
+  /// Returns the key of a call, unless its arguments contain graph elements.
+  static std::optional<Key> MakeKey(std::string_view database, std::string_view procedure,
+                                    const storage::SnapshotId &snapshot, const std::vector<TypedValue> &arguments);
+
+  /// Sets the memory which the cached records may take, 0 disables caching.
+  void SetCapacity(size_t capacity_bytes);
+
+  bool Enabled() const { return capacity_.load(std::memory_order_relaxed) != 0; }
+
+  /// Adds the records cached for the key to the rows of `result`, finding
+  /// their vertices with `dba`.
+  /// @return false if the records aren't cached.
+  bool Find(const Key &key, DbAccessor *dba, storage::View view, mgp_result *result);
+
+  /// Caches the rows of `result` for the key, if they can be cached.
+  void Insert(Key key, const mgp_result &result);
+
+  void Clear();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+
+  // Value of a cached record. Lists and maps are only split into their
+  // elements when they contain vertices.
+  struct CachedValue {
+    using List = std::vector<CachedValue>;
+    using Map = std::vector<std::pair<std::string, CachedValue>>;
+
+    std::variant<TypedValue, storage::Gid, List, Map> value;
+  };
+
+  using Record = std::vector<std::pair<std::string, CachedValue>>;
+
+  struct Entry {
+    std::shared_ptr<const std::vector<Record>> records;
+    size_t size{0};
+    std::list<const Key *>::iterator position;
+  };
+
+  static std::optional<CachedValue> ToCachedValue(const TypedValue &value);
+  static std::optional<TypedValue> ToTypedValue(const CachedValue &value, DbAccessor *dba, storage::View view,
+                                                utils::MemoryResource *memory);
+  static size_t ApproximateSize(const CachedValue &value);
+
+  void EvictOverCapacity();
+
+  std::atomic<size_t> capacity_{0};
+  std::mutex lock_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  // Keys of the entries, the most recently used first.
+  std::list<const Key *> order_;
+  size_t size_{0};
+};
+
+/// Single, global cache of the records of deterministic procedures.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern ResultCache gResultCache;
+
+}  // namespace memgraph::query::procedure
@@ -0,0 +1,248 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/query_result_cache.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/ast/ast_visitor.hpp"
+
+namespace memgraph::query {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+QueryResultCache gQueryResultCache;
+
+namespace {
+
+// Approximate memory used by each cached value and row apart from their
+// contents.
+constexpr size_t kValueOverheadBytes = 32;
+
+// Finds the parts of a query whose results may differ between two executions
+// which see the same state of the database.
+class ChangingResultsFinder : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool Visit(Identifier &) override { return true; }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+
+  bool PreVisit(Function &function) override {
+    static const std::unordered_set<std::string> kChangingFunctions{"RAND", "RANDOMUUID", "TIMESTAMP",
+                                                                    "UNIFORMSAMPLE", "COUNTER"};
+    // Temporal functions called without arguments return the current time.
+    static const std::unordered_set<std::string> kCurrentTimeFunctions{"DATE", "LOCALTIME", "LOCALDATETIME"};
+    if (kChangingFunctions.contains(function.function_name_) ||
+        (function.arguments_.empty() && kCurrentTimeFunctions.contains(function.function_name_))) {
+      found_ = true;
+    }
+    return !found_;
+  }
+  bool PreVisit(CallProcedure &) override { return !(found_ = true); }
+  bool PreVisit(LoadCsv &) override { return !(found_ = true); }
+
+  bool found_{false};
+};
+
+bool HasGraphElements(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Vertex:
+    case TypedValue::Type::Edge:
+    case TypedValue::Type::Path:
+    case TypedValue::Type::Graph:
+      return true;
+    case TypedValue::Type::List:
+      return std::any_of(value.ValueList().begin(), value.ValueList().end(),
+                         [](const auto &element) { return HasGraphElements(element); });
+    case TypedValue::Type::Map:
+      return std::any_of(value.ValueMap().begin(), value.ValueMap().end(),
+                         [](const auto &entry) { return HasGraphElements(entry.second); });
+    default:
+      return false;
+  }
+}
+
+size_t ApproximateValueSize(const TypedValue &value) {
+  size_t size = kValueOverheadBytes;
+  switch (value.type()) {
+    case TypedValue::Type::String:
+      size += value.ValueString().size();
+      break;
+    case TypedValue::Type::List:
+      for (const auto &element : value.ValueList()) size += ApproximateValueSize(element);
+      break;
+    case TypedValue::Type::Map:
+      for (const auto &[key, element] : value.ValueMap()) size += key.size() + ApproximateValueSize(element);
+      break;
+    default:
+      break;
+  }
+  return size;
+}
+
+size_t HashParameter(const storage::PropertyValue &value) {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Bool:
+      return std::hash<bool>{}(value.ValueBool());
+    case storage::PropertyValue::Type::Int:
+      return std::hash<int64_t>{}(value.ValueInt());
+    case storage::PropertyValue::Type::Double:
+      return std::hash<double>{}(value.ValueDouble());
+    case storage::PropertyValue::Type::String:
+      return std::hash<std::string_view>{}(value.ValueString());
+    default:
+      // Other values are told apart by the equality of the keys.
+      return static_cast<size_t>(value.type());
+  }
+}
+
+}  // namespace
+
+bool HasChangingResults(CypherQuery *query) {
+  ChangingResultsFinder finder;
+  query->Accept(finder);
+  return finder.found_;
+}
+
+bool QueryResultCache::Key::operator==(const Key &other) const {
+  if (database != other.database || username != other.username || query_hash != other.query_hash ||
+      parameters.size() != other.parameters.size()) {
+    return false;
+  }
+  // Integers and doubles are equal in Cypher, but the results of the query
+  // may differ for them.
+  return std::equal(parameters.begin(), parameters.end(), other.parameters.begin(),
+                    [](const storage::PropertyValue &first, const storage::PropertyValue &second) {
+                      return first.type() == second.type() && first == second;
+                    });
+}
+
+size_t QueryResultCache::KeyHash::operator()(const Key &key) const {
+  static constexpr size_t kPrime = 1099511628211UL;
+  size_t hash = std::hash<std::string>{}(key.database);
+  hash = hash * kPrime ^ std::hash<std::string>{}(key.username);
+  hash = hash * kPrime ^ std::hash<uint64_t>{}(key.query_hash);
+  for (const auto &parameter : key.parameters) {
+    hash = hash * kPrime ^ HashParameter(parameter);
+  }
+  return hash;
+}
+
+std::optional<QueryResultCache::Key> QueryResultCache::MakeKey(std::string_view database,
+                                                               const std::optional<std::string> &username,
+                                                               const ParsedQuery &parsed_query) {
+  // Queries calling procedures or user-defined functions aren't cacheable.
+  auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
+  if (!parsed_query.is_cacheable || !cypher_query || HasChangingResults(cypher_query)) return std::nullopt;
+
+  Key key{.database = std::string(database),
+          .username = username.value_or(""),
+          .query_hash = parsed_query.stripped_query->hash()};
+  key.parameters.reserve(parsed_query.parameters.size());
+  for (const auto &[position, value] : parsed_query.parameters) key.parameters.push_back(value);
+  return key;
+}
+
+void QueryResultCache::SetCapacity(size_t capacity_bytes) {
+  std::lock_guard guard(lock_);
+  capacity_.store(capacity_bytes, std::memory_order_relaxed);
+  EvictOverCapacity();
+}
+
+std::shared_ptr<const QueryResultCache::Result> QueryResultCache::Find(
+    const Key &key, const std::optional<storage::SnapshotId> &snapshot,
+    std::optional<std::chrono::milliseconds> max_staleness) {
+  std::lock_guard guard(lock_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return nullptr;
+  const auto &result = *it->second.result;
+  const bool same_snapshot = snapshot && result.snapshot == snapshot;
+  const bool fresh_enough = max_staleness && std::chrono::steady_clock::now() - result.created <= *max_staleness;
+  if (!same_snapshot && !fresh_enough) return nullptr;
+  order_.splice(order_.begin(), order_, it->second.position);
+  return it->second.result;
+}
+
+void QueryResultCache::Clear() {
+  std::lock_guard guard(lock_);
+  generation_.fetch_add(1, std::memory_order_acq_rel);
+  entries_.clear();
+  order_.clear();
+  size_ = 0;
+}
+
+void QueryResultCache::Insert(Key key, std::shared_ptr<const Result> result, size_t size, uint64_t generation) {
+  std::lock_guard guard(lock_);
+  if (generation != generation_.load(std::memory_order_acquire)) return;
+  auto [it, inserted] = entries_.try_emplace(std::move(key));
+  if (inserted) {
+    order_.push_front(&it->first);
+    it->second.position = order_.begin();
+  } else {
+    order_.splice(order_.begin(), order_, it->second.position);
+    size_ -= it->second.size;
+  }
+  it->second.result = std::move(result);
+  it->second.size = size;
+  size_ += size;
+  EvictOverCapacity();
+}
+
+void QueryResultCache::EvictOverCapacity() {
+  while (size_ > capacity_.load(std::memory_order_relaxed) && !order_.empty()) {
+    auto it = entries_.find(*order_.back());
+    size_ -= it->second.size;
+    order_.pop_back();
+    entries_.erase(it);
+  }
+}
+
+QueryResultCache::Recorder::Recorder(QueryResultCache *cache, Key key, std::vector<std::string> header,
+                                     std::optional<storage::SnapshotId> snapshot)
+    : cache_(cache),
+      key_(std::move(key)),
+      generation_(cache->generation_.load(std::memory_order_acquire)),
+      result_(std::make_shared<QueryResultCache::Result>(QueryResultCache::Result{
+          .header = std::move(header), .snapshot = snapshot, .created = std::chrono::steady_clock::now()})),
+      size_(kValueOverheadBytes) {}
+
+void QueryResultCache::Recorder::Result(const std::vector<TypedValue> &values) {
+  if (!result_) return;
+  std::vector<TypedValue> row;
+  row.reserve(values.size());
+  size_ += kValueOverheadBytes;
+  for (const auto &value : values) {
+    if (HasGraphElements(value)) {
+      result_.reset();
+      return;
+    }
+    size_ += ApproximateValueSize(value);
+    row.emplace_back(value, utils::NewDeleteResource());
+  }
+  // Results which can't fit into the cache aren't collected any further.
+  if (size_ > cache_->capacity_.load(std::memory_order_relaxed)) {
+    result_.reset();
+    return;
+  }
+  result_->rows.push_back(std::move(row));
+}
+
+void QueryResultCache::Recorder::Finish() {
+  if (!result_) return;
+  cache_->Insert(std::move(key_), std::move(result_), size_, generation_);
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,151 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "query/cypher_query_interpreter.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/storage.hpp"
+
+namespace memgraph::query {
+
+/**
+ * Results of read-only Cypher queries, reused by the executions of the same
+ * query with the same parameters in the same database.
+ *
+ * A result is reused by the transactions which see the same committed state
+ * of the database as the one it was computed in, or, if the query allows it,
+ * by any transaction until it is older than the allowed staleness. Results
+ * with vertices, edges, paths or graphs aren't cached, and neither are the
+ * results of queries which call procedures, user-defined functions or
+ * functions whose values change between executions, such as `rand()`.
+ *
+ * The least recently used results are evicted once all cached results take
+ * more memory than the capacity.
+ *
+ * This class is thread-safe.
+ */
+class QueryResultCache final {
+ public:
+  struct Key {
+    std::string database;
+    // Results depend on the fine-grained privileges of the user.
+    std::string username;
+    uint64_t query_hash;
+    // Literals of the stripped query and the user parameters it uses.
+    std::vector<storage::PropertyValue> parameters;
+
+    bool operator==(const Key &other) const;
+  };
+
+  struct Result {
+    std::vector<std::string> header;
+    std::vector<std::vector<TypedValue>> rows;
+    // Committed state of the database the result was computed in, not set if
+    // the transaction which computed it could see more than that.
+    std::optional<storage::SnapshotId> snapshot;
+    std::chrono::steady_clock::time_point created;
+  };
+
+  /// Collects the rows of a query execution and caches them once the query
+  /// finishes, unless they can't be cached.
+  class Recorder final {
+   public:
+    Recorder(QueryResultCache *cache, Key key, std::vector<std::string> header,
+             std::optional<storage::SnapshotId> snapshot);
+
+    void Result(const std::vector<TypedValue> &values);
+
+    void Finish();
+
+   private:
+    QueryResultCache *cache_;
+    Key key_;
+    uint64_t generation_;
+    std::shared_ptr<QueryResultCache::Result> result_;
+    size_t size_{0};
+  };
+
+  QueryResultCache() = default;
+  QueryResultCache(const QueryResultCache &) = delete;
+  QueryResultCache &operator=(const QueryResultCache &) = delete;
+  QueryResultCache(QueryResultCache &&) = delete;
+  QueryResultCache &operator=(QueryResultCache &&) = delete;
+  ~QueryResultCache() = default;
+
+  /// Returns the key of the query, unless its results can't be cached.
+  static std::optional<Key> MakeKey(std::string_view database, const std::optional<std::string> &username,
+                                    const ParsedQuery &parsed_query);
+
+  /// Sets the memory which the cached results may take, 0 disables caching.
+  void SetCapacity(size_t capacity_bytes);
+
+  bool Enabled() const { return capacity_.load(std::memory_order_relaxed) != 0; }
+
+  /// Returns the result cached for the key if it is valid in the `snapshot`,
+  /// or if it isn't older than `max_staleness`.
+  std::shared_ptr<const Result> Find(const Key &key, const std::optional<storage::SnapshotId> &snapshot,
+                                     std::optional<std::chrono::milliseconds> max_staleness);
+
+  /// Drops all cached results, including the ones of the queries which are
+  /// still executing. Called when the privileges of the users change.
+  void Clear();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    std::shared_ptr<const Result> result;
+    size_t size{0};
+    std::list<const Key *>::iterator position;
+  };
+
+  void Insert(Key key, std::shared_ptr<const Result> result, size_t size, uint64_t generation);
+
+  void EvictOverCapacity();
+
+  std::atomic<size_t> capacity_{0};
+  // Incremented by `Clear`, the results of the executions which started
+  // before it aren't cached.
+  std::atomic<uint64_t> generation_{0};
+  std::mutex lock_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  // Keys of the entries, the most recently used first.
+  std::list<const Key *> order_;
+  size_t size_{0};
+};
+
+/// Returns true if the results of the query may differ between two executions
+/// which see the same state of the database, because it calls a procedure,
+/// loads a CSV file or calls a function such as `rand()`.
+bool HasChangingResults(CypherQuery *query);
+
+/// Single, global cache of the results of read-only queries.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern QueryResultCache gQueryResultCache;
+
+}  // namespace memgraph::query
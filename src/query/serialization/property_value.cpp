@@ -16,7 +16,7 @@
 namespace memgraph::query::serialization {
 
 namespace {
-enum class ObjectType : uint8_t { MAP, TEMPORAL_DATA };
+enum class ObjectType : uint8_t { MAP, TEMPORAL_DATA, POINT };
 }  // namespace
 
 nlohmann::json SerializePropertyValue(const storage::PropertyValue &property_value) {
@@ -36,13 +36,24 @@ nlohmann::json SerializePropertyValue(const storage::PropertyValue &property_val
       return SerializePropertyValueVector(property_value.ValueList());
     case Type::Map:
       return SerializePropertyValueMap(property_value.ValueMap());
-    case Type::TemporalData:
+    case Type::TemporalData: {
       const auto temporal_data = property_value.ValueTemporalData();
       auto data = nlohmann::json::object();
       data.emplace("type", static_cast<uint64_t>(ObjectType::TEMPORAL_DATA));
       data.emplace("value", nlohmann::json::object({{"type", static_cast<uint64_t>(temporal_data.type)},
                                                     {"microseconds", temporal_data.microseconds}}));
       return data;
+    }
+    case Type::Point: {
+      const auto point = property_value.ValuePoint();
+      auto data = nlohmann::json::object();
+      data.emplace("type", static_cast<uint64_t>(ObjectType::POINT));
+      data.emplace("value", nlohmann::json::object({{"srid", static_cast<uint64_t>(point.crs)},
+                                                    {"x", point.x},
+                                                    {"y", point.y},
+                                                    {"z", point.z}}));
+      return data;
+    }
   }
 }
 
@@ -99,6 +110,12 @@ storage::PropertyValue DeserializePropertyValue(const nlohmann::json &data) {
     case ObjectType::TEMPORAL_DATA:
       return storage::PropertyValue(storage::TemporalData{data["value"]["type"].get<storage::TemporalType>(),
                                                           data["value"]["microseconds"].get<int64_t>()});
+    case ObjectType::POINT: {
+      const auto crs = storage::SridToCrs(data["value"]["srid"].get<int64_t>());
+      MG_ASSERT(crs, "Invalid point serialization");
+      return storage::PropertyValue(storage::Point{*crs, data["value"]["x"].get<double>(),
+                                                   data["value"]["y"].get<double>(), data["value"]["z"].get<double>()});
+    }
   }
 }
 
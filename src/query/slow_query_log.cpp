@@ -0,0 +1,134 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/slow_query_log.hpp"
+
+#include <random>
+#include <sstream>
+
+#include <json/json.hpp>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+constexpr auto kFlushInterval = std::chrono::seconds(1);
+constexpr auto kFileName = "slow_queries.log";
+
+std::filesystem::path RotatedPath(const std::filesystem::path &path, size_t index) {
+  return path.string() + "." + std::to_string(index);
+}
+
+}  // namespace
+
+std::string ParametersShape(const std::map<std::string, storage::PropertyValue> &parameters) {
+  std::ostringstream shape;
+  shape << "{";
+  for (auto it = parameters.begin(); it != parameters.end(); ++it) {
+    if (it != parameters.begin()) shape << ", ";
+    shape << it->first << ": " << it->second.type();
+  }
+  shape << "}";
+  return shape.str();
+}
+
+SlowQueryLog::SlowQueryLog(std::filesystem::path directory, std::chrono::milliseconds threshold, double sample_rate,
+                           size_t capacity)
+    : directory_(std::move(directory)), threshold_(threshold), sample_rate_(sample_rate), capacity_(capacity) {}
+
+SlowQueryLog::~SlowQueryLog() {
+  scheduler_.Stop();
+  Flush();
+}
+
+bool SlowQueryLog::ShouldRecord(std::chrono::duration<double> time) const {
+  if (!IsEnabled() || time < threshold_) return false;
+  if (sample_rate_ >= 1.0) return true;
+  thread_local std::minstd_rand generator{std::random_device{}()};
+  return std::uniform_real_distribution<double>{0.0, 1.0}(generator) < sample_rate_;
+}
+
+void SlowQueryLog::Record(SlowQuery query) {
+  std::call_once(scheduler_started_, [this] { scheduler_.Run("SlowQueryLog", kFlushInterval, [this] { Flush(); }); });
+  std::lock_guard guard(lock_);
+  if (recent_.size() == capacity_) recent_.pop_front();
+  recent_.push_back(query);
+  // The queries recorded faster than they are written are dropped.
+  if (pending_.size() < capacity_) pending_.push_back(std::move(query));
+}
+
+std::vector<SlowQuery> SlowQueryLog::Recent() const {
+  std::lock_guard guard(lock_);
+  return {recent_.begin(), recent_.end()};
+}
+
+void SlowQueryLog::Flush() {
+  std::vector<SlowQuery> queries;
+  {
+    std::lock_guard guard(lock_);
+    queries.swap(pending_);
+  }
+  if (queries.empty()) return;
+
+  std::lock_guard guard(file_lock_);
+  try {
+    for (const auto &query : queries) {
+      if ((!file_.IsOpen() || file_size_ >= kSlowQueryLogMaxFileSize) && !OpenFile()) return;
+      auto line = nlohmann::json{{"timestamp", query.timestamp},
+                                 {"db", query.db},
+                                 {"username", query.username},
+                                 {"query_hash", query.query_hash},
+                                 {"query", query.query},
+                                 {"parameters", query.parameters},
+                                 {"plan", query.plan},
+                                 {"parsing_time", query.parsing_time},
+                                 {"planning_time", query.planning_time},
+                                 {"execution_time", query.execution_time},
+                                 {"streaming_time", query.streaming_time},
+                                 {"commit_time", query.commit_time},
+                                 {"total_time", query.TotalTime()}}
+                      .dump();
+      line += '\n';
+      file_.Write(line);
+      file_size_ += line.size();
+    }
+    file_.Sync();
+  } catch (const std::exception &e) {
+    spdlog::warn("Couldn't write the slow query log: {}", e.what());
+  }
+}
+
+bool SlowQueryLog::OpenFile() {
+  const auto path = directory_ / kFileName;
+  if (file_.IsOpen()) {
+    file_.Close();
+    // Shift the older files, dropping the oldest one.
+    std::error_code error;
+    std::filesystem::remove(RotatedPath(path, kSlowQueryLogMaxFiles), error);
+    for (auto index = kSlowQueryLogMaxFiles; index > 1; --index) {
+      std::filesystem::rename(RotatedPath(path, index - 1), RotatedPath(path, index), error);
+    }
+    std::filesystem::rename(path, RotatedPath(path, 1), error);
+  }
+  if (!utils::EnsureDir(directory_)) {
+    spdlog::warn("Couldn't create the slow query log directory {}.", directory_.string());
+    return false;
+  }
+  file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
+  std::error_code error;
+  const auto size = std::filesystem::file_size(path, error);
+  file_size_ = error ? 0 : size;
+  return true;
+}
+
+}  // namespace memgraph::query
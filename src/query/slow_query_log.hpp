@@ -0,0 +1,120 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "storage/v2/property_value.hpp"
+#include "utils/file.hpp"
+#include "utils/scheduler.hpp"
+
+namespace memgraph::query {
+
+/// A query recorded by the slow query log.
+struct SlowQuery {
+  /// Microseconds since the epoch when the query finished.
+  int64_t timestamp{0};
+  std::string db;
+  std::string username;
+  /// Hash of the stripped query, which is the same for the queries differing
+  /// only in their literals.
+  uint64_t query_hash{0};
+  /// The query with its literals replaced by parameters.
+  std::string query;
+  /// Names and types of the parameters given with the query, without their
+  /// values.
+  std::string parameters;
+  /// The plan of a Cypher query, empty for the other queries.
+  std::string plan;
+  // Seconds spent in each phase of the query. Executing a Cypher query is
+  // pulling the results from its plan, and streaming them is everything else
+  // done while the results are pulled by the client.
+  double parsing_time{0};
+  double planning_time{0};
+  double execution_time{0};
+  double streaming_time{0};
+  double commit_time{0};
+
+  double TotalTime() const { return parsing_time + planning_time + execution_time + streaming_time + commit_time; }
+};
+
+/// Returns the names and types of the parameters, e.g. `{id: int, names:
+/// list}`.
+std::string ParametersShape(const std::map<std::string, storage::PropertyValue> &parameters);
+
+inline constexpr uint64_t kSlowQueryLogMaxFileSize = 16UL * 1024UL * 1024UL;
+inline constexpr size_t kSlowQueryLogMaxFiles = 5;
+
+/// Keeps the most recent queries which took at least the threshold, a sample
+/// of them if the sample rate is below 1, and appends them to a log file in
+/// the background. Once the file grows over `kSlowQueryLogMaxFileSize` it is
+/// rotated, and at most `kSlowQueryLogMaxFiles` older files are kept. The
+/// functions are thread-safe.
+class SlowQueryLog {
+ public:
+  /// Nothing is recorded if `sample_rate` or `capacity`, the number of the
+  /// queries kept in memory, is 0.
+  SlowQueryLog(std::filesystem::path directory, std::chrono::milliseconds threshold, double sample_rate,
+               size_t capacity);
+
+  SlowQueryLog(const SlowQueryLog &) = delete;
+  SlowQueryLog(SlowQueryLog &&) = delete;
+  SlowQueryLog &operator=(const SlowQueryLog &) = delete;
+  SlowQueryLog &operator=(SlowQueryLog &&) = delete;
+
+  ~SlowQueryLog();
+
+  bool IsEnabled() const { return sample_rate_ > 0.0 && capacity_ > 0; }
+
+  /// Returns true if a query which took `time` should be recorded. Cheap
+  /// enough to be called for every query.
+  bool ShouldRecord(std::chrono::duration<double> time) const;
+
+  void Record(SlowQuery query);
+
+  /// Returns the queries kept in memory, the latest last.
+  std::vector<SlowQuery> Recent() const;
+
+  /// Writes the recorded queries to the log file.
+  void Flush();
+
+ private:
+  // Opens the log file, rotating the current one if it's open. Returns false
+  // if the directory of the file couldn't be made.
+  bool OpenFile();
+
+  std::filesystem::path directory_;
+  std::chrono::duration<double> threshold_;
+  double sample_rate_;
+  size_t capacity_;
+
+  mutable std::mutex lock_;
+  std::deque<SlowQuery> recent_;
+  // Queries which aren't written to the file yet.
+  std::vector<SlowQuery> pending_;
+
+  std::mutex file_lock_;
+  utils::OutputFile file_;
+  uint64_t file_size_{0};
+
+  std::once_flag scheduler_started_;
+  utils::Scheduler scheduler_;
+};
+
+}  // namespace memgraph::query
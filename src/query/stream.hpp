@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -41,7 +43,13 @@ class AnyStream final {
                   .template delete_object<GenericWrapper<TStream>>(static_cast<GenericWrapper<TStream> *>(ptr));
             }} {}
 
-  void Result(const std::vector<TypedValue> &values) { content_->Result(values); }
+  void Result(const std::vector<TypedValue> &values) {
+    content_->Result(values);
+    ++rows_;
+  }
+
+  /// Number of the results streamed so far.
+  uint64_t Rows() const { return rows_; }
 
  private:
   struct Wrapper {
@@ -58,6 +66,7 @@ class AnyStream final {
   };
 
   std::unique_ptr<Wrapper, std::function<void(Wrapper *)>> content_;
+  uint64_t rows_{0};
 };
 
 }  // namespace memgraph::query
@@ -11,13 +11,21 @@
 
 #include "query/stream/sources.hpp"
 
+#include <algorithm>
+
 #include <json/json.hpp>
 
 #include "integrations/constants.hpp"
+#include "integrations/kafka/exceptions.hpp"
 
 namespace memgraph::query::stream {
 KafkaStream::KafkaStream(std::string stream_name, StreamInfo stream_info,
-                         ConsumerFunction<integrations::kafka::Message> consumer_function) {
+                         ConsumerFunction<integrations::kafka::Message> consumer_function)
+    : workers_count_{stream_info.workers}, consumer_function_{std::move(consumer_function)} {
+  if (workers_count_ < kDefaultKafkaWorkers) {
+    throw integrations::kafka::ConsumerFailedToInitializeException(stream_name,
+                                                                   "Number of workers has to be positive!");
+  }
   integrations::kafka::ConsumerInfo consumer_info{
       .consumer_name = std::move(stream_name),
       .topics = std::move(stream_info.topics),
@@ -27,8 +35,9 @@ KafkaStream::KafkaStream(std::string stream_name, StreamInfo stream_info,
       .batch_size = stream_info.common_info.batch_size,
       .public_configs = std::move(stream_info.configs),
       .private_configs = std::move(stream_info.credentials),
+      .max_in_flight_batches = stream_info.max_in_flight_batches,
   };
-  consumer_.emplace(std::move(consumer_info), std::move(consumer_function));
+  consumer_.emplace(std::move(consumer_info), consumer_function_);
 };
 
 KafkaStream::StreamInfo KafkaStream::Info(std::string transformation_name) const {
@@ -40,31 +49,72 @@ KafkaStream::StreamInfo KafkaStream::Info(std::string transformation_name) const
           .consumer_group = info.consumer_group,
           .bootstrap_servers = info.bootstrap_servers,
           .configs = info.public_configs,
-          .credentials = info.private_configs};
+          .credentials = info.private_configs,
+          .workers = workers_count_,
+          .max_in_flight_batches = info.max_in_flight_batches};
+}
+
+void KafkaStream::Start() {
+  ReleaseWorkers();
+  // The workers run their own transformations and transactions. Kafka assigns
+  // each partition to a single member of the consumer group and every member
+  // commits the offsets of its own partitions, so the messages of a partition
+  // are still processed in order.
+  std::vector<std::unique_ptr<Consumer>> workers;
+  workers.reserve(workers_count_ - 1);
+  for (int64_t i = 1; i < workers_count_; ++i) {
+    workers.push_back(std::make_unique<Consumer>(consumer_->Info(), consumer_function_));
+  }
+  consumer_->Start();
+  for (auto &worker : workers) {
+    worker->Start();
+  }
+  workers_ = std::move(workers);
 }
 
-void KafkaStream::Start() { consumer_->Start(); }
 void KafkaStream::StartWithLimit(uint64_t batch_limit, std::optional<std::chrono::milliseconds> timeout) const {
+  ReleaseWorkers();
   consumer_->StartWithLimit(batch_limit, timeout);
 }
-void KafkaStream::Stop() { consumer_->Stop(); }
-bool KafkaStream::IsRunning() const { return consumer_->IsRunning(); }
+
+void KafkaStream::Stop() {
+  if (!IsRunning()) {
+    throw integrations::kafka::ConsumerStoppedException(consumer_->Info().consumer_name);
+  }
+  consumer_->StopIfRunning();
+  workers_.clear();
+}
+
+bool KafkaStream::IsRunning() const {
+  return consumer_->IsRunning() ||
+         std::any_of(workers_.begin(), workers_.end(), [](const auto &worker) { return worker->IsRunning(); });
+}
 
 void KafkaStream::Check(std::optional<std::chrono::milliseconds> timeout, std::optional<uint64_t> batch_limit,
                         const ConsumerFunction<integrations::kafka::Message> &consumer_function) const {
+  ReleaseWorkers();
   consumer_->Check(timeout, batch_limit, consumer_function);
 }
 
 utils::BasicResult<std::string> KafkaStream::SetStreamOffset(const int64_t offset) {
+  ReleaseWorkers();
   return consumer_->SetConsumerOffsets(offset);
 }
 
+void KafkaStream::ReleaseWorkers() const {
+  if (IsRunning()) {
+    throw integrations::kafka::ConsumerRunningException(consumer_->Info().consumer_name);
+  }
+  workers_.clear();
+}
+
 namespace {
 const std::string kTopicsKey{"topics"};
 const std::string kConsumerGroupKey{"consumer_group"};
 const std::string kBoostrapServers{"bootstrap_servers"};
 const std::string kConfigs{"configs"};
 const std::string kCredentials{"credentials"};
+const std::string kWorkers{"workers"};
 
 const std::unordered_map<std::string, std::string> kDefaultConfigsMap;
 }  // namespace
@@ -76,6 +126,7 @@ void to_json(nlohmann::json &data, KafkaStream::StreamInfo &&info) {
   data[kBoostrapServers] = std::move(info.bootstrap_servers);
   data[kConfigs] = std::move(info.configs);
   data[kCredentials] = std::move(info.credentials);
+  data[kWorkers] = info.workers;
 }
 
 void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
@@ -86,6 +137,7 @@ void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
   // These values might not be present in the persisted JSON object
   info.configs = data.value(kConfigs, kDefaultConfigsMap);
   info.credentials = data.value(kCredentials, kDefaultConfigsMap);
+  info.workers = data.value(kWorkers, kDefaultKafkaWorkers);
 }
 
 PulsarStream::PulsarStream(std::string stream_name, StreamInfo stream_info,
@@ -18,6 +18,8 @@
 
 namespace memgraph::query::stream {
 
+inline constexpr int64_t kDefaultKafkaWorkers{1};
+
 struct KafkaStream {
   struct StreamInfo {
     CommonStreamInfo common_info;
@@ -26,10 +28,15 @@ struct KafkaStream {
     std::string bootstrap_servers;
     std::unordered_map<std::string, std::string> configs;
     std::unordered_map<std::string, std::string> credentials;
+    int64_t workers{kDefaultKafkaWorkers};
+    // Comes from the configuration of the instance, so it isn't persisted.
+    int64_t max_in_flight_batches{1};
   };
 
   using Message = integrations::kafka::Message;
 
+  /// Each worker of the stream calls its own copy of the consumer function, so
+  /// the copies must not share state.
   KafkaStream(std::string stream_name, StreamInfo stream_info,
               ConsumerFunction<integrations::kafka::Message> consumer_function);
 
@@ -47,7 +54,20 @@ struct KafkaStream {
 
  private:
   using Consumer = integrations::kafka::Consumer;
+
+  /// Removes the stopped workers from the consumer group, so consumer_ gets
+  /// all of the partitions again.
+  ///
+  /// @throws ConsumerRunningException if the stream is running
+  void ReleaseWorkers() const;
+
   std::optional<Consumer> consumer_;
+  int64_t workers_count_;
+  ConsumerFunction<Message> consumer_function_;
+  // The consumers which join the consumer group of consumer_ while the stream
+  // is started, so the partitions of the topics are split among them. Mutable,
+  // as the stopped ones are released before the stream is checked.
+  mutable std::vector<std::unique_ptr<Consumer>> workers_;
 };
 
 void to_json(nlohmann::json &data, KafkaStream::StreamInfo &&info);
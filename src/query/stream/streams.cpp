@@ -13,6 +13,7 @@
 
 #include <shared_mutex>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include <spdlog/spdlog.h>
@@ -480,15 +481,24 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
     throw StreamsException{"Stream already exists with name '{}'", stream_name};
   }
 
+  if constexpr (std::is_same_v<TStream, KafkaStream>) {
+    stream_info.max_in_flight_batches = interpreter_context_->config.kafka_stream_max_in_flight_batches;
+  }
+
   auto *memory_resource = utils::NewDeleteResource();
 
+  // The interpreter is created when the first batch is consumed, so every copy
+  // of the function made for the workers of a stream gets its own.
   auto consumer_function = [interpreter_context = interpreter_context_, memory_resource, stream_name,
                             transformation_name = stream_info.common_info.transformation_name, owner = owner,
-                            interpreter = std::make_shared<Interpreter>(interpreter_context_),
+                            interpreter = std::shared_ptr<Interpreter>{},
                             result = mgp_result{nullptr, memory_resource},
                             total_retries = interpreter_context_->config.stream_transaction_conflict_retries,
                             retry_interval = interpreter_context_->config.stream_transaction_retry_interval](
                                const std::vector<typename TStream::Message> &messages) mutable {
+    if (!interpreter) {
+      interpreter = std::make_shared<Interpreter>(interpreter_context);
+    }
     auto accessor = interpreter_context->db->Access();
     // register new interpreter into interpreter_context_
     interpreter_context->interpreters->insert(interpreter.get());
@@ -11,6 +11,7 @@
 
 #include "query/trigger.hpp"
 
+#include <algorithm>
 #include <concepts>
 
 #include "query/config.hpp"
@@ -23,10 +24,14 @@
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_gauge.hpp"
 #include "utils/memory.hpp"
+#include "utils/thread.hpp"
 
 namespace memgraph::metrics {
 extern const Event TriggersExecuted;
+extern const Event AfterCommitTriggerBatches;
+extern const Event AfterCommitTriggerQueueDepth;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query {
@@ -169,7 +174,7 @@ Trigger::TriggerPlan::TriggerPlan(std::unique_ptr<LogicalPlan> logical_plan, std
 std::shared_ptr<Trigger::TriggerPlan> Trigger::GetPlan(DbAccessor *db_accessor,
                                                        const query::AuthChecker *auth_checker) const {
   std::lock_guard plan_guard{plan_lock_};
-  if (!parsed_statements_.is_cacheable || !trigger_plan_ || trigger_plan_->cached_plan.IsExpired()) {
+  if (!parsed_statements_.is_cacheable || !trigger_plan_ || trigger_plan_->cached_plan.IsExpired(db_accessor)) {
     auto identifiers = GetPredefinedIdentifiers(event_type_);
 
     AstStorage ast_storage;
@@ -440,4 +445,78 @@ std::unordered_set<TriggerEventType> TriggerStore::GetEventTypes() const {
   add_event_types(after_commit_triggers_);
   return event_types;
 }
+
+AfterCommitTriggerExecutor::AfterCommitTriggerExecutor(const size_t threads, const size_t max_batch_size,
+                                                       const size_t max_queue_size, RunTriggers run_triggers)
+    : max_batch_size_{std::max<size_t>(max_batch_size, 1)},
+      max_queue_size_{max_queue_size},
+      run_triggers_{std::move(run_triggers)} {
+  threads_.reserve(threads);
+  for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+    threads_.emplace_back([this] { ThreadLoop(); });
+  }
+}
+
+AfterCommitTriggerExecutor::~AfterCommitTriggerExecutor() { Shutdown(); }
+
+void AfterCommitTriggerExecutor::Add(TriggerContext context, std::function<void()> on_finished) {
+  {
+    std::unique_lock guard(lock_);
+    queue_changed_.wait(guard, [this] { return stopped_ || max_queue_size_ == 0 || queue_.size() < max_queue_size_; });
+    if (stopped_) return;
+    queue_.push_back(Job{std::move(context), std::move(on_finished)});
+    metrics::SetGaugeValue(metrics::AfterCommitTriggerQueueDepth, queue_.size());
+  }
+  queue_changed_.notify_all();
+}
+
+size_t AfterCommitTriggerExecutor::QueueDepth() const {
+  std::lock_guard guard(lock_);
+  return queue_.size();
+}
+
+void AfterCommitTriggerExecutor::Shutdown() {
+  {
+    std::lock_guard guard(lock_);
+    if (stopped_) return;
+    stopped_ = true;
+    queue_.clear();
+    metrics::SetGaugeValue(metrics::AfterCommitTriggerQueueDepth, 0);
+  }
+  queue_changed_.notify_all();
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+void AfterCommitTriggerExecutor::ThreadLoop() {
+  utils::ThreadSetName("AfterCommitTrig");
+  while (true) {
+    std::vector<Job> batch;
+    {
+      std::unique_lock guard(lock_);
+      queue_changed_.wait(guard, [this] { return stopped_ || !queue_.empty(); });
+      if (stopped_) return;
+      const auto batch_size = std::min(queue_.size(), max_batch_size_);
+      batch.reserve(batch_size);
+      for (size_t i = 0; i < batch_size; ++i) {
+        batch.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      metrics::SetGaugeValue(metrics::AfterCommitTriggerQueueDepth, queue_.size());
+    }
+    // Wakes up the transactions waiting for a place in the queue.
+    queue_changed_.notify_all();
+
+    auto context = std::move(batch.front().context);
+    for (auto it = std::next(batch.begin()); it != batch.end(); ++it) {
+      context.Merge(std::move(it->context));
+    }
+    run_triggers_(std::move(context));
+    metrics::IncrementCounter(metrics::AfterCommitTriggerBatches);
+    for (auto &job : batch) {
+      job.on_finished();
+    }
+  }
+}
 }  // namespace memgraph::query
@@ -12,10 +12,15 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -117,4 +122,51 @@ struct TriggerStore {
   utils::SkipList<Trigger> after_commit_triggers_;
 };
 
+// Runs the after commit triggers on a pool of threads. The trigger contexts of
+// the transactions which commit while the triggers of the previous ones run
+// are merged, so the triggers run once for the whole batch.
+class AfterCommitTriggerExecutor {
+ public:
+  using RunTriggers = std::function<void(TriggerContext)>;
+
+  // With `max_queue_size` 0, the number of queued transactions isn't limited.
+  AfterCommitTriggerExecutor(size_t threads, size_t max_batch_size, size_t max_queue_size, RunTriggers run_triggers);
+  ~AfterCommitTriggerExecutor();
+
+  AfterCommitTriggerExecutor(const AfterCommitTriggerExecutor &) = delete;
+  AfterCommitTriggerExecutor(AfterCommitTriggerExecutor &&) = delete;
+  AfterCommitTriggerExecutor &operator=(const AfterCommitTriggerExecutor &) = delete;
+  AfterCommitTriggerExecutor &operator=(AfterCommitTriggerExecutor &&) = delete;
+
+  // Queues the trigger context of a committed transaction, `on_finished` is
+  // called after the triggers of its batch run. Blocks while the queue is
+  // full, which slows the committing transactions down to the pace of the
+  // triggers.
+  void Add(TriggerContext context, std::function<void()> on_finished);
+
+  size_t QueueDepth() const;
+
+  // Stops the threads, the queued transactions are dropped without running
+  // their triggers.
+  void Shutdown();
+
+ private:
+  struct Job {
+    TriggerContext context;
+    std::function<void()> on_finished;
+  };
+
+  void ThreadLoop();
+
+  const size_t max_batch_size_;
+  const size_t max_queue_size_;
+  RunTriggers run_triggers_;
+
+  mutable std::mutex lock_;
+  std::condition_variable queue_changed_;
+  std::deque<Job> queue_;
+  bool stopped_{false};
+  std::vector<std::thread> threads_;
+};
+
 }  // namespace memgraph::query
@@ -344,6 +344,23 @@ void TriggerContext::AdaptForAccessor(DbAccessor *accessor) {
   adapt_context_with_edge(&removed_edge_properties_);
 }
 
+void TriggerContext::Merge(TriggerContext &&other) {
+  const auto append = [](auto *values, auto *other_values) {
+    values->insert(values->end(), std::make_move_iterator(other_values->begin()),
+                   std::make_move_iterator(other_values->end()));
+  };
+  append(&created_vertices_, &other.created_vertices_);
+  append(&deleted_vertices_, &other.deleted_vertices_);
+  append(&set_vertex_properties_, &other.set_vertex_properties_);
+  append(&removed_vertex_properties_, &other.removed_vertex_properties_);
+  append(&set_vertex_labels_, &other.set_vertex_labels_);
+  append(&removed_vertex_labels_, &other.removed_vertex_labels_);
+  append(&created_edges_, &other.created_edges_);
+  append(&deleted_edges_, &other.deleted_edges_);
+  append(&set_edge_properties_, &other.set_edge_properties_);
+  append(&removed_edge_properties_, &other.removed_edge_properties_);
+}
+
 TypedValue TriggerContext::GetTypedValue(const TriggerIdentifierTag tag, DbAccessor *dba) const {
   switch (tag) {
     case TriggerIdentifierTag::CREATED_VERTICES:
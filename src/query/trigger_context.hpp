@@ -17,6 +17,7 @@
 #include <string_view>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -194,6 +195,10 @@ class TriggerContext {
   // to the sent DbAccessor so they can be used safely)
   void AdaptForAccessor(DbAccessor *accessor);
 
+  // Appends the changes of a transaction committed after the one this context
+  // was collected for, so the triggers run once for both of them.
+  void Merge(TriggerContext &&other);
+
   // Get TypedValue for the identifier defined with tag
   TypedValue GetTypedValue(TriggerIdentifierTag tag, DbAccessor *dba) const;
   bool ShouldEventTrigger(TriggerEventType) const;
@@ -317,6 +322,24 @@ class TriggerContextCollector {
     RegisterSetObjectProperty(object, key, std::move(old_value), TypedValue());
   }
 
+  /// Returns the objects which were created, deleted or updated, each once.
+  template <detail::ObjectAccessor TAccessor>
+  std::vector<TAccessor> ChangedObjects() const {
+    const auto &registry = GetRegistry<TAccessor>();
+    std::vector<TAccessor> objects;
+    std::unordered_set<storage::Gid> gids;
+    const auto add_object = [&](const TAccessor &object) {
+      if (gids.insert(object.Gid()).second) objects.push_back(object);
+    };
+    for (const auto &[gid, created_object] : registry.created_objects) add_object(created_object.object);
+    for (const auto &deleted_object : registry.deleted_objects) add_object(deleted_object.object);
+    for (const auto &[key, change] : registry.property_changes) add_object(key.first);
+    if constexpr (std::same_as<TAccessor, VertexAccessor>) {
+      for (const auto &[key, change] : label_changes_) add_object(key.first);
+    }
+    return objects;
+  }
+
   bool ShouldRegisterVertexLabelChange() const;
   void RegisterSetVertexLabel(const VertexAccessor &vertex, storage::LabelId label_id);
   void RegisterRemovedVertexLabel(const VertexAccessor &vertex, storage::LabelId label_id);
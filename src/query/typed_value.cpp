@@ -92,6 +92,11 @@ TypedValue::TypedValue(const storage::PropertyValue &value, utils::MemoryResourc
       }
       return;
     }
+    case storage::PropertyValue::Type::Point: {
+      type_ = Type::Point;
+      new (&point_v) storage::Point(value.ValuePoint());
+      return;
+    }
   }
   LOG_FATAL("Unsupported type");
 }
@@ -162,6 +167,11 @@ TypedValue::TypedValue(storage::PropertyValue &&other, utils::MemoryResource *me
       }
       break;
     }
+    case storage::PropertyValue::Type::Point: {
+      type_ = Type::Point;
+      new (&point_v) storage::Point(other.ValuePoint());
+      break;
+    }
   }
 
   other = storage::PropertyValue();
@@ -215,6 +225,9 @@ TypedValue::TypedValue(const TypedValue &other, utils::MemoryResource *memory) :
     case Type::Duration:
       new (&duration_v) utils::Duration(other.duration_v);
       return;
+    case Type::Point:
+      new (&point_v) storage::Point(other.point_v);
+      return;
     case Type::Graph:
       auto *graph_ptr = utils::Allocator<Graph>(memory_).new_object<Graph>(*other.graph_v);
       new (&graph_v) std::unique_ptr<Graph>(graph_ptr);
@@ -309,6 +322,8 @@ TypedValue::operator storage::PropertyValue() const {
           storage::TemporalData{storage::TemporalType::LocalDateTime, local_date_time_v.MicrosecondsSinceEpoch()});
     case Type::Duration:
       return storage::PropertyValue(storage::TemporalData{storage::TemporalType::Duration, duration_v.microseconds});
+    case Type::Point:
+      return storage::PropertyValue(point_v);
     default:
       break;
   }
@@ -343,6 +358,7 @@ DEFINE_VALUE_AND_TYPE_GETTERS(utils::Date, Date, date_v)
 DEFINE_VALUE_AND_TYPE_GETTERS(utils::LocalTime, LocalTime, local_time_v)
 DEFINE_VALUE_AND_TYPE_GETTERS(utils::LocalDateTime, LocalDateTime, local_date_time_v)
 DEFINE_VALUE_AND_TYPE_GETTERS(utils::Duration, Duration, duration_v)
+DEFINE_VALUE_AND_TYPE_GETTERS(storage::Point, Point, point_v)
 
 Graph &TypedValue::ValueGraph() {
   if (type_ != Type::Graph) {
@@ -379,6 +395,7 @@ bool TypedValue::IsPropertyValue() const {
     case Type::LocalTime:
     case Type::LocalDateTime:
     case Type::Duration:
+    case Type::Point:
       return true;
     default:
       return false;
@@ -415,6 +432,8 @@ std::ostream &operator<<(std::ostream &os, const TypedValue::Type &type) {
       return os << "local_date_time";
     case TypedValue::Type::Duration:
       return os << "duration";
+    case TypedValue::Type::Point:
+      return os << "point";
     case TypedValue::Type::Graph:
       return os << "graph";
   }
@@ -469,6 +488,7 @@ DEFINE_TYPED_VALUE_COPY_ASSIGNMENT(const utils::Date &, Date, date_v)
 DEFINE_TYPED_VALUE_COPY_ASSIGNMENT(const utils::LocalTime &, LocalTime, local_time_v)
 DEFINE_TYPED_VALUE_COPY_ASSIGNMENT(const utils::LocalDateTime &, LocalDateTime, local_date_time_v)
 DEFINE_TYPED_VALUE_COPY_ASSIGNMENT(const utils::Duration &, Duration, duration_v)
+DEFINE_TYPED_VALUE_COPY_ASSIGNMENT(const storage::Point &, Point, point_v)
 
 #undef DEFINE_TYPED_VALUE_COPY_ASSIGNMENT
 
@@ -520,6 +540,7 @@ TypedValue &TypedValue::operator=(const TypedValue &other) {
     // from `this`.
     static_assert(!std::allocator_traits<utils::Allocator<TypedValue>>::propagate_on_container_copy_assignment::value,
                   "Allocator propagation not implemented");
+    if (AssignInPlace(other)) return *this;
     DestroyValue();
     type_ = other.type_;
     switch (other.type_) {
@@ -569,6 +590,9 @@ TypedValue &TypedValue::operator=(const TypedValue &other) {
       case Type::Duration:
         new (&duration_v) utils::Duration(other.duration_v);
         return *this;
+      case Type::Point:
+        new (&point_v) storage::Point(other.point_v);
+        return *this;
     }
     LOG_FATAL("Unsupported TypedValue::Type");
   }
@@ -577,7 +601,6 @@ TypedValue &TypedValue::operator=(const TypedValue &other) {
 
 TypedValue &TypedValue::operator=(TypedValue &&other) noexcept(false) {
   if (this != &other) {
-    DestroyValue();
     // NOTE: STL uses
     // std::allocator_traits<>::propagate_on_container_move_assignment to
     // determine whether to take the allocator from `other`, or use the one in
@@ -585,6 +608,11 @@ TypedValue &TypedValue::operator=(TypedValue &&other) noexcept(false) {
     // from `this`.
     static_assert(!std::allocator_traits<utils::Allocator<TypedValue>>::propagate_on_container_move_assignment::value,
                   "Allocator propagation not implemented");
+    if (AssignInPlace(std::move(other))) {
+      other.DestroyValue();
+      return *this;
+    }
+    DestroyValue();
     type_ = other.type_;
     switch (other.type_) {
       case TypedValue::Type::Null:
@@ -628,6 +656,9 @@ TypedValue &TypedValue::operator=(TypedValue &&other) noexcept(false) {
       case Type::Duration:
         new (&duration_v) utils::Duration(other.duration_v);
         break;
+      case Type::Point:
+        new (&point_v) storage::Point(other.point_v);
+        break;
       case Type::Graph:
         if (other.GetMemoryResource() == memory_) {
           new (&graph_v) std::unique_ptr<Graph>(std::move(other.graph_v));
@@ -642,6 +673,27 @@ TypedValue &TypedValue::operator=(TypedValue &&other) noexcept(false) {
   return *this;
 }
 
+template <class TOther>
+bool TypedValue::AssignInPlace(TOther &&other) {
+  if (type_ != other.type_) return false;
+  // Assigning the containers keeps the memory they already own, so copying a
+  // string or a list into a frame slot which held a value of the same type
+  // usually doesn't allocate.
+  switch (type_) {
+    case Type::String:
+      string_v = std::forward<TOther>(other).string_v;
+      return true;
+    case Type::List:
+      list_v = std::forward<TOther>(other).list_v;
+      return true;
+    case Type::Map:
+      map_v = std::forward<TOther>(other).map_v;
+      return true;
+    default:
+      return false;
+  }
+}
+
 void TypedValue::DestroyValue() {
   switch (type_) {
       // destructor for primitive types does nothing
@@ -675,6 +727,7 @@ void TypedValue::DestroyValue() {
     case Type::LocalTime:
     case Type::LocalDateTime:
     case Type::Duration:
+    case Type::Point:
       break;
     case Type::Graph: {
       auto *graph = graph_v.release();
@@ -843,6 +896,8 @@ TypedValue operator==(const TypedValue &a, const TypedValue &b) {
       return TypedValue(a.ValueLocalDateTime() == b.ValueLocalDateTime(), a.GetMemoryResource());
     case TypedValue::Type::Duration:
       return TypedValue(a.ValueDuration() == b.ValueDuration(), a.GetMemoryResource());
+    case TypedValue::Type::Point:
+      return TypedValue(a.ValuePoint() == b.ValuePoint(), a.GetMemoryResource());
     case TypedValue::Type::Graph:
       throw TypedValueException("Unsupported comparison operator");
     default:
@@ -1153,6 +1208,10 @@ size_t TypedValue::Hash::operator()(const TypedValue &value) const {
     case TypedValue::Type::Duration:
       return utils::DurationHash{}(value.ValueDuration());
       break;
+    case TypedValue::Type::Point: {
+      const auto &point = value.ValuePoint();
+      return utils::HashCombine<double, double>{}(point.x, point.y) ^ std::hash<double>{}(point.z);
+    }
     case TypedValue::Type::Graph:
       throw TypedValueException("Unsupported hash function for Graph");
   }
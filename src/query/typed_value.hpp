@@ -23,6 +23,7 @@
 #include "query/db_accessor.hpp"
 #include "query/graph.hpp"
 #include "query/path.hpp"
+#include "storage/v2/point.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/memory.hpp"
 #include "utils/pmr/map.hpp"
@@ -84,6 +85,7 @@ class TypedValue {
     LocalTime,
     LocalDateTime,
     Duration,
+    Point,
     Graph
   };
 
@@ -173,6 +175,11 @@ class TypedValue {
     duration_v = value;
   }
 
+  explicit TypedValue(const storage::Point &value, utils::MemoryResource *memory = utils::NewDeleteResource())
+      : memory_(memory), type_(Type::Point) {
+    new (&point_v) storage::Point(value);
+  }
+
   // conversion function to storage::PropertyValue
   explicit operator storage::PropertyValue() const;
 
@@ -451,6 +458,7 @@ class TypedValue {
   TypedValue &operator=(const utils::LocalTime &);
   TypedValue &operator=(const utils::LocalDateTime &);
   TypedValue &operator=(const utils::Duration &);
+  TypedValue &operator=(const storage::Point &);
 
   /** Copy assign other, utils::MemoryResource of `this` is used */
   TypedValue &operator=(const TypedValue &other);
@@ -505,6 +513,7 @@ class TypedValue {
   DECLARE_VALUE_AND_TYPE_GETTERS(utils::LocalTime, LocalTime)
   DECLARE_VALUE_AND_TYPE_GETTERS(utils::LocalDateTime, LocalDateTime)
   DECLARE_VALUE_AND_TYPE_GETTERS(utils::Duration, Duration)
+  DECLARE_VALUE_AND_TYPE_GETTERS(storage::Point, Point)
   DECLARE_VALUE_AND_TYPE_GETTERS(Graph, Graph)
 
 #undef DECLARE_VALUE_AND_TYPE_GETTERS
@@ -523,6 +532,11 @@ class TypedValue {
   utils::MemoryResource *GetMemoryResource() const { return memory_; }
 
  private:
+  // Assigns a string, a list or a map to the container of the same type held
+  // by `this`. Returns false if the value has to be constructed instead.
+  template <class TOther>
+  bool AssignInPlace(TOther &&other);
+
   void DestroyValue();
 
   // Memory resource for allocations of non primitive values
@@ -548,6 +562,7 @@ class TypedValue {
     utils::LocalTime local_time_v;
     utils::LocalDateTime local_date_time_v;
     utils::Duration duration_v;
+    storage::Point point_v;
     // As the unique_ptr is not allocator aware, it requires special attention when copying or moving graphs
     std::unique_ptr<Graph> graph_v;
   };
@@ -17,11 +17,23 @@ Client::Client(io::network::Endpoint endpoint, communication::ClientContext *con
     : endpoint_(std::move(endpoint)), context_(context) {}
 
 void Client::Abort() {
-  if (!client_) return;
+  auto connection = GetConnection();
+  if (!connection) return;
   // We need to call Shutdown on the client to abort any pending read or
   // write operations.
-  client_->Shutdown();
-  client_ = std::nullopt;
+  connection->failed = true;
+  connection->client.Shutdown();
+  connection->response_cv.notify_all();
+}
+
+std::shared_ptr<Client::Connection> Client::GetConnection() {
+  std::lock_guard guard(connection_lock_);
+  return connection_;
+}
+
+void Client::SetConnection(std::shared_ptr<Connection> connection) {
+  std::lock_guard guard(connection_lock_);
+  connection_ = std::move(connection);
 }
 
 }  // namespace memgraph::rpc
@@ -11,9 +11,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 
 #include "communication/client.hpp"
 #include "io/network/endpoint.hpp"
@@ -23,12 +27,38 @@
 #include "slk/streams.hpp"
 #include "utils/logging.hpp"
 #include "utils/on_scope_exit.hpp"
+#include "utils/spin_lock.hpp"
 #include "utils/typeinfo.hpp"
 
 namespace memgraph::rpc {
 
 /// Client is thread safe, but it is recommended to use thread_local clients.
+///
+/// Requests are pipelined over a single connection: a request can be sent
+/// while the earlier requests still await their responses. The server handles
+/// the requests of a connection in order, so responses are matched to requests
+/// by their position on the connection. An SSL connection can't be read and
+/// written at the same time, so over SSL a request is sent only after the
+/// response to the previous one is received.
 class Client {
+ private:
+  /// Connection to the server with the state of its pipelined requests.
+  struct Connection {
+    explicit Connection(communication::ClientContext *context) : client(context) {}
+
+    communication::Client client;
+    // Position of the next sent request, guarded by `Client::mutex_`.
+    uint64_t next_request{0};
+    std::mutex response_mutex;
+    std::condition_variable response_cv;
+    // Position of the request whose response is read next, guarded by
+    // `response_mutex`.
+    uint64_t next_response{0};
+    // Set when the connection can't be used anymore, requests still awaiting
+    // their responses fail and the next request reconnects.
+    std::atomic<bool> failed{false};
+  };
+
  public:
   Client(io::network::Endpoint endpoint, communication::ClientContext *context);
 
@@ -38,13 +68,35 @@ class Client {
    private:
     friend class Client;
 
-    StreamHandler(Client *self, std::unique_lock<std::mutex> &&guard,
+    StreamHandler(Client *self, std::shared_ptr<Connection> connection, std::unique_lock<std::mutex> &&guard,
                   std::function<typename TRequestResponse::Response(slk::Reader *)> res_load)
         : self_(self),
+          connection_(connection),
           guard_(std::move(guard)),
-          req_builder_([self](const uint8_t *data, size_t size, bool have_more) {
-            if (!self->client_->Write(data, size, have_more)) throw RpcFailedException(self->endpoint_);
-          }),
+          req_builder_(
+              [self, connection = connection.get()](const uint8_t *data, size_t size, bool have_more) {
+                if (!connection->client.Write(data, size, have_more)) {
+                  connection->failed = true;
+                  throw RpcFailedException(self->endpoint_);
+                }
+                self->sent_bytes_.fetch_add(size, std::memory_order_relaxed);
+              },
+              [self, connection = connection.get()](std::span<const iovec> parts, bool have_more) {
+                if (!connection->client.Write(parts, have_more)) {
+                  connection->failed = true;
+                  throw RpcFailedException(self->endpoint_);
+                }
+                for (const auto &part : parts) {
+                  self->sent_bytes_.fetch_add(part.iov_len, std::memory_order_relaxed);
+                }
+              },
+              [self, connection = connection.get()](int fd, uint64_t offset, size_t size, bool have_more) {
+                if (!connection->client.SendFile(fd, offset, size, have_more)) {
+                  connection->failed = true;
+                  throw RpcFailedException(self->endpoint_);
+                }
+                self->sent_bytes_.fetch_add(size, std::memory_order_relaxed);
+              }),
           res_load_(res_load) {}
 
    public:
@@ -54,7 +106,11 @@ class Client {
     StreamHandler(const StreamHandler &) = delete;
     StreamHandler &operator=(const StreamHandler &) = delete;
 
-    ~StreamHandler() {}
+    ~StreamHandler() {
+      // A partially sent request would be followed by the next request, the
+      // connection can't be used anymore.
+      if (connection_ && !sent_) connection_->failed = true;
+    }
 
     slk::Builder *GetBuilder() { return &req_builder_; }
 
@@ -63,16 +119,42 @@ class Client {
 
       // Finalize the request.
       req_builder_.Finalize();
+      sent_ = true;
+
+      // Take the position of the request and let the next requests be sent
+      // while the response is awaited.
+      const auto position = connection_->next_request++;
+      if (!self_->context_->use_ssl()) guard_.unlock();
+
+      // Wait for the responses to the earlier requests to be read.
+      {
+        std::unique_lock response_guard(connection_->response_mutex);
+        connection_->response_cv.wait(response_guard,
+                                      [&] { return connection_->next_response == position || connection_->failed; });
+      }
+      utils::OnScopeExit next_response([this] {
+        {
+          std::lock_guard response_guard(connection_->response_mutex);
+          ++connection_->next_response;
+        }
+        connection_->response_cv.notify_all();
+      });
+      if (connection_->failed) throw RpcFailedException(self_->endpoint_);
+      utils::OnScopeExit on_failure([this] {
+        if (std::uncaught_exceptions() > 0) connection_->failed = true;
+      });
+
+      auto &client = connection_->client;
 
       // Receive the response.
       uint64_t response_data_size = 0;
       while (true) {
-        auto ret = slk::CheckStreamComplete(self_->client_->GetData(), self_->client_->GetDataSize());
+        auto ret = slk::CheckStreamComplete(client.GetData(), client.GetDataSize());
         if (ret.status == slk::StreamStatus::INVALID) {
           throw RpcFailedException(self_->endpoint_);
         } else if (ret.status == slk::StreamStatus::PARTIAL) {
-          if (!self_->client_->Read(ret.stream_size - self_->client_->GetDataSize(),
-                                    /* exactly_len = */ false)) {
+          if (!client.Read(ret.stream_size - client.GetDataSize(),
+                           /* exactly_len = */ false)) {
             throw RpcFailedException(self_->endpoint_);
           }
         } else {
@@ -82,8 +164,8 @@ class Client {
       }
 
       // Load the response.
-      slk::Reader res_reader(self_->client_->GetData(), response_data_size);
-      utils::OnScopeExit res_cleanup([&, response_data_size] { self_->client_->ShiftData(response_data_size); });
+      slk::Reader res_reader(client.GetData(), response_data_size);
+      utils::OnScopeExit res_cleanup([&, response_data_size] { client.ShiftData(response_data_size); });
 
       utils::TypeId res_id{utils::TypeId::UNKNOWN};
       slk::Load(&res_id, &res_reader);
@@ -91,7 +173,6 @@ class Client {
       // Check the response ID.
       if (res_id != res_type.id && res_id != utils::TypeId::UNKNOWN) {
         spdlog::error("Message response was of unexpected type");
-        self_->client_ = std::nullopt;
         throw RpcFailedException(self_->endpoint_);
       }
 
@@ -102,13 +183,16 @@ class Client {
 
    private:
     Client *self_;
+    std::shared_ptr<Connection> connection_;
     std::unique_lock<std::mutex> guard_;
     slk::Builder req_builder_;
     std::function<typename TRequestResponse::Response(slk::Reader *)> res_load_;
+    bool sent_{false};
   };
 
   /// Stream a previously defined and registered RPC call. This function can
-  /// initiate only one request at a time. The call returns a `StreamHandler`
+  /// initiate only one request at a time, but the responses to the earlier
+  /// requests don't have to be received yet. The call returns a `StreamHandler`
   /// object that can be used to send additional data to the request (with the
   /// automatically sent `TRequestResponse::Request` object) and await until the
   /// response is received from the server.
@@ -142,23 +226,26 @@ class Client {
     std::unique_lock<std::mutex> guard(mutex_);
 
     // Check if the connection is broken (if we haven't used the client for a
-    // long time the server could have died).
-    if (client_ && client_->ErrorStatus()) {
-      client_ = std::nullopt;
+    // long time the server could have died). The requests still awaiting
+    // responses on a broken connection keep it alive until they fail.
+    auto connection = GetConnection();
+    if (connection && (connection->failed || connection->client.ErrorStatus())) {
+      connection = nullptr;
     }
 
     // Connect to the remote server.
-    if (!client_) {
-      client_.emplace(context_);
-      if (!client_->Connect(endpoint_)) {
+    if (!connection) {
+      connection = std::make_shared<Connection>(context_);
+      if (!connection->client.Connect(endpoint_)) {
         SPDLOG_ERROR("Couldn't connect to remote address {}", endpoint_);
-        client_ = std::nullopt;
+        SetConnection(nullptr);
         throw RpcFailedException(endpoint_);
       }
+      SetConnection(connection);
     }
 
     // Create the stream handler.
-    StreamHandler<TRequestResponse> handler(this, std::move(guard), load);
+    StreamHandler<TRequestResponse> handler(this, std::move(connection), std::move(guard), load);
 
     // Build and send the request.
     slk::Save(req_type.id, handler.GetBuilder());
@@ -191,17 +278,28 @@ class Client {
     return stream.AwaitResponse();
   }
 
-  /// Call this function from another thread to abort a pending RPC call.
+  /// Call this function from another thread to abort the pending RPC calls.
   void Abort();
 
   auto Endpoint() const -> io::network::Endpoint const & { return endpoint_; }
 
+  /// Number of bytes of the requests sent so far, over all connections.
+  uint64_t SentBytes() const { return sent_bytes_.load(std::memory_order_relaxed); }
+
  private:
+  std::shared_ptr<Connection> GetConnection();
+  void SetConnection(std::shared_ptr<Connection> connection);
+
   io::network::Endpoint endpoint_;
   communication::ClientContext *context_;
-  std::optional<communication::Client> client_;
+  // Guarded by `connection_lock_` because `Abort` doesn't hold `mutex_`.
+  std::shared_ptr<Connection> connection_;
+  utils::SpinLock connection_lock_;
 
+  // Held while a request is sent.
   std::mutex mutex_;
+
+  std::atomic<uint64_t> sent_bytes_{0};
 };
 
 }  // namespace memgraph::rpc
@@ -25,19 +25,27 @@ Session::Session(Server *server, const io::network::Endpoint &endpoint, communic
     : server_(server), endpoint_(endpoint), input_stream_(input_stream), output_stream_(output_stream) {}
 
 void Session::Execute() {
+  // Clients pipeline their requests, so the received data can hold several
+  // requests. They are executed in order, the responses are matched to the
+  // requests by their order.
+  while (input_stream_->size() > 0 && ExecuteRequest()) {
+  }
+}
+
+bool Session::ExecuteRequest() {
   auto ret = slk::CheckStreamComplete(input_stream_->data(), input_stream_->size());
   if (ret.status == slk::StreamStatus::INVALID) {
     throw SessionException("Received an invalid SLK stream!");
   } else if (ret.status == slk::StreamStatus::PARTIAL) {
     input_stream_->Resize(ret.stream_size);
-    return;
+    return false;
   }
 
   // Remove the data from the stream on scope exit.
   utils::OnScopeExit shift_data([&, ret] { input_stream_->Shift(ret.stream_size); });
 
   // Prepare SLK reader and builder.
-  slk::Reader req_reader(input_stream_->data(), input_stream_->size());
+  slk::Reader req_reader(input_stream_->data(), ret.stream_size);
   slk::Builder res_builder(
       [&](const uint8_t *data, size_t size, bool have_more) { output_stream_->Write(data, size, have_more); });
 
@@ -75,6 +83,7 @@ void Session::Execute() {
 
   SPDLOG_TRACE("[RpcServer] sent {}",
                (it != server_->callbacks_.end() ? it->second.res_type.name : extended_it->second.res_type.name));
+  return true;
 }
 
 }  // namespace memgraph::rpc
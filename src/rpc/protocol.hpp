@@ -58,6 +58,12 @@ class Session {
   void Execute();
 
  private:
+  /**
+   * Executes the next request if it was fully received and returns whether it
+   * was executed.
+   */
+  bool ExecuteRequest();
+
   Server *server_;
   io::network::Endpoint endpoint_;
   communication::InputStream *input_stream_;
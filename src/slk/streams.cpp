@@ -11,6 +11,10 @@
 
 #include "slk/streams.hpp"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 #include "utils/logging.hpp"
@@ -19,7 +23,16 @@ namespace memgraph::slk {
 
 Builder::Builder(std::function<void(const uint8_t *, size_t, bool)> write_func) : write_func_(write_func) {}
 
+Builder::Builder(std::function<void(const uint8_t *, size_t, bool)> write_func,
+                 std::function<void(std::span<const iovec>, bool)> gather_write_func,
+                 std::function<void(int, uint64_t, size_t, bool)> send_file_func)
+    : write_func_(write_func), gather_write_func_(gather_write_func), send_file_func_(send_file_func) {}
+
 void Builder::Save(const uint8_t *data, uint64_t size) {
+  if (gather_write_func_ && size >= kSegmentMaxDataSize) {
+    SaveInPlace(data, size);
+    return;
+  }
   size_t offset = 0;
   while (size > 0) {
     FlushSegment(false);
@@ -38,10 +51,69 @@ void Builder::Save(const uint8_t *data, uint64_t size) {
   }
 }
 
-void Builder::Finalize() { FlushSegment(true); }
+void Builder::SaveInPlace(const uint8_t *data, uint64_t size) {
+  // The data saved so far is sent as a shorter segment.
+  if (pos_ > 0) FlushSegment(false, true);
+
+  // A gathered write sends up to 16 MiB.
+  constexpr size_t kMaxSegmentsPerWrite = 64;
+  std::array<SegmentSize, kMaxSegmentsPerWrite> sizes{};
+  std::array<iovec, 2 * kMaxSegmentsPerWrite> parts{};
+  while (size > 0) {
+    size_t count = 0;
+    for (; size > 0 && count < kMaxSegmentsPerWrite; ++count) {
+      const auto segment_size = std::min(size, kSegmentMaxDataSize);
+      sizes[count] = segment_size;
+      parts[2 * count] = {&sizes[count], sizeof(SegmentSize)};
+      parts[2 * count + 1] = {const_cast<uint8_t *>(data), segment_size};
+      data += segment_size;
+      size -= segment_size;
+    }
+    gather_write_func_({parts.data(), 2 * count}, true);
+  }
+  written_ = true;
+}
+
+void Builder::SaveFile(int fd, uint64_t offset, uint64_t size) {
+  if (!send_file_func_) {
+    while (size > 0) {
+      FlushSegment(false);
+      const auto to_read = std::min(size, kSegmentMaxDataSize - pos_);
+      auto read = pread(fd, segment_ + sizeof(SegmentSize) + pos_, to_read, static_cast<off_t>(offset));
+      if (read == -1 && errno == EINTR) continue;
+      MG_ASSERT(read > 0, "Couldn't read the file data!");
+      pos_ += read;
+      offset += read;
+      size -= read;
+    }
+    return;
+  }
+
+  // The data saved so far is sent as a shorter segment.
+  if (pos_ > 0) FlushSegment(false, true);
+  while (size > 0) {
+    SegmentSize segment_size = std::min(size, kSegmentMaxDataSize);
+    write_func_(reinterpret_cast<const uint8_t *>(&segment_size), sizeof(SegmentSize), true);
+    send_file_func_(fd, offset, segment_size, true);
+    offset += segment_size;
+    size -= segment_size;
+    written_ = true;
+  }
+}
+
+void Builder::Finalize() {
+  if (pos_ == 0 && written_) {
+    // All data was saved in place or sent from a file, only the footer is
+    // left.
+    SegmentSize footer = 0;
+    write_func_(reinterpret_cast<const uint8_t *>(&footer), sizeof(SegmentSize), false);
+    return;
+  }
+  FlushSegment(true);
+}
 
-void Builder::FlushSegment(bool final_segment) {
-  if (!final_segment && pos_ < kSegmentMaxDataSize) return;
+void Builder::FlushSegment(bool final_segment, bool force) {
+  if (!final_segment && !force && pos_ < kSegmentMaxDataSize) return;
   MG_ASSERT(pos_ > 0, "Trying to flush out a segment that has no data in it!");
 
   size_t total_size = sizeof(SegmentSize) + pos_;
@@ -58,6 +130,7 @@ void Builder::FlushSegment(bool final_segment) {
   write_func_(segment_, total_size, !final_segment);
 
   pos_ = 0;
+  written_ = true;
 }
 
 Reader::Reader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
@@ -78,6 +151,16 @@ void Reader::Load(uint8_t *data, uint64_t size) {
   }
 }
 
+std::string_view Reader::LoadView(uint64_t size) {
+  if (size == 0) return {};
+  GetSegment();
+  const auto to_read = std::min<uint64_t>(size, have_);
+  std::string_view view(reinterpret_cast<const char *>(data_ + pos_), to_read);
+  pos_ += to_read;
+  have_ -= to_read;
+  return view;
+}
+
 void Reader::Finalize() { GetSegment(true); }
 
 void Reader::GetSegment(bool should_be_final) {
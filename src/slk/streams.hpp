@@ -11,9 +11,13 @@
 
 #pragma once
 
+#include <sys/uio.h>
+
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <span>
+#include <string_view>
 
 #include "utils/exceptions.hpp"
 
@@ -48,16 +52,38 @@ class Builder {
  public:
   Builder(std::function<void(const uint8_t *, size_t, bool)> write_func);
 
+  /// With `gather_write_func` large `Save` calls don't copy the data into the
+  /// segment buffer. The data is split into segments in place and
+  /// `gather_write_func` writes their size fields and data with a single
+  /// gathered write, so the data must only stay valid during the call.
+  /// With `send_file_func` the data of `SaveFile` calls is written by
+  /// `send_file_func(fd, offset, size, have_more)` between the size fields of
+  /// the segments.
+  Builder(std::function<void(const uint8_t *, size_t, bool)> write_func,
+          std::function<void(std::span<const iovec>, bool)> gather_write_func,
+          std::function<void(int, uint64_t, size_t, bool)> send_file_func = {});
+
   /// Function used internally by SLK to serialize the data.
   void Save(const uint8_t *data, uint64_t size);
 
+  /// Saves `size` bytes of the file `fd` starting at `offset`. Without a
+  /// `send_file_func` the data is read straight into the segment buffer.
+  void SaveFile(int fd, uint64_t offset, uint64_t size);
+
   /// Function that should be called after all `slk::Save` operations are done.
   void Finalize();
 
  private:
-  void FlushSegment(bool final_segment);
+  void SaveInPlace(const uint8_t *data, uint64_t size);
+
+  void FlushSegment(bool final_segment, bool force = false);
 
   std::function<void(const uint8_t *, size_t, bool)> write_func_;
+  std::function<void(std::span<const iovec>, bool)> gather_write_func_;
+  std::function<void(int, uint64_t, size_t, bool)> send_file_func_;
+  // Set once a segment is written, the stream may then end with just the
+  // footer.
+  bool written_{false};
   size_t pos_{0};
   uint8_t segment_[kSegmentMaxTotalSize];
 };
@@ -77,6 +103,11 @@ class Reader {
   /// Function used internally by SLK to deserialize the data.
   void Load(uint8_t *data, uint64_t size);
 
+  /// Returns a view of at most `size` bytes of the next data without copying
+  /// them. The view ends with the current segment, so it can be shorter than
+  /// `size`. It is valid as long as the data passed to the reader.
+  std::string_view LoadView(uint64_t size);
+
   /// Function that should be called after all `slk::Load` operations are done.
   void Finalize();
 
@@ -0,0 +1,50 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <cstdint>
+
+namespace memgraph::storage {
+
+/// Counts of the storage work done by a thread. They only grow, so the work
+/// done during an interval, e.g. a pull of a query operator when profiling, is
+/// the difference of the counts at its end and at its start. The counters are
+/// plain thread-local integers, so counting costs next to nothing.
+struct AccessCounters {
+  /// Vertices for which an accessor was made because they are visible.
+  uint64_t vertices_touched{0};
+  /// Edges of the vertices whose edges were read.
+  uint64_t edges_touched{0};
+  /// Deltas applied to read older versions of objects.
+  uint64_t delta_steps{0};
+  /// Lookups in the label, label-property, edge-type, text and vector indices.
+  uint64_t index_seeks{0};
+
+  AccessCounters &operator+=(const AccessCounters &other) {
+    vertices_touched += other.vertices_touched;
+    edges_touched += other.edges_touched;
+    delta_steps += other.delta_steps;
+    index_seeks += other.index_seeks;
+    return *this;
+  }
+
+  AccessCounters operator-(const AccessCounters &other) const {
+    return {vertices_touched - other.vertices_touched, edges_touched - other.edges_touched,
+            delta_steps - other.delta_steps, index_seeks - other.index_seeks};
+  }
+};
+
+/// The counters of the current thread.
+inline thread_local AccessCounters access_counters;
+
+}  // namespace memgraph::storage
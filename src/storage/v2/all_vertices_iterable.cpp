@@ -14,10 +14,12 @@
 namespace memgraph::storage {
 
 auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipList<Vertex>::Iterator end,
-                            std::optional<VertexAccessor> *vertex, Transaction *tx, View view, Indices *indices,
-                            Constraints *constraints, Config::Items config) {
+                            const std::optional<Gid> &chunk_end, std::optional<VertexAccessor> *vertex, Transaction *tx,
+                            View view, Indices *indices, Constraints *constraints, Config::Items config,
+                            const VertexFilter *filter) {
   while (it != end) {
-    if (not VertexAccessor::IsVisible(&*it, tx, view)) {
+    if (chunk_end && it->gid >= *chunk_end) return end;
+    if (filter ? !filter->Matches(*it, tx, view) : !VertexAccessor::IsVisible(&*it, tx, view)) {
       ++it;
       continue;
     }
@@ -29,15 +31,17 @@ auto AdvanceToVisibleVertex(utils::SkipList<Vertex>::Iterator it, utils::SkipLis
 
 AllVerticesIterable::Iterator::Iterator(AllVerticesIterable *self, utils::SkipList<Vertex>::Iterator it)
     : self_(self),
-      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), &self->vertex_, self->transaction_, self->view_,
-                                 self->indices_, self_->constraints_, self->config_)) {}
+      it_(AdvanceToVisibleVertex(it, self->vertices_accessor_.end(), self->chunk_end_, &self->vertex_,
+                                 self->transaction_, self->view_, self->indices_, self_->constraints_, self->config_,
+                                 self->filter_)) {}
 
 VertexAccessor const &AllVerticesIterable::Iterator::operator*() const { return *self_->vertex_; }
 
 AllVerticesIterable::Iterator &AllVerticesIterable::Iterator::operator++() {
   ++it_;
-  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), &self_->vertex_, self_->transaction_, self_->view_,
-                               self_->indices_, self_->constraints_, self_->config_);
+  it_ = AdvanceToVisibleVertex(it_, self_->vertices_accessor_.end(), self_->chunk_end_, &self_->vertex_,
+                               self_->transaction_, self_->view_, self_->indices_, self_->constraints_, self_->config_,
+                               self_->filter_);
   return *this;
 }
 
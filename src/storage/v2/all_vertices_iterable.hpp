@@ -12,6 +12,7 @@
 #pragma once
 
 #include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertex_filter.hpp"
 #include "utils/skip_list.hpp"
 
 namespace memgraph::storage {
@@ -23,7 +24,10 @@ class AllVerticesIterable final {
   Indices *indices_;
   Constraints *constraints_;
   Config::Items config_;
+  std::optional<utils::SkipList<Vertex>::Iterator> chunk_begin_;
+  std::optional<Gid> chunk_end_;
   std::optional<VertexAccessor> vertex_;
+  const VertexFilter *filter_{nullptr};
 
  public:
   class Iterator final {
@@ -51,7 +55,25 @@ class AllVerticesIterable final {
         constraints_(constraints),
         config_(config) {}
 
-  Iterator begin() { return {this, vertices_accessor_.begin()}; }
+  /// Iterates only the chunk of the vertices which starts at `chunk_begin` and
+  /// ends before the vertex with `chunk_end`, or at the end if it isn't set.
+  AllVerticesIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, utils::SkipList<Vertex>::Iterator chunk_begin,
+                      std::optional<Gid> chunk_end, Transaction *transaction, View view, Indices *indices,
+                      Constraints *constraints, Config::Items config)
+      : vertices_accessor_(std::move(vertices_accessor)),
+        transaction_(transaction),
+        view_(view),
+        indices_(indices),
+        constraints_(constraints),
+        config_(config),
+        chunk_begin_(chunk_begin),
+        chunk_end_(chunk_end) {}
+
+  /// Skips the vertices which don't match the `filter`, which has to outlive
+  /// the iteration.
+  void SetFilter(const VertexFilter *filter) { filter_ = filter; }
+
+  Iterator begin() { return {this, chunk_begin_ ? *chunk_begin_ : vertices_accessor_.begin()}; }
   Iterator end() { return {this, vertices_accessor_.end()}; }
 };
 
@@ -0,0 +1,135 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/commit_changes.hpp"
+
+#include <algorithm>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "storage/v2/delta.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+struct EdgeState {
+  CommitChanges::Edge edge;
+  bool existed_before{false};
+  bool exists_now{false};
+};
+
+// Calls `func` with the deltas of the transaction in the version chain starting
+// at `head`, from the newest to the oldest one. The oldest delta of each change
+// holds the state from before the transaction.
+template <typename TFunc>
+void ForEachOwnDelta(const Transaction &transaction, const Delta *head, const TFunc &func) {
+  for (const auto *delta = head; delta != nullptr && delta->timestamp == transaction.commit_timestamp.get();
+       delta = delta->next.load(std::memory_order_acquire)) {
+    func(*delta);
+  }
+}
+
+void AddPropertyChanges(const absl::flat_hash_map<PropertyId, const PropertyValue *> &old_values,
+                        const PropertyStore &properties, Gid object, std::vector<CommitChanges::Property> *changes) {
+  for (const auto &[property, old_value] : old_values) {
+    auto new_value = properties.GetProperty(property);
+    if (*old_value == new_value) continue;
+    changes->push_back({.object = object, .property = property, .old_value = *old_value, .new_value = new_value});
+  }
+}
+
+void CollectVertexChanges(const Transaction &transaction, const Vertex &vertex, const Delta *head,
+                          const Config::Items &items, CommitChanges *changes) {
+  bool created = false;
+  absl::flat_hash_map<LabelId, bool> had_labels;
+  absl::flat_hash_map<PropertyId, const PropertyValue *> old_values;
+  absl::flat_hash_map<Gid, EdgeState> out_edges;
+  ForEachOwnDelta(transaction, head, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::DELETE_OBJECT:
+        created = true;
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+        had_labels[delta.label] = delta.action == Delta::Action::ADD_LABEL;
+        break;
+      case Delta::Action::SET_PROPERTY:
+        old_values[delta.property.key] = &delta.property.value;
+        break;
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE: {
+        const auto gid = items.PropertiesOnEdges(delta.vertex_edge.edge_type) ? delta.vertex_edge.edge.ptr->gid
+                                                                              : delta.vertex_edge.edge.gid;
+        auto [it, inserted] = out_edges.try_emplace(
+            gid, EdgeState{.edge = {.gid = gid,
+                                    .from_vertex = vertex.gid,
+                                    .to_vertex = delta.vertex_edge.vertex->gid,
+                                    .edge_type = delta.vertex_edge.edge_type}});
+        // The newest delta undoes the last change of the edge.
+        if (inserted) it->second.exists_now = delta.action == Delta::Action::REMOVE_OUT_EDGE;
+        it->second.existed_before = delta.action == Delta::Action::ADD_OUT_EDGE;
+        break;
+      }
+      default:
+        break;
+    }
+  });
+
+  for (const auto &[gid, state] : out_edges) {
+    if (state.existed_before && !state.exists_now) changes->deleted_edges.push_back(state.edge);
+    if (!state.existed_before && state.exists_now) changes->created_edges.push_back(state.edge);
+  }
+  if (vertex.deleted) {
+    if (!created) changes->deleted_vertices.push_back(vertex.gid);
+    return;
+  }
+  if (created) changes->created_vertices.push_back(vertex.gid);
+  for (const auto &[label, had_label] : had_labels) {
+    const bool has_label = std::find(vertex.labels.begin(), vertex.labels.end(), label) != vertex.labels.end();
+    if (had_label == has_label) continue;
+    (has_label ? changes->set_labels : changes->removed_labels).push_back({.vertex = vertex.gid, .label = label});
+  }
+  AddPropertyChanges(old_values, vertex.properties, vertex.gid, &changes->vertex_properties);
+}
+
+void CollectEdgeChanges(const Transaction &transaction, const Edge &edge, const Delta *head,
+                        CommitChanges *changes) {
+  // Creations and deletions of edges are collected from their start vertices.
+  if (edge.deleted) return;
+  absl::flat_hash_map<PropertyId, const PropertyValue *> old_values;
+  ForEachOwnDelta(transaction, head, [&](const Delta &delta) {
+    if (delta.action == Delta::Action::SET_PROPERTY) old_values[delta.property.key] = &delta.property.value;
+  });
+  AddPropertyChanges(old_values, edge.properties, edge.gid, &changes->edge_properties);
+}
+
+}  // namespace
+
+CommitChanges CollectCommitChanges(const Transaction &transaction, const Config::Items &items) {
+  CommitChanges changes;
+  // Each changed object has a single delta of the transaction which is the
+  // head of its version chain.
+  for (const auto &delta : transaction.deltas.use()) {
+    auto prev = delta.prev.Get();
+    if (prev.type == PreviousPtr::Type::VERTEX) {
+      CollectVertexChanges(transaction, *prev.vertex, &delta, items, &changes);
+    } else if (prev.type == PreviousPtr::Type::EDGE) {
+      CollectEdgeChanges(transaction, *prev.edge, &delta, &changes);
+    }
+  }
+  return changes;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,71 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+
+namespace memgraph::storage {
+
+struct Transaction;
+
+/// Net changes of a committed transaction. An object created and deleted by
+/// the same transaction doesn't appear in them, and neither does a property
+/// or a label set back to its value from before the transaction.
+struct CommitChanges {
+  struct Edge {
+    Gid gid;
+    Gid from_vertex;
+    Gid to_vertex;
+    EdgeTypeId edge_type;
+  };
+
+  struct Label {
+    Gid vertex;
+    LabelId label;
+  };
+
+  struct Property {
+    // Vertex or edge, depending on the list the change is in.
+    Gid object;
+    PropertyId property;
+    // Null if the property wasn't set before or was removed.
+    PropertyValue old_value;
+    PropertyValue new_value;
+  };
+
+  bool Empty() const {
+    return created_vertices.empty() && deleted_vertices.empty() && created_edges.empty() && deleted_edges.empty() &&
+           set_labels.empty() && removed_labels.empty() && vertex_properties.empty() && edge_properties.empty();
+  }
+
+  uint64_t commit_timestamp{0};
+  std::vector<Gid> created_vertices;
+  std::vector<Gid> deleted_vertices;
+  std::vector<Edge> created_edges;
+  std::vector<Edge> deleted_edges;
+  // Labels and properties of the deleted vertices and edges aren't included.
+  std::vector<Label> set_labels;
+  std::vector<Label> removed_labels;
+  std::vector<Property> vertex_properties;
+  std::vector<Property> edge_properties;
+};
+
+/// Collects the changes of `transaction` from its deltas. The transaction must
+/// not be committed yet, so its objects still hold the values it wrote.
+CommitChanges CollectCommitChanges(const Transaction &transaction, const Config::Items &items);
+
+}  // namespace memgraph::storage
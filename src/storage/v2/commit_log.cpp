@@ -18,6 +18,7 @@ CommitLog::CommitLog() : allocator_(utils::NewDeleteResource()) {}
 CommitLog::CommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResource()) {
   head_ = allocator_.allocate(1);
   allocator_.construct(head_);
+  tail_ = head_;
   head_start_ = oldest_active / kIdsInBlock * kIdsInBlock;
   next_start_ = head_start_ + kIdsInBlock;
 
@@ -33,7 +34,7 @@ CommitLog::CommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResour
     head_->field[field_idx] >>= kIdsInField - idx_in_field;
   }
 
-  oldest_active_ = oldest_active;
+  oldest_active_.store(oldest_active, std::memory_order_release);
 }
 
 CommitLog::~CommitLog() {
@@ -50,25 +51,59 @@ void CommitLog::MarkFinished(uint64_t id) {
 
   Block *block = FindOrCreateBlock(id);
   block->field[(id % kIdsInBlock) / kIdsInField] |= 1ULL << (id % kIdsInField);
-  if (id == oldest_active_) {
+  if (id == oldest_active_.load(std::memory_order_relaxed)) {
     UpdateOldestActive();
   }
 }
 
-uint64_t CommitLog::OldestActive() {
+std::vector<uint64_t> CommitLog::ActiveIdsBelow(const uint64_t end) {
   std::lock_guard<utils::SpinLock> guard(lock_);
-  return oldest_active_;
+
+  std::vector<uint64_t> ids;
+  Block *current = head_;
+  uint64_t current_start = head_start_;
+  uint64_t id = oldest_active_.load(std::memory_order_relaxed);
+  while (id < end) {
+    if (!current) {
+      // None of the remaining IDs has been marked as finished yet.
+      for (; id < end; ++id) {
+        ids.push_back(id);
+      }
+      break;
+    }
+    if (id >= current_start + kIdsInBlock) {
+      current = current->next;
+      current_start += kIdsInBlock;
+      continue;
+    }
+
+    const uint64_t field_start = id / kIdsInField * kIdsInField;
+    uint64_t unfinished = ~current->field[(id - current_start) / kIdsInField] & (~0ULL << (id % kIdsInField));
+    while (unfinished != 0) {
+      const uint64_t active_id = field_start + __builtin_ctzll(unfinished);
+      if (active_id >= end) {
+        return ids;
+      }
+      ids.push_back(active_id);
+      unfinished &= unfinished - 1;
+    }
+    id = field_start + kIdsInField;
+  }
+
+  return ids;
 }
 
 void CommitLog::UpdateOldestActive() {
+  const auto oldest_active = oldest_active_.load(std::memory_order_relaxed);
   while (head_) {
     // This is necessary for amortized constant complexity. If we always start
     // from the 0th field, the amount of steps we make through each block is
     // quadratic in kBlockSize.
-    uint64_t start_field = oldest_active_ >= head_start_ ? (oldest_active_ - head_start_) / kIdsInField : 0;
+    uint64_t start_field = oldest_active >= head_start_ ? (oldest_active - head_start_) / kIdsInField : 0;
     for (uint64_t i = start_field; i < kBlockSize; ++i) {
       if (head_->field[i] != std::numeric_limits<uint64_t>::max()) {
-        oldest_active_ = head_start_ + i * kIdsInField + __builtin_ffsl(~head_->field[i]) - 1;
+        oldest_active_.store(head_start_ + i * kIdsInField + __builtin_ffsl(~head_->field[i]) - 1,
+                             std::memory_order_release);
         return;
       }
     }
@@ -81,17 +116,25 @@ void CommitLog::UpdateOldestActive() {
     head_start_ += kIdsInBlock;
   }
 
-  oldest_active_ = next_start_;
+  tail_ = nullptr;
+  oldest_active_.store(next_start_, std::memory_order_release);
 }
 
 CommitLog::Block *CommitLog::FindOrCreateBlock(const uint64_t id) {
   if (!head_) {
     head_ = allocator_.allocate(1);
     allocator_.construct(head_);
+    tail_ = head_;
     head_start_ = next_start_;
     next_start_ += kIdsInBlock;
   }
 
+  // The IDs are marked roughly in order, so they are usually in the last
+  // block and the blocks before it don't have to be walked.
+  if (id >= next_start_ - kIdsInBlock && id < next_start_) {
+    return tail_;
+  }
+
   Block *current = head_;
   uint64_t current_start = head_start_;
 
@@ -99,6 +142,7 @@ CommitLog::Block *CommitLog::FindOrCreateBlock(const uint64_t id) {
     if (!current->next) {
       current->next = allocator_.allocate(1);
       allocator_.construct(current->next);
+      tail_ = current->next;
       next_start_ += kIdsInBlock;
     }
 
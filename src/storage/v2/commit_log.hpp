@@ -12,8 +12,10 @@
 /// @file commit_log.hpp
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <vector>
 
 #include "utils/memory.hpp"
 #include "utils/spin_lock.hpp"
@@ -50,8 +52,14 @@ class CommitLog final {
   /// @throw std::bad_alloc
   void MarkFinished(uint64_t id);
 
-  /// Retrieve the oldest transaction still not marked as finished.
-  uint64_t OldestActive();
+  /// Retrieve the oldest transaction still not marked as finished. It doesn't
+  /// take the lock, so it's cheap to call often.
+  uint64_t OldestActive() const { return oldest_active_.load(std::memory_order_acquire); }
+
+  /// Retrieve all IDs lower than `end` which are still not marked as finished,
+  /// in increasing order.
+  /// @throw std::bad_alloc
+  std::vector<uint64_t> ActiveIdsBelow(uint64_t end);
 
  private:
   static constexpr uint64_t kBlockSize = 8192;
@@ -69,9 +77,12 @@ class CommitLog final {
   Block *FindOrCreateBlock(uint64_t id);
 
   Block *head_{nullptr};
+  // The last block, to which the new IDs are usually marked.
+  Block *tail_{nullptr};
   uint64_t head_start_{0};
   uint64_t next_start_{0};
-  uint64_t oldest_active_{0};
+  // Changed only while holding the lock.
+  std::atomic<uint64_t> oldest_active_{0};
   utils::SpinLock lock_;
   utils::Allocator<Block> allocator_;
 };
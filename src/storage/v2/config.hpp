@@ -14,6 +14,12 @@
 #include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "utils/exceptions.hpp"
 
@@ -32,34 +38,110 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // Number of threads (including the GC thread itself) used to unlink deltas
+    // and to clean up indices and constraints.
+    uint64_t thread_count{1};
+    // Upper bound on the time a periodic cycle spends unlinking deltas before
+    // releasing the storage lock and continuing in a new slice. Set to 0 to
+    // unlink everything in a single slice.
+    std::chrono::milliseconds time_slice{std::chrono::milliseconds(0)};
+    // Remove property deltas which no active transaction can apply on their own
+    // from the version chains that can't be unlinked yet because of
+    // long-running transactions.
+    bool compact_delta_chains{false};
   } gc;
 
   struct Items {
     bool properties_on_edges{true};
+    // Edge types whose edges have properties even when `properties_on_edges`
+    // is off. Owned by the storage, which resolves it from
+    // `properties_on_edge_types`, so the items stay cheap to copy.
+    const std::unordered_set<EdgeTypeId> *edge_types_with_properties{nullptr};
+
+    bool PropertiesOnEdges(EdgeTypeId edge_type) const {
+      return properties_on_edges ||
+             (edge_types_with_properties != nullptr && edge_types_with_properties->contains(edge_type));
+    }
+
+    // True if edges of at least one type have properties.
+    bool AnyPropertiesOnEdges() const {
+      return properties_on_edges || (edge_types_with_properties != nullptr && !edge_types_with_properties->empty());
+    }
   } items;
 
+  // Names of the edge types whose edges have properties when
+  // `items.properties_on_edges` is off. The edges of the other types are only
+  // stored as references in their vertices. Ignored by the on-disk storage.
+  std::vector<std::string> properties_on_edge_types{};
+
+  // Names of the properties whose string values are stored only once, in a
+  // dictionary shared by all vertices and edges, instead of being stored in
+  // full in each of them. Ignored by the on-disk storage.
+  std::vector<std::string> dictionary_encoded_properties{};
+
+  // Keep the entries of label+property indices in packed, sorted arrays which
+  // are loaded when an index is created and in a skip list holding only the
+  // recent writes. The garbage collector merges the skip list into the array
+  // once it holds at least this many entries of finished transactions. Set to 0
+  // to keep the indices only in skip lists. Ignored by the on-disk storage.
+  uint64_t packed_index_merge_threshold{0};
+
   struct Durability {
     enum class SnapshotWalMode { DISABLED, PERIODIC_SNAPSHOT, PERIODIC_SNAPSHOT_WITH_WAL };
 
     std::filesystem::path storage_directory{"storage"};
 
     bool recover_on_startup{false};
+    // Stop the recovery after the last transaction committed at or before this
+    // timestamp. Unless durability is disabled, the snapshots and WAL files
+    // with later transactions are moved to the backup directory.
+    std::optional<uint64_t> recover_to_timestamp;
 
     SnapshotWalMode snapshot_wal_mode{SnapshotWalMode::DISABLED};
 
     std::chrono::milliseconds snapshot_interval{std::chrono::minutes(2)};
     uint64_t snapshot_retention_count{3};
+    // Up to this many snapshots after each full snapshot are incremental, they
+    // only store the objects changed since the previous snapshot. Only full
+    // snapshots count towards `snapshot_retention_count`.
+    uint64_t snapshot_max_increments{0};
 
     uint64_t wal_file_size_kibibytes{20 * 1024};
     uint64_t wal_file_flush_every_n_tx{100000};
+    // Sync the WAL before each commit returns, sharing one `fsync` among the
+    // transactions committed concurrently. `wal_file_flush_every_n_tx` is
+    // ignored when enabled. Other transactions can see a commit before it's
+    // synced, its client only gets the result after the sync.
+    bool wal_group_commit{false};
+    // Keep this many empty files with the space of a WAL file preallocated,
+    // from which new WAL files are made. 0 disables preallocation.
+    uint64_t wal_preallocated_files{0};
+    // Write WAL files with direct I/O, bypassing the page cache.
+    bool wal_direct_io{false};
+    // Write the objects of snapshots and the transactions of WALs as zlib
+    // compressed blocks. Both kinds of files can be read either way.
+    bool compression{false};
 
     bool snapshot_on_exit{false};
     bool restore_replication_state_on_startup{false};
+    // Commits wait for this many SYNC replicas to apply the transaction, 0
+    // waits for all of them.
+    uint64_t replication_sync_quorum{0};
 
     uint64_t items_per_batch{1'000'000};
     uint64_t recovery_thread_count{8};
+    // Snapshots are written by this many threads, each encoding batches of
+    // `items_per_batch` objects.
+    uint64_t snapshot_thread_count{1};
+    // Snapshots are written at most this fast, 0 doesn't limit them. While
+    // limited, the writes also wait for the WAL syncs in progress.
+    uint64_t snapshot_write_mebibytes_per_sec{0};
 
     bool allow_parallel_index_creation{false};
+    // Create the recovered label and label+property indices in the background
+    // after the data is recovered, instead of before the storage can be used.
+    // An index is only used once it's created. Ignored by the on-disk storage.
+    bool background_index_recovery{false};
   } durability;
 
   struct Transaction {
@@ -75,6 +157,33 @@ struct Config {
     std::filesystem::path id_name_mapper_directory{"storage/rocksdb_id_name_mapper"};
     std::filesystem::path durability_directory{"storage/rocksdb_durability"};
     std::filesystem::path wal_directory{"storage/rocksdb_wal"};
+    // Memory for the committed vertices cached across transactions, 0
+    // disables the cache.
+    uint64_t vertex_cache_mib{64};
+
+    enum class WorkloadProfile : uint8_t {
+      // RocksDB's default options for all column families.
+      DEFAULT,
+      // Small blocks and bloom filters for reading single vertices and edges.
+      POINT_LOOKUPS,
+      // Large blocks without filters for scanning many vertices and edges.
+      SCANS
+    };
+    WorkloadProfile workload_profile{WorkloadProfile::DEFAULT};
+    // Size of the block cache shared by all RocksDB instances of the
+    // process, used by the non-default profiles. RocksDB's per-table cache
+    // is used if 0.
+    uint64_t block_cache_bytes{0};
+    // Commits which only create at least this many vertices and edges are
+    // written as SST files ingested into RocksDB, 0 disables it.
+    uint64_t sst_ingestion_min_objects{100000};
+    // New entries of the label and label+property indices only reference the
+    // vertex, which is read from the main storage, instead of also storing
+    // its labels and properties. Existing entries are read in either format.
+    bool reference_indices{false};
+    // A commit fails with a retryable error if RocksDB stalls the writes for
+    // longer, instead of blocking until the compactions catch up. 0 blocks.
+    std::chrono::milliseconds write_stall_timeout{std::chrono::seconds(10)};
   } disk;
 
   std::string name;
@@ -0,0 +1,98 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/disk/all_vertices_iterable.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Vertices loaded from the disk start their delta chain with the delta which
+// deletes the deserialized object, the rest were created by the transaction.
+bool IsLoadedFromDisk(const Vertex &vertex) {
+  const Delta *delta = vertex.delta;
+  while (delta != nullptr) {
+    auto *next = delta->next.load(std::memory_order_acquire);
+    if (next == nullptr) break;
+    delta = next;
+  }
+  return delta != nullptr && delta->action == Delta::Action::DELETE_DESERIALIZED_OBJECT;
+}
+
+}  // namespace
+
+DiskAllVerticesIterable::Iterator::Iterator(DiskAllVerticesIterable *self, std::unique_ptr<Cursor> cursor,
+                                            utils::SkipList<Vertex>::Iterator it)
+    : self_(self), cursor_(std::move(cursor)), it_(it) {
+  if (cursor_) {
+    AdvanceOnDisk();
+  }
+}
+
+DiskAllVerticesIterable::Iterator::Iterator(const Iterator &other)
+    : self_(other.self_),
+      cursor_(other.cursor_ ? other.cursor_->Clone() : nullptr),
+      disk_vertex_(other.disk_vertex_),
+      it_(other.it_) {}
+
+// NOLINTNEXTLINE(cert-oop54-cpp)
+DiskAllVerticesIterable::Iterator &DiskAllVerticesIterable::Iterator::operator=(const Iterator &other) {
+  self_ = other.self_;
+  cursor_ = other.cursor_ ? other.cursor_->Clone() : nullptr;
+  disk_vertex_ = other.disk_vertex_;
+  it_ = other.it_;
+  return *this;
+}
+
+void DiskAllVerticesIterable::Iterator::AdvanceOnDisk() {
+  while ((disk_vertex_ = cursor_->Next()) != nullptr) {
+    if (VertexAccessor::IsVisible(disk_vertex_, self_->transaction_, self_->view_)) {
+      self_->vertex_ = VertexAccessor{disk_vertex_, self_->transaction_, self_->indices_, self_->constraints_,
+                                      self_->config_};
+      return;
+    }
+  }
+  cursor_.reset();
+  it_ = self_->vertices_accessor_.begin();
+  AdvanceInCache();
+}
+
+void DiskAllVerticesIterable::Iterator::AdvanceInCache() {
+  const auto end = self_->vertices_accessor_.end();
+  for (; it_ != end; ++it_) {
+    if (IsLoadedFromDisk(*it_) || !VertexAccessor::IsVisible(&*it_, self_->transaction_, self_->view_)) {
+      continue;
+    }
+    self_->vertex_ = VertexAccessor{&*it_, self_->transaction_, self_->indices_, self_->constraints_, self_->config_};
+    return;
+  }
+}
+
+VertexAccessor const &DiskAllVerticesIterable::Iterator::operator*() const { return *self_->vertex_; }
+
+DiskAllVerticesIterable::Iterator &DiskAllVerticesIterable::Iterator::operator++() {
+  if (cursor_) {
+    AdvanceOnDisk();
+  } else {
+    ++it_;
+    AdvanceInCache();
+  }
+  return *this;
+}
+
+bool DiskAllVerticesIterable::Iterator::operator==(const Iterator &other) const {
+  if (self_ != other.self_ || (cursor_ == nullptr) != (other.cursor_ == nullptr)) {
+    return false;
+  }
+  return cursor_ ? disk_vertex_ == other.disk_vertex_ : it_ == other.it_;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,105 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Iterates the vertices of a disk storage transaction without loading all of
+/// them upfront. The vertices stored on the disk are read in key order and
+/// loaded into the transaction's vertex cache one at a time. After them, the
+/// vertices created by the transaction are iterated from the cache.
+class DiskAllVerticesIterable final {
+ public:
+  /// Reads the vertices stored on the disk.
+  class Cursor {
+   public:
+    Cursor() = default;
+    Cursor(const Cursor &) = delete;
+    Cursor &operator=(const Cursor &) = delete;
+    Cursor(Cursor &&) = delete;
+    Cursor &operator=(Cursor &&) = delete;
+    virtual ~Cursor() = default;
+
+    /// Moves to the next vertex on the disk and returns its version in the
+    /// transaction's vertex cache, or `nullptr` if there are no more vertices.
+    virtual Vertex *Next() = 0;
+
+    /// Returns a cursor at the same position.
+    virtual std::unique_ptr<Cursor> Clone() const = 0;
+  };
+
+  using CursorFactory = std::function<std::unique_ptr<Cursor>()>;
+
+ private:
+  CursorFactory cursor_factory_;
+  utils::SkipList<Vertex>::Accessor vertices_accessor_;
+  Transaction *transaction_;
+  View view_;
+  Indices *indices_;
+  Constraints *constraints_;
+  Config::Items config_;
+  std::optional<VertexAccessor> vertex_;
+
+ public:
+  class Iterator final {
+    DiskAllVerticesIterable *self_;
+    // `nullptr` once all vertices on the disk are iterated.
+    std::unique_ptr<Cursor> cursor_;
+    Vertex *disk_vertex_{nullptr};
+    utils::SkipList<Vertex>::Iterator it_;
+
+    void AdvanceOnDisk();
+
+    void AdvanceInCache();
+
+   public:
+    Iterator(DiskAllVerticesIterable *self, std::unique_ptr<Cursor> cursor, utils::SkipList<Vertex>::Iterator it);
+
+    Iterator(const Iterator &other);
+    Iterator &operator=(const Iterator &other);
+    Iterator(Iterator &&) noexcept = default;
+    Iterator &operator=(Iterator &&) noexcept = default;
+    ~Iterator() = default;
+
+    VertexAccessor const &operator*() const;
+
+    Iterator &operator++();
+
+    bool operator==(const Iterator &other) const;
+
+    bool operator!=(const Iterator &other) const { return !(*this == other); }
+  };
+
+  /// `vertices_accessor` accesses the transaction's vertex cache into which
+  /// the cursors created by `cursor_factory` load the vertices.
+  DiskAllVerticesIterable(CursorFactory cursor_factory, utils::SkipList<Vertex>::Accessor vertices_accessor,
+                          Transaction *transaction, View view, Indices *indices, Constraints *constraints,
+                          Config::Items config)
+      : cursor_factory_(std::move(cursor_factory)),
+        vertices_accessor_(std::move(vertices_accessor)),
+        transaction_(transaction),
+        view_(view),
+        indices_(indices),
+        constraints_(constraints),
+        config_(config) {}
+
+  Iterator begin() { return {this, cursor_factory_(), vertices_accessor_.end()}; }
+  Iterator end() { return {this, nullptr, vertices_accessor_.end()}; }
+};
+
+}  // namespace memgraph::storage
@@ -45,11 +45,13 @@ bool CommitWithTimestamp(rocksdb::Transaction *disk_transaction, uint64_t commit
 
 }  // namespace
 
-DiskLabelIndex::DiskLabelIndex(Indices *indices, const Config &config) : LabelIndex(indices, config) {
+DiskLabelIndex::DiskLabelIndex(Indices *indices, const Config &config)
+    : LabelIndex(indices, config), reference_entries_(config.disk.reference_indices) {
   utils::EnsureDirOrDie(config.disk.label_index_directory);
   kvstore_ = std::make_unique<RocksDBStorage>();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyWorkloadProfile(kvstore_->options_, ColumnFamilyKind::INDEX, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                             config.disk.label_index_directory, &kvstore_->db_));
 }
@@ -90,10 +92,10 @@ bool DiskLabelIndex::SyncVertexToLabelIndexStorage(const Vertex &vertex, uint64_
     if (!utils::Contains(vertex.labels, index_label)) {
       continue;
     }
-    if (!disk_transaction
-             ->Put(utils::SerializeVertexAsKeyForLabelIndex(index_label, vertex.gid),
-                   utils::SerializeVertexAsValueForLabelIndex(index_label, vertex.labels, vertex.properties))
-             .ok()) {
+    const auto value = reference_entries_
+                           ? std::string{}
+                           : utils::SerializeVertexAsValueForLabelIndex(index_label, vertex.labels, vertex.properties);
+    if (!disk_transaction->Put(utils::SerializeVertexAsKeyForLabelIndex(index_label, vertex.gid), value).ok()) {
       return false;
     }
   }
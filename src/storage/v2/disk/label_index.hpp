@@ -38,6 +38,8 @@ class DiskLabelIndex : public storage::LabelIndex {
   [[nodiscard]] bool DeleteVerticesWithRemovedIndexingLabel(uint64_t transaction_start_timestamp,
                                                             uint64_t transaction_commit_timestamp);
   /// @throw std::bad_alloc
+  using LabelIndex::UpdateOnAddLabel;
+
   void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_before_update, const Transaction &tx) override;
 
   void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_before_update, const Transaction &tx) override;
@@ -61,6 +63,8 @@ class DiskLabelIndex : public storage::LabelIndex {
   utils::Synchronized<std::map<uint64_t, std::map<Gid, std::vector<LabelId>>>> entries_for_deletion;
   std::unordered_set<LabelId> index_;
   std::unique_ptr<RocksDBStorage> kvstore_;
+  // New entries only reference the vertex in the main storage.
+  bool reference_entries_;
 };
 
 }  // namespace memgraph::storage
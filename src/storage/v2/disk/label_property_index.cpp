@@ -50,11 +50,12 @@ bool CommitWithTimestamp(rocksdb::Transaction *disk_transaction, uint64_t commit
 }  // namespace
 
 DiskLabelPropertyIndex::DiskLabelPropertyIndex(Indices *indices, const Config &config)
-    : LabelPropertyIndex(indices, config) {
+    : LabelPropertyIndex(indices, config), reference_entries_(config.disk.reference_indices) {
   utils::EnsureDirOrDie(config.disk.label_property_index_directory);
   kvstore_ = std::make_unique<RocksDBStorage>();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyWorkloadProfile(kvstore_->options_, ColumnFamilyKind::INDEX, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(
       kvstore_->options_, rocksdb::TransactionDBOptions(), config.disk.label_property_index_directory, &kvstore_->db_));
 }
@@ -95,9 +96,12 @@ bool DiskLabelPropertyIndex::SyncVertexToLabelPropertyIndexStorage(const Vertex
   }
   for (const auto &[index_label, index_property] : index_) {
     if (IsVertexIndexedByLabelProperty(vertex, index_label, index_property)) {
+      const auto value =
+          reference_entries_
+              ? std::string{}
+              : utils::SerializeVertexAsValueForLabelPropertyIndex(index_label, vertex.labels, vertex.properties);
       if (!disk_transaction
-               ->Put(utils::SerializeVertexAsKeyForLabelPropertyIndex(index_label, index_property, vertex.gid),
-                     utils::SerializeVertexAsValueForLabelPropertyIndex(index_label, vertex.labels, vertex.properties))
+               ->Put(utils::SerializeVertexAsKeyForLabelPropertyIndex(index_label, index_property, vertex.gid), value)
                .ok()) {
         return false;
       }
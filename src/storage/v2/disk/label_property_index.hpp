@@ -70,6 +70,8 @@ class DiskLabelPropertyIndex : public storage::LabelPropertyIndex {
       entries_for_deletion;
   std::set<std::pair<LabelId, PropertyId>> index_;
   std::unique_ptr<RocksDBStorage> kvstore_;
+  // New entries only reference the vertex in the main storage.
+  bool reference_entries_;
 };
 
 }  // namespace memgraph::storage
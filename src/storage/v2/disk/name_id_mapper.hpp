@@ -44,8 +44,7 @@ class DiskNameIdMapper final : public NameIdMapper {
     uint64_t res_id = 0;
     if (auto maybe_id_from_disk = name_to_id_storage_->Get(std::string(name)); maybe_id_from_disk.has_value()) {
       res_id = std::stoull(maybe_id_from_disk.value());
-      InsertNameIdEntryToCache(std::string(name), res_id);
-      InsertIdNameEntryToCache(res_id, std::string(name));
+      InsertMapping(name, res_id);
     } else {
       res_id = NameIdMapper::NameToId(name);
       MG_ASSERT(id_to_name_storage_->Put(std::to_string(res_id), std::string(name)),
@@ -66,42 +65,17 @@ class DiskNameIdMapper final : public NameIdMapper {
     auto maybe_name_from_disk = id_to_name_storage_->Get(std::to_string(id));
     MG_ASSERT(maybe_name_from_disk.has_value(), "Trying to get a name from disk for an invalid ID!");
 
-    InsertIdNameEntryToCache(id, maybe_name_from_disk.value());
-    return InsertNameIdEntryToCache(maybe_name_from_disk.value(), id);
+    return InsertMapping(maybe_name_from_disk.value(), id).second;
   }
 
  private:
-  std::optional<std::reference_wrapper<const uint64_t>> MaybeNameToId(const std::string_view name) const {
-    auto name_to_id_acc = name_to_id_.access();
-    auto result = name_to_id_acc.find(name);
-    if (result == name_to_id_acc.end()) {
-      return std::nullopt;
-    }
-    return result->id;
-  }
-
-  const std::string &InsertNameIdEntryToCache(const std::string &name, uint64_t id) {
-    auto name_to_id_acc = name_to_id_.access();
-    return name_to_id_acc.insert({std::string(name), id}).first->name;
-  }
-
-  const std::string &InsertIdNameEntryToCache(uint64_t id, const std::string &name) {
-    auto id_to_name_acc = id_to_name_.access();
-    return id_to_name_acc.insert({id, std::string(name)}).first->name;
-  }
-
   void InitializeFromDisk() {
     for (auto itr = name_to_id_storage_->begin(); itr != name_to_id_storage_->end(); ++itr) {
       auto name = itr->first;
       auto id = std::stoull(itr->second);
-      InsertNameIdEntryToCache(name, id);
+      InsertMapping(name, id);
       counter_.fetch_add(1, std::memory_order_release);
     }
-    for (auto itr = id_to_name_storage_->begin(); itr != id_to_name_storage_->end(); ++itr) {
-      auto id = std::stoull(itr->first);
-      auto name = itr->second;
-      InsertIdNameEntryToCache(id, name);
-    }
   }
 
   std::unique_ptr<kvstore::KVStore> name_to_id_storage_;
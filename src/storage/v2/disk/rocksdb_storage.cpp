@@ -11,8 +11,24 @@
 
 #include "rocksdb_storage.hpp"
 
+#include <memory>
+#include <mutex>
 #include <string_view>
+
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/slice_transform.h>
+#include <rocksdb/table.h>
+
+#include "utils/event_counter.hpp"
 #include "utils/rocksdb_serialization.hpp"
+#include "utils/string.hpp"
+
+namespace memgraph::metrics {
+extern const Event DiskDelayedColumnFamilies;
+extern const Event DiskStoppedColumnFamilies;
+extern const Event DiskWriteStalls;
+}  // namespace memgraph::metrics
 
 namespace memgraph::storage {
 
@@ -37,6 +53,56 @@ std::string_view ExtractGidFromUserKey(const rocksdb::Slice &key) {
   return keyStrView.substr(keyStrView.find_last_of('|') + 1);
 }
 
+// The prefix of an adjacency key is the vertex gid and the direction.
+class AdjacencyPrefixTransform : public rocksdb::SliceTransform {
+ public:
+  const char *Name() const override { return "memgraph.AdjacencyPrefix"; }
+
+  rocksdb::Slice Transform(const rocksdb::Slice &key) const override {
+    return {key.data(), PrefixSize(key.ToStringView())};
+  }
+
+  bool InDomain(const rocksdb::Slice &key) const override {
+    return PrefixSize(key.ToStringView()) != std::string_view::npos;
+  }
+
+ private:
+  static size_t PrefixSize(std::string_view key) {
+    const auto vertex_end = key.find('|');
+    if (vertex_end == std::string_view::npos) return std::string_view::npos;
+    const auto direction_end = key.find('|', vertex_end + 1);
+    if (direction_end == std::string_view::npos) return std::string_view::npos;
+    return direction_end + 1;
+  }
+};
+
+constexpr int kAdjacencyBloomBitsPerKey = 10;
+constexpr int kPointLookupBloomBitsPerKey = 10;
+constexpr size_t kPointLookupBlockSize = 4UL * 1024;
+constexpr size_t kPointLookupIndexBlockSize = 16UL * 1024;
+constexpr size_t kScanBlockSize = 64UL * 1024;
+constexpr size_t kScanCompactionReadahead = 2UL * 1024 * 1024;
+// Part of the block cache reserved for index and filter blocks.
+constexpr double kBlockCacheHighPriorityRatio = 0.5;
+
+// All RocksDB instances of the process share one block cache, so its size can
+// be accounted for in the memory limit. It's created with the size requested
+// by the first storage and released with the last one.
+std::shared_ptr<rocksdb::Cache> SharedBlockCache(uint64_t capacity_bytes) {
+  static std::mutex lock;
+  static std::weak_ptr<rocksdb::Cache> shared_cache;
+  std::lock_guard guard(lock);
+  if (auto cache = shared_cache.lock()) {
+    return cache;
+  }
+  rocksdb::LRUCacheOptions cache_options;
+  cache_options.capacity = capacity_bytes;
+  cache_options.high_pri_pool_ratio = kBlockCacheHighPriorityRatio;
+  auto cache = rocksdb::NewLRUCache(cache_options);
+  shared_cache = cache;
+  return cache;
+}
+
 }  // namespace
 
 ComparatorWithU64TsImpl::ComparatorWithU64TsImpl()
@@ -110,4 +176,129 @@ std::string DiskEdgeKey::GetVertexInGid() const {
 
 std::string DiskEdgeKey::GetEdgeGid() const { return key.substr(key.rfind('|') + 1); }
 
+void ApplyWorkloadProfile(rocksdb::ColumnFamilyOptions &options, ColumnFamilyKind kind,
+                          const Config::DiskConfig &config) {
+  using WorkloadProfile = Config::DiskConfig::WorkloadProfile;
+  const bool is_data = kind == ColumnFamilyKind::VERTEX || kind == ColumnFamilyKind::EDGE;
+
+  rocksdb::BlockBasedTableOptions table_options;
+  if (kind == ColumnFamilyKind::ADJACENCY) {
+    // Filters on the prefix only, the adjacency entries are always read with
+    // prefix seeks.
+    table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(kAdjacencyBloomBitsPerKey));
+    table_options.whole_key_filtering = false;
+  }
+
+  switch (config.workload_profile) {
+    case WorkloadProfile::DEFAULT:
+      break;
+    case WorkloadProfile::POINT_LOOKUPS:
+      table_options.block_size = is_data ? kPointLookupBlockSize : kPointLookupIndexBlockSize;
+      if (is_data) {
+        table_options.filter_policy.reset(rocksdb::NewBloomFilterPolicy(kPointLookupBloomBitsPerKey));
+        table_options.optimize_filters_for_memory = true;
+        // Only the partitions of the index and filters which are read are
+        // kept in the cache.
+        table_options.index_type = rocksdb::BlockBasedTableOptions::kTwoLevelIndexSearch;
+        table_options.partition_filters = true;
+      }
+      break;
+    case WorkloadProfile::SCANS:
+      table_options.block_size = kScanBlockSize;
+      options.compaction_readahead_size = kScanCompactionReadahead;
+      break;
+  }
+
+  if (config.workload_profile != WorkloadProfile::DEFAULT && config.block_cache_bytes != 0) {
+    table_options.block_cache = SharedBlockCache(config.block_cache_bytes);
+    // Index and filter blocks are evicted after the data blocks.
+    table_options.cache_index_and_filter_blocks = true;
+    table_options.cache_index_and_filter_blocks_with_high_priority = true;
+    table_options.pin_l0_filter_and_index_blocks_in_cache = true;
+  }
+  options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+}
+
+rocksdb::ColumnFamilyOptions AdjacencyColumnFamilyOptions(const rocksdb::Options &options,
+                                                          const Config::DiskConfig &config) {
+  rocksdb::ColumnFamilyOptions adjacency_options(options);
+  adjacency_options.comparator = rocksdb::BytewiseComparatorWithU64Ts();
+  adjacency_options.prefix_extractor = std::make_shared<AdjacencyPrefixTransform>();
+  adjacency_options.memtable_prefix_bloom_size_ratio = 0.1;
+  ApplyWorkloadProfile(adjacency_options, ColumnFamilyKind::ADJACENCY, config);
+  return adjacency_options;
+}
+
+namespace {
+
+void UpdateStalledColumnFamiliesMetric(rocksdb::WriteStallCondition condition, bool stalled) {
+  const auto event = condition == rocksdb::WriteStallCondition::kStopped ? metrics::DiskStoppedColumnFamilies
+                                                                         : metrics::DiskDelayedColumnFamilies;
+  if (stalled) {
+    metrics::IncrementCounter(event);
+  } else {
+    metrics::DecrementCounter(event);
+  }
+}
+
+}  // namespace
+
+DiskWriteStallListener::~DiskWriteStallListener() {
+  for (const auto &[_, condition] : stalled_column_families_) {
+    UpdateStalledColumnFamiliesMetric(condition, false);
+  }
+}
+
+void DiskWriteStallListener::OnStallConditionsChanged(const rocksdb::WriteStallInfo &info) {
+  std::lock_guard guard(lock_);
+  if (info.condition.prev != rocksdb::WriteStallCondition::kNormal) {
+    UpdateStalledColumnFamiliesMetric(info.condition.prev, false);
+    stalled_column_families_.erase(info.cf_name);
+  }
+  if (info.condition.cur != rocksdb::WriteStallCondition::kNormal) {
+    UpdateStalledColumnFamiliesMetric(info.condition.cur, true);
+    stalled_column_families_[info.cf_name] = info.condition.cur;
+    if (info.condition.prev == rocksdb::WriteStallCondition::kNormal) {
+      metrics::IncrementCounter(metrics::DiskWriteStalls);
+    }
+    spdlog::warn("rocksdb: Writes of column family {} are {} until the compactions catch up.", info.cf_name,
+                 info.condition.cur == rocksdb::WriteStallCondition::kStopped ? "stopped" : "delayed");
+  }
+  if (stalled_column_families_.empty()) {
+    writes_normal_.notify_all();
+  }
+}
+
+bool DiskWriteStallListener::WaitUntilWritesAreNormal(std::chrono::milliseconds timeout) {
+  std::unique_lock guard(lock_);
+  return writes_normal_.wait_for(guard, timeout, [this] { return stalled_column_families_.empty(); });
+}
+
+DiskAdjacencyKey::DiskAdjacencyKey(const DiskEdgeKey &edge_key, EdgeDirection direction) {
+  // from | to | direction | edge_type | edge_gid
+  const auto edge_parts = utils::Split(edge_key.GetSerializedKey(), "|");
+  const bool is_out = direction == EdgeDirection::OUT;
+  const auto &vertex_gid = is_out ? edge_parts[0] : edge_parts[1];
+  const auto &neighbour_gid = is_out ? edge_parts[1] : edge_parts[0];
+  key = fmt::format("{}|{}|{}|{}|{}", vertex_gid, static_cast<int>(direction), edge_parts[3], neighbour_gid,
+                    edge_parts[4]);
+}
+
+std::string DiskAdjacencyKey::Prefix(Gid vertex_gid, EdgeDirection direction) {
+  return fmt::format("{}|{}|", utils::SerializeIdType(vertex_gid), static_cast<int>(direction));
+}
+
+std::string DiskAdjacencyKey::Prefix(Gid vertex_gid, EdgeDirection direction, EdgeTypeId edge_type) {
+  return fmt::format("{}|{}|{}|", utils::SerializeIdType(vertex_gid), static_cast<int>(direction),
+                     utils::SerializeIdType(edge_type));
+}
+
+DiskEdgeKey DiskAdjacencyKey::GetEdgeKey() const {
+  const auto parts = utils::Split(key, "|");
+  const bool is_out = parts[1] == std::to_string(static_cast<int>(EdgeDirection::OUT));
+  const auto &from_gid = is_out ? parts[0] : parts[3];
+  const auto &to_gid = is_out ? parts[3] : parts[0];
+  return DiskEdgeKey(fmt::format("{}|{}|{}|{}|{}", from_gid, to_gid, utils::outEdgeDirection, parts[2], parts[4]));
+}
+
 }  // namespace memgraph::storage
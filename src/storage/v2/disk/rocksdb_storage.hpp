@@ -11,13 +11,20 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
 #include <rocksdb/comparator.h>
 #include <rocksdb/db.h>
 #include <rocksdb/iterator.h>
+#include <rocksdb/listener.h>
 #include <rocksdb/options.h>
 #include <rocksdb/status.h>
 #include <rocksdb/utilities/transaction_db.h>
 
+#include "storage/v2/config.hpp"
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -50,6 +57,7 @@ struct RocksDBStorage {
   rocksdb::TransactionDB *db_;
   rocksdb::ColumnFamilyHandle *vertex_chandle = nullptr;
   rocksdb::ColumnFamilyHandle *edge_chandle = nullptr;
+  rocksdb::ColumnFamilyHandle *adjacency_chandle = nullptr;
   rocksdb::ColumnFamilyHandle *default_chandle = nullptr;
 };
 
@@ -100,4 +108,68 @@ struct DiskEdgeKey {
   std::string key;
 };
 
+/// Column families tuned differently by the workload profiles.
+enum class ColumnFamilyKind : uint8_t { VERTEX, EDGE, ADJACENCY, INDEX };
+
+/// Sets the table options of a column family of the given kind as required by
+/// the workload profile of the config. The column families of the indices and
+/// constraints are all of the `INDEX` kind.
+void ApplyWorkloadProfile(rocksdb::ColumnFamilyOptions &options, ColumnFamilyKind kind,
+                          const Config::DiskConfig &config);
+
+/// Options of the adjacency column family. Unlike the other column families
+/// its keys are ordered bytewise, and a prefix bloom filter on the vertex and
+/// direction lets seeks skip the files without entries of the vertex.
+rocksdb::ColumnFamilyOptions AdjacencyColumnFamilyOptions(const rocksdb::Options &options,
+                                                          const Config::DiskConfig &config);
+
+/// Follows the write stall conditions of the column families of a RocksDB
+/// instance, which RocksDB changes when the compactions fall behind, and
+/// counts them in the metrics.
+class DiskWriteStallListener : public rocksdb::EventListener {
+ public:
+  DiskWriteStallListener() = default;
+  DiskWriteStallListener(const DiskWriteStallListener &) = delete;
+  DiskWriteStallListener &operator=(const DiskWriteStallListener &) = delete;
+  DiskWriteStallListener(DiskWriteStallListener &&) = delete;
+  DiskWriteStallListener &operator=(DiskWriteStallListener &&) = delete;
+  ~DiskWriteStallListener() override;
+
+  void OnStallConditionsChanged(const rocksdb::WriteStallInfo &info) override;
+
+  /// Returns false if the writes of some column family are still delayed or
+  /// stopped after `timeout`.
+  bool WaitUntilWritesAreNormal(std::chrono::milliseconds timeout);
+
+ private:
+  std::mutex lock_;
+  std::condition_variable writes_normal_;
+  // Only the column families whose writes are delayed or stopped.
+  std::map<std::string, rocksdb::WriteStallCondition> stalled_column_families_;
+};
+
+/// Key of the adjacency column family. Every edge has an entry under its
+/// source vertex with the OUT direction and one under its destination vertex
+/// with the IN direction, both with empty values. The edge itself stays in the
+/// edge column family under its `DiskEdgeKey`.
+struct DiskAdjacencyKey {
+  explicit DiskAdjacencyKey(const std::string_view keyView) : key(keyView) {}
+
+  DiskAdjacencyKey(const DiskEdgeKey &edge_key, EdgeDirection direction);
+
+  /// Prefix of the entries of the vertex in the direction.
+  static std::string Prefix(Gid vertex_gid, EdgeDirection direction);
+
+  /// Prefix of the entries of the vertex in the direction with the edge type.
+  static std::string Prefix(Gid vertex_gid, EdgeDirection direction, EdgeTypeId edge_type);
+
+  std::string GetSerializedKey() const { return key; }
+
+  DiskEdgeKey GetEdgeKey() const;
+
+ private:
+  // vertex_gid | direction | edge_type | neighbour_vertex_gid | edge_gid
+  std::string key;
+};
+
 }  // namespace memgraph::storage
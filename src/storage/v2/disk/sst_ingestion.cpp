@@ -0,0 +1,193 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/disk/sst_ingestion.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <queue>
+
+#include <rocksdb/options.h>
+#include <rocksdb/sst_file_writer.h>
+
+#include "utils/file.hpp"
+#include "utils/rocksdb_serialization.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Approximate memory used by a buffered entry apart from its key and value.
+constexpr uint64_t kEntryOverheadBytes = 64;
+
+using Entry = std::pair<std::string, std::string>;
+
+void WriteString(std::ofstream &out, const std::string &str) {
+  const uint64_t size = str.size();
+  out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  out.write(str.data(), static_cast<std::streamsize>(size));
+}
+
+bool ReadString(std::ifstream &in, std::string &str) {
+  uint64_t size = 0;
+  if (!in.read(reinterpret_cast<char *>(&size), sizeof(size))) return false;
+  str.resize(size);
+  return static_cast<bool>(in.read(str.data(), static_cast<std::streamsize>(size)));
+}
+
+// Reads the entries of a sorted run one at a time.
+class RunReader {
+ public:
+  explicit RunReader(const std::filesystem::path &path) : in_(path, std::ios::binary) {}
+
+  bool Next() { return ReadString(in_, entry_.first) && ReadString(in_, entry_.second); }
+
+  const Entry &Current() const { return entry_; }
+
+ private:
+  std::ifstream in_;
+  Entry entry_;
+};
+
+}  // namespace
+
+class DiskSstIngestion::Sorter {
+ public:
+  Sorter(rocksdb::DB *db, rocksdb::ColumnFamilyHandle *column_family, std::filesystem::path directory,
+         uint64_t memory_limit_bytes)
+      : db_(db),
+        column_family_(column_family),
+        comparator_(column_family->GetComparator()),
+        directory_(std::move(directory)),
+        memory_limit_bytes_(memory_limit_bytes) {}
+
+  void Put(std::string key, std::string value) {
+    buffer_bytes_ += key.size() + value.size() + kEntryOverheadBytes;
+    buffer_.emplace_back(std::move(key), std::move(value));
+    if (buffer_bytes_ >= memory_limit_bytes_) {
+      SpillRun();
+    }
+  }
+
+  /// Writes all entries into an SST file. `path` is left empty if there are
+  /// no entries.
+  rocksdb::Status WriteSstFile(const std::string &timestamp, std::string *path) {
+    if (!status_.ok()) return status_;
+    if (buffer_.empty() && runs_.empty()) return rocksdb::Status::OK();
+
+    *path = directory_ / (std::to_string(column_family_->GetID()) + ".sst");
+    rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), db_->GetOptions(column_family_), column_family_);
+    if (auto status = writer.Open(*path); !status.ok()) return status;
+
+    if (runs_.empty()) {
+      SortBuffer();
+      for (const auto &[key, value] : buffer_) {
+        if (auto status = writer.Put(key, timestamp, value); !status.ok()) return status;
+      }
+      return writer.Finish();
+    }
+
+    SpillRun();
+    if (!status_.ok()) return status_;
+    std::vector<RunReader> readers;
+    readers.reserve(runs_.size());
+    for (const auto &run : runs_) {
+      readers.emplace_back(run);
+    }
+    auto greater = [&](size_t lhs, size_t rhs) { return Less(readers[rhs].Current(), readers[lhs].Current()); };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(greater)> heads(greater);
+    for (size_t i = 0; i < readers.size(); ++i) {
+      if (readers[i].Next()) heads.push(i);
+    }
+    while (!heads.empty()) {
+      const auto i = heads.top();
+      heads.pop();
+      const auto &[key, value] = readers[i].Current();
+      if (auto status = writer.Put(key, timestamp, value); !status.ok()) return status;
+      if (readers[i].Next()) heads.push(i);
+    }
+    return writer.Finish();
+  }
+
+ private:
+  bool Less(const Entry &lhs, const Entry &rhs) const {
+    return comparator_->CompareWithoutTimestamp(lhs.first, false, rhs.first, false) < 0;
+  }
+
+  void SortBuffer() {
+    std::sort(buffer_.begin(), buffer_.end(), [this](const Entry &lhs, const Entry &rhs) { return Less(lhs, rhs); });
+  }
+
+  void SpillRun() {
+    if (buffer_.empty() || !status_.ok()) return;
+    SortBuffer();
+    auto &run =
+        runs_.emplace_back(directory_ / (std::to_string(column_family_->GetID()) + "_" + std::to_string(runs_.size())));
+    std::ofstream out(run, std::ios::binary);
+    for (const auto &[key, value] : buffer_) {
+      WriteString(out, key);
+      WriteString(out, value);
+    }
+    out.close();
+    if (!out) {
+      status_ = rocksdb::Status::IOError("Failed to write a sorted run", run.string());
+    }
+    buffer_.clear();
+    buffer_bytes_ = 0;
+  }
+
+  rocksdb::DB *db_;
+  rocksdb::ColumnFamilyHandle *column_family_;
+  const rocksdb::Comparator *comparator_;
+  std::filesystem::path directory_;
+  uint64_t memory_limit_bytes_;
+  std::vector<Entry> buffer_;
+  uint64_t buffer_bytes_{0};
+  std::vector<std::filesystem::path> runs_;
+  rocksdb::Status status_;
+};
+
+DiskSstIngestion::DiskSstIngestion(rocksdb::DB *db, std::filesystem::path directory, uint64_t memory_limit_bytes)
+    : db_(db), directory_(std::move(directory)), memory_limit_bytes_(memory_limit_bytes) {
+  utils::EnsureDirOrDie(directory_);
+}
+
+DiskSstIngestion::~DiskSstIngestion() { utils::DeleteDir(directory_); }
+
+void DiskSstIngestion::Put(rocksdb::ColumnFamilyHandle *column_family, std::string key, std::string value) {
+  auto &sorter = sorters_[column_family];
+  if (!sorter) {
+    sorter = std::make_unique<Sorter>(db_, column_family, directory_, memory_limit_bytes_);
+  }
+  sorter->Put(std::move(key), std::move(value));
+}
+
+rocksdb::Status DiskSstIngestion::Ingest(uint64_t commit_timestamp) {
+  const auto timestamp = utils::StringTimestamp(commit_timestamp);
+  std::vector<rocksdb::IngestExternalFileArg> args;
+  for (auto &[column_family, sorter] : sorters_) {
+    std::string path;
+    if (auto status = sorter->WriteSstFile(timestamp, &path); !status.ok()) {
+      return status;
+    }
+    if (path.empty()) continue;
+    auto &arg = args.emplace_back();
+    arg.column_family = column_family;
+    arg.external_files.push_back(std::move(path));
+    arg.options.move_files = true;
+  }
+  if (args.empty()) {
+    return rocksdb::Status::OK();
+  }
+  return db_->IngestExternalFiles(args);
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,61 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <rocksdb/db.h>
+#include <rocksdb/status.h>
+
+namespace memgraph::storage {
+
+/// Writes new keys into column families of a database without putting them
+/// one by one into the memtables. The keys of each column family are sorted
+/// externally: they are buffered in memory and spilled to sorted runs on the
+/// disk, which are merged into a single SST file when ingested. All files are
+/// ingested atomically, with the given commit timestamp.
+///
+/// The keys must not exist in the database nor be added twice, since the
+/// ingested entries don't go through conflict detection.
+class DiskSstIngestion final {
+ public:
+  /// The sorted runs and SST files are written into `directory`, which is
+  /// removed afterwards. `memory_limit_bytes` bounds the memory used for the
+  /// buffered entries of each column family.
+  DiskSstIngestion(rocksdb::DB *db, std::filesystem::path directory, uint64_t memory_limit_bytes);
+
+  DiskSstIngestion(const DiskSstIngestion &) = delete;
+  DiskSstIngestion &operator=(const DiskSstIngestion &) = delete;
+  DiskSstIngestion(DiskSstIngestion &&) = delete;
+  DiskSstIngestion &operator=(DiskSstIngestion &&) = delete;
+  ~DiskSstIngestion();
+
+  void Put(rocksdb::ColumnFamilyHandle *column_family, std::string key, std::string value);
+
+  rocksdb::Status Ingest(uint64_t commit_timestamp);
+
+ private:
+  class Sorter;
+
+  rocksdb::DB *db_;
+  std::filesystem::path directory_;
+  uint64_t memory_limit_bytes_;
+  std::map<rocksdb::ColumnFamilyHandle *, std::unique_ptr<Sorter>> sorters_;
+};
+
+}  // namespace memgraph::storage
@@ -9,13 +9,18 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <exception>
 #include <limits>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <rocksdb/comparator.h>
@@ -63,10 +68,16 @@
 #include "utils/result.hpp"
 #include "utils/rocksdb_serialization.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
 #include "utils/stat.hpp"
 #include "utils/string.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/typeinfo.hpp"
 
+namespace memgraph::metrics {
+extern const Event DiskCommitsFailedOnWriteStall;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
@@ -76,6 +87,7 @@ namespace {
 constexpr const char *deserializeTimestamp = "0";
 constexpr const char *vertexHandle = "vertex";
 constexpr const char *edgeHandle = "edge";
+constexpr const char *adjacencyHandle = "adjacency";
 constexpr const char *defaultHandle = "default";
 constexpr const char *lastTransactionStartTimeStamp = "last_transaction_start_timestamp";
 constexpr const char *vertex_count_descr = "vertex_count";
@@ -87,6 +99,48 @@ constexpr const char *unique_constraints_str = "unique_constraints";
 
 /// TODO: (andi) Maybe a better way of checking would be if the first delta is DELETE_DESERIALIZED
 /// then we now that the vertex has only been deserialized and nothing more has been done on it.
+// Memory for the sorted entries of each column family of an SST ingestion.
+constexpr uint64_t kSstIngestionSortMemoryBytes = 256UL * 1024 * 1024;
+
+// Number of index entries whose vertices are read from the main storage at
+// once when the index only references the vertices.
+constexpr size_t kIndexEntriesBatchSize = 1024;
+
+// Commits with fewer objects per worker thread are serialized on the
+// committing thread only.
+constexpr size_t kMinObjectsPerCommitWorker = 4096;
+
+// Calls `serialize` for every index in [0, count), split between worker
+// threads if there are enough objects. `serialize` mustn't touch the RocksDB
+// transaction, its results are written to it in order by the caller.
+template <typename TSerialize>
+void SerializeInParallel(size_t count, const TSerialize &serialize) {
+  const size_t thread_count =
+      std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), count / kMinObjectsPerCommitWorker);
+  if (thread_count <= 1) {
+    for (size_t i = 0; i < count; ++i) serialize(i);
+    return;
+  }
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> maybe_error{};
+  {
+    const size_t objects_per_thread = (count + thread_count - 1) / thread_count;
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+    for (size_t begin = 0; begin < count; begin += objects_per_thread) {
+      threads.emplace_back([&, begin] {
+        try {
+          for (size_t i = begin; i < std::min(begin + objects_per_thread, count); ++i) serialize(i);
+        } catch (...) {
+          *maybe_error.Lock() = std::current_exception();
+        }
+      });
+    }
+  }
+  if (auto error = *maybe_error.Lock()) {
+    std::rethrow_exception(error);
+  }
+}
+
 bool VertexNeedsToBeSerialized(const Vertex &vertex) {
   Delta *head = vertex.delta;
   while (head != nullptr) {
@@ -269,7 +323,8 @@ void DiskStorage::LoadUniqueConstraintInfoIfExists() const {
 DiskStorage::DiskStorage(Config config)
     : Storage(config, StorageMode::ON_DISK_TRANSACTIONAL),
       kvstore_(std::make_unique<RocksDBStorage>()),
-      durability_kvstore_(std::make_unique<kvstore::KVStore>(config.disk.durability_directory)) {
+      durability_kvstore_(std::make_unique<kvstore::KVStore>(config.disk.durability_directory)),
+      vertex_cache_(config.disk.vertex_cache_mib * 1024 * 1024) {
   LoadTimestampIfExists();
   LoadVertexAndEdgeCountIfExists();
   LoadIndexInfoIfExists();
@@ -280,12 +335,26 @@ DiskStorage::DiskStorage(Config config)
   kvstore_->options_.wal_recovery_mode = rocksdb::WALRecoveryMode::kPointInTimeRecovery;
   kvstore_->options_.wal_dir = config_.disk.wal_directory;
   kvstore_->options_.wal_compression = rocksdb::kNoCompression;
+  kvstore_->options_.listeners.push_back(write_stall_listener_);
+  rocksdb::ColumnFamilyOptions vertex_options(kvstore_->options_);
+  ApplyWorkloadProfile(vertex_options, ColumnFamilyKind::VERTEX, config_.disk);
+  rocksdb::ColumnFamilyOptions edge_options(kvstore_->options_);
+  ApplyWorkloadProfile(edge_options, ColumnFamilyKind::EDGE, config_.disk);
+  const auto adjacency_options = AdjacencyColumnFamilyOptions(kvstore_->options_, config_.disk);
   std::vector<rocksdb::ColumnFamilyHandle *> column_handles;
   std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
   if (utils::DirExists(config.disk.main_storage_directory)) {
-    column_families.emplace_back(vertexHandle, kvstore_->options_);
-    column_families.emplace_back(edgeHandle, kvstore_->options_);
+    std::vector<std::string> existing_column_families;
+    logging::AssertRocksDBStatus(rocksdb::DB::ListColumnFamilies(
+        kvstore_->options_, config.disk.main_storage_directory, &existing_column_families));
+    const bool adjacency_exists = utils::Contains(existing_column_families, std::string{adjacencyHandle});
+
+    column_families.emplace_back(vertexHandle, vertex_options);
+    column_families.emplace_back(edgeHandle, edge_options);
     column_families.emplace_back(defaultHandle, kvstore_->options_);
+    if (adjacency_exists) {
+      column_families.emplace_back(adjacencyHandle, adjacency_options);
+    }
 
     logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                               config.disk.main_storage_directory, column_families,
@@ -293,22 +362,69 @@ DiskStorage::DiskStorage(Config config)
     kvstore_->vertex_chandle = column_handles[0];
     kvstore_->edge_chandle = column_handles[1];
     kvstore_->default_chandle = column_handles[2];
+    if (adjacency_exists) {
+      kvstore_->adjacency_chandle = column_handles[3];
+    } else {
+      // Storage created before the adjacency column family existed.
+      logging::AssertRocksDBStatus(
+          kvstore_->db_->CreateColumnFamily(adjacency_options, adjacencyHandle, &kvstore_->adjacency_chandle));
+      BuildAdjacencyFromEdges();
+    }
   } else {
     logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                               config.disk.main_storage_directory, &kvstore_->db_));
     logging::AssertRocksDBStatus(
-        kvstore_->db_->CreateColumnFamily(kvstore_->options_, vertexHandle, &kvstore_->vertex_chandle));
+        kvstore_->db_->CreateColumnFamily(vertex_options, vertexHandle, &kvstore_->vertex_chandle));
+    logging::AssertRocksDBStatus(kvstore_->db_->CreateColumnFamily(edge_options, edgeHandle, &kvstore_->edge_chandle));
     logging::AssertRocksDBStatus(
-        kvstore_->db_->CreateColumnFamily(kvstore_->options_, edgeHandle, &kvstore_->edge_chandle));
+        kvstore_->db_->CreateColumnFamily(adjacency_options, adjacencyHandle, &kvstore_->adjacency_chandle));
+  }
+}
+
+void DiskStorage::BuildAdjacencyFromEdges() {
+  constexpr uint64_t kEdgesPerTransaction = 100000;
+
+  rocksdb::ReadOptions ro;
+  auto strTs = utils::StringTimestamp(std::numeric_limits<uint64_t>::max());
+  rocksdb::Slice ts(strTs);
+  ro.timestamp = &ts;
+  auto it = std::unique_ptr<rocksdb::Iterator>(kvstore_->db_->NewIterator(ro, kvstore_->edge_chandle));
+
+  std::unique_ptr<rocksdb::Transaction> transaction;
+  uint64_t edges_in_transaction = 0;
+  auto commit = [&] {
+    // No transaction is running yet, so the entries are made visible to all
+    // of them.
+    logging::AssertRocksDBStatus(transaction->SetCommitTimestamp(0));
+    logging::AssertRocksDBStatus(transaction->Commit());
+    transaction.reset();
+    edges_in_transaction = 0;
+  };
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    if (!transaction) {
+      transaction.reset(kvstore_->db_->BeginTransaction(rocksdb::WriteOptions()));
+    }
+    const DiskEdgeKey edge_key(it->key().ToStringView());
+    for (const auto direction : {EdgeDirection::OUT, EdgeDirection::IN}) {
+      logging::AssertRocksDBStatus(transaction->Put(
+          kvstore_->adjacency_chandle, DiskAdjacencyKey(edge_key, direction).GetSerializedKey(), rocksdb::Slice()));
+    }
+    if (++edges_in_transaction == kEdgesPerTransaction) {
+      commit();
+    }
+  }
+  if (transaction) {
+    commit();
   }
 }
 
 DiskStorage::~DiskStorage() {
-  durability_kvstore_->Put(lastTransactionStartTimeStamp, std::to_string(timestamp_));
+  durability_kvstore_->Put(lastTransactionStartTimeStamp, std::to_string(timestamp_.load()));
   durability_kvstore_->Put(vertex_count_descr, std::to_string(vertex_count_.load(std::memory_order_acquire)));
   durability_kvstore_->Put(edge_count_descr, std::to_string(edge_count_.load(std::memory_order_acquire)));
   logging::AssertRocksDBStatus(kvstore_->db_->DestroyColumnFamilyHandle(kvstore_->vertex_chandle));
   logging::AssertRocksDBStatus(kvstore_->db_->DestroyColumnFamilyHandle(kvstore_->edge_chandle));
+  logging::AssertRocksDBStatus(kvstore_->db_->DestroyColumnFamilyHandle(kvstore_->adjacency_chandle));
   if (kvstore_->default_chandle) {
     // We must destroy default column family handle only if it was read from existing database.
     // https://github.com/facebook/rocksdb/issues/5006#issuecomment-1003154821
@@ -321,6 +437,9 @@ DiskStorage::~DiskStorage() {
 DiskStorage::DiskAccessor::DiskAccessor(DiskStorage *storage, IsolationLevel isolation_level, StorageMode storage_mode)
     : Accessor(storage, isolation_level, storage_mode), config_(storage->config_.items) {
   rocksdb::WriteOptions write_options;
+  // With a timeout the commit fails instead of blocking while RocksDB stalls
+  // the writes.
+  write_options.no_slowdown = storage->config_.disk.write_stall_timeout.count() != 0;
   auto txOptions = rocksdb::TransactionOptions{.set_snapshot = true};
   disk_transaction_ = storage->kvstore_->db_->BeginTransaction(write_options, txOptions);
   disk_transaction_->SetReadTimestampForValidation(transaction_.start_timestamp);
@@ -339,23 +458,22 @@ DiskStorage::DiskAccessor::~DiskAccessor() {
 
   FinalizeTransaction();
 
-  transaction_.deltas.~Bond<PmrListDelta>();
+  transaction_.deltas.~Bond<PmrDeltas>();
 }
 
 /// NOTE: This will create Delta object which will cause deletion of old key entry on the disk
-std::optional<storage::VertexAccessor> DiskStorage::DiskAccessor::LoadVertexToMainMemoryCache(std::string &&key,
-                                                                                              std::string &&value,
-                                                                                              std::string &&ts) {
+std::optional<storage::VertexAccessor> DiskStorage::DiskAccessor::LoadVertexToMainMemoryCache(
+    DiskVertexCache::Entry &&entry) {
   auto main_storage_accessor = vertices_.access();
 
-  storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromKey(key)));
+  storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromKey(entry.key)));
   if (ObjectExistsInCache(main_storage_accessor, gid)) {
     return std::nullopt;
   }
-  std::vector<LabelId> labels_id{utils::DeserializeLabelsFromMainDiskStorage(key)};
-  PropertyStore properties{utils::DeserializePropertiesFromMainDiskStorage(value)};
-  return CreateVertexFromDisk(main_storage_accessor, gid, std::move(labels_id), std::move(properties),
-                              CreateDeleteDeserializedObjectDelta(&transaction_, std::move(key), std::move(ts)));
+  PropertyStore properties{utils::DeserializePropertiesFromMainDiskStorage(entry.properties)};
+  return CreateVertexFromDisk(
+      main_storage_accessor, gid, std::move(entry.labels), std::move(properties),
+      CreateDeleteDeserializedObjectDelta(&transaction_, std::move(entry.key), deserializeTimestamp));
 }
 
 std::optional<storage::VertexAccessor> DiskStorage::DiskAccessor::LoadVertexToLabelIndexCache(
@@ -418,20 +536,73 @@ std::optional<EdgeAccessor> DiskStorage::DiskAccessor::DeserializeEdge(const roc
   return *maybe_edge;
 }
 
-void DiskStorage::DiskAccessor::LoadVerticesToMainMemoryCache() {
-  auto *disk_storage = static_cast<DiskStorage *>(storage_);
-  rocksdb::ReadOptions ro;
-  std::string strTs = utils::StringTimestamp(transaction_.start_timestamp);
-  rocksdb::Slice ts(strTs);
-  ro.timestamp = &ts;
-  auto it =
-      std::unique_ptr<rocksdb::Iterator>(disk_transaction_->GetIterator(ro, disk_storage->kvstore_->vertex_chandle));
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+class DiskStorage::DiskAccessor::MainStorageCursor final : public DiskAllVerticesIterable::Cursor {
+ public:
+  explicit MainStorageCursor(DiskAccessor *accessor)
+      : accessor_(accessor),
+        disk_storage_(static_cast<DiskStorage *>(accessor->storage_)),
+        vertices_accessor_(accessor->vertices_.access()),
+        timestamp_(utils::StringTimestamp(accessor->transaction_.start_timestamp)),
+        timestamp_slice_(timestamp_) {
+    if (disk_storage_->vertex_cache_.Enabled()) {
+      cache_tokens_ = disk_storage_->vertex_cache_.ReadTokens();
+    }
+    rocksdb::ReadOptions ro;
+    ro.timestamp = &timestamp_slice_;
+    it_.reset(accessor_->disk_transaction_->GetIterator(ro, disk_storage_->kvstore_->vertex_chandle));
+  }
+
+  Vertex *Next() override {
+    if (started_) {
+      it_->Next();
+    } else {
+      it_->SeekToFirst();
+      started_ = true;
+    }
+    if (!it_->Valid()) {
+      return nullptr;
+    }
+
+    std::string key = it_->key().ToString();
+    const auto gid = Gid::FromUint(std::stoull(utils::ExtractGidFromKey(key)));
+    if (auto vertex_it = vertices_accessor_.find(gid); vertex_it != vertices_accessor_.end()) {
+      return &*vertex_it;
+    }
+    DiskVertexCache::Entry entry{.labels = utils::DeserializeLabelsFromMainDiskStorage(key),
+                                 .properties = it_->value().ToString()};
+    entry.key = std::move(key);
+    if (!cache_tokens_.empty()) {
+      disk_storage_->vertex_cache_.Insert(gid, cache_tokens_[DiskVertexCache::StripeIndex(gid)],
+                                          accessor_->transaction_.start_timestamp, entry);
+    }
     // We should pass it->timestamp().ToString() instead of "0"
     // This is hack until RocksDB will support timestamp() in WBWI iterator
-    LoadVertexToMainMemoryCache(it->key().ToString(), it->value().ToString(), deserializeTimestamp);
+    return accessor_->LoadVertexToMainMemoryCache(std::move(entry))->vertex_;
+  }
+
+  std::unique_ptr<DiskAllVerticesIterable::Cursor> Clone() const override {
+    auto cursor = std::make_unique<MainStorageCursor>(accessor_);
+    // The clone reads the same snapshot, so the vertices it caches must be
+    // validated with the tokens taken before this cursor started reading.
+    cursor->cache_tokens_ = cache_tokens_;
+    if (started_) {
+      cursor->started_ = true;
+      cursor->it_->Seek(it_->key());
+    }
+    return cursor;
   }
-}
+
+ private:
+  DiskAccessor *accessor_;
+  DiskStorage *disk_storage_;
+  utils::SkipList<Vertex>::Accessor vertices_accessor_;
+  std::vector<uint64_t> cache_tokens_;
+  // The read options of the iterator point to the timestamp.
+  std::string timestamp_;
+  rocksdb::Slice timestamp_slice_;
+  std::unique_ptr<rocksdb::Iterator> it_;
+  bool started_{false};
+};
 
 /// TODO: how to remove this
 /// TODO: When loading from disk, you can in some situations load from index rocksdb not the main one
@@ -479,21 +650,16 @@ void DiskStorage::DiskAccessor::LoadVerticesFromLabelIndexStorageToEdgeImportCac
   rocksdb::Slice ts(strTs);
   ro.timestamp = &ts;
   auto it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
-  std::string label_prefix{utils::SerializeIdType(label)};
 
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
-    std::string value = it->value().ToString();
-    if (key.starts_with(label_prefix)) {
-      storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelIndexStorage(key)));
-      if (ObjectExistsInCache(cache_accessor, gid)) continue;
+  ForEachIndexEntry(it.get(), utils::SerializeIdType(label) + "|", [&](std::string &&key, std::string &&value) {
+    storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelIndexStorage(key)));
+    if (ObjectExistsInCache(cache_accessor, gid)) return;
 
-      std::vector<LabelId> labels_id{utils::DeserializeLabelsFromLabelIndexStorage(key, value)};
-      PropertyStore properties{utils::DeserializePropertiesFromLabelIndexStorage(value)};
-      CreateVertexFromDisk(cache_accessor, gid, std::move(labels_id), std::move(properties),
-                           CreateDeleteDeserializedObjectDelta(&transaction_, std::move(key), deserializeTimestamp));
-    }
-  }
+    std::vector<LabelId> labels_id{utils::DeserializeLabelsFromLabelIndexStorage(key, value)};
+    PropertyStore properties{utils::DeserializePropertiesFromLabelIndexStorage(value)};
+    CreateVertexFromDisk(cache_accessor, gid, std::move(labels_id), std::move(properties),
+                         CreateDeleteDeserializedObjectDelta(&transaction_, std::move(key), deserializeTimestamp));
+  });
 }
 
 void DiskStorage::DiskAccessor::HandleLoadingLabelForEdgeImportCache(LabelId label) {
@@ -534,20 +700,17 @@ void DiskStorage::DiskAccessor::LoadVerticesFromLabelPropertyIndexStorageToEdgeI
   ro.timestamp = &ts;
   auto it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
 
-  const std::string label_property_prefix = utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property);
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    std::string key = it->key().ToString();
-    std::string value = it->value().ToString();
-    if (key.starts_with(label_property_prefix)) {
-      storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelPropertyIndexStorage(key)));
-      if (ObjectExistsInCache(cache_accessor, gid)) continue;
+  const std::string label_property_prefix =
+      utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property) + "|";
+  ForEachIndexEntry(it.get(), label_property_prefix, [&](std::string &&key, std::string &&value) {
+    storage::Gid gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelPropertyIndexStorage(key)));
+    if (ObjectExistsInCache(cache_accessor, gid)) return;
 
-      std::vector<LabelId> labels_id{utils::DeserializeLabelsFromLabelPropertyIndexStorage(key, value)};
-      PropertyStore properties{utils::DeserializePropertiesFromLabelPropertyIndexStorage(value)};
-      CreateVertexFromDisk(cache_accessor, gid, std::move(labels_id), std::move(properties),
-                           CreateDeleteDeserializedObjectDelta(&transaction_, std::move(key), deserializeTimestamp));
-    }
-  }
+    std::vector<LabelId> labels_id{utils::DeserializeLabelsFromLabelPropertyIndexStorage(key, value)};
+    PropertyStore properties{utils::DeserializePropertiesFromLabelPropertyIndexStorage(value)};
+    CreateVertexFromDisk(cache_accessor, gid, std::move(labels_id), std::move(properties),
+                         CreateDeleteDeserializedObjectDelta(&transaction_, std::move(key), deserializeTimestamp));
+  });
 }
 
 VerticesIterable DiskStorage::DiskAccessor::Vertices(View view) {
@@ -559,15 +722,11 @@ VerticesIterable DiskStorage::DiskAccessor::Vertices(View view) {
                                                 &transaction_, view, &storage_->indices_, &storage_->constraints_,
                                                 storage_->config_.items));
   }
-  if (scanned_all_vertices_) {
-    return VerticesIterable(AllVerticesIterable(vertices_.access(), &transaction_, view, &storage_->indices_,
-                                                &storage_->constraints_, storage_->config_.items));
-  }
-
-  LoadVerticesToMainMemoryCache();
-  scanned_all_vertices_ = true;
-  return VerticesIterable(AllVerticesIterable(vertices_.access(), &transaction_, view, &storage_->indices_,
-                                              &storage_->constraints_, storage_->config_.items));
+  // The vertices are loaded from the disk as they are iterated, so a scan
+  // which stops early doesn't read the rest of them.
+  return VerticesIterable(DiskAllVerticesIterable(
+      [this]() -> std::unique_ptr<DiskAllVerticesIterable::Cursor> { return std::make_unique<MainStorageCursor>(this); },
+      vertices_.access(), &transaction_, view, &storage_->indices_, &storage_->constraints_, storage_->config_.items));
 }
 
 VerticesIterable DiskStorage::DiskAccessor::Vertices(LabelId label, View view) {
@@ -723,20 +882,19 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelIndex(LabelId label,
   ro.timestamp = &ts;
   auto index_it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
 
-  const auto serialized_label = utils::SerializeIdType(label);
-  for (index_it->SeekToFirst(); index_it->Valid(); index_it->Next()) {
-    std::string key = index_it->key().ToString();
+  ForEachIndexEntry(index_it.get(), utils::SerializeIdType(label) + "|", [&](std::string &&key, std::string &&value) {
     Gid curr_gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelIndexStorage(key)));
     spdlog::trace("Loaded vertex with key: {} from label index storage", key);
-    if (key.starts_with(serialized_label) && !utils::Contains(gids, curr_gid)) {
+    if (!utils::Contains(gids, curr_gid)) {
       // We should pass it->timestamp().ToString() instead of "0"
       // This is hack until RocksDB will support timestamp() in WBWI iterator
+      std::string index_key = key;
       LoadVertexToLabelIndexCache(
-          index_it->key().ToString(), index_it->value().ToString(),
+          std::move(index_key), std::move(value),
           CreateDeleteDeserializedIndexObjectDelta(index_deltas, std::move(key), deserializeTimestamp),
           indexed_vertices->access());
     }
-  }
+  });
 }
 
 std::unordered_set<Gid> DiskStorage::DiskAccessor::MergeVerticesFromMainCacheWithLabelPropertyIndexCache(
@@ -778,19 +936,19 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndex(LabelId l
   auto index_it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
 
   const auto label_property_prefix = utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property);
-  for (index_it->SeekToFirst(); index_it->Valid(); index_it->Next()) {
-    std::string key = index_it->key().ToString();
+  ForEachIndexEntry(index_it.get(), label_property_prefix + "|", [&](std::string &&key, std::string &&value) {
     Gid curr_gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelPropertyIndexStorage(key)));
     /// TODO: optimize
     if (label_property_filter(key, label_property_prefix, gids, curr_gid)) {
       // We should pass it->timestamp().ToString() instead of "0"
       // This is hack until RocksDB will support timestamp() in WBWI iterator
+      std::string index_key = key;
       LoadVertexToLabelPropertyIndexCache(
-          index_it->key().ToString(), index_it->value().ToString(),
+          std::move(index_key), std::move(value),
           CreateDeleteDeserializedIndexObjectDelta(index_deltas, std::move(key), deserializeTimestamp),
           indexed_vertices->access());
     }
-  }
+  });
 }
 
 void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndexWithPointValueLookup(
@@ -806,23 +964,22 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndexWithPointV
   ro.timestamp = &ts;
   auto index_it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
 
-  const auto label_property_prefix = utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property);
-  for (index_it->SeekToFirst(); index_it->Valid(); index_it->Next()) {
-    std::string key = index_it->key().ToString();
-    std::string it_value = index_it->value().ToString();
+  const auto label_property_prefix =
+      utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property) + "|";
+  ForEachIndexEntry(index_it.get(), label_property_prefix, [&](std::string &&key, std::string &&it_value) {
     Gid curr_gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelPropertyIndexStorage(key)));
     /// TODO: optimize
     PropertyStore properties = utils::DeserializePropertiesFromLabelPropertyIndexStorage(it_value);
-    if (key.starts_with(label_property_prefix) && !utils::Contains(gids, curr_gid) &&
-        properties.IsPropertyEqual(property, value)) {
+    if (!utils::Contains(gids, curr_gid) && properties.IsPropertyEqual(property, value)) {
       // We should pass it->timestamp().ToString() instead of "0"
       // This is hack until RocksDB will support timestamp() in WBWI iterator
+      std::string index_key = key;
       LoadVertexToLabelPropertyIndexCache(
-          index_it->key().ToString(), index_it->value().ToString(),
+          std::move(index_key), std::move(it_value),
           CreateDeleteDeserializedIndexObjectDelta(index_deltas, std::move(key), deserializeTimestamp),
           indexed_vertices->access());
     }
-  }
+  });
 }
 
 std::unordered_set<Gid>
@@ -865,26 +1022,25 @@ void DiskStorage::DiskAccessor::LoadVerticesFromDiskLabelPropertyIndexForInterva
   ro.timestamp = &ts;
   auto index_it = std::unique_ptr<rocksdb::Iterator>(disk_index_transaction->GetIterator(ro));
 
-  const std::string label_property_prefix = utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property);
-  for (index_it->SeekToFirst(); index_it->Valid(); index_it->Next()) {
-    std::string key_str = index_it->key().ToString();
-    std::string it_value_str = index_it->value().ToString();
+  const std::string label_property_prefix =
+      utils::SerializeIdType(label) + "|" + utils::SerializeIdType(property) + "|";
+  ForEachIndexEntry(index_it.get(), label_property_prefix, [&](std::string &&key_str, std::string &&it_value_str) {
     Gid curr_gid = Gid::FromUint(std::stoull(utils::ExtractGidFromLabelPropertyIndexStorage(key_str)));
     /// TODO: andi this will be optimized
     /// TODO: couple this condition
     PropertyStore properties = utils::DeserializePropertiesFromLabelPropertyIndexStorage(it_value_str);
     PropertyValue prop_value = properties.GetProperty(property);
-    if (!key_str.starts_with(label_property_prefix) || utils::Contains(gids, curr_gid) ||
-        !IsPropertyValueWithinInterval(prop_value, lower_bound, upper_bound)) {
-      continue;
+    if (utils::Contains(gids, curr_gid) || !IsPropertyValueWithinInterval(prop_value, lower_bound, upper_bound)) {
+      return;
     }
     // We should pass it->timestamp().ToString() instead of "0"
     // This is hack until RocksDB will support timestamp() in WBWI iterator
+    std::string index_key = key_str;
     LoadVertexToLabelPropertyIndexCache(
-        index_it->key().ToString(), index_it->value().ToString(),
+        std::move(index_key), std::move(it_value_str),
         CreateDeleteDeserializedIndexObjectDelta(index_deltas, std::move(key_str), deserializeTimestamp),
         indexed_vertices->access());
-  }
+  });
 }
 
 uint64_t DiskStorage::DiskAccessor::ApproximateVertexCount() const {
@@ -1012,7 +1168,7 @@ void DiskStorage::SetEdgeImportMode(EdgeImportMode edge_import_status) {
 }
 
 EdgeImportMode DiskStorage::GetEdgeImportMode() const {
-  std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
+  std::shared_lock<utils::ScalableRWLock> storage_guard_(main_lock_);
   return edge_import_status_;
 }
 
@@ -1042,7 +1198,7 @@ VertexAccessor DiskStorage::DiskAccessor::CreateVertexFromDisk(utils::SkipList<V
   auto [it, inserted] = accessor.insert(Vertex{gid, delta});
   MG_ASSERT(inserted, "The vertex must be inserted here!");
   MG_ASSERT(it != accessor.end(), "Invalid Vertex accessor!");
-  it->labels = std::move(label_ids);
+  it->labels.assign(label_ids.begin(), label_ids.end());
   it->properties = std::move(properties);
   delta->prev.Set(&*it);
   return {&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_};
@@ -1068,6 +1224,14 @@ std::optional<VertexAccessor> DiskStorage::DiskAccessor::FindVertex(storage::Gid
     }
   }
 
+  // Only vertices committed before the transaction started are cached, so a
+  // hit is the version the transaction would read from the disk.
+  auto &vertex_cache = disk_storage->vertex_cache_;
+  if (auto entry = vertex_cache.Find(gid, transaction_.start_timestamp)) {
+    return LoadVertexToMainMemoryCache(std::move(*entry));
+  }
+  const auto cache_token = vertex_cache.ReadToken(gid);
+
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -1077,9 +1241,12 @@ std::optional<VertexAccessor> DiskStorage::DiskAccessor::FindVertex(storage::Gid
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     if (Gid::FromUint(std::stoull(utils::ExtractGidFromKey(key))) == gid) {
-      // We should pass it->timestamp().ToString() instead of "0"
-      // This is hack until RocksDB will support timestamp() in WBWI iterator
-      return LoadVertexToMainMemoryCache(std::move(key), it->value().ToString(), deserializeTimestamp);
+      DiskVertexCache::Entry entry{.labels = utils::DeserializeLabelsFromMainDiskStorage(key),
+                                   .properties = it->value().ToString()};
+      entry.key = std::move(key);
+      vertex_cache.Insert(gid, cache_token, transaction_.start_timestamp, entry);
+      // The timestamp of the vertex isn't needed (see `MainStorageCursor::Next`).
+      return LoadVertexToMainMemoryCache(std::move(entry));
     }
   }
   return std::nullopt;
@@ -1125,57 +1292,261 @@ DiskStorage::DiskAccessor::DetachDelete(std::vector<VertexAccessor *> nodes, std
   return maybe_result;
 }
 
-bool DiskStorage::DiskAccessor::PrefetchEdgeFilter(const std::string_view disk_edge_key_str,
-                                                   const VertexAccessor &vertex_acc, EdgeDirection edge_direction) {
-  bool isOutEdge = (edge_direction == EdgeDirection::OUT);
-  DiskEdgeKey disk_edge_key(disk_edge_key_str);
-  auto edges_res = (isOutEdge ? vertex_acc.OutEdges(storage::View::NEW) : vertex_acc.InEdges(storage::View::NEW));
-  const std::string disk_vertex_gid = (isOutEdge ? disk_edge_key.GetVertexOutGid() : disk_edge_key.GetVertexInGid());
-  auto edge_gid = disk_edge_key.GetEdgeGid();
+bool DiskStorage::DiskAccessor::IsVertexLoaded(storage::Gid gid) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto acc = disk_storage->edge_import_status_ == EdgeImportMode::ACTIVE
+                 ? disk_storage->edge_import_mode_cache_->AccessToVertices()
+                 : vertices_.access();
+  if (acc.find(gid) != acc.end()) {
+    return true;
+  }
+  return std::any_of(index_storage_.begin(), index_storage_.end(), [gid](const auto &vec) {
+    auto index_acc = vec->access();
+    return index_acc.find(gid) != index_acc.end();
+  });
+}
 
-  if (disk_vertex_gid != utils::SerializeIdType(vertex_acc.Gid())) {
-    return false;
+void DiskStorage::DiskAccessor::LoadVerticesByGid(std::unordered_set<storage::Gid> gids) {
+  std::erase_if(gids, [this](storage::Gid gid) { return IsVertexLoaded(gid); });
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto &vertex_cache = disk_storage->vertex_cache_;
+  std::erase_if(gids, [&](storage::Gid gid) {
+    auto entry = vertex_cache.Find(gid, transaction_.start_timestamp);
+    if (entry) {
+      LoadVertexToMainMemoryCache(std::move(*entry));
+    }
+    return entry.has_value();
+  });
+  if (gids.empty()) {
+    return;
   }
 
-  // We need to search in edges_to_delete_ because removed edges are not presented in edges_res
-  if (auto edgeIt = edges_to_delete_.find(disk_edge_key.GetSerializedKey()); edgeIt != edges_to_delete_.end()) {
-    return false;
+  // The vertex keys start with the labels, so all missing vertices are read
+  // with a single scan instead of a scan per vertex.
+  const auto cache_tokens = vertex_cache.Enabled() ? vertex_cache.ReadTokens() : std::vector<uint64_t>{};
+  rocksdb::ReadOptions read_opts;
+  auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
+  rocksdb::Slice ts(strTs);
+  read_opts.timestamp = &ts;
+  auto it = std::unique_ptr<rocksdb::Iterator>(
+      disk_transaction_->GetIterator(read_opts, disk_storage->kvstore_->vertex_chandle));
+  for (it->SeekToFirst(); it->Valid() && !gids.empty(); it->Next()) {
+    std::string key = it->key().ToString();
+    const auto gid = Gid::FromUint(std::stoull(utils::ExtractGidFromKey(key)));
+    if (gids.erase(gid) == 0) {
+      continue;
+    }
+    DiskVertexCache::Entry entry{.labels = utils::DeserializeLabelsFromMainDiskStorage(key),
+                                 .properties = it->value().ToString()};
+    entry.key = std::move(key);
+    if (!cache_tokens.empty()) {
+      vertex_cache.Insert(gid, cache_tokens[DiskVertexCache::StripeIndex(gid)], transaction_.start_timestamp, entry);
+    }
+    LoadVertexToMainMemoryCache(std::move(entry));
   }
+}
 
-  MG_ASSERT(edges_res.HasValue());
-  auto edges_result = edges_res.GetValue();
-  bool isEdgeAlreadyInMemory =
-      std::any_of(edges_result.edges.begin(), edges_result.edges.end(),
-                  [edge_gid](const auto &edge_acc) { return utils::SerializeIdType(edge_acc.Gid()) == edge_gid; });
+void DiskStorage::DiskAccessor::ForEachIndexEntry(
+    rocksdb::Iterator *index_it, const std::string &prefix,
+    const std::function<void(std::string &&key, std::string &&value)> &callback) {
+  std::vector<std::pair<std::string, std::string>> batch;
+  auto flush_batch = [&]() {
+    // Reference entries have empty values, the covering ones always contain
+    // the separator of the labels and properties.
+    std::vector<Gid> referenced_gids;
+    for (const auto &[key, value] : batch) {
+      if (value.empty()) {
+        referenced_gids.push_back(Gid::FromUint(std::stoull(key.substr(key.find_last_of('|') + 1))));
+      }
+    }
+    auto vertices = ReadVerticesFromDisk(std::move(referenced_gids));
+    for (auto &[key, value] : batch) {
+      if (value.empty()) {
+        const auto vertex_it = vertices.find(Gid::FromUint(std::stoull(key.substr(key.find_last_of('|') + 1))));
+        const auto indexing_label = LabelId::FromUint(std::stoull(key.substr(0, key.find('|'))));
+        // The entry is stale if the vertex was deleted or lost the label.
+        if (vertex_it == vertices.end() || !utils::Contains(vertex_it->second.labels, indexing_label)) {
+          continue;
+        }
+        const auto &entry = vertex_it->second;
+        value = utils::SerializeVertexAsValueForAuxiliaryStorages(
+            indexing_label, entry.labels, utils::DeserializePropertiesFromMainDiskStorage(entry.properties));
+      }
+      callback(std::move(key), std::move(value));
+    }
+    batch.clear();
+  };
 
-  return !isEdgeAlreadyInMemory;
+  for (index_it->SeekToFirst(); index_it->Valid(); index_it->Next()) {
+    if (!index_it->key().starts_with(prefix)) {
+      continue;
+    }
+    batch.emplace_back(index_it->key().ToString(), index_it->value().ToString());
+    if (batch.size() >= kIndexEntriesBatchSize) {
+      flush_batch();
+    }
+  }
+  flush_batch();
 }
 
-void DiskStorage::DiskAccessor::PrefetchEdges(const VertexAccessor &vertex_acc, EdgeDirection edge_direction) {
+std::unordered_map<Gid, DiskVertexCache::Entry> DiskStorage::DiskAccessor::ReadVerticesFromDisk(
+    std::vector<Gid> gids) {
+  std::unordered_map<Gid, DiskVertexCache::Entry> vertices;
+  if (gids.empty()) {
+    return vertices;
+  }
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  auto &vertex_cache = disk_storage->vertex_cache_;
+  vertices.reserve(gids.size());
+  std::erase_if(gids, [&](Gid gid) {
+    auto entry = vertex_cache.Find(gid, transaction_.start_timestamp);
+    if (entry) {
+      vertices.emplace(gid, std::move(*entry));
+    }
+    return entry.has_value();
+  });
+  if (gids.empty()) {
+    return vertices;
+  }
+
+  // The vertex keys are ordered by their gids, so every vertex is found with
+  // a seek, in the order of the keys.
+  std::vector<std::string> serialized_gids;
+  serialized_gids.reserve(gids.size());
+  for (const auto gid : gids) {
+    serialized_gids.push_back(utils::SerializeIdType(gid));
+  }
+  std::sort(serialized_gids.begin(), serialized_gids.end());
+  const auto cache_tokens = vertex_cache.Enabled() ? vertex_cache.ReadTokens() : std::vector<uint64_t>{};
+  rocksdb::ReadOptions read_opts;
+  auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
+  rocksdb::Slice ts(strTs);
+  read_opts.timestamp = &ts;
+  auto it = std::unique_ptr<rocksdb::Iterator>(
+      disk_transaction_->GetIterator(read_opts, disk_storage->kvstore_->vertex_chandle));
+  for (const auto &serialized_gid : serialized_gids) {
+    it->Seek("|" + serialized_gid);
+    if (!it->Valid()) {
+      break;
+    }
+    std::string key = it->key().ToString();
+    if (utils::ExtractGidFromKey(key) != serialized_gid) {
+      continue;
+    }
+    const auto gid = Gid::FromUint(std::stoull(serialized_gid));
+    DiskVertexCache::Entry entry{.labels = utils::DeserializeLabelsFromMainDiskStorage(key),
+                                 .properties = it->value().ToString()};
+    entry.key = std::move(key);
+    if (!cache_tokens.empty()) {
+      vertex_cache.Insert(gid, cache_tokens[DiskVertexCache::StripeIndex(gid)], transaction_.start_timestamp, entry);
+    }
+    vertices.emplace(gid, std::move(entry));
+  }
+  return vertices;
+}
+
+void DiskStorage::DiskAccessor::PrefetchEdges(const std::vector<VertexAccessor> &vertices,
+                                              EdgeDirection edge_direction,
+                                              const std::vector<EdgeTypeId> &edge_types) {
+  if (vertices.empty()) {
+    return;
+  }
+  const bool is_out_edge = edge_direction == EdgeDirection::OUT;
+
+  // Edges which are already in memory, or deleted by the transaction, aren't
+  // loaded again.
+  std::unordered_map<std::string, std::unordered_set<std::string>> loaded_edges;
+  for (const auto &vertex_acc : vertices) {
+    auto [loaded_it, inserted] = loaded_edges.try_emplace(utils::SerializeIdType(vertex_acc.Gid()));
+    if (!inserted) continue;
+    auto edges_res = is_out_edge ? vertex_acc.OutEdges(storage::View::NEW) : vertex_acc.InEdges(storage::View::NEW);
+    MG_ASSERT(edges_res.HasValue());
+    for (const auto &edge_acc : edges_res->edges) {
+      loaded_it->second.insert(utils::SerializeIdType(edge_acc.Gid()));
+    }
+  }
+  auto should_load = [&](const DiskEdgeKey &disk_edge_key) {
+    const auto loaded_it =
+        loaded_edges.find(is_out_edge ? disk_edge_key.GetVertexOutGid() : disk_edge_key.GetVertexInGid());
+    return loaded_it != loaded_edges.end() && !loaded_it->second.contains(disk_edge_key.GetEdgeGid()) &&
+           !edges_to_delete_.contains(disk_edge_key.GetSerializedKey());
+  };
+
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction_.start_timestamp);
   rocksdb::Slice ts(strTs);
   read_opts.timestamp = &ts;
+  read_opts.prefix_same_as_start = true;
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   auto it = std::unique_ptr<rocksdb::Iterator>(
-      disk_transaction_->GetIterator(read_opts, disk_storage->kvstore_->edge_chandle));
-  for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    const rocksdb::Slice &key = it->key();
-    auto keyStr = key.ToStringView();
-    if (PrefetchEdgeFilter(keyStr, vertex_acc, edge_direction)) {
-      // We should pass it->timestamp().ToString() instead of deserializeTimestamp
-      // This is hack until RocksDB will support timestamp() in WBWI iterator
-      DeserializeEdge(key, it->value(), deserializeTimestamp);
+      disk_transaction_->GetIterator(read_opts, disk_storage->kvstore_->adjacency_chandle));
+
+  // The adjacency keys start with the vertex, direction and edge type, so the
+  // edges of a vertex are found with one prefix seek per edge type.
+  std::vector<std::string> prefixes;
+  for (const auto &[vertex_gid, _] : loaded_edges) {
+    const auto gid = Gid::FromUint(std::stoull(vertex_gid));
+    if (edge_types.empty()) {
+      prefixes.push_back(DiskAdjacencyKey::Prefix(gid, edge_direction));
+    }
+    for (const auto edge_type : edge_types) {
+      prefixes.push_back(DiskAdjacencyKey::Prefix(gid, edge_direction, edge_type));
     }
   }
+  std::vector<std::string> edges_to_load;
+  for (const auto &prefix : prefixes) {
+    for (it->Seek(prefix); it->Valid() && it->key().starts_with(prefix); it->Next()) {
+      auto disk_edge_key = DiskAdjacencyKey(it->key().ToStringView()).GetEdgeKey();
+      if (should_load(disk_edge_key)) {
+        edges_to_load.emplace_back(disk_edge_key.GetSerializedKey());
+      }
+    }
+  }
+  if (edges_to_load.empty()) {
+    return;
+  }
+
+  // Edge properties stay in the edge column family.
+  std::vector<rocksdb::Slice> keys(edges_to_load.begin(), edges_to_load.end());
+  std::vector<rocksdb::ColumnFamilyHandle *> column_families(keys.size(), disk_storage->kvstore_->edge_chandle);
+  std::vector<std::string> values;
+  const auto statuses = disk_transaction_->MultiGet(read_opts, column_families, keys, &values);
+
+  std::unordered_set<storage::Gid> endpoints;
+  for (const auto &key : edges_to_load) {
+    DiskEdgeKey disk_edge_key(key);
+    endpoints.insert(Gid::FromUint(std::stoull(disk_edge_key.GetVertexOutGid())));
+    endpoints.insert(Gid::FromUint(std::stoull(disk_edge_key.GetVertexInGid())));
+  }
+  LoadVerticesByGid(std::move(endpoints));
+
+  for (size_t i = 0; i < edges_to_load.size(); ++i) {
+    if (statuses[i].IsNotFound()) continue;
+    logging::AssertRocksDBStatus(statuses[i]);
+    const auto &key = edges_to_load[i];
+    const auto &value = values[i];
+    // We should pass it->timestamp().ToString() instead of deserializeTimestamp
+    // This is hack until RocksDB will support timestamp() in WBWI iterator
+    DeserializeEdge(key, value, deserializeTimestamp);
+  }
 }
 
 void DiskStorage::DiskAccessor::PrefetchInEdges(const VertexAccessor &vertex_acc) {
-  PrefetchEdges(vertex_acc, EdgeDirection::IN);
+  PrefetchEdges({vertex_acc}, EdgeDirection::IN, {});
 }
 
 void DiskStorage::DiskAccessor::PrefetchOutEdges(const VertexAccessor &vertex_acc) {
-  PrefetchEdges(vertex_acc, EdgeDirection::OUT);
+  PrefetchEdges({vertex_acc}, EdgeDirection::OUT, {});
+}
+
+void DiskStorage::DiskAccessor::PrefetchInEdges(const std::vector<VertexAccessor> &vertices,
+                                                const std::vector<EdgeTypeId> &edge_types) {
+  PrefetchEdges(vertices, EdgeDirection::IN, edge_types);
+}
+
+void DiskStorage::DiskAccessor::PrefetchOutEdges(const std::vector<VertexAccessor> &vertices,
+                                                 const std::vector<EdgeTypeId> &edge_types) {
+  PrefetchEdges(vertices, EdgeDirection::OUT, edge_types);
 }
 
 Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to,
@@ -1214,8 +1585,8 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdgeFromDisk(const VertexA
                                  edge);
   transaction_.AddModifiedEdge(gid, modified_edge);
 
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  AddVertexEdge(from_vertex->out_edges, {edge_type, to_vertex, edge});
+  AddVertexEdge(to_vertex->in_edges, {edge_type, from_vertex, edge});
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1251,10 +1622,10 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::CreateEdge(VertexAccessor *from,
   transaction_.AddModifiedEdge(gid, modified_edge);
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  AddVertexEdge(from_vertex->out_edges, {edge_type, to_vertex, edge});
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  AddVertexEdge(to_vertex->in_edges, {edge_type, from_vertex, edge});
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -1277,20 +1648,26 @@ Result<EdgeAccessor> DiskStorage::DiskAccessor::EdgeSetTo(EdgeAccessor * /*edge*
 
 /// TODO: at which storage naming
 /// TODO: this method should also delete the old key
-bool DiskStorage::DiskAccessor::WriteVertexToDisk(const Vertex &vertex) {
+bool DiskStorage::DiskAccessor::WriteVertexToDisk(Gid gid, const std::string &serialized_vertex_key,
+                                                  const std::string &serialized_vertex_value) {
   MG_ASSERT(commit_timestamp_.has_value(), "Writing vertex to disk but commit timestamp not set.");
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
-  auto status = disk_transaction_->Put(disk_storage->kvstore_->vertex_chandle, utils::SerializeVertex(vertex),
-                                       utils::SerializeProperties(vertex.properties));
+  if (sst_ingestion_) {
+    sst_ingestion_->Put(disk_storage->kvstore_->vertex_chandle, serialized_vertex_key, serialized_vertex_value);
+    written_vertices_.push_back(gid);
+    return true;
+  }
+  auto status =
+      disk_transaction_->Put(disk_storage->kvstore_->vertex_chandle, serialized_vertex_key, serialized_vertex_value);
   if (status.ok()) {
-    spdlog::trace("rocksdb: Saved vertex with key {} and ts {}", utils::SerializeVertex(vertex), *commit_timestamp_);
+    written_vertices_.push_back(gid);
+    spdlog::trace("rocksdb: Saved vertex with key {} and ts {}", serialized_vertex_key, *commit_timestamp_);
   } else if (status.IsBusy()) {
     spdlog::error("rocksdb: Vertex with key {} and ts {} was changed and committed in another transaction",
-                  utils::SerializeVertex(vertex), *commit_timestamp_);
+                  serialized_vertex_key, *commit_timestamp_);
     return false;
   } else {
-    spdlog::error("rocksdb: Failed to save vertex with key {} and ts {}", utils::SerializeVertex(vertex),
-                  *commit_timestamp_);
+    spdlog::error("rocksdb: Failed to save vertex with key {} and ts {}", serialized_vertex_key, *commit_timestamp_);
     return false;
   }
   return true;
@@ -1301,8 +1678,22 @@ bool DiskStorage::DiskAccessor::WriteEdgeToDisk(const std::string &serialized_ed
                                                 const std::string &serialized_edge_value) {
   MG_ASSERT(commit_timestamp_.has_value(), "Writing vertex to disk but commit timestamp not set.");
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  const DiskEdgeKey disk_edge_key(serialized_edge_key);
+  if (sst_ingestion_) {
+    sst_ingestion_->Put(disk_storage->kvstore_->edge_chandle, serialized_edge_key, serialized_edge_value);
+    for (const auto direction : {EdgeDirection::OUT, EdgeDirection::IN}) {
+      sst_ingestion_->Put(disk_storage->kvstore_->adjacency_chandle,
+                          DiskAdjacencyKey(disk_edge_key, direction).GetSerializedKey(), "");
+    }
+    return true;
+  }
   rocksdb::Status status =
       disk_transaction_->Put(disk_storage->kvstore_->edge_chandle, serialized_edge_key, serialized_edge_value);
+  for (const auto direction : {EdgeDirection::OUT, EdgeDirection::IN}) {
+    if (!status.ok()) break;
+    status = disk_transaction_->Put(disk_storage->kvstore_->adjacency_chandle,
+                                    DiskAdjacencyKey(disk_edge_key, direction).GetSerializedKey(), rocksdb::Slice());
+  }
   if (status.ok()) {
     spdlog::trace("rocksdb: Saved edge with key {} and ts {}", serialized_edge_key, *commit_timestamp_);
   } else if (status.IsBusy()) {
@@ -1316,10 +1707,51 @@ bool DiskStorage::DiskAccessor::WriteEdgeToDisk(const std::string &serialized_ed
   return true;
 }
 
+bool DiskStorage::DiskAccessor::CommitCanBeIngested(bool edge_import_mode_active) {
+  auto *disk_storage = static_cast<DiskStorage *>(storage_);
+  const auto min_objects = disk_storage->config_.disk.sst_ingestion_min_objects;
+  if (min_objects == 0 || !edges_to_delete_.empty() || !vertices_to_delete_.empty()) {
+    return false;
+  }
+
+  uint64_t objects = 0;
+  for (const auto &[_, modified_edge] : transaction_.modified_edges_) {
+    if (modified_edge.delta_action != Delta::Action::DELETE_OBJECT) {
+      return false;
+    }
+    ++objects;
+  }
+  if (edge_import_mode_active) {
+    return objects >= min_objects;
+  }
+
+  // Vertices read from the disk are ingested only if they don't change.
+  auto vertices_can_be_ingested = [&objects](const auto &vertex_acc) {
+    for (const Vertex &vertex : vertex_acc) {
+      if (!VertexNeedsToBeSerialized(vertex)) continue;
+      if (vertex.deleted || utils::GetOldDiskKeyOrNull(vertex.delta).has_value()) {
+        return false;
+      }
+      ++objects;
+    }
+    return true;
+  };
+  if (!vertices_can_be_ingested(vertices_.access())) {
+    return false;
+  }
+  for (const auto &vec : index_storage_) {
+    if (!vertices_can_be_ingested(vec->access())) {
+      return false;
+    }
+  }
+  return objects >= min_objects;
+}
+
 bool DiskStorage::DiskAccessor::DeleteVertexFromDisk(const std::string &vertex) {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   auto status = disk_transaction_->Delete(disk_storage->kvstore_->vertex_chandle, vertex);
   if (status.ok()) {
+    written_vertices_.push_back(Gid::FromUint(std::stoull(utils::ExtractGidFromKey(vertex))));
     spdlog::trace("rocksdb: Deleted vertex with key {}", vertex);
   } else if (status.IsBusy()) {
     spdlog::error("rocksdb: Vertex with key {} was changed and committed in another transaction", vertex);
@@ -1334,6 +1766,12 @@ bool DiskStorage::DiskAccessor::DeleteVertexFromDisk(const std::string &vertex)
 bool DiskStorage::DiskAccessor::DeleteEdgeFromDisk(const std::string &edge) {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   auto status = disk_transaction_->Delete(disk_storage->kvstore_->edge_chandle, edge);
+  const DiskEdgeKey disk_edge_key(edge);
+  for (const auto direction : {EdgeDirection::OUT, EdgeDirection::IN}) {
+    if (!status.ok()) break;
+    status = disk_transaction_->Delete(disk_storage->kvstore_->adjacency_chandle,
+                                       DiskAdjacencyKey(disk_edge_key, direction).GetSerializedKey());
+  }
   if (status.ok()) {
     spdlog::trace("rocksdb: Deleted edge with key {}", edge);
   } else if (status.IsBusy()) {
@@ -1347,16 +1785,17 @@ bool DiskStorage::DiskAccessor::DeleteEdgeFromDisk(const std::string &edge) {
 }
 
 [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void>
-DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
-    const Vertex &vertex, std::vector<std::vector<PropertyValue>> &unique_storage) const {
-  if (auto existence_constraint_validation_result = storage_->constraints_.existence_constraints_->Validate(vertex);
-      existence_constraint_validation_result.has_value()) {
-    return StorageDataManipulationError{existence_constraint_validation_result.value()};
+DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(const std::vector<const Vertex *> &vertices) const {
+  for (const Vertex *vertex : vertices) {
+    if (auto existence_constraint_validation_result = storage_->constraints_.existence_constraints_->Validate(*vertex);
+        existence_constraint_validation_result.has_value()) {
+      return StorageDataManipulationError{existence_constraint_validation_result.value()};
+    }
   }
 
   auto *disk_unique_constraints =
       static_cast<DiskUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
-  if (auto unique_constraint_validation_result = disk_unique_constraints->Validate(vertex, unique_storage);
+  if (auto unique_constraint_validation_result = disk_unique_constraints->Validate(vertices);
       unique_constraint_validation_result.has_value()) {
     return StorageDataManipulationError{unique_constraint_validation_result.value()};
   }
@@ -1364,25 +1803,32 @@ DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
 }
 
 [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor::FlushVertices(
-    const auto &vertex_acc, std::vector<std::vector<PropertyValue>> &unique_storage) {
+    const auto &vertex_acc) {
   auto *disk_unique_constraints =
       static_cast<DiskUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
   auto *disk_label_index = static_cast<DiskLabelIndex *>(storage_->indices_.label_index_.get());
   auto *disk_label_property_index =
       static_cast<DiskLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
 
+  std::vector<const Vertex *> vertices;
   for (const Vertex &vertex : vertex_acc) {
-    if (!VertexNeedsToBeSerialized(vertex)) {
-      continue;
-    }
-    if (auto check_result = CheckVertexConstraintsBeforeCommit(vertex, unique_storage); check_result.HasError()) {
-      return check_result.GetError();
+    if (VertexNeedsToBeSerialized(vertex)) {
+      vertices.push_back(&vertex);
     }
+  }
+  if (auto check_result = CheckVertexConstraintsBeforeCommit(vertices); check_result.HasError()) {
+    return check_result.GetError();
+  }
+  std::erase_if(vertices, [](const Vertex *vertex) { return vertex->deleted; });
 
-    if (vertex.deleted) {
-      continue;
-    }
+  std::vector<std::pair<std::string, std::string>> serialized_vertices(vertices.size());
+  SerializeInParallel(vertices.size(), [&](size_t i) {
+    serialized_vertices[i] = {utils::SerializeVertex(*vertices[i]),
+                              utils::SerializeProperties(vertices[i]->properties)};
+  });
 
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    const Vertex &vertex = *vertices[i];
     /// NOTE: this deletion has to come before writing, otherwise RocksDB thinks that all entries are deleted
     if (auto maybe_old_disk_key = utils::GetOldDiskKeyOrNull(vertex.delta); maybe_old_disk_key.has_value()) {
       if (!DeleteVertexFromDisk(maybe_old_disk_key.value())) {
@@ -1390,7 +1836,8 @@ DiskStorage::DiskAccessor::CheckVertexConstraintsBeforeCommit(
       }
     }
 
-    if (!WriteVertexToDisk(vertex)) {
+    const auto &[serialized_key, serialized_value] = serialized_vertices[i];
+    if (!WriteVertexToDisk(vertex.gid, serialized_key, serialized_value)) {
       return StorageDataManipulationError{SerializationError{}};
     }
 
@@ -1423,10 +1870,8 @@ DiskStorage::DiskAccessor::ClearDanglingVertices() {
 }
 
 [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor::FlushIndexCache() {
-  std::vector<std::vector<PropertyValue>> unique_storage;
-
   for (const auto &vec : index_storage_) {
-    if (auto vertices_res = FlushVertices(vec->access(), unique_storage); vertices_res.HasError()) {
+    if (auto vertices_res = FlushVertices(vec->access()); vertices_res.HasError()) {
       return vertices_res.GetError();
     }
   }
@@ -1464,32 +1909,48 @@ DiskStorage::DiskAccessor::ClearDanglingVertices() {
 
 [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor::FlushModifiedEdges(
     const auto &edge_acc) {
-  for (const auto &modified_edge : transaction_.modified_edges_) {
-    const storage::Gid &gid = modified_edge.first;
-    const Delta::Action action = modified_edge.second.delta_action;
-    DiskEdgeKey disk_edge_key(modified_edge.second, config_.properties_on_edges);
-    const std::string &ser_edge_key = disk_edge_key.GetSerializedKey();
-
+  struct EdgeToFlush {
+    const ModifiedEdgeInfo *modified_edge;
+    // `nullptr` if properties on edges are disabled.
+    const Edge *edge;
+    std::string serialized_key;
+    std::string serialized_value;
+  };
+  std::vector<EdgeToFlush> edges;
+  edges.reserve(transaction_.modified_edges_.size());
+  for (const auto &[gid, modified_edge] : transaction_.modified_edges_) {
     if (!config_.properties_on_edges) {
       /// If the object was created then flush it, otherwise since properties on edges are false
       /// edge wasn't modified for sure.
-      if (action == Delta::Action::DELETE_OBJECT && !WriteEdgeToDisk(ser_edge_key, "")) {
-        return StorageDataManipulationError{SerializationError{}};
-      }
-    } else {
-      // If the delta is DELETE_OBJECT, the edge is just created so there is nothing to delete.
-      // If the edge was deserialized, only properties can be modified -> key stays the same as when deserialized
-      // so we can delete it.
-      if (action == Delta::Action::DELETE_DESERIALIZED_OBJECT && !DeleteEdgeFromDisk(ser_edge_key)) {
-        return StorageDataManipulationError{SerializationError{}};
+      if (modified_edge.delta_action == Delta::Action::DELETE_OBJECT) {
+        edges.push_back({&modified_edge, nullptr, {}, {}});
       }
+      continue;
+    }
+    const auto &edge = edge_acc.find(gid);
+    MG_ASSERT(edge != edge_acc.end(),
+              "Database in invalid state, commit not possible! Please restart your DB and start the import again.");
+    edges.push_back({&modified_edge, &*edge, {}, {}});
+  }
 
-      const auto &edge = edge_acc.find(gid);
-      MG_ASSERT(edge != edge_acc.end(),
-                "Database in invalid state, commit not possible! Please restart your DB and start the import again.");
-      if (!WriteEdgeToDisk(ser_edge_key, utils::SerializeProperties(edge->properties))) {
-        return StorageDataManipulationError{SerializationError{}};
-      }
+  SerializeInParallel(edges.size(), [&](size_t i) {
+    auto &edge = edges[i];
+    edge.serialized_key = DiskEdgeKey(*edge.modified_edge, config_.properties_on_edges).GetSerializedKey();
+    if (edge.edge != nullptr) {
+      edge.serialized_value = utils::SerializeProperties(edge.edge->properties);
+    }
+  });
+
+  for (const auto &edge : edges) {
+    // If the delta is DELETE_OBJECT, the edge is just created so there is nothing to delete.
+    // If the edge was deserialized, only properties can be modified -> key stays the same as when deserialized
+    // so we can delete it.
+    if (config_.properties_on_edges && edge.modified_edge->delta_action == Delta::Action::DELETE_DESERIALIZED_OBJECT &&
+        !DeleteEdgeFromDisk(edge.serialized_key)) {
+      return StorageDataManipulationError{SerializationError{}};
+    }
+    if (!WriteEdgeToDisk(edge.serialized_key, edge.serialized_value)) {
+      return StorageDataManipulationError{SerializationError{}};
     }
   }
   return {};
@@ -1556,18 +2017,37 @@ utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor
        std::all_of(transaction_.deltas.use().begin(), transaction_.deltas.use().end(),
                    [](const Delta &delta) { return delta.action == Delta::Action::DELETE_DESERIALIZED_OBJECT; }))) {
   } else {
+    // Waits for the compactions outside of the engine lock, so other
+    // transactions can start and read in the meantime.
+    if (const auto timeout = disk_storage->config_.disk.write_stall_timeout;
+        timeout.count() != 0 && !disk_storage->write_stall_listener_->WaitUntilWritesAreNormal(timeout)) {
+      spdlog::warn("rocksdb: Commit failed because the writes are stalled for more than {} ms.", timeout.count());
+      memgraph::metrics::IncrementCounter(memgraph::metrics::DiskCommitsFailedOnWriteStall);
+      Abort();
+      return StorageDataManipulationError{WriteStallError{}};
+    }
+
     std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
     commit_timestamp_.emplace(disk_storage->CommitTimestamp(desired_commit_timestamp));
     transaction_.commit_timestamp->store(*commit_timestamp_, std::memory_order_release);
 
+    if (CommitCanBeIngested(edge_import_mode_active)) {
+      // The new objects are sorted into SST files instead of going through
+      // the memtables, which is much faster for imports.
+      sst_ingestion_ = std::make_unique<DiskSstIngestion>(
+          disk_storage->kvstore_->db_,
+          disk_storage->config_.disk.main_storage_directory.string() + "_sst_ingestion_" +
+              std::to_string(*commit_timestamp_),
+          kSstIngestionSortMemoryBytes);
+    }
+
     if (edge_import_mode_active) {
       if (auto res = FlushModifiedEdges(disk_storage->edge_import_mode_cache_->AccessToEdges()); res.HasError()) {
         Abort();
         return res;
       }
     } else {
-      std::vector<std::vector<PropertyValue>> unique_storage;
-      if (auto vertices_flush_res = FlushVertices(vertices_.access(), unique_storage); vertices_flush_res.HasError()) {
+      if (auto vertices_flush_res = FlushVertices(vertices_.access()); vertices_flush_res.HasError()) {
         Abort();
         return vertices_flush_res.GetError();
       }
@@ -1597,6 +2077,20 @@ utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor
         return index_flush_res.GetError();
       }
     }
+
+    if (sst_ingestion_) {
+      auto status = sst_ingestion_->Ingest(*commit_timestamp_);
+      sst_ingestion_.reset();
+      if (!status.ok()) {
+        spdlog::error("rocksdb: SST ingestion failed with status {}", status.ToString());
+        Abort();
+        return StorageDataManipulationError{SerializationError{}};
+      }
+    }
+
+    // Transactions starting after the commit timestamp is released mustn't
+    // read the written vertices from the cache.
+    disk_storage->vertex_cache_.BeginInvalidation(written_vertices_);
   }
 
   if (commit_timestamp_) {
@@ -1606,8 +2100,21 @@ utils::BasicResult<StorageDataManipulationError, void> DiskStorage::DiskAccessor
   auto commitStatus = disk_transaction_->Commit();
   delete disk_transaction_;
   disk_transaction_ = nullptr;
+  if (commit_timestamp_) {
+    disk_storage->vertex_cache_.EndInvalidation(written_vertices_, *commit_timestamp_);
+    written_vertices_.clear();
+  }
+  // Transactions without writes have nothing to wait for if the writes
+  // became stalled in the meantime.
+  if (commitStatus.IsIncomplete() && !commit_timestamp_) {
+    commitStatus = rocksdb::Status::OK();
+  }
   if (!commitStatus.ok()) {
     spdlog::error("rocksdb: Commit failed with status {}", commitStatus.ToString());
+    if (commitStatus.IsIncomplete()) {
+      memgraph::metrics::IncrementCounter(memgraph::metrics::DiskCommitsFailedOnWriteStall);
+      return StorageDataManipulationError{WriteStallError{}};
+    }
     return StorageDataManipulationError{SerializationError{}};
   }
   spdlog::trace("rocksdb: Commit successful");
@@ -1631,12 +2138,16 @@ std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesF
     const std::string key_str = it->key().ToString();
     if (const std::vector<std::string> labels_str = utils::ExtractLabelsFromMainDiskStorage(key_str);
         utils::Contains(labels_str, serialized_label)) {
+      auto key = utils::SerializeVertexAsKeyForLabelIndex(utils::SerializeIdType(label),
+                                                          utils::ExtractGidFromMainDiskStorage(key_str));
+      if (config_.disk.reference_indices) {
+        vertices_to_be_indexed.emplace_back(std::move(key), std::string{});
+        continue;
+      }
       std::vector<LabelId> labels = utils::DeserializeLabelsFromMainDiskStorage(key_str);
       PropertyStore property_store = utils::DeserializePropertiesFromMainDiskStorage(it->value().ToStringView());
-      vertices_to_be_indexed.emplace_back(
-          utils::SerializeVertexAsKeyForLabelIndex(utils::SerializeIdType(label),
-                                                   utils::ExtractGidFromMainDiskStorage(key_str)),
-          utils::SerializeVertexAsValueForLabelIndex(label, labels, property_store));
+      vertices_to_be_indexed.emplace_back(std::move(key),
+                                          utils::SerializeVertexAsValueForLabelIndex(label, labels, property_store));
     }
   }
   return vertices_to_be_indexed;
@@ -1663,7 +2174,9 @@ std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesF
           utils::SerializeVertexAsKeyForLabelPropertyIndex(utils::SerializeIdType(label),
                                                            utils::SerializeIdType(property),
                                                            utils::ExtractGidFromMainDiskStorage(key_str)),
-          utils::SerializeVertexAsValueForLabelPropertyIndex(label, labels, property_store));
+          config_.disk.reference_indices
+              ? std::string{}
+              : utils::SerializeVertexAsValueForLabelPropertyIndex(label, labels, property_store));
     }
   }
   return vertices_to_be_indexed;
@@ -1734,6 +2247,7 @@ void DiskStorage::DiskAccessor::Abort() {
   disk_transaction_->ClearSnapshot();
   delete disk_transaction_;
   disk_transaction_ = nullptr;
+  sst_ingestion_.reset();
   is_transaction_active_ = false;
   UpdateObjectsCountOnAbort();
 }
@@ -1755,7 +2269,7 @@ void DiskStorage::DiskAccessor::FinalizeTransaction() {
 
 utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::CreateIndex(
     LabelId label, const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   auto *disk_label_index = static_cast<DiskLabelIndex *>(indices_.label_index_.get());
   if (!disk_label_index->CreateIndex(label, SerializeVerticesForLabelIndex(label))) {
@@ -1774,7 +2288,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::CreateIndex(
 
 utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::CreateIndex(
     LabelId label, PropertyId property, const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   auto *disk_label_property_index = static_cast<DiskLabelPropertyIndex *>(indices_.label_property_index_.get());
   if (!disk_label_property_index->CreateIndex(label, property,
@@ -1794,7 +2308,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::CreateIndex(
 
 utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
     LabelId label, const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   if (!indices_.label_index_->DropIndex(label)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
@@ -1812,7 +2326,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
 
 utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
     LabelId label, PropertyId property, const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   if (!indices_.label_property_index_->DropIndex(label, property)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
@@ -1830,7 +2344,7 @@ utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DropIndex(
 
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void> DiskStorage::CreateExistenceConstraint(
     LabelId label, PropertyId property, const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   if (constraints_.existence_constraints_->ConstraintExists(label, property)) {
     return StorageExistenceConstraintDefinitionError{ConstraintDefinitionError{}};
@@ -1865,7 +2379,7 @@ utils::BasicResult<StorageExistenceConstraintDroppingError, void> DiskStorage::D
 utils::BasicResult<StorageUniqueConstraintDefinitionError, UniqueConstraints::CreationStatus>
 DiskStorage::CreateUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
                                     const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
 
   auto *disk_unique_constraints = static_cast<DiskUniqueConstraints *>(constraints_.unique_constraints_.get());
 
@@ -1893,7 +2407,7 @@ DiskStorage::CreateUniqueConstraint(LabelId label, const std::set<PropertyId> &p
 utils::BasicResult<StorageUniqueConstraintDroppingError, UniqueConstraints::DeletionStatus>
 DiskStorage::DropUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
                                   const std::optional<uint64_t> /*desired_commit_timestamp*/) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
   auto ret = constraints_.unique_constraints_->DropConstraint(label, properties);
   if (ret != UniqueConstraints::DeletionStatus::SUCCESS) {
     return ret;
@@ -1928,7 +2442,7 @@ uint64_t DiskStorage::CommitTimestamp(const std::optional<uint64_t> desired_comm
   if (!desired_commit_timestamp) {
     return timestamp_++;
   }
-  timestamp_ = std::max(timestamp_, *desired_commit_timestamp + 1);
+  timestamp_ = std::max(timestamp_.load(), *desired_commit_timestamp + 1);
   return *desired_commit_timestamp;
 }
 
@@ -15,6 +15,8 @@
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/disk/edge_import_mode_cache.hpp"
 #include "storage/v2/disk/rocksdb_storage.hpp"
+#include "storage/v2/disk/sst_ingestion.hpp"
+#include "storage/v2/disk/vertex_cache.hpp"
 #include "storage/v2/edge_import_mode.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/isolation_level.hpp"
@@ -25,6 +27,8 @@
 
 #include <rocksdb/db.h>
 #include <rocksdb/slice.h>
+#include <functional>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace memgraph::storage {
@@ -46,8 +50,9 @@ class DiskStorage final : public Storage {
 
     explicit DiskAccessor(DiskStorage *storage, IsolationLevel isolation_level, StorageMode storage_mode);
 
-    /// TODO: const methods?
-    void LoadVerticesToMainMemoryCache();
+    /// Reads the vertices of the main disk storage visible to the transaction
+    /// and loads them into `vertices_`.
+    class MainStorageCursor;
 
     void LoadVerticesFromMainStorageToEdgeImportCache();
 
@@ -120,6 +125,56 @@ class DiskStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                              const std::vector<PropertyValue> & /*prefix*/,
+                              const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+                              const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/,
+                              View /*view*/) override {
+      throw utils::NotYetImplemented("Composite label-property indices are not implemented for DiskStorage.");
+    }
+
+    VerticesIterable Vertices(LabelId /*label*/, PropertyId /*property*/, TextMatch /*match*/,
+                              const std::string & /*pattern*/, View /*view*/) override {
+      throw utils::NotYetImplemented("Text indices are not implemented for DiskStorage.");
+    }
+
+    std::vector<std::pair<VertexAccessor, double>> TextSearch(LabelId /*label*/, PropertyId /*property*/,
+                                                              std::string_view /*query*/, uint64_t /*limit*/,
+                                                              View /*view*/) override {
+      throw utils::NotYetImplemented("Text indices are not implemented for DiskStorage.");
+    }
+
+    VerticesIterable Vertices(LabelId /*label*/, PropertyId /*property*/, const PointRegion & /*region*/,
+                              View /*view*/) override {
+      throw utils::NotYetImplemented("Point indices are not implemented for DiskStorage.");
+    }
+
+    std::vector<std::pair<VertexAccessor, double>> VectorSearch(LabelId /*label*/, PropertyId /*property*/,
+                                                                const std::vector<float> & /*query*/,
+                                                                uint64_t /*limit*/, VectorMetric /*metric*/,
+                                                                View /*view*/) override {
+      throw utils::NotYetImplemented("Vector indices are not implemented for DiskStorage.");
+    }
+
+    EdgesIterable Edges(EdgeTypeId /*edge_type*/, View /*view*/) override {
+      throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+    }
+
+    EdgesIterable Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/, View /*view*/) override {
+      throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+    }
+
+    EdgesIterable Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/, const PropertyValue & /*value*/,
+                        View /*view*/) override {
+      throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+    }
+
+    EdgesIterable Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                        const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+                        const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/, View /*view*/) override {
+      throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+    }
+
     uint64_t ApproximateVertexCount() const override;
 
     uint64_t ApproximateVertexCount(LabelId /*label*/) const override { return 10; }
@@ -137,6 +192,62 @@ class DiskStorage final : public Storage {
       return 10;
     }
 
+    uint64_t ApproximateVertexCount(LabelId /*label*/,
+                                    const std::vector<PropertyId> & /*properties*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                                    const std::vector<PropertyValue> & /*prefix*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                                    const std::vector<PropertyValue> & /*prefix*/,
+                                    const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
+                                    const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/, TextMatch /*match*/,
+                                    std::string_view /*pattern*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, PropertyId /*property*/,
+                                    const PointRegion & /*region*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/) const override { return 10; }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const override { return 10; }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                  const PropertyValue & /*value*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+                                  const std::optional<utils::Bound<PropertyValue>> & /*lower*/,
+                                  const std::optional<utils::Bound<PropertyValue>> & /*upper*/) const override {
+      return 10;
+    }
+
+    std::optional<uint64_t> VertexCount(LabelId /*label*/) const override { return std::nullopt; }
+
+    std::optional<uint64_t> EdgeCount(EdgeTypeId /*edge_type*/) const override { return std::nullopt; }
+
+    bool CanFindVertexByUniqueKey(LabelId /*label*/, const std::set<PropertyId> & /*properties*/) const override {
+      return false;
+    }
+
+    Result<std::optional<VertexAccessor>> FindVertexByUniqueKey(
+        LabelId /*label*/, const std::set<PropertyId> & /*properties*/,
+        const std::vector<PropertyValue> & /*values*/) override {
+      return std::optional<VertexAccessor>{};
+    }
+
     std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId & /*label*/) const override {
       return {};
     }
@@ -146,6 +257,11 @@ class DiskStorage final : public Storage {
       return {};
     }
 
+    std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+        const storage::LabelId & /*label*/, const std::vector<storage::PropertyId> & /*properties*/) const override {
+      return {};
+    }
+
     std::vector<LabelId> ClearLabelIndexStats() override {
       throw utils::NotYetImplemented("ClearIndexStats() is not implemented for DiskStorage.");
     }
@@ -172,6 +288,20 @@ class DiskStorage final : public Storage {
       throw utils::NotYetImplemented("SetIndexStats(stats) is not implemented for DiskStorage.");
     }
 
+    void SetIndexStats(const storage::LabelId & /*label*/, const std::vector<storage::PropertyId> & /*properties*/,
+                       const LabelPropertyIndexStats & /*stats*/) override {
+      throw utils::NotYetImplemented("SetIndexStats(stats) is not implemented for DiskStorage.");
+    }
+
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> ClearLabelPropertyCompositeIndexStats() override {
+      throw utils::NotYetImplemented("ClearIndexStats() is not implemented for DiskStorage.");
+    }
+
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> DeleteLabelPropertyCompositeIndexStats(
+        const std::span<std::string> /*labels*/) override {
+      throw utils::NotYetImplemented("DeleteIndexStatsForLabels(labels) is not implemented for DiskStorage.");
+    }
+
     Result<std::optional<std::pair<std::vector<VertexAccessor>, std::vector<EdgeAccessor>>>> DetachDelete(
         std::vector<VertexAccessor *> nodes, std::vector<EdgeAccessor *> edges, bool detach) override;
 
@@ -179,6 +309,12 @@ class DiskStorage final : public Storage {
 
     void PrefetchOutEdges(const VertexAccessor &vertex_acc) override;
 
+    void PrefetchInEdges(const std::vector<VertexAccessor> &vertices,
+                         const std::vector<EdgeTypeId> &edge_types) override;
+
+    void PrefetchOutEdges(const std::vector<VertexAccessor> &vertices,
+                          const std::vector<EdgeTypeId> &edge_types) override;
+
     Result<EdgeAccessor> CreateEdge(VertexAccessor *from, VertexAccessor *to, EdgeTypeId edge_type) override;
 
     Result<EdgeAccessor> EdgeSetFrom(EdgeAccessor *edge, VertexAccessor *new_from) override;
@@ -195,6 +331,25 @@ class DiskStorage final : public Storage {
       return disk_storage->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId /*label*/,
+                                           const std::vector<PropertyId> & /*properties*/) const override {
+      return false;
+    }
+
+    std::vector<std::vector<PropertyId>> LabelPropertyCompositeIndices(LabelId /*label*/) const override { return {}; }
+
+    bool EdgeTypeIndexExists(EdgeTypeId /*edge_type*/) const override { return false; }
+
+    bool EdgeTypePropertyIndexExists(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const override {
+      return false;
+    }
+
+    bool TextIndexExists(LabelId /*label*/, PropertyId /*property*/) const override { return false; }
+
+    bool PointIndexExists(LabelId /*label*/, PropertyId /*property*/) const override { return false; }
+
+    bool VectorIndexExists(LabelId /*label*/, PropertyId /*property*/) const override { return false; }
+
     IndicesInfo ListAllIndices() const override {
       auto *disk_storage = static_cast<DiskStorage *>(storage_);
       return disk_storage->ListAllIndices();
@@ -219,8 +374,8 @@ class DiskStorage final : public Storage {
         std::string &&key, std::string &&value, Delta *index_delta,
         utils::SkipList<storage::Vertex>::Accessor index_accessor);
 
-    std::optional<storage::VertexAccessor> LoadVertexToMainMemoryCache(std::string &&key, std::string &&value,
-                                                                       std::string &&ts);
+    std::optional<storage::VertexAccessor> LoadVertexToMainMemoryCache(DiskVertexCache::Entry &&entry);
+
     std::optional<storage::VertexAccessor> LoadVertexToLabelPropertyIndexCache(
         std::string &&key, std::string &&value, Delta *index_delta,
         utils::SkipList<storage::Vertex>::Accessor index_accessor);
@@ -232,9 +387,26 @@ class DiskStorage final : public Storage {
     VertexAccessor CreateVertexFromDisk(utils::SkipList<Vertex>::Accessor &accessor, storage::Gid gid,
                                         std::vector<LabelId> &&label_ids, PropertyStore &&properties, Delta *delta);
 
-    bool PrefetchEdgeFilter(const std::string_view disk_edge_key_str, const VertexAccessor &vertex_acc,
-                            EdgeDirection edge_direction);
-    void PrefetchEdges(const VertexAccessor &vertex_acc, EdgeDirection edge_direction);
+    /// Returns whether `FindVertex` finds the vertex without reading the disk.
+    bool IsVertexLoaded(storage::Gid gid);
+
+    /// Loads the vertices with the given gids into the vertex cache of the
+    /// transaction, reading the disk at most once.
+    void LoadVerticesByGid(std::unordered_set<storage::Gid> gids);
+
+    /// Calls `callback` with the key and value of every entry of an index
+    /// storage whose key starts with `prefix`. The vertices of reference
+    /// entries are read from the main storage in batches, so the callback
+    /// always gets the labels and properties in the value.
+    void ForEachIndexEntry(rocksdb::Iterator *index_it, const std::string &prefix,
+                           const std::function<void(std::string &&key, std::string &&value)> &callback);
+
+    /// Returns the vertices with the given gids as stored on the disk when
+    /// the transaction started, without loading them into the transaction.
+    std::unordered_map<storage::Gid, DiskVertexCache::Entry> ReadVerticesFromDisk(std::vector<storage::Gid> gids);
+
+    void PrefetchEdges(const std::vector<VertexAccessor> &vertices, EdgeDirection edge_direction,
+                       const std::vector<EdgeTypeId> &edge_types);
 
     Result<EdgeAccessor> CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to, EdgeTypeId edge_type,
                                             storage::Gid gid, std::string_view properties, std::string &&old_disk_key,
@@ -249,17 +421,21 @@ class DiskStorage final : public Storage {
 
     [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> FlushDeletedEdges();
 
-    [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> FlushVertices(
-        const auto &vertex_acc, std::vector<std::vector<PropertyValue>> &unique_storage);
+    [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> FlushVertices(const auto &vertex_acc);
 
     [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> FlushModifiedEdges(const auto &edge_acc);
 
     [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> ClearDanglingVertices();
 
     [[nodiscard]] utils::BasicResult<StorageDataManipulationError, void> CheckVertexConstraintsBeforeCommit(
-        const Vertex &vertex, std::vector<std::vector<PropertyValue>> &unique_storage) const;
+        const std::vector<const Vertex *> &vertices) const;
 
-    bool WriteVertexToDisk(const Vertex &vertex);
+    /// Returns whether the commit only creates objects, and enough of them to
+    /// be written with an SST ingestion instead of the RocksDB transaction.
+    bool CommitCanBeIngested(bool edge_import_mode_active);
+
+    bool WriteVertexToDisk(Gid gid, const std::string &serialized_vertex_key,
+                           const std::string &serialized_vertex_value);
     bool WriteEdgeToDisk(const std::string &serialized_edge_key, const std::string &serialized_edge_value);
     bool DeleteVertexFromDisk(const std::string &vertex);
     bool DeleteEdgeFromDisk(const std::string &edge);
@@ -275,8 +451,12 @@ class DiskStorage final : public Storage {
     Config::Items config_;
     std::unordered_set<std::string> edges_to_delete_;
     std::vector<std::pair<std::string, std::string>> vertices_to_delete_;
+    /// Gids of the vertices written or deleted by the commit, their cached
+    /// versions are invalidated.
+    std::vector<Gid> written_vertices_;
     rocksdb::Transaction *disk_transaction_;
-    bool scanned_all_vertices_ = false;
+    /// Set while a commit is written with an SST ingestion.
+    std::unique_ptr<DiskSstIngestion> sst_ingestion_;
   };
 
   std::unique_ptr<Storage::Accessor> Access(std::optional<IsolationLevel> override_isolation_level) override {
@@ -289,6 +469,8 @@ class DiskStorage final : public Storage {
 
   RocksDBStorage *GetRocksDBStorage() const { return kvstore_.get(); }
 
+  const DiskVertexCache &GetVertexCache() const { return vertex_cache_; }
+
   utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
       LabelId label, std::optional<uint64_t> desired_commit_timestamp) override;
 
@@ -301,6 +483,70 @@ class DiskStorage final : public Storage {
   utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
       LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
 
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+      std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Composite label-property indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+      std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Composite label-property indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId /*edge_type*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+      std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId /*edge_type*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId /*edge_type*/, PropertyId /*property*/,
+      std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Edge indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateTextIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Text indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropTextIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Text indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreatePointIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Point indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropPointIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Point indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateVectorIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Vector indices are not implemented for DiskStorage.");
+  }
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropVectorIndex(
+      LabelId /*label*/, PropertyId /*property*/, std::optional<uint64_t> /*desired_commit_timestamp*/) override {
+    throw utils::NotYetImplemented("Vector indices are not implemented for DiskStorage.");
+  }
+
   utils::BasicResult<StorageExistenceConstraintDefinitionError, void> CreateExistenceConstraint(
       LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
 
@@ -322,6 +568,9 @@ class DiskStorage final : public Storage {
  private:
   void LoadIndexInfoIfExists() const;
 
+  /// Adds the adjacency entries of all edges stored on the disk.
+  void BuildAdjacencyFromEdges();
+
   /// TODO (andi): Maybe good to separate these methods and durability kvstore into a separate class
   bool PersistLabelIndexCreation(LabelId label) const;
 
@@ -366,7 +615,7 @@ class DiskStorage final : public Storage {
 
   StorageInfo GetInfo() const override;
 
-  void FreeMemory(std::unique_lock<utils::RWLock> /*lock*/) override {}
+  void FreeMemory(std::unique_lock<utils::ScalableRWLock> /*lock*/) override {}
 
   void EstablishNewEpoch() override { throw utils::BasicException("Disk storage mode does not support replication."); }
 
@@ -389,6 +638,8 @@ class DiskStorage final : public Storage {
  private:
   std::unique_ptr<RocksDBStorage> kvstore_;
   std::unique_ptr<kvstore::KVStore> durability_kvstore_;
+  DiskVertexCache vertex_cache_;
+  std::shared_ptr<DiskWriteStallListener> write_stall_listener_{std::make_shared<DiskWriteStallListener>()};
 
   std::atomic<uint64_t> vertex_count_{0};
 };
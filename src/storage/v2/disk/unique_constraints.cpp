@@ -12,6 +12,7 @@
 #include "storage/v2/disk/unique_constraints.hpp"
 #include <rocksdb/utilities/transaction.h>
 #include <limits>
+#include <map>
 #include <optional>
 #include <tuple>
 #include "spdlog/spdlog.h"
@@ -61,6 +62,7 @@ DiskUniqueConstraints::DiskUniqueConstraints(const Config &config) {
   utils::EnsureDirOrDie(config.disk.unique_constraints_directory);
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
+  ApplyWorkloadProfile(kvstore_->options_, ColumnFamilyKind::INDEX, config.disk);
   logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                             config.disk.unique_constraints_directory, &kvstore_->db_));
 }
@@ -88,43 +90,30 @@ bool DiskUniqueConstraints::InsertConstraint(
   return status.ok();
 }
 
-std::optional<ConstraintViolation> DiskUniqueConstraints::Validate(
-    const Vertex &vertex, std::vector<std::vector<PropertyValue>> &unique_storage) const {
-  for (const auto &[constraint_label, constraint_properties] : constraints_) {
-    if (IsVertexUnderConstraint(vertex, constraint_label, constraint_properties)) {
-      if (auto vertex_check_result =
-              TestIfVertexSatisifiesUniqueConstraint(vertex, unique_storage, constraint_label, constraint_properties);
-          vertex_check_result.has_value()) {
-        return vertex_check_result.value();
+std::optional<ConstraintViolation> DiskUniqueConstraints::Validate(const std::vector<const Vertex *> &vertices) const {
+  // The property values of the vertices under each constraint, mapped to the
+  // vertex which has them.
+  std::map<std::pair<LabelId, std::set<PropertyId>>, std::map<std::vector<PropertyValue>, Gid>> constrained_values;
+  for (const Vertex *vertex : vertices) {
+    for (const auto &constraint : constraints_) {
+      const auto &[constraint_label, constraint_properties] = constraint;
+      if (!IsVertexUnderConstraint(*vertex, constraint_label, constraint_properties)) {
+        continue;
+      }
+      auto property_values = vertex->properties.ExtractPropertyValues(constraint_properties);
+      if (!property_values.has_value()) {
+        return ConstraintViolation{ConstraintViolation::Type::UNIQUE, constraint_label, constraint_properties};
+      }
+      auto [it, inserted] = constrained_values[constraint].try_emplace(std::move(*property_values), vertex->gid);
+      if (!inserted && it->second != vertex->gid) {
+        return ConstraintViolation{ConstraintViolation::Type::UNIQUE, constraint_label, constraint_properties};
       }
     }
   }
-  return std::nullopt;
-}
-
-std::optional<ConstraintViolation> DiskUniqueConstraints::TestIfVertexSatisifiesUniqueConstraint(
-    const Vertex &vertex, std::vector<std::vector<PropertyValue>> &unique_storage, const LabelId &constraint_label,
-    const std::set<PropertyId> &constraint_properties) const {
-  auto property_values = vertex.properties.ExtractPropertyValues(constraint_properties);
-
-  /// TODO: better naming. Is vertex unique
-  if (property_values.has_value() &&
-      VertexIsUnique(property_values.value(), unique_storage, constraint_label, constraint_properties, vertex.gid)) {
-    unique_storage.emplace_back(std::move(property_values.value()));
+  if (constrained_values.empty()) {
     return std::nullopt;
   }
 
-  return ConstraintViolation{ConstraintViolation::Type::UNIQUE, constraint_label, constraint_properties};
-}
-
-bool DiskUniqueConstraints::VertexIsUnique(const std::vector<PropertyValue> &property_values,
-                                           const std::vector<std::vector<PropertyValue>> &unique_storage,
-                                           const LabelId &constraint_label,
-                                           const std::set<PropertyId> &constraint_properties, const Gid gid) const {
-  if (utils::Contains(unique_storage, property_values)) {
-    return false;
-  }
-
   auto disk_transaction = std::unique_ptr<rocksdb::Transaction>(
       kvstore_->db_->BeginTransaction(rocksdb::WriteOptions(), rocksdb::TransactionOptions()));
   disk_transaction->SetReadTimestampForValidation(std::numeric_limits<uint64_t>::max());
@@ -136,14 +125,26 @@ bool DiskUniqueConstraints::VertexIsUnique(const std::vector<PropertyValue> &pro
   auto it = std::unique_ptr<rocksdb::Iterator>(disk_transaction->GetIterator(ro));
 
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
-    if (IsDifferentVertexWithSameConstraintLabel(it->key().ToString(), gid, constraint_label)) {
-      if (utils::DeserializePropertiesFromUniqueConstraintStorage(it->value().ToString())
-              .ExtractPropertyValues(constraint_properties) == property_values) {
-        return false;
+    const std::string key = it->key().ToString();
+    const LabelId label = utils::DeserializeConstraintLabelFromUniqueConstraintStorage(key);
+    std::optional<PropertyStore> properties;
+    for (auto constraint_it = constrained_values.lower_bound({label, {}});
+         constraint_it != constrained_values.end() && constraint_it->first.first == label; ++constraint_it) {
+      const auto &[constraint, values_to_gid] = *constraint_it;
+      if (!properties) {
+        properties = utils::DeserializePropertiesFromUniqueConstraintStorage(it->value().ToString());
+      }
+      auto property_values = properties->ExtractPropertyValues(constraint.second);
+      if (!property_values.has_value()) {
+        continue;
+      }
+      if (auto found = values_to_gid.find(*property_values);
+          found != values_to_gid.end() && IsDifferentVertexWithSameConstraintLabel(key, found->second, label)) {
+        return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, constraint.second};
       }
     }
   }
-  return true;
+  return std::nullopt;
 }
 
 bool DiskUniqueConstraints::ClearDeletedVertex(const std::string_view gid,
@@ -32,8 +32,9 @@ class DiskUniqueConstraints : public UniqueConstraints {
       LabelId label, const std::set<PropertyId> &properties,
       const std::vector<std::pair<std::string, std::string>> &vertices_under_constraint);
 
-  std::optional<ConstraintViolation> Validate(const Vertex &vertex,
-                                              std::vector<std::vector<PropertyValue>> &unique_storage) const;
+  /// Validates the vertices of a commit against each other and the vertices
+  /// stored on the disk, which are read only once for all of them.
+  std::optional<ConstraintViolation> Validate(const std::vector<const Vertex *> &vertices) const;
 
   [[nodiscard]] bool ClearDeletedVertex(std::string_view gid, uint64_t transaction_commit_timestamp) const;
 
@@ -65,14 +66,6 @@ class DiskUniqueConstraints : public UniqueConstraints {
       entries_for_deletion;
   std::set<std::pair<LabelId, std::set<PropertyId>>> constraints_;
   std::unique_ptr<RocksDBStorage> kvstore_;
-
-  [[nodiscard]] std::optional<ConstraintViolation> TestIfVertexSatisifiesUniqueConstraint(
-      const Vertex &vertex, std::vector<std::vector<PropertyValue>> &unique_storage, const LabelId &constraint_label,
-      const std::set<PropertyId> &constraint_properties) const;
-
-  bool VertexIsUnique(const std::vector<PropertyValue> &property_values,
-                      const std::vector<std::vector<PropertyValue>> &unique_storage, const LabelId &constraint_label,
-                      const std::set<PropertyId> &constraint_properties, Gid gid) const;
 };
 
 }  // namespace memgraph::storage
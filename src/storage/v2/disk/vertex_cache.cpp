@@ -0,0 +1,119 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/disk/vertex_cache.hpp"
+
+#include <algorithm>
+
+namespace memgraph::storage {
+
+namespace {
+
+// Approximate memory used by a cached vertex apart from its data.
+constexpr uint64_t kCachedVertexOverheadBytes = 128;
+
+}  // namespace
+
+DiskVertexCache::DiskVertexCache(uint64_t capacity_bytes) : shard_capacity_bytes_(capacity_bytes / kShards) {}
+
+uint64_t DiskVertexCache::ReadToken(Gid gid) const {
+  return stripes_[StripeIndex(gid)].generation.load(std::memory_order_acquire);
+}
+
+std::vector<uint64_t> DiskVertexCache::ReadTokens() const {
+  std::vector<uint64_t> tokens;
+  tokens.reserve(kStripes);
+  for (const auto &stripe : stripes_) {
+    tokens.push_back(stripe.generation.load(std::memory_order_acquire));
+  }
+  return tokens;
+}
+
+void DiskVertexCache::Insert(Gid gid, uint64_t token, uint64_t start_timestamp, Entry entry) {
+  if (!Enabled()) return;
+  const auto size_bytes =
+      kCachedVertexOverheadBytes + entry.key.size() + entry.properties.size() + entry.labels.size() * sizeof(LabelId);
+  if (size_bytes > shard_capacity_bytes_) return;
+
+  const auto stripe_index = StripeIndex(gid);
+  auto &stripe = stripes_[stripe_index];
+  auto &shard = ShardOf(stripe_index);
+  std::lock_guard guard(shard.lock);
+  if (stripe.pending_commits != 0 || stripe.generation.load(std::memory_order_relaxed) != token ||
+      stripe.max_commit_timestamp > start_timestamp) {
+    return;
+  }
+  Erase(shard, gid);
+  shard.lru.push_front({gid, std::move(entry), stripe.max_commit_timestamp, size_bytes});
+  shard.vertices.emplace(gid, shard.lru.begin());
+  shard.size_bytes += size_bytes;
+  while (shard.size_bytes > shard_capacity_bytes_) {
+    Erase(shard, shard.lru.back().gid);
+  }
+}
+
+std::optional<DiskVertexCache::Entry> DiskVertexCache::Find(Gid gid, uint64_t start_timestamp) {
+  if (!Enabled()) return std::nullopt;
+  auto &shard = ShardOf(StripeIndex(gid));
+  std::lock_guard guard(shard.lock);
+  auto it = shard.vertices.find(gid);
+  if (it == shard.vertices.end() || it->second->valid_from > start_timestamp) {
+    return std::nullopt;
+  }
+  shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+  return it->second->entry;
+}
+
+void DiskVertexCache::BeginInvalidation(const std::vector<Gid> &gids) {
+  if (!Enabled()) return;
+  for (const auto gid : gids) {
+    const auto stripe_index = StripeIndex(gid);
+    auto &stripe = stripes_[stripe_index];
+    auto &shard = ShardOf(stripe_index);
+    std::lock_guard guard(shard.lock);
+    ++stripe.pending_commits;
+    stripe.generation.fetch_add(1, std::memory_order_release);
+    Erase(shard, gid);
+  }
+}
+
+void DiskVertexCache::EndInvalidation(const std::vector<Gid> &gids, uint64_t commit_timestamp) {
+  if (!Enabled()) return;
+  for (const auto gid : gids) {
+    const auto stripe_index = StripeIndex(gid);
+    auto &stripe = stripes_[stripe_index];
+    auto &shard = ShardOf(stripe_index);
+    std::lock_guard guard(shard.lock);
+    --stripe.pending_commits;
+    stripe.max_commit_timestamp = std::max(stripe.max_commit_timestamp, commit_timestamp);
+    stripe.generation.fetch_add(1, std::memory_order_release);
+    Erase(shard, gid);
+  }
+}
+
+uint64_t DiskVertexCache::SizeBytes() const {
+  uint64_t size_bytes = 0;
+  for (const auto &shard : shards_) {
+    std::lock_guard guard(shard.lock);
+    size_bytes += shard.size_bytes;
+  }
+  return size_bytes;
+}
+
+void DiskVertexCache::Erase(Shard &shard, Gid gid) {
+  auto it = shard.vertices.find(gid);
+  if (it == shard.vertices.end()) return;
+  shard.size_bytes -= it->second->size_bytes;
+  shard.lru.erase(it->second);
+  shard.vertices.erase(it);
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,125 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+/// Size bounded LRU cache of committed vertices read from the main disk
+/// storage, shared by all transactions of a `DiskStorage`. It lets a
+/// transaction find a vertex by its gid without scanning the vertex column
+/// family.
+///
+/// Every gid maps to a stripe which counts the commits changing its vertices.
+/// A reader takes a token of the stripe before reading the vertex from the
+/// disk and the read vertex is only cached if no commit to the stripe started
+/// in the meantime. A cached vertex is only returned to transactions which
+/// started after all commits to its stripe.
+class DiskVertexCache final {
+ public:
+  struct Entry {
+    // The key of the vertex in the main disk storage.
+    std::string key;
+    std::vector<LabelId> labels;
+    // The serialized properties of the vertex.
+    std::string properties;
+  };
+
+  /// The cache is disabled if `capacity_bytes` is 0.
+  explicit DiskVertexCache(uint64_t capacity_bytes);
+
+  DiskVertexCache(const DiskVertexCache &) = delete;
+  DiskVertexCache &operator=(const DiskVertexCache &) = delete;
+  DiskVertexCache(DiskVertexCache &&) = delete;
+  DiskVertexCache &operator=(DiskVertexCache &&) = delete;
+  ~DiskVertexCache() = default;
+
+  bool Enabled() const { return shard_capacity_bytes_ != 0; }
+
+  /// Must be called before the vertex is read from the disk, the returned
+  /// token is passed to `Insert`.
+  uint64_t ReadToken(Gid gid) const;
+
+  /// Returns the tokens of all stripes, indexed by `StripeIndex`. Used before
+  /// scanning all vertices on the disk.
+  std::vector<uint64_t> ReadTokens() const;
+
+  static uint64_t StripeIndex(Gid gid) { return gid.AsUint() % kStripes; }
+
+  /// Caches the vertex read from the disk by a transaction with the given
+  /// start timestamp. Ignored if the vertex could have been changed since
+  /// `token` was taken or if the transaction can't see all commits to it.
+  void Insert(Gid gid, uint64_t token, uint64_t start_timestamp, Entry entry);
+
+  /// Returns the cached vertex if it's the one visible to a transaction with
+  /// the given start timestamp.
+  std::optional<Entry> Find(Gid gid, uint64_t start_timestamp);
+
+  /// Must be called before a commit changing the vertices with the given gids
+  /// is written to the disk, and must be followed by `EndInvalidation` once
+  /// the commit is written or has failed.
+  void BeginInvalidation(const std::vector<Gid> &gids);
+
+  void EndInvalidation(const std::vector<Gid> &gids, uint64_t commit_timestamp);
+
+  /// Returns the approximate memory used by the cached vertices.
+  uint64_t SizeBytes() const;
+
+ private:
+  static constexpr uint64_t kShards = 16;
+  static constexpr uint64_t kStripes = 4096;
+
+  struct CachedVertex {
+    Gid gid;
+    Entry entry;
+    // Transactions which started before this timestamp may see an older
+    // version of the vertex.
+    uint64_t valid_from;
+    uint64_t size_bytes;
+  };
+
+  // Stripe `i` is only changed under the lock of shard `i % kShards`.
+  struct Stripe {
+    std::atomic<uint64_t> generation{0};
+    uint64_t max_commit_timestamp{0};
+    uint64_t pending_commits{0};
+  };
+
+  struct Shard {
+    mutable std::mutex lock;
+    // The most recently used vertices are at the front.
+    std::list<CachedVertex> lru;
+    std::unordered_map<Gid, std::list<CachedVertex>::iterator> vertices;
+    uint64_t size_bytes{0};
+  };
+
+  Shard &ShardOf(uint64_t stripe_index) { return shards_[stripe_index % kShards]; }
+
+  static void Erase(Shard &shard, Gid gid);
+
+  uint64_t shard_capacity_bytes_;
+  std::array<Stripe, kStripes> stripes_;
+  std::array<Shard, kShards> shards_;
+};
+
+}  // namespace memgraph::storage
@@ -27,9 +27,15 @@
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
+#include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/point_index.hpp"
+#include "storage/v2/inmemory/text_index.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
+#include "storage/v2/inmemory/vector_index.hpp"
 #include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
@@ -86,7 +92,8 @@ std::vector<SnapshotDurabilityInfo> GetSnapshotFiles(const std::filesystem::path
       try {
         auto info = ReadSnapshotInfo(item.path());
         if (uuid.empty() || info.uuid == uuid) {
-          snapshot_files.emplace_back(item.path(), std::move(info.uuid), info.start_timestamp);
+          snapshot_files.emplace_back(item.path(), std::move(info.uuid), info.start_timestamp, info.incremental,
+                                      info.base_timestamp, info.previous_timestamp);
         }
       } catch (const RecoveryFailure &) {
         continue;
@@ -123,12 +130,85 @@ std::optional<std::vector<WalDurabilityInfo>> GetWalFiles(const std::filesystem:
   return std::move(wal_files);
 }
 
+namespace {
+
+// Returns the paths of the incremental snapshots based on the full snapshot
+// `base`, in the order in which they have to be applied. `snapshot_files` has
+// to be sorted.
+std::vector<std::filesystem::path> GetIncrementalSnapshots(const std::vector<SnapshotDurabilityInfo> &snapshot_files,
+                                                           const SnapshotDurabilityInfo &base) {
+  std::vector<std::filesystem::path> increments;
+  auto previous_timestamp = base.start_timestamp;
+  for (const auto &file : snapshot_files) {
+    if (!file.incremental || file.uuid != base.uuid || file.base_timestamp != base.start_timestamp) continue;
+    if (file.previous_timestamp != previous_timestamp) {
+      spdlog::warn("The incremental snapshot {} doesn't follow the snapshot before it, ignoring it and later ones.",
+                   file.path);
+      break;
+    }
+    increments.push_back(file.path);
+    previous_timestamp = file.start_timestamp;
+  }
+  return increments;
+}
+
+// Combines the data recovered from the snapshots before an incremental
+// snapshot with the data recovered from it.
+void CombineRecoveredSnapshots(RecoveredSnapshot *recovered_snapshot, RecoveredSnapshot increment) {
+  auto &recovery_info = recovered_snapshot->recovery_info;
+  recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, increment.recovery_info.next_vertex_id);
+  recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, increment.recovery_info.next_edge_id);
+  recovery_info.next_timestamp = increment.recovery_info.next_timestamp;
+  recovered_snapshot->snapshot_info = std::move(increment.snapshot_info);
+  recovered_snapshot->indices_constraints = std::move(increment.indices_constraints);
+}
+
+}  // namespace
+
 // Function used to recover all discovered indices and constraints. The
 // indices and constraints must be recovered after the data recovery is done
 // to ensure that the indices and constraints are consistent at the end of the
 // recovery process.
+namespace {
+
+// Splits the vertices into batches for the parallel index creation.
+std::vector<std::pair<Gid, uint64_t>> MakeVertexBatches(utils::SkipList<Vertex> *vertices, uint64_t batch_size) {
+  std::vector<std::pair<Gid, uint64_t>> vertex_batches;
+  batch_size = std::max(batch_size, uint64_t{1});
+  for (const auto &vertex : vertices->access()) {
+    if (vertex_batches.empty() || vertex_batches.back().second == batch_size) {
+      vertex_batches.emplace_back(vertex.gid, 0);
+    }
+    ++vertex_batches.back().second;
+  }
+  return vertex_batches;
+}
+
+// Hands the label and label+property indices over to the storage, which
+// creates them in the background.
+void DeferIndexRecovery(RecoveredIndicesAndConstraints *indices_constraints, Indices *indices) {
+  auto &pending = indices->pending_recovery_;
+  pending.label = std::exchange(indices_constraints->indices.label, {});
+  pending.label_property = std::exchange(indices_constraints->indices.label_property, {});
+  pending.label_property_stats = std::exchange(indices_constraints->indices.label_property_stats, {});
+}
+
+// Moves a snapshot or WAL file into the backup directory next to the directory
+// it's in, so that it isn't recovered anymore.
+void BackupFile(const std::filesystem::path &path) {
+  const auto backup_directory =
+      path.parent_path().parent_path() / kBackupDirectory / path.parent_path().filename();
+  utils::EnsureDirOrDie(backup_directory);
+  std::error_code error_code;
+  std::filesystem::rename(path, backup_directory / path.filename(), error_code);
+  MG_ASSERT(!error_code, "Couldn't move {} to {} because of: {}", path, backup_directory, error_code.message());
+}
+
+}  // namespace
+
 void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_constraints, Indices *indices,
                                   Constraints *constraints, utils::SkipList<Vertex> *vertices,
+                                  const Config::Items &items,
                                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
   spdlog::info("Recreating indices from metadata.");
   // Recover label indices.
@@ -151,7 +231,78 @@ void RecoverIndicesAndConstraints(const RecoveredIndicesAndConstraints &indices_
       throw RecoveryFailure("The label+property index must be created here!");
     spdlog::info("A label+property index is recreated from metadata.");
   }
+  for (const auto &[item, stats] : indices_constraints.indices.label_property_stats) {
+    // The index could have been dropped by a WAL file recovered after the snapshot.
+    if (mem_label_property_index->IndexExists(item.first, item.second)) {
+      mem_label_property_index->SetIndexStats(item, stats);
+    }
+  }
   spdlog::info("Label+property indices are recreated.");
+
+  // Recover label+property composite indices.
+  spdlog::info("Recreating {} label+property composite indices from metadata.",
+               indices_constraints.indices.label_property_composite.size());
+  auto *mem_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(indices->label_property_composite_index_.get());
+  for (const auto &item : indices_constraints.indices.label_property_composite) {
+    if (!mem_composite_index->CreateIndex(item.first, item.second, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The label+property composite index must be created here!");
+    spdlog::info("A label+property composite index is recreated from metadata.");
+  }
+  spdlog::info("Label+property composite indices are recreated.");
+
+  // Recover edge type and edge type+property indices.
+  spdlog::info("Recreating {} edge type indices from metadata.", indices_constraints.indices.edge_type.size());
+  auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(indices->edge_type_index_.get());
+  for (const auto &item : indices_constraints.indices.edge_type) {
+    if (!mem_edge_type_index->CreateIndex(item, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The edge type index must be created here!");
+    spdlog::info("An edge type index is recreated from metadata.");
+  }
+  spdlog::info("Edge type indices are recreated.");
+
+  spdlog::info("Recreating {} edge type+property indices from metadata.",
+               indices_constraints.indices.edge_type_property.size());
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(indices->edge_type_property_index_.get());
+  for (const auto &item : indices_constraints.indices.edge_type_property) {
+    if (!items.PropertiesOnEdges(item.first))
+      throw RecoveryFailure("The edge type+property index requires properties on the edges of its type!");
+    if (!mem_edge_type_property_index->CreateIndex(item.first, item.second, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The edge type+property index must be created here!");
+    spdlog::info("An edge type+property index is recreated from metadata.");
+  }
+  spdlog::info("Edge type+property indices are recreated.");
+
+  // Recover text indices.
+  spdlog::info("Recreating {} text indices from metadata.", indices_constraints.indices.text.size());
+  auto *mem_text_index = static_cast<InMemoryTextIndex *>(indices->text_index_.get());
+  for (const auto &item : indices_constraints.indices.text) {
+    if (!mem_text_index->CreateIndex(item.first, item.second, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The text index must be created here!");
+    spdlog::info("A text index is recreated from metadata.");
+  }
+  spdlog::info("Text indices are recreated.");
+
+  // Recover point indices.
+  spdlog::info("Recreating {} point indices from metadata.", indices_constraints.indices.point.size());
+  auto *mem_point_index = static_cast<InMemoryPointIndex *>(indices->point_index_.get());
+  for (const auto &item : indices_constraints.indices.point) {
+    if (!mem_point_index->CreateIndex(item.first, item.second, vertices->access(), parallel_exec_info))
+      throw RecoveryFailure("The point index must be created here!");
+    spdlog::info("A point index is recreated from metadata.");
+  }
+  spdlog::info("Point indices are recreated.");
+
+  // Recover vector indices.
+  spdlog::info("Recreating {} vector indices from metadata.", indices_constraints.indices.vector.size());
+  auto *mem_vector_index = static_cast<InMemoryVectorIndex *>(indices->vector_index_.get());
+  for (const auto &item : indices_constraints.indices.vector) {
+    if (!mem_vector_index->CreateIndex(item.first, item.second, vertices->access()))
+      throw RecoveryFailure("The vector index must be created here!");
+    spdlog::info("A vector index is recreated from metadata.");
+  }
+  spdlog::info("Vector indices are recreated.");
   spdlog::info("Indices are recreated.");
 
   spdlog::info("Recreating constraints from metadata.");
@@ -207,6 +358,23 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
 
   auto snapshot_files = GetSnapshotFiles(snapshot_directory);
 
+  // When recovering to a point in time, the files with later transactions are
+  // moved away if the storage will write new ones, so that they aren't
+  // recovered together with them on the next start.
+  const auto &recover_to_timestamp = config.durability.recover_to_timestamp;
+  const bool backup_later_files =
+      recover_to_timestamp && config.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED;
+  if (recover_to_timestamp) {
+    spdlog::info("Recovering the transactions committed at or before timestamp {}.", *recover_to_timestamp);
+    // A snapshot holds the transactions committed before its start timestamp.
+    std::erase_if(snapshot_files, [&](const auto &snapshot_file) {
+      if (snapshot_file.start_timestamp <= *recover_to_timestamp + 1) return false;
+      spdlog::info("Skipping snapshot {} because it has later transactions.", snapshot_file.path);
+      if (backup_later_files) BackupFile(snapshot_file.path);
+      return true;
+    });
+  }
+
   RecoveryInfo recovery_info;
   RecoveredIndicesAndConstraints indices_constraints;
   std::optional<uint64_t> snapshot_timestamp;
@@ -219,20 +387,52 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     *uuid = snapshot_files.back().uuid;
     std::optional<RecoveredSnapshot> recovered_snapshot;
     for (auto it = snapshot_files.rbegin(); it != snapshot_files.rend(); ++it) {
-      const auto &[path, file_uuid, _] = *it;
-      if (file_uuid != *uuid) {
+      const auto &snapshot_file = *it;
+      const auto &path = snapshot_file.path;
+      if (snapshot_file.uuid != *uuid) {
         spdlog::warn("The snapshot file {} isn't related to the latest snapshot file!", path);
         continue;
       }
-      spdlog::info("Starting snapshot recovery from {}.", path);
-      try {
-        recovered_snapshot = LoadSnapshot(path, vertices, edges, epoch_history, name_id_mapper, edge_count, config);
-        spdlog::info("Snapshot recovery successful!");
+      // Incremental snapshots are applied on top of their base snapshot.
+      if (snapshot_file.incremental) continue;
+
+      const auto increments = GetIncrementalSnapshots(snapshot_files, snapshot_file);
+      auto increments_to_apply = increments.size();
+      while (true) {
+        spdlog::info("Starting snapshot recovery from {}.", path);
+        try {
+          recovered_snapshot = LoadSnapshot(path, vertices, edges, epoch_history, name_id_mapper, edge_count, config);
+        } catch (const RecoveryFailure &e) {
+          spdlog::warn("Couldn't recover snapshot from {} because of: {}.", path, e.what());
+          break;
+        }
+        uint64_t applied = 0;
+        try {
+          for (; applied < increments_to_apply; ++applied) {
+            spdlog::info("Applying incremental snapshot {}.", increments[applied]);
+            CombineRecoveredSnapshots(&*recovered_snapshot,
+                                      LoadSnapshot(increments[applied], vertices, edges, epoch_history,
+                                                   name_id_mapper, edge_count, config));
+          }
+        } catch (const RecoveryFailure &e) {
+          // The failed snapshot cleared all loaded data, so the snapshots
+          // before it are loaded again.
+          spdlog::warn("Couldn't apply incremental snapshot {} because of: {}.", increments[applied], e.what());
+          recovered_snapshot.reset();
+          increments_to_apply = applied;
+          continue;
+        }
         break;
-      } catch (const RecoveryFailure &e) {
-        spdlog::warn("Couldn't recover snapshot from {} because of: {}.", path, e.what());
-        continue;
       }
+      if (!recovered_snapshot) continue;
+
+      if (increments_to_apply > 0) {
+        // The vertices changed since the batches of the full snapshot were read.
+        recovered_snapshot->recovery_info.vertex_batches =
+            MakeVertexBatches(vertices, config.durability.items_per_batch);
+      }
+      spdlog::info("Snapshot recovery successful!");
+      break;
     }
     MG_ASSERT(recovered_snapshot,
               "The database is configured to recover on startup, but couldn't "
@@ -248,8 +448,11 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
                                      ? std::make_optional(std::make_pair(recovery_info.vertex_batches,
                                                                          config.durability.recovery_thread_count))
                                      : std::nullopt;
-      RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices, par_exec_info);
-      return recovered_snapshot->recovery_info;
+      if (config.durability.background_index_recovery) DeferIndexRecovery(&indices_constraints, indices);
+      utils::Timer indices_timer;
+      RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices, config.items, par_exec_info);
+      recovery_info.durations.indices_constraints = indices_timer.Elapsed<std::chrono::microseconds>();
+      return recovery_info;
     }
   } else {
     spdlog::info("No snapshot file was found, collecting information from WAL directory {}.", wal_directory);
@@ -336,12 +539,20 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     std::optional<uint64_t> previous_seq_num;
     auto last_loaded_timestamp = snapshot_timestamp;
     spdlog::info("Trying to load WAL files.");
+    utils::Timer wal_timer;
     for (auto &wal_file : wal_files) {
       if (previous_seq_num && (wal_file.seq_num - *previous_seq_num) > 1) {
         LOG_FATAL("You are missing a WAL file with the sequence number {}!", *previous_seq_num + 1);
       }
       previous_seq_num = wal_file.seq_num;
 
+      if (recover_to_timestamp && wal_file.from_timestamp > *recover_to_timestamp) {
+        // The file isn't read at all.
+        spdlog::info("Skipping WAL file {} because it only has later transactions.", wal_file.path);
+        if (backup_later_files) BackupFile(wal_file.path);
+        continue;
+      }
+
       if (wal_file.epoch_id != *epoch_id) {
         // This way we skip WALs finalized only because of role change.
         // We can also set the last timestamp to 0 if last loaded timestamp
@@ -354,7 +565,8 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
       }
       try {
         auto info = LoadWal(wal_file.path, &indices_constraints, last_loaded_timestamp, vertices, edges, name_id_mapper,
-                            edge_count, config.items);
+                            edge_count, config.items, config.durability.recovery_thread_count,
+                            recover_to_timestamp);
         recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, info.next_vertex_id);
         recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, info.next_edge_id);
         recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, info.next_timestamp);
@@ -363,6 +575,9 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
       } catch (const RecoveryFailure &e) {
         LOG_FATAL("Couldn't recover WAL deltas from {} because of: {}", wal_file.path, e.what());
       }
+      if (backup_later_files && wal_file.to_timestamp > *recover_to_timestamp) {
+        BackupFile(wal_file.path);
+      }
 
       if (recovery_info.next_timestamp != 0) {
         last_loaded_timestamp.emplace(recovery_info.next_timestamp - 1);
@@ -371,11 +586,23 @@ std::optional<RecoveryInfo> RecoverData(const std::filesystem::path &snapshot_di
     // The sequence number needs to be recovered even though `LoadWal` didn't
     // load any deltas from that file.
     *wal_seq_num = *previous_seq_num + 1;
+    recovery_info.durations.wal = wal_timer.Elapsed<std::chrono::microseconds>();
 
     spdlog::info("All necessary WAL files are loaded successfully.");
   }
 
-  RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices);
+  // The WAL files changed the vertices, so the batches are made again.
+  std::optional<ParallelizedIndexCreationInfo> par_exec_info;
+  if (config.durability.allow_parallel_index_creation) {
+    auto vertex_batches = MakeVertexBatches(vertices, config.durability.items_per_batch);
+    if (!vertex_batches.empty()) {
+      par_exec_info.emplace(std::move(vertex_batches), config.durability.recovery_thread_count);
+    }
+  }
+  if (config.durability.background_index_recovery) DeferIndexRecovery(&indices_constraints, indices);
+  utils::Timer indices_timer;
+  RecoverIndicesAndConstraints(indices_constraints, indices, constraints, vertices, config.items, par_exec_info);
+  recovery_info.durations.indices_constraints = indices_timer.Elapsed<std::chrono::microseconds>();
 
   memgraph::metrics::Measure(memgraph::metrics::SnapshotRecoveryLatency_us,
                              std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
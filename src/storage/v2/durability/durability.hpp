@@ -37,12 +37,23 @@ void VerifyStorageDirectoryOwnerAndProcessUserOrDie(const std::filesystem::path
 
 // Used to capture the snapshot's data related to durability
 struct SnapshotDurabilityInfo {
-  explicit SnapshotDurabilityInfo(std::filesystem::path path, std::string uuid, const uint64_t start_timestamp)
-      : path(std::move(path)), uuid(std::move(uuid)), start_timestamp(start_timestamp) {}
+  explicit SnapshotDurabilityInfo(std::filesystem::path path, std::string uuid, const uint64_t start_timestamp,
+                                  const bool incremental = false, const uint64_t base_timestamp = 0,
+                                  const uint64_t previous_timestamp = 0)
+      : path(std::move(path)),
+        uuid(std::move(uuid)),
+        start_timestamp(start_timestamp),
+        incremental(incremental),
+        base_timestamp(base_timestamp),
+        previous_timestamp(previous_timestamp) {}
 
   std::filesystem::path path;
   std::string uuid;
   uint64_t start_timestamp;
+  // See `SnapshotInfo`.
+  bool incremental;
+  uint64_t base_timestamp;
+  uint64_t previous_timestamp;
 
   auto operator<=>(const SnapshotDurabilityInfo &) const = default;
 };
@@ -101,7 +112,7 @@ using ParallelizedIndexCreationInfo =
 /// @throw RecoveryFailure
 void RecoverIndicesAndConstraints(
     const RecoveredIndicesAndConstraints &indices_constraints, Indices *indices, Constraints *constraints,
-    utils::SkipList<Vertex> *vertices,
+    utils::SkipList<Vertex> *vertices, const Config::Items &items,
     const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info = std::nullopt);
 
 /// Recovers data either from a snapshot and/or WAL files.
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <optional>
 #include <set>
 #include <utility>
@@ -19,6 +20,7 @@
 
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -32,6 +34,16 @@ struct RecoveryInfo {
   std::optional<uint64_t> last_commit_timestamp;
 
   std::vector<std::pair<Gid /*first vertex gid*/, uint64_t /*batch size*/>> vertex_batches;
+
+  // Time spent in each phase of the recovery. The snapshot phases are only
+  // measured for full snapshots.
+  struct {
+    std::chrono::microseconds snapshot_edges{0};
+    std::chrono::microseconds snapshot_vertices{0};
+    std::chrono::microseconds snapshot_connectivity{0};
+    std::chrono::microseconds wal{0};
+    std::chrono::microseconds indices_constraints{0};
+  } durations;
 };
 
 /// Structure used to track indices and constraints during recovery.
@@ -39,6 +51,14 @@ struct RecoveredIndicesAndConstraints {
   struct {
     std::vector<LabelId> label;
     std::vector<std::pair<LabelId, PropertyId>> label_property;
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+    std::vector<EdgeTypeId> edge_type;
+    std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
+    std::vector<std::pair<LabelId, PropertyId>> text;
+    std::vector<std::pair<LabelId, PropertyId>> point;
+    std::vector<std::pair<LabelId, PropertyId>> vector;
+    // Statistics gathered by `ANALYZE GRAPH`.
+    std::vector<std::pair<std::pair<LabelId, PropertyId>, LabelPropertyIndexStats>> label_property_stats;
   } indices;
 
   struct {
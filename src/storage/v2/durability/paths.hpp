@@ -21,6 +21,12 @@ namespace memgraph::storage::durability {
 static const std::string kSnapshotDirectory{"snapshots"};
 static const std::string kWalDirectory{"wal"};
 static const std::string kBackupDirectory{".backup"};
+// Inside the snapshot directory, holds the parts of a snapshot which is being
+// written on multiple threads.
+static const std::string kSnapshotSegmentsDirectory{".segments"};
+// Inside the WAL directory, holds the empty files with preallocated space from
+// which new WAL files are made.
+static const std::string kWalPreallocatedDirectory{".preallocated"};
 static const std::string kLockFile{".lock"};
 static const std::string kReplicationDirectory{"replication"};
 
@@ -11,20 +11,43 @@
 
 #include "storage/v2/durability/serialization.hpp"
 
+#include <cstring>
+
+#include <zlib.h>
+
 #include "storage/v2/temporal.hpp"
 #include "utils/endian.hpp"
+#include "utils/logging.hpp"
 
 namespace memgraph::storage::durability {
 
+size_t EncodeVarint(uint64_t value, uint8_t *buffer) {
+  size_t size = 0;
+  while (value >= 0x80) {
+    buffer[size++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  buffer[size++] = static_cast<uint8_t>(value);
+  return size;
+}
+
 //////////////////////////
 // Encoder implementation.
 //////////////////////////
 
 namespace {
+// The size from which `FinishRecord` writes a compressed block.
+constexpr uint64_t kCompressedBlockSize = 1024 * 1024;
+
 void WriteSize(Encoder *encoder, uint64_t size) {
   size = utils::HostToLittleEndian(size);
   encoder->Write(reinterpret_cast<const uint8_t *>(&size), sizeof(size));
 }
+
+void WriteVarint(Encoder *encoder, uint64_t value) {
+  uint8_t buffer[kMaxVarintSize];
+  encoder->Write(buffer, EncodeVarint(value, buffer));
+}
 }  // namespace
 
 void Encoder::Initialize(const std::filesystem::path &path, const std::string_view magic, uint64_t version) {
@@ -44,7 +67,13 @@ void Encoder::Close() {
   }
 }
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+void Encoder::Write(const uint8_t *data, uint64_t size) {
+  if (compression_enabled_) {
+    compression_buffer_.insert(compression_buffer_.end(), data, data + size);
+    return;
+  }
+  file_.Write(data, size);
+}
 
 void Encoder::WriteMarker(Marker marker) {
   auto value = static_cast<uint8_t>(marker);
@@ -128,15 +157,45 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
       WriteUint(utils::MemcpyCast<uint64_t>(temporal_data.microseconds));
       break;
     }
+    case PropertyValue::Type::Point: {
+      const auto point = value.ValuePoint();
+      WriteMarker(Marker::TYPE_POINT);
+      WriteUint(static_cast<uint64_t>(point.crs));
+      WriteDouble(point.x);
+      WriteDouble(point.y);
+      WriteDouble(point.z);
+      break;
+    }
   }
 }
 
-uint64_t Encoder::GetPosition() { return file_.GetPosition(); }
+void Encoder::WriteCompactUint(uint64_t value) {
+  WriteMarker(Marker::TYPE_VARINT);
+  WriteVarint(this, value);
+}
 
-void Encoder::SetPosition(uint64_t position) { file_.SetPosition(utils::OutputFile::Position::SET, position); }
+void Encoder::WriteCompactString(const std::string_view value) {
+  WriteMarker(Marker::TYPE_COMPACT_STRING);
+  WriteVarint(this, value.size());
+  Write(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+}
+
+uint64_t Encoder::GetPosition() {
+  MG_ASSERT(compression_buffer_.empty(), "Position of a compressed encoder is undefined!");
+  return file_.GetPosition();
+}
+
+void Encoder::SetPosition(uint64_t position) {
+  MG_ASSERT(compression_buffer_.empty(), "Position of a compressed encoder is undefined!");
+  file_.SetPosition(utils::OutputFile::Position::SET, position);
+}
 
 void Encoder::Sync() { file_.Sync(); }
 
+void Encoder::Flush() { file_.Flush(); }
+
+void Encoder::SyncWithoutFlushing() { file_.SyncWithoutFlushing(); }
+
 void Encoder::Finalize() {
   file_.Sync();
   file_.Close();
@@ -152,6 +211,47 @@ std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return f
 
 size_t Encoder::GetSize() { return file_.GetSize(); }
 
+size_t Encoder::GetWrittenSize() { return file_.GetWrittenSize(); }
+
+bool Encoder::Preallocate(size_t size) { return file_.Preallocate(size); }
+
+bool Encoder::EnableDirectIO() { return file_.EnableDirectIO(); }
+
+void Encoder::SetWriteThrottle(utils::WriteThrottle *throttle) { file_.SetWriteThrottle(throttle); }
+
+void Encoder::SetSyncPriority(utils::WriteThrottle *throttle) { file_.SetSyncPriority(throttle); }
+
+void Encoder::EnableCompression() { compression_enabled_ = true; }
+
+void Encoder::DisableCompression() {
+  WriteCompressedBlock();
+  compression_enabled_ = false;
+}
+
+void Encoder::FinishRecord() {
+  if (compression_buffer_.size() >= kCompressedBlockSize) {
+    WriteCompressedBlock();
+  }
+}
+
+void Encoder::WriteCompressedBlock() {
+  if (compression_buffer_.empty()) return;
+  auto compressed_size = compressBound(compression_buffer_.size());
+  std::vector<uint8_t> compressed(compressed_size);
+  // The fastest level, WAL blocks are compressed on the commit path.
+  const auto status = compress2(compressed.data(), &compressed_size, compression_buffer_.data(),
+                                compression_buffer_.size(), Z_BEST_SPEED);
+  MG_ASSERT(status == Z_OK, "Couldn't compress durability block, zlib error {}!", status);
+  // The block header itself is written uncompressed.
+  compression_enabled_ = false;
+  WriteMarker(Marker::SECTION_COMPRESSED_BLOCK);
+  WriteUint(compression_buffer_.size());
+  WriteUint(compressed_size);
+  Write(compressed.data(), compressed_size);
+  compression_enabled_ = true;
+  compression_buffer_.clear();
+}
+
 //////////////////////////
 // Decoder implementation.
 //////////////////////////
@@ -172,10 +272,24 @@ std::optional<uint64_t> ReadSize(Decoder *decoder) {
   size = utils::LittleEndianToHost(size);
   return size;
 }
+
+std::optional<uint64_t> ReadVarint(Decoder *decoder) {
+  uint64_t value = 0;
+  for (uint64_t shift = 0; shift < 64; shift += 7) {
+    uint8_t byte;
+    if (!decoder->Read(&byte, sizeof(byte))) return std::nullopt;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return value;
+  }
+  return std::nullopt;
+}
 }  // namespace
 
-std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic) {
-  if (!file_.Open(path)) return std::nullopt;
+std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic,
+                                            utils::InputFile::Mode mode) {
+  block_.clear();
+  block_read_ = 0;
+  if (!file_.Open(path, mode)) return std::nullopt;
   std::string file_magic(magic.size(), '\0');
   if (!Read(reinterpret_cast<uint8_t *>(file_magic.data()), file_magic.size())) return std::nullopt;
   if (file_magic != magic) return std::nullopt;
@@ -184,11 +298,52 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (block_read_ < block_.size()) {
+    // Records are never split between blocks.
+    if (block_.size() - block_read_ < size) return false;
+    std::memcpy(data, block_.data() + block_read_, size);
+    block_read_ += size;
+    return true;
+  }
+  return file_.Read(data, size);
+}
+
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (block_read_ < block_.size()) {
+    if (block_.size() - block_read_ < size) return false;
+    std::memcpy(data, block_.data() + block_read_, size);
+    return true;
+  }
+  return file_.Peek(data, size);
+}
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+bool Decoder::ReadCompressedBlockIfNext() {
+  if (block_read_ < block_.size()) return true;
+  uint8_t value;
+  // The end of the file is handled by the caller.
+  if (!file_.Peek(&value, sizeof(value))) return true;
+  if (value != static_cast<uint8_t>(Marker::SECTION_COMPRESSED_BLOCK)) return true;
+
+  block_.clear();
+  block_read_ = 0;
+  block_position_ = file_.GetPosition();
+  if (!file_.Read(&value, sizeof(value))) return false;
+  auto uncompressed_size = ReadUint();
+  auto compressed_size = ReadUint();
+  if (!uncompressed_size || !compressed_size || *uncompressed_size == 0) return false;
+  std::vector<uint8_t> compressed(*compressed_size);
+  if (!file_.Read(compressed.data(), compressed.size())) return false;
+  std::vector<uint8_t> block(*uncompressed_size);
+  uLongf size = block.size();
+  if (uncompress(block.data(), &size, compressed.data(), compressed.size()) != Z_OK) return false;
+  if (size != block.size()) return false;
+  block_ = std::move(block);
+  return true;
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
+  if (!ReadCompressedBlockIfNext()) return std::nullopt;
   uint8_t value;
   if (!Peek(&value, sizeof(value))) return std::nullopt;
   auto marker = CastToMarker(value);
@@ -197,6 +352,7 @@ std::optional<Marker> Decoder::PeekMarker() {
 }
 
 std::optional<Marker> Decoder::ReadMarker() {
+  if (!ReadCompressedBlockIfNext()) return std::nullopt;
   uint8_t value;
   if (!Read(&value, sizeof(value))) return std::nullopt;
   auto marker = CastToMarker(value);
@@ -212,9 +368,17 @@ std::optional<bool> Decoder::ReadBool() {
   return *value == Marker::VALUE_TRUE;
 }
 
+std::optional<uint64_t> Decoder::ReadStringSize(Marker marker) {
+  if (marker == Marker::TYPE_STRING) return ReadSize(this);
+  if (marker == Marker::TYPE_COMPACT_STRING) return ReadVarint(this);
+  return std::nullopt;
+}
+
 std::optional<uint64_t> Decoder::ReadUint() {
   auto marker = ReadMarker();
-  if (!marker || *marker != Marker::TYPE_INT) return std::nullopt;
+  if (!marker) return std::nullopt;
+  if (*marker == Marker::TYPE_VARINT) return ReadVarint(this);
+  if (*marker != Marker::TYPE_INT) return std::nullopt;
   uint64_t value;
   if (!Read(reinterpret_cast<uint8_t *>(&value), sizeof(value))) return std::nullopt;
   value = utils::LittleEndianToHost(value);
@@ -233,14 +397,33 @@ std::optional<double> Decoder::ReadDouble() {
 
 std::optional<std::string> Decoder::ReadString() {
   auto marker = ReadMarker();
-  if (!marker || *marker != Marker::TYPE_STRING) return std::nullopt;
-  auto size = ReadSize(this);
+  if (!marker) return std::nullopt;
+  auto size = ReadStringSize(*marker);
   if (!size) return std::nullopt;
   std::string value(*size, '\0');
   if (!Read(reinterpret_cast<uint8_t *>(value.data()), *size)) return std::nullopt;
   return value;
 }
 
+std::optional<std::string_view> Decoder::ReadStringView() {
+  auto marker = ReadMarker();
+  if (!marker) return std::nullopt;
+  auto size = ReadStringSize(*marker);
+  if (!size) return std::nullopt;
+  if (block_read_ < block_.size()) {
+    if (block_.size() - block_read_ < *size) return std::nullopt;
+    std::string_view value(reinterpret_cast<const char *>(block_.data() + block_read_), *size);
+    block_read_ += *size;
+    return value;
+  }
+  if (const auto *data = file_.ReadMapped(*size)) {
+    return std::string_view(reinterpret_cast<const char *>(data), *size);
+  }
+  string_buffer_.resize(*size);
+  if (!Read(reinterpret_cast<uint8_t *>(string_buffer_.data()), *size)) return std::nullopt;
+  return string_buffer_;
+}
+
 namespace {
 std::optional<TemporalData> ReadTemporalData(Decoder &decoder) {
   const auto inner_marker = decoder.ReadMarker();
@@ -254,6 +437,25 @@ std::optional<TemporalData> ReadTemporalData(Decoder &decoder) {
 
   return TemporalData{static_cast<TemporalType>(*type), utils::MemcpyCast<int64_t>(*microseconds)};
 }
+
+std::optional<Point> ReadPoint(Decoder &decoder) {
+  const auto inner_marker = decoder.ReadMarker();
+  if (!inner_marker || *inner_marker != Marker::TYPE_POINT) return std::nullopt;
+
+  const auto srid = decoder.ReadUint();
+  if (!srid) return std::nullopt;
+  const auto crs = SridToCrs(static_cast<int64_t>(*srid));
+  if (!crs) return std::nullopt;
+
+  const auto x = decoder.ReadDouble();
+  if (!x) return std::nullopt;
+  const auto y = decoder.ReadDouble();
+  if (!y) return std::nullopt;
+  const auto z = decoder.ReadDouble();
+  if (!z) return std::nullopt;
+
+  return Point{*crs, *x, *y, *z};
+}
 }  // namespace
 
 std::optional<PropertyValue> Decoder::ReadPropertyValue() {
@@ -322,8 +524,15 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
       if (!maybe_temporal_data) return std::nullopt;
       return PropertyValue(*maybe_temporal_data);
     }
+    case Marker::TYPE_POINT: {
+      const auto maybe_point = ReadPoint(*this);
+      if (!maybe_point) return std::nullopt;
+      return PropertyValue(*maybe_point);
+    }
 
     case Marker::TYPE_PROPERTY_VALUE:
+    case Marker::TYPE_VARINT:
+    case Marker::TYPE_COMPACT_STRING:
     case Marker::SECTION_VERTEX:
     case Marker::SECTION_EDGE:
     case Marker::SECTION_MAPPER:
@@ -332,6 +541,8 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_DELETED_OBJECTS:
+    case Marker::SECTION_COMPRESSED_BLOCK:
     case Marker::SECTION_OFFSETS:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
@@ -350,6 +561,18 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_TEXT_INDEX_CREATE:
+    case Marker::DELTA_TEXT_INDEX_DROP:
+    case Marker::DELTA_POINT_INDEX_CREATE:
+    case Marker::DELTA_POINT_INDEX_DROP:
+    case Marker::DELTA_VECTOR_INDEX_CREATE:
+    case Marker::DELTA_VECTOR_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return std::nullopt;
@@ -358,8 +581,8 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
 
 bool Decoder::SkipString() {
   auto marker = ReadMarker();
-  if (!marker || *marker != Marker::TYPE_STRING) return false;
-  auto maybe_size = ReadSize(this);
+  if (!marker) return false;
+  auto maybe_size = ReadStringSize(*marker);
   if (!maybe_size) return false;
 
   const uint64_t kBufferSize = 262144;
@@ -421,8 +644,13 @@ bool Decoder::SkipPropertyValue() {
     case Marker::TYPE_TEMPORAL_DATA: {
       return !!ReadTemporalData(*this);
     }
+    case Marker::TYPE_POINT: {
+      return !!ReadPoint(*this);
+    }
 
     case Marker::TYPE_PROPERTY_VALUE:
+    case Marker::TYPE_VARINT:
+    case Marker::TYPE_COMPACT_STRING:
     case Marker::SECTION_VERTEX:
     case Marker::SECTION_EDGE:
     case Marker::SECTION_MAPPER:
@@ -431,6 +659,8 @@ bool Decoder::SkipPropertyValue() {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_DELETED_OBJECTS:
+    case Marker::SECTION_COMPRESSED_BLOCK:
     case Marker::SECTION_OFFSETS:
     case Marker::DELTA_VERTEX_CREATE:
     case Marker::DELTA_VERTEX_DELETE:
@@ -449,6 +679,18 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
     case Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case Marker::DELTA_TEXT_INDEX_CREATE:
+    case Marker::DELTA_TEXT_INDEX_DROP:
+    case Marker::DELTA_POINT_INDEX_CREATE:
+    case Marker::DELTA_POINT_INDEX_DROP:
+    case Marker::DELTA_VECTOR_INDEX_CREATE:
+    case Marker::DELTA_VECTOR_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return false;
@@ -457,8 +699,15 @@ bool Decoder::SkipPropertyValue() {
 
 std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
 
-std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
+std::optional<uint64_t> Decoder::GetPosition() {
+  if (block_read_ < block_.size()) return block_position_;
+  return file_.GetPosition();
+}
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  block_.clear();
+  block_read_ = 0;
+  return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+}
 
 }  // namespace memgraph::storage::durability
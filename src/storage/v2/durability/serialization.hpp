@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <string_view>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
@@ -23,6 +24,13 @@
 
 namespace memgraph::storage::durability {
 
+/// Maximum size of an unsigned integer encoded with `EncodeVarint`.
+constexpr size_t kMaxVarintSize = 10;
+
+/// Encodes `value` into `buffer` as a LEB128 varint, 7 bits per byte with the
+/// lowest bits first. Returns the number of bytes written.
+size_t EncodeVarint(uint64_t value, uint8_t *buffer);
+
 /// Encoder interface class. Used to implement streams to different targets
 /// (e.g. file and network).
 class BaseEncoder {
@@ -36,6 +44,13 @@ class BaseEncoder {
   virtual void WriteDouble(double value) = 0;
   virtual void WriteString(std::string_view value) = 0;
   virtual void WritePropertyValue(const PropertyValue &value) = 0;
+
+  // Write the value (`TYPE_VARINT`) or the string size (`TYPE_COMPACT_STRING`)
+  // as a varint. Small values take only a few bytes, which is what WAL deltas
+  // mostly consist of, but they can't be overwritten in place. They are read
+  // with `ReadUint` and `ReadString`.
+  virtual void WriteCompactUint(uint64_t value) = 0;
+  virtual void WriteCompactString(std::string_view value) = 0;
 };
 
 /// Encoder that is used to generate a snapshot/WAL.
@@ -56,12 +71,20 @@ class Encoder final : public BaseEncoder {
   void WriteDouble(double value) override;
   void WriteString(std::string_view value) override;
   void WritePropertyValue(const PropertyValue &value) override;
+  void WriteCompactUint(uint64_t value) override;
+  void WriteCompactString(std::string_view value) override;
 
   uint64_t GetPosition();
   void SetPosition(uint64_t position);
 
   void Sync();
 
+  // Write the internal buffer to the file without syncing it.
+  void Flush();
+  // Sync the data already written to the file, see
+  // `utils::OutputFile::SyncWithoutFlushing`.
+  void SyncWithoutFlushing();
+
   void Finalize();
 
   // Disable flushing of the internal buffer.
@@ -75,9 +98,37 @@ class Encoder final : public BaseEncoder {
 
   // Get the total size of the current file.
   size_t GetSize();
+  // Get the size of the data already written to the file, without the
+  // internal buffer.
+  size_t GetWrittenSize();
+
+  // See `utils::OutputFile::Preallocate`.
+  bool Preallocate(size_t size);
+  // See `utils::OutputFile::EnableDirectIO`.
+  bool EnableDirectIO();
+
+  // See `utils::OutputFile::SetWriteThrottle`.
+  void SetWriteThrottle(utils::WriteThrottle *throttle);
+  // See `utils::OutputFile::SetSyncPriority`.
+  void SetSyncPriority(utils::WriteThrottle *throttle);
+
+  // Buffer all data written from now on and write it to the file as zlib
+  // compressed blocks (`SECTION_COMPRESSED_BLOCK`). A block is written by
+  // `FinishRecord` once enough data is buffered, so a record is never split
+  // between two blocks and each block can be decoded on its own.
+  void EnableCompression();
+  // Write the buffered data as the last block and stop compressing.
+  void DisableCompression();
+  bool IsCompressionEnabled() const { return compression_enabled_; }
+  // Mark the end of a record, see `EnableCompression`.
+  void FinishRecord();
 
  private:
+  void WriteCompressedBlock();
+
   utils::OutputFile file_;
+  bool compression_enabled_{false};
+  std::vector<uint8_t> compression_buffer_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -101,7 +152,8 @@ class BaseDecoder {
 /// Decoder that is used to read a generated snapshot/WAL.
 class Decoder final : public BaseDecoder {
  public:
-  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic);
+  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic,
+                                     utils::InputFile::Mode mode = utils::InputFile::Mode::BUFFERED);
 
   // Main read functions, the only one that are allowed to read from the `file_`
   // directly.
@@ -117,15 +169,32 @@ class Decoder final : public BaseDecoder {
   std::optional<std::string> ReadString() override;
   std::optional<PropertyValue> ReadPropertyValue() override;
 
+  // Reads a string without copying it out of a memory mapped file or the
+  // current compressed block. The view is only valid until the next read.
+  std::optional<std::string_view> ReadStringView();
+
   bool SkipString() override;
   bool SkipPropertyValue() override;
 
   std::optional<uint64_t> GetSize();
+  // While a compressed block is being read this is the position of the block.
   std::optional<uint64_t> GetPosition();
   bool SetPosition(uint64_t position);
 
  private:
+  // Compressed blocks are decoded transparently when a marker is expected and
+  // the next thing in the file is a block, see `Encoder::EnableCompression`.
+  bool ReadCompressedBlockIfNext();
+
+  // Reads the size of a string which starts with `marker`.
+  std::optional<uint64_t> ReadStringSize(Marker marker);
+
   utils::InputFile file_;
+  std::vector<uint8_t> block_;
+  uint64_t block_read_{0};
+  uint64_t block_position_{0};
+  // Holds the strings read by `ReadStringView` which have to be copied.
+  std::string string_buffer_;
 };
 
 }  // namespace memgraph::storage::durability
@@ -11,6 +11,9 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <thread>
 
 #include "spdlog/spdlog.h"
@@ -23,16 +26,27 @@
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/mvcc.hpp"
+#include "storage/v2/property_store.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/concepts.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_gauge.hpp"
 #include "utils/file.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/timer.hpp"
+
+namespace memgraph::metrics {
+extern const Event SnapshotObjectsTotal;
+extern const Event SnapshotObjectsWritten;
+extern const Event SnapshotBytesWritten;
+}  // namespace memgraph::metrics
 
 namespace memgraph::storage::durability {
 
@@ -52,6 +66,7 @@ namespace memgraph::storage::durability {
 //     * offset to the metadata section
 //     * offset to the offset-count pair of the first edge batch (`0` if properties on edges are disabled)
 //     * offset to the offset-count pair of the first vertex batch
+//     * offset to the deleted objects section (only in incremental snapshots)
 //
 // 4) Encoded edges (if properties on edges are enabled); each edge is written
 //    in the following format:
@@ -77,6 +92,25 @@ namespace memgraph::storage::durability {
 //     * label+property indices
 //         * label
 //         * property
+//     * label+property composite indices (from version 16)
+//         * label
+//         * number of properties
+//         * properties, in the order of the index
+//     * edge type indices (from version 17)
+//         * edge type
+//     * edge type+property indices (from version 17)
+//         * edge type
+//         * property
+//     * label+property index statistics (from version 18)
+//     * text indices (from version 19)
+//         * label
+//         * property
+//     * point indices (from version 20)
+//         * label
+//         * property
+//     * vector indices (from version 21)
+//         * label
+//         * property
 //
 // 7) Constraints
 //     * existence constraints
@@ -98,6 +132,8 @@ namespace memgraph::storage::durability {
 //       applied)
 //     * number of edges
 //     * number of vertices
+//     * base snapshot timestamp (only in incremental snapshots)
+//     * previous snapshot timestamp (only in incremental snapshots)
 //
 // 10) Batch infos
 //     * number of edge batch infos
@@ -108,6 +144,17 @@ namespace memgraph::storage::durability {
 //        * starting offset of the batch
 //        * number of vertices in the batch
 //
+// 11) Deleted objects (only in incremental snapshots)
+//     * number of deleted edges
+//     * deleted edge gids
+//     * number of deleted vertices
+//     * deleted vertex gids
+//
+// Incremental snapshots (from version 22) start with a different magic string.
+// They contain only the edges and vertices modified since the previous
+// snapshot, and the gids of the modified objects which were deleted. Indices,
+// constraints and the epoch history are always stored completely.
+//
 // IMPORTANT: When changing snapshot encoding/decoding bump the snapshot/WAL
 // version in `version.hpp`.
 
@@ -116,16 +163,30 @@ struct BatchInfo {
   uint64_t count;
 };
 
+namespace {
+
+// Returns the magic string of the snapshot file, which tells whether the
+// snapshot is incremental.
+const std::string &SnapshotMagic(const std::filesystem::path &path) {
+  Decoder snapshot;
+  if (snapshot.Initialize(path, kIncrementalSnapshotMagic)) return kIncrementalSnapshotMagic;
+  return kSnapshotMagic;
+}
+
+}  // namespace
+
 // Function used to read information about the snapshot file.
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
   // Check magic and version.
   Decoder snapshot;
-  auto version = snapshot.Initialize(path, kSnapshotMagic);
+  const auto &magic = SnapshotMagic(path);
+  auto version = snapshot.Initialize(path, magic);
   if (!version) throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
   if (!IsVersionSupported(*version)) throw RecoveryFailure("Invalid snapshot version!");
 
   // Prepare return value.
   SnapshotInfo info;
+  info.incremental = magic == kIncrementalSnapshotMagic;
 
   // Read offsets.
   {
@@ -157,6 +218,7 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
       info.offset_edge_batches = 0U;
       info.offset_vertex_batches = 0U;
     }
+    info.offset_deleted_objects = info.incremental ? read_offset() : 0U;
   }
 
   // Read metadata.
@@ -185,6 +247,16 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     auto maybe_vertices = snapshot.ReadUint();
     if (!maybe_vertices) throw RecoveryFailure("Invalid snapshot data!");
     info.vertices_count = *maybe_vertices;
+
+    if (info.incremental) {
+      auto maybe_base_timestamp = snapshot.ReadUint();
+      if (!maybe_base_timestamp) throw RecoveryFailure("Invalid snapshot data!");
+      info.base_timestamp = *maybe_base_timestamp;
+
+      auto maybe_previous_timestamp = snapshot.ReadUint();
+      if (!maybe_previous_timestamp) throw RecoveryFailure("Invalid snapshot data!");
+      info.previous_timestamp = *maybe_previous_timestamp;
+    }
   }
 
   return info;
@@ -213,14 +285,69 @@ std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
   return infos;
 }
 
+/// Reads the properties of an object into the empty `store`. Since
+/// `kPropertyBufferVersion` they're stored as the buffer of a `PropertyStore`,
+/// which is copied into `store` as is if the recovery kept the ids of the
+/// properties. Older snapshots store each property separately.
+template <typename TPropertyFromIdFunc>
+void ReadProperties(Decoder &snapshot, PropertyStore &store, TPropertyFromIdFunc get_property_from_id,
+                    const bool property_ids_kept,
+                    std::vector<std::pair<PropertyId, PropertyValue>> &read_properties) {
+  read_properties.clear();
+  if (snapshot.PeekMarker() == Marker::TYPE_STRING) {
+    auto buffer = snapshot.ReadStringView();
+    if (!buffer) throw RecoveryFailure("Invalid snapshot data!");
+    if (property_ids_kept) {
+      store.SetBuffer(*buffer);
+      return;
+    }
+    auto properties = PropertyStore::CreateFromBuffer(*buffer).Properties();
+    read_properties.reserve(properties.size());
+    for (auto &[key, value] : properties) {
+      read_properties.emplace_back(get_property_from_id(key.AsUint()), std::move(value));
+    }
+  } else {
+    auto props_size = snapshot.ReadUint();
+    if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+    read_properties.reserve(*props_size);
+    for (uint64_t j = 0; j < *props_size; ++j) {
+      auto key = snapshot.ReadUint();
+      if (!key) throw RecoveryFailure("Invalid snapshot data!");
+      auto value = snapshot.ReadPropertyValue();
+      if (!value) throw RecoveryFailure("Invalid snapshot data!");
+      read_properties.emplace_back(get_property_from_id(*key), std::move(*value));
+    }
+  }
+  store.InitProperties(std::move(read_properties));
+}
+
+/// Skips the properties of an object, see `ReadProperties`.
+void SkipProperties(Decoder &snapshot) {
+  if (snapshot.PeekMarker() == Marker::TYPE_STRING) {
+    if (!snapshot.SkipString()) throw RecoveryFailure("Invalid snapshot data!");
+    return;
+  }
+  auto props_size = snapshot.ReadUint();
+  if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
+  for (uint64_t j = 0; j < *props_size; ++j) {
+    auto key = snapshot.ReadUint();
+    if (!key) throw RecoveryFailure("Invalid snapshot data!");
+    auto value = snapshot.SkipPropertyValue();
+    if (!value) throw RecoveryFailure("Invalid snapshot data!");
+  }
+}
+
 template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
-                      const uint64_t edges_count, const Config::Items items, TFunc get_property_from_id) {
+                      const uint64_t edges_count, const Config::Items items, TFunc get_property_from_id,
+                      const bool property_ids_kept) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, utils::InputFile::Mode::MEMORY_MAPPED);
 
   // Recover edges.
   auto edge_acc = edges.access();
+  // The gids are sorted, so each insert continues from the previous one.
+  utils::SkipList<Edge>::Finger edge_finger;
   uint64_t last_edge_gid = 0;
   spdlog::info("Recovering {} edges.", edges_count);
   if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
@@ -256,33 +383,19 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &
     if (i > 0 && *gid <= last_edge_gid) throw RecoveryFailure("Invalid snapshot data!");
     last_edge_gid = *gid;
 
-    if (items.properties_on_edges) {
-      auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
+    if (items.AnyPropertiesOnEdges()) {
+      auto [it, inserted] = edge_acc.insert(edge_finger, Edge{Gid::FromUint(*gid), nullptr});
       if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
 
       // Recover properties.
-      {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        auto &props = it->properties;
-        read_properties.clear();
-        read_properties.reserve(*props_size);
-        for (uint64_t j = 0; j < *props_size; ++j) {
-          auto key = snapshot.ReadUint();
-          if (!key) throw RecoveryFailure("Invalid snapshot data!");
-          auto value = snapshot.ReadPropertyValue();
-          if (!value) throw RecoveryFailure("Invalid snapshot data!");
-          read_properties.emplace_back(get_property_from_id(*key), std::move(*value));
-        }
-        props.InitProperties(std::move(read_properties));
-      }
+      ReadProperties(snapshot, it->properties, get_property_from_id, property_ids_kept, read_properties);
     } else {
       spdlog::debug("Ensuring edge {} doesn't have any properties.", *gid);
       // Read properties.
       {
-        auto props_size = snapshot.ReadUint();
-        if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-        if (*props_size != 0)
+        PropertyStore props;
+        ReadProperties(snapshot, props, get_property_from_id, property_ids_kept, read_properties);
+        if (!props.Properties().empty())
           throw RecoveryFailure(
               "The snapshot has properties on edges, but the storage is "
               "configured without properties on edges!");
@@ -296,12 +409,15 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &
 template <typename TLabelFromIdFunc, typename TPropertyFromIdFunc>
 uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<Vertex> &vertices,
                              const uint64_t from_offset, const uint64_t vertices_count,
-                             TLabelFromIdFunc get_label_from_id, TPropertyFromIdFunc get_property_from_id) {
+                             TLabelFromIdFunc get_label_from_id, TPropertyFromIdFunc get_property_from_id,
+                             const bool property_ids_kept) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, utils::InputFile::Mode::MEMORY_MAPPED);
   if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
 
   auto vertex_acc = vertices.access();
+  // The gids are sorted, so each insert continues from the previous one.
+  utils::SkipList<Vertex>::Finger vertex_finger;
   uint64_t last_vertex_gid = 0;
   spdlog::info("Recovering {} vertices.", vertices_count);
   std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
@@ -336,7 +452,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
       throw RecoveryFailure("Invalid snapshot data!");
     }
     last_vertex_gid = *gid;
-    auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
+    auto [it, inserted] = vertex_acc.insert(vertex_finger, Vertex{Gid::FromUint(*gid), nullptr});
     if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
 
     // Recover labels.
@@ -353,21 +469,7 @@ uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<
     }
 
     // Recover properties.
-    {
-      auto props_size = snapshot.ReadUint();
-      if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-      auto &props = it->properties;
-      read_properties.clear();
-      read_properties.reserve(*props_size);
-      for (uint64_t j = 0; j < *props_size; ++j) {
-        auto key = snapshot.ReadUint();
-        if (!key) throw RecoveryFailure("Invalid snapshot data!");
-        auto value = snapshot.ReadPropertyValue();
-        if (!value) throw RecoveryFailure("Invalid snapshot data!");
-        read_properties.emplace_back(get_property_from_id(*key), std::move(*value));
-      }
-      props.InitProperties(std::move(read_properties));
-    }
+    ReadProperties(snapshot, it->properties, get_property_from_id, property_ids_kept, read_properties);
 
     // Skip in edges.
     {
@@ -415,7 +517,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
                                                       const Config::Items items, const bool snapshot_has_edges,
                                                       TEdgeTypeFromIdFunc get_edge_type_from_id) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, utils::InputFile::Mode::MEMORY_MAPPED);
   if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't read data from snapshot!");
 
   auto vertex_acc = vertices.access();
@@ -486,16 +588,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
     }
 
     // Skip properties.
-    {
-      auto props_size = snapshot.ReadUint();
-      if (!props_size) throw RecoveryFailure("Invalid snapshot data!");
-      for (uint64_t j = 0; j < *props_size; ++j) {
-        auto key = snapshot.ReadUint();
-        if (!key) throw RecoveryFailure("Invalid snapshot data!");
-        auto value = snapshot.SkipPropertyValue();
-        if (!value) throw RecoveryFailure("Invalid snapshot data!");
-      }
-    }
+    SkipProperties(snapshot);
 
     // Recover in edges.
     {
@@ -516,7 +609,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
         if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
 
         EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-        if (items.properties_on_edges) {
+        if (items.PropertiesOnEdges(get_edge_type_from_id(*edge_type))) {
           // The snapshot contains the individiual edges only if it was created with a config where properties are
           // allowed on edges. That means the snapshots that were created without edge properties will only contain the
           // edges in the in/out edges list of vertices, therefore the edges has to be created here.
@@ -531,6 +624,8 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
         }
         vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
       }
+      // Edges are appended in the snapshot order, group them by edge type only once per vertex.
+      SortVertexEdges(vertex.in_edges);
     }
 
     // Recover out edges.
@@ -551,7 +646,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
         if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
 
         EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-        if (items.properties_on_edges) {
+        if (items.PropertiesOnEdges(get_edge_type_from_id(*edge_type))) {
           // The snapshot contains the individiual edges only if it was created with a config where properties are
           // allowed on edges. That means the snapshots that were created without edge properties will only contain the
           // edges in the in/out edges list of vertices, therefore the edges has to be created here.
@@ -569,6 +664,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
         // information is duplicated in in_edges.
         edge_count++;
       }
+      SortVertexEdges(vertex.out_edges);
     }
     ++vertex_it;
   }
@@ -633,7 +729,11 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
 
   // Read snapshot info.
   const auto info = ReadSnapshotInfo(path);
-  spdlog::info("Recovering {} vertices and {} edges.", info.vertices_count, info.edges_count);
+  if (info.incremental) {
+    spdlog::info("Applying {} modified vertices and {} modified edges.", info.vertices_count, info.edges_count);
+  } else {
+    spdlog::info("Recovering {} vertices and {} edges.", info.vertices_count, info.edges_count);
+  }
   // Check for edges.
   bool snapshot_has_edges = info.offset_edges != 0;
 
@@ -691,7 +791,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
         }
 
-        if (items.properties_on_edges) {
+        if (items.AnyPropertiesOnEdges()) {
           // Insert edge.
           auto gid = snapshot.ReadUint();
           if (!gid) throw RecoveryFailure("Invalid snapshot data!");
@@ -878,7 +978,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           if (from_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid from vertex!");
 
           EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
+          if (items.PropertiesOnEdges(get_edge_type_from_id(*edge_type))) {
             if (snapshot_has_edges) {
               auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
               if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
@@ -892,6 +992,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), from_vertex->gid.AsUint());
           vertex.in_edges.emplace_back(get_edge_type_from_id(*edge_type), &*from_vertex, edge_ref);
         }
+        SortVertexEdges(vertex.in_edges);
       }
 
       // Recover out edges.
@@ -914,7 +1015,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
           if (to_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid to vertex!");
 
           EdgeRef edge_ref(Gid::FromUint(*edge_gid));
-          if (items.properties_on_edges) {
+          if (items.PropertiesOnEdges(get_edge_type_from_id(*edge_type))) {
             if (snapshot_has_edges) {
               auto edge = edge_acc.find(Gid::FromUint(*edge_gid));
               if (edge == edge_acc.end()) throw RecoveryFailure("Invalid edge!");
@@ -928,6 +1029,7 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
                        name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)), to_vertex->gid.AsUint());
           vertex.out_edges.emplace_back(get_edge_type_from_id(*edge_type), &*to_vertex, edge_ref);
         }
+        SortVertexEdges(vertex.out_edges);
         // Increment edge count. We only increment the count here because the
         // information is duplicated in in_edges.
         edge_count->fetch_add(*out_size, std::memory_order_acq_rel);
@@ -1077,6 +1179,200 @@ RecoveredSnapshot LoadSnapshotVersion14(const std::filesystem::path &path, utils
   return {info, ret, std::move(indices_constraints)};
 }
 
+struct ApplySnapshotIncrementResult {
+  uint64_t highest_vertex_gid;
+  uint64_t highest_edge_gid;
+};
+
+// Applies an incremental snapshot on top of the objects loaded from the
+// snapshots before it. The modified objects replace the loaded ones and the
+// deleted objects are removed. Vertices are read twice, the in/out edges can
+// only be linked once all the modified vertices exist.
+template <typename TLabelFromIdFunc, typename TPropertyFromIdFunc, typename TEdgeTypeFromIdFunc>
+ApplySnapshotIncrementResult ApplySnapshotIncrement(Decoder &snapshot, const SnapshotInfo &info,
+                                                    utils::SkipList<Vertex> &vertices, utils::SkipList<Edge> &edges,
+                                                    std::atomic<uint64_t> &edge_count, const Config::Items items,
+                                                    TLabelFromIdFunc get_label_from_id,
+                                                    TPropertyFromIdFunc get_property_from_id,
+                                                    TEdgeTypeFromIdFunc get_edge_type_from_id,
+                                                    const bool property_ids_kept) {
+  auto vertex_acc = vertices.access();
+  auto edge_acc = edges.access();
+  uint64_t highest_vertex_gid = 0;
+  uint64_t highest_edge_gid = 0;
+  std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
+
+  // Apply edges.
+  if (info.offset_edges != 0) {
+    spdlog::info("Applying {} edges.", info.edges_count);
+    if (!snapshot.SetPosition(info.offset_edges)) throw RecoveryFailure("Couldn't read data from snapshot!");
+    for (uint64_t i = 0; i < info.edges_count; ++i) {
+      {
+        auto marker = snapshot.ReadMarker();
+        if (!marker || *marker != Marker::SECTION_EDGE) throw RecoveryFailure("Invalid snapshot data!");
+      }
+
+      auto gid = snapshot.ReadUint();
+      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+      highest_edge_gid = std::max(highest_edge_gid, *gid);
+
+      if (!items.AnyPropertiesOnEdges()) {
+        PropertyStore props;
+        ReadProperties(snapshot, props, get_property_from_id, property_ids_kept, read_properties);
+        if (!props.Properties().empty()) {
+          throw RecoveryFailure(
+              "The snapshot has properties on edges, but the storage is "
+              "configured without properties on edges!");
+        }
+        continue;
+      }
+      auto [it, inserted] = edge_acc.insert(Edge{Gid::FromUint(*gid), nullptr});
+      it->properties.ClearProperties();
+      ReadProperties(snapshot, it->properties, get_property_from_id, property_ids_kept, read_properties);
+    }
+  }
+
+  auto skip_edges = [&snapshot] {
+    auto size = snapshot.ReadUint();
+    if (!size) throw RecoveryFailure("Invalid snapshot data!");
+    for (uint64_t j = 0; j < *size; ++j) {
+      auto edge_gid = snapshot.ReadUint();
+      if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+      auto vertex_gid = snapshot.ReadUint();
+      if (!vertex_gid) throw RecoveryFailure("Invalid snapshot data!");
+      auto edge_type = snapshot.ReadUint();
+      if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+    }
+  };
+
+  // Apply vertices (labels and properties).
+  spdlog::info("Applying {} vertices.", info.vertices_count);
+  if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
+  for (uint64_t i = 0; i < info.vertices_count; ++i) {
+    {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
+    }
+
+    auto gid = snapshot.ReadUint();
+    if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+    highest_vertex_gid = std::max(highest_vertex_gid, *gid);
+    auto [it, inserted] = vertex_acc.insert(Vertex{Gid::FromUint(*gid), nullptr});
+
+    {
+      auto labels_size = snapshot.ReadUint();
+      if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+      auto &labels = it->labels;
+      labels.clear();
+      labels.reserve(*labels_size);
+      for (uint64_t j = 0; j < *labels_size; ++j) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        labels.emplace_back(get_label_from_id(*label));
+      }
+    }
+
+    it->properties.ClearProperties();
+    ReadProperties(snapshot, it->properties, get_property_from_id, property_ids_kept, read_properties);
+
+    // The vertices which aren't modified keep pointing to this vertex, so it's
+    // updated in place and only its own in/out edges are replaced.
+    edge_count.fetch_sub(it->out_edges.size(), std::memory_order_acq_rel);
+    it->in_edges.clear();
+    it->out_edges.clear();
+    skip_edges();
+    skip_edges();
+  }
+
+  // Apply vertices (in/out edges).
+  if (!snapshot.SetPosition(info.offset_vertices)) throw RecoveryFailure("Couldn't read data from snapshot!");
+  auto read_edges = [&](auto &vertex_edges) {
+    auto size = snapshot.ReadUint();
+    if (!size) throw RecoveryFailure("Invalid snapshot data!");
+    vertex_edges.reserve(*size);
+    for (uint64_t j = 0; j < *size; ++j) {
+      auto edge_gid = snapshot.ReadUint();
+      if (!edge_gid) throw RecoveryFailure("Invalid snapshot data!");
+      highest_edge_gid = std::max(highest_edge_gid, *edge_gid);
+      auto vertex_gid = snapshot.ReadUint();
+      if (!vertex_gid) throw RecoveryFailure("Invalid snapshot data!");
+      auto edge_type = snapshot.ReadUint();
+      if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+
+      auto other_vertex = vertex_acc.find(Gid::FromUint(*vertex_gid));
+      if (other_vertex == vertex_acc.end()) throw RecoveryFailure("Invalid vertex!");
+
+      EdgeRef edge_ref(Gid::FromUint(*edge_gid));
+      if (items.PropertiesOnEdges(get_edge_type_from_id(*edge_type))) {
+        auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
+        edge_ref = EdgeRef(&*edge);
+      }
+      vertex_edges.emplace_back(get_edge_type_from_id(*edge_type), &*other_vertex, edge_ref);
+    }
+    SortVertexEdges(vertex_edges);
+  };
+  for (uint64_t i = 0; i < info.vertices_count; ++i) {
+    {
+      auto marker = snapshot.ReadMarker();
+      if (!marker || *marker != Marker::SECTION_VERTEX) throw RecoveryFailure("Invalid snapshot data!");
+    }
+
+    auto gid = snapshot.ReadUint();
+    if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+    auto vertex = vertex_acc.find(Gid::FromUint(*gid));
+    if (vertex == vertex_acc.end()) throw RecoveryFailure("Invalid snapshot data!");
+
+    // Skip labels.
+    {
+      auto labels_size = snapshot.ReadUint();
+      if (!labels_size) throw RecoveryFailure("Invalid snapshot data!");
+      for (uint64_t j = 0; j < *labels_size; ++j) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+      }
+    }
+
+    // Skip properties.
+    SkipProperties(snapshot);
+
+    read_edges(vertex->in_edges);
+    read_edges(vertex->out_edges);
+    edge_count.fetch_add(vertex->out_edges.size(), std::memory_order_acq_rel);
+  }
+
+  // Remove deleted objects. Their neighbours were modified too, so nothing
+  // points to them anymore.
+  {
+    if (!snapshot.SetPosition(info.offset_deleted_objects)) throw RecoveryFailure("Couldn't read data from snapshot!");
+
+    auto marker = snapshot.ReadMarker();
+    if (!marker || *marker != Marker::SECTION_DELETED_OBJECTS) throw RecoveryFailure("Invalid snapshot data!");
+
+    auto edges_size = snapshot.ReadUint();
+    if (!edges_size) throw RecoveryFailure("Invalid snapshot data!");
+    spdlog::info("Removing {} deleted edges.", *edges_size);
+    for (uint64_t i = 0; i < *edges_size; ++i) {
+      auto gid = snapshot.ReadUint();
+      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+      edge_acc.remove(Gid::FromUint(*gid));
+    }
+
+    auto vertices_size = snapshot.ReadUint();
+    if (!vertices_size) throw RecoveryFailure("Invalid snapshot data!");
+    spdlog::info("Removing {} deleted vertices.", *vertices_size);
+    for (uint64_t i = 0; i < *vertices_size; ++i) {
+      auto gid = snapshot.ReadUint();
+      if (!gid) throw RecoveryFailure("Invalid snapshot data!");
+      auto vertex = vertex_acc.find(Gid::FromUint(*gid));
+      if (vertex == vertex_acc.end()) continue;
+      edge_count.fetch_sub(vertex->out_edges.size(), std::memory_order_acq_rel);
+      vertex_acc.remove(Gid::FromUint(*gid));
+    }
+  }
+
+  return {highest_vertex_gid, highest_edge_gid};
+}
+
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
@@ -1085,7 +1381,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   RecoveredIndicesAndConstraints indices_constraints;
 
   Decoder snapshot;
-  const auto version = snapshot.Initialize(path, kSnapshotMagic);
+  const auto version = snapshot.Initialize(path, SnapshotMagic(path));
   if (!version) throw RecoveryFailure("Couldn't read snapshot magic and/or version!");
 
   if (!IsVersionSupported(*version)) throw RecoveryFailure(fmt::format("Invalid snapshot version {}", *version));
@@ -1126,7 +1422,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       if (!id) throw RecoveryFailure("Invalid snapshot data!");
       auto name = snapshot.ReadString();
       if (!name) throw RecoveryFailure("Invalid snapshot data!");
-      auto my_id = name_id_mapper->NameToId(*name);
+      auto my_id = name_id_mapper->NameToIdPreferring(*name, *id);
       snapshot_id_map.emplace(*id, my_id);
       SPDLOG_TRACE("Mapping \"{}\"from snapshot id {} to actual id {}.", *name, *id, my_id);
     }
@@ -1146,13 +1442,27 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     if (it == snapshot_id_map.end()) throw RecoveryFailure("Invalid snapshot data!");
     return EdgeTypeId::FromUint(it->second);
   };
+  // The property buffers of the objects can only be used as they are if none
+  // of the ids changed.
+  const bool property_ids_kept = std::all_of(snapshot_id_map.begin(), snapshot_id_map.end(),
+                                             [](const auto &item) { return item.first == item.second; });
+
+  if (info.incremental) {
+    const auto result = ApplySnapshotIncrement(snapshot, info, *vertices, *edges, *edge_count, config.items,
+                                               get_label_from_id, get_property_from_id, get_edge_type_from_id,
+                                               property_ids_kept);
+    spdlog::info("Incremental snapshot is applied.");
+
+    // The caller combines these with the IDs of the previous snapshots.
+    recovery_info.next_edge_id = result.highest_edge_gid + 1;
+    recovery_info.next_vertex_id = result.highest_vertex_gid + 1;
+  } else {
+    // Reset current edge count.
+    edge_count->store(0, std::memory_order_release);
 
-  // Reset current edge count.
-  edge_count->store(0, std::memory_order_release);
-
-  {
     spdlog::info("Recovering edges.");
     // Recover edges.
+    utils::Timer phase_timer;
     if (snapshot_has_edges) {
       // We don't need to check whether we store properties on edge or not, because `LoadPartialEdges` will always
       // iterate over the edges in the snapshot (if they exist) and the current configuration of properties on edge only
@@ -1166,16 +1476,19 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                     const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.items, &get_property_from_id, property_ids_kept](
+              const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id,
+                             property_ids_kept);
           },
           edge_batches);
     }
     spdlog::info("Edges are recovered.");
+    recovery_info.durations.snapshot_edges = phase_timer.Elapsed<std::chrono::microseconds>();
 
     // Recover vertices (labels and properties).
     spdlog::info("Recovering vertices.", info.vertices_count);
+    phase_timer = utils::Timer();
     uint64_t last_vertex_gid{0};
 
     if (!snapshot.SetPosition(info.offset_vertex_batches)) {
@@ -1185,10 +1498,11 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     const auto vertex_batches = ReadBatchInfos(snapshot);
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch =
-              LoadPartialVertices(path, *vertices, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, &vertex_batches, &get_label_from_id, &get_property_from_id, property_ids_kept,
+         &last_vertex_gid](const size_t batch_index, const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch = LoadPartialVertices(path, *vertices, batch.offset, batch.count,
+                                                                    get_label_from_id, get_property_from_id,
+                                                                    property_ids_kept);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -1196,9 +1510,11 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
         vertex_batches);
 
     spdlog::info("Vertices are recovered.");
+    recovery_info.durations.snapshot_vertices = phase_timer.Elapsed<std::chrono::microseconds>();
 
     // Recover vertices (in/out edges).
     spdlog::info("Recover connectivity.");
+    phase_timer = utils::Timer();
     recovery_info.vertex_batches.reserve(vertex_batches.size());
     for (const auto batch : vertex_batches) {
       recovery_info.vertex_batches.emplace_back(std::make_pair(Gid::FromUint(0), batch.count));
@@ -1221,6 +1537,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
         vertex_batches);
 
     spdlog::info("Connectivity is recovered.");
+    recovery_info.durations.snapshot_connectivity = phase_timer.Elapsed<std::chrono::microseconds>();
 
     // Set initial values for edge/vertex ID generators.
     recovery_info.next_edge_id = highest_edge_gid + 1;
@@ -1269,6 +1586,186 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       }
       spdlog::info("Metadata of label+property indices are recovered.");
     }
+
+    // Recover label+property composite indices.
+    if (*version >= kCompositeIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} label+property composite indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid snapshot data!");
+        std::vector<PropertyId> properties;
+        properties.reserve(*properties_count);
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Invalid snapshot data!");
+          properties.push_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_composite,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The label+property composite index already exists!");
+        SPDLOG_TRACE("Recovered metadata of label+property composite index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of label+property composite indices are recovered.");
+    }
+
+    // Recover edge type and edge type+property indices.
+    if (*version >= kEdgeIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type, get_edge_type_from_id(*edge_type),
+                                    "The edge type index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge type index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)));
+      }
+      spdlog::info("Metadata of edge type indices are recovered.");
+
+      size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} edge type+property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto edge_type = snapshot.ReadUint();
+        if (!edge_type) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.edge_type_property,
+                                    {get_edge_type_from_id(*edge_type), get_property_from_id(*property)},
+                                    "The edge type+property index already exists!");
+        SPDLOG_TRACE("Recovered metadata of edge type+property index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*edge_type)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of edge type+property indices are recovered.");
+    }
+
+    // Recover label+property index statistics.
+    if (*version >= kIndexStatsVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering statistics of {} label+property indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        auto count = snapshot.ReadUint();
+        auto distinct_values_count = snapshot.ReadUint();
+        auto statistic = snapshot.ReadDouble();
+        auto avg_group_size = snapshot.ReadDouble();
+        auto avg_degree = snapshot.ReadDouble();
+        auto histogram_lower = snapshot.ReadPropertyValue();
+        if (!count || !distinct_values_count || !statistic || !avg_group_size || !avg_degree || !histogram_lower) {
+          throw RecoveryFailure("Invalid snapshot data!");
+        }
+        LabelPropertyIndexStats stats{.count = *count,
+                                      .distinct_values_count = *distinct_values_count,
+                                      .statistic = *statistic,
+                                      .avg_group_size = *avg_group_size,
+                                      .avg_degree = *avg_degree};
+        stats.histogram.lower = std::move(*histogram_lower);
+
+        auto buckets_count = snapshot.ReadUint();
+        if (!buckets_count) throw RecoveryFailure("Invalid snapshot data!");
+        stats.histogram.buckets.reserve(*buckets_count);
+        uint64_t cumulative_count = 0;
+        for (uint64_t j = 0; j < *buckets_count; ++j) {
+          auto upper = snapshot.ReadPropertyValue();
+          auto bucket_count = snapshot.ReadUint();
+          auto bucket_distinct_values_count = snapshot.ReadUint();
+          if (!upper || !bucket_count || !bucket_distinct_values_count) throw RecoveryFailure("Invalid snapshot data!");
+          cumulative_count += *bucket_count;
+          stats.histogram.buckets.push_back({.upper = std::move(*upper),
+                                             .count = *bucket_count,
+                                             .distinct_values_count = *bucket_distinct_values_count,
+                                             .cumulative_count = cumulative_count});
+        }
+
+        auto most_common_values_count = snapshot.ReadUint();
+        if (!most_common_values_count) throw RecoveryFailure("Invalid snapshot data!");
+        stats.histogram.most_common_values.reserve(*most_common_values_count);
+        for (uint64_t j = 0; j < *most_common_values_count; ++j) {
+          auto value = snapshot.ReadPropertyValue();
+          auto value_count = snapshot.ReadUint();
+          if (!value || !value_count) throw RecoveryFailure("Invalid snapshot data!");
+          stats.histogram.most_common_values.emplace_back(std::move(*value), *value_count);
+        }
+
+        indices_constraints.indices.label_property_stats.emplace_back(
+            std::make_pair(get_label_from_id(*label), get_property_from_id(*property)), std::move(stats));
+        SPDLOG_TRACE("Recovered statistics of label+property index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Statistics of label+property indices are recovered.");
+    }
+
+    // Recover text indices.
+    if (*version >= kTextIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} text indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.text,
+                                    {get_label_from_id(*label), get_property_from_id(*property)},
+                                    "The text index already exists!");
+        SPDLOG_TRACE("Recovered metadata of text index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of text indices are recovered.");
+    }
+
+    // Recover point indices.
+    if (*version >= kPointIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} point indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.point,
+                                    {get_label_from_id(*label), get_property_from_id(*property)},
+                                    "The point index already exists!");
+        SPDLOG_TRACE("Recovered metadata of point index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of point indices are recovered.");
+    }
+
+    // Recover vector indices.
+    if (*version >= kVectorIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Invalid snapshot data!");
+      spdlog::info("Recovering metadata of {} vector indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Invalid snapshot data!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Invalid snapshot data!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.vector,
+                                    {get_label_from_id(*label), get_property_from_id(*property)},
+                                    "The vector index already exists!");
+        SPDLOG_TRACE("Recovered metadata of vector index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of vector indices are recovered.");
+    }
     spdlog::info("Metadata of indices are recovered.");
   }
 
@@ -1336,6 +1833,10 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     const auto marker = snapshot.ReadMarker();
     if (!marker || *marker != Marker::SECTION_EPOCH_HISTORY) throw RecoveryFailure("Invalid snapshot data!");
 
+    // An incremental snapshot stores the whole history, which replaces the
+    // history of the snapshot before it.
+    if (info.incremental) epoch_history->clear();
+
     const auto history_size = snapshot.ReadUint();
     if (!history_size) {
       throw RecoveryFailure("Invalid snapshot data!");
@@ -1364,20 +1865,327 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
   return {info, recovery_info, std::move(indices_constraints)};
 }
 
+namespace {
+
+/// Writes `properties` as the buffer of a `PropertyStore` holding them, which
+/// the recovery can copy instead of decoding each value, see `ReadProperties`.
+/// The buffer never holds dictionary codes, `properties` are decoded.
+void WriteProperties(Encoder &snapshot, const std::map<PropertyId, PropertyValue> &properties,
+                     std::unordered_set<uint64_t> &used_ids) {
+  PropertyStore store;
+  store.InitProperties(properties);
+  for (const auto &item : properties) {
+    used_ids.insert(item.first.AsUint());
+  }
+  snapshot.WriteString(store.StringBuffer());
+}
+
+/// Writes `edge` if it's visible to `transaction`. Returns whether it was
+/// written.
+bool WriteEdge(Encoder &snapshot, Edge &edge, Transaction *transaction, Indices *indices, Constraints *constraints,
+               Config::Items items, std::unordered_set<uint64_t> &used_ids) {
+  // The edge visibility check must be done here manually because we don't
+  // allow direct access to the edges through the public API.
+  bool is_visible = true;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{edge.lock};
+    is_visible = !edge.deleted;
+    delta = edge.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        is_visible = true;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        is_visible = false;
+        break;
+      }
+    }
+  });
+  if (!is_visible) return false;
+  EdgeRef edge_ref(&edge);
+  // Here we create an edge accessor that we will use to get the
+  // properties of the edge. The accessor is created with an invalid
+  // type and invalid from/to pointers because we don't know them here,
+  // here. Only the edges of the types with properties are stored as
+  // objects, so the properties are enabled for this one.
+  items.properties_on_edges = true;
+  auto ea = EdgeAccessor{edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, items};
+
+  // Get edge data.
+  auto maybe_props = ea.Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+
+  // Store the edge.
+  snapshot.WriteMarker(Marker::SECTION_EDGE);
+  snapshot.WriteUint(edge.gid.AsUint());
+  WriteProperties(snapshot, maybe_props.GetValue(), used_ids);
+  return true;
+}
+
+/// Writes `vertex` if it's visible to `transaction`. Returns whether it was
+/// written.
+bool WriteVertex(Encoder &snapshot, Vertex &vertex, Transaction *transaction, Indices *indices,
+                 Constraints *constraints, Config::Items items, std::unordered_set<uint64_t> &used_ids) {
+  auto write_mapping = [&snapshot, &used_ids](auto mapping) {
+    used_ids.insert(mapping.AsUint());
+    snapshot.WriteUint(mapping.AsUint());
+  };
+
+  // The visibility check is implemented for vertices so we use it here.
+  auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, items, View::OLD);
+  if (!va) return false;
+
+  // Get vertex data.
+  // TODO (mferencevic): All of these functions could be written into a
+  // single function so that we traverse the undo deltas only once.
+  auto maybe_labels = va->Labels(View::OLD);
+  MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+  auto maybe_props = va->Properties(View::OLD);
+  MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+  auto maybe_in_edges = va->InEdges(View::OLD);
+  MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
+  auto maybe_out_edges = va->OutEdges(View::OLD);
+  MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+
+  // Store the vertex.
+  snapshot.WriteMarker(Marker::SECTION_VERTEX);
+  snapshot.WriteUint(vertex.gid.AsUint());
+  const auto &labels = maybe_labels.GetValue();
+  snapshot.WriteUint(labels.size());
+  for (const auto &item : labels) {
+    write_mapping(item);
+  }
+  WriteProperties(snapshot, maybe_props.GetValue(), used_ids);
+  const auto &in_edges = maybe_in_edges.GetValue().edges;
+  snapshot.WriteUint(in_edges.size());
+  for (const auto &item : in_edges) {
+    snapshot.WriteUint(item.Gid().AsUint());
+    snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+    write_mapping(item.EdgeType());
+  }
+  const auto &out_edges = maybe_out_edges.GetValue().edges;
+  snapshot.WriteUint(out_edges.size());
+  for (const auto &item : out_edges) {
+    snapshot.WriteUint(item.Gid().AsUint());
+    snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+    write_mapping(item.EdgeType());
+  }
+  return true;
+}
+
+/// Publishes the progress of the snapshot being created as metrics.
+class SnapshotProgress {
+ public:
+  explicit SnapshotProgress(uint64_t total) {
+    metrics::SetGaugeValue(metrics::SnapshotObjectsTotal, total);
+    metrics::SetGaugeValue(metrics::SnapshotObjectsWritten, 0);
+  }
+
+  void Add(uint64_t count) { metrics::SetGaugeValue(metrics::SnapshotObjectsWritten, written_ += count); }
+
+ private:
+  std::atomic<uint64_t> written_{0};
+};
+
+/// Copies the content of the file at `path` to the end of `snapshot`.
+void AppendFile(Encoder &snapshot, const std::filesystem::path &path) {
+  utils::InputFile file;
+  MG_ASSERT(file.Open(path), "Couldn't open snapshot segment {}!", path);
+  constexpr size_t kBufferSize = 64 * 1024;
+  std::vector<uint8_t> buffer(kBufferSize);
+  auto remaining = file.GetSize();
+  while (remaining > 0) {
+    const auto size = std::min(remaining, kBufferSize);
+    MG_ASSERT(file.Read(buffer.data(), size), "Couldn't read snapshot segment {}!", path);
+    snapshot.Write(buffer.data(), size);
+    remaining -= size;
+  }
+}
+
+/// Writes the objects of `skip_list` for which `write_object` returns true and
+/// returns the infos of the batches they were written in. `count` is increased
+/// by the number of written objects.
+///
+/// With more than one thread the skip list is split into ranges of
+/// `items_per_batch` objects, each range is encoded into its own segment file
+/// in `segments_directory` by one of the threads, and the segments are then
+/// appended to `snapshot` in order. Each segment is one batch, so the loader
+/// reads the result like a snapshot written on a single thread.
+///
+/// With `compress` each batch is written as its own compressed blocks, so the
+/// batches can still be decoded independently by the recovery threads. The
+/// segments are written through `write_throttle`.
+template <typename TObject, typename TFunc>
+std::vector<BatchInfo> WriteObjects(Encoder &snapshot, utils::SkipList<TObject> *skip_list,
+                                    const TFunc &write_object, uint64_t items_per_batch, uint64_t thread_count,
+                                    const std::filesystem::path &segments_directory,
+                                    std::unordered_set<uint64_t> &used_ids, uint64_t &count, bool compress,
+                                    utils::WriteThrottle *write_throttle, SnapshotProgress &progress) {
+  std::vector<BatchInfo> batch_infos;
+
+  if (thread_count <= 1) {
+    uint64_t items_in_current_batch = 0;
+    auto batch_start_offset = snapshot.GetPosition();
+    if (compress) snapshot.EnableCompression();
+    for (auto &object : skip_list->access()) {
+      if (!write_object(snapshot, object, used_ids)) continue;
+      if (compress) snapshot.FinishRecord();
+      ++count;
+      ++items_in_current_batch;
+      if (items_in_current_batch == items_per_batch) {
+        if (compress) snapshot.DisableCompression();
+        batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+        progress.Add(items_in_current_batch);
+        batch_start_offset = snapshot.GetPosition();
+        items_in_current_batch = 0;
+        if (compress) snapshot.EnableCompression();
+      }
+    }
+    if (compress) snapshot.DisableCompression();
+    if (items_in_current_batch > 0) {
+      batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      progress.Add(items_in_current_batch);
+    }
+    return batch_infos;
+  }
+
+  // Segment `i` holds the objects from `range_starts[i]` up to (excluding)
+  // `range_starts[i + 1]`. Objects removed or added by the GC in the meantime
+  // don't matter, they aren't visible to the snapshot transaction.
+  std::vector<Gid> range_starts;
+  {
+    uint64_t index = 0;
+    for (const auto &object : skip_list->access()) {
+      if (index++ % items_per_batch == 0) range_starts.push_back(object.gid);
+    }
+  }
+
+  struct Segment {
+    std::filesystem::path path;
+    uint64_t count{0};
+    std::unordered_set<uint64_t> used_ids;
+  };
+  std::vector<Segment> segments(range_starts.size());
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> maybe_error{};
+  {
+    std::atomic<uint64_t> segment_counter = 0;
+    std::vector<std::jthread> threads;
+    thread_count = std::min(thread_count, static_cast<uint64_t>(segments.size()));
+    threads.reserve(thread_count);
+    for (uint64_t i = 0; i < thread_count; ++i) {
+      threads.emplace_back([&] {
+        auto acc = skip_list->access();
+        while (!*maybe_error.Lock()) {
+          const auto index = segment_counter++;
+          if (index >= segments.size()) return;
+          auto &segment = segments[index];
+          segment.path = segments_directory / std::to_string(index);
+          try {
+            Encoder encoder;
+            // Creates the segment file, which has no header, it's only a part
+            // of the snapshot.
+            encoder.OpenExisting(segment.path);
+            encoder.SetWriteThrottle(write_throttle);
+            if (compress) encoder.EnableCompression();
+            for (auto it = acc.find_equal_or_greater(range_starts[index]); it != acc.end(); ++it) {
+              if (index + 1 < range_starts.size() && it->gid >= range_starts[index + 1]) break;
+              if (!write_object(encoder, *it, segment.used_ids)) continue;
+              if (compress) encoder.FinishRecord();
+              ++segment.count;
+            }
+            if (compress) encoder.DisableCompression();
+            encoder.Close();
+            progress.Add(segment.count);
+          } catch (...) {
+            *maybe_error.Lock() = std::current_exception();
+          }
+        }
+      });
+    }
+  }
+
+  for (auto &segment : segments) {
+    if (segment.path.empty()) continue;
+    if (!*maybe_error.Lock() && segment.count > 0) {
+      batch_infos.push_back(BatchInfo{snapshot.GetPosition(), segment.count});
+      AppendFile(snapshot, segment.path);
+    }
+    count += segment.count;
+    used_ids.merge(segment.used_ids);
+    utils::DeleteFile(segment.path);
+  }
+  if (auto error = *maybe_error.Lock()) {
+    std::rethrow_exception(error);
+  }
+  return batch_infos;
+}
+
+/// Writes the objects of `skip_list` with the given `gids` like `WriteObjects`,
+/// in a single batch. The gids of the objects which don't exist anymore or
+/// aren't written are appended to `deleted`.
+template <typename TObject, typename TFunc>
+std::vector<BatchInfo> WriteModifiedObjects(Encoder &snapshot, utils::SkipList<TObject> *skip_list,
+                                            const std::vector<Gid> &gids, const TFunc &write_object,
+                                            std::unordered_set<uint64_t> &used_ids, uint64_t &count,
+                                            std::vector<Gid> &deleted, bool compress, SnapshotProgress &progress) {
+  std::vector<BatchInfo> batch_infos;
+  const auto batch_start_offset = snapshot.GetPosition();
+  uint64_t items_in_batch = 0;
+  auto acc = skip_list->access();
+  if (compress) snapshot.EnableCompression();
+  for (const auto gid : gids) {
+    auto it = acc.find(gid);
+    if (it != acc.end() && write_object(snapshot, *it, used_ids)) {
+      if (compress) snapshot.FinishRecord();
+      ++items_in_batch;
+    } else {
+      deleted.push_back(gid);
+    }
+  }
+  if (compress) snapshot.DisableCompression();
+  if (items_in_batch > 0) {
+    batch_infos.push_back(BatchInfo{batch_start_offset, items_in_batch});
+  }
+  count += items_in_batch;
+  progress.Add(items_in_batch);
+  return batch_infos;
+}
+
+}  // namespace
+
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
                     utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
                     Indices *indices, Constraints *constraints, const Config &config, const std::string &uuid,
                     const std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
-                    utils::FileRetainer *file_retainer) {
+                    utils::FileRetainer *file_retainer, const SnapshotIncrement *increment,
+                    utils::WriteThrottle *write_throttle) {
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(snapshot_directory);
 
   // Create snapshot file.
   auto path = snapshot_directory / MakeSnapshotName(transaction->start_timestamp);
-  spdlog::info("Starting snapshot creation to {}", path);
+  if (increment) {
+    spdlog::info("Starting incremental snapshot creation to {}", path);
+  } else {
+    spdlog::info("Starting snapshot creation to {}", path);
+  }
   Encoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic, kVersion);
+  snapshot.Initialize(path, increment ? kIncrementalSnapshotMagic : kSnapshotMagic, kVersion);
+  snapshot.SetWriteThrottle(write_throttle);
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -1390,6 +2198,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   uint64_t offset_epoch_history = 0;
   uint64_t offset_edge_batches = 0;
   uint64_t offset_vertex_batches = 0;
+  uint64_t offset_deleted_objects = 0;
   {
     snapshot.WriteMarker(Marker::SECTION_OFFSETS);
     offset_offsets = snapshot.GetPosition();
@@ -1402,6 +2211,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(offset_metadata);
     snapshot.WriteUint(offset_edge_batches);
     snapshot.WriteUint(offset_vertex_batches);
+    if (increment) snapshot.WriteUint(offset_deleted_objects);
   }
 
   // Object counters.
@@ -1415,152 +2225,59 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(mapping.AsUint());
   };
 
+  // Incremental snapshots are small enough to be written on a single thread.
+  const auto thread_count = increment ? 1 : config.durability.snapshot_thread_count;
+  const auto segments_directory = snapshot_directory / kSnapshotSegmentsDirectory;
+  if (thread_count > 1) {
+    // Remove the segments left behind by an interrupted snapshot.
+    utils::DeleteDir(segments_directory);
+    utils::EnsureDirOrDie(segments_directory);
+  }
+
+  auto write_edge = [&](Encoder &encoder, Edge &edge, std::unordered_set<uint64_t> &ids) {
+    return WriteEdge(encoder, edge, transaction, indices, constraints, config.items, ids);
+  };
+  auto write_vertex = [&](Encoder &encoder, Vertex &vertex, std::unordered_set<uint64_t> &ids) {
+    return WriteVertex(encoder, vertex, transaction, indices, constraints, config.items, ids);
+  };
+
+  SnapshotProgress progress(
+      increment ? increment->vertices.size() + (config.items.AnyPropertiesOnEdges() ? increment->edges.size() : 0)
+                : vertices->size() + (config.items.AnyPropertiesOnEdges() ? edges->size() : 0));
+
+  // The modified objects which an incremental snapshot stores as deleted.
+  std::vector<Gid> deleted_edges;
+  std::vector<Gid> deleted_vertices;
+
   std::vector<BatchInfo> edge_batch_infos;
-  auto items_in_current_batch{0UL};
-  auto batch_start_offset{0UL};
   // Store all edges.
-  if (config.items.properties_on_edges) {
+  if (config.items.AnyPropertiesOnEdges()) {
     offset_edges = snapshot.GetPosition();
-    batch_start_offset = offset_edges;
-    auto acc = edges->access();
-    for (auto &edge : acc) {
-      // The edge visibility check must be done here manually because we don't
-      // allow direct access to the edges through the public API.
-      bool is_visible = true;
-      Delta *delta = nullptr;
-      {
-        auto guard = std::shared_lock{edge.lock};
-        is_visible = !edge.deleted;
-        delta = edge.delta;
-      }
-      ApplyDeltasForRead(transaction, delta, View::OLD, [&is_visible](const Delta &delta) {
-        switch (delta.action) {
-          case Delta::Action::ADD_LABEL:
-          case Delta::Action::REMOVE_LABEL:
-          case Delta::Action::SET_PROPERTY:
-          case Delta::Action::ADD_IN_EDGE:
-          case Delta::Action::ADD_OUT_EDGE:
-          case Delta::Action::REMOVE_IN_EDGE:
-          case Delta::Action::REMOVE_OUT_EDGE:
-            break;
-          case Delta::Action::RECREATE_OBJECT: {
-            is_visible = true;
-            break;
-          }
-          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
-          case Delta::Action::DELETE_OBJECT: {
-            is_visible = false;
-            break;
-          }
-        }
-      });
-      if (!is_visible) continue;
-      EdgeRef edge_ref(&edge);
-      // Here we create an edge accessor that we will use to get the
-      // properties of the edge. The accessor is created with an invalid
-      // type and invalid from/to pointers because we don't know them here,
-      // but that isn't an issue because we won't use that part of the API
-      // here.
-      auto ea = EdgeAccessor{
-          edge_ref, EdgeTypeId::FromUint(0UL), nullptr, nullptr, transaction, indices, constraints, config.items};
-
-      // Get edge data.
-      auto maybe_props = ea.Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-
-      // Store the edge.
-      {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-      }
-
-      ++edges_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == config.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
+    if (increment) {
+      edge_batch_infos = WriteModifiedObjects(snapshot, edges, increment->edges, write_edge, used_ids, edges_count,
+                                              deleted_edges, config.durability.compression, progress);
+    } else {
+      edge_batch_infos = WriteObjects(snapshot, edges, write_edge, config.durability.items_per_batch, thread_count,
+                                      segments_directory, used_ids, edges_count, config.durability.compression,
+                                      write_throttle, progress);
     }
   }
 
-  if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-  }
-
-  std::vector<BatchInfo> vertex_batch_infos;
   // Store all vertices.
-  {
-    items_in_current_batch = 0;
-    offset_vertices = snapshot.GetPosition();
-    batch_start_offset = offset_vertices;
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
-      // The visibility check is implemented for vertices so we use it here.
-      auto va = VertexAccessor::Create(&vertex, transaction, indices, constraints, config.items, View::OLD);
-      if (!va) continue;
-
-      // Get vertex data.
-      // TODO (mferencevic): All of these functions could be written into a
-      // single function so that we traverse the undo deltas only once.
-      auto maybe_labels = va->Labels(View::OLD);
-      MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
-      auto maybe_props = va->Properties(View::OLD);
-      MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
-      auto maybe_in_edges = va->InEdges(View::OLD);
-      MG_ASSERT(maybe_in_edges.HasValue(), "Invalid database state!");
-      auto maybe_out_edges = va->OutEdges(View::OLD);
-      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
-
-      // Store the vertex.
-      {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
-        const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
-        for (const auto &item : labels) {
-          write_mapping(item);
-        }
-        const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
-        for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
-        }
-        const auto &in_edges = maybe_in_edges.GetValue().edges;
-        snapshot.WriteUint(in_edges.size());
-        for (const auto &item : in_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.FromVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-        const auto &out_edges = maybe_out_edges.GetValue().edges;
-        snapshot.WriteUint(out_edges.size());
-        for (const auto &item : out_edges) {
-          snapshot.WriteUint(item.Gid().AsUint());
-          snapshot.WriteUint(item.ToVertex().Gid().AsUint());
-          write_mapping(item.EdgeType());
-        }
-      }
-
-      ++vertices_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == config.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
+  offset_vertices = snapshot.GetPosition();
+  std::vector<BatchInfo> vertex_batch_infos;
+  if (increment) {
+    vertex_batch_infos = WriteModifiedObjects(snapshot, vertices, increment->vertices, write_vertex, used_ids,
+                                              vertices_count, deleted_vertices, config.durability.compression,
+                                              progress);
+  } else {
+    vertex_batch_infos = WriteObjects(snapshot, vertices, write_vertex, config.durability.items_per_batch,
+                                      thread_count, segments_directory, used_ids, vertices_count,
+                                      config.durability.compression, write_throttle, progress);
+  }
 
-    if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-    }
+  if (thread_count > 1) {
+    utils::DeleteDir(segments_directory);
   }
 
   // Write indices.
@@ -1568,9 +2285,13 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     offset_indices = snapshot.GetPosition();
     snapshot.WriteMarker(Marker::SECTION_INDICES);
 
+    // The indices which are still created after the recovery are written too.
+    const auto &pending = indices->pending_recovery_;
+
     // Write label indices.
     {
       auto label = indices->label_index_->ListIndices();
+      label.insert(label.end(), pending.label.begin(), pending.label.end());
       snapshot.WriteUint(label.size());
       for (const auto &item : label) {
         write_mapping(item);
@@ -1580,12 +2301,104 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     // Write label+property indices.
     {
       auto label_property = indices->label_property_index_->ListIndices();
+      label_property.insert(label_property.end(), pending.label_property.begin(), pending.label_property.end());
       snapshot.WriteUint(label_property.size());
       for (const auto &item : label_property) {
         write_mapping(item.first);
         write_mapping(item.second);
       }
     }
+
+    // Write label+property composite indices.
+    {
+      auto label_property_composite = indices->label_property_composite_index_->ListIndices();
+      snapshot.WriteUint(label_property_composite.size());
+      for (const auto &[label, properties] : label_property_composite) {
+        write_mapping(label);
+        snapshot.WriteUint(properties.size());
+        for (const auto &property : properties) {
+          write_mapping(property);
+        }
+      }
+    }
+
+    // Write edge type and edge type+property indices.
+    {
+      auto edge_type = indices->edge_type_index_->ListIndices();
+      snapshot.WriteUint(edge_type.size());
+      for (const auto &item : edge_type) {
+        write_mapping(item);
+      }
+      auto edge_type_property = indices->edge_type_property_index_->ListIndices();
+      snapshot.WriteUint(edge_type_property.size());
+      for (const auto &item : edge_type_property) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+      }
+    }
+
+    // Write label+property index statistics.
+    {
+      auto *mem_label_property_index = static_cast<InMemoryLabelPropertyIndex *>(indices->label_property_index_.get());
+      auto label_property_stats = pending.label_property_stats;
+      for (const auto &item : mem_label_property_index->ListIndices()) {
+        if (auto stats = mem_label_property_index->GetIndexStats(item)) {
+          label_property_stats.emplace_back(item, std::move(*stats));
+        }
+      }
+      snapshot.WriteUint(label_property_stats.size());
+      for (const auto &[item, stats] : label_property_stats) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+        snapshot.WriteUint(stats.count);
+        snapshot.WriteUint(stats.distinct_values_count);
+        snapshot.WriteDouble(stats.statistic);
+        snapshot.WriteDouble(stats.avg_group_size);
+        snapshot.WriteDouble(stats.avg_degree);
+        snapshot.WritePropertyValue(stats.histogram.lower);
+        snapshot.WriteUint(stats.histogram.buckets.size());
+        for (const auto &bucket : stats.histogram.buckets) {
+          snapshot.WritePropertyValue(bucket.upper);
+          snapshot.WriteUint(bucket.count);
+          snapshot.WriteUint(bucket.distinct_values_count);
+        }
+        snapshot.WriteUint(stats.histogram.most_common_values.size());
+        for (const auto &[value, count] : stats.histogram.most_common_values) {
+          snapshot.WritePropertyValue(value);
+          snapshot.WriteUint(count);
+        }
+      }
+    }
+
+    // Write text indices.
+    {
+      auto text = indices->text_index_->ListIndices();
+      snapshot.WriteUint(text.size());
+      for (const auto &item : text) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+      }
+    }
+
+    // Write point indices.
+    {
+      auto point = indices->point_index_->ListIndices();
+      snapshot.WriteUint(point.size());
+      for (const auto &item : point) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+      }
+    }
+
+    // Write vector indices.
+    {
+      auto vector = indices->vector_index_->ListIndices();
+      snapshot.WriteUint(vector.size());
+      for (const auto &item : vector) {
+        write_mapping(item.first);
+        write_mapping(item.second);
+      }
+    }
   }
 
   // Write constraints.
@@ -1622,7 +2435,11 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     offset_mapper = snapshot.GetPosition();
     snapshot.WriteMarker(Marker::SECTION_MAPPER);
     snapshot.WriteUint(used_ids.size());
-    for (auto item : used_ids) {
+    // Sorted, so that the recovery can keep the ids, see
+    // `NameIdMapper::NameToIdPreferring`.
+    std::vector<uint64_t> sorted_ids(used_ids.begin(), used_ids.end());
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    for (auto item : sorted_ids) {
       snapshot.WriteUint(item);
       snapshot.WriteString(name_id_mapper->IdToName(item));
     }
@@ -1648,6 +2465,10 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(transaction->start_timestamp);
     snapshot.WriteUint(edges_count);
     snapshot.WriteUint(vertices_count);
+    if (increment) {
+      snapshot.WriteUint(increment->base_timestamp);
+      snapshot.WriteUint(increment->previous_timestamp);
+    }
   }
 
   auto write_batch_infos = [&snapshot](const std::vector<BatchInfo> &batch_infos) {
@@ -1670,6 +2491,20 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     write_batch_infos(vertex_batch_infos);
   }
 
+  // Write deleted objects.
+  if (increment) {
+    offset_deleted_objects = snapshot.GetPosition();
+    snapshot.WriteMarker(Marker::SECTION_DELETED_OBJECTS);
+    snapshot.WriteUint(deleted_edges.size());
+    for (const auto gid : deleted_edges) {
+      snapshot.WriteUint(gid.AsUint());
+    }
+    snapshot.WriteUint(deleted_vertices.size());
+    for (const auto gid : deleted_vertices) {
+      snapshot.WriteUint(gid.AsUint());
+    }
+  }
+
   // Write true offsets.
   {
     snapshot.SetPosition(offset_offsets);
@@ -1682,14 +2517,20 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
     snapshot.WriteUint(offset_metadata);
     snapshot.WriteUint(offset_edge_batches);
     snapshot.WriteUint(offset_vertex_batches);
+    if (increment) snapshot.WriteUint(offset_deleted_objects);
   }
 
   // Finalize snapshot file.
+  const auto snapshot_size = snapshot.GetSize();
   snapshot.Finalize();
+  metrics::IncrementCounter(metrics::SnapshotBytesWritten, snapshot_size);
   spdlog::info("Snapshot creation successful!");
 
-  // Ensure exactly `snapshot_retention_count` snapshots exist.
+  // Ensure exactly `snapshot_retention_count` full snapshots exist. The base
+  // snapshot of an incremental snapshot counts as the new one. Incremental
+  // snapshots are kept as long as their base snapshot.
   std::vector<std::pair<uint64_t, std::filesystem::path>> old_snapshot_files;
+  std::vector<std::pair<uint64_t, std::filesystem::path>> old_incremental_snapshot_files;
   {
     std::error_code error_code;
     for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
@@ -1698,6 +2539,11 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       try {
         auto info = ReadSnapshotInfo(item.path());
         if (info.uuid != uuid) continue;
+        if (info.incremental) {
+          old_incremental_snapshot_files.emplace_back(info.base_timestamp, item.path());
+          continue;
+        }
+        if (increment && info.start_timestamp == increment->base_timestamp) continue;
         old_snapshot_files.emplace_back(info.start_timestamp, item.path());
       } catch (const RecoveryFailure &e) {
         spdlog::warn("Found a corrupt snapshot file {} becuase of: {}", item.path(), e.what());
@@ -1719,6 +2565,13 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
       }
       old_snapshot_files.erase(old_snapshot_files.begin(), old_snapshot_files.begin() + num_to_erase);
     }
+
+    for (const auto &[base_timestamp, snapshot_path] : old_incremental_snapshot_files) {
+      if (increment && base_timestamp == increment->base_timestamp) continue;
+      const auto base_exists = std::any_of(old_snapshot_files.begin(), old_snapshot_files.end(),
+                                           [base_timestamp](const auto &item) { return item.first == base_timestamp; });
+      if (!base_exists) file_retainer->DeleteFile(snapshot_path);
+    }
   }
 
   // Ensure that only the absolutely necessary WAL files exist.
@@ -1743,7 +2596,7 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
                                  error_code.message(), "https://memgr.ph/snapshots"));
     }
     std::sort(wal_files.begin(), wal_files.end());
-    uint64_t snapshot_start_timestamp = transaction->start_timestamp;
+    uint64_t snapshot_start_timestamp = increment ? increment->base_timestamp : transaction->start_timestamp;
     if (!old_snapshot_files.empty()) {
       snapshot_start_timestamp = old_snapshot_files.front().first;
     }
@@ -1770,4 +2623,57 @@ void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snaps
   }
 }
 
+void SnapshotChangeTracker::Record(const Transaction &transaction, const uint64_t commit_timestamp) {
+  auto record = [commit_timestamp](auto &objects, const Gid gid) {
+    auto [it, inserted] = objects.try_emplace(gid, Modifications{commit_timestamp, commit_timestamp});
+    it->second.last_commit_timestamp = commit_timestamp;
+  };
+  modified_.WithLock([&](auto &modified) {
+    for (const auto &delta : transaction.deltas.use()) {
+      // Only the newest delta of each object points to the object itself.
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX:
+          record(modified.vertices, prev.vertex->gid);
+          break;
+        case PreviousPtr::Type::EDGE:
+          record(modified.edges, prev.edge->gid);
+          break;
+        case PreviousPtr::Type::DELTA:
+        case PreviousPtr::Type::NULLPTR:
+          break;
+      }
+    }
+  });
+}
+
+SnapshotIncrement SnapshotChangeTracker::Take(const uint64_t snapshot_timestamp) {
+  SnapshotIncrement increment{};
+  auto take = [snapshot_timestamp](auto &objects, std::vector<Gid> &gids) {
+    for (auto it = objects.begin(); it != objects.end();) {
+      auto &modifications = it->second;
+      if (modifications.first_commit_timestamp > snapshot_timestamp) {
+        ++it;
+        continue;
+      }
+      gids.push_back(it->first);
+      if (modifications.last_commit_timestamp < snapshot_timestamp) {
+        it = objects.erase(it);
+      } else {
+        // The object was modified again after the snapshot transaction
+        // started, so the next snapshot has to store it as well.
+        modifications.first_commit_timestamp = modifications.last_commit_timestamp;
+        ++it;
+      }
+    }
+  };
+  modified_.WithLock([&](auto &modified) {
+    take(modified.vertices, increment.vertices);
+    take(modified.edges, increment.edges);
+  });
+  std::sort(increment.vertices.begin(), increment.vertices.end());
+  std::sort(increment.edges.begin(), increment.edges.end());
+  return increment;
+}
+
 }  // namespace memgraph::storage::durability
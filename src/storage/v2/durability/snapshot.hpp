@@ -14,6 +14,8 @@
 #include <cstdint>
 #include <filesystem>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/constraints/constraints.hpp"
@@ -25,6 +27,8 @@
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -39,12 +43,62 @@ struct SnapshotInfo {
   uint64_t offset_metadata;
   uint64_t offset_edge_batches;
   uint64_t offset_vertex_batches;
+  // `0` if the snapshot isn't incremental.
+  uint64_t offset_deleted_objects;
 
   std::string uuid;
   std::string epoch_id;
   uint64_t start_timestamp;
   uint64_t edges_count;
   uint64_t vertices_count;
+
+  // An incremental snapshot is applied on top of the full snapshot created at
+  // `base_timestamp` and the incremental snapshots between them, the latest
+  // of which was created at `previous_timestamp`.
+  bool incremental{false};
+  uint64_t base_timestamp{0};
+  uint64_t previous_timestamp{0};
+};
+
+/// The objects an incremental snapshot stores, and the snapshots it's applied
+/// on top of.
+struct SnapshotIncrement {
+  uint64_t base_timestamp;
+  uint64_t previous_timestamp;
+  // Sorted gids of the objects changed since the previous snapshot. The
+  // objects which aren't visible to the snapshot transaction are stored as
+  // deleted.
+  std::vector<Gid> vertices;
+  std::vector<Gid> edges;
+};
+
+/// Collects the gids of the objects modified by committed transactions, which
+/// are the objects the next incremental snapshot has to store.
+class SnapshotChangeTracker {
+ public:
+  /// Records the objects modified by `transaction`. Has to be called while
+  /// holding the engine lock, with the commit timestamp of the transaction.
+  void Record(const Transaction &transaction, uint64_t commit_timestamp);
+
+  /// Returns the objects modified by the transactions committed before
+  /// `snapshot_timestamp`, sorted by gid, and forgets about them. The
+  /// `base_timestamp` and `previous_timestamp` of the result are left unset.
+  SnapshotIncrement Take(uint64_t snapshot_timestamp);
+
+ private:
+  // The commit timestamps of the first and of the last transaction which
+  // modified an object since it was last taken.
+  struct Modifications {
+    uint64_t first_commit_timestamp;
+    uint64_t last_commit_timestamp;
+  };
+
+  struct ModifiedObjects {
+    std::unordered_map<Gid, Modifications> vertices;
+    std::unordered_map<Gid, Modifications> edges;
+  };
+
+  utils::Synchronized<ModifiedObjects, utils::SpinLock> modified_;
 };
 
 /// Structure used to hold information about the snapshot that has been
@@ -59,19 +113,24 @@ struct RecoveredSnapshot {
 /// @throw RecoveryFailure
 SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path);
 
-/// Function used to load the snapshot data into the storage.
+/// Function used to load the snapshot data into the storage. An incremental
+/// snapshot is applied on top of the data loaded from the snapshots before it,
+/// the next vertex and edge IDs it returns only account for its own objects.
 /// @throw RecoveryFailure
 RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipList<Vertex> *vertices,
                                utils::SkipList<Edge> *edges,
                                std::deque<std::pair<std::string, uint64_t>> *epoch_history,
                                NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, const Config &config);
 
-/// Function used to create a snapshot using the given transaction.
+/// Function used to create a snapshot using the given transaction. The
+/// snapshot is incremental if `increment` isn't `nullptr`. Its files are
+/// written through `write_throttle` if it isn't `nullptr`.
 void CreateSnapshot(Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, uint64_t snapshot_retention_count,
                     utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper,
                     Indices *indices, Constraints *constraints, const Config &config, const std::string &uuid,
                     std::string_view epoch_id, const std::deque<std::pair<std::string, uint64_t>> &epoch_history,
-                    utils::FileRetainer *file_retainer);
+                    utils::FileRetainer *file_retainer, const SnapshotIncrement *increment = nullptr,
+                    utils::WriteThrottle *write_throttle = nullptr);
 
 }  // namespace memgraph::storage::durability
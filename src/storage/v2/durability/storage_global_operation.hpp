@@ -23,6 +23,18 @@ enum class StorageGlobalOperation {
   EXISTENCE_CONSTRAINT_DROP,
   UNIQUE_CONSTRAINT_CREATE,
   UNIQUE_CONSTRAINT_DROP,
+  LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+  LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
+  EDGE_TYPE_INDEX_CREATE,
+  EDGE_TYPE_INDEX_DROP,
+  EDGE_TYPE_PROPERTY_INDEX_CREATE,
+  EDGE_TYPE_PROPERTY_INDEX_DROP,
+  TEXT_INDEX_CREATE,
+  TEXT_INDEX_DROP,
+  POINT_INDEX_CREATE,
+  POINT_INDEX_DROP,
+  VECTOR_INDEX_CREATE,
+  VECTOR_INDEX_DROP,
 };
 
 }  // namespace memgraph::storage::durability
@@ -20,13 +20,24 @@ namespace memgraph::storage::durability {
 // The current version of snapshot and WAL encoding / decoding.
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
-const uint64_t kVersion{15};
+const uint64_t kVersion{25};
 
 const uint64_t kOldestSupportedVersion{14};
 const uint64_t kUniqueConstraintVersion{13};
+const uint64_t kCompositeIndexVersion{16};
+const uint64_t kEdgeIndexVersion{17};
+const uint64_t kIndexStatsVersion{18};
+const uint64_t kTextIndexVersion{19};
+const uint64_t kPointIndexVersion{20};
+const uint64_t kVectorIndexVersion{21};
+const uint64_t kIncrementalSnapshotVersion{22};
+const uint64_t kCompressionVersion{23};
+const uint64_t kPropertyBufferVersion{24};
+const uint64_t kCompactDeltaVersion{25};
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
+const std::string kIncrementalSnapshotMagic{"MGsi"};
 const std::string kWalMagic{"MGwl"};
 
 static_assert(std::is_same_v<uint8_t, unsigned char>);
@@ -11,14 +11,24 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <unordered_set>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/edge.hpp"
 #include "storage/v2/vertex.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+#include "utils/thread.hpp"
+
+namespace memgraph::metrics {
+extern const Event WalBytesWritten;
+}  // namespace memgraph::metrics
 
 namespace memgraph::storage::durability {
 
@@ -69,6 +79,21 @@ namespace memgraph::storage::durability {
 //         * unique constraint create, unique constraint drop
 //              * label name
 //              * property names
+//         * label property composite index create, label property composite
+//           index drop
+//              * label name
+//              * property names, in the order of the index
+//         * edge type index create, edge type index drop
+//              * edge type name
+//         * edge type property index create, edge type property index drop
+//              * edge type name
+//              * property name
+//         * text index create, text index drop
+//              * label name
+//              * property name
+//         * point index create, point index drop
+//              * label name
+//              * property name
 //
 // IMPORTANT: When changing WAL encoding/decoding bump the snapshot/WAL version
 // in `version.hpp`.
@@ -93,6 +118,30 @@ Marker OperationToMarker(StorageGlobalOperation operation) {
       return Marker::DELTA_UNIQUE_CONSTRAINT_CREATE;
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return Marker::DELTA_UNIQUE_CONSTRAINT_DROP;
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+      return Marker::DELTA_EDGE_TYPE_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+      return Marker::DELTA_EDGE_TYPE_INDEX_DROP;
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case StorageGlobalOperation::TEXT_INDEX_CREATE:
+      return Marker::DELTA_TEXT_INDEX_CREATE;
+    case StorageGlobalOperation::TEXT_INDEX_DROP:
+      return Marker::DELTA_TEXT_INDEX_DROP;
+    case StorageGlobalOperation::POINT_INDEX_CREATE:
+      return Marker::DELTA_POINT_INDEX_CREATE;
+    case StorageGlobalOperation::POINT_INDEX_DROP:
+      return Marker::DELTA_POINT_INDEX_DROP;
+    case StorageGlobalOperation::VECTOR_INDEX_CREATE:
+      return Marker::DELTA_VECTOR_INDEX_CREATE;
+    case StorageGlobalOperation::VECTOR_INDEX_DROP:
+      return Marker::DELTA_VECTOR_INDEX_DROP;
   }
 }
 
@@ -162,6 +211,30 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
       return WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
+    case Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE;
+    case Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_TYPE_INDEX_DROP;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case Marker::DELTA_TEXT_INDEX_CREATE:
+      return WalDeltaData::Type::TEXT_INDEX_CREATE;
+    case Marker::DELTA_TEXT_INDEX_DROP:
+      return WalDeltaData::Type::TEXT_INDEX_DROP;
+    case Marker::DELTA_POINT_INDEX_CREATE:
+      return WalDeltaData::Type::POINT_INDEX_CREATE;
+    case Marker::DELTA_POINT_INDEX_DROP:
+      return WalDeltaData::Type::POINT_INDEX_DROP;
+    case Marker::DELTA_VECTOR_INDEX_CREATE:
+      return WalDeltaData::Type::VECTOR_INDEX_CREATE;
+    case Marker::DELTA_VECTOR_INDEX_DROP:
+      return WalDeltaData::Type::VECTOR_INDEX_DROP;
 
     case Marker::TYPE_NULL:
     case Marker::TYPE_BOOL:
@@ -171,7 +244,10 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     case Marker::TYPE_LIST:
     case Marker::TYPE_MAP:
     case Marker::TYPE_TEMPORAL_DATA:
+    case Marker::TYPE_POINT:
     case Marker::TYPE_PROPERTY_VALUE:
+    case Marker::TYPE_VARINT:
+    case Marker::TYPE_COMPACT_STRING:
     case Marker::SECTION_VERTEX:
     case Marker::SECTION_EDGE:
     case Marker::SECTION_MAPPER:
@@ -180,6 +256,8 @@ WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     case Marker::SECTION_CONSTRAINTS:
     case Marker::SECTION_DELTA:
     case Marker::SECTION_EPOCH_HISTORY:
+    case Marker::SECTION_DELETED_OBJECTS:
+    case Marker::SECTION_COMPRESSED_BLOCK:
     case Marker::SECTION_OFFSETS:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
@@ -276,7 +354,13 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
-    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
+    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::TEXT_INDEX_CREATE:
+    case WalDeltaData::Type::TEXT_INDEX_DROP:
+    case WalDeltaData::Type::POINT_INDEX_CREATE:
+    case WalDeltaData::Type::POINT_INDEX_DROP:
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE:
+    case WalDeltaData::Type::VECTOR_INDEX_DROP: {
       if constexpr (read_data) {
         auto label = decoder->ReadString();
         if (!label) throw RecoveryFailure("Invalid WAL data!");
@@ -310,6 +394,56 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
           if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
         }
       }
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.properties.reserve(*properties_count);
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_property_list.properties.push_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type.edge_type = std::move(*edge_type);
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto edge_type = decoder->ReadString();
+        if (!edge_type) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.edge_type = std::move(*edge_type);
+        auto property = decoder->ReadString();
+        if (!property) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_edge_type_property.property = std::move(*property);
+      } else {
+        if (!decoder->SkipString() || !decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
     }
   }
 
@@ -451,12 +585,29 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::TEXT_INDEX_CREATE:
+    case WalDeltaData::Type::TEXT_INDEX_DROP:
+    case WalDeltaData::Type::POINT_INDEX_CREATE:
+    case WalDeltaData::Type::POINT_INDEX_DROP:
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE:
+    case WalDeltaData::Type::VECTOR_INDEX_DROP:
       return a.operation_label_property.label == b.operation_label_property.label &&
              a.operation_label_property.property == b.operation_label_property.property;
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return a.operation_label_property_list.label == b.operation_label_property_list.label &&
+             a.operation_label_property_list.properties == b.operation_label_property_list.properties;
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+      return a.operation_edge_type.edge_type == b.operation_edge_type.edge_type;
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return a.operation_edge_type_property.edge_type == b.operation_edge_type_property.edge_type &&
+             a.operation_edge_type_property.property == b.operation_edge_type_property.property;
   }
 }
 bool operator!=(const WalDeltaData &a, const WalDeltaData &b) { return !(a == b); }
@@ -489,20 +640,20 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
   // because the Delta's represent undo actions and we want to store redo
   // actions.
   encoder->WriteMarker(Marker::SECTION_DELTA);
-  encoder->WriteUint(timestamp);
+  encoder->WriteCompactUint(timestamp);
   auto guard = std::shared_lock{vertex.lock};
   switch (delta.action) {
     case Delta::Action::DELETE_DESERIALIZED_OBJECT:
     case Delta::Action::DELETE_OBJECT:
     case Delta::Action::RECREATE_OBJECT: {
       encoder->WriteMarker(VertexActionToMarker(delta.action));
-      encoder->WriteUint(vertex.gid.AsUint());
+      encoder->WriteCompactUint(vertex.gid.AsUint());
       break;
     }
     case Delta::Action::SET_PROPERTY: {
       encoder->WriteMarker(Marker::DELTA_VERTEX_SET_PROPERTY);
-      encoder->WriteUint(vertex.gid.AsUint());
-      encoder->WriteString(name_id_mapper->IdToName(delta.property.key.AsUint()));
+      encoder->WriteCompactUint(vertex.gid.AsUint());
+      encoder->WriteCompactString(name_id_mapper->IdToName(delta.property.key.AsUint()));
       // The property value is the value that is currently stored in the
       // vertex.
       // TODO (mferencevic): Mitigate the memory allocation introduced here
@@ -514,21 +665,21 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
     case Delta::Action::ADD_LABEL:
     case Delta::Action::REMOVE_LABEL: {
       encoder->WriteMarker(VertexActionToMarker(delta.action));
-      encoder->WriteUint(vertex.gid.AsUint());
-      encoder->WriteString(name_id_mapper->IdToName(delta.label.AsUint()));
+      encoder->WriteCompactUint(vertex.gid.AsUint());
+      encoder->WriteCompactString(name_id_mapper->IdToName(delta.label.AsUint()));
       break;
     }
     case Delta::Action::ADD_OUT_EDGE:
     case Delta::Action::REMOVE_OUT_EDGE: {
       encoder->WriteMarker(VertexActionToMarker(delta.action));
-      if (items.properties_on_edges) {
-        encoder->WriteUint(delta.vertex_edge.edge.ptr->gid.AsUint());
+      if (items.PropertiesOnEdges(delta.vertex_edge.edge_type)) {
+        encoder->WriteCompactUint(delta.vertex_edge.edge.ptr->gid.AsUint());
       } else {
-        encoder->WriteUint(delta.vertex_edge.edge.gid.AsUint());
+        encoder->WriteCompactUint(delta.vertex_edge.edge.gid.AsUint());
       }
-      encoder->WriteString(name_id_mapper->IdToName(delta.vertex_edge.edge_type.AsUint()));
-      encoder->WriteUint(vertex.gid.AsUint());
-      encoder->WriteUint(delta.vertex_edge.vertex->gid.AsUint());
+      encoder->WriteCompactString(name_id_mapper->IdToName(delta.vertex_edge.edge_type.AsUint()));
+      encoder->WriteCompactUint(vertex.gid.AsUint());
+      encoder->WriteCompactUint(delta.vertex_edge.vertex->gid.AsUint());
       break;
     }
     case Delta::Action::ADD_IN_EDGE:
@@ -545,13 +696,13 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
   // because the Delta's represent undo actions and we want to store redo
   // actions.
   encoder->WriteMarker(Marker::SECTION_DELTA);
-  encoder->WriteUint(timestamp);
+  encoder->WriteCompactUint(timestamp);
   auto guard = std::shared_lock{edge.lock};
   switch (delta.action) {
     case Delta::Action::SET_PROPERTY: {
       encoder->WriteMarker(Marker::DELTA_EDGE_SET_PROPERTY);
-      encoder->WriteUint(edge.gid.AsUint());
-      encoder->WriteString(name_id_mapper->IdToName(delta.property.key.AsUint()));
+      encoder->WriteCompactUint(edge.gid.AsUint());
+      encoder->WriteCompactString(name_id_mapper->IdToName(delta.property.key.AsUint()));
       // The property value is the value that is currently stored in the
       // edge.
       // TODO (mferencevic): Mitigate the memory allocation introduced here
@@ -579,52 +730,447 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
   }
 }
 
+void EncodeVertex(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Gid gid, const std::vector<LabelId> &labels,
+                  const std::map<PropertyId, PropertyValue> &properties, uint64_t timestamp) {
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteCompactUint(timestamp);
+  encoder->WriteMarker(Marker::DELTA_VERTEX_CREATE);
+  encoder->WriteCompactUint(gid.AsUint());
+  for (const auto &label : labels) {
+    encoder->WriteMarker(Marker::SECTION_DELTA);
+    encoder->WriteCompactUint(timestamp);
+    encoder->WriteMarker(Marker::DELTA_VERTEX_ADD_LABEL);
+    encoder->WriteCompactUint(gid.AsUint());
+    encoder->WriteCompactString(name_id_mapper->IdToName(label.AsUint()));
+  }
+  for (const auto &[property, value] : properties) {
+    encoder->WriteMarker(Marker::SECTION_DELTA);
+    encoder->WriteCompactUint(timestamp);
+    encoder->WriteMarker(Marker::DELTA_VERTEX_SET_PROPERTY);
+    encoder->WriteCompactUint(gid.AsUint());
+    encoder->WriteCompactString(name_id_mapper->IdToName(property.AsUint()));
+    encoder->WritePropertyValue(value);
+  }
+}
+
+void EncodeEdge(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Gid gid, EdgeTypeId edge_type, Gid from_vertex,
+                Gid to_vertex, const std::map<PropertyId, PropertyValue> &properties, uint64_t timestamp) {
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteCompactUint(timestamp);
+  encoder->WriteMarker(Marker::DELTA_EDGE_CREATE);
+  encoder->WriteCompactUint(gid.AsUint());
+  encoder->WriteCompactString(name_id_mapper->IdToName(edge_type.AsUint()));
+  encoder->WriteCompactUint(from_vertex.AsUint());
+  encoder->WriteCompactUint(to_vertex.AsUint());
+  for (const auto &[property, value] : properties) {
+    encoder->WriteMarker(Marker::SECTION_DELTA);
+    encoder->WriteCompactUint(timestamp);
+    encoder->WriteMarker(Marker::DELTA_EDGE_SET_PROPERTY);
+    encoder->WriteCompactUint(gid.AsUint());
+    encoder->WriteCompactString(name_id_mapper->IdToName(property.AsUint()));
+    encoder->WritePropertyValue(value);
+  }
+}
+
 void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp) {
   encoder->WriteMarker(Marker::SECTION_DELTA);
-  encoder->WriteUint(timestamp);
+  encoder->WriteCompactUint(timestamp);
   encoder->WriteMarker(Marker::DELTA_TRANSACTION_END);
 }
 
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp) {
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp) {
   encoder->WriteMarker(Marker::SECTION_DELTA);
-  encoder->WriteUint(timestamp);
+  encoder->WriteCompactUint(timestamp);
   switch (operation) {
     case StorageGlobalOperation::LABEL_INDEX_CREATE:
     case StorageGlobalOperation::LABEL_INDEX_DROP: {
       MG_ASSERT(properties.empty(), "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
-      encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
+      encoder->WriteCompactString(name_id_mapper->IdToName(label.AsUint()));
       break;
     }
     case StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
     case StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
     case StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
-    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP: {
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::TEXT_INDEX_CREATE:
+    case StorageGlobalOperation::TEXT_INDEX_DROP:
+    case StorageGlobalOperation::POINT_INDEX_CREATE:
+    case StorageGlobalOperation::POINT_INDEX_DROP:
+    case StorageGlobalOperation::VECTOR_INDEX_CREATE:
+    case StorageGlobalOperation::VECTOR_INDEX_DROP: {
       MG_ASSERT(properties.size() == 1, "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
-      encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
-      encoder->WriteString(name_id_mapper->IdToName((*properties.begin()).AsUint()));
+      encoder->WriteCompactString(name_id_mapper->IdToName(label.AsUint()));
+      encoder->WriteCompactString(name_id_mapper->IdToName((*properties.begin()).AsUint()));
       break;
     }
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
     case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP: {
       MG_ASSERT(!properties.empty(), "Invalid function call!");
       encoder->WriteMarker(OperationToMarker(operation));
-      encoder->WriteString(name_id_mapper->IdToName(label.AsUint()));
-      encoder->WriteUint(properties.size());
+      encoder->WriteCompactString(name_id_mapper->IdToName(label.AsUint()));
+      encoder->WriteCompactUint(properties.size());
+      for (const auto &property : properties) {
+        encoder->WriteCompactString(name_id_mapper->IdToName(property.AsUint()));
+      }
+      break;
+    }
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      MG_ASSERT(properties.size() > 1, "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteCompactString(name_id_mapper->IdToName(label.AsUint()));
+      encoder->WriteCompactUint(properties.size());
       for (const auto &property : properties) {
-        encoder->WriteString(name_id_mapper->IdToName(property.AsUint()));
+        encoder->WriteCompactString(name_id_mapper->IdToName(property.AsUint()));
       }
       break;
     }
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     EdgeTypeId edge_type, const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  encoder->WriteMarker(Marker::SECTION_DELTA);
+  encoder->WriteCompactUint(timestamp);
+  switch (operation) {
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_INDEX_DROP: {
+      MG_ASSERT(properties.empty(), "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteCompactString(name_id_mapper->IdToName(edge_type.AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+      MG_ASSERT(properties.size() == 1, "Invalid function call!");
+      encoder->WriteMarker(OperationToMarker(operation));
+      encoder->WriteCompactString(name_id_mapper->IdToName(edge_type.AsUint()));
+      encoder->WriteCompactString(name_id_mapper->IdToName((*properties.begin()).AsUint()));
+      break;
+    }
+    case StorageGlobalOperation::LABEL_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_INDEX_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_INDEX_DROP:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
+    case StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case StorageGlobalOperation::TEXT_INDEX_CREATE:
+    case StorageGlobalOperation::TEXT_INDEX_DROP:
+    case StorageGlobalOperation::POINT_INDEX_CREATE:
+    case StorageGlobalOperation::POINT_INDEX_DROP:
+    case StorageGlobalOperation::VECTOR_INDEX_CREATE:
+    case StorageGlobalOperation::VECTOR_INDEX_DROP:
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+namespace {
+
+// The number of per-object steps after which `LoadWal` applies the deltas read
+// so far. Batches end with a transaction, so they can be somewhat bigger.
+constexpr uint64_t kWalReplayBatchSize = 100'000;
+
+/// A change of a single object made by a WAL delta. Edge deltas change both of
+/// their vertices, so they are split into a step for each vertex.
+struct WalReplayStep {
+  enum class Kind : uint8_t {
+    DELETE_VERTEX,
+    ADD_LABEL,
+    REMOVE_LABEL,
+    SET_VERTEX_PROPERTY,
+    ADD_OUT_EDGE,
+    ADD_IN_EDGE,
+    REMOVE_OUT_EDGE,
+    REMOVE_IN_EDGE,
+    SET_EDGE_PROPERTY,
+  };
+
+  Kind kind;
+  Vertex *vertex{nullptr};
+  Edge *edge{nullptr};
+  LabelId label{};
+  PropertyId property{};
+  PropertyValue value{};
+  VertexEdge link{EdgeTypeId{}, nullptr, EdgeRef(Gid::FromUint(0))};
+};
+
+/// @throw RecoveryFailure
+void ApplyWalReplayStep(WalReplayStep &step) {
+  switch (step.kind) {
+    case WalReplayStep::Kind::DELETE_VERTEX: {
+      // The vertex is removed from the skip list after the whole batch is
+      // applied, because steps of its neighbours may still point to it.
+      if (!step.vertex->in_edges.empty() || !step.vertex->out_edges.empty())
+        throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
+      break;
+    }
+    case WalReplayStep::Kind::ADD_LABEL: {
+      auto &labels = step.vertex->labels;
+      if (std::find(labels.begin(), labels.end(), step.label) != labels.end())
+        throw RecoveryFailure("The vertex already has the label!");
+      labels.push_back(step.label);
+      break;
+    }
+    case WalReplayStep::Kind::REMOVE_LABEL: {
+      auto &labels = step.vertex->labels;
+      auto it = std::find(labels.begin(), labels.end(), step.label);
+      if (it == labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
+      *it = labels.back();
+      labels.pop_back();
+      break;
+    }
+    case WalReplayStep::Kind::SET_VERTEX_PROPERTY:
+      step.vertex->properties.SetProperty(step.property, step.value);
+      break;
+    case WalReplayStep::Kind::ADD_OUT_EDGE: {
+      auto it = FindVertexEdge(step.vertex->out_edges, step.link);
+      if (it != step.vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
+      AddVertexEdge(step.vertex->out_edges, step.link);
+      break;
+    }
+    case WalReplayStep::Kind::ADD_IN_EDGE: {
+      auto it = FindVertexEdge(step.vertex->in_edges, step.link);
+      if (it != step.vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
+      AddVertexEdge(step.vertex->in_edges, step.link);
+      break;
+    }
+    case WalReplayStep::Kind::REMOVE_OUT_EDGE: {
+      auto it = FindVertexEdge(step.vertex->out_edges, step.link);
+      if (it == step.vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
+      RemoveVertexEdge(step.vertex->out_edges, it);
+      break;
+    }
+    case WalReplayStep::Kind::REMOVE_IN_EDGE: {
+      auto it = FindVertexEdge(step.vertex->in_edges, step.link);
+      if (it == step.vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
+      RemoveVertexEdge(step.vertex->in_edges, it);
+      break;
+    }
+    case WalReplayStep::Kind::SET_EDGE_PROPERTY:
+      step.edge->properties.SetProperty(step.property, step.value);
+      break;
   }
 }
 
+/// Applies each queue of steps on its own thread. All steps of an object are
+/// in the same queue, so they are applied in the order of the WAL.
+/// @throw RecoveryFailure
+void ApplyWalReplaySteps(std::vector<std::vector<WalReplayStep>> &queues) {
+  if (queues.size() == 1) {
+    for (auto &step : queues.front()) ApplyWalReplayStep(step);
+    return;
+  }
+  utils::Synchronized<std::optional<RecoveryFailure>, utils::SpinLock> maybe_error{};
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(queues.size());
+    for (auto &queue : queues) {
+      if (queue.empty()) continue;
+      threads.emplace_back([&queue, &maybe_error]() {
+        try {
+          for (auto &step : queue) ApplyWalReplayStep(step);
+        } catch (RecoveryFailure &failure) {
+          *maybe_error.Lock() = std::move(failure);
+        }
+      });
+    }
+  }
+  if (maybe_error.Lock()->has_value()) {
+    throw RecoveryFailure((*maybe_error.Lock())->what());
+  }
+}
+
+/// Records an index or constraint operation, the indices and constraints are
+/// created once all data is recovered.
+/// @throw RecoveryFailure
+void RecoverWalOperation(const WalDeltaData &delta, RecoveredIndicesAndConstraints *indices_constraints,
+                         NameIdMapper *name_id_mapper) {
+  switch (delta.type) {
+    case WalDeltaData::Type::LABEL_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::LABEL_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id,
+                                     "The label index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                  "The label property index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                     "The label property index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::TEXT_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.text, {label_id, property_id},
+                                  "The text index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::TEXT_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.text, {label_id, property_id},
+                                     "The text index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::POINT_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.point, {label_id, property_id},
+                                  "The point index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::POINT_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.point, {label_id, property_id},
+                                     "The point index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.vector, {label_id, property_id},
+                                  "The vector index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::VECTOR_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.vector, {label_id, property_id},
+                                     "The vector index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                  "The existence constraint already exists!");
+      break;
+    }
+    case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+      auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                     "The existence constraint doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+      std::set<PropertyId> property_ids;
+      for (const auto &prop : delta.operation_label_properties.properties) {
+        property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+      }
+      AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                  "The unique constraint already exists!");
+      break;
+    }
+    case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+      std::set<PropertyId> property_ids;
+      for (const auto &prop : delta.operation_label_properties.properties) {
+        property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+      }
+      RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                     "The unique constraint doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+      std::vector<PropertyId> property_ids;
+      for (const auto &prop : delta.operation_label_property_list.properties) {
+        property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+      }
+      AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                  {label_id, std::move(property_ids)},
+                                  "The label property composite index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+      std::vector<PropertyId> property_ids;
+      for (const auto &prop : delta.operation_label_property_list.properties) {
+        property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
+      }
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                     {label_id, std::move(property_ids)},
+                                     "The label property composite index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE: {
+      auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                  "The edge type index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+      auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type, edge_type_id,
+                                     "The edge type index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE: {
+      auto edge_type_id =
+          EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+      auto property_id =
+          PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+      AddRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                  "The edge type property index already exists!");
+      break;
+    }
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+      auto edge_type_id =
+          EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+      auto property_id =
+          PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+      RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_type_property, {edge_type_id, property_id},
+                                     "The edge type property index doesn't exist!");
+      break;
+    }
+    case WalDeltaData::Type::VERTEX_CREATE:
+    case WalDeltaData::Type::VERTEX_DELETE:
+    case WalDeltaData::Type::VERTEX_ADD_LABEL:
+    case WalDeltaData::Type::VERTEX_REMOVE_LABEL:
+    case WalDeltaData::Type::VERTEX_SET_PROPERTY:
+    case WalDeltaData::Type::EDGE_CREATE:
+    case WalDeltaData::Type::EDGE_DELETE:
+    case WalDeltaData::Type::EDGE_SET_PROPERTY:
+    case WalDeltaData::Type::TRANSACTION_END:
+      LOG_FATAL("Invalid function call!");
+  }
+}
+
+}  // namespace
+
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items) {
+                     Config::Items items, uint64_t thread_count,
+                     const std::optional<uint64_t> last_timestamp_to_load) {
   spdlog::info("Trying to load WAL file {}.", path);
   RecoveryInfo ret;
 
@@ -643,16 +1189,63 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
     return ret;
   }
 
-  // Recover deltas.
+  // Recover deltas. The deltas are read and checked in order on this thread,
+  // which also creates the new objects. The changes of the objects are queued
+  // by object gid and applied on `thread_count` threads after every batch of
+  // transactions. Deleted objects are removed after their batch is applied.
   wal.SetPosition(info.offset_deltas);
   uint64_t deltas_applied = 0;
   auto edge_acc = edges->access();
   auto vertex_acc = vertices->access();
+  thread_count = std::max(thread_count, uint64_t{1});
+  std::vector<std::vector<WalReplayStep>> queues(thread_count);
+  uint64_t queued_steps = 0;
+  std::unordered_set<Gid> deleted_vertices;
+  std::unordered_set<Gid> deleted_edges;
+
+  auto queue_step = [&](Gid gid, WalReplayStep step) {
+    queues[gid.AsUint() % thread_count].push_back(std::move(step));
+    ++queued_steps;
+  };
+  auto find_vertex = [&](Gid gid, const char *error) {
+    auto vertex = vertex_acc.find(gid);
+    if (vertex == vertex_acc.end() || deleted_vertices.contains(gid)) throw RecoveryFailure(error);
+    return &*vertex;
+  };
+  auto find_edge = [&](Gid gid) {
+    auto edge = edge_acc.find(gid);
+    if (edge == edge_acc.end() || deleted_edges.contains(gid)) throw RecoveryFailure("The edge doesn't exist!");
+    return &*edge;
+  };
+  auto apply_queued_steps = [&]() {
+    ApplyWalReplaySteps(queues);
+    for (auto &queue : queues) queue.clear();
+    queued_steps = 0;
+    for (auto gid : deleted_vertices) {
+      if (!vertex_acc.remove(gid)) throw RecoveryFailure("The vertex must be removed here!");
+    }
+    deleted_vertices.clear();
+    for (auto gid : deleted_edges) {
+      if (!edge_acc.remove(gid)) throw RecoveryFailure("The edge must be removed here!");
+    }
+    deleted_edges.clear();
+  };
+
   spdlog::info("WAL file contains {} deltas.", info.num_deltas);
-  for (uint64_t i = 0; i < info.num_deltas; ++i) {
+  uint64_t deltas_read = 0;
+  std::optional<uint64_t> last_read_timestamp;
+  for (; deltas_read < info.num_deltas; ++deltas_read) {
     // Read WAL delta header to find out the delta timestamp.
     auto timestamp = ReadWalDeltaHeader(&wal);
 
+    // The timestamps of the deltas don't decrease, so all remaining deltas are
+    // after the last timestamp to load.
+    if (last_timestamp_to_load && timestamp > *last_timestamp_to_load) {
+      ret.last_commit_timestamp = last_read_timestamp;
+      break;
+    }
+    last_read_timestamp = timestamp;
+
     if (!last_loaded_timestamp || timestamp > *last_loaded_timestamp) {
       // This delta should be loaded.
       auto delta = ReadWalDeltaData(&wal);
@@ -666,190 +1259,108 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
           break;
         }
         case WalDeltaData::Type::VERTEX_DELETE: {
-          auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-          if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
-            throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
-
-          if (!vertex_acc.remove(delta.vertex_create_delete.gid))
-            throw RecoveryFailure("The vertex must be removed here!");
-
+          auto gid = delta.vertex_create_delete.gid;
+          auto *vertex = find_vertex(gid, "The vertex doesn't exist!");
+          deleted_vertices.insert(gid);
+          queue_step(gid, {.kind = WalReplayStep::Kind::DELETE_VERTEX, .vertex = vertex});
           break;
         }
         case WalDeltaData::Type::VERTEX_ADD_LABEL:
         case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
-          auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
+          auto gid = delta.vertex_add_remove_label.gid;
+          auto *vertex = find_vertex(gid, "The vertex doesn't exist!");
           auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
-          auto it = std::find(vertex->labels.begin(), vertex->labels.end(), label_id);
-
-          if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
-            if (it != vertex->labels.end()) throw RecoveryFailure("The vertex already has the label!");
-            vertex->labels.push_back(label_id);
-          } else {
-            if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
-            std::swap(*it, vertex->labels.back());
-            vertex->labels.pop_back();
-          }
-
+          auto kind = delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL ? WalReplayStep::Kind::ADD_LABEL
+                                                                          : WalReplayStep::Kind::REMOVE_LABEL;
+          queue_step(gid, {.kind = kind, .vertex = vertex, .label = label_id});
           break;
         }
         case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
-          auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
+          auto gid = delta.vertex_edge_set_property.gid;
+          auto *vertex = find_vertex(gid, "The vertex doesn't exist!");
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-
-          vertex->properties.SetProperty(property_id, property_value);
-
-          break;
-        }
-        case WalDeltaData::Type::EDGE_CREATE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto [edge, inserted] = edge_acc.insert(Edge{edge_gid, nullptr});
-            if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
-          }
-
-          ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
-
-          // Increment edge count.
-          edge_count->fetch_add(1, std::memory_order_acq_rel);
-
+          queue_step(gid, {.kind = WalReplayStep::Kind::SET_VERTEX_PROPERTY,
+                           .vertex = vertex,
+                           .property = property_id,
+                           .value = std::move(delta.vertex_edge_set_property.value)});
           break;
         }
+        case WalDeltaData::Type::EDGE_CREATE:
         case WalDeltaData::Type::EDGE_DELETE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto edge = edge_acc.find(edge_gid);
-            if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
+          const auto &edge_delta = delta.edge_create_delete;
+          auto *from_vertex = find_vertex(edge_delta.from_vertex, "The from vertex doesn't exist!");
+          auto *to_vertex = find_vertex(edge_delta.to_vertex, "The to vertex doesn't exist!");
+
+          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(edge_delta.edge_type));
+          EdgeRef edge_ref(edge_delta.gid);
+          const bool create = delta.type == WalDeltaData::Type::EDGE_CREATE;
+          if (items.PropertiesOnEdges(edge_type_id)) {
+            if (create) {
+              auto [edge, inserted] = edge_acc.insert(Edge{edge_delta.gid, nullptr});
+              if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
+              edge_ref = EdgeRef(&*edge);
+            } else {
+              edge_ref = EdgeRef(find_edge(edge_delta.gid));
+              deleted_edges.insert(edge_delta.gid);
+            }
           }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
-          }
-          if (items.properties_on_edges) {
-            if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
+          queue_step(edge_delta.from_vertex,
+                     {.kind = create ? WalReplayStep::Kind::ADD_OUT_EDGE : WalReplayStep::Kind::REMOVE_OUT_EDGE,
+                      .vertex = from_vertex,
+                      .link = {edge_type_id, to_vertex, edge_ref}});
+          queue_step(edge_delta.to_vertex,
+                     {.kind = create ? WalReplayStep::Kind::ADD_IN_EDGE : WalReplayStep::Kind::REMOVE_IN_EDGE,
+                      .vertex = to_vertex,
+                      .link = {edge_type_id, from_vertex, edge_ref}});
+
+          if (create) {
+            ret.next_edge_id = std::max(ret.next_edge_id, edge_delta.gid.AsUint() + 1);
+            edge_count->fetch_add(1, std::memory_order_acq_rel);
+          } else {
+            edge_count->fetch_add(-1, std::memory_order_acq_rel);
           }
 
-          // Decrement edge count.
-          edge_count->fetch_add(-1, std::memory_order_acq_rel);
-
           break;
         }
         case WalDeltaData::Type::EDGE_SET_PROPERTY: {
-          if (!items.properties_on_edges)
+          if (!items.AnyPropertiesOnEdges())
             throw RecoveryFailure(
                 "The WAL has properties on edges, but the storage is "
                 "configured without properties on edges!");
-          auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
-          if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
+          auto gid = delta.vertex_edge_set_property.gid;
+          auto *edge = find_edge(gid);
           auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-          edge->properties.SetProperty(property_id, property_value);
+          queue_step(gid, {.kind = WalReplayStep::Kind::SET_EDGE_PROPERTY,
+                           .edge = edge,
+                           .property = property_id,
+                           .value = std::move(delta.vertex_edge_set_property.value)});
           break;
         }
         case WalDeltaData::Type::TRANSACTION_END:
+          if (queued_steps >= kWalReplayBatchSize) apply_queued_steps();
           break;
-        case WalDeltaData::Type::LABEL_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id,
-                                         "The label index doesn't exist!");
+        case WalDeltaData::Type::LABEL_INDEX_CREATE:
+        case WalDeltaData::Type::LABEL_INDEX_DROP:
+        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE:
+        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
+        case WalDeltaData::Type::TEXT_INDEX_CREATE:
+        case WalDeltaData::Type::TEXT_INDEX_DROP:
+        case WalDeltaData::Type::POINT_INDEX_CREATE:
+        case WalDeltaData::Type::POINT_INDEX_DROP:
+        case WalDeltaData::Type::VECTOR_INDEX_CREATE:
+        case WalDeltaData::Type::VECTOR_INDEX_DROP:
+        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
+        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
+        case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
+        case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+        case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+        case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+          RecoverWalOperation(delta, indices_constraints, name_id_mapper);
           break;
-        }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                      "The label property index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                         "The label property index doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                      "The existence constraint already exists!");
-          break;
-        }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                         "The existence constraint doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
-          }
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                      "The unique constraint already exists!");
-          break;
-        }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
-          }
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                         "The unique constraint doesn't exist!");
-          break;
-        }
       }
       ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
       ++deltas_applied;
@@ -858,18 +1369,24 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
       SkipWalDeltaData(&wal);
     }
   }
+  apply_queued_steps();
 
   spdlog::info("Applied {} deltas from WAL. Skipped {} deltas, because they were too old.", deltas_applied,
-               info.num_deltas - deltas_applied);
+               deltas_read - deltas_applied);
+  if (deltas_read < info.num_deltas) {
+    spdlog::info("Didn't load {} deltas, because they are after timestamp {}.", info.num_deltas - deltas_read,
+                 *last_timestamp_to_load);
+  }
 
   return ret;
 }
 
 WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_view uuid,
                  const std::string_view epoch_id, Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-                 utils::FileRetainer *file_retainer)
+                 utils::FileRetainer *file_retainer, bool compress, WalFilePool *file_pool, bool direct_io)
     : items_(items),
       name_id_mapper_(name_id_mapper),
+      compress_(compress),
       path_(wal_directory / MakeWalName()),
       from_timestamp_(0),
       to_timestamp_(0),
@@ -879,8 +1396,21 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
   // Ensure that the storage directory exists.
   utils::EnsureDirOrDie(wal_directory);
 
+  // Take over a file with preallocated space if one is ready.
+  bool preallocated = false;
+  if (file_pool) {
+    if (auto pool_path = file_pool->Take()) {
+      std::error_code error_code;  // For exception suppression.
+      std::filesystem::rename(*pool_path, path_, error_code);
+      preallocated = !error_code;
+    }
+  }
+
   // Initialize the WAL file.
   wal_.Initialize(path_, kWalMagic, kVersion);
+  if (file_pool && !preallocated) {
+    wal_.Preallocate(file_pool->FileSize());
+  }
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -907,13 +1437,21 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, const std::string_v
 
   // Sync the initial data.
   wal_.Sync();
+
+  // The header is written in place, so direct I/O is enabled only after it.
+  if (direct_io && !wal_.EnableDirectIO()) {
+    spdlog::warn("The file system of {} doesn't support direct I/O, the WAL file is written through the page cache.",
+                 path_);
+  }
+  CountWrittenBytes();
 }
 
 WalFile::WalFile(std::filesystem::path current_wal_path, Config::Items items, NameIdMapper *name_id_mapper,
                  uint64_t seq_num, uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count,
-                 utils::FileRetainer *file_retainer)
+                 utils::FileRetainer *file_retainer, bool compress)
     : items_(items),
       name_id_mapper_(name_id_mapper),
+      compress_(compress),
       path_(std::move(current_wal_path)),
       from_timestamp_(from_timestamp),
       to_timestamp_(to_timestamp),
@@ -921,6 +1459,7 @@ WalFile::WalFile(std::filesystem::path current_wal_path, Config::Items items, Na
       seq_num_(seq_num),
       file_retainer_(file_retainer) {
   wal_.OpenExisting(path_);
+  counted_size_ = wal_.GetSize();
 }
 
 void WalFile::FinalizeWal() {
@@ -950,30 +1489,54 @@ WalFile::~WalFile() {
 }
 
 void WalFile::AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t timestamp) {
+  if (compress_ && !wal_.IsCompressionEnabled()) wal_.EnableCompression();
   EncodeDelta(&wal_, name_id_mapper_, items_, delta, vertex, timestamp);
+  if (compress_) wal_.FinishRecord();
   UpdateStats(timestamp);
 }
 
 void WalFile::AppendDelta(const Delta &delta, const Edge &edge, uint64_t timestamp) {
+  if (compress_ && !wal_.IsCompressionEnabled()) wal_.EnableCompression();
   EncodeDelta(&wal_, name_id_mapper_, delta, edge, timestamp);
+  if (compress_) wal_.FinishRecord();
   UpdateStats(timestamp);
 }
 
 void WalFile::AppendTransactionEnd(uint64_t timestamp) {
   EncodeTransactionEnd(&wal_, timestamp);
+  // The transaction has to be in the file before it's flushed or sent to the
+  // replicas.
+  if (wal_.IsCompressionEnabled()) wal_.DisableCompression();
   UpdateStats(timestamp);
+  CountWrittenBytes();
 }
 
-void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
-                              uint64_t timestamp) {
+void WalFile::AppendOperation(StorageGlobalOperation operation, LabelId label,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
   EncodeOperation(&wal_, name_id_mapper_, operation, label, properties, timestamp);
   UpdateStats(timestamp);
+  CountWrittenBytes();
+}
+
+void WalFile::AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type,
+                              const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  EncodeOperation(&wal_, name_id_mapper_, operation, edge_type, properties, timestamp);
+  UpdateStats(timestamp);
+  CountWrittenBytes();
 }
 
 void WalFile::Sync() { wal_.Sync(); }
 
+void WalFile::Flush() { wal_.Flush(); }
+
+void WalFile::SyncWithoutFlushing() { wal_.SyncWithoutFlushing(); }
+
 uint64_t WalFile::GetSize() { return wal_.GetSize(); }
 
+uint64_t WalFile::GetWrittenSize() { return wal_.GetWrittenSize(); }
+
+void WalFile::SetSyncPriority(utils::WriteThrottle *throttle) { wal_.SetSyncPriority(throttle); }
+
 uint64_t WalFile::SequenceNumber() const { return seq_num_; }
 
 void WalFile::UpdateStats(uint64_t timestamp) {
@@ -982,6 +1545,12 @@ void WalFile::UpdateStats(uint64_t timestamp) {
   count_ += 1;
 }
 
+void WalFile::CountWrittenBytes() {
+  const auto size = wal_.GetSize();
+  metrics::IncrementCounter(metrics::WalBytesWritten, size - counted_size_);
+  counted_size_ = size;
+}
+
 void WalFile::DisableFlushing() { wal_.DisableFlushing(); }
 
 void WalFile::EnableFlushing() { wal_.EnableFlushing(); }
@@ -990,4 +1559,95 @@ void WalFile::TryFlushing() { wal_.TryFlushing(); }
 
 std::pair<const uint8_t *, size_t> WalFile::CurrentFileBuffer() const { return wal_.CurrentFileBuffer(); }
 
+WalGroupCommit::WalGroupCommit() : thread_([this](std::stop_token stop_token) { Run(std::move(stop_token)); }) {}
+
+WalGroupCommit::~WalGroupCommit() { Drain(); }
+
+uint64_t WalGroupCommit::Enqueue(WalFile *wal_file) {
+  std::unique_lock guard(mutex_);
+  MG_ASSERT(wal_file_ == nullptr || wal_file_ == wal_file, "The WAL file was changed without draining its syncs!");
+  wal_file_ = wal_file;
+  const auto ticket = ++enqueued_;
+  guard.unlock();
+  requested_cv_.notify_one();
+  return ticket;
+}
+
+void WalGroupCommit::Wait(uint64_t ticket) {
+  std::unique_lock guard(mutex_);
+  synced_cv_.wait(guard, [&] { return synced_ >= ticket; });
+}
+
+void WalGroupCommit::Drain() {
+  std::unique_lock guard(mutex_);
+  synced_cv_.wait(guard, [this] { return !syncing_; });
+  if (enqueued_ > synced_) {
+    wal_file_->SyncWithoutFlushing();
+    synced_ = enqueued_;
+    synced_cv_.notify_all();
+  }
+  wal_file_ = nullptr;
+}
+
+void WalGroupCommit::Run(std::stop_token stop_token) {
+  utils::ThreadSetName("WAL writer");
+  std::unique_lock guard(mutex_);
+  while (requested_cv_.wait(guard, stop_token, [this] { return enqueued_ > synced_; })) {
+    // Everything enqueued so far was flushed before it was enqueued, so a
+    // single sync covers all of it. Requests enqueued during the sync wait for
+    // the next one.
+    const auto target = enqueued_;
+    auto *wal_file = wal_file_;
+    syncing_ = true;
+    guard.unlock();
+    wal_file->SyncWithoutFlushing();
+    guard.lock();
+    syncing_ = false;
+    synced_ = target;
+    synced_cv_.notify_all();
+  }
+}
+
+WalFilePool::WalFilePool(std::filesystem::path directory, uint64_t file_size, uint64_t file_count)
+    : directory_(std::move(directory)),
+      file_size_(file_size),
+      file_count_(file_count),
+      thread_([this](std::stop_token stop_token) { Run(std::move(stop_token)); }) {}
+
+std::optional<std::filesystem::path> WalFilePool::Take() {
+  std::unique_lock guard(mutex_);
+  if (files_.empty()) return std::nullopt;
+  auto path = std::move(files_.front());
+  files_.pop_front();
+  guard.unlock();
+  taken_cv_.notify_one();
+  return path;
+}
+
+void WalFilePool::Run(std::stop_token stop_token) {
+  utils::ThreadSetName("WAL prealloc");
+  // Files left over from the previous run are of unknown size.
+  utils::DeleteDir(directory_);
+  std::unique_lock guard(mutex_);
+  while (taken_cv_.wait(guard, stop_token, [this] { return files_.size() < file_count_; })) {
+    auto path = directory_ / std::to_string(next_file_id_++);
+    guard.unlock();
+    // The directory is recreated in case the WAL directory was cleared.
+    utils::EnsureDirOrDie(directory_);
+    utils::OutputFile file;
+    file.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    if (!file.Preallocate(file_size_)) {
+      spdlog::warn("Couldn't preallocate the space of WAL files in {}, they are allocated while written.",
+                   directory_);
+      file.Close();
+      utils::DeleteFile(path);
+      return;
+    }
+    file.Sync();
+    file.Close();
+    guard.lock();
+    files_.push_back(std::move(path));
+  }
+}
+
 }  // namespace memgraph::storage::durability
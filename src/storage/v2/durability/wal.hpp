@@ -11,10 +11,17 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/delta.hpp"
@@ -64,6 +71,18 @@ struct WalDeltaData {
     EXISTENCE_CONSTRAINT_DROP,
     UNIQUE_CONSTRAINT_CREATE,
     UNIQUE_CONSTRAINT_DROP,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
+    EDGE_TYPE_INDEX_CREATE,
+    EDGE_TYPE_INDEX_DROP,
+    EDGE_TYPE_PROPERTY_INDEX_CREATE,
+    EDGE_TYPE_PROPERTY_INDEX_DROP,
+    TEXT_INDEX_CREATE,
+    TEXT_INDEX_DROP,
+    POINT_INDEX_CREATE,
+    POINT_INDEX_DROP,
+    VECTOR_INDEX_CREATE,
+    VECTOR_INDEX_DROP,
   };
 
   Type type{Type::TRANSACTION_END};
@@ -103,6 +122,20 @@ struct WalDeltaData {
     std::string label;
     std::set<std::string> properties;
   } operation_label_properties;
+
+  struct {
+    std::string label;
+    std::vector<std::string> properties;
+  } operation_label_property_list;
+
+  struct {
+    std::string edge_type;
+  } operation_edge_type;
+
+  struct {
+    std::string edge_type;
+    std::string property;
+  } operation_edge_type_property;
 };
 
 bool operator==(const WalDeltaData &a, const WalDeltaData &b);
@@ -137,6 +170,18 @@ constexpr bool IsWalDeltaDataTypeTransactionEnd(const WalDeltaData::Type type) {
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_INDEX_DROP:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+    case WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP:
+    case WalDeltaData::Type::TEXT_INDEX_CREATE:
+    case WalDeltaData::Type::TEXT_INDEX_DROP:
+    case WalDeltaData::Type::POINT_INDEX_CREATE:
+    case WalDeltaData::Type::POINT_INDEX_DROP:
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE:
+    case WalDeltaData::Type::VECTOR_INDEX_DROP:
       return true;
   }
 }
@@ -170,27 +215,87 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Config::Ite
 void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta &delta, const Edge &edge,
                  uint64_t timestamp);
 
+/// Function used to encode a vertex with its labels and properties as the
+/// deltas which create it.
+void EncodeVertex(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Gid gid, const std::vector<LabelId> &labels,
+                  const std::map<PropertyId, PropertyValue> &properties, uint64_t timestamp);
+
+/// Function used to encode an edge with its properties as the deltas which
+/// create it.
+void EncodeEdge(BaseEncoder *encoder, NameIdMapper *name_id_mapper, Gid gid, EdgeTypeId edge_type, Gid from_vertex,
+                Gid to_vertex, const std::map<PropertyId, PropertyValue> &properties, uint64_t timestamp);
+
 /// Function used to encode the transaction end.
 void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp);
 
 /// Function used to encode non-transactional operation.
 void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
-                     LabelId label, const std::set<PropertyId> &properties, uint64_t timestamp);
+                     LabelId label, const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+/// Function used to encode non-transactional operation on an edge type.
+void EncodeOperation(BaseEncoder *encoder, NameIdMapper *name_id_mapper, StorageGlobalOperation operation,
+                     EdgeTypeId edge_type, const std::vector<PropertyId> &properties, uint64_t timestamp);
 
-/// Function used to load the WAL data into the storage.
+/// Function used to load the WAL data into the storage. The changes of the
+/// vertices and edges are applied on `thread_count` threads, the changes of
+/// each object in the order in which they were made. The deltas after
+/// `last_timestamp_to_load` aren't read.
 /// @throw RecoveryFailure
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
-                     Config::Items items);
+                     Config::Items items, uint64_t thread_count = 1,
+                     std::optional<uint64_t> last_timestamp_to_load = std::nullopt);
+
+/// Keeps `file_count` empty files with `file_size` bytes of preallocated disk
+/// space ready in `directory`, so that new WAL files don't allocate their
+/// blocks while transactions are appended to them. The files are created on a
+/// dedicated thread. The directory is emptied when the pool is created.
+class WalFilePool {
+ public:
+  WalFilePool(std::filesystem::path directory, uint64_t file_size, uint64_t file_count);
+
+  WalFilePool(const WalFilePool &) = delete;
+  WalFilePool(WalFilePool &&) = delete;
+  WalFilePool &operator=(const WalFilePool &) = delete;
+  WalFilePool &operator=(WalFilePool &&) = delete;
+
+  ~WalFilePool() = default;
+
+  /// Returns the path of a ready file, which the caller has to move away, or
+  /// `std::nullopt` if no file is ready.
+  std::optional<std::filesystem::path> Take();
+
+  uint64_t FileSize() const { return file_size_; }
+
+ private:
+  void Run(std::stop_token stop_token);
+
+  std::filesystem::path directory_;
+  uint64_t file_size_;
+  uint64_t file_count_;
+  std::mutex mutex_;
+  std::condition_variable_any taken_cv_;
+  std::deque<std::filesystem::path> files_;
+  uint64_t next_file_id_{0};
+  std::jthread thread_;
+};
 
 /// WalFile class used to append deltas and operations to the WAL file.
+/// With `compress` the deltas of each transaction are written as compressed
+/// blocks, see `Encoder::EnableCompression`. Operations aren't compressed.
+/// With `file_pool` the file is made from a file of the pool, or it
+/// preallocates the space of the pool's files itself. With `direct_io` the
+/// data after the header is written with direct I/O, see
+/// `utils::OutputFile::EnableDirectIO`.
 class WalFile {
  public:
   WalFile(const std::filesystem::path &wal_directory, std::string_view uuid, std::string_view epoch_id,
-          Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num, utils::FileRetainer *file_retainer);
+          Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num, utils::FileRetainer *file_retainer,
+          bool compress = false, WalFilePool *file_pool = nullptr, bool direct_io = false);
   WalFile(std::filesystem::path current_wal_path, Config::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-          uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count, utils::FileRetainer *file_retainer);
+          uint64_t from_timestamp, uint64_t to_timestamp, uint64_t count, utils::FileRetainer *file_retainer,
+          bool compress = false);
 
   WalFile(const WalFile &) = delete;
   WalFile(WalFile &&) = delete;
@@ -204,13 +309,30 @@ class WalFile {
 
   void AppendTransactionEnd(uint64_t timestamp);
 
-  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::set<PropertyId> &properties,
+  void AppendOperation(StorageGlobalOperation operation, LabelId label, const std::vector<PropertyId> &properties,
                        uint64_t timestamp);
 
+  void AppendOperation(StorageGlobalOperation operation, EdgeTypeId edge_type,
+                       const std::vector<PropertyId> &properties, uint64_t timestamp);
+
   void Sync();
 
+  // Write the internal buffer to the file without syncing it.
+  void Flush();
+  // Sync the data already written to the file. Can be called concurrently
+  // with appending, see `WalGroupCommit`.
+  void SyncWithoutFlushing();
+
   uint64_t GetSize();
 
+  // Get the size of the data already written to the file, without the
+  // internal buffer.
+  uint64_t GetWrittenSize();
+
+  // Let the syncs of the file take priority over the writes throttled by
+  // `throttle`, see `utils::WriteThrottle`.
+  void SetSyncPriority(utils::WriteThrottle *throttle);
+
   uint64_t SequenceNumber() const;
 
   auto FromTimestamp() const { return from_timestamp_; }
@@ -236,17 +358,63 @@ class WalFile {
 
  private:
   void UpdateStats(uint64_t timestamp);
+  // Counts the bytes appended since the last call in the WalBytesWritten
+  // metric.
+  void CountWrittenBytes();
 
   Config::Items items_;
   NameIdMapper *name_id_mapper_;
   Encoder wal_;
+  bool compress_;
   std::filesystem::path path_;
   uint64_t from_timestamp_;
   uint64_t to_timestamp_;
   uint64_t count_;
   uint64_t seq_num_;
+  uint64_t counted_size_{0};
 
   utils::FileRetainer *file_retainer_;
 };
 
+/// Syncs WAL files on a dedicated thread so that the transactions committed
+/// while a sync is in progress share the next `fsync` call (group commit).
+/// Committers append their deltas to the WAL file and flush them in commit
+/// order, enqueue a sync request and wait for it after they release the engine
+/// lock.
+class WalGroupCommit {
+ public:
+  WalGroupCommit();
+
+  WalGroupCommit(const WalGroupCommit &) = delete;
+  WalGroupCommit(WalGroupCommit &&) = delete;
+  WalGroupCommit &operator=(const WalGroupCommit &) = delete;
+  WalGroupCommit &operator=(WalGroupCommit &&) = delete;
+
+  ~WalGroupCommit();
+
+  /// Requests a sync of `wal_file`, whose data must already be flushed.
+  /// Returns the ticket to wait on. Appends to WAL files (and so calls to
+  /// this function) have to be serialized by the caller.
+  uint64_t Enqueue(WalFile *wal_file);
+
+  /// Blocks until the request with `ticket` is synced.
+  void Wait(uint64_t ticket);
+
+  /// Syncs all pending requests on the calling thread and forgets the current
+  /// WAL file. Has to be called before the WAL file is finalized or destroyed.
+  void Drain();
+
+ private:
+  void Run(std::stop_token stop_token);
+
+  std::mutex mutex_;
+  std::condition_variable_any requested_cv_;
+  std::condition_variable synced_cv_;
+  WalFile *wal_file_{nullptr};
+  uint64_t enqueued_{0};
+  uint64_t synced_{0};
+  bool syncing_{false};
+  std::jthread thread_;
+};
+
 }  // namespace memgraph::storage::durability
@@ -30,16 +30,17 @@ struct Edge {
               "Edge must be created with an initial DELETE_OBJECT delta!");
   }
 
+  // Same as for `Vertex`, the hot header is placed before the properties.
   Gid gid;
 
-  PropertyStore properties;
-
   mutable utils::RWSpinLock lock;
   bool deleted;
   // uint8_t PAD;
   // uint16_t PAD;
 
   Delta *delta;
+
+  PropertyStore properties;
 };
 
 static_assert(alignof(Edge) >= 8, "The Edge should be aligned to at least 8!");
@@ -16,6 +16,7 @@
 #include <tuple>
 
 #include "storage/v2/delta.hpp"
+#include "storage/v2/indices/indices.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/result.hpp"
@@ -29,14 +30,13 @@ bool EdgeAccessor::IsVisible(const View view) const {
   bool deleted = true;
   // When edges don't have properties, their isolation level is still dictated by MVCC ->
   // iterate over the deltas of the from_vertex_ and see which deltas can be applied on edges.
-  if (!config_.properties_on_edges) {
+  if (!config_.PropertiesOnEdges(edge_type_)) {
     Delta *delta = nullptr;
     {
       auto guard = std::shared_lock{from_vertex_->lock};
-      // Initialize deleted by checking if out edges contain edge_
-      deleted = std::find_if(from_vertex_->out_edges.begin(), from_vertex_->out_edges.end(), [&](const auto &out_edge) {
-                  return std::get<2>(out_edge) == edge_;
-                }) == from_vertex_->out_edges.end();
+      // Initialize deleted by checking if out edges contain edge_, only the run of our edge type can contain it
+      auto [begin, end] = VertexEdgesOfType(from_vertex_->out_edges, edge_type_);
+      deleted = std::find_if(begin, end, [&](const auto &out_edge) { return std::get<2>(out_edge) == edge_; }) == end;
       delta = from_vertex_->delta;
     }
     ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
@@ -116,7 +116,7 @@ VertexAccessor EdgeAccessor::DeletedEdgeToVertex() const {
 
 Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, const PropertyValue &value) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
+  if (!config_.PropertiesOnEdges(edge_type_)) return Error::PROPERTIES_DISABLED;
 
   auto guard = std::unique_lock{edge_.ptr->lock};
 
@@ -133,7 +133,8 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
   // transactions get a SERIALIZATION_ERROR.
 
   CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, current_value);
-  edge_.ptr->properties.SetProperty(property, value);
+  edge_.ptr->properties.SetProperty(property, value, transaction_->dictionary_encoded_properties);
+  indices_->UpdateOnSetEdgeProperty(from_vertex_, to_vertex_, edge_.ptr, edge_type_, property, value, *transaction_);
 
   if (transaction_->IsDiskStorage()) {
     ModifiedEdgeInfo modified_edge(Delta::Action::SET_PROPERTY, from_vertex_->gid, to_vertex_->gid, edge_type_, edge_);
@@ -145,7 +146,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
 
 Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
+  if (!config_.PropertiesOnEdges(edge_type_)) return Error::PROPERTIES_DISABLED;
 
   auto guard = std::unique_lock{edge_.ptr->lock};
 
@@ -153,9 +154,10 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  if (!edge_.ptr->properties.InitProperties(properties)) return false;
-  for (const auto &[property, _] : properties) {
+  if (!edge_.ptr->properties.InitProperties(properties, transaction_->dictionary_encoded_properties)) return false;
+  for (const auto &[property, value] : properties) {
     CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, PropertyValue());
+    indices_->UpdateOnSetEdgeProperty(from_vertex_, to_vertex_, edge_.ptr, edge_type_, property, value, *transaction_);
   }
 
   return true;
@@ -164,7 +166,7 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
 Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> EdgeAccessor::UpdateProperties(
     std::map<storage::PropertyId, storage::PropertyValue> &properties) const {
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
+  if (!config_.PropertiesOnEdges(edge_type_)) return Error::PROPERTIES_DISABLED;
 
   auto guard = std::unique_lock{edge_.ptr->lock};
 
@@ -172,17 +174,20 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> EdgeAc
 
   if (edge_.ptr->deleted) return Error::DELETED_OBJECT;
 
-  auto id_old_new_change = edge_.ptr->properties.UpdateProperties(properties);
+  auto id_old_new_change =
+      edge_.ptr->properties.UpdateProperties(properties, transaction_->dictionary_encoded_properties);
 
   for (auto &[property, old_value, new_value] : id_old_new_change) {
     CreateAndLinkDelta(transaction_, edge_.ptr, Delta::SetPropertyTag(), property, std::move(old_value));
+    indices_->UpdateOnSetEdgeProperty(from_vertex_, to_vertex_, edge_.ptr, edge_type_, property, new_value,
+                                      *transaction_);
   }
 
   return id_old_new_change;
 }
 
 Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::ClearProperties() {
-  if (!config_.properties_on_edges) return Error::PROPERTIES_DISABLED;
+  if (!config_.PropertiesOnEdges(edge_type_)) return Error::PROPERTIES_DISABLED;
 
   auto guard = std::unique_lock{edge_.ptr->lock};
 
@@ -201,7 +206,7 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::ClearProperties() {
 }
 
 Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view) const {
-  if (!config_.properties_on_edges) return PropertyValue();
+  if (!config_.PropertiesOnEdges(edge_type_)) return PropertyValue();
   bool exists = true;
   bool deleted = false;
   PropertyValue value;
@@ -243,8 +248,23 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   return std::move(value);
 }
 
+Result<bool> EdgeAccessor::IsPropertyEqual(PropertyId property, const PropertyValue &value, View view) const {
+  if (!config_.PropertiesOnEdges(edge_type_)) return value.IsNull();
+  {
+    auto guard = std::shared_lock{edge_.ptr->lock};
+    // Without deltas to apply, the transaction sees the stored properties.
+    if (!NeedsDeltasForRead(transaction_, edge_.ptr->delta)) {
+      if (!for_deleted_ && edge_.ptr->deleted) return Error::DELETED_OBJECT;
+      return edge_.ptr->properties.IsPropertyEqual(property, value);
+    }
+  }
+  auto maybe_value = GetProperty(property, view);
+  if (maybe_value.HasError()) return maybe_value.GetError();
+  return *maybe_value == value;
+}
+
 Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view) const {
-  if (!config_.properties_on_edges) return std::map<PropertyId, PropertyValue>{};
+  if (!config_.PropertiesOnEdges(edge_type_)) return std::map<PropertyId, PropertyValue>{};
   bool exists = true;
   bool deleted = false;
   std::map<PropertyId, PropertyValue> properties;
@@ -81,11 +81,15 @@ class EdgeAccessor final {
   /// @throw std::bad_alloc
   Result<PropertyValue> GetProperty(PropertyId property, View view) const;
 
+  /// @sa VertexAccessor::IsPropertyEqual
+  /// @throw std::bad_alloc
+  Result<bool> IsPropertyEqual(PropertyId property, const PropertyValue &value, View view) const;
+
   /// @throw std::bad_alloc
   Result<std::map<PropertyId, PropertyValue>> Properties(View view) const;
 
   Gid Gid() const noexcept {
-    if (config_.properties_on_edges) {
+    if (config_.PropertiesOnEdges(edge_type_)) {
       return edge_.ptr->gid;
     }
     return edge_.gid;
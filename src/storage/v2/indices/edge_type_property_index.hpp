@@ -0,0 +1,62 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/edge.hpp"
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+
+/// Index over the values of a property of all edges of an edge type. Edges
+/// only have properties when `properties_on_edges` is enabled or their type is
+/// one of `properties_on_edge_types`, so this index can't be created otherwise.
+class EdgeTypePropertyIndex {
+ public:
+  EdgeTypePropertyIndex(Indices *indices, const Config &config) : indices_(indices), config_(config) {}
+
+  EdgeTypePropertyIndex(const EdgeTypePropertyIndex &) = delete;
+  EdgeTypePropertyIndex(EdgeTypePropertyIndex &&) = delete;
+  EdgeTypePropertyIndex &operator=(const EdgeTypePropertyIndex &) = delete;
+  EdgeTypePropertyIndex &operator=(EdgeTypePropertyIndex &&) = delete;
+
+  virtual ~EdgeTypePropertyIndex() = default;
+
+  virtual void UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                                    const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(Vertex *from, Vertex *to, Edge *edge, EdgeTypeId edge_type, PropertyId property,
+                                   const PropertyValue &value, const Transaction &tx) = 0;
+
+  virtual bool DropIndex(EdgeTypeId edge_type, PropertyId property) = 0;
+
+  virtual bool IndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+  virtual std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+ protected:
+  Indices *indices_;
+  Config config_;
+};
+
+}  // namespace memgraph::storage
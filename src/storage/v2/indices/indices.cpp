@@ -12,8 +12,14 @@
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/disk/label_index.hpp"
 #include "storage/v2/disk/label_property_index.hpp"
+#include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/point_index.hpp"
+#include "storage/v2/inmemory/text_index.hpp"
+#include "storage/v2/inmemory/vector_index.hpp"
 
 namespace memgraph::storage {
 
@@ -21,21 +27,121 @@ void Indices::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) cons
   static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp);
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
       ->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryLabelPropertyCompositeIndex *>(label_property_composite_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryTextIndex *>(text_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryPointIndex *>(point_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp);
+  static_cast<InMemoryVectorIndex *>(vector_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp);
+}
+
+void Indices::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                               std::vector<std::function<void()>> &tasks) const {
+  static_cast<InMemoryLabelIndex *>(label_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryLabelPropertyCompositeIndex *>(label_property_composite_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryTextIndex *>(text_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryPointIndex *>(point_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  static_cast<InMemoryVectorIndex *>(vector_index_.get())
+      ->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
 }
 
 void Indices::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
   label_index_->UpdateOnAddLabel(label, vertex, tx);
   label_property_index_->UpdateOnAddLabel(label, vertex, tx);
+  if (label_property_composite_index_) {
+    label_property_composite_index_->UpdateOnAddLabel(label, vertex, tx);
+  }
+  if (text_index_) {
+    text_index_->UpdateOnAddLabel(label, vertex, tx);
+  }
+  if (point_index_) {
+    point_index_->UpdateOnAddLabel(label, vertex, tx);
+  }
+  if (vector_index_) {
+    vector_index_->UpdateOnAddLabel(label, vertex, tx);
+  }
+}
+
+void Indices::UpdateOnAddLabel(LabelId label, const std::vector<Vertex *> &vertices, const Transaction &tx) const {
+  label_index_->UpdateOnAddLabel(label, vertices, tx);
+  for (auto *vertex : vertices) {
+    label_property_index_->UpdateOnAddLabel(label, vertex, tx);
+    if (label_property_composite_index_) {
+      label_property_composite_index_->UpdateOnAddLabel(label, vertex, tx);
+    }
+    if (text_index_) {
+      text_index_->UpdateOnAddLabel(label, vertex, tx);
+    }
+    if (point_index_) {
+      point_index_->UpdateOnAddLabel(label, vertex, tx);
+    }
+    if (vector_index_) {
+      vector_index_->UpdateOnAddLabel(label, vertex, tx);
+    }
+  }
 }
 
 void Indices::UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
   label_index_->UpdateOnRemoveLabel(label, vertex, tx);
   label_property_index_->UpdateOnRemoveLabel(label, vertex, tx);
+  if (label_property_composite_index_) {
+    label_property_composite_index_->UpdateOnRemoveLabel(label, vertex, tx);
+  }
+  if (text_index_) {
+    text_index_->UpdateOnRemoveLabel(label, vertex, tx);
+  }
+  if (point_index_) {
+    point_index_->UpdateOnRemoveLabel(label, vertex, tx);
+  }
+  if (vector_index_) {
+    vector_index_->UpdateOnRemoveLabel(label, vertex, tx);
+  }
 }
 
 void Indices::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                                   const Transaction &tx) const {
   label_property_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  if (label_property_composite_index_) {
+    label_property_composite_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  }
+  if (text_index_) {
+    text_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  }
+  if (point_index_) {
+    point_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  }
+  if (vector_index_) {
+    vector_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  }
+}
+
+void Indices::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                                   const Transaction &tx) const {
+  if (edge_type_index_) {
+    edge_type_index_->UpdateOnEdgeCreation(from, to, edge_ref, edge_type, tx);
+  }
+  if (edge_type_property_index_) {
+    edge_type_property_index_->UpdateOnEdgeCreation(from, to, edge_ref, edge_type, tx);
+  }
+}
+
+void Indices::UpdateOnSetEdgeProperty(Vertex *from, Vertex *to, Edge *edge, EdgeTypeId edge_type,
+                                      PropertyId property, const PropertyValue &value, const Transaction &tx) const {
+  if (edge_type_property_index_) {
+    edge_type_property_index_->UpdateOnSetProperty(from, to, edge, edge_type, property, value, tx);
+  }
 }
 
 Indices::Indices(const Config &config, StorageMode storage_mode) {
@@ -43,6 +149,12 @@ Indices::Indices(const Config &config, StorageMode storage_mode) {
     if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL || storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
       label_index_ = std::make_unique<InMemoryLabelIndex>(this, config);
       label_property_index_ = std::make_unique<InMemoryLabelPropertyIndex>(this, config);
+      label_property_composite_index_ = std::make_unique<InMemoryLabelPropertyCompositeIndex>(this, config);
+      edge_type_index_ = std::make_unique<InMemoryEdgeTypeIndex>(this, config);
+      edge_type_property_index_ = std::make_unique<InMemoryEdgeTypePropertyIndex>(this, config);
+      text_index_ = std::make_unique<InMemoryTextIndex>(this, config);
+      point_index_ = std::make_unique<InMemoryPointIndex>(this, config);
+      vector_index_ = std::make_unique<InMemoryVectorIndex>(this, config);
     } else {
       label_index_ = std::make_unique<DiskLabelIndex>(this, config);
       label_property_index_ = std::make_unique<DiskLabelPropertyIndex>(this, config);
@@ -11,9 +11,19 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
+#include "storage/v2/indices/edge_type_index.hpp"
+#include "storage/v2/indices/edge_type_property_index.hpp"
 #include "storage/v2/indices/label_index.hpp"
+#include "storage/v2/indices/label_property_composite_index.hpp"
 #include "storage/v2/indices/label_property_index.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/indices/vector_index.hpp"
 #include "storage/v2/storage_mode.hpp"
 
 namespace memgraph::storage {
@@ -32,6 +42,12 @@ struct Indices {
   /// TODO: unused in disk indices
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) const;
 
+  /// Appends the clean-up of every in-memory index to `tasks`, with one task
+  /// per index so that they can be run concurrently.
+  /// TODO: unused in disk indices
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks) const;
+
   // Indices are updated whenever an update occurs, instead of only on commit or
   // advance command. This is necessary because we want indices to support `NEW`
   // view for use in Merge.
@@ -40,6 +56,10 @@ struct Indices {
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) const;
 
+  /// Same as above for a batch of vertices, the label index is updated with
+  /// one access to its entries.
+  void UpdateOnAddLabel(LabelId label, const std::vector<Vertex *> &vertices, const Transaction &tx) const;
+
   void UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transaction &tx) const;
 
   /// This function should be called whenever a property is modified on a vertex.
@@ -47,8 +67,40 @@ struct Indices {
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                            const Transaction &tx) const;
 
+  /// This function should be called whenever an edge is created, or an
+  /// existing edge is attached to another vertex.
+  /// @throw std::bad_alloc
+  void UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                            const Transaction &tx) const;
+
+  /// This function should be called whenever a property is modified on an edge.
+  /// @throw std::bad_alloc
+  void UpdateOnSetEdgeProperty(Vertex *from, Vertex *to, Edge *edge, EdgeTypeId edge_type, PropertyId property,
+                               const PropertyValue &value, const Transaction &tx) const;
+
   std::unique_ptr<LabelIndex> label_index_;
   std::unique_ptr<LabelPropertyIndex> label_property_index_;
+  /// Only in-memory storage supports composite indices, so this is `nullptr`
+  /// in the on-disk storage.
+  std::unique_ptr<LabelPropertyCompositeIndex> label_property_composite_index_;
+  /// Edge indices are also only supported by the in-memory storage.
+  std::unique_ptr<EdgeTypeIndex> edge_type_index_;
+  std::unique_ptr<EdgeTypePropertyIndex> edge_type_property_index_;
+  /// Text indices are also only supported by the in-memory storage.
+  std::unique_ptr<TextIndex> text_index_;
+  /// Point indices are also only supported by the in-memory storage.
+  std::unique_ptr<PointIndex> point_index_;
+  /// Vector indices are also only supported by the in-memory storage.
+  std::unique_ptr<VectorIndex> vector_index_;
+
+  /// Recovered indices which the in-memory storage still has to create, see
+  /// `Config::Durability::background_index_recovery`. They are written to
+  /// snapshots, but aren't used by queries. Guarded by the main storage lock.
+  struct {
+    std::vector<LabelId> label;
+    std::vector<std::pair<LabelId, PropertyId>> label_property;
+    std::vector<std::pair<std::pair<LabelId, PropertyId>, LabelPropertyIndexStats>> label_property_stats;
+  } pending_recovery_;
 };
 
 }  // namespace memgraph::storage
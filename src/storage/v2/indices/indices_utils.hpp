@@ -9,8 +9,13 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <iterator>
 #include <thread>
+#include <vector>
+
 #include "storage/v2/delta.hpp"
+#include "storage/v2/edge.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex.hpp"
@@ -159,6 +164,74 @@ inline bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, Prop
       });
 }
 
+/// Helper function for composite label-property index garbage collection.
+/// Returns true if there's a reachable version of the vertex that has the given
+/// label and the given values of all of the properties.
+inline bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                         const std::vector<PropertyValue> &values, uint64_t timestamp) {
+  bool has_label{false};
+  bool deleted{false};
+  std::vector<PropertyValue> current_values;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    if (delta == nullptr && (deleted || !has_label)) return false;
+    current_values.reserve(keys.size());
+    for (const auto &key : keys) {
+      current_values.push_back(vertex.properties.GetProperty(key));
+    }
+  }
+
+  if (!deleted && has_label && current_values == values) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(
+      timestamp, delta, [&has_label, &current_values, &deleted, label, &keys, &values](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::ADD_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(!has_label, "Invalid database state!");
+              has_label = true;
+            }
+            break;
+          case Delta::Action::REMOVE_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(has_label, "Invalid database state!");
+              has_label = false;
+            }
+            break;
+          case Delta::Action::SET_PROPERTY: {
+            auto it = std::find(keys.begin(), keys.end(), delta.property.key);
+            if (it != keys.end()) {
+              current_values[std::distance(keys.begin(), it)] = delta.property.value;
+            }
+            break;
+          }
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && has_label && current_values == values;
+      });
+}
+
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
@@ -218,6 +291,283 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   return exists && !deleted && has_label && current_value_equal_to_value;
 }
 
+// Helper function for iterating through composite label-property index.
+// Returns true if this transaction can see the given vertex, and the visible
+// version has the given label and the given values of all of the properties.
+inline bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, const std::vector<PropertyId> &keys,
+                                             const std::vector<PropertyValue> &values, Transaction *transaction,
+                                             View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  std::vector<PropertyValue> current_values;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    current_values.reserve(keys.size());
+    for (const auto &key : keys) {
+      current_values.push_back(vertex.properties.GetProperty(key));
+    }
+    delta = vertex.delta;
+  }
+
+  if (delta) {
+    ApplyDeltasForRead(transaction, delta, view, [&, label](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        HasLabel_ActionMethod(has_label, label),
+        PropertyValues_ActionMethod(current_values, keys)
+      });
+      // clang-format on
+    });
+  }
+
+  return exists && !deleted && has_label && current_values == values;
+}
+
+/// Helper function for text index garbage collection. Returns true if there's
+/// a reachable version of the vertex that has the given label and a value of
+/// the property for which `matches` returns true.
+template <typename TPredicate>
+inline bool AnyVersionHasLabelPropertyMatching(const Vertex &vertex, LabelId label, PropertyId key,
+                                               const TPredicate &matches, uint64_t timestamp) {
+  bool has_label{false};
+  bool deleted{false};
+  PropertyValue current_value;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    if (delta == nullptr && (deleted || !has_label)) return false;
+    current_value = vertex.properties.GetProperty(key);
+  }
+
+  if (!deleted && has_label && matches(current_value)) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(
+      timestamp, delta, [&has_label, &current_value, &deleted, label, key, &matches](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::ADD_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(!has_label, "Invalid database state!");
+              has_label = true;
+            }
+            break;
+          case Delta::Action::REMOVE_LABEL:
+            if (delta.label == label) {
+              MG_ASSERT(has_label, "Invalid database state!");
+              has_label = false;
+            }
+            break;
+          case Delta::Action::SET_PROPERTY:
+            if (delta.property.key == key) {
+              current_value = delta.property.value;
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && has_label && matches(current_value);
+      });
+}
+
+// Helper function for iterating through text indices. Returns the value of the
+// property if this transaction can see the given vertex and the visible version
+// has the given label, and `std::nullopt` otherwise.
+inline std::optional<PropertyValue> CurrentVersionLabelPropertyValue(const Vertex &vertex, LabelId label,
+                                                                     PropertyId key, Transaction *transaction,
+                                                                     View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  PropertyValue value;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    value = vertex.properties.GetProperty(key);
+    delta = vertex.delta;
+  }
+
+  if (delta) {
+    ApplyDeltasForRead(transaction, delta, view, [&, label, key](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        HasLabel_ActionMethod(has_label, label),
+        PropertyValue_ActionMethod(value, key)
+      });
+      // clang-format on
+    });
+  }
+
+  if (!exists || deleted || !has_label) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+/// Helper function for edge-type index garbage collection. Returns true if
+/// there's a reachable version of `from_vertex` which has the given out edge.
+/// The edge itself isn't read, so it is safe to call this for edges which were
+/// already removed from the main storage.
+inline bool AnyVersionHasOutEdge(const Vertex &from_vertex, EdgeTypeId edge_type, const Vertex *to_vertex,
+                                 EdgeRef edge, uint64_t timestamp) {
+  bool has_edge{false};
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{from_vertex.lock};
+    auto [begin, end] = VertexEdgesOfType(from_vertex.out_edges, edge_type);
+    has_edge = std::find(begin, end, VertexEdge{edge_type, const_cast<Vertex *>(to_vertex), edge}) != end;
+    delta = from_vertex.delta;
+  }
+  if (has_edge) {
+    return true;
+  }
+  return AnyVersionSatisfiesPredicate(timestamp, delta, [&has_edge, edge_type, to_vertex, edge](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge && delta.vertex_edge.edge_type == edge_type &&
+            delta.vertex_edge.vertex == to_vertex) {
+          has_edge = true;
+        }
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge && delta.vertex_edge.edge_type == edge_type &&
+            delta.vertex_edge.vertex == to_vertex) {
+          has_edge = false;
+        }
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::RECREATE_OBJECT:
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        break;
+    }
+    return has_edge;
+  });
+}
+
+/// Helper function for edge-type-property index garbage collection. Returns
+/// true if there's a reachable version of the edge that has the given property
+/// value.
+inline bool AnyVersionHasEdgeProperty(const Edge &edge, PropertyId key, const PropertyValue &value,
+                                      uint64_t timestamp) {
+  bool current_value_equal_to_value{value.IsNull()};
+  bool deleted{false};
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{edge.lock};
+    delta = edge.delta;
+    deleted = edge.deleted;
+    if (delta == nullptr && deleted) return false;
+    current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
+  }
+
+  if (!deleted && current_value_equal_to_value) {
+    return true;
+  }
+
+  return AnyVersionSatisfiesPredicate(
+      timestamp, delta, [&current_value_equal_to_value, &deleted, key, &value](const Delta &delta) {
+        switch (delta.action) {
+          case Delta::Action::SET_PROPERTY:
+            if (delta.property.key == key) {
+              current_value_equal_to_value = delta.property.value == value;
+            }
+            break;
+          case Delta::Action::RECREATE_OBJECT: {
+            MG_ASSERT(deleted, "Invalid database state!");
+            deleted = false;
+            break;
+          }
+          case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+          case Delta::Action::DELETE_OBJECT: {
+            MG_ASSERT(!deleted, "Invalid database state!");
+            deleted = true;
+            break;
+          }
+          case Delta::Action::ADD_LABEL:
+          case Delta::Action::REMOVE_LABEL:
+          case Delta::Action::ADD_IN_EDGE:
+          case Delta::Action::ADD_OUT_EDGE:
+          case Delta::Action::REMOVE_IN_EDGE:
+          case Delta::Action::REMOVE_OUT_EDGE:
+            break;
+        }
+        return !deleted && current_value_equal_to_value;
+      });
+}
+
+// Helper function for iterating through edge-type indices. Returns true if
+// this transaction can see the given out edge of `from_vertex`. Just like
+// `AnyVersionHasOutEdge`, this doesn't read the edge itself.
+inline bool CurrentVersionHasOutEdge(const Vertex &from_vertex, EdgeTypeId edge_type, const Vertex *to_vertex,
+                                     EdgeRef edge, Transaction *transaction, View view) {
+  bool has_edge{false};
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{from_vertex.lock};
+    auto [begin, end] = VertexEdgesOfType(from_vertex.out_edges, edge_type);
+    has_edge = std::find(begin, end, VertexEdge{edge_type, const_cast<Vertex *>(to_vertex), edge}) != end;
+    delta = from_vertex.delta;
+  }
+  ApplyDeltasForRead(transaction, delta, view, [&has_edge, edge_type, to_vertex, edge](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge && delta.vertex_edge.edge_type == edge_type &&
+            delta.vertex_edge.vertex == to_vertex) {
+          has_edge = true;
+        }
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        if (delta.vertex_edge.edge == edge && delta.vertex_edge.edge_type == edge_type &&
+            delta.vertex_edge.vertex == to_vertex) {
+          has_edge = false;
+        }
+        break;
+      case Delta::Action::ADD_LABEL:
+      case Delta::Action::REMOVE_LABEL:
+      case Delta::Action::SET_PROPERTY:
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::RECREATE_OBJECT:
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT:
+        break;
+    }
+  });
+  return has_edge;
+}
+
 template <typename TIndexAccessor>
 inline void TryInsertLabelIndex(Vertex &vertex, LabelId label, TIndexAccessor &index_accessor) {
   if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
@@ -240,6 +590,52 @@ inline void TryInsertLabelPropertyIndex(Vertex &vertex, std::pair<LabelId, Prope
   index_accessor.insert({std::move(value), &vertex, 0});
 }
 
+template <typename TIndexAccessor>
+inline void TryInsertLabelPropertyCompositeIndex(Vertex &vertex,
+                                                 const std::pair<LabelId, std::vector<PropertyId>> &label_properties,
+                                                 TIndexAccessor &index_accessor) {
+  if (vertex.deleted || !utils::Contains(vertex.labels, label_properties.first)) {
+    return;
+  }
+  std::vector<PropertyValue> values;
+  values.reserve(label_properties.second.size());
+  for (const auto &property : label_properties.second) {
+    values.push_back(vertex.properties.GetProperty(property));
+  }
+  if (std::all_of(values.begin(), values.end(), [](const auto &value) { return value.IsNull(); })) {
+    return;
+  }
+  index_accessor.insert({std::move(values), &vertex, 0});
+}
+
+template <typename TIndexAccessor>
+inline void TryInsertEdgeTypeIndex(Vertex &from_vertex, EdgeTypeId edge_type, TIndexAccessor &index_accessor) {
+  if (from_vertex.deleted) {
+    return;
+  }
+  auto [begin, end] = VertexEdgesOfType(from_vertex.out_edges, edge_type);
+  for (auto it = begin; it != end; ++it) {
+    index_accessor.insert({&from_vertex, std::get<1>(*it), std::get<2>(*it), 0});
+  }
+}
+
+template <typename TIndexAccessor>
+inline void TryInsertEdgeTypePropertyIndex(Vertex &from_vertex, std::pair<EdgeTypeId, PropertyId> edge_type_property,
+                                           TIndexAccessor &index_accessor) {
+  if (from_vertex.deleted) {
+    return;
+  }
+  auto [begin, end] = VertexEdgesOfType(from_vertex.out_edges, edge_type_property.first);
+  for (auto it = begin; it != end; ++it) {
+    auto *edge = std::get<2>(*it).ptr;
+    auto value = edge->properties.GetProperty(edge_type_property.second);
+    if (value.IsNull()) {
+      continue;
+    }
+    index_accessor.insert({std::move(value), &from_vertex, std::get<1>(*it), edge, 0});
+  }
+}
+
 template <typename TSkiplistIter, typename TIndex, typename TIndexKey, typename TFunc>
 inline void CreateIndexOnSingleThread(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
                                       TIndexKey key, const TFunc &func) {
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_accessor.hpp"
@@ -30,6 +32,14 @@ class LabelIndex {
 
   virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
 
+  /// Called when the label is added to a batch of vertices at once.
+  virtual void UpdateOnAddLabel(LabelId added_label, const std::vector<Vertex *> &vertices_after_update,
+                                const Transaction &tx) {
+    for (auto *vertex : vertices_after_update) {
+      UpdateOnAddLabel(added_label, vertex, tx);
+    }
+  }
+
   virtual void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
 
   virtual bool DropIndex(LabelId label) = 0;
@@ -0,0 +1,58 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+
+namespace memgraph::storage {
+
+/// Index over a label and an ordered list of properties. Entries are ordered
+/// lexicographically by the values of the properties in the order in which
+/// they were given when the index was created, so lookups can be done by any
+/// prefix of the properties, optionally followed by a range on the next one.
+class LabelPropertyCompositeIndex {
+ public:
+  LabelPropertyCompositeIndex(Indices *indices, const Config &config) : indices_(indices), config_(config) {}
+
+  LabelPropertyCompositeIndex(const LabelPropertyCompositeIndex &) = delete;
+  LabelPropertyCompositeIndex(LabelPropertyCompositeIndex &&) = delete;
+  LabelPropertyCompositeIndex &operator=(const LabelPropertyCompositeIndex &) = delete;
+  LabelPropertyCompositeIndex &operator=(LabelPropertyCompositeIndex &&) = delete;
+
+  virtual ~LabelPropertyCompositeIndex() = default;
+
+  virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                   const Transaction &tx) = 0;
+
+  virtual bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) = 0;
+
+  virtual bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+  virtual std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+ protected:
+  Indices *indices_;
+  Config config_;
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,139 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/label_property_index_stats.hpp"
+
+#include <algorithm>
+
+#include "storage/v2/inmemory/label_property_index.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Returns the position of `value` between `lower` and `upper` as a number
+// between 0 and 1, if the values are numbers or temporal data of the same type.
+std::optional<double> Interpolate(const PropertyValue &lower, const PropertyValue &value, const PropertyValue &upper) {
+  auto to_double = [](const PropertyValue &property_value) -> std::optional<double> {
+    if (property_value.IsInt()) return static_cast<double>(property_value.ValueInt());
+    if (property_value.IsDouble()) return property_value.ValueDouble();
+    if (property_value.IsTemporalData()) return static_cast<double>(property_value.ValueTemporalData().microseconds);
+    return std::nullopt;
+  };
+  if (lower.IsTemporalData() || value.IsTemporalData() || upper.IsTemporalData()) {
+    if (!lower.IsTemporalData() || !value.IsTemporalData() || !upper.IsTemporalData() ||
+        lower.ValueTemporalData().type != value.ValueTemporalData().type ||
+        value.ValueTemporalData().type != upper.ValueTemporalData().type) {
+      return std::nullopt;
+    }
+  }
+  auto lower_number = to_double(lower);
+  auto value_number = to_double(value);
+  auto upper_number = to_double(upper);
+  if (!lower_number || !value_number || !upper_number || *upper_number <= *lower_number) return std::nullopt;
+  return std::clamp((*value_number - *lower_number) / (*upper_number - *lower_number), 0.0, 1.0);
+}
+
+}  // namespace
+
+PropertyValueHistogram PropertyValueHistogram::Build(const std::map<PropertyValue, int64_t> &values_map,
+                                                     uint64_t buckets_count, uint64_t most_common_values_count) {
+  PropertyValueHistogram histogram;
+  if (values_map.empty() || buckets_count == 0) return histogram;
+
+  uint64_t total_count = 0;
+  std::vector<std::pair<const PropertyValue *, uint64_t>> by_count;
+  by_count.reserve(values_map.size());
+  for (const auto &[value, count] : values_map) {
+    total_count += count;
+    by_count.emplace_back(&value, count);
+  }
+
+  // Only the values which appear more often than the average value are worth
+  // counting exactly.
+  const auto most_common_count = std::min<uint64_t>(most_common_values_count, by_count.size());
+  std::partial_sort(by_count.begin(), by_count.begin() + most_common_count, by_count.end(),
+                    [](const auto &first, const auto &second) { return first.second > second.second; });
+  const double average_count = static_cast<double>(total_count) / static_cast<double>(values_map.size());
+  uint64_t most_common_total_count = 0;
+  for (uint64_t i = 0; i < most_common_count && static_cast<double>(by_count[i].second) > average_count; ++i) {
+    histogram.most_common_values.emplace_back(*by_count[i].first, by_count[i].second);
+    most_common_total_count += by_count[i].second;
+  }
+  std::sort(histogram.most_common_values.begin(), histogram.most_common_values.end());
+
+  const uint64_t bucket_depth = std::max<uint64_t>(
+      1, (total_count - most_common_total_count + buckets_count - 1) / buckets_count);
+  Bucket bucket{.upper = PropertyValue(), .count = 0, .distinct_values_count = 0, .cumulative_count = 0};
+  uint64_t cumulative_count = 0;
+  auto common_it = histogram.most_common_values.begin();
+  for (const auto &[value, count] : values_map) {
+    if (common_it != histogram.most_common_values.end() && common_it->first == value) {
+      ++common_it;
+      continue;
+    }
+    if (histogram.buckets.empty() && bucket.count == 0) histogram.lower = value;
+    bucket.count += count;
+    ++bucket.distinct_values_count;
+    if (bucket.count >= bucket_depth) {
+      cumulative_count += bucket.count;
+      bucket.upper = value;
+      bucket.cumulative_count = cumulative_count;
+      histogram.buckets.push_back(std::move(bucket));
+      bucket = Bucket{.upper = PropertyValue(), .count = 0, .distinct_values_count = 0, .cumulative_count = 0};
+    } else {
+      bucket.upper = value;
+    }
+  }
+  if (bucket.count > 0) {
+    bucket.cumulative_count = cumulative_count + bucket.count;
+    histogram.buckets.push_back(std::move(bucket));
+  }
+  return histogram;
+}
+
+double PropertyValueHistogram::CountBelow(const PropertyValue &value, bool inclusive) const {
+  double count = 0;
+  for (const auto &[common_value, common_count] : most_common_values) {
+    if (common_value < value || (inclusive && common_value == value)) count += static_cast<double>(common_count);
+  }
+  if (buckets.empty() || value < lower) return count;
+
+  auto it = std::lower_bound(buckets.begin(), buckets.end(), value,
+                             [](const Bucket &bucket, const PropertyValue &value) { return bucket.upper < value; });
+  if (it == buckets.end()) return count + static_cast<double>(buckets.back().cumulative_count);
+
+  const auto bucket_count = static_cast<double>(it->count);
+  const double before = static_cast<double>(it->cumulative_count) - bucket_count;
+  // Number of vertices with any single value in the bucket.
+  const double value_count = bucket_count / static_cast<double>(it->distinct_values_count);
+  if (value == it->upper) return count + before + bucket_count - (inclusive ? 0 : value_count);
+
+  // The only value of a bucket is its upper value.
+  if (it->distinct_values_count == 1) return count + before;
+  const auto &bucket_lower = it == buckets.begin() ? lower : std::prev(it)->upper;
+  double in_bucket = Interpolate(bucket_lower, value, it->upper).value_or(0.5) * bucket_count;
+  if (inclusive) in_bucket += value_count;
+  return count + before + std::min(in_bucket, bucket_count);
+}
+
+double PropertyValueHistogram::EstimateRangeCount(std::optional<utils::Bound<PropertyValue>> lower,
+                                                  std::optional<utils::Bound<PropertyValue>> upper) const {
+  if (!NormalizePropertyValueBounds(lower, upper)) return 0;
+  double total_count = buckets.empty() ? 0 : static_cast<double>(buckets.back().cumulative_count);
+  for (const auto &[_, common_count] : most_common_values) total_count += static_cast<double>(common_count);
+
+  const double below_upper = upper ? CountBelow(upper->value(), upper->IsInclusive()) : total_count;
+  const double below_lower = lower ? CountBelow(lower->value(), !lower->IsInclusive()) : 0;
+  return std::max(0.0, below_upper - below_lower);
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,74 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/property_value.hpp"
+#include "utils/bound.hpp"
+
+namespace memgraph::storage {
+
+/// Distribution of the values of an indexed property. The values which appear
+/// most often are counted exactly, the rest of them are split into buckets
+/// holding roughly the same number of vertices (an equi-depth histogram).
+struct PropertyValueHistogram {
+  static constexpr uint64_t kDefaultBucketsCount{100};
+  static constexpr uint64_t kDefaultMostCommonValuesCount{10};
+
+  struct Bucket {
+    // The largest value in the bucket. The bucket holds the values greater than
+    // the upper value of the previous bucket.
+    PropertyValue upper;
+    uint64_t count;
+    uint64_t distinct_values_count;
+    // Number of vertices in this and all of the previous buckets.
+    uint64_t cumulative_count;
+  };
+
+  /// Builds the histogram from the number of vertices per distinct value.
+  static PropertyValueHistogram Build(const std::map<PropertyValue, int64_t> &values_map,
+                                      uint64_t buckets_count = kDefaultBucketsCount,
+                                      uint64_t most_common_values_count = kDefaultMostCommonValuesCount);
+
+  bool Empty() const { return buckets.empty() && most_common_values.empty(); }
+
+  /// Estimates the number of vertices with values between the bounds. The
+  /// bounds are treated the same as in the index lookups, so a single bound
+  /// only matches values of the same type.
+  double EstimateRangeCount(std::optional<utils::Bound<PropertyValue>> lower,
+                            std::optional<utils::Bound<PropertyValue>> upper) const;
+
+  // The smallest value in the first bucket.
+  PropertyValue lower;
+  std::vector<Bucket> buckets;
+  // Sorted by value.
+  std::vector<std::pair<PropertyValue, uint64_t>> most_common_values;
+
+ private:
+  /// Estimates the number of vertices with values lower than `value`, or equal
+  /// to it if `inclusive` is set.
+  double CountBelow(const PropertyValue &value, bool inclusive) const;
+};
+
+struct LabelPropertyIndexStats {
+  uint64_t count, distinct_values_count;
+  double statistic, avg_group_size, avg_degree;
+  // Set only for single property indices.
+  PropertyValueHistogram histogram{};
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,144 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/point_index.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace memgraph::storage {
+
+namespace {
+
+constexpr uint64_t kXBits = 0x5555555555555555ULL;
+constexpr uint64_t kYBits = 0xAAAAAAAAAAAAAAAAULL;
+
+/// Returns the 32 most significant bits of an encoding of `coordinate` which
+/// orders like the doubles.
+uint32_t OrderedCoordinateBits(double coordinate) {
+  // -0.0 and 0.0 are equal, so they must have the same key.
+  if (coordinate == 0.0) coordinate = 0.0;
+  constexpr uint64_t kSignBit = uint64_t{1} << 63U;
+  auto bits = std::bit_cast<uint64_t>(coordinate);
+  bits = (bits & kSignBit) ? ~bits : (bits | kSignBit);
+  return static_cast<uint32_t>(bits >> 32U);
+}
+
+/// Moves the i-th bit of `value` to the 2i-th bit of the result.
+uint64_t SpreadBits(uint32_t value) {
+  uint64_t bits = value;
+  bits = (bits | (bits << 16U)) & 0x0000FFFF0000FFFFULL;
+  bits = (bits | (bits << 8U)) & 0x00FF00FF00FF00FFULL;
+  bits = (bits | (bits << 4U)) & 0x0F0F0F0F0F0F0F0FULL;
+  bits = (bits | (bits << 2U)) & 0x3333333333333333ULL;
+  bits = (bits | (bits << 1U)) & kXBits;
+  return bits;
+}
+
+}  // namespace
+
+bool PointRegion::Contains(const Point &point) const {
+  if (point.crs != lower.crs || point.crs != upper.crs) {
+    return false;
+  }
+  switch (type) {
+    case Type::WITHIN_DISTANCE: {
+      const auto distance = Distance(lower, point);
+      return distance && (inclusive ? *distance <= radius : *distance < radius);
+    }
+    case Type::WITHIN_BOX:
+      return lower.x <= point.x && point.x <= upper.x && lower.y <= point.y && point.y <= upper.y &&
+             (!Is3d(point.crs) || (lower.z <= point.z && point.z <= upper.z));
+  }
+}
+
+std::array<double, 4> PointRegion::BoundingBox() const {
+  if (type == Type::WITHIN_BOX) {
+    return {lower.x, lower.y, upper.x, upper.y};
+  }
+  if (!IsGeographic(lower.crs)) {
+    return {lower.x - radius, lower.y - radius, lower.x + radius, lower.y + radius};
+  }
+
+  // The surface distance is at most the distance of 3D points, so the box of
+  // the surface distance contains all of the points. The box spans all
+  // longitudes if the circle contains a pole or crosses the antimeridian.
+  constexpr double kDegreesPerRadian = 180.0 / std::numbers::pi;
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+  const auto angular_radius = radius / kEarthRadiusMeters;
+  const auto min_latitude = lower.y - angular_radius * kDegreesPerRadian;
+  const auto max_latitude = lower.y + angular_radius * kDegreesPerRadian;
+  if (min_latitude <= -90.0 || max_latitude >= 90.0) {
+    return {-kInfinity, min_latitude, kInfinity, max_latitude};
+  }
+  const auto longitude_radius =
+      std::asin(std::min(1.0, std::sin(angular_radius) / std::cos(lower.y / kDegreesPerRadian))) * kDegreesPerRadian;
+  const auto min_longitude = lower.x - longitude_radius;
+  const auto max_longitude = lower.x + longitude_radius;
+  if (min_longitude < -180.0 || max_longitude > 180.0) {
+    return {-kInfinity, min_latitude, kInfinity, max_latitude};
+  }
+  return {min_longitude, min_latitude, max_longitude, max_latitude};
+}
+
+uint64_t PointIndexKey(double x, double y) {
+  return SpreadBits(OrderedCoordinateBits(x)) | (SpreadBits(OrderedCoordinateBits(y)) << 1U);
+}
+
+bool PointIndexKeyInBox(uint64_t key, uint64_t min_key, uint64_t max_key) {
+  // Masked keys of a coordinate order like the coordinate.
+  return std::ranges::all_of(std::array{kXBits, kYBits}, [=](const uint64_t mask) {
+    return (min_key & mask) <= (key & mask) && (key & mask) <= (max_key & mask);
+  });
+}
+
+// This is the BIGMIN computation of Tropf and Herzog. It walks the bits from
+// the most significant one and narrows the box down to the part which is
+// greater than `key`.
+std::optional<uint64_t> PointIndexNextKeyInBox(uint64_t key, uint64_t min_key, uint64_t max_key) {
+  std::optional<uint64_t> next;
+  for (int bit = 63; bit >= 0; --bit) {
+    const uint64_t bit_mask = uint64_t{1} << static_cast<uint64_t>(bit);
+    // The bits of the same coordinate at or below `bit`.
+    const uint64_t coordinate_mask = ((bit % 2 == 0) ? kXBits : kYBits) & ((bit_mask << 1U) - 1);
+    // Sets the coordinate to 1000... or 0111... from `bit` down.
+    const auto with_high_bit = [&](uint64_t value) { return (value & ~coordinate_mask) | bit_mask; };
+    const auto with_low_bits = [&](uint64_t value) {
+      return (value & ~coordinate_mask) | (coordinate_mask & ~bit_mask);
+    };
+
+    const bool key_bit = key & bit_mask;
+    const bool min_bit = min_key & bit_mask;
+    const bool max_bit = max_key & bit_mask;
+    if (!key_bit) {
+      if (min_bit) {
+        return min_key;
+      }
+      if (max_bit) {
+        next = with_high_bit(min_key);
+        max_key = with_low_bits(max_key);
+      }
+    } else {
+      if (!max_bit) {
+        return next;
+      }
+      if (!min_bit) {
+        min_key = with_high_bit(min_key);
+      }
+    }
+  }
+  return next;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,110 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/point.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+
+/// Points which can be looked up in a point index. Only points in the
+/// coordinate reference system of the region are in it.
+struct PointRegion {
+  enum class Type : uint8_t { WITHIN_DISTANCE, WITHIN_BOX };
+
+  static PointRegion WithinDistance(const Point &center, double radius, bool inclusive) {
+    return {Type::WITHIN_DISTANCE, center, center, radius, inclusive};
+  }
+
+  /// Both bounds of the box are inclusive. The z coordinate is only checked
+  /// for 3D points.
+  static PointRegion WithinBox(const Point &lower, const Point &upper) {
+    return {Type::WITHIN_BOX, lower, upper, 0.0, true};
+  }
+
+  bool Contains(const Point &point) const;
+
+  /// Returns the bounds {min_x, min_y, max_x, max_y} of the x and y coordinates
+  /// of the points in the region.
+  std::array<double, 4> BoundingBox() const;
+
+  Type type;
+  // Both are the center of WITHIN_DISTANCE regions.
+  Point lower;
+  Point upper;
+  double radius;
+  bool inclusive;
+};
+
+/// Returns the key of a point in a point index. The key interleaves the bits
+/// of the x and y coordinates (Z-order), so points which are close to each
+/// other mostly have close keys. Only the 32 most significant bits of the
+/// order-preserving encoding of each coordinate are used, so different points
+/// can have the same key.
+uint64_t PointIndexKey(double x, double y);
+
+/// Returns the smallest key which is greater than `key` and is in the box
+/// spanned by `min_key` and `max_key`, or `std::nullopt` if there is no such
+/// key. `key` must be between `min_key` and `max_key` and outside of the box.
+std::optional<uint64_t> PointIndexNextKeyInBox(uint64_t key, uint64_t min_key, uint64_t max_key);
+
+/// Returns true if `key` is in the box spanned by `min_key` and `max_key`.
+bool PointIndexKeyInBox(uint64_t key, uint64_t min_key, uint64_t max_key);
+
+/// Index of the point values of a property of the vertices with a label,
+/// keyed by `PointIndexKey`. Values which aren't points aren't indexed.
+class PointIndex {
+ public:
+  PointIndex(Indices *indices, const Config &config) : indices_(indices), config_(config) {}
+
+  PointIndex(const PointIndex &) = delete;
+  PointIndex(PointIndex &&) = delete;
+  PointIndex &operator=(const PointIndex &) = delete;
+  PointIndex &operator=(PointIndex &&) = delete;
+
+  virtual ~PointIndex() = default;
+
+  virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                   const Transaction &tx) = 0;
+
+  virtual bool DropIndex(LabelId label, PropertyId property) = 0;
+
+  virtual bool IndexExists(LabelId label, PropertyId property) const = 0;
+
+  virtual std::vector<std::pair<LabelId, PropertyId>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PointRegion &region) const = 0;
+
+ protected:
+  Indices *indices_;
+  Config config_;
+};
+
+}  // namespace memgraph::storage
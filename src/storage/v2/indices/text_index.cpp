@@ -0,0 +1,47 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/text_index.hpp"
+
+#include <algorithm>
+
+namespace memgraph::storage {
+
+std::vector<std::string> TextIndexTerms(std::string_view text) {
+  std::vector<std::string> terms;
+  if (text.size() < kTextIndexTermLength) {
+    return terms;
+  }
+  terms.reserve(text.size() - kTextIndexTermLength + 1);
+  for (size_t i = 0; i + kTextIndexTermLength <= text.size(); ++i) {
+    std::string term(text.substr(i, kTextIndexTermLength));
+    std::transform(term.begin(), term.end(), term.begin(), [](char c) {
+      return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    });
+    terms.push_back(std::move(term));
+  }
+  std::sort(terms.begin(), terms.end());
+  terms.erase(std::unique(terms.begin(), terms.end()), terms.end());
+  return terms;
+}
+
+bool TextMatches(std::string_view text, TextMatch match, std::string_view pattern) {
+  switch (match) {
+    case TextMatch::STARTS_WITH:
+      return text.starts_with(pattern);
+    case TextMatch::ENDS_WITH:
+      return text.ends_with(pattern);
+    case TextMatch::CONTAINS:
+      return text.find(pattern) != std::string_view::npos;
+  }
+}
+
+}  // namespace memgraph::storage
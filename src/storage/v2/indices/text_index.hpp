@@ -0,0 +1,83 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+
+/// String predicates which can be answered from a text index.
+enum class TextMatch : uint8_t { STARTS_WITH, ENDS_WITH, CONTAINS };
+
+/// Length of the terms a text index stores for each string. Patterns shorter
+/// than this can't be looked up by term and are checked against every vertex
+/// in the index.
+inline constexpr size_t kTextIndexTermLength = 3;
+
+/// Returns the sorted, distinct terms of `text`: all of its substrings of
+/// `kTextIndexTermLength` bytes, with ASCII letters folded to lower case.
+/// Every string which contains `pattern` has all of the terms of `pattern`, so
+/// the terms narrow down the candidates for all of the `TextMatch` predicates.
+std::vector<std::string> TextIndexTerms(std::string_view text);
+
+/// Returns true if `text` satisfies `match` with `pattern`. Like the Cypher
+/// operators, the comparison is case sensitive.
+bool TextMatches(std::string_view text, TextMatch match, std::string_view pattern);
+
+/// Inverted index from the terms of the string values of a property to the
+/// vertices with a label. Values which aren't strings aren't indexed.
+class TextIndex {
+ public:
+  TextIndex(Indices *indices, const Config &config) : indices_(indices), config_(config) {}
+
+  TextIndex(const TextIndex &) = delete;
+  TextIndex(TextIndex &&) = delete;
+  TextIndex &operator=(const TextIndex &) = delete;
+  TextIndex &operator=(TextIndex &&) = delete;
+
+  virtual ~TextIndex() = default;
+
+  virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                   const Transaction &tx) = 0;
+
+  virtual bool DropIndex(LabelId label, PropertyId property) = 0;
+
+  virtual bool IndexExists(LabelId label, PropertyId property) const = 0;
+
+  virtual std::vector<std::pair<LabelId, PropertyId>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property, std::string_view pattern) const = 0;
+
+ protected:
+  Indices *indices_;
+  Config config_;
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,108 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/vector_index.hpp"
+
+#include <array>
+#include <cmath>
+#include <numeric>
+
+#include "utils/string.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// The kernels sum into several independent accumulators, so the compiler can
+// vectorize the loops without reassociating floating point additions (which it
+// only does with -ffast-math).
+constexpr size_t kLanes = 16;
+
+}  // namespace
+
+std::optional<VectorMetric> StringToVectorMetric(std::string_view name) {
+  const auto lowercase_name = utils::ToLowerCase(name);
+  if (lowercase_name == "l2") return VectorMetric::L2;
+  if (lowercase_name == "cos" || lowercase_name == "cosine") return VectorMetric::COSINE;
+  return std::nullopt;
+}
+
+float L2SquaredDistance(const float *a, const float *b, size_t dimension) {
+  std::array<float, kLanes> sums{};
+  size_t i = 0;
+  for (; i + kLanes <= dimension; i += kLanes) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      const auto diff = a[i + lane] - b[i + lane];
+      sums[lane] += diff * diff;
+    }
+  }
+  for (; i < dimension; ++i) {
+    const auto diff = a[i] - b[i];
+    sums[0] += diff * diff;
+  }
+  return std::accumulate(sums.begin(), sums.end(), 0.0F);
+}
+
+float CosineDistance(const float *a, const float *b, size_t dimension) {
+  std::array<float, kLanes> dots{};
+  std::array<float, kLanes> norms_a{};
+  std::array<float, kLanes> norms_b{};
+  size_t i = 0;
+  for (; i + kLanes <= dimension; i += kLanes) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      dots[lane] += a[i + lane] * b[i + lane];
+      norms_a[lane] += a[i + lane] * a[i + lane];
+      norms_b[lane] += b[i + lane] * b[i + lane];
+    }
+  }
+  for (; i < dimension; ++i) {
+    dots[0] += a[i] * b[i];
+    norms_a[0] += a[i] * a[i];
+    norms_b[0] += b[i] * b[i];
+  }
+  const auto dot = std::accumulate(dots.begin(), dots.end(), 0.0F);
+  const auto norm_a = std::accumulate(norms_a.begin(), norms_a.end(), 0.0F);
+  const auto norm_b = std::accumulate(norms_b.begin(), norms_b.end(), 0.0F);
+  if (norm_a == 0.0F || norm_b == 0.0F) {
+    return 1.0F;
+  }
+  return 1.0F - dot / std::sqrt(norm_a * norm_b);
+}
+
+double VectorDistance(VectorMetric metric, const float *a, const float *b, size_t dimension) {
+  switch (metric) {
+    case VectorMetric::L2:
+      return std::sqrt(static_cast<double>(L2SquaredDistance(a, b, dimension)));
+    case VectorMetric::COSINE:
+      return CosineDistance(a, b, dimension);
+  }
+}
+
+std::optional<std::vector<float>> PropertyValueToVector(const PropertyValue &value) {
+  if (!value.IsList() || value.ValueList().empty()) {
+    return std::nullopt;
+  }
+  const auto &list = value.ValueList();
+  std::vector<float> vector;
+  vector.reserve(list.size());
+  for (const auto &item : list) {
+    if (item.IsDouble()) {
+      vector.push_back(static_cast<float>(item.ValueDouble()));
+    } else if (item.IsInt()) {
+      vector.push_back(static_cast<float>(item.ValueInt()));
+    } else {
+      return std::nullopt;
+    }
+  }
+  return vector;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,87 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/config.hpp"
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+struct Indices;
+
+/// Metrics by which vector indices can be searched.
+enum class VectorMetric : uint8_t { L2, COSINE };
+
+/// Returns the metric with the given name ("l2" or "cos", case insensitive).
+std::optional<VectorMetric> StringToVectorMetric(std::string_view name);
+
+/// Returns the squared Euclidean distance between `a` and `b`.
+float L2SquaredDistance(const float *a, const float *b, size_t dimension);
+
+/// Returns 1 minus the cosine similarity of `a` and `b`, or 1 if one of them
+/// is the zero vector.
+float CosineDistance(const float *a, const float *b, size_t dimension);
+
+/// Returns the distance between `a` and `b` by `metric`. L2 distances are
+/// Euclidean, not squared.
+double VectorDistance(VectorMetric metric, const float *a, const float *b, size_t dimension);
+
+/// Returns the vector of a non-empty list of numbers, or `std::nullopt` if
+/// the value is something else.
+std::optional<std::vector<float>> PropertyValueToVector(const PropertyValue &value);
+
+/// Approximate nearest neighbour index of the vector values (lists of
+/// numbers) of a property of the vertices with a label. All vectors in an
+/// index have the dimension of the first indexed vector, values of other
+/// dimensions aren't indexed.
+class VectorIndex {
+ public:
+  VectorIndex(Indices *indices, const Config &config) : indices_(indices), config_(config) {}
+
+  VectorIndex(const VectorIndex &) = delete;
+  VectorIndex(VectorIndex &&) = delete;
+  VectorIndex &operator=(const VectorIndex &) = delete;
+  VectorIndex &operator=(VectorIndex &&) = delete;
+
+  virtual ~VectorIndex() = default;
+
+  virtual void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) = 0;
+
+  virtual void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                   const Transaction &tx) = 0;
+
+  virtual bool DropIndex(LabelId label, PropertyId property) = 0;
+
+  virtual bool IndexExists(LabelId label, PropertyId property) const = 0;
+
+  virtual std::vector<std::pair<LabelId, PropertyId>> ListIndices() const = 0;
+
+  virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const = 0;
+
+ protected:
+  Indices *indices_;
+  Config config_;
+};
+
+}  // namespace memgraph::storage
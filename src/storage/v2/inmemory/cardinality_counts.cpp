@@ -0,0 +1,169 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/cardinality_counts.hpp"
+
+#include <algorithm>
+
+#include "storage/v2/delta.hpp"
+#include "storage/v2/transaction.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+template <typename TId>
+void ApplyChanges(absl::flat_hash_map<TId, std::vector<std::pair<uint64_t, uint64_t>>> *histories,
+                  const absl::flat_hash_map<TId, int64_t> &changes, uint64_t commit_timestamp) {
+  for (const auto &[id, change] : changes) {
+    if (change == 0) continue;
+    auto &history = (*histories)[id];
+    const uint64_t previous = history.empty() ? 0 : history.back().second;
+    const uint64_t count = static_cast<uint64_t>(static_cast<int64_t>(previous) + change);
+    // Transactions applied by a replica may share the commit timestamp.
+    if (!history.empty() && history.back().first >= commit_timestamp) {
+      history.back().second = count;
+    } else {
+      history.emplace_back(commit_timestamp, count);
+    }
+  }
+}
+
+template <typename TId>
+void RemoveObsolete(absl::flat_hash_map<TId, std::vector<std::pair<uint64_t, uint64_t>>> *histories,
+                    uint64_t oldest_active_start_timestamp) {
+  for (auto it = histories->begin(); it != histories->end();) {
+    auto &history = it->second;
+    // The last count committed before the oldest active transaction started
+    // is the oldest one which can still be read.
+    auto first_needed = std::lower_bound(history.begin(), history.end(), oldest_active_start_timestamp,
+                                         [](const auto &entry, uint64_t timestamp) { return entry.first < timestamp; });
+    if (first_needed != history.begin()) {
+      history.erase(history.begin(), std::prev(first_needed));
+    }
+    if (history.size() == 1 && history.front().second == 0 && history.front().first < oldest_active_start_timestamp) {
+      histories->erase(it++);
+    } else {
+      ++it;
+    }
+  }
+}
+
+}  // namespace
+
+void CardinalityCounts::Rebuild(utils::SkipList<Vertex>::Accessor vertices, uint64_t timestamp) {
+  absl::flat_hash_map<LabelId, uint64_t> labels;
+  absl::flat_hash_map<EdgeTypeId, uint64_t> edge_types;
+  for (const auto &vertex : vertices) {
+    if (vertex.deleted) continue;
+    for (const auto label : vertex.labels) {
+      ++labels[label];
+    }
+    for (const auto &[edge_type, to_vertex, edge] : vertex.out_edges) {
+      ++edge_types[edge_type];
+    }
+  }
+
+  auto state = state_.Lock();
+  state->valid = true;
+  state->valid_from = timestamp;
+  state->labels.clear();
+  state->edge_types.clear();
+  // The counts are visible to every transaction which can read them.
+  for (const auto &[label, count] : labels) {
+    state->labels[label].emplace_back(0, count);
+  }
+  for (const auto &[edge_type, count] : edge_types) {
+    state->edge_types[edge_type].emplace_back(0, count);
+  }
+}
+
+void CardinalityCounts::Invalidate() {
+  auto state = state_.Lock();
+  state->valid = false;
+  state->labels.clear();
+  state->edge_types.clear();
+}
+
+bool CardinalityCounts::Valid() const { return state_.ReadLock()->valid; }
+
+void CardinalityCounts::Commit(const Transaction &transaction, uint64_t commit_timestamp) {
+  absl::flat_hash_map<LabelId, int64_t> labels;
+  absl::flat_hash_map<EdgeTypeId, int64_t> edge_types;
+  // The deltas undo the changes of the transaction, so they change the counts
+  // in the opposite direction.
+  for (const auto &delta : transaction.deltas.use()) {
+    switch (delta.action) {
+      case Delta::Action::REMOVE_LABEL:
+        ++labels[delta.label];
+        break;
+      case Delta::Action::ADD_LABEL:
+        --labels[delta.label];
+        break;
+      case Delta::Action::REMOVE_OUT_EDGE:
+        ++edge_types[delta.vertex_edge.edge_type];
+        break;
+      case Delta::Action::ADD_OUT_EDGE:
+        --edge_types[delta.vertex_edge.edge_type];
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        // A deleted vertex keeps its labels. Its deletion is the newest change
+        // of the vertex, so the delta is the head of its chain.
+        auto prev = delta.prev.Get();
+        if (prev.type != PreviousPtr::Type::VERTEX) break;
+        for (const auto label : prev.vertex->labels) {
+          --labels[label];
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+  if (labels.empty() && edge_types.empty()) return;
+
+  auto state = state_.Lock();
+  if (!state->valid) return;
+  ApplyChanges(&state->labels, labels, commit_timestamp);
+  ApplyChanges(&state->edge_types, edge_types, commit_timestamp);
+}
+
+template <typename TId>
+std::optional<uint64_t> CardinalityCounts::Count(const State &state, const absl::flat_hash_map<TId, History> &histories,
+                                                 TId id, uint64_t start_timestamp) {
+  if (!state.valid || start_timestamp < state.valid_from) return std::nullopt;
+  auto it = histories.find(id);
+  if (it == histories.end()) return 0;
+  const auto &history = it->second;
+  // The transaction sees the commits which happened before it started.
+  auto visible_end = std::lower_bound(history.begin(), history.end(), start_timestamp,
+                                      [](const auto &entry, uint64_t timestamp) { return entry.first < timestamp; });
+  if (visible_end == history.begin()) return 0;
+  return std::prev(visible_end)->second;
+}
+
+std::optional<uint64_t> CardinalityCounts::VertexCount(LabelId label, uint64_t start_timestamp) const {
+  auto state = state_.ReadLock();
+  return Count(*state, state->labels, label, start_timestamp);
+}
+
+std::optional<uint64_t> CardinalityCounts::EdgeCount(EdgeTypeId edge_type, uint64_t start_timestamp) const {
+  auto state = state_.ReadLock();
+  return Count(*state, state->edge_types, edge_type, start_timestamp);
+}
+
+void CardinalityCounts::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  auto state = state_.Lock();
+  RemoveObsolete(&state->labels, oldest_active_start_timestamp);
+  RemoveObsolete(&state->edge_types, oldest_active_start_timestamp);
+}
+
+}  // namespace memgraph::storage
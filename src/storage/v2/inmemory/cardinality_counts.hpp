@@ -0,0 +1,88 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+struct Transaction;
+
+/** Exact numbers of vertices with each label and of edges of each type, as
+ * seen by snapshot isolation transactions.
+ *
+ * Committing transactions change the counts using their deltas, and each
+ * changed count is kept together with the commit timestamp while an active
+ * transaction may still need the previous one. Analytical transactions don't
+ * create deltas, so the counts are invalid in the analytical storage mode and
+ * are rebuilt when the transactional mode is set again.
+ *
+ * This class is thread-safe.
+ */
+class CardinalityCounts final {
+ public:
+  /// Replaces the counts with those of the committed `vertices`, which must
+  /// not be changed by any active transaction. The counts can be read by the
+  /// transactions which start at or after `timestamp`.
+  void Rebuild(utils::SkipList<Vertex>::Accessor vertices, uint64_t timestamp);
+
+  void Invalidate();
+
+  bool Valid() const;
+
+  /// Applies the changes of `transaction`, which is committed at
+  /// `commit_timestamp`. Transactions have to be applied in the order of
+  /// their commit timestamps.
+  void Commit(const Transaction &transaction, uint64_t commit_timestamp);
+
+  /// Returns the number of vertices with the label seen by a transaction which
+  /// started at `start_timestamp`, if the counts are valid for it.
+  std::optional<uint64_t> VertexCount(LabelId label, uint64_t start_timestamp) const;
+
+  /// Returns the number of edges of the type seen by a transaction which
+  /// started at `start_timestamp`, if the counts are valid for it.
+  std::optional<uint64_t> EdgeCount(EdgeTypeId edge_type, uint64_t start_timestamp) const;
+
+  /// Removes the counts which no transaction started at or after
+  /// `oldest_active_start_timestamp` can read.
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+ private:
+  // Counts after the commits which changed them, sorted by commit timestamps.
+  using History = std::vector<std::pair<uint64_t, uint64_t>>;
+
+  struct State {
+    bool valid{false};
+    uint64_t valid_from{0};
+    absl::flat_hash_map<LabelId, History> labels;
+    absl::flat_hash_map<EdgeTypeId, History> edge_types;
+  };
+
+  template <typename TId>
+  static std::optional<uint64_t> Count(const State &state, const absl::flat_hash_map<TId, History> &histories,
+                                       TId id, uint64_t start_timestamp);
+
+  utils::Synchronized<State, utils::RWSpinLock> state_;
+};
+
+}  // namespace memgraph::storage
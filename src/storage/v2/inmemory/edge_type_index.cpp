@@ -0,0 +1,161 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+
+namespace memgraph::storage {
+
+InMemoryEdgeTypeIndex::InMemoryEdgeTypeIndex(Indices *indices, const Config &config) : EdgeTypeIndex(indices, config) {}
+
+bool InMemoryEdgeTypeIndex::CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices,
+                                        const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  using IndexAccessor = decltype(it->second.access());
+  const auto insert = [](Vertex &from_vertex, EdgeTypeId edge_type, IndexAccessor &index_accessor) {
+    TryInsertEdgeTypeIndex(from_vertex, edge_type, index_accessor);
+  };
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, index_, edge_type, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, index_, edge_type, insert);
+  }
+  return true;
+}
+
+void InMemoryEdgeTypeIndex::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                                                 const Transaction &tx) {
+  auto it = index_.find(edge_type);
+  if (it == index_.end()) return;
+  auto acc = it->second.access();
+  acc.insert(Entry{from, to, edge_ref, tx.start_timestamp});
+}
+
+bool InMemoryEdgeTypeIndex::DropIndex(EdgeTypeId edge_type) { return index_.erase(edge_type) > 0; }
+
+bool InMemoryEdgeTypeIndex::IndexExists(EdgeTypeId edge_type) const { return index_.find(edge_type) != index_.end(); }
+
+std::vector<EdgeTypeId> InMemoryEdgeTypeIndex::ListIndices() const {
+  std::vector<EdgeTypeId> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryEdgeTypeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryEdgeTypeIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                             std::vector<std::function<void()>> &tasks) {
+  for (auto &edge_type_storage : index_) {
+    tasks.emplace_back(
+        [edge_type = edge_type_storage.first, &storage = edge_type_storage.second, oldest_active_start_timestamp] {
+          auto edges_acc = storage.access();
+          for (auto it = edges_acc.begin(); it != edges_acc.end();) {
+            auto next_it = it;
+            ++next_it;
+
+            if (it->timestamp >= oldest_active_start_timestamp) {
+              it = next_it;
+              continue;
+            }
+
+            // Only the from vertex is read here because the edge could already
+            // be removed from the main storage.
+            if ((next_it != edges_acc.end() && it->from_vertex == next_it->from_vertex && it->edge == next_it->edge &&
+                 it->to_vertex == next_it->to_vertex) ||
+                !AnyVersionHasOutEdge(*it->from_vertex, edge_type, it->to_vertex, it->edge,
+                                      oldest_active_start_timestamp)) {
+              edges_acc.remove(*it);
+            }
+
+            it = next_it;
+          }
+        });
+  }
+}
+
+InMemoryEdgeTypeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type,
+                                          View view, Transaction *transaction, Indices *indices,
+                                          Constraints *constraints, const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      edge_type_(edge_type),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
+InMemoryEdgeTypeIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_edge_accessor_(EdgeRef(nullptr), self_->edge_type_, nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_.items) {
+  AdvanceUntilValid();
+}
+
+InMemoryEdgeTypeIndex::Iterable::Iterator &InMemoryEdgeTypeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryEdgeTypeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->from_vertex == current_edge_accessor_.from_vertex_ &&
+        index_iterator_->edge == current_edge_accessor_.edge_ &&
+        index_iterator_->to_vertex == current_edge_accessor_.to_vertex_) {
+      continue;
+    }
+    if (CurrentVersionHasOutEdge(*index_iterator_->from_vertex, self_->edge_type_, index_iterator_->to_vertex,
+                                 index_iterator_->edge, self_->transaction_, self_->view_)) {
+      current_edge_accessor_ = EdgeAccessor(index_iterator_->edge, self_->edge_type_, index_iterator_->from_vertex,
+                                            index_iterator_->to_vertex, self_->transaction_, self_->indices_,
+                                            self_->constraints_, self_->config_.items);
+      break;
+    }
+  }
+}
+
+uint64_t InMemoryEdgeTypeIndex::ApproximateEdgeCount(EdgeTypeId edge_type) const {
+  auto it = index_.find(edge_type);
+  MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+  return it->second.size();
+}
+
+void InMemoryEdgeTypeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryEdgeTypeIndex::Iterable InMemoryEdgeTypeIndex::Edges(EdgeTypeId edge_type, View view,
+                                                             Transaction *transaction, Constraints *constraints) {
+  const auto it = index_.find(edge_type);
+  MG_ASSERT(it != index_.end(), "Index for edge type {} doesn't exist", edge_type.AsUint());
+  return {it->second.access(), edge_type, view, transaction, indices_, constraints, config_};
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,117 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/indices/edge_type_index.hpp"
+#include "storage/v2/inmemory/label_index.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
+ private:
+  struct Entry {
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    EdgeRef edge;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const {
+      return std::make_tuple(from_vertex, edge, to_vertex, timestamp) <
+             std::make_tuple(rhs.from_vertex, rhs.edge, rhs.to_vertex, rhs.timestamp);
+    }
+    bool operator==(const Entry &rhs) const {
+      return from_vertex == rhs.from_vertex && edge == rhs.edge && to_vertex == rhs.to_vertex &&
+             timestamp == rhs.timestamp;
+    }
+  };
+
+ public:
+  InMemoryEdgeTypeIndex(Indices *indices, const Config &config);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
+
+  /// @throw std::bad_alloc
+  void UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                            const Transaction &tx) override;
+
+  /// Returns false if there was no index to drop
+  bool DropIndex(EdgeTypeId edge_type) override;
+
+  bool IndexExists(EdgeTypeId edge_type) const override;
+
+  std::vector<EdgeTypeId> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view,
+             Transaction *transaction, Indices *indices, Constraints *constraints, const Config &config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor const &operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+    };
+
+    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator end() { return {this, index_accessor_.end()}; }
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config config_;
+  };
+
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const override;
+
+  void RunGC();
+
+  Iterable Edges(EdgeTypeId edge_type, View view, Transaction *transaction, Constraints *constraints);
+
+ private:
+  std::map<EdgeTypeId, utils::SkipList<Entry>> index_;
+};
+
+}  // namespace memgraph::storage
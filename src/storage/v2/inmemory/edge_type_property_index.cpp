@@ -0,0 +1,306 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+
+namespace memgraph::storage {
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator<(const Entry &rhs) const {
+  if (value < rhs.value) {
+    return true;
+  }
+  if (rhs.value < value) {
+    return false;
+  }
+  return std::make_tuple(from_vertex, edge, to_vertex, timestamp) <
+         std::make_tuple(rhs.from_vertex, rhs.edge, rhs.to_vertex, rhs.timestamp);
+}
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator==(const Entry &rhs) const {
+  return value == rhs.value && from_vertex == rhs.from_vertex && edge == rhs.edge && to_vertex == rhs.to_vertex &&
+         timestamp == rhs.timestamp;
+}
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator<(const PropertyValue &rhs) const { return value < rhs; }
+
+bool InMemoryEdgeTypePropertyIndex::Entry::operator==(const PropertyValue &rhs) const { return value == rhs; }
+
+InMemoryEdgeTypePropertyIndex::InMemoryEdgeTypePropertyIndex(Indices *indices, const Config &config)
+    : EdgeTypePropertyIndex(indices, config) {}
+
+bool InMemoryEdgeTypePropertyIndex::CreateIndex(
+    EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
+  // The callers check that the edges of `edge_type` have properties. The
+  // config copied here is created before the storage resolves the edge types
+  // with properties, so it can't be checked here.
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(edge_type, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  using IndexAccessor = decltype(it->second.access());
+  const auto insert = [](Vertex &from_vertex, std::pair<EdgeTypeId, PropertyId> key, IndexAccessor &index_accessor) {
+    TryInsertEdgeTypePropertyIndex(from_vertex, key, index_accessor);
+  };
+  const auto key = std::make_pair(edge_type, property);
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, index_, key, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, index_, key, insert);
+  }
+  indices_by_edge_type_[edge_type].emplace_back(property, &it->second);
+  return true;
+}
+
+void InMemoryEdgeTypePropertyIndex::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref,
+                                                         EdgeTypeId edge_type, const Transaction &tx) {
+  auto it = indices_by_edge_type_.find(edge_type);
+  if (it == indices_by_edge_type_.end()) return;
+  // The edge is either new or re-pointed to a new vertex by a caller already
+  // holding its lock, so the properties can't change while they are read.
+  for (const auto &[property, storage] : it->second) {
+    auto value = edge_ref.ptr->properties.GetProperty(property);
+    if (value.IsNull()) {
+      continue;
+    }
+    auto acc = storage->access();
+    acc.insert(Entry{std::move(value), from, to, edge_ref.ptr, tx.start_timestamp});
+  }
+}
+
+void InMemoryEdgeTypePropertyIndex::UpdateOnSetProperty(Vertex *from, Vertex *to, Edge *edge, EdgeTypeId edge_type,
+                                                        PropertyId property, const PropertyValue &value,
+                                                        const Transaction &tx) {
+  if (value.IsNull()) {
+    return;
+  }
+  auto it = indices_by_edge_type_.find(edge_type);
+  if (it == indices_by_edge_type_.end()) return;
+  for (const auto &[indexed_property, storage] : it->second) {
+    if (indexed_property != property) {
+      continue;
+    }
+    auto acc = storage->access();
+    acc.insert(Entry{value, from, to, edge, tx.start_timestamp});
+  }
+}
+
+bool InMemoryEdgeTypePropertyIndex::DropIndex(EdgeTypeId edge_type, PropertyId property) {
+  if (auto it = indices_by_edge_type_.find(edge_type); it != indices_by_edge_type_.end()) {
+    std::erase_if(it->second, [property](const auto &item) { return item.first == property; });
+    if (it->second.empty()) {
+      indices_by_edge_type_.erase(it);
+    }
+  }
+  return index_.erase({edge_type, property}) > 0;
+}
+
+bool InMemoryEdgeTypePropertyIndex::IndexExists(EdgeTypeId edge_type, PropertyId property) const {
+  return index_.find({edge_type, property}) != index_.end();
+}
+
+std::vector<std::pair<EdgeTypeId, PropertyId>> InMemoryEdgeTypePropertyIndex::ListIndices() const {
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryEdgeTypePropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryEdgeTypePropertyIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                                     std::vector<std::function<void()>> &tasks) {
+  for (auto &index_storage : index_) {
+    tasks.emplace_back([edge_type_property = index_storage.first, &index = index_storage.second,
+                        oldest_active_start_timestamp] {
+      auto index_acc = index.access();
+      for (auto it = index_acc.begin(); it != index_acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
+
+        // The edge is only read if some version of the from vertex still has
+        // it, otherwise it could already be removed from the main storage.
+        if ((next_it != index_acc.end() && it->value == next_it->value && it->from_vertex == next_it->from_vertex &&
+             it->edge == next_it->edge && it->to_vertex == next_it->to_vertex) ||
+            !AnyVersionHasOutEdge(*it->from_vertex, edge_type_property.first, it->to_vertex, EdgeRef(it->edge),
+                                  oldest_active_start_timestamp) ||
+            !AnyVersionHasEdgeProperty(*it->edge, edge_type_property.second, it->value,
+                                       oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+        it = next_it;
+      }
+    });
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                                  EdgeTypeId edge_type, PropertyId property,
+                                                  const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                  const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                  View view, Transaction *transaction, Indices *indices,
+                                                  Constraints *constraints, const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      edge_type_(edge_type),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  bounds_valid_ = NormalizePropertyValueBounds(lower_bound_, upper_bound_);
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                            utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_edge_accessor_(EdgeRef(nullptr), self_->edge_type_, nullptr, nullptr, nullptr, nullptr, nullptr,
+                             self_->config_.items) {
+  AdvanceUntilValid();
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator &InMemoryEdgeTypePropertyIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryEdgeTypePropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->from_vertex == current_edge_accessor_.from_vertex_ &&
+        EdgeRef(index_iterator_->edge) == current_edge_accessor_.edge_ &&
+        index_iterator_->to_vertex == current_edge_accessor_.to_vertex_) {
+      continue;
+    }
+
+    if (self_->lower_bound_) {
+      if (index_iterator_->value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && index_iterator_->value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      if (self_->upper_bound_->value() < index_iterator_->value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && index_iterator_->value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    // The edge can only be read once the from vertex is known to have it.
+    if (!CurrentVersionHasOutEdge(*index_iterator_->from_vertex, self_->edge_type_, index_iterator_->to_vertex,
+                                  EdgeRef(index_iterator_->edge), self_->transaction_, self_->view_)) {
+      continue;
+    }
+    auto accessor = EdgeAccessor(EdgeRef(index_iterator_->edge), self_->edge_type_, index_iterator_->from_vertex,
+                                 index_iterator_->to_vertex, self_->transaction_, self_->indices_, self_->constraints_,
+                                 self_->config_.items);
+    auto value = accessor.GetProperty(self_->property_, self_->view_);
+    if (!value.HasError() && *value == index_iterator_->value) {
+      current_edge_accessor_ = accessor;
+      break;
+    }
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator InMemoryEdgeTypePropertyIndex::Iterable::begin() {
+  // If the bounds are set and don't have comparable types we don't yield any
+  // items from the index.
+  if (!bounds_valid_) return {this, index_accessor_.end()};
+  auto index_iterator = index_accessor_.begin();
+  if (lower_bound_) {
+    index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
+  }
+  return {this, index_iterator};
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable::Iterator InMemoryEdgeTypePropertyIndex::Iterable::end() {
+  return {this, index_accessor_.end()};
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                                             const PropertyValue &value) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  if (!value.IsNull()) {
+    // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+    return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+  }
+  return acc.estimate_average_number_of_equals(
+      [](const auto &first, const auto &second) { return first.value == second.value; },
+      // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+      utils::SkipListLayerForAverageEqualsEstimation(acc.size()));
+}
+
+uint64_t InMemoryEdgeTypePropertyIndex::ApproximateEdgeCount(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower,
+    const std::optional<utils::Bound<PropertyValue>> &upper) const {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryEdgeTypePropertyIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryEdgeTypePropertyIndex::Iterable InMemoryEdgeTypePropertyIndex::Edges(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+    Constraints *constraints) {
+  auto it = index_.find({edge_type, property});
+  MG_ASSERT(it != index_.end(), "Index for edge type {} and property {} doesn't exist", edge_type.AsUint(),
+            property.AsUint());
+  return {it->second.access(), edge_type, property, lower_bound, upper_bound, view,
+          transaction,         indices_,  constraints, config_};
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,142 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/indices/edge_type_property_index.hpp"
+#include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+#include "utils/bound.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryEdgeTypePropertyIndex : public storage::EdgeTypePropertyIndex {
+ private:
+  struct Entry {
+    PropertyValue value;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    Edge *edge;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    bool operator<(const PropertyValue &rhs) const;
+    bool operator==(const PropertyValue &rhs) const;
+  };
+
+ public:
+  InMemoryEdgeTypePropertyIndex(Indices *indices, const Config &config);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(EdgeTypeId edge_type, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
+
+  /// Indexes the current values of the edge, so it is also used when an
+  /// existing edge is attached to another vertex.
+  /// @throw std::bad_alloc
+  void UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, EdgeTypeId edge_type,
+                            const Transaction &tx) override;
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(Vertex *from, Vertex *to, Edge *edge, EdgeTypeId edge_type, PropertyId property,
+                           const PropertyValue &value, const Transaction &tx) override;
+
+  bool DropIndex(EdgeTypeId edge_type, PropertyId property) override;
+
+  bool IndexExists(EdgeTypeId edge_type, PropertyId property) const override;
+
+  std::vector<std::pair<EdgeTypeId, PropertyId>> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, PropertyId property,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, const Config &config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      EdgeAccessor const &operator*() const { return current_edge_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      EdgeAccessor current_edge_accessor_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    EdgeTypeId edge_type_;
+    PropertyId property_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config config_;
+  };
+
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const override;
+
+  /// Supplying a specific value into the count estimation function will return
+  /// an estimated count of edges with that value. If `Null` is supplied, the
+  /// average number of equal elements is returned.
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value) const;
+
+  uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                const std::optional<utils::Bound<PropertyValue>> &lower,
+                                const std::optional<utils::Bound<PropertyValue>> &upper) const;
+
+  void RunGC();
+
+  Iterable Edges(EdgeTypeId edge_type, PropertyId property,
+                 const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                 const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+                 Constraints *constraints);
+
+ private:
+  std::map<std::pair<EdgeTypeId, PropertyId>, utils::SkipList<Entry>> index_;
+  std::unordered_map<EdgeTypeId, std::vector<std::pair<PropertyId, utils::SkipList<Entry> *>>> indices_by_edge_type_;
+};
+
+}  // namespace memgraph::storage
@@ -24,6 +24,16 @@ void InMemoryLabelIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_af
   acc.insert(Entry{vertex_after_update, tx.start_timestamp});
 }
 
+void InMemoryLabelIndex::UpdateOnAddLabel(LabelId added_label, const std::vector<Vertex *> &vertices_after_update,
+                                          const Transaction &tx) {
+  auto it = index_.find(added_label);
+  if (it == index_.end()) return;
+  auto acc = it->second.access();
+  for (auto *vertex : vertices_after_update) {
+    acc.insert(Entry{vertex, tx.start_timestamp});
+  }
+}
+
 bool InMemoryLabelIndex::CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
                                      const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
   const auto create_index_seq = [this](LabelId label, utils::SkipList<Vertex>::Accessor &vertices,
@@ -77,24 +87,35 @@ std::vector<LabelId> InMemoryLabelIndex::ListIndices() const {
 }
 
 void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                          std::vector<std::function<void()>> &tasks) {
   for (auto &label_storage : index_) {
-    auto vertices_acc = label_storage.second.access();
-    for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
-      auto next_it = it;
-      ++next_it;
+    tasks.emplace_back([label = label_storage.first, &storage = label_storage.second, oldest_active_start_timestamp] {
+      auto vertices_acc = storage.access();
+      for (auto it = vertices_acc.begin(); it != vertices_acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
+
+        if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
+            !AnyVersionHasLabel(*it->vertex, label, oldest_active_start_timestamp)) {
+          vertices_acc.remove(*it);
+        }
 
-      if (it->timestamp >= oldest_active_start_timestamp) {
         it = next_it;
-        continue;
-      }
-
-      if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
-          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
-        vertices_acc.remove(*it);
       }
-
-      it = next_it;
-    }
+    });
   }
 }
 
@@ -109,6 +130,20 @@ InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_ac
       constraints_(constraints),
       config_(config) {}
 
+InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                       utils::SkipList<Entry>::Iterator chunk_begin, Vertex *chunk_end, LabelId label,
+                                       View view, Transaction *transaction, Indices *indices,
+                                       Constraints *constraints, const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      chunk_begin_(chunk_begin),
+      chunk_end_(chunk_end),
+      label_(label),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
 InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
@@ -125,6 +160,10 @@ InMemoryLabelIndex::Iterable::Iterator &InMemoryLabelIndex::Iterable::Iterator::
 
 void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (self_->chunk_end_ && !std::less<Vertex *>{}(index_iterator_->vertex, self_->chunk_end_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
     if (index_iterator_->vertex == current_vertex_) {
       continue;
     }
@@ -158,6 +197,37 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(LabelId label, View vi
   return {it->second.access(), label, view, transaction, indices_, constraints, config_};
 }
 
+std::vector<InMemoryLabelIndex::Iterable> InMemoryLabelIndex::ChunkedVertices(LabelId label, View view,
+                                                                              uint64_t num_chunks,
+                                                                              Transaction *transaction,
+                                                                              Constraints *constraints) {
+  const auto it = index_.find(label);
+  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
+  auto accessor = it->second.access();
+  auto split_points = accessor.split(num_chunks);
+
+  // A chunk ends at the first entry of a vertex, so the split points in the
+  // middle of the entries of a vertex are moved to the next vertex.
+  std::vector<utils::SkipList<Entry>::Iterator> chunk_begins{accessor.begin()};
+  for (auto split_point : split_points) {
+    auto *previous_vertex = chunk_begins.back()->vertex;
+    while (split_point != accessor.end() && !std::less<Vertex *>{}(previous_vertex, split_point->vertex)) {
+      ++split_point;
+    }
+    if (split_point == accessor.end()) break;
+    chunk_begins.push_back(split_point);
+  }
+
+  std::vector<Iterable> chunks;
+  chunks.reserve(chunk_begins.size());
+  for (size_t i = 0; i < chunk_begins.size(); ++i) {
+    auto *chunk_end = i + 1 < chunk_begins.size() ? chunk_begins[i + 1]->vertex : nullptr;
+    chunks.emplace_back(it->second.access(), chunk_begins[i], chunk_end, label, view, transaction, indices_,
+                        constraints, config_);
+  }
+  return chunks;
+}
+
 void InMemoryLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
   stats_[label] = stats;
 }
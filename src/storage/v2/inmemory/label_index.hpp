@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <functional>
+#include <optional>
+#include <vector>
+
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/indices/label_index.hpp"
 #include "storage/v2/vertex.hpp"
@@ -43,6 +47,9 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
 
+  void UpdateOnAddLabel(LabelId added_label, const std::vector<Vertex *> &vertices_after_update,
+                        const Transaction &tx) override;
+
   void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_before_update, const Transaction &tx) override {}
 
   /// @throw std::bad_alloc
@@ -58,11 +65,23 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
+  /// Appends one task per index to `tasks` which, when all of them are run, do
+  /// the same as `RemoveObsoleteEntries`. The tasks are independent of each
+  /// other and can be run concurrently while no index is created or dropped.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
   class Iterable {
    public:
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, View view, Transaction *transaction,
              Indices *indices, Constraints *constraints, const Config &config);
 
+    /// Iterates only the chunk of the index which starts at `chunk_begin` and
+    /// ends before the entries of `chunk_end`, or at the end if it's `nullptr`.
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Entry>::Iterator chunk_begin,
+             Vertex *chunk_end, LabelId label, View view, Transaction *transaction, Indices *indices,
+             Constraints *constraints, const Config &config);
+
     class Iterator {
      public:
       Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
@@ -83,11 +102,13 @@ class InMemoryLabelIndex : public storage::LabelIndex {
       Vertex *current_vertex_;
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator begin() { return {this, chunk_begin_ ? *chunk_begin_ : index_accessor_.begin()}; }
     Iterator end() { return {this, index_accessor_.end()}; }
 
    private:
     utils::SkipList<Entry>::Accessor index_accessor_;
+    std::optional<utils::SkipList<Entry>::Iterator> chunk_begin_;
+    Vertex *chunk_end_{nullptr};
     LabelId label_;
     View view_;
     Transaction *transaction_;
@@ -102,6 +123,11 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   Iterable Vertices(LabelId label, View view, Transaction *transaction, Constraints *constraints);
 
+  /// Splits the vertices with `label` into at most `num_chunks` iterables of
+  /// about the same size. All entries of a vertex are in the same chunk.
+  std::vector<Iterable> ChunkedVertices(LabelId label, View view, uint64_t num_chunks, Transaction *transaction,
+                                        Constraints *constraints);
+
   void SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats);
 
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const;
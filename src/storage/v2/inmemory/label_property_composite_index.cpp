@@ -0,0 +1,452 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
+
+#include <algorithm>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+std::vector<PropertyValue> GetPropertyValues(const Vertex &vertex, const std::vector<PropertyId> &properties) {
+  std::vector<PropertyValue> values;
+  values.reserve(properties.size());
+  for (const auto &property : properties) {
+    values.push_back(vertex.properties.GetProperty(property));
+  }
+  return values;
+}
+
+bool AllNull(const std::vector<PropertyValue> &values) {
+  return std::all_of(values.begin(), values.end(), [](const auto &value) { return value.IsNull(); });
+}
+
+}  // namespace
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const Entry &rhs) const {
+  if (values < rhs.values) {
+    return true;
+  }
+  if (rhs.values < values) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const Entry &rhs) const {
+  return values == rhs.values && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const std::vector<PropertyValue> &prefix) const {
+  DMG_ASSERT(prefix.size() <= values.size(), "Prefix is longer than the indexed properties!");
+  return std::lexicographical_compare(values.begin(), values.begin() + static_cast<int64_t>(prefix.size()),
+                                      prefix.begin(), prefix.end());
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const std::vector<PropertyValue> &prefix) const {
+  DMG_ASSERT(prefix.size() <= values.size(), "Prefix is longer than the indexed properties!");
+  return std::equal(prefix.begin(), prefix.end(), values.begin());
+}
+
+InMemoryLabelPropertyCompositeIndex::InMemoryLabelPropertyCompositeIndex(Indices *indices, const Config &config)
+    : LabelPropertyCompositeIndex(indices, config) {}
+
+bool InMemoryLabelPropertyCompositeIndex::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties, utils::SkipList<Vertex>::Accessor vertices,
+    const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
+  MG_ASSERT(properties.size() > 1, "A composite index needs at least two properties!");
+  spdlog::trace("Vertices size when creating index: {}", vertices.size());
+  using IndexIterator = decltype(index_)::iterator;
+  auto key = LabelProperties{label, properties};
+
+  auto create_index_seq = [this](const LabelProperties &key, utils::SkipList<Vertex>::Accessor &vertices,
+                                 IndexIterator it) {
+    using IndexAccessor = decltype(it->second.access());
+
+    CreateIndexOnSingleThread(vertices, it, index_, key,
+                              [](Vertex &vertex, const LabelProperties &key, IndexAccessor &index_accessor) {
+                                TryInsertLabelPropertyCompositeIndex(vertex, key, index_accessor);
+                              });
+
+    return true;
+  };
+
+  auto create_index_par = [this](const LabelProperties &key, utils::SkipList<Vertex>::Accessor &vertices,
+                                 IndexIterator it, const ParallelizedIndexCreationInfo &parallel_exec_info) {
+    using IndexAccessor = decltype(it->second.access());
+
+    CreateIndexOnMultipleThreads(vertices, it, index_, key, parallel_exec_info,
+                                 [](Vertex &vertex, const LabelProperties &key, IndexAccessor &index_accessor) {
+                                   TryInsertLabelPropertyCompositeIndex(vertex, key, index_accessor);
+                                 });
+
+    return true;
+  };
+
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  auto *index_ptr = &*it;
+  for (const auto &property : properties) {
+    auto &by_property = indices_by_property_[property];
+    if (std::find(by_property.begin(), by_property.end(), index_ptr) == by_property.end()) {
+      by_property.push_back(index_ptr);
+    }
+  }
+
+  // On failure the index is erased by the creation helpers, so it has to be
+  // unregistered from `indices_by_property_` as well.
+  try {
+    if (parallel_exec_info) {
+      return create_index_par(key, vertices, it, *parallel_exec_info);
+    }
+    return create_index_seq(key, vertices, it);
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    for (const auto &property : properties) {
+      auto by_property = indices_by_property_.find(property);
+      if (by_property == indices_by_property_.end()) continue;
+      std::erase(by_property->second, index_ptr);
+      if (by_property->second.empty()) indices_by_property_.erase(by_property);
+    }
+    throw;
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
+                                                           const Transaction &tx) {
+  for (auto &[label_properties, storage] : index_) {
+    if (label_properties.first != added_label) {
+      continue;
+    }
+    auto values = GetPropertyValues(*vertex_after_update, label_properties.second);
+    if (!AllNull(values)) {
+      auto acc = storage.access();
+      acc.insert(Entry{std::move(values), vertex_after_update, tx.start_timestamp});
+    }
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue & /*value*/,
+                                                              Vertex *vertex, const Transaction &tx) {
+  auto by_property = indices_by_property_.find(property);
+  if (by_property == indices_by_property_.end()) {
+    return;
+  }
+
+  // The entry holds the values of all of the properties, so unlike the
+  // single-property index we need the whole (already updated) tuple here.
+  // Vertices without the label get their entry once the label is added.
+  for (auto *index : by_property->second) {
+    const auto &[label, properties] = index->first;
+    if (!utils::Contains(vertex->labels, label)) {
+      continue;
+    }
+    auto values = GetPropertyValues(*vertex, properties);
+    if (AllNull(values)) {
+      continue;
+    }
+    auto acc = index->second.access();
+    acc.insert(Entry{std::move(values), vertex, tx.start_timestamp});
+  }
+}
+
+bool InMemoryLabelPropertyCompositeIndex::DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+  auto it = index_.find({label, properties});
+  if (it == index_.end()) {
+    return false;
+  }
+  for (const auto &property : properties) {
+    auto by_property = indices_by_property_.find(property);
+    if (by_property == indices_by_property_.end()) continue;
+    std::erase(by_property->second, &*it);
+    if (by_property->second.empty()) {
+      indices_by_property_.erase(by_property);
+    }
+  }
+  index_.erase(it);
+  return true;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+  return index_.find({label, properties}) != index_.end();
+}
+
+std::vector<InMemoryLabelPropertyCompositeIndex::LabelProperties> InMemoryLabelPropertyCompositeIndex::ListIndices()
+    const {
+  std::vector<LabelProperties> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+std::vector<std::vector<PropertyId>> InMemoryLabelPropertyCompositeIndex::ListIndices(LabelId label) const {
+  std::vector<std::vector<PropertyId>> ret;
+  for (auto it = index_.lower_bound({label, {}}); it != index_.end() && it->first.first == label; ++it) {
+    ret.push_back(it->first.second);
+  }
+  return ret;
+}
+
+void InMemoryLabelPropertyCompositeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::AppendRemoveObsoleteEntriesTasks(
+    uint64_t oldest_active_start_timestamp, std::vector<std::function<void()>> &tasks) {
+  for (auto &index_storage : index_) {
+    tasks.emplace_back([&label_properties = index_storage.first, &index = index_storage.second,
+                        oldest_active_start_timestamp] {
+      auto index_acc = index.access();
+      for (auto it = index_acc.begin(); it != index_acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
+
+        if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
+            !AnyVersionHasLabelProperties(*it->vertex, label_properties.first, label_properties.second, it->values,
+                                          oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+        it = next_it;
+      }
+    });
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                                  utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_.items),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator &
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  const auto prefix_size = self_->prefix_.size();
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    // The iteration starts at the first entry with the prefix, so the first
+    // entry with a different prefix is past all of the matching ones.
+    if (!(*index_iterator_ == self_->prefix_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
+    const auto &value = index_iterator_->values[prefix_size];
+    if (self_->lower_bound_) {
+      if (value < self_->lower_bound_->value()) {
+        continue;
+      }
+      if (!self_->lower_bound_->IsInclusive() && value == self_->lower_bound_->value()) {
+        continue;
+      }
+    }
+    if (self_->upper_bound_) {
+      if (self_->upper_bound_->value() < value) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+      if (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()) {
+        index_iterator_ = self_->index_accessor_.end();
+        break;
+      }
+    }
+
+    if (CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, self_->properties_,
+                                         index_iterator_->values, self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->transaction_, self_->indices_,
+                                                self_->constraints_, self_->config_.items);
+      break;
+    }
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterable(
+    utils::SkipList<Entry>::Accessor index_accessor, LabelId label, const std::vector<PropertyId> &properties,
+    std::vector<PropertyValue> prefix, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+    Indices *indices, Constraints *constraints, const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      properties_(properties),
+      prefix_(std::move(prefix)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  MG_ASSERT(prefix_.size() + ((lower_bound_ || upper_bound_) ? 1 : 0) <= properties_.size(),
+            "Composite index lookup uses more values than there are indexed properties!");
+  // `Null` is never equal to anything, so a prefix containing it can't match.
+  if (std::any_of(prefix_.begin(), prefix_.end(), [](const auto &value) { return value.IsNull(); })) {
+    bounds_valid_ = false;
+    return;
+  }
+  bounds_valid_ = NormalizePropertyValueBounds(lower_bound_, upper_bound_);
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::begin() {
+  if (!bounds_valid_) return {this, index_accessor_.end()};
+  auto key = prefix_;
+  if (lower_bound_) {
+    key.push_back(lower_bound_->value());
+  }
+  if (key.empty()) {
+    return {this, index_accessor_.begin()};
+  }
+  return {this, index_accessor_.find_equal_or_greater(key)};
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::end() {
+  return {this, index_accessor_.end()};
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties,
+                                                                     const std::vector<PropertyValue> &prefix) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  MG_ASSERT(prefix.size() <= properties.size(), "Prefix is longer than the indexed properties!");
+  auto acc = it->second.access();
+  if (prefix.empty()) {
+    return acc.size();
+  }
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(prefix, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(
+    LabelId label, const std::vector<PropertyId> &properties, const std::vector<PropertyValue> &prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower, const std::optional<utils::Bound<PropertyValue>> &upper)
+    const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  MG_ASSERT(prefix.size() < properties.size(), "There is no property left for the range!");
+  auto normalized_lower = lower;
+  auto normalized_upper = upper;
+  if (!NormalizePropertyValueBounds(normalized_lower, normalized_upper)) {
+    return 0;
+  }
+  if (!normalized_lower && !normalized_upper) {
+    return ApproximateVertexCount(label, properties, prefix);
+  }
+  // Both bounds are set after the normalization, unless the range is open
+  // towards the last type in the order; close it with the prefix itself then.
+  auto make_key_bound = [&prefix](const auto &bound) -> std::optional<utils::Bound<std::vector<PropertyValue>>> {
+    if (!bound) return std::nullopt;
+    auto key = prefix;
+    key.push_back(bound->value());
+    return utils::Bound<std::vector<PropertyValue>>(std::move(key), bound->type());
+  };
+  auto key_lower = make_key_bound(normalized_lower);
+  auto key_upper = make_key_bound(normalized_upper);
+  if (!key_upper && !prefix.empty()) {
+    key_upper = utils::MakeBoundInclusive(prefix);
+  }
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_range_count(key_lower, key_upper, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+std::vector<InMemoryLabelPropertyCompositeIndex::LabelProperties>
+InMemoryLabelPropertyCompositeIndex::ClearIndexStats() {
+  std::vector<LabelProperties> deleted_indexes;
+  deleted_indexes.reserve(stats_.size());
+  std::transform(stats_.begin(), stats_.end(), std::back_inserter(deleted_indexes),
+                 [](const auto &elem) { return elem.first; });
+  stats_.clear();
+  return deleted_indexes;
+}
+
+std::vector<InMemoryLabelPropertyCompositeIndex::LabelProperties> InMemoryLabelPropertyCompositeIndex::DeleteIndexStats(
+    const storage::LabelId &label) {
+  std::vector<LabelProperties> deleted_indexes;
+  for (auto it = stats_.cbegin(); it != stats_.cend();) {
+    if (it->first.first == label) {
+      deleted_indexes.push_back(it->first);
+      it = stats_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return deleted_indexes;
+}
+
+void InMemoryLabelPropertyCompositeIndex::SetIndexStats(const LabelProperties &key,
+                                                        const LabelPropertyIndexStats &stats) {
+  stats_[key] = stats;
+}
+
+std::optional<LabelPropertyIndexStats> InMemoryLabelPropertyCompositeIndex::GetIndexStats(
+    const LabelProperties &key) const {
+  if (auto it = stats_.find(key); it != stats_.end()) {
+    return it->second;
+  }
+  return {};
+}
+
+void InMemoryLabelPropertyCompositeIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable InMemoryLabelPropertyCompositeIndex::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+    Constraints *constraints) {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return {it->second.access(), label,       properties, std::move(prefix), lower_bound, upper_bound, view,
+          transaction,         indices_,    constraints, config_};
+}
+
+}  // namespace memgraph::storage
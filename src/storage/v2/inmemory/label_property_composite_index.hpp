@@ -0,0 +1,165 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/label_property_composite_index.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryLabelPropertyCompositeIndex : public storage::LabelPropertyCompositeIndex {
+ public:
+  using LabelProperties = std::pair<LabelId, std::vector<PropertyId>>;
+
+ private:
+  struct Entry {
+    std::vector<PropertyValue> values;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    // Only the first `prefix.size()` values are compared, so every entry which
+    // starts with `prefix` is considered equal to it.
+    bool operator<(const std::vector<PropertyValue> &prefix) const;
+    bool operator==(const std::vector<PropertyValue> &prefix) const;
+  };
+
+ public:
+  InMemoryLabelPropertyCompositeIndex(Indices *indices, const Config &config);
+
+  /// Vertices are indexed when they have the label and at least one of the
+  /// properties. Missing properties are stored as `Null`, which never matches
+  /// a lookup value.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                   utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
+
+  void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_before_update, const Transaction &tx) override {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           const Transaction &tx) override;
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties) override;
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const override;
+
+  std::vector<LabelProperties> ListIndices() const override;
+
+  /// Returns the property lists of all indices on the given label.
+  std::vector<std::vector<PropertyId>> ListIndices(LabelId label) const;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelPropertyIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, const std::vector<PropertyId> &properties,
+             std::vector<PropertyValue> prefix, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+             Indices *indices, Constraints *constraints, const Config &config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    std::vector<PropertyId> properties_;
+    std::vector<PropertyValue> prefix_;
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config config_;
+  };
+
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const override;
+
+  /// Estimates the number of vertices whose first `prefix.size()` properties
+  /// are equal to `prefix`.
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                  const std::vector<PropertyValue> &prefix) const;
+
+  /// Estimates the number of vertices whose first `prefix.size()` properties
+  /// are equal to `prefix` and whose next property is inside of the bounds.
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                  const std::vector<PropertyValue> &prefix,
+                                  const std::optional<utils::Bound<PropertyValue>> &lower,
+                                  const std::optional<utils::Bound<PropertyValue>> &upper) const;
+
+  std::vector<LabelProperties> ClearIndexStats();
+
+  std::vector<LabelProperties> DeleteIndexStats(const storage::LabelId &label);
+
+  void SetIndexStats(const LabelProperties &key, const storage::LabelPropertyIndexStats &stats);
+
+  std::optional<storage::LabelPropertyIndexStats> GetIndexStats(const LabelProperties &key) const;
+
+  void RunGC();
+
+  /// Yields the vertices whose first `prefix.size()` properties are equal to
+  /// `prefix`. If any of the bounds is set, the next property also has to be
+  /// inside of them.
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
+                    Constraints *constraints);
+
+ private:
+  std::map<LabelProperties, utils::SkipList<Entry>> index_;
+  std::unordered_map<PropertyId, std::vector<std::pair<const LabelProperties, utils::SkipList<Entry>> *>>
+      indices_by_property_;
+  std::map<LabelProperties, storage::LabelPropertyIndexStats> stats_;
+};
+
+}  // namespace memgraph::storage
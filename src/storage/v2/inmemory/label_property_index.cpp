@@ -77,11 +77,112 @@ bool InMemoryLabelPropertyIndex::CreateIndex(LabelId label, PropertyId property,
     return false;
   }
 
-  if (parallel_exec_info) {
-    return create_index_par(label, property, vertices, it, *parallel_exec_info);
+  const bool created = parallel_exec_info ? create_index_par(label, property, vertices, it, *parallel_exec_info)
+                                           : create_index_seq(label, property, vertices, it);
+  if (created && config_.packed_index_merge_threshold > 0) {
+    PackIndex(label, property);
   }
+  return created;
+}
 
-  return create_index_seq(label, property, vertices, it);
+void InMemoryLabelPropertyIndex::PackIndex(LabelId label, PropertyId property) {
+  auto &index = index_.at({label, property});
+  auto packed = std::make_shared<PackedEntries>();
+  packed->entries.reserve(index.size());
+  {
+    auto acc = index.access();
+    for (const auto &entry : acc) {
+      if (packed->entries.empty() || !(packed->entries.back().value == entry.value)) {
+        ++packed->distinct_values_count;
+      }
+      packed->entries.push_back(entry);
+    }
+  }
+  // The entries inserted by index creation are all moved to the packed array,
+  // so no entry of the skip list is covered by it yet.
+  packed->packed_below_timestamp = 0;
+  index.clear();
+
+  auto [it, _] = packed_.try_emplace({label, property});
+  std::lock_guard<utils::SpinLock> guard(it->second.lock);
+  it->second.current = std::move(packed);
+}
+
+void InMemoryLabelPropertyIndex::MergePackedIndex(LabelId label, PropertyId property, utils::SkipList<Entry> &index,
+                                                  PackedIndex &packed, uint64_t oldest_active_start_timestamp,
+                                                  uint64_t merge_threshold) {
+  auto current = packed.Get();
+  auto is_obsolete = [&](const Entry &entry, const Entry *next) {
+    return (next != nullptr && next->vertex == entry.vertex && next->value == entry.value) ||
+           !AnyVersionHasLabelProperty(*entry.vertex, label, property, entry.value, oldest_active_start_timestamp);
+  };
+
+  // Entries of finished transactions which aren't in the packed array yet.
+  std::vector<Entry> finished;
+  {
+    auto index_acc = index.access();
+    for (const auto &entry : index_acc) {
+      if (entry.timestamp >= current->packed_below_timestamp && entry.timestamp < oldest_active_start_timestamp) {
+        finished.push_back(entry);
+      }
+    }
+  }
+  bool has_obsolete = false;
+  for (auto it = current->entries.begin(); it != current->entries.end() && !has_obsolete; ++it) {
+    auto next = std::next(it);
+    has_obsolete = is_obsolete(*it, next != current->entries.end() ? &*next : nullptr);
+  }
+
+  if (has_obsolete || finished.size() >= merge_threshold) {
+    std::vector<Entry> merged;
+    merged.reserve(current->entries.size() + finished.size());
+    std::merge(current->entries.begin(), current->entries.end(), finished.begin(), finished.end(),
+               std::back_inserter(merged));
+    auto rebuilt = std::make_shared<PackedEntries>();
+    rebuilt->entries.reserve(merged.size());
+    for (auto it = merged.begin(); it != merged.end(); ++it) {
+      auto next = std::next(it);
+      if (is_obsolete(*it, next != merged.end() ? &*next : nullptr)) {
+        continue;
+      }
+      if (rebuilt->entries.empty() || !(rebuilt->entries.back().value == it->value)) {
+        ++rebuilt->distinct_values_count;
+      }
+      rebuilt->entries.push_back(std::move(*it));
+    }
+    rebuilt->packed_below_timestamp = oldest_active_start_timestamp;
+
+    std::lock_guard<utils::SpinLock> guard(packed.lock);
+    packed.retired.emplace_back(packed.current);
+    packed.current = rebuilt;
+    current = std::move(rebuilt);
+  }
+
+  // The skip list entries can be removed only once they are packed into every
+  // array which can still be read.
+  uint64_t remove_below_timestamp = current->packed_below_timestamp;
+  std::vector<std::shared_ptr<const PackedEntries>> readable;
+  {
+    std::lock_guard<utils::SpinLock> guard(packed.lock);
+    std::erase_if(packed.retired, [](const auto &retired) { return retired.expired(); });
+    for (const auto &retired : packed.retired) {
+      if (auto retired_entries = retired.lock()) {
+        readable.push_back(std::move(retired_entries));
+      }
+    }
+  }
+  for (const auto &retired_entries : readable) {
+    remove_below_timestamp = std::min(remove_below_timestamp, retired_entries->packed_below_timestamp);
+  }
+  if (remove_below_timestamp == 0) {
+    return;
+  }
+  auto index_acc = index.access();
+  for (const auto &entry : index_acc) {
+    if (entry.timestamp < remove_below_timestamp) {
+      index_acc.remove(entry);
+    }
+  }
 }
 
 void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
@@ -122,6 +223,7 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
       indices_by_property_.erase(property);
     }
   }
+  packed_.erase({label, property});
 
   return index_.erase({label, property}) > 0;
 }
@@ -140,70 +242,118 @@ std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ListIndi
 }
 
 void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &[label_property, index] : index_) {
-    auto index_acc = index.access();
-    for (auto it = index_acc.begin(); it != index_acc.end();) {
-      auto next_it = it;
-      ++next_it;
-
-      if (it->timestamp >= oldest_active_start_timestamp) {
-        it = next_it;
-        continue;
-      }
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
 
-      if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->value == next_it->value) ||
-          !AnyVersionHasLabelProperty(*it->vertex, label_property.first, label_property.second, it->value,
-                                      oldest_active_start_timestamp)) {
-        index_acc.remove(*it);
-      }
-      it = next_it;
-    }
+void InMemoryLabelPropertyIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                                  std::vector<std::function<void()>> &tasks) {
+  for (auto &index_storage : index_) {
+    auto packed_it = packed_.find(index_storage.first);
+    auto *packed = packed_it != packed_.end() ? &packed_it->second : nullptr;
+    tasks.emplace_back(
+        [label_property = index_storage.first, &index = index_storage.second, packed, oldest_active_start_timestamp,
+         merge_threshold = config_.packed_index_merge_threshold] {
+          auto index_acc = index.access();
+          for (auto it = index_acc.begin(); it != index_acc.end();) {
+            auto next_it = it;
+            ++next_it;
+
+            if (it->timestamp >= oldest_active_start_timestamp) {
+              it = next_it;
+              continue;
+            }
+
+            if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->value == next_it->value) ||
+                !AnyVersionHasLabelProperty(*it->vertex, label_property.first, label_property.second, it->value,
+                                            oldest_active_start_timestamp)) {
+              index_acc.remove(*it);
+            }
+            it = next_it;
+          }
+
+          if (packed != nullptr) {
+            MergePackedIndex(label_property.first, label_property.second, index, *packed,
+                             oldest_active_start_timestamp, merge_threshold);
+          }
+        });
   }
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator::Iterator(Iterable *self,
-                                                         utils::SkipList<Entry>::Iterator index_iterator)
+                                                         utils::SkipList<Entry>::Iterator index_iterator,
+                                                         PackedIterator packed_iterator)
     : self_(self),
       index_iterator_(index_iterator),
+      packed_iterator_(packed_iterator),
       current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_.items),
       current_vertex_(nullptr) {
   AdvanceUntilValid();
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator &InMemoryLabelPropertyIndex::Iterable::Iterator::operator++() {
-  ++index_iterator_;
+  AdvanceCurrent();
   AdvanceUntilValid();
   return *this;
 }
 
+bool InMemoryLabelPropertyIndex::Iterable::Iterator::IsCurrentPacked() const {
+  if (packed_iterator_ == self_->PackedEnd()) {
+    return false;
+  }
+  if (index_iterator_ == self_->index_accessor_.end()) {
+    return true;
+  }
+  return !(*index_iterator_ < *packed_iterator_);
+}
+
+const InMemoryLabelPropertyIndex::Entry &InMemoryLabelPropertyIndex::Iterable::Iterator::CurrentEntry() const {
+  return IsCurrentPacked() ? *packed_iterator_ : *index_iterator_;
+}
+
+void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceCurrent() {
+  if (IsCurrentPacked()) {
+    ++packed_iterator_;
+  } else {
+    ++index_iterator_;
+  }
+}
+
 void InMemoryLabelPropertyIndex::Iterable::Iterator::AdvanceUntilValid() {
-  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
-    if (index_iterator_->vertex == current_vertex_) {
+  for (; index_iterator_ != self_->index_accessor_.end() || packed_iterator_ != self_->PackedEnd(); AdvanceCurrent()) {
+    const auto &entry = CurrentEntry();
+    if (entry.vertex == current_vertex_) {
       continue;
     }
 
     if (self_->lower_bound_) {
-      if (index_iterator_->value < self_->lower_bound_->value()) {
+      if (entry.value < self_->lower_bound_->value()) {
         continue;
       }
-      if (!self_->lower_bound_->IsInclusive() && index_iterator_->value == self_->lower_bound_->value()) {
+      if (!self_->lower_bound_->IsInclusive() && entry.value == self_->lower_bound_->value()) {
         continue;
       }
     }
     if (self_->upper_bound_) {
-      if (self_->upper_bound_->value() < index_iterator_->value) {
-        index_iterator_ = self_->index_accessor_.end();
-        break;
-      }
-      if (!self_->upper_bound_->IsInclusive() && index_iterator_->value == self_->upper_bound_->value()) {
+      if (self_->upper_bound_->value() < entry.value ||
+          (!self_->upper_bound_->IsInclusive() && entry.value == self_->upper_bound_->value())) {
         index_iterator_ = self_->index_accessor_.end();
+        packed_iterator_ = self_->PackedEnd();
         break;
       }
     }
 
-    if (CurrentVersionHasLabelProperty(*index_iterator_->vertex, self_->label_, self_->property_,
-                                       index_iterator_->value, self_->transaction_, self_->view_)) {
-      current_vertex_ = index_iterator_->vertex;
+    // The filter reads the indexed property together with its own ones.
+    const bool matches =
+        self_->filter_ ? self_->filter_->MatchesIndexed(*entry.vertex, self_->transaction_, self_->view_, self_->label_,
+                                                        self_->property_, entry.value)
+                       : CurrentVersionHasLabelProperty(*entry.vertex, self_->label_, self_->property_, entry.value,
+                                                        self_->transaction_, self_->view_);
+    if (matches) {
+      current_vertex_ = entry.vertex;
       current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->transaction_, self_->indices_,
                                                 self_->constraints_, self_->config_.items);
       break;
@@ -223,23 +373,12 @@ const PropertyValue kSmallestList = PropertyValue(std::vector<PropertyValue>());
 const PropertyValue kSmallestMap = PropertyValue(std::map<std::string, PropertyValue>());
 const PropertyValue kSmallestTemporalData =
     PropertyValue(TemporalData{static_cast<TemporalType>(0), std::numeric_limits<int64_t>::min()});
+const PropertyValue kSmallestPoint =
+    PropertyValue(Point{static_cast<CoordinateReferenceSystem>(0), -std::numeric_limits<double>::infinity(),
+                        -std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity()});
 
-InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
-                                               PropertyId property,
-                                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
-                                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
-                                               Transaction *transaction, Indices *indices, Constraints *constraints,
-                                               const Config &config)
-    : index_accessor_(std::move(index_accessor)),
-      label_(label),
-      property_(property),
-      lower_bound_(lower_bound),
-      upper_bound_(upper_bound),
-      view_(view),
-      transaction_(transaction),
-      indices_(indices),
-      constraints_(constraints),
-      config_(config) {
+bool NormalizePropertyValueBounds(std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                  std::optional<utils::Bound<PropertyValue>> &upper_bound) {
   // We have to fix the bounds that the user provided to us. If the user
   // provided only one bound we should make sure that only values of that type
   // are returned by the iterator. We ensure this by supplying either an
@@ -255,104 +394,170 @@ InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor
   static_assert(PropertyValue::Type::List < PropertyValue::Type::Map);
 
   // Remove any bounds that are set to `Null` because that isn't a valid value.
-  if (lower_bound_ && lower_bound_->value().IsNull()) {
-    lower_bound_ = std::nullopt;
+  if (lower_bound && lower_bound->value().IsNull()) {
+    lower_bound = std::nullopt;
   }
-  if (upper_bound_ && upper_bound_->value().IsNull()) {
-    upper_bound_ = std::nullopt;
+  if (upper_bound && upper_bound->value().IsNull()) {
+    upper_bound = std::nullopt;
   }
 
   // Check whether the bounds are of comparable types if both are supplied.
-  if (lower_bound_ && upper_bound_ &&
-      !PropertyValue::AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
-    bounds_valid_ = false;
-    return;
+  if (lower_bound && upper_bound &&
+      !PropertyValue::AreComparableTypes(lower_bound->value().type(), upper_bound->value().type())) {
+    return false;
   }
 
   // Set missing bounds.
-  if (lower_bound_ && !upper_bound_) {
+  if (lower_bound && !upper_bound) {
     // Here we need to supply an upper bound. The upper bound is set to an
     // exclusive lower bound of the following type.
-    switch (lower_bound_->value().type()) {
+    switch (lower_bound->value().type()) {
       case PropertyValue::Type::Null:
         // This shouldn't happen because of the nullopt-ing above.
         LOG_FATAL("Invalid database state!");
         break;
       case PropertyValue::Type::Bool:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestNumber);
+        upper_bound = utils::MakeBoundExclusive(kSmallestNumber);
         break;
       case PropertyValue::Type::Int:
       case PropertyValue::Type::Double:
         // Both integers and doubles are treated as the same type in
         // `PropertyValue` and they are interleaved when sorted.
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestString);
+        upper_bound = utils::MakeBoundExclusive(kSmallestString);
         break;
       case PropertyValue::Type::String:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestList);
+        upper_bound = utils::MakeBoundExclusive(kSmallestList);
         break;
       case PropertyValue::Type::List:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestMap);
+        upper_bound = utils::MakeBoundExclusive(kSmallestMap);
         break;
       case PropertyValue::Type::Map:
-        upper_bound_ = utils::MakeBoundExclusive(kSmallestTemporalData);
+        upper_bound = utils::MakeBoundExclusive(kSmallestTemporalData);
         break;
       case PropertyValue::Type::TemporalData:
+        upper_bound = utils::MakeBoundExclusive(kSmallestPoint);
+        break;
+      case PropertyValue::Type::Point:
         // This is the last type in the order so we leave the upper bound empty.
         break;
     }
   }
-  if (upper_bound_ && !lower_bound_) {
+  if (upper_bound && !lower_bound) {
     // Here we need to supply a lower bound. The lower bound is set to an
     // inclusive lower bound of the current type.
-    switch (upper_bound_->value().type()) {
+    switch (upper_bound->value().type()) {
       case PropertyValue::Type::Null:
         // This shouldn't happen because of the nullopt-ing above.
         LOG_FATAL("Invalid database state!");
         break;
       case PropertyValue::Type::Bool:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestBool);
+        lower_bound = utils::MakeBoundInclusive(kSmallestBool);
         break;
       case PropertyValue::Type::Int:
       case PropertyValue::Type::Double:
         // Both integers and doubles are treated as the same type in
         // `PropertyValue` and they are interleaved when sorted.
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestNumber);
+        lower_bound = utils::MakeBoundInclusive(kSmallestNumber);
         break;
       case PropertyValue::Type::String:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestString);
+        lower_bound = utils::MakeBoundInclusive(kSmallestString);
         break;
       case PropertyValue::Type::List:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestList);
+        lower_bound = utils::MakeBoundInclusive(kSmallestList);
         break;
       case PropertyValue::Type::Map:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestMap);
+        lower_bound = utils::MakeBoundInclusive(kSmallestMap);
         break;
       case PropertyValue::Type::TemporalData:
-        lower_bound_ = utils::MakeBoundInclusive(kSmallestTemporalData);
+        lower_bound = utils::MakeBoundInclusive(kSmallestTemporalData);
+        break;
+      case PropertyValue::Type::Point:
+        lower_bound = utils::MakeBoundInclusive(kSmallestPoint);
         break;
     }
   }
+  return true;
+}
+
+InMemoryLabelPropertyIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                               std::shared_ptr<const PackedEntries> packed, LabelId label,
+                                               PropertyId property,
+                                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view,
+                                               Transaction *transaction, Indices *indices, Constraints *constraints,
+                                               const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      packed_(std::move(packed)),
+      label_(label),
+      property_(property),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  bounds_valid_ = NormalizePropertyValueBounds(lower_bound_, upper_bound_);
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::begin() {
   // If the bounds are set and don't have comparable types we don't yield any
   // items from the index.
-  if (!bounds_valid_) return {this, index_accessor_.end()};
+  if (!bounds_valid_) return {this, index_accessor_.end(), PackedEnd()};
   auto index_iterator = index_accessor_.begin();
+  auto packed_iterator = PackedBegin();
   if (lower_bound_) {
     index_iterator = index_accessor_.find_equal_or_greater(lower_bound_->value());
+    packed_iterator = std::lower_bound(packed_iterator, PackedEnd(), lower_bound_->value());
   }
-  return {this, index_iterator};
+  return {this, index_iterator, packed_iterator};
 }
 
 InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Iterable::end() {
-  return {this, index_accessor_.end()};
+  return {this, index_accessor_.end(), PackedEnd()};
+}
+
+InMemoryLabelPropertyIndex::PackedIterator InMemoryLabelPropertyIndex::Iterable::PackedBegin() const {
+  return packed_ ? packed_->entries.cbegin() : PackedIterator{};
+}
+
+InMemoryLabelPropertyIndex::PackedIterator InMemoryLabelPropertyIndex::Iterable::PackedEnd() const {
+  return packed_ ? packed_->entries.cend() : PackedIterator{};
+}
+
+std::shared_ptr<const InMemoryLabelPropertyIndex::PackedEntries> InMemoryLabelPropertyIndex::GetPacked(
+    LabelId label, PropertyId property) const {
+  if (auto it = packed_.find({label, property}); it != packed_.end()) {
+    return it->second.Get();
+  }
+  return nullptr;
+}
+
+uint64_t InMemoryLabelPropertyIndex::CountPackedEntries(const PackedEntries *packed,
+                                                        const std::optional<utils::Bound<PropertyValue>> &lower,
+                                                        const std::optional<utils::Bound<PropertyValue>> &upper) {
+  if (packed == nullptr) {
+    return 0;
+  }
+  auto value_less = [](const PropertyValue &value, const Entry &entry) { return value < entry.value; };
+  auto first = packed->entries.begin();
+  auto last = packed->entries.end();
+  if (lower) {
+    first = lower->IsInclusive() ? std::lower_bound(first, last, lower->value())
+                                 : std::upper_bound(first, last, lower->value(), value_less);
+  }
+  if (upper) {
+    last = upper->IsInclusive() ? std::upper_bound(first, last, upper->value(), value_less)
+                                : std::lower_bound(first, last, upper->value());
+  }
+  return first < last ? last - first : 0;
 }
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
-  return it->second.size();
+  const auto packed = GetPacked(label, property);
+  return it->second.size() + (packed ? packed->entries.size() : 0);
 }
 
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property,
@@ -360,9 +565,14 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, Prope
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
   auto acc = it->second.access();
+  const auto packed = GetPacked(label, property);
   if (!value.IsNull()) {
-    // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-    return acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+    return CountPackedEntries(packed.get(), utils::MakeBoundInclusive(value), utils::MakeBoundInclusive(value)) +
+           // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+           acc.estimate_count(value, utils::SkipListLayerForCountEstimation(acc.size()));
+  }
+  if (packed && packed->distinct_values_count > 0) {
+    return std::max<uint64_t>(1, packed->entries.size() / packed->distinct_values_count);
   }
   // The value `Null` won't ever appear in the index because it indicates that
   // the property shouldn't exist. Instead, this value is used as an indicator
@@ -380,8 +590,10 @@ uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
   auto acc = it->second.access();
-  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
-  return acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
+  const auto packed = GetPacked(label, property);
+  return CountPackedEntries(packed.get(), lower, upper) +
+         // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+         acc.estimate_range_count(lower, upper, utils::SkipListLayerForCountEstimation(acc.size()));
 }
 
 std::vector<std::pair<LabelId, PropertyId>> InMemoryLabelPropertyIndex::ClearIndexStats() {
@@ -432,8 +644,8 @@ InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
     Constraints *constraints) {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
-  return {it->second.access(), label,    property,    lower_bound, upper_bound, view,
-          transaction,         indices_, constraints, config_};
+  return {it->second.access(), GetPacked(label, property), label,       property, lower_bound, upper_bound,
+          view,                transaction,                indices_,    constraints, config_};
 }
 
 }  // namespace memgraph::storage
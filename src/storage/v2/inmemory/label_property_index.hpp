@@ -11,20 +11,29 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/indices/label_property_index.hpp"
+#include "storage/v2/indices/label_property_index_stats.hpp"
+#include "storage/v2/vertex_filter.hpp"
+#include "utils/spin_lock.hpp"
 
 namespace memgraph::storage {
 
-struct LabelPropertyIndexStats {
-  uint64_t count, distinct_values_count;
-  double statistic, avg_group_size, avg_degree;
-};
-
 /// TODO: andi. Too many copies, extract at one place
 using ParallelizedIndexCreationInfo =
     std::pair<std::vector<std::pair<Gid, uint64_t>> /*vertex_recovery_info*/, uint64_t /*thread_count*/>;
 
+/// Fixes the bounds of an index lookup so that only values of the same type as
+/// the supplied bound(s) are yielded. Bounds set to `Null` are removed. Returns
+/// false if both bounds are set but their types aren't comparable, in which
+/// case the lookup shouldn't yield anything.
+bool NormalizePropertyValueBounds(std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                  std::optional<utils::Bound<PropertyValue>> &upper_bound);
+
 class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
  private:
   struct Entry {
@@ -39,6 +48,34 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     bool operator==(const PropertyValue &rhs) const;
   };
 
+  /// Sorted array of the entries of an index. It is never modified after it's
+  /// built, the garbage collector builds a new one instead.
+  struct PackedEntries {
+    std::vector<Entry> entries;
+    // All entries of the skip list with a timestamp lower than this one are
+    // also in `entries`.
+    uint64_t packed_below_timestamp;
+    uint64_t distinct_values_count;
+  };
+
+  /// Packed part of an index. The index skip list holds only the entries which
+  /// weren't merged into the packed array yet.
+  struct PackedIndex {
+    std::shared_ptr<const PackedEntries> Get() const {
+      std::lock_guard<utils::SpinLock> guard(lock);
+      return current;
+    }
+
+    mutable utils::SpinLock lock;
+    std::shared_ptr<const PackedEntries> current;
+    // Arrays replaced by the garbage collector which can still be read by some
+    // iterator, the skip list entries they rely on aren't removed until all of
+    // them expire.
+    std::vector<std::weak_ptr<const PackedEntries>> retired;
+  };
+
+  using PackedIterator = std::vector<Entry>::const_iterator;
+
  public:
   InMemoryLabelPropertyIndex(Indices *indices, const Config &config);
 
@@ -63,38 +100,65 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
+  /// Appends one task per index to `tasks` which, when all of them are run, do
+  /// the same as `RemoveObsoleteEntries`. The tasks are independent of each
+  /// other and can be run concurrently while no index is created or dropped.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
   class Iterable {
    public:
-    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, PropertyId property,
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, std::shared_ptr<const PackedEntries> packed,
+             LabelId label, PropertyId property,
              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Transaction *transaction,
              Indices *indices, Constraints *constraints, const Config &config);
 
     class Iterator {
      public:
-      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator, PackedIterator packed_iterator);
 
       VertexAccessor const &operator*() const { return current_vertex_accessor_; }
 
-      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
-      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+      bool operator==(const Iterator &other) const {
+        return index_iterator_ == other.index_iterator_ && packed_iterator_ == other.packed_iterator_;
+      }
+      bool operator!=(const Iterator &other) const { return !(*this == other); }
 
       Iterator &operator++();
 
+      /// Value of the indexed property of the current vertex, which is the
+      /// value the vertex has in the view of the iteration.
+      const PropertyValue &CurrentValue() const { return CurrentEntry().value; }
+
      private:
+      /// Entries of the packed array and of the skip list are yielded merged in
+      /// the order of `Entry`, so the equal entries are next to each other.
+      bool IsCurrentPacked() const;
+      const Entry &CurrentEntry() const;
+      void AdvanceCurrent();
       void AdvanceUntilValid();
 
       Iterable *self_;
       utils::SkipList<Entry>::Iterator index_iterator_;
+      PackedIterator packed_iterator_;
       VertexAccessor current_vertex_accessor_;
       Vertex *current_vertex_;
     };
 
+    /// Skips the vertices which don't match the `filter`, which has to
+    /// outlive the iteration. It has to be set before calling `begin`.
+    void SetFilter(const VertexFilter *filter) { filter_ = filter; }
+
     Iterator begin();
     Iterator end();
 
    private:
+    PackedIterator PackedBegin() const;
+    PackedIterator PackedEnd() const;
+
     utils::SkipList<Entry>::Accessor index_accessor_;
+    std::shared_ptr<const PackedEntries> packed_;
     LabelId label_;
     PropertyId property_;
     std::optional<utils::Bound<PropertyValue>> lower_bound_;
@@ -105,6 +169,7 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     Indices *indices_;
     Constraints *constraints_;
     Config config_;
+    const VertexFilter *filter_{nullptr};
   };
 
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
@@ -136,7 +201,25 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
                     Constraints *constraints);
 
  private:
+  /// Loads all entries of the index skip list into a new packed array and
+  /// clears the skip list. Must be called while nothing else accesses the index.
+  void PackIndex(LabelId label, PropertyId property);
+
+  /// Merges the entries of finished transactions from the skip list into a new
+  /// packed array and drops the obsolete entries of the packed array.
+  static void MergePackedIndex(LabelId label, PropertyId property, utils::SkipList<Entry> &index,
+                               PackedIndex &packed, uint64_t oldest_active_start_timestamp, uint64_t merge_threshold);
+
+  std::shared_ptr<const PackedEntries> GetPacked(LabelId label, PropertyId property) const;
+
+  /// Returns the number of packed entries with values between the bounds.
+  static uint64_t CountPackedEntries(const PackedEntries *packed,
+                                     const std::optional<utils::Bound<PropertyValue>> &lower,
+                                     const std::optional<utils::Bound<PropertyValue>> &upper);
+
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  // Empty unless `Config::packed_index_merge_threshold` is set.
+  std::map<std::pair<LabelId, PropertyId>, PackedIndex> packed_;
   std::unordered_map<PropertyId, std::unordered_map<LabelId, utils::SkipList<Entry> *>> indices_by_property_;
   std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats> stats_;
 };
@@ -0,0 +1,288 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/point_index.hpp"
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+template <typename TIndexAccessor>
+void InsertPointEntry(const PropertyValue &value, Vertex *vertex, uint64_t timestamp, TIndexAccessor &index_accessor) {
+  if (!value.IsPoint()) {
+    return;
+  }
+  const auto &point = value.ValuePoint();
+  index_accessor.insert({PointIndexKey(point.x, point.y), vertex, timestamp});
+}
+
+template <typename TIndexAccessor>
+void TryInsertPointIndex(Vertex &vertex, std::pair<LabelId, PropertyId> label_property,
+                         TIndexAccessor &index_accessor) {
+  if (vertex.deleted || !utils::Contains(vertex.labels, label_property.first)) {
+    return;
+  }
+  InsertPointEntry(vertex.properties.GetProperty(label_property.second), &vertex, 0, index_accessor);
+}
+
+bool ValueHasKey(const PropertyValue &value, uint64_t key) {
+  return value.IsPoint() && PointIndexKey(value.ValuePoint().x, value.ValuePoint().y) == key;
+}
+
+/// Returns the keys of the corners of the bounding box of `region`, or an
+/// empty range if the box is empty.
+std::pair<uint64_t, uint64_t> RegionKeys(const PointRegion &region) {
+  const auto [min_x, min_y, max_x, max_y] = region.BoundingBox();
+  // Also handles NaN bounds.
+  if (!(min_x <= max_x && min_y <= max_y)) {
+    return {1, 0};
+  }
+  return {PointIndexKey(min_x, min_y), PointIndexKey(max_x, max_y)};
+}
+
+}  // namespace
+
+bool InMemoryPointIndex::Entry::operator<(const Entry &rhs) const {
+  return std::make_tuple(key, vertex, timestamp) < std::make_tuple(rhs.key, rhs.vertex, rhs.timestamp);
+}
+
+bool InMemoryPointIndex::Entry::operator==(const Entry &rhs) const {
+  return key == rhs.key && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool InMemoryPointIndex::Entry::operator<(uint64_t rhs) const { return key < rhs; }
+
+bool InMemoryPointIndex::Entry::operator==(uint64_t rhs) const { return key == rhs; }
+
+InMemoryPointIndex::InMemoryPointIndex(Indices *indices, const Config &config) : PointIndex(indices, config) {}
+
+bool InMemoryPointIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                                     const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  using IndexAccessor = decltype(it->second.access());
+  const auto insert = [](Vertex &vertex, std::pair<LabelId, PropertyId> key, IndexAccessor &index_accessor) {
+    TryInsertPointIndex(vertex, key, index_accessor);
+  };
+  const auto key = std::make_pair(label, property);
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, index_, key, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, index_, key, insert);
+  }
+  indices_by_property_[property].emplace_back(label, &it->second);
+  return true;
+}
+
+void InMemoryPointIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) {
+  for (auto &[label_property, storage] : index_) {
+    if (label_property.first != added_label) {
+      continue;
+    }
+    auto acc = storage.access();
+    InsertPointEntry(vertex_after_update->properties.GetProperty(label_property.second), vertex_after_update,
+                     tx.start_timestamp, acc);
+  }
+}
+
+void InMemoryPointIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                             const Transaction &tx) {
+  if (!value.IsPoint()) {
+    return;
+  }
+  auto it = indices_by_property_.find(property);
+  if (it == indices_by_property_.end()) {
+    return;
+  }
+  for (const auto &[label, storage] : it->second) {
+    if (!utils::Contains(vertex->labels, label)) {
+      continue;
+    }
+    auto acc = storage->access();
+    InsertPointEntry(value, vertex, tx.start_timestamp, acc);
+  }
+}
+
+bool InMemoryPointIndex::DropIndex(LabelId label, PropertyId property) {
+  if (auto it = indices_by_property_.find(property); it != indices_by_property_.end()) {
+    std::erase_if(it->second, [label](const auto &item) { return item.first == label; });
+    if (it->second.empty()) {
+      indices_by_property_.erase(it);
+    }
+  }
+  return index_.erase({label, property}) > 0;
+}
+
+bool InMemoryPointIndex::IndexExists(LabelId label, PropertyId property) const {
+  return index_.find({label, property}) != index_.end();
+}
+
+std::vector<std::pair<LabelId, PropertyId>> InMemoryPointIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryPointIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryPointIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                          std::vector<std::function<void()>> &tasks) {
+  for (auto &index_storage : index_) {
+    tasks.emplace_back([label_property = index_storage.first, &index = index_storage.second,
+                        oldest_active_start_timestamp] {
+      auto index_acc = index.access();
+      for (auto it = index_acc.begin(); it != index_acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
+
+        if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->key == next_it->key) ||
+            !AnyVersionHasLabelPropertyMatching(
+                *it->vertex, label_property.first, label_property.second,
+                [key = it->key](const PropertyValue &value) { return ValueHasKey(value, key); },
+                oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+        it = next_it;
+      }
+    });
+  }
+}
+
+InMemoryPointIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
+                                       PropertyId property, PointRegion region, View view, Transaction *transaction,
+                                       Indices *indices, Constraints *constraints, const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      property_(property),
+      region_(region),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {
+  std::tie(min_key_, max_key_) = RegionKeys(region_);
+}
+
+InMemoryPointIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_.items),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryPointIndex::Iterable::Iterator &InMemoryPointIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryPointIndex::Iterable::Iterator::AdvanceUntilValid() {
+  auto &index_accessor = self_->index_accessor_;
+  while (index_iterator_ != index_accessor.end()) {
+    const auto key = index_iterator_->key;
+    if (key > self_->max_key_) {
+      index_iterator_ = index_accessor.end();
+      break;
+    }
+    if (!PointIndexKeyInBox(key, self_->min_key_, self_->max_key_)) {
+      // Skip the keys on the Z-order curve which leave the box.
+      const auto next_key = PointIndexNextKeyInBox(key, self_->min_key_, self_->max_key_);
+      index_iterator_ = next_key ? index_accessor.find_equal_or_greater(*next_key) : index_accessor.end();
+      continue;
+    }
+    // A vertex has an entry for each of its indexed values, but only the entry
+    // with the key of the visible value yields it. Entries of the same key are
+    // ordered by vertex, so those entries are next to each other.
+    if (index_iterator_->vertex != current_vertex_) {
+      auto value = CurrentVersionLabelPropertyValue(*index_iterator_->vertex, self_->label_, self_->property_,
+                                                    self_->transaction_, self_->view_);
+      if (value && ValueHasKey(*value, key) && self_->region_.Contains(value->ValuePoint())) {
+        current_vertex_ = index_iterator_->vertex;
+        current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->transaction_, self_->indices_,
+                                                  self_->constraints_, self_->config_.items);
+        break;
+      }
+    }
+    ++index_iterator_;
+  }
+}
+
+InMemoryPointIndex::Iterable::Iterator InMemoryPointIndex::Iterable::begin() {
+  if (min_key_ > max_key_) {
+    return end();
+  }
+  return {this, index_accessor_.find_equal_or_greater(min_key_)};
+}
+
+InMemoryPointIndex::Iterable::Iterator InMemoryPointIndex::Iterable::end() { return {this, index_accessor_.end()}; }
+
+uint64_t InMemoryPointIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Point index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryPointIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                    const PointRegion &region) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Point index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  const auto [min_key, max_key] = RegionKeys(region);
+  if (min_key > max_key) {
+    return 0;
+  }
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_range_count(std::optional{utils::MakeBoundInclusive(min_key)},
+                                  std::optional{utils::MakeBoundInclusive(max_key)},
+                                  utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryPointIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryPointIndex::Iterable InMemoryPointIndex::Vertices(LabelId label, PropertyId property,
+                                                          const PointRegion &region, View view,
+                                                          Transaction *transaction, Constraints *constraints) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Point index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  return {it->second.access(), label, property, region, view, transaction, indices_, constraints, config_};
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,134 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryPointIndex : public storage::PointIndex {
+ private:
+  struct Entry {
+    uint64_t key;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    bool operator<(uint64_t rhs) const;
+    bool operator==(uint64_t rhs) const;
+  };
+
+ public:
+  InMemoryPointIndex(Indices *indices, const Config &config);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
+
+  void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) override {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           const Transaction &tx) override;
+
+  bool DropIndex(LabelId label, PropertyId property) override;
+
+  bool IndexExists(LabelId label, PropertyId property) const override;
+
+  std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, PropertyId property, PointRegion region,
+             View view, Transaction *transaction, Indices *indices, Constraints *constraints, const Config &config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    PropertyId property_;
+    PointRegion region_;
+    // Keys of the corners of the bounding box of the region. All entries with
+    // keys in the box are candidates, the actual values are checked against
+    // the region. The box is empty if `min_key_` is greater than `max_key_`.
+    uint64_t min_key_;
+    uint64_t max_key_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config config_;
+  };
+
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
+
+  /// Estimates the number of candidates a lookup of `region` has to check,
+  /// which is the number of entries with keys between the keys of the corners
+  /// of the bounding box of the region.
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PointRegion &region) const override;
+
+  void RunGC();
+
+  /// Yields the vertices whose value of the property is a point in `region`.
+  Iterable Vertices(LabelId label, PropertyId property, const PointRegion &region, View view,
+                    Transaction *transaction, Constraints *constraints);
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  std::unordered_map<PropertyId, std::vector<std::pair<LabelId, utils::SkipList<Entry> *>>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
@@ -12,13 +12,20 @@
 #include "storage/v2/inmemory/replication/replication_client.hpp"
 
 #include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/wal.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/on_scope_exit.hpp"
 
 namespace memgraph::storage {
 
 namespace {
 template <typename>
 [[maybe_unused]] inline constexpr bool always_false_v = false;
+
+// The number of vertices or edges sent in a single `StateBatchRpc`. The
+// replica keeps the whole request in memory while applying it.
+constexpr uint64_t kStateBatchObjects = 10000;
 }  // namespace
 
 // Handler for transfering the current WAL file whose data is
@@ -30,7 +37,7 @@ class CurrentWalHandler {
 
   void AppendSize(size_t size);
 
-  void AppendFileData(utils::InputFile *file);
+  void AppendFileData(utils::InputFile *file, size_t size);
 
   void AppendBufferData(const uint8_t *buffer, size_t buffer_size);
 
@@ -44,7 +51,7 @@ class CurrentWalHandler {
 
 ////// CurrentWalHandler //////
 CurrentWalHandler::CurrentWalHandler(ReplicationClient *self)
-    : self_(self), stream_(self_->rpc_client_.Stream<replication::CurrentWalRpc>()) {}
+    : self_(self), stream_(self_->stream_rpc_client_.Stream<replication::CurrentWalRpc>()) {}
 
 void CurrentWalHandler::AppendFilename(const std::string &filename) {
   replication::Encoder encoder(stream_.GetBuilder());
@@ -56,9 +63,9 @@ void CurrentWalHandler::AppendSize(const size_t size) {
   encoder.WriteUint(size);
 }
 
-void CurrentWalHandler::AppendFileData(utils::InputFile *file) {
+void CurrentWalHandler::AppendFileData(utils::InputFile *file, const size_t size) {
   replication::Encoder encoder(stream_.GetBuilder());
-  encoder.WriteFileData(file);
+  encoder.WriteFileData(file, size);
 }
 
 void CurrentWalHandler::AppendBufferData(const uint8_t *buffer, const size_t buffer_size) {
@@ -81,20 +88,16 @@ replication::WalFilesRes TransferWalFiles(rpc::Client &client, const std::vector
   return stream.AwaitResponse();
 }
 
-replication::SnapshotRes TransferSnapshot(rpc::Client &client, const std::filesystem::path &path) {
-  auto stream = client.Stream<replication::SnapshotRpc>();
-  replication::Encoder encoder(stream.GetBuilder());
-  encoder.WriteFile(path);
-  return stream.AwaitResponse();
-}
-
-uint64_t ReplicateCurrentWal(CurrentWalHandler &stream, durability::WalFile const &wal_file) {
+uint64_t ReplicateCurrentWal(CurrentWalHandler &stream, durability::WalFile &wal_file) {
   stream.AppendFilename(wal_file.Path().filename());
   utils::InputFile file;
   MG_ASSERT(file.Open(wal_file.Path()), "Failed to open current WAL file!");
   const auto [buffer, buffer_size] = wal_file.CurrentFileBuffer();
-  stream.AppendSize(file.GetSize() + buffer_size);
-  stream.AppendFileData(&file);
+  // With direct I/O the file ends with a padded copy of the start of the
+  // buffer, so only the data before it is sent from the file.
+  const auto written_size = wal_file.GetWrittenSize();
+  stream.AppendSize(written_size + buffer_size);
+  stream.AppendFileData(&file, written_size);
   stream.AppendBufferData(buffer, buffer_size);
   auto response = stream.Finalize();
   return response.current_commit_timestamp;
@@ -114,6 +117,7 @@ void InMemoryReplicationClient::RecoverReplica(uint64_t replica_commit) {
     auto file_locker = storage->file_retainer_.AddLocker();
 
     const auto steps = GetRecoverySteps(replica_commit, &file_locker);
+    StartRecovery(steps.size());
     int i = 0;
     for (const auto &recovery_step : steps) {
       spdlog::trace("Recovering in step: {}", i++);
@@ -121,13 +125,13 @@ void InMemoryReplicationClient::RecoverReplica(uint64_t replica_commit) {
         std::visit(
             [&, this]<typename T>(T &&arg) {
               using StepType = std::remove_cvref_t<T>;
-              if constexpr (std::is_same_v<StepType, RecoverySnapshot>) {
-                spdlog::debug("Sending the latest snapshot file: {}", arg);
-                auto response = TransferSnapshot(rpc_client_, arg);
-                replica_commit = response.current_commit_timestamp;
+              if constexpr (std::is_same_v<StepType, RecoveryState>) {
+                spdlog::debug("Sending the current state of the storage");
+                replica_commit = TransferState();
+                spdlog::debug("State successfully transferred.");
               } else if constexpr (std::is_same_v<StepType, RecoveryWals>) {
                 spdlog::debug("Sending the latest wal files");
-                auto response = TransferWalFiles(rpc_client_, arg);
+                auto response = TransferWalFiles(stream_rpc_client_, arg);
                 replica_commit = response.current_commit_timestamp;
                 spdlog::debug("Wal files successfully transferred.");
               } else if constexpr (std::is_same_v<StepType, RecoveryCurrentWal>) {
@@ -155,6 +159,7 @@ void InMemoryReplicationClient::RecoverReplica(uint64_t replica_commit) {
         HandleRpcFailure();
         return;
       }
+      FinishRecoveryStep(replica_commit);
     }
 
     spdlog::trace("Current timestamp on replica: {}", replica_commit);
@@ -189,15 +194,13 @@ void InMemoryReplicationClient::RecoverReplica(uint64_t replica_commit) {
 /// fetch the list of finalized WALs, we try to find the longest chain of
 /// sequential WALs, starting from the latest one, that will update the recovery
 /// with the all missed updates. If the WAL chain cannot be created, replica is
-/// behind by a lot, so we use the regular recovery process, we send the latest
-/// snapshot and all the necessary WAL files, starting from the newest WAL that
-/// contains a timestamp before the snapshot. If we registered the existence of
-/// the current WAL, we add the sequence number we read from it to the recovery
-/// process. After all the other steps are finished, if the current WAL contains
-/// the same sequence number, it's the same WAL we read while fetching the
-/// recovery steps, so we can safely send it to the replica.
-/// We assume that the property of preserving at least 1 WAL before the snapshot
-/// is satisfied as we extract the timestamp information from it.
+/// behind by a lot, so we stream the current state of the storage to it,
+/// without writing or sending a snapshot file, and find the steps from the
+/// new commit timestamp of the replica again. If we registered the existence
+/// of the current WAL, we add the sequence number we read from it to the
+/// recovery process. After all the other steps are finished, if the current WAL
+/// contains the same sequence number, it's the same WAL we read while fetching
+/// the recovery steps, so we can safely send it to the replica.
 std::vector<InMemoryReplicationClient::RecoveryStep> InMemoryReplicationClient::GetRecoverySteps(
     const uint64_t replica_commit, utils::FileRetainer::FileLocker *file_locker) {
   // First check if we can recover using the current wal file only
@@ -215,13 +218,6 @@ std::vector<InMemoryReplicationClient::RecoveryStep> InMemoryReplicationClient::
   auto wal_files = durability::GetWalFiles(storage->wal_directory_, storage->uuid_, current_wal_seq_num);
   MG_ASSERT(wal_files, "Wal files could not be loaded");
 
-  auto snapshot_files = durability::GetSnapshotFiles(storage->snapshot_directory_, storage->uuid_);
-  std::optional<durability::SnapshotDurabilityInfo> latest_snapshot;
-  if (!snapshot_files.empty()) {
-    std::sort(snapshot_files.begin(), snapshot_files.end());
-    latest_snapshot.emplace(std::move(snapshot_files.back()));
-  }
-
   std::vector<RecoveryStep> recovery_steps;
 
   // No finalized WAL files were found. This means the difference is contained
@@ -234,16 +230,15 @@ std::vector<InMemoryReplicationClient::RecoveryStep> InMemoryReplicationClient::
     }
 
     // Without the finalized WAL containing the current timestamp of replica,
-    // we cannot know if the difference is only in the current WAL or we need
-    // to send the snapshot.
-    if (latest_snapshot) {
-      const auto lock_success = locker_acc.AddPath(latest_snapshot->path);
-      MG_ASSERT(!lock_success.HasError(), "Tried to lock a nonexistant path.");
-      recovery_steps.emplace_back(std::in_place_type_t<RecoverySnapshot>{}, std::move(latest_snapshot->path));
+    // we cannot know if the difference is only in the current WAL. If a
+    // snapshot was made, the data before the current WAL is only in the
+    // snapshot, so we send the current state of the storage instead.
+    if (!durability::GetSnapshotFiles(storage->snapshot_directory_, storage->uuid_).empty()) {
+      recovery_steps.emplace_back(RecoveryState{});
+      return recovery_steps;
     }
-    // if there are no finalized WAL files, snapshot left the current WAL
-    // as the WAL file containing a transaction before snapshot creation
-    // so we can be sure that the current WAL is present
+    // if there are no finalized WAL files and no snapshots, the current WAL
+    // contains all of the data
     MG_ASSERT(current_wal_seq_num);
     recovery_steps.emplace_back(RecoveryCurrentWal{*current_wal_seq_num});
     return recovery_steps;
@@ -301,48 +296,146 @@ std::vector<InMemoryReplicationClient::RecoveryStep> InMemoryReplicationClient::
     previous_seq_num = rwal_it->seq_num;
   }
 
-  MG_ASSERT(latest_snapshot, "Invalid durability state, missing snapshot");
-  // We didn't manage to find a WAL chain, we need to send the latest snapshot
-  // with its WALs
-  const auto lock_success = locker_acc.AddPath(latest_snapshot->path);
-  MG_ASSERT(!lock_success.HasError(), "Tried to lock a nonexistant path.");
-  recovery_steps.emplace_back(std::in_place_type_t<RecoverySnapshot>{}, std::move(latest_snapshot->path));
-
-  std::vector<std::filesystem::path> recovery_wal_files;
-  auto wal_it = wal_files->begin();
-  for (; wal_it != wal_files->end(); ++wal_it) {
-    // Assuming recovery process is correct the snashpot should
-    // always retain a single WAL that contains a transaction
-    // before its creation
-    if (latest_snapshot->start_timestamp < wal_it->to_timestamp) {
-      if (latest_snapshot->start_timestamp < wal_it->from_timestamp) {
-        MG_ASSERT(wal_it != wal_files->begin(), "Invalid durability files state");
-        --wal_it;
+  // We didn't manage to find a WAL chain, so the replica receives the current
+  // state of the storage and the steps are found again afterwards.
+  recovery_steps.emplace_back(RecoveryState{});
+  return recovery_steps;
+}
+
+uint64_t InMemoryReplicationClient::TransferState() {
+  auto *storage = static_cast<InMemoryStorage *>(storage_);
+
+  // Index and constraint changes are excluded while the state is sent, as
+  // while a snapshot is created. In the analytical mode the transaction
+  // doesn't isolate the data from the other transactions, so they are
+  // excluded as well.
+  std::shared_lock<utils::ScalableRWLock> shared_storage_guard(storage->main_lock_);
+  std::unique_lock<utils::ScalableRWLock> unique_storage_guard;
+  if (storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
+    shared_storage_guard.unlock();
+    unique_storage_guard = std::unique_lock{storage->main_lock_};
+  }
+
+  uint64_t last_commit_timestamp = 0;
+  auto transaction =
+      storage->CreateTransaction(IsolationLevel::SNAPSHOT_ISOLATION, storage->storage_mode_, &last_commit_timestamp);
+  utils::OnScopeExit finish_transaction([&] { storage->commit_log_->MarkFinished(transaction.start_timestamp); });
+  const auto epoch_id = storage->replication_state_.GetEpoch().id;
+  auto *name_id_mapper = storage->name_id_mapper_.get();
+  const auto items = storage->config_.items;
+
+  // The replica commits all of the data with the commit timestamp of the last
+  // transaction seen here, so it continues from that transaction.
+  bool first = true;
+  auto stream_batch = [&](uint64_t transaction_count, bool last) {
+    auto stream = stream_rpc_client_.Stream<replication::StateBatchRpc>(first, last, storage->uuid_, epoch_id,
+                                                                        last_commit_timestamp, transaction_count);
+    first = false;
+    return stream;
+  };
+
+  // Vertices are sent before the edges, so the replica has the vertices of
+  // every edge it receives.
+  for (const bool send_edges : {false, true}) {
+    std::optional<rpc::Client::StreamHandler<replication::StateBatchRpc>> stream;
+    uint64_t batch_objects = 0;
+    auto finish_batch = [&] {
+      replication::Encoder encoder(stream->GetBuilder());
+      durability::EncodeTransactionEnd(&encoder, last_commit_timestamp);
+      stream->AwaitResponse();
+      stream.reset();
+      batch_objects = 0;
+    };
+
+    for (auto &vertex : storage->vertices_.access()) {
+      auto va = VertexAccessor::Create(&vertex, &transaction, &storage->indices_, &storage->constraints_, items,
+                                       View::OLD);
+      if (!va) continue;
+      if (!send_edges) {
+        auto maybe_labels = va->Labels(View::OLD);
+        MG_ASSERT(maybe_labels.HasValue(), "Invalid database state!");
+        auto maybe_props = va->Properties(View::OLD);
+        MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+        if (!stream) stream.emplace(stream_batch(1, false));
+        replication::Encoder encoder(stream->GetBuilder());
+        durability::EncodeVertex(&encoder, name_id_mapper, vertex.gid, *maybe_labels, *maybe_props,
+                                 last_commit_timestamp);
+        if (++batch_objects == kStateBatchObjects) finish_batch();
+        continue;
+      }
+      auto maybe_out_edges = va->OutEdges(View::OLD);
+      MG_ASSERT(maybe_out_edges.HasValue(), "Invalid database state!");
+      for (const auto &edge : maybe_out_edges->edges) {
+        std::map<PropertyId, PropertyValue> properties;
+        if (items.PropertiesOnEdges(edge.EdgeType())) {
+          auto maybe_props = edge.Properties(View::OLD);
+          MG_ASSERT(maybe_props.HasValue(), "Invalid database state!");
+          properties = std::move(*maybe_props);
+        }
+        if (!stream) stream.emplace(stream_batch(1, false));
+        replication::Encoder encoder(stream->GetBuilder());
+        durability::EncodeEdge(&encoder, name_id_mapper, edge.Gid(), edge.EdgeType(), vertex.gid, edge.ToVertex().Gid(),
+                               properties, last_commit_timestamp);
+        if (++batch_objects == kStateBatchObjects) finish_batch();
       }
-      break;
     }
+    if (stream) finish_batch();
   }
 
-  for (; wal_it != wal_files->end(); ++wal_it) {
-    const auto lock_success = locker_acc.AddPath(wal_it->path);
-    MG_ASSERT(!lock_success.HasError(), "Tried to lock a nonexistant path.");
-    recovery_wal_files.push_back(std::move(wal_it->path));
+  // The indices and constraints are created after the data is received, each
+  // of them is a separate operation.
+  std::vector<std::function<void(durability::BaseEncoder *)>> operations;
+  auto add_operation = [&](durability::StorageGlobalOperation operation, auto label_or_edge_type,
+                           std::vector<PropertyId> properties) {
+    operations.emplace_back([=](durability::BaseEncoder *encoder) {
+      durability::EncodeOperation(encoder, name_id_mapper, operation, label_or_edge_type, properties,
+                                  last_commit_timestamp);
+    });
+  };
+  using enum durability::StorageGlobalOperation;
+  const auto &indices = storage->indices_;
+  auto label = indices.label_index_->ListIndices();
+  label.insert(label.end(), indices.pending_recovery_.label.begin(), indices.pending_recovery_.label.end());
+  for (const auto &item : label) {
+    add_operation(LABEL_INDEX_CREATE, item, {});
   }
-
-  // We only have a WAL before the snapshot
-  if (recovery_wal_files.empty()) {
-    const auto lock_success = locker_acc.AddPath(wal_files->back().path);
-    MG_ASSERT(!lock_success.HasError(), "Tried to lock a nonexistant path.");
-    recovery_wal_files.push_back(std::move(wal_files->back().path));
+  auto label_property = indices.label_property_index_->ListIndices();
+  label_property.insert(label_property.end(), indices.pending_recovery_.label_property.begin(),
+                        indices.pending_recovery_.label_property.end());
+  for (const auto &[label, property] : label_property) {
+    add_operation(LABEL_PROPERTY_INDEX_CREATE, label, {property});
   }
-
-  recovery_steps.emplace_back(std::in_place_type_t<RecoveryWals>{}, std::move(recovery_wal_files));
-
-  if (current_wal_seq_num) {
-    recovery_steps.emplace_back(RecoveryCurrentWal{*current_wal_seq_num});
+  for (const auto &[label, properties] : indices.label_property_composite_index_->ListIndices()) {
+    add_operation(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, label, properties);
+  }
+  for (const auto &item : indices.edge_type_index_->ListIndices()) {
+    add_operation(EDGE_TYPE_INDEX_CREATE, item, {});
+  }
+  for (const auto &[edge_type, property] : indices.edge_type_property_index_->ListIndices()) {
+    add_operation(EDGE_TYPE_PROPERTY_INDEX_CREATE, edge_type, {property});
+  }
+  for (const auto &[label, property] : indices.text_index_->ListIndices()) {
+    add_operation(TEXT_INDEX_CREATE, label, {property});
+  }
+  for (const auto &[label, property] : indices.point_index_->ListIndices()) {
+    add_operation(POINT_INDEX_CREATE, label, {property});
+  }
+  for (const auto &[label, property] : indices.vector_index_->ListIndices()) {
+    add_operation(VECTOR_INDEX_CREATE, label, {property});
+  }
+  for (const auto &[label, property] : storage->constraints_.existence_constraints_->ListConstraints()) {
+    add_operation(EXISTENCE_CONSTRAINT_CREATE, label, {property});
+  }
+  for (const auto &[label, properties] : storage->constraints_.unique_constraints_->ListConstraints()) {
+    add_operation(UNIQUE_CONSTRAINT_CREATE, label, {properties.begin(), properties.end()});
   }
 
-  return recovery_steps;
+  auto stream = stream_batch(operations.size(), true);
+  replication::Encoder encoder(stream.GetBuilder());
+  for (const auto &operation : operations) {
+    operation(&encoder);
+  }
+  return stream.AwaitResponse().current_commit_timestamp;
 }
 
 }  // namespace memgraph::storage
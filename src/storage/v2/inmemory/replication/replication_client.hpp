@@ -25,14 +25,20 @@ class InMemoryReplicationClient : public ReplicationClient {
   void RecoverReplica(uint64_t replica_commit) override;
 
   // TODO: move the GetRecoverySteps stuff below as an internal detail
-  using RecoverySnapshot = std::filesystem::path;
   using RecoveryWals = std::vector<std::filesystem::path>;
   struct RecoveryCurrentWal {
     explicit RecoveryCurrentWal(const uint64_t current_wal_seq_num) : current_wal_seq_num(current_wal_seq_num) {}
     uint64_t current_wal_seq_num;
   };
-  using RecoveryStep = std::variant<RecoverySnapshot, RecoveryWals, RecoveryCurrentWal>;
+  struct RecoveryState {};
+  using RecoveryStep = std::variant<RecoveryWals, RecoveryCurrentWal, RecoveryState>;
   std::vector<RecoveryStep> GetRecoverySteps(uint64_t replica_commit, utils::FileRetainer::FileLocker *file_locker);
+
+  /// Sends the vertices, edges, indices and constraints seen by a new
+  /// transaction in batches of `StateBatchRpc`s, which replace the data of
+  /// the replica. Returns the commit timestamp of the replica afterwards.
+  /// @throw rpc::RpcFailedException
+  uint64_t TransferState();
 };
 
 }  // namespace memgraph::storage
@@ -13,11 +13,27 @@
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/version.hpp"
+#include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
+#include "storage/v2/inmemory/point_index.hpp"
+#include "storage/v2/inmemory/vector_index.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/inmemory/text_index.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace memgraph::storage {
 namespace {
+
+// The number of decoded transactions which may wait to be applied.
+constexpr size_t kMaxDecodedTransactions = 1024;
+
 std::pair<uint64_t, durability::WalDeltaData> ReadDelta(durability::BaseDecoder *decoder) {
   try {
     auto timestamp = ReadWalDeltaHeader(decoder);
@@ -60,6 +76,10 @@ InMemoryReplicationServer::InMemoryReplicationServer(InMemoryStorage *storage, m
     spdlog::debug("Received TimestampRpc");
     this->TimestampHandler(req_reader, res_builder);
   });
+  rpc_server_.Register<replication::StateBatchRpc>([this](auto *req_reader, auto *res_builder) {
+    spdlog::debug("Received StateBatchRpc");
+    this->StateBatchHandler(req_reader, res_builder);
+  });
 }
 
 void InMemoryReplicationServer::HeartbeatHandler(slk::Reader *req_reader, slk::Builder *res_builder) {
@@ -86,6 +106,7 @@ void InMemoryReplicationServer::AppendDeltasHandler(slk::Reader *req_reader, slk
   if (storage_->wal_file_) {
     if (req.seq_num > storage_->wal_file_->SequenceNumber() ||
         *maybe_epoch_id != storage_->replication_state_.GetEpoch().id) {
+      storage_->DrainWalGroupCommit();
       storage_->wal_file_->FinalizeWal();
       storage_->wal_file_.reset();
       storage_->wal_seq_num_ = req.seq_num;
@@ -100,11 +121,13 @@ void InMemoryReplicationServer::AppendDeltasHandler(slk::Reader *req_reader, slk
 
   if (req.previous_commit_timestamp != storage_->replication_state_.last_commit_timestamp_.load()) {
     // Empty the stream
-    bool transaction_complete = false;
-    while (!transaction_complete) {
-      SPDLOG_INFO("Skipping delta");
-      const auto [timestamp, delta] = ReadDelta(&decoder);
-      transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
+    for (uint64_t i = 0; i < req.transaction_count; ++i) {
+      bool transaction_complete = false;
+      while (!transaction_complete) {
+        SPDLOG_INFO("Skipping delta");
+        const auto [timestamp, delta] = ReadDelta(&decoder);
+        transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
+      }
     }
 
     replication::AppendDeltasRes res{false, storage_->replication_state_.last_commit_timestamp_.load()};
@@ -112,7 +135,11 @@ void InMemoryReplicationServer::AppendDeltasHandler(slk::Reader *req_reader, slk
     return;
   }
 
-  ReadAndApplyDelta(storage_, &decoder);
+  // The transactions are consecutive, so they are applied in the order in
+  // which they were committed on main and acknowledged together.
+  ReadAndApplyTransactions(storage_, &decoder, [&](uint64_t read_transactions, uint64_t /*read_deltas*/) {
+    return read_transactions < req.transaction_count;
+  });
 
   replication::AppendDeltasRes res{true, storage_->replication_state_.last_commit_timestamp_.load()};
   slk::Save(res, res_builder);
@@ -133,15 +160,7 @@ void InMemoryReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::Bu
 
   auto storage_guard = std::unique_lock{storage_->main_lock_};
   spdlog::trace("Clearing database since recovering from snapshot.");
-  // Clear the database
-  storage_->vertices_.clear();
-  storage_->edges_.clear();
-
-  storage_->constraints_.existence_constraints_ = std::make_unique<ExistenceConstraints>();
-  storage_->constraints_.unique_constraints_ = std::make_unique<InMemoryUniqueConstraints>();
-  storage_->indices_.label_index_ = std::make_unique<InMemoryLabelIndex>(&storage_->indices_, storage_->config_);
-  storage_->indices_.label_property_index_ =
-      std::make_unique<InMemoryLabelPropertyIndex>(&storage_->indices_, storage_->config_);
+  ClearStorage();
   try {
     spdlog::debug("Loading snapshot");
     auto &epoch =
@@ -158,11 +177,12 @@ void InMemoryReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::Bu
     const auto &recovery_info = recovered_snapshot.recovery_info;
     storage_->vertex_id_ = recovery_info.next_vertex_id;
     storage_->edge_id_ = recovery_info.next_edge_id;
-    storage_->timestamp_ = std::max(storage_->timestamp_, recovery_info.next_timestamp);
+    storage_->timestamp_ = std::max(storage_->timestamp_.load(), recovery_info.next_timestamp);
 
     spdlog::trace("Recovering indices and constraints from snapshot.");
     durability::RecoverIndicesAndConstraints(recovered_snapshot.indices_constraints, &storage_->indices_,
-                                             &storage_->constraints_, &storage_->vertices_);
+                                             &storage_->constraints_, &storage_->vertices_, storage_->config_.items);
+    storage_->RecountCardinalities();
   } catch (const durability::RecoveryFailure &e) {
     LOG_FATAL("Couldn't load the snapshot because of: {}", e.what());
   }
@@ -171,17 +191,84 @@ void InMemoryReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::Bu
   replication::SnapshotRes res{true, storage_->replication_state_.last_commit_timestamp_.load()};
   slk::Save(res, res_builder);
 
-  spdlog::trace("Deleting old snapshot files due to snapshot recovery.");
-  // Delete other durability files
+  DeleteDurabilityFiles(&*maybe_snapshot_path);
+  spdlog::debug("Replication recovery from snapshot finished!");
+}
+
+void InMemoryReplicationServer::StateBatchHandler(slk::Reader *req_reader, slk::Builder *res_builder) {
+  replication::StateBatchReq req;
+  slk::Load(&req, req_reader);
+
+  replication::Decoder decoder(req_reader);
+
+  if (req.first) {
+    // The data is replaced by the state of main, the following batches are
+    // applied while queries can run, as the data received from main usually
+    // is.
+    auto storage_guard = std::unique_lock{storage_->main_lock_};
+    spdlog::trace("Clearing database since recovering from the state of main.");
+    ClearStorage();
+    DeleteDurabilityFiles(nullptr);
+    storage_->uuid_ = req.uuid;
+    if (req.epoch_id != storage_->replication_state_.GetEpoch().id) {
+      storage_->replication_state_.AppendEpoch(req.epoch_id);
+    }
+  }
+
+  // All of the data is committed with the same commit timestamp, so none of it
+  // may be skipped as already applied.
+  if (req.transaction_count > 0) {
+    ReadAndApplyTransactions(
+        storage_, &decoder,
+        [&](uint64_t read_transactions, uint64_t /*read_deltas*/) { return read_transactions < req.transaction_count; },
+        /*skip_applied=*/false);
+  }
+
+  // The replica doesn't have the data of any commit of main until the last
+  // batch is applied, so it isn't reported as up to date if the transfer is
+  // interrupted.
+  if (req.last) {
+    storage_->replication_state_.last_commit_timestamp_ = req.last_commit_timestamp;
+    spdlog::debug("Replication recovery from the state of main finished!");
+  } else {
+    storage_->replication_state_.last_commit_timestamp_ = kTimestampInitialId;
+  }
+
+  replication::StateBatchRes res{true, storage_->replication_state_.last_commit_timestamp_.load()};
+  slk::Save(res, res_builder);
+}
+
+void InMemoryReplicationServer::ClearStorage() {
+  storage_->vertices_.clear();
+  storage_->edges_.clear();
+  storage_->RecountCardinalities();
+
+  storage_->constraints_.existence_constraints_ = std::make_unique<ExistenceConstraints>();
+  storage_->constraints_.unique_constraints_ = std::make_unique<InMemoryUniqueConstraints>();
+  storage_->indices_.label_index_ = std::make_unique<InMemoryLabelIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.label_property_index_ =
+      std::make_unique<InMemoryLabelPropertyIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.label_property_composite_index_ =
+      std::make_unique<InMemoryLabelPropertyCompositeIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.edge_type_index_ = std::make_unique<InMemoryEdgeTypeIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.edge_type_property_index_ =
+      std::make_unique<InMemoryEdgeTypePropertyIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.text_index_ = std::make_unique<InMemoryTextIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.point_index_ = std::make_unique<InMemoryPointIndex>(&storage_->indices_, storage_->config_);
+  storage_->indices_.vector_index_ = std::make_unique<InMemoryVectorIndex>(&storage_->indices_, storage_->config_);
+}
+
+void InMemoryReplicationServer::DeleteDurabilityFiles(const std::filesystem::path *kept_snapshot) {
+  spdlog::trace("Deleting old snapshot files due to recovery.");
   auto snapshot_files = durability::GetSnapshotFiles(storage_->snapshot_directory_, storage_->uuid_);
-  for (const auto &[path, uuid, _] : snapshot_files) {
-    if (path != *maybe_snapshot_path) {
-      spdlog::trace("Deleting snapshot file {}", path);
-      storage_->file_retainer_.DeleteFile(path);
+  for (const auto &snapshot_file : snapshot_files) {
+    if (!kept_snapshot || snapshot_file.path != *kept_snapshot) {
+      spdlog::trace("Deleting snapshot file {}", snapshot_file.path);
+      storage_->file_retainer_.DeleteFile(snapshot_file.path);
     }
   }
 
-  spdlog::trace("Deleting old WAL files due to snapshot recovery.");
+  spdlog::trace("Deleting old WAL files due to recovery.");
   auto wal_files = durability::GetWalFiles(storage_->wal_directory_, storage_->uuid_);
   if (wal_files) {
     for (const auto &wal_file : *wal_files) {
@@ -189,9 +276,9 @@ void InMemoryReplicationServer::SnapshotHandler(slk::Reader *req_reader, slk::Bu
       storage_->file_retainer_.DeleteFile(wal_file.path);
     }
 
+    storage_->DrainWalGroupCommit();
     storage_->wal_file_.reset();
   }
-  spdlog::debug("Replication recovery from snapshot finished!");
 }
 
 void InMemoryReplicationServer::WalFilesHandler(slk::Reader *req_reader, slk::Builder *res_builder) {
@@ -247,6 +334,7 @@ void InMemoryReplicationServer::LoadWal(InMemoryStorage *storage, replication::D
 
     if (storage->wal_file_) {
       if (storage->wal_file_->SequenceNumber() != wal_info.seq_num) {
+        storage->DrainWalGroupCommit();
         storage->wal_file_->FinalizeWal();
         storage->wal_seq_num_ = wal_info.seq_num;
         storage->wal_file_.reset();
@@ -263,8 +351,10 @@ void InMemoryReplicationServer::LoadWal(InMemoryStorage *storage, replication::D
     if (!durability::IsVersionSupported(*version)) throw durability::RecoveryFailure("Invalid WAL version!");
     wal.SetPosition(wal_info.offset_deltas);
 
-    for (size_t i = 0; i < wal_info.num_deltas;) {
-      i += ReadAndApplyDelta(storage, &wal);
+    if (wal_info.num_deltas > 0) {
+      ReadAndApplyTransactions(storage, &wal, [&](uint64_t /*read_transactions*/, uint64_t read_deltas) {
+        return read_deltas < wal_info.num_deltas;
+      });
     }
 
     spdlog::debug("Replication from current WAL successful!");
@@ -281,7 +371,96 @@ void InMemoryReplicationServer::TimestampHandler(slk::Reader *req_reader, slk::B
   slk::Save(res, res_builder);
 }
 
-uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage, durability::BaseDecoder *decoder) {
+InMemoryReplicationServer::DecodedTransaction InMemoryReplicationServer::ReadTransaction(
+    durability::BaseDecoder *decoder) {
+  DecodedTransaction transaction;
+  for (bool transaction_complete = false; !transaction_complete;) {
+    auto delta = ReadDelta(decoder);
+    transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.second.type);
+    transaction.push_back(std::move(delta));
+  }
+  return transaction;
+}
+
+uint64_t InMemoryReplicationServer::ReadAndApplyTransactions(
+    InMemoryStorage *storage, durability::BaseDecoder *decoder,
+    const std::function<bool(uint64_t read_transactions, uint64_t read_deltas)> &has_more, bool skip_applied) {
+  auto first_transaction = ReadTransaction(decoder);
+  if (!has_more(1, first_transaction.size())) {
+    return ApplyTransaction(storage, first_transaction, skip_applied);
+  }
+
+  // Decoding the deltas takes about as long as applying them, so the
+  // transactions are decoded on this thread while the ones before them are
+  // applied on another. Each transaction is committed with its own commit
+  // timestamp, so they are applied one at a time and in order.
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<DecodedTransaction> decoded;
+  decoded.push_back(std::move(first_transaction));
+  bool all_decoded = false;
+  std::exception_ptr error;
+  uint64_t applied_deltas = 0;
+
+  std::jthread applier([&] {
+    while (true) {
+      DecodedTransaction transaction;
+      {
+        std::unique_lock guard(mutex);
+        cv.wait(guard, [&] { return !decoded.empty() || all_decoded; });
+        if (decoded.empty()) return;
+        transaction = std::move(decoded.front());
+        decoded.pop_front();
+      }
+      cv.notify_all();
+      try {
+        applied_deltas += ApplyTransaction(storage, transaction, skip_applied);
+      } catch (...) {
+        {
+          std::unique_lock guard(mutex);
+          error = std::current_exception();
+        }
+        cv.notify_all();
+        return;
+      }
+    }
+  });
+
+  auto finish = [&] {
+    {
+      std::unique_lock guard(mutex);
+      all_decoded = true;
+    }
+    cv.notify_all();
+    applier.join();
+  };
+
+  try {
+    uint64_t read_transactions = 1;
+    uint64_t read_deltas = decoded.front().size();
+    while (has_more(read_transactions, read_deltas)) {
+      auto transaction = ReadTransaction(decoder);
+      ++read_transactions;
+      read_deltas += transaction.size();
+      std::unique_lock guard(mutex);
+      cv.wait(guard, [&] { return decoded.size() < kMaxDecodedTransactions || error; });
+      if (error) break;
+      decoded.push_back(std::move(transaction));
+      guard.unlock();
+      cv.notify_all();
+    }
+  } catch (...) {
+    finish();
+    throw;
+  }
+  finish();
+
+  if (error) std::rethrow_exception(error);
+  return applied_deltas;
+}
+
+uint64_t InMemoryReplicationServer::ApplyTransaction(InMemoryStorage *storage, const DecodedTransaction &transaction,
+                                                     bool skip_applied) {
   auto edge_acc = storage->edges_.access();
   auto vertex_acc = storage->vertices_.access();
 
@@ -301,15 +480,13 @@ uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage,
   uint64_t applied_deltas = 0;
   auto max_commit_timestamp = storage->replication_state_.last_commit_timestamp_.load();
 
-  for (bool transaction_complete = false; !transaction_complete; ++applied_deltas) {
-    const auto [timestamp, delta] = ReadDelta(decoder);
+  for (const auto &[timestamp, delta] : transaction) {
+    ++applied_deltas;
     if (timestamp > max_commit_timestamp) {
       max_commit_timestamp = timestamp;
     }
 
-    transaction_complete = durability::IsWalDeltaDataTypeTransactionEnd(delta.type);
-
-    if (timestamp < storage->timestamp_) {
+    if (skip_applied && timestamp < storage->timestamp_) {
       continue;
     }
 
@@ -397,7 +574,7 @@ uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage,
       case durability::WalDeltaData::Type::EDGE_SET_PROPERTY: {
         spdlog::trace("       Edge {} set property {} to {}", delta.vertex_edge_set_property.gid.AsUint(),
                       delta.vertex_edge_set_property.property, delta.vertex_edge_set_property.value);
-        if (!storage->config_.items.properties_on_edges)
+        if (!storage->config_.items.AnyPropertiesOnEdges())
           throw utils::BasicException(
               "Can't set properties on edges because properties on edges "
               "are disabled!");
@@ -447,7 +624,10 @@ uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage,
         // properties of the edge. The accessor is created with an invalid
         // type and invalid from/to pointers because we don't know them
         // here, but that isn't an issue because we won't use that part of
-        // the API here.
+        // the API here. Only the edges of the types with properties are
+        // stored as objects, so the properties are enabled for this one.
+        auto items = storage->config_.items;
+        items.properties_on_edges = true;
         auto ea = EdgeAccessor{edge_ref,
                                EdgeTypeId::FromUint(0UL),
                                nullptr,
@@ -455,7 +635,7 @@ uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage,
                                &transaction->GetTransaction(),
                                &storage->indices_,
                                &storage->constraints_,
-                               storage->config_.items};
+                               items};
 
         auto ret = ea.SetProperty(transaction->NameToProperty(delta.vertex_edge_set_property.property),
                                   delta.vertex_edge_set_property.value);
@@ -561,6 +741,138 @@ uint64_t InMemoryReplicationServer::ReadAndApplyDelta(InMemoryStorage *storage,
           throw utils::BasicException("Invalid transaction!");
         break;
       }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Create label+property composite index on :{} ({})",
+                      delta.operation_label_property_list.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.push_back(storage->NameToProperty(prop));
+        }
+        if (storage->CreateIndex(storage->NameToLabel(delta.operation_label_property_list.label), properties, timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        std::stringstream ss;
+        utils::PrintIterable(ss, delta.operation_label_property_list.properties);
+        spdlog::trace("       Drop label+property composite index on :{} ({})",
+                      delta.operation_label_property_list.label, ss.str());
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        std::vector<PropertyId> properties;
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          properties.push_back(storage->NameToProperty(prop));
+        }
+        if (storage->DropIndex(storage->NameToLabel(delta.operation_label_property_list.label), properties, timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE: {
+        spdlog::trace("       Create edge type index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage->CreateIndex(storage->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp).HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_INDEX_DROP: {
+        spdlog::trace("       Drop edge type index on :{}", delta.operation_edge_type.edge_type);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage->DropIndex(storage->NameToEdgeType(delta.operation_edge_type.edge_type), timestamp).HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE: {
+        spdlog::trace("       Create edge type+property index on :{} ({})",
+                      delta.operation_edge_type_property.edge_type, delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->CreateIndex(storage->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                              storage->NameToProperty(delta.operation_edge_type_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP: {
+        spdlog::trace("       Drop edge type+property index on :{} ({})", delta.operation_edge_type_property.edge_type,
+                      delta.operation_edge_type_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->DropIndex(storage->NameToEdgeType(delta.operation_edge_type_property.edge_type),
+                            storage->NameToProperty(delta.operation_edge_type_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::TEXT_INDEX_CREATE: {
+        spdlog::trace("       Create text index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->CreateTextIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                  storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::TEXT_INDEX_DROP: {
+        spdlog::trace("       Drop text index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->DropTextIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::POINT_INDEX_CREATE: {
+        spdlog::trace("       Create point index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->CreatePointIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                   storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::POINT_INDEX_DROP: {
+        spdlog::trace("       Drop point index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->DropPointIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                 storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::VECTOR_INDEX_CREATE: {
+        spdlog::trace("       Create vector index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->CreateVectorIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                    storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
+      case durability::WalDeltaData::Type::VECTOR_INDEX_DROP: {
+        spdlog::trace("       Drop vector index on :{} ({})", delta.operation_label_property.label,
+                      delta.operation_label_property.property);
+        if (commit_timestamp_and_accessor) throw utils::BasicException("Invalid transaction!");
+        if (storage
+                ->DropVectorIndex(storage->NameToLabel(delta.operation_label_property.label),
+                                  storage->NameToProperty(delta.operation_label_property.property), timestamp)
+                .HasError())
+          throw utils::BasicException("Invalid transaction!");
+        break;
+      }
     }
   }
 
@@ -11,6 +11,12 @@
 
 #pragma once
 
+#include <filesystem>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/durability/wal.hpp"
 #include "storage/v2/replication/replication_server.hpp"
 #include "storage/v2/replication/serialization.hpp"
 
@@ -37,9 +43,35 @@ class InMemoryReplicationServer : public ReplicationServer {
 
   void TimestampHandler(slk::Reader *req_reader, slk::Builder *res_builder);
 
+  void StateBatchHandler(slk::Reader *req_reader, slk::Builder *res_builder);
+
+  // Removes all of the data, indices and constraints. The main storage lock
+  // must be held exclusively.
+  void ClearStorage();
+
+  // Deletes the snapshot and WAL files, except `kept_snapshot`, and closes the
+  // current WAL file.
+  void DeleteDurabilityFiles(const std::filesystem::path *kept_snapshot);
+
   static void LoadWal(InMemoryStorage *storage, replication::Decoder *decoder);
 
-  static uint64_t ReadAndApplyDelta(InMemoryStorage *storage, durability::BaseDecoder *decoder);
+  // The deltas of a transaction with their commit timestamps.
+  using DecodedTransaction = std::vector<std::pair<uint64_t, durability::WalDeltaData>>;
+
+  static DecodedTransaction ReadTransaction(durability::BaseDecoder *decoder);
+
+  /// Deltas with timestamps before the current timestamp of the storage are
+  /// skipped as already applied if `skip_applied` is set.
+  static uint64_t ApplyTransaction(InMemoryStorage *storage, const DecodedTransaction &transaction,
+                                   bool skip_applied = true);
+
+  /// Reads transactions while `has_more` returns true and applies them in
+  /// order. Transactions after the first are decoded while the previous ones
+  /// are being applied. Returns the number of applied deltas.
+  static uint64_t ReadAndApplyTransactions(
+      InMemoryStorage *storage, durability::BaseDecoder *decoder,
+      const std::function<bool(uint64_t read_transactions, uint64_t read_deltas)> &has_more,
+      bool skip_applied = true);
 
   InMemoryStorage *storage_;
 };
@@ -10,8 +10,19 @@
 // licenses/APL.txt.
 
 #include "storage/v2/inmemory/storage.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <thread>
+
+#include "query/exceptions.hpp"
+#include "storage/v2/access_counters.hpp"
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/snapshot.hpp"
+#include "utils/algorithm.hpp"
+#include "utils/thread.hpp"
 
 /// REPLICATION ///
 #include "storage/v2/inmemory/replication/replication_client.hpp"
@@ -22,12 +33,27 @@ namespace memgraph::storage {
 
 using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
 
+namespace {
+
+// Removes an index from `Indices::pending_recovery_`, returns false if it
+// isn't there.
+template <typename TItem>
+bool ErasePendingIndex(std::vector<TItem> &pending, const TItem &item) {
+  auto it = std::find(pending.begin(), pending.end(), item);
+  if (it == pending.end()) return false;
+  pending.erase(it);
+  return true;
+}
+
+}  // namespace
+
 InMemoryStorage::InMemoryStorage(Config config)
     : Storage(config, StorageMode::IN_MEMORY_TRANSACTIONAL),
       snapshot_directory_(config.durability.storage_directory / durability::kSnapshotDirectory),
       lock_file_path_(config.durability.storage_directory / durability::kLockFile),
       wal_directory_(config.durability.storage_directory / durability::kWalDirectory),
       uuid_(utils::GenerateUUID()),
+      durability_write_throttle_(config.durability.snapshot_write_mebibytes_per_sec * 1024 * 1024),
       global_locker_(file_retainer_.AddLocker()) {
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
       config_.durability.snapshot_on_exit || config_.durability.recover_on_startup) {
@@ -54,6 +80,18 @@ InMemoryStorage::InMemoryStorage(Config config)
               "process!",
               config_.durability.storage_directory);
   }
+  for (const auto &name : config_.dictionary_encoded_properties) {
+    dictionary_encoded_properties_.insert(NameToProperty(name));
+  }
+  for (const auto &name : config_.properties_on_edge_types) {
+    edge_types_with_properties_.insert(NameToEdgeType(name));
+  }
+  // Accessors copy the items, so they must point to the set before any
+  // accessor, including the ones of the recovery, is created.
+  config_.items.edge_types_with_properties = &edge_types_with_properties_;
+  // Set if the recovery stopped at `config_.durability.recover_to_timestamp`
+  // and the storage continues from there, see `durability::RecoverData`.
+  bool continue_from_recovered_timestamp = false;
   if (config_.durability.recover_on_startup) {
     auto &epoch = replication_state_.GetEpoch();
     auto info = durability::RecoverData(snapshot_directory_, wal_directory_, &uuid_, &epoch.id,
@@ -62,10 +100,37 @@ InMemoryStorage::InMemoryStorage(Config config)
     if (info) {
       vertex_id_ = info->next_vertex_id;
       edge_id_ = info->next_edge_id;
-      timestamp_ = std::max(timestamp_, info->next_timestamp);
+      timestamp_ = std::max(timestamp_.load(), info->next_timestamp);
       if (info->last_commit_timestamp) {
         replication_state_.last_commit_timestamp_ = *info->last_commit_timestamp;
       }
+      if (config_.durability.recover_to_timestamp &&
+          config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
+        // The durability files of the recovered history may also hold later
+        // transactions, so the storage continues with a new history which
+        // starts with a snapshot.
+        continue_from_recovered_timestamp = true;
+        uuid_ = utils::GenerateUUID();
+        wal_seq_num_ = 0;
+        replication_state_.NewEpoch();
+      }
+      if (!dictionary_encoded_properties_.empty()) {
+        // The recovery sets the properties directly in the property stores, so
+        // the dictionary encoded values have to be encoded afterwards.
+        auto encode = [this](PropertyStore &store) {
+          auto properties = store.Properties();
+          store.ClearProperties();
+          store.InitProperties(properties, &dictionary_encoded_properties_);
+        };
+        for (auto &vertex : vertices_.access()) {
+          encode(vertex.properties);
+        }
+        if (config_.items.AnyPropertiesOnEdges()) {
+          for (auto &edge : edges_.access()) {
+            encode(edge.properties);
+          }
+        }
+      }
     }
   } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
              config_.durability.snapshot_on_exit) {
@@ -78,6 +143,8 @@ InMemoryStorage::InMemoryStorage(Config config)
       auto backup_curr = backup_root / dirname;
       std::error_code error_code;
       for (const auto &item : std::filesystem::directory_iterator(path, error_code)) {
+        // Preallocated WAL files don't hold any data, see `durability::WalFilePool`.
+        if (item.path().filename() == durability::kWalPreallocatedDirectory) continue;
         utils::EnsureDirOrDie(backup_root);
         utils::EnsureDirOrDie(backup_curr);
         std::error_code item_error_code;
@@ -96,6 +163,11 @@ InMemoryStorage::InMemoryStorage(Config config)
           "those files into a .backup directory inside the storage directory.");
     }
   }
+  RecountCardinalities();
+  if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED &&
+      config_.durability.snapshot_max_increments > 0) {
+    snapshot_change_tracker_.emplace();
+  }
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
     snapshot_runner_.Run("Snapshot", config_.durability.snapshot_interval, [this] {
       if (auto maybe_error = this->CreateSnapshot({true}); maybe_error.HasError()) {
@@ -115,14 +187,30 @@ InMemoryStorage::InMemoryStorage(Config config)
       }
     });
   }
+  if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+      config_.durability.wal_group_commit) {
+    wal_group_commit_.emplace();
+  }
+  if (config_.durability.snapshot_wal_mode == Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL &&
+      config_.durability.wal_preallocated_files > 0) {
+    wal_file_pool_.emplace(wal_directory_ / durability::kWalPreallocatedDirectory,
+                           config_.durability.wal_file_size_kibibytes * 1024,
+                           config_.durability.wal_preallocated_files);
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
-    gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->CollectGarbage<false>(); });
+    gc_runner_.Run("Storage GC", config_.gc.interval, [this] {
+      // A time sliced cycle that didn't unlink everything continues right
+      // away, but it releases the main lock between the slices.
+      do {
+        this->CollectGarbage<false>();
+      } while (gc_runner_.IsRunning() && gc_unlinking_pending_.exchange(false));
+    });
   }
 
   if (timestamp_ == kTimestampInitialId) {
     commit_log_.emplace();
   } else {
-    commit_log_.emplace(timestamp_);
+    commit_log_.emplace(timestamp_.load());
   }
 
   if (config_.durability.restore_replication_state_on_startup) {
@@ -145,9 +233,25 @@ InMemoryStorage::InMemoryStorage(Config config)
         "enabling durability by using --storage-snapshot-interval-sec and --storage-wal-enabled flags because "
         "without write-ahead logs this instance is not replicating any data.");
   }
+
+  if (continue_from_recovered_timestamp) {
+    if (auto maybe_error = CreateSnapshot({false}); maybe_error.HasError()) {
+      spdlog::warn("Couldn't create a snapshot of the data recovered to timestamp {}, it isn't durable yet.",
+                   *config_.durability.recover_to_timestamp);
+    }
+  }
+
+  if (!indices_.pending_recovery_.label.empty() || !indices_.pending_recovery_.label_property.empty()) {
+    index_recovery_thread_ =
+        std::jthread([this](const std::stop_token &stop_token) { CreatePendingIndices(stop_token); });
+  }
 }
 
 InMemoryStorage::~InMemoryStorage() {
+  if (index_recovery_thread_.joinable()) {
+    index_recovery_thread_.request_stop();
+    index_recovery_thread_.join();
+  }
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Stop();
   }
@@ -156,6 +260,7 @@ InMemoryStorage::~InMemoryStorage() {
     replication_state_.Reset();
   }
   if (wal_file_) {
+    DrainWalGroupCommit();
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
   }
@@ -187,7 +292,10 @@ InMemoryStorage::InMemoryAccessor::InMemoryAccessor(InMemoryStorage *storage, Is
                                                     StorageMode storage_mode)
     : Accessor(storage, isolation_level, storage_mode), config_(storage->config_.items) {}
 InMemoryStorage::InMemoryAccessor::InMemoryAccessor(InMemoryAccessor &&other) noexcept
-    : Accessor(std::move(other)), config_(other.config_) {}
+    : Accessor(std::move(other)),
+      config_(other.config_),
+      imported_edges_(std::move(other.imported_edges_)),
+      unique_constraint_deltas_(other.unique_constraint_deltas_) {}
 
 InMemoryStorage::InMemoryAccessor::~InMemoryAccessor() {
   if (is_transaction_active_) {
@@ -195,6 +303,15 @@ InMemoryStorage::InMemoryAccessor::~InMemoryAccessor() {
   }
 
   FinalizeTransaction();
+
+  // Analytical transactions can't be rolled back, so the imported edges are
+  // kept even if the transaction was aborted, same as all other changes.
+  if (!imported_edges_.empty()) {
+    auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+    mem_storage->imported_edges_.WithLock([&](auto &imported_edges) {
+      imported_edges.insert(imported_edges.end(), imported_edges_.begin(), imported_edges_.end());
+    });
+  }
 }
 
 VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertex() {
@@ -214,17 +331,65 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertex() {
   return {&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_};
 }
 
+std::vector<VertexAccessor> InMemoryStorage::InMemoryAccessor::CreateVertices(uint64_t count,
+                                                                              const std::vector<LabelId> &labels) {
+  if (transaction_.edge_import_mode_active && !labels.empty()) {
+    // Adding the labels throws.
+    return Storage::Accessor::CreateVertices(count, labels);
+  }
+  OOMExceptionEnabler oom_exception;
+  std::vector<LabelId> unique_labels;
+  for (const auto label : labels) {
+    if (!utils::Contains(unique_labels, label)) unique_labels.push_back(label);
+  }
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto first_gid = mem_storage->vertex_id_.fetch_add(count, std::memory_order_acq_rel);
+  auto acc = mem_storage->vertices_.access();
+
+  std::vector<VertexAccessor> vertices;
+  vertices.reserve(count);
+  std::vector<Vertex *> created;
+  created.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    auto *delta = CreateDeleteObjectDelta(&transaction_);
+    auto [it, inserted] = acc.insert(Vertex{storage::Gid::FromUint(first_gid + i), delta});
+    MG_ASSERT(inserted, "The vertex must be inserted here!");
+    MG_ASSERT(it != acc.end(), "Invalid Vertex accessor!");
+    auto *vertex = &*it;
+    if (delta) {
+      delta->prev.Set(vertex);
+    }
+    if (!unique_labels.empty()) {
+      auto guard = std::unique_lock{vertex->lock};
+      for (const auto label : unique_labels) {
+        CreateAndLinkDelta(&transaction_, vertex, Delta::RemoveLabelTag(), label);
+        vertex->labels.push_back(label);
+      }
+    }
+    created.push_back(vertex);
+    vertices.emplace_back(vertex, &transaction_, &storage_->indices_, &storage_->constraints_, config_);
+  }
+
+  for (const auto label : unique_labels) {
+    for (auto *vertex : created) {
+      storage_->constraints_.unique_constraints_->UpdateOnAddLabel(label, *vertex, transaction_.start_timestamp);
+      transaction_.manyDeltasCache.Invalidate(vertex, label);
+    }
+    storage_->indices_.UpdateOnAddLabel(label, created, transaction_);
+  }
+  return vertices;
+}
+
 VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertexEx(storage::Gid gid) {
   OOMExceptionEnabler oom_exception;
-  // NOTE: When we update the next `vertex_id_` here we perform a RMW
-  // (read-modify-write) operation that ISN'T atomic! But, that isn't an issue
-  // because this function is only called from the replication delta applier
-  // that runs single-threadedly and while this instance is set-up to apply
-  // threads (it is the replica), it is guaranteed that no other writes are
-  // possible.
+  // NOTE: The next `vertex_id_` is raised with a CAS loop because besides the
+  // replication delta applier, which runs single-threadedly, this function is
+  // also called by the CSV importer from several threads at once.
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
-  mem_storage->vertex_id_.store(std::max(mem_storage->vertex_id_.load(std::memory_order_acquire), gid.AsUint() + 1),
-                                std::memory_order_release);
+  auto vertex_id = mem_storage->vertex_id_.load(std::memory_order_acquire);
+  while (vertex_id <= gid.AsUint() &&
+         !mem_storage->vertex_id_.compare_exchange_weak(vertex_id, gid.AsUint() + 1, std::memory_order_acq_rel)) {
+  }
   auto acc = mem_storage->vertices_.access();
 
   auto *delta = CreateDeleteObjectDelta(&transaction_);
@@ -245,11 +410,89 @@ std::optional<VertexAccessor> InMemoryStorage::InMemoryAccessor::FindVertex(Gid
   return VertexAccessor::Create(&*it, &transaction_, &storage_->indices_, &storage_->constraints_, config_, view);
 }
 
+std::optional<uint64_t> InMemoryStorage::InMemoryAccessor::VertexCount(LabelId label) const {
+  // The counts hold only committed changes, seen by snapshot isolation.
+  if (transaction_.isolation_level != IsolationLevel::SNAPSHOT_ISOLATION || !transaction_.deltas.use().empty()) {
+    return std::nullopt;
+  }
+  return static_cast<InMemoryStorage *>(storage_)->cardinality_counts_.VertexCount(label, transaction_.start_timestamp);
+}
+
+bool InMemoryStorage::InMemoryAccessor::CanFindVertexByUniqueKey(LabelId label,
+                                                                 const std::set<PropertyId> &properties) const {
+  // Other transactions add their vertices to the constraints before they
+  // commit, and the vertices of this one are found through its deltas.
+  if (transaction_.storage_mode != StorageMode::IN_MEMORY_TRANSACTIONAL ||
+      transaction_.isolation_level == IsolationLevel::READ_UNCOMMITTED) {
+    return false;
+  }
+  return storage_->constraints_.unique_constraints_->ConstraintExists(label, properties);
+}
+
+Result<std::optional<VertexAccessor>> InMemoryStorage::InMemoryAccessor::FindVertexByUniqueKey(
+    LabelId label, const std::set<PropertyId> &properties, const std::vector<PropertyValue> &values) {
+  auto *mem_unique_constraints =
+      static_cast<InMemoryUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
+
+  // The vertices changed by the transaction since the last lookup are added to
+  // the constraints now, instead of when it commits. Only the newest delta of
+  // a vertex points to the vertex, and no other transaction can change it.
+  const auto &deltas = transaction_.deltas.use();
+  for (; unique_constraint_deltas_ < deltas.size(); ++unique_constraint_deltas_) {
+    auto prev = deltas[unique_constraint_deltas_].prev.Get();
+    if (prev.type != PreviousPtr::Type::VERTEX) continue;
+    mem_unique_constraints->UpdateBeforeCommit(prev.vertex, transaction_);
+  }
+
+  bool created_by_other = false;
+  for (const auto *candidate : mem_unique_constraints->GetVertices(label, properties, values)) {
+    // The constraints hold vertices which had the values in some version, so
+    // the version visible to the transaction has to be checked.
+    auto *vertex = const_cast<Vertex *>(candidate);
+    VertexAccessor vertex_acc{vertex, &transaction_, &storage_->indices_, &storage_->constraints_, config_};
+    auto has_label = vertex_acc.HasLabel(label, View::NEW);
+    bool visible = has_label.HasValue() && *has_label;
+    size_t i = 0;
+    for (auto property_it = properties.begin(); visible && property_it != properties.end(); ++property_it, ++i) {
+      auto value = vertex_acc.GetProperty(*property_it, View::NEW);
+      visible = value.HasValue() && *value == values[i];
+    }
+    if (visible) return std::make_optional(vertex_acc);
+
+    auto guard = std::shared_lock{vertex->lock};
+    if (vertex->deleted || !utils::Contains(vertex->labels, label)) continue;
+    i = 0;
+    bool has_values = true;
+    for (auto property_it = properties.begin(); has_values && property_it != properties.end(); ++property_it, ++i) {
+      has_values = vertex->properties.IsPropertyEqual(*property_it, values[i]);
+    }
+    // The newest version of the vertex isn't visible, so another transaction
+    // made it.
+    created_by_other = created_by_other || has_values;
+  }
+  if (created_by_other) return Error::SERIALIZATION_ERROR;
+  return std::optional<VertexAccessor>{};
+}
+
+std::optional<uint64_t> InMemoryStorage::InMemoryAccessor::EdgeCount(EdgeTypeId edge_type) const {
+  if (transaction_.isolation_level != IsolationLevel::SNAPSHOT_ISOLATION || !transaction_.deltas.use().empty()) {
+    return std::nullopt;
+  }
+  return static_cast<InMemoryStorage *>(storage_)->cardinality_counts_.EdgeCount(edge_type,
+                                                                                 transaction_.start_timestamp);
+}
+
 Result<std::optional<std::pair<std::vector<VertexAccessor>, std::vector<EdgeAccessor>>>>
 InMemoryStorage::InMemoryAccessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector<EdgeAccessor *> edges,
                                                 bool detach) {
   using ReturnType = std::pair<std::vector<VertexAccessor>, std::vector<EdgeAccessor>>;
 
+  if (transaction_.edge_import_mode_active) {
+    // The imported edges aren't linked to their vertices yet, so we couldn't
+    // detach them from the deleted objects.
+    throw query::WriteVertexOperationInEdgeImportModeException();
+  }
+
   auto maybe_result = Storage::Accessor::DetachDelete(nodes, edges, detach);
 
   if (maybe_result.HasError()) {
@@ -305,18 +548,29 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   auto *from_vertex = from->vertex_;
   auto *to_vertex = to->vertex_;
 
+  if (transaction_.edge_import_mode_active) {
+    return CreateImportedEdge(from_vertex, to_vertex, edge_type);
+  }
+
   // Obtain the locks by `gid` order to avoid lock cycles.
+  // NOTE: The locks are needed even when the vertices were created by this
+  // transaction. Such vertices are already in `vertices_`, and other
+  // transactions (scans, index iterators, snapshot creation) read their
+  // `delta` and `deleted` under a shared lock to check visibility, while we
+  // are about to prepend a new delta to their chain. No other transaction ever
+  // takes the unique lock of such a vertex, so the lock is never contended by
+  // writers.
   auto guard_from = std::unique_lock{from_vertex->lock, std::defer_lock};
   auto guard_to = std::unique_lock{to_vertex->lock, std::defer_lock};
   if (from_vertex->gid < to_vertex->gid) {
-    guard_from.lock();
-    guard_to.lock();
+    LockVertex(guard_from, *from_vertex);
+    LockVertex(guard_to, *to_vertex);
   } else if (from_vertex->gid > to_vertex->gid) {
-    guard_to.lock();
-    guard_from.lock();
+    LockVertex(guard_to, *to_vertex);
+    LockVertex(guard_from, *from_vertex);
   } else {
     // The vertices are the same vertex, only lock one.
-    guard_from.lock();
+    LockVertex(guard_from, *from_vertex);
   }
 
   if (!PrepareForWrite(&transaction_, from_vertex)) return Error::SERIALIZATION_ERROR;
@@ -330,7 +584,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
   auto gid = storage::Gid::FromUint(mem_storage->edge_id_.fetch_add(1, std::memory_order_acq_rel));
   EdgeRef edge(gid);
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     auto acc = mem_storage->edges_.access();
     auto *delta = CreateDeleteObjectDelta(&transaction_);
     auto [it, inserted] = acc.insert(Edge(gid, delta));
@@ -343,10 +597,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  AddVertexEdge(from_vertex->out_edges, {edge_type, to_vertex, edge});
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  AddVertexEdge(to_vertex->in_edges, {edge_type, from_vertex, edge});
+
+  storage_->indices_.UpdateOnEdgeCreation(from_vertex, to_vertex, edge, edge_type, transaction_);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -358,6 +614,33 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
                       &storage_->constraints_, config_);
 }
 
+Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateImportedEdge(Vertex *from_vertex, Vertex *to_vertex,
+                                                                           EdgeTypeId edge_type) {
+  // Vertices can't be deleted while the edge import mode is active, so it is
+  // enough to check that they weren't deleted before it was activated.
+  if (from_vertex->deleted || to_vertex->deleted) return Error::DELETED_OBJECT;
+
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto gid = storage::Gid::FromUint(mem_storage->edge_id_.fetch_add(1, std::memory_order_acq_rel));
+  EdgeRef edge(gid);
+  if (config_.PropertiesOnEdges(edge_type)) {
+    auto acc = mem_storage->edges_.access();
+    // There are no deltas in the analytical storage mode.
+    auto [it, inserted] = acc.insert(Edge(gid, nullptr));
+    MG_ASSERT(inserted, "The edge must be inserted here!");
+    MG_ASSERT(it != acc.end(), "Invalid Edge accessor!");
+    edge = EdgeRef(&*it);
+  }
+
+  imported_edges_.push_back({from_vertex, to_vertex, edge_type, edge});
+
+  // Increment edge count.
+  storage_->edge_count_.fetch_add(1, std::memory_order_acq_rel);
+
+  return EdgeAccessor(edge, edge_type, from_vertex, to_vertex, &transaction_, &storage_->indices_,
+                      &storage_->constraints_, config_);
+}
+
 Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAccessor *from, VertexAccessor *to,
                                                                      EdgeTypeId edge_type, storage::Gid gid) {
   OOMExceptionEnabler oom_exception;
@@ -375,14 +658,14 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   auto guard_from = std::unique_lock{from_vertex->lock, std::defer_lock};
   auto guard_to = std::unique_lock{to_vertex->lock, std::defer_lock};
   if (from_vertex->gid < to_vertex->gid) {
-    guard_from.lock();
-    guard_to.lock();
+    LockVertex(guard_from, *from_vertex);
+    LockVertex(guard_to, *to_vertex);
   } else if (from_vertex->gid > to_vertex->gid) {
-    guard_to.lock();
-    guard_from.lock();
+    LockVertex(guard_to, *to_vertex);
+    LockVertex(guard_from, *from_vertex);
   } else {
     // The vertices are the same vertex, only lock one.
-    guard_from.lock();
+    LockVertex(guard_from, *from_vertex);
   }
 
   if (!PrepareForWrite(&transaction_, from_vertex)) return Error::SERIALIZATION_ERROR;
@@ -404,7 +687,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
                               std::memory_order_release);
 
   EdgeRef edge(gid);
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     auto acc = mem_storage->edges_.access();
 
     auto *delta = CreateDeleteObjectDelta(&transaction_);
@@ -418,10 +701,12 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   }
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-  from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+  AddVertexEdge(from_vertex->out_edges, {edge_type, to_vertex, edge});
 
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-  to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+  AddVertexEdge(to_vertex->in_edges, {edge_type, from_vertex, edge});
+
+  storage_->indices_.UpdateOnEdgeCreation(from_vertex, to_vertex, edge, edge_type, transaction_);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -434,6 +719,9 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
 }
 
 Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor *edge, VertexAccessor *new_from) {
+  if (transaction_.edge_import_mode_active) {
+    throw query::WriteVertexOperationInEdgeImportModeException();
+  }
   MG_ASSERT(edge->transaction_ == new_from->transaction_,
             "EdgeAccessor must be from the same transaction as the new from vertex "
             "accessor when deleting an edge!");
@@ -451,7 +739,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
   auto edge_type = edge->edge_type_;
 
   std::unique_lock<utils::RWSpinLock> guard;
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     auto *edge_ptr = edge_ref.ptr;
     guard = std::unique_lock{edge_ptr->lock};
 
@@ -495,21 +783,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
-    if (config_.properties_on_edges) {
+    auto it = FindVertexEdge(*edges, link);
+    if (config_.PropertiesOnEdges(edge_type)) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    RemoveVertexEdge(*edges, it);
     return true;
   };
 
   auto op1 = delete_edge_from_storage(to_vertex, &old_from_vertex->out_edges);
   auto op2 = delete_edge_from_storage(old_from_vertex, &to_vertex->in_edges);
 
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
   } else {
     MG_ASSERT((op1 && op2) || (!op1 && !op2), "Invalid database state!");
@@ -523,9 +810,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::AddInEdgeTag(), edge_type, old_from_vertex, edge_ref);
 
   CreateAndLinkDelta(&transaction_, new_from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge_ref);
-  new_from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge_ref);
+  AddVertexEdge(new_from_vertex->out_edges, {edge_type, to_vertex, edge_ref});
   CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, new_from_vertex, edge_ref);
-  to_vertex->in_edges.emplace_back(edge_type, new_from_vertex, edge_ref);
+  AddVertexEdge(to_vertex->in_edges, {edge_type, new_from_vertex, edge_ref});
+
+  storage_->indices_.UpdateOnEdgeCreation(new_from_vertex, to_vertex, edge_ref, edge_type, transaction_);
 
   transaction_.manyDeltasCache.Invalidate(new_from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(old_from_vertex, edge_type, EdgeDirection::OUT);
@@ -536,6 +825,9 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
 }
 
 Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *edge, VertexAccessor *new_to) {
+  if (transaction_.edge_import_mode_active) {
+    throw query::WriteVertexOperationInEdgeImportModeException();
+  }
   MG_ASSERT(edge->transaction_ == new_to->transaction_,
             "EdgeAccessor must be from the same transaction as the new to vertex "
             "accessor when deleting an edge!");
@@ -553,7 +845,7 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
   auto &edge_type = edge->edge_type_;
 
   std::unique_lock<utils::RWSpinLock> guard;
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     auto *edge_ptr = edge_ref.ptr;
     guard = std::unique_lock{edge_ptr->lock};
 
@@ -597,21 +889,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
 
   auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
-    if (config_.properties_on_edges) {
+    auto it = FindVertexEdge(*edges, link);
+    if (config_.PropertiesOnEdges(edge_type)) {
       MG_ASSERT(it != edges->end(), "Invalid database state!");
     } else if (it == edges->end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    RemoveVertexEdge(*edges, it);
     return true;
   };
 
   auto op1 = delete_edge_from_storage(old_to_vertex, &from_vertex->out_edges);
   auto op2 = delete_edge_from_storage(from_vertex, &old_to_vertex->in_edges);
 
-  if (config_.properties_on_edges) {
+  if (config_.PropertiesOnEdges(edge_type)) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
   } else {
     MG_ASSERT((op1 && op2) || (!op1 && !op2), "Invalid database state!");
@@ -625,9 +916,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
   CreateAndLinkDelta(&transaction_, old_to_vertex, Delta::AddInEdgeTag(), edge_type, from_vertex, edge_ref);
 
   CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, new_to_vertex, edge_ref);
-  from_vertex->out_edges.emplace_back(edge_type, new_to_vertex, edge_ref);
+  AddVertexEdge(from_vertex->out_edges, {edge_type, new_to_vertex, edge_ref});
   CreateAndLinkDelta(&transaction_, new_to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge_ref);
-  new_to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge_ref);
+  AddVertexEdge(new_to_vertex->in_edges, {edge_type, from_vertex, edge_ref});
+
+  storage_->indices_.UpdateOnEdgeCreation(from_vertex, new_to_vertex, edge_ref, edge_type, transaction_);
 
   transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
   transaction_.manyDeltasCache.Invalidate(old_to_vertex, edge_type, EdgeDirection::IN);
@@ -669,6 +962,24 @@ utils::BasicResult<StorageDataManipulationError, void> InMemoryStorage::InMemory
       }
     }
 
+    // The objects still hold the values written by the transaction, as no one
+    // else can change them until it commits.
+    if (commit_changes_) {
+      *commit_changes_ = storage::CollectCommitChanges(transaction_, config_);
+    }
+
+    // The modified vertices are collected before the engine lock is taken,
+    // so only the unique constraints are updated and validated under it.
+    std::vector<const Vertex *> modified_vertices;
+    for (const auto &delta : transaction_.deltas.use()) {
+      auto prev = delta.prev.Get();
+      if (prev.type == PreviousPtr::Type::VERTEX) {
+        modified_vertices.push_back(prev.vertex);
+      }
+    }
+    std::sort(modified_vertices.begin(), modified_vertices.end());
+    modified_vertices.erase(std::unique(modified_vertices.begin(), modified_vertices.end()), modified_vertices.end());
+
     // Result of validating the vertex against unqiue constraints. It has to be
     // declared outside of the critical section scope because its value is
     // tested for Abort call which has to be done out of the scope.
@@ -677,42 +988,43 @@ utils::BasicResult<StorageDataManipulationError, void> InMemoryStorage::InMemory
     // Save these so we can mark them used in the commit log.
     uint64_t start_timestamp = transaction_.start_timestamp;
 
+    // Set if the transaction has to wait for a group commit of the WAL.
+    uint64_t wal_sync_ticket = 0;
+
     {
       std::unique_lock<utils::SpinLock> engine_guard(storage_->engine_lock_);
+      // Cleared before the engine lock is released, also when the commit fails.
+      utils::OnScopeExit clear_committing([&] {
+        if (engine_guard.owns_lock()) {
+          mem_storage->committing_timestamp_.store(kNoCommit, std::memory_order_seq_cst);
+        }
+      });
       auto *mem_unique_constraints =
           static_cast<InMemoryUniqueConstraints *>(storage_->constraints_.unique_constraints_.get());
+      // Marked as pending before the timestamp is allocated so that no
+      // transaction begins after the commit without seeing it.
+      mem_storage->committing_timestamp_.store(kCommitPending, std::memory_order_seq_cst);
       commit_timestamp_.emplace(mem_storage->CommitTimestamp(desired_commit_timestamp));
+      mem_storage->committing_timestamp_.store(*commit_timestamp_, std::memory_order_seq_cst);
 
-      // Before committing and validating vertices against unique constraints,
-      // we have to update unique constraints with the vertices that are going
-      // to be validated/committed.
-      for (const auto &delta : transaction_.deltas.use()) {
-        auto prev = delta.prev.Get();
-        MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-        if (prev.type != PreviousPtr::Type::VERTEX) {
-          continue;
-        }
-        mem_unique_constraints->UpdateBeforeCommit(prev.vertex, transaction_);
-      }
+      // Update the unique constraints with the vertices that are going to be
+      // committed and validate them, in sorted batches per constraint. No need
+      // to take any locks here because we modified these vertices and no one
+      // else can touch them until we commit.
+      unique_constraint_violation =
+          mem_unique_constraints->UpdateAndValidateBeforeCommit(modified_vertices, transaction_, *commit_timestamp_);
 
-      // Validate that unique constraints are satisfied for all modified
-      // vertices.
-      for (const auto &delta : transaction_.deltas.use()) {
-        auto prev = delta.prev.Get();
-        MG_ASSERT(prev.type != PreviousPtr::Type::NULLPTR, "Invalid pointer!");
-        if (prev.type != PreviousPtr::Type::VERTEX) {
-          continue;
+      if (!unique_constraint_violation) {
+        // The next incremental snapshot stores the modified objects if it
+        // starts after this commit, which the engine lock guarantees.
+        if (mem_storage->snapshot_change_tracker_) {
+          mem_storage->snapshot_change_tracker_->Record(transaction_, *commit_timestamp_);
         }
 
-        // No need to take any locks here because we modified this vertex and no
-        // one else can touch it until we commit.
-        unique_constraint_violation = mem_unique_constraints->Validate(*prev.vertex, transaction_, *commit_timestamp_);
-        if (unique_constraint_violation) {
-          break;
-        }
-      }
+        // The counts change before the transaction becomes visible, so every
+        // transaction which sees it also sees its counts.
+        mem_storage->cardinality_counts_.Commit(transaction_, *commit_timestamp_);
 
-      if (!unique_constraint_violation) {
         // Write transaction to WAL while holding the engine lock to make sure
         // that committed transactions are sorted by the commit timestamp in the
         // WAL files. We supply the new commit timestamp to the function so that
@@ -725,7 +1037,7 @@ utils::BasicResult<StorageDataManipulationError, void> InMemoryStorage::InMemory
         if (mem_storage->replication_state_.GetRole() == replication::ReplicationRole::MAIN ||
             desired_commit_timestamp.has_value()) {
           could_replicate_all_sync_replicas =
-              mem_storage->AppendToWalDataManipulation(transaction_, *commit_timestamp_);
+              mem_storage->AppendToWalDataManipulation(transaction_, *commit_timestamp_, &wal_sync_ticket);
         }
 
         // Take committed_transactions lock while holding the engine lock to
@@ -743,19 +1055,28 @@ utils::BasicResult<StorageDataManipulationError, void> InMemoryStorage::InMemory
             // Update the last commit timestamp
             mem_storage->replication_state_.last_commit_timestamp_.store(*commit_timestamp_);
           }
+          mem_storage->committing_timestamp_.store(kNoCommit, std::memory_order_seq_cst);
           // Release engine lock because we don't have to hold it anymore
           // and emplace back could take a long time.
           engine_guard.unlock();
         });
 
         mem_storage->commit_log_->MarkFinished(start_timestamp);
+
+        // With group commits the WAL writer thread syncs the deltas, which the
+        // transaction waits for only after it releases the engine lock.
+        if (wal_sync_ticket != 0) {
+          mem_storage->wal_group_commit_->Wait(wal_sync_ticket);
+        }
       }
     }
 
     if (unique_constraint_violation) {
+      commit_changes_.reset();
       Abort();
       return StorageDataManipulationError{*unique_constraint_violation};
     }
+    if (commit_changes_) commit_changes_->commit_timestamp = *commit_timestamp_;
   }
 
   is_transaction_active_ = false;
@@ -789,7 +1110,7 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
             case Delta::Action::REMOVE_LABEL: {
               auto it = std::find(vertex->labels.begin(), vertex->labels.end(), current->label);
               MG_ASSERT(it != vertex->labels.end(), "Invalid database state!");
-              std::swap(*it, *vertex->labels.rbegin());
+              *it = vertex->labels.back();
               vertex->labels.pop_back();
               break;
             }
@@ -800,23 +1121,24 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               break;
             }
             case Delta::Action::SET_PROPERTY: {
-              vertex->properties.SetProperty(current->property.key, current->property.value);
+              vertex->properties.SetProperty(current->property.key, current->property.value,
+                                             transaction_.dictionary_encoded_properties);
               break;
             }
             case Delta::Action::ADD_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+              auto it = FindVertexEdge(vertex->in_edges, link);
               MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
-              vertex->in_edges.push_back(link);
+              AddVertexEdge(vertex->in_edges, link);
               break;
             }
             case Delta::Action::ADD_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+              auto it = FindVertexEdge(vertex->out_edges, link);
               MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
-              vertex->out_edges.push_back(link);
+              AddVertexEdge(vertex->out_edges, link);
               // Increment edge count. We only increment the count here because
               // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
               // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -827,19 +1149,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
             case Delta::Action::REMOVE_IN_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+              auto it = FindVertexEdge(vertex->in_edges, link);
               MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->in_edges.rbegin());
-              vertex->in_edges.pop_back();
+              RemoveVertexEdge(vertex->in_edges, it);
               break;
             }
             case Delta::Action::REMOVE_OUT_EDGE: {
               std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                              current->vertex_edge.vertex, current->vertex_edge.edge};
-              auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+              auto it = FindVertexEdge(vertex->out_edges, link);
               MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-              std::swap(*it, *vertex->out_edges.rbegin());
-              vertex->out_edges.pop_back();
+              RemoveVertexEdge(vertex->out_edges, it);
               // Decrement edge count. We only decrement the count here because
               // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
               // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -875,7 +1195,8 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
                current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
           switch (current->action) {
             case Delta::Action::SET_PROPERTY: {
-              edge->properties.SetProperty(current->property.key, current->property.value);
+              edge->properties.SetProperty(current->property.key, current->property.value,
+                                           transaction_.dictionary_encoded_properties);
               break;
             }
             case Delta::Action::DELETE_DESERIALIZED_OBJECT:
@@ -949,9 +1270,14 @@ void InMemoryStorage::InMemoryAccessor::FinalizeTransaction() {
 
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateIndex(
     LabelId label, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  // An index which is still created after the recovery already exists.
+  const auto &pending = indices_.pending_recovery_.label;
+  if (std::find(pending.begin(), pending.end(), label) != pending.end()) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(indices_.label_index_.get());
-  if (!mem_label_index->CreateIndex(label, vertices_.access(), std::nullopt)) {
+  if (!mem_label_index->CreateIndex(label, vertices_.access(), GetParallelExecInfo())) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -972,9 +1298,13 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateInd
 
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateIndex(
     LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  const auto &pending = indices_.pending_recovery_.label_property;
+  if (std::find(pending.begin(), pending.end(), std::make_pair(label, property)) != pending.end()) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
   auto *mem_label_property_index = static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get());
-  if (!mem_label_property_index->CreateIndex(label, property, vertices_.access(), std::nullopt)) {
+  if (!mem_label_property_index->CreateIndex(label, property, vertices_.access(), GetParallelExecInfo())) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -995,8 +1325,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateInd
 
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex(
     LabelId label, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_index_->DropIndex(label)) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.label_index_->DropIndex(label) && !ErasePendingIndex(indices_.pending_recovery_.label, label)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -1017,10 +1347,13 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex
 
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex(
     LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!indices_.label_property_index_->DropIndex(label, property)) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_index_->DropIndex(label, property) &&
+      !ErasePendingIndex(indices_.pending_recovery_.label_property, std::make_pair(label, property))) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
+  std::erase_if(indices_.pending_recovery_.label_property_stats,
+                [&](const auto &item) { return item.first == std::make_pair(label, property); });
   // For a description why using `timestamp_` is correct, see
   // `CreateIndex(LabelId label)`.
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
@@ -1039,168 +1372,806 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex
   return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-utils::BasicResult<StorageExistenceConstraintDefinitionError, void> InMemoryStorage::CreateExistenceConstraint(
-    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-
-  if (constraints_.existence_constraints_->ConstraintExists(label, property)) {
-    return StorageExistenceConstraintDefinitionError{ConstraintDefinitionError{}};
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties, const std::optional<uint64_t> desired_commit_timestamp) {
+  MG_ASSERT(properties.size() > 1, "A composite index needs at least two properties!");
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_composite_index =
+      static_cast<InMemoryLabelPropertyCompositeIndex *>(indices_.label_property_composite_index_.get());
+  if (!mem_composite_index->CreateIndex(label, properties, vertices_.access(), GetParallelExecInfo())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+                                           label, properties, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
 
-  if (auto violation = ExistenceConstraints::ValidateVerticesOnConstraint(vertices_.access(), label, property);
-      violation.has_value()) {
-    return StorageExistenceConstraintDefinitionError{violation.value()};
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveLabelPropertyCompositeIndices);
+
+  if (success) {
+    return {};
   }
 
-  constraints_.existence_constraints_->InsertConstraint(label, property);
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex(
+    LabelId label, const std::vector<PropertyId> &properties, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.label_property_composite_index_->DropIndex(label, properties)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE, label,
-                                           {property}, commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
+                                           label, properties, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   replication_state_.last_commit_timestamp_ = commit_timestamp;
 
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveLabelPropertyCompositeIndices);
+
   if (success) {
     return {};
   }
 
-  return StorageExistenceConstraintDefinitionError{ReplicationError{}};
+  return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-utils::BasicResult<StorageExistenceConstraintDroppingError, void> InMemoryStorage::DropExistenceConstraint(
-    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  if (!constraints_.existence_constraints_->DropConstraint(label, property)) {
-    return StorageExistenceConstraintDroppingError{ConstraintDefinitionError{}};
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateIndex(
+    EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get());
+  if (!mem_edge_type_index->CreateIndex(edge_type, vertices_.access(), GetParallelExecInfo())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP, label,
-                                           {property}, commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE, edge_type,
+                                           {}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   replication_state_.last_commit_timestamp_ = commit_timestamp;
 
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveEdgeTypeIndices);
+
   if (success) {
     return {};
   }
 
-  return StorageExistenceConstraintDroppingError{ReplicationError{}};
+  return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-utils::BasicResult<StorageUniqueConstraintDefinitionError, UniqueConstraints::CreationStatus>
-InMemoryStorage::CreateUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
-                                        const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
-  auto ret = mem_unique_constraints->CreateConstraint(label, properties, vertices_.access());
-  if (ret.HasError()) {
-    return StorageUniqueConstraintDefinitionError{ret.GetError()};
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateIndex(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!config_.items.PropertiesOnEdges(edge_type)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
-  if (ret.GetValue() != UniqueConstraints::CreationStatus::SUCCESS) {
-    return ret.GetValue();
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get());
+  if (!mem_edge_type_property_index->CreateIndex(edge_type, property, vertices_.access(), GetParallelExecInfo())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label,
-                                           properties, commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE,
+                                           edge_type, {property}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   replication_state_.last_commit_timestamp_ = commit_timestamp;
 
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveEdgeTypePropertyIndices);
+
   if (success) {
-    return UniqueConstraints::CreationStatus::SUCCESS;
+    return {};
   }
 
-  return StorageUniqueConstraintDefinitionError{ReplicationError{}};
+  return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-utils::BasicResult<StorageUniqueConstraintDroppingError, UniqueConstraints::DeletionStatus>
-InMemoryStorage::DropUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
-                                      const std::optional<uint64_t> desired_commit_timestamp) {
-  std::unique_lock<utils::RWLock> storage_guard(main_lock_);
-  auto ret = constraints_.unique_constraints_->DropConstraint(label, properties);
-  if (ret != UniqueConstraints::DeletionStatus::SUCCESS) {
-    return ret;
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex(
+    EdgeTypeId edge_type, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_index_->DropIndex(edge_type)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
-  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label,
-                                           properties, commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP, edge_type,
+                                           {}, commit_timestamp);
   commit_log_->MarkFinished(commit_timestamp);
   replication_state_.last_commit_timestamp_ = commit_timestamp;
 
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveEdgeTypeIndices);
+
   if (success) {
-    return UniqueConstraints::DeletionStatus::SUCCESS;
+    return {};
   }
 
-  return StorageUniqueConstraintDroppingError{ReplicationError{}};
+  return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View view) {
-  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
-  return VerticesIterable(mem_label_index->Vertices(label, view, &transaction_, &storage_->constraints_));
-}
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropIndex(
+    EdgeTypeId edge_type, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.edge_type_property_index_->DropIndex(edge_type, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP, edge_type,
+                                           {property}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
 
-VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property, View view) {
-  auto *mem_label_property_index =
-      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
-  return VerticesIterable(mem_label_property_index->Vertices(label, property, std::nullopt, std::nullopt, view,
-                                                             &transaction_, &storage_->constraints_));
-}
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveEdgeTypePropertyIndices);
 
-VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property,
-                                                             const PropertyValue &value, View view) {
-  auto *mem_label_property_index =
-      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
-  return VerticesIterable(mem_label_property_index->Vertices(label, property, utils::MakeBoundInclusive(value),
-                                                             utils::MakeBoundInclusive(value), view, &transaction_,
-                                                             &storage_->constraints_));
-}
+  if (success) {
+    return {};
+  }
 
-VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
-    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
-    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
-  auto *mem_label_property_index =
-      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
-  return VerticesIterable(mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view,
-                                                             &transaction_, &storage_->constraints_));
+  return StorageIndexDefinitionError{ReplicationError{}};
 }
 
-Transaction InMemoryStorage::CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode) {
-  // We acquire the transaction engine lock here because we access (and
-  // modify) the transaction engine variables (`transaction_id` and
-  // `timestamp`) below.
-  uint64_t transaction_id = 0;
-  uint64_t start_timestamp = 0;
-  {
-    std::lock_guard<utils::SpinLock> guard(engine_lock_);
-    transaction_id = transaction_id_++;
-    // Replica should have only read queries and the write queries
-    // can come from main instance with any past timestamp.
-    // To preserve snapshot isolation we set the start timestamp
-    // of any query on replica to the last commited transaction
-    // which is timestamp_ as only commit of transaction with writes
-    // can change the value of it.
-    if (replication_state_.GetRole() == replication::ReplicationRole::REPLICA) {
-      start_timestamp = timestamp_;
-    } else {
-      start_timestamp = timestamp_++;
-    }
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateTextIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_text_index = static_cast<InMemoryTextIndex *>(indices_.text_index_.get());
+  if (!mem_text_index->CreateIndex(label, property, vertices_.access(), GetParallelExecInfo())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
-  return {transaction_id, start_timestamp, isolation_level, storage_mode, false};
-}
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::TEXT_INDEX_CREATE, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
 
-template <bool force>
-void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard) {
-  // NOTE: You do not need to consider cleanup of deleted object that occurred in
-  // different storage modes within the same CollectGarbage call. This is because
-  // SetStorageMode will ensure CollectGarbage is called before any new transactions
-  // with the new storage mode can start.
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveTextIndices);
 
-  // SetStorageMode will pass its unique_lock of main_lock_. We will use that lock,
-  // as reacquiring the lock would cause  deadlock. Otherwise, we need to get our own
-  // lock.
-  if (!main_guard.owns_lock()) {
-    if constexpr (force) {
-      // We take the unique lock on the main storage lock, so we can forcefully clean
-      // everything we can
-      if (!main_lock_.try_lock()) {
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropTextIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.text_index_->DropIndex(label, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::TEXT_INDEX_DROP, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveTextIndices);
+
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreatePointIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_point_index = static_cast<InMemoryPointIndex *>(indices_.point_index_.get());
+  if (!mem_point_index->CreateIndex(label, property, vertices_.access(), GetParallelExecInfo())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::POINT_INDEX_CREATE, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActivePointIndices);
+
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropPointIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.point_index_->DropIndex(label, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::POINT_INDEX_DROP, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActivePointIndices);
+
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::CreateVectorIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_vector_index = static_cast<InMemoryVectorIndex *>(indices_.vector_index_.get());
+  if (!mem_vector_index->CreateIndex(label, property, vertices_.access())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::VECTOR_INDEX_CREATE, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveVectorIndices);
+
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::DropVectorIndex(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!indices_.vector_index_->DropIndex(label, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::VECTOR_INDEX_DROP, label, {property},
+                                           commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveVectorIndices);
+
+  if (success) {
+    return {};
+  }
+
+  return StorageIndexDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageExistenceConstraintDefinitionError, void> InMemoryStorage::CreateExistenceConstraint(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+
+  if (constraints_.existence_constraints_->ConstraintExists(label, property)) {
+    return StorageExistenceConstraintDefinitionError{ConstraintDefinitionError{}};
+  }
+
+  if (auto violation = ExistenceConstraints::ValidateVerticesOnConstraint(vertices_.access(), label, property);
+      violation.has_value()) {
+    return StorageExistenceConstraintDefinitionError{violation.value()};
+  }
+
+  constraints_.existence_constraints_->InsertConstraint(label, property);
+
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_CREATE, label,
+                                           {property}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  if (success) {
+    return {};
+  }
+
+  return StorageExistenceConstraintDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageExistenceConstraintDroppingError, void> InMemoryStorage::DropExistenceConstraint(
+    LabelId label, PropertyId property, const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  if (!constraints_.existence_constraints_->DropConstraint(label, property)) {
+    return StorageExistenceConstraintDroppingError{ConstraintDefinitionError{}};
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::EXISTENCE_CONSTRAINT_DROP, label,
+                                           {property}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  if (success) {
+    return {};
+  }
+
+  return StorageExistenceConstraintDroppingError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageUniqueConstraintDefinitionError, UniqueConstraints::CreationStatus>
+InMemoryStorage::CreateUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
+                                        const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
+  auto ret = mem_unique_constraints->CreateConstraint(label, properties, vertices_.access());
+  if (ret.HasError()) {
+    return StorageUniqueConstraintDefinitionError{ret.GetError()};
+  }
+  if (ret.GetValue() != UniqueConstraints::CreationStatus::SUCCESS) {
+    return ret.GetValue();
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE, label,
+                                           {properties.begin(), properties.end()}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  if (success) {
+    return UniqueConstraints::CreationStatus::SUCCESS;
+  }
+
+  return StorageUniqueConstraintDefinitionError{ReplicationError{}};
+}
+
+utils::BasicResult<StorageUniqueConstraintDroppingError, UniqueConstraints::DeletionStatus>
+InMemoryStorage::DropUniqueConstraint(LabelId label, const std::set<PropertyId> &properties,
+                                      const std::optional<uint64_t> desired_commit_timestamp) {
+  std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+  auto ret = constraints_.unique_constraints_->DropConstraint(label, properties);
+  if (ret != UniqueConstraints::DeletionStatus::SUCCESS) {
+    return ret;
+  }
+  const auto commit_timestamp = CommitTimestamp(desired_commit_timestamp);
+  auto success = AppendToWalDataDefinition(durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP, label,
+                                           {properties.begin(), properties.end()}, commit_timestamp);
+  commit_log_->MarkFinished(commit_timestamp);
+  replication_state_.last_commit_timestamp_ = commit_timestamp;
+
+  if (success) {
+    return UniqueConstraints::DeletionStatus::SUCCESS;
+  }
+
+  return StorageUniqueConstraintDroppingError{ReplicationError{}};
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, View view) {
+  ++access_counters.index_seeks;
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  return VerticesIterable(mem_label_index->Vertices(label, view, &transaction_, &storage_->constraints_));
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(View view, uint64_t num_chunks) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto accessor = mem_storage->vertices_.access();
+  auto split_points = accessor.split(num_chunks);
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(split_points.size() + 1);
+  auto chunk_begin = accessor.begin();
+  for (size_t i = 0; i <= split_points.size(); ++i) {
+    auto chunk_end = i < split_points.size() ? std::make_optional(split_points[i]->gid) : std::nullopt;
+    chunks.emplace_back(AllVerticesIterable(mem_storage->vertices_.access(), chunk_begin, chunk_end, &transaction_,
+                                            view, &mem_storage->indices_, &mem_storage->constraints_,
+                                            mem_storage->config_.items));
+    if (i < split_points.size()) chunk_begin = split_points[i];
+  }
+  return chunks;
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(LabelId label, View view,
+                                                                                 uint64_t num_chunks) {
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  auto label_chunks = mem_label_index->ChunkedVertices(label, view, num_chunks, &transaction_, &storage_->constraints_);
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(label_chunks.size());
+  for (auto &label_chunk : label_chunks) {
+    chunks.emplace_back(std::move(label_chunk));
+  }
+  return chunks;
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property, View view) {
+  ++access_counters.index_seeks;
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  return VerticesIterable(mem_label_property_index->Vertices(label, property, std::nullopt, std::nullopt, view,
+                                                             &transaction_, &storage_->constraints_));
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property,
+                                                             const PropertyValue &value, View view) {
+  ++access_counters.index_seeks;
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  return VerticesIterable(mem_label_property_index->Vertices(label, property, utils::MakeBoundInclusive(value),
+                                                             utils::MakeBoundInclusive(value), view, &transaction_,
+                                                             &storage_->constraints_));
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  ++access_counters.index_seeks;
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  return VerticesIterable(mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view,
+                                                             &transaction_, &storage_->constraints_));
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, const std::vector<PropertyValue> &prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  ++access_counters.index_seeks;
+  return VerticesIterable(GetCompositeIndex()->Vertices(label, properties, prefix, lower_bound, upper_bound, view,
+                                                        &transaction_, &storage_->constraints_));
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property, TextMatch match,
+                                                             const std::string &pattern, View view) {
+  ++access_counters.index_seeks;
+  return VerticesIterable(
+      GetTextIndex()->Vertices(label, property, match, pattern, view, &transaction_, &storage_->constraints_));
+}
+
+std::vector<std::pair<VertexAccessor, double>> InMemoryStorage::InMemoryAccessor::TextSearch(LabelId label,
+                                                                                             PropertyId property,
+                                                                                             std::string_view query,
+                                                                                             uint64_t limit,
+                                                                                             View view) {
+  ++access_counters.index_seeks;
+  return GetTextIndex()->Search(label, property, query, limit, view, &transaction_, &storage_->constraints_);
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(LabelId label, PropertyId property,
+                                                             const PointRegion &region, View view) {
+  ++access_counters.index_seeks;
+  return VerticesIterable(
+      GetPointIndex()->Vertices(label, property, region, view, &transaction_, &storage_->constraints_));
+}
+
+std::vector<std::pair<VertexAccessor, double>> InMemoryStorage::InMemoryAccessor::VectorSearch(
+    LabelId label, PropertyId property, const std::vector<float> &query, uint64_t limit, VectorMetric metric,
+    View view) {
+  ++access_counters.index_seeks;
+  return GetVectorIndex()->Search(label, property, query, limit, metric, view, &transaction_, &storage_->constraints_);
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, View view) {
+  ++access_counters.index_seeks;
+  return EdgesIterable(GetEdgeTypeIndex()->Edges(edge_type, view, &transaction_, &storage_->constraints_));
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property, View view) {
+  ++access_counters.index_seeks;
+  return EdgesIterable(GetEdgeTypePropertyIndex()->Edges(edge_type, property, std::nullopt, std::nullopt, view,
+                                                         &transaction_, &storage_->constraints_));
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                                       const PropertyValue &value, View view) {
+  ++access_counters.index_seeks;
+  return EdgesIterable(GetEdgeTypePropertyIndex()->Edges(edge_type, property, utils::MakeBoundInclusive(value),
+                                                         utils::MakeBoundInclusive(value), view, &transaction_,
+                                                         &storage_->constraints_));
+}
+
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property,
+                                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound,
+                                                       View view) {
+  ++access_counters.index_seeks;
+  return EdgesIterable(GetEdgeTypePropertyIndex()->Edges(edge_type, property, lower_bound, upper_bound, view,
+                                                         &transaction_, &storage_->constraints_));
+}
+
+Transaction InMemoryStorage::CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode) {
+  return CreateTransaction(isolation_level, storage_mode, nullptr);
+}
+
+Transaction InMemoryStorage::CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode,
+                                               uint64_t *last_commit_timestamp) {
+  const uint64_t transaction_id = transaction_id_.fetch_add(1, std::memory_order_relaxed);
+  // Replica should have only read queries and the write queries
+  // can come from main instance with any past timestamp.
+  // To preserve snapshot isolation we set the start timestamp
+  // of any query on replica to the last commited transaction
+  // which is timestamp_ as only commit of transaction with writes
+  // can change the value of it.
+  const bool is_replica = replication_state_.GetRole() == replication::ReplicationRole::REPLICA;
+  const auto next_start_timestamp = [&] {
+    return is_replica ? timestamp_.load(std::memory_order_seq_cst) : timestamp_.fetch_add(1, std::memory_order_seq_cst);
+  };
+
+  // The transaction begins without the engine lock. The transaction which
+  // commits under it may have a lower commit timestamp than the start
+  // timestamp, in which case the transaction waits until the commit is
+  // visible to it.
+  uint64_t start_timestamp = next_start_timestamp();
+  while (committing_timestamp_.load(std::memory_order_seq_cst) < start_timestamp) {
+    std::this_thread::yield();
+  }
+  uint64_t seen_commit_timestamp = replication_state_.last_commit_timestamp_.load();
+  if (seen_commit_timestamp >= start_timestamp) {
+    // A later commit became visible meanwhile, so the last commit which the
+    // transaction sees isn't known. Transactions get their commit timestamps
+    // and update the last commit timestamp while holding the engine lock, so
+    // a transaction which begins under it sees exactly the commits up to its
+    // start.
+    if (!is_replica) commit_log_->MarkFinished(start_timestamp);
+    std::lock_guard<utils::SpinLock> guard(engine_lock_);
+    start_timestamp = next_start_timestamp();
+    seen_commit_timestamp = replication_state_.last_commit_timestamp_.load();
+  }
+  if (last_commit_timestamp) {
+    *last_commit_timestamp = seen_commit_timestamp;
+  }
+  // The edge import mode can only change while the unique main lock is held,
+  // so it can't change during the transaction.
+  const bool edge_import_mode_active =
+      edge_import_status_ == EdgeImportMode::ACTIVE && storage_mode == StorageMode::IN_MEMORY_ANALYTICAL;
+  Transaction transaction{transaction_id, start_timestamp, isolation_level, storage_mode, edge_import_mode_active};
+  transaction.last_commit_timestamp = seen_commit_timestamp;
+  transaction.vertex_version_cache = &vertex_version_cache_;
+  if (!dictionary_encoded_properties_.empty()) {
+    transaction.dictionary_encoded_properties = &dictionary_encoded_properties_;
+  }
+  return transaction;
+}
+
+namespace {
+
+/// Runs `func(thread_id, item)` for every item in `[0, item_count)` on up to
+/// `thread_count` threads, the calling thread included. The items are claimed
+/// in increasing order, and once `should_stop()` returns true no new items are
+/// claimed. Returns the number of processed items, which always form a prefix
+/// of the range.
+template <typename TFunc, typename TStop>
+uint64_t RunGcWork(uint64_t item_count, uint64_t thread_count, const TFunc &func, const TStop &should_stop) {
+  std::atomic<uint64_t> item_counter = 0;
+  std::atomic<uint64_t> processed_count = 0;
+  auto worker = [&](uint64_t thread_id) {
+    while (!should_stop()) {
+      const auto item = item_counter++;
+      if (item >= item_count) {
+        return;
+      }
+      func(thread_id, item);
+      ++processed_count;
+    }
+  };
+
+  thread_count = std::min(thread_count, item_count);
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count > 0 ? thread_count - 1 : 0);
+    for (uint64_t i = 1; i < thread_count; ++i) {
+      threads.emplace_back(worker, i);
+    }
+    worker(0);
+  }
+  return processed_count.load();
+}
+
+/// Unlinks all deltas of the committed `transaction` from their version
+/// chains. Vertices and edges that are deleted and whose version chains become
+/// empty are appended to `deleted_vertices` and `deleted_edges`.
+void UnlinkTransactionDeltas(Transaction &transaction, std::list<Gid> &deleted_vertices,
+                             std::list<Gid> &deleted_edges) {
+  auto commit_timestamp = transaction.commit_timestamp->load(std::memory_order_acquire);
+
+  // When unlinking a delta which is the first delta in its version chain,
+  // special care has to be taken to avoid the following race condition:
+  //
+  // [Vertex] --> [Delta A]
+  //
+  //    GC thread: Delta A is the first in its chain, it must be unlinked from
+  //               vertex and marked for deletion
+  //    TX thread: Update vertex and add Delta B with Delta A as next
+  //
+  // [Vertex] --> [Delta B] <--> [Delta A]
+  //
+  //    GC thread: Unlink delta from Vertex
+  //
+  // [Vertex] --> (nullptr)
+  //
+  // When processing a delta that is the first one in its chain, we
+  // obtain the corresponding vertex or edge lock, and then verify that this
+  // delta still is the first in its chain.
+  // When processing a delta that is in the middle of the chain we only
+  // process the final delta of the given transaction in that chain. We
+  // determine the owner of the chain (either a vertex or an edge), obtain the
+  // corresponding lock, and then verify that this delta is still in the same
+  // position as it was before taking the lock.
+  //
+  // Even though the delta chain is lock-free (both `next` and `prev`) the
+  // chain should not be modified without taking the lock from the object that
+  // owns the chain (either a vertex or an edge). Modifying the chain without
+  // taking the lock will cause subtle race conditions that will leave the
+  // chain in a broken state.
+  // The chain can be only read without taking any locks.
+
+  for (Delta &delta : transaction.deltas.use()) {
+    while (true) {
+      auto prev = delta.prev.Get();
+      switch (prev.type) {
+        case PreviousPtr::Type::VERTEX: {
+          Vertex *vertex = prev.vertex;
+          auto vertex_guard = std::unique_lock{vertex->lock};
+          if (vertex->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          vertex->delta = nullptr;
+          if (vertex->deleted) {
+            deleted_vertices.push_back(vertex->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::EDGE: {
+          Edge *edge = prev.edge;
+          auto edge_guard = std::unique_lock{edge->lock};
+          if (edge->delta != &delta) {
+            // Something changed, we're not the first delta in the chain
+            // anymore.
+            continue;
+          }
+          edge->delta = nullptr;
+          if (edge->deleted) {
+            deleted_edges.push_back(edge->gid);
+          }
+          break;
+        }
+        case PreviousPtr::Type::DELTA: {
+          if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
+            // The delta that is newer than this one is also a delta from this
+            // transaction. We skip the current delta and will remove it as a
+            // part of the suffix later.
+            break;
+          }
+          std::unique_lock<utils::RWSpinLock> guard;
+          {
+            // We need to find the parent object in order to be able to use
+            // its lock.
+            auto parent = prev;
+            while (parent.type == PreviousPtr::Type::DELTA) {
+              parent = parent.delta->prev.Get();
+            }
+            switch (parent.type) {
+              case PreviousPtr::Type::VERTEX:
+                guard = std::unique_lock{parent.vertex->lock};
+                break;
+              case PreviousPtr::Type::EDGE:
+                guard = std::unique_lock{parent.edge->lock};
+                break;
+              case PreviousPtr::Type::DELTA:
+              case PreviousPtr::Type::NULLPTR:
+                LOG_FATAL("Invalid database state!");
+            }
+          }
+          if (delta.prev.Get() != prev) {
+            // Something changed, we could now be the first delta in the
+            // chain.
+            continue;
+          }
+          Delta *prev_delta = prev.delta;
+          prev_delta->next.store(nullptr, std::memory_order_release);
+          break;
+        }
+        case PreviousPtr::Type::NULLPTR: {
+          // The delta was already removed from its chain by
+          // `CompactTransactionDeltas`.
+          break;
+        }
+      }
+      break;
+    }
+  }
+}
+
+/// Removes the deltas of the given committed transaction that no transaction
+/// will ever apply on their own from their version chains.
+///
+/// A `SET_PROPERTY` delta which is followed by another `SET_PROPERTY` delta of
+/// the same property is redundant if no active transaction started between
+/// the two commits, because every transaction then either applies both of
+/// them, in which case the older one wins, or neither of them. Long-running
+/// readers keep GC from unlinking anything committed after they started, so
+/// without compaction frequently updated objects accumulate long chains that
+/// every concurrent reader has to walk.
+///
+/// A removed delta keeps its `next` pointer so that readers which are
+/// currently traversing it can continue, while its `prev` pointer is reset to
+/// mark it as removed. Its memory is freed with the rest of the transaction.
+///
+/// @param active_timestamps sorted start timestamps of all transactions which
+/// could still read deltas of the given transaction.
+/// NOTE: Must not run concurrently with `UnlinkTransactionDeltas` or with
+/// itself, because both of them walk `prev` pointers without holding a lock.
+void CompactTransactionDeltas(Transaction &transaction, const std::vector<uint64_t> &active_timestamps) {
+  const auto is_redundant = [&](const Delta &delta, const Delta *next) {
+    if (next == nullptr || next->action != Delta::Action::SET_PROPERTY ||
+        next->property.key != delta.property.key) {
+      return false;
+    }
+    const auto older_timestamp = next->timestamp->load(std::memory_order_acquire);
+    const auto newer_timestamp = delta.timestamp->load(std::memory_order_acquire);
+    auto it = std::lower_bound(active_timestamps.begin(), active_timestamps.end(), older_timestamp);
+    return it == active_timestamps.end() || *it > newer_timestamp;
+  };
+
+  for (Delta &delta : transaction.deltas.use()) {
+    if (delta.action != Delta::Action::SET_PROPERTY) continue;
+    if (delta.prev.Get().type == PreviousPtr::Type::NULLPTR) continue;
+    if (!is_redundant(delta, delta.next.load(std::memory_order_acquire))) continue;
+
+    // The owner of the chain doesn't change, only the path to it can get
+    // longer when new deltas are prepended.
+    auto parent = delta.prev.Get();
+    while (parent.type == PreviousPtr::Type::DELTA) {
+      parent = parent.delta->prev.Get();
+    }
+    std::unique_lock<utils::RWSpinLock> guard;
+    switch (parent.type) {
+      case PreviousPtr::Type::VERTEX:
+        guard = std::unique_lock{parent.vertex->lock};
+        break;
+      case PreviousPtr::Type::EDGE:
+        guard = std::unique_lock{parent.edge->lock};
+        break;
+      case PreviousPtr::Type::DELTA:
+      case PreviousPtr::Type::NULLPTR:
+        LOG_FATAL("Invalid database state!");
+    }
+
+    // Writers could have changed the chain before we took the lock.
+    auto prev = delta.prev.Get();
+    Delta *next = delta.next.load(std::memory_order_acquire);
+    if (!is_redundant(delta, next)) continue;
+    switch (prev.type) {
+      case PreviousPtr::Type::VERTEX:
+        prev.vertex->delta = next;
+        next->prev.Set(prev.vertex);
+        break;
+      case PreviousPtr::Type::EDGE:
+        prev.edge->delta = next;
+        next->prev.Set(prev.edge);
+        break;
+      case PreviousPtr::Type::DELTA:
+        prev.delta->next.store(next, std::memory_order_release);
+        next->prev.Set(prev.delta);
+        break;
+      case PreviousPtr::Type::NULLPTR:
+        LOG_FATAL("Invalid database state!");
+    }
+    delta.prev.Reset();
+  }
+}
+
+}  // namespace
+
+template <bool force>
+void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ScalableRWLock> main_guard) {
+  // NOTE: You do not need to consider cleanup of deleted object that occurred in
+  // different storage modes within the same CollectGarbage call. This is because
+  // SetStorageMode will ensure CollectGarbage is called before any new transactions
+  // with the new storage mode can start.
+
+  // SetStorageMode will pass its unique_lock of main_lock_. We will use that lock,
+  // as reacquiring the lock would cause  deadlock. Otherwise, we need to get our own
+  // lock.
+  if (!main_guard.owns_lock()) {
+    if constexpr (force) {
+      // We take the unique lock on the main storage lock, so we can forcefully clean
+      // everything we can
+      if (!main_lock_.try_lock()) {
         CollectGarbage<false>();
         return;
       }
@@ -1237,12 +2208,14 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
   if (!gc_guard.owns_lock()) {
     return;
   }
+  utils::Timer gc_timer;
+  uint64_t freed_bytes = 0;
 
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
   // We don't move undo buffers of unlinked transactions to garbage_undo_buffers
   // list immediately, because we would have to repeatedly take
   // garbage_undo_buffers lock.
-  std::list<std::pair<uint64_t, BondPmrLd>> unlinked_undo_buffers;
+  std::list<std::pair<uint64_t, BondPmrDeltas>> unlinked_undo_buffers;
 
   // We will only free vertices deleted up until now in this GC cycle, and we
   // will do it after cleaning-up the indices. That way we are sure that all
@@ -1259,154 +2232,122 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
   // should be run when there were any items that were cleaned up (there were
   // updates between this run of the GC and the previous run of the GC). This
   // eliminates high CPU usage when the GC doesn't have to clean up anything.
+  // Edge indices also have to be cleaned up before the deleted edges are freed.
   bool run_index_cleanup = !committed_transactions_->empty() || !garbage_undo_buffers_->empty() ||
-                           need_full_scan_vertices || need_full_scan_edges;
+                           !current_deleted_edges.empty() || need_full_scan_vertices || need_full_scan_edges;
 
-  while (true) {
-    // We don't want to hold the lock on committed transactions for too long,
-    // because that prevents other transactions from committing.
-    Transaction *transaction = nullptr;
-    {
-      auto committed_transactions_ptr = committed_transactions_.Lock();
-      if (committed_transactions_ptr->empty()) {
+  // Collect the transactions whose deltas aren't visible to any active
+  // transaction anymore. The committed transactions are sorted by their commit
+  // timestamps, so these form a prefix of the list. Only the GC removes
+  // transactions from the list, so the collected pointers stay valid.
+  std::vector<Transaction *> unlinkable_transactions;
+  {
+    auto next_transaction = committed_transactions_.WithLock([](auto &transactions) { return transactions.begin(); });
+    while (true) {
+      // We don't want to hold the lock on committed transactions for too long,
+      // because that prevents other transactions from committing.
+      auto *transaction = committed_transactions_.WithLock([&](auto &transactions) -> Transaction * {
+        if (next_transaction == transactions.end() ||
+            next_transaction->commit_timestamp->load(std::memory_order_acquire) >= oldest_active_start_timestamp) {
+          return nullptr;
+        }
+        return &*next_transaction++;
+      });
+      if (transaction == nullptr) {
         break;
       }
-      transaction = &committed_transactions_ptr->front();
+      unlinkable_transactions.push_back(transaction);
     }
+  }
 
-    auto commit_timestamp = transaction->commit_timestamp->load(std::memory_order_acquire);
-    if (commit_timestamp >= oldest_active_start_timestamp) {
-      break;
+  // A periodic GC cycle stops unlinking once its time slice is used up so that
+  // it doesn't hold the main lock for too long. The remaining transactions stay
+  // in the committed transactions list and are handled by the next slice.
+  std::optional<std::chrono::steady_clock::time_point> slice_deadline;
+  if constexpr (!force) {
+    if (config_.gc.time_slice.count() > 0) {
+      slice_deadline = std::chrono::steady_clock::now() + config_.gc.time_slice;
     }
+  }
 
-    // When unlinking a delta which is the first delta in its version chain,
-    // special care has to be taken to avoid the following race condition:
-    //
-    // [Vertex] --> [Delta A]
-    //
-    //    GC thread: Delta A is the first in its chain, it must be unlinked from
-    //               vertex and marked for deletion
-    //    TX thread: Update vertex and add Delta B with Delta A as next
-    //
-    // [Vertex] --> [Delta B] <--> [Delta A]
-    //
-    //    GC thread: Unlink delta from Vertex
-    //
-    // [Vertex] --> (nullptr)
-    //
-    // When processing a delta that is the first one in its chain, we
-    // obtain the corresponding vertex or edge lock, and then verify that this
-    // delta still is the first in its chain.
-    // When processing a delta that is in the middle of the chain we only
-    // process the final delta of the given transaction in that chain. We
-    // determine the owner of the chain (either a vertex or an edge), obtain the
-    // corresponding lock, and then verify that this delta is still in the same
-    // position as it was before taking the lock.
-    //
-    // Even though the delta chain is lock-free (both `next` and `prev`) the
-    // chain should not be modified without taking the lock from the object that
-    // owns the chain (either a vertex or an edge). Modifying the chain without
-    // taking the lock will cause subtle race conditions that will leave the
-    // chain in a broken state.
-    // The chain can be only read without taking any locks.
-
-    for (Delta &delta : transaction->deltas.use()) {
-      while (true) {
-        auto prev = delta.prev.Get();
-        switch (prev.type) {
-          case PreviousPtr::Type::VERTEX: {
-            Vertex *vertex = prev.vertex;
-            auto vertex_guard = std::unique_lock{vertex->lock};
-            if (vertex->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            vertex->delta = nullptr;
-            if (vertex->deleted) {
-              current_deleted_vertices.push_back(vertex->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::EDGE: {
-            Edge *edge = prev.edge;
-            auto edge_guard = std::unique_lock{edge->lock};
-            if (edge->delta != &delta) {
-              // Something changed, we're not the first delta in the chain
-              // anymore.
-              continue;
-            }
-            edge->delta = nullptr;
-            if (edge->deleted) {
-              current_deleted_edges.push_back(edge->gid);
-            }
-            break;
-          }
-          case PreviousPtr::Type::DELTA: {
-            if (prev.delta->timestamp->load(std::memory_order_acquire) == commit_timestamp) {
-              // The delta that is newer than this one is also a delta from this
-              // transaction. We skip the current delta and will remove it as a
-              // part of the suffix later.
-              break;
-            }
-            std::unique_lock<utils::RWSpinLock> guard;
-            {
-              // We need to find the parent object in order to be able to use
-              // its lock.
-              auto parent = prev;
-              while (parent.type == PreviousPtr::Type::DELTA) {
-                parent = parent.delta->prev.Get();
-              }
-              switch (parent.type) {
-                case PreviousPtr::Type::VERTEX:
-                  guard = std::unique_lock{parent.vertex->lock};
-                  break;
-                case PreviousPtr::Type::EDGE:
-                  guard = std::unique_lock{parent.edge->lock};
-                  break;
-                case PreviousPtr::Type::DELTA:
-                case PreviousPtr::Type::NULLPTR:
-                  LOG_FATAL("Invalid database state!");
-              }
-            }
-            if (delta.prev.Get() != prev) {
-              // Something changed, we could now be the first delta in the
-              // chain.
-              continue;
-            }
-            Delta *prev_delta = prev.delta;
-            prev_delta->next.store(nullptr, std::memory_order_release);
-            break;
-          }
-          case PreviousPtr::Type::NULLPTR: {
-            LOG_FATAL("Invalid pointer!");
-          }
-        }
-        break;
-      }
-    }
+  // Every GC thread collects the deleted objects it finds in its own lists.
+  const auto thread_count = std::max<uint64_t>(config_.gc.thread_count, 1);
+  std::vector<std::list<Gid>> thread_deleted_vertices(thread_count);
+  std::vector<std::list<Gid>> thread_deleted_edges(thread_count);
+  const auto unlinked_count = RunGcWork(
+      unlinkable_transactions.size(), thread_count,
+      [&](uint64_t thread_id, uint64_t transaction_id) {
+        UnlinkTransactionDeltas(*unlinkable_transactions[transaction_id], thread_deleted_vertices[thread_id],
+                                thread_deleted_edges[thread_id]);
+      },
+      [&] { return slice_deadline && std::chrono::steady_clock::now() >= *slice_deadline; });
+  for (uint64_t i = 0; i < thread_count; ++i) {
+    current_deleted_vertices.splice(current_deleted_vertices.end(), thread_deleted_vertices[i]);
+    current_deleted_edges.splice(current_deleted_edges.end(), thread_deleted_edges[i]);
+  }
+  if (unlinked_count < unlinkable_transactions.size()) {
+    gc_unlinking_pending_.store(true);
+  }
 
+  for (uint64_t i = 0; i < unlinked_count; ++i) {
     committed_transactions_.WithLock([&](auto &committed_transactions) {
-      unlinked_undo_buffers.emplace_back(0, std::move(transaction->deltas));
+      DMG_ASSERT(&committed_transactions.front() == unlinkable_transactions[i], "Invalid database state!");
+      unlinked_undo_buffers.emplace_back(0, std::move(committed_transactions.front().deltas));
       committed_transactions.pop_front();
     });
   }
 
+  // The transactions which are left could still be read by some active
+  // transaction, so their deltas can only be compacted.
+  if (config_.gc.compact_delta_chains && unlinked_count == unlinkable_transactions.size()) {
+    std::vector<Transaction *> compactable_transactions;
+    committed_transactions_.WithLock([&](auto &transactions) {
+      compactable_transactions.reserve(transactions.size());
+      for (auto &transaction : transactions) {
+        compactable_transactions.push_back(&transaction);
+      }
+    });
+    if (!compactable_transactions.empty()) {
+      // Every transaction which isn't in the list starts after all of the
+      // collected transactions were committed, so it won't read their deltas.
+      uint64_t timestamp_bound = 0;
+      {
+        std::lock_guard<utils::SpinLock> guard(engine_lock_);
+        timestamp_bound = timestamp_;
+      }
+      const auto active_timestamps = commit_log_->ActiveIdsBelow(timestamp_bound);
+      for (auto *transaction : compactable_transactions) {
+        if (slice_deadline && std::chrono::steady_clock::now() >= *slice_deadline) {
+          break;
+        }
+        CompactTransactionDeltas(*transaction, active_timestamps);
+      }
+    }
+  }
+
   // After unlinking deltas from vertices, we refresh the indices. That way
   // we're sure that none of the vertices from `current_deleted_vertices`
   // appears in an index, and we can safely remove the from the main storage
   // after the last currently active transaction is finished.
   if (run_index_cleanup) {
     // This operation is very expensive as it traverses through all of the items
-    // in every index every time.
-    indices_.RemoveObsoleteEntries(oldest_active_start_timestamp);
+    // in every index every time. Every index and constraint is cleaned up by
+    // a separate task so that the work can be split between the GC threads.
+    std::vector<std::function<void()>> cleanup_tasks;
+    indices_.AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, cleanup_tasks);
     auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
-    mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp);
+    mem_unique_constraints->AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, cleanup_tasks);
+    RunGcWork(
+        cleanup_tasks.size(), thread_count, [&](uint64_t /*thread_id*/, uint64_t task_id) { cleanup_tasks[task_id](); },
+        [] { return false; });
   }
 
+  cardinality_counts_.RemoveObsoleteEntries(oldest_active_start_timestamp);
+
+  uint64_t mark_timestamp = 0;
   {
     std::unique_lock<utils::SpinLock> guard(engine_lock_);
-    uint64_t mark_timestamp = timestamp_;
+    mark_timestamp = timestamp_;
     // Take garbage_undo_buffers lock while holding the engine lock to make
     // sure that entries are sorted by mark timestamp in the list.
     garbage_undo_buffers_.WithLock([&](auto &garbage_undo_buffers) {
@@ -1431,14 +2372,16 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
     // no transaction is active
     if constexpr (force) {
       for (auto &[timestamp, transaction_deltas] : undo_buffers) {
-        transaction_deltas.~Bond<PmrListDelta>();
+        freed_bytes += transaction_deltas.use().size() * sizeof(Delta);
+        transaction_deltas.~Bond<PmrDeltas>();
       }
       undo_buffers.clear();
 
     } else {
       while (!undo_buffers.empty() && undo_buffers.front().first <= oldest_active_start_timestamp) {
         auto &[timestamp, transaction_deltas] = undo_buffers.front();
-        transaction_deltas.~Bond<PmrListDelta>();
+        freed_bytes += transaction_deltas.use().size() * sizeof(Delta);
+        transaction_deltas.~Bond<PmrDeltas>();
         // this will trigger destory of object
         // but since we release pointer, it will just destory other stuff
         undo_buffers.pop_front();
@@ -1454,11 +2397,13 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
       while (!garbage_vertices_.empty()) {
         MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
         garbage_vertices_.pop_front();
+        freed_bytes += sizeof(Vertex);
       }
     } else {
       while (!garbage_vertices_.empty() && garbage_vertices_.front().first < oldest_active_start_timestamp) {
         MG_ASSERT(vertex_acc.remove(garbage_vertices_.front().second), "Invalid database state!");
         garbage_vertices_.pop_front();
+        freed_bytes += sizeof(Vertex);
       }
     }
   }
@@ -1466,6 +2411,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
     auto edge_acc = edges_.access();
     for (auto edge : current_deleted_edges) {
       MG_ASSERT(edge_acc.remove(edge), "Invalid database state!");
+      freed_bytes += sizeof(Edge);
     }
   }
 
@@ -1478,8 +2424,8 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
     auto vertex_acc = vertices_.access();
     for (auto &vertex : vertex_acc) {
       // a deleted vertex which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
-      if (vertex.delta == nullptr && vertex.deleted) {
-        vertex_acc.remove(vertex);
+      if (vertex.delta == nullptr && vertex.deleted && vertex_acc.remove(vertex)) {
+        freed_bytes += sizeof(Vertex);
       }
     }
   }
@@ -1489,16 +2435,56 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::RWLock> main_guard)
     auto edge_acc = edges_.access();
     for (auto &edge : edge_acc) {
       // a deleted edge which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
-      if (edge.delta == nullptr && edge.deleted) {
-        edge_acc.remove(edge);
+      if (edge.delta == nullptr && edge.deleted && edge_acc.remove(edge)) {
+        freed_bytes += sizeof(Edge);
       }
     }
   }
+
+  UpdateGcStats(oldest_active_start_timestamp, mark_timestamp);
+  memgraph::metrics::IncrementCounter(memgraph::metrics::GcFreedBytes, freed_bytes);
+  memgraph::metrics::Measure(memgraph::metrics::GcCycleLatency_us,
+                             std::chrono::duration_cast<std::chrono::microseconds>(gc_timer.Elapsed()).count());
+}
+
+void InMemoryStorage::UpdateGcStats(uint64_t oldest_active_start_timestamp, uint64_t next_timestamp) {
+  GcStats stats;
+  stats.uncollected_transactions =
+      committed_transactions_.WithLock([](const auto &transactions) { return transactions.size(); });
+  // Committed and aborted transactions are marked as finished in the commit
+  // log, so some transaction is still active if the oldest unfinished
+  // timestamp wasn't given out yet.
+  if (oldest_active_start_timestamp < next_timestamp) {
+    stats.oldest_active.emplace(oldest_active_start_timestamp, std::chrono::steady_clock::now());
+  }
+
+  auto append_index_entries = [&stats](std::string name, uint64_t entries) {
+    stats.index_entries.emplace_back(std::move(name), entries);
+  };
+  for (const auto label : indices_.label_index_->ListIndices()) {
+    append_index_entries(fmt::format(":{}", LabelToName(label)), indices_.label_index_->ApproximateVertexCount(label));
+  }
+  for (const auto &[label, property] : indices_.label_property_index_->ListIndices()) {
+    append_index_entries(fmt::format(":{}({})", LabelToName(label), PropertyToName(property)),
+                         indices_.label_property_index_->ApproximateVertexCount(label, property));
+  }
+  for (const auto edge_type : indices_.edge_type_index_->ListIndices()) {
+    append_index_entries(fmt::format("[:{}]", EdgeTypeToName(edge_type)),
+                         indices_.edge_type_index_->ApproximateEdgeCount(edge_type));
+  }
+
+  auto locked_stats = gc_stats_.Lock();
+  // The transaction stays the oldest active one since it was first seen.
+  if (stats.oldest_active && locked_stats->oldest_active &&
+      locked_stats->oldest_active->first == stats.oldest_active->first) {
+    stats.oldest_active = locked_stats->oldest_active;
+  }
+  *locked_stats = std::move(stats);
 }
 
 // tell the linker he can find the CollectGarbage definitions here
-template void InMemoryStorage::CollectGarbage<true>(std::unique_lock<utils::RWLock>);
-template void InMemoryStorage::CollectGarbage<false>(std::unique_lock<utils::RWLock>);
+template void InMemoryStorage::CollectGarbage<true>(std::unique_lock<utils::ScalableRWLock>);
+template void InMemoryStorage::CollectGarbage<false>(std::unique_lock<utils::ScalableRWLock>);
 
 StorageInfo InMemoryStorage::GetInfo() const {
   auto vertex_count = vertices_.size();
@@ -1508,8 +2494,18 @@ StorageInfo InMemoryStorage::GetInfo() const {
     // NOLINTNEXTLINE(bugprone-narrowing-conversions, cppcoreguidelines-narrowing-conversions)
     average_degree = 2.0 * static_cast<double>(edge_count) / vertex_count;
   }
-  return {vertex_count, edge_count, average_degree, utils::GetMemoryUsage(),
-          utils::GetDirDiskUsage(config_.durability.storage_directory)};
+  StorageInfo info{vertex_count, edge_count, average_degree, utils::GetMemoryUsage(),
+                   utils::GetDirDiskUsage(config_.durability.storage_directory)};
+  auto gc_stats = gc_stats_.ReadLock();
+  info.uncollected_transactions = gc_stats->uncollected_transactions;
+  // The oldest active transaction may have finished since the last cycle.
+  if (gc_stats->oldest_active && gc_stats->oldest_active->first == commit_log_->OldestActive()) {
+    info.oldest_active_transaction_age_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                std::chrono::steady_clock::now() - gc_stats->oldest_active->second)
+                                                .count();
+  }
+  info.index_entries = gc_stats->index_entries;
+  return info;
 }
 
 bool InMemoryStorage::InitializeWalFile() {
@@ -1517,18 +2513,28 @@ bool InMemoryStorage::InitializeWalFile() {
     return false;
   if (!wal_file_) {
     wal_file_.emplace(wal_directory_, uuid_, replication_state_.GetEpoch().id, config_.items, name_id_mapper_.get(),
-                      wal_seq_num_++, &file_retainer_);
+                      wal_seq_num_++, &file_retainer_, config_.durability.compression,
+                      wal_file_pool_ ? &*wal_file_pool_ : nullptr, config_.durability.wal_direct_io);
+    wal_file_->SetSyncPriority(&durability_write_throttle_);
   }
   return true;
 }
 
-void InMemoryStorage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
-    wal_file_->Sync();
-    wal_unsynced_transactions_ = 0;
+uint64_t InMemoryStorage::FinalizeWalFile() {
+  uint64_t wal_sync_ticket = 0;
+  if (wal_group_commit_) {
+    // The WAL writer thread syncs only what is already written to the file.
+    wal_file_->Flush();
+    wal_sync_ticket = wal_group_commit_->Enqueue(&*wal_file_);
+  } else {
+    ++wal_unsynced_transactions_;
+    if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+      wal_file_->Sync();
+      wal_unsynced_transactions_ = 0;
+    }
   }
   if (wal_file_->GetSize() / 1024 >= config_.durability.wal_file_size_kibibytes) {
+    DrainWalGroupCommit();
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
     wal_unsynced_transactions_ = 0;
@@ -1539,9 +2545,17 @@ void InMemoryStorage::FinalizeWalFile() {
     // reading thread EnabledFlushing)
     wal_file_->TryFlushing();
   }
+  return wal_sync_ticket;
 }
 
-bool InMemoryStorage::AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp) {
+void InMemoryStorage::DrainWalGroupCommit() {
+  if (wal_group_commit_) {
+    wal_group_commit_->Drain();
+  }
+}
+
+bool InMemoryStorage::AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp,
+                                                  uint64_t *wal_sync_ticket) {
   if (!InitializeWalFile()) {
     return true;
   }
@@ -1706,24 +2720,45 @@ bool InMemoryStorage::AppendToWalDataManipulation(const Transaction &transaction
   // Add a delta that indicates that the transaction is fully written to the WAL
   // file.replication_clients_.WithLock
   wal_file_->AppendTransactionEnd(final_commit_timestamp);
-  FinalizeWalFile();
+  *wal_sync_ticket = FinalizeWalFile();
 
   return replication_state_.FinalizeTransaction(final_commit_timestamp);
 }
 
 bool InMemoryStorage::AppendToWalDataDefinition(durability::StorageGlobalOperation operation, LabelId label,
-                                                const std::set<PropertyId> &properties,
+                                                const std::vector<PropertyId> &properties,
                                                 uint64_t final_commit_timestamp) {
   if (!InitializeWalFile()) {
     return true;
   }
 
   wal_file_->AppendOperation(operation, label, properties, final_commit_timestamp);
-  FinalizeWalFile();
+  // Definitions are written under the unique main lock, so waiting here
+  // doesn't hold up any commits.
+  if (const auto wal_sync_ticket = FinalizeWalFile(); wal_sync_ticket != 0) {
+    wal_group_commit_->Wait(wal_sync_ticket);
+  }
   return replication_state_.AppendOperation(wal_file_->SequenceNumber(), operation, label, properties,
                                             final_commit_timestamp);
 }
 
+bool InMemoryStorage::AppendToWalDataDefinition(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                                                const std::vector<PropertyId> &properties,
+                                                uint64_t final_commit_timestamp) {
+  if (!InitializeWalFile()) {
+    return true;
+  }
+
+  wal_file_->AppendOperation(operation, edge_type, properties, final_commit_timestamp);
+  // Definitions are written under the unique main lock, so waiting here
+  // doesn't hold up any commits.
+  if (const auto wal_sync_ticket = FinalizeWalFile(); wal_sync_ticket != 0) {
+    wal_group_commit_->Wait(wal_sync_ticket);
+  }
+  return replication_state_.AppendOperation(wal_file_->SequenceNumber(), operation, edge_type, properties,
+                                            final_commit_timestamp);
+}
+
 utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::CreateSnapshot(
     std::optional<bool> is_periodic) {
   if (replication_state_.GetRole() != replication::ReplicationRole::MAIN) {
@@ -1734,11 +2769,35 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
     utils::Timer timer;
     const auto &epoch = replication_state_.GetEpoch();
     auto transaction = CreateTransaction(IsolationLevel::SNAPSHOT_ISOLATION, storage_mode_);
+    // The snapshot is incremental if there is a chain to add it to. Analytical
+    // transactions don't leave deltas, so their changes aren't tracked.
+    std::optional<durability::SnapshotIncrement> increment;
+    std::optional<SnapshotChain> chain;
+    if (snapshot_change_tracker_) {
+      auto modified = snapshot_change_tracker_->Take(transaction.start_timestamp);
+      chain = std::exchange(*snapshot_chain_.Lock(), std::nullopt);
+      if (chain && chain->increments < config_.durability.snapshot_max_increments &&
+          storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL) {
+        modified.base_timestamp = chain->base_timestamp;
+        modified.previous_timestamp = chain->last_timestamp;
+        increment.emplace(std::move(modified));
+      }
+    }
     // Create snapshot.
     durability::CreateSnapshot(&transaction, snapshot_directory_, wal_directory_,
                                config_.durability.snapshot_retention_count, &vertices_, &edges_, name_id_mapper_.get(),
                                &indices_, &constraints_, config_, uuid_, epoch.id, replication_state_.history,
-                               &file_retainer_);
+                               &file_retainer_, increment ? &*increment : nullptr, &durability_write_throttle_);
+    if (snapshot_change_tracker_) {
+      // The chain stays empty if the snapshot creation fails, so the next
+      // snapshot is a full one.
+      if (increment) {
+        *snapshot_chain_.Lock() =
+            SnapshotChain{chain->base_timestamp, transaction.start_timestamp, chain->increments + 1};
+      } else {
+        *snapshot_chain_.Lock() = SnapshotChain{transaction.start_timestamp, transaction.start_timestamp, 0};
+      }
+    }
     // Finalize snapshot transaction.
     commit_log_->MarkFinished(transaction.start_timestamp);
 
@@ -1752,7 +2811,7 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
   auto max_num_tries{10};
   while (max_num_tries) {
     if (should_try_shared) {
-      std::shared_lock<utils::RWLock> storage_guard(main_lock_);
+      std::shared_lock<utils::ScalableRWLock> storage_guard(main_lock_);
       if (storage_mode_ == memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL) {
         snapshot_creator();
         return {};
@@ -1774,7 +2833,154 @@ utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::Create
   return CreateSnapshotError::ReachedMaxNumTries;
 }
 
-void InMemoryStorage::FreeMemory(std::unique_lock<utils::RWLock> main_guard) {
+utils::BasicResult<InMemoryStorage::CreateSnapshotError> InMemoryStorage::DumpSnapshot(
+    const std::filesystem::path &directory) {
+  auto snapshot_creator = [this, &directory]() {
+    const auto &epoch = replication_state_.GetEpoch();
+    auto transaction = CreateTransaction(IsolationLevel::SNAPSHOT_ISOLATION, storage_mode_);
+    // The dump is always a full snapshot. There is no WAL directory and no
+    // retention, so nothing next to it is deleted. It isn't throttled either.
+    durability::CreateSnapshot(&transaction, directory, {}, std::numeric_limits<uint64_t>::max(), &vertices_, &edges_,
+                               name_id_mapper_.get(), &indices_, &constraints_, config_, uuid_, epoch.id,
+                               replication_state_.history, &file_retainer_);
+    commit_log_->MarkFinished(transaction.start_timestamp);
+  };
+
+  std::lock_guard snapshot_guard(snapshot_lock_);
+
+  auto should_try_shared{true};
+  auto max_num_tries{10};
+  while (max_num_tries) {
+    if (should_try_shared) {
+      std::shared_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+      if (storage_mode_ == memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL) {
+        snapshot_creator();
+        return {};
+      }
+    } else {
+      std::unique_lock main_guard{main_lock_};
+      if (storage_mode_ == memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL) {
+        snapshot_creator();
+        return {};
+      }
+    }
+    should_try_shared = !should_try_shared;
+    max_num_tries--;
+  }
+
+  return CreateSnapshotError::ReachedMaxNumTries;
+}
+
+void InMemoryStorage::SetEdgeImportMode(EdgeImportMode edge_import_status) {
+  {
+    std::unique_lock main_guard{main_lock_};
+    if (edge_import_status == edge_import_status_) {
+      return;
+    }
+    if (edge_import_status == EdgeImportMode::INACTIVE) {
+      LinkImportedEdges();
+      // Imported edges are linked without deltas, so the changes aren't tracked.
+      snapshot_chain_.Lock()->reset();
+    }
+    edge_import_status_ = edge_import_status;
+  }
+  spdlog::trace("Edge import mode changed to: {}", EdgeImportModeToString(edge_import_status));
+
+  if (edge_import_status == EdgeImportMode::INACTIVE &&
+      config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
+    if (auto maybe_error = CreateSnapshot({false}); maybe_error.HasError()) {
+      switch (maybe_error.GetError()) {
+        case CreateSnapshotError::DisabledForReplica:
+          spdlog::warn(utils::MessageWithLink("Snapshots are disabled for replicas.", "https://memgr.ph/replication"));
+          break;
+        case CreateSnapshotError::DisabledForAnalyticsPeriodicCommit:
+          spdlog::warn(utils::MessageWithLink("Periodic snapshots are disabled for analytical mode.",
+                                              "https://memgr.ph/durability"));
+          break;
+        case CreateSnapshotError::ReachedMaxNumTries:
+          spdlog::warn("Failed to create snapshot. Reached max number of tries. Please contact support");
+          break;
+      }
+    }
+  }
+}
+
+EdgeImportMode InMemoryStorage::GetEdgeImportMode() const {
+  std::shared_lock<utils::ScalableRWLock> storage_guard_(main_lock_);
+  return edge_import_status_;
+}
+
+void InMemoryStorage::LinkImportedEdges() {
+  std::vector<ImportedEdge> imported_edges;
+  imported_edges_->swap(imported_edges);
+  if (imported_edges.empty()) {
+    return;
+  }
+
+  // The edges are grouped by vertex so that every adjacency list is grown and
+  // sorted by edge type only once, instead of once for every edge.
+  auto link = [&imported_edges](auto vertex_of, auto other_vertex_of, auto edges_of) {
+    std::sort(imported_edges.begin(), imported_edges.end(),
+              [&](const auto &a, const auto &b) { return vertex_of(a) < vertex_of(b); });
+    for (auto it = imported_edges.begin(); it != imported_edges.end();) {
+      auto *vertex = vertex_of(*it);
+      auto group_end = std::find_if(it, imported_edges.end(), [&](const auto &item) { return vertex_of(item) != vertex; });
+      auto &edges = edges_of(vertex);
+      edges.reserve(edges.size() + std::distance(it, group_end));
+      for (; it != group_end; ++it) {
+        edges.emplace_back(it->edge_type, other_vertex_of(*it), it->edge);
+      }
+      SortVertexEdges(edges);
+    }
+  };
+  link([](const ImportedEdge &item) { return item.from_vertex; },
+       [](const ImportedEdge &item) { return item.to_vertex; },
+       [](Vertex *vertex) -> VertexEdges & { return vertex->out_edges; });
+  link([](const ImportedEdge &item) { return item.to_vertex; },
+       [](const ImportedEdge &item) { return item.from_vertex; },
+       [](Vertex *vertex) -> VertexEdges & { return vertex->in_edges; });
+
+  // Imported edges bypass the index updates, so the edge indices on the
+  // imported edge types are rebuilt from the linked adjacency lists.
+  std::set<EdgeTypeId> imported_edge_types;
+  for (const auto &item : imported_edges) {
+    imported_edge_types.insert(item.edge_type);
+  }
+  auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get());
+  for (const auto edge_type : imported_edge_types) {
+    if (!mem_edge_type_index->DropIndex(edge_type)) continue;
+    MG_ASSERT(mem_edge_type_index->CreateIndex(edge_type, vertices_.access(), GetParallelExecInfo()),
+              "The edge type index must be recreated here!");
+  }
+  auto *mem_edge_type_property_index =
+      static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get());
+  for (const auto &[edge_type, property] : mem_edge_type_property_index->ListIndices()) {
+    if (!imported_edge_types.contains(edge_type)) continue;
+    MG_ASSERT(mem_edge_type_property_index->DropIndex(edge_type, property), "Invalid database state!");
+    MG_ASSERT(mem_edge_type_property_index->CreateIndex(edge_type, property, vertices_.access(), GetParallelExecInfo()),
+              "The edge type+property index must be recreated here!");
+  }
+}
+
+void InMemoryStorage::FreeMemory(std::unique_lock<utils::ScalableRWLock> main_guard) {
+  // Analytical transactions change vertices without prepending deltas, so the
+  // cached versions can't be trusted after the storage mode was changed.
+  vertex_version_cache_.Clear();
+  // Neither are the counts changed by them, which are counted again once the
+  // storage is transactional and no transaction is active.
+  if (main_guard.owns_lock() && !cardinality_counts_.Valid()) {
+    RecountCardinalities();
+  } else if (storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
+    cardinality_counts_.Invalidate();
+  }
+  // For the same reason their changes aren't tracked for incremental
+  // snapshots, so the next snapshot is a full one.
+  snapshot_chain_.Lock()->reset();
+  // The forced collection takes the lock if no transaction is active anyway.
+  if (!main_guard.owns_lock()) main_guard = std::unique_lock{main_lock_, std::try_to_lock};
+  if (main_guard.owns_lock() && storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
+    CompactAdjacency();
+  }
   CollectGarbage<true>(std::move(main_guard));
 
   // SkipList is already threadsafe
@@ -1783,19 +2989,112 @@ void InMemoryStorage::FreeMemory(std::unique_lock<utils::RWLock> main_guard) {
 
   static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())->RunGC();
   static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())->RunGC();
+  static_cast<InMemoryLabelPropertyCompositeIndex *>(indices_.label_property_composite_index_.get())->RunGC();
+  static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get())->RunGC();
+  static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get())->RunGC();
+  static_cast<InMemoryTextIndex *>(indices_.text_index_.get())->RunGC();
+  static_cast<InMemoryPointIndex *>(indices_.point_index_.get())->RunGC();
+}
+
+void InMemoryStorage::RecountCardinalities() {
+  if (storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
+    cardinality_counts_.Invalidate();
+    return;
+  }
+  cardinality_counts_.Rebuild(vertices_.access(), timestamp_);
+}
+
+void InMemoryStorage::CompactAdjacency() {
+  size_t released_edges = 0;
+  for (auto &vertex : vertices_.access()) {
+    std::lock_guard guard(vertex.lock);
+    for (auto *edges : {&vertex.in_edges, &vertex.out_edges}) {
+      if (edges->capacity() == edges->size()) continue;
+      released_edges += edges->capacity() - edges->size();
+      edges->shrink_to_fit();
+    }
+  }
+  spdlog::debug("Released the memory of {} unused adjacency list entries.", released_edges);
 }
 
 uint64_t InMemoryStorage::CommitTimestamp(const std::optional<uint64_t> desired_commit_timestamp) {
   if (!desired_commit_timestamp) {
-    return timestamp_++;
+    return timestamp_.fetch_add(1, std::memory_order_seq_cst);
+  }
+  // Transactions on a replica may read the timestamp concurrently.
+  auto timestamp = timestamp_.load(std::memory_order_seq_cst);
+  while (timestamp <= *desired_commit_timestamp &&
+         !timestamp_.compare_exchange_weak(timestamp, *desired_commit_timestamp + 1, std::memory_order_seq_cst)) {
   }
-  timestamp_ = std::max(timestamp_, *desired_commit_timestamp + 1);
   return *desired_commit_timestamp;
 }
 
+void InMemoryStorage::CreatePendingIndices(const std::stop_token &stop_token) {
+  utils::ThreadSetName("index recovery");
+  auto &pending = indices_.pending_recovery_;
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(indices_.label_index_.get());
+  auto *mem_label_property_index = static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get());
+  spdlog::info("Creating {} label and {} label+property recovered indices in the background.", pending.label.size(),
+               pending.label_property.size());
+  // Transactions keep running between the indices, the lock is held only
+  // while one index is created, same as for `CREATE INDEX`.
+  while (!stop_token.stop_requested()) {
+    std::unique_lock<utils::ScalableRWLock> storage_guard(main_lock_);
+    if (!pending.label.empty()) {
+      const auto label = pending.label.back();
+      pending.label.pop_back();
+      if (!mem_label_index->CreateIndex(label, vertices_.access(), GetParallelExecInfo())) {
+        spdlog::warn("The recovered label index on {} already exists.", LabelToName(label));
+      }
+    } else if (!pending.label_property.empty()) {
+      const auto item = pending.label_property.back();
+      pending.label_property.pop_back();
+      if (!mem_label_property_index->CreateIndex(item.first, item.second, vertices_.access(),
+                                                 GetParallelExecInfo())) {
+        spdlog::warn("The recovered label+property index on {}({}) already exists.", LabelToName(item.first),
+                     PropertyToName(item.second));
+        continue;
+      }
+      auto stats = std::find_if(pending.label_property_stats.begin(), pending.label_property_stats.end(),
+                                [&](const auto &item_stats) { return item_stats.first == item; });
+      if (stats != pending.label_property_stats.end()) {
+        mem_label_property_index->SetIndexStats(item, stats->second);
+        pending.label_property_stats.erase(stats);
+      }
+    } else {
+      spdlog::info("All recovered indices are created.");
+      return;
+    }
+  }
+}
+
+std::optional<ParallelizedIndexCreationInfo> InMemoryStorage::GetParallelExecInfo() {
+  const auto &durability_config = config_.durability;
+  if (!durability_config.allow_parallel_index_creation || durability_config.recovery_thread_count <= 1) {
+    return std::nullopt;
+  }
+  const auto batch_size = std::max(durability_config.items_per_batch, uint64_t{1});
+  auto vertices = vertices_.access();
+  if (vertices.size() <= batch_size) return std::nullopt;
+  // The skip list can't be split without walking it, but stepping over the
+  // vertices is much cheaper than indexing them.
+  std::vector<std::pair<Gid, uint64_t>> vertex_batches;
+  vertex_batches.reserve(vertices.size() / batch_size + 1);
+  for (const auto &vertex : vertices) {
+    if (vertex_batches.empty() || vertex_batches.back().second == batch_size) {
+      vertex_batches.emplace_back(vertex.gid, 0);
+    }
+    ++vertex_batches.back().second;
+  }
+  return std::make_pair(std::move(vertex_batches), durability_config.recovery_thread_count);
+}
+
 void InMemoryStorage::EstablishNewEpoch() {
+  // The snapshots of the new epoch don't build on the ones before it.
+  snapshot_chain_.Lock()->reset();
   std::unique_lock engine_guard{engine_lock_};
   if (wal_file_) {
+    DrainWalGroupCommit();
     wal_file_->FinalizeWal();
     wal_file_.reset();
   }
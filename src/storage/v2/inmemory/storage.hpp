@@ -11,12 +11,27 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <stop_token>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#include "storage/v2/durability/snapshot.hpp"
+#include "storage/v2/edge_import_mode.hpp"
+#include "storage/v2/inmemory/cardinality_counts.hpp"
+#include "storage/v2/inmemory/edge_type_index.hpp"
+#include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/point_index.hpp"
+#include "storage/v2/inmemory/text_index.hpp"
+#include "storage/v2/inmemory/vector_index.hpp"
 #include "storage/v2/storage.hpp"
 
 /// REPLICATION ///
@@ -28,6 +43,7 @@
 #include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/transaction.hpp"
 #include "utils/memory.hpp"
+#include "utils/rw_spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::storage {
@@ -59,12 +75,46 @@ class InMemoryStorage final : public Storage {
 
   ~InMemoryStorage() override;
 
+  struct ImportedEdge {
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    EdgeTypeId edge_type;
+    EdgeRef edge;
+  };
+
   class InMemoryAccessor : public Storage::Accessor {
    private:
     friend class InMemoryStorage;
 
     explicit InMemoryAccessor(InMemoryStorage *storage, IsolationLevel isolation_level, StorageMode storage_mode);
 
+    InMemoryLabelPropertyCompositeIndex *GetCompositeIndex() const {
+      return static_cast<InMemoryLabelPropertyCompositeIndex *>(
+          static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_.get());
+    }
+
+    InMemoryEdgeTypeIndex *GetEdgeTypeIndex() const {
+      return static_cast<InMemoryEdgeTypeIndex *>(
+          static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_.get());
+    }
+
+    InMemoryEdgeTypePropertyIndex *GetEdgeTypePropertyIndex() const {
+      return static_cast<InMemoryEdgeTypePropertyIndex *>(
+          static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_property_index_.get());
+    }
+
+    InMemoryTextIndex *GetTextIndex() const {
+      return static_cast<InMemoryTextIndex *>(static_cast<InMemoryStorage *>(storage_)->indices_.text_index_.get());
+    }
+
+    InMemoryPointIndex *GetPointIndex() const {
+      return static_cast<InMemoryPointIndex *>(static_cast<InMemoryStorage *>(storage_)->indices_.point_index_.get());
+    }
+
+    InMemoryVectorIndex *GetVectorIndex() const {
+      return static_cast<InMemoryVectorIndex *>(static_cast<InMemoryStorage *>(storage_)->indices_.vector_index_.get());
+    }
+
    public:
     InMemoryAccessor(const InMemoryAccessor &) = delete;
     InMemoryAccessor &operator=(const InMemoryAccessor &) = delete;
@@ -79,6 +129,11 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     VertexAccessor CreateVertex() override;
 
+    /// Reserves the gids of all vertices at once and inserts them with a
+    /// single access to the vertices, locking each vertex once for all labels.
+    /// @throw std::bad_alloc
+    std::vector<VertexAccessor> CreateVertices(uint64_t count, const std::vector<LabelId> &labels) override;
+
     std::optional<VertexAccessor> FindVertex(Gid gid, View view) override;
 
     VerticesIterable Vertices(View view) override {
@@ -90,6 +145,10 @@ class InMemoryStorage final : public Storage {
 
     VerticesIterable Vertices(LabelId label, View view) override;
 
+    std::vector<VerticesIterable> ChunkedVertices(View view, uint64_t num_chunks) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, uint64_t num_chunks) override;
+
     VerticesIterable Vertices(LabelId label, PropertyId property, View view) override;
 
     VerticesIterable Vertices(LabelId label, PropertyId property, const PropertyValue &value, View view) override;
@@ -98,6 +157,34 @@ class InMemoryStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              const std::vector<PropertyValue> &prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
+    VerticesIterable Vertices(LabelId label, PropertyId property, TextMatch match, const std::string &pattern,
+                              View view) override;
+
+    std::vector<std::pair<VertexAccessor, double>> TextSearch(LabelId label, PropertyId property,
+                                                              std::string_view query, uint64_t limit,
+                                                              View view) override;
+
+    VerticesIterable Vertices(LabelId label, PropertyId property, const PointRegion &region, View view) override;
+
+    std::vector<std::pair<VertexAccessor, double>> VectorSearch(LabelId label, PropertyId property,
+                                                                const std::vector<float> &query, uint64_t limit,
+                                                                VectorMetric metric, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) override;
+
+    EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                        const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                        const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     /// Return approximate number of all vertices in the database.
     /// Note that this is always an over-estimate and never an under-estimate.
     uint64_t ApproximateVertexCount() const override {
@@ -136,6 +223,82 @@ class InMemoryStorage final : public Storage {
           label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index on the
+    /// given label and properties.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return GetCompositeIndex()->ApproximateVertexCount(label, properties);
+    }
+
+    /// Return approximate number of vertices with the given label whose first
+    /// `prefix.size()` properties are equal to `prefix`.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &prefix) const override {
+      return GetCompositeIndex()->ApproximateVertexCount(label, properties, prefix);
+    }
+
+    /// Return approximate number of vertices with the given label whose first
+    /// `prefix.size()` properties are equal to `prefix` and whose next property
+    /// is in the range defined by provided upper and lower bounds.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &prefix,
+                                    const std::optional<utils::Bound<PropertyValue>> &lower,
+                                    const std::optional<utils::Bound<PropertyValue>> &upper) const override {
+      return GetCompositeIndex()->ApproximateVertexCount(label, properties, prefix, lower, upper);
+    }
+
+    /// Return approximate number of vertices a lookup in the text index on the
+    /// given label and property has to check for the given pattern.
+    uint64_t ApproximateVertexCount(LabelId label, PropertyId property, TextMatch /*match*/,
+                                    std::string_view pattern) const override {
+      return GetTextIndex()->ApproximateVertexCount(label, property, pattern);
+    }
+
+    /// Return approximate number of vertices a lookup in the point index on
+    /// the given label and property has to check for the given region.
+    uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PointRegion &region) const override {
+      return GetPointIndex()->ApproximateVertexCount(label, property, region);
+    }
+
+    /// Return approximate number of edges with the given edge type.
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const override {
+      return GetEdgeTypeIndex()->ApproximateEdgeCount(edge_type);
+    }
+
+    /// Return approximate number of edges with the given edge type and property.
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const override {
+      return GetEdgeTypePropertyIndex()->ApproximateEdgeCount(edge_type, property);
+    }
+
+    /// Return approximate number of edges with the given edge type and property
+    /// value.
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                  const PropertyValue &value) const override {
+      return GetEdgeTypePropertyIndex()->ApproximateEdgeCount(edge_type, property, value);
+    }
+
+    /// Return approximate number of edges with the given edge type and property
+    /// value in the range defined by provided upper and lower bounds.
+    uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                  const std::optional<utils::Bound<PropertyValue>> &lower,
+                                  const std::optional<utils::Bound<PropertyValue>> &upper) const override {
+      return GetEdgeTypePropertyIndex()->ApproximateEdgeCount(edge_type, property, lower, upper);
+    }
+
+    /// Return the exact number of vertices with the given label, unless the
+    /// transaction changed the graph or doesn't use snapshot isolation.
+    std::optional<uint64_t> VertexCount(LabelId label) const override;
+
+    /// Return the exact number of edges of the given type, unless the
+    /// transaction changed the graph or doesn't use snapshot isolation.
+    std::optional<uint64_t> EdgeCount(EdgeTypeId edge_type) const override;
+
+    /// The vertices are looked up while the storage is transactional and the
+    /// transaction can't see uncommitted changes of the others.
+    bool CanFindVertexByUniqueKey(LabelId label, const std::set<PropertyId> &properties) const override;
+
+    Result<std::optional<VertexAccessor>> FindVertexByUniqueKey(LabelId label, const std::set<PropertyId> &properties,
+                                                                const std::vector<PropertyValue> &values) override;
+
     template <typename TResult, typename TIndex, typename TIndexKey>
     std::optional<TResult> GetIndexStatsForIndex(TIndex *index, TIndexKey &&key) const {
       return index->GetIndexStats(key);
@@ -153,6 +316,12 @@ class InMemoryStorage final : public Storage {
           std::make_pair(label, property));
     }
 
+    std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+        const storage::LabelId &label, const std::vector<storage::PropertyId> &properties) const override {
+      return GetIndexStatsForIndex<storage::LabelPropertyIndexStats>(GetCompositeIndex(),
+                                                                     std::make_pair(label, properties));
+    }
+
     template <typename TIndex, typename TIndexKey, typename TIndexStats>
     void SetIndexStatsForIndex(TIndex *index, TIndexKey &&key, TIndexStats &stats) const {
       index->SetIndexStats(key, stats);
@@ -168,6 +337,11 @@ class InMemoryStorage final : public Storage {
                             std::make_pair(label, property), stats);
     }
 
+    void SetIndexStats(const storage::LabelId &label, const std::vector<storage::PropertyId> &properties,
+                       const LabelPropertyIndexStats &stats) override {
+      SetIndexStatsForIndex(GetCompositeIndex(), std::make_pair(label, properties), stats);
+    }
+
     template <typename TResult, typename TIndex>
     std::vector<TResult> ClearIndexStatsForIndex(TIndex *index) const {
       return index->ClearIndexStats();
@@ -182,6 +356,10 @@ class InMemoryStorage final : public Storage {
           static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get()));
     }
 
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> ClearLabelPropertyCompositeIndexStats() override {
+      return ClearIndexStatsForIndex<std::pair<LabelId, std::vector<PropertyId>>>(GetCompositeIndex());
+    }
+
     template <typename TResult, typename TIndex>
     std::vector<TResult> DeleteIndexStatsForIndex(TIndex *index, const std::span<std::string> labels) {
       std::vector<TResult> deleted_indexes;
@@ -205,6 +383,11 @@ class InMemoryStorage final : public Storage {
                                                labels);
     }
 
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> DeleteLabelPropertyCompositeIndexStats(
+        const std::span<std::string> labels) override {
+      return DeleteIndexStatsForIndex<std::pair<LabelId, std::vector<PropertyId>>>(GetCompositeIndex(), labels);
+    }
+
     Result<std::optional<std::pair<std::vector<VertexAccessor>, std::vector<EdgeAccessor>>>> DetachDelete(
         std::vector<VertexAccessor *> nodes, std::vector<EdgeAccessor *> edges, bool detach) override;
 
@@ -212,6 +395,12 @@ class InMemoryStorage final : public Storage {
 
     void PrefetchOutEdges(const VertexAccessor &vertex_acc) override{};
 
+    void PrefetchInEdges(const std::vector<VertexAccessor> &vertices,
+                         const std::vector<EdgeTypeId> &edge_types) override{};
+
+    void PrefetchOutEdges(const std::vector<VertexAccessor> &vertices,
+                          const std::vector<EdgeTypeId> &edge_types) override{};
+
     /// @throw std::bad_alloc
     Result<EdgeAccessor> CreateEdge(VertexAccessor *from, VertexAccessor *to, EdgeTypeId edge_type) override;
 
@@ -227,6 +416,34 @@ class InMemoryStorage final : public Storage {
       return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return GetCompositeIndex()->IndexExists(label, properties);
+    }
+
+    std::vector<std::vector<PropertyId>> LabelPropertyCompositeIndices(LabelId label) const override {
+      return GetCompositeIndex()->ListIndices(label);
+    }
+
+    bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override {
+      return GetEdgeTypeIndex()->IndexExists(edge_type);
+    }
+
+    bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const override {
+      return GetEdgeTypePropertyIndex()->IndexExists(edge_type, property);
+    }
+
+    bool TextIndexExists(LabelId label, PropertyId property) const override {
+      return GetTextIndex()->IndexExists(label, property);
+    }
+
+    bool PointIndexExists(LabelId label, PropertyId property) const override {
+      return GetPointIndex()->IndexExists(label, property);
+    }
+
+    bool VectorIndexExists(LabelId label, PropertyId property) const override {
+      return GetVectorIndex()->IndexExists(label, property);
+    }
+
     IndicesInfo ListAllIndices() const override {
       const auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
       return mem_storage->ListAllIndices();
@@ -259,7 +476,20 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     Result<EdgeAccessor> CreateEdgeEx(VertexAccessor *from, VertexAccessor *to, EdgeTypeId edge_type, storage::Gid gid);
 
+    /// Creates an edge while the edge import mode is active. The edge isn't
+    /// linked to its vertices, it is buffered until the mode is deactivated.
+    /// @throw std::bad_alloc
+    Result<EdgeAccessor> CreateImportedEdge(Vertex *from_vertex, Vertex *to_vertex, EdgeTypeId edge_type);
+
     Config::Items config_;
+
+    // Edges created by this transaction while the edge import mode is active.
+    // They are handed over to the storage when the accessor is destroyed.
+    std::vector<ImportedEdge> imported_edges_;
+
+    // Number of the transaction's deltas whose vertices were added to the
+    // unique constraints by `FindVertexByUniqueKey`.
+    uint64_t unique_constraint_deltas_{0};
   };
 
   class ReplicationAccessor final : public InMemoryAccessor {
@@ -318,6 +548,113 @@ class InMemoryStorage final : public Storage {
   utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
       LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
 
+  /// Create a composite index on the ordered list of properties.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      LabelId label, const std::vector<PropertyId> &properties,
+      std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing composite index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      LabelId label, const std::vector<PropertyId> &properties,
+      std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Create an index on all the edges of the given edge type.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Create an index on a property of the edges of the given edge type.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists or properties on edges are disabled.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId edge_type, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing edge type index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing edge type+property index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId edge_type, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Create a text index on a string property of the vertices with the given
+  /// label.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateTextIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing text index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropTextIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Create a point index on a point property of the vertices with the given
+  /// label.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreatePointIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing point index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropPointIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Create a vector index on a list property of the vertices with the given
+  /// label.
+  /// Returns void if the index has been created.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index already exists.
+  /// @throw std::bad_alloc
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateVectorIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
+  /// Drop an existing vector index.
+  /// Returns void if the index has been dropped.
+  /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+  /// * `ReplicationError`:  there is at least one SYNC replica that has not confirmed receiving the transaction.
+  /// * `IndexDefinitionError`: the index does not exist.
+  utils::BasicResult<StorageIndexDefinitionError, void> DropVectorIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) override;
+
   /// Returns void if the existence constraint has been created.
   /// Returns `StorageExistenceConstraintDefinitionError` if an error occures. Error can be:
   /// * `ReplicationError`: there is at least one SYNC replica that has not confirmed receiving the transaction.
@@ -360,7 +697,7 @@ class InMemoryStorage final : public Storage {
   utils::BasicResult<StorageUniqueConstraintDroppingError, UniqueConstraints::DeletionStatus> DropUniqueConstraint(
       LabelId label, const std::set<PropertyId> &properties, std::optional<uint64_t> desired_commit_timestamp) override;
 
-  void FreeMemory(std::unique_lock<utils::RWLock> main_guard) override;
+  void FreeMemory(std::unique_lock<utils::ScalableRWLock> main_guard) override;
 
   utils::FileRetainer::FileLockerAccessor::ret_type IsPathLocked();
   utils::FileRetainer::FileLockerAccessor::ret_type LockPath();
@@ -368,8 +705,31 @@ class InMemoryStorage final : public Storage {
 
   utils::BasicResult<CreateSnapshotError> CreateSnapshot(std::optional<bool> is_periodic);
 
+  /// Writes a full snapshot of the current data to `directory` with
+  /// `snapshot_thread_count` threads. It isn't part of the snapshots of the
+  /// storage and it doesn't delete any snapshots or WAL files, so it can be
+  /// copied to the snapshot directory of another instance and recovered there.
+  utils::BasicResult<CreateSnapshotError> DumpSnapshot(const std::filesystem::path &directory);
+
+  /// Bulk edge loading for the IN_MEMORY_ANALYTICAL storage mode. While the
+  /// mode is active, created edges aren't linked to their vertices one by one.
+  /// They are buffered instead and, once the mode is deactivated, linked
+  /// with a single pass over every adjacency list. After that a snapshot is
+  /// created if snapshots are enabled. Until then, the imported edges can't
+  /// be reached from their vertices. Writes to vertices and deletions are
+  /// forbidden while the mode is active.
+  /// @throw std::bad_alloc
+  void SetEdgeImportMode(EdgeImportMode edge_import_status);
+
+  EdgeImportMode GetEdgeImportMode() const;
+
   Transaction CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode) override;
 
+  /// Also stores the commit timestamp of the last transaction which the
+  /// created transaction sees into `last_commit_timestamp`.
+  Transaction CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode,
+                                uint64_t *last_commit_timestamp);
+
   auto CreateReplicationClient(std::string name, io::network::Endpoint endpoint, replication::ReplicationMode mode,
                                replication::ReplicationClientConfig const &config)
       -> std::unique_ptr<ReplicationClient> override;
@@ -390,21 +750,63 @@ class InMemoryStorage final : public Storage {
   /// @throw std::system_error
   /// @throw std::bad_alloc
   template <bool force>
-  void CollectGarbage(std::unique_lock<utils::RWLock> main_guard = {});
+  void CollectGarbage(std::unique_lock<utils::ScalableRWLock> main_guard = {});
+
+  // Records what a garbage collection cycle saw in `gc_stats_`. Has to be
+  // called while holding the main lock, which protects the indices.
+  void UpdateGcStats(uint64_t oldest_active_start_timestamp, uint64_t next_timestamp);
 
   bool InitializeWalFile();
-  void FinalizeWalFile();
+  /// Returns the ticket to wait on with `wal_group_commit_`, or 0 if group
+  /// commits are disabled.
+  uint64_t FinalizeWalFile();
+  /// Syncs the transactions waiting for a group commit. Has to be called
+  /// before the current WAL file is finalized or reset.
+  void DrainWalGroupCommit();
+
+  /// Links all buffered imported edges to their vertices. The caller must hold
+  /// the unique main lock.
+  void LinkImportedEdges();
 
   StorageInfo GetInfo() const override;
 
   /// Return true in all cases excepted if any sync replicas have not sent confirmation.
-  [[nodiscard]] bool AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp);
+  /// If group commits are enabled, `wal_sync_ticket` is set to the ticket the
+  /// caller has to wait on after releasing the engine lock.
+  [[nodiscard]] bool AppendToWalDataManipulation(const Transaction &transaction, uint64_t final_commit_timestamp,
+                                                 uint64_t *wal_sync_ticket);
   /// Return true in all cases excepted if any sync replicas have not sent confirmation.
+  /// The order of `properties` is kept, which matters for composite indices.
   [[nodiscard]] bool AppendToWalDataDefinition(durability::StorageGlobalOperation operation, LabelId label,
-                                               const std::set<PropertyId> &properties, uint64_t final_commit_timestamp);
+                                               const std::vector<PropertyId> &properties,
+                                               uint64_t final_commit_timestamp);
+  /// Return true in all cases excepted if any sync replicas have not sent confirmation.
+  [[nodiscard]] bool AppendToWalDataDefinition(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                                               const std::vector<PropertyId> &properties,
+                                               uint64_t final_commit_timestamp);
+
+  /// Counts the labels and edge types of all vertices again. No transaction
+  /// may be active.
+  void RecountCardinalities();
+
+  /// Releases the capacity of the adjacency lists beyond their edges, which
+  /// the lists grown one edge at a time by an analytical import leave unused.
+  /// No transaction may be active, as the lists are reallocated.
+  void CompactAdjacency();
 
   uint64_t CommitTimestamp(std::optional<uint64_t> desired_commit_timestamp = {});
 
+  /// Splits the vertices into batches of `items_per_batch` vertices which are
+  /// indexed by `recovery_thread_count` threads when a new index is built.
+  /// Returns `std::nullopt` if parallel index creation is disabled or there
+  /// aren't enough vertices for more than one batch. The caller must hold the
+  /// unique main lock, so the batches stay valid until the index is built.
+  std::optional<ParallelizedIndexCreationInfo> GetParallelExecInfo();
+
+  /// Creates the indices left in `Indices::pending_recovery_` by the recovery
+  /// one at a time, each under the unique main lock.
+  void CreatePendingIndices(const std::stop_token &stop_token);
+
   void EstablishNewEpoch() override;
 
   // Main object storage
@@ -420,13 +822,33 @@ class InMemoryStorage final : public Storage {
   utils::Scheduler snapshot_runner_;
   utils::SpinLock snapshot_lock_;
 
+  // Set if incremental snapshots are enabled.
+  std::optional<durability::SnapshotChangeTracker> snapshot_change_tracker_;
+  // The full snapshot and the incremental snapshots created after it.
+  struct SnapshotChain {
+    uint64_t base_timestamp;
+    uint64_t last_timestamp;
+    uint64_t increments;
+  };
+  // Empty if the next snapshot has to be a full one.
+  utils::Synchronized<std::optional<SnapshotChain>, utils::SpinLock> snapshot_chain_;
+
   // UUID used to distinguish snapshots and to link snapshots to WALs
   std::string uuid_;
   // Sequence number used to keep track of the chain of WALs.
   uint64_t wal_seq_num_{0};
 
+  // Throttles the snapshot writes, which the syncs of `wal_file_` take
+  // priority over. Declared before `wal_file_` so that it outlives it.
+  utils::WriteThrottle durability_write_throttle_;
+
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Set if `config_.durability.wal_group_commit` is enabled. Declared after
+  // `wal_file_` so that it's destroyed first.
+  std::optional<durability::WalGroupCommit> wal_group_commit_;
+  // Set if `config_.durability.wal_preallocated_files` isn't 0.
+  std::optional<durability::WalFilePool> wal_file_pool_;
 
   utils::FileRetainer file_retainer_;
 
@@ -439,13 +861,32 @@ class InMemoryStorage final : public Storage {
   // whatever.
   std::optional<CommitLog> commit_log_;
 
+  // Commit timestamp of the transaction which is committing under the engine
+  // lock, `kCommitPending` while the timestamp is being allocated and
+  // `kNoCommit` if no transaction is committing. A transaction which begins
+  // waits while the commit timestamp is lower than its start timestamp,
+  // because it has to see the commit and the commit isn't visible yet.
+  static constexpr uint64_t kCommitPending = 0;
+  static constexpr uint64_t kNoCommit = std::numeric_limits<uint64_t>::max();
+  std::atomic<uint64_t> committing_timestamp_{kNoCommit};
+
   utils::Synchronized<std::list<Transaction>, utils::SpinLock> committed_transactions_;
   utils::Scheduler gc_runner_;
   std::mutex gc_lock_;
 
-  using BondPmrLd = Bond<utils::pmr::list<Delta>>;
+  // What the last garbage collection cycle saw, reported by `GetInfo`.
+  struct GcStats {
+    uint64_t uncollected_transactions{0};
+    // Start timestamp of the oldest active transaction and when it was first
+    // seen.
+    std::optional<std::pair<uint64_t, std::chrono::steady_clock::time_point>> oldest_active;
+    std::vector<std::pair<std::string, uint64_t>> index_entries;
+  };
+  utils::Synchronized<GcStats, utils::RWSpinLock> gc_stats_;
+
+  using BondPmrDeltas = Bond<PmrDeltas>;
   // Ownership of unlinked deltas is transfered to garabage_undo_buffers once transaction is commited
-  utils::Synchronized<std::list<std::pair<uint64_t, BondPmrLd>>, utils::SpinLock> garbage_undo_buffers_;
+  utils::Synchronized<std::list<std::pair<uint64_t, BondPmrDeltas>>, utils::SpinLock> garbage_undo_buffers_;
 
   // Vertices that are logically deleted but still have to be removed from
   // indices before removing them from the main storage.
@@ -459,9 +900,38 @@ class InMemoryStorage final : public Storage {
   // storage.
   utils::Synchronized<std::list<Gid>, utils::SpinLock> deleted_edges_;
 
+  EdgeImportMode edge_import_status_{EdgeImportMode::INACTIVE};
+  // Edges created while the edge import mode is active, by all finished
+  // transactions.
+  utils::Synchronized<std::vector<ImportedEdge>, utils::SpinLock> imported_edges_;
+
+  // Numbers of vertices with each label and of edges of each type, kept by
+  // the committing transactions.
+  CardinalityCounts cardinality_counts_;
+
+  // Vertex versions rebuilt from long delta chains, shared by all transactions.
+  VertexVersionCache vertex_version_cache_{FLAGS_delta_chain_shared_cache_size};
+
+  // Properties from `Config::dictionary_encoded_properties`, which can't change
+  // after the storage is created.
+  DictionaryEncodedProperties dictionary_encoded_properties_;
+
+  // Edge types from `Config::properties_on_edge_types`, pointed to by
+  // `config_.items`. Like the properties above, they can't change after the
+  // storage is created.
+  std::unordered_set<EdgeTypeId> edge_types_with_properties_;
+
   // Flags to inform CollectGarbage that it needs to do the more expensive full scans
   std::atomic<bool> gc_full_scan_vertices_delete_ = false;
   std::atomic<bool> gc_full_scan_edges_delete_ = false;
+
+  // Set when a time sliced GC cycle ran out of time before it unlinked all of
+  // the deltas it could, so that the next slice is run right away
+  std::atomic<bool> gc_unlinking_pending_ = false;
+
+  // Runs `CreatePendingIndices` if `config_.durability.background_index_recovery`
+  // left indices to create.
+  std::jthread index_recovery_thread_;
 };
 
 }  // namespace memgraph::storage
@@ -0,0 +1,360 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/text_index.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+template <typename TIndexAccessor>
+void InsertTextEntries(const PropertyValue &value, Vertex *vertex, uint64_t timestamp,
+                       TIndexAccessor &index_accessor) {
+  if (!value.IsString()) {
+    return;
+  }
+  index_accessor.insert({std::string{}, vertex, timestamp});
+  for (auto &term : TextIndexTerms(value.ValueString())) {
+    index_accessor.insert({std::move(term), vertex, timestamp});
+  }
+}
+
+template <typename TIndexAccessor>
+void TryInsertTextIndex(Vertex &vertex, std::pair<LabelId, PropertyId> label_property, TIndexAccessor &index_accessor) {
+  if (vertex.deleted || !utils::Contains(vertex.labels, label_property.first)) {
+    return;
+  }
+  InsertTextEntries(vertex.properties.GetProperty(label_property.second), &vertex, 0, index_accessor);
+}
+
+/// Returns true if `value` is a string which has `term`. Every string has the
+/// empty term.
+bool ValueHasTerm(const PropertyValue &value, const std::string &term) {
+  if (!value.IsString()) {
+    return false;
+  }
+  if (term.empty()) {
+    return true;
+  }
+  auto terms = TextIndexTerms(value.ValueString());
+  return std::binary_search(terms.begin(), terms.end(), term);
+}
+
+double TermsSimilarity(const std::vector<std::string> &lhs, const std::vector<std::string> &rhs) {
+  if (lhs.empty() || rhs.empty()) {
+    return 0.0;
+  }
+  std::vector<std::string> shared;
+  std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(shared));
+  return static_cast<double>(shared.size()) / static_cast<double>(lhs.size() + rhs.size() - shared.size());
+}
+
+/// Returns the term of `pattern` with the fewest entries, or the empty term if
+/// the pattern is too short to have terms.
+template <typename TIndexAccessor>
+std::string SelectTerm(TIndexAccessor &index_accessor, std::string_view pattern) {
+  std::string selected;
+  uint64_t selected_count = std::numeric_limits<uint64_t>::max();
+  const auto layer = utils::SkipListLayerForCountEstimation(index_accessor.size());
+  for (auto &term : TextIndexTerms(pattern)) {
+    // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+    const auto count = index_accessor.estimate_count(std::string_view{term}, layer);
+    if (count < selected_count) {
+      selected = std::move(term);
+      selected_count = count;
+    }
+  }
+  return selected;
+}
+
+}  // namespace
+
+bool InMemoryTextIndex::Entry::operator<(const Entry &rhs) const {
+  return std::make_tuple(std::string_view{term}, vertex, timestamp) <
+         std::make_tuple(std::string_view{rhs.term}, rhs.vertex, rhs.timestamp);
+}
+
+bool InMemoryTextIndex::Entry::operator==(const Entry &rhs) const {
+  return term == rhs.term && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool InMemoryTextIndex::Entry::operator<(std::string_view rhs) const { return std::string_view{term} < rhs; }
+
+bool InMemoryTextIndex::Entry::operator==(std::string_view rhs) const { return term == rhs; }
+
+InMemoryTextIndex::InMemoryTextIndex(Indices *indices, const Config &config) : TextIndex(indices, config) {}
+
+bool InMemoryTextIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                                    const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  using IndexAccessor = decltype(it->second.access());
+  const auto insert = [](Vertex &vertex, std::pair<LabelId, PropertyId> key, IndexAccessor &index_accessor) {
+    TryInsertTextIndex(vertex, key, index_accessor);
+  };
+  const auto key = std::make_pair(label, property);
+  if (parallel_exec_info) {
+    CreateIndexOnMultipleThreads(vertices, it, index_, key, *parallel_exec_info, insert);
+  } else {
+    CreateIndexOnSingleThread(vertices, it, index_, key, insert);
+  }
+  indices_by_property_[property].emplace_back(label, &it->second);
+  return true;
+}
+
+void InMemoryTextIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) {
+  for (auto &[label_property, storage] : index_) {
+    if (label_property.first != added_label) {
+      continue;
+    }
+    auto acc = storage.access();
+    InsertTextEntries(vertex_after_update->properties.GetProperty(label_property.second), vertex_after_update,
+                      tx.start_timestamp, acc);
+  }
+}
+
+void InMemoryTextIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                            const Transaction &tx) {
+  if (!value.IsString()) {
+    return;
+  }
+  auto it = indices_by_property_.find(property);
+  if (it == indices_by_property_.end()) {
+    return;
+  }
+  for (const auto &[label, storage] : it->second) {
+    if (!utils::Contains(vertex->labels, label)) {
+      continue;
+    }
+    auto acc = storage->access();
+    InsertTextEntries(value, vertex, tx.start_timestamp, acc);
+  }
+}
+
+bool InMemoryTextIndex::DropIndex(LabelId label, PropertyId property) {
+  if (auto it = indices_by_property_.find(property); it != indices_by_property_.end()) {
+    std::erase_if(it->second, [label](const auto &item) { return item.first == label; });
+    if (it->second.empty()) {
+      indices_by_property_.erase(it);
+    }
+  }
+  return index_.erase({label, property}) > 0;
+}
+
+bool InMemoryTextIndex::IndexExists(LabelId label, PropertyId property) const {
+  return index_.find({label, property}) != index_.end();
+}
+
+std::vector<std::pair<LabelId, PropertyId>> InMemoryTextIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryTextIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryTextIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                         std::vector<std::function<void()>> &tasks) {
+  for (auto &index_storage : index_) {
+    tasks.emplace_back([label_property = index_storage.first, &index = index_storage.second,
+                        oldest_active_start_timestamp] {
+      auto index_acc = index.access();
+      for (auto it = index_acc.begin(); it != index_acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
+
+        if ((next_it != index_acc.end() && it->vertex == next_it->vertex && it->term == next_it->term) ||
+            !AnyVersionHasLabelPropertyMatching(
+                *it->vertex, label_property.first, label_property.second,
+                [&term = it->term](const PropertyValue &value) { return ValueHasTerm(value, term); },
+                oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+        it = next_it;
+      }
+    });
+  }
+}
+
+InMemoryTextIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label,
+                                      PropertyId property, TextMatch match, std::string pattern, std::string term,
+                                      View view, Transaction *transaction, Indices *indices, Constraints *constraints,
+                                      const Config &config)
+    : index_accessor_(std::move(index_accessor)),
+      label_(label),
+      property_(property),
+      match_(match),
+      pattern_(std::move(pattern)),
+      term_(std::move(term)),
+      view_(view),
+      transaction_(transaction),
+      indices_(indices),
+      constraints_(constraints),
+      config_(config) {}
+
+InMemoryTextIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, nullptr, nullptr, nullptr, self_->config_.items),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryTextIndex::Iterable::Iterator &InMemoryTextIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryTextIndex::Iterable::Iterator::AdvanceUntilValid() {
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (index_iterator_->term != self_->term_) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+    // Entries of a term are ordered by vertex, so all entries of a vertex are
+    // next to each other.
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    auto value = CurrentVersionLabelPropertyValue(*index_iterator_->vertex, self_->label_, self_->property_,
+                                                  self_->transaction_, self_->view_);
+    if (value && value->IsString() && TextMatches(value->ValueString(), self_->match_, self_->pattern_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->transaction_, self_->indices_,
+                                                self_->constraints_, self_->config_.items);
+      break;
+    }
+  }
+}
+
+InMemoryTextIndex::Iterable::Iterator InMemoryTextIndex::Iterable::begin() {
+  return {this, index_accessor_.find_equal_or_greater(std::string_view{term_})};
+}
+
+InMemoryTextIndex::Iterable::Iterator InMemoryTextIndex::Iterable::end() { return {this, index_accessor_.end()}; }
+
+uint64_t InMemoryTextIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Text index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(std::string_view{}, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+uint64_t InMemoryTextIndex::ApproximateVertexCount(LabelId label, PropertyId property,
+                                                   std::string_view pattern) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Text index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  const auto term = SelectTerm(acc, pattern);
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(std::string_view{term}, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryTextIndex::RunGC() {
+  for (auto &index_entry : index_) {
+    index_entry.second.run_gc();
+  }
+}
+
+InMemoryTextIndex::Iterable InMemoryTextIndex::Vertices(LabelId label, PropertyId property, TextMatch match,
+                                                        std::string pattern, View view, Transaction *transaction,
+                                                        Constraints *constraints) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Text index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  auto acc = it->second.access();
+  auto term = SelectTerm(acc, pattern);
+  return {std::move(acc), label, property,    match,       std::move(pattern), std::move(term), view,
+          transaction,    indices_, constraints, config_};
+}
+
+std::vector<std::pair<VertexAccessor, double>> InMemoryTextIndex::Search(LabelId label, PropertyId property,
+                                                                         std::string_view query, uint64_t limit,
+                                                                         View view, Transaction *transaction,
+                                                                         Constraints *constraints) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Text index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  const auto query_terms = TextIndexTerms(query);
+  if (query_terms.empty() || limit == 0) {
+    return {};
+  }
+
+  // Any vertex sharing at least one term with the query is a candidate. The
+  // score is computed from the visible value, because the index also has the
+  // terms of the older values.
+  std::vector<Vertex *> candidates;
+  auto acc = it->second.access();
+  for (const auto &term : query_terms) {
+    for (auto entry = acc.find_equal_or_greater(std::string_view{term}); entry != acc.end() && entry->term == term;
+         ++entry) {
+      if (candidates.empty() || candidates.back() != entry->vertex) {
+        candidates.push_back(entry->vertex);
+      }
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  std::vector<std::pair<VertexAccessor, double>> results;
+  for (auto *vertex : candidates) {
+    auto value = CurrentVersionLabelPropertyValue(*vertex, label, property, transaction, view);
+    if (!value || !value->IsString()) {
+      continue;
+    }
+    const auto score = TermsSimilarity(query_terms, TextIndexTerms(value->ValueString()));
+    if (score <= 0.0) {
+      continue;
+    }
+    results.emplace_back(VertexAccessor(vertex, transaction, indices_, constraints, config_.items), score);
+  }
+
+  const auto by_score = [](const auto &lhs, const auto &rhs) { return lhs.second > rhs.second; };
+  if (results.size() > limit) {
+    std::partial_sort(results.begin(), results.begin() + static_cast<int64_t>(limit), results.end(), by_score);
+    results.resize(limit);
+  } else {
+    std::sort(results.begin(), results.end(), by_score);
+  }
+  return results;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,145 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+class InMemoryTextIndex : public storage::TextIndex {
+ private:
+  /// Every indexed vertex has an entry with an empty term, which is used to
+  /// scan the whole index when a pattern is too short to have terms.
+  struct Entry {
+    std::string term;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    bool operator<(std::string_view rhs) const;
+    bool operator==(std::string_view rhs) const;
+  };
+
+ public:
+  InMemoryTextIndex(Indices *indices, const Config &config);
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
+                   const std::optional<ParallelizedIndexCreationInfo> &parallel_exec_info);
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
+
+  void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) override {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           const Transaction &tx) override;
+
+  bool DropIndex(LabelId label, PropertyId property) override;
+
+  bool IndexExists(LabelId label, PropertyId property) const override;
+
+  std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, LabelId label, PropertyId property, TextMatch match,
+             std::string pattern, std::string term, View view, Transaction *transaction, Indices *indices,
+             Constraints *constraints, const Config &config);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    PropertyId property_;
+    TextMatch match_;
+    std::string pattern_;
+    // All entries with this term are candidates, the actual values are checked
+    // against the pattern.
+    std::string term_;
+    View view_;
+    Transaction *transaction_;
+    Indices *indices_;
+    Constraints *constraints_;
+    Config config_;
+  };
+
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
+
+  /// Estimates the number of candidates a lookup with `pattern` has to check,
+  /// which is the number of vertices with the rarest term of the pattern.
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property, std::string_view pattern) const override;
+
+  void RunGC();
+
+  /// Yields the vertices whose value of the property satisfies `match` with
+  /// `pattern`.
+  Iterable Vertices(LabelId label, PropertyId property, TextMatch match, std::string pattern, View view,
+                    Transaction *transaction, Constraints *constraints);
+
+  /// Returns at most `limit` vertices sharing terms with `query`, ordered by
+  /// descending score. The score is the Jaccard similarity of the terms of
+  /// `query` and of the value, so it is 1 for equal values (ignoring case).
+  std::vector<std::pair<VertexAccessor, double>> Search(LabelId label, PropertyId property, std::string_view query,
+                                                        uint64_t limit, View view, Transaction *transaction,
+                                                        Constraints *constraints);
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
+  std::unordered_map<PropertyId, std::vector<std::pair<LabelId, utils::SkipList<Entry> *>>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
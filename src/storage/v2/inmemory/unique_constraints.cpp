@@ -398,6 +398,89 @@ std::optional<ConstraintViolation> InMemoryUniqueConstraints::Validate(const Ver
   return std::nullopt;
 }
 
+std::optional<ConstraintViolation> InMemoryUniqueConstraints::UpdateAndValidateBeforeCommit(
+    const std::vector<const Vertex *> &vertices, const Transaction &tx, uint64_t commit_timestamp) {
+  // Up to this many entries are walked to get to the next values before the
+  // skip list is searched for them instead.
+  constexpr size_t kMaxMergeSteps = 16;
+
+  struct Batch {
+    LabelId label;
+    const std::set<PropertyId> *properties;
+    std::vector<Entry> entries;
+  };
+  std::map<utils::SkipList<Entry> *, Batch> batches;
+  for (const auto *vertex : vertices) {
+    for (const auto &label : vertex->labels) {
+      auto constraints = constraints_by_label_.find(label);
+      if (constraints == constraints_by_label_.end()) {
+        continue;
+      }
+      for (auto &[props, storage] : constraints->second) {
+        auto values = vertex->properties.ExtractPropertyValues(props);
+        if (!values) {
+          continue;
+        }
+        auto [it, _] = batches.try_emplace(storage, Batch{label, &props, {}});
+        it->second.entries.push_back(Entry{std::move(*values), vertex, tx.start_timestamp});
+      }
+    }
+  }
+
+  for (auto &[storage, batch] : batches) {
+    auto &entries = batch.entries;
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    auto acc = storage->access();
+    for (auto &entry : entries) {
+      acc.insert(entry);
+    }
+
+    auto it = acc.begin();
+    for (auto group = entries.begin(); group != entries.end();) {
+      const auto &values = group->values;
+      auto group_end = std::find_if(group, entries.end(), [&](const auto &entry) { return values < entry.values; });
+
+      // Vertices of the transaction with the values. Deleted vertices don't
+      // violate the constraint.
+      std::vector<const Vertex *> validated;
+      for (auto entry = group; entry != group_end; ++entry) {
+        if (!entry->vertex->deleted) validated.push_back(entry->vertex);
+      }
+      group = group_end;
+      if (validated.empty()) {
+        continue;
+      }
+
+      for (size_t steps = 0; it != acc.end() && *it < values && steps < kMaxMergeSteps; ++steps) {
+        ++it;
+      }
+      if (it != acc.end() && *it < values) {
+        it = acc.find_equal_or_greater(values);
+      }
+
+      // A vertex violates the constraint if a different vertex had the same
+      // values in its last committed version, so it's enough to find two such
+      // vertices or one which isn't validated.
+      const Vertex *committed = nullptr;
+      for (; it != acc.end() && !(values < it->values); ++it) {
+        if (it->vertex == committed ||
+            !LastCommittedVersionHasLabelProperty(*it->vertex, batch.label, *batch.properties, values, tx,
+                                                  commit_timestamp)) {
+          continue;
+        }
+        if (committed != nullptr || validated.size() > 1 || validated.front() != it->vertex) {
+          return ConstraintViolation{ConstraintViolation::Type::UNIQUE, batch.label, *batch.properties};
+        }
+        committed = it->vertex;
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
 std::vector<std::pair<LabelId, std::set<PropertyId>>> InMemoryUniqueConstraints::ListConstraints() const {
   std::vector<std::pair<LabelId, std::set<PropertyId>>> ret;
   ret.reserve(constraints_.size());
@@ -407,25 +490,56 @@ std::vector<std::pair<LabelId, std::set<PropertyId>>> InMemoryUniqueConstraints:
   return ret;
 }
 
+std::vector<const Vertex *> InMemoryUniqueConstraints::GetVertices(LabelId label,
+                                                                   const std::set<PropertyId> &properties,
+                                                                   const std::vector<PropertyValue> &values) const {
+  std::vector<const Vertex *> vertices;
+  auto constraint = constraints_.find({label, properties});
+  if (constraint == constraints_.end()) return vertices;
+
+  auto acc = constraint->second.access();
+  for (auto it = acc.find_equal_or_greater(values); it != acc.end() && it->values == values; ++it) {
+    // The entries of a vertex are adjacent since they are sorted by the values
+    // and then by the vertex.
+    if (vertices.empty() || vertices.back() != it->vertex) {
+      vertices.push_back(it->vertex);
+    }
+  }
+  return vertices;
+}
+
 void InMemoryUniqueConstraints::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
-  for (auto &[label_props, storage] : constraints_) {
-    auto acc = storage.access();
-    for (auto it = acc.begin(); it != acc.end();) {
-      auto next_it = it;
-      ++next_it;
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
 
-      if (it->timestamp >= oldest_active_start_timestamp) {
-        it = next_it;
-        continue;
-      }
+void InMemoryUniqueConstraints::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                                 std::vector<std::function<void()>> &tasks) {
+  for (auto &constraint : constraints_) {
+    // The key of the map is never modified while the tasks are alive, so we
+    // capture it by reference to avoid copying the property set.
+    tasks.emplace_back([&label_props = constraint.first, &storage = constraint.second, oldest_active_start_timestamp] {
+      auto acc = storage.access();
+      for (auto it = acc.begin(); it != acc.end();) {
+        auto next_it = it;
+        ++next_it;
+
+        if (it->timestamp >= oldest_active_start_timestamp) {
+          it = next_it;
+          continue;
+        }
 
-      if ((next_it != acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
-          !AnyVersionHasLabelProperty(*it->vertex, label_props.first, label_props.second, it->values,
-                                      oldest_active_start_timestamp)) {
-        acc.remove(*it);
+        if ((next_it != acc.end() && it->vertex == next_it->vertex && it->values == next_it->values) ||
+            !AnyVersionHasLabelProperty(*it->vertex, label_props.first, label_props.second, it->values,
+                                        oldest_active_start_timestamp)) {
+          acc.remove(*it);
+        }
+        it = next_it;
       }
-      it = next_it;
-    }
+    });
   }
 }
 
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <functional>
+#include <vector>
+
 #include "storage/v2/constraints/unique_constraints.hpp"
 
 namespace memgraph::storage {
@@ -87,11 +90,34 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
   std::optional<ConstraintViolation> Validate(const Vertex &vertex, const Transaction &tx,
                                               uint64_t commit_timestamp) const;
 
+  /// Does the same as `UpdateBeforeCommit` followed by `Validate` for each of
+  /// the given vertices, but one constraint at a time. The entries of the
+  /// vertices are sorted, so vertices of the transaction with the same values
+  /// are next to each other, and the constraint is searched once per distinct
+  /// values, walking forward from the previous ones. This method should be
+  /// called while commit lock is active.
+  /// @throw std::bad_alloc
+  std::optional<ConstraintViolation> UpdateAndValidateBeforeCommit(const std::vector<const Vertex *> &vertices,
+                                                                   const Transaction &tx, uint64_t commit_timestamp);
+
   std::vector<std::pair<LabelId, std::set<PropertyId>>> ListConstraints() const override;
 
+  /// Returns the vertices which had the `values` of the `properties` of the
+  /// constraint on `label` in some version since the oldest active transaction
+  /// started, or which were passed to `UpdateBeforeCommit` with them.
+  std::vector<const Vertex *> GetVertices(LabelId label, const std::set<PropertyId> &properties,
+                                          const std::vector<PropertyValue> &values) const;
+
   /// GC method that removes outdated entries from constraints' storages.
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
 
+  /// Appends one task per constraint to `tasks` which, when all of them are
+  /// run, do the same as `RemoveObsoleteEntries`. The tasks are independent of
+  /// each other and can be run concurrently while no constraint is created or
+  /// dropped.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
   void Clear() override;
 
  private:
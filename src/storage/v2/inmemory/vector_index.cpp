@@ -0,0 +1,401 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/vector_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <unordered_set>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/indices_utils.hpp"
+#include "utils/memory_tracker.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// The maximum number of neighbours of a node on level 0 and on higher levels.
+constexpr size_t kMaxNeighboursLevel0 = 32;
+constexpr size_t kMaxNeighbours = 16;
+// The beam width used to find the neighbours of inserted nodes.
+constexpr size_t kEfConstruction = 128;
+// The smallest beam width of searches.
+constexpr size_t kMinSearchEf = 64;
+// The expected number of nodes on a level is `kMaxNeighbours` times the number
+// of nodes on the level above it.
+const double kLevelMultiplier = 1.0 / std::log(static_cast<double>(kMaxNeighbours));
+
+bool HasVector(const PropertyValue &value, const float *vector, size_t dimension) {
+  const auto value_vector = PropertyValueToVector(value);
+  return value_vector && value_vector->size() == dimension &&
+         std::equal(value_vector->begin(), value_vector->end(), vector);
+}
+
+}  // namespace
+
+void InMemoryVectorIndex::Graph::Insert(Vertex *vertex, uint64_t timestamp, std::span<const float> vector) {
+  if (dimension == 0) {
+    dimension = vector.size();
+  }
+  if (vector.size() != dimension) {
+    return;
+  }
+  // Setting the same value again keeps the node of the value, but the node
+  // must outlive the new transaction.
+  auto [first, last] = nodes_by_vertex.equal_range(vertex);
+  for (auto it = first; it != last; ++it) {
+    if (std::equal(vector.begin(), vector.end(), Vector(it->second))) {
+      auto &node = nodes[it->second];
+      node.timestamp = std::max(node.timestamp, timestamp);
+      return;
+    }
+  }
+
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  const auto level = static_cast<size_t>(-std::log(1.0 - uniform(level_generator)) * kLevelMultiplier);
+  const auto node = static_cast<uint32_t>(nodes.size());
+  vectors.insert(vectors.end(), vector.begin(), vector.end());
+  nodes.push_back({vertex, timestamp, std::vector<std::vector<uint32_t>>(level + 1)});
+  nodes_by_vertex.emplace(vertex, node);
+  if (node == 0) {
+    entry_point = node;
+    return;
+  }
+
+  const auto *query = Vector(node);
+  const auto top_level = nodes[entry_point].neighbours.size() - 1;
+  std::vector<std::pair<float, uint32_t>> closest{
+      {L2SquaredDistance(query, Vector(entry_point), dimension), entry_point}};
+  for (auto current_level = top_level; current_level > level; --current_level) {
+    closest = SearchLevel(query, std::move(closest), 1, current_level);
+  }
+  for (auto current_level = std::min(level, top_level) + 1; current_level-- > 0;) {
+    closest = SearchLevel(query, std::move(closest), kEfConstruction, current_level);
+    const auto max_neighbours = current_level == 0 ? kMaxNeighboursLevel0 : kMaxNeighbours;
+    auto neighbours = SelectNeighbours(closest, max_neighbours);
+    for (const auto neighbour : neighbours) {
+      auto &links = nodes[neighbour].neighbours[current_level];
+      links.push_back(node);
+      if (links.size() <= max_neighbours) {
+        continue;
+      }
+      std::vector<std::pair<float, uint32_t>> candidates;
+      candidates.reserve(links.size());
+      for (const auto link : links) {
+        candidates.emplace_back(L2SquaredDistance(Vector(neighbour), Vector(link), dimension), link);
+      }
+      std::sort(candidates.begin(), candidates.end());
+      links = SelectNeighbours(std::move(candidates), max_neighbours);
+    }
+    nodes[node].neighbours[current_level] = std::move(neighbours);
+  }
+  if (level > top_level) {
+    entry_point = node;
+  }
+}
+
+std::vector<std::pair<float, uint32_t>> InMemoryVectorIndex::Graph::Search(const float *query, size_t ef) const {
+  if (nodes.empty()) {
+    return {};
+  }
+  std::vector<std::pair<float, uint32_t>> closest{
+      {L2SquaredDistance(query, Vector(entry_point), dimension), entry_point}};
+  for (auto level = nodes[entry_point].neighbours.size() - 1; level > 0; --level) {
+    closest = SearchLevel(query, std::move(closest), 1, level);
+  }
+  return SearchLevel(query, std::move(closest), ef, 0);
+}
+
+std::vector<std::pair<float, uint32_t>> InMemoryVectorIndex::Graph::SearchLevel(
+    const float *query, std::vector<std::pair<float, uint32_t>> entry_points, size_t ef, size_t level) const {
+  using Candidate = std::pair<float, uint32_t>;
+  std::unordered_set<uint32_t> visited;
+  // The nearest candidate is expanded next, the farthest of the closest nodes
+  // is dropped first.
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> candidates;
+  std::priority_queue<Candidate> closest;
+  for (const auto &entry_point : entry_points) {
+    visited.insert(entry_point.second);
+    candidates.push(entry_point);
+    closest.push(entry_point);
+    if (closest.size() > ef) {
+      closest.pop();
+    }
+  }
+
+  while (!candidates.empty()) {
+    const auto [distance, node] = candidates.top();
+    if (closest.size() >= ef && distance > closest.top().first) {
+      break;
+    }
+    candidates.pop();
+    for (const auto neighbour : nodes[node].neighbours[level]) {
+      if (!visited.insert(neighbour).second) {
+        continue;
+      }
+      const auto neighbour_distance = L2SquaredDistance(query, Vector(neighbour), dimension);
+      if (closest.size() < ef || neighbour_distance < closest.top().first) {
+        candidates.emplace(neighbour_distance, neighbour);
+        closest.emplace(neighbour_distance, neighbour);
+        if (closest.size() > ef) {
+          closest.pop();
+        }
+      }
+    }
+  }
+
+  std::vector<Candidate> result(closest.size());
+  for (auto i = result.size(); i-- > 0;) {
+    result[i] = closest.top();
+    closest.pop();
+  }
+  return result;
+}
+
+std::vector<uint32_t> InMemoryVectorIndex::Graph::SelectNeighbours(std::vector<std::pair<float, uint32_t>> candidates,
+                                                                   size_t max_neighbours) const {
+  // Candidates which are closer to an already selected neighbour than to the
+  // node are reachable through that neighbour, so they are skipped in favour
+  // of links in other directions.
+  std::vector<uint32_t> selected;
+  selected.reserve(max_neighbours);
+  for (const auto &candidate : candidates) {
+    if (selected.size() == max_neighbours) {
+      break;
+    }
+    const auto diverse = std::none_of(selected.begin(), selected.end(), [&](uint32_t neighbour) {
+      return L2SquaredDistance(Vector(candidate.second), Vector(neighbour), dimension) < candidate.first;
+    });
+    if (diverse) {
+      selected.push_back(candidate.second);
+    }
+  }
+  return selected;
+}
+
+InMemoryVectorIndex::InMemoryVectorIndex(Indices *indices, const Config &config) : VectorIndex(indices, config) {}
+
+bool InMemoryVectorIndex::CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices) {
+  auto [it, emplaced] =
+      index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, property), std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+  try {
+    auto graph = it->second.Lock();
+    for (Vertex &vertex : vertices) {
+      if (vertex.deleted || !utils::Contains(vertex.labels, label)) {
+        continue;
+      }
+      if (auto vector = PropertyValueToVector(vertex.properties.GetProperty(property))) {
+        graph->Insert(&vertex, 0, *vector);
+      }
+    }
+  } catch (const utils::OutOfMemoryException &) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index_.erase(it);
+    throw;
+  }
+  indices_by_property_[property].emplace_back(label, &it->second);
+  return true;
+}
+
+void InMemoryVectorIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) {
+  for (auto &[label_property, graph] : index_) {
+    if (label_property.first != added_label) {
+      continue;
+    }
+    if (auto vector = PropertyValueToVector(vertex_after_update->properties.GetProperty(label_property.second))) {
+      graph.Lock()->Insert(vertex_after_update, tx.start_timestamp, *vector);
+    }
+  }
+}
+
+void InMemoryVectorIndex::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                                              const Transaction &tx) {
+  auto it = indices_by_property_.find(property);
+  if (it == indices_by_property_.end()) {
+    return;
+  }
+  const auto vector = PropertyValueToVector(value);
+  if (!vector) {
+    return;
+  }
+  for (const auto &[label, graph] : it->second) {
+    if (!utils::Contains(vertex->labels, label)) {
+      continue;
+    }
+    graph->Lock()->Insert(vertex, tx.start_timestamp, *vector);
+  }
+}
+
+bool InMemoryVectorIndex::DropIndex(LabelId label, PropertyId property) {
+  if (auto it = indices_by_property_.find(property); it != indices_by_property_.end()) {
+    std::erase_if(it->second, [label](const auto &item) { return item.first == label; });
+    if (it->second.empty()) {
+      indices_by_property_.erase(it);
+    }
+  }
+  return index_.erase({label, property}) > 0;
+}
+
+bool InMemoryVectorIndex::IndexExists(LabelId label, PropertyId property) const {
+  return index_.find({label, property}) != index_.end();
+}
+
+std::vector<std::pair<LabelId, PropertyId>> InMemoryVectorIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  ret.reserve(index_.size());
+  for (const auto &item : index_) {
+    ret.push_back(item.first);
+  }
+  return ret;
+}
+
+void InMemoryVectorIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp) {
+  std::vector<std::function<void()>> tasks;
+  AppendRemoveObsoleteEntriesTasks(oldest_active_start_timestamp, tasks);
+  for (auto &task : tasks) {
+    task();
+  }
+}
+
+void InMemoryVectorIndex::AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                                           std::vector<std::function<void()>> &tasks) {
+  for (auto &index_graph : index_) {
+    tasks.emplace_back([label_property = index_graph.first, &synchronized_graph = index_graph.second,
+                        oldest_active_start_timestamp] {
+      // The versions of the vertices are checked under the read lock, so
+      // searches can go on meanwhile.
+      std::vector<uint32_t> obsolete;
+      {
+        auto graph = synchronized_graph.ReadLock();
+        for (uint32_t node = 0; node < graph->nodes.size(); ++node) {
+          const auto &item = graph->nodes[node];
+          if (item.vertex == nullptr || item.timestamp >= oldest_active_start_timestamp) {
+            continue;
+          }
+          const auto *vector = graph->Vector(node);
+          if (!AnyVersionHasLabelPropertyMatching(
+                  *item.vertex, label_property.first, label_property.second,
+                  [vector, dimension = graph->dimension](const PropertyValue &value) {
+                    return HasVector(value, vector, dimension);
+                  },
+                  oldest_active_start_timestamp)) {
+            obsolete.push_back(node);
+          }
+        }
+      }
+      if (obsolete.empty()) {
+        return;
+      }
+
+      auto graph = synchronized_graph.Lock();
+      for (const auto node : obsolete) {
+        auto &item = graph->nodes[node];
+        // The value may have been set again in the meantime.
+        if (item.timestamp >= oldest_active_start_timestamp) {
+          continue;
+        }
+        auto [first, last] = graph->nodes_by_vertex.equal_range(item.vertex);
+        graph->nodes_by_vertex.erase(std::find_if(first, last, [node](const auto &entry) {
+          return entry.second == node;
+        }));
+        item.vertex = nullptr;
+        ++graph->removed_count;
+      }
+      if (graph->removed_count * 2 <= graph->nodes.size()) {
+        return;
+      }
+      // Removed nodes slow down searches, so the graph is rebuilt from the
+      // remaining nodes once they are the minority.
+      Graph rebuilt;
+      for (uint32_t node = 0; node < graph->nodes.size(); ++node) {
+        const auto &item = graph->nodes[node];
+        if (item.vertex != nullptr) {
+          rebuilt.Insert(item.vertex, item.timestamp, {graph->Vector(node), graph->dimension});
+        }
+      }
+      *graph = std::move(rebuilt);
+    });
+  }
+}
+
+uint64_t InMemoryVectorIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Vector index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  auto graph = it->second.ReadLock();
+  return graph->nodes.size() - graph->removed_count;
+}
+
+std::vector<std::pair<VertexAccessor, double>> InMemoryVectorIndex::Search(LabelId label, PropertyId property,
+                                                                           const std::vector<float> &query,
+                                                                           uint64_t limit, VectorMetric metric,
+                                                                           View view, Transaction *transaction,
+                                                                           Constraints *constraints) {
+  auto it = index_.find({label, property});
+  MG_ASSERT(it != index_.end(), "Vector index for label {} and property {} doesn't exist", label.AsUint(),
+            property.AsUint());
+  auto graph = it->second.ReadLock();
+  if (limit == 0 || graph->nodes.empty() || query.size() != graph->dimension) {
+    return {};
+  }
+
+  // The graph links L2 neighbours, which are only the cosine neighbours of
+  // normalized vectors, so cosine searches look at more candidates.
+  const size_t beam_factor = metric == VectorMetric::COSINE ? 4 : 2;
+  auto ef = std::max(kMinSearchEf, std::min<size_t>(limit, graph->nodes.size()) * beam_factor);
+  std::vector<std::pair<VertexAccessor, double>> results;
+  while (true) {
+    results.clear();
+    std::unordered_set<Vertex *> found;
+    for (const auto &candidate : graph->Search(query.data(), ef)) {
+      const auto node = candidate.second;
+      auto *vertex = graph->nodes[node].vertex;
+      if (vertex == nullptr || found.contains(vertex)) {
+        continue;
+      }
+      // A vertex has a node for each of its indexed values, but only the node
+      // of the visible value yields it.
+      const auto *vector = graph->Vector(node);
+      auto value = CurrentVersionLabelPropertyValue(*vertex, label, property, transaction, view);
+      if (!value || !HasVector(*value, vector, graph->dimension)) {
+        continue;
+      }
+      found.insert(vertex);
+      results.emplace_back(VertexAccessor(vertex, transaction, indices_, constraints, config_.items),
+                           VectorDistance(metric, query.data(), vector, graph->dimension));
+    }
+    if (results.size() >= limit || ef >= graph->nodes.size()) {
+      break;
+    }
+    // Too many of the candidates are removed or not visible to the
+    // transaction.
+    ef *= 2;
+  }
+
+  const auto by_distance = [](const auto &lhs, const auto &rhs) { return lhs.second < rhs.second; };
+  if (results.size() > limit) {
+    std::partial_sort(results.begin(), results.begin() + static_cast<int64_t>(limit), results.end(), by_distance);
+    results.resize(limit);
+  } else {
+    std::sort(results.begin(), results.end(), by_distance);
+  }
+  return results;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,127 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <random>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/vector_index.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "utils/rw_lock.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Keeps a hierarchical navigable small world (HNSW) graph per index. The
+/// graph is built with the L2 distance, cosine searches walk it with a wider
+/// beam and rank the candidates by their exact cosine distance.
+class InMemoryVectorIndex : public storage::VectorIndex {
+ private:
+  /// A vertex has a node for each of its indexed values. Nodes are never
+  /// erased, the nodes of obsolete values are marked as removed and are only
+  /// used to navigate the graph until it is rebuilt.
+  struct Node {
+    // `nullptr` if the node is removed.
+    Vertex *vertex;
+    uint64_t timestamp;
+    // The neighbours on each level, from level 0 up to the level of the node.
+    std::vector<std::vector<uint32_t>> neighbours;
+  };
+
+  struct Graph {
+    const float *Vector(uint32_t node) const { return vectors.data() + static_cast<size_t>(node) * dimension; }
+
+    /// @throw std::bad_alloc
+    void Insert(Vertex *vertex, uint64_t timestamp, std::span<const float> vector);
+
+    /// Returns up to `ef` nodes close to `query` with their squared L2
+    /// distances, ordered by ascending distance. Removed nodes are included.
+    std::vector<std::pair<float, uint32_t>> Search(const float *query, size_t ef) const;
+
+    // 0 until the first vector is inserted.
+    size_t dimension{0};
+    // The vectors of the nodes, `dimension` values each.
+    std::vector<float> vectors;
+    std::vector<Node> nodes;
+    std::unordered_multimap<Vertex *, uint32_t> nodes_by_vertex;
+    uint32_t entry_point{0};
+    uint64_t removed_count{0};
+    std::mt19937_64 level_generator{0};
+
+   private:
+    std::vector<std::pair<float, uint32_t>> SearchLevel(const float *query,
+                                                        std::vector<std::pair<float, uint32_t>> entry_points,
+                                                        size_t ef, size_t level) const;
+
+    std::vector<uint32_t> SelectNeighbours(std::vector<std::pair<float, uint32_t>> candidates,
+                                           size_t max_neighbours) const;
+  };
+
+  using SynchronizedGraph = utils::Synchronized<Graph, utils::WritePrioritizedRWLock>;
+
+ public:
+  InMemoryVectorIndex(Indices *indices, const Config &config);
+
+  /// Graph insertions are serialized, so the index is always built on a
+  /// single thread.
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
+
+  void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_after_update, const Transaction &tx) override {}
+
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
+                           const Transaction &tx) override;
+
+  bool DropIndex(LabelId label, PropertyId property) override;
+
+  bool IndexExists(LabelId label, PropertyId property) const override;
+
+  std::vector<std::pair<LabelId, PropertyId>> ListIndices() const override;
+
+  /// Marks the nodes of values which no transaction can see anymore as
+  /// removed, and rebuilds graphs in which most nodes are removed.
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp);
+
+  /// Appends one task per index to `tasks`, see
+  /// `InMemoryLabelIndex::AppendRemoveObsoleteEntriesTasks`.
+  void AppendRemoveObsoleteEntriesTasks(uint64_t oldest_active_start_timestamp,
+                                        std::vector<std::function<void()>> &tasks);
+
+  /// Returns the number of nodes which aren't removed.
+  uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
+
+  /// Returns at most `limit` vertices whose value of the property is close to
+  /// `query` by `metric`, ordered by ascending distance. The result is
+  /// approximate, some of the nearest vertices may be missing. Returns no
+  /// vertices if `query` doesn't have the dimension of the index.
+  std::vector<std::pair<VertexAccessor, double>> Search(LabelId label, PropertyId property,
+                                                        const std::vector<float> &query, uint64_t limit,
+                                                        VectorMetric metric, View view, Transaction *transaction,
+                                                        Constraints *constraints);
+
+ private:
+  std::map<std::pair<LabelId, PropertyId>, SynchronizedGraph> index_;
+  std::unordered_map<PropertyId, std::vector<std::pair<LabelId, SynchronizedGraph *>>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
@@ -15,13 +15,37 @@
 #include <cstdint>
 #include <optional>
 
+#include "storage/v2/access_counters.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/rocksdb_serialization.hpp"
 
+namespace memgraph::metrics {
+extern const Event DeltaChainLength;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
+/// One in this many reads of objects with deltas measures the number of the
+/// applied deltas, so that the histogram's lock is rarely taken.
+inline constexpr uint64_t kDeltaChainSampleInterval = 64;
+
+/// Reads of objects with deltas done by the current thread.
+inline thread_local uint64_t delta_chain_reads = 0;
+
+/// Returns true if the transaction has to apply the deltas of an object, whose
+/// newest delta is `delta`, to read it. Deltas are never applied in
+/// IsolationLevel::READ_UNCOMMITTED. Analytical transactions don't create
+/// deltas and never run together with transactional ones, so the deltas left
+/// by those were committed before they started and don't change what they
+/// see. Otherwise, the object is read as it is.
+inline bool NeedsDeltasForRead(Transaction const *transaction, const Delta *delta) {
+  return delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED &&
+         transaction->storage_mode != StorageMode::IN_MEMORY_ANALYTICAL;
+}
+
 /// This function iterates through the undo buffers from an object (starting
 /// from the supplied delta) and determines what deltas should be applied to get
 /// the currently visible version of the object. When the function finds a delta
@@ -32,9 +56,7 @@ namespace memgraph::storage {
 template <typename TCallback>
 inline std::size_t ApplyDeltasForRead(Transaction const *transaction, const Delta *delta, View view,
                                       const TCallback &callback) {
-  // Avoid work if no deltas or
-  // IsolationLevel::READ_UNCOMMITTED, where deltas are never applied
-  if (!delta || transaction->isolation_level == IsolationLevel::READ_UNCOMMITTED) return 0;
+  if (!NeedsDeltasForRead(transaction, delta)) return 0;
 
   // if the transaction is not committed, then its deltas have transaction_id for the timestamp, otherwise they have
   // its commit timestamp set.
@@ -83,6 +105,10 @@ inline std::size_t ApplyDeltasForRead(Transaction const *transaction, const Delt
     // Move to the next delta.
     delta = delta->next.load(std::memory_order_acquire);
   }
+  access_counters.delta_steps += n_processed;
+  if (++delta_chain_reads % kDeltaChainSampleInterval == 0) {
+    metrics::Measure(metrics::DeltaChainLength, n_processed);
+  }
   return n_processed;
 }
 
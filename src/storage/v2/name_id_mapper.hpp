@@ -11,38 +11,51 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <bit>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include "utils/logging.hpp"
-#include "utils/skip_list.hpp"
+#include "utils/rw_spin_lock.hpp"
 
 namespace memgraph::storage {
 
+/// Maps names to ids and back. The mappings are never removed.
+///
+/// Names are kept in a hash map split into shards, each guarded by its own
+/// reader-writer spin lock, and are looked up by `std::string_view` without
+/// making a temporary `std::string`. Ids are mapped to names by an
+/// append-only array of pointers to the names in the hash map, so `IdToName`
+/// is a lock-free indexed load. The array grows by adding segments which are
+/// twice as large as the previous one and are never moved, so elements of the
+/// array and the names they point to stay valid.
 class NameIdMapper {
  private:
-  struct MapNameToId {
-    std::string name;
-    uint64_t id;
-
-    bool operator<(const MapNameToId &other) const { return name < other.name; }
-    bool operator==(const MapNameToId &other) const { return name == other.name; }
-
-    bool operator<(const std::string_view other) const { return name < other; }
-    bool operator==(const std::string_view other) const { return name == other; }
+  struct NameHash {
+    using is_transparent = void;
+    size_t operator()(const std::string_view name) const { return std::hash<std::string_view>{}(name); }
   };
 
-  struct MapIdToName {
-    uint64_t id;
-    std::string name;
+  struct alignas(64) Shard {
+    mutable utils::RWSpinLock lock;
+    std::unordered_map<std::string, uint64_t, NameHash, std::equal_to<>> name_to_id;
+  };
 
-    bool operator<(const MapIdToName &other) const { return id < other.id; }
-    bool operator==(const MapIdToName &other) const { return id == other.id; }
+  using IdSlot = std::atomic<const std::string *>;
 
-    bool operator<(uint64_t other) const { return id < other; }
-    bool operator==(uint64_t other) const { return id == other; }
-  };
+  static constexpr size_t kShards = 16;
+  // The first segment has `kFirstSegmentSize` slots and every following
+  // segment is twice as large as the previous one, so 64 segments cover all of
+  // the ids.
+  static constexpr uint64_t kFirstSegmentSize = 64;
+  static constexpr size_t kSegments = 64;
 
  public:
   explicit NameIdMapper() = default;
@@ -52,46 +65,56 @@ class NameIdMapper {
   NameIdMapper(NameIdMapper &&) = delete;
   NameIdMapper &operator=(NameIdMapper &&) = delete;
 
-  virtual ~NameIdMapper() = default;
+  virtual ~NameIdMapper() {
+    for (auto &segment : id_to_name_) {
+      delete[] segment.load(std::memory_order_acquire);
+    }
+  }
 
   /// @throw std::bad_alloc if unable to insert a new mapping
   virtual uint64_t NameToId(const std::string_view name) {
-    auto name_to_id_acc = name_to_id_.access();
-    auto found = name_to_id_acc.find(name);
-    uint64_t id;
-    if (found == name_to_id_acc.end()) {
-      uint64_t new_id = counter_.fetch_add(1, std::memory_order_acq_rel);
-      // Try to insert the mapping with the `new_id`, but use the id that is in
-      // the object itself. The object that cointains the mapping is designed to
-      // be a map, so that if the inserted name already exists `insert` will
-      // return an iterator to the existing item. This prevents assignment of
-      // two IDs to the same name when the mapping is being inserted
-      // concurrently from two threads. One ID is wasted in that case, though.
-      id = name_to_id_acc.insert({std::string(name), new_id}).first->id;
-    } else {
-      id = found->id;
+    auto &shard = ShardOf(name);
+    {
+      std::shared_lock guard(shard.lock);
+      if (auto found = shard.name_to_id.find(name); found != shard.name_to_id.end()) [[likely]] {
+        // The thread which inserted the name may not have published the id to
+        // name mapping yet, and both mappings have to exist when this returns.
+        PublishName(found->second, found->first);
+        return found->second;
+      }
     }
-    auto id_to_name_acc = id_to_name_.access();
-    // We have to try to insert the ID to name mapping even if we are not the
-    // one who assigned the ID because we have to make sure that after this
-    // method returns that both mappings exist.
-    if (id_to_name_acc.find(id) == id_to_name_acc.end()) {
-      // We first try to find the `id` in the map to avoid making an unnecessary
-      // temporary memory allocation when the object already exists.
-      id_to_name_acc.insert({id, std::string(name)});
+    std::unique_lock guard(shard.lock);
+    auto [it, inserted] = shard.name_to_id.try_emplace(std::string(name), 0);
+    if (inserted) {
+      // The id is taken only after the name is known to be new, so no id is
+      // wasted when the same name is inserted concurrently.
+      it->second = counter_.fetch_add(1, std::memory_order_acq_rel);
     }
-    return id;
+    PublishName(it->second, it->first);
+    return it->second;
+  }
+
+  /// Maps `name` to `id` unless `name` is already mapped or ids from `id` up
+  /// might have been assigned, in which case this is `NameToId(name)`. Used
+  /// by the recovery to keep the ids the names had when they were persisted.
+  /// @throw std::bad_alloc if unable to insert a new mapping
+  uint64_t NameToIdPreferring(const std::string_view name, uint64_t id) {
+    if (MaybeNameToId(name)) return NameToId(name);
+    auto counter = counter_.load(std::memory_order_acquire);
+    while (counter <= id) {
+      if (!counter_.compare_exchange_weak(counter, id + 1, std::memory_order_acq_rel)) continue;
+      // Nobody else can get `id` now. If `name` was inserted concurrently the
+      // existing id is used.
+      return InsertMapping(name, id).first;
+    }
+    return NameToId(name);
   }
 
   // NOTE: Currently this function returns a `const std::string &` instead of a
-  // `std::string` to avoid making unnecessary copies of the string.
-  // Usually, this wouldn't be correct because the accessor to the
-  // `utils::SkipList` is destroyed in this function and that removes the
-  // guarantee that the reference to the value contained in the list will be
-  // valid.
-  // Currently, we never delete anything from the `utils::SkipList` so the
-  // references will always be valid. If you change this class to remove unused
-  // names, be sure to change the signature of this function.
+  // `std::string` to avoid making unnecessary copies of the string. The
+  // reference is valid because the names are never removed from the mapper.
+  // If you change this class to remove unused names, be sure to change the
+  // signature of this function.
   virtual const std::string &IdToName(uint64_t id) {
     auto maybe_name = MaybeIdToName(id);
     MG_ASSERT(maybe_name.has_value(), "Trying to get a name for an invalid ID!");
@@ -100,16 +123,78 @@ class NameIdMapper {
 
  protected:
   std::optional<std::reference_wrapper<const std::string>> MaybeIdToName(uint64_t id) const {
-    auto id_to_name_acc = id_to_name_.access();
-    auto result = id_to_name_acc.find(id);
-    if (result == id_to_name_acc.end()) {
-      return std::nullopt;
+    const auto [segment_index, offset] = Locate(id);
+    const auto *segment = id_to_name_[segment_index].load(std::memory_order_acquire);
+    if (segment == nullptr) return std::nullopt;
+    const auto *name = segment[offset].load(std::memory_order_acquire);
+    if (name == nullptr) return std::nullopt;
+    return *name;
+  }
+
+  std::optional<uint64_t> MaybeNameToId(const std::string_view name) const {
+    const auto &shard = ShardOf(name);
+    std::shared_lock guard(shard.lock);
+    auto found = shard.name_to_id.find(name);
+    if (found == shard.name_to_id.end()) return std::nullopt;
+    return found->second;
+  }
+
+  /// Maps `name` to `id` and back unless `name` is already mapped, in which
+  /// case its existing mapping is kept. Returns the id of `name` and the name
+  /// stored in the mapper.
+  /// @throw std::bad_alloc if unable to insert a new mapping
+  std::pair<uint64_t, const std::string &> InsertMapping(const std::string_view name, uint64_t id) {
+    auto &shard = ShardOf(name);
+    std::unique_lock guard(shard.lock);
+    auto it = shard.name_to_id.try_emplace(std::string(name), id).first;
+    PublishName(it->second, it->first);
+    return {it->second, it->first};
+  }
+
+  /// Returns the number of mapped names.
+  uint64_t Size() const {
+    uint64_t size = 0;
+    for (const auto &shard : name_to_id_) {
+      std::shared_lock guard(shard.lock);
+      size += shard.name_to_id.size();
     }
-    return result->name;
+    return size;
   }
 
   std::atomic<uint64_t> counter_{0};
-  utils::SkipList<MapNameToId> name_to_id_;
-  utils::SkipList<MapIdToName> id_to_name_;
+
+ private:
+  Shard &ShardOf(const std::string_view name) { return name_to_id_[NameHash{}(name) % kShards]; }
+  const Shard &ShardOf(const std::string_view name) const { return name_to_id_[NameHash{}(name) % kShards]; }
+
+  // Returns the segment containing the slot of `id` and the offset of the slot
+  // in the segment.
+  static std::pair<size_t, uint64_t> Locate(uint64_t id) {
+    const auto block = id / kFirstSegmentSize + 1;
+    const auto segment_index = static_cast<size_t>(std::bit_width(block) - 1);
+    return {segment_index, id - kFirstSegmentSize * ((uint64_t{1} << segment_index) - 1)};
+  }
+
+  // Stores the pointer to `name` in the slot of `id`, adding the segment of the
+  // slot if it doesn't exist yet.
+  void PublishName(uint64_t id, const std::string &name) {
+    const auto [segment_index, offset] = Locate(id);
+    auto &segment = id_to_name_[segment_index];
+    auto *slots = segment.load(std::memory_order_acquire);
+    if (slots == nullptr) [[unlikely]] {
+      auto *new_slots = new IdSlot[kFirstSegmentSize << segment_index]{};
+      if (segment.compare_exchange_strong(slots, new_slots, std::memory_order_acq_rel)) {
+        slots = new_slots;
+      } else {
+        delete[] new_slots;
+      }
+    }
+    if (slots[offset].load(std::memory_order_relaxed) == nullptr) {
+      slots[offset].store(&name, std::memory_order_release);
+    }
+  }
+
+  std::array<Shard, kShards> name_to_id_;
+  std::array<std::atomic<IdSlot *>, kSegments> id_to_name_{};
 };
 }  // namespace memgraph::storage
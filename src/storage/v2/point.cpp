@@ -0,0 +1,49 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/point.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "utils/string.hpp"
+
+namespace memgraph::storage {
+
+std::optional<CoordinateReferenceSystem> StringToCrs(std::string_view name) {
+  const auto lowercase_name = utils::ToLowerCase(name);
+  for (const auto crs : {CoordinateReferenceSystem::Cartesian2d, CoordinateReferenceSystem::Cartesian3d,
+                         CoordinateReferenceSystem::Wgs84_2d, CoordinateReferenceSystem::Wgs84_3d}) {
+    if (CrsToString(crs) == lowercase_name) return crs;
+  }
+  return std::nullopt;
+}
+
+std::optional<double> Distance(const Point &a, const Point &b) {
+  if (a.crs != b.crs) return std::nullopt;
+  const auto dz = a.z - b.z;
+  if (!IsGeographic(a.crs)) {
+    const auto dx = a.x - b.x;
+    const auto dy = a.y - b.y;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+  constexpr double kRadiansPerDegree = std::numbers::pi / 180.0;
+  const auto lat_a = a.y * kRadiansPerDegree;
+  const auto lat_b = b.y * kRadiansPerDegree;
+  const auto sin_dlat = std::sin((lat_b - lat_a) / 2.0);
+  const auto sin_dlon = std::sin((b.x - a.x) * kRadiansPerDegree / 2.0);
+  const auto h = sin_dlat * sin_dlat + std::cos(lat_a) * std::cos(lat_b) * sin_dlon * sin_dlon;
+  const auto surface_distance = 2.0 * kEarthRadiusMeters * std::asin(std::min(1.0, std::sqrt(h)));
+  return std::sqrt(surface_distance * surface_distance + dz * dz);
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,104 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+namespace memgraph::storage {
+
+/// Coordinate reference systems of points. The values are the SRIDs which are
+/// also used by Bolt clients.
+enum class CoordinateReferenceSystem : uint16_t {
+  Cartesian2d = 7203,
+  Cartesian3d = 9157,
+  Wgs84_2d = 4326,
+  Wgs84_3d = 4979,
+};
+
+constexpr std::string_view CrsToString(const CoordinateReferenceSystem crs) {
+  switch (crs) {
+    case CoordinateReferenceSystem::Cartesian2d:
+      return "cartesian";
+    case CoordinateReferenceSystem::Cartesian3d:
+      return "cartesian-3d";
+    case CoordinateReferenceSystem::Wgs84_2d:
+      return "wgs-84";
+    case CoordinateReferenceSystem::Wgs84_3d:
+      return "wgs-84-3d";
+  }
+}
+
+/// Returns the coordinate reference system with the given SRID.
+constexpr std::optional<CoordinateReferenceSystem> SridToCrs(const int64_t srid) {
+  switch (srid) {
+    case static_cast<int64_t>(CoordinateReferenceSystem::Cartesian2d):
+      return CoordinateReferenceSystem::Cartesian2d;
+    case static_cast<int64_t>(CoordinateReferenceSystem::Cartesian3d):
+      return CoordinateReferenceSystem::Cartesian3d;
+    case static_cast<int64_t>(CoordinateReferenceSystem::Wgs84_2d):
+      return CoordinateReferenceSystem::Wgs84_2d;
+    case static_cast<int64_t>(CoordinateReferenceSystem::Wgs84_3d):
+      return CoordinateReferenceSystem::Wgs84_3d;
+    default:
+      return std::nullopt;
+  }
+}
+
+/// Returns the coordinate reference system with the given name, as returned by
+/// `CrsToString`. The name is case insensitive.
+std::optional<CoordinateReferenceSystem> StringToCrs(std::string_view name);
+
+constexpr bool IsGeographic(const CoordinateReferenceSystem crs) {
+  return crs == CoordinateReferenceSystem::Wgs84_2d || crs == CoordinateReferenceSystem::Wgs84_3d;
+}
+
+constexpr bool Is3d(const CoordinateReferenceSystem crs) {
+  return crs == CoordinateReferenceSystem::Cartesian3d || crs == CoordinateReferenceSystem::Wgs84_3d;
+}
+
+/// A 2D or 3D point. Geographic points keep the longitude in `x`, the
+/// latitude in `y` and the height in meters in `z`. `z` is 0 for 2D points.
+struct Point {
+  constexpr Point(CoordinateReferenceSystem crs, double x, double y, double z = 0.0) : crs{crs}, x{x}, y{y}, z{z} {}
+
+  auto operator<=>(const Point &) const = default;
+  friend std::ostream &operator<<(std::ostream &os, const Point &p) {
+    os << "POINT({";
+    if (IsGeographic(p.crs)) {
+      os << "longitude: " << p.x << ", latitude: " << p.y;
+      if (Is3d(p.crs)) os << ", height: " << p.z;
+    } else {
+      os << "x: " << p.x << ", y: " << p.y;
+      if (Is3d(p.crs)) os << ", z: " << p.z;
+    }
+    return os << ", srid: " << static_cast<uint16_t>(p.crs) << "})";
+  }
+
+  CoordinateReferenceSystem crs;
+  double x;
+  double y;
+  double z;
+};
+
+/// Mean radius of the Earth in meters, used for distances between geographic
+/// points.
+inline constexpr double kEarthRadiusMeters = 6378140.0;
+
+/// Returns the distance between `a` and `b`, or `std::nullopt` if they are in
+/// different coordinate reference systems. Cartesian distances are Euclidean,
+/// geographic distances are the great-circle (haversine) distance in meters,
+/// combined with the difference of heights for 3D points.
+std::optional<double> Distance(const Point &a, const Point &b);
+
+}  // namespace memgraph::storage
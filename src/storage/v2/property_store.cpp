@@ -20,7 +20,10 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
+#include "storage/v2/point.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/logging.hpp"
@@ -57,7 +60,10 @@ namespace {
 // usage with the cost of a higher time complexity of the operations that
 // access the store. Compared to a `std::map<PropertyValue>`, the
 // `PropertyStore` uses approximately 10 times less memory. But, the time
-// complexity of its get and set operations is O(n) instead of O(log(n)).
+// complexity of its get and set operations is O(n) instead of O(log(n)). Stores
+// with a lot of properties additionally keep a directory of property positions
+// (see `kPropertyDirectoryMarker` below) so that their get operations take
+// O(log(n)) time.
 //
 // The values themselves are stored encoded in a flat buffer. On an insertion
 // the underlying storage buffer is resized if necessary and on removal the
@@ -94,7 +100,9 @@ enum class Size : uint8_t {
 };
 
 // All of these values must have the lowest 4 bits set to zero because they are
-// used to store two `Size` values as described in the comment above.
+// used to store two `Size` values as described in the comment above. The value
+// 0x90 is reserved for the marker of the property directory (see
+// `kPropertyDirectoryMarker` below).
 enum class Type : uint8_t {
   EMPTY = 0x00,  // Special value used to indicate end of buffer.
   NONE = 0x10,   // NONE used instead of NULL because NULL is defined to
@@ -105,7 +113,9 @@ enum class Type : uint8_t {
   STRING = 0x50,
   LIST = 0x60,
   MAP = 0x70,
-  TEMPORAL_DATA = 0x80
+  TEMPORAL_DATA = 0x80,
+  DICTIONARY_STRING = 0xa0,
+  POINT = 0xb0
 };
 
 const uint8_t kMaskType = 0xf0;
@@ -113,6 +123,12 @@ const uint8_t kMaskIdSize = 0x0c;
 const uint8_t kMaskPayloadSize = 0x03;
 const uint8_t kShiftIdSize = 2;
 
+uint64_t SizeToBytes(Size size) { return 1ULL << static_cast<uint8_t>(size); }
+
+// Strings shorter than this are always stored in full because a dictionary
+// code wouldn't make them much smaller.
+const uint64_t kDictionaryStringMinSize = 4;
+
 // Values are encoded as follows:
 //   * NULL
 //     - type; payload size is not used
@@ -167,6 +183,20 @@ const uint8_t kShiftIdSize = 2;
 //         or `uint64_t`
 //       + encoded temporal data type value
 //       + encoded microseconds value
+//   * POINT
+//     - type; payload size is used to indicate whether the SRID is encoded as
+//       `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`
+//     - encoded property ID
+//     - encoded SRID
+//     - the coordinates encoded as 8 byte doubles, 2 or 3 of them depending on
+//       the SRID
+//   * DICTIONARY_STRING
+//     - type; payload size is used to indicate whether the code is encoded as
+//       `uint8_t`, `uint16_t`, `uint32_t` or `uint64_t`
+//     - encoded property ID
+//     - encoded code of the string in the `PropertyStringDictionary`
+//     Only the values of dictionary encoded properties are encoded like this,
+//     string items of lists and maps are always encoded as STRING.
 
 struct Metadata {
   Type type{Type::EMPTY};
@@ -235,6 +265,21 @@ class Writer {
     }
   }
 
+  // Writes the value using exactly the given size, which must be large enough
+  // to hold the value.
+  bool WriteUint(uint64_t value, Size size) {
+    switch (size) {
+      case Size::INT8:
+        return InternalWriteInt<uint8_t>(value);
+      case Size::INT16:
+        return InternalWriteInt<uint16_t>(value);
+      case Size::INT32:
+        return InternalWriteInt<uint32_t>(value);
+      case Size::INT64:
+        return InternalWriteInt<uint64_t>(value);
+    }
+  }
+
   std::optional<Size> WriteDouble(double value) { return WriteUint(utils::MemcpyCast<uint64_t>(value)); }
 
   bool WriteBytes(const uint8_t *data, uint64_t size) {
@@ -469,6 +514,19 @@ std::optional<std::pair<Type, Size>> EncodePropertyValue(Writer *writer, const P
       // We don't need payload size so we set it to a random value
       return {{Type::TEMPORAL_DATA, Size::INT8}};
     }
+    case PropertyValue::Type::Point: {
+      const auto point = value.ValuePoint();
+      auto srid_size = writer->WriteUint(utils::UnderlyingCast(point.crs));
+      if (!srid_size) return std::nullopt;
+      if (!writer->WriteUint(utils::MemcpyCast<uint64_t>(point.x), Size::INT64) ||
+          !writer->WriteUint(utils::MemcpyCast<uint64_t>(point.y), Size::INT64)) {
+        return std::nullopt;
+      }
+      if (Is3d(point.crs) && !writer->WriteUint(utils::MemcpyCast<uint64_t>(point.z), Size::INT64)) {
+        return std::nullopt;
+      }
+      return {{Type::POINT, *srid_size}};
+    }
   }
 }
 
@@ -486,6 +544,22 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
   return TemporalData{static_cast<TemporalType>(*type_value), *microseconds_value};
 }
 
+std::optional<Point> DecodePoint(Reader &reader, Size payload_size) {
+  auto srid = reader.ReadUint(payload_size);
+  if (!srid) return std::nullopt;
+  auto crs = SridToCrs(static_cast<int64_t>(*srid));
+  if (!crs) return std::nullopt;
+
+  auto x = reader.ReadDouble(Size::INT64);
+  if (!x) return std::nullopt;
+  auto y = reader.ReadDouble(Size::INT64);
+  if (!y) return std::nullopt;
+  if (!Is3d(*crs)) return Point{*crs, *x, *y};
+  auto z = reader.ReadDouble(Size::INT64);
+  if (!z) return std::nullopt;
+  return Point{*crs, *x, *y, *z};
+}
+
 }  // namespace
 
 // Function used to decode a PropertyValue from a byte stream.
@@ -569,6 +643,18 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return true;
     }
+    case Type::POINT: {
+      const auto maybe_point = DecodePoint(*reader, payload_size);
+      if (!maybe_point) return false;
+      value = PropertyValue(*maybe_point);
+      return true;
+    }
+    case Type::DICTIONARY_STRING: {
+      auto code = reader->ReadUint(payload_size);
+      if (!code) return false;
+      value = PropertyValue(GetPropertyStringDictionary().Decode(*code));
+      return true;
+    }
   }
 }
 
@@ -625,6 +711,12 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
     case Type::TEMPORAL_DATA: {
       return DecodeTemporalData(*reader).has_value();
     }
+    case Type::POINT: {
+      return DecodePoint(*reader, payload_size).has_value();
+    }
+    case Type::DICTIONARY_STRING: {
+      return reader->SkipBytes(SizeToBytes(payload_size));
+    }
   }
 }
 
@@ -725,18 +817,40 @@ std::optional<TemporalData> DecodeTemporalData(Reader &reader) {
 
       return *maybe_temporal_data == value.ValueTemporalData();
     }
+    case Type::POINT: {
+      if (!value.IsPoint()) return false;
+      const auto maybe_point = DecodePoint(*reader, payload_size);
+      return maybe_point && *maybe_point == value.ValuePoint();
+    }
+    case Type::DICTIONARY_STRING: {
+      if (!value.IsString()) return false;
+      auto code = reader->ReadUint(payload_size);
+      if (!code) return false;
+      // The value stays in the dictionary, so it isn't copied.
+      return GetPropertyStringDictionary().Decode(*code) == value.ValueString();
+    }
   }
 }
 
 // Function used to encode a property (PropertyId, PropertyValue) into a byte
-// stream.
-bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value) {
+// stream. String values of the properties in `dictionary_encoded_properties`
+// are encoded as codes of the `PropertyStringDictionary`.
+bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value,
+                    const DictionaryEncodedProperties *dictionary_encoded_properties) {
   auto metadata = writer->WriteMetadata();
   if (!metadata) return false;
 
   auto id_size = writer->WriteUint(property.AsUint());
   if (!id_size) return false;
 
+  if (dictionary_encoded_properties && value.IsString() && value.ValueString().size() >= kDictionaryStringMinSize &&
+      dictionary_encoded_properties->contains(property)) {
+    auto code_size = writer->WriteUint(GetPropertyStringDictionary().Encode(value.ValueString()));
+    if (!code_size) return false;
+    metadata->Set({Type::DICTIONARY_STRING, *id_size, *code_size});
+    return true;
+  }
+
   auto type_property_size = EncodePropertyValue(writer, value);
   if (!type_property_size) return false;
 
@@ -901,6 +1015,7 @@ struct SpecificPropertyAndBufferInfo {
   uint64_t all_begin;
   uint64_t all_end;
   uint64_t all_size;
+  uint64_t property_count;
 };
 
 // Function used to find the position where the property should be in the data
@@ -911,7 +1026,7 @@ struct SpecificPropertyAndBufferInfo {
 // If the function doesn't find the property, the `property_size` will be `0`
 // and `property_begin` will be equal to `property_end`. Positions and size of
 // all properties is always calculated (even if the specific property isn't
-// found).
+// found), as well as the number of properties currently stored in the buffer.
 //
 // @sa FindSpecificProperty
 SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader, PropertyId property) {
@@ -919,11 +1034,13 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
   uint64_t property_end = reader->GetPosition();
   uint64_t all_begin = reader->GetPosition();
   uint64_t all_end = reader->GetPosition();
+  uint64_t property_count = 0;
   while (true) {
     auto ret = HasExpectedProperty(reader, property);
     if (ret == ExpectedPropertyStatus::MISSING_DATA) {
       break;
     }
+    ++property_count;
     if (ret == ExpectedPropertyStatus::SMALLER) {
       property_begin = reader->GetPosition();
       property_end = reader->GetPosition();
@@ -932,7 +1049,8 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
     }
     all_end = reader->GetPosition();
   }
-  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin};
+  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin,
+          property_count};
 }
 
 // All data buffers will be allocated to a power of 8 size.
@@ -942,6 +1060,182 @@ uint64_t ToPowerOf8(uint64_t size) {
   return size - mod + 8;
 }
 
+// Finding a property in the buffer requires all of the properties that are
+// stored before it to be skipped, which gets expensive for vertices and edges
+// that have a lot of properties. That is why buffers that store at least
+// `kPropertyDirectoryMinProperties` properties are prefixed with a directory
+// that stores the position of each of the properties. Because the properties
+// are sorted by their ID, a property can then be found using a binary search
+// over the directory.
+//
+// The directory is encoded as follows:
+//   * header, which is a single byte whose bits are used as follows:
+//      0b0000 0000
+//        ++++      -> `kPropertyDirectoryMarker` (4 bits)
+//             ++   -> size of the number of properties (2 bits)
+//               ++ -> size of each of the offsets (2 bits)
+//   * encoded number of properties (`count`)
+//   * `count + 1` offsets, all of them encoded using the same size; the `i`-th
+//     offset is the position of the `i`-th property and the last offset is the
+//     position where the last property ends; the offsets are relative to the
+//     first byte after the directory
+//
+// The properties themselves (and the tombstone) are encoded after the
+// directory exactly as they would be encoded without it. The marker is chosen
+// so that it can't be the type of the first property, so buffers with and
+// without the directory can always be told apart. The directory is never used
+// for data stored in the local buffer.
+//
+// Modifying a buffer that has a directory always re-encodes the whole buffer,
+// which has the same O(n) complexity as the modification of a buffer without
+// the directory.
+const uint8_t kPropertyDirectoryMarker = 0x90;
+const uint64_t kPropertyDirectoryMinProperties = 16;
+
+// Struct used to access the directory of a buffer.
+struct PropertyDirectory {
+  uint64_t count;
+  Size offset_size;
+  const uint8_t *offsets;
+  // Position in the buffer where the first property starts.
+  uint64_t properties_begin;
+
+  uint64_t Offset(uint64_t index) const {
+    auto offset_bytes = SizeToBytes(offset_size);
+    Reader reader(offsets + index * offset_bytes, offset_bytes);
+    auto offset = reader.ReadUint(offset_size);
+    MG_ASSERT(offset, "Invalid database state!");
+    return *offset;
+  }
+};
+
+// Function used to read the directory from the start of the buffer.
+//
+// @return std::nullopt when the buffer doesn't have a directory
+std::optional<PropertyDirectory> ReadPropertyDirectory(const uint8_t *data, uint64_t size) {
+  if (size == 0 || (data[0] & kMaskType) != kPropertyDirectoryMarker) return std::nullopt;
+  Reader reader(data, size);
+  auto metadata = reader.ReadMetadata();
+  MG_ASSERT(metadata, "Invalid database state!");
+  auto count = reader.ReadUint(metadata->id_size);
+  MG_ASSERT(count, "Invalid database state!");
+  auto offsets_begin = reader.GetPosition();
+  auto properties_begin = offsets_begin + (*count + 1) * SizeToBytes(metadata->payload_size);
+  MG_ASSERT(properties_begin <= size, "Invalid database state!");
+  return PropertyDirectory{*count, metadata->payload_size, data + offsets_begin, properties_begin};
+}
+
+// Struct used to describe the directory that should be written in front of
+// the properties.
+struct PropertyDirectoryLayout {
+  Size count_size;
+  Size offset_size;
+  uint64_t size;
+};
+
+// Function used to calculate the layout of a directory for `count` properties
+// whose encoded size is `properties_size`.
+PropertyDirectoryLayout GetPropertyDirectoryLayout(uint64_t count, uint64_t properties_size) {
+  Writer writer;
+  auto count_size = *writer.WriteUint(count);
+  auto offset_size = *writer.WriteUint(properties_size);
+  return {count_size, offset_size, 1 + SizeToBytes(count_size) + (count + 1) * SizeToBytes(offset_size)};
+}
+
+// Function used to encode the directory. The `offsets` must contain `count + 1`
+// offsets as described above.
+bool EncodePropertyDirectory(Writer *writer, const PropertyDirectoryLayout &layout,
+                             const std::vector<uint64_t> &offsets) {
+  auto metadata = writer->WriteMetadata();
+  if (!metadata) return false;
+  if (!writer->WriteUint(offsets.size() - 1, layout.count_size)) return false;
+  for (auto offset : offsets) {
+    if (!writer->WriteUint(offset, layout.offset_size)) return false;
+  }
+  metadata->Set({static_cast<Type>(kPropertyDirectoryMarker), layout.count_size, layout.offset_size});
+  return true;
+}
+
+// Function used to find the position where the property should be in the data
+// buffer using its directory. The `data` and `size` describe the part of the
+// buffer that follows the directory. The returned info is the same as the one
+// returned by the linear search below.
+//
+// @sa FindSpecificPropertyAndBufferInfo
+SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(const PropertyDirectory &directory,
+                                                                const uint8_t *data, uint64_t size,
+                                                                PropertyId property) {
+  uint64_t low = 0;
+  uint64_t high = directory.count;
+  bool found = false;
+  while (low < high) {
+    auto middle = low + (high - low) / 2;
+    auto position = directory.Offset(middle);
+    MG_ASSERT(position < size, "Invalid database state!");
+    Reader reader(data + position, size - position);
+    auto metadata = reader.ReadMetadata();
+    MG_ASSERT(metadata, "Invalid database state!");
+    auto property_id = reader.ReadUint(metadata->id_size);
+    MG_ASSERT(property_id, "Invalid database state!");
+    if (*property_id < property.AsUint()) {
+      low = middle + 1;
+    } else if (*property_id > property.AsUint()) {
+      high = middle;
+    } else {
+      low = middle;
+      found = true;
+      break;
+    }
+  }
+  uint64_t property_begin = directory.Offset(low);
+  uint64_t property_end = found ? directory.Offset(low + 1) : property_begin;
+  uint64_t all_end = directory.Offset(directory.count);
+  return {property_begin, property_end, property_end - property_begin, 0, all_end, all_end, directory.count};
+}
+
+// Function used to find the position where the property should be in the data
+// buffer, using the directory if the buffer has one. The returned positions are
+// relative to `properties_begin`, which is set to the position of the first
+// property in the buffer.
+SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(const uint8_t *data, uint64_t size,
+                                                                PropertyId property, uint64_t *properties_begin) {
+  if (auto directory = ReadPropertyDirectory(data, size)) {
+    *properties_begin = directory->properties_begin;
+    return FindSpecificPropertyAndBufferInfo(*directory, data + directory->properties_begin,
+                                             size - directory->properties_begin, property);
+  }
+  *properties_begin = 0;
+  Reader reader(data, size);
+  return FindSpecificPropertyAndBufferInfo(&reader, property);
+}
+
+// Function used to get the positions of all of the properties that are stored
+// in the buffer and the position where the last of them ends. The `data` and
+// `size` describe the part of the buffer that follows the directory.
+std::vector<uint64_t> GetPropertyOffsets(const std::optional<PropertyDirectory> &directory, const uint8_t *data,
+                                         uint64_t size) {
+  std::vector<uint64_t> offsets;
+  if (directory) {
+    offsets.reserve(directory->count + 1);
+    for (uint64_t i = 0; i <= directory->count; ++i) {
+      offsets.push_back(directory->Offset(i));
+    }
+    return offsets;
+  }
+  Reader reader(data, size);
+  while (true) {
+    auto position = reader.GetPosition();
+    offsets.push_back(position);
+    auto metadata = reader.ReadMetadata();
+    if (!metadata) break;
+    if (!reader.ReadUint(metadata->id_size)) break;
+    // The tombstone can't be skipped, so the last offset always points to the
+    // position where the last property ends.
+    if (!SkipPropertyValue(&reader, metadata->type, metadata->payload_size)) break;
+  }
+  return offsets;
+}
+
 // The `PropertyStore` also uses a small buffer optimization in it. If the data
 // fits into the size of the internally stored pointer and size, then the
 // pointer and size are used as a in-place buffer. In order to be able to do
@@ -1031,6 +1325,16 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = ReadPropertyDirectory(data, size)) {
+    data += directory->properties_begin;
+    size -= directory->properties_begin;
+    auto info = FindSpecificPropertyAndBufferInfo(*directory, data, size, property);
+    if (info.property_size == 0) return {};
+    Reader reader(data + info.property_begin, info.property_size);
+    PropertyValue value;
+    if (DecodeExpectedProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
+    return value;
+  }
   Reader reader(data, size);
   PropertyValue value;
   if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
@@ -1046,6 +1350,11 @@ bool PropertyStore::HasProperty(PropertyId property) const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = ReadPropertyDirectory(data, size)) {
+    auto info = FindSpecificPropertyAndBufferInfo(*directory, data + directory->properties_begin,
+                                                  size - directory->properties_begin, property);
+    return info.property_size != 0;
+  }
   Reader reader(data, size);
   return ExistsSpecificProperty(&reader, property) == ExpectedPropertyStatus::EQUAL;
 }
@@ -1092,10 +1401,10 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
-  Reader reader(data, size);
-  auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
+  uint64_t properties_begin = 0;
+  auto info = FindSpecificPropertyAndBufferInfo(data, size, property, &properties_begin);
   if (info.property_size == 0) return value.IsNull();
-  Reader prop_reader(data + info.property_begin, info.property_size);
+  Reader prop_reader(data + properties_begin + info.property_begin, info.property_size);
   if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
   return prop_reader.GetPosition() == info.property_size;
 }
@@ -1109,6 +1418,10 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
     size = sizeof(buffer_) - 1;
     data = &buffer_[1];
   }
+  if (auto directory = ReadPropertyDirectory(data, size)) {
+    data += directory->properties_begin;
+    size -= directory->properties_begin;
+  }
   Reader reader(data, size);
   std::map<PropertyId, PropertyValue> props;
   while (true) {
@@ -1120,11 +1433,12 @@ std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
   return props;
 }
 
-bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value) {
+bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value,
+                                const DictionaryEncodedProperties *dictionary_encoded_properties) {
   uint64_t property_size = 0;
   if (!value.IsNull()) {
     Writer writer;
-    EncodeProperty(&writer, property, value);
+    EncodeProperty(&writer, property, value, dictionary_encoded_properties);
     property_size = writer.Written();
   }
 
@@ -1164,7 +1478,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
       // Encode the property into the data buffer.
       Writer writer(data, size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, dictionary_encoded_properties), "Invalid database state!");
       auto metadata = writer.WriteMetadata();
       if (metadata) {
         // If there is any space left in the buffer we add a tombstone to
@@ -1176,9 +1490,79 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       // to set a property to `Null` (we are trying to remove the property).
     }
   } else {
-    Reader reader(data, size);
-    auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
+    auto directory = ReadPropertyDirectory(data, size);
+    uint64_t properties_begin = 0;
+    auto info = FindSpecificPropertyAndBufferInfo(data, size, property, &properties_begin);
     existed = info.property_size != 0;
+    auto new_count = info.property_count - (existed ? 1 : 0) + (value.IsNull() ? 0 : 1);
+    if (directory || new_count >= kPropertyDirectoryMinProperties) {
+      // The buffer either already has a directory or it needs one now, so we
+      // re-encode the whole buffer.
+      const auto *properties = data + properties_begin;
+      auto old_offsets = GetPropertyOffsets(directory, properties, size - properties_begin);
+      std::vector<uint64_t> offsets;
+      offsets.reserve(new_count + 1);
+      for (auto offset : old_offsets) {
+        if (offset >= info.property_begin) break;
+        offsets.push_back(offset);
+      }
+      if (!value.IsNull()) offsets.push_back(info.property_begin);
+      for (auto offset : old_offsets) {
+        if (offset < info.property_end) continue;
+        offsets.push_back(offset - info.property_size + property_size);
+      }
+      auto new_properties_size = offsets.back();
+
+      std::optional<PropertyDirectoryLayout> layout;
+      uint64_t new_size = new_properties_size;
+      if (new_count >= kPropertyDirectoryMinProperties) {
+        layout = GetPropertyDirectoryLayout(new_count, new_properties_size);
+        new_size += layout->size;
+      }
+
+      uint8_t *current_data = nullptr;
+      uint64_t current_size = 0;
+      bool current_in_local_buffer = false;
+      if (new_size == 0) {
+        // We don't have any data to encode anymore.
+      } else if (!layout && new_size <= sizeof(buffer_) - 1) {
+        // Use the local buffer, the old data is still accessible through `data`
+        // because it can't be in the local buffer.
+        MG_ASSERT(!in_local_buffer, "Invalid database state!");
+        buffer_[0] = kUseLocalBuffer;
+        current_size = sizeof(buffer_) - 1;
+        current_data = &buffer_[1];
+        current_in_local_buffer = true;
+      } else {
+        current_size = ToPowerOf8(new_size);
+        current_data = new uint8_t[current_size];
+      }
+
+      if (current_data) {
+        Writer writer(current_data, current_size);
+        if (layout) {
+          MG_ASSERT(EncodePropertyDirectory(&writer, *layout, offsets), "Invalid database state!");
+        }
+        MG_ASSERT(writer.WriteBytes(properties, info.property_begin), "Invalid database state!");
+        if (!value.IsNull()) {
+          MG_ASSERT(EncodeProperty(&writer, property, value, dictionary_encoded_properties), "Invalid database state!");
+        }
+        MG_ASSERT(writer.WriteBytes(properties + info.property_end, info.all_end - info.property_end),
+                  "Invalid database state!");
+        auto metadata = writer.WriteMetadata();
+        if (metadata) {
+          metadata->Set({Type::EMPTY});
+        }
+      }
+
+      // Free the old buffer and permanently remember the new one.
+      if (!in_local_buffer) delete[] data;
+      if (!current_in_local_buffer) {
+        SetSizeData(buffer_, current_size, current_data);
+      }
+      return !existed;
+    }
+
     auto new_size = info.all_size - info.property_size + property_size;
     auto new_size_to_power_of_8 = ToPowerOf8(new_size);
     if (new_size_to_power_of_8 == 0) {
@@ -1229,7 +1613,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (!value.IsNull()) {
       // We need to encode the new value.
       Writer writer(data + info.property_begin, property_size);
-      MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+      MG_ASSERT(EncodeProperty(&writer, property, value, dictionary_encoded_properties), "Invalid database state!");
     }
 
     // We need to recreate the tombstone (if possible).
@@ -1244,7 +1628,8 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 }
 
 template <typename TContainer>
-bool PropertyStore::DoInitProperties(const TContainer &properties) {
+bool PropertyStore::DoInitProperties(const TContainer &properties,
+                                     const DictionaryEncodedProperties *dictionary_encoded_properties) {
   uint64_t size = 0;
   uint8_t *data = nullptr;
   std::tie(size, data) = GetSizeData(buffer_);
@@ -1253,19 +1638,28 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
   }
 
   uint64_t property_size = 0;
+  std::vector<uint64_t> offsets;
   {
     Writer writer;
     for (const auto &[property, value] : properties) {
       if (value.IsNull()) {
         continue;
       }
-      EncodeProperty(&writer, property, value);
+      offsets.push_back(writer.Written());
+      EncodeProperty(&writer, property, value, dictionary_encoded_properties);
       property_size = writer.Written();
     }
+    offsets.push_back(property_size);
+  }
+
+  std::optional<PropertyDirectoryLayout> layout;
+  if (offsets.size() - 1 >= kPropertyDirectoryMinProperties) {
+    layout = GetPropertyDirectoryLayout(offsets.size() - 1, property_size);
+    property_size += layout->size;
   }
 
   auto property_size_to_power_of_8 = ToPowerOf8(property_size);
-  if (property_size <= sizeof(buffer_) - 1) {
+  if (!layout && property_size <= sizeof(buffer_) - 1) {
     // Use the local buffer.
     buffer_[0] = kUseLocalBuffer;
     size = sizeof(buffer_) - 1;
@@ -1284,11 +1678,15 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
   // Encode the property into the data buffer.
   Writer writer(data, size);
 
+  if (layout) {
+    MG_ASSERT(EncodePropertyDirectory(&writer, *layout, offsets), "Invalid database state!");
+  }
+
   for (const auto &[property, value] : properties) {
     if (value.IsNull()) {
       continue;
     }
-    MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
+    MG_ASSERT(EncodeProperty(&writer, property, value, dictionary_encoded_properties), "Invalid database state!");
     writer.Written();
   }
 
@@ -1303,7 +1701,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
 }
 
 std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> PropertyStore::UpdateProperties(
-    std::map<PropertyId, PropertyValue> &properties) {
+    std::map<PropertyId, PropertyValue> &properties, const DictionaryEncodedProperties *dictionary_encoded_properties) {
   auto old_properties = Properties();
   ClearProperties();
 
@@ -1323,23 +1721,25 @@ std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> PropertyStore:
     }
   }
 
-  MG_ASSERT(InitProperties(properties));
+  MG_ASSERT(InitProperties(properties, dictionary_encoded_properties));
   return id_old_new_change;
 }
 
 template bool PropertyStore::DoInitProperties<std::map<PropertyId, PropertyValue>>(
-    const std::map<PropertyId, PropertyValue> &);
+    const std::map<PropertyId, PropertyValue> &, const DictionaryEncodedProperties *);
 template bool PropertyStore::DoInitProperties<std::vector<std::pair<PropertyId, PropertyValue>>>(
-    const std::vector<std::pair<PropertyId, PropertyValue>> &);
+    const std::vector<std::pair<PropertyId, PropertyValue>> &, const DictionaryEncodedProperties *);
 
-bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
-  return DoInitProperties(properties);
+bool PropertyStore::InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                                   const DictionaryEncodedProperties *dictionary_encoded_properties) {
+  return DoInitProperties(properties, dictionary_encoded_properties);
 }
 
-bool PropertyStore::InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties) {
+bool PropertyStore::InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties,
+                                   const DictionaryEncodedProperties *dictionary_encoded_properties) {
   std::sort(properties.begin(), properties.end());
 
-  return DoInitProperties(properties);
+  return DoInitProperties(properties, dictionary_encoded_properties);
 }
 
 bool PropertyStore::ClearProperties() {
@@ -13,12 +13,17 @@
 
 #include <map>
 #include <set>
+#include <unordered_set>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 
 namespace memgraph::storage {
 
+/// Properties whose string values are stored as codes of the
+/// `PropertyStringDictionary` instead of being stored in full.
+using DictionaryEncodedProperties = std::unordered_set<PropertyId>;
+
 class PropertyStore {
   static_assert(std::endian::native == std::endian::little,
                 "PropertyStore supports only architectures using little-endian.");
@@ -41,12 +46,13 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) for stores with a lot of properties.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) for stores with a lot of
+  /// properties.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -65,7 +71,7 @@ class PropertyStore {
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(n), or O(log(n)) for stores with a lot of properties.
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
   /// Returns all properties currently stored in the store. The time complexity
@@ -74,22 +80,26 @@ class PropertyStore {
   std::map<PropertyId, PropertyValue> Properties() const;
 
   /// Set a property value and return `true` if insertion took place. `false` is
-  /// returned if assignment took place. The time complexity of this function is
-  /// O(n).
+  /// returned if assignment took place. String values of the properties in
+  /// `dictionary_encoded_properties` are stored as dictionary codes. The time
+  /// complexity of this function is O(n).
   /// @throw std::bad_alloc
-  bool SetProperty(PropertyId property, const PropertyValue &value);
+  bool SetProperty(PropertyId property, const PropertyValue &value,
+                   const DictionaryEncodedProperties *dictionary_encoded_properties = nullptr);
 
   /// Init property values and return `true` if insertion took place. `false` is
   /// returned if there is any existing property in property store and insertion couldn't take place. The time
   /// complexity of this function is O(n).
   /// @throw std::bad_alloc
-  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties);
+  bool InitProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties,
+                      const DictionaryEncodedProperties *dictionary_encoded_properties = nullptr);
 
   /// Init property values and return `true` if insertion took place. `false` is
   /// returned if there is any existing property in property store and insertion couldn't take place. The time
   /// complexity of this function is O(n*log(n)):
   /// @throw std::bad_alloc
-  bool InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties);
+  bool InitProperties(std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties,
+                      const DictionaryEncodedProperties *dictionary_encoded_properties = nullptr);
 
   /// Update property values in property store with sent properties. Returns vector of changed
   /// properties. Each tuple inside vector consists of PropertyId of inserted property, together with old
@@ -97,7 +107,8 @@ class PropertyStore {
   /// The time complexity of this function is O(n*log(n)):
   /// @throw std::bad_alloc
   std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>> UpdateProperties(
-      std::map<storage::PropertyId, storage::PropertyValue> &properties);
+      std::map<storage::PropertyId, storage::PropertyValue> &properties,
+      const DictionaryEncodedProperties *dictionary_encoded_properties = nullptr);
 
   /// Remove all properties and return `true` if any removal took place.
   /// `false` is returned if there were no properties to remove. The time
@@ -113,7 +124,7 @@ class PropertyStore {
 
  private:
   template <typename TContainer>
-  bool DoInitProperties(const TContainer &properties);
+  bool DoInitProperties(const TContainer &properties, const DictionaryEncodedProperties *dictionary_encoded_properties);
 
   uint8_t buffer_[sizeof(uint64_t) + sizeof(uint8_t *)];
 };
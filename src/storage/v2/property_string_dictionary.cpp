@@ -0,0 +1,21 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_string_dictionary.hpp"
+
+namespace memgraph::storage {
+
+PropertyStringDictionary &GetPropertyStringDictionary() {
+  static PropertyStringDictionary dictionary;
+  return dictionary;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,50 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "storage/v2/name_id_mapper.hpp"
+
+namespace memgraph::storage {
+
+/// Dictionary of the string values of dictionary encoded properties. The
+/// `PropertyStore` stores only the code of such a value, so that a value which
+/// is repeated in a lot of vertices and edges is stored only once.
+///
+/// Values are never removed from the dictionary and their codes are never
+/// reused, so it should only be used for properties with a limited number of
+/// distinct values. A single dictionary is shared by all of the storages
+/// because property stores are decoded without access to the storage that
+/// owns them. The codes are never persisted, both snapshots and WALs store the
+/// values themselves.
+class PropertyStringDictionary final : public NameIdMapper {
+ public:
+  /// Returns the code of the value, adding the value to the dictionary if it
+  /// isn't in it yet.
+  /// @throw std::bad_alloc if unable to insert a new value
+  uint64_t Encode(const std::string_view value) { return NameToId(value); }
+
+  /// Returns the value whose code is `code`. The reference stays valid because
+  /// values are never removed from the dictionary.
+  const std::string &Decode(uint64_t code) { return IdToName(code); }
+
+  /// Returns the number of distinct values in the dictionary.
+  uint64_t size() const { return Size(); }
+};
+
+/// Returns the dictionary used by all of the property stores.
+PropertyStringDictionary &GetPropertyStringDictionary();
+
+}  // namespace memgraph::storage
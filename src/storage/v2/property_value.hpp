@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "storage/v2/point.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/exceptions.hpp"
@@ -45,7 +46,8 @@ class PropertyValue {
     String = 4,
     List = 5,
     Map = 6,
-    TemporalData = 7
+    TemporalData = 7,
+    Point = 8
   };
 
   static bool AreComparableTypes(Type a, Type b) {
@@ -61,6 +63,7 @@ class PropertyValue {
   explicit PropertyValue(const int64_t value) : type_(Type::Int) { int_v = value; }
   explicit PropertyValue(const double value) : type_(Type::Double) { double_v = value; }
   explicit PropertyValue(const TemporalData value) : type_{Type::TemporalData} { temporal_data_v = value; }
+  explicit PropertyValue(const Point value) : type_{Type::Point} { point_v = value; }
 
   // copy constructors for non-primitive types
   /// @throw std::bad_alloc
@@ -118,6 +121,7 @@ class PropertyValue {
   bool IsList() const { return type_ == Type::List; }
   bool IsMap() const { return type_ == Type::Map; }
   bool IsTemporalData() const { return type_ == Type::TemporalData; }
+  bool IsPoint() const { return type_ == Type::Point; }
 
   // value getters for primitive types
   /// @throw PropertyValueException if value isn't of correct type.
@@ -151,6 +155,15 @@ class PropertyValue {
     return temporal_data_v;
   }
 
+  /// @throw PropertyValueException if value isn't of correct type.
+  Point ValuePoint() const {
+    if (type_ != Type::Point) {
+      throw PropertyValueException("The value isn't a point!");
+    }
+
+    return point_v;
+  }
+
   // const value getters for non-primitive types
   /// @throw PropertyValueException if value isn't of correct type.
   const std::string &ValueString() const {
@@ -212,6 +225,7 @@ class PropertyValue {
     std::vector<PropertyValue> list_v;
     std::map<std::string, PropertyValue> map_v;
     TemporalData temporal_data_v;
+    Point point_v;
   };
 
   Type type_;
@@ -237,6 +251,8 @@ inline std::ostream &operator<<(std::ostream &os, const PropertyValue::Type type
       return os << "map";
     case PropertyValue::Type::TemporalData:
       return os << "temporal data";
+    case PropertyValue::Type::Point:
+      return os << "point";
   }
 }
 /// @throw anything std::ostream::operator<< may throw.
@@ -264,6 +280,8 @@ inline std::ostream &operator<<(std::ostream &os, const PropertyValue &value) {
     case PropertyValue::Type::TemporalData:
       return os << fmt::format("type: {}, microseconds: {}", TemporalTypeTostring(value.ValueTemporalData().type),
                                value.ValueTemporalData().microseconds);
+    case PropertyValue::Type::Point:
+      return os << value.ValuePoint();
   }
 }
 
@@ -297,6 +315,8 @@ inline bool operator==(const PropertyValue &first, const PropertyValue &second)
       return first.ValueMap() == second.ValueMap();
     case PropertyValue::Type::TemporalData:
       return first.ValueTemporalData() == second.ValueTemporalData();
+    case PropertyValue::Type::Point:
+      return first.ValuePoint() == second.ValuePoint();
   }
 }
 
@@ -328,6 +348,8 @@ inline bool operator<(const PropertyValue &first, const PropertyValue &second) n
       return first.ValueMap() < second.ValueMap();
     case PropertyValue::Type::TemporalData:
       return first.ValueTemporalData() < second.ValueTemporalData();
+    case PropertyValue::Type::Point:
+      return first.ValuePoint() < second.ValuePoint();
   }
 }
 
@@ -359,6 +381,9 @@ inline PropertyValue::PropertyValue(const PropertyValue &other) : type_(other.ty
     case Type::TemporalData:
       this->temporal_data_v = other.temporal_data_v;
       return;
+    case Type::Point:
+      this->point_v = other.point_v;
+      return;
   }
 }
 
@@ -387,6 +412,9 @@ inline PropertyValue::PropertyValue(PropertyValue &&other) noexcept : type_(othe
     case Type::TemporalData:
       this->temporal_data_v = other.temporal_data_v;
       break;
+    case Type::Point:
+      this->point_v = other.point_v;
+      break;
   }
 
   // reset the type of other
@@ -424,6 +452,9 @@ inline PropertyValue &PropertyValue::operator=(const PropertyValue &other) {
     case Type::TemporalData:
       this->temporal_data_v = other.temporal_data_v;
       break;
+    case Type::Point:
+      this->point_v = other.point_v;
+      break;
   }
 
   return *this;
@@ -459,6 +490,9 @@ inline PropertyValue &PropertyValue::operator=(PropertyValue &&other) noexcept {
     case Type::TemporalData:
       this->temporal_data_v = other.temporal_data_v;
       break;
+    case Type::Point:
+      this->point_v = other.point_v;
+      break;
   }
 
   // reset the type of other
@@ -476,6 +510,7 @@ inline void PropertyValue::DestroyValue() noexcept {
     case Type::Int:
     case Type::Double:
     case Type::TemporalData:
+    case Type::Point:
       return;
 
     // destructor for non primitive types since we used placement new
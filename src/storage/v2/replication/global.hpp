@@ -15,6 +15,7 @@
 #include <deque>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "io/network/endpoint.hpp"
 #include "storage/v2/replication/enums.hpp"
@@ -62,4 +63,24 @@ struct ReplicaInfo {
   TimestampInfo timestamp_info;
 };
 
+struct ReplicaMetrics {
+  std::string name;
+  // How far the last commit timestamp acknowledged by the replica is behind
+  // the last commit timestamp of MAIN.
+  uint64_t commit_timestamp_lag;
+  // Bytes sent to the replica in total and per second since the previous
+  // measurement.
+  uint64_t sent_bytes;
+  uint64_t sent_bytes_per_second;
+  // Transactions sent to the replica or waiting to be sent which it didn't
+  // acknowledge yet.
+  uint64_t in_flight_transactions;
+  // Percentiles of the time it takes the replica to apply transactions, in
+  // microseconds, as (percentile, value) pairs.
+  std::vector<std::pair<uint64_t, uint64_t>> append_latency_percentiles;
+  // Steps of the current (or the last) recovery of the replica.
+  uint64_t recovery_steps_done;
+  uint64_t recovery_steps_total;
+};
+
 }  // namespace memgraph::storage
@@ -38,7 +38,8 @@ std::string RegisterReplicaErrorToString(ReplicationState::RegisterReplicaError
 }
 }  // namespace
 
-storage::ReplicationState::ReplicationState(bool restore, std::filesystem::path durability_dir) {
+storage::ReplicationState::ReplicationState(bool restore, std::filesystem::path durability_dir, uint64_t sync_quorum)
+    : sync_quorum_(sync_quorum) {
   if (restore) {
     utils::EnsureDirOrDie(durability_dir / durability::kReplicationDirectory);
     durability_ = std::make_unique<kvstore::KVStore>(durability_dir / durability::kReplicationDirectory);
@@ -85,7 +86,7 @@ bool storage::ReplicationState::SetMainReplicationRole(storage::Storage *storage
 }
 
 bool storage::ReplicationState::AppendOperation(const uint64_t seq_num, durability::StorageGlobalOperation operation,
-                                                LabelId label, const std::set<PropertyId> &properties,
+                                                LabelId label, const std::vector<PropertyId> &properties,
                                                 uint64_t final_commit_timestamp) {
   bool finalized_on_all_replicas = true;
   // TODO Should we return true if not MAIN?
@@ -95,12 +96,25 @@ bool storage::ReplicationState::AppendOperation(const uint64_t seq_num, durabili
         client->StartTransactionReplication(seq_num);
         client->IfStreamingTransaction(
             [&](auto &stream) { stream.AppendOperation(operation, label, properties, final_commit_timestamp); });
+      }
+      finalized_on_all_replicas = FinalizeTransactionReplication(clients);
+    });
+  }
+  return finalized_on_all_replicas;
+}
 
-        const auto finalized = client->FinalizeTransactionReplication();
-        if (client->Mode() == replication::ReplicationMode::SYNC) {
-          finalized_on_all_replicas = finalized && finalized_on_all_replicas;
-        }
+bool storage::ReplicationState::AppendOperation(const uint64_t seq_num, durability::StorageGlobalOperation operation,
+                                                EdgeTypeId edge_type, const std::vector<PropertyId> &properties,
+                                                uint64_t final_commit_timestamp) {
+  bool finalized_on_all_replicas = true;
+  if (GetRole() == replication::ReplicationRole::MAIN) {
+    replication_clients_.WithLock([&](auto &clients) {
+      for (auto &client : clients) {
+        client->StartTransactionReplication(seq_num);
+        client->IfStreamingTransaction(
+            [&](auto &stream) { stream.AppendOperation(operation, edge_type, properties, final_commit_timestamp); });
       }
+      finalized_on_all_replicas = FinalizeTransactionReplication(clients);
     });
   }
   return finalized_on_all_replicas;
@@ -137,16 +151,27 @@ bool storage::ReplicationState::FinalizeTransaction(uint64_t timestamp) {
   replication_clients_.WithLock([&](auto &clients) {
     for (auto &client : clients) {
       client->IfStreamingTransaction([&](auto &stream) { stream.AppendTransactionEnd(timestamp); });
-      const auto finalized = client->FinalizeTransactionReplication();
-
-      if (client->Mode() == replication::ReplicationMode::SYNC) {
-        finalized_on_all_replicas = finalized && finalized_on_all_replicas;
-      }
     }
+    finalized_on_all_replicas = FinalizeTransactionReplication(clients);
   });
   return finalized_on_all_replicas;
 }
 
+bool storage::ReplicationState::FinalizeTransactionReplication(
+    const std::vector<std::unique_ptr<ReplicationClient>> &clients) const {
+  // The responses of the SYNC replicas are awaited concurrently. The replicas
+  // which didn't respond before the quorum was reached fall behind and catch
+  // up in their recovery.
+  auto acks = std::make_shared<TransactionAcks>();
+  uint64_t sync_replicas = 0;
+  for (const auto &client : clients) {
+    if (client->Mode() == replication::ReplicationMode::SYNC) ++sync_replicas;
+    client->FinalizeTransactionReplication(acks);
+  }
+  const auto quorum = sync_quorum_ == 0 ? sync_replicas : std::min(sync_quorum_, sync_replicas);
+  return acks->Wait(sync_replicas, quorum);
+}
+
 utils::BasicResult<ReplicationState::RegisterReplicaError> ReplicationState::RegisterReplica(
     std::string name, io::network::Endpoint endpoint, const replication::ReplicationMode replication_mode,
     const replication::RegistrationMode registration_mode, const replication::ReplicationClientConfig &config,
@@ -289,6 +314,16 @@ std::vector<ReplicaInfo> ReplicationState::ReplicasInfo() {
   });
 }
 
+std::vector<ReplicaMetrics> ReplicationState::ReplicasMetrics() {
+  return replication_clients_.WithLock([](auto &clients) {
+    std::vector<ReplicaMetrics> replica_metrics;
+    replica_metrics.reserve(clients.size());
+    std::transform(clients.begin(), clients.end(), std::back_inserter(replica_metrics),
+                   [](const auto &client) { return client->GetMetrics(); });
+    return replica_metrics;
+  });
+}
+
 void ReplicationState::RestoreReplicationRole(Storage *storage) {
   if (!ShouldStoreAndRestoreReplicationState()) {
     return;
@@ -41,7 +41,9 @@ struct ReplicationState {
   };
 
   // TODO: This mirrors the logic in InMemoryConstructor; make it independent
-  ReplicationState(bool restore, std::filesystem::path durability_dir);
+  // A transaction is replicated once `sync_quorum` SYNC replicas applied it,
+  // or all of them if `sync_quorum` is 0.
+  ReplicationState(bool restore, std::filesystem::path durability_dir, uint64_t sync_quorum = 0);
 
   // Generic API
   void Reset();
@@ -57,7 +59,9 @@ struct ReplicationState {
 
   // MAIN actually doing the replication
   bool AppendOperation(uint64_t seq_num, durability::StorageGlobalOperation operation, LabelId label,
-                       const std::set<PropertyId> &properties, uint64_t final_commit_timestamp);
+                       const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
+  bool AppendOperation(uint64_t seq_num, durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                       const std::vector<PropertyId> &properties, uint64_t final_commit_timestamp);
   void InitializeTransaction(uint64_t seq_num);
   void AppendDelta(const Delta &delta, const Vertex &parent, uint64_t timestamp);
   void AppendDelta(const Delta &delta, const Edge &parent, uint64_t timestamp);
@@ -78,6 +82,7 @@ struct ReplicationState {
   // TODO make into const (problem with SpinLock and WithReadLock)
   std::optional<replication::ReplicaState> GetReplicaState(std::string_view name);
   std::vector<ReplicaInfo> ReplicasInfo();
+  std::vector<ReplicaMetrics> ReplicasMetrics();
 
   const ReplicationEpoch &GetEpoch() const { return epoch_; }
   ReplicationEpoch &GetEpoch() { return epoch_; }
@@ -99,6 +104,10 @@ struct ReplicationState {
  private:
   bool ShouldStoreAndRestoreReplicationState() const { return nullptr != durability_; }
 
+  // Finishes the replication of the current transaction to `clients` and
+  // waits for the quorum of SYNC replicas to apply it.
+  bool FinalizeTransactionReplication(const std::vector<std::unique_ptr<ReplicationClient>> &clients) const;
+
   void SetRole(replication::ReplicationRole role) { return replication_role_.store(role); }
 
   // NOTE: Server is not in MAIN it is in REPLICA
@@ -121,6 +130,8 @@ struct ReplicationState {
 
   std::unique_ptr<kvstore::KVStore> durability_;
 
+  uint64_t sync_quorum_;
+
   ReplicationEpoch epoch_;
 };
 
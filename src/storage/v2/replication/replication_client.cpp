@@ -12,6 +12,7 @@
 #include "storage/v2/replication/replication_client.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <type_traits>
 
 #include "storage/v2/durability/durability.hpp"
@@ -22,9 +23,23 @@
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/timer.hpp"
 
 namespace memgraph::storage {
 
+namespace {
+
+// Batches of an ASYNC replica are cut at this size so a single request
+// doesn't hold the RPC client for too long.
+constexpr uint64_t kMaxTransactionBatchSize = 16ULL * 1024 * 1024;
+// If the replica can't keep up and more data than this is waiting to be sent,
+// the pending transactions are dropped and the replica is recovered from the
+// durability files instead.
+constexpr uint64_t kMaxPendingTransactionsSize = 256ULL * 1024 * 1024;
+
+}  // namespace
+
 static auto CreateClientContext(const replication::ReplicationClientConfig &config) -> communication::ClientContext {
   return (config.ssl) ? communication::ClientContext{config.ssl->key_file, config.ssl->cert_file}
                       : communication::ClientContext{};
@@ -35,7 +50,8 @@ ReplicationClient::ReplicationClient(Storage *storage, std::string name, memgrap
                                      replication::ReplicationClientConfig const &config)
     : name_{std::move(name)},
       rpc_context_{CreateClientContext(config)},
-      rpc_client_{std::move(endpoint), &rpc_context_},
+      rpc_client_{endpoint, &rpc_context_},
+      stream_rpc_client_{std::move(endpoint), &rpc_context_},
       replica_check_frequency_{config.replica_check_frequency},
       mode_{mode},
       storage_{storage} {}
@@ -82,6 +98,7 @@ void ReplicationClient::InitializeClient() {
   }
 
   current_commit_timestamp = replica.current_commit_timestamp;
+  replica_commit_timestamp_.store(current_commit_timestamp);
   spdlog::trace("Current timestamp on replica {}: {}", name_, current_commit_timestamp);
   spdlog::trace("Current timestamp on main: {}", storage_->replication_state_.last_commit_timestamp_.load());
   if (current_commit_timestamp == storage_->replication_state_.last_commit_timestamp_.load()) {
@@ -112,6 +129,7 @@ TimestampInfo ReplicationClient::GetTimestampInfo() {
       HandleRpcFailure();
     }
     auto main_time_stamp = storage_->replication_state_.last_commit_timestamp_.load();
+    replica_commit_timestamp_.store(response.current_commit_timestamp);
     info.current_timestamp_of_replica = response.current_commit_timestamp;
     info.current_number_of_timestamp_behind_master = response.current_commit_timestamp - main_time_stamp;
   } catch (const rpc::RpcFailedException &) {
@@ -126,6 +144,42 @@ TimestampInfo ReplicationClient::GetTimestampInfo() {
   return info;
 }
 
+ReplicaMetrics ReplicationClient::GetMetrics() {
+  const auto main_commit = LastCommitTimestamp();
+  const auto replica_commit = replica_commit_timestamp_.load();
+  const auto sent_bytes = rpc_client_.SentBytes() + stream_rpc_client_.SentBytes();
+  const auto now = std::chrono::steady_clock::now();
+  const auto bytes_per_second = throughput_sample_.WithLock([&](auto &sample) {
+    // The rate is measured over at least a second, so it isn't distorted
+    // when the metrics are read often.
+    const auto elapsed = std::chrono::duration<double>(now - sample.time).count();
+    if (elapsed >= 1.0) {
+      sample.bytes_per_second = static_cast<uint64_t>(static_cast<double>(sent_bytes - sample.sent_bytes) / elapsed);
+      sample.time = now;
+      sample.sent_bytes = sent_bytes;
+    }
+    return sample.bytes_per_second;
+  });
+  return {.name = name_,
+          .commit_timestamp_lag = main_commit > replica_commit ? main_commit - replica_commit : 0,
+          .sent_bytes = sent_bytes,
+          .sent_bytes_per_second = bytes_per_second,
+          .in_flight_transactions = in_flight_transactions_.load(),
+          .append_latency_percentiles = append_latency_.YieldPercentiles(),
+          .recovery_steps_done = recovery_steps_done_.load(),
+          .recovery_steps_total = recovery_steps_total_.load()};
+}
+
+void ReplicationClient::StartRecovery(uint64_t steps) {
+  recovery_steps_total_.store(steps);
+  recovery_steps_done_.store(0);
+}
+
+void ReplicationClient::FinishRecoveryStep(uint64_t replica_commit) {
+  replica_commit_timestamp_.store(replica_commit);
+  recovery_steps_done_.fetch_add(1);
+}
+
 void ReplicationClient::HandleRpcFailure() {
   spdlog::error(utils::MessageWithLink("Couldn't replicate data to {}.", name_, "https://memgr.ph/replication"));
   TryInitializeClientAsync();
@@ -134,6 +188,7 @@ void ReplicationClient::HandleRpcFailure() {
 void ReplicationClient::TryInitializeClientAsync() {
   thread_pool_.AddTask([this] {
     rpc_client_.Abort();
+    stream_rpc_client_.Abort();
     this->TryInitializeClientSync();
   });
 }
@@ -173,8 +228,8 @@ void ReplicationClient::StartTransactionReplication(const uint64_t current_wal_s
     case replication::ReplicaState::READY:
       MG_ASSERT(!replica_stream_);
       try {
-        replica_stream_.emplace(
-            ReplicaStream{this, storage_->replication_state_.last_commit_timestamp_.load(), current_wal_seq_num});
+        replica_stream_.emplace(this, storage_->replication_state_.last_commit_timestamp_.load(), current_wal_seq_num,
+                                mode_ == replication::ReplicationMode::ASYNC);
         replica_state_.store(replication::ReplicaState::REPLICATING);
       } catch (const rpc::RpcFailedException &) {
         replica_state_.store(replication::ReplicaState::INVALID);
@@ -186,24 +241,81 @@ void ReplicationClient::StartTransactionReplication(const uint64_t current_wal_s
 
 auto ReplicationClient::GetEpochId() const -> std::string const & { return storage_->replication_state_.GetEpoch().id; }
 
-bool ReplicationClient::FinalizeTransactionReplication() {
+void TransactionAcks::Add(bool applied) {
+  {
+    std::lock_guard guard(mutex_);
+    ++responses_;
+    if (applied) ++applied_;
+  }
+  cv_.notify_all();
+}
+
+bool TransactionAcks::Wait(uint64_t expected, uint64_t quorum) {
+  std::unique_lock guard(mutex_);
+  cv_.wait(guard, [&] { return applied_ >= quorum || responses_ >= expected; });
+  return applied_ >= quorum;
+}
+
+void ReplicationClient::FinalizeTransactionReplication(const std::shared_ptr<TransactionAcks> &acks) {
   // We can only check the state because it guarantees to be only
   // valid during a single transaction replication (if the assumption
   // that this and other transaction replication functions can only be
   // called from a one thread stands)
   if (replica_state_ != replication::ReplicaState::REPLICATING) {
-    return false;
+    if (mode_ == replication::ReplicationMode::SYNC) acks->Add(false);
+    return;
+  }
+
+  if (mode_ == replication::ReplicationMode::ASYNC) {
+    MG_ASSERT(replica_stream_, "Missing stream for transaction deltas");
+    auto transaction = replica_stream_->FinalizeBuffered();
+    replica_stream_.reset();
+    std::unique_lock client_guard(client_lock_);
+    if (replica_state_ != replication::ReplicaState::REPLICATING) {
+      // The replica failed or fell behind in the meantime, the transaction
+      // will be sent during its recovery.
+      return;
+    }
+    const auto schedule_send = pending_transactions_.WithLock([&](auto &pending) {
+      if (!pending.transactions.empty() && pending.size + transaction.data.size() > kMaxPendingTransactionsSize) {
+        // The task sending the pending transactions notices the state after
+        // the batch in flight and starts the recovery.
+        spdlog::debug("Replica {} can't keep up with MAIN instance", name_);
+        replica_state_.store(replication::ReplicaState::RECOVERY);
+        return false;
+      }
+      replica_state_.store(replication::ReplicaState::READY);
+      pending.size += transaction.data.size();
+      pending.transactions.push_back(std::move(transaction));
+      in_flight_transactions_.fetch_add(1);
+      if (pending.send_scheduled) {
+        return false;
+      }
+      pending.send_scheduled = true;
+      return true;
+    });
+    if (schedule_send) {
+      thread_pool_.AddTask([this] { this->SendPendingTransactions(); });
+    }
+    return;
   }
 
+  // The response is awaited on `thread_pool_`, so the responses of all SYNC
+  // replicas are awaited at the same time.
   auto task = [this]() {
     MG_ASSERT(replica_stream_, "Missing stream for transaction deltas");
+    utils::OnScopeExit in_flight([this] { in_flight_transactions_.fetch_sub(1); });
     try {
+      utils::Timer timer;
       auto response = replica_stream_->Finalize();
+      append_latency_.Measure(timer.Elapsed<std::chrono::microseconds>().count());
+      replica_commit_timestamp_.store(response.current_commit_timestamp);
       replica_stream_.reset();
       std::unique_lock client_guard(client_lock_);
       if (!response.success || replica_state_ == replication::ReplicaState::RECOVERY) {
         replica_state_.store(replication::ReplicaState::RECOVERY);
-        thread_pool_.AddTask([&, this] { this->RecoverReplica(response.current_commit_timestamp); });
+        thread_pool_.AddTask(
+            [this, replica_commit = response.current_commit_timestamp] { this->RecoverReplica(replica_commit); });
       } else {
         replica_state_.store(replication::ReplicaState::READY);
         return true;
@@ -219,12 +331,79 @@ bool ReplicationClient::FinalizeTransactionReplication() {
     return false;
   };
 
-  if (mode_ == replication::ReplicationMode::ASYNC) {
-    thread_pool_.AddTask([=] { (void)task(); });
-    return true;
-  }
+  in_flight_transactions_.fetch_add(1);
+  thread_pool_.AddTask([task, acks] { acks->Add(task()); });
+}
 
-  return task();
+void ReplicationClient::SendPendingTransactions() {
+  while (true) {
+    std::vector<BufferedTransaction> batch;
+    pending_transactions_.WithLock([&](auto &pending) {
+      // Only consecutive transactions of the same WAL file can be sent
+      // together. The replica rejects a batch which doesn't continue from
+      // its last commit, so a gap leads to a recovery.
+      uint64_t batch_size = 0;
+      auto it = pending.transactions.begin();
+      for (; it != pending.transactions.end(); ++it) {
+        if (!batch.empty() && (batch_size + it->data.size() > kMaxTransactionBatchSize ||
+                               it->seq_num != batch.back().seq_num ||
+                               it->previous_commit_timestamp != batch.back().commit_timestamp)) {
+          break;
+        }
+        batch_size += it->data.size();
+        batch.push_back(std::move(*it));
+      }
+      pending.transactions.erase(pending.transactions.begin(), it);
+      pending.size -= batch_size;
+      if (batch.empty()) {
+        pending.send_scheduled = false;
+      }
+    });
+    if (batch.empty()) {
+      return;
+    }
+
+    utils::OnScopeExit in_flight([this, sent = batch.size()] { in_flight_transactions_.fetch_sub(sent); });
+    auto clear_pending = [this] {
+      pending_transactions_.WithLock([this](auto &pending) {
+        in_flight_transactions_.fetch_sub(pending.transactions.size());
+        pending.transactions.clear();
+        pending.size = 0;
+        pending.send_scheduled = false;
+      });
+    };
+
+    try {
+      utils::Timer timer;
+      auto stream{stream_rpc_client_.Stream<replication::AppendDeltasRpc>(batch.front().previous_commit_timestamp,
+                                                                   batch.front().seq_num, batch.size())};
+      replication::Encoder encoder{stream.GetBuilder()};
+      encoder.WriteString(GetEpochId());
+      for (const auto &transaction : batch) {
+        encoder.WriteBuffer(transaction.data.data(), transaction.data.size());
+      }
+      // The replica acknowledges the whole batch with its last commit
+      // timestamp.
+      const auto response = stream.AwaitResponse();
+      append_latency_.Measure(timer.Elapsed<std::chrono::microseconds>().count());
+      replica_commit_timestamp_.store(response.current_commit_timestamp);
+      std::unique_lock client_guard(client_lock_);
+      if (!response.success || replica_state_ == replication::ReplicaState::RECOVERY) {
+        replica_state_.store(replication::ReplicaState::RECOVERY);
+        clear_pending();
+        thread_pool_.AddTask([=, this] { this->RecoverReplica(response.current_commit_timestamp); });
+        return;
+      }
+    } catch (const rpc::RpcFailedException &) {
+      {
+        std::unique_lock client_guard(client_lock_);
+        replica_state_.store(replication::ReplicaState::INVALID);
+        clear_pending();
+      }
+      HandleRpcFailure();
+      return;
+    }
+  }
 }
 
 void ReplicationClient::FrequentCheck() {
@@ -286,36 +465,67 @@ void ReplicationClient::IfStreamingTransaction(const std::function<void(ReplicaS
 
 ////// ReplicaStream //////
 ReplicaStream::ReplicaStream(ReplicationClient *self, const uint64_t previous_commit_timestamp,
-                             const uint64_t current_seq_num)
-    : self_(self),
-      stream_(self_->rpc_client_.Stream<replication::AppendDeltasRpc>(previous_commit_timestamp, current_seq_num)) {
-  replication::Encoder encoder{stream_.GetBuilder()};
+                             const uint64_t current_seq_num, const bool buffered)
+    : self_(self), previous_commit_timestamp_(previous_commit_timestamp), seq_num_(current_seq_num) {
+  if (buffered) {
+    buffer_ = std::make_unique<std::vector<uint8_t>>();
+    // Only the data of the segments is kept, the batch is split into new
+    // segments when it is sent.
+    buffer_builder_ = std::make_unique<slk::Builder>([buffer = buffer_.get()](const uint8_t *data, size_t /*size*/,
+                                                                              bool /*have_more*/) {
+      slk::SegmentSize segment_size = 0;
+      memcpy(&segment_size, data, sizeof(slk::SegmentSize));
+      const auto *segment_data = data + sizeof(slk::SegmentSize);
+      buffer->insert(buffer->end(), segment_data, segment_data + segment_size);
+    });
+    return;
+  }
+
+  stream_.emplace(
+      self_->stream_rpc_client_.Stream<replication::AppendDeltasRpc>(previous_commit_timestamp, current_seq_num, 1));
+  replication::Encoder encoder{stream_->GetBuilder()};
 
   encoder.WriteString(self_->GetEpochId());
 }
 
+slk::Builder *ReplicaStream::GetBuilder() { return stream_ ? stream_->GetBuilder() : buffer_builder_.get(); }
+
 void ReplicaStream::AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(GetBuilder());
   auto *storage = self_->GetStorage();
   EncodeDelta(&encoder, storage->name_id_mapper_.get(), storage->config_.items, delta, vertex, final_commit_timestamp);
 }
 
 void ReplicaStream::AppendDelta(const Delta &delta, const Edge &edge, uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  replication::Encoder encoder(GetBuilder());
   EncodeDelta(&encoder, self_->GetStorage()->name_id_mapper_.get(), delta, edge, final_commit_timestamp);
 }
 
 void ReplicaStream::AppendTransactionEnd(uint64_t final_commit_timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+  commit_timestamp_ = final_commit_timestamp;
+  replication::Encoder encoder(GetBuilder());
   EncodeTransactionEnd(&encoder, final_commit_timestamp);
 }
 
 void ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation, LabelId label,
-                                    const std::set<PropertyId> &properties, uint64_t timestamp) {
-  replication::Encoder encoder(stream_.GetBuilder());
+                                    const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  commit_timestamp_ = timestamp;
+  replication::Encoder encoder(GetBuilder());
   EncodeOperation(&encoder, self_->GetStorage()->name_id_mapper_.get(), operation, label, properties, timestamp);
 }
 
-replication::AppendDeltasRes ReplicaStream::Finalize() { return stream_.AwaitResponse(); }
+void ReplicaStream::AppendOperation(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                                    const std::vector<PropertyId> &properties, uint64_t timestamp) {
+  commit_timestamp_ = timestamp;
+  replication::Encoder encoder(GetBuilder());
+  EncodeOperation(&encoder, self_->GetStorage()->name_id_mapper_.get(), operation, edge_type, properties, timestamp);
+}
+
+replication::AppendDeltasRes ReplicaStream::Finalize() { return stream_->AwaitResponse(); }
+
+BufferedTransaction ReplicaStream::FinalizeBuffered() {
+  buffer_builder_->Finalize();
+  return {previous_commit_timestamp_, seq_num_, commit_timestamp_, std::move(*buffer_)};
+}
 
 }  // namespace memgraph::storage
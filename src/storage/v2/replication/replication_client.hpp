@@ -18,14 +18,24 @@
 #include "storage/v2/replication/enums.hpp"
 #include "storage/v2/replication/global.hpp"
 #include "storage/v2/replication/rpc.hpp"
+#include "storage/v2/transaction.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/scheduler.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/thread_pool.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace memgraph::storage {
 
@@ -35,10 +45,39 @@ struct Edge;
 class Storage;
 class ReplicationClient;
 
-// Handler used for transferring the current transaction.
+// A committed transaction encoded for an ASYNC replica, waiting to be sent
+// together with the transactions committed after it.
+struct BufferedTransaction {
+  uint64_t previous_commit_timestamp;
+  uint64_t seq_num;
+  uint64_t commit_timestamp;
+  std::vector<uint8_t> data;
+};
+
+// Collects the responses of the SYNC replicas to a transaction. The responses
+// are awaited concurrently on the threads of the replication clients.
+class TransactionAcks {
+ public:
+  void Add(bool applied);
+
+  // Waits until `quorum` replicas applied the transaction or `expected`
+  // responses arrived. Returns whether `quorum` replicas applied it.
+  bool Wait(uint64_t expected, uint64_t quorum);
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  uint64_t responses_{0};
+  uint64_t applied_{0};
+};
+
+// Handler used for transferring the current transaction. Transactions of
+// ASYNC replicas are encoded into a buffer instead of being streamed
+// directly.
 class ReplicaStream {
  public:
-  explicit ReplicaStream(ReplicationClient *self, uint64_t previous_commit_timestamp, uint64_t current_seq_num);
+  ReplicaStream(ReplicationClient *self, uint64_t previous_commit_timestamp, uint64_t current_seq_num,
+                bool buffered = false);
 
   /// @throw rpc::RpcFailedException
   void AppendDelta(const Delta &delta, const Vertex &vertex, uint64_t final_commit_timestamp);
@@ -51,14 +90,31 @@ class ReplicaStream {
 
   /// @throw rpc::RpcFailedException
   void AppendOperation(durability::StorageGlobalOperation operation, LabelId label,
-                       const std::set<PropertyId> &properties, uint64_t timestamp);
+                       const std::vector<PropertyId> &properties, uint64_t timestamp);
+
+  /// @throw rpc::RpcFailedException
+  void AppendOperation(durability::StorageGlobalOperation operation, EdgeTypeId edge_type,
+                       const std::vector<PropertyId> &properties, uint64_t timestamp);
 
   /// @throw rpc::RpcFailedException
   replication::AppendDeltasRes Finalize();
 
+  /// Returns the encoded transaction of a buffered stream.
+  BufferedTransaction FinalizeBuffered();
+
  private:
+  slk::Builder *GetBuilder();
+
   ReplicationClient *self_;
-  rpc::Client::StreamHandler<replication::AppendDeltasRpc> stream_;
+  uint64_t previous_commit_timestamp_;
+  uint64_t seq_num_;
+  uint64_t commit_timestamp_{0};
+  std::optional<rpc::Client::StreamHandler<replication::AppendDeltasRpc>> stream_;
+  // Used instead of `stream_` by buffered streams. Both are allocated on the
+  // heap because the builder refers to the buffer and is too large to be moved
+  // around.
+  std::unique_ptr<std::vector<uint8_t>> buffer_;
+  std::unique_ptr<slk::Builder> buffer_builder_;
 };
 
 class ReplicationClient {
@@ -81,6 +137,8 @@ class ReplicationClient {
   auto Endpoint() const -> io::network::Endpoint const & { return rpc_client_.Endpoint(); }
   auto State() const -> replication::ReplicaState { return replica_state_.load(); }
   auto GetTimestampInfo() -> TimestampInfo;
+  // Unlike `GetTimestampInfo`, doesn't communicate with the replica.
+  auto GetMetrics() -> ReplicaMetrics;
 
   void Start();
   void StartTransactionReplication(const uint64_t current_wal_seq_num);
@@ -90,8 +148,10 @@ class ReplicationClient {
   // function will run a callback if, after previously callling
   // StartTransactionReplication, stream is created.
   void IfStreamingTransaction(const std::function<void(ReplicaStream &)> &callback);
-  // Return whether the transaction could be finalized on the replication client or not.
-  [[nodiscard]] bool FinalizeTransactionReplication();
+  // Finishes the replication of the transaction. A SYNC replica adds whether
+  // it applied the transaction to `acks`, usually after this function
+  // returns. ASYNC replicas don't add anything.
+  void FinalizeTransactionReplication(const std::shared_ptr<TransactionAcks> &acks);
 
  protected:
   virtual void RecoverReplica(uint64_t replica_commit) = 0;
@@ -104,15 +164,47 @@ class ReplicationClient {
   void TryInitializeClientAsync();
   void TryInitializeClientSync();
   void FrequentCheck();
+  // Sends the pending transactions of an ASYNC replica in batches. Runs on
+  // `thread_pool_`.
+  void SendPendingTransactions();
+  void StartRecovery(uint64_t steps);
+  void FinishRecoveryStep(uint64_t replica_commit);
 
   std::string name_;
   communication::ClientContext rpc_context_;
+  // Heartbeats and timestamp queries, they aren't delayed by the streamed
+  // data.
   rpc::Client rpc_client_;
+  // Transactions, snapshots and WAL files.
+  rpc::Client stream_rpc_client_;
   std::chrono::seconds replica_check_frequency_;
 
   std::optional<ReplicaStream> replica_stream_;
   replication::ReplicationMode mode_{replication::ReplicationMode::SYNC};
 
+  // Transactions committed for an ASYNC replica which weren't sent yet. A
+  // single task sending them is queued on `thread_pool_` at a time, so one
+  // batch is in flight while the next one accumulates.
+  struct PendingTransactions {
+    std::vector<BufferedTransaction> transactions;
+    uint64_t size{0};
+    bool send_scheduled{false};
+  };
+  utils::Synchronized<PendingTransactions, utils::SpinLock> pending_transactions_;
+
+  // Metrics, see `GetMetrics`.
+  std::atomic<uint64_t> replica_commit_timestamp_{kTimestampInitialId};
+  std::atomic<uint64_t> in_flight_transactions_{0};
+  metrics::Histogram append_latency_;
+  std::atomic<uint64_t> recovery_steps_done_{0};
+  std::atomic<uint64_t> recovery_steps_total_{0};
+  struct ThroughputSample {
+    std::chrono::steady_clock::time_point time{std::chrono::steady_clock::now()};
+    uint64_t sent_bytes{0};
+    uint64_t bytes_per_second{0};
+  };
+  utils::Synchronized<ThroughputSample, utils::SpinLock> throughput_sample_;
+
   utils::SpinLock client_lock_;
   // This thread pool is used for background tasks so we don't
   // block the main storage thread
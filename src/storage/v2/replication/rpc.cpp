@@ -70,6 +70,14 @@ void TimestampRes::Save(const TimestampRes &self, memgraph::slk::Builder *builde
   memgraph::slk::Save(self, builder);
 }
 void TimestampRes::Load(TimestampRes *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
+void StateBatchReq::Save(const StateBatchReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void StateBatchReq::Load(StateBatchReq *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
+void StateBatchRes::Save(const StateBatchRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void StateBatchRes::Load(StateBatchRes *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
 
 }  // namespace replication
 }  // namespace storage
@@ -116,8 +124,46 @@ constexpr utils::TypeInfo storage::replication::TimestampReq::kType{utils::TypeI
 constexpr utils::TypeInfo storage::replication::TimestampRes::kType{utils::TypeId::REP_TIMESTAMP_RES, "TimestampRes",
                                                                     nullptr};
 
+constexpr utils::TypeInfo storage::replication::StateBatchReq::kType{utils::TypeId::REP_STATE_BATCH_REQ,
+                                                                     "StateBatchReq", nullptr};
+
+constexpr utils::TypeInfo storage::replication::StateBatchRes::kType{utils::TypeId::REP_STATE_BATCH_RES,
+                                                                     "StateBatchRes", nullptr};
+
 // Autogenerated SLK serialization code
 namespace slk {
+// Serialize code for StateBatchRes
+
+void Save(const memgraph::storage::replication::StateBatchRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.success, builder);
+  memgraph::slk::Save(self.current_commit_timestamp, builder);
+}
+
+void Load(memgraph::storage::replication::StateBatchRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->success, reader);
+  memgraph::slk::Load(&self->current_commit_timestamp, reader);
+}
+
+// Serialize code for StateBatchReq
+
+void Save(const memgraph::storage::replication::StateBatchReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.first, builder);
+  memgraph::slk::Save(self.last, builder);
+  memgraph::slk::Save(self.uuid, builder);
+  memgraph::slk::Save(self.epoch_id, builder);
+  memgraph::slk::Save(self.last_commit_timestamp, builder);
+  memgraph::slk::Save(self.transaction_count, builder);
+}
+
+void Load(memgraph::storage::replication::StateBatchReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->first, reader);
+  memgraph::slk::Load(&self->last, reader);
+  memgraph::slk::Load(&self->uuid, reader);
+  memgraph::slk::Load(&self->epoch_id, reader);
+  memgraph::slk::Load(&self->last_commit_timestamp, reader);
+  memgraph::slk::Load(&self->transaction_count, reader);
+}
+
 // Serialize code for TimestampRes
 
 void Save(const memgraph::storage::replication::TimestampRes &self, memgraph::slk::Builder *builder) {
@@ -253,11 +299,13 @@ void Load(memgraph::storage::replication::AppendDeltasRes *self, memgraph::slk::
 void Save(const memgraph::storage::replication::AppendDeltasReq &self, memgraph::slk::Builder *builder) {
   memgraph::slk::Save(self.previous_commit_timestamp, builder);
   memgraph::slk::Save(self.seq_num, builder);
+  memgraph::slk::Save(self.transaction_count, builder);
 }
 
 void Load(memgraph::storage::replication::AppendDeltasReq *self, memgraph::slk::Reader *reader) {
   memgraph::slk::Load(&self->previous_commit_timestamp, reader);
   memgraph::slk::Load(&self->seq_num, reader);
+  memgraph::slk::Load(&self->transaction_count, reader);
 }
 }  // namespace slk
 }  // namespace memgraph
@@ -32,11 +32,12 @@ struct AppendDeltasReq {
   static void Load(AppendDeltasReq *self, memgraph::slk::Reader *reader);
   static void Save(const AppendDeltasReq &self, memgraph::slk::Builder *builder);
   AppendDeltasReq() {}
-  AppendDeltasReq(uint64_t previous_commit_timestamp, uint64_t seq_num)
-      : previous_commit_timestamp(previous_commit_timestamp), seq_num(seq_num) {}
+  AppendDeltasReq(uint64_t previous_commit_timestamp, uint64_t seq_num, uint64_t transaction_count)
+      : previous_commit_timestamp(previous_commit_timestamp), seq_num(seq_num), transaction_count(transaction_count) {}
 
   uint64_t previous_commit_timestamp;
   uint64_t seq_num;
+  uint64_t transaction_count;
 };
 
 struct AppendDeltasRes {
@@ -211,6 +212,46 @@ struct TimestampRes {
 };
 
 using TimestampRpc = rpc::RequestResponse<TimestampReq, TimestampRes>;
+
+struct StateBatchReq {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(StateBatchReq *self, memgraph::slk::Reader *reader);
+  static void Save(const StateBatchReq &self, memgraph::slk::Builder *builder);
+  StateBatchReq() {}
+  StateBatchReq(bool first, bool last, std::string uuid, std::string epoch_id, uint64_t last_commit_timestamp,
+                uint64_t transaction_count)
+      : first(first),
+        last(last),
+        uuid(uuid),
+        epoch_id(epoch_id),
+        last_commit_timestamp(last_commit_timestamp),
+        transaction_count(transaction_count) {}
+
+  bool first;
+  bool last;
+  std::string uuid;
+  std::string epoch_id;
+  uint64_t last_commit_timestamp;
+  uint64_t transaction_count;
+};
+
+struct StateBatchRes {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(StateBatchRes *self, memgraph::slk::Reader *reader);
+  static void Save(const StateBatchRes &self, memgraph::slk::Builder *builder);
+  StateBatchRes() {}
+  StateBatchRes(bool success, uint64_t current_commit_timestamp)
+      : success(success), current_commit_timestamp(current_commit_timestamp) {}
+
+  bool success;
+  uint64_t current_commit_timestamp;
+};
+
+using StateBatchRpc = rpc::RequestResponse<StateBatchReq, StateBatchRes>;
 }  // namespace replication
 }  // namespace storage
 }  // namespace memgraph
@@ -219,6 +260,14 @@ using TimestampRpc = rpc::RequestResponse<TimestampReq, TimestampRes>;
 #include "slk/serialization.hpp"
 namespace memgraph::slk {
 
+void Save(const memgraph::storage::replication::StateBatchRes &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::StateBatchRes *self, memgraph::slk::Reader *reader);
+
+void Save(const memgraph::storage::replication::StateBatchReq &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::StateBatchReq *self, memgraph::slk::Reader *reader);
+
 void Save(const memgraph::storage::replication::TimestampRes &self, memgraph::slk::Builder *builder);
 
 void Load(memgraph::storage::replication::TimestampRes *self, memgraph::slk::Reader *reader);
@@ -40,17 +40,27 @@ void Encoder::WritePropertyValue(const PropertyValue &value) {
   slk::Save(value, builder_);
 }
 
+void Encoder::WriteCompactUint(uint64_t value) {
+  WriteMarker(durability::Marker::TYPE_VARINT);
+  uint8_t buffer[durability::kMaxVarintSize];
+  builder_->Save(buffer, durability::EncodeVarint(value, buffer));
+}
+
+void Encoder::WriteCompactString(const std::string_view value) {
+  WriteMarker(durability::Marker::TYPE_COMPACT_STRING);
+  uint8_t buffer[durability::kMaxVarintSize];
+  builder_->Save(buffer, durability::EncodeVarint(value.size(), buffer));
+  builder_->Save(reinterpret_cast<const uint8_t *>(value.data()), value.size());
+}
+
 void Encoder::WriteBuffer(const uint8_t *buffer, const size_t buffer_size) { builder_->Save(buffer, buffer_size); }
 
-void Encoder::WriteFileData(utils::InputFile *file) {
-  auto file_size = file->GetSize();
-  uint8_t buffer[utils::kFileBufferSize];
-  while (file_size > 0) {
-    const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
-    file->Read(buffer, chunk_size);
-    WriteBuffer(buffer, chunk_size);
-    file_size -= chunk_size;
-  }
+void Encoder::WriteFileData(utils::InputFile *file) { WriteFileData(file, file->GetSize()); }
+
+void Encoder::WriteFileData(utils::InputFile *file, size_t size) {
+  const auto position = file->GetPosition();
+  builder_->SaveFile(file->fd(), position, size);
+  file->SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(position + size));
 }
 
 void Encoder::WriteFile(const std::filesystem::path &path) {
@@ -61,6 +71,7 @@ void Encoder::WriteFile(const std::filesystem::path &path) {
   WriteString(filename);
   auto file_size = file.GetSize();
   WriteUint(file_size);
+  // The file data is sent by the kernel when the builder writes to a socket.
   WriteFileData(&file);
   file.Close();
 }
@@ -79,8 +90,21 @@ std::optional<bool> Decoder::ReadBool() {
   return value;
 }
 
+std::optional<uint64_t> Decoder::ReadVarint() {
+  uint64_t value = 0;
+  for (uint64_t shift = 0; shift < 64; shift += 7) {
+    uint8_t byte;
+    reader_->Load(&byte, sizeof(byte));
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) return value;
+  }
+  return std::nullopt;
+}
+
 std::optional<uint64_t> Decoder::ReadUint() {
-  if (const auto marker = ReadMarker(); !marker || marker != durability::Marker::TYPE_INT) return std::nullopt;
+  const auto marker = ReadMarker();
+  if (marker == durability::Marker::TYPE_VARINT) return ReadVarint();
+  if (!marker || marker != durability::Marker::TYPE_INT) return std::nullopt;
   uint64_t value;
   slk::Load(&value, reader_);
   return value;
@@ -94,7 +118,15 @@ std::optional<double> Decoder::ReadDouble() {
 }
 
 std::optional<std::string> Decoder::ReadString() {
-  if (const auto marker = ReadMarker(); !marker || marker != durability::Marker::TYPE_STRING) return std::nullopt;
+  const auto marker = ReadMarker();
+  if (marker == durability::Marker::TYPE_COMPACT_STRING) {
+    const auto size = ReadVarint();
+    if (!size) return std::nullopt;
+    std::string value(*size, '\0');
+    reader_->Load(reinterpret_cast<uint8_t *>(value.data()), value.size());
+    return std::move(value);
+  }
+  if (!marker || marker != durability::Marker::TYPE_STRING) return std::nullopt;
   std::string value;
   slk::Load(&value, reader_);
   return std::move(value);
@@ -109,7 +141,16 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
 }
 
 bool Decoder::SkipString() {
-  if (const auto marker = ReadMarker(); !marker || marker != durability::Marker::TYPE_STRING) return false;
+  const auto marker = ReadMarker();
+  if (marker == durability::Marker::TYPE_COMPACT_STRING) {
+    const auto size = ReadVarint();
+    if (!size) return false;
+    for (auto left = *size; left > 0;) {
+      left -= reader_->LoadView(left).size();
+    }
+    return true;
+  }
+  if (!marker || marker != durability::Marker::TYPE_STRING) return false;
   std::string value;
   slk::Load(&value, reader_);
   return true;
@@ -136,12 +177,10 @@ std::optional<std::filesystem::path> Decoder::ReadFile(const std::filesystem::pa
   std::optional<size_t> maybe_file_size = ReadUint();
   MG_ASSERT(maybe_file_size, "File size missing");
   auto file_size = *maybe_file_size;
-  uint8_t buffer[utils::kFileBufferSize];
   while (file_size > 0) {
-    const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
-    reader_->Load(buffer, chunk_size);
-    file.Write(buffer, chunk_size);
-    file_size -= chunk_size;
+    const auto chunk = reader_->LoadView(file_size);
+    file.Write(chunk);
+    file_size -= chunk.size();
   }
   file.Close();
   return std::move(path);
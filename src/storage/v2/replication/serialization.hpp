@@ -37,10 +37,17 @@ class Encoder final : public durability::BaseEncoder {
 
   void WritePropertyValue(const PropertyValue &value) override;
 
+  void WriteCompactUint(uint64_t value) override;
+
+  void WriteCompactString(std::string_view value) override;
+
   void WriteBuffer(const uint8_t *buffer, size_t buffer_size);
 
   void WriteFileData(utils::InputFile *file);
 
+  // Write the first `size` bytes of the file.
+  void WriteFileData(utils::InputFile *file, size_t size);
+
   void WriteFile(const std::filesystem::path &path);
 
  private:
@@ -74,6 +81,8 @@ class Decoder final : public durability::BaseDecoder {
   std::optional<std::filesystem::path> ReadFile(const std::filesystem::path &directory, const std::string &suffix = "");
 
  private:
+  std::optional<uint64_t> ReadVarint();
+
   slk::Reader *reader_;
 };
 
@@ -13,6 +13,7 @@
 
 #include <type_traits>
 
+#include "storage/v2/point.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
@@ -41,6 +42,7 @@ void Load(storage::PropertyValue::Type *type, slk::Reader *reader) {
     case utils::UnderlyingCast(storage::PropertyValue::Type::List):
     case utils::UnderlyingCast(storage::PropertyValue::Type::Map):
     case utils::UnderlyingCast(storage::PropertyValue::Type::TemporalData):
+    case utils::UnderlyingCast(storage::PropertyValue::Type::Point):
       valid = true;
       break;
     default:
@@ -99,6 +101,15 @@ void Save(const storage::PropertyValue &value, slk::Builder *builder) {
       slk::Save(temporal_data.microseconds, builder);
       return;
     }
+    case storage::PropertyValue::Type::Point: {
+      slk::Save(storage::PropertyValue::Type::Point, builder);
+      const auto point = value.ValuePoint();
+      slk::Save(utils::UnderlyingCast(point.crs), builder);
+      slk::Save(point.x, builder);
+      slk::Save(point.y, builder);
+      slk::Save(point.z, builder);
+      return;
+    }
   }
 }
 
@@ -163,6 +174,20 @@ void Load(storage::PropertyValue *value, slk::Reader *reader) {
       *value = storage::PropertyValue(storage::TemporalData{temporal_type, microseconds});
       return;
     }
+    case storage::PropertyValue::Type::Point: {
+      std::underlying_type_t<storage::CoordinateReferenceSystem> srid{0};
+      slk::Load(&srid, reader);
+      const auto crs = storage::SridToCrs(srid);
+      if (!crs) throw slk::SlkDecodeException("Trying to load a point with an unknown SRID!");
+      double x{0.0};
+      double y{0.0};
+      double z{0.0};
+      slk::Load(&x, reader);
+      slk::Load(&y, reader);
+      slk::Load(&z, reader);
+      *value = storage::PropertyValue(storage::Point{*crs, x, y, z});
+      return;
+    }
   }
 }
 
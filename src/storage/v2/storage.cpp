@@ -31,6 +31,12 @@ extern const Event SnapshotCreationLatency_us;
 
 extern const Event ActiveLabelIndices;
 extern const Event ActiveLabelPropertyIndices;
+extern const Event ActiveLabelPropertyCompositeIndices;
+extern const Event ActiveEdgeTypeIndices;
+extern const Event ActiveEdgeTypePropertyIndices;
+extern const Event ActiveTextIndices;
+extern const Event ActivePointIndices;
+extern const Event ActiveVectorIndices;
 }  // namespace memgraph::metrics
 
 namespace memgraph::storage {
@@ -54,7 +60,7 @@ Storage::Storage(Config config, StorageMode storage_mode)
       constraints_(config, storage_mode),
       id_(config.name),
       replication_state_(config_.durability.restore_replication_state_on_startup,
-                         config_.durability.storage_directory) {}
+                         config_.durability.storage_directory, config_.durability.replication_sync_quorum) {}
 
 Storage::Accessor::Accessor(Storage *storage, IsolationLevel isolation_level, StorageMode storage_mode)
     : storage_(storage),
@@ -71,6 +77,8 @@ Storage::Accessor::Accessor(Accessor &&other) noexcept
       storage_guard_(std::move(other.storage_guard_)),
       transaction_(std::move(other.transaction_)),
       commit_timestamp_(other.commit_timestamp_),
+      commit_changes_(std::move(other.commit_changes_)),
+      saved_command_id_(other.saved_command_id_),
       is_transaction_active_(other.is_transaction_active_),
       creation_storage_mode_(other.creation_storage_mode_) {
   // Don't allow the other accessor to abort our transaction in destructor.
@@ -79,12 +87,31 @@ Storage::Accessor::Accessor(Accessor &&other) noexcept
 }
 
 IndicesInfo Storage::ListAllIndices() const {
-  std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
-  return {indices_.label_index_->ListIndices(), indices_.label_property_index_->ListIndices()};
+  std::shared_lock<utils::ScalableRWLock> storage_guard_(main_lock_);
+  IndicesInfo info{indices_.label_index_->ListIndices(), indices_.label_property_index_->ListIndices(), {}, {}, {}, {}, {}};
+  if (indices_.label_property_composite_index_) {
+    info.label_property_composite = indices_.label_property_composite_index_->ListIndices();
+  }
+  if (indices_.edge_type_index_) {
+    info.edge_type = indices_.edge_type_index_->ListIndices();
+  }
+  if (indices_.edge_type_property_index_) {
+    info.edge_type_property = indices_.edge_type_property_index_->ListIndices();
+  }
+  if (indices_.text_index_) {
+    info.text = indices_.text_index_->ListIndices();
+  }
+  if (indices_.point_index_) {
+    info.point = indices_.point_index_->ListIndices();
+  }
+  if (indices_.vector_index_) {
+    info.vector = indices_.vector_index_->ListIndices();
+  }
+  return info;
 }
 
 ConstraintsInfo Storage::ListAllConstraints() const {
-  std::shared_lock<utils::RWLock> storage_guard_(main_lock_);
+  std::shared_lock<utils::ScalableRWLock> storage_guard_(main_lock_);
   return {constraints_.existence_constraints_->ListConstraints(), constraints_.unique_constraints_->ListConstraints()};
 }
 
@@ -96,6 +123,7 @@ void Storage::SetStorageMode(StorageMode storage_mode) {
       (storage_mode == StorageMode::IN_MEMORY_ANALYTICAL || storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL));
   if (storage_mode_ != storage_mode) {
     storage_mode_ = storage_mode;
+    ++storage_mode_changes_;
     FreeMemory(std::move(main_guard));
   }
 }
@@ -123,11 +151,46 @@ std::optional<uint64_t> Storage::Accessor::GetTransactionId() const {
   return {};
 }
 
+std::optional<SnapshotId> Storage::Accessor::GetSnapshotId() const {
+  if (!is_transaction_active_ || !transaction_.last_commit_timestamp) return std::nullopt;
+  if (transaction_.isolation_level != IsolationLevel::SNAPSHOT_ISOLATION ||
+      transaction_.storage_mode != StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    return std::nullopt;
+  }
+  if (!transaction_.deltas.use().empty()) return std::nullopt;
+  return SnapshotId{.last_commit_timestamp = *transaction_.last_commit_timestamp,
+                    .storage_mode_changes = storage_->storage_mode_changes_};
+}
+
 void Storage::Accessor::AdvanceCommand() {
   transaction_.manyDeltasCache.Clear();  // TODO: Just invalidate the View::OLD cache, NEW should still be fine
   ++transaction_.command_id;
 }
 
+void Storage::Accessor::ReadStateBeforeTransaction(bool enabled) {
+  if (enabled == saved_command_id_.has_value()) return;
+  // View::OLD reads undo the changes of the commands from the current one on,
+  // so all the changes are undone from the first command.
+  transaction_.manyDeltasCache.Clear();
+  if (enabled) {
+    saved_command_id_ = std::exchange(transaction_.command_id, 0);
+  } else {
+    transaction_.command_id = *std::exchange(saved_command_id_, std::nullopt);
+  }
+}
+
+std::vector<VertexAccessor> Storage::Accessor::CreateVertices(uint64_t count, const std::vector<LabelId> &labels) {
+  std::vector<VertexAccessor> vertices;
+  vertices.reserve(count);
+  for (uint64_t i = 0; i < count; ++i) {
+    auto &vertex = vertices.emplace_back(CreateVertex());
+    for (const auto label : labels) {
+      MG_ASSERT(vertex.AddLabel(label).HasValue(), "Couldn't add a label to a created vertex!");
+    }
+  }
+  return vertices;
+}
+
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
   auto res = DetachDelete({vertex}, {}, false);
 
@@ -206,7 +269,7 @@ Storage::Accessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector
   if (maybe_nodes_to_delete.HasError()) {
     return maybe_nodes_to_delete.GetError();
   }
-  const std::unordered_set<Vertex *> nodes_to_delete = *maybe_nodes_to_delete.GetValue();
+  const std::unordered_set<Vertex *> nodes_to_delete = std::move(*maybe_nodes_to_delete.GetValue());
 
   // 2. Gather edges and corresponding node on the other end of the edge for the deletable nodes
   EdgeInfoForDeletion edge_deletion_info = PrepareDeletableEdges(nodes_to_delete, edges, detach);
@@ -220,7 +283,7 @@ Storage::Accessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector
       return maybe_cleared_edges.GetError();
     }
 
-    deleted_edges = *maybe_cleared_edges.GetValue();
+    deleted_edges = std::move(*maybe_cleared_edges.GetValue());
   }
 
   // Detach nodes on the other end, which don't need deletion, by passing once through their vectors
@@ -228,8 +291,9 @@ Storage::Accessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector
   if (maybe_remaining_edges.HasError()) {
     return maybe_remaining_edges.GetError();
   }
-  const std::vector<EdgeAccessor> remaining_edges = *maybe_remaining_edges.GetValue();
-  deleted_edges.insert(deleted_edges.end(), remaining_edges.begin(), remaining_edges.end());
+  auto &remaining_edges = *maybe_remaining_edges.GetValue();
+  deleted_edges.insert(deleted_edges.end(), std::make_move_iterator(remaining_edges.begin()),
+                       std::make_move_iterator(remaining_edges.end()));
 
   auto const maybe_deleted_vertices = TryDeleteVertices(nodes_to_delete);
   if (maybe_deleted_vertices.HasError()) {
@@ -264,7 +328,7 @@ Result<std::optional<std::unordered_set<Vertex *>>> Storage::Accessor::PrepareDe
     nodes_to_delete.insert(vertex_ptr);
   }
 
-  return std::make_optional<std::unordered_set<Vertex *>>(nodes_to_delete);
+  return std::make_optional<std::unordered_set<Vertex *>>(std::move(nodes_to_delete));
 }
 
 EdgeInfoForDeletion Storage::Accessor::PrepareDeletableEdges(const std::unordered_set<Vertex *> &vertices,
@@ -283,7 +347,7 @@ EdgeInfoForDeletion Storage::Accessor::PrepareDeletableEdges(const std::unordere
     const auto &[edge_type, opposing_vertex, edge] = item;
     if (!vertices.contains(opposing_vertex)) {
       partial_delete_vertices.insert(opposing_vertex);
-      auto const edge_gid = storage_->config_.items.properties_on_edges ? edge.ptr->gid : edge.gid;
+      auto const edge_gid = storage_->config_.items.PropertiesOnEdges(edge_type) ? edge.ptr->gid : edge.gid;
       edge_ids.insert(edge_gid);
     }
   };
@@ -291,19 +355,13 @@ EdgeInfoForDeletion Storage::Accessor::PrepareDeletableEdges(const std::unordere
   // add nodes which need to be detached on the other end of the edge
   if (detach) {
     for (auto *vertex_ptr : vertices) {
-      std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-      std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
-
-      {
-        auto vertex_lock = std::shared_lock{vertex_ptr->lock};
-        in_edges = vertex_ptr->in_edges;
-        out_edges = vertex_ptr->out_edges;
-      }
-
-      for (auto const &item : in_edges) {
+      // The adjacency lists are read in place, copying them would double the
+      // memory needed for deleting vertices with many edges.
+      auto vertex_lock = std::shared_lock{vertex_ptr->lock};
+      for (auto const &item : vertex_ptr->in_edges) {
         try_adding_partial_delete_vertices(partial_src_vertices, src_edge_ids, item);
       }
-      for (auto const &item : out_edges) {
+      for (auto const &item : vertex_ptr->out_edges) {
         try_adding_partial_delete_vertices(partial_dest_vertices, dest_edge_ids, item);
       }
     }
@@ -336,28 +394,31 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
                          auto *vertex_ptr, auto *attached_edges_to_vertex, auto deletion_delta,
                          auto reverse_vertex_order) -> Result<std::optional<ReturnType>> {
     auto vertex_lock = std::unique_lock{vertex_ptr->lock};
+    if (attached_edges_to_vertex->empty()) return std::make_optional<ReturnType>();
+
+    if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
+    MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
+
     while (!attached_edges_to_vertex->empty()) {
       // get the information about the last edge in the vertex collection
       auto const &[edge_type, opposing_vertex, edge_ref] = *attached_edges_to_vertex->rbegin();
+      const bool properties_on_edge = storage_->config_.items.PropertiesOnEdges(edge_type);
 
       std::unique_lock<utils::RWSpinLock> guard;
-      if (storage_->config_.items.properties_on_edges) {
+      if (properties_on_edge) {
         auto edge_ptr = edge_ref.ptr;
         guard = std::unique_lock{edge_ptr->lock};
 
         if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
       }
 
-      if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
-      MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
-
       attached_edges_to_vertex->pop_back();
-      if (storage_->config_.items.properties_on_edges) {
+      if (properties_on_edge) {
         auto *edge_ptr = edge_ref.ptr;
         MarkEdgeAsDeleted(edge_ptr);
       }
 
-      auto const edge_gid = storage_->config_.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
+      auto const edge_gid = properties_on_edge ? edge_ref.ptr->gid : edge_ref.gid;
       auto const [_, was_inserted] = deleted_edge_ids.insert(edge_gid);
       bool const edge_cleared_from_both_directions = !was_inserted;
       if (edge_cleared_from_both_directions) {
@@ -387,7 +448,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
     }
   }
 
-  return std::make_optional<ReturnType>(deleted_edges);
+  return std::make_optional<ReturnType>(std::move(deleted_edges));
 }
 
 Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemainingEdges(
@@ -404,17 +465,21 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
     MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
 
-    auto mid = std::partition(
-        edges_attached_to_vertex->begin(), edges_attached_to_vertex->end(), [this, &set_for_erasure](auto &edge) {
-          auto const &[edge_type, opposing_vertex, edge_ref] = edge;
-          auto const edge_gid = storage_->config_.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
-          return !set_for_erasure.contains(edge_gid);
-        });
-
-    for (auto it = mid; it != edges_attached_to_vertex->end(); it++) {
+    // The removed edges are detached and the kept ones are moved to the front
+    // in a single pass, which keeps the edges grouped by edge type.
+    auto kept_end = edges_attached_to_vertex->begin();
+    for (auto it = kept_end; it != edges_attached_to_vertex->end(); ++it) {
       auto const &[edge_type, opposing_vertex, edge_ref] = *it;
+      const bool properties_on_edge = storage_->config_.items.PropertiesOnEdges(edge_type);
+      auto const edge_gid = properties_on_edge ? edge_ref.ptr->gid : edge_ref.gid;
+      if (!set_for_erasure.contains(edge_gid)) {
+        if (kept_end != it) *kept_end = std::move(*it);
+        ++kept_end;
+        continue;
+      }
+
       std::unique_lock<utils::RWSpinLock> guard;
-      if (storage_->config_.items.properties_on_edges) {
+      if (properties_on_edge) {
         auto edge_ptr = edge_ref.ptr;
         guard = std::unique_lock{edge_ptr->lock};
         // this can happen only if we marked edges for deletion with no nodes,
@@ -424,7 +489,6 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
 
       CreateAndLinkDelta(&transaction_, vertex_ptr, deletion_delta, edge_type, opposing_vertex, edge_ref);
 
-      auto const edge_gid = storage_->config_.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
       auto const [_, was_inserted] = partially_detached_edge_ids.insert(edge_gid);
       bool const edge_cleared_from_both_directions = !was_inserted;
       if (edge_cleared_from_both_directions) {
@@ -435,7 +499,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
       }
     }
 
-    edges_attached_to_vertex->erase(mid, edges_attached_to_vertex->end());
+    edges_attached_to_vertex->erase(kept_end, edges_attached_to_vertex->end());
 
     return std::make_optional<ReturnType>();
   };
@@ -456,7 +520,7 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
     }
   }
 
-  return std::make_optional<ReturnType>(deleted_edges);
+  return std::make_optional<ReturnType>(std::move(deleted_edges));
 }
 
 Result<std::vector<VertexAccessor>> Storage::Accessor::TryDeleteVertices(const std::unordered_set<Vertex *> &vertices) {
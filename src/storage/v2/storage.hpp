@@ -17,11 +17,13 @@
 #include "kvstore/kvstore.hpp"
 #include "query/exceptions.hpp"
 #include "storage/v2/all_vertices_iterable.hpp"
+#include "storage/v2/commit_changes.hpp"
 #include "storage/v2/commit_log.hpp"
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/edge_accessor.hpp"
+#include "storage/v2/edges_iterable.hpp"
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/replication/config.hpp"
@@ -35,15 +37,25 @@
 #include "storage/v2/vertices_iterable.hpp"
 #include "utils/event_counter.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/scalable_rw_lock.hpp"
 #include "utils/scheduler.hpp"
 #include "utils/timer.hpp"
 #include "utils/uuid.hpp"
 
 namespace memgraph::metrics {
 extern const Event SnapshotCreationLatency_us;
+extern const Event GcCycleLatency_us;
+
+extern const Event GcFreedBytes;
 
 extern const Event ActiveLabelIndices;
 extern const Event ActiveLabelPropertyIndices;
+extern const Event ActiveLabelPropertyCompositeIndices;
+extern const Event ActiveEdgeTypeIndices;
+extern const Event ActiveEdgeTypePropertyIndices;
+extern const Event ActiveTextIndices;
+extern const Event ActivePointIndices;
+extern const Event ActiveVectorIndices;
 }  // namespace memgraph::metrics
 
 namespace memgraph::storage {
@@ -54,6 +66,12 @@ class EdgeAccessor;
 struct IndicesInfo {
   std::vector<LabelId> label;
   std::vector<std::pair<LabelId, PropertyId>> label_property;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+  std::vector<EdgeTypeId> edge_type;
+  std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
+  std::vector<std::pair<LabelId, PropertyId>> text;
+  std::vector<std::pair<LabelId, PropertyId>> point;
+  std::vector<std::pair<LabelId, PropertyId>> vector;
 };
 
 struct ConstraintsInfo {
@@ -67,6 +85,16 @@ struct StorageInfo {
   double average_degree;
   uint64_t memory_usage;
   uint64_t disk_usage;
+  // MVCC health as seen by the last garbage collection cycle, only tracked by
+  // the in-memory storage. The uncollected transactions are the committed ones
+  // whose deltas may still be read by an active transaction.
+  uint64_t uncollected_transactions{0};
+  // Milliseconds since the oldest active transaction was first seen by the
+  // garbage collector, 0 if there is no active transaction.
+  uint64_t oldest_active_transaction_age_ms{0};
+  // Entries of each label, label-property and edge-type index, including the
+  // obsolete ones the garbage collector hasn't removed yet.
+  std::vector<std::pair<std::string, uint64_t>> index_entries{};
 };
 
 struct EdgeInfoForDeletion {
@@ -76,6 +104,16 @@ struct EdgeInfoForDeletion {
   std::unordered_set<Vertex *> partial_dest_vertices{};
 };
 
+/// Committed state of the database, as seen by a transaction.
+struct SnapshotId {
+  uint64_t last_commit_timestamp;
+  // Analytical transactions change the database without committing, so
+  // their changes are told apart by the storage mode changes.
+  uint64_t storage_mode_changes;
+
+  friend bool operator==(const SnapshotId &, const SnapshotId &) = default;
+};
+
 class Storage {
   friend class ReplicationServer;
   friend class ReplicationClient;
@@ -105,6 +143,11 @@ class Storage {
 
     virtual VertexAccessor CreateVertex() = 0;
 
+    /// Creates `count` vertices which have the `labels`, the same as creating
+    /// each one with `CreateVertex` and adding the labels to it.
+    /// @throw std::bad_alloc
+    virtual std::vector<VertexAccessor> CreateVertices(uint64_t count, const std::vector<LabelId> &labels);
+
     virtual std::optional<VertexAccessor> FindVertex(Gid gid, View view) = 0;
 
     virtual VerticesIterable Vertices(View view) = 0;
@@ -113,12 +156,64 @@ class Storage {
 
     virtual VerticesIterable Vertices(LabelId label, PropertyId property, View view) = 0;
 
+    /// Splits the vertices into at most `num_chunks` iterables of about the
+    /// same size, which may be iterated by different threads at once while
+    /// the transaction caches are frozen. Returns no iterables if the storage
+    /// can't split the vertices.
+    virtual std::vector<VerticesIterable> ChunkedVertices(View /*view*/, uint64_t /*num_chunks*/) { return {}; }
+
+    /// Splits the vertices with `label` like `ChunkedVertices(View, uint64_t)`.
+    virtual std::vector<VerticesIterable> ChunkedVertices(LabelId /*label*/, View /*view*/,
+                                                          uint64_t /*num_chunks*/) {
+      return {};
+    }
+
     virtual VerticesIterable Vertices(LabelId label, PropertyId property, const PropertyValue &value, View view) = 0;
 
     virtual VerticesIterable Vertices(LabelId label, PropertyId property,
                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
 
+    /// Uses the composite index on `label` and `properties`. The first
+    /// `prefix.size()` properties have to be equal to `prefix` and, if any of
+    /// the bounds is set, the next property has to be inside of them.
+    virtual VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                      const std::vector<PropertyValue> &prefix,
+                                      const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                      const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
+    /// Uses the text index on `label` and `property` to find the vertices
+    /// whose value of the property satisfies `match` with `pattern`.
+    virtual VerticesIterable Vertices(LabelId label, PropertyId property, TextMatch match, const std::string &pattern,
+                                      View view) = 0;
+
+    /// Returns at most `limit` vertices from the text index on `label` and
+    /// `property` which are similar to `query`, best matches first.
+    virtual std::vector<std::pair<VertexAccessor, double>> TextSearch(LabelId label, PropertyId property,
+                                                                      std::string_view query, uint64_t limit,
+                                                                      View view) = 0;
+
+    /// Uses the point index on `label` and `property` to find the vertices
+    /// whose value of the property is a point in `region`.
+    virtual VerticesIterable Vertices(LabelId label, PropertyId property, const PointRegion &region, View view) = 0;
+
+    /// Returns at most `limit` vertices from the vector index on `label` and
+    /// `property` which are close to `query` by `metric`, nearest first.
+    virtual std::vector<std::pair<VertexAccessor, double>> VectorSearch(LabelId label, PropertyId property,
+                                                                        const std::vector<float> &query,
+                                                                        uint64_t limit, VectorMetric metric,
+                                                                        View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) = 0;
+
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property,
+                                const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
     virtual Result<std::optional<VertexAccessor>> DeleteVertex(VertexAccessor *vertex);
 
     virtual Result<std::optional<std::pair<VertexAccessor, std::vector<EdgeAccessor>>>> DetachDeleteVertex(
@@ -139,16 +234,69 @@ class Storage {
                                             const std::optional<utils::Bound<PropertyValue>> &lower,
                                             const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
 
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                            const std::vector<PropertyValue> &prefix) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                            const std::vector<PropertyValue> &prefix,
+                                            const std::optional<utils::Bound<PropertyValue>> &lower,
+                                            const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property, TextMatch match,
+                                            std::string_view pattern) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, PropertyId property, const PointRegion &region) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                          const PropertyValue &value) const = 0;
+
+    virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
+
+    /// Returns the exact number of vertices with the label visible to the
+    /// transaction, or nothing if the storage can't count them cheaply.
+    virtual std::optional<uint64_t> VertexCount(LabelId label) const = 0;
+
+    /// Returns the exact number of edges of the type visible to the
+    /// transaction, or nothing if the storage can't count them cheaply.
+    virtual std::optional<uint64_t> EdgeCount(EdgeTypeId edge_type) const = 0;
+
+    /// Returns true if `FindVertexByUniqueKey` can look up the vertices with
+    /// the `label` by the values of the `properties`.
+    virtual bool CanFindVertexByUniqueKey(LabelId label, const std::set<PropertyId> &properties) const = 0;
+
+    /// Returns the vertex visible to the transaction which has the `label` and
+    /// the `values` of the `properties`, using the unique constraint on them.
+    /// Returns `Error::SERIALIZATION_ERROR` if there's no such vertex, but
+    /// another transaction created one the transaction can't see, so creating
+    /// it would violate the constraint.
+    virtual Result<std::optional<VertexAccessor>> FindVertexByUniqueKey(LabelId label,
+                                                                        const std::set<PropertyId> &properties,
+                                                                        const std::vector<PropertyValue> &values) = 0;
+
     virtual std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const = 0;
 
     virtual std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
         const storage::LabelId &label, const storage::PropertyId &property) const = 0;
 
+    virtual std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
+        const storage::LabelId &label, const std::vector<storage::PropertyId> &properties) const = 0;
+
     virtual void SetIndexStats(const storage::LabelId &label, const LabelIndexStats &stats) = 0;
 
     virtual void SetIndexStats(const storage::LabelId &label, const storage::PropertyId &property,
                                const LabelPropertyIndexStats &stats) = 0;
 
+    virtual void SetIndexStats(const storage::LabelId &label, const std::vector<storage::PropertyId> &properties,
+                               const LabelPropertyIndexStats &stats) = 0;
+
     virtual std::vector<std::pair<LabelId, PropertyId>> ClearLabelPropertyIndexStats() = 0;
 
     virtual std::vector<LabelId> ClearLabelIndexStats() = 0;
@@ -158,10 +306,24 @@ class Storage {
 
     virtual std::vector<LabelId> DeleteLabelIndexStats(std::span<std::string> labels) = 0;
 
+    virtual std::vector<std::pair<LabelId, std::vector<PropertyId>>> ClearLabelPropertyCompositeIndexStats() = 0;
+
+    virtual std::vector<std::pair<LabelId, std::vector<PropertyId>>> DeleteLabelPropertyCompositeIndexStats(
+        std::span<std::string> labels) = 0;
+
     virtual void PrefetchInEdges(const VertexAccessor &vertex_acc) = 0;
 
     virtual void PrefetchOutEdges(const VertexAccessor &vertex_acc) = 0;
 
+    /// Prefetches the edges of all vertices at once, which needs fewer reads
+    /// than prefetching them vertex by vertex. Only the edges of the given
+    /// types are prefetched, or all of them if `edge_types` is empty.
+    virtual void PrefetchInEdges(const std::vector<VertexAccessor> &vertices,
+                                 const std::vector<EdgeTypeId> &edge_types) = 0;
+
+    virtual void PrefetchOutEdges(const std::vector<VertexAccessor> &vertices,
+                                  const std::vector<EdgeTypeId> &edge_types) = 0;
+
     virtual Result<EdgeAccessor> CreateEdge(VertexAccessor *from, VertexAccessor *to, EdgeTypeId edge_type) = 0;
 
     virtual Result<EdgeAccessor> EdgeSetFrom(EdgeAccessor *edge, VertexAccessor *new_from) = 0;
@@ -174,6 +336,21 @@ class Storage {
 
     virtual bool LabelPropertyIndexExists(LabelId label, PropertyId property) const = 0;
 
+    virtual bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    /// Returns the property lists of all composite indices on `label`.
+    virtual std::vector<std::vector<PropertyId>> LabelPropertyCompositeIndices(LabelId label) const = 0;
+
+    virtual bool EdgeTypeIndexExists(EdgeTypeId edge_type) const = 0;
+
+    virtual bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
+
+    virtual bool TextIndexExists(LabelId label, PropertyId property) const = 0;
+
+    virtual bool PointIndexExists(LabelId label, PropertyId property) const = 0;
+
+    virtual bool VectorIndexExists(LabelId label, PropertyId property) const = 0;
+
     virtual IndicesInfo ListAllIndices() const = 0;
 
     virtual ConstraintsInfo ListAllConstraints() const = 0;
@@ -188,8 +365,36 @@ class Storage {
 
     std::optional<uint64_t> GetTransactionId() const;
 
+    uint64_t GetStartTimestamp() const { return transaction_.start_timestamp; }
+
+    /// Returns the timestamp of the committed transaction, not set if the
+    /// transaction didn't change anything.
+    std::optional<uint64_t> GetCommitTimestamp() const { return commit_timestamp_; }
+
+    /// Returns the committed state of the database which the transaction
+    /// sees, if it sees nothing else: it's a snapshot isolation transaction
+    /// in the in-memory transactional mode which hasn't changed anything.
+    std::optional<SnapshotId> GetSnapshotId() const;
+
+    /// Makes the next Commit collect the net changes of the transaction, which
+    /// TakeCommitChanges returns once the commit succeeds. Only the in-memory
+    /// transactional mode records the changes of a transaction, so they are
+    /// never collected in the other modes.
+    void CollectCommitChanges() { commit_changes_.emplace(); }
+
+    std::optional<CommitChanges> TakeCommitChanges() { return std::exchange(commit_changes_, std::nullopt); }
+
     void AdvanceCommand();
 
+    /// While enabled, View::OLD reads of the transaction see the objects as
+    /// they were before the transaction changed them, rather than as they were
+    /// before its current command. View::NEW reads aren't valid meanwhile.
+    void ReadStateBeforeTransaction(bool enabled);
+
+    /// While frozen, the caches of the transaction are only read so that the
+    /// transaction may be read by several threads at once.
+    void FreezeTransactionCaches(bool frozen) { transaction_.manyDeltasCache.Freeze(frozen); }
+
     const std::string &LabelToName(LabelId label) const { return storage_->LabelToName(label); }
 
     const std::string &PropertyToName(PropertyId property) const { return storage_->PropertyToName(property); }
@@ -208,9 +413,12 @@ class Storage {
 
    protected:
     Storage *storage_;
-    std::shared_lock<utils::RWLock> storage_guard_;
+    std::shared_lock<utils::ScalableRWLock> storage_guard_;
     Transaction transaction_;
     std::optional<uint64_t> commit_timestamp_;
+    std::optional<CommitChanges> commit_changes_;
+    // Command of the transaction while `ReadStateBeforeTransaction` is enabled.
+    std::optional<uint64_t> saved_command_id_;
     bool is_transaction_active_;
 
     // Detach delete private methods
@@ -251,7 +459,7 @@ class Storage {
 
   StorageMode GetStorageMode() const;
 
-  virtual void FreeMemory(std::unique_lock<utils::RWLock> main_guard) = 0;
+  virtual void FreeMemory(std::unique_lock<utils::ScalableRWLock> main_guard) = 0;
 
   void FreeMemory() { FreeMemory({}); }
 
@@ -286,6 +494,92 @@ class Storage {
     return DropIndex(label, property, std::optional<uint64_t>{});
   }
 
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      LabelId label, const std::vector<PropertyId> &properties, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label,
+                                                                    const std::vector<PropertyId> &properties) {
+    return CreateIndex(label, properties, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      LabelId label, const std::vector<PropertyId> &properties, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label,
+                                                                  const std::vector<PropertyId> &properties) {
+    return DropIndex(label, properties, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type) {
+    return CreateIndex(edge_type, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+      EdgeTypeId edge_type, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type, PropertyId property) {
+    return CreateIndex(edge_type, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId edge_type, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) {
+    return DropIndex(edge_type, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+      EdgeTypeId edge_type, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type, PropertyId property) {
+    return DropIndex(edge_type, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateTextIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateTextIndex(LabelId label, PropertyId property) {
+    return CreateTextIndex(label, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropTextIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropTextIndex(LabelId label, PropertyId property) {
+    return DropTextIndex(label, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreatePointIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreatePointIndex(LabelId label, PropertyId property) {
+    return CreatePointIndex(label, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropPointIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropPointIndex(LabelId label, PropertyId property) {
+    return DropPointIndex(label, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateVectorIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> CreateVectorIndex(LabelId label, PropertyId property) {
+    return CreateVectorIndex(label, property, std::optional<uint64_t>{});
+  }
+
+  virtual utils::BasicResult<StorageIndexDefinitionError, void> DropVectorIndex(
+      LabelId label, PropertyId property, std::optional<uint64_t> desired_commit_timestamp) = 0;
+
+  utils::BasicResult<StorageIndexDefinitionError, void> DropVectorIndex(LabelId label, PropertyId property) {
+    return DropVectorIndex(label, property, std::optional<uint64_t>{});
+  }
+
   IndicesInfo ListAllIndices() const;
 
   virtual utils::BasicResult<StorageExistenceConstraintDefinitionError, void> CreateExistenceConstraint(
@@ -342,7 +636,11 @@ class Storage {
   /// @pre The instance should have a MAIN role
   bool UnregisterReplica(const std::string &name) { return replication_state_.UnregisterReplica(name); }
   replication::ReplicationRole GetReplicationRole() const { return replication_state_.GetRole(); }
+  /// The commit timestamp of the last transaction committed on MAIN, or
+  /// replicated from it on a REPLICA.
+  uint64_t LastCommitTimestamp() const { return replication_state_.last_commit_timestamp_.load(); }
   auto ReplicasInfo() { return replication_state_.ReplicasInfo(); }
+  auto ReplicasMetrics() { return replication_state_.ReplicasMetrics(); }
   std::optional<replication::ReplicaState> GetReplicaState(std::string_view name) {
     return replication_state_.GetReplicaState(name);
   }
@@ -357,7 +655,7 @@ class Storage {
   // creation of new accessors by taking a unique lock. This is used when doing
   // operations on storage that affect the global state, for example index
   // creation.
-  mutable utils::RWLock main_lock_{utils::RWLock::Priority::WRITE};
+  mutable utils::ScalableRWLock main_lock_;
 
   // Even though the edge count is already kept in the `edges_` SkipList, the
   // list is used only when properties are enabled for edges. Because of that we
@@ -368,13 +666,18 @@ class Storage {
   std::unique_ptr<NameIdMapper> name_id_mapper_;
   Config config_;
 
-  // Transaction engine
+  // Transaction engine. The IDs and timestamps are atomic so that in-memory
+  // transactions can begin without the engine lock, which serializes the
+  // commits.
   utils::SpinLock engine_lock_;
-  uint64_t timestamp_{kTimestampInitialId};
-  uint64_t transaction_id_{kTransactionInitialId};
+  std::atomic<uint64_t> timestamp_{kTimestampInitialId};
+  std::atomic<uint64_t> transaction_id_{kTransactionInitialId};
 
   IsolationLevel isolation_level_;
   StorageMode storage_mode_;
+  // Changed under the unique main lock, so it's stable while an accessor
+  // exists.
+  uint64_t storage_mode_changes_{0};
 
   Indices indices_;
   Constraints constraints_;
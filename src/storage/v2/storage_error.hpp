@@ -27,7 +27,13 @@ struct ConstraintsPersistenceError {};
 struct SerializationError {};
 inline bool operator==(const SerializationError & /*err1*/, const SerializationError & /*err2*/) { return true; }
 
-using StorageDataManipulationError = std::variant<ConstraintViolation, ReplicationError, SerializationError>;
+// The on-disk storage couldn't write the commit because RocksDB stalled the
+// writes while the compactions catch up.
+struct WriteStallError {};
+inline bool operator==(const WriteStallError & /*err1*/, const WriteStallError & /*err2*/) { return true; }
+
+using StorageDataManipulationError =
+    std::variant<ConstraintViolation, ReplicationError, SerializationError, WriteStallError>;
 
 struct IndexDefinitionError {};
 using StorageIndexDefinitionError = std::variant<IndexDefinitionError, ReplicationError, IndexPersistenceError>;
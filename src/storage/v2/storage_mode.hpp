@@ -16,6 +16,11 @@
 
 namespace memgraph::storage {
 
+// NOTE: There is no tiered mode which keeps hot objects in memory and evicts
+// cold ones to disk. The in-memory storage links vertices, edges, deltas and
+// index entries through raw pointers into its skip lists, so an object can't be
+// evicted while anything may still reference it. Such a mode would need stable
+// handles instead of pointers in all of those structures.
 enum class StorageMode : std::uint8_t { IN_MEMORY_ANALYTICAL, IN_MEMORY_TRANSACTIONAL, ON_DISK_TRANSACTIONAL };
 
 std::string_view StorageModeToString(memgraph::storage::StorageMode storage_mode);
@@ -15,6 +15,7 @@
 #include <limits>
 #include <list>
 #include <memory>
+#include <optional>
 
 #include "utils/memory.hpp"
 #include "utils/skip_list.hpp"
@@ -23,19 +24,25 @@
 #include "storage/v2/edge.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/modified_edge.hpp"
+#include "storage/v2/property_store.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage_mode.hpp"
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertex_info_cache.hpp"
+#include "storage/v2/vertex_version_cache.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/bond.hpp"
-#include "utils/pmr/list.hpp"
+#include "utils/pmr/deque.hpp"
 
 namespace memgraph::storage {
 
 const uint64_t kTimestampInitialId = 0;
 const uint64_t kTransactionInitialId = 1ULL << 63U;
-using PmrListDelta = utils::pmr::list<Delta>;
+// The deltas of a transaction are allocated in chunks from the transaction's
+// own arena (see `Bond`), which is released in one go once the GC is done with
+// them. A deque never relocates its elements on `emplace_back`, so pointers to
+// the deltas stored in the version chains stay valid.
+using PmrDeltas = utils::pmr::deque<Delta>;
 
 struct Transaction {
   Transaction(uint64_t transaction_id, uint64_t start_timestamp, IsolationLevel isolation_level,
@@ -59,7 +66,10 @@ struct Transaction {
         isolation_level(other.isolation_level),
         storage_mode(other.storage_mode),
         edge_import_mode_active(other.edge_import_mode_active),
-        manyDeltasCache{std::move(other.manyDeltasCache)} {}
+        last_commit_timestamp(other.last_commit_timestamp),
+        manyDeltasCache{std::move(other.manyDeltasCache)},
+        vertex_version_cache(other.vertex_version_cache),
+        dictionary_encoded_properties(other.dictionary_encoded_properties) {}
 
   Transaction(const Transaction &) = delete;
   Transaction &operator=(const Transaction &) = delete;
@@ -92,17 +102,29 @@ struct Transaction {
   std::unique_ptr<std::atomic<uint64_t>> commit_timestamp;
   uint64_t command_id;
 
-  Bond<PmrListDelta> deltas;
+  Bond<PmrDeltas> deltas;
   bool must_abort;
   IsolationLevel isolation_level;
   StorageMode storage_mode;
   bool edge_import_mode_active{false};
 
+  // Commit timestamp of the last transaction which this transaction sees, if
+  // the storage keeps it.
+  std::optional<uint64_t> last_commit_timestamp;
+
   // A cache which is consistent to the current transaction_id + command_id.
   // Used to speedup getting info about a vertex when there is a long delta
   // chain involved in rebuilding that info.
   mutable VertexInfoCache manyDeltasCache;
 
+  // A cache of committed vertex versions shared by all transactions of the
+  // storage. Not used if null.
+  VertexVersionCache *vertex_version_cache{nullptr};
+
+  // Properties whose string values the transaction stores as dictionary codes.
+  // Not used if null.
+  const DictionaryEncodedProperties *dictionary_encoded_properties{nullptr};
+
   // Store modified edges GID mapped to changed Delta and serialized edge key
   ModifiedEdgesMap modified_edges_;
 };
@@ -19,10 +19,19 @@
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/vertex_edges.hpp"
+#include "utils/compact_vector.hpp"
+#include "utils/lock_contention.hpp"
 #include "utils/rw_spin_lock.hpp"
 
 namespace memgraph::storage {
 
+/// Almost all vertices have only a handful of labels, so they are stored
+/// inline in the vertex and a heap allocation happens only for vertices
+/// with more than `kVertexInlineLabels` labels.
+inline constexpr uint32_t kVertexInlineLabels = 3;
+using VertexLabels = utils::CompactVector<LabelId, kVertexInlineLabels>;
+
 struct Vertex {
   Vertex(Gid gid, Delta *delta) : gid(gid), deleted(false), delta(delta) {
     MG_ASSERT(delta == nullptr || delta->action == Delta::Action::DELETE_OBJECT ||
@@ -30,13 +39,13 @@ struct Vertex {
               "Vertex must be created with an initial DELETE_OBJECT delta!");
   }
 
-  Gid gid;
-
-  std::vector<LabelId> labels;
-  PropertyStore properties;
+  // The members are ordered by how often they are accessed. The hot header
+  // (gid, lock, deleted flag and delta pointer) is read by every visibility
+  // check, so it is kept together with the labels at the start of the object,
+  // where it shares a cache line with the skip list node. The cold payload
+  // (properties and adjacency lists) is only touched when it is actually read.
 
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-  std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
+  Gid gid;
 
   mutable utils::RWSpinLock lock;
   bool deleted;
@@ -44,6 +53,14 @@ struct Vertex {
   // uint16_t PAD;
 
   Delta *delta;
+
+  VertexLabels labels;
+
+  PropertyStore properties;
+
+  // Both are kept grouped by edge type, see `VertexEdges`.
+  VertexEdges in_edges;
+  VertexEdges out_edges;
 };
 
 static_assert(alignof(Vertex) >= 8, "The Vertex should be aligned to at least 8!");
@@ -53,4 +70,15 @@ inline bool operator<(const Vertex &first, const Vertex &second) { return first.
 inline bool operator==(const Vertex &first, const Gid &second) { return first.gid == second; }
 inline bool operator<(const Vertex &first, const Gid &second) { return first.gid < second; }
 
+/// Gids of the vertices, of all the storages, whose locks were waited for the
+/// longest.
+inline utils::LockContentionTable vertex_lock_contention;
+
+/// Locks `guard`, a deferred guard of the lock of `vertex`, recording the wait
+/// in `vertex_lock_contention` if the lock was held by another thread.
+template <typename TGuard>
+void LockVertex(TGuard &guard, const Vertex &vertex) {
+  utils::LockAndRecordContention(guard, vertex_lock_contention, vertex.gid.AsUint());
+}
+
 }  // namespace memgraph::storage
@@ -11,11 +11,14 @@
 
 #include "storage/v2/vertex_accessor.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <utility>
 
 #include "query/exceptions.hpp"
+#include "storage/v2/access_counters.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/indices.hpp"
@@ -24,12 +27,81 @@
 #include "storage/v2/result.hpp"
 #include "storage/v2/vertex_info_cache.hpp"
 #include "storage/v2/vertex_info_helpers.hpp"
+#include "storage/v2/vertex_version_cache.hpp"
+#include "utils/algorithm.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/variant_helpers.hpp"
 
 namespace memgraph::storage {
 
+namespace {
+auto VertexVersionCacheFor(Transaction const *transaction) -> VertexVersionCache * {
+  auto *cache = transaction->vertex_version_cache;
+  if (!cache || !cache->Enabled()) return nullptr;
+  // Analytical transactions change vertices without prepending deltas, and
+  // the versions seen by other isolation levels don't depend on the start
+  // timestamp only.
+  if (transaction->isolation_level != IsolationLevel::SNAPSHOT_ISOLATION ||
+      transaction->storage_mode != StorageMode::IN_MEMORY_TRANSACTIONAL) {
+    return nullptr;
+  }
+  return cache;
+}
+
+/// Returns the version of the vertex visible to the transaction from the
+/// storage-wide cache. Versions are only cached for chains without
+/// uncommitted deltas, so the transaction didn't change the vertex and both
+/// views are the same.
+auto FindSharedVersion(Vertex const *vertex, Delta const *head, Transaction const *transaction)
+    -> std::shared_ptr<CachedVertexVersion const> {
+  auto *cache = VertexVersionCacheFor(transaction);
+  if (!cache || head->timestamp->load(std::memory_order_acquire) >= kTransactionInitialId) return nullptr;
+  return cache->Find(vertex, head, transaction->start_timestamp);
+}
+
+/// Rebuilds the whole version of the vertex visible to the transaction and
+/// stores it in the storage-wide cache, together with the range of start
+/// timestamps for which it is the visible version.
+void StoreSharedVersion(Vertex const *vertex, Transaction const *transaction) {
+  auto *cache = VertexVersionCacheFor(transaction);
+  if (!cache) return;
+
+  CachedVertexVersion version;
+  Delta const *head = nullptr;
+  {
+    auto guard = std::shared_lock{vertex->lock};
+    version.deleted = vertex->deleted;
+    version.labels.assign(vertex->labels.begin(), vertex->labels.end());
+    version.properties = vertex->properties.Properties();
+    head = vertex->delta;
+  }
+  if (!head || head->timestamp->load(std::memory_order_acquire) >= kTransactionInitialId) return;
+
+  uint64_t lower_timestamp = 0;
+  uint64_t upper_timestamp = std::numeric_limits<uint64_t>::max();
+  for (auto const *delta = head; delta != nullptr; delta = delta->next.load(std::memory_order_acquire)) {
+    auto const timestamp = delta->timestamp->load(std::memory_order_acquire);
+    if (timestamp < transaction->start_timestamp) {
+      lower_timestamp = timestamp;
+      break;
+    }
+    // clang-format off
+    DeltaDispatch(*delta, utils::ChainedOverloaded{
+      Deleted_ActionMethod(version.deleted),
+      Exists_ActionMethod(version.exists),
+      Labels_ActionMethod(version.labels),
+      Properties_ActionMethod(version.properties)
+    });
+    // clang-format on
+    upper_timestamp = timestamp;
+  }
+  if (upper_timestamp == std::numeric_limits<uint64_t>::max()) return;
+
+  cache->Store(vertex, head, lower_timestamp, upper_timestamp, std::move(version));
+}
+}  // namespace
+
 namespace detail {
 std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transaction, View view) {
   bool exists = true;
@@ -43,7 +115,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -53,6 +125,9 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
       auto existsRes = cache.GetExists(view, vertex);
       auto deletedRes = cache.GetDeleted(view, vertex);
       if (existsRes && deletedRes) return {*existsRes, *deletedRes};
+      if (auto version = FindSharedVersion(vertex, delta, transaction); version) {
+        return {version->exists, version->deleted};
+      }
     }
 
     auto const n_processed = ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
@@ -68,6 +143,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
       auto &cache = transaction->manyDeltasCache;
       cache.StoreExists(view, vertex, exists);
       cache.StoreDeleted(view, vertex, deleted);
+      StoreSharedVersion(vertex, transaction);
     }
   }
 
@@ -75,12 +151,54 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
 }
 }  // namespace detail
 
+namespace {
+// Adjacency lists are grouped by edge type, so when edge types are given only
+// their runs are visited instead of the whole list.
+template <typename TCallback>
+void ForEachFilteredEdge(const VertexEdges &edges, const std::vector<EdgeTypeId> &edge_types,
+                         const Vertex *other_vertex, const TCallback &callback) {
+  auto const visit_range = [&](auto begin, auto end) {
+    for (auto it = begin; it != end; ++it) {
+      if (other_vertex && std::get<1>(*it) != other_vertex) continue;
+      callback(*it);
+    }
+  };
+
+  if (edge_types.empty()) {
+    visit_range(edges.begin(), edges.end());
+    return;
+  }
+  for (auto type_it = edge_types.begin(); type_it != edge_types.end(); ++type_it) {
+    // Duplicated edge types must not duplicate the edges.
+    if (std::find(edge_types.begin(), type_it, *type_it) != type_it) continue;
+    auto [begin, end] = VertexEdgesOfType(edges, *type_it);
+    visit_range(begin, end);
+  }
+}
+
+void CopyFilteredEdges(const VertexEdges &edges, const std::vector<EdgeTypeId> &edge_types,
+                       const Vertex *other_vertex, VertexEdges &result) {
+  ForEachFilteredEdge(edges, edge_types, other_vertex, [&result](const auto &edge) { result.push_back(edge); });
+}
+
+// Checks if CopyFilteredEdges would copy any edge, looking only at the first
+// edge of each run.
+bool HasEdgeOfTypes(const VertexEdges &edges, const std::vector<EdgeTypeId> &edge_types) {
+  if (edge_types.empty()) return !edges.empty();
+  return std::any_of(edge_types.begin(), edge_types.end(), [&edges](EdgeTypeId edge_type) {
+    auto [begin, end] = VertexEdgesOfType(edges, edge_type);
+    return begin != end;
+  });
+}
+}  // namespace
+
 std::optional<VertexAccessor> VertexAccessor::Create(Vertex *vertex, Transaction *transaction, Indices *indices,
                                                      Constraints *constraints, Config::Items config, View view) {
   if (const auto [exists, deleted] = detail::IsVisible(vertex, transaction, view); !exists || deleted) {
     return std::nullopt;
   }
 
+  ++access_counters.vertices_touched;
   return VertexAccessor{vertex, transaction, indices, constraints, config};
 }
 
@@ -99,11 +217,12 @@ Result<bool> VertexAccessor::AddLabel(LabelId label) {
     throw query::WriteVertexOperationInEdgeImportModeException();
   }
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
   if (vertex_->deleted) return Error::DELETED_OBJECT;
-  if (std::find(vertex_->labels.begin(), vertex_->labels.end(), label) != vertex_->labels.end()) return false;
+  if (utils::Contains(vertex_->labels, label)) return false;
 
   CreateAndLinkDelta(transaction_, vertex_, Delta::RemoveLabelTag(), label);
   vertex_->labels.push_back(label);
@@ -121,7 +240,8 @@ Result<bool> VertexAccessor::RemoveLabel(LabelId label) {
   if (transaction_->edge_import_mode_active) {
     throw query::WriteVertexOperationInEdgeImportModeException();
   }
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
   if (vertex_->deleted) return Error::DELETED_OBJECT;
@@ -149,13 +269,13 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
   {
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
-    has_label = std::find(vertex_->labels.begin(), vertex_->labels.end(), label) != vertex_->labels.end();
+    has_label = utils::Contains(vertex_->labels, label);
     delta = vertex_->delta;
   }
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -163,6 +283,10 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabel = cache.GetHasLabel(view, vertex_, label); resLabel) return {resLabel.value()};
+      if (auto version = FindSharedVersion(vertex_, delta, transaction_); version) {
+        if (auto resError = HasError(*version, for_deleted_); resError) return *resError;
+        return utils::Contains(version->labels, label);
+      }
     }
 
     auto const n_processed = ApplyDeltasForRead(transaction_, delta, view, [&, label](const Delta &delta) {
@@ -180,6 +304,7 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreHasLabel(view, vertex_, label, has_label);
+      StoreSharedVersion(vertex_, transaction_);
     }
   }
 
@@ -196,13 +321,13 @@ Result<std::vector<LabelId>> VertexAccessor::Labels(View view) const {
   {
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
-    labels = vertex_->labels;
+    labels.assign(vertex_->labels.begin(), vertex_->labels.end());
     delta = vertex_->delta;
   }
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -210,6 +335,10 @@ Result<std::vector<LabelId>> VertexAccessor::Labels(View view) const {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabels = cache.GetLabels(view, vertex_); resLabels) return {*resLabels};
+      if (auto version = FindSharedVersion(vertex_, delta, transaction_); version) {
+        if (auto resError = HasError(*version, for_deleted_); resError) return *resError;
+        return version->labels;
+      }
     }
 
     auto const n_processed = ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
@@ -227,6 +356,7 @@ Result<std::vector<LabelId>> VertexAccessor::Labels(View view) const {
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreLabels(view, vertex_, labels);
+      StoreSharedVersion(vertex_, transaction_);
     }
   }
 
@@ -241,7 +371,8 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
   }
 
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
@@ -256,7 +387,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
   // transactions get a SERIALIZATION_ERROR.
 
   CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, current_value);
-  vertex_->properties.SetProperty(property, value);
+  vertex_->properties.SetProperty(property, value, transaction_->dictionary_encoded_properties);
 
   indices_->UpdateOnSetProperty(property, value, vertex_, *transaction_);
   transaction_->manyDeltasCache.Invalidate(vertex_, property);
@@ -270,13 +401,14 @@ Result<bool> VertexAccessor::InitProperties(const std::map<storage::PropertyId,
   }
 
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  if (!vertex_->properties.InitProperties(properties)) return false;
+  if (!vertex_->properties.InitProperties(properties, transaction_->dictionary_encoded_properties)) return false;
   for (const auto &[property, value] : properties) {
     CreateAndLinkDelta(transaction_, vertex_, Delta::SetPropertyTag(), property, PropertyValue());
     indices_->UpdateOnSetProperty(property, value, vertex_, *transaction_);
@@ -293,13 +425,15 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> Vertex
   }
 
   utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
   if (vertex_->deleted) return Error::DELETED_OBJECT;
 
-  auto id_old_new_change = vertex_->properties.UpdateProperties(properties);
+  auto id_old_new_change =
+      vertex_->properties.UpdateProperties(properties, transaction_->dictionary_encoded_properties);
 
   for (auto &[id, old_value, new_value] : id_old_new_change) {
     indices_->UpdateOnSetProperty(id, new_value, vertex_, *transaction_);
@@ -314,7 +448,8 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::ClearProperties() {
   if (transaction_->edge_import_mode_active) {
     throw query::WriteVertexOperationInEdgeImportModeException();
   }
-  auto guard = std::unique_lock{vertex_->lock};
+  auto guard = std::unique_lock{vertex_->lock, std::defer_lock};
+  LockVertex(guard, *vertex_);
 
   if (!PrepareForWrite(transaction_, vertex_)) return Error::SERIALIZATION_ERROR;
 
@@ -346,7 +481,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -354,6 +489,11 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperty = cache.GetProperty(view, vertex_, property); resProperty) return {*resProperty};
+      if (auto version = FindSharedVersion(vertex_, delta, transaction_); version) {
+        if (auto resError = HasError(*version, for_deleted_); resError) return *resError;
+        auto it = version->properties.find(property);
+        return it != version->properties.end() ? it->second : PropertyValue();
+      }
     }
 
     auto const n_processed =
@@ -372,6 +512,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperty(view, vertex_, property, value);
+      StoreSharedVersion(vertex_, transaction_);
     }
   }
 
@@ -380,6 +521,20 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   return std::move(value);
 }
 
+Result<bool> VertexAccessor::IsPropertyEqual(PropertyId property, const PropertyValue &value, View view) const {
+  {
+    auto guard = std::shared_lock{vertex_->lock};
+    // Without deltas to apply, the transaction sees the stored properties.
+    if (!NeedsDeltasForRead(transaction_, vertex_->delta)) {
+      if (!for_deleted_ && vertex_->deleted) return Error::DELETED_OBJECT;
+      return vertex_->properties.IsPropertyEqual(property, value);
+    }
+  }
+  auto maybe_value = GetProperty(property, view);
+  if (maybe_value.HasError()) return maybe_value.GetError();
+  return *maybe_value == value;
+}
+
 Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view) const {
   bool exists = true;
   bool deleted = false;
@@ -394,7 +549,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -402,6 +557,10 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperties = cache.GetProperties(view, vertex_); resProperties) return {*resProperties};
+      if (auto version = FindSharedVersion(vertex_, delta, transaction_); version) {
+        if (auto resError = HasError(*version, for_deleted_); resError) return *resError;
+        return version->properties;
+      }
     }
 
     auto const n_processed =
@@ -420,6 +579,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
       cache.StoreExists(view, vertex_, exists);
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperties(view, vertex_, properties);
+      StoreSharedVersion(vertex_, transaction_);
     }
   }
 
@@ -432,7 +592,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
                                                           const VertexAccessor *destination) const {
   MG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
-  using edge_store = std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>>;
+  using edge_store = VertexEdges;
 
   // We return EdgeAccessors, this method with wrap the results in EdgeAccessors
   auto const build_result = [this](edge_store const &edges) -> std::vector<EdgeAccessor> {
@@ -452,26 +612,34 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
   {
-    auto guard = std::shared_lock{vertex_->lock};
-    deleted = vertex_->deleted;
+    auto guard = std::shared_lock{vertex_->lock, std::defer_lock};
+    LockVertex(guard, *vertex_);
     expanded_count = static_cast<int64_t>(vertex_->in_edges.size());
-    // TODO: a better filter copy
+    access_counters.edges_touched += static_cast<uint64_t>(expanded_count);
+    // Without deltas to apply, the accessors are made from the edges of the
+    // vertex without copying them first.
+    if (!NeedsDeltasForRead(transaction_, vertex_->delta)) {
+      if (vertex_->deleted) return Error::DELETED_OBJECT;
+      auto edges = std::vector<EdgeAccessor>{};
+      if (edge_types.empty() && !destination) edges.reserve(vertex_->in_edges.size());
+      ForEachFilteredEdge(vertex_->in_edges, edge_types, destination_vertex, [&](const auto &in_edge) {
+        auto const &[edge_type, from_vertex, edge] = in_edge;
+        edges.emplace_back(edge, edge_type, from_vertex, vertex_, transaction_, indices_, constraints_, config_);
+      });
+      return EdgesVertexAccessorResult{.edges = std::move(edges), .expanded_count = expanded_count};
+    }
+    deleted = vertex_->deleted;
     if (edge_types.empty() && !destination) {
       in_edges = vertex_->in_edges;
     } else {
-      for (const auto &[edge_type, from_vertex, edge] : vertex_->in_edges) {
-        if (destination && from_vertex != destination_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        in_edges.emplace_back(edge_type, from_vertex, edge);
-      }
+      CopyFilteredEdges(vertex_->in_edges, edge_types, destination_vertex, in_edges);
     }
     delta = vertex_->delta;
   }
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -512,7 +680,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
                                                            const VertexAccessor *destination) const {
   MG_ASSERT(!destination || destination->transaction_ == transaction_, "Invalid accessor!");
 
-  using edge_store = std::vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>>;
+  using edge_store = VertexEdges;
 
   auto const build_result = [this](edge_store const &out_edges) {
     auto ret = std::vector<EdgeAccessor>{};
@@ -531,25 +699,34 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
   {
-    auto guard = std::shared_lock{vertex_->lock};
-    deleted = vertex_->deleted;
+    auto guard = std::shared_lock{vertex_->lock, std::defer_lock};
+    LockVertex(guard, *vertex_);
     expanded_count = static_cast<int64_t>(vertex_->out_edges.size());
+    access_counters.edges_touched += static_cast<uint64_t>(expanded_count);
+    // Without deltas to apply, the accessors are made from the edges of the
+    // vertex without copying them first.
+    if (!NeedsDeltasForRead(transaction_, vertex_->delta)) {
+      if (vertex_->deleted) return Error::DELETED_OBJECT;
+      auto edges = std::vector<EdgeAccessor>{};
+      if (edge_types.empty() && !destination) edges.reserve(vertex_->out_edges.size());
+      ForEachFilteredEdge(vertex_->out_edges, edge_types, dst_vertex, [&](const auto &out_edge) {
+        auto const &[edge_type, to_vertex, edge] = out_edge;
+        edges.emplace_back(edge, edge_type, vertex_, to_vertex, transaction_, indices_, constraints_, config_);
+      });
+      return EdgesVertexAccessorResult{.edges = std::move(edges), .expanded_count = expanded_count};
+    }
+    deleted = vertex_->deleted;
     if (edge_types.empty() && !destination) {
       out_edges = vertex_->out_edges;
     } else {
-      for (const auto &[edge_type, to_vertex, edge] : vertex_->out_edges) {
-        if (destination && to_vertex != dst_vertex) continue;
-        if (!edge_types.empty() && std::find(edge_types.begin(), edge_types.end(), edge_type) == edge_types.end())
-          continue;
-        out_edges.emplace_back(edge_type, to_vertex, edge);
-      }
+      CopyFilteredEdges(vertex_->out_edges, edge_types, dst_vertex, out_edges);
     }
     delta = vertex_->delta;
   }
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -585,6 +762,34 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   return EdgesVertexAccessorResult{.edges = build_result(out_edges), .expanded_count = expanded_count};
 }
 
+Result<bool> VertexAccessor::HasInEdges(View view, const std::vector<EdgeTypeId> &edge_types) const {
+  {
+    auto guard = std::shared_lock{vertex_->lock};
+    // Without deltas to apply, the transaction sees the edges of the vertex.
+    if (!NeedsDeltasForRead(transaction_, vertex_->delta)) {
+      if (vertex_->deleted) return Error::DELETED_OBJECT;
+      return HasEdgeOfTypes(vertex_->in_edges, edge_types);
+    }
+  }
+  auto edges = InEdges(view, edge_types);
+  if (edges.HasError()) return edges.GetError();
+  return !edges->edges.empty();
+}
+
+Result<bool> VertexAccessor::HasOutEdges(View view, const std::vector<EdgeTypeId> &edge_types) const {
+  {
+    auto guard = std::shared_lock{vertex_->lock};
+    // Without deltas to apply, the transaction sees the edges of the vertex.
+    if (!NeedsDeltasForRead(transaction_, vertex_->delta)) {
+      if (vertex_->deleted) return Error::DELETED_OBJECT;
+      return HasEdgeOfTypes(vertex_->out_edges, edge_types);
+    }
+  }
+  auto edges = OutEdges(view, edge_types);
+  if (edges.HasError()) return edges.GetError();
+  return !edges->edges.empty();
+}
+
 Result<size_t> VertexAccessor::InDegree(View view) const {
   bool exists = true;
   bool deleted = false;
@@ -599,7 +804,7 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -647,7 +852,7 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
 
   // Checking cache has a cost, only do it if we have any deltas
   // if we have no deltas then what we already have from the vertex is correct.
-  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+  if (NeedsDeltasForRead(transaction_, delta)) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
     auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
@@ -86,6 +86,12 @@ class VertexAccessor final {
   /// @throw std::bad_alloc
   Result<PropertyValue> GetProperty(PropertyId property, View view) const;
 
+  /// Returns true if the property has the given value. Int and double values
+  /// are compared like in `PropertyValue::operator==`. Unlike `GetProperty`,
+  /// the stored value isn't decoded when the vertex has no deltas.
+  /// @throw std::bad_alloc
+  Result<bool> IsPropertyEqual(PropertyId property, const PropertyValue &value, View view) const;
+
   /// @throw std::bad_alloc
   Result<std::map<PropertyId, PropertyValue>> Properties(View view) const;
 
@@ -101,6 +107,14 @@ class VertexAccessor final {
   Result<EdgesVertexAccessorResult> OutEdges(View view, const std::vector<EdgeTypeId> &edge_types = {},
                                              const VertexAccessor *destination = nullptr) const;
 
+  /// Checks if the vertex has any in edge of the given types, any type if
+  /// none are given, without creating accessors for the edges.
+  Result<bool> HasInEdges(View view, const std::vector<EdgeTypeId> &edge_types = {}) const;
+
+  /// Checks if the vertex has any out edge of the given types, any type if
+  /// none are given, without creating accessors for the edges.
+  Result<bool> HasOutEdges(View view, const std::vector<EdgeTypeId> &edge_types = {}) const;
+
   Result<size_t> InDegree(View view) const;
 
   Result<size_t> OutDegree(View view) const;
@@ -0,0 +1,101 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/edge_ref.hpp"
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+// Forward declaration because we only store a pointer here.
+struct Vertex;
+
+using VertexEdge = std::tuple<EdgeTypeId, Vertex *, EdgeRef>;
+
+/// Adjacency list of a vertex for a single direction.
+///
+/// The entries are kept ordered by edge type so that all edges of one type
+/// form a single contiguous run. Expansions filtered by edge type then only
+/// have to look at their own run, which is found in O(log n). The order of
+/// the edges inside of a run is unspecified.
+///
+/// All modifications must go through `AddVertexEdge` and `RemoveVertexEdge`,
+/// which keep the runs contiguous by moving at most one element per run that
+/// follows the modified one, instead of shifting the whole tail.
+using VertexEdges = std::vector<VertexEdge>;
+
+namespace detail {
+struct VertexEdgeTypeCompare {
+  bool operator()(const VertexEdge &edge, EdgeTypeId edge_type) const { return std::get<0>(edge) < edge_type; }
+  bool operator()(EdgeTypeId edge_type, const VertexEdge &edge) const { return edge_type < std::get<0>(edge); }
+};
+}  // namespace detail
+
+/// Returns the contiguous run of edges with the given edge type.
+inline auto VertexEdgesOfType(VertexEdges &edges, EdgeTypeId edge_type) {
+  return std::equal_range(edges.begin(), edges.end(), edge_type, detail::VertexEdgeTypeCompare{});
+}
+
+inline auto VertexEdgesOfType(const VertexEdges &edges, EdgeTypeId edge_type) {
+  return std::equal_range(edges.begin(), edges.end(), edge_type, detail::VertexEdgeTypeCompare{});
+}
+
+/// Finds the given edge by searching only the run of its edge type.
+inline VertexEdges::iterator FindVertexEdge(VertexEdges &edges, const VertexEdge &edge) {
+  auto [begin, end] = VertexEdgesOfType(edges, std::get<0>(edge));
+  auto it = std::find(begin, end, edge);
+  return it != end ? it : edges.end();
+}
+
+/// Adds the edge at the end of the run of its edge type.
+inline void AddVertexEdge(VertexEdges &edges, VertexEdge edge) {
+  const auto edge_type = std::get<0>(edge);
+  edges.push_back(std::move(edge));
+  // Rotate the new element over every run with a greater edge type by swapping
+  // it with the first element of that run.
+  auto pos = edges.end() - 1;
+  while (pos != edges.begin() && edge_type < std::get<0>(*(pos - 1))) {
+    auto run_begin = std::lower_bound(edges.begin(), pos, std::get<0>(*(pos - 1)), detail::VertexEdgeTypeCompare{});
+    std::iter_swap(run_begin, pos);
+    pos = run_begin;
+  }
+}
+
+/// Removes the edge pointed to by `it`.
+inline void RemoveVertexEdge(VertexEdges &edges, VertexEdges::iterator it) {
+  // Move the hole to the back by swapping it with the last element of its run
+  // and then with the last element of every following run.
+  auto run_end = std::upper_bound(it, edges.end(), std::get<0>(*it), detail::VertexEdgeTypeCompare{});
+  auto hole = run_end - 1;
+  std::iter_swap(it, hole);
+  while (hole + 1 != edges.end()) {
+    auto next_run_end =
+        std::upper_bound(hole + 1, edges.end(), std::get<0>(*(hole + 1)), detail::VertexEdgeTypeCompare{});
+    std::iter_swap(hole, next_run_end - 1);
+    hole = next_run_end - 1;
+  }
+  edges.pop_back();
+}
+
+/// Restores the ordering invariant on an adjacency list that was filled in an
+/// arbitrary order, e.g. during recovery.
+inline void SortVertexEdges(VertexEdges &edges) {
+  std::stable_sort(edges.begin(), edges.end(),
+                   [](const VertexEdge &a, const VertexEdge &b) { return std::get<0>(a) < std::get<0>(b); });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,149 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/vertex_filter.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <shared_mutex>
+
+#include "storage/v2/mvcc.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_info_helpers.hpp"
+#include "utils/algorithm.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Compares the values like Cypher does. Returns std::nullopt if they can't be
+// compared, when the query engine decides whether that's an error.
+std::optional<int> CompareValues(const PropertyValue &lhs, const PropertyValue &rhs) {
+  auto is_number = [](const PropertyValue &value) { return value.IsInt() || value.IsDouble(); };
+  if (is_number(lhs) && is_number(rhs)) {
+    if (lhs.IsInt() && rhs.IsInt()) {
+      return lhs.ValueInt() < rhs.ValueInt() ? -1 : (lhs.ValueInt() == rhs.ValueInt() ? 0 : 1);
+    }
+    const auto left = lhs.IsInt() ? static_cast<double>(lhs.ValueInt()) : lhs.ValueDouble();
+    const auto right = rhs.IsInt() ? static_cast<double>(rhs.ValueInt()) : rhs.ValueDouble();
+    return left < right ? -1 : (left == right ? 0 : 1);
+  }
+  if (lhs.IsString() && rhs.IsString()) {
+    return lhs.ValueString().compare(rhs.ValueString());
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+void VertexFilter::AddLabel(LabelId label) {
+  if (!utils::Contains(labels_, label)) labels_.push_back(label);
+}
+
+void VertexFilter::AddProperty(PropertyId property, Comparison comparison, PropertyValue value) {
+  auto it = std::find(properties_.begin(), properties_.end(), property);
+  if (it == properties_.end()) it = properties_.insert(properties_.end(), property);
+  predicates_.push_back({static_cast<size_t>(std::distance(properties_.begin(), it)), comparison, std::move(value)});
+}
+
+bool VertexFilter::Matches(const Vertex &vertex, Transaction *transaction, View view) const {
+  read_properties_ = properties_;
+  return ReadVisibleVersion(vertex, transaction, view) && SatisfiesPredicates();
+}
+
+bool VertexFilter::MatchesIndexed(const Vertex &vertex, Transaction *transaction, View view, LabelId label,
+                                  PropertyId property, const PropertyValue &value) const {
+  read_properties_ = properties_;
+  read_properties_.push_back(property);
+  return ReadVisibleVersion(vertex, transaction, view) && utils::Contains(vertex_labels_, label) &&
+         vertex_values_.back() == value && SatisfiesPredicates();
+}
+
+bool VertexFilter::ReadVisibleVersion(const Vertex &vertex, Transaction *transaction, View view) const {
+  bool exists = true;
+  bool deleted = false;
+  const Delta *delta = nullptr;
+  vertex_values_.clear();
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    vertex_labels_.assign(vertex.labels.begin(), vertex.labels.end());
+    for (const auto property : read_properties_) {
+      vertex_values_.push_back(vertex.properties.GetProperty(property));
+    }
+    delta = vertex.delta;
+  }
+
+  if (delta) {
+    ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        Labels_ActionMethod(vertex_labels_),
+        PropertyValues_ActionMethod(vertex_values_, read_properties_)
+      });
+      // clang-format on
+    });
+  }
+  return exists && !deleted;
+}
+
+bool VertexFilter::SatisfiesPredicates() const {
+  for (const auto label : labels_) {
+    if (!utils::Contains(vertex_labels_, label)) return false;
+  }
+  for (const auto &predicate : predicates_) {
+    const auto &value = vertex_values_[predicate.position];
+    // Comparisons with null are null, which doesn't satisfy a filter.
+    if (value.IsNull()) return false;
+    if (predicate.comparison == Comparison::IS_NOT_NULL) continue;
+    const auto comparison = CompareValues(value, predicate.value);
+    if (!comparison) {
+      if (predicate.comparison != Comparison::EQUAL) {
+        // Comparing the order of such values is an error which the query
+        // engine reports.
+        continue;
+      }
+      if (value.IsBool() && predicate.value.IsBool()) {
+        if (value.ValueBool() != predicate.value.ValueBool()) return false;
+        continue;
+      }
+      // Lists and maps are compared element by element by the query engine.
+      // Other values of different types are never equal.
+      if (!value.IsList() && !value.IsMap()) return false;
+      continue;
+    }
+    switch (predicate.comparison) {
+      case Comparison::EQUAL:
+        if (*comparison != 0) return false;
+        break;
+      case Comparison::LESS:
+        if (*comparison >= 0) return false;
+        break;
+      case Comparison::LESS_EQUAL:
+        if (*comparison > 0) return false;
+        break;
+      case Comparison::GREATER:
+        if (*comparison <= 0) return false;
+        break;
+      case Comparison::GREATER_EQUAL:
+        if (*comparison < 0) return false;
+        break;
+      case Comparison::IS_NOT_NULL:
+        break;
+    }
+  }
+  return true;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,83 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/view.hpp"
+
+namespace memgraph::storage {
+
+struct Transaction;
+struct Vertex;
+
+/**
+ * Simple predicates on the labels and the properties of vertices, which the
+ * vertex iterables check on the versions of the vertices visible to the
+ * transaction while holding the vertex lock, before making their accessors.
+ *
+ * A vertex is skipped only if a predicate is certainly false for it. Values
+ * which can't be compared, like a string and a number, don't skip the vertex,
+ * so the query engine has to filter the yielded vertices again.
+ *
+ * The filter keeps buffers for reading the vertices, so it may be used by one
+ * iterable at a time.
+ */
+class VertexFilter final {
+ public:
+  enum class Comparison : uint8_t { EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, IS_NOT_NULL };
+
+  void AddLabel(LabelId label);
+
+  /// The `value` is ignored by IS_NOT_NULL.
+  void AddProperty(PropertyId property, Comparison comparison, PropertyValue value);
+
+  bool Empty() const { return labels_.empty() && predicates_.empty(); }
+
+  /// Returns false if the transaction doesn't see the vertex, or if its visible
+  /// version doesn't satisfy the predicates.
+  bool Matches(const Vertex &vertex, Transaction *transaction, View view) const;
+
+  /// Like `Matches`, but the visible version also has to have the `label` and
+  /// the `value` of the `property` with which the vertex is in an index.
+  bool MatchesIndexed(const Vertex &vertex, Transaction *transaction, View view, LabelId label, PropertyId property,
+                      const PropertyValue &value) const;
+
+ private:
+  struct PropertyPredicate {
+    // Position of the property in `properties_`.
+    size_t position;
+    Comparison comparison;
+    PropertyValue value;
+  };
+
+  // Reads the labels and `read_properties_` of the visible version of the
+  // vertex. Returns false if the transaction doesn't see the vertex.
+  bool ReadVisibleVersion(const Vertex &vertex, Transaction *transaction, View view) const;
+  bool SatisfiesPredicates() const;
+
+  std::vector<LabelId> labels_;
+  std::vector<PropertyPredicate> predicates_;
+  // Distinct properties of the predicates.
+  std::vector<PropertyId> properties_;
+
+  // The properties of the predicates followed by the indexed property, and
+  // the labels and the property values of the last read vertex.
+  mutable std::vector<PropertyId> read_properties_;
+  mutable std::vector<LabelId> vertex_labels_;
+  mutable std::vector<PropertyValue> vertex_values_;
+};
+
+}  // namespace memgraph::storage
@@ -46,6 +46,7 @@ auto FetchHelper(VertexInfoCache const &caches, Func &&getCache, View view, Keys
 
 template <typename Value, typename Func, typename... Keys>
 void Store(Value &&value, VertexInfoCache &caches, Func &&getCache, View view, Keys &&...keys) {
+  if (caches.frozen_) return;
   auto &cache = (view == View::OLD) ? getCache(caches.old_) : getCache(caches.new_);
   using key_type = typename std::remove_cvref_t<decltype(cache)>::key_type;
   cache.emplace(key_type{std::forward<Keys>(keys)...}, std::forward<Value>(value));
@@ -112,6 +112,10 @@ struct VertexInfoCache final {
 
   void Clear();
 
+  /// While frozen, nothing new is stored into the cache so that it may be read
+  /// by several threads executing the same transaction at once.
+  void Freeze(bool frozen) { frozen_ = frozen; }
+
  private:
   /// Note: not a tuple because need a canonical form for the edge types
   struct EdgeKey {
@@ -157,6 +161,7 @@ struct VertexInfoCache final {
   };
   Caches old_;
   Caches new_;
+  bool frozen_{false};
 
   // Helpers
   template <typename Ret, typename Func, typename... Keys>
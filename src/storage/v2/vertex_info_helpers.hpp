@@ -13,9 +13,11 @@
 #include "storage/v2/delta.hpp"
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/vertex_info_cache.hpp"
+#include "storage/v2/vertex_version_cache.hpp"
 #include "utils/variant_helpers.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <tuple>
 #include <vector>
 namespace memgraph::storage {
@@ -118,6 +120,16 @@ inline auto PropertyValue_ActionMethod(PropertyValue &value, PropertyId property
   });
 }
 
+inline auto PropertyValues_ActionMethod(std::vector<PropertyValue> &values, const std::vector<PropertyId> &properties) {
+  using enum Delta::Action;
+  return ActionMethod<SET_PROPERTY>([&](Delta const &delta) {
+    auto it = std::find(properties.begin(), properties.end(), delta.property.key);
+    if (it != properties.end()) {
+      values[std::distance(properties.begin(), it)] = delta.property.value;
+    }
+  });
+}
+
 inline auto PropertyValueMatch_ActionMethod(bool &match, PropertyId property, PropertyValue const &value) {
   using enum Delta::Action;
   return ActionMethod<SET_PROPERTY>([&, property](Delta const &delta) {
@@ -206,4 +218,10 @@ inline auto HasError(View view, VertexInfoCache const &cache, Vertex const *vert
   return std::nullopt;
 }
 
+inline auto HasError(CachedVertexVersion const &version, bool for_deleted) -> std::optional<Error> {
+  if (!version.exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted && version.deleted) return Error::DELETED_OBJECT;
+  return std::nullopt;
+}
+
 }  // namespace memgraph::storage
@@ -0,0 +1,70 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/vertex_version_cache.hpp"
+
+#include "absl/hash/hash.h"
+
+#include "storage/v2/delta.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(delta_chain_shared_cache_size, 65536,
+              "The maximum number of vertex versions rebuilt from long delta chains which are shared between all "
+              "transactions. Set to 0 to disable the shared cache.");
+
+namespace memgraph::storage {
+
+VertexVersionCache::VertexVersionCache(uint64_t capacity)
+    : shard_capacity_{capacity == 0 ? 0 : (capacity + kShardCount - 1) / kShardCount} {}
+
+VertexVersionCache::~VertexVersionCache() = default;
+
+auto VertexVersionCache::GetShard(Vertex const *vertex) const -> Shard & {
+  return shards_[absl::Hash<Vertex const *>{}(vertex) % kShardCount];
+}
+
+auto VertexVersionCache::Find(Vertex const *vertex, Delta const *head, uint64_t start_timestamp) const
+    -> std::shared_ptr<CachedVertexVersion const> {
+  if (!Enabled()) return nullptr;
+  // A different delta can be allocated at the address of a freed one, but it
+  // can't have the same timestamp.
+  const auto head_timestamp = head->timestamp->load(std::memory_order_acquire);
+  return GetShard(vertex).WithLock([&](auto &entries) -> std::shared_ptr<CachedVertexVersion const> {
+    auto it = entries.find(vertex);
+    if (it == entries.end()) return nullptr;
+    const auto &entry = it->second;
+    if (entry.head != head || entry.head_timestamp != head_timestamp) return nullptr;
+    if (start_timestamp <= entry.lower_timestamp || start_timestamp > entry.upper_timestamp) return nullptr;
+    return entry.version;
+  });
+}
+
+void VertexVersionCache::Store(Vertex const *vertex, Delta const *head, uint64_t lower_timestamp,
+                               uint64_t upper_timestamp, CachedVertexVersion version) {
+  if (!Enabled()) return;
+  Entry entry{head, head->timestamp->load(std::memory_order_acquire), lower_timestamp, upper_timestamp,
+              std::make_shared<CachedVertexVersion const>(std::move(version))};
+  GetShard(vertex).WithLock([&](auto &entries) {
+    if (entries.size() >= shard_capacity_ && !entries.contains(vertex)) {
+      // There is no recency information, so any entry is as good as another.
+      entries.erase(entries.begin());
+    }
+    entries.insert_or_assign(vertex, std::move(entry));
+  });
+}
+
+void VertexVersionCache::Clear() {
+  for (auto &shard : shards_) {
+    shard.WithLock([](auto &entries) { entries.clear(); });
+  }
+}
+
+}  // namespace memgraph::storage
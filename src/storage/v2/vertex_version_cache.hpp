@@ -0,0 +1,106 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+#include <gflags/gflags.h>
+
+DECLARE_uint64(delta_chain_shared_cache_size);
+
+namespace memgraph::storage {
+
+// forward declarations
+struct Delta;
+struct Vertex;
+
+/// A committed version of a vertex, rebuilt by applying its delta chain.
+struct CachedVertexVersion {
+  bool exists{true};
+  bool deleted{false};
+  std::vector<LabelId> labels;
+  std::map<PropertyId, PropertyValue> properties;
+};
+
+/** Storage-wide cache of vertex versions rebuilt from long delta chains.
+ *
+ * Unlike `VertexInfoCache`, which lives in a single transaction, the versions
+ * stored here are shared by all snapshot isolation transactions. A version
+ * rebuilt by one transaction is the same for every transaction whose start
+ * timestamp falls between the commit timestamp of the newest delta which
+ * wasn't applied and that of the oldest delta which was applied.
+ *
+ * Only versions of chains without uncommitted deltas are cached. Every change
+ * of a vertex prepends a delta to its chain, so an entry is only valid while
+ * the head of the chain is still the same delta. Stale entries are simply
+ * ignored and replaced by newer ones.
+ *
+ * This class is thread-safe.
+ */
+class VertexVersionCache final {
+ public:
+  /// @param capacity maximum number of cached versions, 0 disables the cache
+  explicit VertexVersionCache(uint64_t capacity);
+
+  VertexVersionCache(const VertexVersionCache &) = delete;
+  VertexVersionCache &operator=(const VertexVersionCache &) = delete;
+  VertexVersionCache(VertexVersionCache &&) = delete;
+  VertexVersionCache &operator=(VertexVersionCache &&) = delete;
+
+  ~VertexVersionCache();
+
+  bool Enabled() const { return shard_capacity_ != 0; }
+
+  /// Returns the version of `vertex` visible to a transaction which started
+  /// at `start_timestamp`, if it is cached for the given head of its chain.
+  auto Find(Vertex const *vertex, Delta const *head, uint64_t start_timestamp) const
+      -> std::shared_ptr<CachedVertexVersion const>;
+
+  /// Stores the version of `vertex` which is visible to transactions with a
+  /// start timestamp in the range (`lower_timestamp`, `upper_timestamp`] while
+  /// `head` is the first delta in its chain.
+  void Store(Vertex const *vertex, Delta const *head, uint64_t lower_timestamp, uint64_t upper_timestamp,
+             CachedVertexVersion version);
+
+  void Clear();
+
+ private:
+  struct Entry {
+    Delta const *head;
+    uint64_t head_timestamp;
+    uint64_t lower_timestamp;
+    uint64_t upper_timestamp;
+    std::shared_ptr<CachedVertexVersion const> version;
+  };
+
+  using Shard = utils::Synchronized<absl::flat_hash_map<Vertex const *, Entry>, utils::SpinLock>;
+
+  static constexpr uint64_t kShardCount = 64;
+
+  Shard &GetShard(Vertex const *vertex) const;
+
+  uint64_t shard_capacity_;
+  mutable std::array<Shard, kShardCount> shards_;
+};
+
+}  // namespace memgraph::storage
@@ -17,6 +17,10 @@ VerticesIterable::VerticesIterable(AllVerticesIterable vertices) : type_(Type::A
   new (&all_vertices_) AllVerticesIterable(std::move(vertices));
 }
 
+VerticesIterable::VerticesIterable(DiskAllVerticesIterable vertices) : type_(Type::ALL_ON_DISK) {
+  new (&disk_all_vertices_) DiskAllVerticesIterable(std::move(vertices));
+}
+
 VerticesIterable::VerticesIterable(InMemoryLabelIndex::Iterable vertices) : type_(Type::BY_LABEL_IN_MEMORY) {
   new (&in_memory_vertices_by_label_) InMemoryLabelIndex::Iterable(std::move(vertices));
 }
@@ -26,11 +30,28 @@ VerticesIterable::VerticesIterable(InMemoryLabelPropertyIndex::Iterable vertices
   new (&in_memory_vertices_by_label_property_) InMemoryLabelPropertyIndex::Iterable(std::move(vertices));
 }
 
+VerticesIterable::VerticesIterable(InMemoryLabelPropertyCompositeIndex::Iterable vertices)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY) {
+  new (&in_memory_vertices_by_label_property_composite_)
+      InMemoryLabelPropertyCompositeIndex::Iterable(std::move(vertices));
+}
+
+VerticesIterable::VerticesIterable(InMemoryTextIndex::Iterable vertices) : type_(Type::BY_TEXT_IN_MEMORY) {
+  new (&in_memory_vertices_by_text_) InMemoryTextIndex::Iterable(std::move(vertices));
+}
+
+VerticesIterable::VerticesIterable(InMemoryPointIndex::Iterable vertices) : type_(Type::BY_POINT_IN_MEMORY) {
+  new (&in_memory_vertices_by_point_) InMemoryPointIndex::Iterable(std::move(vertices));
+}
+
 VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
       new (&all_vertices_) AllVerticesIterable(std::move(other.all_vertices_));
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_vertices_) DiskAllVerticesIterable(std::move(other.disk_all_vertices_));
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       new (&in_memory_vertices_by_label_) InMemoryLabelIndex::Iterable(std::move(other.in_memory_vertices_by_label_));
       break;
@@ -38,6 +59,17 @@ VerticesIterable::VerticesIterable(VerticesIterable &&other) noexcept : type_(ot
       new (&in_memory_vertices_by_label_property_)
           InMemoryLabelPropertyIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_vertices_by_label_property_composite_)
+          InMemoryLabelPropertyCompositeIndex::Iterable(
+              std::move(other.in_memory_vertices_by_label_property_composite_));
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      new (&in_memory_vertices_by_text_) InMemoryTextIndex::Iterable(std::move(other.in_memory_vertices_by_text_));
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      new (&in_memory_vertices_by_point_) InMemoryPointIndex::Iterable(std::move(other.in_memory_vertices_by_point_));
+      break;
   }
 }
 
@@ -46,18 +78,33 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
     case Type::ALL:
       all_vertices_.AllVerticesIterable::~AllVerticesIterable();
       break;
+    case Type::ALL_ON_DISK:
+      disk_all_vertices_.DiskAllVerticesIterable::~DiskAllVerticesIterable();
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       in_memory_vertices_by_label_.InMemoryLabelIndex::Iterable::~Iterable();
       break;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_vertices_by_label_property_.InMemoryLabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      in_memory_vertices_by_label_property_composite_.InMemoryLabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      in_memory_vertices_by_text_.InMemoryTextIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      in_memory_vertices_by_point_.InMemoryPointIndex::Iterable::~Iterable();
+      break;
   }
   type_ = other.type_;
   switch (other.type_) {
     case Type::ALL:
       new (&all_vertices_) AllVerticesIterable(std::move(other.all_vertices_));
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_vertices_) DiskAllVerticesIterable(std::move(other.disk_all_vertices_));
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       new (&in_memory_vertices_by_label_) InMemoryLabelIndex::Iterable(std::move(other.in_memory_vertices_by_label_));
       break;
@@ -65,6 +112,17 @@ VerticesIterable &VerticesIterable::operator=(VerticesIterable &&other) noexcept
       new (&in_memory_vertices_by_label_property_)
           InMemoryLabelPropertyIndex::Iterable(std::move(other.in_memory_vertices_by_label_property_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_vertices_by_label_property_composite_)
+          InMemoryLabelPropertyCompositeIndex::Iterable(
+              std::move(other.in_memory_vertices_by_label_property_composite_));
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      new (&in_memory_vertices_by_text_) InMemoryTextIndex::Iterable(std::move(other.in_memory_vertices_by_text_));
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      new (&in_memory_vertices_by_point_) InMemoryPointIndex::Iterable(std::move(other.in_memory_vertices_by_point_));
+      break;
   }
   return *this;
 }
@@ -74,12 +132,41 @@ VerticesIterable::~VerticesIterable() {
     case Type::ALL:
       all_vertices_.AllVerticesIterable::~AllVerticesIterable();
       break;
+    case Type::ALL_ON_DISK:
+      disk_all_vertices_.DiskAllVerticesIterable::~DiskAllVerticesIterable();
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       in_memory_vertices_by_label_.InMemoryLabelIndex::Iterable::~Iterable();
       break;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_vertices_by_label_property_.InMemoryLabelPropertyIndex::Iterable::~Iterable();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      in_memory_vertices_by_label_property_composite_.InMemoryLabelPropertyCompositeIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      in_memory_vertices_by_text_.InMemoryTextIndex::Iterable::~Iterable();
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      in_memory_vertices_by_point_.InMemoryPointIndex::Iterable::~Iterable();
+      break;
+  }
+}
+
+bool VerticesIterable::SetFilter(const VertexFilter *filter) {
+  switch (type_) {
+    case Type::ALL:
+      all_vertices_.SetFilter(filter);
+      return true;
+    case Type::BY_LABEL_PROPERTY_IN_MEMORY:
+      in_memory_vertices_by_label_property_.SetFilter(filter);
+      return true;
+    case Type::ALL_ON_DISK:
+    case Type::BY_LABEL_IN_MEMORY:
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+    case Type::BY_TEXT_IN_MEMORY:
+    case Type::BY_POINT_IN_MEMORY:
+      return false;
   }
 }
 
@@ -87,10 +174,18 @@ VerticesIterable::Iterator VerticesIterable::begin() {
   switch (type_) {
     case Type::ALL:
       return Iterator(all_vertices_.begin());
+    case Type::ALL_ON_DISK:
+      return Iterator(disk_all_vertices_.begin());
     case Type::BY_LABEL_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_.begin());
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_property_.begin());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_property_composite_.begin());
+    case Type::BY_TEXT_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_text_.begin());
+    case Type::BY_POINT_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_point_.begin());
   }
 }
 
@@ -98,10 +193,18 @@ VerticesIterable::Iterator VerticesIterable::end() {
   switch (type_) {
     case Type::ALL:
       return Iterator(all_vertices_.end());
+    case Type::ALL_ON_DISK:
+      return Iterator(disk_all_vertices_.end());
     case Type::BY_LABEL_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_.end());
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return Iterator(in_memory_vertices_by_label_property_.end());
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_label_property_composite_.end());
+    case Type::BY_TEXT_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_text_.end());
+    case Type::BY_POINT_IN_MEMORY:
+      return Iterator(in_memory_vertices_by_point_.end());
   }
 }
 
@@ -110,6 +213,10 @@ VerticesIterable::Iterator::Iterator(AllVerticesIterable::Iterator it) : type_(T
   new (&all_it_) AllVerticesIterable::Iterator(std::move(it));
 }
 
+VerticesIterable::Iterator::Iterator(DiskAllVerticesIterable::Iterator it) : type_(Type::ALL_ON_DISK) {
+  new (&disk_all_it_) DiskAllVerticesIterable::Iterator(std::move(it));
+}
+
 VerticesIterable::Iterator::Iterator(InMemoryLabelIndex::Iterable::Iterator it) : type_(Type::BY_LABEL_IN_MEMORY) {
   // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
   new (&in_memory_by_label_it_) InMemoryLabelIndex::Iterable::Iterator(std::move(it));
@@ -121,11 +228,31 @@ VerticesIterable::Iterator::Iterator(InMemoryLabelPropertyIndex::Iterable::Itera
   new (&in_memory_by_label_property_it_) InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(it));
 }
 
+VerticesIterable::Iterator::Iterator(InMemoryLabelPropertyCompositeIndex::Iterable::Iterator it)
+    : type_(Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_by_label_property_composite_it_)
+      InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(std::move(it));
+}
+
+VerticesIterable::Iterator::Iterator(InMemoryTextIndex::Iterable::Iterator it) : type_(Type::BY_TEXT_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_by_text_it_) InMemoryTextIndex::Iterable::Iterator(std::move(it));
+}
+
+VerticesIterable::Iterator::Iterator(InMemoryPointIndex::Iterable::Iterator it) : type_(Type::BY_POINT_IN_MEMORY) {
+  // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+  new (&in_memory_by_point_it_) InMemoryPointIndex::Iterable::Iterator(std::move(it));
+}
+
 VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) : type_(other.type_) {
   switch (other.type_) {
     case Type::ALL:
       new (&all_it_) AllVerticesIterable::Iterator(other.all_it_);
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_it_) DiskAllVerticesIterable::Iterator(other.disk_all_it_);
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       new (&in_memory_by_label_it_) InMemoryLabelIndex::Iterable::Iterator(other.in_memory_by_label_it_);
       break;
@@ -133,6 +260,16 @@ VerticesIterable::Iterator::Iterator(const VerticesIterable::Iterator &other) :
       new (&in_memory_by_label_property_it_)
           InMemoryLabelPropertyIndex::Iterable::Iterator(other.in_memory_by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_by_label_property_composite_it_)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(other.in_memory_by_label_property_composite_it_);
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      new (&in_memory_by_text_it_) InMemoryTextIndex::Iterable::Iterator(other.in_memory_by_text_it_);
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      new (&in_memory_by_point_it_) InMemoryPointIndex::Iterable::Iterator(other.in_memory_by_point_it_);
+      break;
   }
 }
 
@@ -144,6 +281,9 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(const Vertices
     case Type::ALL:
       new (&all_it_) AllVerticesIterable::Iterator(other.all_it_);
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_it_) DiskAllVerticesIterable::Iterator(other.disk_all_it_);
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       new (&in_memory_by_label_it_) InMemoryLabelIndex::Iterable::Iterator(other.in_memory_by_label_it_);
       break;
@@ -151,6 +291,16 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(const Vertices
       new (&in_memory_by_label_property_it_)
           InMemoryLabelPropertyIndex::Iterable::Iterator(other.in_memory_by_label_property_it_);
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_by_label_property_composite_it_)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(other.in_memory_by_label_property_composite_it_);
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      new (&in_memory_by_text_it_) InMemoryTextIndex::Iterable::Iterator(other.in_memory_by_text_it_);
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      new (&in_memory_by_point_it_) InMemoryPointIndex::Iterable::Iterator(other.in_memory_by_point_it_);
+      break;
   }
   return *this;
 }
@@ -161,6 +311,9 @@ VerticesIterable::Iterator::Iterator(VerticesIterable::Iterator &&other) noexcep
       // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
       new (&all_it_) AllVerticesIterable::Iterator(std::move(other.all_it_));
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_it_) DiskAllVerticesIterable::Iterator(std::move(other.disk_all_it_));
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
       new (&in_memory_by_label_it_) InMemoryLabelIndex::Iterable::Iterator(std::move(other.in_memory_by_label_it_));
@@ -170,6 +323,20 @@ VerticesIterable::Iterator::Iterator(VerticesIterable::Iterator &&other) noexcep
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_by_label_property_composite_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(
+              std::move(other.in_memory_by_label_property_composite_it_));
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+      new (&in_memory_by_text_it_) InMemoryTextIndex::Iterable::Iterator(std::move(other.in_memory_by_text_it_));
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+      new (&in_memory_by_point_it_) InMemoryPointIndex::Iterable::Iterator(std::move(other.in_memory_by_point_it_));
+      break;
   }
 }
 
@@ -181,6 +348,9 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(VerticesIterab
       // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
       new (&all_it_) AllVerticesIterable::Iterator(std::move(other.all_it_));
       break;
+    case Type::ALL_ON_DISK:
+      new (&disk_all_it_) DiskAllVerticesIterable::Iterator(std::move(other.disk_all_it_));
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
       new (&in_memory_by_label_it_) InMemoryLabelIndex::Iterable::Iterator(std::move(other.in_memory_by_label_it_));
@@ -190,6 +360,20 @@ VerticesIterable::Iterator &VerticesIterable::Iterator::operator=(VerticesIterab
           // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
           InMemoryLabelPropertyIndex::Iterable::Iterator(std::move(other.in_memory_by_label_property_it_));
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      new (&in_memory_by_label_property_composite_it_)
+          // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+          InMemoryLabelPropertyCompositeIndex::Iterable::Iterator(
+              std::move(other.in_memory_by_label_property_composite_it_));
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+      new (&in_memory_by_text_it_) InMemoryTextIndex::Iterable::Iterator(std::move(other.in_memory_by_text_it_));
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      // NOLINTNEXTLINE(hicpp-move-const-arg,performance-move-const-arg)
+      new (&in_memory_by_point_it_) InMemoryPointIndex::Iterable::Iterator(std::move(other.in_memory_by_point_it_));
+      break;
   }
   return *this;
 }
@@ -201,12 +385,24 @@ void VerticesIterable::Iterator::Destroy() noexcept {
     case Type::ALL:
       all_it_.AllVerticesIterable::Iterator::~Iterator();
       break;
+    case Type::ALL_ON_DISK:
+      disk_all_it_.DiskAllVerticesIterable::Iterator::~Iterator();
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       in_memory_by_label_it_.InMemoryLabelIndex::Iterable::Iterator::~Iterator();
       break;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       in_memory_by_label_property_it_.InMemoryLabelPropertyIndex::Iterable::Iterator::~Iterator();
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      in_memory_by_label_property_composite_it_.InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      in_memory_by_text_it_.InMemoryTextIndex::Iterable::Iterator::~Iterator();
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      in_memory_by_point_it_.InMemoryPointIndex::Iterable::Iterator::~Iterator();
+      break;
   }
 }
 
@@ -214,24 +410,49 @@ VertexAccessor const &VerticesIterable::Iterator::operator*() const {
   switch (type_) {
     case Type::ALL:
       return *all_it_;
+    case Type::ALL_ON_DISK:
+      return *disk_all_it_;
     case Type::BY_LABEL_IN_MEMORY:
       return *in_memory_by_label_it_;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return *in_memory_by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      return *in_memory_by_label_property_composite_it_;
+    case Type::BY_TEXT_IN_MEMORY:
+      return *in_memory_by_text_it_;
+    case Type::BY_POINT_IN_MEMORY:
+      return *in_memory_by_point_it_;
   }
 }
 
+const PropertyValue *VerticesIterable::Iterator::IndexedValue() const {
+  if (type_ != Type::BY_LABEL_PROPERTY_IN_MEMORY) return nullptr;
+  return &in_memory_by_label_property_it_.CurrentValue();
+}
+
 VerticesIterable::Iterator &VerticesIterable::Iterator::operator++() {
   switch (type_) {
     case Type::ALL:
       ++all_it_;
       break;
+    case Type::ALL_ON_DISK:
+      ++disk_all_it_;
+      break;
     case Type::BY_LABEL_IN_MEMORY:
       ++in_memory_by_label_it_;
       break;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       ++in_memory_by_label_property_it_;
       break;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      ++in_memory_by_label_property_composite_it_;
+      break;
+    case Type::BY_TEXT_IN_MEMORY:
+      ++in_memory_by_text_it_;
+      break;
+    case Type::BY_POINT_IN_MEMORY:
+      ++in_memory_by_point_it_;
+      break;
   }
   return *this;
 }
@@ -240,10 +461,18 @@ bool VerticesIterable::Iterator::operator==(const Iterator &other) const {
   switch (type_) {
     case Type::ALL:
       return all_it_ == other.all_it_;
+    case Type::ALL_ON_DISK:
+      return disk_all_it_ == other.disk_all_it_;
     case Type::BY_LABEL_IN_MEMORY:
       return in_memory_by_label_it_ == other.in_memory_by_label_it_;
     case Type::BY_LABEL_PROPERTY_IN_MEMORY:
       return in_memory_by_label_property_it_ == other.in_memory_by_label_property_it_;
+    case Type::BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY:
+      return in_memory_by_label_property_composite_it_ == other.in_memory_by_label_property_composite_it_;
+    case Type::BY_TEXT_IN_MEMORY:
+      return in_memory_by_text_it_ == other.in_memory_by_text_it_;
+    case Type::BY_POINT_IN_MEMORY:
+      return in_memory_by_point_it_ == other.in_memory_by_point_it_;
   }
 }
 
@@ -12,25 +12,45 @@
 #pragma once
 
 #include "storage/v2/all_vertices_iterable.hpp"
+#include "storage/v2/disk/all_vertices_iterable.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
+#include "storage/v2/inmemory/point_index.hpp"
+#include "storage/v2/inmemory/text_index.hpp"
 
 namespace memgraph::storage {
 
 class VerticesIterable final {
-  enum class Type { ALL, BY_LABEL_IN_MEMORY, BY_LABEL_PROPERTY_IN_MEMORY };
+  enum class Type {
+    ALL,
+    ALL_ON_DISK,
+    BY_LABEL_IN_MEMORY,
+    BY_LABEL_PROPERTY_IN_MEMORY,
+    BY_LABEL_PROPERTY_COMPOSITE_IN_MEMORY,
+    BY_TEXT_IN_MEMORY,
+    BY_POINT_IN_MEMORY
+  };
 
   Type type_;
   union {
     AllVerticesIterable all_vertices_;
+    DiskAllVerticesIterable disk_all_vertices_;
     InMemoryLabelIndex::Iterable in_memory_vertices_by_label_;
     InMemoryLabelPropertyIndex::Iterable in_memory_vertices_by_label_property_;
+    InMemoryLabelPropertyCompositeIndex::Iterable in_memory_vertices_by_label_property_composite_;
+    InMemoryTextIndex::Iterable in_memory_vertices_by_text_;
+    InMemoryPointIndex::Iterable in_memory_vertices_by_point_;
   };
 
  public:
   explicit VerticesIterable(AllVerticesIterable);
+  explicit VerticesIterable(DiskAllVerticesIterable);
   explicit VerticesIterable(InMemoryLabelIndex::Iterable);
   explicit VerticesIterable(InMemoryLabelPropertyIndex::Iterable);
+  explicit VerticesIterable(InMemoryLabelPropertyCompositeIndex::Iterable);
+  explicit VerticesIterable(InMemoryTextIndex::Iterable);
+  explicit VerticesIterable(InMemoryPointIndex::Iterable);
 
   VerticesIterable(const VerticesIterable &) = delete;
   VerticesIterable &operator=(const VerticesIterable &) = delete;
@@ -44,16 +64,24 @@ class VerticesIterable final {
     Type type_;
     union {
       AllVerticesIterable::Iterator all_it_;
+      DiskAllVerticesIterable::Iterator disk_all_it_;
       InMemoryLabelIndex::Iterable::Iterator in_memory_by_label_it_;
       InMemoryLabelPropertyIndex::Iterable::Iterator in_memory_by_label_property_it_;
+      InMemoryLabelPropertyCompositeIndex::Iterable::Iterator in_memory_by_label_property_composite_it_;
+      InMemoryTextIndex::Iterable::Iterator in_memory_by_text_it_;
+      InMemoryPointIndex::Iterable::Iterator in_memory_by_point_it_;
     };
 
     void Destroy() noexcept;
 
    public:
     explicit Iterator(AllVerticesIterable::Iterator);
+    explicit Iterator(DiskAllVerticesIterable::Iterator);
     explicit Iterator(InMemoryLabelIndex::Iterable::Iterator);
     explicit Iterator(InMemoryLabelPropertyIndex::Iterable::Iterator);
+    explicit Iterator(InMemoryLabelPropertyCompositeIndex::Iterable::Iterator);
+    explicit Iterator(InMemoryTextIndex::Iterable::Iterator);
+    explicit Iterator(InMemoryPointIndex::Iterable::Iterator);
 
     Iterator(const Iterator &);
     Iterator &operator=(const Iterator &);
@@ -67,10 +95,22 @@ class VerticesIterable final {
 
     Iterator &operator++();
 
+    /// Returns the value of the indexed property of the current vertex if the
+    /// iterator reads it from the index entries, or nullptr otherwise. Only
+    /// the iterators of in-memory label-property indices read it.
+    const PropertyValue *IndexedValue() const;
+
     bool operator==(const Iterator &other) const;
     bool operator!=(const Iterator &other) const { return !(*this == other); }
   };
 
+  /// Skips the vertices which don't match the `filter`, which has to outlive
+  /// the iteration. It has to be set before calling `begin`. Only the
+  /// in-memory iterables of all vertices and of label-property indices apply
+  /// the filter.
+  /// @return true if the filter is applied.
+  bool SetFilter(const VertexFilter *filter);
+
   Iterator begin();
   Iterator end();
 };
@@ -13,7 +13,7 @@
 #include <memory>
 #include "storage/v2/delta.hpp"
 #include "utils/memory.hpp"
-#include "utils/pmr/list.hpp"
+#include "utils/pmr/deque.hpp"
 
 /// struct Bond presents the association of a collection and its resource
 /// and makes them tightly bound for easier handling of construction, moving and destruction
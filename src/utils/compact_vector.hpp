@@ -0,0 +1,176 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "utils/likely.hpp"
+
+namespace memgraph::utils {
+
+/// Vector of trivially copyable elements which stores up to `TInline` of them
+/// inside of the object itself and only allocates memory once it grows beyond
+/// that.
+///
+/// Unlike `utils::SmallVector`, the size and capacity are stored as 32-bit
+/// integers and the inline elements share their space with the heap pointer,
+/// so e.g. `CompactVector<uint64_t, 2>` has the same size as a `std::vector`
+/// header while never allocating for up to 2 elements. It is intended for
+/// short lists stored in huge numbers of objects, like the labels of a vertex.
+template <typename T, uint32_t TInline>
+class CompactVector {
+  static_assert(std::is_trivially_copyable_v<T>, "CompactVector supports only trivially copyable types!");
+  static_assert(TInline > 0, "CompactVector must have space for at least one inline element!");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  CompactVector() = default;
+
+  CompactVector(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+
+  template <typename TIterator>
+  CompactVector(TIterator first, TIterator last) {
+    assign(first, last);
+  }
+
+  CompactVector(const CompactVector &other) { assign(other.begin(), other.end()); }
+
+  CompactVector(CompactVector &&other) noexcept { MoveFrom(std::move(other)); }
+
+  CompactVector &operator=(const CompactVector &other) {
+    if (this != &other) assign(other.begin(), other.end());
+    return *this;
+  }
+
+  CompactVector &operator=(CompactVector &&other) noexcept {
+    if (this != &other) {
+      Deallocate();
+      MoveFrom(std::move(other));
+    }
+    return *this;
+  }
+
+  ~CompactVector() { Deallocate(); }
+
+  template <typename TIterator>
+  void assign(TIterator first, TIterator last) {
+    clear();
+    reserve(static_cast<size_type>(std::distance(first, last)));
+    std::copy(first, last, data());
+    size_ = static_cast<uint32_t>(std::distance(first, last));
+  }
+
+  iterator begin() { return data(); }
+  const_iterator begin() const { return data(); }
+  iterator end() { return data() + size_; }
+  const_iterator end() const { return data() + size_; }
+  reverse_iterator rbegin() { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  reverse_iterator rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  pointer data() { return IsInline() ? inline_ : heap_; }
+  const_pointer data() const { return IsInline() ? inline_ : heap_; }
+
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+
+  reference operator[](size_type idx) { return data()[idx]; }
+  const_reference operator[](size_type idx) const { return data()[idx]; }
+  reference front() { return data()[0]; }
+  const_reference front() const { return data()[0]; }
+  reference back() { return data()[size_ - 1]; }
+  const_reference back() const { return data()[size_ - 1]; }
+
+  void reserve(size_type new_capacity) {
+    if (new_capacity <= capacity_) return;
+    auto *new_data = static_cast<T *>(::operator new(new_capacity * sizeof(T)));
+    std::memcpy(static_cast<void *>(new_data), data(), size_ * sizeof(T));
+    Deallocate();
+    heap_ = new_data;
+    capacity_ = static_cast<uint32_t>(new_capacity);
+  }
+
+  void push_back(const T &value) {
+    if (UNLIKELY(size_ == capacity_)) reserve(capacity_ * 2);
+    data()[size_++] = value;
+  }
+
+  template <typename... TArgs>
+  reference emplace_back(TArgs &&...args) {
+    push_back(T(std::forward<TArgs>(args)...));
+    return back();
+  }
+
+  void pop_back() { --size_; }
+
+  iterator erase(const_iterator pos) {
+    auto *it = begin() + (pos - begin());
+    std::copy(it + 1, end(), it);
+    --size_;
+    return it;
+  }
+
+  void clear() { size_ = 0; }
+
+  friend bool operator==(const CompactVector &a, const CompactVector &b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+  }
+
+ private:
+  bool IsInline() const { return capacity_ == TInline; }
+
+  void Deallocate() {
+    if (!IsInline()) ::operator delete(heap_);
+  }
+
+  void MoveFrom(CompactVector &&other) {
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    if (other.IsInline()) {
+      std::memcpy(static_cast<void *>(inline_), other.inline_, size_ * sizeof(T));
+    } else {
+      heap_ = other.heap_;
+    }
+    other.size_ = 0;
+    other.capacity_ = TInline;
+  }
+
+  uint32_t size_{0};
+  uint32_t capacity_{TInline};
+  union {
+    T inline_[TInline];
+    T *heap_;
+  };
+};
+
+}  // namespace memgraph::utils
@@ -25,7 +25,11 @@
   M(ScanAllByLabelPropertyRangeOperator, Operator, "Number of times ScanAllByLabelPropertyRange operator was used.") \
   M(ScanAllByLabelPropertyValueOperator, Operator, "Number of times ScanAllByLabelPropertyValue operator was used.") \
   M(ScanAllByLabelPropertyOperator, Operator, "Number of times ScanAllByLabelProperty operator was used.")           \
+  M(ScanAllByLabelPropertiesOperator, Operator, "Number of times ScanAllByLabelProperties operator was used.")       \
   M(ScanAllByIdOperator, Operator, "Number of times ScanAllById operator was used.")                                 \
+  M(ScanAllByEdgeTypeOperator, Operator, "Number of times ScanAllByEdgeType operator was used.")                     \
+  M(ScanAllByTextOperator, Operator, "Number of times ScanAllByText operator was used.")                             \
+  M(ScanAllByPointOperator, Operator, "Number of times ScanAllByPoint operator was used.")                           \
   M(ExpandOperator, Operator, "Number of times Expand operator was used.")                                           \
   M(ExpandVariableOperator, Operator, "Number of times ExpandVariable operator was used.")                           \
   M(ConstructNamedPathOperator, Operator, "Number of times ConstructNamedPath operator was used.")                   \
@@ -50,6 +54,8 @@
   M(DistinctOperator, Operator, "Number of times Distinct operator was used.")                                       \
   M(UnionOperator, Operator, "Number of times Union operator was used.")                                             \
   M(CartesianOperator, Operator, "Number of times Cartesian operator was used.")                                     \
+  M(HashJoinOperator, Operator, "Number of times HashJoin operator was used.")                                       \
+  M(IndexedJoinOperator, Operator, "Number of times IndexedJoin operator was used.")                                 \
   M(CallProcedureOperator, Operator, "Number of times CallProcedure operator was used.")                             \
   M(ForeachOperator, Operator, "Number of times Foreach operator was used.")                                         \
   M(EvaluatePatternFilterOperator, Operator, "Number of times EvaluatePatternFilter operator was used.")             \
@@ -57,12 +63,19 @@
                                                                                                                      \
   M(ActiveLabelIndices, Index, "Number of active label indices in the system.")                                      \
   M(ActiveLabelPropertyIndices, Index, "Number of active label property indices in the system<.")                    \
+  M(ActiveLabelPropertyCompositeIndices, Index, "Number of active composite label property indices in the system.")  \
+  M(ActiveEdgeTypeIndices, Index, "Number of active edge type indices in the system.")                               \
+  M(ActiveEdgeTypePropertyIndices, Index, "Number of active edge type property indices in the system.")              \
+  M(ActiveTextIndices, Index, "Number of active text indices in the system.")                                        \
+  M(ActivePointIndices, Index, "Number of active point indices in the system.")                                      \
+  M(ActiveVectorIndices, Index, "Number of active vector indices in the system.")                                    \
                                                                                                                      \
   M(StreamsCreated, Stream, "Number of Streams created.")                                                            \
   M(MessagesConsumed, Stream, "Number of consumed streamed messages.")                                               \
                                                                                                                      \
   M(TriggersCreated, Trigger, "Number of Triggers created.")                                                         \
   M(TriggersExecuted, Trigger, "Number of Triggers executed.")                                                       \
+  M(AfterCommitTriggerBatches, Trigger, "Number of batches of transactions after commit triggers ran for.")          \
                                                                                                                      \
   M(ActiveSessions, Session, "Number of active connections.")                                                        \
   M(ActiveBoltSessions, Session, "Number of active Bolt connections.")                                               \
@@ -70,11 +83,31 @@
   M(ActiveSSLSessions, Session, "Number of active SSL connections.")                                                 \
   M(ActiveWebSocketSessions, Session, "Number of active websocket connections.")                                     \
   M(BoltMessages, Session, "Number of Bolt messages sent.")                                                          \
+  M(WebSocketMessagesDropped, Session,                                                                               \
+    "Number of log messages which weren't sent to the websocket clients because they couldn't keep up.")             \
                                                                                                                      \
   M(ActiveTransactions, Transaction, "Number of active transactions.")                                               \
   M(CommitedTransactions, Transaction, "Number of committed transactions.")                                          \
   M(RollbackedTransactions, Transaction, "Number of rollbacked transactions.")                                       \
-  M(FailedQuery, Transaction, "Number of times executing a query failed.")
+  M(FailedQuery, Transaction, "Number of times executing a query failed.")                                           \
+                                                                                                                     \
+  M(RWSpinLockContentions, Lock, "Number of times a vertex or an edge lock had to be waited for.")                   \
+  M(RWSpinLockWait_ns, Lock, "Nanoseconds spent waiting for vertex and edge locks.")                                 \
+  M(ScalableRWLockContentions, Lock, "Number of times the storage lock had to be waited for.")                       \
+  M(ScalableRWLockWait_ns, Lock, "Nanoseconds spent waiting for the storage lock.")                                  \
+  M(LockSpins, Lock, "Number of iterations spent spinning while waiting for a lock.")                                \
+                                                                                                                     \
+  M(SnapshotBytesWritten, Snapshot, "Number of bytes written to snapshot files.")                                    \
+  M(WalBytesWritten, Wal, "Number of bytes appended to WAL files.")                                                  \
+                                                                                                                     \
+  M(GcFreedBytes, GarbageCollection,                                                                                 \
+    "Approximate number of bytes of the deltas, vertices and edges freed by the garbage collector.")                 \
+                                                                                                                     \
+  M(DiskDelayedColumnFamilies, DiskStorage, "Number of RocksDB column families whose writes are being delayed.")     \
+  M(DiskStoppedColumnFamilies, DiskStorage, "Number of RocksDB column families whose writes are being stopped.")     \
+  M(DiskWriteStalls, DiskStorage, "Number of times RocksDB started delaying or stopping writes of a column family.") \
+  M(DiskCommitsFailedOnWriteStall, DiskStorage,                                                                      \
+    "Number of on-disk storage commits which failed because RocksDB stalled the writes for too long.")
 
 namespace memgraph::metrics {
 // define every Event as an index in the array of counters
@@ -11,8 +11,11 @@
 
 #include "utils/event_gauge.hpp"
 
-// We don't have any gauges for now
-#define APPLY_FOR_GAUGES(M)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define APPLY_FOR_GAUGES(M)                                                                                        \
+  M(SnapshotObjectsTotal, Snapshot, "Approximate number of objects the current or last snapshot writes in total.") \
+  M(SnapshotObjectsWritten, Snapshot, "Number of objects written by the current or last snapshot so far.")         \
+  M(AfterCommitTriggerQueueDepth, Trigger, "Number of committed transactions waiting for after commit triggers.")
 
 namespace memgraph::metrics {
 
@@ -12,10 +12,12 @@
 #include "utils/event_histogram.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_HISTOGRAMS(M)                                                                    \
-  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
-  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+#define APPLY_FOR_HISTOGRAMS(M)                                                                                      \
+  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)                          \
+  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99)                   \
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)                   \
+  M(GcCycleLatency_us, GarbageCollection, "Garbage collection cycle latency in microseconds", 50, 90, 99)            \
+  M(DeltaChainLength, Storage, "Number of deltas applied by a sample of the reads of objects with deltas", 50, 90, 99)
 
 namespace memgraph::metrics {
 
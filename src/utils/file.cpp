@@ -12,6 +12,7 @@
 #include "utils/file.hpp"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -20,6 +21,7 @@
 #include <fstream>
 #include <mutex>
 #include <shared_mutex>
+#include <thread>
 #include <type_traits>
 
 #include "utils/logging.hpp"
@@ -95,7 +97,9 @@ InputFile::InputFile(InputFile &&other) noexcept
       file_position_(other.file_position_),
       buffer_start_(other.buffer_start_),
       buffer_size_(other.buffer_size_),
-      buffer_position_(other.buffer_position_) {
+      buffer_position_(other.buffer_position_),
+      memory_mapped_(other.memory_mapped_),
+      mapped_data_(other.mapped_data_) {
   memcpy(buffer_, other.buffer_, kFileBufferSize);
   other.fd_ = -1;
   other.file_size_ = 0;
@@ -103,6 +107,8 @@ InputFile::InputFile(InputFile &&other) noexcept
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
+  other.memory_mapped_ = false;
+  other.mapped_data_ = nullptr;
 }
 
 InputFile &InputFile::operator=(InputFile &&other) noexcept {
@@ -115,6 +121,8 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   buffer_start_ = other.buffer_start_;
   buffer_size_ = other.buffer_size_;
   buffer_position_ = other.buffer_position_;
+  memory_mapped_ = other.memory_mapped_;
+  mapped_data_ = other.mapped_data_;
   memcpy(buffer_, other.buffer_, kFileBufferSize);
 
   other.fd_ = -1;
@@ -123,11 +131,13 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
+  other.memory_mapped_ = false;
+  other.mapped_data_ = nullptr;
 
   return *this;
 }
 
-bool InputFile::Open(const std::filesystem::path &path) {
+bool InputFile::Open(const std::filesystem::path &path, Mode mode) {
   if (IsOpen()) return false;
 
   path_ = path;
@@ -154,6 +164,20 @@ bool InputFile::Open(const std::filesystem::path &path) {
   }
   file_size_ = *size;
 
+  if (mode == Mode::MEMORY_MAPPED) {
+    memory_mapped_ = true;
+    if (file_size_ > 0) {
+      auto *data = mmap(nullptr, file_size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      if (data == MAP_FAILED) {
+        Close();
+        return false;
+      }
+      mapped_data_ = static_cast<uint8_t *>(data);
+      // The files are mostly read from the start to the end.
+      madvise(mapped_data_, file_size_, MADV_SEQUENTIAL);
+    }
+  }
+
   return true;
 }
 
@@ -161,7 +185,16 @@ bool InputFile::IsOpen() const { return fd_ != -1; }
 
 const std::filesystem::path &InputFile::path() const { return path_; }
 
+int InputFile::fd() const { return fd_; }
+
 bool InputFile::Read(uint8_t *data, size_t size) {
+  if (memory_mapped_) {
+    const auto *mapped = ReadMapped(size);
+    if (!mapped) return false;
+    memcpy(data, mapped, size);
+    return true;
+  }
+
   size_t offset = 0;
 
   while (size > 0) {
@@ -181,6 +214,12 @@ bool InputFile::Read(uint8_t *data, size_t size) {
 }
 
 bool InputFile::Peek(uint8_t *data, size_t size) {
+  if (memory_mapped_) {
+    if (!mapped_data_ || size > file_size_ - file_position_) return false;
+    memcpy(data, mapped_data_ + file_position_, size);
+    return true;
+  }
+
   auto old_buffer_start = buffer_start_;
   auto old_buffer_position = buffer_position_;
   auto real_position = GetPosition();
@@ -199,6 +238,13 @@ bool InputFile::Peek(uint8_t *data, size_t size) {
   return ret;
 }
 
+const uint8_t *InputFile::ReadMapped(size_t size) {
+  if (!memory_mapped_ || !mapped_data_ || size > file_size_ - file_position_) return nullptr;
+  const auto *data = mapped_data_ + file_position_;
+  file_position_ += size;
+  return data;
+}
+
 size_t InputFile::GetSize() { return file_size_; }
 
 size_t InputFile::GetPosition() {
@@ -207,6 +253,16 @@ size_t InputFile::GetPosition() {
 }
 
 std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset) {
+  if (memory_mapped_) {
+    ssize_t base = 0;
+    if (position == Position::RELATIVE_TO_CURRENT) base = static_cast<ssize_t>(file_position_);
+    if (position == Position::RELATIVE_TO_END) base = static_cast<ssize_t>(file_size_);
+    const auto pos = base + offset;
+    if (pos < 0 || static_cast<size_t>(pos) > file_size_) return std::nullopt;
+    file_position_ = pos;
+    return pos;
+  }
+
   int whence;
   switch (position) {
     case Position::SET:
@@ -236,6 +292,12 @@ std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset)
 void InputFile::Close() noexcept {
   if (!IsOpen()) return;
 
+  if (mapped_data_) {
+    munmap(mapped_data_, file_size_);
+    mapped_data_ = nullptr;
+  }
+  memory_mapped_ = false;
+
   int ret = 0;
   while (true) {
     ret = close(fd_);
@@ -290,17 +352,56 @@ bool InputFile::LoadBuffer() {
   return true;
 }
 
+void WriteThrottle::Acquire(size_t size) {
+  if (bytes_per_second_ == 0) return;
+  std::unique_lock guard(mutex_);
+  syncs_done_cv_.wait_for(guard, kMaxSyncWait, [this] { return syncs_in_progress_ == 0; });
+  // Each write is scheduled after the previous ones take their time.
+  const auto start = std::max(std::chrono::steady_clock::now(), next_write_);
+  next_write_ = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(static_cast<double>(size) / bytes_per_second_));
+  guard.unlock();
+  std::this_thread::sleep_until(start);
+}
+
+void WriteThrottle::BeginPrioritySync() {
+  if (bytes_per_second_ == 0) return;
+  std::lock_guard guard(mutex_);
+  ++syncs_in_progress_;
+}
+
+void WriteThrottle::EndPrioritySync() {
+  if (bytes_per_second_ == 0) return;
+  {
+    std::lock_guard guard(mutex_);
+    --syncs_in_progress_;
+  }
+  syncs_done_cv_.notify_all();
+}
+
 OutputFile::~OutputFile() {
   if (IsOpen()) Close();
 }
 
 OutputFile::OutputFile(OutputFile &&other) noexcept
-    : fd_(other.fd_), written_since_last_sync_(other.written_since_last_sync_), path_(std::move(other.path_)) {
+    : fd_(other.fd_),
+      written_since_last_sync_(other.written_since_last_sync_),
+      path_(std::move(other.path_)),
+      direct_io_(other.direct_io_),
+      direct_offset_(other.direct_offset_),
+      direct_written_(other.direct_written_),
+      write_throttle_(other.write_throttle_),
+      sync_priority_throttle_(other.sync_priority_throttle_) {
   memcpy(buffer_, other.buffer_, kFileBufferSize);
   buffer_position_.store(other.buffer_position_.load());
   other.fd_ = -1;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
+  other.direct_io_ = false;
+  other.direct_offset_ = 0;
+  other.direct_written_ = 0;
+  other.write_throttle_ = nullptr;
+  other.sync_priority_throttle_ = nullptr;
 }
 
 OutputFile &OutputFile::operator=(OutputFile &&other) noexcept {
@@ -311,10 +412,20 @@ OutputFile &OutputFile::operator=(OutputFile &&other) noexcept {
   path_ = std::move(other.path_);
   buffer_position_ = other.buffer_position_.load();
   memcpy(buffer_, other.buffer_, kFileBufferSize);
+  direct_io_ = other.direct_io_;
+  direct_offset_ = other.direct_offset_;
+  direct_written_ = other.direct_written_;
+  write_throttle_ = other.write_throttle_;
+  sync_priority_throttle_ = other.sync_priority_throttle_;
 
   other.fd_ = -1;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
+  other.direct_io_ = false;
+  other.direct_offset_ = 0;
+  other.direct_written_ = 0;
+  other.write_throttle_ = nullptr;
+  other.sync_priority_throttle_ = nullptr;
 
   return *this;
 }
@@ -398,9 +509,13 @@ size_t OutputFile::SeekFile(const Position position, const ssize_t offset) {
   }
 }
 
-size_t OutputFile::GetPosition() { return SetPosition(Position::RELATIVE_TO_CURRENT, 0); }
+size_t OutputFile::GetPosition() {
+  if (direct_io_) return direct_offset_ + buffer_position_.load();
+  return SetPosition(Position::RELATIVE_TO_CURRENT, 0);
+}
 
 size_t OutputFile::SetPosition(Position position, ssize_t offset) {
+  MG_ASSERT(!direct_io_, "Trying to set the position in {} which is written with direct I/O!", path_);
   FlushBuffer(true);
   return SeekFile(position, offset);
 }
@@ -427,9 +542,7 @@ bool OutputFile::AcquireLock() {
   return ret != -1;
 }
 
-void OutputFile::Sync() {
-  FlushBuffer(true);
-
+int OutputFile::FsyncFile() {
   int ret = 0;
   while (true) {
     ret = fsync(fd_);
@@ -437,11 +550,20 @@ void OutputFile::Sync() {
       // The call was interrupted, try again...
       continue;
     } else {
-      // All other possible errors are fatal errors and are handled in the
-      // MG_ASSERT below.
+      // All other possible errors are fatal errors and are handled by the
+      // caller.
       break;
     }
   }
+  return ret;
+}
+
+void OutputFile::Sync() {
+  FlushBuffer(true);
+
+  if (sync_priority_throttle_) sync_priority_throttle_->BeginPrioritySync();
+  const int ret = FsyncFile();
+  if (sync_priority_throttle_) sync_priority_throttle_->EndPrioritySync();
 
   // In this check we are extremely rigorous because any error except EINTR is
   // treated as a fatal error that will crash the database. The errors that will
@@ -475,10 +597,37 @@ void OutputFile::Sync() {
   written_since_last_sync_ = 0;
 }
 
+void OutputFile::Flush() { FlushBuffer(true); }
+
+void OutputFile::SyncWithoutFlushing() {
+  MG_ASSERT(IsOpen(), "Syncing an unopened file.");
+
+  // See `Sync` for the reasoning behind crashing. `written_since_last_sync_`
+  // may be updated concurrently, so it isn't reported (nor reset) here.
+  if (sync_priority_throttle_) sync_priority_throttle_->BeginPrioritySync();
+  const int ret = FsyncFile();
+  if (sync_priority_throttle_) sync_priority_throttle_->EndPrioritySync();
+  MG_ASSERT(ret == 0, "While trying to sync {}, an error occurred: {} ({}).", path_, strerror(errno), errno);
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
   int ret = 0;
+  if (direct_io_) {
+    // Direct writes are padded to whole blocks, the padding is cut off.
+    while (true) {
+      ret = ftruncate(fd_, static_cast<off_t>(direct_offset_ + direct_written_));
+      if (ret == -1 && errno == EINTR) continue;
+      break;
+    }
+    MG_ASSERT(ret == 0, "While trying to truncate {}, an error occurred: {} ({}).", path_, strerror(errno), errno);
+    direct_io_ = false;
+    direct_offset_ = 0;
+    direct_written_ = 0;
+    buffer_position_ = 0;
+  }
+
   while (true) {
     ret = close(fd_);
     if (ret == -1 && errno == EINTR) {
@@ -516,6 +665,13 @@ void OutputFile::FlushBufferInternal() {
             "buffer than the buffer has space!",
             path_);
 
+  if (write_throttle_ && buffer_position_ > 0) write_throttle_->Acquire(buffer_position_);
+
+  if (direct_io_) {
+    FlushBufferDirect();
+    return;
+  }
+
   auto *buffer = buffer_;
   auto buffer_position = buffer_position_.load();
   while (buffer_position > 0) {
@@ -537,6 +693,41 @@ void OutputFile::FlushBufferInternal() {
   buffer_position_.store(buffer_position);
 }
 
+void OutputFile::FlushBufferDirect() {
+  const auto buffer_position = buffer_position_.load();
+  if (buffer_position == direct_written_) return;
+
+  // Only whole blocks can be written, so the last partial block is padded.
+  const auto padded_size = (buffer_position + kDirectIOAlignment - 1) / kDirectIOAlignment * kDirectIOAlignment;
+  memset(buffer_ + buffer_position, 0, padded_size - buffer_position);
+
+  size_t written_total = 0;
+  while (written_total < padded_size) {
+    auto written = pwrite(fd_, buffer_ + written_total, padded_size - written_total,
+                          static_cast<off_t>(direct_offset_ + written_total));
+    if (written == -1 && errno == EINTR) {
+      continue;
+    }
+
+    MG_ASSERT(written > 0,
+              "while trying to write to {} an error occurred: {} ({}). "
+              "Possibly {} bytes of data were lost from this call and "
+              "possibly {} bytes were lost from previous calls.",
+              path_, strerror(errno), errno, buffer_position - direct_written_, written_since_last_sync_);
+
+    written_total += written;
+  }
+
+  // The last partial block stays in the buffer and is written again once the
+  // following data is appended to it.
+  const auto full_size = buffer_position - buffer_position % kDirectIOAlignment;
+  const auto partial_size = buffer_position - full_size;
+  if (full_size > 0 && partial_size > 0) memcpy(buffer_, buffer_ + full_size, partial_size);
+  direct_offset_ += full_size;
+  direct_written_ = partial_size;
+  buffer_position_.store(partial_size);
+}
+
 void OutputFile::DisableFlushing() { flush_lock_.lock_shared(); }
 
 void OutputFile::EnableFlushing() {
@@ -544,7 +735,10 @@ void OutputFile::EnableFlushing() {
   TryFlushing();
 }
 
-std::pair<const uint8_t *, size_t> OutputFile::CurrentBuffer() const { return {buffer_, buffer_position_.load()}; }
+std::pair<const uint8_t *, size_t> OutputFile::CurrentBuffer() const {
+  if (direct_io_) return {buffer_ + direct_written_, buffer_position_.load() - direct_written_};
+  return {buffer_, buffer_position_.load()};
+}
 
 size_t OutputFile::GetSize() {
   // There's an alternative way of fetching the files size using fstat.
@@ -554,9 +748,69 @@ size_t OutputFile::GetSize() {
   // support for multi-threading. While lseek uses locks, fstat is lockfree.
   // For now, lseek should be good enough. If at any point this proves to
   // be a bottleneck, fstat should be considered.
+  if (direct_io_) return direct_offset_ + buffer_position_.load();
   return SeekFile(Position::RELATIVE_TO_END, 0) + buffer_position_.load();
 }
 
+size_t OutputFile::GetWrittenSize() {
+  if (direct_io_) return direct_offset_ + direct_written_;
+  return SeekFile(Position::RELATIVE_TO_END, 0);
+}
+
+void OutputFile::SetWriteThrottle(WriteThrottle *throttle) { write_throttle_ = throttle; }
+
+void OutputFile::SetSyncPriority(WriteThrottle *throttle) { sync_priority_throttle_ = throttle; }
+
+bool OutputFile::Preallocate(size_t size) {
+  MG_ASSERT(IsOpen(), "Trying to preallocate an unopened file!");
+  int ret = 0;
+  while (true) {
+    ret = fallocate(fd_, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+    if (ret == -1 && errno == EINTR) continue;
+    break;
+  }
+  return ret == 0;
+}
+
+bool OutputFile::EnableDirectIO() {
+  MG_ASSERT(IsOpen(), "Trying to enable direct I/O on an unopened file!");
+  MG_ASSERT(!direct_io_, "Direct I/O is already enabled on {}!", path_);
+  FlushBuffer(true);
+
+  const int flags = fcntl(fd_, F_GETFL);
+  MG_ASSERT(flags != -1, "While trying to get the flags of {} an error occurred: {} ({})", path_, strerror(errno),
+            errno);
+  // `O_APPEND` is cleared because Linux ignores the offset of `pwrite` with it.
+  if (fcntl(fd_, F_SETFL, (flags & ~O_APPEND) | O_DIRECT) == -1) {
+    return false;
+  }
+
+  // Writes start at the last aligned offset, so the last partial block is read
+  // back into the buffer.
+  const auto size = SeekFile(Position::RELATIVE_TO_END, 0);
+  const auto offset = size - size % kDirectIOAlignment;
+  size_t read_total = 0;
+  if (offset < size) {
+    const int read_fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    MG_ASSERT(read_fd != -1, "While trying to open {} for reading an error occurred: {} ({})", path_, strerror(errno),
+              errno);
+    while (read_total < size - offset) {
+      auto got = pread(read_fd, buffer_ + read_total, size - offset - read_total,
+                       static_cast<off_t>(offset + read_total));
+      if (got == -1 && errno == EINTR) continue;
+      MG_ASSERT(got > 0, "While trying to read from {} an error occurred: {} ({})", path_, strerror(errno), errno);
+      read_total += got;
+    }
+    close(read_fd);
+  }
+
+  direct_io_ = true;
+  direct_offset_ = offset;
+  direct_written_ = read_total;
+  buffer_position_ = read_total;
+  return true;
+}
+
 void OutputFile::TryFlushing() {
   if (std::unique_lock guard(flush_lock_, std::try_to_lock); guard.owns_lock()) {
     FlushBufferInternal();
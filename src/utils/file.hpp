@@ -18,7 +18,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -73,6 +76,9 @@ bool HasReadAccess(const std::filesystem::path &path);
 /// emptying.
 inline constexpr size_t kFileBufferSize = 262144;
 
+/// Alignment of the memory, file offsets and sizes of direct I/O writes.
+inline constexpr size_t kDirectIOAlignment = 4096;
+
 /// This class implements a file handler that is used to read binary files. It
 /// was developed because the C++ standard library has an awful API and makes
 /// handling of binary data extremely tedious.
@@ -87,6 +93,14 @@ class InputFile {
     RELATIVE_TO_END,
   };
 
+  /// `MEMORY_MAPPED` files are read straight from a read-only mapping of the
+  /// whole file instead of through the internal buffer. The file mustn't be
+  /// truncated while it's open.
+  enum class Mode {
+    BUFFERED,
+    MEMORY_MAPPED,
+  };
+
   InputFile() = default;
   ~InputFile();
 
@@ -98,7 +112,7 @@ class InputFile {
 
   /// This method opens the file used for reading. If the file can't be opened
   /// or doesn't exist it returns `false`.
-  bool Open(const std::filesystem::path &path);
+  bool Open(const std::filesystem::path &path, Mode mode = Mode::BUFFERED);
 
   /// Returns a boolean indicating whether a file is opened.
   bool IsOpen() const;
@@ -107,6 +121,11 @@ class InputFile {
   /// path is empty.
   const std::filesystem::path &path() const;
 
+  /// Returns the descriptor of the currently opened file, -1 if a file isn't
+  /// opened. Reads through the descriptor should use explicit offsets
+  /// (`pread`, `sendfile`) so that they don't move the position in the file.
+  int fd() const;
+
   /// Reads `size` bytes from the file into the memory pointed by `data` and
   /// returns a boolean indicating whether the read succeeded. Reading the file
   /// changes the current position in the file.
@@ -117,6 +136,11 @@ class InputFile {
   /// doesn't change the current position in the file.
   bool Peek(uint8_t *data, size_t size);
 
+  /// Returns a pointer to the next `size` bytes of a memory mapped file and
+  /// skips them. Returns `nullptr` if the file isn't memory mapped or if it
+  /// doesn't have enough data left.
+  const uint8_t *ReadMapped(size_t size);
+
   /// This method gets the size of the file.
   size_t GetSize();
 
@@ -144,6 +168,10 @@ class InputFile {
   std::optional<size_t> buffer_start_;
   size_t buffer_size_{0};
   size_t buffer_position_{0};
+
+  bool memory_mapped_{false};
+  // `nullptr` for empty memory mapped files.
+  uint8_t *mapped_data_{nullptr};
 };
 
 /// This class implements a file handler that is used for mission critical files
@@ -172,6 +200,45 @@ class InputFile {
 /// flushing of the internal buffer using `DisableFlushing`. Don't forget to
 /// enable flushing again after you're done with reading using the
 /// 'EnableFlushing' method!
+/// Limits the rate at which the `OutputFile`s which share it write their
+/// internal buffers, and lets the syncs of other files take priority over
+/// those writes. Writes are scheduled one after another at the limited rate,
+/// so the limit holds for any number of concurrently written files.
+///
+/// This class is thread safe.
+class WriteThrottle {
+ public:
+  /// A limit of 0 bytes per second doesn't throttle the writes, and doesn't
+  /// let syncs take priority over them either.
+  explicit WriteThrottle(uint64_t bytes_per_second) : bytes_per_second_(bytes_per_second) {}
+
+  WriteThrottle(const WriteThrottle &) = delete;
+  WriteThrottle(WriteThrottle &&) = delete;
+  WriteThrottle &operator=(const WriteThrottle &) = delete;
+  WriteThrottle &operator=(WriteThrottle &&) = delete;
+
+  ~WriteThrottle() = default;
+
+  /// Blocks until `size` bytes can be written at the limited rate. While a
+  /// prioritized sync is in progress it also waits for the sync, but at most
+  /// `kMaxSyncWait`, so that a steady stream of syncs can't starve writes.
+  void Acquire(size_t size);
+
+  /// Marks the start and the end of a sync which takes priority over the
+  /// throttled writes.
+  void BeginPrioritySync();
+  void EndPrioritySync();
+
+  static constexpr std::chrono::milliseconds kMaxSyncWait{10};
+
+ private:
+  const uint64_t bytes_per_second_;
+  std::mutex mutex_;
+  std::condition_variable syncs_done_cv_;
+  uint64_t syncs_in_progress_{0};
+  std::chrono::steady_clock::time_point next_write_;
+};
+
 class OutputFile {
  public:
   enum class Mode {
@@ -235,6 +302,16 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Writes the internal buffer to the currently opened file without syncing
+  /// it. On failure and misuse it crashes the program.
+  void Flush();
+
+  /// Syncs the data which was already written to the currently opened file,
+  /// leaving the internal buffer as it is. Unlike the other methods it may be
+  /// called concurrently with `Write` and `Flush`, which lets another thread
+  /// wait for the sync. On failure and misuse it crashes the program.
+  void SyncWithoutFlushing();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -256,18 +333,60 @@ class OutputFile {
   /// Get the size of the file.
   size_t GetSize();
 
+  /// Get the size of the data already written to the file, without the data
+  /// in the internal buffer.
+  size_t GetWrittenSize();
+
+  /// Allocates disk space for the first `size` bytes of the currently opened
+  /// file without changing its size, so writes within them don't have to
+  /// allocate blocks. Returns `false` if the space couldn't be allocated, e.g.
+  /// because the file system doesn't support it. On misuse it crashes the
+  /// program.
+  bool Preallocate(size_t size);
+
+  /// Switches the currently opened file to direct I/O (`O_DIRECT`), which
+  /// writes the internal buffer to the device in whole blocks, bypassing the
+  /// page cache. The last partial block is padded with zeros and is written
+  /// again with the following data; `Close` truncates the padding. Afterwards
+  /// data can only be appended to the file. Returns `false` and keeps using
+  /// buffered I/O if the file system doesn't support direct I/O. On failure
+  /// and misuse it crashes the program.
+  bool EnableDirectIO();
+
+  /// Writes of the internal buffer wait for `throttle` from now on. `nullptr`
+  /// stops throttling them.
+  void SetWriteThrottle(WriteThrottle *throttle);
+
+  /// Syncs of the file take priority over the writes throttled by `throttle`
+  /// from now on, see `WriteThrottle::BeginPrioritySync`.
+  void SetSyncPriority(WriteThrottle *throttle);
+
  private:
   void FlushBuffer(bool force_flush);
   void FlushBufferInternal();
+  void FlushBufferDirect();
+
+  int FsyncFile();
 
   size_t SeekFile(Position position, ssize_t offset);
 
   int fd_{-1};
   size_t written_since_last_sync_{0};
   std::filesystem::path path_;
-  uint8_t buffer_[kFileBufferSize];
+  alignas(kDirectIOAlignment) uint8_t buffer_[kFileBufferSize];
   std::atomic<size_t> buffer_position_{0};
 
+  bool direct_io_{false};
+  // With direct I/O, the file offset of the start of the buffer, which is
+  // always aligned.
+  size_t direct_offset_{0};
+  // With direct I/O, the number of bytes at the start of the buffer which are
+  // already written to the file.
+  size_t direct_written_{0};
+
+  WriteThrottle *write_throttle_{nullptr};
+  WriteThrottle *sync_priority_throttle_{nullptr};
+
   // Flushing buffer should be a higher priority
   utils::RWLock flush_lock_{RWLock::Priority::WRITE};
 };
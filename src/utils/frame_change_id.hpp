@@ -18,10 +18,23 @@ namespace memgraph::utils {
 
 // Get ID by which FrameChangeCollector struct can cache in_list.expression2_
 inline std::optional<std::string> GetFrameChangeId(memgraph::query::InListOperator &in_list) {
-  if (in_list.expression2_->GetTypeInfo() == memgraph::query::ListLiteral::kType) {
+  // Lists which are the same for every row are cached by the address of their
+  // expression.
+  auto expression_id = [&in_list]() {
     std::stringstream ss;
     ss << static_cast<const void *>(in_list.expression2_);
     return ss.str();
+  };
+  if (in_list.expression2_->GetTypeInfo() == memgraph::query::ListLiteral::kType) {
+    if (!utils::Downcast<memgraph::query::ListLiteral>(in_list.expression2_)->is_constant_) return {};
+    return expression_id();
+  }
+  if (in_list.expression2_->GetTypeInfo() == memgraph::query::ParameterLookup::kType) {
+    return expression_id();
+  }
+  if (in_list.expression2_->GetTypeInfo() == memgraph::query::Function::kType) {
+    if (!utils::Downcast<memgraph::query::Function>(in_list.expression2_)->is_constant_) return {};
+    return expression_id();
   }
   if (in_list.expression2_->GetTypeInfo() == memgraph::query::Identifier::kType) {
     auto *identifier = utils::Downcast<memgraph::query::Identifier>(in_list.expression2_);
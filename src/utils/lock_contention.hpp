@@ -0,0 +1,136 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "utils/event_counter.hpp"
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::metrics {
+extern const Event LockSpins;
+}  // namespace memgraph::metrics
+
+namespace memgraph::utils {
+
+/// Waits of the current thread for locks held by other threads: the lock
+/// operations which had to wait, the iterations spent spinning and the time
+/// spent waiting. They only grow and are read by the query profiler. Nothing is
+/// counted when a lock is obtained without waiting.
+struct LockWaitCounters {
+  uint64_t contentions{0};
+  uint64_t spins{0};
+  uint64_t wait_ns{0};
+};
+
+inline thread_local LockWaitCounters lock_wait_counters;
+
+/// Counts a wait for a lock from its construction to its destruction in
+/// `lock_wait_counters` and in the `contentions` and `wait_ns` metrics, and
+/// the spins done meanwhile in the LockSpins metric. Made only when a lock has
+/// to be waited for, so the uncontended paths don't read the clock.
+class LockWaitTimer {
+ public:
+  LockWaitTimer(metrics::Event contentions, metrics::Event wait_ns)
+      : contentions_(contentions), wait_ns_(wait_ns), spins_(lock_wait_counters.spins) {}
+
+  LockWaitTimer(const LockWaitTimer &) = delete;
+  LockWaitTimer &operator=(const LockWaitTimer &) = delete;
+  LockWaitTimer(LockWaitTimer &&) = delete;
+  LockWaitTimer &operator=(LockWaitTimer &&) = delete;
+
+  ~LockWaitTimer() {
+    const auto waited = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+    ++lock_wait_counters.contentions;
+    lock_wait_counters.wait_ns += waited;
+    metrics::IncrementCounter(contentions_);
+    metrics::IncrementCounter(wait_ns_, waited);
+    if (const auto spins = lock_wait_counters.spins - spins_; spins > 0) {
+      metrics::IncrementCounter(metrics::LockSpins, spins);
+    }
+  }
+
+ private:
+  metrics::Event contentions_;
+  metrics::Event wait_ns_;
+  uint64_t spins_;
+  std::chrono::steady_clock::time_point start_{std::chrono::steady_clock::now()};
+};
+
+/// Keeps the keys, e.g. the gids of vertices, whose locks were waited for the
+/// longest in total, so that the hot objects can be told. At most `kCapacity`
+/// keys are kept. A new key replaces the one waited for the least and takes
+/// its wait over, so a hot key isn't pushed out by many cold ones. Only the
+/// waits are recorded, which keeps the table off the uncontended paths.
+class LockContentionTable {
+ public:
+  static constexpr size_t kCapacity = 16;
+
+  struct Entry {
+    uint64_t key;
+    uint64_t waits;
+    uint64_t wait_ns;
+  };
+
+  void Record(uint64_t key, uint64_t wait_ns) {
+    std::lock_guard guard(lock_);
+    auto *const end = entries_.begin() + size_;
+    if (auto *it = std::find_if(entries_.begin(), end, [key](const auto &entry) { return entry.key == key; });
+        it != end) {
+      ++it->waits;
+      it->wait_ns += wait_ns;
+      return;
+    }
+    if (size_ < kCapacity) {
+      entries_[size_++] = {key, 1, wait_ns};
+      return;
+    }
+    auto *least = std::min_element(entries_.begin(), end,
+                                   [](const auto &a, const auto &b) { return a.wait_ns < b.wait_ns; });
+    *least = {key, least->waits + 1, least->wait_ns + wait_ns};
+  }
+
+  /// Returns the recorded keys, the longest waited for first.
+  std::vector<Entry> Entries() const {
+    std::vector<Entry> entries;
+    {
+      std::lock_guard guard(lock_);
+      entries.assign(entries_.begin(), entries_.begin() + size_);
+    }
+    std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) { return a.wait_ns > b.wait_ns; });
+    return entries;
+  }
+
+ private:
+  mutable SpinLock lock_;
+  std::array<Entry, kCapacity> entries_{};
+  size_t size_{0};
+};
+
+/// Locks `guard`, a deferred lock guard, and records the wait under `key` in
+/// `table` if the lock had to be waited for.
+template <typename TGuard>
+void LockAndRecordContention(TGuard &guard, LockContentionTable &table, uint64_t key) {
+  const auto waited_before = lock_wait_counters.wait_ns;
+  guard.lock();
+  if (const auto waited = lock_wait_counters.wait_ns - waited_before; waited > 0) [[unlikely]] {
+    table.Record(key, waited);
+  }
+}
+
+}  // namespace memgraph::utils
@@ -12,6 +12,7 @@
 #include "utils/memory.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -258,6 +259,13 @@ void Pool::Release() {
 
 }  // namespace impl
 
+PoolResource::Stats &PoolResource::Stats::operator+=(const Stats &other) {
+  pooled += other.pooled;
+  unpooled += other.unpooled;
+  for (size_t i = 0; i < kSizeClasses; ++i) unpooled_by_size_class[i] += other.unpooled_by_size_class[i];
+  return *this;
+}
+
 PoolResource::PoolResource(size_t max_blocks_per_chunk, size_t max_block_size, MemoryResource *memory_pools,
                            MemoryResource *memory_unpooled)
     : pools_(memory_pools),
@@ -291,8 +299,11 @@ void *PoolResource::DoAllocate(size_t bytes, size_t alignment) {
       GetUpstreamResourceBlocks()->Deallocate(big_block.data, bytes, alignment);
       throw;
     }
+    ++stats_.unpooled;
+    ++stats_.unpooled_by_size_class[std::bit_width(block_size - 1)];
     return big_block.data;
   }
+  ++stats_.pooled;
   // Allocate a regular block, first check if last_alloc_pool_ is suitable.
   if (last_alloc_pool_ && last_alloc_pool_->GetBlockSize() == block_size) {
     return last_alloc_pool_->Allocate();
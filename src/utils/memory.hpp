@@ -15,7 +15,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <new>
@@ -459,9 +461,24 @@ class Pool final {
 ///   * Allocation requests which exceed the maximum block size will be
 ///     forwarded to upstream MemoryResource.
 ///   * Maximum block size and maximum number of blocks per chunk can be tuned
-///     by passing the arguments to the constructor.
+///     by passing the arguments to the constructor. The resource counts the
+///     allocations it served, so the arguments for the following resources
+///     serving the same work can be tuned by them.
 class PoolResource final : public MemoryResource {
  public:
+  /// Numbers of the allocations served by a PoolResource.
+  struct Stats {
+    static constexpr size_t kSizeClasses = 64;
+
+    uint64_t pooled{0};
+    uint64_t unpooled{0};
+    /// Allocations forwarded to the upstream memory by the power of two their
+    /// size rounds up to, i.e. the element `i` counts sizes in (2^(i-1), 2^i].
+    std::array<uint64_t, kSizeClasses> unpooled_by_size_class{};
+
+    Stats &operator+=(const Stats &other);
+  };
+
   /// Construct with given max_blocks_per_chunk, max_block_size and upstream
   /// memory.
   ///
@@ -486,6 +503,13 @@ class PoolResource final : public MemoryResource {
   /// Release all allocated memory.
   void Release();
 
+  size_t GetMaxBlocksPerChunk() const { return max_blocks_per_chunk_; }
+  size_t GetMaxBlockSize() const { return max_block_size_; }
+
+  /// Numbers of the allocations served since the construction. They aren't
+  /// reset by `Release`.
+  const Stats &GetStats() const { return stats_; }
+
  private:
   // Big block larger than max_block_size_, doesn't go into a pool.
   struct BigBlock {
@@ -507,6 +531,7 @@ class PoolResource final : public MemoryResource {
   impl::AVector<BigBlock> unpooled_;
   size_t max_blocks_per_chunk_;
   size_t max_block_size_;
+  Stats stats_;
 
   void *DoAllocate(size_t bytes, size_t alignment) override;
 
@@ -587,4 +612,60 @@ class ResourceWithOutOfMemoryException : public MemoryResource {
 
   MemoryResource *upstream_{utils::NewDeleteResource()};
 };
+
+// Counts the memory allocated from the upstream resource in a memory tracker,
+// so that the allocations of a group of users (e.g. the queries of a database)
+// are limited by the hard limit of the tracker. Exceeding the limit throws an
+// OutOfMemoryException.
+class TrackingMemoryResource final : public MemoryResource {
+ public:
+  TrackingMemoryResource(MemoryTracker *tracker, MemoryResource *upstream) : tracker_{tracker}, upstream_{upstream} {}
+
+ private:
+  void *DoAllocate(size_t bytes, size_t alignment) override {
+    {
+      MemoryTracker::OutOfMemoryExceptionEnabler exception_enabler;
+      tracker_->Alloc(static_cast<int64_t>(bytes));
+    }
+    try {
+      return upstream_->Allocate(bytes, alignment);
+    } catch (...) {
+      tracker_->Free(static_cast<int64_t>(bytes));
+      throw;
+    }
+  }
+
+  void DoDeallocate(void *p, size_t bytes, size_t alignment) override {
+    upstream_->Deallocate(p, bytes, alignment);
+    tracker_->Free(static_cast<int64_t>(bytes));
+  }
+
+  bool DoIsEqual(const utils::MemoryResource &other) const noexcept override { return this == &other; }
+
+  MemoryTracker *tracker_;
+  MemoryResource *upstream_;
+};
+
+// Adds the bytes allocated from the upstream resource to a counter, which the
+// query profiler reads to attribute the allocations to the operators.
+// Deallocations aren't subtracted.
+class CountingMemoryResource final : public MemoryResource {
+ public:
+  CountingMemoryResource(uint64_t *allocated_bytes, MemoryResource *upstream)
+      : allocated_bytes_{allocated_bytes}, upstream_{upstream} {}
+
+ private:
+  void *DoAllocate(size_t bytes, size_t alignment) override {
+    auto *ptr = upstream_->Allocate(bytes, alignment);
+    *allocated_bytes_ += bytes;
+    return ptr;
+  }
+
+  void DoDeallocate(void *p, size_t bytes, size_t alignment) override { upstream_->Deallocate(p, bytes, alignment); }
+
+  bool DoIsEqual(const utils::MemoryResource &other) const noexcept override { return this == &other; }
+
+  uint64_t *allocated_bytes_;
+  MemoryResource *upstream_;
+};
 }  // namespace memgraph::utils
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <exception>
 #include <stdexcept>
+#include <utility>
 
 #include "utils/likely.hpp"
 #include "utils/logging.hpp"
@@ -30,6 +31,23 @@ bool MemoryTrackerCanThrow() {
          !MemoryTracker::OutOfMemoryExceptionBlocker::IsBlocked();
 }
 
+// Tracker of the innermost ThreadTrackerScope of the thread and the amount
+// which the thread allocated for it, but didn't charge to it yet.
+thread_local MemoryTracker *thread_tracker = nullptr;
+thread_local int64_t thread_untracked = 0;
+
+void FlushThreadUntracked() {
+  const auto amount = std::exchange(thread_untracked, 0);
+  if (thread_tracker == nullptr) return;
+  if (amount > 0) {
+    // The memory is already allocated so there is nothing to fail anymore.
+    MemoryTracker::OutOfMemoryExceptionBlocker exception_blocker;
+    thread_tracker->Alloc(amount);
+  } else if (amount < 0) {
+    thread_tracker->Free(-amount);
+  }
+}
+
 }  // namespace
 
 thread_local uint64_t MemoryTracker::OutOfMemoryExceptionEnabler::counter_ = 0;
@@ -42,8 +60,79 @@ MemoryTracker::OutOfMemoryExceptionBlocker::OutOfMemoryExceptionBlocker() { ++co
 MemoryTracker::OutOfMemoryExceptionBlocker::~OutOfMemoryExceptionBlocker() { --counter_; }
 bool MemoryTracker::OutOfMemoryExceptionBlocker::IsBlocked() { return counter_ > 0; }
 
+MemoryTracker::ThreadTrackerScope::ThreadTrackerScope(MemoryTracker *tracker) : previous_(thread_tracker) {
+  FlushThreadUntracked();
+  thread_tracker = tracker;
+}
+
+MemoryTracker::ThreadTrackerScope::~ThreadTrackerScope() {
+  FlushThreadUntracked();
+  thread_tracker = previous_;
+}
+
 MemoryTracker total_memory_tracker;
 
+namespace {
+
+// Amount which the thread allocated, but didn't charge to the global tracker
+// yet. The thread can still allocate and free after the object is destroyed,
+// which is then charged right away.
+struct ThreadTotalUntracked {
+  int64_t amount{0};
+  bool exited{false};
+
+  ~ThreadTotalUntracked() {
+    exited = true;
+    const auto remaining = std::exchange(amount, 0);
+    if (remaining > 0) {
+      MemoryTracker::OutOfMemoryExceptionBlocker exception_blocker;
+      total_memory_tracker.Alloc(remaining);
+    } else {
+      total_memory_tracker.Free(-remaining);
+    }
+  }
+};
+
+thread_local ThreadTotalUntracked thread_total_untracked;
+
+}  // namespace
+
+void TrackTotalAlloc(const int64_t size) {
+  auto &untracked = thread_total_untracked;
+  if (untracked.exited) [[unlikely]] {
+    total_memory_tracker.Alloc(size);
+    return;
+  }
+  untracked.amount += size;
+  if (untracked.amount < kTotalMemoryBatchSize) [[likely]] {
+    return;
+  }
+  const auto amount = std::exchange(untracked.amount, 0);
+  try {
+    total_memory_tracker.Alloc(amount);
+  } catch (...) {
+    untracked.amount += amount - size;
+    throw;
+  }
+}
+
+void TrackTotalFree(const int64_t size) {
+  auto &untracked = thread_total_untracked;
+  if (untracked.exited) [[unlikely]] {
+    total_memory_tracker.Free(size);
+    return;
+  }
+  untracked.amount -= size;
+  if (untracked.amount > -kTotalMemoryBatchSize) [[likely]] {
+    return;
+  }
+  total_memory_tracker.Free(-std::exchange(untracked.amount, 0));
+}
+
+MemoryTracker::~MemoryTracker() {
+  if (parent_ != nullptr) parent_->Free(Amount());
+}
+
 // TODO (antonio2368): Define how should the peak memory be logged.
 // Logging every time the peak changes is too much so some kind of distribution
 // should be used.
@@ -115,9 +204,51 @@ void MemoryTracker::Alloc(const int64_t size) {
                     GetReadableSize(size), GetReadableSize(will_be), GetReadableSize(current_hard_limit)));
   }
 
+  if (parent_ != nullptr) {
+    try {
+      parent_->Alloc(size);
+    } catch (...) {
+      amount_.fetch_sub(size, std::memory_order_relaxed);
+      throw;
+    }
+  }
+
   UpdatePeak(will_be);
 }
 
-void MemoryTracker::Free(const int64_t size) { amount_.fetch_sub(size, std::memory_order_relaxed); }
+void MemoryTracker::Free(const int64_t size) {
+  amount_.fetch_sub(size, std::memory_order_relaxed);
+  if (parent_ != nullptr) parent_->Free(size);
+}
+
+void MemoryTracker::ThreadAlloc(const int64_t size) {
+  auto *tracker = thread_tracker;
+  if (tracker == nullptr) [[likely]] {
+    return;
+  }
+  thread_untracked += size;
+  if (thread_untracked < kThreadBatchSize) [[likely]] {
+    return;
+  }
+  const auto amount = std::exchange(thread_untracked, 0);
+  try {
+    tracker->Alloc(amount);
+  } catch (...) {
+    // The allocation which failed won't happen, the rest of the batch did.
+    thread_untracked += amount - size;
+    throw;
+  }
+}
+
+void MemoryTracker::ThreadFree(const int64_t size) {
+  if (thread_tracker == nullptr) [[likely]] {
+    return;
+  }
+  thread_untracked -= size;
+  if (thread_untracked > -kThreadBatchSize) [[likely]] {
+    return;
+  }
+  thread_tracker->Free(-std::exchange(thread_untracked, 0));
+}
 
 }  // namespace memgraph::utils
@@ -29,6 +29,9 @@ class MemoryTracker final {
   std::atomic<int64_t> hard_limit_{0};
   // Maximum possible value of a hard limit. If it's set to 0, no upper bound on the hard limit is set.
   int64_t maximum_hard_limit_{0};
+  // Tracker which is also charged with everything charged to this one, so
+  // that its limit applies to the sum of its children.
+  MemoryTracker *parent_{nullptr};
 
   void UpdatePeak(int64_t will_be);
 
@@ -38,16 +41,26 @@ class MemoryTracker final {
   void LogPeakMemoryUsage() const;
 
   MemoryTracker() = default;
-  ~MemoryTracker() = default;
+  explicit MemoryTracker(MemoryTracker *parent) : parent_(parent) {}
+  // Returns the amount which is still charged to the tracker to its parents.
+  ~MemoryTracker();
 
   MemoryTracker(const MemoryTracker &) = delete;
   MemoryTracker &operator=(const MemoryTracker &) = delete;
   MemoryTracker(MemoryTracker &&) = delete;
   MemoryTracker &operator=(MemoryTracker &&) = delete;
 
+  // Charges the tracker and its parents, throwing if that goes over the limit
+  // of any of them. Nothing is charged if it throws.
   void Alloc(int64_t size);
   void Free(int64_t size);
 
+  // Allocations and frees of the calling thread reported by the global
+  // operators new and delete. They are charged to the tracker set by the
+  // innermost ThreadTrackerScope of the thread, if any.
+  static void ThreadAlloc(int64_t size);
+  static void ThreadFree(int64_t size);
+
   auto Amount() const { return amount_.load(std::memory_order_relaxed); }
 
   auto Peak() const { return peak_.load(std::memory_order_relaxed); }
@@ -58,6 +71,27 @@ class MemoryTracker final {
   void TryRaiseHardLimit(int64_t limit);
   void SetMaximumHardLimit(int64_t limit);
 
+  // Charges the memory which the calling thread allocates and frees in the
+  // scope of the object to the given tracker, or to none if it's nullptr. The
+  // thread accumulates the amounts locally and charges them in batches of
+  // kThreadBatchSize, so the limit of the tracker is enforced with that
+  // granularity. The remainder is charged when the scope ends.
+  class ThreadTrackerScope final {
+   public:
+    explicit ThreadTrackerScope(MemoryTracker *tracker);
+    ~ThreadTrackerScope();
+
+    ThreadTrackerScope(const ThreadTrackerScope &) = delete;
+    ThreadTrackerScope &operator=(const ThreadTrackerScope &) = delete;
+    ThreadTrackerScope(ThreadTrackerScope &&) = delete;
+    ThreadTrackerScope &operator=(ThreadTrackerScope &&) = delete;
+
+   private:
+    MemoryTracker *previous_;
+  };
+
+  static constexpr int64_t kThreadBatchSize = 1024L * 1024L;
+
   // By creating an object of this class, every allocation in its scope that goes over
   // the set hard limit produces an OutOfMemoryException.
   class OutOfMemoryExceptionEnabler final {
@@ -98,4 +132,15 @@ class MemoryTracker final {
 
 // Global memory tracker which tracks every allocation in the application.
 extern MemoryTracker total_memory_tracker;
+
+// Amount which a thread allocates or frees before charging it to
+// `total_memory_tracker`. Smaller allocations only update a counter of the
+// thread, so the global limit is enforced with this granularity per thread.
+inline constexpr int64_t kTotalMemoryBatchSize = 256L * 1024L;
+
+// Charge the allocations and frees of the calling thread to
+// `total_memory_tracker` in batches of `kTotalMemoryBatchSize`. The rest is
+// charged when the thread exits.
+void TrackTotalAlloc(int64_t size);
+void TrackTotalFree(int64_t size);
 }  // namespace memgraph::utils
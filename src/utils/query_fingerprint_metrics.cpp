@@ -0,0 +1,80 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/query_fingerprint_metrics.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+namespace memgraph::metrics {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+QueryFingerprints global_query_fingerprints{0};
+
+void QueryFingerprints::SetCapacity(size_t capacity) {
+  std::unique_lock guard(lock_);
+  capacity_.store(capacity, std::memory_order_relaxed);
+  while (fingerprints_.size() > capacity) EvictOne();
+}
+
+std::shared_ptr<QueryFingerprintMetrics> QueryFingerprints::Execute(uint64_t hash) {
+  if (capacity_.load(std::memory_order_relaxed) == 0) return nullptr;
+  {
+    std::shared_lock guard(lock_);
+    if (auto it = fingerprints_.find(hash); it != fingerprints_.end()) {
+      it->second->executions.fetch_add(1, std::memory_order_relaxed);
+      return it->second;
+    }
+  }
+
+  std::unique_lock guard(lock_);
+  if (auto it = fingerprints_.find(hash); it != fingerprints_.end()) {
+    it->second->executions.fetch_add(1, std::memory_order_relaxed);
+    return it->second;
+  }
+  const auto capacity = capacity_.load(std::memory_order_relaxed);
+  if (capacity == 0) return nullptr;
+  uint64_t executions = 1;
+  if (fingerprints_.size() >= capacity) {
+    // The new fingerprint may have been executed before, while it wasn't
+    // tracked, at most as many times as the least executed one.
+    executions += EvictOne();
+  }
+  auto metrics = std::make_shared<QueryFingerprintMetrics>(hash, executions);
+  fingerprints_.emplace(hash, metrics);
+  return metrics;
+}
+
+std::vector<std::shared_ptr<const QueryFingerprintMetrics>> QueryFingerprints::Tracked() const {
+  std::vector<std::shared_ptr<const QueryFingerprintMetrics>> tracked;
+  {
+    std::shared_lock guard(lock_);
+    tracked.reserve(fingerprints_.size());
+    for (const auto &[hash, metrics] : fingerprints_) tracked.emplace_back(metrics);
+  }
+  std::sort(tracked.begin(), tracked.end(), [](const auto &a, const auto &b) {
+    return a->executions.load(std::memory_order_relaxed) > b->executions.load(std::memory_order_relaxed);
+  });
+  return tracked;
+}
+
+uint64_t QueryFingerprints::EvictOne() {
+  const auto least = std::min_element(fingerprints_.begin(), fingerprints_.end(), [](const auto &a, const auto &b) {
+    return a.second->executions.load(std::memory_order_relaxed) < b.second->executions.load(std::memory_order_relaxed);
+  });
+  if (least == fingerprints_.end()) return 0;
+  const auto executions = least->second->executions.load(std::memory_order_relaxed);
+  fingerprints_.erase(least);
+  return executions;
+}
+
+}  // namespace memgraph::metrics
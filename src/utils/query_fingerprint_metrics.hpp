@@ -0,0 +1,79 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/event_histogram.hpp"
+#include "utils/rw_spin_lock.hpp"
+
+namespace memgraph::metrics {
+
+/// Latency histogram and counters of the queries with the same fingerprint,
+/// the hash of the stripped query.
+struct QueryFingerprintMetrics {
+  QueryFingerprintMetrics(uint64_t hash, uint64_t executions) : hash(hash), executions(executions) {}
+
+  const uint64_t hash;
+  /// How many times the fingerprint was executed. Once the fingerprint
+  /// replaces an evicted one, this overestimates the count by at most the
+  /// count of the evicted fingerprint.
+  std::atomic<uint64_t> executions;
+  Histogram latency_us{{50, 90, 99}};
+  std::atomic<uint64_t> rows{0};
+  std::atomic<uint64_t> plan_cache_hits{0};
+  std::atomic<uint64_t> plan_cache_misses{0};
+  std::atomic<uint64_t> serialization_conflicts{0};
+};
+
+/// Keeps the metrics of the most frequently executed query fingerprints. At
+/// most `capacity` fingerprints are tracked, so the number of the exported
+/// metrics is bounded. When a new fingerprint comes and there's no room, it
+/// replaces the one with the fewest executions, as in the Space-Saving
+/// algorithm, so the frequent fingerprints stay tracked. Each tracked
+/// fingerprint takes about 32 KiB for its histogram. The functions are
+/// thread-safe.
+class QueryFingerprints {
+ public:
+  explicit QueryFingerprints(size_t capacity) : capacity_(capacity) {}
+
+  /// Fingerprints are tracked only while the capacity is above 0. Lowering
+  /// the capacity evicts the least executed fingerprints.
+  void SetCapacity(size_t capacity);
+
+  /// Counts an execution of the fingerprint and returns its metrics, or
+  /// nullptr if the fingerprints aren't tracked. The returned metrics stay
+  /// valid after the fingerprint is evicted, they just aren't exported
+  /// anymore.
+  std::shared_ptr<QueryFingerprintMetrics> Execute(uint64_t hash);
+
+  /// Returns the metrics of the tracked fingerprints, the most executed
+  /// first.
+  std::vector<std::shared_ptr<const QueryFingerprintMetrics>> Tracked() const;
+
+ private:
+  // Removes the least executed fingerprint and returns its executions.
+  uint64_t EvictOne();
+
+  std::atomic<size_t> capacity_;
+  mutable utils::RWSpinLock lock_;
+  std::unordered_map<uint64_t, std::shared_ptr<QueryFingerprintMetrics>> fingerprints_;
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern QueryFingerprints global_query_fingerprints;
+
+}  // namespace memgraph::metrics
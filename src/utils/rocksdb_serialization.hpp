@@ -16,6 +16,7 @@
 #include <iomanip>
 #include <iterator>
 #include <numeric>
+#include <span>
 #include <string>
 
 #include "storage/v2/edge_accessor.hpp"
@@ -139,7 +140,7 @@ inline std::string PutIndexingLabelAndPropertiesFirst(const std::string &target_
 }
 
 inline std::string SerializeVertexAsValueForAuxiliaryStorages(storage::LabelId label_to_remove,
-                                                              const std::vector<storage::LabelId> &vertex_labels,
+                                                              std::span<const storage::LabelId> vertex_labels,
                                                               const storage::PropertyStore &property_store) {
   std::vector<storage::LabelId> labels_without_target;
   labels_without_target.reserve(vertex_labels.size());
@@ -199,7 +200,7 @@ inline std::string SerializeVertexAsKeyForUniqueConstraint(const storage::LabelI
 }
 
 inline std::string SerializeVertexAsValueForUniqueConstraint(const storage::LabelId &constraint_label,
-                                                             const std::vector<storage::LabelId> &vertex_labels,
+                                                             std::span<const storage::LabelId> vertex_labels,
                                                              const storage::PropertyStore &property_store) {
   return SerializeVertexAsValueForAuxiliaryStorages(constraint_label, vertex_labels, property_store);
 }
@@ -232,7 +233,7 @@ inline std::string SerializeVertexAsKeyForLabelIndex(storage::LabelId label, sto
 inline std::string ExtractGidFromLabelIndexStorage(const std::string &key) { return ExtractGidFromKey(key); }
 
 inline std::string SerializeVertexAsValueForLabelIndex(storage::LabelId indexing_label,
-                                                       const std::vector<storage::LabelId> &vertex_labels,
+                                                       std::span<const storage::LabelId> vertex_labels,
                                                        const storage::PropertyStore &property_store) {
   return SerializeVertexAsValueForAuxiliaryStorages(indexing_label, vertex_labels, property_store);
 }
@@ -268,7 +269,7 @@ inline std::string SerializeVertexAsKeyForLabelPropertyIndex(storage::LabelId la
 }
 
 inline std::string SerializeVertexAsValueForLabelPropertyIndex(storage::LabelId indexing_label,
-                                                               const std::vector<storage::LabelId> &vertex_labels,
+                                                               std::span<const storage::LabelId> vertex_labels,
                                                                const storage::PropertyStore &property_store) {
   return SerializeVertexAsValueForAuxiliaryStorages(indexing_label, vertex_labels, property_store);
 }
@@ -14,8 +14,17 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <optional>
+
+#include "utils/lock_contention.hpp"
+
+namespace memgraph::metrics {
+extern const Event RWSpinLockContentions;
+extern const Event RWSpinLockWait_ns;
+}  // namespace memgraph::metrics
 
 namespace memgraph::utils {
+
 namespace {
 /// A helper for RWSpinLock, allows a contended spin lock to yield to another thread.
 struct yeilder {
@@ -25,6 +34,7 @@ struct yeilder {
     __builtin_ia32_pause();
 #endif
     ++count;
+    ++lock_wait_counters.spins;
     if (count > 8) [[unlikely]] {
       count = 0;
       nanosleep(&shortpause, nullptr);
@@ -52,6 +62,7 @@ struct RWSpinLock {
   RWSpinLock() = default;
 
   void lock() {
+    std::optional<LockWaitTimer> wait;
     // spin: to grant the UNIQUE_LOCKED bit
     while (true) {
       // optimistic: assume we will be granted the lock
@@ -59,6 +70,7 @@ struct RWSpinLock {
       // check: we were granted UNIQUE_LOCK and no current readers
       if (phase1 == 0) [[likely]]
         return;
+      if (!wait) wait.emplace(metrics::RWSpinLockContentions, metrics::RWSpinLockWait_ns);
       // check: we were granted UNIQUE_LOCK, but need to wait for readers
       if ((phase1 & UNIQUE_LOCKED) != UNIQUE_LOCKED) [[likely]]
         break;
@@ -77,7 +89,8 @@ struct RWSpinLock {
     // spin: to wait for readers to leave
     auto maybe_yield = yeilder{};
     while (true) {
-      auto const phase3 = std::atomic_ref{lock_status_}.load(std::memory_order_relaxed);
+      // acquire: synchronizes with the unlock_shared of the leaving readers
+      auto const phase3 = std::atomic_ref{lock_status_}.load(std::memory_order_acquire);
       // check: all readers have gone (leaving only the UNIQUE_LOCKED bit set)
       if (phase3 == UNIQUE_LOCKED) return;
       maybe_yield();
@@ -87,6 +100,7 @@ struct RWSpinLock {
   void unlock() { std::atomic_ref{lock_status_}.fetch_and(~UNIQUE_LOCKED, std::memory_order_release); }
 
   void lock_shared() {
+    std::optional<LockWaitTimer> wait;
     while (true) {
       // optimistic: assume we will be granted the lock
       auto const phase1 = std::atomic_ref{lock_status_}.fetch_add(READER, std::memory_order_acquire);
@@ -95,6 +109,7 @@ struct RWSpinLock {
         return;
       // correct for our optimism, we shouldn't have modified the reader count
       std::atomic_ref{lock_status_}.fetch_sub(READER, std::memory_order_release);
+      if (!wait) wait.emplace(metrics::RWSpinLockContentions, metrics::RWSpinLockWait_ns);
 
       // spin: to wait for UNIQUE_LOCKED to be available
       auto maybe_yield = yeilder{};
@@ -0,0 +1,145 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+
+#include "utils/lock_contention.hpp"
+
+namespace memgraph::metrics {
+extern const Event ScalableRWLockContentions;
+extern const Event ScalableRWLockWait_ns;
+}  // namespace memgraph::metrics
+
+namespace memgraph::utils {
+
+/// A reader-writer lock for data which is locked shared very often and
+/// exclusively rarely. The readers are counted in several slots on separate
+/// cache lines, and each thread uses its own slot, so readers on different
+/// cores don't write to the same cache line. Locking exclusively is more
+/// expensive because it has to check every slot.
+///
+/// Writers are preferred: once a writer waits for the lock, new readers wait
+/// until it releases it. The lock isn't recursive.
+///
+/// A shared lock may be released by a thread different from the one which
+/// obtained it. The slot counters may then go negative, but their sum is still
+/// the number of readers holding the lock.
+class ScalableRWLock final {
+ public:
+  ScalableRWLock() = default;
+  ScalableRWLock(const ScalableRWLock &) = delete;
+  ScalableRWLock &operator=(const ScalableRWLock &) = delete;
+  ScalableRWLock(ScalableRWLock &&) = delete;
+  ScalableRWLock &operator=(ScalableRWLock &&) = delete;
+  ~ScalableRWLock() = default;
+
+  void lock() {
+    std::optional<LockWaitTimer> wait;
+    if (!writer_mutex_.try_lock()) {
+      wait.emplace(metrics::ScalableRWLockContentions, metrics::ScalableRWLockWait_ns);
+      writer_mutex_.lock();
+    }
+    writer_.store(true, std::memory_order_seq_cst);
+    while (true) {
+      // Read before checking the readers so that no departure is missed.
+      const auto departures = departures_.load(std::memory_order_seq_cst);
+      if (Readers() == 0) return;
+      if (!wait) wait.emplace(metrics::ScalableRWLockContentions, metrics::ScalableRWLockWait_ns);
+      departures_.wait(departures, std::memory_order_seq_cst);
+    }
+  }
+
+  bool try_lock() {
+    if (!writer_mutex_.try_lock()) return false;
+    writer_.store(true, std::memory_order_seq_cst);
+    if (Readers() == 0) return true;
+    unlock();
+    return false;
+  }
+
+  void unlock() {
+    writer_.store(false, std::memory_order_seq_cst);
+    writer_.notify_all();
+    writer_mutex_.unlock();
+  }
+
+  void lock_shared() {
+    auto &readers = slots_[ThreadSlot()].readers;
+    std::optional<LockWaitTimer> wait;
+    while (true) {
+      readers.fetch_add(1, std::memory_order_seq_cst);
+      if (!writer_.load(std::memory_order_seq_cst)) [[likely]] {
+        return;
+      }
+      Depart(readers);
+      if (!wait) wait.emplace(metrics::ScalableRWLockContentions, metrics::ScalableRWLockWait_ns);
+      writer_.wait(true, std::memory_order_seq_cst);
+    }
+  }
+
+  bool try_lock_shared() {
+    auto &readers = slots_[ThreadSlot()].readers;
+    readers.fetch_add(1, std::memory_order_seq_cst);
+    if (!writer_.load(std::memory_order_seq_cst)) [[likely]] {
+      return true;
+    }
+    Depart(readers);
+    return false;
+  }
+
+  void unlock_shared() { Depart(slots_[ThreadSlot()].readers); }
+
+ private:
+  static constexpr size_t kSlots = 128;
+
+  struct alignas(64) Slot {
+    std::atomic<int64_t> readers{0};
+  };
+
+  static size_t ThreadSlot() {
+    static std::atomic<size_t> next_slot{0};
+    static thread_local const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kSlots;
+    return slot;
+  }
+
+  int64_t Readers() const {
+    int64_t readers = 0;
+    for (const auto &slot : slots_) {
+      readers += slot.readers.load(std::memory_order_seq_cst);
+    }
+    return readers;
+  }
+
+  // Removes a reader from the slot and wakes up the writer waiting for the
+  // readers to leave, if there is one.
+  void Depart(std::atomic<int64_t> &readers) {
+    readers.fetch_sub(1, std::memory_order_seq_cst);
+    if (writer_.load(std::memory_order_seq_cst)) [[unlikely]] {
+      departures_.fetch_add(1, std::memory_order_seq_cst);
+      departures_.notify_all();
+    }
+  }
+
+  std::array<Slot, kSlots> slots_;
+  alignas(64) std::atomic<bool> writer_{false};
+  std::atomic<uint64_t> departures_{0};
+  // Serializes the writers.
+  std::mutex writer_mutex_;
+};
+
+}  // namespace memgraph::utils
@@ -11,15 +11,20 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <deque>
+#include <iterator>
 #include <limits>
 #include <mutex>
 #include <optional>
 #include <random>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "spdlog/spdlog.h"
 #include "utils/bound.hpp"
@@ -30,7 +35,6 @@
 #include "utils/on_scope_exit.hpp"
 #include "utils/readable_size.hpp"
 #include "utils/spin_lock.hpp"
-#include "utils/stack.hpp"
 #include "utils/stat.hpp"
 
 // This code heavily depends on atomic operations. For a more detailed
@@ -63,12 +67,19 @@ constexpr uint64_t kSkipListGcHeightTrigger = 16;
 /// elements.
 constexpr int kSkipListCountEstimateDefaultLayer = 10;
 
-/// These variables define the storage sizes for the SkipListGc. The internal
-/// storage of the GC and the Stack storage used within the GC are all
-/// optimized to have block sizes that are a whole multiple of the memory page
-/// size.
+/// This variable defines the storage size for the SkipListGc. The internal
+/// storage of the GC is optimized to have block sizes that are a whole multiple
+/// of the memory page size.
 constexpr uint64_t kSkipListGcBlockSize = 8189;
-constexpr uint64_t kSkipListGcStackSize = 8191;
+
+/// The garbage collection is also triggered each time this many nodes are
+/// removed from the list, so the memory of removed nodes is reclaimed
+/// continuously instead of only when the storage GC runs.
+constexpr uint64_t kSkipListGcCollectInterval = 4096;
+
+/// The number of removed nodes that the garbage collection takes from the
+/// queue of removed nodes at once and frees without holding its lock.
+constexpr uint64_t kSkipListGcFreeBatchSize = 256;
 
 namespace detail {
 struct SkipListNode_base {
@@ -197,12 +208,17 @@ constexpr uint64_t SkipListLayerForAverageEqualsEstimation(const uint64_t N) {
 /// collection is blocking is when the structure of the doubly-linked list has
 /// to be changed (eg. a new Block has to be allocated and linked into the
 /// structure).
+///
+/// The removed nodes are queued in the order of removal, which is also the
+/// order of the accessor IDs they wait for, so the collection only visits the
+/// nodes it frees. It frees them in batches outside of the lock of the queue,
+/// so removals aren't blocked while a large number of nodes is freed.
 template <typename TObj>
 class SkipListGc final {
  private:
   using TNode = SkipListNode<TObj>;
   using TDeleted = std::pair<uint64_t, TNode *>;
-  using TStack = Stack<TDeleted, kSkipListGcStackSize>;
+  using TDeletedQueue = std::deque<TDeleted, Allocator<TDeleted>>;
 
   static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
   static constexpr uint64_t kIdsInBlock = kSkipListGcBlockSize * kIdsInField;
@@ -242,7 +258,7 @@ class SkipListGc final {
   }
 
  public:
-  explicit SkipListGc(MemoryResource *memory) : memory_(memory) {
+  explicit SkipListGc(MemoryResource *memory) : memory_(memory), deleted_(memory) {
     static_assert(sizeof(Block) % kLinuxPageSize == 0,
                   "It is recommended that you set the kSkipListGcBlockSize "
                   "constant so that the size of SkipListGc::Block is a "
@@ -298,8 +314,14 @@ class SkipListGc final {
   }
 
   void Collect(TNode *node) {
-    std::unique_lock guard(lock_);
-    deleted_.Push({accessor_id_.load(std::memory_order_acquire), node});
+    bool run = false;
+    {
+      std::lock_guard guard(deleted_lock_);
+      // The ID is read under the lock, so the queue is ordered by it.
+      deleted_.emplace_back(accessor_id_.load(std::memory_order_acquire), node);
+      run = deleted_.size() % kSkipListGcCollectInterval == 0;
+    }
+    if (run) Run();
   }
 
   void Run() {
@@ -354,19 +376,22 @@ class SkipListGc final {
       }
       tail = next;
     }
-    TStack leftover;
-    std::optional<TDeleted> item;
-    while ((item = deleted_.Pop())) {
-      if (item->first < last_dead) {
-        size_t bytes = SkipListNodeSize(*item->second);
-        item->second->~TNode();
-        memory_->Deallocate(item->second, bytes);
-      } else {
-        leftover.Push(*item);
+    TNode *batch[kSkipListGcFreeBatchSize];
+    uint64_t count = kSkipListGcFreeBatchSize;
+    while (count == kSkipListGcFreeBatchSize) {
+      count = 0;
+      {
+        std::lock_guard guard(deleted_lock_);
+        while (count < kSkipListGcFreeBatchSize && !deleted_.empty() && deleted_.front().first < last_dead) {
+          batch[count++] = deleted_.front().second;
+          deleted_.pop_front();
+        }
+      }
+      for (uint64_t i = 0; i < count; ++i) {
+        size_t bytes = SkipListNodeSize(*batch[i]);
+        batch[i]->~TNode();
+        memory_->Deallocate(batch[i], bytes);
       }
-    }
-    while ((item = leftover.Pop())) {
-      deleted_.Push(*item);
     }
   }
 
@@ -384,12 +409,12 @@ class SkipListGc final {
     }
 
     // Delete all items that have to be garbage collected.
-    std::optional<TDeleted> item;
-    while ((item = deleted_.Pop())) {
-      size_t bytes = SkipListNodeSize(*item->second);
-      item->second->~TNode();
-      memory_->Deallocate(item->second, bytes);
+    for (auto [_, node] : deleted_) {
+      size_t bytes = SkipListNodeSize(*node);
+      node->~TNode();
+      memory_->Deallocate(node, bytes);
     }
+    deleted_.clear();
 
     // Reset all variables.
     accessor_id_ = 0;
@@ -405,7 +430,8 @@ class SkipListGc final {
   std::atomic<Block *> head_{nullptr};
   std::atomic<Block *> tail_{nullptr};
   uint64_t last_id_{0};
-  TStack deleted_;
+  SpinLock deleted_lock_;
+  TDeletedQueue deleted_;
 #ifndef NDEBUG
   std::atomic<uint64_t> alive_accessors_{0};
 #endif
@@ -646,6 +672,17 @@ class SkipList final : detail::SkipListNode_base {
     TNode *node_;
   };
 
+  /// The nodes preceding the position of the last object inserted with the
+  /// finger, in each layer. The search for the position of the next object
+  /// starts from them instead of from the head, so inserting objects in
+  /// ascending order only walks past the nodes between consecutive objects.
+  class Finger final {
+   private:
+    friend class SkipList;
+
+    TNode *nodes_[kSkipListMaxHeight]{};
+  };
+
   class Accessor final {
    private:
     friend class SkipList;
@@ -690,6 +727,19 @@ class SkipList final : detail::SkipListNode_base {
     ///         bool indicates whether the item was inserted into the list
     std::pair<Iterator, bool> insert(TObj &&object) { return skiplist_->insert(std::move(object)); }
 
+    std::pair<Iterator, bool> insert(Finger &finger, const TObj &object) {
+      return skiplist_->insert(object, finger.nodes_);
+    }
+
+    /// Inserts an object into the list like `insert`, but searches for its
+    /// position from the finger, which is then moved to the object. It's
+    /// meant for inserting objects in ascending order, e.g. during recovery.
+    /// The finger must only be used with a single accessor, because the nodes
+    /// it points to may be freed once the accessor is destroyed.
+    std::pair<Iterator, bool> insert(Finger &finger, TObj &&object) {
+      return skiplist_->insert(std::move(object), finger.nodes_);
+    }
+
     /// Checks whether the key exists in the list.
     ///
     /// @return bool indicating whether the item exists
@@ -762,6 +812,16 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->template estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Splits the list into at most `num_parts` parts of about the same size.
+    /// The split points are sampled from an upper layer of the list, so the
+    /// sizes of the parts are only estimated. A part starts at its split point
+    /// and ends before the next one. The split points may be removed from the
+    /// list concurrently, the iterators to them remain usable while the
+    /// accessor is alive.
+    ///
+    /// @return the starts of all parts except the first one, in order
+    std::vector<Iterator> split(uint64_t num_parts) const { return skiplist_->split(num_parts); }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -866,6 +926,28 @@ class SkipList final : detail::SkipListNode_base {
     new (&head_->lock) utils::SpinLock();
   }
 
+  /// Builds the list from a range of objects sorted in ascending order without
+  /// duplicates. The nodes are appended to the end of each layer, bottom-up,
+  /// instead of searching for their positions.
+  template <typename TIterator>
+  SkipList(TIterator first, TIterator last, MemoryResource *memory = NewDeleteResource()) : SkipList(memory) {
+    TNode *tails[kSkipListMaxHeight];
+    std::fill(std::begin(tails), std::end(tails), head_);
+    uint64_t size = 0;
+    for (; first != last; ++first) {
+      DMG_ASSERT(tails[0] == head_ || tails[0]->obj < *first, "The objects must be sorted and unique!");
+      const int top_layer = gen_height();
+      auto *new_node = create_node(top_layer, *first);
+      for (int layer = 0; layer < top_layer; ++layer) {
+        tails[layer]->nexts[layer].store(new_node, std::memory_order_relaxed);
+        tails[layer] = new_node;
+      }
+      new_node->fully_linked.store(true, std::memory_order_relaxed);
+      ++size;
+    }
+    size_.store(size, std::memory_order_release);
+  }
+
   SkipList(SkipList &&other) noexcept : head_(other.head_), gc_(other.GetMemoryResource()), size_(other.size_.load()) {
     other.head_ = nullptr;
   }
@@ -936,11 +1018,23 @@ class SkipList final : detail::SkipListNode_base {
   void run_gc() { gc_.Run(); }
 
  private:
+  /// Only the search for the position of an object can start from the
+  /// `fingers`, in the layers where they are further than the node reached
+  /// from the layer above and still precede the key.
   template <typename TKey>
-  int find_node(const TKey &key, TNode *preds[], TNode *succs[]) const {
+  int find_node(const TKey &key, TNode *preds[], TNode *succs[], TNode *const fingers[] = nullptr) const {
     int layer_found = -1;
     TNode *pred = head_;
     for (int layer = kSkipListMaxHeight - 1; layer >= 0; --layer) {
+      if constexpr (std::is_same_v<TKey, TObj>) {
+        if (fingers != nullptr) {
+          TNode *finger = fingers[layer];
+          if (finger != nullptr && finger != head_ && finger != pred && finger->obj < key &&
+              (pred == head_ || pred->obj < finger->obj)) {
+            pred = finger;
+          }
+        }
+      }
       TNode *curr = pred->nexts[layer].load(std::memory_order_acquire);
       // Existence test is missing in the paper.
       while (curr != nullptr && curr->obj < key) {
@@ -958,18 +1052,36 @@ class SkipList final : detail::SkipListNode_base {
     return layer_found;
   }
 
+  template <typename... TArgs>
+  TNode *create_node(int height, TArgs &&...args) {
+    size_t node_bytes = sizeof(TNode) + height * sizeof(std::atomic<TNode *>);
+    void *ptr = GetMemoryResource()->Allocate(node_bytes);
+    // `calloc` would be faster, but the API has no such call.
+    memset(ptr, 0, node_bytes);
+    auto *new_node = static_cast<TNode *>(ptr);
+    // Construct through allocator so it propagates if needed.
+    Allocator<TNode> allocator(GetMemoryResource());
+    allocator.construct(new_node, height, std::forward<TArgs>(args)...);
+    return new_node;
+  }
+
   template <typename TObjUniv>
-  std::pair<Iterator, bool> insert(TObjUniv &&object) {
+  std::pair<Iterator, bool> insert(TObjUniv &&object, TNode *fingers[] = nullptr) {
     int top_layer = gen_height();
     TNode *preds[kSkipListMaxHeight], *succs[kSkipListMaxHeight];
     if (top_layer >= kSkipListGcHeightTrigger) gc_.Run();
+    // A failed attempt searches again from the head, the fingers may have
+    // been removed from the list in the meantime.
+    TNode *const *search_fingers = fingers;
     while (true) {
-      int layer_found = find_node(object, preds, succs);
+      int layer_found = find_node(object, preds, succs, search_fingers);
+      search_fingers = nullptr;
       if (layer_found != -1) {
         TNode *node_found = succs[layer_found];
         if (!node_found->marked.load(std::memory_order_acquire)) {
           while (!node_found->fully_linked.load(std::memory_order_acquire))
             ;
+          if (fingers != nullptr) std::copy(std::begin(preds), std::end(preds), fingers);
           return {Iterator{node_found}, false};
         }
         continue;
@@ -995,14 +1107,7 @@ class SkipList final : detail::SkipListNode_base {
 
       if (!valid) continue;
 
-      size_t node_bytes = sizeof(TNode) + top_layer * sizeof(std::atomic<TNode *>);
-      void *ptr = GetMemoryResource()->Allocate(node_bytes);
-      // `calloc` would be faster, but the API has no such call.
-      memset(ptr, 0, node_bytes);
-      auto *new_node = static_cast<TNode *>(ptr);
-      // Construct through allocator so it propagates if needed.
-      Allocator<TNode> allocator(GetMemoryResource());
-      allocator.construct(new_node, top_layer, std::forward<TObjUniv>(object));
+      auto *new_node = create_node(top_layer, std::forward<TObjUniv>(object));
 
       // The paper is also wrong here. It states that the loop should go up to
       // `top_layer` which is wrong.
@@ -1013,6 +1118,11 @@ class SkipList final : detail::SkipListNode_base {
 
       new_node->fully_linked.store(true, std::memory_order_release);
       size_.fetch_add(1, std::memory_order_acq_rel);
+      if (fingers != nullptr) {
+        for (int layer = 0; layer < kSkipListMaxHeight; ++layer) {
+          fingers[layer] = layer < top_layer ? new_node : preds[layer];
+        }
+      }
       return {Iterator{new_node}, true};
     }
   }
@@ -1219,6 +1329,36 @@ class SkipList final : detail::SkipListNode_base {
     return nodes_traversed / unique_count;
   }
 
+  std::vector<Iterator> split(uint64_t num_parts) const {
+    std::vector<Iterator> split_points;
+    const auto size = size_.load(std::memory_order_acquire);
+    if (num_parts < 2 || size < num_parts) return split_points;
+
+    // Each node on the layer stands for about `2^layer` nodes of the bottom
+    // layer, so the layer has at least `num_parts` nodes and not many more.
+    int layer = 0;
+    while (layer + 1 < static_cast<int>(kSkipListMaxHeight) && (size >> (layer + 1)) >= num_parts) {
+      ++layer;
+    }
+    std::vector<TNode *> nodes;
+    for (TNode *node = head_->nexts[layer].load(std::memory_order_acquire); node != nullptr;
+         node = node->nexts[layer].load(std::memory_order_acquire)) {
+      if (node->fully_linked.load(std::memory_order_acquire) && !node->marked.load(std::memory_order_acquire)) {
+        nodes.push_back(node);
+      }
+    }
+
+    split_points.reserve(num_parts - 1);
+    uint64_t last_pos = 0;
+    for (uint64_t part = 1; part < num_parts; ++part) {
+      const auto pos = part * nodes.size() / num_parts;
+      if (pos == last_pos) continue;
+      split_points.push_back(Iterator{nodes[pos]});
+      last_pos = pos;
+    }
+    return split_points;
+  }
+
   bool ok_to_delete(TNode *candidate, int layer_found) {
     // The paper has an incorrect check here. It expects the `layer_found`
     // variable to be 1-indexed, but in fact it is 0-indexed.
@@ -14,6 +14,7 @@
 #include <charconv>
 #include <chrono>
 #include <ctime>
+#include <functional>
 #include <limits>
 #include <string>
 #include <string_view>
@@ -470,21 +471,35 @@ std::pair<DateParameters, LocalTimeParameters> ParseLocalDateTimeParameters(std:
   }
 }
 
-LocalDateTime::LocalDateTime(const int64_t microseconds) {
-  auto chrono_microseconds = std::chrono::microseconds(microseconds);
-  static constexpr int64_t one_day_in_microseconds = std::chrono::microseconds{std::chrono::days{1}}.count();
-  if (microseconds < 0 && (microseconds % one_day_in_microseconds != 0)) {
-    date = Date(microseconds - one_day_in_microseconds);
-  } else {
-    date = Date(microseconds);
-  }
-  chrono_microseconds -= std::chrono::microseconds{date.MicrosecondsSinceEpoch()};
-  local_time = LocalTime(chrono_microseconds.count());
+namespace {
+// Microseconds since the epoch at the start of the day which contains the
+// point in time.
+int64_t StartOfDay(const int64_t microseconds) {
+  namespace chrono = std::chrono;
+  return chrono::duration_cast<chrono::microseconds>(chrono::floor<chrono::days>(chrono::microseconds(microseconds)))
+      .count();
 }
 
-// return microseconds normilized with regard to epoch time point
-int64_t LocalDateTime::MicrosecondsSinceEpoch() const {
-  return date.MicrosecondsSinceEpoch() + local_time.MicrosecondsSinceEpoch();
+constexpr int64_t kMinLocalDateTimeMicroseconds =
+    std::chrono::duration_cast<std::chrono::microseconds>(DaysSinceEpoch(0, 1, 1)).count();
+constexpr int64_t kMaxLocalDateTimeMicroseconds =
+    std::chrono::duration_cast<std::chrono::microseconds>(DaysSinceEpoch(9999, 12, 31) + std::chrono::days{1})
+        .count() -
+    1;
+}  // namespace
+
+LocalDateTime::LocalDateTime(const int64_t microseconds)
+    : date(StartOfDay(microseconds)),
+      local_time(microseconds - StartOfDay(microseconds)),
+      microseconds_(microseconds) {}
+
+LocalDateTime operator+(const LocalDateTime &dt, const Duration &dur) {
+  const auto result = Duration(dt.microseconds_) + dur;
+  if (!IsInBounds(kMinLocalDateTimeMicroseconds, kMaxLocalDateTimeMicroseconds, result.microseconds)) {
+    throw temporal::InvalidArgumentException(
+        "Creating a Date with invalid year parameter. The value should be an integer between 0 and 9999.");
+  }
+  return LocalDateTime(result.microseconds);
 }
 
 int64_t LocalDateTime::SecondsSinceEpoch() const {
@@ -503,15 +518,15 @@ int64_t LocalDateTime::SubSecondsAsNanoseconds() const {
 std::string LocalDateTime::ToString() const { return date.ToString() + 'T' + local_time.ToString(); }
 
 LocalDateTime::LocalDateTime(const DateParameters &date_parameters, const LocalTimeParameters &local_time_parameters)
-    : date(date_parameters), local_time(local_time_parameters) {}
+    : LocalDateTime(Date(date_parameters), LocalTime(local_time_parameters)) {}
 
-LocalDateTime::LocalDateTime(const Date &date, const LocalTime &local_time) : date(date), local_time(local_time) {}
+LocalDateTime::LocalDateTime(const Date &date, const LocalTime &local_time)
+    : date(date),
+      local_time(local_time),
+      microseconds_(date.MicrosecondsSinceEpoch() + local_time.MicrosecondsSinceEpoch()) {}
 
 size_t LocalDateTimeHash::operator()(const LocalDateTime &local_date_time) const {
-  utils::HashCombine<uint64_t, uint64_t> hasher;
-  size_t result = hasher(0, LocalTimeHash{}(local_date_time.local_time));
-  result = hasher(result, DateHash{}(local_date_time.date));
-  return result;
+  return std::hash<int64_t>{}(local_date_time.MicrosecondsSinceEpoch());
 }
 
 namespace {
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <chrono>
+#include <compare>
 #include <cstdint>
 #include <iostream>
 #include <limits>
@@ -252,41 +253,39 @@ struct LocalTimeHash {
 
 std::pair<DateParameters, LocalTimeParameters> ParseLocalDateTimeParameters(std::string_view string);
 
+// The calendar fields are kept together with the microseconds since the epoch,
+// so comparisons and arithmetic don't have to convert between them.
 struct LocalDateTime {
   explicit LocalDateTime(int64_t microseconds);
   explicit LocalDateTime(const DateParameters &date_parameters, const LocalTimeParameters &local_time_parameters);
   explicit LocalDateTime(const Date &date, const LocalTime &local_time);
 
-  int64_t MicrosecondsSinceEpoch() const;
+  int64_t MicrosecondsSinceEpoch() const { return microseconds_; }
   int64_t SecondsSinceEpoch() const;  // seconds since epoch
   int64_t SubSecondsAsNanoseconds() const;
   std::string ToString() const;
 
-  auto operator<=>(const LocalDateTime &) const = default;
+  // The microseconds determine the calendar fields and preserve their order.
+  std::strong_ordering operator<=>(const LocalDateTime &other) const { return microseconds_ <=> other.microseconds_; }
+  bool operator==(const LocalDateTime &other) const { return microseconds_ == other.microseconds_; }
 
   friend std::ostream &operator<<(std::ostream &os, const LocalDateTime &ldt) { return os << ldt.ToString(); }
 
-  friend LocalDateTime operator+(const LocalDateTime &dt, const Duration &dur) {
-    const auto local_date_time_as_duration = Duration(dt.MicrosecondsSinceEpoch());
-    const auto result = local_date_time_as_duration + dur;
-    namespace chrono = std::chrono;
-    const auto ymd = chrono::year_month_day(chrono::sys_days(chrono::days(result.Days())));
-    const auto date_part =
-        Date({static_cast<int>(ymd.year()), static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day())});
-    const auto local_time_part = LocalTime(result.SubDaysAsMicroseconds());
-    return LocalDateTime(date_part, local_time_part);
-  }
+  friend LocalDateTime operator+(const LocalDateTime &dt, const Duration &dur);
 
   friend LocalDateTime operator+(const Duration &dur, const LocalDateTime &dt) { return dt + dur; }
 
   friend LocalDateTime operator-(const LocalDateTime &dt, const Duration &dur) { return dt + (-dur); }
 
   friend Duration operator-(const LocalDateTime &lhs, const LocalDateTime &rhs) {
-    return Duration(lhs.MicrosecondsSinceEpoch()) - Duration(rhs.MicrosecondsSinceEpoch());
+    return Duration(lhs.microseconds_) - Duration(rhs.microseconds_);
   }
 
   Date date;
   LocalTime local_time;
+
+ private:
+  int64_t microseconds_;
 };
 
 struct LocalDateTimeHash {
@@ -11,12 +11,59 @@
 
 #include "utils/thread.hpp"
 
+#include <pthread.h>
+#include <sched.h>
 #include <sys/prctl.h>
 
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
 #include "utils/logging.hpp"
+#include "utils/string.hpp"
 
 namespace memgraph::utils {
 
+namespace {
+
+// Parses the list of processing units in the format of sysfs, e.g. "0-3,8-11".
+std::vector<size_t> ParseCpuList(const std::string &list) {
+  std::vector<size_t> cpus;
+  for (const auto &range : Split(Trim(list), ",")) {
+    if (range.empty()) continue;
+    const auto bounds = Split(range, "-");
+    const auto first = ParseInt(bounds.front());
+    const auto last = ParseInt(bounds.back());
+    for (auto cpu = first; cpu <= last; ++cpu) cpus.push_back(static_cast<size_t>(cpu));
+  }
+  return cpus;
+}
+
+// The processing units of the NUMA nodes, without the nodes which only have
+// memory.
+const std::vector<std::vector<size_t>> &NumaNodesCpus() {
+  static const auto nodes = [] {
+    std::vector<std::vector<size_t>> nodes;
+    for (size_t node = 0;; ++node) {
+      std::ifstream file(fmt::format("/sys/devices/system/node/node{}/cpulist", node));
+      if (!file) break;
+      std::string list;
+      std::getline(file, list);
+      try {
+        auto cpus = ParseCpuList(list);
+        if (!cpus.empty()) nodes.push_back(std::move(cpus));
+      } catch (const BasicException &) {
+        spdlog::warn("Couldn't parse the processing units of the NUMA node {}: {}", node, list);
+        return std::vector<std::vector<size_t>>{};
+      }
+    }
+    return nodes;
+  }();
+  return nodes;
+}
+
+}  // namespace
+
 void ThreadSetName(const std::string &name) {
   static constexpr auto max_name_length = GetMaxThreadNameSize();
   MG_ASSERT(name.size() <= max_name_length, "Thread name '{}' is too long", max_name_length);
@@ -26,4 +73,30 @@ void ThreadSetName(const std::string &name) {
   }
 }
 
+bool ThreadPinToCore(size_t core) {
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(core, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    spdlog::warn("Couldn't pin the thread to the processing unit {}!", core);
+    return false;
+  }
+  return true;
+}
+
+size_t NumaNodesCount() { return std::max(NumaNodesCpus().size(), size_t{1}); }
+
+bool ThreadPinToNumaNode(size_t node) {
+  const auto &nodes = NumaNodesCpus();
+  if (nodes.empty()) return false;
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : nodes[node % nodes.size()]) CPU_SET(cpu, &cpu_set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0) {
+    spdlog::warn("Couldn't pin the thread to the NUMA node {}!", node % nodes.size());
+    return false;
+  }
+  return true;
+}
+
 }  // namespace memgraph::utils
@@ -12,6 +12,7 @@
 /// @file
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace memgraph::utils {
@@ -22,4 +23,17 @@ constexpr size_t GetMaxThreadNameSize() { return 16; }
 /// Beware, the name length limit is 16 characters!
 void ThreadSetName(const std::string &name);
 
+/// Restricts the calling thread to run only on the given processing unit.
+/// Returns false if the affinity couldn't be set.
+bool ThreadPinToCore(size_t core);
+
+/// Returns the number of NUMA nodes with processing units, 1 if the machine
+/// isn't NUMA or its topology can't be read.
+size_t NumaNodesCount();
+
+/// Restricts the calling thread to run only on the processing units of the
+/// NUMA node `node % NumaNodesCount()`. Returns false if the affinity couldn't
+/// be set.
+bool ThreadPinToNumaNode(size_t node);
+
 };  // namespace memgraph::utils
@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -13,17 +13,34 @@
 
 namespace memgraph::utils {
 
+namespace {
+// The pool and the index of the worker run by the current thread, used to
+// queue the tasks added by a worker at the worker itself.
+thread_local const void *current_pool{nullptr};
+thread_local size_t current_worker{0};
+}  // namespace
+
 ThreadPool::ThreadPool(const size_t pool_size) {
+  workers_.reserve(pool_size);
+  for (size_t i = 0; i < pool_size; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
   for (size_t i = 0; i < pool_size; ++i) {
-    thread_pool_.emplace_back(([this] { this->ThreadLoop(); }));
+    thread_pool_.emplace_back(([this, i] { this->ThreadLoop(i); }));
   }
 }
 
-void ThreadPool::AddTask(std::function<void()> new_task) {
-  task_queue_.WithLock([&](auto &queue) {
-    queue.emplace(std::make_unique<TaskSignature>(std::move(new_task)));
+void ThreadPool::AddTask(std::function<void()> new_task, TaskPriority priority) {
+  if (workers_.empty()) return;
+  const auto worker = current_pool == this ? current_worker
+                                           : next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+  {
+    std::lock_guard guard(workers_[worker]->lock);
+    workers_[worker]->tasks[static_cast<size_t>(priority)].push_back(std::move(new_task));
+    workers_[worker]->size.fetch_add(1);
     unfinished_tasks_num_.fetch_add(1);
-  });
+    queued_tasks_num_.fetch_add(1);
+  }
   std::unique_lock pool_guard(pool_lock_);
   queue_cv_.notify_one();
 }
@@ -51,34 +68,50 @@ ThreadPool::~ThreadPool() {
   }
 }
 
-std::unique_ptr<ThreadPool::TaskSignature> ThreadPool::PopTask() {
-  return task_queue_.WithLock([](auto &queue) -> std::unique_ptr<TaskSignature> {
-    if (queue.empty()) {
-      return nullptr;
+bool ThreadPool::PopTaskFrom(Worker &worker, const size_t priority, const bool own, TaskSignature &task) {
+  if (worker.size.load() == 0) return false;
+  std::lock_guard guard(worker.lock);
+  auto &tasks = worker.tasks[priority];
+  if (tasks.empty()) return false;
+  if (own) {
+    task = std::move(tasks.back());
+    tasks.pop_back();
+  } else {
+    task = std::move(tasks.front());
+    tasks.pop_front();
+  }
+  worker.size.fetch_sub(1);
+  queued_tasks_num_.fetch_sub(1);
+  return true;
+}
+
+bool ThreadPool::PopTask(const size_t worker, TaskSignature &task) {
+  if (queued_tasks_num_.load() == 0) return false;
+  for (size_t priority = 0; priority < kPriorities; ++priority) {
+    if (PopTaskFrom(*workers_[worker], priority, true, task)) return true;
+    for (size_t i = 1; i < workers_.size(); ++i) {
+      if (PopTaskFrom(*workers_[(worker + i) % workers_.size()], priority, false, task)) return true;
     }
-    auto front = std::move(queue.front());
-    queue.pop();
-    return front;
-  });
+  }
+  return false;
 }
 
-void ThreadPool::ThreadLoop() {
-  std::unique_ptr<TaskSignature> task = PopTask();
+void ThreadPool::ThreadLoop(const size_t worker) {
+  current_pool = this;
+  current_worker = worker;
+  TaskSignature task;
   while (true) {
-    while (task) {
+    while (PopTask(worker, task)) {
       if (terminate_pool_.load()) {
         return;
       }
-      (*task)();
+      task();
+      task = nullptr;
       unfinished_tasks_num_.fetch_sub(1);
-      task = PopTask();
     }
 
     std::unique_lock guard(pool_lock_);
-    queue_cv_.wait(guard, [&] {
-      task = PopTask();
-      return task || terminate_pool_.load();
-    });
+    queue_cv_.wait(guard, [&] { return queued_tasks_num_.load() != 0 || terminate_pool_.load(); });
     if (terminate_pool_.load()) {
       return;
     }
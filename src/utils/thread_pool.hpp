@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -10,26 +10,38 @@
 // licenses/APL.txt.
 
 #pragma once
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <vector>
 
-#include "utils/spin_lock.hpp"
-#include "utils/synchronized.hpp"
 #include "utils/thread.hpp"
 
 namespace memgraph::utils {
 
+/// Tasks of a higher priority are started before the tasks of a lower
+/// priority which are waiting in the same pool.
+enum class TaskPriority : uint8_t { HIGH, NORMAL, LOW };
+
+/// A work-stealing thread pool. Every thread of the pool has its own queues of
+/// tasks, one for each priority. Tasks added by a thread of the pool go to its
+/// own queues, where they are taken last in first out, and the other tasks are
+/// distributed among the threads round-robin. A thread whose queues are empty
+/// steals the oldest tasks from the queues of the other threads, so the
+/// threads don't all contend for a single queue.
 class ThreadPool {
   using TaskSignature = std::function<void()>;
 
  public:
   explicit ThreadPool(size_t pool_size);
 
-  void AddTask(std::function<void()> new_task);
+  void AddTask(std::function<void()> new_task, TaskPriority priority = TaskPriority::NORMAL);
 
   void Shutdown();
 
@@ -43,18 +55,73 @@ class ThreadPool {
   size_t UnfinishedTasksNum() const;
 
  private:
-  std::unique_ptr<TaskSignature> PopTask();
+  static constexpr size_t kPriorities = 3;
+
+  struct alignas(64) Worker {
+    std::mutex lock;
+    std::array<std::deque<TaskSignature>, kPriorities> tasks;
+    // The number of tasks in `tasks`, read without the lock to skip the
+    // workers which have nothing to steal.
+    std::atomic<size_t> size{0};
+  };
+
+  // Takes the task of the highest priority which is queued at `worker` or can
+  // be stolen from another worker.
+  bool PopTask(size_t worker, TaskSignature &task);
 
-  void ThreadLoop();
+  // Takes the newest task of `priority` queued at the worker if `own`, and the
+  // oldest one otherwise.
+  bool PopTaskFrom(Worker &worker, size_t priority, bool own, TaskSignature &task);
 
+  void ThreadLoop(size_t worker);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
   std::vector<std::thread> thread_pool_;
 
+  std::atomic<size_t> next_worker_{0};
+  std::atomic<size_t> queued_tasks_num_{0};
   std::atomic<size_t> unfinished_tasks_num_{0};
   std::atomic<bool> terminate_pool_{false};
   std::atomic<bool> stopped_{false};
-  utils::Synchronized<std::queue<std::unique_ptr<TaskSignature>>, utils::SpinLock> task_queue_;
   std::mutex pool_lock_;
   std::condition_variable queue_cv_;
 };
 
+// Runs `work(worker)` for workers 1 to `num_workers - 1` on the threads of
+// `pool` and for the worker 0 on the calling thread, and waits for all of
+// them. Tasks which the pool starts only after the calling thread is done
+// don't run at all, the workers share the work so the others do it instead.
+template <class TWork>
+void RunParallelWorkers(ThreadPool &pool, size_t num_workers, const TWork &work,
+                        TaskPriority priority = TaskPriority::NORMAL) {
+  struct State {
+    std::mutex lock;
+    std::condition_variable finished;
+    size_t running{0};
+    bool closed{false};
+  };
+  auto state = std::make_shared<State>();
+  for (size_t worker = 1; worker < num_workers; ++worker) {
+    pool.AddTask(
+        [state, worker, &work] {
+          {
+            std::lock_guard guard(state->lock);
+            if (state->closed) return;
+            ++state->running;
+          }
+          work(worker);
+          {
+            std::lock_guard guard(state->lock);
+            --state->running;
+          }
+          state->finished.notify_all();
+        },
+        priority);
+  }
+  work(0);
+  std::unique_lock guard(state->lock);
+  state->closed = true;
+  state->finished.wait(guard, [&] { return state->running == 0; });
+}
+
 }  // namespace memgraph::utils
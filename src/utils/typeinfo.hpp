@@ -30,7 +30,11 @@ enum class TypeId : uint64_t {
   SCAN_ALL_BY_LABEL_PROPERTY_RANGE,
   SCAN_ALL_BY_LABEL_PROPERTY_VALUE,
   SCAN_ALL_BY_LABEL_PROPERTY,
+  SCAN_ALL_BY_LABEL_PROPERTIES,
   SCAN_ALL_BY_ID,
+  SCAN_ALL_BY_EDGE_TYPE,
+  SCAN_ALL_BY_TEXT,
+  SCAN_ALL_BY_POINT,
   EXPAND_COMMON,
   EXPAND,
   EXPANSION_LAMBDA,
@@ -59,6 +63,8 @@ enum class TypeId : uint64_t {
   DISTINCT,
   UNION,
   CARTESIAN,
+  HASH_JOIN,
+  INDEXED_JOIN,
   OUTPUT_TABLE,
   OUTPUT_TABLE_STREAM,
   CALL_PROCEDURE,
@@ -81,6 +87,8 @@ enum class TypeId : uint64_t {
   REP_CURRENT_WAL_RES,
   REP_TIMESTAMP_REQ,
   REP_TIMESTAMP_RES,
+  REP_STATE_BATCH_REQ,
+  REP_STATE_BATCH_RES,
 
   // AST
   AST_LABELIX,
@@ -187,6 +195,7 @@ enum class TypeId : uint64_t {
   AST_MULTI_DATABASE_QUERY,
   AST_SHOW_DATABASES,
   AST_EDGE_IMPORT_MODE_QUERY,
+  AST_MATERIALIZED_VIEW_QUERY,
   // Symbol
   SYMBOL,
 };
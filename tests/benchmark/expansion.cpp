@@ -29,6 +29,8 @@ class ExpansionBenchFixture : public benchmark::Fixture {
     auto *db = interpreter_context->db.get();
 
     auto label = db->NameToLabel("Starting");
+    // Not indexed, used for measuring scans that filter on labels
+    auto dest_label = db->NameToLabel("Destination");
 
     {
       auto dba = db->Access();
@@ -40,6 +42,7 @@ class ExpansionBenchFixture : public benchmark::Fixture {
       auto edge_type = dba->NameToEdgeType("edge_type");
       for (int i = 0; i < 1000; i++) {
         auto dest = dba->CreateVertex();
+        MG_ASSERT(dest.AddLabel(dest_label).HasValue());
         MG_ASSERT(dba->CreateEdge(&start, &dest, edge_type).HasValue());
       }
       MG_ASSERT(!dba->Commit().HasError());
@@ -87,6 +90,21 @@ BENCHMARK_REGISTER_F(ExpansionBenchFixture, Expand)
     ->Range(1, 1 << 20)
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_DEFINE_F(ExpansionBenchFixture, ScanAllLabelFilter)(benchmark::State &state) {
+  auto query = "MATCH (d) WHERE d:Destination RETURN count(d)";
+
+  while (state.KeepRunning()) {
+    ResultStreamFaker results(interpreter_context->db.get());
+    interpreter->Prepare(query, {}, nullptr);
+    interpreter->PullAll(&results);
+  }
+}
+
+BENCHMARK_REGISTER_F(ExpansionBenchFixture, ScanAllLabelFilter)
+    ->RangeMultiplier(1024)
+    ->Range(1, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
 int main(int argc, char **argv) {
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,101 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "graph_algorithms.hpp"
+
+// Random graph with `vertices` vertices and 8 edges per vertex on average.
+static graph_algorithms::OwnedCsr RandomGraph(uint64_t vertices) {
+  static constexpr uint64_t kEdgesPerVertex = 8;
+  std::mt19937_64 gen(vertices);
+  std::uniform_int_distribution<uint64_t> dist(0, vertices - 1);
+  std::vector<std::pair<uint64_t, uint64_t>> edges(vertices * kEdgesPerVertex);
+  for (auto &edge : edges) {
+    edge = {dist(gen), dist(gen)};
+  }
+  std::sort(edges.begin(), edges.end());
+  graph_algorithms::OwnedCsr graph;
+  graph.offsets.assign(vertices + 1, 0);
+  for (const auto &[from, to] : edges) {
+    ++graph.offsets[from + 1];
+    graph.neighbours.push_back(to);
+  }
+  for (uint64_t vertex = 0; vertex < vertices; ++vertex) {
+    graph.offsets[vertex + 1] += graph.offsets[vertex];
+  }
+  return graph;
+}
+
+// Runs `func` on the random graph with `state.range(0)` vertices.
+template <typename TFunc>
+// NOLINTNEXTLINE(google-runtime-references)
+static void RunOnRandomGraph(benchmark::State &state, const TFunc &func) {
+  const auto graph = RandomGraph(state.range(0));
+  const auto view = graph.View();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(func(view));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(view.neighbours.size()));
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void BreadthFirstSearch(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::BreadthFirstSearch(graph, 0); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void WeaklyConnectedComponents(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::WeaklyConnectedComponents(graph); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void StronglyConnectedComponents(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::StronglyConnectedComponents(graph); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PageRank(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::PageRank(graph, 0.85, 100, 1e-5); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void TriangleCounts(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::TriangleCounts(graph); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void Louvain(benchmark::State &state) {
+  RunOnRandomGraph(state, [](const auto &graph) { return graph_algorithms::Louvain(graph, 1.0, 32, 1e-4); });
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void BetweennessCentrality(benchmark::State &state) {
+  RunOnRandomGraph(state,
+                   [](const auto &graph) { return graph_algorithms::BetweennessCentrality(graph, true, true); });
+}
+
+BENCHMARK(BreadthFirstSearch)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(WeaklyConnectedComponents)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(StronglyConnectedComponents)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(PageRank)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(TriangleCounts)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(Louvain)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+// Betweenness traverses the whole graph from each vertex.
+BENCHMARK(BetweennessCentrality)->RangeMultiplier(10)->Range(100, 1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
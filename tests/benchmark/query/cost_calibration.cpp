@@ -0,0 +1,201 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Measures the costs of processing a row by the query operators on the host,
+// and writes them as the json file which memgraph loads with the
+// --query-cost-model-path flag. The costs are relative to the cost of
+// ScanAll. Operators which aren't measured keep their default costs.
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <gflags/gflags.h>
+#include <json/json.hpp>
+
+#include "query/context.hpp"
+#include "query/frontend/ast/cypher_main_visitor.hpp"
+#include "query/frontend/opencypher/parser.hpp"
+#include "query/frontend/semantic/symbol_generator.hpp"
+#include "query/plan/planner.hpp"
+#include "storage/v2/disk/storage.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(vertices, 100000, "Number of vertices of the measured graph.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(degree, 4, "Number of outgoing edges of each vertex of the measured graph.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(repetitions, 5, "Number of executions of each query, of which the fastest one is measured.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(on_disk, false, "Measure the costs with the on-disk storage instead of the in-memory one.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(output, "", "Path of the json file with the costs. They are printed if it isn't set.");
+
+namespace {
+
+const char *kLabel = "Label";
+const char *kEdgeType = "Type";
+
+// Half of the vertices have the label and an indexed property with a unique
+// value. All vertices have a property with 10 distinct values.
+void CreateGraph(memgraph::storage::Storage *db) {
+  {
+    auto dba = db->Access();
+    const auto label = dba->NameToLabel(kLabel);
+    const auto indexed = dba->NameToProperty("indexed");
+    const auto value = dba->NameToProperty("value");
+    const auto edge_type = dba->NameToEdgeType(kEdgeType);
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    vertices.reserve(FLAGS_vertices);
+    for (int i = 0; i < FLAGS_vertices; ++i) {
+      auto vertex = dba->CreateVertex();
+      if (i % 2 == 0) {
+        MG_ASSERT(vertex.AddLabel(label).HasValue());
+        MG_ASSERT(vertex.SetProperty(indexed, memgraph::storage::PropertyValue(i)).HasValue());
+      }
+      MG_ASSERT(vertex.SetProperty(value, memgraph::storage::PropertyValue(i % 10)).HasValue());
+      vertices.push_back(vertex);
+    }
+    // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+    std::mt19937_64 rg(42);
+    std::uniform_int_distribution<size_t> dis(0U, vertices.size() - 1U);
+    for (auto &from : vertices) {
+      for (int i = 0; i < FLAGS_degree; ++i) {
+        MG_ASSERT(dba->CreateEdge(&from, &vertices[dis(rg)], edge_type).HasValue());
+      }
+    }
+    MG_ASSERT(!dba->Commit().HasError());
+  }
+  MG_ASSERT(!db->CreateIndex(db->NameToLabel(kLabel), db->NameToProperty("indexed")).HasError());
+}
+
+struct Measurement {
+  double nanoseconds;
+  uint64_t rows;
+};
+
+// Executes the query, which mustn't change the graph, and returns the fastest
+// of its executions with the number of rows it produced.
+Measurement Measure(memgraph::storage::Storage *db, const std::string &query_string) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::frontend::ParsingContext parsing_context;
+  parsing_context.is_query_cached = false;
+  memgraph::query::frontend::opencypher::Parser parser(query_string);
+  memgraph::query::frontend::CypherMainVisitor cypher_visitor(parsing_context, &ast);
+  cypher_visitor.visit(parser.tree());
+  auto *cypher_query = memgraph::utils::Downcast<memgraph::query::CypherQuery>(cypher_visitor.query());
+  MG_ASSERT(cypher_query, "Couldn't parse the query {}", query_string);
+
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto symbol_table = memgraph::query::MakeSymbolTable(cypher_query);
+  auto planning_context = memgraph::query::plan::MakePlanningContext(&ast, &symbol_table, cypher_query, &dba);
+  memgraph::query::Parameters parameters;
+  auto [plan, cost] = memgraph::query::plan::MakeLogicalPlan(&planning_context, parameters, false);
+
+  Measurement fastest{std::numeric_limits<double>::max(), 0};
+  for (int i = 0; i < FLAGS_repetitions; ++i) {
+    memgraph::utils::MonotonicBufferResource memory(memgraph::query::kExecutionMemoryBlockSize);
+    memgraph::query::EvaluationContext evaluation_context{&memory};
+    evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, &dba);
+    evaluation_context.labels = memgraph::query::NamesToLabels(ast.labels_, &dba);
+    memgraph::query::ExecutionContext context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    memgraph::query::Frame frame(symbol_table.max_position(), &memory);
+    const auto start = std::chrono::steady_clock::now();
+    auto cursor = plan->MakeCursor(&memory);
+    uint64_t rows = 0;
+    while (cursor->Pull(frame, context)) ++rows;
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    if (elapsed.count() < fastest.nanoseconds) fastest = {elapsed.count(), rows};
+  }
+  MG_ASSERT(fastest.rows > 0, "The query {} produced no rows", query_string);
+  return fastest;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  MG_ASSERT(FLAGS_vertices > 1 && FLAGS_degree > 0 && FLAGS_repetitions > 0, "Invalid graph size or repetitions");
+
+  const auto directory = std::filesystem::temp_directory_path() / "mg_cost_calibration";
+  std::filesystem::remove_all(directory);
+  memgraph::storage::Config config;
+  memgraph::storage::UpdatePaths(config, directory);
+  std::unique_ptr<memgraph::storage::Storage> db;
+  if (FLAGS_on_disk) {
+    db = std::make_unique<memgraph::storage::DiskStorage>(config);
+  } else {
+    db = std::make_unique<memgraph::storage::InMemoryStorage>(config);
+  }
+  CreateGraph(db.get());
+
+  // The cost of an operator is the time it adds to the query per row it
+  // processes. The costs of the scans include producing their rows, which all
+  // the measured queries do.
+  const auto scan_all = Measure(db.get(), "MATCH (n) RETURN 0");
+  const double scan_all_cost = scan_all.nanoseconds / static_cast<double>(scan_all.rows);
+  auto cost_per_row = [](const Measurement &measurement) {
+    return measurement.nanoseconds / static_cast<double>(measurement.rows);
+  };
+  // The cost of the operator processing the rows of a scan of all vertices.
+  auto cost_after_scan_all = [&](const Measurement &measurement, uint64_t input_rows) {
+    return std::max(measurement.nanoseconds - scan_all.nanoseconds, 0.0) / static_cast<double>(input_rows);
+  };
+
+  const auto unwind = Measure(db.get(), fmt::format("UNWIND range(0, {}) AS x RETURN 0", FLAGS_vertices - 1));
+  const auto lookups = Measure(
+      db.get(), fmt::format("UNWIND range(0, {}, 2) AS x MATCH (n:{} {{indexed: x}}) RETURN 0", FLAGS_vertices - 1,
+                            kLabel));
+  const auto expand = Measure(db.get(), fmt::format("MATCH (n)-[:{}]->(m) RETURN 0", kEdgeType));
+  const auto expand_variable = Measure(db.get(), fmt::format("MATCH (n)-[:{}*1..2]->(m) RETURN 0", kEdgeType));
+
+  nlohmann::json costs;
+  costs["ScanAll"] = 1.0;
+  costs["ScanAllByLabel"] = cost_per_row(Measure(db.get(), fmt::format("MATCH (n:{}) RETURN 0", kLabel)));
+  // The rows of the unwind are the input of the lookups.
+  costs["ScanAllByLabelPropertyValue"] =
+      std::max(lookups.nanoseconds - unwind.nanoseconds / 2, 0.0) / static_cast<double>(lookups.rows);
+  costs["ScanAllByLabelPropertyRange"] =
+      cost_per_row(Measure(db.get(), fmt::format("MATCH (n:{}) WHERE n.indexed >= 0 RETURN 0", kLabel)));
+  costs["ScanAllByLabelProperty"] =
+      cost_per_row(Measure(db.get(), fmt::format("MATCH (n:{}) WHERE n.indexed IS NOT NULL RETURN 0", kLabel)));
+  costs["Filter"] = cost_after_scan_all(Measure(db.get(), "MATCH (n) WHERE n.value < 5 RETURN 0"), scan_all.rows);
+  costs["Expand"] = cost_after_scan_all(expand, expand.rows);
+  costs["ExpandVariable"] = cost_after_scan_all(expand_variable, expand_variable.rows);
+  costs["Unwind"] = cost_per_row(unwind);
+  for (auto it = costs.begin(); it != costs.end(); ++it) {
+    if (it.key() == "ScanAll") continue;
+    // A cost of 0 would make the planner ignore the operator.
+    it.value() = std::max(it.value().get<double>() / scan_all_cost, 0.01);
+  }
+
+  db.reset();
+  std::filesystem::remove_all(directory);
+
+  if (FLAGS_output.empty()) {
+    std::cout << costs.dump(2) << std::endl;
+    return 0;
+  }
+  std::ofstream output(FLAGS_output);
+  output << costs.dump(2) << std::endl;
+  MG_ASSERT(output, "Couldn't write the costs to {}", FLAGS_output);
+  return 0;
+}
@@ -0,0 +1,228 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Measures the query operators on a synthetic graph. Each benchmark executes a
+// query whose cost is dominated by one operator, planned once and pulled to
+// the end in every iteration. The queries which change the graph are executed
+// in a transaction which is aborted after each iteration, outside of the
+// measured time, so every iteration sees the same graph.
+//
+// Run with --benchmark_format=json to compare the results between builds.
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "query/context.hpp"
+#include "query/frontend/ast/cypher_main_visitor.hpp"
+#include "query/frontend/opencypher/parser.hpp"
+#include "query/frontend/semantic/symbol_generator.hpp"
+#include "query/plan/planner.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(vertices, 10000, "Number of vertices of the graph.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(degree, 4, "Average number of outgoing edges of a vertex of the graph.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(degree_distribution, "uniform",
+              "Distribution of the incoming edges over the vertices of the graph: 'uniform', or 'power_law' for a "
+              "few hubs with most of the edges.");
+
+namespace {
+
+const char *kLabel = "Label";
+const char *kEdgeType = "Type";
+
+// Half of the vertices have the label and an indexed property with a unique
+// value. All vertices have a property with 10 distinct values. Every vertex
+// has `FLAGS_degree` outgoing edges, whose endpoints are chosen by
+// `FLAGS_degree_distribution`.
+void CreateGraph(memgraph::storage::Storage *db) {
+  {
+    auto dba = db->Access();
+    const auto label = dba->NameToLabel(kLabel);
+    const auto indexed = dba->NameToProperty("indexed");
+    const auto value = dba->NameToProperty("value");
+    const auto weight = dba->NameToProperty("weight");
+    const auto edge_type = dba->NameToEdgeType(kEdgeType);
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    vertices.reserve(FLAGS_vertices);
+    for (int i = 0; i < FLAGS_vertices; ++i) {
+      auto vertex = dba->CreateVertex();
+      if (i % 2 == 0) {
+        MG_ASSERT(vertex.AddLabel(label).HasValue());
+        MG_ASSERT(vertex.SetProperty(indexed, memgraph::storage::PropertyValue(i / 2)).HasValue());
+      }
+      MG_ASSERT(vertex.SetProperty(value, memgraph::storage::PropertyValue(i % 10)).HasValue());
+      vertices.push_back(vertex);
+    }
+
+    // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+    std::mt19937_64 rg(42);
+    std::uniform_int_distribution<size_t> uniform(0U, vertices.size() - 1U);
+    // The i-th vertex is the endpoint of an edge with a probability
+    // proportional to 1 / (i + 1).
+    std::vector<double> weights(vertices.size());
+    for (size_t i = 0; i < weights.size(); ++i) weights[i] = 1.0 / static_cast<double>(i + 1);
+    std::discrete_distribution<size_t> power_law(weights.begin(), weights.end());
+    const bool is_power_law = FLAGS_degree_distribution == "power_law";
+
+    std::uniform_int_distribution<int64_t> edge_weight(1, 10);
+    for (auto &from : vertices) {
+      for (int i = 0; i < FLAGS_degree; ++i) {
+        auto &to = vertices[is_power_law ? power_law(rg) : uniform(rg)];
+        auto edge = dba->CreateEdge(&from, &to, edge_type);
+        MG_ASSERT(edge.HasValue());
+        MG_ASSERT(edge->SetProperty(weight, memgraph::storage::PropertyValue(edge_weight(rg))).HasValue());
+      }
+    }
+    MG_ASSERT(!dba->Commit().HasError());
+  }
+  MG_ASSERT(!db->CreateIndex(db->NameToLabel(kLabel)).HasError());
+  MG_ASSERT(!db->CreateIndex(db->NameToLabel(kLabel), db->NameToProperty("indexed")).HasError());
+}
+
+// Parses and plans the query, keeping the AST and the symbols the plan
+// refers to.
+struct PlannedQuery {
+  PlannedQuery(const std::string &query_string, memgraph::query::DbAccessor *dba) {
+    memgraph::query::frontend::ParsingContext parsing_context;
+    parsing_context.is_query_cached = false;
+    memgraph::query::frontend::opencypher::Parser parser(query_string);
+    memgraph::query::frontend::CypherMainVisitor cypher_visitor(parsing_context, &ast);
+    cypher_visitor.visit(parser.tree());
+    auto *cypher_query = memgraph::utils::Downcast<memgraph::query::CypherQuery>(cypher_visitor.query());
+    MG_ASSERT(cypher_query, "Couldn't parse the query {}", query_string);
+    symbol_table = memgraph::query::MakeSymbolTable(cypher_query);
+    auto planning_context = memgraph::query::plan::MakePlanningContext(&ast, &symbol_table, cypher_query, dba);
+    memgraph::query::Parameters parameters;
+    plan = memgraph::query::plan::MakeLogicalPlan(&planning_context, parameters, false).first;
+  }
+
+  // Pulls all the results of the plan and returns their number.
+  uint64_t Execute(memgraph::query::DbAccessor *dba) {
+    memgraph::utils::MonotonicBufferResource memory(memgraph::query::kExecutionMemoryBlockSize);
+    memgraph::query::EvaluationContext evaluation_context{&memory};
+    evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, dba);
+    evaluation_context.labels = memgraph::query::NamesToLabels(ast.labels_, dba);
+    memgraph::query::ExecutionContext context{
+        .db_accessor = dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    memgraph::query::Frame frame(symbol_table.max_position(), &memory);
+    auto cursor = plan->MakeCursor(&memory);
+    uint64_t rows = 0;
+    while (cursor->Pull(frame, context)) ++rows;
+    return rows;
+  }
+
+  memgraph::query::AstStorage ast;
+  memgraph::query::SymbolTable symbol_table;
+  std::unique_ptr<memgraph::query::plan::LogicalOperator> plan;
+};
+
+struct OperatorQuery {
+  const char *name;
+  std::string query;
+  bool writes;
+};
+
+std::vector<OperatorQuery> OperatorQueries() {
+  // Queries starting from a few indexed vertices keep the expansions bounded
+  // on the graphs with hubs.
+  const auto start = fmt::format("MATCH (n:{}) WHERE n.indexed < 16", kLabel);
+  return {
+      {"ScanAll", "MATCH (n) RETURN n", false},
+      {"ScanAllByLabel", fmt::format("MATCH (n:{}) RETURN n", kLabel), false},
+      {"ScanAllByLabelPropertyValue",
+       fmt::format("UNWIND range(0, 999) AS x MATCH (n:{} {{indexed: x}}) RETURN n", kLabel), false},
+      {"ScanAllByLabelPropertyRange", fmt::format("MATCH (n:{}) WHERE n.indexed >= 0 RETURN n", kLabel), false},
+      {"ScanAllByLabelProperty", fmt::format("MATCH (n:{}) WHERE n.indexed IS NOT NULL RETURN n", kLabel), false},
+      {"ScanAllById", "UNWIND range(0, 999) AS x MATCH (n) WHERE id(n) = x RETURN n", false},
+      {"Filter", "MATCH (n) WHERE n.value < 5 RETURN n", false},
+      {"Expand", fmt::format("MATCH (n)-[e:{}]->(m) RETURN m", kEdgeType), false},
+      {"ExpandVariable", fmt::format("{} MATCH (n)-[:{}*1..3]->(m) RETURN m", start, kEdgeType), false},
+      {"ExpandBfs", fmt::format("{} MATCH (n)-[:{} *BFS ..3]->(m) RETURN m", start, kEdgeType), false},
+      {"ExpandWeightedShortest",
+       fmt::format("{} MATCH (n)-[:{} *WSHORTEST 3 (e, v | e.weight) total]->(m) RETURN m, total", start, kEdgeType),
+       false},
+      {"Aggregate", "MATCH (n) RETURN n.value, count(*), avg(n.indexed)", false},
+      {"OrderBy", "MATCH (n) RETURN n ORDER BY n.value, n.indexed", false},
+      {"Distinct", "MATCH (n) RETURN DISTINCT n.value", false},
+      {"Unwind", "UNWIND range(1, 100000) AS x RETURN x", false},
+      {"CreateNode", "UNWIND range(1, 1000) AS x CREATE (n {value: x})", true},
+      {"CreateExpand", fmt::format("MATCH (n:{}) WHERE n.indexed < 1000 CREATE (n)-[:New]->(m)", kLabel), true},
+      {"Merge", fmt::format("UNWIND range(0, 1999) AS x MERGE (n:{} {{indexed: x}})", kLabel), true},
+      {"SetProperty", "MATCH (n) SET n.value = 1", true},
+      {"SetProperties", "MATCH (n) SET n += {value: 1, other: 'other'}", true},
+      {"SetLabels", "MATCH (n) SET n:New", true},
+      {"RemoveProperty", "MATCH (n) REMOVE n.value", true},
+      {"Delete", "MATCH (n) DETACH DELETE n", true},
+  };
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::unique_ptr<memgraph::storage::Storage> db;
+
+// NOLINTNEXTLINE(google-runtime-references)
+void ReadQuery(benchmark::State &state, const std::string &query) {
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  PlannedQuery planned(query, &dba);
+  uint64_t rows = 0;
+  for (auto _ : state) {
+    rows = planned.Execute(&dba);
+  }
+  state.counters["rows"] = static_cast<double>(rows);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void WriteQuery(benchmark::State &state, const std::string &query) {
+  uint64_t rows = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto storage_dba = db->Access();
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    PlannedQuery planned(query, &dba);
+    state.ResumeTiming();
+    rows = planned.Execute(&dba);
+    state.PauseTiming();
+    storage_dba->Abort();
+    state.ResumeTiming();
+  }
+  state.counters["rows"] = static_cast<double>(rows);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  MG_ASSERT(FLAGS_vertices > 1 && FLAGS_degree > 0, "Invalid graph size");
+  MG_ASSERT(FLAGS_degree_distribution == "uniform" || FLAGS_degree_distribution == "power_law",
+            "Unknown degree distribution {}", FLAGS_degree_distribution);
+
+  db = std::make_unique<memgraph::storage::InMemoryStorage>();
+  CreateGraph(db.get());
+
+  for (const auto &[name, query, writes] : OperatorQueries()) {
+    ::benchmark::RegisterBenchmark(name, writes ? WriteQuery : ReadQuery, query)->Unit(benchmark::kMicrosecond);
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  db.reset();
+  return 0;
+}
@@ -0,0 +1,58 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "utils/skip_list.hpp"
+
+// Inserting sorted items, as the recovery does with the gids of the vertices
+// and edges.
+
+static void Insert(benchmark::State &state) {
+  const auto items = static_cast<uint64_t>(state.range(0));
+  for (auto _ : state) {
+    memgraph::utils::SkipList<uint64_t> list;
+    auto acc = list.access();
+    for (uint64_t i = 0; i < items; ++i) acc.insert(i);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void InsertWithFinger(benchmark::State &state) {
+  const auto items = static_cast<uint64_t>(state.range(0));
+  for (auto _ : state) {
+    memgraph::utils::SkipList<uint64_t> list;
+    auto acc = list.access();
+    memgraph::utils::SkipList<uint64_t>::Finger finger;
+    for (uint64_t i = 0; i < items; ++i) acc.insert(finger, i);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BuildFromSortedRange(benchmark::State &state) {
+  std::vector<uint64_t> items(state.range(0));
+  std::iota(items.begin(), items.end(), 0);
+  for (auto _ : state) {
+    memgraph::utils::SkipList<uint64_t> list(items.begin(), items.end());
+    benchmark::DoNotOptimize(list.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(Insert)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(InsertWithFinger)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BuildFromSortedRange)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,62 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+
+// Throughput of beginning and committing transactions, which contend on the
+// transaction engine of the storage, depending on the number of threads.
+
+namespace {
+
+std::unique_ptr<memgraph::storage::Storage> storage;
+
+void SetUp(const benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    storage = std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+        .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC, .interval = std::chrono::milliseconds(100)}});
+  }
+}
+
+void TearDown(const benchmark::State &state) {
+  if (state.thread_index() == 0) {
+    storage.reset();
+  }
+}
+
+}  // namespace
+
+// Transactions without changes, which only begin and finish.
+static void ReadOnly(benchmark::State &state) {
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Transactions which create a vertex, so they also get a commit timestamp.
+static void Write(benchmark::State &state) {
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    acc->CreateVertex();
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(ReadOnly)->Setup(SetUp)->Teardown(TearDown)->ThreadRange(1, 128)->UseRealTime();
+BENCHMARK(Write)->Setup(SetUp)->Teardown(TearDown)->ThreadRange(1, 128)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,319 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Compares the storage modes under the same operations, driving the storage
+// accessors directly. Each benchmark runs in IN_MEMORY_TRANSACTIONAL,
+// IN_MEMORY_ANALYTICAL and ON_DISK_TRANSACTIONAL mode, on a fresh storage with
+// --vertices vertices and --degree outgoing edges per vertex. The items
+// processed per second are the operations per second. The benchmarks which
+// commit also report the mean and the maximum commit latency, and the
+// Footprint benchmark reports the bytes of memory and disk used per vertex and
+// per edge.
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "storage/v2/disk/storage.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/storage.hpp"
+#include "storage/v2/storage_mode.hpp"
+#include "utils/logging.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(vertices, 100000, "Number of vertices the storage starts with.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(degree, 4, "Number of outgoing edges of each vertex the storage starts with.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(batch, 100, "Number of operations done by each transaction which changes the storage.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(wal, true, "Write the committed transactions of the in-memory transactional mode to WAL files.");
+
+namespace {
+
+using memgraph::storage::StorageMode;
+
+const char *kLabel = "Label";
+const char *kProperty = "property";
+const char *kEdgeType = "Type";
+
+std::filesystem::path StorageDirectory() {
+  return std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_modes";
+}
+
+std::unique_ptr<memgraph::storage::Storage> MakeStorage(StorageMode mode) {
+  std::filesystem::remove_all(StorageDirectory());
+  memgraph::storage::Config config;
+  config.gc.type = memgraph::storage::Config::Gc::Type::PERIODIC;
+  config.gc.interval = std::chrono::milliseconds(100);
+  if (FLAGS_wal) {
+    config.durability.snapshot_wal_mode =
+        memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL;
+  }
+  memgraph::storage::UpdatePaths(config, StorageDirectory());
+  if (mode == StorageMode::ON_DISK_TRANSACTIONAL) {
+    return std::make_unique<memgraph::storage::DiskStorage>(config);
+  }
+  auto storage = std::make_unique<memgraph::storage::InMemoryStorage>(config);
+  storage->SetStorageMode(mode);
+  return storage;
+}
+
+// Creates the vertices, a half of them with the label, all with a property,
+// and the edges between random vertices. Returns the gids of the vertices.
+std::vector<memgraph::storage::Gid> CreateGraph(memgraph::storage::Storage *storage, int vertices, int degree) {
+  std::vector<memgraph::storage::Gid> gids;
+  gids.reserve(vertices);
+  const auto label = storage->NameToLabel(kLabel);
+  const auto property = storage->NameToProperty(kProperty);
+  const auto edge_type = storage->NameToEdgeType(kEdgeType);
+  // Large transactions make the on-disk storage hold all of their changes in
+  // memory, so the graph is created in batches.
+  constexpr int kBatch = 10000;
+  for (int start = 0; start < vertices; start += kBatch) {
+    auto acc = storage->Access();
+    for (int i = start; i < std::min(start + kBatch, vertices); ++i) {
+      auto vertex = acc->CreateVertex();
+      if (i % 2 == 0) MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+      gids.push_back(vertex.Gid());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  std::uniform_int_distribution<size_t> dis(0U, gids.size() - 1U);
+  for (int start = 0; start < vertices; start += kBatch / std::max(degree, 1)) {
+    auto acc = storage->Access();
+    for (int i = start; i < std::min(start + kBatch / std::max(degree, 1), vertices); ++i) {
+      auto from = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+      MG_ASSERT(from);
+      for (int j = 0; j < degree; ++j) {
+        auto to = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::OLD);
+        MG_ASSERT(to);
+        MG_ASSERT(acc->CreateEdge(&*from, &*to, edge_type).HasValue());
+      }
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  return gids;
+}
+
+// Commits the transaction, adding its latency to the commit latency counters.
+void Commit(memgraph::storage::Storage::Accessor *acc, double *total_us, double *max_us) {
+  const auto start = std::chrono::steady_clock::now();
+  MG_ASSERT(!acc->Commit().HasError());
+  const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+  *total_us += elapsed.count();
+  *max_us = std::max(*max_us, elapsed.count());
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void ReportCommits(benchmark::State &state, double total_us, double max_us) {
+  state.counters["commit_us"] = benchmark::Counter(total_us, benchmark::Counter::kAvgIterations);
+  state.counters["commit_max_us"] = max_us;
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void CreateVertices(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  const auto property = storage->NameToProperty(kProperty);
+  double commit_us = 0;
+  double commit_max_us = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    for (int i = 0; i < FLAGS_batch; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    Commit(acc.get(), &commit_us, &commit_max_us);
+  }
+  ReportCommits(state, commit_us, commit_max_us);
+  state.SetItemsProcessed(state.iterations() * FLAGS_batch);
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void CreateEdges(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  const auto gids = CreateGraph(storage.get(), FLAGS_vertices, 0);
+  const auto edge_type = storage->NameToEdgeType(kEdgeType);
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  std::uniform_int_distribution<size_t> dis(0U, gids.size() - 1U);
+  double commit_us = 0;
+  double commit_max_us = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    for (int i = 0; i < FLAGS_batch; ++i) {
+      auto from = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::OLD);
+      auto to = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::OLD);
+      MG_ASSERT(from && to);
+      MG_ASSERT(acc->CreateEdge(&*from, &*to, edge_type).HasValue());
+    }
+    Commit(acc.get(), &commit_us, &commit_max_us);
+  }
+  ReportCommits(state, commit_us, commit_max_us);
+  state.SetItemsProcessed(state.iterations() * FLAGS_batch);
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void SetProperty(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  const auto gids = CreateGraph(storage.get(), FLAGS_vertices, 0);
+  const auto property = storage->NameToProperty(kProperty);
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  std::uniform_int_distribution<size_t> dis(0U, gids.size() - 1U);
+  double commit_us = 0;
+  double commit_max_us = 0;
+  int64_t value = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    for (int i = 0; i < FLAGS_batch; ++i) {
+      auto vertex = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::OLD);
+      MG_ASSERT(vertex);
+      // A vertex may be changed twice by a transaction, which is fine.
+      MG_ASSERT(vertex->SetProperty(property, memgraph::storage::PropertyValue(++value)).HasValue());
+    }
+    Commit(acc.get(), &commit_us, &commit_max_us);
+  }
+  ReportCommits(state, commit_us, commit_max_us);
+  state.SetItemsProcessed(state.iterations() * FLAGS_batch);
+}
+
+// Reads the outgoing edges of random vertices and the vertices they lead to.
+// NOLINTNEXTLINE(google-runtime-references)
+void Expand(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  const auto gids = CreateGraph(storage.get(), FLAGS_vertices, FLAGS_degree);
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  std::uniform_int_distribution<size_t> dis(0U, gids.size() - 1U);
+  auto acc = storage->Access();
+  int64_t edges = 0;
+  for (auto _ : state) {
+    auto vertex = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::OLD);
+    MG_ASSERT(vertex);
+    auto out_edges = vertex->OutEdges(memgraph::storage::View::OLD);
+    MG_ASSERT(out_edges.HasValue());
+    for (const auto &edge : out_edges->edges) {
+      benchmark::DoNotOptimize(edge.ToVertex().Gid());
+      ++edges;
+    }
+  }
+  state.SetItemsProcessed(edges);
+}
+
+// Scans the label index, reading a property of each vertex.
+// NOLINTNEXTLINE(google-runtime-references)
+void IndexScan(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  CreateGraph(storage.get(), FLAGS_vertices, 0);
+  const auto label = storage->NameToLabel(kLabel);
+  const auto property = storage->NameToProperty(kProperty);
+  MG_ASSERT(!storage->CreateIndex(label).HasError());
+  auto acc = storage->Access();
+  int64_t vertices = 0;
+  for (auto _ : state) {
+    for (auto vertex : acc->Vertices(label, memgraph::storage::View::OLD)) {
+      benchmark::DoNotOptimize(vertex.GetProperty(property, memgraph::storage::View::OLD));
+      ++vertices;
+    }
+  }
+  state.SetItemsProcessed(vertices);
+}
+
+// Transactions which create a single vertex, measuring mostly the commit and
+// writing it to the WAL.
+// NOLINTNEXTLINE(google-runtime-references)
+void CommitSmall(benchmark::State &state, StorageMode mode) {
+  auto storage = MakeStorage(mode);
+  double commit_us = 0;
+  double commit_max_us = 0;
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    acc->CreateVertex();
+    Commit(acc.get(), &commit_us, &commit_max_us);
+  }
+  ReportCommits(state, commit_us, commit_max_us);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Memory and disk used per vertex and per edge, measured by creating the
+// graph once. The memory is the resident memory of the process, so it's
+// only accurate for large graphs.
+// NOLINTNEXTLINE(google-runtime-references)
+void Footprint(benchmark::State &state, StorageMode mode) {
+  for (auto _ : state) {
+    auto storage = MakeStorage(mode);
+    auto used = [&storage] {
+      const auto info = storage->GetInfo();
+      return static_cast<double>(info.memory_usage + info.disk_usage);
+    };
+    const auto empty = used();
+    const auto gids = CreateGraph(storage.get(), FLAGS_vertices, 0);
+    const auto with_vertices = used();
+    const auto edge_type = storage->NameToEdgeType(kEdgeType);
+    {
+      auto acc = storage->Access();
+      for (size_t i = 0; i < gids.size(); ++i) {
+        auto from = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+        auto to = acc->FindVertex(gids[(i + 1) % gids.size()], memgraph::storage::View::OLD);
+        MG_ASSERT(from && to);
+        MG_ASSERT(acc->CreateEdge(&*from, &*to, edge_type).HasValue());
+      }
+      MG_ASSERT(!acc->Commit().HasError());
+    }
+    const auto with_edges = used();
+    state.counters["bytes_per_vertex"] = (with_vertices - empty) / static_cast<double>(gids.size());
+    state.counters["bytes_per_edge"] = (with_edges - with_vertices) / static_cast<double>(gids.size());
+  }
+}
+
+const std::pair<const char *, StorageMode> kModes[] = {
+    {"IN_MEMORY_TRANSACTIONAL", StorageMode::IN_MEMORY_TRANSACTIONAL},
+    {"IN_MEMORY_ANALYTICAL", StorageMode::IN_MEMORY_ANALYTICAL},
+    {"ON_DISK_TRANSACTIONAL", StorageMode::ON_DISK_TRANSACTIONAL},
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  MG_ASSERT(FLAGS_vertices > 1 && FLAGS_degree > 0 && FLAGS_batch > 0, "Invalid graph size or batch");
+
+  const std::pair<const char *, void (*)(benchmark::State &, StorageMode)> benchmarks[] = {
+      {"CreateVertices", CreateVertices}, {"CreateEdges", CreateEdges}, {"SetProperty", SetProperty},
+      {"Expand", Expand},                 {"IndexScan", IndexScan},     {"CommitSmall", CommitSmall},
+  };
+  for (const auto &[name, function] : benchmarks) {
+    for (const auto &[mode_name, mode] : kModes) {
+      ::benchmark::RegisterBenchmark(fmt::format("{}/{}", name, mode_name).c_str(), function, mode)
+          ->Unit(benchmark::kMicrosecond);
+    }
+  }
+  for (const auto &[mode_name, mode] : kModes) {
+    ::benchmark::RegisterBenchmark(fmt::format("Footprint/{}", mode_name).c_str(), Footprint, mode)
+        ->Iterations(1)
+        ->Unit(benchmark::kMillisecond);
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  std::filesystem::remove_all(StorageDirectory());
+  return 0;
+}
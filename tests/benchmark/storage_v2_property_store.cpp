@@ -13,6 +13,9 @@
 #include <iostream>
 #include <map>
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -106,4 +109,103 @@ static void StdMapGet(benchmark::State &state) {
 
 BENCHMARK(StdMapGet)->RangeMultiplier(2)->Range(1, 1024)->Unit(benchmark::kNanosecond)->UseRealTime();
 
+///////////////////////////////////////////////////////////////////////////////
+// PropertyStore wide records
+///////////////////////////////////////////////////////////////////////////////
+
+// Fills the store with `num_properties` properties of mixed types, which is
+// what vertices with a lot of properties usually look like.
+static void FillWideStore(memgraph::storage::PropertyStore &store, uint64_t num_properties) {
+  std::vector<std::pair<memgraph::storage::PropertyId, memgraph::storage::PropertyValue>> properties;
+  properties.reserve(num_properties);
+  for (uint64_t i = 0; i < num_properties; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    switch (i % 4) {
+      case 0:
+        properties.emplace_back(prop, memgraph::storage::PropertyValue(static_cast<int64_t>(i * 1000)));
+        break;
+      case 1:
+        properties.emplace_back(prop, memgraph::storage::PropertyValue("value of property " + std::to_string(i)));
+        break;
+      case 2:
+        properties.emplace_back(prop, memgraph::storage::PropertyValue(static_cast<double>(i) / 3));
+        break;
+      case 3:
+        properties.emplace_back(prop, memgraph::storage::PropertyValue(i % 2 == 0));
+        break;
+    }
+  }
+  store.InitProperties(std::move(properties));
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreWideGet(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  FillWideStore(store, state.range(0));
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<uint64_t> dist(0, state.range(0) - 1);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
+    benchmark::DoNotOptimize(store.GetProperty(prop));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreWideGet)->DenseRange(8, 128, 24)->Unit(benchmark::kNanosecond)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreWideHas(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  FillWideStore(store, state.range(0));
+  std::mt19937 gen(state.thread_index());
+  // Half of the looked up properties don't exist.
+  std::uniform_int_distribution<uint64_t> dist(0, state.range(0) * 2 - 1);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
+    benchmark::DoNotOptimize(store.HasProperty(prop));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreWideHas)->DenseRange(8, 128, 24)->Unit(benchmark::kNanosecond)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreWideIsPropertyEqual(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  FillWideStore(store, state.range(0));
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<uint64_t> dist(0, state.range(0) - 1);
+  const memgraph::storage::PropertyValue value(42);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
+    benchmark::DoNotOptimize(store.IsPropertyEqual(prop, value));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreWideIsPropertyEqual)->DenseRange(8, 128, 24)->Unit(benchmark::kNanosecond)->UseRealTime();
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void PropertyStoreWideUpdate(benchmark::State &state) {
+  memgraph::storage::PropertyStore store;
+  FillWideStore(store, state.range(0));
+  std::mt19937 gen(state.thread_index());
+  std::uniform_int_distribution<uint64_t> dist(0, state.range(0) - 1);
+  uint64_t counter = 0;
+  while (state.KeepRunning()) {
+    auto prop = memgraph::storage::PropertyId::FromUint(dist(gen));
+    store.SetProperty(prop, memgraph::storage::PropertyValue(static_cast<int64_t>(counter)));
+    ++counter;
+  }
+  state.SetItemsProcessed(counter);
+}
+
+BENCHMARK(PropertyStoreWideUpdate)->DenseRange(8, 128, 24)->Unit(benchmark::kNanosecond)->UseRealTime();
+
 BENCHMARK_MAIN();
@@ -0,0 +1,231 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Measures the recovery of the in-memory storage. A dataset of the configured
+// size and schema is written once as a snapshot followed by a WAL tail, and
+// then recovered with 1 to --max_threads recovery threads. Besides the total
+// time, the time of each phase of the recovery is reported in milliseconds:
+// the edges, vertices and connectivity from the snapshot, replaying the WAL
+// and creating the indices and constraints.
+
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "storage/v2/durability/durability.hpp"
+#include "storage/v2/durability/paths.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/logging.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(vertices, 1000000, "Number of vertices in the snapshot.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(degree, 4, "Number of outgoing edges of each vertex in the snapshot.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(labels, 4, "Number of distinct labels, each vertex has one of them.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(properties, 4, "Number of properties of each vertex.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(edge_properties, true, "Store a property on each edge.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(indices, true, "Create a label index for each label and a label+property index for each property.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(constraints, true, "Create an existence and a unique constraint.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(wal_transactions, 10000,
+             "Number of transactions committed after the snapshot, each creating a vertex and an edge.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(max_threads, 8, "Recovery is measured with 1, 2, 4, ... up to this many threads.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(items_per_batch, 100000, "Number of objects recovered by a thread at once.");
+
+namespace {
+
+std::filesystem::path StorageDirectory() {
+  return std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_recovery";
+}
+
+memgraph::storage::Config MakeConfig() {
+  memgraph::storage::Config config;
+  config.items.properties_on_edges = FLAGS_edge_properties;
+  config.durability.snapshot_wal_mode =
+      memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL;
+  // The snapshot is only made explicitly.
+  config.durability.snapshot_interval = std::chrono::hours(24);
+  config.durability.items_per_batch = FLAGS_items_per_batch;
+  memgraph::storage::UpdatePaths(config, StorageDirectory());
+  return config;
+}
+
+std::string PropertyName(int i) { return "p" + std::to_string(i); }
+
+// Every vertex has the unique `id` property, one of the labels and the
+// properties with values from a few distinct ones. The constraints are on the
+// first label.
+void CreateDataset() {
+  std::filesystem::remove_all(StorageDirectory());
+  std::unique_ptr<memgraph::storage::Storage> storage =
+      std::make_unique<memgraph::storage::InMemoryStorage>(MakeConfig());
+  const auto id = storage->NameToProperty("id");
+  const auto weight = storage->NameToProperty("weight");
+  const auto edge_type = storage->NameToEdgeType("Edge");
+  std::vector<memgraph::storage::LabelId> labels;
+  for (int i = 0; i < FLAGS_labels; ++i) labels.push_back(storage->NameToLabel("L" + std::to_string(i)));
+  std::vector<memgraph::storage::PropertyId> properties;
+  for (int i = 0; i < FLAGS_properties; ++i) properties.push_back(storage->NameToProperty(PropertyName(i)));
+
+  if (FLAGS_indices) {
+    for (const auto label : labels) MG_ASSERT(!storage->CreateIndex(label).HasError());
+    for (const auto property : properties) MG_ASSERT(!storage->CreateIndex(labels[0], property).HasError());
+  }
+  if (FLAGS_constraints) {
+    MG_ASSERT(!storage->CreateExistenceConstraint(labels[0], id, {}).HasError());
+    MG_ASSERT(!storage->CreateUniqueConstraint(labels[0], {id}, {}).HasError());
+  }
+
+  // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+  std::mt19937_64 rg(42);
+  std::vector<memgraph::storage::Gid> gids;
+  gids.reserve(FLAGS_vertices + FLAGS_wal_transactions);
+  auto create_vertex = [&](memgraph::storage::Storage::Accessor *acc, int64_t i) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(vertex.AddLabel(labels[i % labels.size()]).HasValue());
+    MG_ASSERT(vertex.SetProperty(id, memgraph::storage::PropertyValue(i)).HasValue());
+    for (size_t j = 0; j < properties.size(); ++j) {
+      MG_ASSERT(vertex.SetProperty(properties[j], memgraph::storage::PropertyValue(static_cast<int64_t>(i % 100 + j)))
+                    .HasValue());
+    }
+    gids.push_back(vertex.Gid());
+    return vertex;
+  };
+  auto create_edge = [&](memgraph::storage::Storage::Accessor *acc, memgraph::storage::VertexAccessor *from) {
+    std::uniform_int_distribution<size_t> dis(0U, gids.size() - 1U);
+    auto to = acc->FindVertex(gids[dis(rg)], memgraph::storage::View::NEW);
+    MG_ASSERT(to);
+    auto edge = acc->CreateEdge(from, &*to, edge_type);
+    MG_ASSERT(edge.HasValue());
+    if (FLAGS_edge_properties) {
+      MG_ASSERT(edge->SetProperty(weight, memgraph::storage::PropertyValue(static_cast<int64_t>(dis(rg)))).HasValue());
+    }
+  };
+
+  constexpr int kBatch = 10000;
+  for (int start = 0; start < FLAGS_vertices; start += kBatch) {
+    auto acc = storage->Access();
+    for (int i = start; i < std::min(start + kBatch, FLAGS_vertices); ++i) create_vertex(acc.get(), i);
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  for (int start = 0; start < FLAGS_vertices; start += kBatch) {
+    auto acc = storage->Access();
+    for (int i = start; i < std::min(start + kBatch, FLAGS_vertices); ++i) {
+      auto from = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+      MG_ASSERT(from);
+      for (int j = 0; j < FLAGS_degree; ++j) create_edge(acc.get(), &*from);
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  MG_ASSERT(!static_cast<memgraph::storage::InMemoryStorage *>(storage.get())->CreateSnapshot({false}).HasError());
+
+  for (int i = 0; i < FLAGS_wal_transactions; ++i) {
+    auto acc = storage->Access();
+    auto vertex = create_vertex(acc.get(), FLAGS_vertices + i);
+    create_edge(acc.get(), &vertex);
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void Recovery(benchmark::State &state) {
+  auto config = MakeConfig();
+  config.durability.recovery_thread_count = state.range(0);
+  config.durability.allow_parallel_index_creation = state.range(0) > 1;
+  const auto &directory = config.durability.storage_directory;
+  const auto snapshot_directory = directory / memgraph::storage::durability::kSnapshotDirectory;
+  const auto wal_directory = directory / memgraph::storage::durability::kWalDirectory;
+
+  std::chrono::microseconds snapshot_edges{0};
+  std::chrono::microseconds snapshot_vertices{0};
+  std::chrono::microseconds snapshot_connectivity{0};
+  std::chrono::microseconds wal{0};
+  std::chrono::microseconds indices_constraints{0};
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto vertices = std::make_unique<memgraph::utils::SkipList<memgraph::storage::Vertex>>();
+    auto edges = std::make_unique<memgraph::utils::SkipList<memgraph::storage::Edge>>();
+    auto name_id_mapper = std::make_unique<memgraph::storage::NameIdMapper>();
+    auto indices = std::make_unique<memgraph::storage::Indices>(
+        config, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL);
+    auto constraints = std::make_unique<memgraph::storage::Constraints>(
+        config, memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL);
+    std::atomic<uint64_t> edge_count{0};
+    std::string uuid;
+    std::string epoch_id;
+    std::deque<std::pair<std::string, uint64_t>> epoch_history;
+    uint64_t wal_seq_num{0};
+    state.ResumeTiming();
+
+    const auto info = memgraph::storage::durability::RecoverData(
+        snapshot_directory, wal_directory, &uuid, &epoch_id, &epoch_history, vertices.get(), edges.get(), &edge_count,
+        name_id_mapper.get(), indices.get(), constraints.get(), config, &wal_seq_num);
+
+    state.PauseTiming();
+    MG_ASSERT(info, "Nothing was recovered");
+    snapshot_edges += info->durations.snapshot_edges;
+    snapshot_vertices += info->durations.snapshot_vertices;
+    snapshot_connectivity += info->durations.snapshot_connectivity;
+    wal += info->durations.wal;
+    indices_constraints += info->durations.indices_constraints;
+    // The recovered data is freed outside of the measured time.
+    indices.reset();
+    constraints.reset();
+    edges.reset();
+    vertices.reset();
+    state.ResumeTiming();
+  }
+
+  auto report = [&state](const char *name, std::chrono::microseconds duration) {
+    state.counters[name] = benchmark::Counter(static_cast<double>(duration.count()) / 1000.0,
+                                              benchmark::Counter::kAvgIterations);
+  };
+  report("snapshot_edges_ms", snapshot_edges);
+  report("snapshot_vertices_ms", snapshot_vertices);
+  report("snapshot_connectivity_ms", snapshot_connectivity);
+  report("wal_ms", wal);
+  report("indices_constraints_ms", indices_constraints);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  MG_ASSERT(FLAGS_vertices > 0 && FLAGS_degree >= 0 && FLAGS_labels > 0 && FLAGS_properties >= 0 &&
+                FLAGS_wal_transactions >= 0 && FLAGS_max_threads > 0,
+            "Invalid dataset size");
+
+  CreateDataset();
+  ::benchmark::RegisterBenchmark("Recovery", Recovery)
+      ->RangeMultiplier(2)
+      ->Range(1, FLAGS_max_threads)
+      ->ArgName("threads")
+      ->UseRealTime()
+      ->Unit(benchmark::kMillisecond);
+  ::benchmark::RunSpecifiedBenchmarks();
+  std::filesystem::remove_all(StorageDirectory());
+  return 0;
+}
@@ -0,0 +1,218 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Measures replication between in-process storages, a MAIN and up to
+// --replicas REPLICAs listening on consecutive ports from --port.
+//
+// Commit/<mode>/replicas:<n> commits write transactions on MAIN with n
+// replicas in SYNC or ASYNC mode; comparing it to replicas:0 gives the commit
+// latency overhead. The commit timestamp lag of the replicas is sampled every
+// --lag_sample_every commits and reported as its mean and maximum, and the
+// time the replicas need to apply the remaining transactions after the last
+// commit as drain_ms.
+//
+// CatchUp/<wal|snapshot> stops a replica, commits --catch_up_transactions on
+// MAIN and measures the time from registering the restarted replica until it
+// is ready. With `wal` the replica recovers its own data and gets the missing
+// transactions from the WAL files of MAIN. With `snapshot` it starts empty
+// after MAIN made a snapshot, so it gets the snapshot first.
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <gflags/gflags.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/replication/config.hpp"
+#include "storage/v2/replication/enums.hpp"
+#include "utils/logging.hpp"
+#include "utils/timer.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(replicas, 2, "Commits are measured with 0 up to this many replicas.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(port, 10000, "Port of the first replica, the others use the following ports.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(transaction_size, 10, "Number of vertices created by each transaction.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(lag_sample_every, 100, "Number of commits between the samples of the replication lag.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(catch_up_transactions, 10000, "Number of transactions a stopped replica has to catch up with.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_int32(catch_up_iterations, 3, "Number of times the catch up is measured.");
+
+namespace {
+
+using memgraph::storage::replication::ReplicaState;
+using memgraph::storage::replication::ReplicationMode;
+
+const std::string kLocalHost = "127.0.0.1";
+
+std::filesystem::path StorageDirectory() {
+  return std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_replication";
+}
+
+std::unique_ptr<memgraph::storage::InMemoryStorage> MakeStorage(const std::string &name, bool recover = false) {
+  memgraph::storage::Config config;
+  config.durability.storage_directory = StorageDirectory() / name;
+  config.durability.snapshot_wal_mode =
+      memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL;
+  // The snapshots are only made explicitly.
+  config.durability.snapshot_interval = std::chrono::hours(24);
+  config.durability.recover_on_startup = recover;
+  return std::make_unique<memgraph::storage::InMemoryStorage>(config);
+}
+
+std::string ReplicaName(int i) { return "REPLICA" + std::to_string(i); }
+
+memgraph::io::network::Endpoint ReplicaEndpoint(int i) {
+  return memgraph::io::network::Endpoint{kLocalHost, static_cast<uint16_t>(FLAGS_port + i)};
+}
+
+std::unique_ptr<memgraph::storage::InMemoryStorage> StartReplica(int i, bool recover = false) {
+  auto replica = MakeStorage(ReplicaName(i), recover);
+  MG_ASSERT(replica->SetReplicaRole(ReplicaEndpoint(i), memgraph::storage::replication::ReplicationServerConfig{}),
+            "Couldn't start {}", ReplicaName(i));
+  return replica;
+}
+
+void RegisterReplica(memgraph::storage::InMemoryStorage *main, int i, ReplicationMode mode) {
+  MG_ASSERT(!main->RegisterReplica(ReplicaName(i), ReplicaEndpoint(i), mode,
+                                   memgraph::storage::replication::RegistrationMode::MUST_BE_INSTANTLY_VALID,
+                                   memgraph::storage::replication::ReplicationClientConfig{})
+                 .HasError(),
+            "Couldn't register {}", ReplicaName(i));
+}
+
+void WaitUntilReady(memgraph::storage::InMemoryStorage *main, int i) {
+  while (main->GetReplicaState(ReplicaName(i)) != ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void Write(memgraph::storage::Storage *storage, int64_t value) {
+  const auto property = storage->NameToProperty("value");
+  auto acc = storage->Access();
+  for (int i = 0; i < FLAGS_transaction_size; ++i) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(vertex.SetProperty(property, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  MG_ASSERT(!acc->Commit().HasError());
+}
+
+// Returns the largest commit timestamp lag of the replicas.
+uint64_t MaxLag(memgraph::storage::InMemoryStorage *main) {
+  uint64_t lag = 0;
+  for (const auto &metrics : main->ReplicasMetrics()) lag = std::max(lag, metrics.commit_timestamp_lag);
+  return lag;
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void Commit(benchmark::State &state, ReplicationMode mode) {
+  std::filesystem::remove_all(StorageDirectory());
+  const auto replica_count = static_cast<int>(state.range(0));
+  std::vector<std::unique_ptr<memgraph::storage::InMemoryStorage>> replicas;
+  for (int i = 0; i < replica_count; ++i) replicas.push_back(StartReplica(i));
+  auto main = MakeStorage("main");
+  for (int i = 0; i < replica_count; ++i) RegisterReplica(main.get(), i, mode);
+
+  int64_t commits = 0;
+  uint64_t lag_sum = 0;
+  uint64_t lag_samples = 0;
+  uint64_t max_lag = 0;
+  for (auto _ : state) {
+    Write(main.get(), commits);
+    if (replica_count > 0 && ++commits % FLAGS_lag_sample_every == 0) {
+      state.PauseTiming();
+      const auto lag = MaxLag(main.get());
+      lag_sum += lag;
+      ++lag_samples;
+      max_lag = std::max(max_lag, lag);
+      state.ResumeTiming();
+    }
+  }
+
+  memgraph::utils::Timer drain_timer;
+  while (replica_count > 0 && MaxLag(main.get()) > 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  state.counters["drain_ms"] = drain_timer.Elapsed<std::chrono::duration<double, std::milli>>().count();
+  state.counters["mean_lag"] = lag_samples == 0 ? 0.0 : static_cast<double>(lag_sum) / lag_samples;
+  state.counters["max_lag"] = static_cast<double>(max_lag);
+  state.SetItemsProcessed(state.iterations());
+
+  main.reset();
+  replicas.clear();
+  std::filesystem::remove_all(StorageDirectory());
+}
+
+// NOLINTNEXTLINE(google-runtime-references)
+void CatchUp(benchmark::State &state, bool from_snapshot) {
+  uint64_t recovery_steps = 0;
+  for (auto _ : state) {
+    std::filesystem::remove_all(StorageDirectory());
+    auto replica = StartReplica(0);
+    auto main = MakeStorage("main");
+    RegisterReplica(main.get(), 0, ReplicationMode::SYNC);
+    for (int i = 0; i < FLAGS_catch_up_transactions; ++i) Write(main.get(), i);
+
+    MG_ASSERT(main->UnregisterReplica(ReplicaName(0)));
+    replica.reset();
+    for (int i = 0; i < FLAGS_catch_up_transactions; ++i) Write(main.get(), i);
+    if (from_snapshot) {
+      MG_ASSERT(!main->CreateSnapshot({false}).HasError());
+      std::filesystem::remove_all(StorageDirectory() / ReplicaName(0));
+    }
+    replica = StartReplica(0, !from_snapshot);
+
+    memgraph::utils::Timer timer;
+    RegisterReplica(main.get(), 0, ReplicationMode::SYNC);
+    WaitUntilReady(main.get(), 0);
+    state.SetIterationTime(timer.Elapsed().count());
+
+    recovery_steps = main->ReplicasMetrics()[0].recovery_steps_total;
+    main.reset();
+    replica.reset();
+  }
+  state.counters["recovery_steps"] = static_cast<double>(recovery_steps);
+  std::filesystem::remove_all(StorageDirectory());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  MG_ASSERT(FLAGS_replicas >= 0 && FLAGS_transaction_size > 0 && FLAGS_lag_sample_every > 0 &&
+                FLAGS_catch_up_transactions > 0 && FLAGS_catch_up_iterations > 0,
+            "Invalid arguments");
+
+  for (const auto &[name, mode] : {std::make_pair("SYNC", ReplicationMode::SYNC),
+                                   std::make_pair("ASYNC", ReplicationMode::ASYNC)}) {
+    ::benchmark::RegisterBenchmark(fmt::format("Commit/{}", name).c_str(), Commit, mode)
+        ->DenseRange(0, FLAGS_replicas)
+        ->ArgName("replicas")
+        ->Unit(benchmark::kMicrosecond);
+  }
+  for (const auto &[name, from_snapshot] : {std::make_pair("wal", false), std::make_pair("snapshot", true)}) {
+    ::benchmark::RegisterBenchmark(fmt::format("CatchUp/{}", name).c_str(), CatchUp, from_snapshot)
+        ->Iterations(FLAGS_catch_up_iterations)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
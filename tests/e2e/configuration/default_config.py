@@ -14,6 +14,17 @@
 # If you wish to modify these, update the startup_config_dict and workloads.yaml !
 
 startup_config_dict = {
+    "after_commit_trigger_batch_size": (
+        "1",
+        "1",
+        "Maximum number of committed transactions whose changes are merged into a single run of the after commit triggers.",
+    ),
+    "after_commit_trigger_queue_size": (
+        "0",
+        "0",
+        "Maximum number of committed transactions waiting for their after commit triggers. Committing transactions wait while the queue is full. With 0, the queue isn't limited.",
+    ),
+    "after_commit_trigger_threads": ("1", "1", "Number of threads running the after commit triggers."),
     "auth_module_create_missing_role": ("true", "true", "Set to false to disable creation of missing roles."),
     "auth_module_create_missing_user": ("true", "true", "Set to false to disable creation of missing users."),
     "auth_module_executable": ("", "", "Absolute path to the auth module executable that should be used."),
@@ -27,6 +38,11 @@ startup_config_dict = {
         "10000",
         "Timeout (in milliseconds) used when waiting for a response from the auth module.",
     ),
+    "auth_password_cache_ttl_sec": (
+        "60",
+        "60",
+        "Time (in seconds) for which a verified password is recognized by its keyed digest instead of being hashed again on login. Set to 0 to verify the password on every login.",
+    ),
     "auth_password_permit_null": ("true", "true", "Set to false to disable null passwords."),
     "auth_password_strength_regex": (
         ".+",
@@ -34,6 +50,11 @@ startup_config_dict = {
         "The regular expression that should be used to match the entire entered password to ensure its strength.",
     ),
     "allow_load_csv": ("true", "true", "Controls whether LOAD CSV clause is allowed in queries."),
+    "audit_buffer_drop_when_full": (
+        "false",
+        "false",
+        "Set to true to drop the audit log entries recorded while the audit log buffer is full instead of blocking the queries until the buffer is flushed.",
+    ),
     "audit_buffer_flush_interval_ms": (
         "200",
         "200",
@@ -54,6 +75,46 @@ startup_config_dict = {
         "12",
         "Number of workers used by the Bolt server. By default, this will be the number of processing units available on the machine.",
     ),
+    "bolt_num_io_workers": (
+        "1",
+        "1",
+        "Number of workers which accept the Bolt connections and read from them. The queries are executed by the workers set by bolt_num_workers.",
+    ),
+    "bolt_io_context_per_worker": (
+        "false",
+        "false",
+        "Each Bolt I/O worker runs its own event loop pinned to a processing unit, and accepts connections with its own socket bound using SO_REUSEPORT. A connection is handled by the same worker for its lifetime.",
+    ),
+    "bolt_numa_aware_workers": (
+        "false",
+        "false",
+        "Spread the Bolt workers across the NUMA nodes, pinning each to the processing units of its node and giving each node its own memory arena, so the data created by the queries is placed on the node of the worker which creates it.",
+    ),
+    "bolt_long_execution_ms": (
+        "1000",
+        "1000",
+        "Bolt sessions whose previous execution took longer than this number of milliseconds are executed with a lower priority, and can't occupy all of the Bolt workers.",
+    ),
+    "bolt_max_executing_per_client": (
+        "0",
+        "0",
+        "Maximum number of queries of a single user executed by the Bolt workers at once. The other queries of the user wait while the queries of other users are executed. 0 for no limit.",
+    ),
+    "bolt_max_queued_per_client": (
+        "0",
+        "0",
+        "Maximum number of queries of a single user waiting for the Bolt workers. Further queries of the user fail immediately with a transient error. 0 for no limit.",
+    ),
+    "bolt_fair_share_by_database": (
+        "false",
+        "false",
+        "The Bolt workers are shared fairly between the databases instead of the users, and the limits on the queries of a user apply to the database of the session.",
+    ),
+    "bolt_fair_share_by_role": (
+        "false",
+        "false",
+        "The Bolt workers are shared fairly between the roles instead of the users, and the limits on the queries of a user apply to their role.",
+    ),
     "bolt_port": ("7687", "7687", "Port on which the Bolt server should listen."),
     "bolt_server_name_for_init": (
         "",
@@ -81,6 +142,11 @@ startup_config_dict = {
         "",
         "List of default Kafka brokers as a comma separated list of broker host or host:port.",
     ),
+    "kafka_stream_max_in_flight_batches": (
+        "1",
+        "1",
+        "Maximum number of batches a Kafka stream polls before the previous ones are processed. With more than 1, the next batches are polled while the current one is transformed and committed.",
+    ),
     "log_file": ("", "", "Path to where the log should be stored."),
     "log_level": (
         "WARNING",
@@ -103,16 +169,32 @@ startup_config_dict = {
         "IP address on which the Memgraph server for exposing metrics should listen.",
     ),
     "metrics_port": ("9091", "9091", "Port on which the Memgraph server for exposing metrics should listen."),
+    "metrics_query_fingerprints": (
+        "100",
+        "100",
+        "Number of the most frequently executed query fingerprints whose latency histograms and counters are exposed as metrics. Value of 0 disables the fingerprint metrics.",
+    ),
     "monitoring_address": (
         "0.0.0.0",
         "0.0.0.0",
         "IP address on which the websocket server for Memgraph monitoring should listen.",
     ),
     "monitoring_port": ("7444", "7444", "Port on which the websocket server for Memgraph monitoring should listen."),
+    "storage_background_index_recovery": (
+        "false",
+        "false",
+        "Create the recovered label and label+property indices in the background, so queries can be served as soon as the data is recovered. Queries don't use an index until it's created.",
+    ),
+    "storage_recover_to_timestamp": (
+        "0",
+        "0",
+        "Recover only the transactions committed at or before this commit timestamp. The snapshots and WAL files with later transactions are moved to the .backup directory. Set to 0 to recover everything.",
+    ),
     "storage_parallel_index_recovery": (
         "false",
         "false",
-        "Controls whether the index creation can be done in a multithreaded fashion.",
+        "Controls whether the index creation, both on recovery and on CREATE INDEX, can be done in a multithreaded "
+        "fashion.",
     ),
     "password_encryption_algorithm": ("bcrypt", "bcrypt", "The password encryption algorithm used for authentication."),
     "pulsar_service_url": ("", "", "Default URL used while connecting to Pulsar brokers."),
@@ -121,22 +203,153 @@ startup_config_dict = {
         "-1",
         "Maximum allowed query execution time. Queries exceeding this limit will be aborted. Value of 0 means no limit.",
     ),
+    "query_memory_limit_per_database_mb": (
+        "0",
+        "0",
+        "Maximum memory in megabytes which the executing queries of a single database allocate at once, so that the queries of one database can't take the memory of the others. Value of 0 limits the queries only by the total memory limit.",
+    ),
+    "query_memory_limit_per_user_mb": (
+        "0",
+        "0",
+        "Maximum memory in megabytes which the transactions of a single user allocate at once in a database. Value of 0 limits the transactions only by the memory limit of the database.",
+    ),
     "query_modules_directory": (
         "",
         "",
         "Directory where modules with custom query procedures are stored. NOTE: Multiple comma-separated directories can be defined.",
     ),
+    "query_modules_lazy_loading": (
+        "false",
+        "false",
+        "Load each query module when it's first used instead of loading all of them on startup and on mg.load_all(). The commit hooks of a module only run once it's loaded.",
+    ),
+    "query_parallel_execution_threads": (
+        "0",
+        "0",
+        "Number of threads helping to execute parts of read-only queries, such as scans followed by an aggregation, in parallel. Value of 0 executes each query on a single thread.",
+    ),
+    "query_prefetch_rows": (
+        "1000",
+        "1000",
+        "Maximum number of results of a read-only query computed ahead of the client's next PULL while the previous results are sent. Value of 0 computes the results only when they are pulled.",
+    ),
+    "query_procedure_cache_mb": (
+        "64",
+        "64",
+        "Maximum memory in megabytes taken by the cached records of the procedures which their modules declare deterministic. Value of 0 disables the cache.",
+    ),
+    "query_pull_batch_size": (
+        "256",
+        "256",
+        "Number of rows pulled at once by the query operators of read-only queries. Value of 0 pulls the rows one at a time.",
+    ),
+    "query_result_cache_mb": (
+        "0",
+        "0",
+        "Maximum memory in megabytes taken by the cached results of read-only queries, which are reused by the same queries with the same parameters while the database doesn't change. Value of 0 disables the cache.",
+    ),
+    "query_slow_log_sample_rate": (
+        "1",
+        "1",
+        "Fraction of the queries taking at least --query-slow-log-threshold-ms which are recorded by the slow query log. Value of 0 disables the log.",
+    ),
+    "query_slow_log_size": (
+        "1000",
+        "1000",
+        "Number of the most recent slow queries of each database kept in memory for SHOW SLOW QUERIES. Value of 0 disables the slow query log.",
+    ),
+    "query_slow_log_threshold_ms": (
+        "1000",
+        "1000",
+        "Queries taking at least this many milliseconds are recorded by the slow query log, which keeps the recent ones for SHOW SLOW QUERIES and writes them to files under the data directory.",
+    ),
+    "query_spill_threshold_mb": (
+        "0",
+        "0",
+        "Maximum memory in megabytes which the aggregations, orderings and DISTINCT clauses of a query keep before spilling their rows to temporary files under the data directory. Value of 0 keeps all rows in memory.",
+    ),
+    "replication_bookmark_wait_timeout_ms": (
+        "5000",
+        "5000",
+        "The time a transaction started with bookmarks waits for the instance (usually a REPLICA) to catch up with them before it fails.",
+    ),
+    "replication_sync_quorum": (
+        "0",
+        "0",
+        "The number of SYNC replicas which must apply a transaction before its commit succeeds. The responses of the replicas are awaited concurrently. 0 waits for all SYNC replicas.",
+    ),
     "replication_replica_check_frequency_sec": (
         "1",
         "1",
         "The time duration between two replica checks/pings. If < 1, replicas will NOT be checked at all. NOTE: The MAIN instance allocates a new thread for each REPLICA.",
     ),
+    "storage_dictionary_encoded_properties": (
+        "",
+        "",
+        "Comma-separated list of properties whose string values are stored only once, in a dictionary shared by all vertices and edges. Use it for properties with a limited number of distinct values. Ignored by the on-disk storage.",
+    ),
+    "storage_disk_block_cache_percent": (
+        "10",
+        "10",
+        "Percentage of the memory limit used for the RocksDB block cache of the on-disk storage when a non-default workload profile is set.",
+    ),
+    "storage_disk_reference_indices": (
+        "false",
+        "false",
+        "Controls whether the label and label+property indices of the on-disk storage store only references to the vertices, which are read from the main storage, instead of copies of their labels and properties.",
+    ),
+    "storage_disk_sst_ingestion_min_objects": (
+        "100000",
+        "100000",
+        "Commits to the on-disk storage which only create at least this many vertices and edges, such as imports, are sorted into SST files which are ingested into RocksDB. Set to 0 to disable it.",
+    ),
+    "storage_disk_vertex_cache_mib": (
+        "64",
+        "64",
+        "Memory in MiB for the vertices read from the on-disk storage which are cached across transactions. Set to 0 to disable the cache.",
+    ),
+    "storage_disk_workload_profile": (
+        "DEFAULT",
+        "DEFAULT",
+        "RocksDB options of the on-disk storage, tuned for the expected workload. Allowed values: DEFAULT, POINT_LOOKUPS, SCANS",
+    ),
+    "storage_disk_write_stall_timeout_ms": (
+        "10000",
+        "10000",
+        "Time in milliseconds a commit to the on-disk storage waits while RocksDB stalls writes until its compactions catch up, after which it fails with a retryable error. Set to 0 to wait indefinitely.",
+    ),
+    "storage_gc_compact_delta_chains": (
+        "false",
+        "false",
+        "Controls whether the storage garbage collector removes property versions which no active transaction can see from delta chains that are kept alive by long-running transactions.",
+    ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_thread_count": ("1", "1", "The number of threads used by the storage garbage collector."),
+    "storage_gc_time_slice_ms": (
+        "0",
+        "0",
+        "Maximum time (in milliseconds) a storage garbage collector cycle unlinks deltas before it releases the storage lock and continues in a new slice. Set to 0 to disable slicing.",
+    ),
     "storage_items_per_batch": (
         "1000000",
         "1000000",
         "The number of edges and vertices stored in a batch in a snapshot file.",
     ),
+    "storage_lazy_database_loading": (
+        "false",
+        "false",
+        "If set to true the databases other than the default one are recovered when they are first used instead of on startup.",
+    ),
+    "storage_packed_index_merge_threshold": (
+        "0",
+        "0",
+        "Keep label+property indices in packed, sorted arrays and merge recent writes into them during garbage collection once at least this many of them accumulate. Use it for labels which are mostly read. Set to 0 to disable. Ignored by the on-disk storage.",
+    ),
+    "storage_properties_on_edge_types": (
+        "",
+        "",
+        "Comma-separated list of edge types whose edges have properties when --storage-properties-on-edges is off. The edges of the other types are stored only as references in their vertices. The list must stay the same between restarts. Ignored by the on-disk storage.",
+    ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
     "storage_snapshot_interval_sec": (
@@ -144,8 +357,28 @@ startup_config_dict = {
         "300",
         "Storage snapshot creation interval (in seconds). Set to 0 to disable periodic snapshot creation.",
     ),
+    "storage_snapshot_max_increments": (
+        "0",
+        "0",
+        "The number of incremental snapshots, which store only the vertices and edges changed since the previous snapshot, created after each full snapshot. Set to 0 to create only full snapshots.",
+    ),
     "storage_snapshot_on_exit": ("false", "false", "Controls whether the storage creates another snapshot on exit."),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_snapshot_thread_count": (
+        "1",
+        "1",
+        "The number of threads used to create snapshots. Each thread encodes batches of --storage-items-per-batch vertices or edges.",
+    ),
+    "storage_snapshot_write_mib_per_sec": (
+        "0",
+        "0",
+        "Limit the rate at which snapshots are written to this many MiB per second, so that they don't delay the WAL syncs of commits. While limited, snapshot writes also wait for the WAL syncs in progress. Set to 0 to write snapshots as fast as possible.",
+    ),
+    "storage_unload_idle_databases_sec": (
+        "0",
+        "0",
+        "Databases other than the default one without sessions and streams for this many seconds are snapshotted and unloaded, and recovered again when they are used. Set to 0 to disable it.",
+    ),
     "storage_wal_enabled": (
         "false",
         "true",
@@ -157,6 +390,22 @@ startup_config_dict = {
         "Issue a 'fsync' call after this amount of transactions are written to the WAL file. Set to 1 for fully synchronous operation.",
     ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Make every commit durable before it returns, syncing the WAL of concurrent commits with a single 'fsync' call on a dedicated thread. Overrides --storage-wal-file-flush-every-n-tx.",
+    ),
+    "storage_wal_preallocated_files": (
+        "0",
+        "0",
+        "Number of empty files with the space of a WAL file preallocated which are kept ready for new WAL files. Set to 0 to disable preallocation.",
+    ),
+    "storage_wal_direct_io": ("false", "false", "Write WAL files with direct I/O (O_DIRECT), bypassing the page cache."),
+    "storage_durability_compression": (
+        "false",
+        "false",
+        "Compress the objects written to snapshots and the transactions written to WAL files with zlib.",
+    ),
     "storage_delete_on_drop": (
         "true",
         "true",
@@ -185,6 +434,21 @@ startup_config_dict = {
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_max_estimated_memory_mib": (
+        "0",
+        "0",
+        "Queries whose plans are estimated to keep more memory than this number of MiB in operators which collect their input, like aggregations and orderings, are rejected. With 0, no query is rejected.",
+    ),
+    "query_planning_threads": (
+        "0",
+        "0",
+        "Number of threads estimating the costs of the alternative plans of a query. With 0, the costs are estimated by the thread planning the query.",
+    ),
+    "query_plan_cost_bound": (
+        "0",
+        "0",
+        "The cost planner stops considering the alternative plans of a query once it finds a plan whose estimated cost is at most this bound. With 0, all of the plans are considered.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "init_file": (
         "",
@@ -202,9 +466,19 @@ startup_config_dict = {
         "",
         "The path to mappings that describes aliases to callables in cypher queries in the form of key-value pairs in a json file. With this option query module procedures that do not exist in memgraph can be mapped to ones that exist.",
     ),
+    "query_cost_model_path": (
+        "",
+        "",
+        "The path to a json file with the costs of processing a row by each query operator, which the query planner uses instead of the default ones. The file can be made on the host by the cost_calibration benchmark.",
+    ),
     "delta_chain_cache_threshold": (
         "128",
         "128",
         "The threshold for when to cache long delta chains. This is used for heavy read + write workloads where repeated processing of delta chains can become costly.",
     ),
+    "delta_chain_shared_cache_size": (
+        "65536",
+        "65536",
+        "The maximum number of vertex versions rebuilt from long delta chains which are shared between all transactions. Set to 0 to disable the shared cache.",
+    ),
 }
@@ -21,6 +21,25 @@ def test_import_mode_disabled_for_in_memory_storages():
         execute_and_fetch_all(cursor, "EDGE IMPORT MODE ACTIVE")
 
 
+def test_import_mode_in_memory_analytical():
+    cursor = connect().cursor()
+    execute_and_fetch_all(cursor, "STORAGE MODE IN_MEMORY_ANALYTICAL")
+    execute_and_fetch_all(cursor, "CREATE (u:User {id: 1})")
+    execute_and_fetch_all(cursor, "CREATE (u:User {id: 2})")
+    execute_and_fetch_all(cursor, "EDGE IMPORT MODE ACTIVE")
+    execute_and_fetch_all(
+        cursor, "MATCH (u1:User {id: 1}), (u2:User {id: 2}) CREATE (u1)-[:FRIENDS {id: 3}]->(u2)"
+    )
+    with pytest.raises(Exception):
+        execute_and_fetch_all(cursor, "MATCH (n) DETACH DELETE n")
+    execute_and_fetch_all(cursor, "EDGE IMPORT MODE INACTIVE")
+    assert list(execute_and_fetch_all(cursor, "MATCH (:User {id: 1})-[r:FRIENDS]->(:User {id: 2}) RETURN r.id")) == [
+        (3,)
+    ]
+    execute_and_fetch_all(cursor, "MATCH (n) DETACH DELETE n")
+    execute_and_fetch_all(cursor, "STORAGE MODE IN_MEMORY_TRANSACTIONAL")
+
+
 def test_import_mode_on_off():
     cursor = connect().cursor()
     execute_and_fetch_all(cursor, "STORAGE MODE ON_DISK_TRANSACTIONAL")
@@ -19,12 +19,12 @@ from mg_utils import mg_sleep_and_assert
 from multiprocessing import Process, Value
 import common
 
-TRANSFORMATIONS_TO_CHECK_C = ["c_transformations.empty_transformation"]
+TRANSFORMATIONS_TO_CHECK_C = ["c_transformations.empty_transformation", "c_transformations.batched"]
 
 TRANSFORMATIONS_TO_CHECK_PY = ["kafka_transform.simple", "kafka_transform.with_parameters"]
 
 
-@pytest.mark.parametrize("transformation", TRANSFORMATIONS_TO_CHECK_PY)
+@pytest.mark.parametrize("transformation", TRANSFORMATIONS_TO_CHECK_PY + ["c_transformations.batched"])
 def test_simple(kafka_producer, kafka_topics, connection, transformation):
     assert len(kafka_topics) > 0
     cursor = connection.cursor()
@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2023 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -9,7 +9,36 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <string>
+
 #include "mg_procedure.h"
+#include "mgp.hpp"
+
+namespace {
+
+// Creates the vertices of the whole batch with a single query.
+void BatchedTransformation(mgp_messages *messages, mgp_graph * /*graph*/, mgp_result *result, mgp_memory *memory) {
+  try {
+    mgp::MemoryDispatcherGuard guard(memory);
+    const mgp::Messages batch(messages);
+    mgp::List rows(batch.Size());
+    for (const auto message : batch) {
+      const std::string payload(message.Payload());
+      rows.AppendExtend(mgp::Value(mgp::Map({{"topic", mgp::Value(message.TopicName())},
+                                             {"payload", mgp::Value(std::string_view(payload))},
+                                             {"offset", mgp::Value(message.Offset())}})));
+    }
+    mgp::AddTransformationQuery(
+        result,
+        "UNWIND $messages AS message CREATE (:MESSAGE {topic: message.topic, payload: message.payload, offset: "
+        "message.offset})",
+        mgp::Map({{"messages", mgp::Value(std::move(rows))}}));
+  } catch (const std::exception &e) {
+    mgp::result_set_error_msg(result, e.what());
+  }
+}
+
+}  // namespace
 
 extern "C" int mgp_init_module(mgp_module *module, mgp_memory *memory) {
   static const auto no_op_cb = [](mgp_messages *msg, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {};
@@ -18,5 +47,12 @@ extern "C" int mgp_init_module(mgp_module *module, mgp_memory *memory) {
     return 1;
   }
 
+  try {
+    mgp::MemoryDispatcherGuard guard(memory);
+    mgp::AddTransformation(BatchedTransformation, "batched", module);
+  } catch (const std::exception &e) {
+    return 1;
+  }
+
   return 0;
-}
\ No newline at end of file
+}
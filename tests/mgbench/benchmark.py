@@ -18,6 +18,9 @@ import pathlib
 import platform
 import random
 import sys
+import threading
+import time
+import urllib.request
 
 import helpers
 import log
@@ -133,6 +136,20 @@ def parse_args():
         with the presence of 300 write queries from write type or 30%""",
     )
 
+    benchmark_parser.add_argument(
+        "--workload-concurrent",
+        nargs="*",
+        type=int,
+        default=None,
+        help="""Concurrent workload runs a sustained stream of the write, read and update queries of each group
+        for a given number of seconds, while one of the analytical queries of the group is executed periodically.
+        Pass the duration of the stream in seconds, the period of the analytical queries in seconds and optionally
+        the window in seconds over which the stream latency percentiles are reported (10 by default).
+        Example: --workload-concurrent 300 30 10 will run the stream for 5 minutes with an analytical query
+        every 30 seconds and report p50/p99/p999 latency of the stream for every 10 seconds.
+        The memory and garbage collection metrics of Memgraph are sampled every second during the run.""",
+    )
+
     benchmark_parser.add_argument(
         "--time-depended-execution",
         type=int,
@@ -364,6 +381,137 @@ def mixed_workload(
         print(mixed_workload)
 
 
+def sample_metrics(vendor_args: dict, samples: list, stop_event: threading.Event):
+    metrics_url = "http://127.0.0.1:{}/metrics".format(vendor_args.get("metrics-port", 9091))
+    start = time.monotonic()
+    while not stop_event.is_set():
+        try:
+            with urllib.request.urlopen(metrics_url, timeout=1) as response:
+                metrics = json.load(response)
+        except Exception as e:
+            log.warning("Couldn't sample the metrics from {}: {}".format(metrics_url, e))
+            return
+        general = metrics.get("General", {})
+        gc = metrics.get("GarbageCollection", {})
+        samples.append(
+            {
+                "time": time.monotonic() - start,
+                "memory_usage": general.get("memory_usage"),
+                "uncollected_transactions": general.get("uncollected_transactions"),
+                "oldest_active_transaction_age_ms": general.get("oldest_active_transaction_age_ms"),
+                "gc_freed_bytes": gc.get("GcFreedBytes"),
+                "gc_latency_us_p99": gc.get("GcCycleLatency_us_99p"),
+            }
+        )
+        stop_event.wait(1)
+
+
+def concurrent_workload(
+    vendor: runners.BaseRunner, client: runners.BaseClient, dataset, group, queries, benchmark_context: BenchmarkContext
+):
+    if len(benchmark_context.mode_config) not in (2, 3):
+        raise Exception(
+            "Please pass the duration, the analytical query period and optionally the latency window, passed: ",
+            benchmark_context.mode_config,
+        )
+    duration, analytical_period = benchmark_context.mode_config[:2]
+    latency_window = benchmark_context.mode_config[2] if len(benchmark_context.mode_config) == 3 else 10
+    config_distribution = "_".join(str(i) for i in benchmark_context.mode_config)
+
+    transactional = []
+    analytical = []
+    for _, funcname in queries[group]:
+        if "analytical" in funcname:
+            analytical.append(funcname)
+        elif any(key in funcname for key in ("write", "read", "update")):
+            transactional.append(funcname)
+    if len(transactional) == 0 or len(analytical) == 0:
+        log.warning("Group {} needs both transactional and analytical queries for a concurrent workload".format(group))
+        return
+
+    random.seed(config_distribution)
+    # The client cycles through the stream until the duration passes.
+    stream = [getattr(dataset, random.choice(transactional))() for _ in range(10000)]
+
+    name = dataset.NAME + dataset.get_variant() + "_" + "concurrent" + "_" + config_distribution
+    vendor.start_db(name)
+    warmup(benchmark_context.warm_up, client=client)
+
+    stop_event = threading.Event()
+    metrics = []
+    metrics_thread = threading.Thread(target=sample_metrics, args=(benchmark_context.vendor_args, metrics, stop_event))
+    analytical_runs = []
+    analytical_client = vendor.fetch_client()
+
+    def run_analytical():
+        start = time.monotonic()
+        while not stop_event.wait(analytical_period):
+            funcname = random.choice(analytical)
+            ret = analytical_client.execute(queries=[getattr(dataset, funcname)()], num_workers=1)[0]
+            analytical_runs.append({"query": funcname, "start": time.monotonic() - start, "duration": ret["duration"]})
+
+    analytical_thread = threading.Thread(target=run_analytical)
+    metrics_thread.start()
+    analytical_thread.start()
+    try:
+        ret = client.execute(
+            queries=stream,
+            num_workers=benchmark_context.num_workers_for_benchmark,
+            time_dependent_execution=duration,
+            latency_window_sec=latency_window,
+        )[0]
+    finally:
+        stop_event.set()
+        analytical_thread.join()
+        metrics_thread.join()
+    usage = vendor.stop_db(name)
+
+    windows = [window for window in ret.get("latency_windows", []) if "p99" in window]
+    memory = [sample["memory_usage"] for sample in metrics if sample["memory_usage"] is not None]
+    uncollected = [
+        sample["uncollected_transactions"] for sample in metrics if sample["uncollected_transactions"] is not None
+    ]
+    result = {
+        "count": ret["count"],
+        "num_workers": ret["num_workers"],
+        "duration": ret["duration"],
+        "throughput": ret["throughput"],
+        "retries": ret["retries"],
+        "latency_stats": ret["latency_stats"],
+        "metadata": ret["metadata"],
+        "latency_windows": ret.get("latency_windows", []),
+        "worst_window_p99": max((window["p99"] for window in windows), default=None),
+        "worst_window_p999": max((window["p999"] for window in windows), default=None),
+        "analytical": analytical_runs,
+        "analytical_mean_duration": (
+            sum(run["duration"] for run in analytical_runs) / len(analytical_runs) if analytical_runs else None
+        ),
+        "metrics": metrics,
+        "peak_memory_usage": max(memory, default=None),
+        "max_uncollected_transactions": max(uncollected, default=None),
+        "database": usage,
+    }
+    results_key = [
+        dataset.NAME,
+        dataset.get_variant(),
+        group,
+        "concurrent_" + config_distribution,
+        WITHOUT_FINE_GRAINED_AUTHORIZATION,
+    ]
+    results.set_value(*results_key, value=result)
+
+    log.success(
+        "Executed {} transactional queries with {} analytical queries, {:02f} QPS".format(
+            ret["queries_executed"], len(analytical_runs), ret["throughput"]
+        )
+    )
+    log.success(
+        "Worst window p99: {} seconds, p999: {} seconds".format(
+            result["worst_window_p99"], result["worst_window_p999"]
+        )
+    )
+
+
 def get_query_cache_count(
     vendor: runners.BaseRunner,
     client: runners.BaseClient,
@@ -435,8 +583,11 @@ if __name__ == "__main__":
         args.single_threaded_runtime_sec >= 10
     ), "Low runtime value, consider extending time for more accurate results"
     assert (
-        args.workload_realistic == None or args.workload_mixed == None
-    ), "Cannot run both realistic and mixed workload, only one mode run at the time"
+        [args.workload_realistic, args.workload_mixed, args.workload_concurrent].count(None) >= 2
+    ), "Cannot run more than one of realistic, mixed and concurrent workload, only one mode run at the time"
+    assert (
+        args.workload_concurrent == None or args.run_option == "vendor-native"
+    ), "Concurrent workload can only be run with a native vendor"
 
     temp_dir = pathlib.Path.cwd() / ".temp"
     temp_dir.mkdir(parents=True, exist_ok=True)
@@ -455,6 +606,7 @@ if __name__ == "__main__":
         temporary_directory=temp_dir.absolute(),
         workload_mixed=args.workload_mixed,
         workload_realistic=args.workload_realistic,
+        workload_concurrent=args.workload_concurrent,
         time_dependent_execution=args.time_depended_execution,
         warm_up=args.warm_up,
         performance_tracking=args.performance_tracking,
@@ -602,6 +754,8 @@ if __name__ == "__main__":
                 mixed_workload(vendor_runner, client, workload, group, queries, benchmark_context)
             elif benchmark_context.mode == "Realistic":
                 mixed_workload(vendor_runner, client, workload, group, queries, benchmark_context)
+            elif benchmark_context.mode == "Concurrent":
+                concurrent_workload(vendor_runner, client, workload, group, queries, benchmark_context)
             else:
                 for query, funcname in queries[group]:
                     log.init(
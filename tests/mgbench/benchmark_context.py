@@ -32,6 +32,7 @@ class BenchmarkContext:
         temporary_directory: str = None,
         workload_mixed: str = None,  # Default mode is isolated, mixed None
         workload_realistic: str = None,  # Default mode is isolated, realistic None
+        workload_concurrent: str = None,  # Default mode is isolated, concurrent None
         time_dependent_execution: int = 0,
         warm_up: str = None,
         performance_tracking: bool = False,
@@ -58,6 +59,9 @@ class BenchmarkContext:
         elif workload_realistic != None:
             self.mode = "Realistic"
             self.mode_config = workload_realistic
+        elif workload_concurrent != None:
+            self.mode = "Concurrent"
+            self.mode_config = workload_concurrent
         else:
             self.mode = "Isolated"
             self.mode_config = "Isolated run does not have a config."
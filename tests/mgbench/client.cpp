@@ -62,6 +62,9 @@ DEFINE_int64(time_dependent_execution, 0,
              "Time-dependent executions execute the queries for a specified number of seconds."
              "If all queries are executed, and there is still time, queries are rerun again."
              "If the time runs out, the client is done with the job and returning results.");
+DEFINE_double(latency_window_sec, 0,
+              "If set, time-dependent executions also report the latency statistics of the queries finished in "
+              "each window of this many seconds, to show how the latency changes over time.");
 
 std::pair<std::map<std::string, memgraph::communication::bolt::Value>, uint64_t> ExecuteNTimesTillSuccess(
     memgraph::communication::bolt::Client *client, const std::string &query,
@@ -211,6 +214,7 @@ nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_
     statistics["min"] = query_latency.front();
     statistics["max"] = query_latency.back();
     statistics["mean"] = std::accumulate(query_latency.begin(), query_latency.end(), 0.0) / iterations;
+    statistics["p999"] = query_latency[floor(iterations * 0.999)];
     statistics["p99"] = query_latency[floor(iterations * 0.99)];
     statistics["p95"] = query_latency[floor(iterations * 0.95)];
     statistics["p90"] = query_latency[floor(iterations * 0.90)];
@@ -224,6 +228,38 @@ nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_
   return statistics;
 }
 
+// Splits the queries by the time they finished at into windows of
+// `FLAGS_latency_window_sec` seconds and returns the latency statistics of each
+// window with the second it starts at.
+nlohmann::json LatencyWindows(const std::vector<std::vector<double>> &worker_query_latency,
+                              const std::vector<std::vector<double>> &worker_query_finish) {
+  std::vector<std::vector<double>> windows;
+  for (int i = 0; i < FLAGS_num_workers; i++) {
+    for (size_t j = 0; j < worker_query_latency[i].size(); ++j) {
+      const auto window = static_cast<size_t>(worker_query_finish[i][j] / FLAGS_latency_window_sec);
+      if (window >= windows.size()) windows.resize(window + 1);
+      windows[window].push_back(worker_query_latency[i][j]);
+    }
+  }
+  nlohmann::json statistics = nlohmann::json::array();
+  for (size_t window = 0; window < windows.size(); ++window) {
+    auto &latency = windows[window];
+    nlohmann::json window_statistics = nlohmann::json::object();
+    window_statistics["start"] = static_cast<double>(window) * FLAGS_latency_window_sec;
+    window_statistics["iterations"] = latency.size();
+    if (!latency.empty()) {
+      std::sort(latency.begin(), latency.end());
+      const auto iterations = latency.size();
+      window_statistics["max"] = latency.back();
+      window_statistics["p999"] = latency[floor(iterations * 0.999)];
+      window_statistics["p99"] = latency[floor(iterations * 0.99)];
+      window_statistics["p50"] = latency[floor(iterations * 0.50)];
+    }
+    statistics.push_back(std::move(window_statistics));
+  }
+  return statistics;
+}
+
 void ExecuteTimeDependentWorkload(
     const std::vector<std::pair<std::string, std::map<std::string, memgraph::communication::bolt::Value>>> &queries,
     std::ostream *stream) {
@@ -234,6 +270,8 @@ void ExecuteTimeDependentWorkload(
   std::vector<Metadata> worker_metadata(FLAGS_num_workers, Metadata());
   std::vector<double> worker_duration(FLAGS_num_workers, 0.0);
   std::vector<std::vector<double>> worker_query_durations(FLAGS_num_workers);
+  // Seconds from the start of the workload until each query finished.
+  std::vector<std::vector<double>> worker_query_finish(FLAGS_num_workers);
 
   // Start workers and execute queries.
   auto size = queries.size();
@@ -258,6 +296,7 @@ void ExecuteTimeDependentWorkload(
       auto &metadata = worker_metadata[worker];
       auto &duration = worker_duration[worker];
       auto &query_duration = worker_query_durations[worker];
+      auto &query_finish = worker_query_finish[worker];
 
       // After all threads have been initialised, start the workload timer
       if (!start_workload_timer.load()) {
@@ -278,6 +317,8 @@ void ExecuteTimeDependentWorkload(
         memgraph::utils::Timer query_timer;
         auto ret = ExecuteNTimesTillSuccess(&client, query.first, query.second, FLAGS_max_retries);
         query_duration.emplace_back(query_timer.Elapsed().count());
+        query_finish.emplace_back(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - workload_start).count());
         retries += ret.second;
         metadata.Append(ret.first);
         duration = worker_timer.Elapsed().count();
@@ -324,6 +365,9 @@ void ExecuteTimeDependentWorkload(
   summary["throughput"] = throughput;
   summary["raw_throughput"] = raw_throughput;
   summary["latency_stats"] = LatencyStatistics(worker_query_durations);
+  if (FLAGS_latency_window_sec > 0) {
+    summary["latency_windows"] = LatencyWindows(worker_query_durations, worker_query_finish);
+  }
   summary["retries"] = final_retries;
   summary["metadata"] = final_metadata.Export();
   summary["num_workers"] = FLAGS_num_workers;
@@ -482,6 +526,7 @@ int main(int argc, char **argv) {
   spdlog::info("Output: {}", FLAGS_output);
   spdlog::info("Validation: {}", FLAGS_validation);
   spdlog::info("Time dependend execution: {}", FLAGS_time_dependent_execution);
+  spdlog::info("Latency window: {}", FLAGS_latency_window_sec);
 
   memgraph::communication::SSLInit sslInit;
 
@@ -71,6 +71,8 @@ def compare_results(results_from, results_to, fields, ignored, different_vendors
                     for field in fields:
                         key = field["name"]
                         if key in summary_to:
+                            if summary_to[key] is None:
+                                continue
                             row[key] = compute_diff(summary_from.get(key, None), summary_to[key])
                         elif key in summary_to["database"]:
                             row[key] = compute_diff(
@@ -82,7 +84,7 @@ def compare_results(results_from, results_to, fields, ignored, different_vendors
                                 recursive_get(summary_from, "latency_stats", key, value=None),
                                 summary_to["latency_stats"][key],
                             )
-                        elif not different_vendors:
+                        elif not different_vendors and key in summary_to.get("metadata", {}):
                             row[key] = compute_diff(
                                 recursive_get(summary_from, "metadata", key, "average", value=None),
                                 summary_to["metadata"][key]["average"],
@@ -285,6 +287,12 @@ if __name__ == "__main__":
             "scaling": 1000,
             "unit": "ms",
         },
+        {
+            "name": "p999",
+            "positive_diff_better": False,
+            "scaling": 1000,
+            "unit": "ms",
+        },
         {
             "name": "p99",
             "positive_diff_better": False,
@@ -315,6 +323,38 @@ if __name__ == "__main__":
             "scaling": 1000,
             "unit": "ms",
         },
+        # Concurrent workload
+        {
+            "name": "worst_window_p99",
+            "positive_diff_better": False,
+            "scaling": 1000,
+            "unit": "ms",
+        },
+        {
+            "name": "worst_window_p999",
+            "positive_diff_better": False,
+            "scaling": 1000,
+            "unit": "ms",
+        },
+        {
+            "name": "analytical_mean_duration",
+            "positive_diff_better": False,
+            "scaling": 1,
+            "unit": "s",
+        },
+        {
+            "name": "peak_memory_usage",
+            "positive_diff_better": False,
+            "scaling": 1 / 1024 / 1024,
+            "unit": "MiB",
+            "diff_treshold": 0.02,  # 2%
+        },
+        {
+            "name": "max_uncollected_transactions",
+            "positive_diff_better": False,
+            "scaling": 1,
+            "unit": "",
+        },
     ]
 
     if args.compare is None or len(args.compare) == 0:
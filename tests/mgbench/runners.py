@@ -125,6 +125,7 @@ class BoltClient(BaseClient):
         max_retries: int = 10000,
         validation: bool = False,
         time_dependent_execution: int = 0,
+        latency_window_sec: float = 0,
     ):
         check_db_query = Path(self._directory.name) / "check_db_query.json"
         with open(check_db_query, "w") as f:
@@ -177,6 +178,7 @@ class BoltClient(BaseClient):
             port=self._bolt_port,
             validation=validation,
             time_dependent_execution=time_dependent_execution,
+            latency_window_sec=latency_window_sec,
         )
 
         ret = None
@@ -104,6 +104,36 @@ TEST_F(AuthWithStorage, Authenticate) {
   ASSERT_EQ(auth.Authenticate("nonexistant", "123"), std::nullopt);
 }
 
+TEST_F(AuthWithStorage, AuthenticateWithCachedCredentials) {
+  auto user = auth.AddUser("test", "123");
+  ASSERT_NE(user, std::nullopt);
+
+  // The second login is recognized by the digest of the verified password.
+  ASSERT_NE(auth.AuthenticateWithStoredPassword("test", "123"), std::nullopt);
+  ASSERT_NE(auth.AuthenticateWithStoredPassword("TEST", "123"), std::nullopt);
+  ASSERT_EQ(auth.AuthenticateWithStoredPassword("test", "456"), std::nullopt);
+
+  // Changing the password drops the verified one.
+  user->UpdatePassword("456");
+  auth.SaveUser(*user);
+  ASSERT_EQ(auth.AuthenticateWithStoredPassword("test", "123"), std::nullopt);
+  ASSERT_NE(auth.AuthenticateWithStoredPassword("test", "456"), std::nullopt);
+
+  // The cached users see the changes of their roles.
+  auto role = auth.AddRole("admin");
+  ASSERT_NE(role, std::nullopt);
+  user->SetRole(*role);
+  auth.SaveUser(*user);
+  role->permissions().Grant(Permission::MATCH);
+  auth.SaveRole(*role);
+  auto authenticated = auth.AuthenticateWithStoredPassword("test", "456");
+  ASSERT_NE(authenticated, std::nullopt);
+  ASSERT_EQ(authenticated->GetPermissions().Has(Permission::MATCH), PermissionLevel::GRANT);
+
+  ASSERT_TRUE(auth.RemoveUser("test"));
+  ASSERT_EQ(auth.AuthenticateWithStoredPassword("test", "456"), std::nullopt);
+}
+
 TEST_F(AuthWithStorage, UserRolePermissions) {
   ASSERT_FALSE(auth.HasUsers());
   ASSERT_TRUE(auth.AddUser("test"));
@@ -925,6 +955,9 @@ TEST(AuthWithoutStorage, Crypto) {
   auto hash = EncryptPassword("hello");
   ASSERT_TRUE(VerifyPassword("hello", hash));
   ASSERT_FALSE(VerifyPassword("hello1", hash));
+
+  ASSERT_EQ(PasswordDigest("hello"), PasswordDigest("hello"));
+  ASSERT_NE(PasswordDigest("hello"), PasswordDigest("hello1"));
 }
 
 class AuthWithVariousEncryptionAlgorithms : public ::testing::Test {
@@ -225,4 +225,28 @@ TYPED_TEST(FineGrainedAuthCheckerFixture, GrantAndDenySpecificEdgeTypes) {
   ASSERT_FALSE(auth_checker.Has(this->r3, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
   ASSERT_FALSE(auth_checker.Has(this->r4, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
 }
+
+TYPED_TEST(FineGrainedAuthCheckerFixture, RepeatedChecksOfDifferentPrivileges) {
+  memgraph::auth::User user{"test"};
+  user.fine_grained_access_handler().label_permissions().Grant("l1", memgraph::auth::FineGrainedPermission::READ);
+  user.fine_grained_access_handler().label_permissions().Grant("*", memgraph::auth::FineGrainedPermission::UPDATE);
+  memgraph::glue::FineGrainedAuthChecker auth_checker{user, &this->dba};
+
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_TRUE(auth_checker.Has(this->v1, memgraph::storage::View::NEW,
+                                 memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+    ASSERT_FALSE(auth_checker.Has(this->v1, memgraph::storage::View::NEW,
+                                  memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+    ASSERT_TRUE(auth_checker.Has(this->v2, memgraph::storage::View::NEW,
+                                 memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+    ASSERT_FALSE(auth_checker.Has(this->v2, memgraph::storage::View::NEW,
+                                  memgraph::query::AuthQuery::FineGrainedPrivilege::CREATE_DELETE));
+  }
+
+  // A label created after the checker is checked with the global permission.
+  const auto new_label = this->dba.NameToLabel("l4");
+  ASSERT_TRUE(auth_checker.Has(std::vector{new_label}, memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+  ASSERT_FALSE(
+      auth_checker.Has(std::vector{new_label}, memgraph::query::AuthQuery::FineGrainedPrivilege::CREATE_DELETE));
+}
 #endif
@@ -14,6 +14,7 @@
 #include "disk_test_utils.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "utils/thread_pool.hpp"
 
 using namespace memgraph::query;
 using namespace memgraph::query::plan;
@@ -127,6 +128,75 @@ INSTANTIATE_TEST_CASE_P(FilterLambda, SingleNodeBfsTestInMemory,
                                                          FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                          FilterLambdaType::ERROR)));
 
+class SingleNodeBfsTestLargeLevels : public ::testing::TestWithParam<bool> {
+ protected:
+  AstStorage storage;
+};
+
+TEST_P(SingleNodeBfsTestLargeLevels, Parallel) {
+  // The source is connected to the first layer of vertices, and each of them
+  // to two vertices of the second layer. Without the isolated vertices the
+  // levels are expanded bottom-up, with them top-down.
+  constexpr int kLayerSize = 1500;
+  const bool isolated_vertices = GetParam();
+  memgraph::storage::InMemoryStorage db;
+  auto storage_dba = db.Access();
+  DbAccessor dba(storage_dba.get());
+  auto id = dba.NameToProperty("id");
+  auto type = dba.NameToEdgeType("type");
+  auto source = dba.InsertVertex();
+  std::vector<VertexAccessor> first_layer;
+  std::vector<VertexAccessor> second_layer;
+  for (int i = 0; i < 2 * kLayerSize; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(id, memgraph::storage::PropertyValue(i)).HasValue());
+    (i < kLayerSize ? first_layer : second_layer).push_back(vertex);
+  }
+  for (int i = 0; isolated_vertices && i < 30 * kLayerSize; ++i) dba.InsertVertex();
+  for (int i = 0; i < kLayerSize; ++i) {
+    ASSERT_TRUE(dba.InsertEdge(&source, &first_layer[i], type).HasValue());
+    ASSERT_TRUE(dba.InsertEdge(&first_layer[i], &second_layer[i], type).HasValue());
+    ASSERT_TRUE(dba.InsertEdge(&first_layer[i], &second_layer[(i + 1) % kLayerSize], type).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  memgraph::utils::ThreadPool pool(3);
+  ExecutionContext context{.db_accessor = &dba};
+  context.parallel_execution_pool = &pool;
+  context.parallel_workers = 4;
+  auto source_sym = context.symbol_table.CreateSymbol("source", true);
+  auto sink_sym = context.symbol_table.CreateSymbol("sink", true);
+  auto edges_sym = context.symbol_table.CreateSymbol("edges", true);
+  auto inner_node_sym = context.symbol_table.CreateSymbol("inner_node", true);
+  auto inner_edge_sym = context.symbol_table.CreateSymbol("inner_edge", true);
+  auto *inner_node = IDENT("inner_node")->MapTo(inner_node_sym);
+  // The last 100 vertices of the second layer are filtered out.
+  auto *filter_expr = LESS(PROPERTY_LOOKUP(dba, inner_node, PROPERTY_PAIR(dba, "id")), LITERAL(2 * kLayerSize - 100));
+  auto input_op = std::make_shared<Yield>(nullptr, std::vector<Symbol>{source_sym},
+                                          std::vector<std::vector<TypedValue>>{{TypedValue(source)}});
+  auto bfs = std::make_shared<ExpandVariable>(input_op, source_sym, sink_sym, edges_sym, EdgeAtom::Type::BREADTH_FIRST,
+                                              EdgeAtom::Direction::OUT, std::vector<memgraph::storage::EdgeTypeId>{},
+                                              false, nullptr, nullptr, false,
+                                              ExpansionLambda{inner_edge_sym, inner_node_sym, filter_expr},
+                                              std::nullopt, std::nullopt);
+  context.evaluation_context.properties = NamesToProperties(storage.properties_, &dba);
+  context.evaluation_context.labels = NamesToLabels(storage.labels_, &dba);
+
+  auto results = PullResults(bfs.get(), &context, std::vector<Symbol>{sink_sym, edges_sym});
+  ASSERT_EQ(results.size(), 2 * kLayerSize - 100);
+  std::set<int64_t> ids;
+  for (const auto &row : results) {
+    auto sink_id = GetProp(row[0].ValueVertex(), "id", &dba).ValueInt();
+    EXPECT_EQ(row[1].ValueList().size(), sink_id < kLayerSize ? 1 : 2);
+    EXPECT_EQ(row[1].ValueList().back().ValueEdge().To(), row[0].ValueVertex());
+    ids.insert(sink_id);
+  }
+  EXPECT_EQ(ids.size(), results.size());
+  dba.Abort();
+}
+
+INSTANTIATE_TEST_CASE_P(IsolatedVertices, SingleNodeBfsTestLargeLevels, testing::Bool());
+
 class SingleNodeBfsTestOnDisk
     : public ::testing::TestWithParam<
           std::tuple<int, int, EdgeAtom::Direction, std::vector<std::string>, bool, FilterLambdaType>> {
@@ -9,6 +9,9 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <vector>
+
 #include "bolt_common.hpp"
 #include "communication/bolt/v1/decoder/chunked_decoder_buffer.hpp"
 #include "communication/buffer.hpp"
@@ -138,3 +141,37 @@ TEST_F(BoltBuffer, GraduallyPopulatedChunkTrailingData) {
   ASSERT_EQ(buffer.read_end()->size(), 1000);
   for (int i = 0; i < 1000; ++i) EXPECT_EQ(data[i], leftover[i]);
 }
+
+TEST_F(BoltBuffer, ChunkLargerThanBuffer) {
+  // The chunk is read as it arrives, so the buffer doesn't have to fit it.
+  std::vector<uint8_t> tmp(65535);
+  BufferT buffer;
+  DecoderBufferT decoder_buffer(*buffer.read_end());
+  StreamBufferT sb = buffer.write_end()->Allocate();
+
+  sb.data[0] = 0xff;
+  sb.data[1] = 0xff;
+  buffer.write_end()->Written(2);
+
+  size_t written = 0;
+  while (written < tmp.size()) {
+    ASSERT_EQ(decoder_buffer.GetChunk(), ChunkStateT::Partial);
+    ASSERT_EQ(buffer.read_end()->size(), 0);
+    sb = buffer.write_end()->Allocate();
+    const size_t len = std::min<size_t>({sb.len, 10000, tmp.size() - written});
+    memcpy(sb.data, data + written, len);
+    buffer.write_end()->Written(len);
+    written += len;
+  }
+
+  sb = buffer.write_end()->Allocate();
+  sb.data[0] = 0;
+  sb.data[1] = 0;
+  buffer.write_end()->Written(2);
+  ASSERT_EQ(decoder_buffer.GetChunk(), ChunkStateT::Whole);
+  ASSERT_EQ(decoder_buffer.GetChunk(), ChunkStateT::Done);
+
+  ASSERT_EQ(decoder_buffer.Read(tmp.data(), tmp.size()), true);
+  for (size_t i = 0; i < tmp.size(); ++i) EXPECT_EQ(data[i], tmp[i]);
+  ASSERT_EQ(buffer.read_end()->size(), 0);
+}
@@ -9,9 +9,29 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <span>
+
 #include "bolt_common.hpp"
 #include "communication/bolt/v1/encoder/chunked_encoder_buffer.hpp"
 
+/**
+ * Output stream which can also write a sequence of buffers at once.
+ */
+class GatheringTestOutputStream : public TestOutputStream {
+ public:
+  bool CanWriteGathered() const { return true; }
+
+  bool WriteGathered(std::span<const std::span<const uint8_t>> buffers, bool have_more = false) {
+    ++gathered_writes;
+    for (const auto &buffer : buffers) {
+      if (!Write(buffer.data(), buffer.size(), have_more)) return false;
+    }
+    return true;
+  }
+
+  int gathered_writes{0};
+};
+
 // aliases
 using BufferT = memgraph::communication::bolt::ChunkedEncoderBuffer<TestOutputStream>;
 
@@ -109,3 +129,31 @@ TEST_F(BoltChunkedEncoderBuffer, OneAndAHalfOfMaxChunk) {
   VerifyChunkOfTestData(output, kChunkMaxDataSize);
   VerifyChunkOfTestData(output + kChunkWholeSize, kTestDataSize - kChunkMaxDataSize, kChunkMaxDataSize);
 }
+
+TEST_F(BoltChunkedEncoderBuffer, GatheredWriteOfWholeChunks) {
+  int size = 100;
+
+  // initialize tested buffer
+  GatheringTestOutputStream output_stream;
+  memgraph::communication::bolt::ChunkedEncoderBuffer<GatheringTestOutputStream> buffer(output_stream);
+
+  // write into buffer
+  buffer.Write(test_data, size);
+  buffer.Write(test_data + size, kTestDataSize - size);
+  buffer.Flush();
+
+  // the buffered data and the whole chunk are sent with a single gathered
+  // write, and the rest is sent when flushed
+  // the output array should look like this:
+  // [0, 100, first 100 bytes of test data,
+  //  0xFF, 0xFF, next 65535 bytes of test data,
+  //  0x86, 0x3D, the remaining 34365 bytes of test data]
+  ASSERT_EQ(output_stream.gathered_writes, 1);
+  auto output = output_stream.output.data();
+  VerifyChunkOfTestData(output, size);
+  output += kChunkHeaderSize + size;
+  VerifyChunkOfTestData(output, kChunkMaxDataSize, size);
+  output += kChunkWholeSize;
+  VerifyChunkOfTestData(output, kTestDataSize - size - kChunkMaxDataSize, size + kChunkMaxDataSize);
+  ASSERT_EQ(output_stream.output.size(), 3 * kChunkHeaderSize + kTestDataSize);
+}
@@ -178,6 +178,21 @@ TEST_F(BoltEncoder, Map) {
   CheckOutput(output, nullptr, 0);
 }
 
+TEST_F(BoltEncoder, MovedPropertyValue) {
+  std::map<std::string, memgraph::storage::PropertyValue> map{
+      {"list", memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
+                   memgraph::storage::PropertyValue("string"), memgraph::storage::PropertyValue(1)})},
+      {"string", memgraph::storage::PropertyValue(std::string(100, 'a'))}};
+  memgraph::storage::PropertyValue value(map);
+
+  output.clear();
+  bolt_encoder.MessageRecord({memgraph::glue::ToBoltValue(value)});
+  auto copied = output;
+  output.clear();
+  bolt_encoder.MessageRecord({memgraph::glue::ToBoltValue(std::move(value))});
+  ASSERT_EQ(output, copied);
+}
+
 void TestVertexAndEdgeWithDifferentStorages(std::unique_ptr<memgraph::storage::Storage> &&db) {
   output.clear();
 
@@ -243,6 +258,31 @@ TEST_F(BoltEncoder, VertexAndEdgeOnDiskStorage) {
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
 
+TEST_F(BoltEncoder, ElementIdsFromIds) {
+  TestOutputStream v5_output_stream;
+  TestBuffer v5_encoder_buffer(v5_output_stream);
+  memgraph::communication::bolt::Encoder<TestBuffer> v5_encoder(v5_encoder_buffer);
+  v5_encoder.UpdateVersion(5);
+  auto &v5_output = v5_output_stream.output;
+
+  const auto id = memgraph::communication::bolt::Id::FromInt(1234567);
+  const auto from = memgraph::communication::bolt::Id::FromInt(0);
+  const auto to = memgraph::communication::bolt::Id::FromInt(42);
+  memgraph::communication::bolt::Vertex vertex{id, {"label"}, {}};
+  memgraph::communication::bolt::Edge edge{id, from, to, "type", {}};
+  v5_encoder.MessageRecord({Value(vertex), Value(edge)});
+  auto from_ids = v5_output;
+
+  // The element IDs which aren't set are encoded as the decimal IDs.
+  v5_output.clear();
+  vertex.element_id = "1234567";
+  edge.element_id = "1234567";
+  edge.from_element_id = "0";
+  edge.to_element_id = "42";
+  v5_encoder.MessageRecord({Value(vertex), Value(edge)});
+  ASSERT_EQ(from_ids, v5_output);
+}
+
 TEST_F(BoltEncoder, BoltV1ExampleMessages) {
   // this test checks example messages from: http://boltprotocol.org/v1/
 
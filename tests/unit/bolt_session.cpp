@@ -9,7 +9,9 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <string>
+#include <string_view>
 
 #include <gflags/gflags.h>
 #include <gtest/gtest.h>
@@ -43,7 +45,7 @@ class TestSession final : public Session<TestInputStream, TestOutputStream> {
   TestSession(TestSessionContext *data, TestInputStream *input_stream, TestOutputStream *output_stream)
       : Session<TestInputStream, TestOutputStream>(input_stream, output_stream) {}
   std::pair<std::vector<std::string>, std::optional<int>> Interpret(
-      const std::string &query, const std::map<std::string, Value> &params,
+      const std::string &query, std::map<std::string, Value> params,
       const std::map<std::string, Value> &extra) override {
     if (extra.contains("tx_metadata")) {
       auto const &metadata = extra.at("tx_metadata").ValueMap();
@@ -107,7 +109,10 @@ class TestSession final : public Session<TestInputStream, TestOutputStream> {
       if (!metadata.empty()) md_ = metadata;
     }
   }
-  void CommitTransaction() override { md_.clear(); }
+  std::map<std::string, Value> CommitTransaction() override {
+    md_.clear();
+    return {};
+  }
   void RollbackTransaction() override { md_.clear(); }
 
   void Abort() override { md_.clear(); }
@@ -199,6 +204,9 @@ inline constexpr uint8_t handshake_req[] = {0x60, 0x60, 0xb0, 0x17, 0x00, 0x00,
                                             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 inline constexpr uint8_t handshake_resp[] = {0x00, 0x00, 0x03, 0x04};
 inline constexpr uint8_t route[]{0xb3, 0x66, 0xa0, 0x90, 0xc0};
+inline constexpr uint8_t route_w_address[]{0xb3, 0x66, 0xa1, 0x87, 'a', 'd', 'd', 'r', 'e', 's', 's',
+                                           0x8e, 'l',  'o',  'c',  'a',  'l', 'h', 'o', 's', 't', ':',
+                                           '7',  '6',  '8',  '7',  0x90, 0x85, 'g', 'r', 'a', 'p', 'h'};
 constexpr std::string_view extra_w_metadata =
     "\xa2"                                              // Map size 2
     "\x8b\x74\x78\x5f\x6d\x65\x74\x61\x64\x61\x74\x61"  // "tx_metadata"
@@ -1134,6 +1142,54 @@ TEST(BoltSession, Route) {
   }
 }
 
+TEST(BoltSession, RouteWithAddress) {
+  // The routing table sends the client back to the address it connected to.
+  INIT_VARS;
+
+  ExecuteHandshake(input_stream, session, output, v4_3::handshake_req, v4_3::handshake_resp);
+  ExecuteInit(input_stream, session, output, true);
+  ASSERT_NO_THROW(ExecuteCommand(input_stream, session, v4_3::route_w_address, sizeof(v4_3::route_w_address)));
+  EXPECT_EQ(input_stream.size(), 0U);
+  EXPECT_EQ(session.state_, State::Idle);
+  ASSERT_GT(output.size(), 4U);
+  EXPECT_EQ(output[2], 0xb1);
+  EXPECT_EQ(output[3], 0x70);
+  for (const std::string_view expected : {"localhost:7687", "graph", "WRITE", "READ", "ROUTE"}) {
+    EXPECT_NE(std::search(output.begin(), output.end(), expected.begin(), expected.end()), output.end()) << expected;
+  }
+
+  SCOPED_TRACE("The same routing table is sent again");
+  const auto first_response = output;
+  output.clear();
+  ASSERT_NO_THROW(ExecuteCommand(input_stream, session, v4_3::route_w_address, sizeof(v4_3::route_w_address)));
+  EXPECT_EQ(output, first_response);
+  EXPECT_EQ(session.state_, State::Idle);
+}
+
+TEST(BoltSession, ExecuteBusy) {
+  INIT_VARS;
+
+  ExecuteHandshake(input_stream, session, output, v4::handshake_req, v4::handshake_resp);
+  ExecuteInit(input_stream, session, output, true);
+
+  // The query fails without being executed.
+  WriteRunRequest(input_stream, kQueryReturn42, true);
+  session.ExecuteBusy();
+  EXPECT_EQ(session.state_, State::Error);
+  const std::string_view code{"ServerBusy"};
+  EXPECT_NE(std::search(output.begin(), output.end(), code.begin(), code.end()), output.end());
+  CheckFailureMessage(output);
+
+  SCOPED_TRACE("The client can retry the query after a reset");
+  ExecuteCommand(input_stream, session, v4::reset_req, sizeof(v4::reset_req));
+  EXPECT_EQ(session.state_, State::Idle);
+  CheckSuccessMessage(output);
+  WriteRunRequest(input_stream, kQueryReturn42, true);
+  session.Execute();
+  EXPECT_EQ(session.state_, State::Result);
+  CheckSuccessMessage(output);
+}
+
 TEST(BoltSession, Rollback) {
   // v1 does not support ROLLBACK message
   {
@@ -11,6 +11,9 @@
 
 #include "storage/v2/commit_log.hpp"
 
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
@@ -79,3 +82,46 @@ TEST(CommitLog, TrackAfterInitialId) {
     check_marking_ids(&log, i);
   }
 }
+
+TEST(CommitLog, ActiveIdsBelow) {
+  memgraph::storage::CommitLog log;
+  EXPECT_EQ(log.ActiveIdsBelow(3), (std::vector<uint64_t>{0, 1, 2}));
+
+  for (uint64_t i = 0; i < ids_per_block + 100; ++i) {
+    if (i != 5 && i != 64 && i != ids_per_block + 1) {
+      log.MarkFinished(i);
+    }
+  }
+  EXPECT_EQ(log.ActiveIdsBelow(ids_per_block + 102),
+            (std::vector<uint64_t>{5, 64, ids_per_block + 1, ids_per_block + 100, ids_per_block + 101}));
+  EXPECT_EQ(log.ActiveIdsBelow(64), (std::vector<uint64_t>{5}));
+
+  log.MarkFinished(5);
+  log.MarkFinished(64);
+  EXPECT_EQ(log.ActiveIdsBelow(ids_per_block + 101), (std::vector<uint64_t>{ids_per_block + 1, ids_per_block + 100}));
+  EXPECT_TRUE(log.ActiveIdsBelow(ids_per_block).empty());
+}
+
+TEST(CommitLog, ConcurrentMarkFinished) {
+  memgraph::storage::CommitLog log;
+  static constexpr uint64_t kThreads = 4;
+  static constexpr uint64_t kIdsPerThread = ids_per_block / 2;
+
+  std::vector<std::thread> threads;
+  for (uint64_t thread = 0; thread < kThreads; ++thread) {
+    threads.emplace_back([&log, thread] {
+      uint64_t last_oldest_active = 0;
+      for (uint64_t i = 0; i < kIdsPerThread; ++i) {
+        log.MarkFinished(i * kThreads + thread);
+        const auto oldest_active = log.OldestActive();
+        EXPECT_GE(oldest_active, last_oldest_active);
+        last_oldest_active = oldest_active;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(log.OldestActive(), kThreads * kIdsPerThread);
+}
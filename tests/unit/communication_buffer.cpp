@@ -65,5 +65,43 @@ TEST_F(CommunicationBuffer, Resize) {
   buffer.read_end()->Resize(sb.len + 1000);
 
   auto sbn = buffer.write_end()->Allocate();
-  ASSERT_EQ(sb.len + 1000, sbn.len);
+  ASSERT_GE(sbn.len, sb.len + 1000);
+}
+
+TEST_F(CommunicationBuffer, ResizeKeepsData) {
+  Buffer buffer;
+  auto sb = buffer.write_end()->Allocate();
+  memcpy(sb.data, data, 1000);
+  buffer.write_end()->Written(1000);
+
+  buffer.write_end()->Resize(sb.len * 4);
+  ASSERT_EQ(buffer.read_end()->size(), 1000);
+  uint8_t *tmp = buffer.read_end()->data();
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(data[i], tmp[i]);
+}
+
+TEST_F(CommunicationBuffer, Release) {
+  Buffer buffer;
+  auto sb = buffer.write_end()->Allocate();
+  memcpy(sb.data, data, 1000);
+  buffer.write_end()->Written(1000);
+
+  // The buffer holding data keeps its storage.
+  buffer.Release();
+  ASSERT_EQ(buffer.read_end()->size(), 1000);
+  uint8_t *tmp = buffer.read_end()->data();
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(data[i], tmp[i]);
+
+  buffer.read_end()->Shift(1000);
+  buffer.Release();
+  ASSERT_EQ(buffer.read_end()->size(), 0);
+
+  // The storage is taken again when data is written.
+  sb = buffer.write_end()->Allocate();
+  ASSERT_GT(sb.len, 0);
+  memcpy(sb.data, data, 1000);
+  buffer.write_end()->Written(1000);
+  ASSERT_EQ(buffer.read_end()->size(), 1000);
+  tmp = buffer.read_end()->data();
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(data[i], tmp[i]);
 }
@@ -0,0 +1,118 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "communication/v2/execution_pool.hpp"
+
+using memgraph::communication::v2::ExecutionPool;
+using namespace std::chrono_literals;
+
+TEST(ExecutionPool, ExecutesAllWork) {
+  ExecutionPool pool{4};
+  pool.Run();
+  std::atomic<int> count{0};
+  std::promise<void> done;
+  static constexpr int kWork = 1000;
+  for (int i = 0; i < kWork; ++i) {
+    const auto priority = i % 2 == 0 ? ExecutionPool::Priority::SHORT : ExecutionPool::Priority::LONG;
+    pool.Submit(priority, [&] {
+      if (count.fetch_add(1) + 1 == kWork) done.set_value();
+    });
+  }
+  ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+  pool.Shutdown();
+  pool.AwaitShutdown();
+}
+
+TEST(ExecutionPool, LongWorkLeavesThreadForShortWork) {
+  ExecutionPool pool{2};
+  pool.Run();
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> long_started{0};
+  for (int i = 0; i < 3; ++i) {
+    pool.Submit(ExecutionPool::Priority::LONG, [&long_started, released] {
+      long_started.fetch_add(1);
+      released.wait();
+    });
+  }
+
+  std::promise<void> short_done;
+  pool.Submit(ExecutionPool::Priority::SHORT, [&] { short_done.set_value(); });
+  ASSERT_EQ(short_done.get_future().wait_for(10s), std::future_status::ready);
+  EXPECT_LE(long_started.load(), 1);
+
+  release.set_value();
+  pool.Shutdown();
+  pool.AwaitShutdown();
+}
+
+TEST(ExecutionPool, ClientsTakeTurns) {
+  ExecutionPool pool{1};
+  std::vector<std::string> order;
+  for (int i = 0; i < 3; ++i) {
+    pool.Submit(ExecutionPool::Priority::SHORT, "flooding", [&order] { order.emplace_back("flooding"); });
+  }
+  pool.Submit(ExecutionPool::Priority::SHORT, "other", [&order] { order.emplace_back("other"); });
+
+  // The flooding client waits for its next turn behind the other client.
+  std::promise<void> done;
+  pool.Submit(ExecutionPool::Priority::SHORT, "flooding", [&] { done.set_value(); });
+  pool.Run();
+  ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+  pool.Shutdown();
+  pool.AwaitShutdown();
+
+  const std::vector<std::string> expected{"flooding", "other", "flooding", "flooding"};
+  EXPECT_EQ(order, expected);
+}
+
+TEST(ExecutionPool, ClientLimits) {
+  ExecutionPool pool{2, {.max_running_per_client = 1, .max_queued_per_client = 1}};
+  pool.Run();
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> running{0};
+  std::promise<void> started;
+  ASSERT_TRUE(pool.Submit(ExecutionPool::Priority::SHORT, "client", [&, released] {
+    running.fetch_add(1);
+    started.set_value();
+    released.wait();
+    running.fetch_sub(1);
+  }));
+  ASSERT_EQ(started.get_future().wait_for(10s), std::future_status::ready);
+
+  // The second work of the client waits although a thread is free, and the
+  // third one is rejected.
+  std::promise<void> second_done;
+  ASSERT_TRUE(pool.Submit(ExecutionPool::Priority::SHORT, "client", [&] {
+    EXPECT_EQ(running.load(), 0);
+    second_done.set_value();
+  }));
+  EXPECT_FALSE(pool.Submit(ExecutionPool::Priority::SHORT, "client", [] {}));
+
+  // Other clients aren't affected.
+  std::promise<void> other_done;
+  ASSERT_TRUE(pool.Submit(ExecutionPool::Priority::SHORT, "other", [&] { other_done.set_value(); }));
+  ASSERT_EQ(other_done.get_future().wait_for(10s), std::future_status::ready);
+
+  release.set_value();
+  ASSERT_EQ(second_done.get_future().wait_for(10s), std::future_status::ready);
+  pool.Shutdown();
+  pool.AwaitShutdown();
+}
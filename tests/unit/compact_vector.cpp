@@ -0,0 +1,81 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/compact_vector.hpp"
+
+using memgraph::utils::CompactVector;
+
+static_assert(sizeof(CompactVector<uint64_t, 2>) == sizeof(std::vector<uint64_t>));
+
+TEST(CompactVector, InlineAndHeap) {
+  CompactVector<uint64_t, 3> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 3);
+
+  for (uint64_t i = 0; i < 3; ++i) vec.push_back(i);
+  EXPECT_EQ(vec.capacity(), 3);
+  // The data is stored inside the object while it is small.
+  const auto *object_begin = reinterpret_cast<const char *>(&vec);
+  const auto *data_begin = reinterpret_cast<const char *>(vec.data());
+  EXPECT_TRUE(data_begin >= object_begin && data_begin < object_begin + sizeof(vec));
+
+  for (uint64_t i = 3; i < 100; ++i) vec.push_back(i);
+  EXPECT_EQ(vec.size(), 100);
+  EXPECT_GE(vec.capacity(), 100);
+  for (uint64_t i = 0; i < 100; ++i) EXPECT_EQ(vec[i], i);
+  EXPECT_EQ(vec.back(), 99);
+
+  while (vec.size() > 1) vec.pop_back();
+  EXPECT_EQ(vec.front(), 0);
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(CompactVector, CopyAndMove) {
+  for (uint64_t size : {2, 10}) {
+    CompactVector<uint64_t, 2> vec;
+    for (uint64_t i = 0; i < size; ++i) vec.push_back(i);
+
+    CompactVector<uint64_t, 2> copy(vec);
+    EXPECT_EQ(copy, vec);
+    EXPECT_NE(copy.data(), vec.data());
+
+    CompactVector<uint64_t, 2> moved(std::move(copy));
+    EXPECT_EQ(moved, vec);
+    EXPECT_TRUE(copy.empty());  // NOLINT(bugprone-use-after-move)
+
+    CompactVector<uint64_t, 2> assigned{42};
+    assigned = vec;
+    EXPECT_EQ(assigned, vec);
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned, vec);
+  }
+}
+
+TEST(CompactVector, AssignAndErase) {
+  std::vector<uint64_t> source{5, 6, 7, 8};
+  CompactVector<uint64_t, 2> vec;
+  vec.assign(source.begin(), source.end());
+  EXPECT_TRUE(std::equal(vec.begin(), vec.end(), source.begin(), source.end()));
+
+  auto it = vec.erase(vec.begin() + 1);
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(vec, (CompactVector<uint64_t, 2>{5, 7, 8}));
+
+  vec.assign(source.begin(), source.begin() + 1);
+  EXPECT_EQ(vec, (CompactVector<uint64_t, 2>{5}));
+}
@@ -367,6 +367,53 @@ TEST_P(CsvReaderTest, EmptyColumns) {
   }
 }
 
+TEST_P(CsvReaderTest, PrefetchedRows) {
+  // create a file with many valid rows followed by a row with a missing
+  // closing quote;
+  // the prefetched rows should be returned in order before the error
+  const auto filepath = csv_directory / "bla.csv";
+  auto writer = FileWriter(filepath, GetParam().newline, GetParam().compressionMethod);
+
+  memgraph::utils::MemoryResource *mem(memgraph::utils::NewDeleteResource());
+
+  const memgraph::utils::pmr::string delimiter{",", mem};
+  const memgraph::utils::pmr::string quote{"\"", mem};
+
+  const int rows = 1000;
+  for (int i = 0; i < rows; ++i) {
+    writer.WriteLine(CreateRow({std::to_string(i), "B"}, delimiter));
+  }
+  writer.WriteLine(CreateRow({"A", "\"B"}, delimiter));
+
+  writer.Close();
+
+  for (const bool ignore_bad : {false, true}) {
+    const bool with_header = false;
+    Reader::Config cfg{with_header, ignore_bad, delimiter, quote};
+    cfg.prefetch_batch_size = 7;
+    auto reader = Reader(FileCsvSource{filepath}, cfg);
+
+    for (int i = 0; i < rows; ++i) {
+      const auto parsed_row = reader.GetNextRow(mem);
+      ASSERT_TRUE(parsed_row.has_value());
+      ASSERT_EQ(*parsed_row, ToPmrColumns({std::to_string(i), "B"}));
+    }
+    if (ignore_bad) {
+      ASSERT_EQ(reader.GetNextRow(mem), std::nullopt);
+    } else {
+      EXPECT_THROW(reader.GetNextRow(mem), CsvReadException);
+    }
+  }
+
+  {
+    // the reader can be destroyed before all rows are read
+    Reader::Config cfg{false, false, delimiter, quote};
+    cfg.prefetch_batch_size = 1;
+    auto reader = Reader(FileCsvSource{filepath}, cfg);
+    ASSERT_TRUE(reader.GetNextRow(mem).has_value());
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(NewlineParameterizedTest, CsvReaderTest,
                         ::testing::Values(TestParam{"\n", CompressionMethod::NONE},
                                           TestParam{"\r\n", CompressionMethod::NONE},
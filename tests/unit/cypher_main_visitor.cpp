@@ -1807,7 +1807,22 @@ TEST_P(CypherMainVisitorTest, DropIndexWithoutProperties) {
 
 TEST_P(CypherMainVisitorTest, DropIndexWithMultipleProperties) {
   auto &ast_generator = *GetParam();
-  EXPECT_THROW(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"), SyntaxException);
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("dRoP InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::DROP);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
+}
+
+TEST_P(CypherMainVisitorTest, CreateIndexWithMultipleProperties) {
+  auto &ast_generator = *GetParam();
+  auto *index_query = dynamic_cast<IndexQuery *>(ast_generator.ParseQuery("Create InDeX oN :mirko(slavko, pero)"));
+  ASSERT_TRUE(index_query);
+  EXPECT_EQ(index_query->action_, IndexQuery::Action::CREATE);
+  EXPECT_EQ(index_query->label_, ast_generator.Label("mirko"));
+  std::vector<PropertyIx> expected_properties{ast_generator.Prop("slavko"), ast_generator.Prop("pero")};
+  EXPECT_EQ(index_query->properties_, expected_properties);
 }
 
 TEST_P(CypherMainVisitorTest, ReturnAll) {
@@ -2616,6 +2631,20 @@ TEST_P(CypherMainVisitorTest, TestShowConstraintInfo) {
   EXPECT_EQ(query->info_type_, InfoQuery::InfoType::CONSTRAINT);
 }
 
+TEST_P(CypherMainVisitorTest, TestShowSlowQueries) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<InfoQuery *>(ast_generator.ParseQuery("SHOW SLOW QUERIES"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, InfoQuery::InfoType::SLOW_QUERIES);
+}
+
+TEST_P(CypherMainVisitorTest, TestShowIndexRecommendations) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<InfoQuery *>(ast_generator.ParseQuery("SHOW INDEX RECOMMENDATIONS"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, InfoQuery::InfoType::INDEX_RECOMMENDATIONS);
+}
+
 TEST_P(CypherMainVisitorTest, CreateConstraintSyntaxError) {
   auto &ast_generator = *GetParam();
   EXPECT_THROW(ast_generator.ParseQuery("CREATE CONSTRAINT ON (:label) ASSERT EXISTS"), SyntaxException);
@@ -2831,6 +2860,16 @@ TEST_P(CypherMainVisitorTest, DumpDatabase) {
   auto &ast_generator = *GetParam();
   auto *query = dynamic_cast<DumpQuery *>(ast_generator.ParseQuery("DUMP DATABASE"));
   ASSERT_TRUE(query);
+  EXPECT_EQ(query->directory_, nullptr);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(CypherMainVisitorTest, DumpDatabaseToDirectory) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<DumpQuery *>(ast_generator.ParseQuery("DUMP DATABASE TO '/backups/dump'"));
+  ASSERT_TRUE(query);
+  ast_generator.CheckLiteral(query->directory_, "/backups/dump");
+  ASSERT_THROW(ast_generator.ParseQuery("DUMP DATABASE TO 42"), SyntaxException);
 }
 
 namespace {
@@ -3735,6 +3774,42 @@ TEST_P(CypherMainVisitorTest, CreateTriggers) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, CreateMaterializedView) {
+  auto &ast_generator = *GetParam();
+
+  TestInvalidQuery("CREATE MATERIALIZED VIEW", ast_generator);
+  TestInvalidQuery("CREATE MATERIALIZED VIEW view", ast_generator);
+  TestInvalidQuery("CREATE MATERIALIZED VIEW view MATCH (n) RETURN count(n)", ast_generator);
+
+  auto *parsed_query = dynamic_cast<MaterializedViewQuery *>(
+      ast_generator.ParseQuery("CREATE MATERIALIZED VIEW view AS MATCH (n:Person) RETURN n.city, count(*)"));
+  ASSERT_TRUE(parsed_query);
+  EXPECT_EQ(parsed_query->action_, MaterializedViewQuery::Action::CREATE_VIEW);
+  EXPECT_EQ(parsed_query->view_name_, "view");
+  EXPECT_EQ(parsed_query->statement_, "MATCH (n:Person) RETURN n.city, count(*)");
+}
+
+TEST_P(CypherMainVisitorTest, DropAndShowMaterializedViews) {
+  auto &ast_generator = *GetParam();
+
+  TestInvalidQuery("DROP MATERIALIZED VIEW", ast_generator);
+  TestInvalidQuery("SHOW MATERIALIZED", ast_generator);
+
+  auto *parsed_query = dynamic_cast<MaterializedViewQuery *>(ast_generator.ParseQuery("DROP MATERIALIZED VIEW view"));
+  ASSERT_TRUE(parsed_query);
+  EXPECT_EQ(parsed_query->action_, MaterializedViewQuery::Action::DROP_VIEW);
+  EXPECT_EQ(parsed_query->view_name_, "view");
+
+  parsed_query = dynamic_cast<MaterializedViewQuery *>(ast_generator.ParseQuery("SHOW MATERIALIZED VIEWS"));
+  ASSERT_TRUE(parsed_query);
+  EXPECT_EQ(parsed_query->action_, MaterializedViewQuery::Action::SHOW_VIEWS);
+
+  parsed_query = dynamic_cast<MaterializedViewQuery *>(ast_generator.ParseQuery("SHOW MATERIALIZED VIEW view"));
+  ASSERT_TRUE(parsed_query);
+  EXPECT_EQ(parsed_query->action_, MaterializedViewQuery::Action::SHOW_VIEW);
+  EXPECT_EQ(parsed_query->view_name_, "view");
+}
+
 namespace {
 void ValidateSetIsolationLevelQuery(Base &ast_generator, const auto &query, const auto scope,
                                     const auto isolation_level) {
@@ -3906,6 +3981,7 @@ void ValidateCreateKafkaStreamQuery(Base &ast_generator, const std::string &quer
   EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->batch_interval_, batch_interval));
   EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->batch_size_, batch_size));
   EXPECT_EQ(parsed_query->batch_limit_, nullptr);
+  EXPECT_EQ(parsed_query->workers_, nullptr);
   if (bootstrap_servers.empty()) {
     EXPECT_EQ(parsed_query->bootstrap_servers_, nullptr);
   } else {
@@ -3966,6 +4042,11 @@ TEST_P(CypherMainVisitorTest, CreateKafkaStream) {
       "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform CREDENTIALS { symbolicname : 'string' }",
       ast_generator);
   TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform CREDENTIALS 2", ast_generator);
+  TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS", ast_generator);
+  TestInvalidQuery<SemanticException>("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS 'four'",
+                                      ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS 2 WORKERS 3", ast_generator);
 
   const std::vector<std::string> topic_names{"topic1_name.with_dot", "topic1_name.with_multiple.dots",
                                              "topic-name.with-multiple.dots-and-dashes"};
@@ -4067,6 +4148,15 @@ TEST_P(CypherMainVisitorTest, CreateKafkaStream) {
     EXPECT_NO_FATAL_FAILURE(check_consumer_group(consumer_group));
   }
 
+  {
+    const auto query_string =
+        fmt::format("CREATE KAFKA STREAM {} TOPICS topic1 TRANSFORM {} WORKERS 4", kStreamName, kTransformName);
+    SCOPED_TRACE(query_string);
+    auto *parsed_query = dynamic_cast<StreamQuery *>(ast_generator.ParseQuery(query_string));
+    ASSERT_NE(parsed_query, nullptr);
+    EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->workers_, TypedValue{4}));
+  }
+
   auto check_config_map = [&](const std::unordered_map<std::string, std::string> &config_map) {
     const std::string kTopicName{"topic1"};
 
@@ -4143,6 +4233,9 @@ TEST_P(CypherMainVisitorTest, CreatePulsarStream) {
   TestInvalidQuery(
       "CREATE PULSAR STREAM stream TOPICS topic_name TRANSFORM transform.name BOOTSTRAP_SERVERS 'bootstrap'",
       ast_generator);
+  TestInvalidQuery(
+      "CREATE PULSAR STREAM stream TOPICS topic_name TRANSFORM transform.name SERVICE_URL 'test' WORKERS 2",
+      ast_generator);
   TestInvalidQuery<SemanticException>(
       "CREATE PULSAR STREAM stream TOPICS topic_name TRANSFORM transform.name SERVICE_URL 'test' TOPICS topic_name",
       ast_generator);
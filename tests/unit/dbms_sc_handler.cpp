@@ -333,6 +333,49 @@ TEST(DBMS_Handler, Delete) {
   ASSERT_TRUE(sch.Delete(ti1));
 }
 
+TEST(DBMS_Handler, LazyLoading) {
+  const auto lazy_directory = storage_directory.parent_path() / "MG_test_unit_dbms_sc_handler_lazy";
+  std::filesystem::remove_all(lazy_directory);
+  auto conf = storage_conf;
+  memgraph::storage::UpdatePaths(conf, lazy_directory);
+  auto make_handler = [&](bool lazy_loading) {
+    return std::make_unique<memgraph::dbms::SessionContextHandler>(
+        audit_log,
+        memgraph::dbms::SessionContextHandler::Config{
+            conf, interp_conf,
+            [](memgraph::utils::Synchronized<memgraph::auth::Auth, memgraph::utils::WritePrioritizedRWLock> *auth,
+               std::unique_ptr<memgraph::query::AuthQueryHandler> &ah,
+               std::unique_ptr<memgraph::query::AuthChecker> &ac) {
+              ah = std::make_unique<memgraph::glue::AuthQueryHandler>(auth, "");
+              ac = std::make_unique<memgraph::glue::AuthChecker>(auth);
+            }},
+        true, true, lazy_loading);
+  };
+
+  {
+    auto sch = make_handler(false);
+    ASSERT_TRUE(sch->New("lazy").HasValue());
+    auto sc = sch->Get("lazy");
+    auto acc = sc.interpreter_context->db->Access();
+    acc->CreateVertex();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto sch = make_handler(true);
+    // Listed and counted, but not recovered yet
+    ASSERT_THAT(sch->All(), testing::UnorderedElementsAre(memgraph::dbms::kDefaultDB, "lazy"));
+    ASSERT_EQ(sch->Info().num_databases, 2);
+    ASSERT_EQ(sch->Info().num_vertex, 0);
+    auto new_sc = sch->New("lazy");
+    ASSERT_TRUE(new_sc.HasError() && new_sc.GetError() == memgraph::dbms::NewError::EXISTS);
+    // Recovered on first use
+    auto sc = sch->Get("lazy");
+    ASSERT_EQ(sc.interpreter_context->db->GetInfo().vertex_count, 1);
+    ASSERT_THAT(sch->All(), testing::UnorderedElementsAre(memgraph::dbms::kDefaultDB, "lazy"));
+  }
+  std::filesystem::remove_all(lazy_directory);
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   // gtest takes ownership of the TestEnvironment ptr - we don't delete it.
@@ -309,6 +309,51 @@ TEST_F(ConsumerTest, InvalidBatchSize) {
   EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
 }
 
+TEST_F(ConsumerTest, InvalidMaxInFlightBatches) {
+  auto info = CreateDefaultConsumerInfo();
+
+  info.max_in_flight_batches = 0;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.max_in_flight_batches = -1;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.max_in_flight_batches = 4;
+  EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
+}
+
+TEST_F(ConsumerTest, PipelinedBatchesAreProcessedInOrder) {
+  auto info = CreateDefaultConsumerInfo();
+  info.batch_size = 1;
+  info.max_in_flight_batches = 3;
+  std::vector<int> received_values;
+  auto consumer_function = [&received_values](const std::vector<Message> &messages) mutable {
+    // Slow processing lets the next batches be polled in the meantime.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    for (const auto &message : messages) {
+      received_values.push_back(SpanToInt(message.Payload()));
+    }
+  };
+
+  auto consumer = CreateConsumer(std::move(info), std::move(consumer_function));
+  ASSERT_NE(consumer, nullptr);
+  consumer->Start();
+  ASSERT_TRUE(consumer->IsRunning());
+
+  static constexpr auto kMessageCount = 20;
+  for (auto value = 1; value <= kMessageCount; ++value) {
+    SeedTopicWithInt(kTopicName, value);
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(2));
+  // The already polled batches are processed before the consumer stops.
+  consumer->Stop();
+
+  ASSERT_EQ(received_values.size(), kMessageCount);
+  for (auto i = 0; i < kMessageCount; ++i) {
+    EXPECT_EQ(received_values[i], i + 1);
+  }
+}
+
 TEST_F(ConsumerTest, DISABLED_StartsFromPreviousOffset) {
   static constexpr auto kBatchSize = 1;
   auto info = CreateDefaultConsumerInfo();
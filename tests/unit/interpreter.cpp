@@ -115,6 +115,25 @@ TYPED_TEST(InterpreterTest, MultiplePulls) {
   }
 }
 
+TYPED_TEST(InterpreterTest, PrefetchedPulls) {
+  auto [stream, qid] = this->Prepare("UNWIND range(1, 2000) AS n RETURN n");
+  this->Pull(&stream, 1);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+
+  // The prefetched results are streamed by the following pulls.
+  this->default_interpreter.interpreter.Prefetch([] { return false; });
+  this->Pull(&stream, 1500);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  int stops = 0;
+  this->default_interpreter.interpreter.Prefetch([&stops] { return ++stops > 1; });
+  this->Pull(&stream);
+  ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 2000U);
+  for (int i = 0; i < 2000; ++i) {
+    ASSERT_EQ(stream.GetResults()[i][0].ValueInt(), i + 1);
+  }
+}
+
 // Run query with different ast twice to see if query executes correctly when
 // ast is read from cache.
 TYPED_TEST(InterpreterTest, AstCache) {
@@ -222,6 +241,42 @@ TYPED_TEST(InterpreterTest, Parameters) {
 }
 
 // Run CREATE/MATCH/MERGE queries with property map
+TYPED_TEST(InterpreterTest, InListParameter) {
+  this->Interpret("UNWIND range(0, 4) AS id CREATE ({id: id})");
+  this->Interpret("CREATE ({id: 'a'}), ({id: 2.0}), ({id: 2.5})");
+  std::vector<memgraph::storage::PropertyValue> ids{
+      memgraph::storage::PropertyValue(1), memgraph::storage::PropertyValue(3.0), memgraph::storage::PropertyValue("a"),
+      memgraph::storage::PropertyValue(2), memgraph::storage::PropertyValue()};
+  auto stream = this->Interpret("MATCH (n) WHERE n.id IN $ids RETURN count(n)",
+                                {{"ids", memgraph::storage::PropertyValue(ids)}});
+  ASSERT_EQ(stream.GetResults().size(), 1U);
+  // The integer 2 matches both 2 and 2.0, and the null doesn't match anything.
+  EXPECT_EQ(stream.GetResults()[0][0].ValueInt(), 5);
+}
+
+TYPED_TEST(InterpreterTest, UnwindListParameter) {
+  using memgraph::storage::PropertyValue;
+  std::vector<PropertyValue> batch{PropertyValue(1), PropertyValue("a"),
+                                   PropertyValue(std::vector<PropertyValue>{PropertyValue(2)})};
+  {
+    // The parameter is unwound for each input row.
+    auto stream = this->Interpret("UNWIND [1, 2] AS row UNWIND $batch AS x RETURN row, x",
+                                  {{"batch", PropertyValue(batch)}});
+    ASSERT_EQ(stream.GetResults().size(), 6U);
+    EXPECT_EQ(stream.GetResults()[0][1].ValueInt(), 1);
+    EXPECT_EQ(stream.GetResults()[1][1].ValueString(), "a");
+    EXPECT_EQ(stream.GetResults()[2][1].ValueList().size(), 1U);
+    EXPECT_EQ(stream.GetResults()[5][0].ValueInt(), 2);
+  }
+  {
+    auto stream =
+        this->Interpret("UNWIND $batch AS x RETURN x", {{"batch", PropertyValue(std::vector<PropertyValue>{})}});
+    EXPECT_TRUE(stream.GetResults().empty());
+  }
+  ASSERT_THROW(this->Interpret("UNWIND $batch AS x RETURN x", {{"batch", PropertyValue(1)}}),
+               memgraph::query::QueryRuntimeException);
+}
+
 TYPED_TEST(InterpreterTest, ParametersAsPropertyMap) {
   {
     std::map<std::string, memgraph::storage::PropertyValue> property_map{};
@@ -737,6 +792,21 @@ TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, MemoryEstimateLimit) {
+  this->Interpret("UNWIND range(1, 1000) AS id CREATE ({id: id});");
+  const auto memory_estimate = [this](const std::string &query) {
+    return this->Interpret(query).GetSummary().at("memory_estimate").ValueDouble();
+  };
+  const std::string ordered_pairs = "MATCH (a), (b) RETURN a, b ORDER BY a.id;";
+  EXPECT_GT(memory_estimate("EXPLAIN " + ordered_pairs), 1024.0 * 1024.0);
+  EXPECT_EQ(memory_estimate("EXPLAIN MATCH (n) RETURN n;"), 0.0);
+
+  FLAGS_query_max_estimated_memory_mib = 1;
+  EXPECT_THROW(this->Interpret(ordered_pairs), memgraph::query::MemoryEstimateExceededException);
+  EXPECT_NO_THROW(this->Interpret("MATCH (n) RETURN n;"));
+  FLAGS_query_max_estimated_memory_mib = 0;
+}
+
 TYPED_TEST(InterpreterTest, ProfileQuery) {
   EXPECT_EQ(this->interpreter_context.plan_cache.size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
@@ -1084,6 +1154,97 @@ TYPED_TEST(InterpreterTest, CacheableQueries) {
   }
 }
 
+TYPED_TEST(InterpreterTest, CachedPlanCardinalityDrift) {
+  auto is_cached = [this](const std::shared_ptr<memgraph::query::CachedPlan> &plan) {
+    auto access = this->interpreter_context.plan_cache.access();
+    return std::any_of(access.begin(), access.end(), [&](const auto &entry) { return entry.second == plan; });
+  };
+  auto cached_plans = [this] {
+    std::vector<std::shared_ptr<memgraph::query::CachedPlan>> plans;
+    auto access = this->interpreter_context.plan_cache.access();
+    for (const auto &entry : access) plans.push_back(entry.second);
+    return plans;
+  };
+
+  this->Interpret("CREATE INDEX ON :A");
+  this->Interpret("CREATE (:A)");
+  auto plans_before = cached_plans();
+  this->Interpret("MATCH (n:A) RETURN n");
+  std::shared_ptr<memgraph::query::CachedPlan> plan;
+  for (const auto &cached_plan : cached_plans()) {
+    if (std::find(plans_before.begin(), plans_before.end(), cached_plan) == plans_before.end()) plan = cached_plan;
+  }
+  ASSERT_TRUE(plan);
+
+  {
+    SCOPED_TRACE("Small change of the label count");
+    this->Interpret("CREATE (:A)");
+    this->Interpret("MATCH (n:A) RETURN n");
+    EXPECT_TRUE(is_cached(plan));
+  }
+
+  {
+    SCOPED_TRACE("Label count drifted");
+    this->Interpret("UNWIND range(1, 10) AS i CREATE (:A)");
+    this->Interpret("MATCH (n:A) RETURN n");
+    EXPECT_FALSE(is_cached(plan));
+  }
+}
+
+TYPED_TEST(InterpreterTest, CachedPlanUnderestimatedCardinality) {
+  auto cached_plans = [this] {
+    std::vector<std::shared_ptr<memgraph::query::CachedPlan>> plans;
+    auto access = this->interpreter_context.plan_cache.access();
+    for (const auto &entry : access) plans.push_back(entry.second);
+    return plans;
+  };
+
+  this->Interpret("CREATE INDEX ON :A");
+  this->Interpret("CREATE (a:A) WITH a UNWIND range(1, 1000) AS i CREATE (a)-[:T]->(:B)");
+
+  const std::string query = "MATCH (a:A)-[:T]->(b) RETURN count(b)";
+  auto interpret_and_get_plan = [&] {
+    auto plans_before = cached_plans();
+    this->Interpret(query);
+    std::shared_ptr<memgraph::query::CachedPlan> plan;
+    for (const auto &cached_plan : cached_plans()) {
+      if (std::find(plans_before.begin(), plans_before.end(), cached_plan) == plans_before.end()) plan = cached_plan;
+    }
+    return plan;
+  };
+
+  auto plan = interpret_and_get_plan();
+  ASSERT_TRUE(plan);
+
+  // The aggregation received many more rows than estimated for the plan.
+  auto corrected_plan = interpret_and_get_plan();
+  ASSERT_TRUE(corrected_plan);
+  EXPECT_NE(corrected_plan, plan);
+
+  // The plan made with the feedback is kept.
+  EXPECT_FALSE(interpret_and_get_plan());
+}
+
+TYPED_TEST(InterpreterTest, CachedPlanVariantsForSkewedParameters) {
+  auto plan_cache_size = [this] { return this->interpreter_context.plan_cache.access().size(); };
+
+  this->Interpret("CREATE INDEX ON :A(x)");
+  this->Interpret("UNWIND range(1, 1000) AS i CREATE (:A {x: 1})");
+  this->Interpret("CREATE (:A {x: 2})");
+  this->Interpret("ANALYZE GRAPH");
+
+  const std::string query = "MATCH (n:A {x: $x}) RETURN n";
+  this->Interpret(query, {{"x", memgraph::storage::PropertyValue(1)}});
+  const auto cached_plans = plan_cache_size();
+  this->Interpret(query, {{"x", memgraph::storage::PropertyValue(1)}});
+  EXPECT_EQ(plan_cache_size(), cached_plans);
+  this->Interpret(query, {{"x", memgraph::storage::PropertyValue(2)}});
+  EXPECT_EQ(plan_cache_size(), cached_plans + 1);
+  this->Interpret(query, {{"x", memgraph::storage::PropertyValue(2)}});
+  this->Interpret(query, {{"x", memgraph::storage::PropertyValue(1)}});
+  EXPECT_EQ(plan_cache_size(), cached_plans + 1);
+}
+
 TYPED_TEST(InterpreterTest, AllowLoadCsvConfig) {
   const auto check_load_csv_queries = [&](const bool allow_load_csv) {
     TmpDirManager directory_manager{"allow_load_csv"};
@@ -1128,6 +1289,72 @@ void AssertAllValuesAreZero(const std::map<std::string, memgraph::communication:
   }
 }
 
+TYPED_TEST(InterpreterTest, Bookmarks) {
+  auto stream = this->Interpret("CREATE ();");
+  ASSERT_EQ(stream.GetSummary().count("bookmark"), 1);
+  ASSERT_TRUE(stream.GetSummary().at("bookmark").IsString());
+  const auto bookmark = stream.GetSummary().at("bookmark").ValueString();
+  ASSERT_EQ(this->default_interpreter.interpreter.GetBookmark(), bookmark);
+
+  auto prepare_with_bookmarks = [this](std::vector<std::string> bookmarks) {
+    memgraph::query::QueryExtras extras;
+    extras.bookmarks = std::move(bookmarks);
+    ResultStreamFaker result(this->interpreter_context.db.get());
+    const auto [header, _1, qid, _2] =
+        this->default_interpreter.interpreter.Prepare("MATCH (n) RETURN n;", {}, nullptr, extras);
+    result.Header(header);
+    const auto summary = this->default_interpreter.interpreter.Pull(&result, {}, qid);
+    result.Summary(summary);
+    return result.GetResults().size();
+  };
+  // The transaction is already committed on this instance.
+  ASSERT_EQ(prepare_with_bookmarks({bookmark}), 1);
+  // Bookmarks of other databases are ignored.
+  ASSERT_EQ(prepare_with_bookmarks({"other_database:1000000"}), 1);
+  ASSERT_THROW(prepare_with_bookmarks({"invalid"}), memgraph::query::QueryException);
+}
+
+TYPED_TEST(InterpreterTest, PreparedStatements) {
+  this->Interpret("CREATE (:Node {id: 1}), (:Node {id: 2}), (:Node {id: 3})");
+
+  auto execute = [this](const std::string &query, int64_t id) {
+    memgraph::query::QueryExtras extras;
+    extras.prepared_statement = "by_id";
+    ResultStreamFaker result(this->interpreter_context.db.get());
+    const auto [header, _1, qid, _2] = this->default_interpreter.interpreter.Prepare(
+        query, {{"id", memgraph::storage::PropertyValue(id)}}, nullptr, extras);
+    result.Header(header);
+    const auto summary = this->default_interpreter.interpreter.Pull(&result, {}, qid);
+    result.Summary(summary);
+    EXPECT_EQ(result.GetHeader(), std::vector<std::string>{"n.id"});
+    return result.GetResults();
+  };
+
+  auto results = execute("MATCH (n:Node) WHERE n.id >= $id RETURN n.id", 2);
+  ASSERT_EQ(results.size(), 2);
+  // The statement is executed by its name with other parameters.
+  results = execute("", 3);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0][0].ValueInt(), 3);
+  // Creating an index unpins the plan, which is made again.
+  this->Interpret("CREATE INDEX ON :Node(id)");
+  results = execute("", 1);
+  ASSERT_EQ(results.size(), 3);
+  // Preparing the statement again replaces it.
+  results = execute("MATCH (n:Node) WHERE n.id = $id RETURN n.id", 1);
+  ASSERT_EQ(results.size(), 1);
+  results = execute("", 2);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0][0].ValueInt(), 2);
+
+  memgraph::query::QueryExtras extras;
+  extras.prepared_statement = "missing";
+  ASSERT_THROW(this->default_interpreter.interpreter.Prepare("", {}, nullptr, extras), memgraph::query::QueryException);
+  extras.prepared_statement = "index";
+  ASSERT_THROW(this->default_interpreter.interpreter.Prepare("CREATE INDEX ON :Node", {}, nullptr, extras),
+               memgraph::query::QueryException);
+}
+
 TYPED_TEST(InterpreterTest, ExecutionStatsIsValid) {
   {
     auto [stream, qid] = this->Prepare("MATCH (n) DELETE n;");
@@ -1473,6 +1700,114 @@ TYPED_TEST(InterpreterTest, TriggerInfoNotifications) {
   }
 }
 
+TYPED_TEST(InterpreterTest, MaterializedViews) {
+  if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) {
+    ASSERT_THROW(this->Interpret("CREATE MATERIALIZED VIEW people AS MATCH (n) RETURN count(*)"),
+                 memgraph::query::QueryException);
+    return;
+  }
+
+  this->Interpret(
+      "CREATE (:Person {city: 'A', age: 20}), (:Person {city: 'A', age: 30}), (:Person {city: 'B', age: 10})");
+  this->Interpret(
+      "CREATE MATERIALIZED VIEW people AS MATCH (n:Person) WHERE n.age > 18 "
+      "RETURN n.city AS city, count(*) AS count, sum(n.age) AS total");
+  this->Interpret("CREATE MATERIALIZED VIEW knows AS MATCH (a)-[r:KNOWS]->(b) RETURN count(*) AS count");
+
+  using Groups = std::map<std::string, std::pair<int64_t, int64_t>>;
+  auto read_people = [this] {
+    auto stream = this->Interpret("SHOW MATERIALIZED VIEW people");
+    EXPECT_EQ(stream.GetHeader(), (std::vector<std::string>{"city", "count", "total"}));
+    Groups groups;
+    for (const auto &row : stream.GetResults()) {
+      groups[row[0].ValueString()] = {row[1].ValueInt(), row[2].ValueInt()};
+    }
+    return groups;
+  };
+  EXPECT_EQ(read_people(), (Groups{{"A", {2, 50}}}));
+
+  this->Interpret("MATCH (n:Person {city: 'B'}) SET n.age = 40");
+  EXPECT_EQ(read_people(), (Groups{{"A", {2, 50}}, {"B", {1, 40}}}));
+
+  this->Interpret("MATCH (n:Person {age: 20}) DETACH DELETE n");
+  EXPECT_EQ(read_people(), (Groups{{"A", {1, 30}}, {"B", {1, 40}}}));
+
+  // The rows of the objects changed several times in a transaction are
+  // updated once.
+  this->Interpret("BEGIN");
+  this->Interpret("CREATE (:Person {city: 'B', age: 50})");
+  this->Interpret("MATCH (n:Person {age: 50}) SET n.city = 'C'");
+  this->Interpret("MATCH (n:Person {city: 'A'}) REMOVE n:Person");
+  this->Interpret("COMMIT");
+  EXPECT_EQ(read_people(), (Groups{{"B", {1, 40}}, {"C", {1, 50}}}));
+
+  {
+    auto stream = this->Interpret("SHOW MATERIALIZED VIEW knows");
+    ASSERT_EQ(stream.GetResults().size(), 1U);
+    EXPECT_EQ(stream.GetResults()[0][0].ValueInt(), 0);
+  }
+  this->Interpret("MATCH (a:Person {city: 'B'}), (b:Person {city: 'C'}) CREATE (a)-[:KNOWS]->(b), (a)-[:LIKES]->(b)");
+  {
+    auto stream = this->Interpret("SHOW MATERIALIZED VIEW knows");
+    ASSERT_EQ(stream.GetResults().size(), 1U);
+    EXPECT_EQ(stream.GetResults()[0][0].ValueInt(), 1);
+  }
+
+  {
+    auto stream = this->Interpret("SHOW MATERIALIZED VIEWS");
+    ASSERT_EQ(stream.GetResults().size(), 2U);
+    EXPECT_EQ(stream.GetResults()[0][0].ValueString(), "knows");
+    EXPECT_EQ(stream.GetResults()[0][1].ValueString(), "MATCH (a)-[r:KNOWS]->(b) RETURN count(*) AS count");
+  }
+
+  // Aggregations whose rows depend on other objects can't be maintained.
+  ASSERT_THROW(this->Interpret("CREATE MATERIALIZED VIEW invalid AS MATCH (n) RETURN collect(n.age)"),
+               memgraph::query::QueryException);
+  ASSERT_THROW(this->Interpret("CREATE MATERIALIZED VIEW invalid AS MATCH (a)-[r]->(b) RETURN b.age, count(*)"),
+               memgraph::query::QueryException);
+  ASSERT_THROW(this->Interpret("CREATE MATERIALIZED VIEW people AS MATCH (n) RETURN count(*)"),
+               memgraph::query::QueryException);
+
+  this->Interpret("DROP MATERIALIZED VIEW people");
+  this->Interpret("DROP MATERIALIZED VIEW knows");
+  ASSERT_THROW(this->Interpret("SHOW MATERIALIZED VIEW people"), memgraph::query::QueryException);
+}
+
+TYPED_TEST(InterpreterTest, IndexRecommendations) {
+  this->Interpret("CREATE INDEX ON :Person");
+  this->Interpret("CREATE (:Person {age: 20}), (:Person {age: 30}), (:Person {age: 40})");
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(this->Interpret("MATCH (n:Person) WHERE n.age = 20 RETURN n").GetResults().size(), 1U);
+  }
+  ASSERT_EQ(this->Interpret("MATCH (n:Person) WHERE n.age > 35 RETURN n").GetResults().size(), 1U);
+  // Properties compared with other properties of the vertex can't be looked
+  // up in an index.
+  this->Interpret("MATCH (n:Person) WHERE n.age = n.other RETURN n");
+
+  {
+    auto stream = this->Interpret("SHOW INDEX RECOMMENDATIONS");
+    EXPECT_EQ(stream.GetHeader(),
+              (std::vector<std::string>{"index type", "label", "properties", "comparison", "executions",
+                                        "scanned_rows", "discarded_rows", "estimated_saved_cost"}));
+    const auto &results = stream.GetResults();
+    ASSERT_EQ(results.size(), 2U);
+    EXPECT_EQ(results[0][0].ValueString(), "label+property");
+    EXPECT_EQ(results[0][1].ValueString(), "Person");
+    EXPECT_EQ(results[0][2].ValueString(), "age");
+    EXPECT_EQ(results[0][3].ValueString(), "equality");
+    EXPECT_EQ(results[0][4].ValueInt(), 3);
+    EXPECT_EQ(results[0][5].ValueInt(), 9);
+    EXPECT_EQ(results[0][6].ValueInt(), 6);
+    EXPECT_EQ(results[1][3].ValueString(), "range");
+    EXPECT_EQ(results[1][4].ValueInt(), 1);
+    EXPECT_GT(results[0][7].ValueDouble(), results[1][7].ValueDouble());
+  }
+
+  // The indices which exist aren't recommended.
+  this->Interpret("CREATE INDEX ON :Person(age)");
+  EXPECT_TRUE(this->Interpret("SHOW INDEX RECOMMENDATIONS").GetResults().empty());
+}
+
 TYPED_TEST(InterpreterTest, LoadCsvClauseNotification) {
   auto dir_manager = TmpDirManager("csv_directory");
   const auto csv_path = dir_manager.Path() / "file.csv";
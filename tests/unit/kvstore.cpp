@@ -41,6 +41,17 @@ TEST_F(KVStore, PutMultipleGet) {
   ASSERT_EQ(kvstore.Get("key2").value(), "value2");
 }
 
+TEST_F(KVStore, PutMultipleGetMultiple) {
+  memgraph::kvstore::KVStore kvstore(test_folder_ / "PutMultipleGetMultiple");
+  ASSERT_TRUE(kvstore.PutMultiple({{"key1", "value1"}, {"key2", "value2"}}));
+  auto values = kvstore.GetMultiple({"key2", "key3", "key1"});
+  ASSERT_EQ(values.size(), 3);
+  ASSERT_EQ(values[0].value(), "value2");
+  ASSERT_FALSE(static_cast<bool>(values[1]));
+  ASSERT_EQ(values[2].value(), "value1");
+  ASSERT_TRUE(kvstore.GetMultiple({}).empty());
+}
+
 TEST_F(KVStore, PutGetDeleteGet) {
   memgraph::kvstore::KVStore kvstore(test_folder_ / "PutGetDeleteGet");
   ASSERT_TRUE(kvstore.Put("key", "value"));
@@ -235,3 +246,40 @@ TEST_F(KVStore, IteratorPrefix) {
   it = kvstore.begin("unexisting_prefix");
   ASSERT_FALSE(it.IsValid());
 }
+
+TEST_F(KVStore, IteratorPrefixUpperBound) {
+  memgraph::kvstore::KVStore kvstore(test_folder_ / "IteratorPrefixUpperBound");
+
+  const std::string prefix{"a\xff"};
+  ASSERT_TRUE(kvstore.Put(prefix + "\xff", "value1"));
+  ASSERT_TRUE(kvstore.Put("b", "value2"));
+
+  auto it = kvstore.begin(prefix);
+  ASSERT_TRUE(it.IsValid());
+  EXPECT_EQ(it->first, prefix + "\xff");
+
+  ++it;
+  ASSERT_FALSE(it.IsValid());
+}
+
+TEST_F(KVStore, IteratorSnapshot) {
+  memgraph::kvstore::KVStore kvstore(test_folder_ / "IteratorSnapshot");
+
+  ASSERT_TRUE(kvstore.Put("a_1", "value1"));
+  ASSERT_TRUE(kvstore.Put("a_2", "value2"));
+
+  auto it = kvstore.begin("a_");
+  ASSERT_TRUE(kvstore.Put("a_3", "value3"));
+  ASSERT_TRUE(kvstore.Delete("a_2"));
+
+  ASSERT_TRUE(it.IsValid());
+  EXPECT_EQ(it->first, "a_1");
+
+  ++it;
+  ASSERT_TRUE(it.IsValid());
+  EXPECT_EQ(it->first, "a_2");
+  EXPECT_EQ(it->second, "value2");
+
+  ++it;
+  ASSERT_FALSE(it.IsValid());
+}
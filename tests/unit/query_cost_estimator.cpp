@@ -10,6 +10,8 @@
 // licenses/APL.txt.
 
 #include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 
 #include "query/db_accessor.hpp"
@@ -169,6 +171,26 @@ TEST_F(QueryCostEstimator, ScanAllByLabelPropertyRangeConstExpr) {
   }
 }
 
+TEST_F(QueryCostEstimator, ScanAllByLabelPropertyRangeHistogram) {
+  AddVertices(100, 30, 20);
+  // A skewed distribution in which most of the vertices have the same value.
+  std::map<memgraph::storage::PropertyValue, int64_t> values_map{{memgraph::storage::PropertyValue(0), 1000}};
+  for (int64_t value = 1; value < 100; ++value) {
+    values_map.emplace(memgraph::storage::PropertyValue(value), 1);
+  }
+  memgraph::storage::LabelPropertyIndexStats stats{
+      .count = 1099, .distinct_values_count = 100, .statistic = 0, .avg_group_size = 10.99, .avg_degree = 0};
+  stats.histogram = memgraph::storage::PropertyValueHistogram::Build(values_map);
+  dba->SetIndexStats(label, property, stats);
+
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, "property", InclusiveBound(Literal(0)),
+                                      InclusiveBound(Literal(0)));
+  EXPECT_COST(1000 * CostParam::MakeScanAllByLabelPropertyRange);
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, "property", InclusiveBound(Literal(50)),
+                                      InclusiveBound(Literal(60)));
+  EXPECT_COST(11 * CostParam::MakeScanAllByLabelPropertyRange);
+}
+
 TEST_F(QueryCostEstimator, Expand) {
   MakeOp<Expand>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Direction::IN,
                  std::vector<memgraph::storage::EdgeTypeId>{}, false, memgraph::storage::View::OLD);
@@ -256,6 +278,21 @@ TEST_F(QueryCostEstimator, UnwindNoLiteral) {
           MiscParam::kUnwindNoLiteral);
 }
 
+TEST_F(QueryCostEstimator, LoadedCostParams) {
+  const auto path = std::filesystem::temp_directory_path() / "query_cost_estimator_cost_model.json";
+  {
+    std::ofstream file(path);
+    file << R"({"ScanAll": 2.5, "NotAnOperator": 1.0})";
+  }
+  const auto default_cost = CostParam::kScanAll;
+  LoadCostParams(path);
+  std::filesystem::remove(path);
+  AddVertices(100, 30, 20);
+  MakeOp<ScanAll>(last_op_, NextSymbol());
+  EXPECT_COST(100 * 2.5);
+  CostParam::kScanAll = default_cost;
+}
+
 #undef TEST_OP
 #undef EXPECT_COST
 //
@@ -24,7 +24,9 @@
 #include "query/db_accessor.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/opencypher/parser.hpp"
+#include "query/frontend/semantic/constant_expressions.hpp"
 #include "query/interpret/awesome_memgraph_functions.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpret/frame.hpp"
 #include "query/path.hpp"
@@ -835,6 +837,24 @@ TYPED_TEST(ExpressionEvaluatorTest, ParameterLookup) {
   EXPECT_EQ(value.ValueInt(), 42);
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, ConstantExpressions) {
+  EXPECT_TRUE(IsConstantExpression(*FN("toLower", PARAMETER_LOOKUP(0))));
+  EXPECT_TRUE(IsConstantExpression(*LIST(LITERAL(1), ADD(PARAMETER_LOOKUP(0), LITERAL(2)))));
+  EXPECT_FALSE(IsConstantExpression(*FN("rand")));
+  EXPECT_FALSE(IsConstantExpression(*FN("timestamp")));
+  EXPECT_FALSE(IsConstantExpression(*LIST(LITERAL(1), IDENT("x"))));
+
+  // A constant expression is evaluated once per execution, so the counter
+  // isn't incremented again.
+  auto *counter = FN("counter", LITERAL("c"), LITERAL(0));
+  EXPECT_EQ(this->Eval(counter).ValueInt(), 0);
+  EXPECT_EQ(this->Eval(counter).ValueInt(), 1);
+  auto *constant_counter = FN("counter", LITERAL("d"), LITERAL(0));
+  constant_counter->is_constant_ = true;
+  EXPECT_EQ(this->Eval(constant_counter).ValueInt(), 0);
+  EXPECT_EQ(this->Eval(constant_counter).ValueInt(), 0);
+}
+
 TYPED_TEST(ExpressionEvaluatorTest, FunctionAll1) {
   AstStorage storage;
   auto *ident_x = IDENT("x");
@@ -1101,6 +1121,48 @@ TYPED_TEST(ExpressionEvaluatorTest, FunctionReduce) {
   EXPECT_EQ(value.ValueInt(), 3);
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, FunctionReduceNumbers) {
+  const auto acc_sym = this->symbol_table.CreateSymbol("acc", true);
+  const auto x_sym = this->symbol_table.CreateSymbol("x", true);
+  auto add = [&](auto *acc, auto *x) -> Expression * { return ADD(acc, x); };
+  auto multiply = [&](auto *acc, auto *x) -> Expression * {
+    return this->storage.template Create<MultiplicationOperator>(x, acc);
+  };
+  auto subtract = [&](auto *acc, auto *x) -> Expression * {
+    return this->storage.template Create<SubtractionOperator>(acc, x);
+  };
+  auto make_reduce = [&](auto *list, auto make_expression) {
+    auto *ident_acc = IDENT("acc");
+    auto *ident_x = IDENT("x");
+    ident_acc->MapTo(acc_sym);
+    ident_x->MapTo(x_sym);
+    auto *reduce = REDUCE("acc", LITERAL(1), "x", list, make_expression(ident_acc, ident_x));
+    reduce->accumulator_->MapTo(acc_sym);
+    reduce->identifier_->MapTo(x_sym);
+    return reduce;
+  };
+  {
+    // The accumulator becomes a double after the first double element.
+    auto value = this->Eval(make_reduce(LIST(LITERAL(2), LITERAL(1.5), LITERAL(3)), multiply));
+    ASSERT_TRUE(value.IsDouble());
+    EXPECT_DOUBLE_EQ(value.ValueDouble(), 9.0);
+  }
+  {
+    auto value = this->Eval(make_reduce(LIST(LITERAL(2), LITERAL(3)), add));
+    ASSERT_TRUE(value.IsInt());
+    EXPECT_EQ(value.ValueInt(), 6);
+  }
+  {
+    auto value = this->Eval(make_reduce(LIST(LITERAL(2), LITERAL(memgraph::storage::PropertyValue())), add));
+    EXPECT_TRUE(value.IsNull());
+  }
+  {
+    auto value = this->Eval(make_reduce(LIST(LITERAL(2), LITERAL(3)), subtract));
+    ASSERT_TRUE(value.IsInt());
+    EXPECT_EQ(value.ValueInt(), -4);
+  }
+}
+
 TYPED_TEST(ExpressionEvaluatorTest, FunctionExtract) {
   AstStorage storage;
   auto *ident_x = IDENT("x");
@@ -1186,6 +1248,16 @@ TYPED_TEST(ExpressionEvaluatorTest, RegexMatch) {
   EXPECT_TRUE(this->Eval(this->storage.template Create<RegexMatch>(LITERAL("text"), LITERAL(".+[ext]"))).ValueBool());
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, RegexMatchPatternChanges) {
+  auto *regex_match = this->storage.template Create<RegexMatch>(LITERAL("text"), PARAMETER_LOOKUP(0));
+  this->ctx.parameters.Add(0, memgraph::storage::PropertyValue(".*ext"));
+  EXPECT_TRUE(this->Eval(regex_match).ValueBool());
+  EXPECT_TRUE(this->Eval(regex_match).ValueBool());
+  this->ctx.parameters = Parameters{};
+  this->ctx.parameters.Add(0, memgraph::storage::PropertyValue(".*ex"));
+  EXPECT_FALSE(this->Eval(regex_match).ValueBool());
+}
+
 template <typename StorageType>
 class ExpressionEvaluatorPropertyLookup : public ExpressionEvaluatorTest<StorageType> {
  protected:
@@ -1215,6 +1287,37 @@ TYPED_TEST(ExpressionEvaluatorPropertyLookup, Vertex) {
   EXPECT_TRUE(this->Value(this->prop_height).IsNull());
 }
 
+TYPED_TEST(ExpressionEvaluatorPropertyLookup, CompiledExpression) {
+  auto v1 = this->dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(this->prop_age.second, memgraph::storage::PropertyValue(10)).HasValue());
+  this->dba.AdvanceCommand();
+  this->frame[this->symbol] = TypedValue(v1);
+  this->ctx.parameters.Add(0, memgraph::storage::PropertyValue(2));
+  auto *age = this->storage.template Create<PropertyLookup>(this->identifier, this->storage.GetPropertyIx("age"));
+  auto *height = this->storage.template Create<PropertyLookup>(this->identifier, this->storage.GetPropertyIx("height"));
+  this->ctx.properties = NamesToProperties(this->storage.properties_, &this->dba);
+  // The compiled expression evaluates to the same values as the evaluator,
+  // also for the subexpressions it leaves to the evaluator.
+  auto *times = this->storage.template Create<MultiplicationOperator>(LITERAL(2), PARAMETER_LOOKUP(0));
+  std::vector<Expression *> expressions{
+      AND(GREATER(ADD(age, times), LITERAL(13)), IN_LIST(age, LIST(LITERAL(10), LITERAL(20)))),
+      AND(LESS(height, LITERAL(1)), LITERAL(true)),
+      AND(EQ(age, LITERAL(11)), LITERAL("not a bool")),
+      OR(IS_NULL(height), NOT(LESS_EQ(age, LITERAL(9.5)))),
+      ADD(age, LITERAL(" years"))};
+  for (auto *expression : expressions) {
+    CompiledExpression compiled(expression);
+    EXPECT_GT(compiled.Size(), 1U);
+    auto expected = expression->Accept(this->eval);
+    auto value = compiled.Evaluate(this->eval);
+    EXPECT_EQ(value.GetMemoryResource(), &this->mem);
+    EXPECT_TRUE(TypedValue::BoolEqual{}(value, expected));
+  }
+  // The errors are the same as the evaluator's.
+  CompiledExpression invalid(AND(LITERAL(true), age));
+  EXPECT_THROW(invalid.Evaluate(this->eval), QueryRuntimeException);
+}
+
 TYPED_TEST(ExpressionEvaluatorPropertyLookup, Duration) {
   const memgraph::utils::Duration dur({10, 1, 30, 2, 22, 45});
   this->frame[this->symbol] = TypedValue(dur);
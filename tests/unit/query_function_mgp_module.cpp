@@ -48,3 +48,31 @@ TEST(Module, CaseSensitiveFunctionNames) {
   EXPECT_EQ(mgp_module_add_function(&module, "NOT_SAME", DummyCallback, &func), mgp_error::MGP_ERROR_NO_ERROR);
   EXPECT_EQ(module.functions.size(), 3U);
 }
+
+static void DummyScalarCallback(const mgp_scalar *, size_t, mgp_scalar *, mgp_func_result *, mgp_memory *){};
+
+TEST(Module, ScalarFunctionArguments) {
+  mgp_module module(memgraph::utils::NewDeleteResource());
+  mgp_memory memory{memgraph::utils::NewDeleteResource()};
+  mgp_func *func{nullptr};
+  EXPECT_EQ(mgp_module_add_scalar_function(&module, "hash", DummyScalarCallback, MGP_SCALAR_TYPE_INT, &func),
+            mgp_error::MGP_ERROR_NO_ERROR);
+  EXPECT_EQ(mgp_func_add_arg(func, "value", EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_string)),
+            mgp_error::MGP_ERROR_NO_ERROR);
+  auto *int_type = EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_int);
+  EXPECT_EQ(mgp_func_add_arg(func, "values", EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_list, int_type)),
+            mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  EXPECT_EQ(mgp_func_add_arg(func, "maybe", EXPECT_MGP_NO_ERROR(mgp_type *, mgp_type_nullable, int_type)),
+            mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+  auto default_value =
+      test_utils::CreateValueOwningPtr(EXPECT_MGP_NO_ERROR(mgp_value *, mgp_value_make_int, 7, &memory));
+  EXPECT_EQ(mgp_func_add_opt_arg(func, "seed", int_type, default_value.get()),
+            mgp_error::MGP_ERROR_NO_ERROR);
+
+  ASSERT_EQ(func->args.size(), 1U);
+  ASSERT_EQ(func->opt_args.size(), 1U);
+  ASSERT_EQ(func->scalar_arg_types.size(), 2U);
+  EXPECT_EQ(func->scalar_arg_types[0], MGP_SCALAR_TYPE_STRING);
+  EXPECT_EQ(func->scalar_arg_types[1], MGP_SCALAR_TYPE_INT);
+  EXPECT_EQ(func->scalar_result_type, MGP_SCALAR_TYPE_INT);
+}
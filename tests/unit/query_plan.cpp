@@ -643,6 +643,20 @@ TYPED_TEST(TestPlanner, MatchOptionalMatchNodePropertyWithIndex) {
   DeleteListContent(&optional);
 }
 
+TYPED_TEST(TestPlanner, MatchOptionalMatchNodePropertyHashJoin) {
+  // Test MATCH (n:Label) OPTIONAL MATCH (m:Label) WHERE n.prop = m.prop RETURN n
+  FakeDbAccessor dba;
+  const auto prop = PROPERTY_PAIR(dba, "prop");
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))), OPTIONAL_MATCH(PATTERN(NODE("m", "label"))),
+      WHERE(EQ(PROPERTY_LOOKUP(dba, "n", prop.second), PROPERTY_LOOKUP(dba, "m", prop.second))), RETURN("n")));
+  // Without the property index, m is scanned once into a hash table instead
+  // of being scanned for each n.
+  auto left = MakeCheckers(ExpectScanAll(), ExpectFilter());
+  auto right = MakeCheckers(ExpectScanAll(), ExpectFilter());
+  CheckPlan<TypeParam>(query, this->storage, ExpectHashJoin(left, right, true), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MatchUnwindReturn) {
   // Test MATCH (n) UNWIND [1,2,3] AS x RETURN n, x
   FakeDbAccessor dba;
@@ -690,9 +704,12 @@ TYPED_TEST(TestPlanner, MatchCrossReferenceVariable) {
   auto n_prop = PROPERTY_LOOKUP(dba, "n", prop.second);
   std::get<0>(node_m->properties_)[this->storage.GetPropertyIx(prop.first)] = n_prop;
   auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(node_n), PATTERN(node_m)), RETURN("n")));
-  // We expect both ScanAll to come before filters (2 are joined into one),
-  // because they need to populate the symbol values.
-  CheckPlan<TypeParam>(query, this->storage, ExpectScanAll(), ExpectScanAll(), ExpectFilter(), ExpectProduce());
+  // We expect m to be joined with n by a hash table on one of the equalities,
+  // and the other one to be filtered after the join, because both ScanAll need
+  // to populate the symbol values.
+  auto left = MakeCheckers(ExpectScanAll());
+  auto right = MakeCheckers(ExpectScanAll());
+  CheckPlan<TypeParam>(query, this->storage, ExpectHashJoin(left, right), ExpectFilter(), ExpectProduce());
 }
 
 TYPED_TEST(TestPlanner, MatchWhereBeforeExpand) {
@@ -1082,6 +1099,192 @@ TYPED_TEST(TestPlanner, MultiPropertyIndexScan) {
             ExpectScanAllByLabelPropertyValue(label2, prop2, lit_2), ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, CompositeIndexedEquality) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = dba.Property("a");
+  auto b = dba.Property("b");
+  dba.SetIndexCount(label, a, 10);
+  dba.SetIndexCount(label, {a, b}, 10);
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1)), EQ(PROPERTY_LOOKUP(dba, "n", b), LITERAL(2)))),
+      RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelProperties(label, {a, b}, 2, false), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, CompositeIndexedEqualityAndRange) {
+  // Test MATCH (n :label) WHERE n.a = 1 AND n.b > 2 AND n.c = 3 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = dba.Property("a");
+  auto b = dba.Property("b");
+  auto c = dba.Property("c");
+  dba.SetIndexCount(label, {a, b, c}, 10);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(AND(AND(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1)),
+                                                 GREATER(PROPERTY_LOOKUP(dba, "n", b), LITERAL(2))),
+                                             EQ(PROPERTY_LOOKUP(dba, "n", c), LITERAL(3)))),
+                                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // Only the prefix and the range are served by the index, `n.c = 3` remains
+  // a filter.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelProperties(label, {a, b, c}, 1, true), ExpectFilter(),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, CompositeIndexNotUsedForSingleProperty) {
+  // Test MATCH (n :label) WHERE n.a = 1 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto a = PROPERTY_PAIR(dba, "a");
+  auto b = dba.Property("b");
+  dba.SetIndexCount(label, 10);
+  dba.SetIndexCount(label, {a.second, b}, 10);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP(dba, "n", a), LITERAL(1))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectFilter(), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, TextIndexedLookup) {
+  // Test MATCH (n :label) WHERE n.name CONTAINS "mem" RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto name = dba.Property("name");
+  dba.SetIndexCount(label, 100);
+  dba.SetTextIndexCount(label, name, 1);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(FN("contains", PROPERTY_LOOKUP(dba, "n", name), LITERAL("mem"))),
+                                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The index checks the values against the pattern, so the filter is dropped.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByText(label, name, memgraph::storage::TextMatch::CONTAINS), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, TextIndexNotUsedWithoutIndex) {
+  // Test MATCH (n :label) WHERE n.name STARTS WITH "mem" RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto name = dba.Property("name");
+  dba.SetIndexCount(label, 100);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                   WHERE(FN("startsWith", PROPERTY_LOOKUP(dba, "n", name), LITERAL("mem"))),
+                                   RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectFilter(), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, PointIndexedLookupWithinDistance) {
+  // Test MATCH (n :label) WHERE distance(n.location, point({x: 0, y: 0})) <= 100 RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto location = dba.Property("location");
+  dba.SetIndexCount(label, 100);
+  dba.SetPointIndex(label, location);
+  auto *center =
+      FN("point", MAP({this->storage.GetPropertyIx("x"), LITERAL(0)}, {this->storage.GetPropertyIx("y"), LITERAL(0)}));
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(LESS_EQ(FN("distance", PROPERTY_LOOKUP(dba, "n", location), center), LITERAL(100))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The index checks the points against the region, so the filter is dropped.
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByPoint(label, location, memgraph::storage::PointRegion::Type::WITHIN_DISTANCE),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, PointIndexedLookupWithinBox) {
+  // Test MATCH (n :label) WHERE withinbbox(n.location, point({x: 0, y: 0}), point({x: 1, y: 1})) RETURN n
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto location = dba.Property("location");
+  dba.SetIndexCount(label, 100);
+  dba.SetPointIndex(label, location);
+  auto make_point = [this](int64_t x, int64_t y) {
+    return FN("point",
+              MAP({this->storage.GetPropertyIx("x"), LITERAL(x)}, {this->storage.GetPropertyIx("y"), LITERAL(y)}));
+  };
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n", "label"))),
+      WHERE(FN("withinbbox", PROPERTY_LOOKUP(dba, "n", location), make_point(0, 0), make_point(1, 1))), RETURN("n")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table,
+            ExpectScanAllByPoint(label, location, memgraph::storage::PointRegion::Type::WITHIN_BOX),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, EdgeTypeIndexedScan) {
+  // Test MATCH (n) -[r :transfer]-> (m) RETURN r
+  FakeDbAccessor dba;
+  auto transfer = dba.NameToEdgeType("transfer");
+  dba.SetIndexCount(transfer, 10);
+  auto *query =
+      QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {"transfer"}), NODE("m"))), RETURN("r")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByEdgeType(transfer), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, EdgeTypePropertyIndexedRange) {
+  // Test MATCH (n) -[r :transfer]-> (m) WHERE r.amount > 10000 RETURN r
+  FakeDbAccessor dba;
+  auto transfer = dba.NameToEdgeType("transfer");
+  auto amount = dba.Property("amount");
+  dba.SetIndexCount(transfer, 10);
+  dba.SetIndexCount(transfer, amount, 10);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {"transfer"}), NODE("m"))),
+                                   WHERE(GREATER(PROPERTY_LOOKUP(dba, "r", amount), LITERAL(10000))), RETURN("r")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  // The filter is served by the index, so nothing remains between the scan
+  // and the produce.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByEdgeType(transfer, amount), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, EdgeTypeIndexNotUsed) {
+  FakeDbAccessor dba;
+  auto transfer = dba.NameToEdgeType("transfer");
+  dba.SetIndexCount(transfer, 10);
+  {
+    // Test MATCH (n) -[r :transfer]- (m) RETURN r
+    auto *query = QUERY(
+        SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::BOTH, {"transfer"}), NODE("m"))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // Expanding in both directions produces each edge twice.
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n) -[r :other]-> (m) RETURN r
+    auto *query =
+        QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {"other"}), NODE("m"))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n) -[r :transfer]-> (m) WHERE n.prop = 1 RETURN r
+    auto prop = dba.Property("prop");
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r", Direction::OUT, {"transfer"}), NODE("m"))),
+                                     WHERE(EQ(PROPERTY_LOOKUP(dba, "n", prop), LITERAL(1))), RETURN("r")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // The start node is filtered before the expansion.
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectExpand(), ExpectProduce());
+  }
+}
+
 TYPED_TEST(TestPlanner, WhereIndexedLabelPropertyRange) {
   // Test MATCH (n :label) WHERE n.property REL_OP 42 RETURN n
   // REL_OP is one of: `<`, `<=`, `>`, `>=`
@@ -1172,9 +1375,23 @@ TYPED_TEST(TestPlanner, SecondPropertyIndex) {
                                    WHERE(EQ(m_prop, n_prop)), RETURN("n")));
   auto symbol_table = memgraph::query::MakeSymbolTable(query);
   auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
-  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(),
-            // Note: We are scanning for m, therefore property should equal n_prop.
-            ExpectScanAllByLabelPropertyValue(label, property, n_prop), ExpectProduce());
+  // Note: We are scanning for m, therefore property should equal n_prop.
+  auto sub_branch = MakeCheckers(ExpectScanAllByLabelPropertyValue(label, property, n_prop));
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectIndexedJoin(sub_branch), ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, HashJoinOnPropertyEquality) {
+  // Test MATCH (n :label), (m :label) WHERE m.property = n.property RETURN n
+  FakeDbAccessor dba;
+  auto property = PROPERTY_PAIR(dba, "property");
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label")), PATTERN(NODE("m", "label"))),
+                                   WHERE(EQ(PROPERTY_LOOKUP(dba, "m", property), PROPERTY_LOOKUP(dba, "n", property))),
+                                   RETURN("n")));
+  // Without the property index, m is scanned once into a hash table instead
+  // of being scanned for each n.
+  auto left = MakeCheckers(ExpectScanAll(), ExpectFilter());
+  auto right = MakeCheckers(ExpectScanAll(), ExpectFilter());
+  CheckPlan<TypeParam>(query, this->storage, ExpectHashJoin(left, right), ExpectProduce());
 }
 
 TYPED_TEST(TestPlanner, ReturnSumGroupByAll) {
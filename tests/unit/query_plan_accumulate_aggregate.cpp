@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -375,6 +376,88 @@ TYPED_TEST(QueryPlanTest, AggregateGroupByValues) {
                                   TypedValue::BoolEqual{}));
 }
 
+TYPED_TEST(QueryPlanTest, AggregateGroupByVertex) {
+  // Groups of vertices are aggregated separately, also when the summed values
+  // mix ints and doubles.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto prop = dba.NameToProperty("prop");
+  for (int i = 0; i < 10; ++i) {
+    auto value = i % 2 == 0 ? memgraph::storage::PropertyValue(i) : memgraph::storage::PropertyValue(i + 0.5);
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, value).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto m = MakeScanAll(this->storage, symbol_table, "m", n.op_);
+  auto m_p = PROPERTY_LOOKUP(dba, IDENT("m")->MapTo(m.sym_), prop);
+  auto produce = this->MakeAggregationProduce(m.op_, symbol_table, {nullptr, m_p},
+                                              {Aggregation::Op::COUNT, Aggregation::Op::SUM},
+                                              {IDENT("n")->MapTo(n.sym_)}, {}, false);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 10);
+  std::unordered_set<memgraph::storage::Gid> vertices;
+  for (const auto &row : results) {
+    ASSERT_EQ(row.size(), 3);
+    EXPECT_EQ(row[0].ValueInt(), 10);
+    EXPECT_DOUBLE_EQ(row[1].ValueDouble(), 47.5);
+    vertices.insert(row[2].ValueVertex().Gid());
+  }
+  EXPECT_EQ(vertices.size(), 10);
+}
+
+TYPED_TEST(QueryPlanTest, AggregateCountFromStorage) {
+  // Counts of the scanned vertices with a label and of the expanded edges of a
+  // type are the same whether the storage keeps them or they are counted.
+  auto label = this->db->NameToLabel("label");
+  auto edge_type = this->db->NameToEdgeType("edge_type");
+  {
+    auto storage_dba = this->db->Access();
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    auto from = dba.InsertVertex();
+    for (int i = 0; i < 5; ++i) {
+      auto to = dba.InsertVertex();
+      ASSERT_TRUE(to.AddLabel(label).HasValue());
+      ASSERT_TRUE(dba.InsertEdge(&from, &to, edge_type).HasValue());
+    }
+    ASSERT_TRUE(dba.InsertVertex().AddLabel(label).HasValue());
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto check_counts = [&](int64_t vertices, int64_t edges) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAllByLabel(this->storage, symbol_table, "n", label);
+    auto count_vertices =
+        this->MakeAggregationProduce(n.op_, symbol_table, {IDENT("n")->MapTo(n.sym_), nullptr},
+                                     {Aggregation::Op::COUNT, Aggregation::Op::COUNT}, {}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*count_vertices, &context);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0][0].ValueInt(), vertices);
+    EXPECT_EQ(results[0][1].ValueInt(), vertices);
+
+    auto m = MakeScanAll(this->storage, symbol_table, "m");
+    auto r_m = MakeExpand(this->storage, symbol_table, m.op_, m.sym_, "r", EdgeAtom::Direction::IN, {edge_type}, "k",
+                          false, memgraph::storage::View::OLD);
+    auto count_edges = this->MakeAggregationProduce(r_m.op_, symbol_table, {nullptr}, {Aggregation::Op::COUNT}, {},
+                                                    {}, false);
+    results = CollectProduce(*count_edges, &context);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0][0].ValueInt(), edges);
+  };
+  check_counts(6, 5);
+  // the changes of the transaction are counted
+  auto from = dba.InsertVertex();
+  ASSERT_TRUE(from.AddLabel(label).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&from, &from, edge_type).HasValue());
+  dba.AdvanceCommand();
+  check_counts(7, 6);
+}
+
 TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   // in this test we have 3 different properties that have different values
   // for different records and assert that we get the correct combination
@@ -409,6 +492,107 @@ TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   EXPECT_EQ(results.size(), 2 * 3 * 5);
 }
 
+TYPED_TEST(QueryPlanTest, AggregateInParallel) {
+  // Aggregating the scanned vertices on several threads gives the same results
+  // as aggregating them on a single thread.
+  auto label = this->db->NameToLabel("label");
+  [[maybe_unused]] auto _ = this->db->CreateIndex(label);
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto group = dba.NameToProperty("group");
+  auto value = dba.NameToProperty("value");
+  for (int i = 0; i < 10000; ++i) {
+    auto vertex = dba.InsertVertex();
+    if (i % 3 == 0) ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(group, memgraph::storage::PropertyValue(i % 7)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(value, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  memgraph::utils::ThreadPool pool(3);
+  auto aggregate = [&](bool by_label, bool parallel) {
+    SymbolTable symbol_table;
+    auto n = by_label ? MakeScanAllByLabel(this->storage, symbol_table, "n", label)
+                      : MakeScanAll(this->storage, symbol_table, "n");
+    auto n_group = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+    auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value);
+    auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr, n_value, n_value, n_value, n_value},
+                                                {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN,
+                                                 Aggregation::Op::MAX, Aggregation::Op::AVG},
+                                                {n_group}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    if (parallel) {
+      context.parallel_execution_pool = &pool;
+      context.parallel_workers = 4;
+    }
+    auto results = CollectProduce(*produce, &context);
+    std::sort(results.begin(), results.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.back().ValueInt() < rhs.back().ValueInt(); });
+    return results;
+  };
+
+  for (const auto by_label : {false, true}) {
+    auto expected = aggregate(by_label, false);
+    auto results = aggregate(by_label, true);
+    ASSERT_EQ(expected.size(), 7);
+    ASSERT_EQ(results.size(), expected.size());
+    for (size_t row = 0; row < results.size(); ++row) {
+      ASSERT_EQ(results[row].size(), expected[row].size());
+      for (size_t column = 0; column < results[row].size(); ++column) {
+        EXPECT_TRUE(TypedValue::BoolEqual{}(results[row][column], expected[row][column]));
+      }
+    }
+  }
+}
+
+TYPED_TEST(QueryPlanTest, AggregateSpill) {
+  // Aggregating the groups spilled to the disk gives the same results as
+  // aggregating all groups in memory.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto group = dba.NameToProperty("group");
+  auto value = dba.NameToProperty("value");
+  for (int i = 0; i < 5000; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.SetProperty(group, memgraph::storage::PropertyValue(i % 700)).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(value, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_aggregate_spill";
+  auto aggregate = [&](bool spill) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_group = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group);
+    auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value);
+    auto produce = this->MakeAggregationProduce(n.op_, symbol_table, {nullptr, n_value, n_value, n_value, n_value},
+                                                {Aggregation::Op::COUNT, Aggregation::Op::SUM, Aggregation::Op::MIN,
+                                                 Aggregation::Op::MAX, Aggregation::Op::AVG},
+                                                {n_group}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    if (spill) {
+      context.spill_threshold_bytes = 4096;
+      context.spill_directory = spill_directory;
+    }
+    auto results = CollectProduce(*produce, &context);
+    std::sort(results.begin(), results.end(),
+              [](const auto &lhs, const auto &rhs) { return lhs.back().ValueInt() < rhs.back().ValueInt(); });
+    return results;
+  };
+
+  auto expected = aggregate(false);
+  auto results = aggregate(true);
+  ASSERT_EQ(expected.size(), 700);
+  ASSERT_EQ(results.size(), expected.size());
+  for (size_t row = 0; row < results.size(); ++row) {
+    ASSERT_EQ(results[row].size(), expected[row].size());
+    for (size_t column = 0; column < results[row].size(); ++column) {
+      EXPECT_TRUE(TypedValue::BoolEqual{}(results[row][column], expected[row][column]));
+    }
+  }
+  EXPECT_TRUE(std::filesystem::is_empty(spill_directory));
+}
+
 TYPED_TEST(QueryPlanTest, AggregateNoInput) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
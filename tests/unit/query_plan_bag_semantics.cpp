@@ -15,6 +15,7 @@
 //
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
 #include <vector>
@@ -255,6 +256,86 @@ TYPED_TEST(QueryPlanTest, OrderByMultiple) {
   }
 }
 
+TYPED_TEST(QueryPlanTest, OrderByTopK) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto prop = dba.NameToProperty("prop");
+
+  std::vector<int> values;
+  for (int i = 0; i < 100; ++i) values.push_back(i / 2);
+  std::random_shuffle(values.begin(), values.end());
+  for (const auto value : values) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  // OrderBy which keeps only the rows passing the following Skip and Limit
+  // gives the same rows as sorting all of them
+  for (const auto &[skip, limit] : std::vector<std::pair<int, int>>{{0, 10}, {5, 10}, {95, 10}, {0, 0}, {0, 200}}) {
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::DESC, n_p}},
+                                                    std::vector<Symbol>{n.sym_}, LITERAL(skip), LITERAL(limit));
+    auto skip_op = std::make_shared<plan::Skip>(order_by, LITERAL(skip));
+    auto limit_op = std::make_shared<plan::Limit>(skip_op, LITERAL(limit));
+    auto n_p_ne = NEXPR("n.p", n_p)->MapTo(symbol_table.CreateSymbol("n.p", true));
+    auto produce = MakeProduce(limit_op, n_p_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    const auto expected_size = std::max(0, std::min(limit, 100 - skip));
+    ASSERT_EQ(results.size(), expected_size);
+    for (int j = 0; j < expected_size; ++j) {
+      ASSERT_EQ(results[j][0].type(), TypedValue::Type::Int);
+      EXPECT_EQ(results[j][0].ValueInt(), (99 - skip - j) / 2);
+    }
+  }
+}
+
+TYPED_TEST(QueryPlanTest, OrderByAndDistinctSpill) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_query_plan_spill";
+
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < 2000; ++i) values.push_back(i);
+  std::random_shuffle(values.begin(), values.end());
+
+  auto pull = [&](auto make_operator) {
+    auto x = symbol_table.CreateSymbol("x", true);
+    auto unwind = std::make_shared<plan::Unwind>(
+        nullptr, LITERAL(TypedValue(std::vector<TypedValue>(values.begin(), values.end()))), x);
+    auto x_ne = NEXPR("x", IDENT("x")->MapTo(x))->MapTo(symbol_table.CreateSymbol("x_ne", true));
+    auto produce = MakeProduce(make_operator(unwind, x), x_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    context.spill_threshold_bytes = 1024;
+    context.spill_directory = spill_directory;
+    std::vector<int64_t> results;
+    for (const auto &row : CollectProduce(*produce, &context)) results.push_back(row[0].ValueInt());
+    return results;
+  };
+
+  // OrderBy merges the sorted runs spilled to the disk
+  auto sorted = pull([&](auto input, auto x) {
+    return std::make_shared<plan::OrderBy>(input, std::vector<SortItem>{{Ordering::ASC, IDENT("x")->MapTo(x)}},
+                                           std::vector<Symbol>{x});
+  });
+  ASSERT_EQ(sorted.size(), values.size());
+  for (size_t i = 0; i < sorted.size(); ++i) EXPECT_EQ(sorted[i], static_cast<int64_t>(i));
+
+  // Distinct compares the rows pulled after spilling with the spilled ones
+  for (size_t i = 0; i < sorted.size(); ++i) values.push_back(values[i]);
+  auto distinct =
+      pull([](auto input, auto x) { return std::make_shared<plan::Distinct>(input, std::vector<Symbol>{x}); });
+  std::sort(distinct.begin(), distinct.end());
+  ASSERT_EQ(distinct.size(), sorted.size());
+  EXPECT_EQ(distinct, sorted);
+
+  // the spilled files are removed once the cursors are destroyed
+  EXPECT_TRUE(std::filesystem::is_empty(spill_directory));
+}
+
 TYPED_TEST(QueryPlanTest, OrderByExceptions) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
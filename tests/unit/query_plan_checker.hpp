@@ -62,7 +62,11 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByLabelPropertyValue);
   PRE_VISIT(ScanAllByLabelPropertyRange);
   PRE_VISIT(ScanAllByLabelProperty);
+  PRE_VISIT(ScanAllByLabelProperties);
   PRE_VISIT(ScanAllById);
+  PRE_VISIT(ScanAllByEdgeType);
+  PRE_VISIT(ScanAllByText);
+  PRE_VISIT(ScanAllByPoint);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
   PRE_VISIT(ConstructNamedPath);
@@ -114,6 +118,17 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
     return false;
   }
 
+  bool PreVisit(HashJoin &op) override {
+    CheckOp(op);
+    return false;
+  }
+
+  bool PreVisit(IndexedJoin &op) override {
+    CheckOp(op);
+    op.main_branch_->Accept(*this);
+    return false;
+  }
+
   bool PreVisit(Apply &op) override {
     CheckOp(op);
     op.input()->Accept(*this);
@@ -403,6 +418,80 @@ class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
   memgraph::storage::PropertyId property_;
 };
 
+class ExpectScanAllByLabelProperties : public OpChecker<ScanAllByLabelProperties> {
+ public:
+  ExpectScanAllByLabelProperties(memgraph::storage::LabelId label,
+                                 const std::vector<memgraph::storage::PropertyId> &properties, size_t prefix_size,
+                                 bool has_range)
+      : label_(label), properties_(properties), prefix_size_(prefix_size), has_range_(has_range) {}
+
+  void ExpectOp(ScanAllByLabelProperties &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.properties_, properties_);
+    EXPECT_EQ(scan_all.prefix_.size(), prefix_size_);
+    EXPECT_EQ(scan_all.lower_bound_ || scan_all.upper_bound_, has_range_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  std::vector<memgraph::storage::PropertyId> properties_;
+  size_t prefix_size_;
+  bool has_range_;
+};
+
+class ExpectScanAllByEdgeType : public OpChecker<ScanAllByEdgeType> {
+ public:
+  explicit ExpectScanAllByEdgeType(memgraph::storage::EdgeTypeId edge_type,
+                                   std::optional<memgraph::storage::PropertyId> property = std::nullopt)
+      : edge_type_(edge_type), property_(property) {}
+
+  void ExpectOp(ScanAllByEdgeType &scan_all, const SymbolTable &) override {
+    ASSERT_EQ(scan_all.common_.edge_types.size(), 1);
+    EXPECT_EQ(scan_all.common_.edge_types.front(), edge_type_);
+    EXPECT_EQ(scan_all.property_, property_);
+  }
+
+ private:
+  memgraph::storage::EdgeTypeId edge_type_;
+  std::optional<memgraph::storage::PropertyId> property_;
+};
+
+class ExpectScanAllByText : public OpChecker<ScanAllByText> {
+ public:
+  ExpectScanAllByText(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
+                      memgraph::storage::TextMatch match)
+      : label_(label), property_(property), match_(match) {}
+
+  void ExpectOp(ScanAllByText &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.property_, property_);
+    EXPECT_EQ(scan_all.match_, match_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  memgraph::storage::PropertyId property_;
+  memgraph::storage::TextMatch match_;
+};
+
+class ExpectScanAllByPoint : public OpChecker<ScanAllByPoint> {
+ public:
+  ExpectScanAllByPoint(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
+                       memgraph::storage::PointRegion::Type region_type)
+      : label_(label), property_(property), region_type_(region_type) {}
+
+  void ExpectOp(ScanAllByPoint &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.property_, property_);
+    EXPECT_EQ(scan_all.region_type_, region_type_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  memgraph::storage::PropertyId property_;
+  memgraph::storage::PointRegion::Type region_type_;
+};
+
 class ExpectCartesian : public OpChecker<Cartesian> {
  public:
   ExpectCartesian(const std::list<std::unique_ptr<BaseOpChecker>> &left,
@@ -423,6 +512,42 @@ class ExpectCartesian : public OpChecker<Cartesian> {
   const std::list<std::unique_ptr<BaseOpChecker>> &right_;
 };
 
+class ExpectHashJoin : public OpChecker<HashJoin> {
+ public:
+  ExpectHashJoin(const std::list<std::unique_ptr<BaseOpChecker>> &left,
+                 const std::list<std::unique_ptr<BaseOpChecker>> &right, bool optional = false)
+      : left_(left), right_(right), optional_(optional) {}
+
+  void ExpectOp(HashJoin &op, const SymbolTable &symbol_table) override {
+    EXPECT_EQ(op.optional_, optional_);
+    ASSERT_TRUE(op.left_op_);
+    PlanChecker left_checker(left_, symbol_table);
+    op.left_op_->Accept(left_checker);
+    ASSERT_TRUE(op.right_op_);
+    PlanChecker right_checker(right_, symbol_table);
+    op.right_op_->Accept(right_checker);
+  }
+
+ private:
+  const std::list<std::unique_ptr<BaseOpChecker>> &left_;
+  const std::list<std::unique_ptr<BaseOpChecker>> &right_;
+  bool optional_;
+};
+
+class ExpectIndexedJoin : public OpChecker<IndexedJoin> {
+ public:
+  ExpectIndexedJoin(const std::list<std::unique_ptr<BaseOpChecker>> &sub_branch) : sub_branch_(sub_branch) {}
+
+  void ExpectOp(IndexedJoin &op, const SymbolTable &symbol_table) override {
+    ASSERT_TRUE(op.sub_branch_);
+    PlanChecker sub_branch_checker(sub_branch_, symbol_table);
+    op.sub_branch_->Accept(sub_branch_checker);
+  }
+
+ private:
+  const std::list<std::unique_ptr<BaseOpChecker>> &sub_branch_;
+};
+
 class ExpectCallProcedure : public OpChecker<CallProcedure> {
  public:
   ExpectCallProcedure(const std::string &name, const std::vector<memgraph::query::Expression *> &args,
@@ -487,6 +612,91 @@ class FakeDbAccessor {
     return 0;
   }
 
+  int64_t VerticesCount(memgraph::storage::LabelId label,
+                        const std::vector<memgraph::storage::PropertyId> &properties) const {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return std::get<2>(index);
+      }
+    }
+    return 0;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                        const std::vector<memgraph::storage::PropertyValue> &,
+                        const std::optional<memgraph::utils::Bound<memgraph::storage::PropertyValue>> &,
+                        const std::optional<memgraph::utils::Bound<memgraph::storage::PropertyValue>> &) const {
+    return VerticesCount(label, properties);
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type) const {
+    auto found = edge_type_index_.find(edge_type);
+    if (found != edge_type_index_.end()) return found->second;
+    return 0;
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property) const {
+    for (auto &index : edge_type_property_index_) {
+      if (std::get<0>(index) == edge_type && std::get<1>(index) == property) {
+        return std::get<2>(index);
+      }
+    }
+    return 0;
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                     const memgraph::storage::PropertyValue &) const {
+    return EdgesCount(edge_type, property);
+  }
+
+  int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property,
+                     const std::optional<memgraph::utils::Bound<memgraph::storage::PropertyValue>> &,
+                     const std::optional<memgraph::utils::Bound<memgraph::storage::PropertyValue>> &) const {
+    return EdgesCount(edge_type, property);
+  }
+
+  bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
+    return edge_type_index_.find(edge_type) != edge_type_index_.end();
+  }
+
+  bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type,
+                                   memgraph::storage::PropertyId property) const {
+    for (auto &index : edge_type_property_index_) {
+      if (std::get<0>(index) == edge_type && std::get<1>(index) == property) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
+                        memgraph::storage::TextMatch, std::string_view) const {
+    for (auto &index : text_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == property) {
+        return std::get<2>(index);
+      }
+    }
+    return 0;
+  }
+
+  bool TextIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    for (auto &index : text_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == property) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
+                        const memgraph::storage::PointRegion &) const {
+    return PointIndexExists(label, property) ? VerticesCount(label) : 0;
+  }
+
+  bool PointIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return std::find(point_index_.begin(), point_index_.end(), std::make_pair(label, property)) != point_index_.end();
+  }
+
   bool LabelIndexExists(memgraph::storage::LabelId label) const {
     return label_index_.find(label) != label_index_.end();
   }
@@ -505,6 +715,22 @@ class FakeDbAccessor {
     return memgraph::storage::LabelPropertyIndexStats{.statistic = 0, .avg_group_size = 1};  // unique id
   }
 
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId label) const {
+    std::vector<std::vector<memgraph::storage::PropertyId>> indices;
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label) {
+        indices.push_back(std::get<1>(index));
+      }
+    }
+    return indices;
+  }
+
+  std::optional<memgraph::storage::LabelPropertyIndexStats> GetIndexStats(
+      const memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties) const {
+    return memgraph::storage::LabelPropertyIndexStats{.statistic = 0, .avg_group_size = 1};  // unique id
+  }
+
   std::optional<memgraph::storage::LabelIndexStats> GetIndexStats(const memgraph::storage::LabelId label) const {
     return memgraph::storage::LabelIndexStats{.count = 0, .avg_degree = 0};  // unique id
   }
@@ -521,6 +747,43 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                     int64_t count) {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    label_property_composite_index_.emplace_back(label, properties, count);
+  }
+
+  void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
+
+  void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property, int64_t count) {
+    for (auto &index : edge_type_property_index_) {
+      if (std::get<0>(index) == edge_type && std::get<1>(index) == property) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    edge_type_property_index_.emplace_back(edge_type, property, count);
+  }
+
+  void SetTextIndexCount(memgraph::storage::LabelId label, memgraph::storage::PropertyId property, int64_t count) {
+    for (auto &index : text_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == property) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    text_index_.emplace_back(label, property, count);
+  }
+
+  void SetPointIndex(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) {
+    point_index_.emplace_back(label, property);
+  }
+
   memgraph::storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -559,6 +822,13 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>, int64_t>>
+      label_property_composite_index_;
+  std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
+  std::vector<std::tuple<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId, int64_t>>
+      edge_type_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> text_index_;
+  std::vector<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>> point_index_;
 };
 
 }  // namespace memgraph::query::plan
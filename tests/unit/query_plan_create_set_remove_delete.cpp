@@ -11,6 +11,7 @@
 
 #include <iterator>
 #include <memory>
+#include <set>
 #include <string>
 #include <variant>
 #include <vector>
@@ -98,6 +99,51 @@ TYPED_TEST(QueryPlanTest, CreateNodeWithAttributes) {
   EXPECT_EQ(vertex_count, 1);
 }
 
+TYPED_TEST(QueryPlanTest, CreateNodesFromUnwind) {
+  // The vertices of the unwound rows are created in batches, each with the
+  // properties of its own row.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  memgraph::storage::LabelId label = dba.NameToLabel("Person");
+  auto property = PROPERTY_PAIR(dba, "prop");
+
+  const int64_t rows = 2500;
+  std::vector<Expression *> elements;
+  for (int64_t i = 0; i < rows; ++i) elements.push_back(LITERAL(i));
+
+  SymbolTable symbol_table;
+  auto x = symbol_table.CreateSymbol("x", true);
+  auto unwind = std::make_shared<Unwind>(nullptr, this->storage.template Create<ListLiteral>(elements), x);
+  NodeCreationInfo node;
+  node.symbol = symbol_table.CreateSymbol("n", true);
+  node.labels.emplace_back(label);
+  node.labels.emplace_back(label);
+  std::get<std::vector<std::pair<memgraph::storage::PropertyId, Expression *>>>(node.properties)
+      .emplace_back(property.second, IDENT("x")->MapTo(x));
+
+  auto create = std::make_shared<CreateNode>(unwind, node);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(PullAll(*create, &context), rows);
+  EXPECT_EQ(context.execution_stats[ExecutionStats::Key::CREATED_NODES], rows);
+  EXPECT_EQ(context.execution_stats[ExecutionStats::Key::CREATED_LABELS], 2 * rows);
+  dba.AdvanceCommand();
+
+  std::set<int64_t> values;
+  for (auto vertex : dba.Vertices(memgraph::storage::View::OLD)) {
+    auto maybe_labels = vertex.Labels(memgraph::storage::View::OLD);
+    ASSERT_TRUE(maybe_labels.HasValue());
+    ASSERT_EQ(maybe_labels->size(), 1);
+    EXPECT_EQ(maybe_labels->front(), label);
+    auto maybe_prop = vertex.GetProperty(memgraph::storage::View::OLD, property.second);
+    ASSERT_TRUE(maybe_prop.HasValue());
+    values.insert(maybe_prop->ValueInt());
+  }
+  EXPECT_EQ(values.size(), static_cast<size_t>(rows));
+  EXPECT_EQ(*values.begin(), 0);
+  EXPECT_EQ(*values.rbegin(), rows - 1);
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(QueryPlanTest, FineGrainedCreateNodeWithAttributes) {
   memgraph::license::global_license_checker.EnableTesting();
@@ -1653,6 +1699,60 @@ TYPED_TEST(QueryPlanTest, MergeNoInput) {
   EXPECT_EQ(1, CountIterable(dba.Vertices(memgraph::storage::View::OLD)));
 }
 
+TYPED_TEST(QueryPlanTest, MergeByUniqueConstraint) {
+  // UNWIND [1, 2, 1, 3, 2] AS x MERGE (n:Person {id: x}), where Person.id is
+  // unique and a Person with the id 3 exists
+  memgraph::storage::LabelId label = this->db->NameToLabel("Person");
+  memgraph::storage::PropertyId id = this->db->NameToProperty("id");
+  ASSERT_FALSE(this->db->CreateUniqueConstraint(label, {id}, {}).HasError());
+  {
+    auto acc = this->db->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(id, memgraph::storage::PropertyValue(3)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto x = symbol_table.CreateSymbol("x", true);
+  std::vector<Expression *> elements{LITERAL(1), LITERAL(2), LITERAL(1), LITERAL(3), LITERAL(2)};
+  auto unwind = std::make_shared<Unwind>(nullptr, this->storage.template Create<ListLiteral>(elements), x);
+
+  // merge_match branch
+  auto n = MakeScanAllByLabel(this->storage, symbol_table, "n", label, std::make_shared<Once>(),
+                              memgraph::storage::View::NEW);
+  auto n_id = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), id);
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         EQ(n_id, IDENT("x")->MapTo(x)));
+
+  // merge_create branch
+  NodeCreationInfo node;
+  node.symbol = n.sym_;
+  node.labels.emplace_back(label);
+  std::get<std::vector<std::pair<memgraph::storage::PropertyId, Expression *>>>(node.properties)
+      .emplace_back(id, IDENT("x")->MapTo(x));
+  auto create = std::make_shared<CreateNode>(nullptr, node);
+
+  auto merge = std::make_shared<plan::Merge>(unwind, filter, create);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(5, PullAll(*merge, &context));
+  EXPECT_EQ(context.execution_stats[ExecutionStats::Key::CREATED_NODES], 2);
+  dba.AdvanceCommand();
+  EXPECT_EQ(3, CountIterable(dba.Vertices(memgraph::storage::View::OLD)));
+
+  if constexpr (std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>) {
+    // A transaction which can't see the merged nodes fails on merging them
+    // again, instead of creating a node which violates the constraint.
+    auto other_storage_dba = this->db->Access();
+    ASSERT_FALSE(storage_dba->Commit().HasError());
+    memgraph::query::DbAccessor other_dba(other_storage_dba.get());
+    auto other_context = MakeContext(this->storage, symbol_table, &other_dba);
+    EXPECT_THROW(PullAll(*merge, &other_context), TransactionSerializationException);
+  }
+}
+
 TYPED_TEST(QueryPlanTest, SetPropertyWithCaching) {
   // SET (Null).prop = 42
   auto storage_dba = this->db->Access();
@@ -14,6 +14,7 @@
 // easy testing and latter readability they are tested end-to-end.
 
 #include <filesystem>
+#include <limits>
 #include <memory>
 #include <optional>
 
@@ -27,6 +28,8 @@
 #include "storage/v2/storage.hpp"
 
 DECLARE_bool(query_cost_planner);
+DECLARE_uint64(query_planning_threads);
+DECLARE_double(query_plan_cost_bound);
 
 template <typename StorageType>
 class QueryExecution : public testing::Test {
@@ -116,3 +119,53 @@ TYPED_TEST(QueryExecution, EdgeUniquenessInOptional) {
                 .size(),
             3);
 }
+
+TYPED_TEST(QueryExecution, ConcurrentPlanCosts) {
+  // The costs of the alternative plans are estimated on the planning threads,
+  // which mustn't change the results of the chosen plan.
+  this->Execute("CREATE (:A {id: 1})-[:T]->(:B {id: 2})-[:T]->(:C {id: 3}), (:A {id: 4})-[:T]->(:B {id: 5})");
+  FLAGS_query_cost_planner = true;
+  FLAGS_query_planning_threads = 2;
+  EXPECT_EQ(this->Execute("MATCH (a:A)-[:T]->(b:B), (b)-[:T]->(c:C) RETURN a, b, c").size(), 1);
+  EXPECT_EQ(this->Execute("MATCH (a:A)-[:T]->(b:B) MATCH (c:C) RETURN a, b, c").size(), 2);
+  FLAGS_query_plan_cost_bound = std::numeric_limits<double>::max();
+  EXPECT_EQ(this->Execute("MATCH (a:A), (b:B) WHERE a.id < b.id RETURN a, b").size(), 3);
+  FLAGS_query_plan_cost_bound = 0.0;
+  FLAGS_query_planning_threads = 0;
+}
+
+TYPED_TEST(QueryExecution, OptionalMatchJoinedByEquality) {
+  // The OPTIONAL MATCH isn't anchored on n, so it's matched once and joined
+  // with the rows of n by a hash table.
+  this->Execute("CREATE (:A {id: 1}), (:A {id: 2}), (:A), (:B {id: 1}), (:B {id: 1}), (:B {id: 3})");
+  FLAGS_query_cost_planner = true;
+  auto results =
+      this->Execute("MATCH (a:A) OPTIONAL MATCH (b:B) WHERE b.id = a.id RETURN a.id, count(b) ORDER BY a.id");
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_EQ(results[0][0].ValueInt(), 1);
+  EXPECT_EQ(results[0][1].ValueInt(), 2);
+  EXPECT_EQ(results[1][0].ValueInt(), 2);
+  EXPECT_EQ(results[1][1].ValueInt(), 0);
+  EXPECT_TRUE(results[2][0].IsNull());
+  EXPECT_EQ(results[2][1].ValueInt(), 0);
+}
+
+TYPED_TEST(QueryExecution, IndexedPropertyValues) {
+  // The returned and aggregated values of the indexed property are read from
+  // the index in read-only queries.
+  this->Execute("CREATE INDEX ON :A(id)");
+  this->Execute("CREATE (:A {id: 1}), (:A {id: 2}), (:A {id: 3}), (:A), (:B {id: 4})");
+  auto results = this->Execute("MATCH (a:A) WHERE a.id > 1 RETURN a.id AS id ORDER BY id");
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0][0].ValueInt(), 2);
+  EXPECT_EQ(results[1][0].ValueInt(), 3);
+  results = this->Execute("MATCH (a:A) WHERE a.id >= 1 RETURN min(a.id), max(a.id), count(a.id)");
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0][0].ValueInt(), 1);
+  EXPECT_EQ(results[0][1].ValueInt(), 3);
+  EXPECT_EQ(results[0][2].ValueInt(), 3);
+  // The property changed by the query is read from the vertex.
+  results = this->Execute("MATCH (a:A) WHERE a.id = 1 SET a.id = 10 RETURN a.id");
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_EQ(results[0][0].ValueInt(), 10);
+}
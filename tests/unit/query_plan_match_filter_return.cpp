@@ -336,6 +336,57 @@ TYPED_TEST(QueryPlan, NodeFilterLabelsAndProperties) {
   EXPECT_EQ(2, PullAll(*produce, &context));
 }
 
+TYPED_TEST(QueryPlan, PullBatch) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "Property");
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  // MATCH (n) WHERE n.Property > 4 RETURN n.Property AS x ORDER BY n.Property DESC
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto *filter_expr = GREATER(PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property), LITERAL(4));
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{}, filter_expr);
+  auto x_sym = symbol_table.CreateSymbol("x", true);
+  auto output = NEXPR("x", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property))->MapTo(x_sym);
+  auto produce = MakeProduce(filter, output);
+  // ORDER BY reads a symbol from before the projection.
+  auto order_by = std::make_shared<OrderBy>(
+      produce,
+      std::vector<SortItem>{{Ordering::DESC, PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property)}},
+      std::vector<Symbol>{x_sym});
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  context.pull_batch_size = 3;
+  Frame frame(symbol_table.max_position());
+  auto cursor = order_by->MakeCursor(memgraph::utils::NewDeleteResource());
+  FrameBlock block({x_sym}, context.pull_batch_size, memgraph::utils::NewDeleteResource());
+  std::vector<int64_t> results;
+  for (; cursor->PullBatch(frame, block, context); block.Clear()) {
+    EXPECT_LE(block.Size(), 3);
+    for (size_t row = 0; row < block.Size(); ++row) {
+      block.RestoreRow(row, frame, nullptr);
+      ASSERT_EQ(frame[x_sym].type(), TypedValue::Type::Int);
+      results.push_back(frame[x_sym].ValueInt());
+    }
+  }
+  EXPECT_THAT(results, testing::ElementsAre(9, 8, 7, 6, 5));
+
+  // The rows pulled one at a time are the same.
+  context.pull_batch_size = 0;
+  auto row_results = CollectProduce(*MakeProduce(order_by, NEXPR("x", IDENT("x")->MapTo(x_sym))
+                                                               ->MapTo(symbol_table.CreateSymbol("y", true))),
+                                    &context);
+  ASSERT_EQ(row_results.size(), results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(row_results[i][0].ValueInt(), results[i]);
+  }
+}
+
 TYPED_TEST(QueryPlan, NodeFilterMultipleLabels) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -484,6 +535,93 @@ TYPED_TEST(QueryPlan, CartesianThreeWay) {
   }
 }
 
+TYPED_TEST(QueryPlan, HashJoin) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "property");
+  auto add_vertex = [&dba, &property](memgraph::storage::PropertyValue value) {
+    auto vertex = dba.InsertVertex();
+    MG_ASSERT(vertex.SetProperty(property.second, value).HasValue());
+  };
+  add_vertex(memgraph::storage::PropertyValue(1));
+  add_vertex(memgraph::storage::PropertyValue(2));
+  add_vertex(memgraph::storage::PropertyValue(2.0));
+  // Null values never join.
+  dba.InsertVertex();
+  dba.AdvanceCommand();
+
+  // MATCH (n), (m) WHERE n.property = m.property RETURN n.property, m.property
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto m = MakeScanAll(this->storage, symbol_table, "m");
+  auto *condition = EQ(PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property),
+                       PROPERTY_LOOKUP(dba, IDENT("m")->MapTo(m.sym_), property));
+  auto return_n = NEXPR("n", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property))
+                      ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto return_m = NEXPR("m", PROPERTY_LOOKUP(dba, IDENT("m")->MapTo(m.sym_), property))
+                      ->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+
+  std::vector<Symbol> left_symbols{n.sym_};
+  std::vector<Symbol> right_symbols{m.sym_};
+  auto hash_join_op = std::make_shared<HashJoin>(n.op_, left_symbols, m.op_, right_symbols, condition);
+
+  auto produce = MakeProduce(hash_join_op, return_n, return_m);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  // 1 joins with itself, 2 and 2.0 join with both of them.
+  EXPECT_EQ(results.size(), 5);
+  for (const auto &row : results) {
+    EXPECT_TRUE(memgraph::query::TypedValue::BoolEqual{}(row[0], row[1]));
+  }
+}
+
+TYPED_TEST(QueryPlan, IndexedJoin) {
+  auto label_a = this->db->NameToLabel("A");
+  auto label_b = this->db->NameToLabel("B");
+  auto prop = this->db->NameToProperty("prop");
+  {
+    auto storage_dba = this->db->Access();
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    auto add_vertex = [&dba, prop](memgraph::storage::LabelId label, int64_t value) {
+      auto vertex = dba.InsertVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+    };
+    add_vertex(label_a, 1);
+    add_vertex(label_a, 2);
+    add_vertex(label_b, 1);
+    add_vertex(label_b, 1);
+    add_vertex(label_b, 3);
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+  [[maybe_unused]] auto _ = this->db->CreateIndex(label_b, prop);
+
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // MATCH (a :A), (b :B) WHERE b.prop = a.prop RETURN a.prop, b.prop
+  SymbolTable symbol_table;
+  auto a = MakeScanAllByLabel(this->storage, symbol_table, "a", label_a);
+  auto a_prop = PROPERTY_LOOKUP(dba, IDENT("a")->MapTo(a.sym_), prop);
+  auto b = MakeScanAllByLabelPropertyValue(this->storage, symbol_table, "b", label_b, prop, "prop", a_prop,
+                                           std::make_shared<Once>(std::vector<Symbol>{a.sym_}));
+  auto indexed_join_op = std::make_shared<IndexedJoin>(a.op_, b.op_);
+  auto return_a = NEXPR("a", PROPERTY_LOOKUP(dba, IDENT("a")->MapTo(a.sym_), prop))
+                      ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto return_b = NEXPR("b", PROPERTY_LOOKUP(dba, IDENT("b")->MapTo(b.sym_), prop))
+                      ->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+  auto produce = MakeProduce(indexed_join_op, return_a, return_b);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  // Only the A with prop 1 joins, with both B which have it.
+  ASSERT_EQ(results.size(), 2);
+  for (const auto &row : results) {
+    EXPECT_EQ(row[0].ValueInt(), 1);
+    EXPECT_EQ(row[1].ValueInt(), 1);
+  }
+}
+
 template <typename StorageType>
 class ExpandFixture : public testing::Test {
  protected:
@@ -3002,6 +3140,52 @@ TYPED_TEST(QueryPlan, Filter) {
   EXPECT_EQ(CollectProduce(*produce, &context).size(), 2);
 }
 
+TYPED_TEST(QueryPlan, FilterPropertyEquality) {
+  auto property = this->db->NameToProperty("property");
+  auto other = this->db->NameToProperty("other");
+  {
+    auto storage_dba = this->db->Access();
+    memgraph::query::DbAccessor dba(storage_dba.get());
+    for (int i = 0; i < 6; ++i) {
+      auto vertex = dba.InsertVertex();
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i % 3)).HasValue());
+      if (i < 3) ASSERT_TRUE(vertex.SetProperty(other, memgraph::storage::PropertyValue("a")).HasValue());
+    }
+    dba.InsertVertex();  // property not set
+    ASSERT_FALSE(dba.Commit().HasError());
+  }
+  // Without deltas the properties are compared in the property store.
+  this->db->FreeMemory();
+
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  SymbolTable symbol_table;
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto count = [&](Expression *expression, const memgraph::storage::PropertyValue &parameter = {}) {
+    auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{}, expression);
+    auto output =
+        NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+    auto produce = MakeProduce(filter, output);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    context.evaluation_context.parameters.Add(0, parameter);
+    return CollectProduce(*produce, &context).size();
+  };
+  auto lookup = [&](memgraph::storage::PropertyId property_id) {
+    return PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), property_id);
+  };
+
+  EXPECT_EQ(count(EQ(lookup(property), LITERAL(1))), 2);
+  EXPECT_EQ(count(EQ(LITERAL(1.0), lookup(property))), 2);
+  EXPECT_EQ(count(EQ(lookup(property), LITERAL("1"))), 0);
+  EXPECT_EQ(count(EQ(lookup(property), LITERAL(memgraph::storage::PropertyValue()))), 0);
+  EXPECT_EQ(count(AND(EQ(lookup(property), LITERAL(1)), EQ(lookup(other), LITERAL("a")))), 1);
+  EXPECT_EQ(count(EQ(lookup(property), PARAMETER_LOOKUP(0)), memgraph::storage::PropertyValue(2)), 2);
+  // Lists aren't compared in the property store.
+  EXPECT_EQ(count(EQ(lookup(property), PARAMETER_LOOKUP(0)),
+                  memgraph::storage::PropertyValue(std::vector{memgraph::storage::PropertyValue(2)})),
+            0);
+}
+
 TYPED_TEST(QueryPlan, EdgeUniquenessFilter) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -3631,6 +3815,70 @@ class ExistsFixture : public testing::Test {
     return PullAll(*produce, &context);
   }
 
+  int TestVariableExists(std::string match_label, EdgeAtom::Direction direction,
+                         std::vector<memgraph::storage::EdgeTypeId> edge_types, int64_t lower, int64_t upper,
+                         std::optional<std::string> destination_label = std::nullopt,
+                         std::optional<int64_t> edge_prop = std::nullopt) {
+    std::vector<std::string> edge_type_names;
+    for (const auto &type : edge_types) {
+      edge_type_names.emplace_back(db->EdgeTypeToName(type));
+    }
+
+    auto *source_node = NODE("n");
+    auto source_sym = symbol_table.CreateSymbol("n", true);
+    source_node->identifier_->MapTo(source_sym);
+
+    auto *expansion_edge = EDGE_VARIABLE("edge", EdgeAtom::Type::DEPTH_FIRST, direction, edge_type_names);
+    auto edge_sym = symbol_table.CreateSymbol("edge", false);
+    expansion_edge->identifier_->MapTo(edge_sym);
+
+    auto *destination_node = NODE("m");
+    auto *exists_expression = EXISTS(PATTERN(source_node, expansion_edge, destination_node));
+    exists_expression->MapTo(symbol_table.CreateAnonymousSymbol());
+
+    auto scan_all = MakeScanAll(storage, symbol_table, "n");
+    scan_all.node_->labels_.emplace_back(storage.GetLabelIx(match_label));
+    Expression *total_expression = storage.Create<LabelsTest>(scan_all.node_->identifier_, scan_all.node_->labels_);
+
+    auto input_op = scan_all.op_;
+    auto dest_sym = symbol_table.CreateSymbol("m", false);
+    if (destination_label.has_value()) {
+      auto scan_destination = MakeScanAll(storage, symbol_table, "m", input_op);
+      scan_destination.node_->labels_.emplace_back(storage.GetLabelIx(destination_label.value()));
+      total_expression =
+          AND(total_expression,
+              storage.Create<LabelsTest>(scan_destination.node_->identifier_, scan_destination.node_->labels_));
+      input_op = scan_destination.op_;
+      dest_sym = scan_destination.sym_;
+    }
+    destination_node->identifier_->MapTo(dest_sym);
+
+    auto inner_edge_sym = symbol_table.CreateSymbol("inner_edge", false);
+    auto inner_node_sym = symbol_table.CreateSymbol("inner_node", false);
+    Expression *filter_expr = nullptr;
+    if (edge_prop.has_value()) {
+      filter_expr = EQ(PROPERTY_LOOKUP(dba, IDENT("inner_edge")->MapTo(inner_edge_sym), prop),
+                       LITERAL(edge_prop.value()));
+    }
+
+    std::shared_ptr<LogicalOperator> last_op = std::make_shared<ExpandVariable>(
+        nullptr, scan_all.sym_, dest_sym, edge_sym, EdgeAtom::Type::DEPTH_FIRST, direction, edge_types, false,
+        LITERAL(lower), LITERAL(upper), destination_label.has_value(),
+        ExpansionLambda{inner_edge_sym, inner_node_sym, filter_expr}, std::nullopt, std::nullopt);
+    last_op = std::make_shared<Limit>(std::move(last_op), storage.Create<PrimitiveLiteral>(1));
+    last_op = std::make_shared<EvaluatePatternFilter>(std::move(last_op), symbol_table.at(*exists_expression));
+
+    total_expression = AND(total_expression, exists_expression);
+    auto filter = std::make_shared<Filter>(input_op, std::vector<std::shared_ptr<LogicalOperator>>{last_op},
+                                           total_expression);
+    auto output =
+        NEXPR("n", IDENT("n")->MapTo(scan_all.sym_))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+
+    auto produce = MakeProduce(filter, output);
+    auto context = MakeContext(storage, symbol_table, &dba);
+    return PullAll(*produce, &context);
+  }
+
   int TestDoubleExists(std::string match_label, EdgeAtom::Direction direction,
                        std::vector<memgraph::storage::EdgeTypeId> first_edge_type,
                        std::vector<memgraph::storage::EdgeTypeId> second_edge_type, bool or_flag = false) {
@@ -3732,6 +3980,36 @@ TYPED_TEST(ExistsFixture, ExistsWithFiltering) {
   EXPECT_EQ(0, this->TestExists("l1", EdgeAtom::Direction::BOTH, {}, "l2", 1, 1));
 }
 
+TYPED_TEST(ExistsFixture, VariableLengthExists) {
+  // (:l1)-[:Edge]->(:l2)-[:Edge]->(:l3)-[:Other]->(:l4)
+  ASSERT_TRUE(this->dba.InsertEdge(&this->v2, &this->v3, this->edge_type).HasValue());
+  this->dba.AdvanceCommand();
+
+  std::vector<memgraph::storage::EdgeTypeId> known_edge_types;
+  known_edge_types.push_back(this->edge_type);
+
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 3));
+  EXPECT_EQ(0, this->TestVariableExists("l4", EdgeAtom::Direction::OUT, {}, 1, 3));
+  EXPECT_EQ(1, this->TestVariableExists("l4", EdgeAtom::Direction::IN, {}, 1, 3));
+
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 3, "l4"));
+  EXPECT_EQ(0, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 2, "l4"));
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 2, "l3"));
+  EXPECT_EQ(0, this->TestVariableExists("l1", EdgeAtom::Direction::IN, {}, 1, 3, "l4"));
+  EXPECT_EQ(1, this->TestVariableExists("l4", EdgeAtom::Direction::BOTH, {}, 1, 3, "l1"));
+  EXPECT_EQ(0, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, known_edge_types, 1, 3, "l4"));
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, known_edge_types, 1, 3, "l3"));
+
+  // Only the first edge has the property.
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 3, "l2", 1));
+  EXPECT_EQ(0, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 1, 3, "l3", 1));
+
+  // Paths with a minimum length are enumerated.
+  EXPECT_EQ(0, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 2, 2, "l2"));
+  EXPECT_EQ(1, this->TestVariableExists("l1", EdgeAtom::Direction::OUT, {}, 2, 2, "l3"));
+  EXPECT_EQ(0, this->TestVariableExists("l2", EdgeAtom::Direction::BOTH, {}, 2, 3, "l2"));
+}
+
 TYPED_TEST(ExistsFixture, DoubleFilters) {
   EXPECT_EQ(1, this->TestDoubleExists("l1", EdgeAtom::Direction::BOTH, {}, {}, true));
   EXPECT_EQ(1, this->TestDoubleExists("l1", EdgeAtom::Direction::BOTH, {}, {}, false));
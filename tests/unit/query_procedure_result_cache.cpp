@@ -0,0 +1,158 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "query/db_accessor.hpp"
+#include "query/procedure/mg_procedure_impl.hpp"
+#include "query/procedure/result_cache.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+using memgraph::query::TypedValue;
+using memgraph::query::procedure::ResultCache;
+
+class ResultCacheTest : public ::testing::Test {
+ protected:
+  using Signature = memgraph::utils::pmr::map<memgraph::utils::pmr::string,
+                                              std::pair<const memgraph::query::procedure::CypherType *, bool>>;
+
+  void AddRow(mgp_result *result, const std::string &field, TypedValue value) {
+    auto &row = result->rows.emplace_back(mgp_result_record{
+        &signature_, memgraph::utils::pmr::map<memgraph::utils::pmr::string, TypedValue>(memory_)});
+    row.values.emplace(field, std::move(value));
+  }
+
+  ResultCache::Key MakeKey(const memgraph::storage::SnapshotId &snapshot, int64_t argument) {
+    auto key = ResultCache::MakeKey("memgraph", "module.procedure", snapshot, {TypedValue(argument)});
+    EXPECT_TRUE(key);
+    return std::move(*key);
+  }
+
+  memgraph::utils::MemoryResource *memory_{memgraph::utils::NewDeleteResource()};
+  Signature signature_{memory_};
+  std::unique_ptr<memgraph::storage::Storage> storage_{
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{})};
+  ResultCache cache_;
+};
+
+TEST_F(ResultCacheTest, SnapshotId) {
+  memgraph::storage::SnapshotId before_commit;
+  {
+    auto accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    ASSERT_TRUE(accessor->GetSnapshotId());
+    before_commit = *accessor->GetSnapshotId();
+    accessor->CreateVertex();
+    // Own changes aren't part of any committed state.
+    EXPECT_FALSE(accessor->GetSnapshotId());
+    ASSERT_FALSE(accessor->Commit().HasError());
+  }
+  {
+    auto accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    ASSERT_TRUE(accessor->GetSnapshotId());
+    EXPECT_NE(*accessor->GetSnapshotId(), before_commit);
+  }
+  {
+    auto accessor = storage_->Access(memgraph::storage::IsolationLevel::READ_COMMITTED);
+    EXPECT_FALSE(accessor->GetSnapshotId());
+  }
+}
+
+TEST_F(ResultCacheTest, FindsVerticesAgain) {
+  memgraph::storage::Gid gid;
+  {
+    auto accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    gid = accessor->CreateVertex().Gid();
+    ASSERT_FALSE(accessor->Commit().HasError());
+  }
+  cache_.SetCapacity(1024 * 1024);
+
+  auto storage_accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+  memgraph::query::DbAccessor dba(storage_accessor.get());
+  const auto snapshot = *dba.GetSnapshotId();
+  {
+    mgp_result result(&signature_, memory_);
+    EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 1), &dba, memgraph::storage::View::OLD, &result));
+    AddRow(&result, "node", TypedValue(*dba.FindVertex(gid, memgraph::storage::View::OLD)));
+    AddRow(&result, "value", TypedValue("text"));
+    cache_.Insert(MakeKey(snapshot, 1), result);
+  }
+
+  mgp_result result(&signature_, memory_);
+  EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 2), &dba, memgraph::storage::View::OLD, &result));
+  ASSERT_TRUE(cache_.Find(MakeKey(snapshot, 1), &dba, memgraph::storage::View::OLD, &result));
+  ASSERT_EQ(result.rows.size(), 2);
+  EXPECT_EQ(result.rows[0].values.at("node").ValueVertex().Gid(), gid);
+  EXPECT_EQ(result.rows[1].values.at("value").ValueString(), "text");
+
+  // A double argument equal to the integer one is another call.
+  auto double_key = ResultCache::MakeKey("memgraph", "module.procedure", snapshot, {TypedValue(1.0)});
+  ASSERT_TRUE(double_key);
+  EXPECT_FALSE(cache_.Find(*double_key, &dba, memgraph::storage::View::OLD, &result));
+}
+
+TEST_F(ResultCacheTest, SkipsEdgesAndGraphElementArguments) {
+  memgraph::storage::Gid from_gid;
+  {
+    auto accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    auto from = accessor->CreateVertex();
+    auto to = accessor->CreateVertex();
+    from_gid = from.Gid();
+    ASSERT_TRUE(accessor->CreateEdge(&from, &to, accessor->NameToEdgeType("EDGE")).HasValue());
+    ASSERT_FALSE(accessor->Commit().HasError());
+  }
+  cache_.SetCapacity(1024 * 1024);
+
+  auto storage_accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+  memgraph::query::DbAccessor dba(storage_accessor.get());
+  const auto snapshot = *dba.GetSnapshotId();
+  auto from = *dba.FindVertex(from_gid, memgraph::storage::View::OLD);
+  EXPECT_FALSE(ResultCache::MakeKey("memgraph", "module.procedure", snapshot, {TypedValue(from)}));
+
+  mgp_result result(&signature_, memory_);
+  auto edges = from.OutEdges(memgraph::storage::View::OLD);
+  ASSERT_TRUE(edges.HasValue());
+  ASSERT_EQ(edges->edges.size(), 1);
+  AddRow(&result, "edge", TypedValue(edges->edges[0]));
+  cache_.Insert(MakeKey(snapshot, 1), result);
+  EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 1), &dba, memgraph::storage::View::OLD, &result));
+}
+
+TEST_F(ResultCacheTest, EvictsOverCapacity) {
+  auto accessor = storage_->Access(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+  memgraph::query::DbAccessor dba(accessor.get());
+  const auto snapshot = *dba.GetSnapshotId();
+  const std::string value(1000, 'a');
+  cache_.SetCapacity(2500);
+  for (int64_t argument = 0; argument < 3; ++argument) {
+    mgp_result result(&signature_, memory_);
+    AddRow(&result, "value", TypedValue(value));
+    cache_.Insert(MakeKey(snapshot, argument), result);
+  }
+  mgp_result result(&signature_, memory_);
+  EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 0), &dba, memgraph::storage::View::OLD, &result));
+  EXPECT_TRUE(cache_.Find(MakeKey(snapshot, 1), &dba, memgraph::storage::View::OLD, &result));
+  EXPECT_TRUE(cache_.Find(MakeKey(snapshot, 2), &dba, memgraph::storage::View::OLD, &result));
+
+  // Records larger than the whole cache aren't kept.
+  mgp_result large_result(&signature_, memory_);
+  AddRow(&large_result, "value", TypedValue(std::string(3000, 'a')));
+  cache_.Insert(MakeKey(snapshot, 3), large_result);
+  EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 3), &dba, memgraph::storage::View::OLD, &result));
+  EXPECT_TRUE(cache_.Find(MakeKey(snapshot, 2), &dba, memgraph::storage::View::OLD, &result));
+
+  cache_.SetCapacity(0);
+  EXPECT_FALSE(cache_.Enabled());
+  EXPECT_FALSE(cache_.Find(MakeKey(snapshot, 2), &dba, memgraph::storage::View::OLD, &result));
+}
@@ -12,7 +12,11 @@
 #include <algorithm>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <tuple>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -32,6 +36,7 @@
 #include "storage_test_utils.hpp"
 #include "test_utils.hpp"
 #include "utils/memory.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/variant_helpers.hpp"
 
 #define EXPECT_SUCCESS(...) EXPECT_EQ(__VA_ARGS__, mgp_error::MGP_ERROR_NO_ERROR)
@@ -77,11 +82,29 @@ struct MgpValueDeleter {
   }
 };
 
+struct MgpCsrDeleter {
+  void operator()(mgp_csr *csr) {
+    if (csr != nullptr) {
+      mgp_csr_destroy(csr);
+    }
+  }
+};
+
+struct MgpPropertyColumnDeleter {
+  void operator()(mgp_property_column *column) {
+    if (column != nullptr) {
+      mgp_property_column_destroy(column);
+    }
+  }
+};
+
 using MgpEdgePtr = std::unique_ptr<mgp_edge, MgpEdgeDeleter>;
 using MgpEdgesIteratorPtr = std::unique_ptr<mgp_edges_iterator, MgpEdgesIteratorDeleter>;
 using MgpVertexPtr = std::unique_ptr<mgp_vertex, MgpVertexDeleter>;
 using MgpVerticesIteratorPtr = std::unique_ptr<mgp_vertices_iterator, MgpVerticesIteratorDeleter>;
 using MgpValuePtr = std::unique_ptr<mgp_value, MgpValueDeleter>;
+using MgpCsrPtr = std::unique_ptr<mgp_csr, MgpCsrDeleter>;
+using MgpPropertyColumnPtr = std::unique_ptr<mgp_property_column, MgpPropertyColumnDeleter>;
 
 template <typename TMaybeIterable, typename TIterableAccessor>
 size_t CountMaybeIterables(TMaybeIterable &&maybe_iterable, TIterableAccessor func) {
@@ -698,3 +721,160 @@ TYPED_TEST(MgpGraphTest, EdgeSetPropertyWithImmutableGraph) {
   EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_edge_underlying_graph_is_mutable, edge.get()), 0);
   EXPECT_EQ(mgp_edge_set_property(edge.get(), "property", value.get()), mgp_error::MGP_ERROR_IMMUTABLE_OBJECT);
 }
+
+TYPED_TEST(MgpGraphTest, ProjectCsr) {
+  std::array<memgraph::storage::Gid, 3> vertex_ids{};
+  {
+    auto &accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    const auto label = accessor.NameToLabel("City");
+    const auto road = accessor.NameToEdgeType("ROAD");
+    const auto weight = accessor.NameToProperty("distance");
+    std::vector<memgraph::query::VertexAccessor> vertices;
+    for (auto &vertex_id : vertex_ids) {
+      vertices.push_back(accessor.InsertVertex());
+      ASSERT_TRUE(vertices.back().AddLabel(label).HasValue());
+      vertex_id = vertices.back().Gid();
+    }
+    auto village = accessor.InsertVertex();
+    auto long_road = accessor.InsertEdge(&vertices[0], &vertices[1], road);
+    ASSERT_TRUE(long_road.HasValue());
+    ASSERT_TRUE(long_road->SetProperty(weight, memgraph::storage::PropertyValue(2)).HasValue());
+    auto short_road = accessor.InsertEdge(&vertices[0], &vertices[2], road);
+    ASSERT_TRUE(short_road.HasValue());
+    ASSERT_TRUE(short_road->SetProperty(weight, memgraph::storage::PropertyValue(0.5)).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[2], &vertices[1], road).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[1], &vertices[2], accessor.NameToEdgeType("RAIL")).HasValue());
+    ASSERT_TRUE(accessor.InsertEdge(&vertices[1], &village, road).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  auto graph = this->CreateGraph(memgraph::storage::View::OLD);
+  {
+    SCOPED_TRACE("Whole graph");
+    MgpCsrPtr csr{EXPECT_MGP_NO_ERROR(mgp_csr *, mgp_graph_project_csr, &graph, nullptr, nullptr, nullptr, 1.0,
+                                      &this->memory)};
+    ASSERT_NE(csr, nullptr);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_vertices_count, csr.get()), 4);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_edges_count, csr.get()), 5);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(const double *, mgp_csr_weights, csr.get()), nullptr);
+    const auto *offsets = EXPECT_MGP_NO_ERROR(const uint64_t *, mgp_csr_offsets, csr.get());
+    EXPECT_EQ(offsets[4], 5);
+    mgp_vertex_id vertex_id{};
+    EXPECT_EQ(mgp_csr_vertex_id(csr.get(), 4, &vertex_id), mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  }
+  {
+    SCOPED_TRACE("Cities connected by roads");
+    MgpCsrPtr csr{EXPECT_MGP_NO_ERROR(mgp_csr *, mgp_graph_project_csr, &graph, "City", "ROAD", "distance", 1.0,
+                                      &this->memory)};
+    ASSERT_NE(csr, nullptr);
+    ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_vertices_count, csr.get()), 3);
+    ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_edges_count, csr.get()), 3);
+    const auto *offsets = EXPECT_MGP_NO_ERROR(const uint64_t *, mgp_csr_offsets, csr.get());
+    const auto *neighbours = EXPECT_MGP_NO_ERROR(const uint64_t *, mgp_csr_neighbours, csr.get());
+    const auto *weights = EXPECT_MGP_NO_ERROR(const double *, mgp_csr_weights, csr.get());
+    ASSERT_NE(weights, nullptr);
+    const auto to_id = [&csr](uint64_t number) {
+      return EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_csr_vertex_id, csr.get(), number).as_int;
+    };
+    std::vector<std::tuple<int64_t, int64_t, double>> edges;
+    for (uint64_t from = 0; from < 3; ++from) {
+      for (auto edge = offsets[from]; edge < offsets[from + 1]; ++edge) {
+        edges.emplace_back(to_id(from), to_id(neighbours[edge]), weights[edge]);
+      }
+    }
+    std::sort(edges.begin(), edges.end());
+    const std::vector<std::tuple<int64_t, int64_t, double>> expected_edges{
+        {vertex_ids[0].AsInt(), vertex_ids[1].AsInt(), 2.0},
+        {vertex_ids[0].AsInt(), vertex_ids[2].AsInt(), 0.5},
+        {vertex_ids[2].AsInt(), vertex_ids[1].AsInt(), 1.0}};
+    EXPECT_EQ(edges, expected_edges);
+  }
+}
+
+TYPED_TEST(MgpGraphTest, PropertyColumn) {
+  std::map<int64_t, double> expected_values;
+  {
+    auto &accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    const auto label = accessor.NameToLabel("Page");
+    const auto rank = accessor.NameToProperty("rank");
+    const std::array values{memgraph::storage::PropertyValue(3), memgraph::storage::PropertyValue(0.25),
+                            memgraph::storage::PropertyValue("high"), memgraph::storage::PropertyValue()};
+    const std::array expected{3.0, 0.25, -1.0, -1.0};
+    for (size_t i = 0; i < values.size(); ++i) {
+      auto vertex = accessor.InsertVertex();
+      ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(rank, values[i]).HasValue());
+      expected_values.emplace(vertex.Gid().AsInt(), expected[i]);
+    }
+    auto unlabeled = accessor.InsertVertex();
+    ASSERT_TRUE(unlabeled.SetProperty(rank, memgraph::storage::PropertyValue(7)).HasValue());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  auto graph = this->CreateGraph(memgraph::storage::View::OLD);
+  MgpPropertyColumnPtr column{EXPECT_MGP_NO_ERROR(mgp_property_column *, mgp_graph_property_column, &graph, "Page",
+                                                  "rank", -1.0, &this->memory)};
+  ASSERT_NE(column, nullptr);
+  const auto size = EXPECT_MGP_NO_ERROR(size_t, mgp_property_column_size, column.get());
+  ASSERT_EQ(size, expected_values.size());
+  const auto *vertex_ids = EXPECT_MGP_NO_ERROR(const int64_t *, mgp_property_column_vertex_ids, column.get());
+  const auto *values = EXPECT_MGP_NO_ERROR(const double *, mgp_property_column_values, column.get());
+  std::map<int64_t, double> read_values;
+  for (size_t i = 0; i < size; ++i) {
+    read_values.emplace(vertex_ids[i], values[i]);
+  }
+  EXPECT_EQ(read_values, expected_values);
+
+  MgpPropertyColumnPtr all_vertices{EXPECT_MGP_NO_ERROR(mgp_property_column *, mgp_graph_property_column, &graph,
+                                                        nullptr, "rank", -1.0, &this->memory)};
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_property_column_size, all_vertices.get()), expected_values.size() + 1);
+}
+
+TYPED_TEST(MgpGraphTest, ParallelForVertices) {
+  std::set<int64_t> vertex_ids;
+  {
+    auto &accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    for (int i = 0; i < 1000; ++i) {
+      vertex_ids.insert(accessor.InsertVertex().Gid().AsInt());
+    }
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  memgraph::utils::ThreadPool pool(2);
+  memgraph::query::ExecutionContext ctx;
+  ctx.parallel_execution_pool = &pool;
+  ctx.parallel_workers = 3;
+  mgp_graph graph{&this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION),
+                  memgraph::storage::View::NEW, &ctx};
+  struct Payload {
+    size_t workers;
+    std::mutex lock;
+    std::set<int64_t> vertex_ids;
+    size_t partitions{0};
+  } payload{EXPECT_MGP_NO_ERROR(size_t, mgp_graph_parallel_workers, &graph)};
+  EXPECT_EQ(payload.workers, 3);
+
+  EXPECT_SUCCESS(mgp_graph_parallel_for_vertices(
+      &graph,
+      [](mgp_vertices_iterator *it, size_t worker, mgp_memory * /*memory*/, void *raw_payload) {
+        auto *payload = static_cast<Payload *>(raw_payload);
+        MgpVerticesIteratorPtr vertices{it};
+        EXPECT_LT(worker, payload->workers);
+        EXPECT_EQ(EXPECT_MGP_NO_ERROR(int, mgp_vertices_iterator_underlying_graph_is_mutable, it), 0);
+        std::vector<int64_t> vertex_ids;
+        for (auto *vertex = EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_vertices_iterator_get, it); vertex != nullptr;
+             vertex = EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_vertices_iterator_next, it)) {
+          vertex_ids.push_back(EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_vertex_get_id, vertex).as_int);
+        }
+        std::lock_guard guard(payload->lock);
+        for (const auto vertex_id : vertex_ids) {
+          EXPECT_TRUE(payload->vertex_ids.insert(vertex_id).second);
+        }
+        ++payload->partitions;
+      },
+      &payload));
+  EXPECT_EQ(payload.vertex_ids, vertex_ids);
+  if (std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>) {
+    EXPECT_GT(payload.partitions, 1);
+  } else {
+    // The on-disk storage can't split the vertices.
+    EXPECT_EQ(payload.partitions, 1);
+  }
+}
@@ -270,3 +270,32 @@ TEST(QueryProfileTest, ComplicatedQuery) {
   EXPECT_EQ(children5[0]["name"], "Once");
   EXPECT_TRUE(children5[0]["children"].empty());
 }
+
+TEST(QueryProfileTest, Counters) {
+  std::chrono::duration<double> total_time{0.001};
+  ProfilingStats scan{3, 40, 0, "ScanAll", {}, {100, 64, 5, 1, 30, {2, 0, 7, 1}}};
+  ProfilingStats produce{3, 100, 0, "Produce", {scan}, {300, 192, 5, 1, 40, {2, 4, 9, 1}}};
+
+  auto json = ProfilingStatsToJson(ProfilingStatsWithTotalTime{produce, total_time});
+
+  // The counters of an operator don't include the ones of its children.
+  EXPECT_EQ(json["cpu_time_ns"], 200);
+  EXPECT_EQ(json["allocated_bytes"], 128);
+  EXPECT_EQ(json["lock_wait_ns"], 0);
+  EXPECT_EQ(json["lock_contentions"], 0);
+  EXPECT_EQ(json["lock_spins"], 10);
+  EXPECT_EQ(json["vertices_touched"], 0);
+  EXPECT_EQ(json["edges_touched"], 4);
+  EXPECT_EQ(json["delta_steps"], 2);
+  EXPECT_EQ(json["index_seeks"], 0);
+
+  EXPECT_EQ(json["children"][0]["cpu_time_ns"], 100);
+  EXPECT_EQ(json["children"][0]["allocated_bytes"], 64);
+  EXPECT_EQ(json["children"][0]["lock_wait_ns"], 5);
+  EXPECT_EQ(json["children"][0]["lock_contentions"], 1);
+  EXPECT_EQ(json["children"][0]["lock_spins"], 30);
+  EXPECT_EQ(json["children"][0]["vertices_touched"], 2);
+  EXPECT_EQ(json["children"][0]["edges_touched"], 0);
+  EXPECT_EQ(json["children"][0]["delta_steps"], 7);
+  EXPECT_EQ(json["children"][0]["index_seeks"], 1);
+}
@@ -122,6 +122,18 @@ TEST_F(TestPrivilegeExtractor, ShowStatsInfo) {
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::STATS));
 }
 
+TEST_F(TestPrivilegeExtractor, ShowIndexRecommendations) {
+  auto *query = storage.Create<InfoQuery>();
+  query->info_type_ = InfoQuery::InfoType::INDEX_RECOMMENDATIONS;
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::INDEX));
+}
+
+TEST_F(TestPrivilegeExtractor, ShowSlowQueries) {
+  auto *query = storage.Create<InfoQuery>();
+  query->info_type_ = InfoQuery::InfoType::SLOW_QUERIES;
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::STATS));
+}
+
 TEST_F(TestPrivilegeExtractor, ShowConstraintInfo) {
   auto *query = storage.Create<InfoQuery>();
   query->info_type_ = InfoQuery::InfoType::CONSTRAINT;
@@ -174,6 +186,14 @@ TEST_F(TestPrivilegeExtractor, TriggerQuery) {
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::TRIGGER));
 }
 
+TEST_F(TestPrivilegeExtractor, MaterializedViewQuery) {
+  auto *query = storage.Create<MaterializedViewQuery>();
+  query->action_ = MaterializedViewQuery::Action::CREATE_VIEW;
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::INDEX));
+  query->action_ = MaterializedViewQuery::Action::SHOW_VIEW;
+  EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::MATCH));
+}
+
 TEST_F(TestPrivilegeExtractor, SetIsolationLevelQuery) {
   auto *query = storage.Create<IsolationLevelQuery>();
   EXPECT_THAT(GetRequiredPrivileges(query), UnorderedElementsAre(AuthQuery::Privilege::CONFIG));
@@ -0,0 +1,113 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "query/cypher_query_interpreter.hpp"
+#include "query/query_result_cache.hpp"
+
+using memgraph::query::QueryResultCache;
+using memgraph::query::TypedValue;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::SnapshotId;
+
+class QueryResultCacheTest : public ::testing::Test {
+ protected:
+  static QueryResultCache::Key MakeKey(PropertyValue parameter) {
+    return QueryResultCache::Key{
+        .database = "memgraph", .username = "", .query_hash = 1, .parameters = {std::move(parameter)}};
+  }
+
+  void Record(const QueryResultCache::Key &key, const SnapshotId &snapshot, const std::vector<TypedValue> &row) {
+    QueryResultCache::Recorder recorder(&cache_, key, {"value"}, snapshot);
+    recorder.Result(row);
+    recorder.Finish();
+  }
+
+  std::optional<QueryResultCache::Key> MakeQueryKey(const std::string &query) {
+    auto parsed_query = memgraph::query::ParseQuery(query, {}, &ast_cache_, config_);
+    return QueryResultCache::MakeKey("memgraph", std::nullopt, parsed_query);
+  }
+
+  memgraph::utils::SkipList<memgraph::query::QueryCacheEntry> ast_cache_;
+  memgraph::query::InterpreterConfig::Query config_;
+  QueryResultCache cache_;
+};
+
+TEST_F(QueryResultCacheTest, FindsResultOfSameSnapshot) {
+  const SnapshotId snapshot{.last_commit_timestamp = 1, .storage_mode_changes = 0};
+  const SnapshotId later_snapshot{.last_commit_timestamp = 2, .storage_mode_changes = 0};
+  cache_.SetCapacity(1024 * 1024);
+  Record(MakeKey(PropertyValue(1)), snapshot, {TypedValue("text"), TypedValue(1)});
+
+  auto result = cache_.Find(MakeKey(PropertyValue(1)), snapshot, std::nullopt);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->header, std::vector<std::string>{"value"});
+  ASSERT_EQ(result->rows.size(), 1);
+  EXPECT_EQ(result->rows[0][0].ValueString(), "text");
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(2)), snapshot, std::nullopt));
+  // A double parameter equal to the integer one is another query.
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(1.0)), snapshot, std::nullopt));
+
+  // Results of older snapshots are only found while they are fresh enough.
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(1)), later_snapshot, std::nullopt));
+  EXPECT_TRUE(cache_.Find(MakeKey(PropertyValue(1)), later_snapshot, std::chrono::hours(1)));
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(1)), later_snapshot, std::chrono::milliseconds(0)));
+}
+
+TEST_F(QueryResultCacheTest, ClearDropsRunningQueries) {
+  const SnapshotId snapshot{.last_commit_timestamp = 1, .storage_mode_changes = 0};
+  cache_.SetCapacity(1024 * 1024);
+  QueryResultCache::Recorder recorder(&cache_, MakeKey(PropertyValue(1)), {"value"}, snapshot);
+  recorder.Result({TypedValue(1)});
+  cache_.Clear();
+  recorder.Finish();
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(1)), snapshot, std::nullopt));
+}
+
+TEST_F(QueryResultCacheTest, EvictsOverCapacity) {
+  const SnapshotId snapshot{.last_commit_timestamp = 1, .storage_mode_changes = 0};
+  const std::string value(1000, 'a');
+  cache_.SetCapacity(2500);
+  for (int64_t parameter = 0; parameter < 3; ++parameter) {
+    Record(MakeKey(PropertyValue(parameter)), snapshot, {TypedValue(value)});
+    // The first result is used again, so the second one is evicted.
+    EXPECT_TRUE(cache_.Find(MakeKey(PropertyValue(0)), snapshot, std::nullopt));
+  }
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(1)), snapshot, std::nullopt));
+  EXPECT_TRUE(cache_.Find(MakeKey(PropertyValue(2)), snapshot, std::nullopt));
+
+  // Results larger than the capacity aren't cached.
+  Record(MakeKey(PropertyValue(3)), snapshot, {TypedValue(std::string(3000, 'a'))});
+  EXPECT_FALSE(cache_.Find(MakeKey(PropertyValue(3)), snapshot, std::nullopt));
+}
+
+TEST_F(QueryResultCacheTest, SkipsQueriesWithChangingResults) {
+  EXPECT_TRUE(MakeQueryKey("MATCH (n) WHERE n.value > 5 RETURN count(n)"));
+  EXPECT_TRUE(MakeQueryKey("RETURN date('2023-01-01')"));
+  EXPECT_FALSE(MakeQueryKey("RETURN rand()"));
+  EXPECT_FALSE(MakeQueryKey("MATCH (n) RETURN n.value, timestamp()"));
+  EXPECT_FALSE(MakeQueryKey("RETURN localDateTime()"));
+  EXPECT_FALSE(MakeQueryKey("CALL mg.procedures() YIELD name RETURN name"));
+  EXPECT_FALSE(MakeQueryKey("CREATE INDEX ON :Label"));
+
+  // The same query with other literals has another key.
+  auto key = MakeQueryKey("MATCH (n) WHERE n.value > 5 RETURN count(n)");
+  auto other_key = MakeQueryKey("MATCH (n) WHERE n.value > 6 RETURN count(n)");
+  ASSERT_TRUE(key && other_key);
+  EXPECT_EQ(key->query_hash, other_key->query_hash);
+  EXPECT_FALSE(*key == *other_key);
+}
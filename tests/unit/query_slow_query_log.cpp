@@ -0,0 +1,113 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <json/json.hpp>
+
+#include "query/slow_query_log.hpp"
+
+using memgraph::query::SlowQuery;
+using memgraph::query::SlowQueryLog;
+
+class SlowQueryLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override { Clear(); }
+  void TearDown() override { Clear(); }
+
+  void Clear() {
+    if (std::filesystem::exists(directory_)) std::filesystem::remove_all(directory_);
+  }
+
+  static SlowQuery MakeQuery(const std::string &query, double execution_time) {
+    return SlowQuery{.query = query, .execution_time = execution_time};
+  }
+
+  std::filesystem::path directory_{std::filesystem::temp_directory_path() / "MG_test_unit_query_slow_query_log"};
+};
+
+TEST_F(SlowQueryLogTest, Threshold) {
+  SlowQueryLog log{directory_, std::chrono::milliseconds(100), 1.0, 10};
+  EXPECT_TRUE(log.IsEnabled());
+  EXPECT_FALSE(log.ShouldRecord(std::chrono::milliseconds(99)));
+  EXPECT_TRUE(log.ShouldRecord(std::chrono::milliseconds(100)));
+}
+
+TEST_F(SlowQueryLogTest, Disabled) {
+  SlowQueryLog no_samples{directory_, std::chrono::milliseconds(0), 0.0, 10};
+  EXPECT_FALSE(no_samples.IsEnabled());
+  EXPECT_FALSE(no_samples.ShouldRecord(std::chrono::seconds(10)));
+
+  SlowQueryLog no_entries{directory_, std::chrono::milliseconds(0), 1.0, 0};
+  EXPECT_FALSE(no_entries.IsEnabled());
+  EXPECT_FALSE(no_entries.ShouldRecord(std::chrono::seconds(10)));
+}
+
+TEST_F(SlowQueryLogTest, Sampling) {
+  SlowQueryLog log{directory_, std::chrono::milliseconds(0), 0.5, 10};
+  size_t recorded = 0;
+  for (size_t i = 0; i < 10000; ++i) {
+    if (log.ShouldRecord(std::chrono::seconds(1))) ++recorded;
+  }
+  EXPECT_GT(recorded, 4000);
+  EXPECT_LT(recorded, 6000);
+}
+
+TEST_F(SlowQueryLogTest, KeepsRecent) {
+  SlowQueryLog log{directory_, std::chrono::milliseconds(0), 1.0, 3};
+  for (int i = 0; i < 5; ++i) {
+    log.Record(MakeQuery("RETURN " + std::to_string(i), 1.0));
+  }
+  const auto recent = log.Recent();
+  ASSERT_EQ(recent.size(), 3);
+  EXPECT_EQ(recent[0].query, "RETURN 2");
+  EXPECT_EQ(recent[2].query, "RETURN 4");
+}
+
+TEST_F(SlowQueryLogTest, WritesFile) {
+  SlowQueryLog log{directory_, std::chrono::milliseconds(0), 1.0, 10};
+  auto query = MakeQuery("MATCH (n) RETURN n", 1.5);
+  query.parsing_time = 0.5;
+  log.Record(query);
+  log.Flush();
+
+  std::ifstream file(directory_ / "slow_queries.log");
+  std::string line;
+  ASSERT_TRUE(std::getline(file, line));
+  const auto entry = nlohmann::json::parse(line);
+  EXPECT_EQ(entry["query"], "MATCH (n) RETURN n");
+  EXPECT_EQ(entry["execution_time"], 1.5);
+  EXPECT_EQ(entry["total_time"], 2.0);
+  EXPECT_FALSE(std::getline(file, line));
+}
+
+TEST_F(SlowQueryLogTest, RotatesFile) {
+  SlowQueryLog log{directory_, std::chrono::milliseconds(0), 1.0, 10};
+  const std::string query(memgraph::query::kSlowQueryLogMaxFileSize / 4, 'x');
+  for (int i = 0; i < 6; ++i) {
+    log.Record(MakeQuery(query, 1.0));
+    log.Flush();
+  }
+  EXPECT_TRUE(std::filesystem::exists(directory_ / "slow_queries.log"));
+  EXPECT_TRUE(std::filesystem::exists(directory_ / "slow_queries.log.1"));
+  EXPECT_FALSE(std::filesystem::exists(directory_ / "slow_queries.log.2"));
+}
+
+TEST(SlowQueryParameters, Shape) {
+  std::map<std::string, memgraph::storage::PropertyValue> parameters{
+      {"id", memgraph::storage::PropertyValue(1)}, {"name", memgraph::storage::PropertyValue("value")}};
+  EXPECT_EQ(memgraph::query::ParametersShape(parameters), "{id: int, name: string}");
+  EXPECT_EQ(memgraph::query::ParametersShape({}), "{}");
+}
@@ -373,6 +373,25 @@ TYPED_TEST(TriggerContextTest, ReturnCreateOnlyEvent) {
   CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_OBJECTS, 0, dba);
 }
 
+TYPED_TEST(TriggerContextTest, Merge) {
+  memgraph::query::DbAccessor dba{this->StartTransaction()};
+
+  const auto collect_created_vertices = [&](const size_t count) {
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    for (size_t i = 0; i < count; ++i) {
+      trigger_context_collector.RegisterCreatedObject(dba.InsertVertex());
+    }
+    return std::move(trigger_context_collector).TransformToTriggerContext();
+  };
+
+  auto trigger_context = collect_created_vertices(2);
+  trigger_context.Merge(collect_created_vertices(3));
+  dba.AdvanceCommand();
+
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 5, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_EDGES, 0, dba);
+}
+
 namespace {
 void EXPECT_PROP_TRUE(const memgraph::query::TypedValue &a) {
   EXPECT_TRUE(a.type() == memgraph::query::TypedValue::Type::Bool && a.ValueBool());
@@ -1274,3 +1293,46 @@ TYPED_TEST(TriggerStoreTest, AuthCheckerUsage) {
   ASSERT_EQ(triggers.size(), 1);
   ASSERT_EQ(triggers.front().owner, owner);
 }
+
+TEST(AfterCommitTriggerExecutorTest, MergesQueuedContexts) {
+  std::mutex lock;
+  std::condition_variable cv;
+  bool first_run_started{false};
+  bool first_run_released{false};
+  size_t runs{0};
+
+  memgraph::query::AfterCommitTriggerExecutor executor{
+      1, 10, 0, [&](memgraph::query::TriggerContext /*trigger_context*/) {
+        std::unique_lock guard(lock);
+        ++runs;
+        first_run_started = true;
+        cv.notify_all();
+        cv.wait(guard, [&] { return first_run_released; });
+      }};
+
+  std::atomic<size_t> finished{0};
+  const auto on_finished = [&finished] { ++finished; };
+  executor.Add(memgraph::query::TriggerContext{}, on_finished);
+  {
+    std::unique_lock guard(lock);
+    cv.wait(guard, [&] { return first_run_started; });
+  }
+
+  // The transactions committed while the triggers run are merged into a single run.
+  for (size_t i = 0; i < 3; ++i) {
+    executor.Add(memgraph::query::TriggerContext{}, on_finished);
+  }
+  EXPECT_EQ(executor.QueueDepth(), 3);
+  {
+    std::lock_guard guard(lock);
+    first_run_released = true;
+  }
+  cv.notify_all();
+
+  while (finished.load() < 4) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(executor.QueueDepth(), 0);
+  std::lock_guard guard(lock);
+  EXPECT_EQ(runs, 2);
+}
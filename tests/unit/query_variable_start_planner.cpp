@@ -435,4 +435,29 @@ TYPED_TEST(TestVariableStartPlanner, TestSubqueryWithTripleUnion) {
                dba);
   });
 }
+
+TYPED_TEST(TestVariableStartPlanner, MatchRingPattern) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // Make a ring (v0:Start) -[:r]-> (v1) -[:r]-> ... -[:r]-> (v4) -[:r]-> (v0)
+  std::vector<memgraph::query::VertexAccessor> vertices;
+  for (int i = 0; i < 5; ++i) {
+    vertices.push_back(dba.InsertVertex());
+  }
+  ASSERT_TRUE(vertices[0].AddLabel(dba.NameToLabel("Start")).HasValue());
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(dba.InsertEdge(&vertices[i], &vertices[(i + 1) % 5], dba.NameToEdgeType("r")).HasValue());
+  }
+  dba.AdvanceCommand();
+  // Test MATCH (a:Start) -[r1]-> (b) -[r2]-> (c) -[r3]-> (d) -[r4]-> (e) -[r5]-> (a) RETURN a, c
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("a", "Start"), EDGE("r1", Direction::OUT), NODE("b"), EDGE("r2", Direction::OUT), NODE("c"),
+                    EDGE("r3", Direction::OUT), NODE("d"), EDGE("r4", Direction::OUT), NODE("e"),
+                    EDGE("r5", Direction::OUT), NODE("a"))),
+      RETURN("a", "c")));
+  // Each node is a starting node, and the expansions from it are reordered.
+  CheckPlansProduce(5, query, this->storage, &dba, [&](const auto &results) {
+    AssertRows(results, {{TypedValue(vertices[0]), TypedValue(vertices[2])}}, dba);
+  });
+}
 }  // namespace
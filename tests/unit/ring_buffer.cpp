@@ -94,3 +94,40 @@ TEST(RingBuffer, NonCopyable) {
 
   std::unique_ptr<std::string> a(new std::string("bla"));
 }
+
+TEST(RingBuffer, TryEmplace) {
+  RingBuffer<std::unique_ptr<std::string>> buffer{2};
+  EXPECT_TRUE(buffer.try_emplace(std::make_unique<std::string>("string")));
+  EXPECT_TRUE(buffer.try_emplace(std::make_unique<std::string>("kifla")));
+
+  auto element = std::make_unique<std::string>("bla");
+  EXPECT_FALSE(buffer.try_emplace(std::move(element)));
+  // The element isn't moved from if it wasn't emplaced.
+  ASSERT_TRUE(element);
+
+  EXPECT_EQ(**buffer.pop(), "string");
+  EXPECT_TRUE(buffer.try_emplace(std::move(element)));
+  EXPECT_EQ(**buffer.pop(), "kifla");
+  EXPECT_EQ(**buffer.pop(), "bla");
+  EXPECT_FALSE(buffer.pop());
+}
+
+TEST(RingBuffer, WrapsAround) {
+  RingBuffer<int> buffer{3};
+  for (int i = 0; i < 100; i++) {
+    ASSERT_TRUE(buffer.try_emplace(2 * i));
+    ASSERT_TRUE(buffer.try_emplace(2 * i + 1));
+    EXPECT_EQ(*buffer.pop(), 2 * i);
+    EXPECT_EQ(*buffer.pop(), 2 * i + 1);
+  }
+  EXPECT_FALSE(buffer.pop());
+
+  ASSERT_TRUE(buffer.try_emplace(1));
+  ASSERT_TRUE(buffer.try_emplace(2));
+  ASSERT_TRUE(buffer.try_emplace(3));
+  EXPECT_FALSE(buffer.try_emplace(4));
+  buffer.clear();
+  EXPECT_FALSE(buffer.pop());
+  ASSERT_TRUE(buffer.try_emplace(5));
+  EXPECT_EQ(*buffer.pop(), 5);
+}
@@ -109,6 +109,43 @@ TEST(Rpc, Abort) {
   server.AwaitShutdown();
 }
 
+TEST(Rpc, Pipelining) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context);
+  server.Register<Sum>([](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    memgraph::slk::Load(&req, req_reader);
+    std::this_thread::sleep_for(200ms);
+    SumRes res(req.x + req.y);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext client_context;
+  Client client(server.endpoint(), &client_context);
+
+  std::thread thread([&client]() {
+    auto sum = client.Call<Sum>(10, 20);
+    EXPECT_EQ(sum.sum, 30);
+  });
+  std::this_thread::sleep_for(50ms);
+
+  // The request is sent while the first request still awaits its response,
+  // the responses are received in order.
+  memgraph::utils::Timer timer;
+  auto stream = client.Stream<Sum>(30, 40);
+  EXPECT_LT(timer.Elapsed(), 100ms);
+  auto sum = stream.AwaitResponse();
+  EXPECT_EQ(sum.sum, 70);
+  EXPECT_GE(timer.Elapsed(), 300ms);
+
+  thread.join();
+
+  server.Shutdown();
+  server.AwaitShutdown();
+}
+
 TEST(Rpc, ClientPool) {
   memgraph::communication::ServerContext server_context;
   Server server({"127.0.0.1", 0}, &server_context);
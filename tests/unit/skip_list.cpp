@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
 #include <vector>
 
 #include <fmt/format.h>
@@ -478,6 +479,114 @@ TEST(SkipList, FindEqualOrGreater) {
   }
 }
 
+TEST(SkipList, Split) {
+  memgraph::utils::SkipList<uint64_t> list;
+
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.split(4).empty());
+    for (uint64_t i = 0; i < 100000; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.split(1).empty());
+    for (uint64_t num_parts : {2, 4, 16, 100}) {
+      auto split_points = acc.split(num_parts);
+      ASSERT_FALSE(split_points.empty());
+      ASSERT_LT(split_points.size(), num_parts);
+      // The parts cover the whole list in order and none of them is empty.
+      uint64_t begin = 0;
+      for (auto split_point : split_points) {
+        ASSERT_NE(split_point, acc.end());
+        ASSERT_GT(*split_point, begin);
+        begin = *split_point;
+      }
+    }
+  }
+}
+
+TEST(SkipList, InsertWithFinger) {
+  memgraph::utils::SkipList<uint64_t> list;
+
+  {
+    auto acc = list.access();
+    memgraph::utils::SkipList<uint64_t>::Finger finger;
+    for (uint64_t i = 0; i < 10000; i += 2) {
+      auto ret = acc.insert(finger, i);
+      ASSERT_EQ(*ret.first, i);
+      ASSERT_TRUE(ret.second);
+    }
+    // The finger moves backwards when the objects aren't sorted.
+    memgraph::utils::SkipList<uint64_t>::Finger other_finger;
+    for (uint64_t i = 9999; i < 10000; i -= 2) {
+      ASSERT_TRUE(acc.insert(other_finger, i).second);
+    }
+    for (uint64_t i = 0; i < 10000; i += 3) {
+      auto ret = acc.insert(finger, i);
+      ASSERT_EQ(*ret.first, i);
+      ASSERT_FALSE(ret.second);
+    }
+  }
+
+  {
+    auto acc = list.access();
+    ASSERT_EQ(acc.size(), 10000);
+    uint64_t expected = 0;
+    for (auto item : acc) ASSERT_EQ(item, expected++);
+  }
+}
+
+TEST(SkipList, BuildFromSortedRange) {
+  std::vector<uint64_t> items;
+  for (uint64_t i = 0; i < 10000; ++i) items.push_back(i * 2);
+  memgraph::utils::SkipList<uint64_t> list(items.begin(), items.end());
+
+  auto acc = list.access();
+  ASSERT_EQ(acc.size(), items.size());
+  ASSERT_TRUE(std::equal(acc.begin(), acc.end(), items.begin(), items.end()));
+  ASSERT_TRUE(acc.contains(1000));
+  ASSERT_FALSE(acc.contains(1001));
+  ASSERT_TRUE(acc.insert(1001).second);
+  ASSERT_TRUE(acc.remove(1000));
+  ASSERT_EQ(*acc.find_equal_or_greater(1000), 1001);
+}
+
+class CountingMemory final : public memgraph::utils::MemoryResource {
+ public:
+  int64_t allocated_{0};
+
+ private:
+  void *DoAllocate(size_t bytes, size_t alignment) override {
+    ++allocated_;
+    return memgraph::utils::NewDeleteResource()->Allocate(bytes, alignment);
+  }
+
+  void DoDeallocate(void *ptr, size_t bytes, size_t alignment) override {
+    --allocated_;
+    memgraph::utils::NewDeleteResource()->Deallocate(ptr, bytes, alignment);
+  }
+
+  bool DoIsEqual(const memgraph::utils::MemoryResource &other) const noexcept override { return this == &other; }
+};
+
+TEST(SkipList, ReclaimsRemovedNodesWithoutGc) {
+  CountingMemory memory;
+  const int64_t items = 4 * memgraph::utils::kSkipListGcCollectInterval;
+  memgraph::utils::SkipList<int64_t> list(&memory);
+  for (int64_t i = 0; i < items; ++i) {
+    ASSERT_TRUE(list.access().insert(i).second);
+  }
+  ASSERT_GE(memory.allocated_, items);
+  for (int64_t i = 0; i < items; ++i) {
+    ASSERT_TRUE(list.access().remove(i));
+  }
+  // Only the nodes removed since the last collection are left.
+  ASSERT_LT(memory.allocated_, 2 * memgraph::utils::kSkipListGcCollectInterval);
+}
+
 struct Counter {
   int64_t key;
   int64_t value;
@@ -10,9 +10,12 @@
 // licenses/APL.txt.
 
 #include <gtest/gtest.h>
+#include <unistd.h>
 
+#include <cstdio>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <random>
 #include <vector>
 
@@ -136,6 +139,105 @@ TEST(Builder, MultipleSegments) {
   ASSERT_EQ(splits[4], footer_expected);
 }
 
+TEST(Builder, GatheredWrite) {
+  std::vector<uint8_t> buffer;
+  size_t gathered_writes = 0;
+  memgraph::slk::Builder builder(
+      [&buffer](const uint8_t *data, size_t size, bool have_more) {
+        for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+      },
+      [&buffer, &gathered_writes](std::span<const iovec> parts, bool have_more) {
+        ASSERT_TRUE(have_more);
+        for (const auto &part : parts) {
+          const auto *data = static_cast<const uint8_t *>(part.iov_base);
+          buffer.insert(buffer.end(), data, data + part.iov_len);
+        }
+        ++gathered_writes;
+      });
+
+  auto small = GetRandomData(5);
+  auto large = GetRandomData(2 * memgraph::slk::kSegmentMaxDataSize + 100);
+  builder.Save(small.data(), small.size());
+  builder.Save(large.data(), large.size());
+  builder.Finalize();
+
+  ASSERT_EQ(gathered_writes, 1);
+  ASSERT_EQ(buffer.size(), small.size() + large.size() + 5 * sizeof(memgraph::slk::SegmentSize));
+
+  auto splits = BufferToBinaryData(
+      buffer.data(), buffer.size(),
+      {sizeof(memgraph::slk::SegmentSize), small.size(), sizeof(memgraph::slk::SegmentSize),
+       memgraph::slk::kSegmentMaxDataSize, sizeof(memgraph::slk::SegmentSize), memgraph::slk::kSegmentMaxDataSize,
+       sizeof(memgraph::slk::SegmentSize), 100, sizeof(memgraph::slk::SegmentSize)});
+  ASSERT_EQ(splits[0], SizeToBinaryData(small.size()));
+  ASSERT_EQ(splits[1], small);
+  ASSERT_EQ(splits[2], SizeToBinaryData(memgraph::slk::kSegmentMaxDataSize));
+  ASSERT_EQ(splits[4], SizeToBinaryData(memgraph::slk::kSegmentMaxDataSize));
+  ASSERT_EQ(splits[6], SizeToBinaryData(100));
+  ASSERT_EQ(splits[3] + splits[5] + splits[7], large);
+  ASSERT_EQ(splits[8], SizeToBinaryData(0));
+
+  memgraph::slk::Reader reader(buffer.data(), buffer.size());
+  uint8_t loaded_small[5];
+  reader.Load(loaded_small, sizeof(loaded_small));
+  ASSERT_EQ(BinaryData(loaded_small, sizeof(loaded_small)), small);
+  size_t pos = 0;
+  while (pos < large.size()) {
+    auto view = reader.LoadView(large.size() - pos);
+    ASSERT_GT(view.size(), 0);
+    ASSERT_EQ(BinaryData(reinterpret_cast<const uint8_t *>(view.data()), view.size()),
+              BinaryData(large.data() + pos, view.size()));
+    pos += view.size();
+  }
+  ASSERT_EQ(pos, large.size());
+  reader.Finalize();
+}
+
+TEST(Builder, SaveFile) {
+  auto input = GetRandomData(2 * memgraph::slk::kSegmentMaxDataSize + 100);
+  auto *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(std::fwrite(input.data(), 1, input.size(), file), input.size());
+  ASSERT_EQ(std::fflush(file), 0);
+  const auto fd = fileno(file);
+
+  // The file data is read into the segment buffer or sent by the send file
+  // function, both streams must have the same data.
+  for (const auto send_file : {false, true}) {
+    std::vector<uint8_t> buffer;
+    auto write_func = [&buffer](const uint8_t *data, size_t size, bool have_more) {
+      for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+    };
+    std::optional<memgraph::slk::Builder> builder;
+    if (send_file) {
+      builder.emplace(
+          write_func, [](std::span<const iovec> parts, bool have_more) {},
+          [&buffer](int fd, uint64_t offset, size_t size, bool have_more) {
+            const auto old_size = buffer.size();
+            buffer.resize(old_size + size);
+            ASSERT_EQ(pread(fd, buffer.data() + old_size, size, static_cast<off_t>(offset)), size);
+          });
+    } else {
+      builder.emplace(write_func);
+    }
+
+    uint8_t small[3] = {1, 2, 3};
+    builder->Save(small, sizeof(small));
+    builder->SaveFile(fd, 100, input.size() - 100);
+    builder->Finalize();
+
+    memgraph::slk::Reader reader(buffer.data(), buffer.size());
+    uint8_t loaded_small[3];
+    reader.Load(loaded_small, sizeof(loaded_small));
+    ASSERT_EQ(BinaryData(loaded_small, sizeof(loaded_small)), BinaryData(small, sizeof(small)));
+    std::unique_ptr<uint8_t[]> loaded(new uint8_t[input.size() - 100]);
+    reader.Load(loaded.get(), input.size() - 100);
+    ASSERT_EQ(BinaryData(std::move(loaded), input.size() - 100), BinaryData(input.data() + 100, input.size() - 100));
+    reader.Finalize();
+  }
+  std::fclose(file);
+}
+
 TEST(Reader, SingleSegment) {
   std::vector<uint8_t> buffer;
   memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
@@ -18,9 +18,11 @@
 #include "disk_test_utils.hpp"
 #include "storage/v2/disk/storage.hpp"
 #include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/vertex_filter.hpp"
 #include "storage_test_utils.hpp"
 
 using testing::Types;
@@ -2646,3 +2648,178 @@ TYPED_TEST(StorageV2Test, DeletedVertexAccessor) {
     ASSERT_EQ(property_value, *maybe_property);
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2InMemory, DictionaryEncodedProperties) {
+  memgraph::storage::Config config;
+  config.dictionary_encoded_properties = {"category"};
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(config));
+  auto &dictionary = memgraph::storage::GetPropertyStringDictionary();
+  const memgraph::storage::PropertyValue electronics("dictionary test electronics");
+  const memgraph::storage::PropertyValue books("dictionary test books");
+
+  memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  auto dictionary_size = dictionary.size();
+  {
+    auto acc = store->Access();
+    auto property = acc->NameToProperty("category");
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_TRUE(vertex.SetProperty(property, electronics)->IsNull());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_EQ(dictionary.size(), dictionary_size + 1);
+  {
+    auto acc = store->Access();
+    auto property = acc->NameToProperty("category");
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), electronics);
+    ASSERT_EQ(*vertex->SetProperty(property, books), electronics);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::NEW), books);
+    acc->Abort();
+  }
+  ASSERT_EQ(dictionary.size(), dictionary_size + 2);
+  {
+    auto acc = store->Access();
+    auto property = acc->NameToProperty("category");
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), electronics);
+    acc->Abort();
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2InMemory, CardinalityCounts) {
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage());
+  const auto label = store->NameToLabel("label");
+  const auto edge_type = store->NameToEdgeType("edge");
+  memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->VertexCount(label), 0U);
+    ASSERT_EQ(acc->EdgeCount(edge_type), 0U);
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    gid = from.Gid();
+    ASSERT_TRUE(from.AddLabel(label).HasValue());
+    ASSERT_TRUE(to.AddLabel(label).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&from, &to, edge_type).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&to, &to, edge_type).HasValue());
+    // the counts don't include the changes of the transaction
+    ASSERT_EQ(acc->VertexCount(label), std::nullopt);
+    ASSERT_EQ(acc->EdgeCount(edge_type), std::nullopt);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto old_acc = store->Access();
+  ASSERT_EQ(old_acc->VertexCount(label), 2U);
+  ASSERT_EQ(old_acc->EdgeCount(edge_type), 2U);
+  {
+    auto acc = store->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(acc->DetachDeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = store->Access(memgraph::storage::IsolationLevel::READ_COMMITTED);
+    ASSERT_EQ(acc->VertexCount(label), std::nullopt);
+  }
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->VertexCount(label), 1U);
+    ASSERT_EQ(acc->EdgeCount(edge_type), 1U);
+  }
+  // the older transaction still sees the counts when it started
+  ASSERT_EQ(old_acc->VertexCount(label), 2U);
+  ASSERT_EQ(old_acc->EdgeCount(edge_type), 2U);
+  old_acc->Abort();
+  old_acc.reset();
+
+  store->FreeMemory();
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->VertexCount(label), 1U);
+    ASSERT_EQ(acc->EdgeCount(edge_type), 1U);
+  }
+
+  // analytical transactions don't change the counts
+  store->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->VertexCount(label), std::nullopt);
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  store->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_TRANSACTIONAL);
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->VertexCount(label), 2U);
+    ASSERT_EQ(acc->EdgeCount(edge_type), 1U);
+  }
+}
+
+TEST(StorageV2InMemory, VertexFilter) {
+  using Comparison = memgraph::storage::VertexFilter::Comparison;
+  using memgraph::storage::PropertyValue;
+  using memgraph::storage::View;
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage());
+  const auto label = store->NameToLabel("label");
+  const auto x = store->NameToProperty("x");
+  const auto y = store->NameToProperty("y");
+  ASSERT_FALSE(store->CreateIndex(label, x).HasError());
+  memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  {
+    auto acc = store->Access();
+    auto one = acc->CreateVertex();
+    gid = one.Gid();
+    ASSERT_TRUE(one.AddLabel(label).HasValue());
+    ASSERT_TRUE(one.SetProperty(x, PropertyValue(1)).HasValue());
+    auto five = acc->CreateVertex();
+    ASSERT_TRUE(five.AddLabel(label).HasValue());
+    ASSERT_TRUE(five.SetProperty(x, PropertyValue(5.0)).HasValue());
+    ASSERT_TRUE(five.SetProperty(y, PropertyValue(true)).HasValue());
+    auto str = acc->CreateVertex();
+    ASSERT_TRUE(str.SetProperty(x, PropertyValue("a")).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto count = [](memgraph::storage::VerticesIterable vertices, const memgraph::storage::VertexFilter &filter) {
+    EXPECT_TRUE(vertices.SetFilter(&filter));
+    size_t count = 0;
+    for (auto it = vertices.begin(); it != vertices.end(); ++it) ++count;
+    return count;
+  };
+
+  auto acc = store->Access();
+  {
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(x, PropertyValue(10)).HasValue());
+  }
+  memgraph::storage::VertexFilter greater;
+  greater.AddLabel(label);
+  greater.AddProperty(x, Comparison::GREATER, PropertyValue(2));
+  // the filter sees the version of the vertex of the view
+  EXPECT_EQ(count(acc->Vertices(View::OLD), greater), 1U);
+  EXPECT_EQ(count(acc->Vertices(View::NEW), greater), 2U);
+
+  memgraph::storage::VertexFilter equal;
+  equal.AddProperty(x, Comparison::EQUAL, PropertyValue("a"));
+  EXPECT_EQ(count(acc->Vertices(View::OLD), equal), 1U);
+
+  // comparing the order of strings and numbers is left to the query engine
+  memgraph::storage::VertexFilter less;
+  less.AddProperty(x, Comparison::LESS, PropertyValue("b"));
+  EXPECT_EQ(count(acc->Vertices(View::OLD), less), 3U);
+
+  memgraph::storage::VertexFilter not_null;
+  not_null.AddProperty(y, Comparison::IS_NOT_NULL, PropertyValue());
+  EXPECT_EQ(count(acc->Vertices(label, x, PropertyValue(5), View::OLD), not_null), 1U);
+  EXPECT_EQ(count(acc->Vertices(label, x, PropertyValue(1), View::OLD), not_null), 0U);
+  const auto lower = memgraph::utils::MakeBoundInclusive(PropertyValue(0));
+  EXPECT_EQ(count(acc->Vertices(label, x, lower, std::nullopt, View::NEW), greater), 2U);
+}
@@ -0,0 +1,133 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "storage/v2/commit_changes.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+
+using memgraph::storage::CommitChanges;
+using memgraph::storage::Gid;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::View;
+
+class CommitChangesTest : public ::testing::Test {
+ protected:
+  template <typename TFunc>
+  CommitChanges Commit(const TFunc &func) {
+    auto accessor = storage_->Access();
+    func(accessor.get());
+    accessor->CollectCommitChanges();
+    EXPECT_FALSE(accessor->Commit().HasError());
+    auto changes = accessor->TakeCommitChanges();
+    EXPECT_TRUE(changes);
+    return std::move(*changes);
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage_{
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{})};
+};
+
+TEST_F(CommitChangesTest, CreateAndChange) {
+  const auto label = storage_->NameToLabel("Label");
+  const auto other_label = storage_->NameToLabel("Other");
+  const auto property = storage_->NameToProperty("property");
+  const auto edge_type = storage_->NameToEdgeType("EDGE");
+
+  Gid from_gid;
+  Gid to_gid;
+  Gid edge_gid;
+  auto created = Commit([&](auto *accessor) {
+    auto from = accessor->CreateVertex();
+    auto to = accessor->CreateVertex();
+    from_gid = from.Gid();
+    to_gid = to.Gid();
+    ASSERT_TRUE(from.AddLabel(label).HasValue());
+    ASSERT_TRUE(from.SetProperty(property, PropertyValue(1)).HasValue());
+    ASSERT_TRUE(from.SetProperty(property, PropertyValue(2)).HasValue());
+    auto edge = accessor->CreateEdge(&from, &to, edge_type);
+    ASSERT_TRUE(edge.HasValue());
+    edge_gid = edge->Gid();
+    // Created and deleted by the same transaction.
+    auto temporary = accessor->CreateVertex();
+    ASSERT_TRUE(accessor->DeleteVertex(&temporary).HasValue());
+  });
+  EXPECT_GT(created.commit_timestamp, 0);
+  ASSERT_EQ(created.created_vertices.size(), 2);
+  ASSERT_EQ(created.created_edges.size(), 1);
+  EXPECT_EQ(created.created_edges[0].gid, edge_gid);
+  EXPECT_EQ(created.created_edges[0].from_vertex, from_gid);
+  EXPECT_EQ(created.created_edges[0].to_vertex, to_gid);
+  EXPECT_EQ(created.created_edges[0].edge_type, edge_type);
+  ASSERT_EQ(created.set_labels.size(), 1);
+  EXPECT_EQ(created.set_labels[0].vertex, from_gid);
+  ASSERT_EQ(created.vertex_properties.size(), 1);
+  EXPECT_TRUE(created.vertex_properties[0].old_value.IsNull());
+  EXPECT_EQ(created.vertex_properties[0].new_value, PropertyValue(2));
+  EXPECT_TRUE(created.deleted_vertices.empty());
+
+  auto changed = Commit([&](auto *accessor) {
+    auto from = accessor->FindVertex(from_gid, View::OLD);
+    ASSERT_TRUE(from);
+    ASSERT_TRUE(from->RemoveLabel(label).HasValue());
+    // Set back to the value from before the transaction.
+    ASSERT_TRUE(from->AddLabel(other_label).HasValue());
+    ASSERT_TRUE(from->RemoveLabel(other_label).HasValue());
+    ASSERT_TRUE(from->SetProperty(property, PropertyValue(3)).HasValue());
+    auto to = accessor->FindVertex(to_gid, View::OLD);
+    ASSERT_TRUE(to);
+    ASSERT_TRUE(accessor->DetachDeleteVertex(&*to).HasValue());
+  });
+  EXPECT_GT(changed.commit_timestamp, created.commit_timestamp);
+  EXPECT_TRUE(changed.created_vertices.empty());
+  EXPECT_TRUE(changed.set_labels.empty());
+  ASSERT_EQ(changed.removed_labels.size(), 1);
+  EXPECT_EQ(changed.removed_labels[0].label, label);
+  ASSERT_EQ(changed.vertex_properties.size(), 1);
+  EXPECT_EQ(changed.vertex_properties[0].old_value, PropertyValue(2));
+  EXPECT_EQ(changed.vertex_properties[0].new_value, PropertyValue(3));
+  ASSERT_EQ(changed.deleted_edges.size(), 1);
+  EXPECT_EQ(changed.deleted_edges[0].gid, edge_gid);
+  ASSERT_EQ(changed.deleted_vertices.size(), 1);
+  EXPECT_EQ(changed.deleted_vertices[0], to_gid);
+
+  EXPECT_TRUE(Commit([](auto * /*accessor*/) {}).Empty());
+}
+
+TEST_F(CommitChangesTest, EdgeProperties) {
+  const auto property = storage_->NameToProperty("property");
+  Gid from_gid;
+  Gid edge_gid;
+  Commit([&](auto *accessor) {
+    auto from = accessor->CreateVertex();
+    auto to = accessor->CreateVertex();
+    from_gid = from.Gid();
+    auto edge = accessor->CreateEdge(&from, &to, accessor->NameToEdgeType("EDGE"));
+    ASSERT_TRUE(edge.HasValue());
+    edge_gid = edge->Gid();
+  });
+
+  auto changed = Commit([&](auto *accessor) {
+    auto from = accessor->FindVertex(from_gid, View::OLD);
+    ASSERT_TRUE(from);
+    auto edges = from->OutEdges(View::OLD);
+    ASSERT_TRUE(edges.HasValue());
+    ASSERT_EQ(edges->edges.size(), 1);
+    ASSERT_TRUE(edges->edges[0].SetProperty(property, PropertyValue("value")).HasValue());
+  });
+  ASSERT_EQ(changed.edge_properties.size(), 1);
+  EXPECT_EQ(changed.edge_properties[0].object, edge_gid);
+  EXPECT_TRUE(changed.edge_properties[0].old_value.IsNull());
+  EXPECT_EQ(changed.edge_properties[0].new_value, PropertyValue("value"));
+  EXPECT_TRUE(changed.created_edges.empty());
+}
@@ -0,0 +1,156 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
+
+class CompositeIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>();
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_a = acc->NameToProperty("a");
+    prop_b = acc->NameToProperty("b");
+    label = acc->NameToLabel("label");
+  }
+
+  std::unique_ptr<Storage> storage;
+  PropertyId prop_id;
+  PropertyId prop_a;
+  PropertyId prop_b;
+  LabelId label;
+
+  // Creates a vertex with the label and the given values of `a` and `b`, a
+  // `std::nullopt` leaves the property unset.
+  void CreateVertex(Storage::Accessor *acc, int64_t id, std::optional<int64_t> a, std::optional<int64_t> b) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(!vertex.SetProperty(prop_id, PropertyValue(id)).HasError());
+    if (a) MG_ASSERT(!vertex.SetProperty(prop_a, PropertyValue(*a)).HasError());
+    if (b) MG_ASSERT(!vertex.SetProperty(prop_b, PropertyValue(*b)).HasError());
+    MG_ASSERT(!vertex.AddLabel(label).HasError());
+  }
+
+  template <class TIterable>
+  std::vector<int64_t> GetIds(TIterable iterable, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (auto vertex : iterable) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(CompositeIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage->ListAllIndices().label_property_composite.size(), 0);
+  EXPECT_FALSE(storage->CreateIndex(label, {prop_a, prop_b}).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->LabelPropertyCompositeIndexExists(label, {prop_a, prop_b}));
+    // The order of the properties is a part of the index.
+    EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(label, {prop_b, prop_a}));
+    EXPECT_FALSE(acc->LabelPropertyIndexExists(label, prop_a));
+  }
+  EXPECT_THAT(storage->ListAllIndices().label_property_composite,
+              UnorderedElementsAre(std::make_pair(label, std::vector<PropertyId>{prop_a, prop_b})));
+  EXPECT_TRUE(storage->CreateIndex(label, {prop_a, prop_b}).HasError());
+
+  EXPECT_FALSE(storage->DropIndex(label, {prop_a, prop_b}).HasError());
+  EXPECT_TRUE(storage->DropIndex(label, {prop_a, prop_b}).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(label, {prop_a, prop_b}));
+  }
+  EXPECT_EQ(storage->ListAllIndices().label_property_composite.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(CompositeIndexTest, PrefixAndRangeLookup) {
+  {
+    auto acc = storage->Access();
+    int64_t id = 0;
+    for (int64_t a = 0; a < 3; ++a) {
+      for (int64_t b = 0; b < 3; ++b) {
+        CreateVertex(acc.get(), id++, a, b);
+      }
+    }
+    // Vertices missing one of the properties are indexed, but can't be found
+    // by a value of the missing property.
+    CreateVertex(acc.get(), id++, 1, std::nullopt);
+    CreateVertex(acc.get(), id++, std::nullopt, 1);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  EXPECT_FALSE(storage->CreateIndex(label, {prop_a, prop_b}).HasError());
+
+  auto acc = storage->Access();
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(1), PropertyValue(2)}, std::nullopt,
+                                   std::nullopt, View::OLD)),
+              ElementsAre(5));
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD)),
+              UnorderedElementsAre(9, 3, 4, 5));
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(1)},
+                                   memgraph::utils::MakeBoundExclusive(PropertyValue(0)), std::nullopt, View::OLD)),
+              ElementsAre(4, 5));
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(2)}, std::nullopt,
+                                   memgraph::utils::MakeBoundInclusive(PropertyValue(1)), View::OLD)),
+              ElementsAre(6, 7));
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(3)}, std::nullopt, std::nullopt, View::OLD)),
+              IsEmpty());
+  EXPECT_THAT(GetIds(acc->Vertices(label, {prop_a, prop_b}, {PropertyValue()}, std::nullopt, std::nullopt, View::OLD)),
+              IsEmpty());
+
+  EXPECT_EQ(acc->ApproximateVertexCount(label, {prop_a, prop_b}), 11);
+  EXPECT_EQ(acc->ApproximateVertexCount(label, {prop_a, prop_b}, {PropertyValue(1), PropertyValue(2)}), 1);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(CompositeIndexTest, UpdatesAreVisibleByView) {
+  EXPECT_FALSE(storage->CreateIndex(label, {prop_a, prop_b}).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), 0, 1, 1);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  auto lookup = [&](int64_t b, View view) {
+    return GetIds(
+        acc->Vertices(label, {prop_a, prop_b}, {PropertyValue(1), PropertyValue(b)}, std::nullopt, std::nullopt, view),
+        view);
+  };
+  for (auto vertex : acc->Vertices(View::OLD)) {
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_b, PropertyValue(2)));
+  }
+  EXPECT_THAT(lookup(1, View::OLD), ElementsAre(0));
+  EXPECT_THAT(lookup(1, View::NEW), IsEmpty());
+  EXPECT_THAT(lookup(2, View::OLD), IsEmpty());
+  EXPECT_THAT(lookup(2, View::NEW), ElementsAre(0));
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other = storage->Access();
+  EXPECT_THAT(GetIds(other->Vertices(label, {prop_a, prop_b}, {PropertyValue(1), PropertyValue(2)}, std::nullopt,
+                                     std::nullopt, View::OLD)),
+              ElementsAre(0));
+}
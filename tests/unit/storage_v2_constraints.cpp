@@ -505,6 +505,53 @@ TYPED_TEST(ConstraintsTest, UniqueConstraintsViolationOnCommit1) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(ConstraintsTest, UniqueConstraintsViolationOnBulkCommit) {
+  {
+    auto res = this->storage->CreateUniqueConstraint(this->label1, {this->prop1}, {});
+    ASSERT_TRUE(res.HasValue());
+    ASSERT_EQ(res.GetValue(), UniqueConstraints::CreationStatus::SUCCESS);
+  }
+
+  // The values of the bulk transactions are both next to and far from the
+  // committed ones.
+  auto create_vertices = [&](const std::vector<int64_t> &values) {
+    auto acc = this->storage->Access();
+    for (const auto value : values) {
+      auto vertex = acc->CreateVertex();
+      EXPECT_FALSE(vertex.AddLabel(this->label1).HasError());
+      EXPECT_FALSE(vertex.SetProperty(this->prop1, PropertyValue(value)).HasError());
+    }
+    return acc->Commit();
+  };
+  auto every_third = [](int64_t first) {
+    std::vector<int64_t> values;
+    for (int64_t i = first; i < 3000; i += 3) values.push_back(i);
+    return values;
+  };
+  ASSERT_NO_ERROR(create_vertices(every_third(0)));
+  ASSERT_NO_ERROR(create_vertices(every_third(1)));
+
+  const ConstraintViolation violation{ConstraintViolation::Type::UNIQUE, this->label1,
+                                      std::set<PropertyId>{this->prop1}};
+  {
+    // The last value was committed by the second transaction.
+    auto values = every_third(2);
+    values.push_back(1501);
+    auto res = create_vertices(values);
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(std::get<ConstraintViolation>(res.GetError()), violation);
+  }
+  {
+    // The last value duplicates one of the same transaction.
+    auto res = create_vertices({2002, 2, 1502, 2002});
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(std::get<ConstraintViolation>(res.GetError()), violation);
+  }
+
+  ASSERT_NO_ERROR(create_vertices(every_third(2)));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 /// TODO: andi consistency problems
 TYPED_TEST(ConstraintsTest, UniqueConstraintsViolationOnCommit2) {
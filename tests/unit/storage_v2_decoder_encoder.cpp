@@ -50,6 +50,8 @@ TEST_F(DecoderEncoderTest, ReadMarker) {
     memgraph::storage::durability::Encoder encoder;
     encoder.Initialize(storage_file, kTestMagic, kTestVersion);
     for (const auto &item : memgraph::storage::durability::kMarkersAll) {
+      // A raw block marker is decoded as the start of a compressed block.
+      if (item == memgraph::storage::durability::Marker::SECTION_COMPRESSED_BLOCK) continue;
       encoder.WriteMarker(item);
     }
     {
@@ -64,6 +66,7 @@ TEST_F(DecoderEncoderTest, ReadMarker) {
     ASSERT_TRUE(version);
     ASSERT_EQ(*version, kTestVersion);
     for (const auto &item : memgraph::storage::durability::kMarkersAll) {
+      if (item == memgraph::storage::durability::Marker::SECTION_COMPRESSED_BLOCK) continue;
       auto decoded = decoder.ReadMarker();
       ASSERT_TRUE(decoded);
       ASSERT_EQ(*decoded, item);
@@ -248,7 +251,9 @@ GENERATE_PARTIAL_READ_TEST(
         memgraph::storage::PropertyValue("nandare"),
         memgraph::storage::PropertyValue{
             std::map<std::string, memgraph::storage::PropertyValue>{{"haihai", memgraph::storage::PropertyValue()}}},
-        memgraph::storage::PropertyValue(memgraph::storage::TemporalData(memgraph::storage::TemporalType::Date, 23))}));
+        memgraph::storage::PropertyValue(memgraph::storage::TemporalData(memgraph::storage::TemporalType::Date, 23)),
+        memgraph::storage::PropertyValue(
+            memgraph::storage::Point(memgraph::storage::CoordinateReferenceSystem::Wgs84_2d, 15.97, 45.81))}));
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define GENERATE_PARTIAL_SKIP_TEST(name, value)                                          \
@@ -303,6 +308,63 @@ GENERATE_PARTIAL_SKIP_TEST(
             std::map<std::string, memgraph::storage::PropertyValue>{{"haihai", memgraph::storage::PropertyValue()}}},
         memgraph::storage::PropertyValue(memgraph::storage::TemporalData(memgraph::storage::TemporalType::Date, 23))}));
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompactValues) {
+  const std::vector<uint64_t> uints{0, 1, 127, 128, 16383, 16384, 123123123, std::numeric_limits<uint64_t>::max()};
+  const std::vector<std::string> strings{"hello", std::string(), std::string(100000, 'a')};
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, kTestVersion);
+    auto pos = encoder.GetPosition();
+    encoder.WriteCompactUint(1);
+    ASSERT_EQ(encoder.GetPosition(), pos + 2);
+    pos = encoder.GetPosition();
+    encoder.WriteCompactUint(std::numeric_limits<uint64_t>::max());
+    ASSERT_EQ(encoder.GetPosition(), pos + 1 + memgraph::storage::durability::kMaxVarintSize);
+    for (const auto &item : uints) {
+      encoder.WriteCompactUint(item);
+    }
+    for (const auto &item : strings) {
+      encoder.WriteCompactString(item);
+    }
+    for (const auto &item : strings) {
+      encoder.WriteCompactString(item);
+    }
+    // A varint which doesn't end.
+    encoder.WriteMarker(memgraph::storage::durability::Marker::TYPE_VARINT);
+    uint8_t invalid = 0xff;
+    encoder.Write(&invalid, sizeof(invalid));
+    encoder.Finalize();
+  }
+  {
+    memgraph::storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(storage_file, kTestMagic);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, kTestVersion);
+    ASSERT_EQ(decoder.ReadUint(), 1);
+    ASSERT_EQ(decoder.ReadUint(), std::numeric_limits<uint64_t>::max());
+    for (const auto &item : uints) {
+      auto decoded = decoder.ReadUint();
+      ASSERT_TRUE(decoded);
+      ASSERT_EQ(*decoded, item);
+    }
+    for (const auto &item : strings) {
+      auto decoded = decoder.ReadString();
+      ASSERT_TRUE(decoded);
+      ASSERT_EQ(*decoded, item);
+    }
+    ASSERT_TRUE(decoder.SkipString());
+    auto view = decoder.ReadStringView();
+    ASSERT_TRUE(view);
+    ASSERT_EQ(*view, strings[1]);
+    ASSERT_TRUE(decoder.SkipString());
+    ASSERT_FALSE(decoder.ReadUint());
+    auto pos = decoder.GetPosition();
+    ASSERT_TRUE(pos);
+    ASSERT_EQ(pos, decoder.GetSize());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
   {
@@ -325,10 +387,13 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::TYPE_LIST:
         case memgraph::storage::durability::Marker::TYPE_MAP:
         case memgraph::storage::durability::Marker::TYPE_TEMPORAL_DATA:
+        case memgraph::storage::durability::Marker::TYPE_POINT:
         case memgraph::storage::durability::Marker::TYPE_PROPERTY_VALUE:
           valid_marker = true;
           break;
 
+        case memgraph::storage::durability::Marker::TYPE_VARINT:
+        case memgraph::storage::durability::Marker::TYPE_COMPACT_STRING:
         case memgraph::storage::durability::Marker::SECTION_VERTEX:
         case memgraph::storage::durability::Marker::SECTION_EDGE:
         case memgraph::storage::durability::Marker::SECTION_MAPPER:
@@ -337,6 +402,8 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::SECTION_CONSTRAINTS:
         case memgraph::storage::durability::Marker::SECTION_DELTA:
         case memgraph::storage::durability::Marker::SECTION_EPOCH_HISTORY:
+        case memgraph::storage::durability::Marker::SECTION_DELETED_OBJECTS:
+        case memgraph::storage::durability::Marker::SECTION_COMPRESSED_BLOCK:
         case memgraph::storage::durability::Marker::SECTION_OFFSETS:
         case memgraph::storage::durability::Marker::DELTA_VERTEX_CREATE:
         case memgraph::storage::durability::Marker::DELTA_VERTEX_DELETE:
@@ -355,6 +422,18 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::DELTA_EXISTENCE_CONSTRAINT_DROP:
         case memgraph::storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_EDGE_TYPE_PROPERTY_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_TEXT_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_TEXT_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_POINT_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_POINT_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_VECTOR_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_VECTOR_INDEX_DROP:
         case memgraph::storage::durability::Marker::VALUE_FALSE:
         case memgraph::storage::durability::Marker::VALUE_TRUE:
           valid_marker = false;
@@ -459,3 +538,71 @@ TEST_F(DecoderEncoderTest, EncoderPosition) {
     ASSERT_EQ(pos, decoder.GetSize());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, CompressedBlocks) {
+  // Large enough for each batch to take several blocks.
+  const uint64_t kRecords = 3000;
+  const std::string kValue(1000, 'x');
+  uint64_t end_position = 0;
+  uint64_t second_batch_position = 0;
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, kTestVersion);
+    encoder.WriteUint(kRecords);
+    for (int batch = 0; batch < 2; ++batch) {
+      if (batch == 1) second_batch_position = encoder.GetPosition();
+      encoder.EnableCompression();
+      for (uint64_t i = 0; i < kRecords; ++i) {
+        encoder.WriteUint(i);
+        encoder.WriteString(kValue);
+        encoder.FinishRecord();
+      }
+      encoder.DisableCompression();
+    }
+    encoder.WriteBool(true);
+    end_position = encoder.GetPosition();
+    encoder.Finalize();
+  }
+  ASSERT_LT(std::filesystem::file_size(storage_file), 2 * kRecords * kValue.size() / 10);
+  {
+    memgraph::storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(storage_file, kTestMagic);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, kTestVersion);
+    auto count = decoder.ReadUint();
+    ASSERT_TRUE(count);
+    ASSERT_EQ(*count, kRecords);
+    for (int batch = 0; batch < 2; ++batch) {
+      for (uint64_t i = 0; i < kRecords; ++i) {
+        auto pos = decoder.GetPosition();
+        ASSERT_TRUE(pos);
+        ASSERT_NE(*pos, end_position);
+        auto index = decoder.ReadUint();
+        ASSERT_TRUE(index);
+        ASSERT_EQ(*index, i);
+        auto value = decoder.ReadString();
+        ASSERT_TRUE(value);
+        ASSERT_EQ(*value, kValue);
+      }
+    }
+    auto decoded = decoder.ReadBool();
+    ASSERT_TRUE(decoded);
+    ASSERT_TRUE(*decoded);
+    auto pos = decoder.GetPosition();
+    ASSERT_TRUE(pos);
+    ASSERT_EQ(pos, decoder.GetSize());
+
+    // Batches can be decoded on their own.
+    ASSERT_TRUE(decoder.SetPosition(second_batch_position));
+    for (uint64_t i = 0; i < kRecords; ++i) {
+      auto index = decoder.ReadUint();
+      ASSERT_TRUE(index);
+      ASSERT_EQ(*index, i);
+      ASSERT_TRUE(decoder.SkipString());
+    }
+    decoded = decoder.ReadBool();
+    ASSERT_TRUE(decoded);
+    ASSERT_TRUE(*decoded);
+  }
+}
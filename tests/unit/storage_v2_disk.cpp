@@ -9,6 +9,10 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include "disk_test_utils.hpp"
@@ -27,3 +31,464 @@ TEST_F(DiskStorageTest, CreateDiskStorageInDataDirectory) {
 
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
+
+TEST_F(DiskStorageTest, VertexCacheInvalidation) {
+  memgraph::storage::DiskVertexCache cache(1024 * 1024);
+  const auto gid = memgraph::storage::Gid::FromUint(1);
+  const memgraph::storage::DiskVertexCache::Entry entry{.key = "|1", .labels = {}, .properties = "props"};
+
+  // Vertices read by a transaction which doesn't see the last commit aren't cached.
+  cache.BeginInvalidation({gid});
+  cache.EndInvalidation({gid}, 10);
+  cache.Insert(gid, cache.ReadToken(gid), 5, entry);
+  ASSERT_FALSE(cache.Find(gid, 20));
+
+  cache.Insert(gid, cache.ReadToken(gid), 15, entry);
+  ASSERT_TRUE(cache.Find(gid, 20));
+  ASSERT_TRUE(cache.Find(gid, 10));
+  ASSERT_FALSE(cache.Find(gid, 9));
+
+  // Vertices read while the vertex is committed aren't cached.
+  auto token = cache.ReadToken(gid);
+  cache.BeginInvalidation({gid});
+  ASSERT_FALSE(cache.Find(gid, 20));
+  cache.Insert(gid, token, 20, entry);
+  cache.Insert(gid, cache.ReadToken(gid), 20, entry);
+  ASSERT_FALSE(cache.Find(gid, 20));
+  cache.EndInvalidation({gid}, 21);
+  cache.Insert(gid, token, 22, entry);
+  ASSERT_FALSE(cache.Find(gid, 22));
+
+  cache.Insert(gid, cache.ReadToken(gid), 22, entry);
+  ASSERT_TRUE(cache.Find(gid, 22));
+  ASSERT_FALSE(cache.Find(gid, 20));
+  ASSERT_GT(cache.SizeBytes(), 0);
+}
+
+TEST_F(DiskStorageTest, VertexCacheSharedAcrossTransactions) {
+  const std::string testSuite = "storage_v2_disk_vertex_cache";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto property = storage->NameToProperty("property");
+
+  memgraph::storage::Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_GT(storage->GetVertexCache().SizeBytes(), 0);
+
+  auto reader = storage->Access();
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(2)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_EQ(storage->GetVertexCache().SizeBytes(), 0);
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(2));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // The transaction which started before the update reads the old version.
+  auto vertex = reader->FindVertex(gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(vertex);
+  ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+  ASSERT_FALSE(reader->Commit().HasError());
+  reader.reset();
+  storage.reset();
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, VerticesAreLoadedLazily) {
+  const std::string testSuite = "storage_v2_disk_lazy_vertices";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto property = storage->NameToProperty("property");
+
+  memgraph::storage::Gid first_gid;
+  {
+    auto acc = storage->Access();
+    for (int i = 0; i < 3; ++i) {
+      auto vertex = acc->CreateVertex();
+      if (i == 0) first_gid = vertex.Gid();
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    // A vertex loaded before the scan is iterated once, with its changes.
+    auto loaded = acc->FindVertex(first_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(loaded);
+    ASSERT_FALSE(loaded->SetProperty(property, memgraph::storage::PropertyValue(1)).HasError());
+    acc->CreateVertex();
+
+    auto vertices = acc->Vertices(memgraph::storage::View::NEW);
+    auto it = vertices.begin();
+    ASSERT_NE(it, vertices.end());
+    ++it;
+    // A copy continues from the same position.
+    auto copy = it;
+    uint64_t remaining = 0;
+    for (; copy != vertices.end(); ++copy) {
+      ++remaining;
+    }
+    ASSERT_EQ(remaining, 3);
+
+    uint64_t count = 0;
+    uint64_t with_property = 0;
+    for (const auto &vertex : acc->Vertices(memgraph::storage::View::NEW)) {
+      ++count;
+      if (!vertex.GetProperty(property, memgraph::storage::View::NEW)->IsNull()) ++with_property;
+    }
+    ASSERT_EQ(count, 4);
+    ASSERT_EQ(with_property, 1);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage.reset();
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, PrefetchEdgesOfManyVertices) {
+  const std::string testSuite = "storage_v2_disk_batched_prefetch";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto edge_type = storage->NameToEdgeType("T");
+
+  // A chain of vertices, each connected to the next one.
+  std::vector<memgraph::storage::Gid> gids;
+  {
+    auto acc = storage->Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (int i = 0; i < 5; ++i) {
+      vertices.push_back(acc->CreateVertex());
+      gids.push_back(vertices.back().Gid());
+    }
+    for (size_t i = 0; i + 1 < vertices.size(); ++i) {
+      ASSERT_TRUE(acc->CreateEdge(&vertices[i], &vertices[i + 1], edge_type).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (const auto gid : gids) {
+      auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      vertices.push_back(*vertex);
+    }
+    acc->PrefetchOutEdges(vertices, {});
+    acc->PrefetchInEdges(vertices, {});
+    // Prefetching again doesn't duplicate the edges.
+    acc->PrefetchOutEdges(vertices, {});
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      ASSERT_EQ(vertices[i].OutEdges(memgraph::storage::View::OLD)->edges.size(), i + 1 < vertices.size() ? 1 : 0);
+      ASSERT_EQ(vertices[i].InEdges(memgraph::storage::View::OLD)->edges.size(), i > 0 ? 1 : 0);
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage.reset();
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, PrefetchEdgesByType) {
+  const std::string testSuite = "storage_v2_disk_prefetch_by_type";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto knows = storage->NameToEdgeType("KNOWS");
+  const auto likes = storage->NameToEdgeType("LIKES");
+
+  memgraph::storage::Gid from_gid;
+  memgraph::storage::Gid to_gid;
+  {
+    auto acc = storage->Access();
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    from_gid = from.Gid();
+    to_gid = to.Gid();
+    ASSERT_TRUE(acc->CreateEdge(&from, &to, knows).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&from, &to, likes).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&to, &from, knows).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // The adjacency entries are persisted with the edges.
+  storage.reset();
+  storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  {
+    auto acc = storage->Access();
+    auto from = acc->FindVertex(from_gid, memgraph::storage::View::OLD);
+    auto to = acc->FindVertex(to_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(from && to);
+    acc->PrefetchOutEdges({*from}, {likes});
+    ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges.size(), 1);
+    ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges[0].EdgeType(), likes);
+    acc->PrefetchOutEdges({*from}, {});
+    ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges.size(), 2);
+    acc->PrefetchInEdges({*from}, {knows});
+    ASSERT_EQ(from->InEdges(memgraph::storage::View::OLD)->edges.size(), 1);
+    ASSERT_EQ(from->InEdges(memgraph::storage::View::OLD)->edges[0].ToVertex().Gid(), from_gid);
+    ASSERT_EQ(from->InEdges(memgraph::storage::View::OLD)->edges[0].FromVertex().Gid(), to_gid);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    // Deleted edges lose their adjacency entries.
+    auto acc = storage->Access();
+    auto from = acc->FindVertex(from_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(from);
+    acc->PrefetchOutEdges({*from}, {});
+    auto edges = from->OutEdges(memgraph::storage::View::OLD)->edges;
+    ASSERT_EQ(edges.size(), 2);
+    for (auto &edge : edges) {
+      ASSERT_TRUE(acc->DeleteEdge(&edge).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto to = acc->FindVertex(to_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(to);
+    acc->PrefetchInEdges({*to}, {});
+    ASSERT_EQ(to->InEdges(memgraph::storage::View::OLD)->edges.size(), 0);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage.reset();
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, CommitLargeTransactionWithUniqueConstraint) {
+  const std::string testSuite = "storage_v2_disk_large_commit";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto label = storage->NameToLabel("L");
+  const auto property = storage->NameToProperty("p");
+  ASSERT_FALSE(storage->CreateUniqueConstraint(label, {property}, {}).HasError());
+
+  // Enough vertices for the commit to be serialized on several threads.
+  constexpr int64_t kVertexCount = 20000;
+  auto create_vertices = [&](int64_t first_value) {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < kVertexCount; ++i) {
+      auto vertex = acc->CreateVertex();
+      EXPECT_TRUE(vertex.AddLabel(label).HasValue());
+      EXPECT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(first_value + i)).HasValue());
+    }
+    return acc->Commit();
+  };
+  ASSERT_FALSE(create_vertices(0).HasError());
+  // All but the last of these vertices have values already on the disk.
+  ASSERT_TRUE(create_vertices(1).HasError());
+  {
+    auto acc = storage->Access();
+    int64_t count = 0;
+    for ([[maybe_unused]] const auto &vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, kVertexCount);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage.reset();
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, WorkloadProfiles) {
+  using WorkloadProfile = memgraph::storage::Config::DiskConfig::WorkloadProfile;
+  const std::string testSuite = "storage_v2_disk_workload_profiles";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  config.disk.block_cache_bytes = 8UL * 1024 * 1024;
+  memgraph::storage::Gid gid;
+  // The data written with one profile is readable with the others.
+  for (const auto profile : {WorkloadProfile::POINT_LOOKUPS, WorkloadProfile::SCANS, WorkloadProfile::DEFAULT}) {
+    config.disk.workload_profile = profile;
+    auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+    if (profile == WorkloadProfile::POINT_LOOKUPS) {
+      auto acc = storage->Access();
+      gid = acc->CreateVertex().Gid();
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    auto acc = storage->Access();
+    ASSERT_TRUE(acc->FindVertex(gid, memgraph::storage::View::OLD));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, CommitWithSstIngestion) {
+  const std::string testSuite = "storage_v2_disk_sst_ingestion";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  config.disk.sst_ingestion_min_objects = 10;
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto label = storage->NameToLabel("Person");
+  const auto property = storage->NameToProperty("id");
+  const auto knows = storage->NameToEdgeType("KNOWS");
+
+  std::vector<memgraph::storage::Gid> gids;
+  {
+    auto acc = storage->Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (int64_t i = 0; i < 20; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+      gids.push_back(vertex.Gid());
+      vertices.push_back(vertex);
+    }
+    for (size_t i = 1; i < vertices.size(); ++i) {
+      ASSERT_TRUE(acc->CreateEdge(&vertices[0], &vertices[i], knows).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // The ingested files are part of the database.
+  storage.reset();
+  storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 20; ++i) {
+      auto vertex = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(*vertex->HasLabel(label, memgraph::storage::View::OLD));
+      ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(i));
+    }
+    auto from = acc->FindVertex(gids[0], memgraph::storage::View::OLD);
+    acc->PrefetchOutEdges({*from}, {knows});
+    ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges.size(), 19);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    // Commits changing stored objects go through the transaction.
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(property, memgraph::storage::PropertyValue(100)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gids[1], memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(100));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage.reset();
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, ReferenceIndices) {
+  const std::string testSuite = "storage_v2_disk_reference_indices";
+
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  config.disk.reference_indices = true;
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto label = storage->NameToLabel("Person");
+  const auto property = storage->NameToProperty("id");
+
+  auto create_vertices = [&](int64_t from, int64_t to) {
+    auto acc = storage->Access();
+    for (int64_t i = from; i < to; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  // Entries are written both when the index is created and on commit.
+  create_vertices(0, 10);
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+  ASSERT_FALSE(storage->CreateIndex(label, property).HasError());
+  create_vertices(10, 20);
+
+  auto verify = [&]() {
+    auto acc = storage->Access();
+    std::vector<int64_t> ids;
+    for (auto vertex : acc->Vertices(label, memgraph::storage::View::OLD)) {
+      ASSERT_TRUE(*vertex.HasLabel(label, memgraph::storage::View::OLD));
+      ids.push_back(vertex.GetProperty(property, memgraph::storage::View::OLD)->ValueInt());
+    }
+    std::sort(ids.begin(), ids.end());
+    ASSERT_EQ(ids.size(), 20);
+    ASSERT_EQ(ids.front(), 0);
+    ASSERT_EQ(ids.back(), 19);
+
+    int64_t count = 0;
+    for (auto vertex :
+         acc->Vertices(label, property, memgraph::storage::PropertyValue(15), memgraph::storage::View::OLD)) {
+      ASSERT_EQ(vertex.GetProperty(property, memgraph::storage::View::OLD)->ValueInt(), 15);
+      ++count;
+    }
+    ASSERT_EQ(count, 1);
+
+    count = 0;
+    for ([[maybe_unused]] auto vertex :
+         acc->Vertices(label, property,
+                       memgraph::utils::MakeBoundInclusive(memgraph::storage::PropertyValue(5)),
+                       memgraph::utils::MakeBoundExclusive(memgraph::storage::PropertyValue(12)),
+                       memgraph::storage::View::OLD)) {
+      ++count;
+    }
+    ASSERT_EQ(count, 7);
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  verify();
+
+  // The existing entries are read after switching to covering entries.
+  storage.reset();
+  config.disk.reference_indices = false;
+  storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  verify();
+
+  storage.reset();
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
+
+TEST_F(DiskStorageTest, WriteStallListener) {
+  memgraph::storage::DiskWriteStallListener listener;
+  ASSERT_TRUE(listener.WaitUntilWritesAreNormal(std::chrono::milliseconds(0)));
+
+  rocksdb::WriteStallInfo info;
+  info.cf_name = "vertex";
+  info.condition.prev = rocksdb::WriteStallCondition::kNormal;
+  info.condition.cur = rocksdb::WriteStallCondition::kDelayed;
+  listener.OnStallConditionsChanged(info);
+  ASSERT_FALSE(listener.WaitUntilWritesAreNormal(std::chrono::milliseconds(10)));
+
+  info.condition.prev = rocksdb::WriteStallCondition::kDelayed;
+  info.condition.cur = rocksdb::WriteStallCondition::kStopped;
+  listener.OnStallConditionsChanged(info);
+  ASSERT_FALSE(listener.WaitUntilWritesAreNormal(std::chrono::milliseconds(10)));
+
+  // A waiting commit continues as soon as the writes are normal again.
+  std::jthread compaction([&listener, info]() mutable {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    info.condition.prev = rocksdb::WriteStallCondition::kStopped;
+    info.condition.cur = rocksdb::WriteStallCondition::kNormal;
+    listener.OnStallConditionsChanged(info);
+  });
+  ASSERT_TRUE(listener.WaitUntilWritesAreNormal(std::chrono::seconds(10)));
+}
@@ -699,6 +699,147 @@ TEST_P(DurabilityTest, SnapshotOnExit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotBackgroundIndexRecovery) {
+  // Create snapshot.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true}}));
+    CreateBaseDataset(store.get(), GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Recover snapshot and create a snapshot right away, which has to contain
+  // the indices even if they aren't created yet.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .snapshot_on_exit = true,
+                        .background_index_recovery = true}}));
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 2);
+
+  // Recover the new snapshot and wait for the indices.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory,
+                      .recover_on_startup = true,
+                      .background_index_recovery = true}}));
+  for (int i = 0; i < 1000; ++i) {
+    auto info = store->ListAllIndices();
+    if (info.label.size() == 1 && info.label_property.size() == 1) break;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  VerifyDataset(store.get(), DatasetType::ONLY_BASE, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotOnExitMultipleThreads) {
+  // Create snapshot, written in many small batches.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_on_exit = true,
+                        .items_per_batch = 13,
+                        .snapshot_thread_count = 4}}));
+    CreateBaseDataset(store.get(), GetParam());
+    CreateExtendedDataset(store.get());
+    VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_FALSE(std::filesystem::exists(storage_directory / memgraph::storage::durability::kSnapshotDirectory /
+                                       memgraph::storage::durability::kSnapshotSegmentsDirectory));
+
+  // Recover snapshot.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotIncremental) {
+  memgraph::storage::Gid kept_gid;
+  memgraph::storage::Gid deleted_gid;
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT,
+                        .snapshot_interval = std::chrono::hours(1),
+                        .snapshot_max_increments = 2}}));
+    auto *mem_store = static_cast<memgraph::storage::InMemoryStorage *>(store.get());
+    auto property = store->NameToProperty("value");
+
+    // The first snapshot is a full one.
+    CreateBaseDataset(store.get(), GetParam());
+    {
+      auto acc = store->Access();
+      auto kept = acc->CreateVertex();
+      auto deleted = acc->CreateVertex();
+      ASSERT_FALSE(kept.SetProperty(property, memgraph::storage::PropertyValue(1)).HasError());
+      ASSERT_TRUE(acc->CreateEdge(&kept, &deleted, store->NameToEdgeType("temporary")).HasValue());
+      kept_gid = kept.Gid();
+      deleted_gid = deleted.Gid();
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(mem_store->CreateSnapshot({false}).HasError());
+
+    // The second one only stores the modified and the deleted objects.
+    CreateExtendedDataset(store.get());
+    {
+      auto acc = store->Access();
+      auto kept = acc->FindVertex(kept_gid, memgraph::storage::View::OLD);
+      auto deleted = acc->FindVertex(deleted_gid, memgraph::storage::View::OLD);
+      ASSERT_TRUE(kept && deleted);
+      ASSERT_FALSE(kept->SetProperty(property, memgraph::storage::PropertyValue(2)).HasError());
+      ASSERT_TRUE(acc->DetachDeleteVertex(&*deleted).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(mem_store->CreateSnapshot({false}).HasError());
+  }
+
+  auto snapshots = GetSnapshotsList();
+  ASSERT_EQ(snapshots.size(), 2);
+  std::sort(snapshots.begin(), snapshots.end());
+  auto full_info = memgraph::storage::durability::ReadSnapshotInfo(snapshots[0]);
+  auto incremental_info = memgraph::storage::durability::ReadSnapshotInfo(snapshots[1]);
+  ASSERT_FALSE(full_info.incremental);
+  ASSERT_TRUE(incremental_info.incremental);
+  ASSERT_EQ(incremental_info.base_timestamp, full_info.start_timestamp);
+  ASSERT_EQ(incremental_info.previous_timestamp, full_info.start_timestamp);
+  ASSERT_LT(incremental_info.vertices_count, full_info.vertices_count);
+
+  // Recover the full snapshot with the incremental one applied on top of it.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  {
+    auto acc = store->Access();
+    ASSERT_FALSE(acc->FindVertex(deleted_gid, memgraph::storage::View::OLD));
+    auto kept = acc->FindVertex(kept_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(kept);
+    ASSERT_EQ(*kept->GetProperty(store->NameToProperty("value"), memgraph::storage::View::OLD),
+              memgraph::storage::PropertyValue(2));
+    auto out_edges = kept->OutEdges(memgraph::storage::View::OLD);
+    ASSERT_TRUE(out_edges.HasValue());
+    ASSERT_TRUE(out_edges->edges.empty());
+    uint64_t vertices_count = 0;
+    for ([[maybe_unused]] auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      ++vertices_count;
+    }
+    ASSERT_EQ(vertices_count, kNumBaseVertices + kNumExtendedVertices + 1);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotPeriodic) {
   // Create snapshot.
@@ -1208,6 +1349,193 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalRecoveryThreadCount) {
+  // Create WALs.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}}));
+    CreateBaseDataset(store.get(), GetParam());
+    CreateExtendedDataset(store.get());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs on a single thread and on more threads than there are
+  // vertices, with the indices created in parallel.
+  for (const uint64_t thread_count : {1, 3, 1000}) {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .items_per_batch = 13,
+                        .recovery_thread_count = thread_count,
+                        .allow_parallel_index_creation = true}}));
+    VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalRecoverToTimestamp) {
+  // Create WALs, remembering the commit timestamp of the base dataset.
+  uint64_t base_timestamp = 0;
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery}}));
+    CreateBaseDataset(store.get(), GetParam());
+    base_timestamp = store->timestamp_ - 1;
+    CreateExtendedDataset(store.get());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover to the base dataset without durability, which leaves the files as
+  // they are.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .recover_on_startup = true,
+                        .recover_to_timestamp = base_timestamp}}));
+    VerifyDataset(store.get(), DatasetType::ONLY_BASE, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Recover to the base dataset with durability, which moves the WALs with the
+  // extended dataset away and continues with a snapshot.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .recover_on_startup = true,
+             .recover_to_timestamp = base_timestamp,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20)}}));
+    VerifyDataset(store.get(), DatasetType::ONLY_BASE, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetBackupWalsList().size(), 1);
+
+  // A regular recovery continues from the snapshot.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::ONLY_BASE, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  // Create WALs, small ones so that the group commits span multiple files.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_size_kibibytes = 1,
+             .wal_group_commit = true}}));
+    CreateBaseDataset(store.get(), GetParam());
+    CreateExtendedDataset(store.get());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 2);
+
+  // Recover WALs.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalPreallocatedFilesDirectIO) {
+  // Create WALs, small ones so that multiple preallocated files are used.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_size_kibibytes = 1,
+             .wal_file_flush_every_n_tx = kFlushWalEvery,
+             .wal_preallocated_files = 2,
+             .wal_direct_io = true}}));
+    CreateBaseDataset(store.get(), GetParam());
+    CreateExtendedDataset(store.get());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 2);
+
+  // Recover WALs.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommitConcurrentTransactions) {
+  constexpr uint64_t kThreads = 8;
+  constexpr uint64_t kTransactionsPerThread = 200;
+  // Create WALs.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_size_kibibytes = 4,
+             .wal_group_commit = true}}));
+    std::vector<std::jthread> threads;
+    for (uint64_t i = 0; i < kThreads; ++i) {
+      threads.emplace_back([&store, i] {
+        const auto property = store->NameToProperty("value");
+        for (uint64_t j = 0; j < kTransactionsPerThread; ++j) {
+          auto acc = store->Access();
+          auto vertex = acc->CreateVertex();
+          MG_ASSERT(!vertex.SetProperty(property, memgraph::storage::PropertyValue(static_cast<int64_t>(i))).HasError());
+          MG_ASSERT(!acc->Commit().HasError());
+        }
+      });
+    }
+  }
+
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  auto acc = store->Access();
+  const auto property = store->NameToProperty("value");
+  std::vector<uint64_t> counts(kThreads, 0);
+  for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+    ++counts[vertex.GetProperty(property, memgraph::storage::View::OLD)->ValueInt()];
+  }
+  ASSERT_THAT(counts, ::testing::Each(kTransactionsPerThread));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -2182,6 +2510,50 @@ TEST_P(DurabilityTest, WalAndSnapshotAppendToExistingSnapshot) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalAndSnapshotCompressed) {
+  // Create compressed snapshot, written in many small batches.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {.storage_directory = storage_directory,
+                        .compression = true,
+                        .snapshot_on_exit = true,
+                        .items_per_batch = 13,
+                        .snapshot_thread_count = 2}}));
+    CreateBaseDataset(store.get(), GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetWalsList().size(), 0);
+
+  // Recover snapshot on multiple threads and create compressed WALs.
+  {
+    std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = GetParam()},
+         .durability = {
+             .storage_directory = storage_directory,
+             .recover_on_startup = true,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_interval = std::chrono::minutes(20),
+             .wal_file_flush_every_n_tx = kFlushWalEvery,
+             .compression = true,
+             .items_per_batch = 13,
+             .recovery_thread_count = 4}}));
+    VerifyDataset(store.get(), DatasetType::ONLY_BASE, GetParam());
+    CreateExtendedDataset(store.get());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover snapshot and WALs.
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = GetParam()},
+       .durability = {.storage_directory = storage_directory, .recover_on_startup = true}}));
+  VerifyDataset(store.get(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAndSnapshotAppendToExistingSnapshotAndWal) {
   // Create snapshot.
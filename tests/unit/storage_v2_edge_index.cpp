@@ -0,0 +1,228 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
+
+class EdgeIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>();
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_amount = acc->NameToProperty("amount");
+    transfer = acc->NameToEdgeType("transfer");
+    other = acc->NameToEdgeType("other");
+  }
+
+  std::unique_ptr<Storage> storage;
+  PropertyId prop_id;
+  PropertyId prop_amount;
+  EdgeTypeId transfer;
+  EdgeTypeId other;
+
+  // Creates an edge of the given type between two new vertices, a
+  // `std::nullopt` amount leaves the property unset.
+  EdgeAccessor CreateEdge(Storage::Accessor *acc, EdgeTypeId edge_type, int64_t id, std::optional<int64_t> amount) {
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    auto edge = acc->CreateEdge(&from, &to, edge_type);
+    MG_ASSERT(edge.HasValue());
+    MG_ASSERT(!edge->SetProperty(prop_id, PropertyValue(id)).HasError());
+    if (amount) MG_ASSERT(!edge->SetProperty(prop_amount, PropertyValue(*amount)).HasError());
+    return *edge;
+  }
+
+  std::vector<int64_t> GetIds(EdgesIterable iterable, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (auto edge : iterable) {
+      ret.push_back(edge.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage->ListAllIndices().edge_type.size(), 0);
+  EXPECT_FALSE(storage->CreateIndex(transfer).HasError());
+  EXPECT_FALSE(storage->CreateIndex(transfer, prop_amount).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->EdgeTypeIndexExists(transfer));
+    EXPECT_FALSE(acc->EdgeTypeIndexExists(other));
+    EXPECT_TRUE(acc->EdgeTypePropertyIndexExists(transfer, prop_amount));
+    EXPECT_FALSE(acc->EdgeTypePropertyIndexExists(transfer, prop_id));
+  }
+  EXPECT_THAT(storage->ListAllIndices().edge_type, UnorderedElementsAre(transfer));
+  EXPECT_THAT(storage->ListAllIndices().edge_type_property, UnorderedElementsAre(std::make_pair(transfer, prop_amount)));
+  EXPECT_TRUE(storage->CreateIndex(transfer).HasError());
+  EXPECT_TRUE(storage->CreateIndex(transfer, prop_amount).HasError());
+
+  EXPECT_FALSE(storage->DropIndex(transfer).HasError());
+  EXPECT_TRUE(storage->DropIndex(transfer).HasError());
+  EXPECT_FALSE(storage->DropIndex(transfer, prop_amount).HasError());
+  EXPECT_TRUE(storage->DropIndex(transfer, prop_amount).HasError());
+  EXPECT_EQ(storage->ListAllIndices().edge_type.size(), 0);
+  EXPECT_EQ(storage->ListAllIndices().edge_type_property.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, PropertyIndexNeedsPropertiesOnEdges) {
+  storage = std::make_unique<InMemoryStorage>(Config{.items = {.properties_on_edges = false}});
+  EXPECT_FALSE(storage->CreateIndex(transfer).HasError());
+  EXPECT_TRUE(storage->CreateIndex(transfer, prop_amount).HasError());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, ScanExistingAndNewEdges) {
+  {
+    auto acc = storage->Access();
+    CreateEdge(acc.get(), transfer, 0, 5);
+    CreateEdge(acc.get(), other, 1, 5);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  EXPECT_FALSE(storage->CreateIndex(transfer).HasError());
+
+  auto acc = storage->Access();
+  EXPECT_THAT(GetIds(acc->Edges(transfer, View::OLD)), UnorderedElementsAre(0));
+  CreateEdge(acc.get(), transfer, 2, std::nullopt);
+  EXPECT_THAT(GetIds(acc->Edges(transfer, View::OLD)), UnorderedElementsAre(0));
+  EXPECT_THAT(GetIds(acc->Edges(transfer, View::NEW), View::NEW), UnorderedElementsAre(0, 2));
+  EXPECT_EQ(acc->ApproximateEdgeCount(transfer), 2);
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(GetIds(other_acc->Edges(transfer, View::OLD)), UnorderedElementsAre(0, 2));
+  EXPECT_THAT(GetIds(other_acc->Edges(other, View::OLD)), IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, PropertyValueAndRangeLookup) {
+  EXPECT_FALSE(storage->CreateIndex(transfer, prop_amount).HasError());
+  {
+    auto acc = storage->Access();
+    for (int64_t id = 0; id < 10; ++id) {
+      CreateEdge(acc.get(), transfer, id, id * 1000);
+    }
+    CreateEdge(acc.get(), transfer, 10, std::nullopt);
+    CreateEdge(acc.get(), other, 11, 5000);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  EXPECT_EQ(GetIds(acc->Edges(transfer, prop_amount, View::OLD)).size(), 10);
+  EXPECT_THAT(GetIds(acc->Edges(transfer, prop_amount, PropertyValue(5000), View::OLD)), UnorderedElementsAre(5));
+  EXPECT_THAT(GetIds(acc->Edges(transfer, prop_amount, memgraph::utils::MakeBoundExclusive(PropertyValue(7000)),
+                                std::nullopt, View::OLD)),
+              UnorderedElementsAre(8, 9));
+  EXPECT_THAT(GetIds(acc->Edges(transfer, prop_amount, memgraph::utils::MakeBoundInclusive(PropertyValue(1000)),
+                                memgraph::utils::MakeBoundInclusive(PropertyValue(2000)), View::OLD)),
+              UnorderedElementsAre(1, 2));
+  EXPECT_EQ(acc->ApproximateEdgeCount(transfer, prop_amount), 10);
+  EXPECT_EQ(acc->ApproximateEdgeCount(transfer, prop_amount, PropertyValue(5000)), 1);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, SetPropertyIsVisibleByView) {
+  EXPECT_FALSE(storage->CreateIndex(transfer, prop_amount).HasError());
+  {
+    auto acc = storage->Access();
+    CreateEdge(acc.get(), transfer, 0, 1);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  auto lookup = [&](int64_t amount, View view) {
+    return GetIds(acc->Edges(transfer, prop_amount, PropertyValue(amount), view), view);
+  };
+  for (auto edge : acc->Edges(transfer, prop_amount, View::OLD)) {
+    ASSERT_NO_ERROR(edge.SetProperty(prop_amount, PropertyValue(2)));
+  }
+  EXPECT_THAT(lookup(1, View::OLD), UnorderedElementsAre(0));
+  EXPECT_THAT(lookup(1, View::NEW), IsEmpty());
+  EXPECT_THAT(lookup(2, View::OLD), IsEmpty());
+  EXPECT_THAT(lookup(2, View::NEW), UnorderedElementsAre(0));
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(GetIds(other_acc->Edges(transfer, prop_amount, PropertyValue(2), View::OLD)), UnorderedElementsAre(0));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, DeletedEdgesAreRemovedByGc) {
+  EXPECT_FALSE(storage->CreateIndex(transfer).HasError());
+  EXPECT_FALSE(storage->CreateIndex(transfer, prop_amount).HasError());
+  {
+    auto acc = storage->Access();
+    CreateEdge(acc.get(), transfer, 0, 1);
+    CreateEdge(acc.get(), transfer, 1, 1);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto acc = storage->Access();
+    for (auto edge : acc->Edges(transfer, View::OLD)) {
+      if (edge.GetProperty(prop_id, View::OLD)->ValueInt() == 0) {
+        ASSERT_NO_ERROR(acc->DeleteEdge(&edge));
+      }
+    }
+    EXPECT_THAT(GetIds(acc->Edges(transfer, View::OLD)), UnorderedElementsAre(0, 1));
+    EXPECT_THAT(GetIds(acc->Edges(transfer, View::NEW), View::NEW), UnorderedElementsAre(1));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  EXPECT_THAT(GetIds(acc->Edges(transfer, View::OLD)), UnorderedElementsAre(1));
+  EXPECT_THAT(GetIds(acc->Edges(transfer, prop_amount, PropertyValue(1), View::OLD)), UnorderedElementsAre(1));
+  EXPECT_EQ(acc->ApproximateEdgeCount(transfer), 1);
+  EXPECT_EQ(acc->ApproximateEdgeCount(transfer, prop_amount), 1);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(EdgeIndexTest, EdgeSetFromReindexesTheEdge) {
+  EXPECT_FALSE(storage->CreateIndex(transfer, prop_amount).HasError());
+  {
+    auto acc = storage->Access();
+    CreateEdge(acc.get(), transfer, 0, 1);
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  Gid new_from_gid;
+  {
+    auto acc = storage->Access();
+    auto new_from = acc->CreateVertex();
+    new_from_gid = new_from.Gid();
+    for (auto edge : acc->Edges(transfer, prop_amount, View::OLD)) {
+      ASSERT_NO_ERROR(acc->EdgeSetFrom(&edge, &new_from));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  std::vector<Gid> from_gids;
+  for (auto edge : acc->Edges(transfer, prop_amount, PropertyValue(1), View::OLD)) {
+    from_gids.push_back(edge.FromVertex().Gid());
+  }
+  EXPECT_THAT(from_gids, UnorderedElementsAre(new_from_gid));
+}
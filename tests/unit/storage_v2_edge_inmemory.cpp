@@ -3742,6 +3742,86 @@ TEST_P(StorageEdgeTest, VertexDetachDeleteMultipleCommit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, VertexDetachDeleteManyNeighbours) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.items = {.properties_on_edges = GetParam()}}));
+  constexpr int kNeighbours = 100;
+  auto et1 = store->NameToEdgeType("et1");
+  auto et2 = store->NameToEdgeType("et2");
+  auto gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::Gid> gid_neighbours;
+
+  // Create dataset
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    for (int i = 0; i < kNeighbours; ++i) {
+      auto neighbour = acc->CreateVertex();
+      gid_neighbours.push_back(neighbour.Gid());
+      ASSERT_TRUE(acc->CreateEdge(&hub, &neighbour, i % 2 == 0 ? et1 : et2).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&neighbour, &hub, i % 2 == 0 ? et2 : et1).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto check_hub = [&](auto *acc, int out_et1, int out_et2, int in_et1, int in_et2) {
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::NEW);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW, {et1})->edges.size(), out_et1);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::NEW, {et2})->edges.size(), out_et2);
+    ASSERT_EQ(hub->InEdges(memgraph::storage::View::NEW, {et1})->edges.size(), in_et1);
+    ASSERT_EQ(hub->InEdges(memgraph::storage::View::NEW, {et2})->edges.size(), in_et2);
+    ASSERT_EQ(*hub->OutDegree(memgraph::storage::View::NEW), out_et1 + out_et2);
+    ASSERT_EQ(*hub->InDegree(memgraph::storage::View::NEW), in_et1 + in_et2);
+  };
+
+  // Delete the even neighbours together with the edges from the hub to the odd
+  // neighbours divisible by three, first aborting and then committing
+  for (bool commit : {false, true}) {
+    auto acc = store->Access();
+    std::vector<memgraph::storage::VertexAccessor> neighbours;
+    std::vector<memgraph::storage::EdgeAccessor> edges;
+    for (int i = 0; i < kNeighbours; ++i) {
+      auto neighbour = acc->FindVertex(gid_neighbours[i], memgraph::storage::View::NEW);
+      ASSERT_TRUE(neighbour);
+      if (i % 2 == 0) {
+        neighbours.push_back(*neighbour);
+      } else if (i % 3 == 0) {
+        auto in_edges = neighbour->InEdges(memgraph::storage::View::NEW)->edges;
+        edges.insert(edges.end(), in_edges.begin(), in_edges.end());
+      }
+    }
+    std::vector<memgraph::storage::VertexAccessor *> neighbour_ptrs;
+    for (auto &neighbour : neighbours) neighbour_ptrs.push_back(&neighbour);
+    std::vector<memgraph::storage::EdgeAccessor *> edge_ptrs;
+    for (auto &edge : edges) edge_ptrs.push_back(&edge);
+
+    auto ret = acc->DetachDelete(std::move(neighbour_ptrs), std::move(edge_ptrs), true);
+    ASSERT_TRUE(ret.HasValue());
+    ASSERT_TRUE(*ret);
+    ASSERT_EQ((*ret)->first.size(), kNeighbours / 2);
+    ASSERT_EQ((*ret)->second.size(), kNeighbours + edges.size());
+
+    // Odd neighbours which aren't divisible by three keep their edges.
+    check_hub(acc.get(), 0, 33, 33, 0);
+
+    if (commit) {
+      ASSERT_FALSE(acc->Commit().HasError());
+    } else {
+      acc->Abort();
+      auto acc2 = store->Access();
+      check_hub(acc2.get(), kNeighbours / 2, kNeighbours / 2, kNeighbours / 2, kNeighbours / 2);
+    }
+  }
+
+  {
+    auto acc = store->Access();
+    check_hub(acc.get(), 0, 33, 33, 0);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(StorageEdgeTest, VertexDetachDeleteSingleAbort) {
   std::unique_ptr<memgraph::storage::Storage> store(
@@ -5379,6 +5459,47 @@ TEST(StorageWithoutProperties, EdgePropertyClear) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageWithPropertiesOnEdgeTypes, EdgePropertyPerEdgeType) {
+  memgraph::storage::Config config{.items = {.properties_on_edges = false}};
+  config.properties_on_edge_types = {"with"};
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage(config));
+  auto property = store->NameToProperty("property");
+  auto with = store->NameToEdgeType("with");
+  auto without = store->NameToEdgeType("without");
+  memgraph::storage::Gid gid;
+  {
+    auto acc = store->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    auto edge_with = acc->CreateEdge(&vertex, &vertex, with).GetValue();
+    auto edge_without = acc->CreateEdge(&vertex, &vertex, without).GetValue();
+    ASSERT_TRUE(edge_with.SetProperty(property, memgraph::storage::PropertyValue(42)).HasValue());
+    ASSERT_EQ(edge_without.SetProperty(property, memgraph::storage::PropertyValue(42)).GetError(),
+              memgraph::storage::Error::PROPERTIES_DISABLED);
+    ASSERT_NE(edge_with.Gid(), edge_without.Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = store->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    auto edges_with = vertex->OutEdges(memgraph::storage::View::OLD, {with}).GetValue().edges;
+    ASSERT_EQ(edges_with.size(), 1);
+    ASSERT_EQ(*edges_with[0].GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(42));
+    auto edges_without = vertex->OutEdges(memgraph::storage::View::OLD, {without}).GetValue().edges;
+    ASSERT_EQ(edges_without.size(), 1);
+    ASSERT_TRUE(edges_without[0].Properties(memgraph::storage::View::OLD)->empty());
+
+    ASSERT_TRUE(acc->DetachDeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = store->Access();
+    ASSERT_FALSE(acc->FindVertex(gid, memgraph::storage::View::OLD));
+  }
+}
+
 TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
   std::unique_ptr<memgraph::storage::Storage> store(
       new memgraph::storage::InMemoryStorage({.items = {.properties_on_edges = true}}));
@@ -5413,3 +5534,49 @@ TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
 
   ASSERT_FALSE(acc->Commit().HasError());
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageWithProperties, VertexHasEdges) {
+  std::unique_ptr<memgraph::storage::Storage> store(new memgraph::storage::InMemoryStorage());
+  memgraph::storage::Gid gid_from = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  memgraph::storage::Gid gid_to = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  auto et1 = store->NameToEdgeType("et1");
+  auto et2 = store->NameToEdgeType("et2");
+  auto et3 = store->NameToEdgeType("et3");
+  {
+    auto acc = store->Access();
+    auto vertex_from = acc->CreateVertex();
+    auto vertex_to = acc->CreateVertex();
+    gid_from = vertex_from.Gid();
+    gid_to = vertex_to.Gid();
+    ASSERT_TRUE(acc->CreateEdge(&vertex_from, &vertex_to, et1).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&vertex_from, &vertex_to, et2).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  // Without deltas the edges of the vertices are checked directly.
+  store->FreeMemory();
+
+  auto acc = store->Access();
+  auto vertex_from = acc->FindVertex(gid_from, memgraph::storage::View::OLD);
+  auto vertex_to = acc->FindVertex(gid_to, memgraph::storage::View::OLD);
+  ASSERT_TRUE(vertex_from);
+  ASSERT_TRUE(vertex_to);
+  for (auto view : {memgraph::storage::View::OLD, memgraph::storage::View::NEW}) {
+    ASSERT_TRUE(*vertex_from->HasOutEdges(view));
+    ASSERT_TRUE(*vertex_from->HasOutEdges(view, {et1}));
+    ASSERT_TRUE(*vertex_from->HasOutEdges(view, {et3, et2}));
+    ASSERT_FALSE(*vertex_from->HasOutEdges(view, {et3}));
+    ASSERT_FALSE(*vertex_from->HasInEdges(view));
+    ASSERT_TRUE(*vertex_to->HasInEdges(view, {et2}));
+    ASSERT_FALSE(*vertex_to->HasOutEdges(view));
+  }
+
+  // The deltas of the transaction are applied.
+  auto edges = vertex_from->OutEdges(memgraph::storage::View::OLD, {et1})->edges;
+  ASSERT_EQ(edges.size(), 1);
+  ASSERT_TRUE(acc->DeleteEdge(&edges[0]).HasValue());
+  ASSERT_TRUE(*vertex_from->HasOutEdges(memgraph::storage::View::OLD, {et1}));
+  ASSERT_FALSE(*vertex_from->HasOutEdges(memgraph::storage::View::NEW, {et1}));
+  ASSERT_TRUE(*vertex_from->HasOutEdges(memgraph::storage::View::NEW, {et2}));
+  ASSERT_FALSE(*vertex_to->HasInEdges(memgraph::storage::View::NEW, {et1}));
+}
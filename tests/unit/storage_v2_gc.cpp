@@ -200,3 +200,165 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Delete many vertices in separate transactions and verify that a GC which runs
+// on multiple threads in short time slices eventually removes all of them from
+// the main storage and the label index.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, ParallelSlicedCollection) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
+                 .interval = std::chrono::milliseconds(100),
+                 .thread_count = 4,
+                 .time_slice = std::chrono::milliseconds(1)}}));
+
+  const auto label = storage->NameToLabel("label");
+  ASSERT_FALSE(storage->CreateIndex(label).HasError());
+
+  std::vector<memgraph::storage::Gid> vertices;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_TRUE(*vertex.AddLabel(label));
+    vertices.push_back(vertex.Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  for (const auto gid : vertices) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(acc->DeleteVertex(&vertex.value()).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // Wait for GC. The deleted vertices are removed from the main storage one
+  // cycle after they have been removed from the index.
+  for (int i = 0; i < 50 && storage->GetInfo().vertex_count != 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+
+  EXPECT_EQ(storage->GetInfo().vertex_count, 0);
+  auto acc = storage->Access();
+  EXPECT_EQ(acc->ApproximateVertexCount(label), 0);
+}
+
+// Update a property many times while long-running transactions keep GC from
+// unlinking the deltas, and verify that the compacted chain keeps exactly the
+// versions those transactions can see.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, CompactDeltaChains) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
+                 .interval = std::chrono::milliseconds(100),
+                 .compact_delta_chains = true}}));
+
+  const auto property = storage->NameToProperty("property");
+  memgraph::storage::Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(0)).HasError());
+    gid = vertex.Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto set_property = [&](int64_t value) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(value)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  };
+  auto get_property = [&](memgraph::storage::Storage::Accessor *acc) {
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    EXPECT_TRUE(vertex.has_value());
+    return vertex->GetProperty(property, memgraph::storage::View::OLD)->ValueInt();
+  };
+
+  auto oldest_acc = storage->Access();
+  EXPECT_EQ(get_property(oldest_acc.get()), 0);
+  for (int64_t i = 1; i <= 50; ++i) {
+    set_property(i);
+  }
+  auto middle_acc = storage->Access();
+  EXPECT_EQ(get_property(middle_acc.get()), 50);
+  for (int64_t i = 51; i <= 100; ++i) {
+    set_property(i);
+  }
+
+  // Wait for GC.
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  EXPECT_EQ(get_property(oldest_acc.get()), 0);
+  EXPECT_EQ(get_property(middle_acc.get()), 50);
+  {
+    auto acc = storage->Access();
+    EXPECT_EQ(get_property(acc.get()), 100);
+  }
+
+  {
+    // Only the deltas restoring 50 for the middle and 0 for the oldest
+    // transaction are left in the chain.
+    auto vertex = oldest_acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    uint64_t chain_length = 0;
+    {
+      auto guard = std::shared_lock{vertex->vertex_->lock};
+      for (const auto *delta = vertex->vertex_->delta; delta != nullptr;
+           delta = delta->next.load(std::memory_order_acquire)) {
+        ++chain_length;
+      }
+    }
+    EXPECT_EQ(chain_length, 2);
+  }
+
+  ASSERT_FALSE(oldest_acc->Commit().HasError());
+  ASSERT_FALSE(middle_acc->Commit().HasError());
+  oldest_acc.reset();
+  middle_acc.reset();
+
+  // Wait for GC to unlink the compacted chain as well.
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  auto acc = storage->Access();
+  EXPECT_EQ(get_property(acc.get()), 100);
+}
+
+// Keep a transaction open while others commit and verify that the storage
+// info reports the transactions the GC couldn't collect because of it, its
+// age and the obsolete index entries.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, Stats) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC, .interval = std::chrono::milliseconds(50)}}));
+  ASSERT_FALSE(storage->CreateIndex(storage->NameToLabel("label")).HasError());
+
+  {
+    auto old_acc = storage->Access();
+    for (int i = 0; i < 10; ++i) {
+      auto acc = storage->Access();
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(acc->NameToLabel("label")));
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+
+    // Wait for GC.
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    auto info = storage->GetInfo();
+    EXPECT_EQ(info.uncollected_transactions, 10);
+    EXPECT_GE(info.oldest_active_transaction_age_ms, 100);
+    ASSERT_EQ(info.index_entries.size(), 1);
+    EXPECT_EQ(info.index_entries[0].first, ":label");
+    EXPECT_EQ(info.index_entries[0].second, 10);
+  }
+
+  // Wait for GC.
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+  auto info = storage->GetInfo();
+  EXPECT_EQ(info.uncollected_transactions, 0);
+  EXPECT_EQ(info.oldest_active_transaction_age_ms, 0);
+}
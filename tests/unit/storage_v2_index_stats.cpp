@@ -0,0 +1,75 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include "storage/v2/indices/label_property_index_stats.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using memgraph::utils::MakeBoundExclusive;
+using memgraph::utils::MakeBoundInclusive;
+
+namespace {
+
+std::map<PropertyValue, int64_t> UniformValues(int64_t count) {
+  std::map<PropertyValue, int64_t> values_map;
+  for (int64_t value = 0; value < count; ++value) {
+    values_map.emplace(PropertyValue(value), 1);
+  }
+  return values_map;
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PropertyValueHistogram, Empty) {
+  auto histogram = PropertyValueHistogram::Build({});
+  EXPECT_TRUE(histogram.Empty());
+  EXPECT_EQ(histogram.EstimateRangeCount(MakeBoundInclusive(PropertyValue(0)), std::nullopt), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PropertyValueHistogram, EquiDepthBuckets) {
+  auto histogram = PropertyValueHistogram::Build(UniformValues(1000), 10);
+  ASSERT_EQ(histogram.buckets.size(), 10);
+  EXPECT_TRUE(histogram.most_common_values.empty());
+  for (const auto &bucket : histogram.buckets) {
+    EXPECT_EQ(bucket.count, 100);
+  }
+  EXPECT_EQ(histogram.buckets.back().cumulative_count, 1000);
+
+  EXPECT_NEAR(histogram.EstimateRangeCount(std::nullopt, MakeBoundExclusive(PropertyValue(500))), 500, 2);
+  EXPECT_NEAR(
+      histogram.EstimateRangeCount(MakeBoundInclusive(PropertyValue(250)), MakeBoundInclusive(PropertyValue(349))), 100,
+      2);
+  // A single bound only matches the values of the same type.
+  EXPECT_DOUBLE_EQ(histogram.EstimateRangeCount(std::nullopt, MakeBoundInclusive(PropertyValue("a"))), 0);
+  EXPECT_DOUBLE_EQ(histogram.EstimateRangeCount(MakeBoundInclusive(PropertyValue(0)), std::nullopt), 1000);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PropertyValueHistogram, MostCommonValues) {
+  auto values_map = UniformValues(100);
+  values_map[PropertyValue(42)] = 5000;
+  values_map[PropertyValue(7)] = 300;
+  auto histogram = PropertyValueHistogram::Build(values_map);
+  ASSERT_EQ(histogram.most_common_values.size(), 2);
+  EXPECT_EQ(histogram.most_common_values[0], std::make_pair(PropertyValue(7), uint64_t{300}));
+  EXPECT_EQ(histogram.most_common_values[1], std::make_pair(PropertyValue(42), uint64_t{5000}));
+
+  EXPECT_DOUBLE_EQ(
+      histogram.EstimateRangeCount(MakeBoundInclusive(PropertyValue(42)), MakeBoundInclusive(PropertyValue(42))), 5000);
+  EXPECT_DOUBLE_EQ(
+      histogram.EstimateRangeCount(MakeBoundExclusive(PropertyValue(42)), MakeBoundInclusive(PropertyValue(50))), 8);
+  EXPECT_DOUBLE_EQ(histogram.EstimateRangeCount(std::nullopt, std::nullopt), 5000 + 300 + 98);
+}
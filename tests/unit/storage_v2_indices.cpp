@@ -1130,3 +1130,96 @@ TYPED_TEST(IndexTest, LabelPropertyIndexClearOldDataFromDisk) {
     ASSERT_EQ(disk_test_utils::GetRealNumberOfEntriesInRocksDB(tx_db), 1);
   }
 }
+
+TYPED_TEST(IndexTest, ParallelIndexCreationOnLiveStorage) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    auto config = this->config_;
+    config.durability.allow_parallel_index_creation = true;
+    config.durability.items_per_batch = 7;
+    config.durability.recovery_thread_count = 4;
+    this->storage = std::make_unique<TypeParam>(config);
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 100; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        if (i % 2 == 0) {
+          ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+          ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 10)));
+        }
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1).HasError());
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1, this->prop_val).HasError());
+
+    auto acc = this->storage->Access();
+    EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, View::OLD)).size(), 50);
+    EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, this->prop_val, View::OLD)).size(), 50);
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(4), View::OLD)),
+                UnorderedElementsAre(4, 14, 24, 34, 44, 54, 64, 74, 84, 94));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, PackedLabelPropertyIndex) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    auto config = this->config_;
+    config.packed_index_merge_threshold = 2;
+    this->storage = std::make_unique<TypeParam>(config);
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 5)));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    EXPECT_FALSE(this->storage->CreateIndex(this->label1, this->prop_val).HasError());
+
+    auto range = [&](Storage::Accessor *acc, int64_t lower, int64_t upper, View view) {
+      return this->GetIds(acc->Vertices(this->label1, this->prop_val,
+                                        memgraph::utils::MakeBoundInclusive(PropertyValue(lower)),
+                                        memgraph::utils::MakeBoundInclusive(PropertyValue(upper)), view),
+                          view);
+    };
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(range(acc.get(), 1, 2, View::OLD), UnorderedElementsAre(1, 2, 6, 7));
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val), 10);
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val, PropertyValue(3)), 2);
+
+      // Writes go to the skip list and are merged with the packed entries.
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(1)));
+      for (auto indexed : acc->Vertices(this->label1, this->prop_val, PropertyValue(0), View::OLD)) {
+        if (indexed.GetProperty(this->prop_id, View::OLD)->ValueInt() == 0) {
+          ASSERT_NO_ERROR(indexed.SetProperty(this->prop_val, PropertyValue(2)));
+        }
+      }
+      EXPECT_THAT(range(acc.get(), 0, 2, View::OLD), UnorderedElementsAre(0, 1, 2, 5, 6, 7));
+      EXPECT_THAT(range(acc.get(), 1, 2, View::NEW), UnorderedElementsAre(0, 1, 2, 6, 7, 10));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    this->storage->FreeMemory();
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(range(acc.get(), 0, 0, View::OLD), UnorderedElementsAre(5));
+      EXPECT_THAT(range(acc.get(), 1, 2, View::OLD), UnorderedElementsAre(0, 1, 2, 6, 7, 10));
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val), 11);
+
+      for (auto vertex : acc->Vertices(this->label1, this->prop_val, PropertyValue(4), View::OLD)) {
+        ASSERT_NO_ERROR(acc->DeleteVertex(&vertex));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    this->storage->FreeMemory();
+    {
+      auto acc = this->storage->Access();
+      EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_val, PropertyValue(4), View::OLD)), IsEmpty());
+      EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, this->prop_val, View::OLD)).size(), 9);
+      EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_val), 9);
+    }
+  }
+}
@@ -9,6 +9,10 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "storage/v2/name_id_mapper.hpp"
@@ -45,3 +49,64 @@ TEST(NameIdMapper, Correctness) {
   ASSERT_EQ(mapper.IdToName(1), "n2");
   ASSERT_EQ(mapper.IdToName(0), "n1");
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, PreferredId) {
+  memgraph::storage::NameIdMapper mapper;
+
+  ASSERT_EQ(mapper.NameToIdPreferring("n1", 3), 3);
+  ASSERT_EQ(mapper.NameToIdPreferring("n2", 5), 5);
+  ASSERT_EQ(mapper.IdToName(3), "n1");
+  ASSERT_EQ(mapper.IdToName(5), "n2");
+
+  // Already mapped names keep their ids.
+  ASSERT_EQ(mapper.NameToIdPreferring("n1", 7), 3);
+  // Ids below the last assigned one aren't reused.
+  ASSERT_EQ(mapper.NameToIdPreferring("n3", 4), 6);
+  ASSERT_EQ(mapper.NameToId("n4"), 7);
+  ASSERT_EQ(mapper.IdToName(6), "n3");
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, ManyNames) {
+  memgraph::storage::NameIdMapper mapper;
+
+  // Spans several segments of the id to name array.
+  for (uint64_t i = 0; i < 10000; ++i) {
+    ASSERT_EQ(mapper.NameToId(std::to_string(i)), i);
+  }
+  for (uint64_t i = 0; i < 10000; ++i) {
+    ASSERT_EQ(mapper.IdToName(i), std::to_string(i));
+  }
+  ASSERT_DEATH(mapper.IdToName(10000), "");
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, Concurrent) {
+  memgraph::storage::NameIdMapper mapper;
+  constexpr uint64_t kNames = 1000;
+  constexpr size_t kThreads = 8;
+
+  std::vector<std::vector<uint64_t>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      for (uint64_t i = 0; i < kNames; ++i) {
+        // Each thread goes through the names in a different order.
+        const auto name = std::to_string((i * (t + 1)) % kNames);
+        const auto id = mapper.NameToId(name);
+        ASSERT_EQ(mapper.IdToName(id), name);
+        ids[t].push_back(id);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+
+  // Every name got a single id and no id was wasted.
+  for (uint64_t i = 0; i < kNames; ++i) {
+    const auto id = mapper.NameToId(std::to_string(i));
+    ASSERT_LT(id, kNames);
+    ASSERT_EQ(mapper.IdToName(id), std::to_string(i));
+  }
+  ASSERT_EQ(mapper.NameToId("new"), kNames);
+}
@@ -0,0 +1,266 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/indices/point_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/point.hpp"
+#include "storage/v2/property_value.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
+
+constexpr auto kCartesian = CoordinateReferenceSystem::Cartesian2d;
+constexpr auto kWgs84 = CoordinateReferenceSystem::Wgs84_2d;
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PointTest, Distance) {
+  EXPECT_DOUBLE_EQ(*Distance(Point(kCartesian, 0, 0), Point(kCartesian, 3, 4)), 5.0);
+  EXPECT_DOUBLE_EQ(*Distance(Point(CoordinateReferenceSystem::Cartesian3d, 0, 0, 0),
+                             Point(CoordinateReferenceSystem::Cartesian3d, 1, 2, 2)),
+                   3.0);
+  EXPECT_FALSE(Distance(Point(kCartesian, 0, 0), Point(kWgs84, 0, 0)));
+  // A degree of latitude is about 111 km.
+  EXPECT_NEAR(*Distance(Point(kWgs84, 0, 0), Point(kWgs84, 0, 1)), 111'300.0, 500.0);
+  // Longitudes are closer together near the poles.
+  EXPECT_LT(*Distance(Point(kWgs84, 0, 80), Point(kWgs84, 1, 80)), *Distance(Point(kWgs84, 0, 0), Point(kWgs84, 1, 0)));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PointIndexKeyTest, OrdersLikeCoordinates) {
+  EXPECT_LT(PointIndexKey(-1, 0), PointIndexKey(1, 0));
+  EXPECT_LT(PointIndexKey(0, -1), PointIndexKey(0, 1));
+  EXPECT_EQ(PointIndexKey(-0.0, 0), PointIndexKey(0.0, 0));
+  EXPECT_TRUE(PointIndexKeyInBox(PointIndexKey(0.5, -0.5), PointIndexKey(-1, -1), PointIndexKey(1, 1)));
+  EXPECT_FALSE(PointIndexKeyInBox(PointIndexKey(2, 0), PointIndexKey(-1, -1), PointIndexKey(1, 1)));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PointIndexKeyTest, NextKeyInBoxMatchesBruteForce) {
+  // Small keys only use the low bits, but the bits are interleaved the same.
+  for (uint64_t min_key = 0; min_key < 64; ++min_key) {
+    for (uint64_t max_key = min_key; max_key < 64; ++max_key) {
+      if (!PointIndexKeyInBox(max_key, min_key, max_key)) continue;
+      for (uint64_t key = min_key; key <= max_key; ++key) {
+        if (PointIndexKeyInBox(key, min_key, max_key)) continue;
+        std::optional<uint64_t> expected;
+        for (uint64_t next = key + 1; next <= max_key; ++next) {
+          if (PointIndexKeyInBox(next, min_key, max_key)) {
+            expected = next;
+            break;
+          }
+        }
+        ASSERT_EQ(PointIndexNextKeyInBox(key, min_key, max_key), expected) << key << " " << min_key << " " << max_key;
+      }
+    }
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PointRegionTest, Contains) {
+  const auto circle = PointRegion::WithinDistance(Point(kCartesian, 0, 0), 1.0, true);
+  EXPECT_TRUE(circle.Contains(Point(kCartesian, 1, 0)));
+  EXPECT_FALSE(circle.Contains(Point(kCartesian, 1, 1)));
+  EXPECT_FALSE(circle.Contains(Point(kWgs84, 0, 0)));
+  EXPECT_FALSE(PointRegion::WithinDistance(Point(kCartesian, 0, 0), 1.0, false).Contains(Point(kCartesian, 1, 0)));
+
+  const auto box = PointRegion::WithinBox(Point(kCartesian, 0, 0), Point(kCartesian, 2, 1));
+  EXPECT_TRUE(box.Contains(Point(kCartesian, 2, 1)));
+  EXPECT_FALSE(box.Contains(Point(kCartesian, 1, 2)));
+}
+
+class PointIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>();
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_location = acc->NameToProperty("location");
+    label = acc->NameToLabel("label");
+    other = acc->NameToLabel("other");
+  }
+
+  std::unique_ptr<Storage> storage;
+  PropertyId prop_id;
+  PropertyId prop_location;
+  LabelId label;
+  LabelId other;
+
+  void CreateVertex(Storage::Accessor *acc, LabelId vertex_label, int64_t id, PropertyValue location) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(!vertex.AddLabel(vertex_label).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_id, PropertyValue(id)).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_location, std::move(location)).HasError());
+  }
+
+  std::vector<int64_t> GetIds(VerticesIterable iterable, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (auto vertex : iterable) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+
+  std::vector<int64_t> Lookup(Storage::Accessor *acc, const PointRegion &region, View view = View::OLD) {
+    return GetIds(acc->Vertices(label, prop_location, region, view), view);
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage->ListAllIndices().point.size(), 0);
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->PointIndexExists(label, prop_location));
+    EXPECT_FALSE(acc->PointIndexExists(label, prop_id));
+    EXPECT_FALSE(acc->PointIndexExists(other, prop_location));
+  }
+  EXPECT_THAT(storage->ListAllIndices().point, UnorderedElementsAre(std::make_pair(label, prop_location)));
+  EXPECT_TRUE(storage->CreatePointIndex(label, prop_location).HasError());
+
+  EXPECT_FALSE(storage->DropPointIndex(label, prop_location).HasError());
+  EXPECT_TRUE(storage->DropPointIndex(label, prop_location).HasError());
+  EXPECT_EQ(storage->ListAllIndices().point.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, LookupExistingAndNewVertices) {
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue(Point(kCartesian, 0, 0)));
+    CreateVertex(acc.get(), label, 1, PropertyValue(Point(kCartesian, 3, 4)));
+    CreateVertex(acc.get(), label, 2, PropertyValue(Point(kCartesian, -10, 2)));
+    CreateVertex(acc.get(), label, 3, PropertyValue(Point(kWgs84, 0, 0)));
+    CreateVertex(acc.get(), label, 4, PropertyValue(42));
+    CreateVertex(acc.get(), other, 5, PropertyValue(Point(kCartesian, 0, 0)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+
+  auto acc = storage->Access();
+  const auto origin = Point(kCartesian, 0, 0);
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(origin, 5.0, true)), UnorderedElementsAre(0, 1));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(origin, 5.0, false)), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(origin, 100.0, true)), UnorderedElementsAre(0, 1, 2));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinBox(Point(kCartesian, -10, 0), Point(kCartesian, 0, 2))),
+              UnorderedElementsAre(0, 2));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(Point(kWgs84, 0.001, 0), 1'000.0, true)),
+              UnorderedElementsAre(3));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinBox(Point(kCartesian, 1, 1), Point(kCartesian, 0, 0))), IsEmpty());
+
+  CreateVertex(acc.get(), label, 6, PropertyValue(Point(kCartesian, 1, 1)));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(origin, 2.0, true)), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(origin, 2.0, true), View::NEW),
+              UnorderedElementsAre(0, 6));
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Lookup(other_acc.get(), PointRegion::WithinDistance(origin, 2.0, true)), UnorderedElementsAre(0, 6));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, RegionsAroundTheAntimeridianAndPoles) {
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue(Point(kWgs84, 179.999, 0)));
+    CreateVertex(acc.get(), label, 1, PropertyValue(Point(kWgs84, -179.999, 0)));
+    CreateVertex(acc.get(), label, 2, PropertyValue(Point(kWgs84, 90, 89.999)));
+    CreateVertex(acc.get(), label, 3, PropertyValue(Point(kWgs84, -90, 89.999)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(Point(kWgs84, 180, 0), 1'000.0, true)),
+              UnorderedElementsAre(0, 1));
+  EXPECT_THAT(Lookup(acc.get(), PointRegion::WithinDistance(Point(kWgs84, 0, 90), 1'000.0, true)),
+              UnorderedElementsAre(2, 3));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, SetPropertyIsVisibleByView) {
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue(Point(kCartesian, 0, 0)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  const auto near_origin = PointRegion::WithinDistance(Point(kCartesian, 0, 0), 1.0, true);
+  const auto far_away = PointRegion::WithinDistance(Point(kCartesian, 100, 100), 1.0, true);
+  auto acc = storage->Access();
+  for (auto vertex : acc->Vertices(label, prop_location, near_origin, View::OLD)) {
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_location, PropertyValue(Point(kCartesian, 100, 100))));
+  }
+  EXPECT_THAT(Lookup(acc.get(), near_origin, View::OLD), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), near_origin, View::NEW), IsEmpty());
+  EXPECT_THAT(Lookup(acc.get(), far_away, View::OLD), IsEmpty());
+  EXPECT_THAT(Lookup(acc.get(), far_away, View::NEW), UnorderedElementsAre(0));
+  ASSERT_NO_ERROR(acc->Commit());
+  storage->FreeMemory();
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Lookup(other_acc.get(), near_origin), IsEmpty());
+  EXPECT_THAT(Lookup(other_acc.get(), far_away), UnorderedElementsAre(0));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, ApproximateCountOfRegion) {
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+  {
+    auto acc = storage->Access();
+    for (int64_t id = 0; id < 10; ++id) {
+      CreateVertex(acc.get(), label, id, PropertyValue(Point(kCartesian, static_cast<double>(id * 100), 0)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  const auto everything = PointRegion::WithinBox(Point(kCartesian, -1, -1), Point(kCartesian, 1'000, 1));
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_location, everything), 10);
+  const auto nothing = PointRegion::WithinBox(Point(kCartesian, -20, -20), Point(kCartesian, -10, -10));
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_location, nothing), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(PointIndexTest, DeletedVerticesAreRemovedByGc) {
+  EXPECT_FALSE(storage->CreatePointIndex(label, prop_location).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue(Point(kCartesian, 0, 0)));
+    CreateVertex(acc.get(), label, 1, PropertyValue(Point(kCartesian, 0, 0)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  const auto near_origin = PointRegion::WithinDistance(Point(kCartesian, 0, 0), 1.0, true);
+  {
+    auto acc = storage->Access();
+    for (auto vertex : acc->Vertices(label, prop_location, near_origin, View::OLD)) {
+      if (vertex.GetProperty(prop_id, View::OLD)->ValueInt() == 0) {
+        ASSERT_NO_ERROR(acc->DeleteVertex(&vertex));
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Lookup(acc.get(), near_origin), UnorderedElementsAre(1));
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_location, near_origin), 1);
+}
@@ -13,9 +13,12 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <map>
+#include <random>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/property_string_dictionary.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/temporal.hpp"
 
@@ -727,3 +730,140 @@ TEST(PropertyStore, HasAnyProperties) {
   EXPECT_FALSE(store.HasAllPropertyValues({memgraph::storage::PropertyValue(0.0), memgraph::storage::PropertyValue(123),
                                            memgraph::storage::PropertyValue("three")}));
 }
+
+TEST(PropertyStore, WideRecord) {
+  // Enough properties for the store to keep a directory of their positions.
+  const uint64_t kNumProperties = 80;
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> property_dist(0, kNumProperties * 2 - 1);
+  std::uniform_int_distribution<uint64_t> value_dist(0, std::size(kSampleValues) - 1);
+
+  memgraph::storage::PropertyStore store;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  for (int i = 0; i < 5000; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(property_dist(gen));
+    const auto &value = kSampleValues[value_dist(gen)];
+    bool existed = expected.contains(prop);
+    ASSERT_EQ(store.SetProperty(prop, value), !existed);
+    if (value.IsNull()) {
+      expected.erase(prop);
+    } else {
+      expected[prop] = value;
+    }
+    if (i % 100 == 0) {
+      ASSERT_EQ(store.Properties(), expected);
+    }
+  }
+  ASSERT_EQ(store.Properties(), expected);
+  for (uint64_t i = 0; i < kNumProperties * 2; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    auto it = expected.find(prop);
+    if (it == expected.end()) {
+      ASSERT_FALSE(store.HasProperty(prop));
+      ASSERT_TRUE(store.GetProperty(prop).IsNull());
+      ASSERT_TRUE(store.IsPropertyEqual(prop, memgraph::storage::PropertyValue()));
+    } else {
+      ASSERT_TRUE(store.HasProperty(prop));
+      ASSERT_EQ(store.GetProperty(prop), it->second);
+      TestIsPropertyEqual(store, prop, it->second);
+    }
+  }
+
+  // Remove all of the properties so that the store goes back to the layout
+  // without the directory.
+  for (const auto &[prop, value] : expected) {
+    ASSERT_FALSE(store.SetProperty(prop, memgraph::storage::PropertyValue()));
+    ASSERT_FALSE(store.HasProperty(prop));
+  }
+  ASSERT_EQ(store.Properties().size(), 0);
+  ASSERT_FALSE(store.ClearProperties());
+}
+
+TEST(PropertyStore, WideRecordInitAndBuffer) {
+  std::vector<std::pair<memgraph::storage::PropertyId, memgraph::storage::PropertyValue>> data;
+  for (uint64_t i = 0; i < 64; ++i) {
+    data.emplace_back(memgraph::storage::PropertyId::FromUint(i * 3), kSampleValues[i % std::size(kSampleValues)]);
+  }
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  for (const auto &[prop, value] : data) {
+    if (!value.IsNull()) expected.emplace(prop, value);
+  }
+
+  memgraph::storage::PropertyStore store;
+  ASSERT_TRUE(store.InitProperties(data));
+  ASSERT_EQ(store.Properties(), expected);
+  for (const auto &[prop, value] : expected) {
+    ASSERT_EQ(store.GetProperty(prop), value);
+    ASSERT_FALSE(store.HasProperty(memgraph::storage::PropertyId::FromUint(prop.AsUint() + 1)));
+  }
+
+  auto restored = memgraph::storage::PropertyStore::CreateFromBuffer(store.StringBuffer());
+  ASSERT_EQ(restored.Properties(), expected);
+  for (const auto &[prop, value] : expected) {
+    TestIsPropertyEqual(restored, prop, value);
+  }
+}
+
+TEST(PropertyStore, DictionaryEncodedStrings) {
+  auto encoded_prop = memgraph::storage::PropertyId::FromInt(42);
+  auto plain_prop = memgraph::storage::PropertyId::FromInt(43);
+  const memgraph::storage::DictionaryEncodedProperties dictionary_encoded_properties{encoded_prop};
+  auto &dictionary = memgraph::storage::GetPropertyStringDictionary();
+  const memgraph::storage::PropertyValue value(std::string(404, 'n'));
+
+  auto dictionary_size = dictionary.size();
+  memgraph::storage::PropertyStore encoded_store;
+  ASSERT_TRUE(encoded_store.SetProperty(encoded_prop, value, &dictionary_encoded_properties));
+  ASSERT_EQ(dictionary.size(), dictionary_size + 1);
+  memgraph::storage::PropertyStore other_encoded_store;
+  const std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> properties{{encoded_prop, value}};
+  ASSERT_TRUE(other_encoded_store.InitProperties(properties, &dictionary_encoded_properties));
+  ASSERT_EQ(dictionary.size(), dictionary_size + 1);
+  memgraph::storage::PropertyStore plain_store;
+  ASSERT_TRUE(plain_store.SetProperty(plain_prop, value, &dictionary_encoded_properties));
+  ASSERT_EQ(dictionary.size(), dictionary_size + 1);
+
+  // Only the code of the value is stored, so it fits into the local buffer.
+  ASSERT_EQ(encoded_store.StringBuffer(), other_encoded_store.StringBuffer());
+  ASSERT_LT(encoded_store.StringBuffer().size(), plain_store.StringBuffer().size());
+
+  ASSERT_EQ(encoded_store.GetProperty(encoded_prop), value);
+  ASSERT_TRUE(encoded_store.HasProperty(encoded_prop));
+  TestIsPropertyEqual(encoded_store, encoded_prop, value);
+  ASSERT_THAT(encoded_store.Properties(), UnorderedElementsAre(std::pair(encoded_prop, value)));
+
+  // Short strings are always stored in full.
+  ASSERT_FALSE(encoded_store.SetProperty(encoded_prop, memgraph::storage::PropertyValue("ab"),
+                                         &dictionary_encoded_properties));
+  ASSERT_EQ(dictionary.size(), dictionary_size + 1);
+  ASSERT_EQ(encoded_store.GetProperty(encoded_prop), memgraph::storage::PropertyValue("ab"));
+
+  // Setting the value without the dictionary stores it in full.
+  ASSERT_FALSE(encoded_store.SetProperty(encoded_prop, value));
+  ASSERT_EQ(encoded_store.StringBuffer().size(), plain_store.StringBuffer().size());
+  ASSERT_EQ(encoded_store.GetProperty(encoded_prop), value);
+}
+
+TEST(PropertyStore, DictionaryEncodedStringsWideRecord) {
+  memgraph::storage::DictionaryEncodedProperties dictionary_encoded_properties;
+  std::map<memgraph::storage::PropertyId, memgraph::storage::PropertyValue> expected;
+  for (uint64_t i = 0; i < 64; ++i) {
+    auto prop = memgraph::storage::PropertyId::FromUint(i);
+    if (i % 2 == 0) dictionary_encoded_properties.insert(prop);
+    expected.emplace(prop, memgraph::storage::PropertyValue("category " + std::to_string(i % 5)));
+  }
+
+  memgraph::storage::PropertyStore store;
+  for (const auto &[prop, value] : expected) {
+    ASSERT_TRUE(store.SetProperty(prop, value, &dictionary_encoded_properties));
+  }
+  ASSERT_EQ(store.Properties(), expected);
+  for (const auto &[prop, value] : expected) {
+    ASSERT_EQ(store.GetProperty(prop), value);
+    TestIsPropertyEqual(store, prop, value);
+  }
+
+  auto copy = expected;
+  store.UpdateProperties(copy, &dictionary_encoded_properties);
+  ASSERT_EQ(store.Properties(), expected);
+}
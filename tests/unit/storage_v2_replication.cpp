@@ -18,6 +18,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <storage/v2/durability/paths.hpp>
 #include <storage/v2/inmemory/storage.hpp>
 #include <storage/v2/property_value.hpp>
 #include <storage/v2/replication/enums.hpp>
@@ -372,6 +373,54 @@ TEST_F(ReplicationTest, MultipleSynchronousReplicationTest) {
   }
 }
 
+TEST_F(ReplicationTest, SynchronousReplicationQuorumTest) {
+  auto main_config = configuration;
+  main_config.durability.replication_sync_quorum = 1;
+  std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(main_config)};
+  auto *main_mem_store = static_cast<memgraph::storage::InMemoryStorage *>(main_store.get());
+
+  std::unique_ptr<memgraph::storage::Storage> replica_store1{new memgraph::storage::InMemoryStorage(configuration)};
+  static_cast<memgraph::storage::InMemoryStorage *>(replica_store1.get())
+      ->SetReplicaRole(memgraph::io::network::Endpoint{local_host, ports[0]},
+                       memgraph::storage::replication::ReplicationServerConfig{});
+
+  std::unique_ptr<memgraph::storage::Storage> replica_store2{new memgraph::storage::InMemoryStorage(configuration)};
+  static_cast<memgraph::storage::InMemoryStorage *>(replica_store2.get())
+      ->SetReplicaRole(memgraph::io::network::Endpoint{local_host, ports[1]},
+                       memgraph::storage::replication::ReplicationServerConfig{});
+
+  for (size_t i = 0; i < replicas.size(); ++i) {
+    ASSERT_FALSE(main_mem_store
+                     ->RegisterReplica(replicas[i], memgraph::io::network::Endpoint{local_host, ports[i]},
+                                       memgraph::storage::replication::ReplicationMode::SYNC,
+                                       memgraph::storage::replication::RegistrationMode::MUST_BE_INSTANTLY_VALID,
+                                       memgraph::storage::replication::ReplicationClientConfig{})
+                     .HasError());
+  }
+
+  // One of the two SYNC replicas is enough.
+  replica_store2.reset();
+  std::optional<memgraph::storage::Gid> vertex_gid;
+  {
+    auto acc = main_store->Access();
+    vertex_gid.emplace(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = replica_store1->Access();
+    ASSERT_TRUE(acc->FindVertex(*vertex_gid, memgraph::storage::View::OLD));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // Without any replica the quorum isn't reached.
+  replica_store1.reset();
+  {
+    auto acc = main_store->Access();
+    acc->CreateVertex();
+    ASSERT_TRUE(acc->Commit().HasError());
+  }
+}
+
 TEST_F(ReplicationTest, RecoveryProcess) {
   std::vector<memgraph::storage::Gid> vertex_gids;
   // Force the creation of snapshot
@@ -517,6 +566,130 @@ TEST_F(ReplicationTest, RecoveryProcess) {
   }
 }
 
+TEST_F(ReplicationTest, RecoveryFromState) {
+  static constexpr const auto *vertex_label = "vertex_label";
+  static constexpr const auto *property_name = "property_name";
+  static constexpr const auto *edge_type = "edge_type";
+  std::vector<memgraph::storage::Gid> vertex_gids;
+  std::optional<memgraph::storage::Gid> edge_gid;
+  {
+    std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(
+        {.items = {.properties_on_edges = true},
+         .durability = {
+             .storage_directory = storage_directory,
+             .recover_on_startup = true,
+             .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+             .snapshot_on_exit = true,
+         }})};
+    {
+      auto acc = main_store->Access();
+      for (int i = 0; i < 2; ++i) {
+        auto v = acc->CreateVertex();
+        ASSERT_TRUE(v.AddLabel(main_store->NameToLabel(vertex_label)).HasValue());
+        ASSERT_TRUE(v.SetProperty(main_store->NameToProperty(property_name), memgraph::storage::PropertyValue(i))
+                        .HasValue());
+        vertex_gids.emplace_back(v.Gid());
+      }
+      auto from = acc->FindVertex(vertex_gids[0], memgraph::storage::View::NEW);
+      auto to = acc->FindVertex(vertex_gids[1], memgraph::storage::View::NEW);
+      auto edge = acc->CreateEdge(&*from, &*to, main_store->NameToEdgeType(edge_type));
+      ASSERT_TRUE(edge.HasValue());
+      ASSERT_TRUE(
+          edge->SetProperty(main_store->NameToProperty(property_name), memgraph::storage::PropertyValue(2)).HasValue());
+      edge_gid.emplace(edge->Gid());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    ASSERT_FALSE(main_store->CreateIndex(main_store->NameToLabel(vertex_label)).HasError());
+  }
+
+  // Without the WAL files the data is only in the snapshot, so the replica
+  // receives the state of main.
+  std::filesystem::remove_all(storage_directory / memgraph::storage::durability::kWalDirectory);
+
+  std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = true},
+       .durability = {
+           .storage_directory = storage_directory,
+           .recover_on_startup = true,
+           .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+       }})};
+  auto *main_mem_store = static_cast<memgraph::storage::InMemoryStorage *>(main_store.get());
+  // The current WAL starts after the recovered data.
+  {
+    auto acc = main_store->Access();
+    vertex_gids.emplace_back(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  std::filesystem::path replica_storage_directory{std::filesystem::temp_directory_path() /
+                                                  "MG_test_unit_storage_v2_replication_replica"};
+  memgraph::utils::OnScopeExit replica_directory_cleaner(
+      [&]() { std::filesystem::remove_all(replica_storage_directory); });
+
+  std::unique_ptr<memgraph::storage::Storage> replica_store{new memgraph::storage::InMemoryStorage(
+      {.items = {.properties_on_edges = true},
+       .durability = {.storage_directory = replica_storage_directory,
+                      .snapshot_wal_mode =
+                          memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL}})};
+  static_cast<memgraph::storage::InMemoryStorage *>(replica_store.get())
+      ->SetReplicaRole(memgraph::io::network::Endpoint{local_host, ports[0]},
+                       memgraph::storage::replication::ReplicationServerConfig{});
+
+  ASSERT_FALSE(main_mem_store
+                   ->RegisterReplica(replicas[0], memgraph::io::network::Endpoint{local_host, ports[0]},
+                                     memgraph::storage::replication::ReplicationMode::SYNC,
+                                     memgraph::storage::replication::RegistrationMode::MUST_BE_INSTANTLY_VALID,
+                                     memgraph::storage::replication::ReplicationClientConfig{})
+                   .HasError());
+
+  while (main_mem_store->GetReplicaState(replicas[0]) != memgraph::storage::replication::ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  {
+    auto acc = replica_store->Access();
+    for (int i = 0; i < 2; ++i) {
+      auto v = acc->FindVertex(vertex_gids[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(v);
+      const auto labels = v->Labels(memgraph::storage::View::OLD);
+      ASSERT_TRUE(labels.HasValue());
+      ASSERT_THAT(*labels, UnorderedElementsAre(replica_store->NameToLabel(vertex_label)));
+      const auto properties = v->Properties(memgraph::storage::View::OLD);
+      ASSERT_TRUE(properties.HasValue());
+      ASSERT_THAT(*properties, UnorderedElementsAre(std::make_pair(replica_store->NameToProperty(property_name),
+                                                                   memgraph::storage::PropertyValue(i))));
+    }
+    ASSERT_TRUE(acc->FindVertex(vertex_gids[2], memgraph::storage::View::OLD));
+    auto from = acc->FindVertex(vertex_gids[0], memgraph::storage::View::OLD);
+    const auto out_edges = from->OutEdges(memgraph::storage::View::OLD);
+    ASSERT_TRUE(out_edges.HasValue());
+    ASSERT_EQ(out_edges->edges.size(), 1);
+    const auto &edge = out_edges->edges[0];
+    ASSERT_EQ(edge.Gid(), *edge_gid);
+    ASSERT_EQ(edge.EdgeType(), replica_store->NameToEdgeType(edge_type));
+    ASSERT_EQ(edge.ToVertex().Gid(), vertex_gids[1]);
+    const auto properties = edge.Properties(memgraph::storage::View::OLD);
+    ASSERT_TRUE(properties.HasValue());
+    ASSERT_THAT(*properties, UnorderedElementsAre(std::make_pair(replica_store->NameToProperty(property_name),
+                                                                 memgraph::storage::PropertyValue(2))));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ASSERT_THAT(replica_store->ListAllIndices().label, UnorderedElementsAre(replica_store->NameToLabel(vertex_label)));
+
+  // The replica continues from the state it received.
+  std::optional<memgraph::storage::Gid> vertex_gid;
+  {
+    auto acc = main_store->Access();
+    vertex_gid.emplace(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = replica_store->Access();
+    ASSERT_TRUE(acc->FindVertex(*vertex_gid, memgraph::storage::View::OLD));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+}
+
 TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
   std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(configuration)};
   auto *main_mem_store = static_cast<memgraph::storage::InMemoryStorage *>(main_store.get());
@@ -536,7 +709,9 @@ TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
                                      memgraph::storage::replication::ReplicationClientConfig{})
                    .HasError());
 
-  static constexpr size_t vertices_create_num = 10;
+  // Transactions committed while the previous ones are still being sent are
+  // queued and sent in batches, so the replica doesn't fall behind.
+  static constexpr size_t vertices_create_num = 1000;
   std::vector<memgraph::storage::Gid> created_vertices;
   for (size_t i = 0; i < vertices_create_num; ++i) {
     auto acc = main_store->Access();
@@ -544,18 +719,13 @@ TEST_F(ReplicationTest, BasicAsynchronousReplicationTest) {
     created_vertices.push_back(v.Gid());
     ASSERT_FALSE(acc->Commit().HasError());
 
-    if (i == 0) {
-      ASSERT_EQ(main_mem_store->GetReplicaState("REPLICA_ASYNC"),
-                memgraph::storage::replication::ReplicaState::REPLICATING);
-    } else {
-      ASSERT_EQ(main_mem_store->GetReplicaState("REPLICA_ASYNC"),
-                memgraph::storage::replication::ReplicaState::RECOVERY);
-    }
+    ASSERT_EQ(main_mem_store->GetReplicaState("REPLICA_ASYNC"), memgraph::storage::replication::ReplicaState::READY);
   }
 
-  while (main_mem_store->GetReplicaState("REPLICA_ASYNC") != memgraph::storage::replication::ReplicaState::READY) {
+  while (main_mem_store->ReplicasInfo()[0].timestamp_info.current_number_of_timestamp_behind_master != 0) {
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
   }
+  ASSERT_EQ(main_mem_store->GetReplicaState("REPLICA_ASYNC"), memgraph::storage::replication::ReplicaState::READY);
 
   ASSERT_TRUE(std::all_of(created_vertices.begin(), created_vertices.end(), [&](const auto vertex_gid) {
     auto acc = replica_store_async->Access();
@@ -724,6 +894,42 @@ TEST_F(ReplicationTest, ReplicationInformation) {
   ASSERT_EQ(second_info.state, memgraph::storage::replication::ReplicaState::READY);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(ReplicationTest, ReplicationMetrics) {
+  std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(configuration)};
+  std::unique_ptr<memgraph::storage::Storage> replica_store{new memgraph::storage::InMemoryStorage(configuration)};
+  auto *main_mem_store = static_cast<memgraph::storage::InMemoryStorage *>(main_store.get());
+  auto *replica_mem_store = static_cast<memgraph::storage::InMemoryStorage *>(replica_store.get());
+
+  replica_mem_store->SetReplicaRole(memgraph::io::network::Endpoint{local_host, ports[0]},
+                                    memgraph::storage::replication::ReplicationServerConfig{});
+  ASSERT_FALSE(main_mem_store
+                   ->RegisterReplica(replicas[0], memgraph::io::network::Endpoint{local_host, ports[0]},
+                                     memgraph::storage::replication::ReplicationMode::SYNC,
+                                     memgraph::storage::replication::RegistrationMode::MUST_BE_INSTANTLY_VALID,
+                                     memgraph::storage::replication::ReplicationClientConfig{})
+                   .HasError());
+
+  const auto sent_bytes_before = main_mem_store->ReplicasMetrics()[0].sent_bytes;
+  const auto kTransactions = 10;
+  for (int i = 0; i < kTransactions; ++i) {
+    auto acc = main_store->Access();
+    auto v = acc->CreateVertex();
+    ASSERT_TRUE(v.SetProperty(main_store->NameToProperty("prop"), memgraph::storage::PropertyValue(i)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  const auto metrics = main_mem_store->ReplicasMetrics();
+  ASSERT_EQ(metrics.size(), 1);
+  const auto &replica_metrics = metrics[0];
+  ASSERT_EQ(replica_metrics.name, replicas[0]);
+  ASSERT_EQ(replica_metrics.commit_timestamp_lag, 0);
+  ASSERT_GT(replica_metrics.sent_bytes, sent_bytes_before);
+  ASSERT_EQ(replica_metrics.in_flight_transactions, 0);
+  ASSERT_FALSE(replica_metrics.append_latency_percentiles.empty());
+  ASSERT_EQ(replica_metrics.recovery_steps_done, replica_metrics.recovery_steps_total);
+}
+
 TEST_F(ReplicationTest, ReplicationReplicaWithExistingName) {
   std::unique_ptr<memgraph::storage::Storage> main_store{new memgraph::storage::InMemoryStorage(configuration)};
   std::unique_ptr<memgraph::storage::Storage> replica_store1{new memgraph::storage::InMemoryStorage(configuration)};
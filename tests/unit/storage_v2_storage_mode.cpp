@@ -66,6 +66,83 @@ TEST_P(StorageModeTest, Mode) {
 INSTANTIATE_TEST_CASE_P(ParameterizedStorageModeTests, StorageModeTest, ::testing::ValuesIn(storage_modes),
                         StorageModeTest::PrintStringParamToName());
 
+// analytics mode reads the vertices as they are, even if the transactional
+// mode left deltas on them
+TEST(StorageModeReadTest, AnalyticalReadsAfterTransactionalChanges) {
+  std::unique_ptr<memgraph::storage::Storage> storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+  auto label = storage->NameToLabel("label");
+  auto property = storage->NameToProperty("property");
+  auto edge_type = storage->NameToEdgeType("edge_type");
+  auto other_edge_type = storage->NameToEdgeType("other_edge_type");
+
+  memgraph::storage::Gid from_gid;
+  memgraph::storage::Gid to_gid;
+  {
+    auto acc = storage->Access();
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    auto deleted = acc->CreateVertex();
+    from_gid = from.Gid();
+    to_gid = to.Gid();
+    ASSERT_TRUE(from.AddLabel(label).HasValue());
+    ASSERT_TRUE(from.SetProperty(property, memgraph::storage::PropertyValue(1)).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&from, &to, edge_type).HasValue());
+    ASSERT_TRUE(acc->DeleteVertex(&deleted).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+  auto reader = storage->Access();
+  {
+    auto writer = storage->Access();
+    auto from = writer->FindVertex(from_gid, memgraph::storage::View::OLD);
+    auto to = writer->FindVertex(to_gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(from && to);
+    ASSERT_TRUE(writer->CreateEdge(&*from, &*to, other_edge_type).HasValue());
+    ASSERT_FALSE(writer->Commit().HasError());
+  }
+
+  ASSERT_EQ(CountVertices(*reader, memgraph::storage::View::OLD), 2);
+  auto from = reader->FindVertex(from_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(from);
+  ASSERT_TRUE(*from->HasLabel(label, memgraph::storage::View::OLD));
+  ASSERT_EQ(*from->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+  ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges.size(), 2);
+  ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD, {edge_type})->edges.size(), 1);
+  auto to = reader->FindVertex(to_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(to);
+  auto in_edges = to->InEdges(memgraph::storage::View::OLD, {other_edge_type}, &*from);
+  ASSERT_TRUE(in_edges.HasValue());
+  ASSERT_EQ(in_edges->edges.size(), 1);
+  ASSERT_EQ(in_edges->edges[0].FromVertex(), *from);
+  ASSERT_EQ(in_edges->edges[0].EdgeType(), other_edge_type);
+}
+
+TEST(StorageModeReadTest, FreeMemoryCompactsAnalyticalAdjacency) {
+  std::unique_ptr<memgraph::storage::Storage> storage = std::make_unique<memgraph::storage::InMemoryStorage>();
+  storage->SetStorageMode(memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL);
+  auto edge_type = storage->NameToEdgeType("edge_type");
+
+  memgraph::storage::Gid from_gid;
+  {
+    auto acc = storage->Access();
+    auto from = acc->CreateVertex();
+    from_gid = from.Gid();
+    for (int i = 0; i < 5; ++i) {
+      auto to = acc->CreateVertex();
+      ASSERT_TRUE(acc->CreateEdge(&from, &to, edge_type).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  storage->FreeMemory();
+  auto acc = storage->Access();
+  auto from = acc->FindVertex(from_gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(from);
+  EXPECT_EQ(from->vertex_->out_edges.capacity(), 5);
+  ASSERT_EQ(from->OutEdges(memgraph::storage::View::OLD)->edges.size(), 5);
+}
+
 class StorageModeMultiTxTest : public ::testing::Test {
  protected:
   std::filesystem::path data_directory{std::filesystem::temp_directory_path() / "MG_tests_unit_storage_mode"};
@@ -0,0 +1,223 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(TextIndexTermsTest, Trigrams) {
+  EXPECT_THAT(TextIndexTerms("ab"), IsEmpty());
+  EXPECT_THAT(TextIndexTerms("abc"), ElementsAre("abc"));
+  EXPECT_THAT(TextIndexTerms("MemGraph"), ElementsAre("aph", "emg", "gra", "mem", "mgr", "rap"));
+  EXPECT_THAT(TextIndexTerms("aaaa"), ElementsAre("aaa"));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(TextIndexTermsTest, Matches) {
+  EXPECT_TRUE(TextMatches("memgraph", TextMatch::STARTS_WITH, "mem"));
+  EXPECT_FALSE(TextMatches("memgraph", TextMatch::STARTS_WITH, "Mem"));
+  EXPECT_TRUE(TextMatches("memgraph", TextMatch::ENDS_WITH, "graph"));
+  EXPECT_FALSE(TextMatches("memgraph", TextMatch::ENDS_WITH, "mem"));
+  EXPECT_TRUE(TextMatches("memgraph", TextMatch::CONTAINS, "mgr"));
+  EXPECT_TRUE(TextMatches("memgraph", TextMatch::CONTAINS, ""));
+}
+
+class TextIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>();
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_name = acc->NameToProperty("name");
+    label = acc->NameToLabel("label");
+    other = acc->NameToLabel("other");
+  }
+
+  std::unique_ptr<Storage> storage;
+  PropertyId prop_id;
+  PropertyId prop_name;
+  LabelId label;
+  LabelId other;
+
+  void CreateVertex(Storage::Accessor *acc, LabelId vertex_label, int64_t id, PropertyValue name) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(!vertex.AddLabel(vertex_label).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_id, PropertyValue(id)).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_name, std::move(name)).HasError());
+  }
+
+  std::vector<int64_t> GetIds(VerticesIterable iterable, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (auto vertex : iterable) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+
+  std::vector<int64_t> Lookup(Storage::Accessor *acc, TextMatch match, const std::string &pattern,
+                              View view = View::OLD) {
+    return GetIds(acc->Vertices(label, prop_name, match, pattern, view), view);
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage->ListAllIndices().text.size(), 0);
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->TextIndexExists(label, prop_name));
+    EXPECT_FALSE(acc->TextIndexExists(label, prop_id));
+    EXPECT_FALSE(acc->TextIndexExists(other, prop_name));
+  }
+  EXPECT_THAT(storage->ListAllIndices().text, UnorderedElementsAre(std::make_pair(label, prop_name)));
+  EXPECT_TRUE(storage->CreateTextIndex(label, prop_name).HasError());
+
+  EXPECT_FALSE(storage->DropTextIndex(label, prop_name).HasError());
+  EXPECT_TRUE(storage->DropTextIndex(label, prop_name).HasError());
+  EXPECT_EQ(storage->ListAllIndices().text.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, LookupExistingAndNewVertices) {
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue("memgraph"));
+    CreateVertex(acc.get(), label, 1, PropertyValue("graph database"));
+    CreateVertex(acc.get(), label, 2, PropertyValue(42));
+    CreateVertex(acc.get(), other, 3, PropertyValue("memgraph"));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::STARTS_WITH, "mem"), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::STARTS_WITH, "graph"), UnorderedElementsAre(1));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::ENDS_WITH, "graph"), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "graph"), UnorderedElementsAre(0, 1));
+  // Matching is case sensitive even though the terms aren't.
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "GRAPH"), IsEmpty());
+  // Patterns shorter than a term check every string in the index.
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "a"), UnorderedElementsAre(0, 1));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::STARTS_WITH, ""), UnorderedElementsAre(0, 1));
+
+  CreateVertex(acc.get(), label, 4, PropertyValue("graphs"));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::STARTS_WITH, "graph"), UnorderedElementsAre(1));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::STARTS_WITH, "graph", View::NEW), UnorderedElementsAre(1, 4));
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Lookup(other_acc.get(), TextMatch::STARTS_WITH, "graph"), UnorderedElementsAre(1, 4));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, SetPropertyIsVisibleByView) {
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue("memgraph"));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  for (auto vertex : acc->Vertices(label, prop_name, TextMatch::CONTAINS, "mem", View::OLD)) {
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_name, PropertyValue("neo")));
+  }
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "mem", View::OLD), UnorderedElementsAre(0));
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "mem", View::NEW), IsEmpty());
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "neo", View::OLD), IsEmpty());
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "neo", View::NEW), UnorderedElementsAre(0));
+  ASSERT_NO_ERROR(acc->Commit());
+  storage->FreeMemory();
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Lookup(other_acc.get(), TextMatch::CONTAINS, "mem"), IsEmpty());
+  EXPECT_THAT(Lookup(other_acc.get(), TextMatch::CONTAINS, "neo"), UnorderedElementsAre(0));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, ApproximateCountUsesTheRarestTerm) {
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+  {
+    auto acc = storage->Access();
+    for (int64_t id = 0; id < 10; ++id) {
+      CreateVertex(acc.get(), label, id, PropertyValue(id == 0 ? "memgraph" : "graph"));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_name, TextMatch::CONTAINS, "graph"), 10);
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_name, TextMatch::CONTAINS, "memgraph"), 1);
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_name, TextMatch::CONTAINS, ""), 10);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, SearchOrdersBySimilarity) {
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue("graph"));
+    CreateVertex(acc.get(), label, 1, PropertyValue("graph database"));
+    CreateVertex(acc.get(), label, 2, PropertyValue("relational database"));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  auto results = acc->TextSearch(label, prop_name, "Graph", 10, View::OLD);
+  ASSERT_EQ(results.size(), 2);
+  EXPECT_EQ(results[0].first.GetProperty(prop_id, View::OLD)->ValueInt(), 0);
+  EXPECT_DOUBLE_EQ(results[0].second, 1.0);
+  EXPECT_EQ(results[1].first.GetProperty(prop_id, View::OLD)->ValueInt(), 1);
+  EXPECT_LT(results[1].second, 1.0);
+
+  EXPECT_EQ(acc->TextSearch(label, prop_name, "graph", 1, View::OLD).size(), 1);
+  EXPECT_THAT(acc->TextSearch(label, prop_name, "xyz", 10, View::OLD), IsEmpty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(TextIndexTest, DeletedVerticesAreRemovedByGc) {
+  EXPECT_FALSE(storage->CreateTextIndex(label, prop_name).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, PropertyValue("memgraph"));
+    CreateVertex(acc.get(), label, 1, PropertyValue("memgraph"));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto acc = storage->Access();
+    for (auto vertex : acc->Vertices(label, prop_name, TextMatch::CONTAINS, "mem", View::OLD)) {
+      if (vertex.GetProperty(prop_id, View::OLD)->ValueInt() == 0) {
+        ASSERT_NO_ERROR(acc->DeleteVertex(&vertex));
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Lookup(acc.get(), TextMatch::CONTAINS, "mem"), UnorderedElementsAre(1));
+  EXPECT_EQ(acc->ApproximateVertexCount(label, prop_name, TextMatch::CONTAINS, "mem"), 1);
+}
@@ -0,0 +1,286 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/indices/vector_index.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/property_value.hpp"
+
+// NOLINTNEXTLINE(google-build-using-namespace)
+using namespace memgraph::storage;
+
+using testing::ElementsAre;
+using testing::IsEmpty;
+using testing::UnorderedElementsAre;
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
+
+namespace {
+
+PropertyValue ToPropertyValue(const std::vector<float> &vector) {
+  std::vector<PropertyValue> list;
+  list.reserve(vector.size());
+  for (const auto value : vector) {
+    list.emplace_back(static_cast<double>(value));
+  }
+  return PropertyValue(std::move(list));
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VectorDistanceTest, Kernels) {
+  const std::vector<float> a{0, 0, 0};
+  const std::vector<float> b{1, 2, 2};
+  EXPECT_FLOAT_EQ(L2SquaredDistance(a.data(), b.data(), 3), 9.0F);
+  EXPECT_DOUBLE_EQ(VectorDistance(VectorMetric::L2, a.data(), b.data(), 3), 3.0);
+  // The zero vector has no direction.
+  EXPECT_FLOAT_EQ(CosineDistance(a.data(), b.data(), 3), 1.0F);
+
+  const std::vector<float> x{1, 0};
+  const std::vector<float> y{0, 1};
+  const std::vector<float> scaled_x{10, 0};
+  EXPECT_FLOAT_EQ(CosineDistance(x.data(), y.data(), 2), 1.0F);
+  EXPECT_NEAR(CosineDistance(x.data(), scaled_x.data(), 2), 0.0F, 1e-6);
+
+  // Dimensions which aren't a multiple of the unrolled loop have a tail.
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> uniform(-1, 1);
+  for (const size_t dimension : {1, 15, 16, 17, 100}) {
+    std::vector<float> u(dimension);
+    std::vector<float> v(dimension);
+    std::generate(u.begin(), u.end(), [&] { return uniform(gen); });
+    std::generate(v.begin(), v.end(), [&] { return uniform(gen); });
+    double l2 = 0;
+    double dot = 0;
+    double norm_u = 0;
+    double norm_v = 0;
+    for (size_t i = 0; i < dimension; ++i) {
+      l2 += (u[i] - v[i]) * (u[i] - v[i]);
+      dot += u[i] * v[i];
+      norm_u += u[i] * u[i];
+      norm_v += v[i] * v[i];
+    }
+    EXPECT_NEAR(L2SquaredDistance(u.data(), v.data(), dimension), l2, 1e-4) << dimension;
+    EXPECT_NEAR(CosineDistance(u.data(), v.data(), dimension), 1 - dot / std::sqrt(norm_u * norm_v), 1e-4)
+        << dimension;
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VectorDistanceTest, PropertyValueToVector) {
+  EXPECT_THAT(*PropertyValueToVector(PropertyValue(std::vector<PropertyValue>{PropertyValue(1), PropertyValue(2.5)})),
+              ElementsAre(1.0F, 2.5F));
+  EXPECT_FALSE(PropertyValueToVector(PropertyValue(std::vector<PropertyValue>{})));
+  EXPECT_FALSE(PropertyValueToVector(PropertyValue(std::vector<PropertyValue>{PropertyValue(1), PropertyValue("a")})));
+  EXPECT_FALSE(PropertyValueToVector(PropertyValue(1.0)));
+
+  EXPECT_EQ(StringToVectorMetric("L2"), VectorMetric::L2);
+  EXPECT_EQ(StringToVectorMetric("cos"), VectorMetric::COSINE);
+  EXPECT_FALSE(StringToVectorMetric("dot"));
+}
+
+class VectorIndexTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>();
+    auto acc = storage->Access();
+    prop_id = acc->NameToProperty("id");
+    prop_embedding = acc->NameToProperty("embedding");
+    label = acc->NameToLabel("label");
+    other = acc->NameToLabel("other");
+  }
+
+  std::unique_ptr<Storage> storage;
+  PropertyId prop_id;
+  PropertyId prop_embedding;
+  LabelId label;
+  LabelId other;
+
+  void CreateVertex(Storage::Accessor *acc, LabelId vertex_label, int64_t id, PropertyValue embedding) {
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(!vertex.AddLabel(vertex_label).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_id, PropertyValue(id)).HasError());
+    MG_ASSERT(!vertex.SetProperty(prop_embedding, std::move(embedding)).HasError());
+  }
+
+  std::vector<int64_t> Search(Storage::Accessor *acc, const std::vector<float> &query, uint64_t limit,
+                              VectorMetric metric = VectorMetric::L2, View view = View::OLD) {
+    std::vector<int64_t> ret;
+    for (const auto &[vertex, distance] : acc->VectorSearch(label, prop_embedding, query, limit, metric, view)) {
+      ret.push_back(vertex.GetProperty(prop_id, view)->ValueInt());
+    }
+    return ret;
+  }
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VectorIndexTest, CreateAndDrop) {
+  EXPECT_EQ(storage->ListAllIndices().vector.size(), 0);
+  EXPECT_FALSE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+  {
+    auto acc = storage->Access();
+    EXPECT_TRUE(acc->VectorIndexExists(label, prop_embedding));
+    EXPECT_FALSE(acc->VectorIndexExists(label, prop_id));
+    EXPECT_FALSE(acc->VectorIndexExists(other, prop_embedding));
+  }
+  EXPECT_THAT(storage->ListAllIndices().vector, UnorderedElementsAre(std::make_pair(label, prop_embedding)));
+  EXPECT_TRUE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+
+  EXPECT_FALSE(storage->DropVectorIndex(label, prop_embedding).HasError());
+  EXPECT_TRUE(storage->DropVectorIndex(label, prop_embedding).HasError());
+  EXPECT_EQ(storage->ListAllIndices().vector.size(), 0);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VectorIndexTest, SearchExistingAndNewVertices) {
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, ToPropertyValue({0, 0}));
+    CreateVertex(acc.get(), label, 1, ToPropertyValue({1, 0}));
+    CreateVertex(acc.get(), label, 2, ToPropertyValue({10, 1}));
+    CreateVertex(acc.get(), label, 3, ToPropertyValue({-1, 1}));
+    // Values which aren't vectors of the dimension of the index aren't in it.
+    CreateVertex(acc.get(), label, 4, ToPropertyValue({1, 0, 0}));
+    CreateVertex(acc.get(), label, 5, PropertyValue("not a vector"));
+    CreateVertex(acc.get(), other, 6, ToPropertyValue({1, 0}));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  EXPECT_FALSE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 10), ElementsAre(1, 0, 3, 2));
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 2), ElementsAre(1, 0));
+  // The zero vector has no direction, so it's farther by the cosine distance.
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 10, VectorMetric::COSINE), ElementsAre(1, 2, 0, 3));
+  EXPECT_THAT(Search(acc.get(), {1, 0, 0}, 10), IsEmpty());
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 0), IsEmpty());
+
+  const auto results = acc->VectorSearch(label, prop_embedding, {4, 4}, 1, VectorMetric::L2, View::OLD);
+  ASSERT_EQ(results.size(), 1);
+  EXPECT_DOUBLE_EQ(results[0].second, 5.0);
+
+  CreateVertex(acc.get(), label, 7, ToPropertyValue({1, 0.1}));
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 2), ElementsAre(1, 0));
+  EXPECT_THAT(Search(acc.get(), {1, 0}, 2, VectorMetric::L2, View::NEW), ElementsAre(1, 7));
+  ASSERT_NO_ERROR(acc->Commit());
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Search(other_acc.get(), {1, 0}, 2), ElementsAre(1, 7));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VectorIndexTest, SearchHasHighRecall) {
+  constexpr size_t kDimension = 24;
+  constexpr int64_t kVertices = 2'000;
+  constexpr uint64_t kLimit = 10;
+  std::mt19937 gen(7);
+  std::normal_distribution<float> normal;
+  const auto random_vector = [&] {
+    std::vector<float> vector(kDimension);
+    std::generate(vector.begin(), vector.end(), [&] { return normal(gen); });
+    return vector;
+  };
+
+  EXPECT_FALSE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+  std::vector<std::vector<float>> vectors;
+  {
+    auto acc = storage->Access();
+    for (int64_t id = 0; id < kVertices; ++id) {
+      vectors.push_back(random_vector());
+      CreateVertex(acc.get(), label, id, ToPropertyValue(vectors.back()));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  size_t found = 0;
+  constexpr size_t kQueries = 50;
+  for (size_t i = 0; i < kQueries; ++i) {
+    const auto query = random_vector();
+    std::vector<std::pair<float, int64_t>> exact;
+    for (int64_t id = 0; id < kVertices; ++id) {
+      exact.emplace_back(L2SquaredDistance(query.data(), vectors[id].data(), kDimension), id);
+    }
+    std::partial_sort(exact.begin(), exact.begin() + kLimit, exact.end());
+    const auto approximate = Search(acc.get(), query, kLimit);
+    ASSERT_EQ(approximate.size(), kLimit);
+    for (size_t j = 0; j < kLimit; ++j) {
+      found += std::count(approximate.begin(), approximate.end(), exact[j].second);
+    }
+  }
+  EXPECT_GE(static_cast<double>(found) / (kQueries * kLimit), 0.9);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VectorIndexTest, SetPropertyIsVisibleByView) {
+  EXPECT_FALSE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+  {
+    auto acc = storage->Access();
+    CreateVertex(acc.get(), label, 0, ToPropertyValue({0, 0}));
+    CreateVertex(acc.get(), label, 1, ToPropertyValue({5, 5}));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = storage->Access();
+  for (auto &[vertex, distance] : acc->VectorSearch(label, prop_embedding, {0, 0}, 1, VectorMetric::L2, View::OLD)) {
+    ASSERT_NO_ERROR(vertex.SetProperty(prop_embedding, ToPropertyValue({10, 10})));
+  }
+  EXPECT_THAT(Search(acc.get(), {0, 0}, 1, VectorMetric::L2, View::OLD), ElementsAre(0));
+  EXPECT_THAT(Search(acc.get(), {0, 0}, 1, VectorMetric::L2, View::NEW), ElementsAre(1));
+  EXPECT_THAT(Search(acc.get(), {0, 0}, 2, VectorMetric::L2, View::NEW), ElementsAre(1, 0));
+  ASSERT_NO_ERROR(acc->Commit());
+  storage->FreeMemory();
+
+  auto other_acc = storage->Access();
+  EXPECT_THAT(Search(other_acc.get(), {0, 0}, 2), ElementsAre(1, 0));
+  EXPECT_THAT(Search(other_acc.get(), {10, 10}, 1), ElementsAre(0));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VectorIndexTest, ObsoleteValuesAreRemovedByGc) {
+  constexpr int64_t kVertices = 100;
+  EXPECT_FALSE(storage->CreateVectorIndex(label, prop_embedding).HasError());
+  {
+    auto acc = storage->Access();
+    for (int64_t id = 0; id < kVertices; ++id) {
+      CreateVertex(acc.get(), label, id, ToPropertyValue({static_cast<float>(id), 0}));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  // Moving most of the vertices twice leaves more removed nodes than live ones,
+  // which makes the graph rebuild.
+  for (const auto y : {500.0F, 1'000.0F}) {
+    auto acc = storage->Access();
+    for (auto vertex : acc->Vertices(label, View::OLD)) {
+      const auto id = vertex.GetProperty(prop_id, View::OLD)->ValueInt();
+      if (id == 0) {
+        ASSERT_NO_ERROR(acc->DeleteVertex(&vertex));
+      } else if (id % 4 != 0) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop_embedding, ToPropertyValue({static_cast<float>(id), y})));
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+    storage->FreeMemory();
+  }
+
+  auto acc = storage->Access();
+  EXPECT_THAT(Search(acc.get(), {0, 0}, 3), ElementsAre(4, 8, 12));
+  EXPECT_THAT(Search(acc.get(), {1, 1'000}, 3), ElementsAre(1, 2, 3));
+  EXPECT_EQ(Search(acc.get(), {0, 0}, kVertices).size(), kVertices - 1);
+}
@@ -0,0 +1,119 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "storage/v2/vertex_edges.hpp"
+
+using memgraph::storage::EdgeRef;
+using memgraph::storage::EdgeTypeId;
+using memgraph::storage::Gid;
+using memgraph::storage::VertexEdge;
+using memgraph::storage::VertexEdges;
+
+namespace {
+VertexEdge MakeEdge(uint64_t edge_type, uint64_t gid) {
+  return {EdgeTypeId::FromUint(edge_type), nullptr, EdgeRef(Gid::FromUint(gid))};
+}
+
+bool IsGroupedByType(const VertexEdges &edges) {
+  return std::is_sorted(edges.begin(), edges.end(),
+                        [](const auto &a, const auto &b) { return std::get<0>(a) < std::get<0>(b); });
+}
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexEdges, AddKeepsRunsContiguous) {
+  VertexEdges edges;
+  memgraph::storage::AddVertexEdge(edges, MakeEdge(2, 0));
+  memgraph::storage::AddVertexEdge(edges, MakeEdge(0, 1));
+  memgraph::storage::AddVertexEdge(edges, MakeEdge(1, 2));
+  memgraph::storage::AddVertexEdge(edges, MakeEdge(0, 3));
+  memgraph::storage::AddVertexEdge(edges, MakeEdge(2, 4));
+  ASSERT_EQ(edges.size(), 5);
+  ASSERT_TRUE(IsGroupedByType(edges));
+
+  auto [begin, end] = memgraph::storage::VertexEdgesOfType(edges, EdgeTypeId::FromUint(0));
+  ASSERT_EQ(std::distance(begin, end), 2);
+  std::tie(begin, end) = memgraph::storage::VertexEdgesOfType(edges, EdgeTypeId::FromUint(1));
+  ASSERT_EQ(std::distance(begin, end), 1);
+  ASSERT_EQ(std::get<2>(*begin).gid.AsUint(), 2);
+  std::tie(begin, end) = memgraph::storage::VertexEdgesOfType(edges, EdgeTypeId::FromUint(3));
+  ASSERT_EQ(begin, end);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexEdges, FindAndRemove) {
+  VertexEdges edges;
+  for (uint64_t i = 0; i < 12; ++i) {
+    memgraph::storage::AddVertexEdge(edges, MakeEdge(i % 4, i));
+  }
+
+  auto it = memgraph::storage::FindVertexEdge(edges, MakeEdge(1, 5));
+  ASSERT_NE(it, edges.end());
+  memgraph::storage::RemoveVertexEdge(edges, it);
+  ASSERT_EQ(edges.size(), 11);
+  ASSERT_TRUE(IsGroupedByType(edges));
+  ASSERT_EQ(memgraph::storage::FindVertexEdge(edges, MakeEdge(1, 5)), edges.end());
+  // The edge type has to match as well.
+  ASSERT_EQ(memgraph::storage::FindVertexEdge(edges, MakeEdge(2, 4)), edges.end());
+
+  for (uint64_t i = 0; i < 12; ++i) {
+    if (i == 5) continue;
+    auto it = memgraph::storage::FindVertexEdge(edges, MakeEdge(i % 4, i));
+    ASSERT_NE(it, edges.end());
+    memgraph::storage::RemoveVertexEdge(edges, it);
+    ASSERT_TRUE(IsGroupedByType(edges));
+  }
+  ASSERT_TRUE(edges.empty());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexEdges, RandomOperations) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint64_t> type_dist(0, 19);
+  VertexEdges edges;
+  std::vector<VertexEdge> expected;
+  uint64_t next_gid = 0;
+
+  for (int i = 0; i < 5000; ++i) {
+    if (expected.empty() || gen() % 3 != 0) {
+      auto edge = MakeEdge(type_dist(gen), next_gid++);
+      memgraph::storage::AddVertexEdge(edges, edge);
+      expected.push_back(edge);
+    } else {
+      auto pos = gen() % expected.size();
+      auto it = memgraph::storage::FindVertexEdge(edges, expected[pos]);
+      ASSERT_NE(it, edges.end());
+      memgraph::storage::RemoveVertexEdge(edges, it);
+      expected.erase(expected.begin() + static_cast<int64_t>(pos));
+    }
+    ASSERT_EQ(edges.size(), expected.size());
+  }
+  ASSERT_TRUE(IsGroupedByType(edges));
+  for (const auto &edge : expected) {
+    ASSERT_NE(memgraph::storage::FindVertexEdge(edges, edge), edges.end());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexEdges, SortKeepsOrderInsideRun) {
+  VertexEdges edges{MakeEdge(1, 0), MakeEdge(0, 1), MakeEdge(1, 2), MakeEdge(0, 3)};
+  memgraph::storage::SortVertexEdges(edges);
+  ASSERT_TRUE(IsGroupedByType(edges));
+  ASSERT_EQ(std::get<2>(edges[0]).gid.AsUint(), 1);
+  ASSERT_EQ(std::get<2>(edges[1]).gid.AsUint(), 3);
+  ASSERT_EQ(std::get<2>(edges[2]).gid.AsUint(), 0);
+  ASSERT_EQ(std::get<2>(edges[3]).gid.AsUint(), 2);
+}
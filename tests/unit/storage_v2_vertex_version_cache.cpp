@@ -0,0 +1,131 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <deque>
+
+#include "storage/v2/delta.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_version_cache.hpp"
+
+using memgraph::storage::CachedVertexVersion;
+using memgraph::storage::Delta;
+using memgraph::storage::Vertex;
+using memgraph::storage::VertexVersionCache;
+
+namespace {
+CachedVertexVersion MakeVersion(int64_t value) {
+  CachedVertexVersion version;
+  version.properties.emplace(memgraph::storage::PropertyId::FromUint(0), memgraph::storage::PropertyValue(value));
+  return version;
+}
+}  // namespace
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexVersionCache, TimestampRangeAndHead) {
+  VertexVersionCache cache(16);
+  auto *vertex = reinterpret_cast<Vertex const *>(0x1000);
+  std::atomic<uint64_t> timestamp{10};
+  Delta head(Delta::DeleteObjectTag{}, &timestamp, 0);
+  Delta other_head(Delta::DeleteObjectTag{}, &timestamp, 0);
+
+  cache.Store(vertex, &head, 5, 10, MakeVersion(1));
+  EXPECT_EQ(cache.Find(vertex, &head, 5), nullptr);
+  ASSERT_NE(cache.Find(vertex, &head, 6), nullptr);
+  ASSERT_NE(cache.Find(vertex, &head, 10), nullptr);
+  EXPECT_EQ(cache.Find(vertex, &head, 11), nullptr);
+  EXPECT_EQ(cache.Find(vertex, &head, 7)->properties.begin()->second.ValueInt(), 1);
+
+  // A new delta was prepended to the chain.
+  EXPECT_EQ(cache.Find(vertex, &other_head, 7), nullptr);
+  // The head delta was freed and another one was allocated in its place.
+  timestamp = 20;
+  EXPECT_EQ(cache.Find(vertex, &head, 7), nullptr);
+
+  cache.Clear();
+  timestamp = 10;
+  EXPECT_EQ(cache.Find(vertex, &head, 7), nullptr);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexVersionCache, Capacity) {
+  VertexVersionCache disabled(0);
+  EXPECT_FALSE(disabled.Enabled());
+
+  // The capacity is split between 64 shards, so this is one entry per shard.
+  VertexVersionCache cache(64);
+  std::atomic<uint64_t> timestamp{10};
+  std::deque<int64_t> vertices(10000);
+  Delta head(Delta::DeleteObjectTag{}, &timestamp, 0);
+  for (auto &vertex : vertices) {
+    cache.Store(reinterpret_cast<Vertex const *>(&vertex), &head, 0, 10, CachedVertexVersion{});
+  }
+  uint64_t cached = 0;
+  for (auto &vertex : vertices) {
+    if (cache.Find(reinterpret_cast<Vertex const *>(&vertex), &head, 5)) ++cached;
+  }
+  EXPECT_GT(cached, 0);
+  EXPECT_LE(cached, 64);
+}
+
+// Readers with different snapshots of a frequently updated vertex have to see
+// their own versions even though they share the cache.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(VertexVersionCache, SharedBetweenTransactions) {
+  std::unique_ptr<memgraph::storage::Storage> storage(std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}}));
+  const auto property = storage->NameToProperty("property");
+  const auto updates = static_cast<int64_t>(FLAGS_delta_chain_cache_threshold) * 2;
+
+  memgraph::storage::Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(0)).HasError());
+    gid = vertex.Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  auto get_property = [&](memgraph::storage::Storage::Accessor *acc) {
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    EXPECT_TRUE(vertex.has_value());
+    return vertex->GetProperty(property, memgraph::storage::View::OLD)->ValueInt();
+  };
+
+  auto first_acc = storage->Access();
+  auto second_acc = storage->Access();
+  for (int64_t i = 1; i <= updates; ++i) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(i)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  auto third_acc = storage->Access();
+
+  // The first reader caches the version, the second one uses it.
+  EXPECT_EQ(get_property(first_acc.get()), 0);
+  EXPECT_EQ(get_property(second_acc.get()), 0);
+  EXPECT_EQ(get_property(third_acc.get()), updates);
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(-1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  EXPECT_EQ(get_property(first_acc.get()), 0);
+  EXPECT_EQ(get_property(third_acc.get()), updates);
+  auto acc = storage->Access();
+  EXPECT_EQ(get_property(acc.get()), -1);
+}
@@ -48,6 +48,30 @@ memgraph::storage::durability::WalDeltaData::Type StorageGlobalOperationToWalDel
       return memgraph::storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE;
     case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
       return memgraph::storage::durability::WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_TYPE_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_TYPE_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::EDGE_TYPE_PROPERTY_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::TEXT_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::TEXT_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::TEXT_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::TEXT_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::POINT_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::POINT_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::POINT_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::POINT_INDEX_DROP;
+    case memgraph::storage::durability::StorageGlobalOperation::VECTOR_INDEX_CREATE:
+      return memgraph::storage::durability::WalDeltaData::Type::VECTOR_INDEX_CREATE;
+    case memgraph::storage::durability::StorageGlobalOperation::VECTOR_INDEX_DROP:
+      return memgraph::storage::durability::WalDeltaData::Type::VECTOR_INDEX_DROP;
   }
 }
 
@@ -211,11 +235,11 @@ class DeltaGenerator final {
   }
 
   void AppendOperation(memgraph::storage::durability::StorageGlobalOperation operation, const std::string &label,
-                       const std::set<std::string> properties = {}) {
+                       const std::vector<std::string> properties = {}) {
     auto label_id = memgraph::storage::LabelId::FromUint(mapper_.NameToId(label));
-    std::set<memgraph::storage::PropertyId> property_ids;
+    std::vector<memgraph::storage::PropertyId> property_ids;
     for (const auto &property : properties) {
-      property_ids.insert(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+      property_ids.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
     }
     wal_file_.AppendOperation(operation, label_id, property_ids, timestamp_);
     if (valid_) {
@@ -236,7 +260,49 @@ class DeltaGenerator final {
         case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageGlobalOperation::UNIQUE_CONSTRAINT_DROP:
           data.operation_label_properties.label = label;
-          data.operation_label_properties.properties = properties;
+          data.operation_label_properties.properties = {properties.begin(), properties.end()};
+          break;
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          data.operation_label_property_list.label = label;
+          data.operation_label_property_list.properties = properties;
+          break;
+        case memgraph::storage::durability::StorageGlobalOperation::TEXT_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::TEXT_INDEX_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::POINT_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::POINT_INDEX_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::VECTOR_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::VECTOR_INDEX_DROP:
+          data.operation_label_property.label = label;
+          data.operation_label_property.property = *properties.begin();
+          break;
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_INDEX_DROP:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_CREATE:
+        case memgraph::storage::durability::StorageGlobalOperation::EDGE_TYPE_PROPERTY_INDEX_DROP:
+          LOG_FATAL("Edge type operations have to be appended with AppendEdgeTypeOperation!");
+      }
+      data_.emplace_back(timestamp_, data);
+    }
+  }
+
+  void AppendEdgeTypeOperation(memgraph::storage::durability::StorageGlobalOperation operation,
+                               const std::string &edge_type, const std::vector<std::string> properties = {}) {
+    auto edge_type_id = memgraph::storage::EdgeTypeId::FromUint(mapper_.NameToId(edge_type));
+    std::vector<memgraph::storage::PropertyId> property_ids;
+    for (const auto &property : properties) {
+      property_ids.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+    }
+    wal_file_.AppendOperation(operation, edge_type_id, property_ids, timestamp_);
+    if (valid_) {
+      UpdateStats(timestamp_, 1);
+      memgraph::storage::durability::WalDeltaData data;
+      data.type = StorageGlobalOperationToWalDeltaDataType(operation);
+      if (properties.empty()) {
+        data.operation_edge_type.edge_type = edge_type;
+      } else {
+        data.operation_edge_type_property.edge_type = edge_type;
+        data.operation_edge_type_property.property = *properties.begin();
       }
       data_.emplace_back(timestamp_, data);
     }
@@ -300,6 +366,9 @@ class DeltaGenerator final {
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define OPERATION(op, ...) gen.AppendOperation(memgraph::storage::durability::StorageGlobalOperation::op, __VA_ARGS__)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define EDGE_TYPE_OPERATION(op, ...) \
+  gen.AppendEdgeTypeOperation(memgraph::storage::durability::StorageGlobalOperation::op, __VA_ARGS__)
 
 void AssertWalInfoEqual(const memgraph::storage::durability::WalInfo &a,
                         const memgraph::storage::durability::WalInfo &b) {
@@ -528,6 +597,18 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION(EXISTENCE_CONSTRAINT_DROP, "hello", {"world"});
   OPERATION(UNIQUE_CONSTRAINT_CREATE, "hello", {"world", "and", "universe"});
   OPERATION(UNIQUE_CONSTRAINT_DROP, "hello", {"world", "and", "universe"});
+  OPERATION(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, "hello", {"world", "and", "universe"});
+  OPERATION(LABEL_PROPERTY_COMPOSITE_INDEX_DROP, "hello", {"world", "and", "universe"});
+  OPERATION(TEXT_INDEX_CREATE, "hello", {"world"});
+  OPERATION(TEXT_INDEX_DROP, "hello", {"world"});
+  OPERATION(POINT_INDEX_CREATE, "hello", {"world"});
+  OPERATION(POINT_INDEX_DROP, "hello", {"world"});
+  OPERATION(VECTOR_INDEX_CREATE, "hello", {"world"});
+  OPERATION(VECTOR_INDEX_DROP, "hello", {"world"});
+  EDGE_TYPE_OPERATION(EDGE_TYPE_INDEX_CREATE, "hello");
+  EDGE_TYPE_OPERATION(EDGE_TYPE_INDEX_DROP, "hello");
+  EDGE_TYPE_OPERATION(EDGE_TYPE_PROPERTY_INDEX_CREATE, "hello", {"world"});
+  EDGE_TYPE_OPERATION(EDGE_TYPE_PROPERTY_INDEX_DROP, "hello", {"world"});
 });
 
 // NOLINTNEXTLINE(hicpp-special-member-functions)
@@ -496,6 +496,45 @@ TYPED_TEST(AllTypesFixture, AssignmentWithMemoryResource) {
   }
 }
 
+class CountingMemory final : public memgraph::utils::MemoryResource {
+ public:
+  size_t allocations_{0};
+
+ private:
+  void *DoAllocate(size_t bytes, size_t alignment) override {
+    ++allocations_;
+    return memgraph::utils::NewDeleteResource()->Allocate(bytes, alignment);
+  }
+  void DoDeallocate(void *p, size_t bytes, size_t alignment) override {
+    memgraph::utils::NewDeleteResource()->Deallocate(p, bytes, alignment);
+  }
+  bool DoIsEqual(const MemoryResource &other) const noexcept override { return this == &other; }
+};
+
+TEST(TypedValue, AssignmentReusesMemory) {
+  CountingMemory memory;
+  const TypedValue long_string("a string which doesn't fit into the string object");
+  const TypedValue other_long_string("another string which doesn't fit into the string object");
+  TypedValue string_value(other_long_string, &memory);
+  const auto string_allocations = memory.allocations_;
+  string_value = long_string;
+  EXPECT_EQ(string_value.ValueString(), long_string.ValueString());
+  string_value = TypedValue(other_long_string);
+  EXPECT_EQ(string_value.ValueString(), other_long_string.ValueString());
+  EXPECT_EQ(memory.allocations_, string_allocations);
+  EXPECT_EQ(string_value.GetMemoryResource(), &memory);
+
+  const TypedValue list(std::vector<TypedValue>{TypedValue(1), TypedValue(2), TypedValue(3)});
+  const TypedValue other_list(std::vector<TypedValue>{TypedValue(4), TypedValue(5)});
+  TypedValue list_value(list, &memory);
+  const auto list_allocations = memory.allocations_;
+  list_value = other_list;
+  EXPECT_EQ(list_value.ValueList().size(), 2U);
+  EXPECT_EQ(list_value.ValueList()[1].ValueInt(), 5);
+  EXPECT_EQ(memory.allocations_, list_allocations);
+  EXPECT_EQ(list_value.ValueList()[1].GetMemoryResource(), &memory);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(AllTypesFixture, PropagationOfMemoryOnConstruction) {
   memgraph::utils::MonotonicBufferResource monotonic_memory(1024);
@@ -9,10 +9,13 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <array>
 #include <chrono>
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -276,6 +279,111 @@ TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   }
 }
 
+TEST_F(UtilsFileTest, OutputFilePreallocate) {
+  memgraph::utils::OutputFile handle;
+  const auto path = storage / "existing_dir_777" / "preallocated";
+  handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  if (!handle.Preallocate(1024 * 1024)) {
+    GTEST_SKIP() << "The file system doesn't support preallocation.";
+  }
+  ASSERT_EQ(handle.GetSize(), 0);
+  handle.Write("hello world!\n");
+  handle.Sync();
+  handle.Close();
+  ASSERT_EQ(fs::file_size(path), 13);
+}
+
+TEST_F(UtilsFileTest, OutputFileDirectIO) {
+  memgraph::utils::OutputFile handle;
+  const auto path = storage / "existing_dir_777" / "direct_io";
+  handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  std::string expected = "header";
+  handle.Write(expected);
+  handle.Sync();
+  if (!handle.EnableDirectIO()) {
+    GTEST_SKIP() << "The file system doesn't support direct I/O.";
+  }
+  // Writes cross whole blocks and the buffer, and are flushed in the middle of
+  // a block.
+  for (int i = 0; i < 100000; ++i) {
+    const auto value = std::to_string(i);
+    handle.Write(value);
+    expected += value;
+    if (i % 1000 == 0) handle.Flush();
+  }
+  ASSERT_EQ(handle.GetSize(), expected.size());
+  ASSERT_EQ(handle.GetPosition(), expected.size());
+  const auto [buffer, buffer_size] = handle.CurrentBuffer();
+  ASSERT_EQ(handle.GetWrittenSize() + buffer_size, expected.size());
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(buffer), buffer_size),
+            std::string_view(expected).substr(handle.GetWrittenSize()));
+  handle.Sync();
+  handle.Close();
+
+  std::ifstream file(path, std::ios::binary);
+  const std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  ASSERT_EQ(content, expected);
+}
+
+TEST_F(UtilsFileTest, OutputFileWriteThrottle) {
+  constexpr uint64_t kBytesPerSecond = 10 * 1024 * 1024;
+  memgraph::utils::WriteThrottle throttle(kBytesPerSecond);
+  memgraph::utils::OutputFile handle;
+  handle.Open(storage / "existing_dir_777" / "throttled", memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  handle.SetWriteThrottle(&throttle);
+  // The first buffer is written right away, each following one waits for the
+  // ones before it.
+  const std::string data(memgraph::utils::kFileBufferSize, 'a');
+  constexpr uint64_t kBuffers = 12;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < kBuffers; ++i) {
+    handle.Write(data);
+  }
+  handle.Sync();
+  handle.Close();
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  ASSERT_GE(elapsed, std::chrono::duration<double>(static_cast<double>((kBuffers - 1) * data.size()) /
+                                                   static_cast<double>(kBytesPerSecond)));
+}
+
+TEST_F(UtilsFileTest, InputFileMemoryMapped) {
+  const auto path = storage / "existing_dir_777" / "memory_mapped_file";
+  {
+    memgraph::utils::OutputFile handle;
+    handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    handle.Write("hello world!", 12);
+    handle.Sync();
+    handle.Close();
+  }
+
+  memgraph::utils::InputFile handle;
+  ASSERT_TRUE(handle.Open(path, memgraph::utils::InputFile::Mode::MEMORY_MAPPED));
+  ASSERT_EQ(handle.GetSize(), 12);
+
+  std::array<uint8_t, 5> data{};
+  ASSERT_TRUE(handle.Peek(data.data(), data.size()));
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(data.data()), data.size()), "hello");
+  ASSERT_TRUE(handle.Read(data.data(), data.size()));
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(data.data()), data.size()), "hello");
+  ASSERT_EQ(handle.GetPosition(), 5);
+
+  const auto *mapped = handle.ReadMapped(7);
+  ASSERT_NE(mapped, nullptr);
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(mapped), 7), " world!");
+  ASSERT_EQ(handle.ReadMapped(1), nullptr);
+  ASSERT_FALSE(handle.Read(data.data(), 1));
+
+  ASSERT_EQ(handle.SetPosition(memgraph::utils::InputFile::Position::RELATIVE_TO_END, -6), 6);
+  ASSERT_TRUE(handle.Read(data.data(), 5));
+  ASSERT_EQ(std::string_view(reinterpret_cast<const char *>(data.data()), 5), "world");
+  ASSERT_FALSE(handle.SetPosition(memgraph::utils::InputFile::Position::SET, 13));
+  handle.Close();
+
+  // Buffered files can't be read in place.
+  ASSERT_TRUE(handle.Open(path));
+  ASSERT_EQ(handle.ReadMapped(1), nullptr);
+}
+
 TEST_F(UtilsFileTest, ConcurrentReadingAndWritting) {
   const auto file_path = storage / "existing_dir_777" / "existing_file_777";
   memgraph::utils::OutputFile handle;
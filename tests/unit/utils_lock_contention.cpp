@@ -0,0 +1,91 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include "utils/lock_contention.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/scalable_rw_lock.hpp"
+
+using memgraph::utils::lock_wait_counters;
+using memgraph::utils::LockContentionTable;
+
+TEST(LockContentionTable, AccumulatesWaits) {
+  LockContentionTable table;
+  table.Record(1, 10);
+  table.Record(2, 50);
+  table.Record(1, 30);
+
+  const auto entries = table.Entries();
+  ASSERT_EQ(entries.size(), 2);
+  EXPECT_EQ(entries[0].key, 2);
+  EXPECT_EQ(entries[0].waits, 1);
+  EXPECT_EQ(entries[0].wait_ns, 50);
+  EXPECT_EQ(entries[1].key, 1);
+  EXPECT_EQ(entries[1].waits, 2);
+  EXPECT_EQ(entries[1].wait_ns, 40);
+}
+
+TEST(LockContentionTable, ReplacesLeastWaited) {
+  LockContentionTable table;
+  for (uint64_t key = 0; key < LockContentionTable::kCapacity; ++key) {
+    table.Record(key, 100 + 10 * key);
+  }
+  table.Record(1000, 1);
+
+  const auto entries = table.Entries();
+  ASSERT_EQ(entries.size(), LockContentionTable::kCapacity);
+  // The new key takes over the wait of the key it replaced.
+  EXPECT_EQ(entries.back().key, 1000);
+  EXPECT_EQ(entries.back().waits, 2);
+  EXPECT_EQ(entries.back().wait_ns, 101);
+  EXPECT_EQ(entries.front().key, LockContentionTable::kCapacity - 1);
+}
+
+TEST(LockWaitCounters, UncontendedLocksAreNotCounted) {
+  const auto before = lock_wait_counters;
+  memgraph::utils::RWSpinLock spin_lock;
+  { std::unique_lock guard{spin_lock}; }
+  { std::shared_lock guard{spin_lock}; }
+  memgraph::utils::ScalableRWLock rw_lock;
+  { std::unique_lock guard{rw_lock}; }
+  { std::shared_lock guard{rw_lock}; }
+  EXPECT_EQ(lock_wait_counters.contentions, before.contentions);
+  EXPECT_EQ(lock_wait_counters.wait_ns, before.wait_ns);
+}
+
+TEST(LockWaitCounters, ContendedLockIsRecorded) {
+  memgraph::utils::RWSpinLock lock;
+  LockContentionTable table;
+  const auto before = lock_wait_counters;
+
+  std::unique_lock holder{lock};
+  std::thread waiter([&] {
+    std::unique_lock guard{lock, std::defer_lock};
+    memgraph::utils::LockAndRecordContention(guard, table, 42);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  holder.unlock();
+  waiter.join();
+
+  // The waiter counted the wait in its own counters.
+  EXPECT_EQ(lock_wait_counters.contentions, before.contentions);
+  const auto entries = table.Entries();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_EQ(entries[0].key, 42);
+  EXPECT_EQ(entries[0].waits, 1);
+  EXPECT_GE(entries[0].wait_ns, 10'000'000);
+}
@@ -270,6 +270,30 @@ TEST(PoolResource, BigBlockAllocations) {
   CheckAllocation(&mem, max_block_size + 1, 1U);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(PoolResource, Stats) {
+  const size_t max_blocks_per_chunk = 3U;
+  const size_t max_block_size = 64U;
+  memgraph::utils::PoolResource mem(max_blocks_per_chunk, max_block_size);
+  CheckAllocation(&mem, 8U, 1U);
+  CheckAllocation(&mem, max_block_size, 1U);
+  CheckAllocation(&mem, max_block_size + 1, 1U);
+  CheckAllocation(&mem, max_block_size * 2, 1U);
+  CheckAllocation(&mem, max_block_size * 4, 1U);
+  mem.Release();
+  const auto &stats = mem.GetStats();
+  EXPECT_EQ(stats.pooled, 2U);
+  EXPECT_EQ(stats.unpooled, 3U);
+  // 65 and 128 bytes round up to 128, 256 bytes is a class of its own.
+  EXPECT_EQ(stats.unpooled_by_size_class[7], 2U);
+  EXPECT_EQ(stats.unpooled_by_size_class[8], 1U);
+
+  auto total = stats;
+  total += stats;
+  EXPECT_EQ(total.pooled, 4U);
+  EXPECT_EQ(total.unpooled_by_size_class[7], 4U);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST(PoolResource, BlockSizeIsNotMultipleOfAlignment) {
   const size_t max_blocks_per_chunk = 3U;
@@ -353,6 +377,28 @@ TEST(MonotonicBufferResource, ResetGrowthFactor) {
   ASSERT_EQ(test_mem.allocated_sizes_.front(), test_mem.allocated_sizes_.back());
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(TrackingMemoryResource, CountsAndLimitsAllocations) {
+  memgraph::utils::MemoryTracker tracker;
+  tracker.SetHardLimit(1024);
+  memgraph::utils::TrackingMemoryResource mem(&tracker, memgraph::utils::NewDeleteResource());
+
+  auto *first = mem.Allocate(512);
+  auto *second = mem.Allocate(256);
+  EXPECT_EQ(tracker.Amount(), 768);
+  EXPECT_THROW(mem.Allocate(512), memgraph::utils::OutOfMemoryException);
+  EXPECT_EQ(tracker.Amount(), 768);
+
+  mem.Deallocate(first, 512);
+  EXPECT_EQ(tracker.Amount(), 256);
+  auto *third = mem.Allocate(512);
+  EXPECT_EQ(tracker.Amount(), 768);
+  mem.Deallocate(second, 256);
+  mem.Deallocate(third, 512);
+  EXPECT_EQ(tracker.Amount(), 0);
+  EXPECT_EQ(tracker.Peak(), 768);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 class ContainerWithAllocatorLast final {
  public:
@@ -68,3 +68,98 @@ TEST(MemoryTrackerTest, ExceptionBlocker) {
   }
   ASSERT_THROW(memory_tracker.Alloc(hard_limit + 1), memgraph::utils::OutOfMemoryException);
 }
+
+TEST(MemoryTrackerTest, ParentLimits) {
+  memgraph::utils::MemoryTracker parent;
+  parent.SetHardLimit(100);
+  memgraph::utils::MemoryTracker::OutOfMemoryExceptionEnabler exception_enabler;
+  {
+    memgraph::utils::MemoryTracker first{&parent};
+    memgraph::utils::MemoryTracker second{&parent};
+    first.SetHardLimit(80);
+
+    first.Alloc(60);
+    ASSERT_THROW(first.Alloc(30), memgraph::utils::OutOfMemoryException);
+    second.Alloc(30);
+    ASSERT_EQ(parent.Amount(), 90);
+    // Over the limit of the parent, so neither tracker is charged.
+    ASSERT_THROW(second.Alloc(20), memgraph::utils::OutOfMemoryException);
+    ASSERT_EQ(second.Amount(), 30);
+    ASSERT_EQ(parent.Amount(), 90);
+
+    second.Free(10);
+    ASSERT_EQ(parent.Amount(), 80);
+    ASSERT_EQ(parent.Peak(), 90);
+  }
+  // The children return what is still charged to them when destroyed.
+  ASSERT_EQ(parent.Amount(), 0);
+}
+
+TEST(MemoryTrackerTest, ThreadTrackerScope) {
+  using memgraph::utils::MemoryTracker;
+  static constexpr int64_t batch = MemoryTracker::kThreadBatchSize;
+
+  MemoryTracker outer;
+  MemoryTracker inner;
+  MemoryTracker::ThreadAlloc(batch);
+  {
+    MemoryTracker::ThreadTrackerScope outer_scope{&outer};
+    MemoryTracker::ThreadAlloc(batch / 2);
+    // Charged only once the thread allocated a whole batch.
+    ASSERT_EQ(outer.Amount(), 0);
+    {
+      MemoryTracker::ThreadTrackerScope inner_scope{&inner};
+      ASSERT_EQ(outer.Amount(), batch / 2);
+      MemoryTracker::ThreadAlloc(batch);
+      ASSERT_EQ(inner.Amount(), batch);
+      MemoryTracker::ThreadAlloc(10);
+      MemoryTracker::ThreadFree(20);
+    }
+    ASSERT_EQ(inner.Amount(), batch - 10);
+    MemoryTracker::ThreadFree(batch / 2);
+  }
+  ASSERT_EQ(outer.Amount(), 0);
+  MemoryTracker::ThreadFree(batch);
+  ASSERT_EQ(outer.Amount(), 0);
+  ASSERT_EQ(inner.Amount(), batch - 10);
+}
+
+TEST(MemoryTrackerTest, ThreadTrackerScopeLimit) {
+  using memgraph::utils::MemoryTracker;
+  static constexpr int64_t batch = MemoryTracker::kThreadBatchSize;
+
+  MemoryTracker tracker;
+  tracker.SetHardLimit(2 * batch);
+  MemoryTracker::OutOfMemoryExceptionEnabler exception_enabler;
+  {
+    MemoryTracker::ThreadTrackerScope scope{&tracker};
+    MemoryTracker::ThreadAlloc(batch);
+    ASSERT_EQ(tracker.Amount(), batch);
+    MemoryTracker::ThreadAlloc(batch / 2);
+    ASSERT_THROW(MemoryTracker::ThreadAlloc(batch), memgraph::utils::OutOfMemoryException);
+    // The failed allocation isn't charged, the one before it still is.
+    ASSERT_EQ(tracker.Amount(), batch);
+  }
+  ASSERT_EQ(tracker.Amount(), batch + batch / 2);
+}
+
+TEST(MemoryTrackerTest, TotalBatches) {
+  using memgraph::utils::kTotalMemoryBatchSize;
+  auto &total = memgraph::utils::total_memory_tracker;
+  const auto initial = total.Amount();
+
+  std::thread thread{[&] {
+    memgraph::utils::TrackTotalAlloc(kTotalMemoryBatchSize / 2);
+    ASSERT_EQ(total.Amount(), initial);
+    memgraph::utils::TrackTotalAlloc(kTotalMemoryBatchSize / 2);
+    ASSERT_EQ(total.Amount(), initial + kTotalMemoryBatchSize);
+    memgraph::utils::TrackTotalAlloc(10);
+    ASSERT_EQ(total.Amount(), initial + kTotalMemoryBatchSize);
+  }};
+  thread.join();
+  // The rest is charged when the thread exits.
+  ASSERT_EQ(total.Amount(), initial + kTotalMemoryBatchSize + 10);
+
+  memgraph::utils::TrackTotalFree(kTotalMemoryBatchSize + 10);
+  ASSERT_EQ(total.Amount(), initial);
+}
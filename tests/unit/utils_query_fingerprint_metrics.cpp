@@ -0,0 +1,91 @@
+// Copyright 2023 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "utils/query_fingerprint_metrics.hpp"
+
+using memgraph::metrics::QueryFingerprints;
+
+TEST(QueryFingerprints, Disabled) {
+  QueryFingerprints fingerprints{0};
+  EXPECT_EQ(fingerprints.Execute(1), nullptr);
+  EXPECT_TRUE(fingerprints.Tracked().empty());
+}
+
+TEST(QueryFingerprints, CountsExecutions) {
+  QueryFingerprints fingerprints{10};
+  auto first = fingerprints.Execute(1);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->hash, 1);
+  EXPECT_EQ(fingerprints.Execute(1), first);
+  fingerprints.Execute(2);
+
+  const auto tracked = fingerprints.Tracked();
+  ASSERT_EQ(tracked.size(), 2);
+  EXPECT_EQ(tracked[0]->hash, 1);
+  EXPECT_EQ(tracked[0]->executions, 2);
+  EXPECT_EQ(tracked[1]->hash, 2);
+  EXPECT_EQ(tracked[1]->executions, 1);
+}
+
+TEST(QueryFingerprints, EvictsLeastExecuted) {
+  QueryFingerprints fingerprints{2};
+  for (int i = 0; i < 4; ++i) fingerprints.Execute(1);
+  fingerprints.Execute(2);
+  auto evicted = fingerprints.Execute(2);
+  evicted->rows += 5;
+
+  // The new fingerprint takes over the count of the evicted one.
+  fingerprints.Execute(3);
+  auto tracked = fingerprints.Tracked();
+  ASSERT_EQ(tracked.size(), 2);
+  EXPECT_EQ(tracked[0]->hash, 1);
+  EXPECT_EQ(tracked[1]->hash, 3);
+  EXPECT_EQ(tracked[1]->executions, 3);
+  EXPECT_EQ(tracked[1]->rows, 0);
+  // The metrics of the evicted fingerprint stay valid.
+  EXPECT_EQ(evicted->rows, 5);
+
+  fingerprints.SetCapacity(1);
+  tracked = fingerprints.Tracked();
+  ASSERT_EQ(tracked.size(), 1);
+  EXPECT_EQ(tracked[0]->hash, 1);
+}
+
+TEST(QueryFingerprints, LatencyPercentiles) {
+  QueryFingerprints fingerprints{1};
+  auto metrics = fingerprints.Execute(1);
+  for (uint64_t latency = 1; latency <= 100; ++latency) metrics->latency_us.Measure(latency * 1000);
+  const auto percentiles = metrics->latency_us.YieldPercentiles();
+  ASSERT_EQ(percentiles.size(), 3);
+  EXPECT_EQ(percentiles[0].first, 50);
+  EXPECT_NEAR(percentiles[0].second, 50000, 1000);
+  EXPECT_EQ(percentiles[2].first, 99);
+  EXPECT_NEAR(percentiles[2].second, 99000, 1500);
+}
+
+TEST(QueryFingerprints, Concurrent) {
+  QueryFingerprints fingerprints{8};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&fingerprints, t] {
+      for (uint64_t i = 0; i < 10000; ++i) {
+        if (auto metrics = fingerprints.Execute(i % 16 + t)) metrics->rows.fetch_add(1);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  EXPECT_EQ(fingerprints.Tracked().size(), 8);
+}
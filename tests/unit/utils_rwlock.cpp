@@ -15,6 +15,7 @@
 #include "gtest/gtest.h"
 
 #include "utils/rw_lock.hpp"
+#include "utils/scalable_rw_lock.hpp"
 #include "utils/timer.hpp"
 
 using namespace std::chrono_literals;
@@ -152,3 +153,122 @@ TEST(RWLock, TryLock) {
   });
   t5.join();
 }
+
+TEST(ScalableRWLock, MultipleReaders) {
+  memgraph::utils::ScalableRWLock rwlock;
+
+  std::vector<std::thread> threads;
+  memgraph::utils::Timer timer;
+  for (int i = 0; i < 3; ++i) {
+    threads.push_back(std::thread([&rwlock] {
+      std::shared_lock<memgraph::utils::ScalableRWLock> lock(rwlock);
+      std::this_thread::sleep_for(100ms);
+    }));
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    threads[i].join();
+  }
+
+  EXPECT_LE(timer.Elapsed(), 150ms);
+  EXPECT_GE(timer.Elapsed(), 90ms);
+}
+
+TEST(ScalableRWLock, WritePriority) {
+  /*
+   * - Main thread is holding a shared lock until T = 100ms.
+   * - Thread 1 tries to acquire an unique lock at T = 30ms.
+   * - Thread 2 tries to acquire a shared lock at T = 60ms, but it is not able
+   *   to because of write priority.
+   */
+  memgraph::utils::ScalableRWLock rwlock;
+  rwlock.lock_shared();
+  bool first = true;
+
+  std::thread t1([&rwlock, &first] {
+    std::this_thread::sleep_for(30ms);
+    std::unique_lock<memgraph::utils::ScalableRWLock> lock(rwlock);
+    EXPECT_TRUE(first);
+    first = false;
+  });
+
+  std::thread t2([&rwlock, &first] {
+    std::this_thread::sleep_for(60ms);
+    std::shared_lock<memgraph::utils::ScalableRWLock> lock(rwlock);
+    EXPECT_FALSE(first);
+  });
+
+  std::this_thread::sleep_for(100ms);
+  rwlock.unlock_shared();
+
+  t1.join();
+  t2.join();
+}
+
+TEST(ScalableRWLock, TryLock) {
+  memgraph::utils::ScalableRWLock rwlock;
+  rwlock.lock();
+
+  std::thread t1([&rwlock] { EXPECT_FALSE(rwlock.try_lock()); });
+  t1.join();
+
+  std::thread t2([&rwlock] { EXPECT_FALSE(rwlock.try_lock_shared()); });
+  t2.join();
+
+  rwlock.unlock();
+
+  std::thread t3([&rwlock] {
+    EXPECT_TRUE(rwlock.try_lock());
+    rwlock.unlock();
+  });
+  t3.join();
+
+  rwlock.lock_shared();
+
+  std::thread t4([&rwlock] {
+    EXPECT_TRUE(rwlock.try_lock_shared());
+    rwlock.unlock_shared();
+    EXPECT_FALSE(rwlock.try_lock());
+  });
+  t4.join();
+}
+
+TEST(ScalableRWLock, UnlockSharedOnOtherThread) {
+  memgraph::utils::ScalableRWLock rwlock;
+  rwlock.lock_shared();
+
+  std::thread t1([&rwlock] { rwlock.unlock_shared(); });
+  t1.join();
+
+  EXPECT_TRUE(rwlock.try_lock());
+  rwlock.unlock();
+}
+
+TEST(ScalableRWLock, ExclusiveAccess) {
+  memgraph::utils::ScalableRWLock rwlock;
+  static constexpr int kThreads = 4;
+  static constexpr int kIterations = 10000;
+  int64_t first = 0;
+  int64_t second = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.push_back(std::thread([&, i] {
+      for (int j = 0; j < kIterations; ++j) {
+        if ((i + j) % 8 == 0) {
+          std::unique_lock<memgraph::utils::ScalableRWLock> lock(rwlock);
+          ++first;
+          ++second;
+        } else {
+          std::shared_lock<memgraph::utils::ScalableRWLock> lock(rwlock);
+          EXPECT_EQ(first, second);
+        }
+      }
+    }));
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(first, kThreads * kIterations / 8);
+}
@@ -600,6 +600,19 @@ TEST(TemporalTest, LocalDateTimeAdditionSubtraction) {
                memgraph::utils::BasicException);
 }
 
+TEST(TemporalTest, LocalDateTimeOrdering) {
+  const auto before_unix_epoch = memgraph::utils::LocalDateTime({1969, 12, 31}, {23, 59, 59, 999, 999});
+  const auto unix_epoch = memgraph::utils::LocalDateTime({1970, 1, 1}, {});
+  const auto later_that_day = memgraph::utils::LocalDateTime({1970, 1, 1}, {.microsecond = 1});
+  ASSERT_LT(before_unix_epoch, unix_epoch);
+  ASSERT_LT(unix_epoch, later_that_day);
+  ASSERT_EQ(before_unix_epoch, memgraph::utils::LocalDateTime(-1));
+  ASSERT_EQ(memgraph::utils::LocalDateTime(-1).date, memgraph::utils::Date({1969, 12, 31}));
+  ASSERT_EQ(before_unix_epoch + memgraph::utils::Duration({.microsecond = 1}), unix_epoch);
+  ASSERT_THROW(memgraph::utils::LocalDateTime({9999, 12, 31}, {23}) + memgraph::utils::Duration({.hour = 1}),
+               memgraph::utils::BasicException);
+}
+
 TEST(TemporalTest, LocalDateTimeDelta) {
   const auto unix_epoch = memgraph::utils::LocalDateTime({1970, 1, 1}, {1, 1, 1});
   const auto one_year_after_unix_epoch = memgraph::utils::LocalDateTime({1971, 2, 1}, {12, 1, 1});
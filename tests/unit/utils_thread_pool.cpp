@@ -13,7 +13,10 @@
 
 #include <atomic>
 #include <chrono>
+#include <mutex>
+#include <set>
 #include <thread>
+#include <vector>
 
 #include <utils/thread_pool.hpp>
 
@@ -38,3 +41,59 @@ TEST(ThreadPool, Basic) {
     ASSERT_EQ(count.load(), adder_count);
   }
 }
+
+TEST(ThreadPool, Priorities) {
+  memgraph::utils::ThreadPool pool{1};
+
+  std::atomic<bool> blocked{true};
+  pool.AddTask([&] {
+    while (blocked.load()) std::this_thread::sleep_for(1ms);
+  });
+
+  std::mutex lock;
+  std::vector<int> order;
+  const auto record = [&](int value) {
+    return [&, value] {
+      std::lock_guard guard(lock);
+      order.push_back(value);
+    };
+  };
+  pool.AddTask(record(2), memgraph::utils::TaskPriority::LOW);
+  pool.AddTask(record(1), memgraph::utils::TaskPriority::NORMAL);
+  pool.AddTask(record(0), memgraph::utils::TaskPriority::HIGH);
+  blocked.store(false);
+
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(order, (std::vector<int>{0, 1, 2}));
+}
+
+TEST(ThreadPool, StealsNestedTasks) {
+  static constexpr size_t pool_size = 4;
+  memgraph::utils::ThreadPool pool{pool_size};
+
+  // All of the tasks are queued at the worker running the first one, the
+  // other workers have to steal them.
+  std::mutex lock;
+  std::set<std::thread::id> threads;
+  std::atomic<int> count{0};
+  pool.AddTask([&] {
+    for (int i = 0; i < 1000; ++i) {
+      pool.AddTask([&] {
+        {
+          std::lock_guard guard(lock);
+          threads.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(100us);
+        count.fetch_add(1);
+      });
+    }
+  });
+
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ASSERT_EQ(count.load(), 1000);
+  ASSERT_GT(threads.size(), 1);
+}